@@ -34,6 +34,7 @@
  * maintained and there may be no bug maintenance planned for these resources.
  * Silicon Labs may update projects from time to time.
  ******************************************************************************/
+#include <string.h>
 #include "sl_common.h"
 #include "gpiointerrupt.h"
 #include "sl_simple_led_instances.h"
@@ -58,11 +59,35 @@
 // Flag set each time sleep timer callback to trigger bluetooth external signal
 #define TIMER_CALLBACK_FLAG   (1 << 0)
 
-// Earth's gravity in m/s^2
-#define GRAVITY_EARTH         (9.80665f)
 // 39.0625us per tick
 #define SENSOR_TICK_TO_S      (0.0000390625f)
 
+// Output data rate of the accelerometer, both as register value and in Hz
+#define ACCEL_ODR             BMA400_ODR_100HZ
+#define ACCEL_ODR_HZ          100
+#define ACCEL_SAMPLE_PERIOD_US  (1000000UL / ACCEL_ODR_HZ)
+// Range of the accelerometer in g, 12-bit samples
+#define ACCEL_RANGE           BMA400_RANGE_2G
+#define ACCEL_RANGE_G         2
+#define ACCEL_HALF_SCALE      2048
+
+// Frames the sensor collects in its FIFO before raising the watermark
+// interrupt. 32 frames at 100 Hz wake the MCU every 320 ms.
+#define ACCEL_FIFO_WATERMARK_FRAMES  32
+// Header byte followed by 12-bit X, Y and Z
+#define ACCEL_FIFO_FRAME_SIZE 7
+#define ACCEL_FIFO_SIZE       1024
+#define ACCEL_FIFO_FRAMES_MAX (ACCEL_FIFO_SIZE / ACCEL_FIFO_FRAME_SIZE)
+
+// Notification: timestamp of the first sample in ms (4 bytes, little endian),
+// sample count (1 byte) then 1 byte per X-, Y- and Z-axis for every sample
+#define ACCEL_PACKET_HEADER_SIZE  5
+#define ACCEL_SAMPLE_SIZE         3
+// Length of the acceleration characteristic
+#define ACCEL_PACKET_SIZE_MAX     244
+#define ATT_HEADER_SIZE           3
+#define ATT_MTU_DEFAULT           23
+
 static struct bma400_dev bma;
 // set sleep timer handle
 static sl_sleeptimer_timer_handle_t led_blinky_timer;
@@ -71,13 +96,26 @@ static uint8_t advertising_set_handle = 0xff;
 // If the notification is enabled or not
 static uint8_t notification_enabled = 0;
 static int16_t connection_handle = 0xff;
+static uint16_t att_mtu = ATT_MTU_DEFAULT;
+
+static struct bma400_fifo_data fifo_frame;
+static uint8_t fifo_buffer[ACCEL_FIFO_SIZE + BMA400_FIFO_BYTES_OVERREAD];
+// Samples left over from a failed notification, followed by a full FIFO
+static struct bma400_fifo_sensor_data accel_frames[2 * ACCEL_FIFO_FRAMES_MAX];
+// Samples at the start of accel_frames still waiting to be notified
+static uint16_t accel_pending = 0;
+static uint8_t accel_packet[ACCEL_PACKET_SIZE_MAX];
 
 static void app_gpio_int_cb(uint8_t intNo);
 static void app_bma400_config(void);
 static void app_bma400_get_data(uint32_t extsignals);
 static void led_blinky_timer_callback(sl_sleeptimer_timer_handle_t *handle,
                                       void *data);
-static float lsb_to_ms2(int16_t accel_data, uint8_t g_range, uint8_t bit_width);
+static uint16_t app_send_samples(
+  const struct bma400_fifo_sensor_data *frames,
+  uint16_t count,
+  uint32_t last_ms);
+static uint8_t lsb_to_ms2_x10(int16_t accel_data);
 
 /**************************************************************************//**
  * Application Init.
@@ -160,7 +198,9 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     case sl_bt_evt_connection_closed_id:
 
       notification_enabled = 0;
+      accel_pending = 0;
       connection_handle = 0xff;
+      att_mtu = ATT_MTU_DEFAULT;
       sl_sleeptimer_start_periodic_timer_ms(&led_blinky_timer,
                                             800,
                                             led_blinky_timer_callback,
@@ -179,6 +219,11 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     // Add additional event handlers here as your application requires!      //
     ///////////////////////////////////////////////////////////////////////////
 
+    case sl_bt_evt_gatt_mtu_exchanged_id:
+      // Larger MTU, more samples per notification
+      att_mtu = evt->data.evt_gatt_mtu_exchanged.mtu;
+      break;
+
     case sl_bt_evt_gatt_server_characteristic_status_id:
 
       if (evt->data.evt_gatt_server_characteristic_status.characteristic
@@ -190,6 +235,7 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
           notification_enabled = 1;
         } else {
           notification_enabled = 0;
+          accel_pending = 0;
         }
       }
 
@@ -210,6 +256,7 @@ static void app_bma400_config(void)
 {
   int8_t rslt;
   struct bma400_sensor_conf conf;
+  struct bma400_device_conf fifo_conf;
   struct bma400_int_enable int_en;
 
   GPIO_PinModeSet(MIKROE_BMA400_INT1_PORT,
@@ -258,8 +305,8 @@ static void app_bma400_config(void)
              "[E: 0x%04x] Failed to init BMA400 interface\r\n",
              (int)rslt);
   conf.param.accel.int_chan = BMA400_INT_CHANNEL_1;
-  conf.param.accel.odr = BMA400_ODR_25HZ;
-  conf.param.accel.range = BMA400_RANGE_2G;
+  conf.param.accel.odr = ACCEL_ODR;
+  conf.param.accel.range = ACCEL_RANGE;
   conf.param.accel.data_src = BMA400_DATA_SRC_ACCEL_FILT_1;
   // Set the desired configurations to the sensor
   rslt = bma400_set_sensor_conf(&conf, 1, &bma);
@@ -272,7 +319,26 @@ static void app_bma400_config(void)
              "[E: 0x%04x] Failed to init BMA400 interface\r\n",
              (int)rslt);
 
-  int_en.type = BMA400_DRDY_INT_EN;
+  // Collect samples in the FIFO, interrupt once the watermark is reached
+  fifo_conf.type = BMA400_FIFO_CONF;
+  rslt = bma400_get_device_conf(&fifo_conf, 1, &bma);
+  app_assert(rslt == BMA400_OK,
+             "[E: 0x%04x] Failed to init BMA400 interface\r\n",
+             (int)rslt);
+  fifo_conf.param.fifo_conf.conf_regs = BMA400_FIFO_X_EN
+                                        | BMA400_FIFO_Y_EN
+                                        | BMA400_FIFO_Z_EN;
+  fifo_conf.param.fifo_conf.conf_status = BMA400_ENABLE;
+  fifo_conf.param.fifo_conf.fifo_watermark = ACCEL_FIFO_WATERMARK_FRAMES
+                                             * ACCEL_FIFO_FRAME_SIZE;
+  fifo_conf.param.fifo_conf.fifo_wm_channel = BMA400_INT_CHANNEL_1;
+  fifo_conf.param.fifo_conf.fifo_full_channel = BMA400_UNMAP_INT_PIN;
+  rslt = bma400_set_device_conf(&fifo_conf, 1, &bma);
+  app_assert(rslt == BMA400_OK,
+             "[E: 0x%04x] Failed to init BMA400 interface\r\n",
+             (int)rslt);
+
+  int_en.type = BMA400_FIFO_WM_INT_EN;
   int_en.conf = BMA400_ENABLE;
   rslt = bma400_enable_interrupt(&int_en, 1, &bma);
   app_assert(rslt == BMA400_OK,
@@ -291,12 +357,11 @@ static void led_blinky_timer_callback(sl_sleeptimer_timer_handle_t *handle,
 static void app_bma400_get_data(uint32_t extsignals)
 {
   if (extsignals & TIMER_CALLBACK_FLAG) {
-    sl_status_t sc;
     int8_t rslt;
-    struct bma400_sensor_data accel_data_raw;
-    struct bma400_sensor_data accel_data_ms2;
     uint16_t int_status = 0;
-    uint8_t accel_buffer[3];
+    uint16_t frame_count;
+    uint16_t sent;
+    uint64_t now_ms;
 
     rslt = bma400_get_interrupt_status(&int_status, &bma);
     if (rslt != BMA400_OK) {
@@ -304,50 +369,110 @@ static void app_bma400_get_data(uint32_t extsignals)
       return;
     }
 
-    if (int_status & BMA400_ASSERTED_DRDY_INT) {
-      rslt = bma400_get_accel_data(BMA400_DATA_SENSOR_TIME,
-                                   &accel_data_raw,
-                                   &bma);
+    if (int_status & BMA400_ASSERTED_FIFO_WM_INT) {
+      // Empty the FIFO in a single burst read
+      fifo_frame.data = fifo_buffer;
+      fifo_frame.length = sizeof(fifo_buffer);
+      rslt = bma400_get_fifo_data(&fifo_frame, &bma);
+      if (rslt != BMA400_OK) {
+        app_log("[E: 0x%04x] Failed to get FIFO data\r\n", (int)rslt);
+        return;
+      }
+      (void)sl_sleeptimer_tick64_to_ms(sl_sleeptimer_get_tick_count64(),
+                                       &now_ms);
+
+      // New samples follow the ones still pending, the sensor sampled them
+      // without a gap
+      frame_count = ACCEL_FIFO_FRAMES_MAX;
+      rslt = bma400_extract_accel(&fifo_frame,
+                                  &accel_frames[accel_pending],
+                                  &frame_count,
+                                  &bma);
       if (rslt != BMA400_OK) {
-        app_log("[E: 0x%04x] Failed to get accel data\r\n", (int)rslt);
+        app_log("[E: 0x%04x] Failed to extract accel data\r\n", (int)rslt);
         return;
       }
+      frame_count += accel_pending;
 
-      /* 12-bit accelerometer at range 2G */
-      accel_data_ms2.x = (int16_t) (10 * lsb_to_ms2(accel_data_raw.x, 2, 12));
-      accel_buffer[0] = (uint8_t) abs(accel_data_ms2.x);
-      accel_data_ms2.y = (int16_t) (10 * lsb_to_ms2(accel_data_raw.y, 2, 12));
-      accel_buffer[1] = (uint8_t) abs(accel_data_ms2.y);
-      accel_data_ms2.z = (int16_t) (10 * lsb_to_ms2(accel_data_raw.z, 2, 12));
-      accel_buffer[2] = (uint8_t) abs(accel_data_ms2.z);
-
-      sc = sl_bt_gatt_server_write_attribute_value(gattdb_acceleration,
-                                                   0,
-                                                   3,
-                                                   accel_buffer);
-      app_assert_status(sc);
+      // The last frame was sampled just before the read
+      sent = app_send_samples(accel_frames, frame_count, (uint32_t)now_ms);
+
+      // Keep what a failed notification left behind for the next
+      // watermark, dropping the oldest samples if it does not fit
+      accel_pending = SL_MIN(frame_count - sent, ACCEL_FIFO_FRAMES_MAX);
+      memmove(accel_frames,
+              &accel_frames[frame_count - accel_pending],
+              accel_pending * sizeof(accel_frames[0]));
+    }
+  }
+}
 
-      if ((notification_enabled == 1) && (connection_handle != 0xff)) {
-        sc = sl_bt_gatt_server_send_notification(connection_handle,
-                                                 gattdb_acceleration,
-                                                 3,
-                                                 accel_buffer);
+static uint16_t app_send_samples(
+  const struct bma400_fifo_sensor_data *frames,
+  uint16_t count,
+  uint32_t last_ms)
+{
+  sl_status_t sc;
+  uint16_t per_packet;
+  uint16_t first;
+  uint16_t n;
+  uint16_t len = 0;
+  uint32_t timestamp;
+
+  // As many samples as fit in one notification with the current MTU
+  per_packet = (SL_MIN(att_mtu - ATT_HEADER_SIZE, ACCEL_PACKET_SIZE_MAX)
+                - ACCEL_PACKET_HEADER_SIZE) / ACCEL_SAMPLE_SIZE;
+
+  for (first = 0; first < count; first += n) {
+    n = SL_MIN(per_packet, count - first);
+    timestamp = last_ms
+                - (uint32_t)(((uint64_t)(count - 1 - first)
+                              * ACCEL_SAMPLE_PERIOD_US) / 1000);
+
+    accel_packet[0] = (uint8_t)timestamp;
+    accel_packet[1] = (uint8_t)(timestamp >> 8);
+    accel_packet[2] = (uint8_t)(timestamp >> 16);
+    accel_packet[3] = (uint8_t)(timestamp >> 24);
+    accel_packet[4] = (uint8_t)n;
+    len = ACCEL_PACKET_HEADER_SIZE;
+    for (uint16_t i = first; i < first + n; i++) {
+      accel_packet[len++] = lsb_to_ms2_x10(frames[i].x);
+      accel_packet[len++] = lsb_to_ms2_x10(frames[i].y);
+      accel_packet[len++] = lsb_to_ms2_x10(frames[i].z);
+    }
 
-        app_assert_status(sc);
+    if ((notification_enabled == 1) && (connection_handle != 0xff)) {
+      sc = sl_bt_gatt_server_send_notification(connection_handle,
+                                               gattdb_acceleration,
+                                               len,
+                                               accel_packet);
+      if (sc != SL_STATUS_OK) {
+        app_log("[E: 0x%04x] Failed to send notification\r\n", (int)sc);
+        break;
       }
     }
   }
+
+  // Reads return the most recent packet
+  if (len) {
+    sc = sl_bt_gatt_server_write_attribute_value(gattdb_acceleration,
+                                                 0,
+                                                 len,
+                                                 accel_packet);
+    app_assert_status(sc);
+  }
+  return first;
 }
 
-static float lsb_to_ms2(int16_t accel_data, uint8_t g_range, uint8_t bit_width)
+// Absolute acceleration in 0.1 m/s^2, truncated like the former float
+// conversion: |a| * range * 9.80665 * 10 / half scale
+static uint8_t lsb_to_ms2_x10(int16_t accel_data)
 {
-  float accel_ms2;
-  int16_t half_scale;
-
-  half_scale = 1 << (bit_width - 1);
-  accel_ms2 = (GRAVITY_EARTH * accel_data * g_range) / half_scale;
+  uint32_t magnitude = (accel_data < 0) ? (uint32_t)(-accel_data)
+                      : (uint32_t)accel_data;
 
-  return accel_ms2;
+  return (uint8_t)((magnitude * ACCEL_RANGE_G * 196133UL)
+                   / (ACCEL_HALF_SCALE * 2000UL));
 }
 
 static void app_gpio_int_cb(uint8_t intNo)
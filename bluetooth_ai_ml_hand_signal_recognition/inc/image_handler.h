@@ -37,15 +37,30 @@
 #ifndef IMAGE_HANDLER_H_
 #define IMAGE_HANDLER_H_
 
+#include <stdint.h>
 #include "sl_status.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Capture counters
+typedef struct {
+  // Number of frames captured since setup
+  uint32_t frames_captured;
+  // Achieved frame rate over the last second, in 0.1 frame/s
+  uint32_t frames_per_second_x10;
+  // Start of the last capture, in sleeptimer milliseconds
+  uint32_t last_capture_ms;
+} mlx90640_capture_stats_t;
+
 sl_status_t mlx90640_setup(uint32_t inference_ms);
+
+// Captures a new frame. The frame stays valid until the next call.
 sl_status_t mlx90640_read_image(float **image_data, int *image_size);
 
+void mlx90640_get_capture_stats(mlx90640_capture_stats_t *stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -80,16 +80,17 @@ public:
     return results_[back_index];
   }
 
-  void push_back(const Result& entry)
+  bool push_back(const Result& entry)
   {
     if (size() >= MAX_RESULT_COUNT) {
       TF_LITE_REPORT_ERROR(
         error_reporter_,
         "Couldn't push_back latest result, too many already!");
-      return;
+      return false;
     }
     size_ += 1;
     back() = entry;
+    return true;
   }
 
   Result pop_front()
@@ -180,6 +181,8 @@ private:
   uint8_t previous_top_label_index_;
   int32_t previous_top_label_time_;
   int32_t suppression_remaining_;
+  // Sum of the scores of each category over the results in the queue
+  uint32_t score_sums_[TFLITE_MODEL_CLASS_COUNT];
 };
 
 #endif // RECOGNIZE_COMMANDS_H_
@@ -100,6 +100,12 @@ sl_status_t hand_signal_recognition_init(void)
       );
   command_recognizer = &static_recognizer;
 
+  // SL_TFLITE_MICRO_ARENA_SIZE can be trimmed down to the used size
+  app_log("Model input: %s, tensor arena used: %u bytes\n",
+          (sl_tflite_micro_get_input_tensor()->type == kTfLiteInt8)
+          ? "int8" : "float32",
+          (unsigned int)sl_tflite_micro_get_interpreter()->arena_used_bytes());
+
   app_log("Start recognition.\n");
   return SL_STATUS_OK;
 }
@@ -157,6 +163,17 @@ void hand_signal_recognition_loop(void)
   }
 
   handle_result(current_time_stamp, found_command_index, score, is_new_command);
+
+  if (app_settings.verbose_inference_output) {
+    mlx90640_capture_stats_t stats;
+
+    mlx90640_get_capture_stats(&stats);
+    app_log("Frames: %lu, %lu.%lu fps, capture to decision: %lu ms\n",
+            stats.frames_captured,
+            stats.frames_per_second_x10 / 10,
+            stats.frames_per_second_x10 % 10,
+            current_time_stamp - stats.last_capture_ms);
+  }
 }
 
 /***************************************************************************//**
@@ -172,22 +189,20 @@ const char * get_category_label(int index)
 }
 
 /***************************************************************************//**
- * @brief Normalize the source buffer by mean and STD
- *
- * dst_float32 = (src - mean(src)) / std(src)
+ * @brief Calculate the mean and the reciprocal of the STD of the source buffer
  ******************************************************************************/
 template<typename SrcType>
-void samplewise_mean_std_tensor(const SrcType* src, float* dst, uint32_t length)
+static void samplewise_mean_std(const SrcType* src,
+                                uint32_t length,
+                                float* mean_out,
+                                float* std_recip_out)
 {
   float mean = 0.0f;
   float count = 0.0f;
   float m2 = 0.0f;
-  const SrcType *ptr;
 
-    // Calculate the STD and mean
-  ptr = src;
   for (int i = length; i > 0; --i) {
-    const float value = (float)(*ptr++);
+    const float value = (float)(*src++);
 
     count += 1;
 
@@ -198,32 +213,59 @@ void samplewise_mean_std_tensor(const SrcType* src, float* dst, uint32_t length)
   }
 
   const float variance = m2 / count;
-  const float std = sqrtf(variance);
-  const float std_recip = 1.0f / std; // multiplication is faster than division
-
-  // Subtract the mean and divide by the STD
-  ptr = src;
-  for (int i = length; i > 0; --i) {
-    const float value = (float)(*ptr++);
-    const float x = value - mean;
+  *mean_out = mean;
+  // multiplication is faster than division
+  *std_recip_out = 1.0f / sqrtf(variance);
+}
 
-    *dst++ = x * std_recip;
+/***************************************************************************//**
+ * @brief Normalize the source buffer into a float32 buffer
+ *
+ * dst_float32 = (src - offset) * multiplier
+ ******************************************************************************/
+template<typename SrcType>
+static void normalize_tensor(const SrcType* src,
+                             float* dst,
+                             uint32_t length,
+                             float offset,
+                             float multiplier)
+{
+  for (; length > 0; --length) {
+    const float value = (float)(*src++);
+    *dst++ = (value - offset) * multiplier;
   }
 }
 
 /***************************************************************************//**
- * @brief Scale the source buffer by the given scaler
+ * @brief Normalize and quantize the source buffer into an int8 buffer
  *
- * dst_float32 = src * scaler
+ * dst_int8 = round((src - offset) * multiplier / scale) + zero_point
+ *
+ * The quantization scale is folded into the multiplier, so both steps cost a
+ * single multiply-add per element.
  ******************************************************************************/
 template<typename SrcType>
-void scale_tensor(float scaler, const SrcType* src, float* dst, uint32_t length)
+static void normalize_quantize_tensor(const SrcType* src,
+                                      int8_t* dst,
+                                      uint32_t length,
+                                      float offset,
+                                      float multiplier,
+                                      const TfLiteQuantizationParams* params)
 {
-    for(; length > 0; --length)
-    {
-        const float src_flt = static_cast<SrcType>(*src++);
-        *dst++ = src_flt * scaler;
+  const float q_multiplier = multiplier / params->scale;
+  const float q_offset = (float)params->zero_point - offset * q_multiplier;
+
+  for (; length > 0; --length) {
+    const float value = (float)(*src++);
+    int32_t q = (int32_t)lrintf(value * q_multiplier + q_offset);
+
+    if (q < -128) {
+      q = -128;
+    } else if (q > 127) {
+      q = 127;
     }
+    *dst++ = (int8_t)q;
+  }
 }
 
 /***************************************************************************//**
@@ -231,15 +273,30 @@ void scale_tensor(float scaler, const SrcType* src, float* dst, uint32_t length)
  ******************************************************************************/
 static void standardize_image_data(float* image_data, uint32_t image_size)
 {
-  if(app_settings.samplewise_norm_rescale != 0) {
-    scale_tensor(app_settings.samplewise_norm_rescale,
-                 image_data,
-                 sl_tflite_micro_get_input_tensor()->data.f,
-                 image_size);
-  } else if(app_settings.samplewise_norm_mean_and_std) {
+  TfLiteTensor* input_tensor = sl_tflite_micro_get_input_tensor();
+  float offset = 0.0f;
+  float multiplier = 1.0f;
+
+  if (app_settings.samplewise_norm_rescale != 0) {
+    // input_tensor = image_data * rescale
+    multiplier = app_settings.samplewise_norm_rescale;
+  } else if (app_settings.samplewise_norm_mean_and_std) {
     // input_tensor = (image_data - mean(image_data)) / std(image_data)
-    samplewise_mean_std_tensor(image_data,
-                               sl_tflite_micro_get_input_tensor()->data.f,
-                               image_size);
+    samplewise_mean_std(image_data, image_size, &offset, &multiplier);
+  }
+
+  if (input_tensor->type == kTfLiteInt8) {
+    normalize_quantize_tensor(image_data,
+                              input_tensor->data.int8,
+                              image_size,
+                              offset,
+                              multiplier,
+                              &input_tensor->params);
+  } else {
+    normalize_tensor(image_data,
+                     input_tensor->data.f,
+                     image_size,
+                     offset,
+                     multiplier);
   }
 }
@@ -39,18 +39,80 @@
 #include "sparkfun_mlx90640.h"
 #include "image_handler.h"
 
-static sl_sleeptimer_timer_handle_t mlx90640_get_image_timer;
-static bool print_image = false;
+// MLX90640 status register, bit 3 is set when a new subpage is in RAM
+#define MLX90640_STATUS_REG             0x8000
+#define MLX90640_STATUS_NEW_DATA        0x0008
 
+static uint32_t frame_interval_ms;
+static uint32_t last_capture_ms;
+
+// The driver reads a frame in one blocking call from the main loop, so the
+// frame is always consumed before the next capture and one buffer is enough.
 static float mlx90640_image[SPARKFUN_MLX90640_NUM_OF_PIXELS];
 
-static void mlx90640_temperature_array_cb(
-  sl_sleeptimer_timer_handle_t *mlx90640_get_image_timer,
-  void *data)
+static mlx90640_capture_stats_t capture_stats;
+static uint32_t fps_window_start_ms;
+static uint32_t fps_window_frames;
+
+static uint32_t get_time_ms(void)
+{
+  return sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count());
+}
+
+/***************************************************************************//**
+ * Check the sensor status without waiting for a measurement.
+ ******************************************************************************/
+static bool mlx90640_has_new_data(void)
+{
+  I2C_TransferSeq_TypeDef seq;
+  uint8_t reg[2] = { MLX90640_STATUS_REG >> 8, MLX90640_STATUS_REG & 0xff };
+  uint8_t status[2] = { 0 };
+
+  seq.addr = SPARKFUN_MLX90640_DEFAULT_I2C_ADDR << 1;
+  seq.flags = I2C_FLAG_WRITE_READ;
+  seq.buf[0].data = reg;
+  seq.buf[0].len = sizeof(reg);
+  seq.buf[1].data = status;
+  seq.buf[1].len = sizeof(status);
+  if (I2CSPM_Transfer(sl_i2cspm_qwiic, &seq) != i2cTransferDone) {
+    return false;
+  }
+  return (status[1] & MLX90640_STATUS_NEW_DATA) != 0;
+}
+
+/***************************************************************************//**
+ * Capture a frame when the sensor has one.
+ ******************************************************************************/
+static sl_status_t mlx90640_capture(void)
 {
-  (void) mlx90640_get_image_timer;
-  (void) data;
-  print_image = true;
+  sl_status_t sc;
+  uint32_t now = get_time_ms();
+
+  // Start a capture only when the interval elapsed and the sensor already
+  // holds a subpage, so the first subpage read does not wait on the sensor.
+  if ((now - last_capture_ms < frame_interval_ms)
+      || !mlx90640_has_new_data()) {
+    return SL_STATUS_NOT_READY;
+  }
+  last_capture_ms = now;
+
+  sc = sparkfun_mlx90640_get_image_array(mlx90640_image);
+  if (sc != SL_STATUS_OK) {
+    return sc;
+  }
+  capture_stats.last_capture_ms = now;
+
+  // Update the achieved frame rate once per second
+  now = get_time_ms();
+  capture_stats.frames_captured++;
+  fps_window_frames++;
+  if (now - fps_window_start_ms >= 1000) {
+    capture_stats.frames_per_second_x10 = (fps_window_frames * 10000)
+                                          / (now - fps_window_start_ms);
+    fps_window_start_ms = now;
+    fps_window_frames = 0;
+  }
+  return SL_STATUS_OK;
 }
 
 /***************************************************************************//**
@@ -77,13 +139,11 @@ sl_status_t mlx90640_setup(uint32_t inference_ms)
   if (sc != SL_STATUS_OK) {
     return sc;
   }
-  sc = sl_sleeptimer_start_periodic_timer_ms(&mlx90640_get_image_timer,
-                                             inference_ms,
-                                             mlx90640_temperature_array_cb,
-                                             (void *) NULL,
-                                             0,
-                                             0);
-  return sc;
+
+  frame_interval_ms = inference_ms;
+  last_capture_ms = get_time_ms() - inference_ms;
+  fps_window_start_ms = get_time_ms();
+  return SL_STATUS_OK;
 }
 
 /***************************************************************************//**
@@ -93,11 +153,7 @@ sl_status_t mlx90640_read_image(float **image_data, int *image_size)
 {
   sl_status_t sc;
 
-  if (print_image == false) {
-    return SL_STATUS_NOT_READY;
-  }
-  print_image = false;
-  sc = sparkfun_mlx90640_get_image_array(mlx90640_image);
+  sc = mlx90640_capture();
   if (sc != SL_STATUS_OK) {
     return sc;
   }
@@ -107,3 +163,11 @@ sl_status_t mlx90640_read_image(float **image_data, int *image_size)
 
   return SL_STATUS_OK;
 }
+
+/***************************************************************************//**
+ * Get the capture counters.
+ ******************************************************************************/
+void mlx90640_get_capture_stats(mlx90640_capture_stats_t *stats)
+{
+  *stats = capture_stats;
+}
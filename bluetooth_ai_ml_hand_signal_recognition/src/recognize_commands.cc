@@ -33,6 +33,9 @@ RecognizeCommands::RecognizeCommands(tflite::ErrorReporter* error_reporter,
   previous_top_label_index_ = 0;
   previous_top_label_time_ = 0;
   suppression_remaining_ = 0;
+  for (int i = 0; i < TFLITE_MODEL_CLASS_COUNT; ++i) {
+    score_sums_[i] = 0;
+  }
 }
 
 TfLiteStatus RecognizeCommands::ProcessLatestResults(
@@ -52,24 +55,47 @@ TfLiteStatus RecognizeCommands::ProcessLatestResults(
   // Add the latest results to the head of the queue.
   uint8_t converted_scores[TFLITE_MODEL_CLASS_COUNT];
 
-  // Convert the model output from float32 to uint8
+  // Convert the model output from float32 or int8 to uint8
   if (latest_results->type == kTfLiteFloat32) {
     for(int i = 0; i < TFLITE_MODEL_CLASS_COUNT; ++i) {
       converted_scores[i] = (uint8_t)(latest_results->data.f[i] *255);
     }
+  } else if (latest_results->type == kTfLiteInt8) {
+    // Dequantize the probability, then scale it to the uint8 range
+    const float scale = latest_results->params.scale * 255;
+    const int32_t zero_point = latest_results->params.zero_point;
+    for(int i = 0; i < TFLITE_MODEL_CLASS_COUNT; ++i) {
+      float value = (latest_results->data.int8[i] - zero_point) * scale;
+      if (value < 0) {
+        value = 0;
+      } else if (value > 255) {
+        value = 255;
+      }
+      converted_scores[i] = (uint8_t)value;
+    }
   } else {
     TF_LITE_REPORT_ERROR(
           error_reporter_,
-          "Unsupported output tensor data type, must be float32");
+          "Unsupported output tensor data type, must be float32 or int8");
     return kTfLiteError;
   }
 
-  previous_results_.push_back({current_time_ms, converted_scores});
+  // Keep a running sum of the scores in the window, so that averaging costs
+  // the same whatever the window length.
+  if (previous_results_.push_back({current_time_ms, converted_scores})) {
+    for (int i = 0; i < TFLITE_MODEL_CLASS_COUNT; ++i) {
+      score_sums_[i] += converted_scores[i];
+    }
+  }
 
   // Prune any earlier results that are too old for the averaging window.
   const int64_t time_limit = current_time_ms - average_window_duration_ms_;
   while ((!previous_results_.empty())
          && previous_results_.front().time_ < time_limit) {
+    const uint8_t* scores = previous_results_.front().scores;
+    for (int i = 0; i < TFLITE_MODEL_CLASS_COUNT; ++i) {
+      score_sums_[i] -= scores[i];
+    }
     previous_results_.pop_front();
   }
 
@@ -96,22 +122,8 @@ TfLiteStatus RecognizeCommands::ProcessLatestResults(
 
   // Calculate the average score across all the results in the window.
   uint32_t average_scores[TFLITE_MODEL_CLASS_COUNT];
-  for (int offset = 0; offset < previous_results_.size(); ++offset) {
-    // Iterates the amount of times to achieve average_window_duration
-    PreviousResultsQueue::Result previous_result =
-      previous_results_.from_front(offset);
-    const uint8_t* scores = previous_result.scores;
-    for (int i = 0; i < TFLITE_MODEL_CLASS_COUNT; ++i) {
-      if (offset == 0) {
-        average_scores[i] = scores[i];
-      } else {
-        average_scores[i] += scores[i];
-      }
-    }
-  }
-
   for (int i = 0; i < TFLITE_MODEL_CLASS_COUNT; ++i) {
-    average_scores[i] /= how_many_results;
+    average_scores[i] = score_sums_[i] / how_many_results;
   }
 
   // Find the current highest scoring category.
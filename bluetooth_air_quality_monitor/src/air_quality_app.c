@@ -52,6 +52,7 @@
 #include "nvm3_user.h"
 #include "air_quality_app.h"
 #include "sparkfun_ccs811.h"
+#include "sample_filter.h"
 
 #define DATA_BUFFER_SIZE  5
 
@@ -66,10 +67,9 @@ const char air_quality_status_text[][12] = {
   "  SEVERE   "
 };
 
-// Buffer to store measurement data.
-static uint16_t co2_buffer[DATA_BUFFER_SIZE];
-static uint16_t tvoc_buffer[DATA_BUFFER_SIZE];
-static uint32_t samples_counter;
+// Last DATA_BUFFER_SIZE measurements, without the lowest and greatest
+static sample_filter_t co2_filter;
+static sample_filter_t tvoc_filter;
 
 // The instance for OLED LCD
 static glib_context_t glib_context;
@@ -104,7 +104,6 @@ static void air_quality_monitor_event_handler(void);
 static void air_quality_monitor_button_event_handler(void);
 static void air_quality_update_display(void);
 static void air_quality_data_process(void);
-static uint16_t air_quality_moving_average(uint16_t *data);
 
 static const unsigned char silicon_labs_logo_64x23[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -136,6 +135,17 @@ sl_status_t air_quality_app_init(void)
   // Initialize the oled
   oled_app_init();
 
+  status = sample_filter_init(&co2_filter,
+                              SAMPLE_FILTER_TRIMMED_MEAN,
+                              DATA_BUFFER_SIZE,
+                              0);
+  app_assert_status(status);
+  status = sample_filter_init(&tvoc_filter,
+                              SAMPLE_FILTER_TRIMMED_MEAN,
+                              DATA_BUFFER_SIZE,
+                              0);
+  app_assert_status(status);
+
   // Load configuration from NVM
   err = nvm3_load_configuration();
   if (err != ECODE_NVM3_OK) {
@@ -248,15 +258,13 @@ static void air_quality_monitor_event_handler(void)
   uint16_t _tvoc;
 
   if (sparkfun_ccs811_is_data_available()) {
-    uint8_t index = samples_counter % DATA_BUFFER_SIZE;
     // Get measurement data from the CCS811
     sparkfun_ccs811_get_measurement(&_eco2, &_tvoc);
 
     // Store measurement data.
     // appends a new value to the measurement data, removes the oldest one.
-    co2_buffer[index] = _eco2;
-    tvoc_buffer[index] = _tvoc;
-    samples_counter++;
+    sample_filter_push(&co2_filter, _eco2);
+    sample_filter_push(&tvoc_filter, _tvoc);
 
     // Run limit check and alarm logic
     air_quality_data_process();
@@ -563,49 +571,6 @@ void air_quality_user_write_callback(sl_bt_msg_t *evt)
   app_assert_status(status);
 }
 
-/***************************************************************************//**
- * @brief
- *  This function processes the measured values.
- *  Filters the lowest and greatest values, and calculates an average.
- *
- * @param[in] data
- *  Pointer to data storage structure
- *
- * @return
- *  Returns sample filtered.
- ******************************************************************************/
-static uint16_t air_quality_moving_average(uint16_t *data)
-{
-  uint32_t sum = 0;
-  uint16_t min, max;
-  uint8_t i;
-
-  if (!samples_counter) {
-    return 0;
-  }
-
-  // Calculate average value
-  min = max = data[0];
-  for (i = 0; i < samples_counter && i < DATA_BUFFER_SIZE; i++) {
-    sum += data[i];
-    if (data[i] > max) {
-      max = data[i];
-    }
-
-    if (data[i] < min) {
-      min = data[i];
-    }
-  }
-
-  // Exclude  min. and max. values
-  if (i > 2) {
-    i -= 2;
-    sum = sum - (min + max);
-  }
-
-  return (uint16_t) (sum / i);
-}
-
 /***************************************************************************//**
  * This function processes the measured values, checks the values against
  * the configured thresholds. If the measured value(s) are above
@@ -613,8 +578,8 @@ static uint16_t air_quality_moving_average(uint16_t *data)
  ******************************************************************************/
 static void air_quality_data_process(void)
 {
-  co2 = air_quality_moving_average(co2_buffer);
-  tvoc = air_quality_moving_average(tvoc_buffer);
+  co2 = (uint16_t)sample_filter_get(&co2_filter);
+  tvoc = (uint16_t)sample_filter_get(&tvoc_filter);
 
   // Ignore if notification is not enable
   if (0 == air_quality_data.notification_data) {
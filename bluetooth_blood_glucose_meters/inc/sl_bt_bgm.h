@@ -59,7 +59,7 @@ extern uint8_t security_level;
 #define SL_BGM_FAST_ADV_TIMEOUT   30 * 1000
 
 #define SIGNAL_FAST_ADV_TIMEOUT   1
-#define SIGNAL_REPORT_ALL         2
+#define SIGNAL_REPORT_RECORDS     2
 
 /**************************************************************************//**
  * Bluetooth stack event handler.
@@ -91,12 +91,12 @@ void sl_bt_bgm_read_feature(sl_bt_msg_t *evt);
 extern bool measure_enabled;
 #define BGM_DEFUALT_RECORDS_NUM 5
 
-/** @brief Glucose measurement records max number */
-#define MAX_RECORD_NUM          50
+/** @brief Glucose measurement records added by a medium button press */
+#define BGM_ADD_RECORDS_NUM     50
 // Glucose measurement current record number
 extern uint16_t records_num;
-// Glucose sequence number
-extern uint8_t seq_num;
+// Glucose sequence number of the newest record
+extern uint16_t seq_num;
 
 /* the BGM measurement struct:
  * 1. Flags field (containing units of glucose, the existence of context
@@ -130,11 +130,11 @@ extern uint8_t seq_num;
 #define UINT_MOLL_PRESENT                   0x04
 #define SENSOR_STATUS_PRESENT               0x08
 #define MEASURE_CONTEXT_PRESENT             0x10
-// Glucose measurement data
-#if SL_BT_BGM_STATUS_ANNUNCIATION_SUPPORTED
-extern uint8_t sl_glucose_records[MAX_RECORD_NUM][17];
+// Glucose measurement record length
+#if STATUS_ANNUNCIATION_SUPPORTED
+#define SL_BT_BGM_RECORD_LEN                17
 #else
-extern uint8_t sl_glucose_records[MAX_RECORD_NUM][15];
+#define SL_BT_BGM_RECORD_LEN                15
 #endif
 
 /* BGM has two filter types,
@@ -168,6 +168,80 @@ void sl_bt_bgm_measurement_context_handler(sl_bt_msg_t *evt);
 
 /** @} */ // end addtogroup measurement characteristic
 
+/**
+ * @addtogroup record store
+ * @{
+ *
+ * @brief persistent glucose measurement record store
+ *
+ * Records are kept in NVM3 in a ring indexed by sequence number, so the
+ * record with a given sequence number is found without a search. A RAM
+ * bitmap tells which slots hold a valid record.
+ */
+
+/** @brief Glucose measurement records kept in NVM3, shall be a power of two*/
+#define SL_BT_BGM_RECORD_STORE_CAPACITY     2048
+
+/**************************************************************************//**
+ * Load the record store index from NVM3.
+ *****************************************************************************/
+void sl_bt_bgm_record_store_init(void);
+
+/**************************************************************************//**
+ * Store a new record, the oldest record is replaced when the store is full.
+ * @param[in,out] record measurement record, the sequence number field is
+ *                filled in by the store
+ * @return SL_STATUS_OK if the record is written to NVM3
+ *****************************************************************************/
+sl_status_t sl_bt_bgm_record_store_append(uint8_t *record);
+
+/**************************************************************************//**
+ * Read a stored record.
+ * @param[in] seq sequence number of the record
+ * @param[out] record SL_BT_BGM_RECORD_LEN bytes of measurement record
+ * @return true if the record exists
+ *****************************************************************************/
+bool sl_bt_bgm_record_store_read(uint16_t seq, uint8_t *record);
+
+/**************************************************************************//**
+ * Sequence number of the oldest slot in the store.
+ *****************************************************************************/
+uint16_t sl_bt_bgm_record_store_oldest_seq(void);
+
+/**************************************************************************//**
+ * Find the first stored record in the sequence number range [*seq, high].
+ * @param[in,out] seq lower bound, sequence number of the record found
+ * @param[in] high upper bound
+ * @return true if a record is found
+ *****************************************************************************/
+bool sl_bt_bgm_record_store_next(uint16_t *seq, uint16_t high);
+
+/**************************************************************************//**
+ * Find the last stored record in the sequence number range [low, *seq].
+ * @param[in] low lower bound
+ * @param[in,out] seq upper bound, sequence number of the record found
+ * @return true if a record is found
+ *****************************************************************************/
+bool sl_bt_bgm_record_store_prev(uint16_t low, uint16_t *seq);
+
+/**************************************************************************//**
+ * Number of stored records in the sequence number range [low, high].
+ *****************************************************************************/
+uint16_t sl_bt_bgm_record_store_count(uint16_t low, uint16_t high);
+
+/**************************************************************************//**
+ * Delete the stored records in the sequence number range [low, high].
+ * @return number of records deleted
+ *****************************************************************************/
+uint16_t sl_bt_bgm_record_store_delete(uint16_t low, uint16_t high);
+
+/**************************************************************************//**
+ * Delete all the stored records. Sequence numbers are not reused.
+ *****************************************************************************/
+void sl_bt_bgm_record_store_delete_all(void);
+
+/** @} */ // end addtogroup record store
+
 /**
  * @addtogroup Record Access Control Point
  * @{
@@ -209,6 +283,7 @@ extern bool racp_enabled;
 #define OPERATOR_NOT_SUPPORT            0x04
 #define INVALID_OPERAND                 0x05
 #define NO_RECORDS_FOUND                0x06
+#define PROCEDURE_NOT_COMPLETED         0x08
 #define OPERAND_NOT_SUPPORTED           0x09
 #define PROCEDURE_ALREADY_IN_PROCESSED  0x80 /** <Procedure Already In
                                               *   Progress*/
@@ -247,9 +322,15 @@ void sl_bt_bgm_report_record(sl_bt_msg_t *evt);
 void sl_bt_bgm_report_all_records(uint8_t connection);
 
 /**************************************************************************//**
- * Report Stored Records – ‘All records’ callback
+ * Continue the running Report Stored Records procedure, sends notifications
+ * until the TX buffers are full.
+ *****************************************************************************/
+void sl_bt_bgm_report_resume(void);
+
+/**************************************************************************//**
+ * Stop the running Report Stored Records procedure without a response.
  *****************************************************************************/
-void sl_bt_signal_report_all_cb(void);
+void sl_bt_bgm_report_stop(void);
 
 /**************************************************************************//**
  * [Report Stored Records – ‘Less than or equal to Time Offset’]
@@ -40,15 +40,32 @@
 // Glucose measurement characteristic notification enable
 bool measure_enabled = false;
 static bool bgm_in_process = false;
-// Glucose measurement data
-#if STATUS_ANNUNCIATION_SUPPORTED
-uint8_t sl_glucose_records[MAX_RECORD_NUM][17] = { 0 };
-#else
-uint8_t sl_glucose_records[MAX_RECORD_NUM][15] = { 0 };
-#endif
 
-static app_timer_t bgm_report_all_timer;
-void sl_bt_bgm_report_all_timer_cb(app_timer_t *timer, void *data);
+// Notifications sent before yielding to the event loop
+#define SL_BT_BGM_REPORT_BURST          8
+// Retry delay when the stack is out of TX buffers, in ms
+#define SL_BT_BGM_REPORT_RETRY_INTERVAL 10
+// No limit on the number of reported records
+#define SL_BT_BGM_REPORT_NO_LIMIT       0xFFFF
+
+/* Report Stored Records procedure state. The matching records are found
+ * through the record store index, one at a time, so the procedure can stop
+ * when the TX buffers are full and resume later from the same record.
+ */
+typedef struct {
+  uint8_t connection;
+  uint16_t seq;            // sequence number of the record to send
+  uint16_t high;           // last sequence number matching the filter
+  uint16_t remaining;      // records left to send
+  uint16_t sent;           // records sent
+  bool with_context;       // send a measurement context after each record
+  bool context_pending;    // measurement sent, context not sent yet
+  uint32_t start_tick;
+} bgm_report_t;
+
+static bgm_report_t bgm_report;
+static app_timer_t bgm_report_retry_timer;
+static void sl_bt_bgm_report_retry_timer_cb(app_timer_t *timer, void *data);
 
 /**************************************************************************//**
  * BGM - BGM Measurement
@@ -76,10 +93,9 @@ void sl_bt_bgm_measurement_notification_handler(sl_bt_msg_t *evt)
 /**************************************************************************//**
  * add a glucose measurement record
  *****************************************************************************/
-void sli_bt_bgm_generate_record(uint16_t index)
+void sli_bt_bgm_generate_record(void)
 {
-  seq_num++;
-  uint8_t temp[15] = { 0 };
+  uint8_t temp[SL_BT_BGM_RECORD_LEN] = { 0 };
   // 1. flag
   temp[0] = TIME_OFFSET_PRESENT | CON_TYPE_SAMPLE_PRESENT | UINT_MOLL_PRESENT;
   // if unit to kg/L
@@ -89,8 +105,7 @@ void sli_bt_bgm_generate_record(uint16_t index)
 #endif
   // if measurement context is followed by measurement
   // temp[0] = temp[0] | MEASURE_CONTEXT_PRESENT;
-  // 2. seq num
-  temp[1] = seq_num, temp[2] = 0;
+  // 2. seq num, filled in by the record store
   // 3. base time 0xE507(year 2021), 7(month July), 5(day 5), 12 30
   //   5(12h:30m:5s)
   temp[3] = 0xE5, temp[4] = 7, temp[5] = 7, temp[6] = 5, temp[7] = 12;
@@ -107,15 +122,15 @@ void sli_bt_bgm_generate_record(uint16_t index)
   // 7. Annunciation uint16_t
 #if STATUS_ANNUNCIATION_SUPPORTED
 #endif
-  memcpy(sl_glucose_records[index], temp, sizeof(temp));
-  records_num++;
+  if (sl_bt_bgm_record_store_append(temp) != SL_STATUS_OK) {
+    app_log_warning("failed to store record\n");
+  }
 }
 
 // for GLS/SEN/SPT/BV-01-C [Service Procedure - Time Update]
-void sli_bt_bgm_time_update(uint16_t index, int8_t hour)
+void sli_bt_bgm_time_update(int8_t hour)
 {
-  seq_num++;
-  uint8_t temp[15] = { 0 };
+  uint8_t temp[SL_BT_BGM_RECORD_LEN] = { 0 };
   // 1. flag
   temp[0] = TIME_OFFSET_PRESENT | CON_TYPE_SAMPLE_PRESENT | UINT_MOLL_PRESENT;
   // if unit to kg/L
@@ -125,8 +140,7 @@ void sli_bt_bgm_time_update(uint16_t index, int8_t hour)
 #endif
   // if measurement context is followed by measurement
   // temp[0] = temp[0] | MEASURE_CONTEXT_PRESENT;
-  // 2. seq num
-  temp[1] = seq_num, temp[2] = 0;
+  // 2. seq num, filled in by the record store
   // 3. base time 0xE507(year 2021), 7(month July), 5(day 5), 12 30
   //   5(12h:30m:5s)
   temp[3] = 0xE5, temp[4] = 7, temp[5] = 7, temp[6] = 5, temp[7] = 12;
@@ -148,16 +162,17 @@ void sli_bt_bgm_time_update(uint16_t index, int8_t hour)
   // 7. Annunciation uint16_t
 #if STATUS_ANNUNCIATION_SUPPORTED
 #endif
-  memcpy(sl_glucose_records[index], temp, sizeof(temp));
-  records_num++;
+  if (sl_bt_bgm_record_store_append(temp) != SL_STATUS_OK) {
+    app_log_warning("failed to store record\n");
+  }
 }
 
-/* add 200 records at one time */
-void sl_bt_bgm_add_200_measurement_records(void)
+/* add BGM_ADD_RECORDS_NUM records at one time */
+void sl_bt_bgm_add_measurement_records(void)
 {
-  for (uint16_t i = records_num; i < MAX_RECORD_NUM; i++) {
+  for (uint16_t i = 0; i < BGM_ADD_RECORDS_NUM; i++) {
     app_log("add one record in loop\n");
-    sli_bt_bgm_generate_record(i);
+    sli_bt_bgm_generate_record();
   }
 }
 
@@ -191,44 +206,40 @@ void sl_button_on_change(const sl_button_t *handle)
   if (t_diff < sl_sleeptimer_ms_to_tick(SHORT_BUTTON_PRESS_DURATION)) {
     app_btn0_pressed = false;
     app_log("add one record\n");
-    sli_bt_bgm_generate_record(records_num);
+    sli_bt_bgm_generate_record();
   } else if (t_diff < sl_sleeptimer_ms_to_tick(MEDIUM_BUTTON_PRESS_DURATION)) {
-    app_log("add %d records\n", MAX_RECORD_NUM);
-    sl_bt_bgm_add_200_measurement_records();
+    app_log("add %d records\n", BGM_ADD_RECORDS_NUM);
+    sl_bt_bgm_add_measurement_records();
   } else if (t_diff < sl_sleeptimer_ms_to_tick(3000)) {
     app_log("update time 1 hours\n");
-    sli_bt_bgm_time_update(records_num, 1);
+    sli_bt_bgm_time_update(1);
   } else if (t_diff < sl_sleeptimer_ms_to_tick(6000)) {
     app_log("update time -2 hours\n");
-    sli_bt_bgm_time_update(records_num, -2);
+    sli_bt_bgm_time_update(-2);
   }
 }
 
 /**************************************************************************//**
- * 4.9.1 GLS/SEN/SPR/BV-01-C [Report Stored Records - All records]
+ * Measurement context sent with a record in Report Stored Records
  *****************************************************************************/
-#define REQUESTED_NOTIFICATION_INTERVAL 100
-void sl_bt_bgm_measurement_notificate(uint16_t index)
+static void sl_bt_bgm_measurement_context(uint16_t seq, uint8_t *context)
 {
-  sl_status_t sc = SL_STATUS_FAIL;
-  uint8_t context[20] = { 0 };
-
   /* 4.8 Characteristic notification
    *    context[0] = context[0] | SL_BT_BGM_CONTEXT_CARB;
-   *    context[1] = sl_glucose_records[i][1];  // seq num
-   *    context[2] = sl_glucose_records[i][2];
+   *    context[1] = seq & 0xFF;  // seq num
+   *    context[2] = seq >> 8;
    *    context[3] = 1;  //carb ID
    *    context[4] = 50; //carb value float
    *    context[5] = 208;
    *
    *    context[0] = context[0] | SL_BT_BGM_CONTEXT_MEAL;
-   *    context[1] = sl_glucose_records[i][1];
-   *    context[2] = sl_glucose_records[i][2];
+   *    context[1] = seq & 0xFF;
+   *    context[2] = seq >> 8;
    *    context[3] = 1; //meal breakfast
    *
    *    context[0] = context[0] | SL_BT_BGM_CONTEXT_TESTER;
-   *    context[1] = sl_glucose_records[i][1];
-   *    context[2] = sl_glucose_records[i][2];
+   *    context[1] = seq & 0xFF;
+   *    context[2] = seq >> 8;
    *    context[3] = 3; //lab test
    */
   context[0] = context[0] | SL_BT_BGM_CONTEXT_EXERCISE;
@@ -236,8 +247,8 @@ void sl_bt_bgm_measurement_notificate(uint16_t index)
   context[0] = context[0] | SL_BT_BGM_CONTEXT_MED_L;
   context[0] = context[0] | SL_BT_BGM_CONTEXT_HBA1C;
   // sequence number
-  context[1] = sl_glucose_records[index][1];
-  context[2] = sl_glucose_records[index][2];
+  context[1] = seq & 0xFF;
+  context[2] = seq >> 8;
   context[3] = 1; // exercise duration
   context[4] = 0;
   context[6] = 5; // exercise intensity
@@ -246,131 +257,206 @@ void sl_bt_bgm_measurement_notificate(uint16_t index)
   context[8] = 208; // SFLOAT -3
   context[9] = 50; // HbA1c 50 percent
   context[10] = 0; // sfloat 0
-
-  sc = sl_bt_gatt_server_send_notification(
-    connection,
-    gattdb_glucose_measurement,
-    sizeof(sl_glucose_records[0]),
-    sl_glucose_records[index]
-    );
-  if (sc) {
-    app_log_warning("send measurement fail in sending all records 0x%04lX\n",
-                    sc);
-    while (sc == SL_STATUS_NO_MORE_RESOURCE && sc != SL_STATUS_INVALID_HANDLE) {
-      sc = sl_bt_gatt_server_send_notification(
-        connection,
-        gattdb_glucose_measurement,
-        sizeof(sl_glucose_records[0]),
-        sl_glucose_records[index]
-        );
-    }
-  }
-  sc = sl_bt_gatt_server_send_notification(
-    connection,
-    gattdb_glucose_measurement_context,
-    sizeof(context),
-    context
-    );
-  if (sc) {
-    app_log_warning("send context fail in sending all records 0x%04lX\n", sc);
-    while (sc == SL_STATUS_NO_MORE_RESOURCE) {
-      sc = sl_bt_gatt_server_send_notification(
-        connection,
-        gattdb_glucose_measurement_context,
-        sizeof(context),
-        context
-        );
-    }
-  }
 }
 
-void sl_bt_bgm_report_all_timer_cb(app_timer_t *timer, void *data)
+static void sl_bt_bgm_report_retry_timer_cb(app_timer_t *timer, void *data)
 {
   (void)data;
   (void)timer;
-  sl_bt_external_signal(SIGNAL_REPORT_ALL);
+  sl_bt_external_signal(SIGNAL_REPORT_RECORDS);
 }
 
-void sl_bt_signal_report_all_cb(void)
+/**************************************************************************//**
+ * Start a Report Stored Records procedure over a sequence number range.
+ * @param[in] connection handle
+ * @param[in] low first sequence number of the filter
+ * @param[in] high last sequence number of the filter
+ * @param[in] max_count maximum number of records to send
+ * @param[in] with_context send a measurement context after each record
+ *****************************************************************************/
+static void sl_bt_bgm_report_start(uint8_t connection,
+                                   uint16_t low,
+                                   uint16_t high,
+                                   uint16_t max_count,
+                                   bool with_context)
 {
-  static uint16_t num = 0;
-
-  bgm_abort_operation_flag = false;
-
-  if (bgm_abort_operation_flag == true) {
-    bgm_abort_operation_flag = false;
-    app_log("set bgm_abort_operation_flag back to false\n");
-    bgm_in_process = false;
-    (void)app_timer_stop(&bgm_report_all_timer);
+  if (bgm_in_process == true) {
+    app_log("procedure already in process.\n");
+    sl_bt_bgm_send_racp_indication(connection, REPORT_STORED_RECORDS,
+                                   PROCEDURE_ALREADY_IN_PROCESSED);
+    return;
+  }
+  if (!sl_bt_bgm_record_store_next(&low, high)) {
+    app_log("no records\n");
+    sl_bt_bgm_send_racp_indication(connection, REPORT_STORED_RECORDS,
+                                   NO_RECORDS_FOUND);
     return;
   }
+  bgm_report.connection = connection;
+  bgm_report.seq = low;
+  bgm_report.high = high;
+  bgm_report.remaining = max_count;
+  bgm_report.sent = 0;
+  bgm_report.with_context = with_context;
+  bgm_report.context_pending = false;
+  bgm_report.start_tick = sl_sleeptimer_get_tick_count();
+  bgm_abort_operation_flag = false;
+  bgm_in_process = true;
+  sl_bt_bgm_report_resume();
+}
 
-  app_log("send %d\n", num);
-  sl_bt_bgm_measurement_notificate(num);
+/**************************************************************************//**
+ * Report Stored Records procedure completed.
+ *****************************************************************************/
+static void sl_bt_bgm_report_finish(void)
+{
+  uint32_t elapsed_ms;
 
-  num++;
-  if (num == records_num) {
-    app_log("finished send all records\n");
-    num = 0;
-    bgm_in_process = false;
-    (void)app_timer_stop(&bgm_report_all_timer);
-    sl_bt_bgm_send_racp_indication(connection,
-                                   REPORT_STORED_RECORDS, RSP_CODE_SUCCEED);
+  bgm_in_process = false;
+  elapsed_ms = sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count()
+                                        - bgm_report.start_tick);
+  app_log("finished send %d records in %lu ms",
+          bgm_report.sent, elapsed_ms);
+  if (elapsed_ms > 0) {
+    app_log(", %lu records/s",
+            (uint32_t)bgm_report.sent * 1000 / elapsed_ms);
   }
+  app_log("\n");
+  sl_bt_bgm_send_racp_indication(bgm_report.connection,
+                                 REPORT_STORED_RECORDS, RSP_CODE_SUCCEED);
 }
 
-void sl_bt_bgm_report_all_records(uint8_t connection)
+/**************************************************************************//**
+ * Report Stored Records procedure failed, a record could not be sent.
+ *****************************************************************************/
+static void sl_bt_bgm_report_fail(void)
 {
-  sl_status_t sc = SL_STATUS_FAIL;
+  bgm_in_process = false;
+  bgm_report.context_pending = false;
+  app_log("report stored records failed after %d records\n",
+          bgm_report.sent);
+  sl_bt_bgm_send_racp_indication(bgm_report.connection,
+                                 REPORT_STORED_RECORDS,
+                                 PROCEDURE_NOT_COMPLETED);
+}
+
+/**************************************************************************//**
+ * Continue the running Report Stored Records procedure.
+ *****************************************************************************/
+void sl_bt_bgm_report_resume(void)
+{
+  sl_status_t sc;
+  uint8_t record[SL_BT_BGM_RECORD_LEN];
+  uint8_t context[20];
+  uint8_t burst = 0;
+
   if (bgm_in_process == false) {
-    bgm_in_process = true;
-  } else {
-    app_log("procedure already in process.\n");
-    sl_bt_bgm_send_racp_indication(connection, REPORT_STORED_RECORDS,
-                                   PROCEDURE_ALREADY_IN_PROCESSED);
     return;
   }
-  if (records_num < 1) {
-    app_log("no records\n");
+  if (bgm_abort_operation_flag == true) {
+    bgm_abort_operation_flag = false;
+    app_log("report stored records aborted\n");
+    bgm_in_process = false;
     return;
   }
-  sc = app_timer_start(&bgm_report_all_timer,
-                       REQUESTED_NOTIFICATION_INTERVAL,
-                       sl_bt_bgm_report_all_timer_cb,
+  while (true) {
+    // give the other events a chance, continue from the event loop
+    if (burst == SL_BT_BGM_REPORT_BURST) {
+      sl_bt_external_signal(SIGNAL_REPORT_RECORDS);
+      return;
+    }
+    if ((bgm_report.context_pending == false)
+        && sl_bt_bgm_record_store_read(bgm_report.seq, record)) {
+      sc = sl_bt_gatt_server_send_notification(
+        bgm_report.connection,
+        gattdb_glucose_measurement,
+        sizeof(record),
+        record
+        );
+      if (sc == SL_STATUS_NO_MORE_RESOURCE) {
+        break;
+      } else if (sc) {
+        app_log_warning("send measurement fail 0x%04lX\n", sc);
+        sl_bt_bgm_report_fail();
+        return;
+      }
+      bgm_report.context_pending = bgm_report.with_context;
+      bgm_report.remaining--;
+      bgm_report.sent++;
+      burst++;
+    }
+    if (bgm_report.context_pending == true) {
+      memset(context, 0, sizeof(context));
+      sl_bt_bgm_measurement_context(bgm_report.seq, context);
+      sc = sl_bt_gatt_server_send_notification(
+        bgm_report.connection,
+        gattdb_glucose_measurement_context,
+        sizeof(context),
+        context
+        );
+      if (sc == SL_STATUS_NO_MORE_RESOURCE) {
+        break;
+      } else if (sc) {
+        app_log_warning("send context fail 0x%04lX\n", sc);
+        sl_bt_bgm_report_fail();
+        return;
+      }
+      bgm_report.context_pending = false;
+    }
+    if ((bgm_report.remaining == 0) || (bgm_report.seq == bgm_report.high)) {
+      sl_bt_bgm_report_finish();
+      return;
+    }
+    bgm_report.seq++;
+    if (!sl_bt_bgm_record_store_next(&bgm_report.seq, bgm_report.high)) {
+      sl_bt_bgm_report_finish();
+      return;
+    }
+  }
+  // TX buffers are full, retry after they had time to drain
+  sc = app_timer_start(&bgm_report_retry_timer,
+                       SL_BT_BGM_REPORT_RETRY_INTERVAL,
+                       sl_bt_bgm_report_retry_timer_cb,
                        NULL,
-                       true);
+                       false);
   if (sc != SL_STATUS_OK) {
-    app_log("bgm_report_timer failed 0x%04lX\n", sc);
+    app_log("bgm_report_retry_timer failed 0x%04lX\n", sc);
   }
 }
 
+/**************************************************************************//**
+ * Stop the running Report Stored Records procedure without a response.
+ *****************************************************************************/
+void sl_bt_bgm_report_stop(void)
+{
+  bgm_in_process = false;
+  bgm_report.context_pending = false;
+  (void)app_timer_stop(&bgm_report_retry_timer);
+}
+
+/**************************************************************************//**
+ * 4.9.1 GLS/SEN/SPR/BV-01-C [Report Stored Records - All records]
+ *****************************************************************************/
+void sl_bt_bgm_report_all_records(uint8_t connection)
+{
+  sl_bt_bgm_report_start(connection,
+                         0,
+                         0xFFFF,
+                         SL_BT_BGM_REPORT_NO_LIMIT,
+                         true);
+}
+
 /**************************************************************************//**
  * 4.9.2 GLS/SEN/SPR/BV-02-C
  * [Report Stored Records - Less than or equal to Sequence Number]
  *****************************************************************************/
 void sl_bt_bgm_report_record_less_than(uint8_t connection, uint16_t high)
 {
-  sl_status_t sc = SL_STATUS_FAIL;
-  if (high > records_num) {
-    high = records_num;
-  }
-  if (records_num > 0) {
-    for (uint8_t i = 0; i < high; i++) {
-      sc = sl_bt_gatt_server_send_notification(
-        connection,
-        gattdb_glucose_measurement,
-        sizeof(sl_glucose_records[0]),
-        sl_glucose_records[i]
-        );
-      app_log("send one record, high is %d, connect is %d\n", high, connection);
-    }
-  }
-  if (sc) {
-    app_log_warning("Failed to send less than records 0x%04lX\n", sc);
-  } else {
-    sl_bt_bgm_send_racp_indication(connection,
-                                   REPORT_STORED_RECORDS, RSP_CODE_SUCCEED);
-  }
+  sl_bt_bgm_report_start(connection,
+                         0,
+                         high,
+                         SL_BT_BGM_REPORT_NO_LIMIT,
+                         false);
 }
 
 /**************************************************************************//**
@@ -380,44 +466,21 @@ void sl_bt_bgm_report_record_less_than(uint8_t connection, uint16_t high)
 void sl_bt_bgm_report_records_greater_than(uint8_t connection,
                                            uint8_t filter_type, uint16_t low)
 {
-  sl_status_t sc = SL_STATUS_FAIL;
   // sequence number filter type
   if (filter_type == FILTER_TYPE_SEQ_NUM) {
-    if (records_num > 0) {
-      for (uint16_t i = low - 1 ; i < records_num; i++) {
-        sc = sl_bt_gatt_server_send_notification(
-          connection,
-          gattdb_glucose_measurement,
-          sizeof(sl_glucose_records[0]),
-          sl_glucose_records[i]
-          );
-      }
-    }
+    sl_bt_bgm_report_start(connection,
+                           low,
+                           0xFFFF,
+                           SL_BT_BGM_REPORT_NO_LIMIT,
+                           false);
   }
-  // user facing time filter
+  // user facing time filter, records are not indexed by time
   else if (filter_type == FILTER_TYPE_USER_FACING_TIME) {
-    // bgm_unsupported_operand(connection);
-    if (records_num > 0) {
-      for (uint16_t i = 0 ; i < 2; i++) {
-        sc = sl_bt_gatt_server_send_notification(
-          connection,
-          gattdb_glucose_measurement,
-          sizeof(sl_glucose_records[0]),
-          sl_glucose_records[i]
-          );
-      }
-    }
+    sl_bt_bgm_report_start(connection, 0, 0xFFFF, 2, false);
   }
   // unsupported operand
   else {
     sl_bt_bgm_unsupported_operand(connection);
-    return;
-  }
-  if (sc) {
-    app_log_warning("Failed to report greater than records\n");
-  } else {
-    sl_bt_bgm_send_racp_indication(connection,
-                                   REPORT_STORED_RECORDS, RSP_CODE_SUCCEED);
   }
 }
 
@@ -431,24 +494,11 @@ void sl_bt_bgm_report_records_within_range(uint8_t connection,
                                            uint16_t high)
 {
   (void)filter_type;
-  sl_status_t sc = SL_STATUS_FAIL;
-  if (records_num == 0) {
-    return;
-  }
-  for (uint16_t i = low; i <= high; i++) {
-    sc = sl_bt_gatt_server_send_notification(
-      connection,
-      gattdb_glucose_measurement,
-      sizeof(sl_glucose_records[0]),
-      sl_glucose_records[i]
-      );
-  }
-  if (sc) {
-    app_log_warning("Failed to send within records\n");
-  } else {
-    sl_bt_bgm_send_racp_indication(connection,
-                                   REPORT_STORED_RECORDS, RSP_CODE_SUCCEED);
-  }
+  sl_bt_bgm_report_start(connection,
+                         low,
+                         high,
+                         SL_BT_BGM_REPORT_NO_LIMIT,
+                         false);
 }
 
 /**************************************************************************//**
@@ -456,21 +506,7 @@ void sl_bt_bgm_report_records_within_range(uint8_t connection,
  *****************************************************************************/
 void sl_bt_bgm_report_first_record(uint8_t connection)
 {
-  sl_status_t sc = SL_STATUS_FAIL;
-  if ((measure_enabled == true) && (records_num > 0)) {
-    sc = sl_bt_gatt_server_send_notification(
-      connection,
-      gattdb_glucose_measurement,
-      sizeof(sl_glucose_records[0]),
-      sl_glucose_records[0]
-      );
-  }
-  if (sc) {
-    app_log_warning("Failed to send first record.\n");
-  } else {
-    sl_bt_bgm_send_racp_indication(connection,
-                                   REPORT_STORED_RECORDS, RSP_CODE_SUCCEED);
-  }
+  sl_bt_bgm_report_start(connection, 0, 0xFFFF, 1, false);
 }
 
 /**************************************************************************//**
@@ -478,19 +514,12 @@ void sl_bt_bgm_report_first_record(uint8_t connection)
  *****************************************************************************/
 void sl_bt_bgm_report_last_record(uint8_t connection)
 {
-  sl_status_t sc = SL_STATUS_FAIL;
-  if ((measure_enabled == true) && (records_num > 0)) {
-    sc = sl_bt_gatt_server_send_notification(
-      connection,
-      gattdb_glucose_measurement,
-      sizeof(sl_glucose_records[0]),
-      sl_glucose_records[records_num - 1]
-      );
-  }
-  if (sc) {
-    app_log_warning("Failed to send last record\n");
-  } else {
-    sl_bt_bgm_send_racp_indication(connection,
-                                   REPORT_STORED_RECORDS, RSP_CODE_SUCCEED);
+  uint16_t last = 0xFFFF;
+
+  if (!sl_bt_bgm_record_store_prev(0, &last)) {
+    sl_bt_bgm_send_racp_indication(connection, REPORT_STORED_RECORDS,
+                                   NO_RECORDS_FOUND);
+    return;
   }
+  sl_bt_bgm_report_start(connection, last, last, 1, false);
 }
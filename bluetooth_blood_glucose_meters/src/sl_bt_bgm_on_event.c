@@ -43,10 +43,10 @@
 uint8_t security_level = 1;
 uint8_t connection;
 // Glucose measurement current record number
-uint16_t records_num = 3;
+uint16_t records_num = 0;
 
 // Glucose sequence number
-uint8_t seq_num = 0;
+uint16_t seq_num = 0;
 
 // GLusose abort operation - Report Stored Records
 bool bgm_abort_operation_flag = false;
@@ -132,6 +132,7 @@ static void sl_bt_connection_closed_cb(uint16_t reason, uint8_t connection)
   (void)connection;
   sl_status_t sc = SL_STATUS_OK;
   app_log("central disconnect\n");
+  sl_bt_bgm_report_stop();
   sl_bt_create_user_adv();
   sl_bt_start_adv();
   app_assert_status(sc);
@@ -204,6 +205,7 @@ void sl_bt_bgm_on_event(sl_bt_msg_t *evt)
       sc = sl_bt_sm_configure(flags, io_capabilities);
       app_assert_status(sc);
       app_log("set security\n");
+      sl_bt_bgm_record_store_init();
       // for(uint8_t i = 0; i < BGM_DEFUALT_RECORDS_NUM; i++){
       // sl_bt_bgm_add_measurement_record();
       // }
@@ -337,8 +339,8 @@ void sl_bt_bgm_on_event(sl_bt_msg_t *evt)
         sl_bt_start_adv();
       }
       if (evt->data.evt_system_external_signal.extsignals
-          == SIGNAL_REPORT_ALL) {
-        sl_bt_signal_report_all_cb();
+          == SIGNAL_REPORT_RECORDS) {
+        sl_bt_bgm_report_resume();
       }
       break;
     default:
@@ -125,10 +125,6 @@ void sl_bt_bgm_report_record(sl_bt_msg_t *evt)
         sl_bt_bgm_invalid_operand_type2(connection);
         return;
       }
-      if ((operand2 > records_num) || (operand1 > records_num)) {
-        sl_bt_bgm_invalid_operand_type2(connection);
-        return;
-      }
       sl_bt_bgm_report_records_within_range(connection, filter_type,
                                             operand1, operand2);
       break;
@@ -159,7 +155,8 @@ void sl_bt_bgm_delete_record(sl_bt_msg_t *evt)
     sl_bt_bgm_invalid_operator(connection);
   }
   uint8_t operator = array[1];
-  uint8_t filter_type = 0, operand1 = 0, operand2 = 0;
+  uint8_t filter_type = 0;
+  uint16_t operand1 = 0, operand2 = 0;
   switch (operator)
   {
     case OPERATOR_ALL_RECORDS:
@@ -245,14 +242,11 @@ void sl_bt_bgm_report_num_records(sl_bt_msg_t *evt)
         return;
       }
       filter_type = array[2];
-      operand2 = array[3] | array[4] >> 8;
+      operand2 = array[3] | array[4] << 8;
       if (filter_type != 0x01) {
         sl_bt_bgm_unsupported_operand(connection);
         return;
       }
-      if (operand2 > records_num) {
-        sl_bt_bgm_unsupported_operand(connection);
-      }
       sl_bt_bgm_report_greater_num_records(connection, operand2);
       break;
     case OPERATOR_WITHIN_RANGE:
@@ -300,8 +294,7 @@ void sl_bt_bgm_delete_all_records(uint8_t connection)
     sizeof(rsp),
     rsp
     );
-  records_num = 0;
-  // memset(sl_glucose_records, 0, sizeof(sl_glucose_records));
+  sl_bt_bgm_record_store_delete_all();
 }
 
 /**************************************************************************//**
@@ -319,7 +312,7 @@ void sl_bt_bgm_delete_within_range_seq(uint8_t connection,
     sizeof(rsp),
     rsp
     );
-  records_num = records_num - (high - low + 1);
+  sl_bt_bgm_record_store_delete(low, high);
 }
 
 /**************************************************************************//**
@@ -329,7 +322,7 @@ void sl_bt_bgm_delete_within_range_seq(uint8_t connection,
 void sl_bt_bgm_report_greater_num_records(uint8_t connection, uint16_t high)
 {
   sl_status_t sc = SL_STATUS_FAIL;
-  uint16_t temp = records_num - high + 1;
+  uint16_t temp = sl_bt_bgm_record_store_count(high, 0xFFFF);
   rsp_report_num_records[2] = temp & 0xff;
   rsp_report_num_records[3] = temp >> 8;
   sc = sl_bt_gatt_server_send_indication(
@@ -351,10 +344,10 @@ void sl_bt_bgm_report_within_range(sl_bt_msg_t *evt)
 {
   uint8_t *array = evt->data.evt_gatt_server_attribute_value.value.data;
   uint8_t connection = evt->data.evt_gatt_server_attribute_value.connection;
-  uint16_t low = array[3] | array[4] >> 8;
-  uint16_t high = array[5] | array[6] >> 8;
+  uint16_t low = array[3] | array[4] << 8;
+  uint16_t high = array[5] | array[6] << 8;
   sl_status_t sc = SL_STATUS_FAIL;
-  uint16_t temp = high - low;
+  uint16_t temp = sl_bt_bgm_record_store_count(low, high);
   rsp_report_num_records[2] = temp & 0xff;
   rsp_report_num_records[3] = temp >> 8;
   sc = sl_bt_gatt_server_send_indication(
@@ -0,0 +1,445 @@
+/***************************************************************************//**
+ * @file
+ * @brief BGM persistent measurement record store
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+#include <string.h>
+#include "nvm3_default.h"
+#include "sl_bt_bgm.h"
+
+// NVM3 keys used by the record store
+#define BGM_STORE_META_KEY           (NVM3_KEY_MIN + 0x1000)
+#define BGM_STORE_BLOCK_KEY_BASE     (NVM3_KEY_MIN + 0x1100)
+
+// Records are packed into NVM3 objects no larger than a small object
+#define BGM_STORE_RECORDS_PER_BLOCK  (120 / SL_BT_BGM_RECORD_LEN)
+#define BGM_STORE_BLOCK_NUM                                     \
+  ((SL_BT_BGM_RECORD_STORE_CAPACITY + BGM_STORE_RECORDS_PER_BLOCK - 1) \
+   / BGM_STORE_RECORDS_PER_BLOCK)
+#define BGM_STORE_NO_BLOCK           0xFFFF
+
+// Flags value marking a deleted record, the reserved flag bits are never set
+// in a valid record.
+#define BGM_STORE_DELETED_FLAGS      0xFF
+
+// Record slot is the sequence number modulo the capacity, so the capacity
+// shall divide the 16-bit sequence number range.
+#if (65536 % SL_BT_BGM_RECORD_STORE_CAPACITY) != 0
+#error "SL_BT_BGM_RECORD_STORE_CAPACITY shall be a power of two"
+#endif
+
+typedef struct {
+  uint16_t next_seq; // sequence number given to the next record
+  uint16_t span;     // sequence numbers from the oldest to the newest record
+} bgm_store_meta_t;
+
+static bgm_store_meta_t store_meta = { 1, 0 };
+// one bit per slot, set when the slot holds a valid record
+static uint8_t store_valid[(SL_BT_BGM_RECORD_STORE_CAPACITY + 7) / 8];
+// last block read from or written to NVM3
+static uint8_t block_cache[BGM_STORE_RECORDS_PER_BLOCK][SL_BT_BGM_RECORD_LEN];
+static uint16_t block_cache_index = BGM_STORE_NO_BLOCK;
+
+static inline uint16_t seq_to_slot(uint16_t seq)
+{
+  return seq % SL_BT_BGM_RECORD_STORE_CAPACITY;
+}
+
+static inline bool slot_is_valid(uint16_t slot)
+{
+  return (store_valid[slot >> 3] & (1 << (slot & 7))) != 0;
+}
+
+static inline void slot_set_valid(uint16_t slot, bool valid)
+{
+  if (valid) {
+    store_valid[slot >> 3] |= (uint8_t)(1 << (slot & 7));
+  } else {
+    store_valid[slot >> 3] &= (uint8_t)~(1 << (slot & 7));
+  }
+}
+
+/**************************************************************************//**
+ * Load the NVM3 block holding a record slot into the block cache.
+ *****************************************************************************/
+static bool load_block(uint16_t block)
+{
+  Ecode_t err;
+
+  if (block == block_cache_index) {
+    return true;
+  }
+  err = nvm3_readData(nvm3_defaultHandle,
+                      BGM_STORE_BLOCK_KEY_BASE + block,
+                      block_cache,
+                      sizeof(block_cache));
+  if (err == ECODE_NVM3_ERR_KEY_NOT_FOUND) {
+    memset(block_cache, BGM_STORE_DELETED_FLAGS, sizeof(block_cache));
+  } else if (err != ECODE_NVM3_OK) {
+    app_log_warning("record store read block %d failed 0x%04lX\n",
+                    block, err);
+    block_cache_index = BGM_STORE_NO_BLOCK;
+    return false;
+  }
+  block_cache_index = block;
+  return true;
+}
+
+/**************************************************************************//**
+ * Write the block cache back to NVM3.
+ *****************************************************************************/
+static bool store_block(void)
+{
+  Ecode_t err;
+
+  err = nvm3_writeData(nvm3_defaultHandle,
+                       BGM_STORE_BLOCK_KEY_BASE + block_cache_index,
+                       block_cache,
+                       sizeof(block_cache));
+  if (err != ECODE_NVM3_OK) {
+    app_log_warning("record store write block %d failed 0x%04lX\n",
+                    block_cache_index, err);
+    block_cache_index = BGM_STORE_NO_BLOCK;
+    return false;
+  }
+  return true;
+}
+
+static void store_meta_write(void)
+{
+  Ecode_t err;
+
+  err = nvm3_writeData(nvm3_defaultHandle,
+                       BGM_STORE_META_KEY,
+                       &store_meta,
+                       sizeof(store_meta));
+  if (err != ECODE_NVM3_OK) {
+    app_log_warning("record store write meta failed 0x%04lX\n", err);
+  }
+}
+
+/**************************************************************************//**
+ * Clamp a sequence number range to the stored records.
+ * The result is given as offsets from the oldest record. Sequence numbers
+ * wrap around, so they are compared relative to the oldest record and the
+ * range [low, high] may wrap through 0xFFFF.
+ *****************************************************************************/
+static bool range_to_offsets(uint16_t low, uint16_t high,
+                             uint16_t *first, uint16_t *last)
+{
+  uint16_t oldest = sl_bt_bgm_record_store_oldest_seq();
+  uint16_t low_offset = (uint16_t)(low - oldest);
+  uint16_t high_offset = (uint16_t)(high - oldest);
+
+  if (store_meta.span == 0) {
+    return false;
+  }
+  if (low_offset < store_meta.span) {
+    *first = low_offset;
+  } else if ((uint16_t)(oldest - low) <= (uint16_t)(high - low)) {
+    // the range starts before the oldest record and reaches it
+    *first = 0;
+  } else {
+    return false;
+  }
+  if (high_offset >= store_meta.span) {
+    // the range ends after the newest record
+    *last = store_meta.span - 1;
+  } else if (high_offset >= *first) {
+    *last = high_offset;
+  } else {
+    // the range wraps around the whole sequence number space
+    *first = 0;
+    *last = store_meta.span - 1;
+  }
+  return true;
+}
+
+/**************************************************************************//**
+ * Load the record store index from NVM3.
+ *****************************************************************************/
+void sl_bt_bgm_record_store_init(void)
+{
+  Ecode_t err;
+  uint16_t seq;
+  uint16_t slot;
+  uint8_t *record;
+
+  memset(store_valid, 0, sizeof(store_valid));
+  records_num = 0;
+  err = nvm3_readData(nvm3_defaultHandle,
+                      BGM_STORE_META_KEY,
+                      &store_meta,
+                      sizeof(store_meta));
+  if ((err != ECODE_NVM3_OK)
+      || (store_meta.span > SL_BT_BGM_RECORD_STORE_CAPACITY)) {
+    store_meta.next_seq = 1;
+    store_meta.span = 0;
+  }
+  seq = sl_bt_bgm_record_store_oldest_seq();
+  for (uint16_t i = 0; i < store_meta.span; i++, seq++) {
+    slot = seq_to_slot(seq);
+    if (!load_block(slot / BGM_STORE_RECORDS_PER_BLOCK)) {
+      continue;
+    }
+    record = block_cache[slot % BGM_STORE_RECORDS_PER_BLOCK];
+    if ((record[0] != BGM_STORE_DELETED_FLAGS)
+        && ((uint16_t)(record[1] | (record[2] << 8)) == seq)) {
+      slot_set_valid(slot, true);
+      records_num++;
+    }
+  }
+  seq_num = store_meta.next_seq - 1;
+  app_log("record store loaded %d records, last sequence number %d\n",
+          records_num, seq_num);
+}
+
+/**************************************************************************//**
+ * Store a new record. The sequence number field is filled in by the store.
+ *****************************************************************************/
+sl_status_t sl_bt_bgm_record_store_append(uint8_t *record)
+{
+  uint16_t seq = store_meta.next_seq;
+  uint16_t slot = seq_to_slot(seq);
+
+  record[1] = (uint8_t)seq;
+  record[2] = (uint8_t)(seq >> 8);
+  if (!load_block(slot / BGM_STORE_RECORDS_PER_BLOCK)) {
+    return SL_STATUS_FAIL;
+  }
+  memcpy(block_cache[slot % BGM_STORE_RECORDS_PER_BLOCK],
+         record,
+         SL_BT_BGM_RECORD_LEN);
+  if (!store_block()) {
+    return SL_STATUS_FAIL;
+  }
+  // the store is full, the new record replaces the oldest one
+  if (store_meta.span == SL_BT_BGM_RECORD_STORE_CAPACITY) {
+    if (slot_is_valid(slot)) {
+      records_num--;
+    }
+    store_meta.span--;
+  }
+  slot_set_valid(slot, true);
+  records_num++;
+  store_meta.span++;
+  store_meta.next_seq++;
+  store_meta_write();
+  seq_num = seq;
+  return SL_STATUS_OK;
+}
+
+/**************************************************************************//**
+ * Read the record with the given sequence number.
+ *****************************************************************************/
+bool sl_bt_bgm_record_store_read(uint16_t seq, uint8_t *record)
+{
+  uint16_t slot = seq_to_slot(seq);
+
+  if (((uint16_t)(seq - sl_bt_bgm_record_store_oldest_seq())
+       >= store_meta.span)
+      || !slot_is_valid(slot)
+      || !load_block(slot / BGM_STORE_RECORDS_PER_BLOCK)) {
+    return false;
+  }
+  memcpy(record,
+         block_cache[slot % BGM_STORE_RECORDS_PER_BLOCK],
+         SL_BT_BGM_RECORD_LEN);
+  return true;
+}
+
+/**************************************************************************//**
+ * Sequence number of the oldest slot in the store.
+ *****************************************************************************/
+uint16_t sl_bt_bgm_record_store_oldest_seq(void)
+{
+  return store_meta.next_seq - store_meta.span;
+}
+
+/**************************************************************************//**
+ * Find the first stored record with a sequence number in [*seq, high].
+ *****************************************************************************/
+bool sl_bt_bgm_record_store_next(uint16_t *seq, uint16_t high)
+{
+  uint16_t oldest = sl_bt_bgm_record_store_oldest_seq();
+  uint16_t first, last, slot;
+  uint32_t offset;
+
+  if (!range_to_offsets(*seq, high, &first, &last)) {
+    return false;
+  }
+  offset = first;
+  while (offset <= last) {
+    slot = seq_to_slot(oldest + offset);
+    // skip eight empty slots at once
+    if (((slot & 7) == 0) && (store_valid[slot >> 3] == 0)) {
+      offset += 8;
+      continue;
+    }
+    if (slot_is_valid(slot)) {
+      *seq = oldest + offset;
+      return true;
+    }
+    offset++;
+  }
+  return false;
+}
+
+/**************************************************************************//**
+ * Find the last stored record with a sequence number in [low, *seq].
+ *****************************************************************************/
+bool sl_bt_bgm_record_store_prev(uint16_t low, uint16_t *seq)
+{
+  uint16_t oldest = sl_bt_bgm_record_store_oldest_seq();
+  uint16_t first, last, slot;
+  int32_t offset;
+
+  if (!range_to_offsets(low, *seq, &first, &last)) {
+    return false;
+  }
+  offset = last;
+  while (offset >= first) {
+    slot = seq_to_slot(oldest + offset);
+    // skip eight empty slots at once
+    if (((slot & 7) == 7) && (store_valid[slot >> 3] == 0)) {
+      offset -= 8;
+      continue;
+    }
+    if (slot_is_valid(slot)) {
+      *seq = oldest + offset;
+      return true;
+    }
+    offset--;
+  }
+  return false;
+}
+
+/**************************************************************************//**
+ * Number of stored records with a sequence number in [low, high].
+ *****************************************************************************/
+uint16_t sl_bt_bgm_record_store_count(uint16_t low, uint16_t high)
+{
+  uint16_t first, last;
+  uint16_t count = 0;
+  uint16_t seq = low;
+
+  if (!range_to_offsets(low, high, &first, &last)) {
+    return 0;
+  }
+  if ((first == 0) && (last == store_meta.span - 1)) {
+    return records_num;
+  }
+  while (sl_bt_bgm_record_store_next(&seq, high)) {
+    count++;
+    if (seq == high) {
+      break;
+    }
+    seq++;
+  }
+  return count;
+}
+
+/**************************************************************************//**
+ * Write the block cache back to NVM3 after marking records deleted in it.
+ * The records leave the valid bitmap only once the block is written, a failed
+ * write keeps them.
+ *****************************************************************************/
+static uint16_t store_deleted_block(void)
+{
+  uint16_t first_slot = block_cache_index * BGM_STORE_RECORDS_PER_BLOCK;
+  uint16_t slot;
+  uint16_t deleted = 0;
+
+  if (!store_block()) {
+    return 0;
+  }
+  for (uint16_t i = 0; i < BGM_STORE_RECORDS_PER_BLOCK; i++) {
+    slot = first_slot + i;
+    if ((slot < SL_BT_BGM_RECORD_STORE_CAPACITY)
+        && slot_is_valid(slot)
+        && (block_cache[i][0] == BGM_STORE_DELETED_FLAGS)) {
+      slot_set_valid(slot, false);
+      records_num--;
+      deleted++;
+    }
+  }
+  return deleted;
+}
+
+/**************************************************************************//**
+ * Delete the stored records with a sequence number in [low, high].
+ *****************************************************************************/
+uint16_t sl_bt_bgm_record_store_delete(uint16_t low, uint16_t high)
+{
+  uint16_t seq = low;
+  uint16_t slot;
+  uint16_t deleted = 0;
+  bool dirty = false;
+
+  while (sl_bt_bgm_record_store_next(&seq, high)) {
+    slot = seq_to_slot(seq);
+    if ((block_cache_index != slot / BGM_STORE_RECORDS_PER_BLOCK) && dirty) {
+      dirty = false;
+      deleted += store_deleted_block();
+    }
+    if (load_block(slot / BGM_STORE_RECORDS_PER_BLOCK)) {
+      block_cache[slot % BGM_STORE_RECORDS_PER_BLOCK][0] =
+        BGM_STORE_DELETED_FLAGS;
+      dirty = true;
+    }
+    if (seq == high) {
+      break;
+    }
+    seq++;
+  }
+  if (dirty) {
+    deleted += store_deleted_block();
+  }
+  return deleted;
+}
+
+/**************************************************************************//**
+ * Delete all the stored records. Sequence numbers are not reused.
+ *****************************************************************************/
+void sl_bt_bgm_record_store_delete_all(void)
+{
+  for (uint16_t block = 0; block < BGM_STORE_BLOCK_NUM; block++) {
+    (void)nvm3_deleteObject(nvm3_defaultHandle,
+                            BGM_STORE_BLOCK_KEY_BASE + block);
+  }
+  memset(store_valid, 0, sizeof(store_valid));
+  block_cache_index = BGM_STORE_NO_BLOCK;
+  records_num = 0;
+  store_meta.span = 0;
+  store_meta_write();
+}
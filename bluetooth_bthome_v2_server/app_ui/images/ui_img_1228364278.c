@@ -10,947 +10,391 @@
 #endif
 
 // IMAGE DATA: assets\silabs_logo-removebg.png
+// RLE encoded by tools/img_rle_convert.py, 11952 bytes raw
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_1228364278_data[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xA5, 0x63,
-  0xF7, 0xBD, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xFE, 0x07, 0xBB, 0xE6, 0x33, 0x7A,
-  0xDE, 0x43, 0x9B, 0xDE, 0x34, 0xFD, 0xEE, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xE6, 0x1F, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-  0x7C, 0x92, 0xCE, 0x73, 0x9B, 0xAF, 0x73, 0x9C, 0x96, 0xB5, 0x49, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA,
-  0xF6, 0x39, 0x96, 0xCD, 0x82, 0x96, 0xCD, 0x79, 0xF7, 0xD5, 0x66, 0xBA, 0xEE,
-  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xFE, 0x0E, 0xB6, 0xFD, 0x45, 0xF3, 0xFC,
-  0x6A, 0x92, 0xFC, 0x86, 0x10, 0xF4, 0x97, 0xF0, 0xFB, 0xA0, 0x11, 0xFC, 0x95,
-  0x93, 0xFC, 0x7F, 0x56, 0xFD, 0x5D, 0xF9, 0xFD, 0x2E, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x93, 0xC4, 0xB5, 0xF1, 0xCB, 0xE7, 0xDB, 0xFE, 0x0D, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x2F, 0x84, 0x8C, 0xEB, 0x5A, 0xB5,
-  0x14, 0xA5, 0x63, 0x72, 0x94, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFE, 0x20, 0x13, 0xC5, 0xA9, 0x0F, 0xA4,
-  0xE8, 0x13, 0xC5, 0xB5, 0x79, 0xEE, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xFD,
-  0x57, 0xAE, 0xCB, 0xB8, 0xE8, 0xA1, 0xFF, 0x45, 0x91, 0xFF, 0x05, 0x99, 0xFF,
-  0x04, 0xA1, 0xFF, 0x04, 0xA9, 0xFF, 0xE3, 0xB0, 0xFF, 0xC4, 0xB8, 0xFF, 0xE4,
-  0xC0, 0xFF, 0xC4, 0xC0, 0xFF, 0xA4, 0xB8, 0xFF, 0xA4, 0xB0, 0xFF, 0xE4, 0xA8,
-  0xFF, 0xE4, 0x98, 0xFF, 0xC8, 0xA1, 0xFF, 0x8F, 0xCB, 0xD3,
-  0xD7, 0xFD, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x32, 0xE4, 0x8D, 0x06, 0x89, 0xFF, 0x4D, 0xB3, 0xFC, 0xFF, 0xFF, 0x02, 0x95,
-  0xD5, 0x43, 0xCF, 0x8B, 0x95, 0xAB, 0x5A, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x18, 0xFE, 0x2D, 0xAF, 0xBB, 0xDE, 0x69, 0x8A, 0xFF, 0x50, 0xBC, 0xC4,
-  0xDB, 0xFE, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFC, 0x67,
-  0x29, 0xC2, 0xFF, 0x05, 0xB1, 0xFF, 0x83, 0xA8, 0xFF, 0x05, 0xB9, 0xFF, 0x25,
-  0xC1, 0xFF, 0x05, 0xC1, 0xFF, 0x25, 0xC9, 0xFF, 0x26, 0xC9, 0xFF, 0x25, 0xC9,
-  0xFF, 0x25, 0xC9, 0xFF, 0x05, 0xC9, 0xFF, 0x05, 0xC9, 0xFF, 0xE5, 0xD0, 0xFF,
-  0xE5, 0xD0, 0xFF, 0x05, 0xD1, 0xFF, 0x25, 0xC9, 0xFF, 0x25, 0xC1, 0xFF, 0x04,
-  0xB9, 0xFF, 0x05, 0xC1, 0xFF, 0x84, 0xA0, 0xFF, 0x67, 0xA1, 0xFF, 0xDB, 0xFE,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xA1, 0xFF, 0x06, 0xA9,
-  0xFF, 0xC4, 0x98, 0xFF, 0xB4, 0xFC, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x52, 0x4C, 0x45, 0x03, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x10,
+  0x00, 0x1F, 0x00, 0x50, 0x00, 0xAA, 0x00, 0x17, 0x01, 0x85, 0x01, 0xFE, 0x01,
+  0x84, 0x02, 0x0D, 0x03, 0xA1, 0x03, 0x48, 0x04, 0xFC, 0x04, 0x80, 0x05, 0xE6,
+  0x05, 0x65, 0x06, 0xE9, 0x06, 0x58, 0x07, 0xCE, 0x07, 0x82, 0x08, 0x2E, 0x09,
+  0xCC, 0x09, 0x56, 0x0A, 0xE2, 0x0A, 0x5F, 0x0B, 0xC8, 0x0B, 0x1A, 0x0C, 0x4F,
+  0x0C, 0x64, 0x0C, 0x76, 0x0C, 0x7A, 0x0C, 0x1D, 0x0D, 0xD0, 0x0D, 0x82, 0x0E,
+  0x20, 0x0F, 0xC0, 0x0F, 0x5D, 0x10, 0x0F, 0x11, 0xDB, 0x11, 0xA2, 0x12, 0xA6,
+  0x12, 0xAA, 0x12, 0xAE, 0x12, 0xB2, 0x12, 0xB6, 0x12, 0xD2, 0x00, 0x00, 0x00,
+  0xD2, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0xCC,
+  0x00, 0x00, 0x00, 0x01, 0x34, 0xA5, 0x63, 0xF7, 0xBD, 0x3E, 0x83, 0x00, 0x00,
+  0x00, 0xA2, 0x00, 0x00, 0x00, 0x04, 0xDB, 0xFE, 0x07, 0xBB, 0xE6, 0x33, 0x7A,
+  0xDE, 0x43, 0x9B, 0xDE, 0x34, 0xFD, 0xEE, 0x18, 0x9D, 0x00, 0x00, 0x00, 0x00,
+  0xFB, 0xE6, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x7C, 0x92, 0xCE, 0x73,
+  0x9B, 0xAF, 0x73, 0x9C, 0x96, 0xB5, 0x49, 0x82, 0x00, 0x00, 0x00, 0x9E, 0x00,
+  0x00, 0x00, 0x04, 0xDA, 0xF6, 0x39, 0x96, 0xCD, 0x82, 0x96, 0xCD, 0x79, 0xF7,
+  0xD5, 0x66, 0xBA, 0xEE, 0x38, 0x89, 0x00, 0x00, 0x00, 0x09, 0x5B, 0xFE, 0x0E,
+  0xB6, 0xFD, 0x45, 0xF3, 0xFC, 0x6A, 0x92, 0xFC, 0x86, 0x10, 0xF4, 0x97, 0xF0,
+  0xFB, 0xA0, 0x11, 0xFC, 0x95, 0x93, 0xFC, 0x7F, 0x56, 0xFD, 0x5D, 0xF9, 0xFD,
+  0x2E, 0x8E, 0x00, 0x00, 0x00, 0x02, 0x93, 0xC4, 0xB5, 0xF1, 0xCB, 0xE7, 0xDB,
+  0xFE, 0x0D, 0x81, 0x00, 0x00, 0x00, 0x03, 0x2F, 0x84, 0x8C, 0xEB, 0x5A, 0xB5,
+  0x14, 0xA5, 0x63, 0x72, 0x94, 0x76, 0x82, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00,
+  0x00, 0x04, 0xFB, 0xFE, 0x20, 0x13, 0xC5, 0xA9, 0x0F, 0xA4, 0xE8, 0x13, 0xC5,
+  0xB5, 0x79, 0xEE, 0x42, 0x89, 0x00, 0x00, 0x00, 0x11, 0xB6, 0xFD, 0x57, 0xAE,
+  0xCB, 0xB8, 0xE8, 0xA1, 0xFF, 0x45, 0x91, 0xFF, 0x05, 0x99, 0xFF, 0x04, 0xA1,
+  0xFF, 0x04, 0xA9, 0xFF, 0xE3, 0xB0, 0xFF, 0xC4, 0xB8, 0xFF, 0xE4, 0xC0, 0xFF,
+  0xC4, 0xC0, 0xFF, 0xA4, 0xB8, 0xFF, 0xA4, 0xB0, 0xFF, 0xE4, 0xA8, 0xFF, 0xE4,
+  0x98, 0xFF, 0xC8, 0xA1, 0xFF, 0x8F, 0xCB, 0xD3, 0xD7, 0xFD, 0x53, 0x8B, 0x00,
+  0x00, 0x00, 0x06, 0x32, 0xE4, 0x8D, 0x06, 0x89, 0xFF, 0x4D, 0xB3, 0xFC, 0xFF,
+  0xFF, 0x02, 0x95, 0xD5, 0x43, 0xCF, 0x8B, 0x95, 0xAB, 0x5A, 0xA9, 0x83, 0x00,
+  0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x04, 0x18, 0xFE, 0x2D, 0xAF, 0xBB, 0xDE,
+  0x69, 0x8A, 0xFF, 0x50, 0xBC, 0xC4, 0xDB, 0xFE, 0x1C, 0x89, 0x00, 0x00, 0x00,
+  0x08, 0xF4, 0xFC, 0x67, 0x29, 0xC2, 0xFF, 0x05, 0xB1, 0xFF, 0x83, 0xA8, 0xFF,
+  0x05, 0xB9, 0xFF, 0x25, 0xC1, 0xFF, 0x05, 0xC1, 0xFF, 0x25, 0xC9, 0xFF, 0x26,
+  0xC9, 0xFF, 0x81, 0x25, 0xC9, 0xFF, 0x81, 0x05, 0xC9, 0xFF, 0x81, 0xE5, 0xD0,
+  0xFF, 0x07, 0x05, 0xD1, 0xFF, 0x25, 0xC9, 0xFF, 0x25, 0xC1, 0xFF, 0x04, 0xB9,
+  0xFF, 0x05, 0xC1, 0xFF, 0x84, 0xA0, 0xFF, 0x67, 0xA1, 0xFF, 0xDB, 0xFE, 0x14,
+  0x8A, 0x00, 0x00, 0x00, 0x03, 0xE8, 0xA1, 0xFF, 0x06, 0xA9, 0xFF, 0xC4, 0x98,
+  0xFF, 0xB4, 0xFC, 0x7C, 0x85, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x04,
   0xDB, 0xFE, 0x1C, 0xAF, 0xB3, 0xCF, 0x66, 0x69, 0xFF, 0x8A, 0x9A, 0xFF, 0xD7,
-  0xFD, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xDC, 0x9E, 0x45,
-  0x99, 0xFF, 0xE4, 0xB0, 0xFF, 0x25, 0xC9, 0xFF, 0xE5, 0xD0, 0xFF, 0x05, 0xD9,
-  0xFF, 0x05, 0xD9, 0xFF, 0xE4, 0xD0, 0xFF, 0xE5, 0xD8, 0xFF, 0x05, 0xD9, 0xFF,
-  0xE5, 0xD8, 0xFF, 0xC4, 0xD8, 0xFF, 0xE5, 0xD0, 0xFF, 0x05, 0xD1, 0xFF, 0x05,
-  0xD1, 0xFF, 0x05, 0xD9, 0xFF, 0xE5, 0xD8, 0xFF, 0xE5, 0xD8, 0xFF, 0xE4, 0xD8,
-  0xFF, 0x04, 0xD1, 0xFF, 0xE4, 0xD8, 0xFF, 0xC5, 0xE0, 0xFF, 0xE5, 0xD8, 0xFF,
-  0x06, 0xC1, 0xFF, 0x67, 0x91, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x29, 0xC2, 0xFF, 0x27, 0xD1, 0xFF, 0xE6, 0xD0, 0xFF, 0x84, 0xA8, 0xFF, 0x2D,
-  0xCB, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52,
-  0xF4, 0x76, 0xA7, 0xA1, 0xFF, 0x45, 0x89, 0xFF, 0xEB, 0xA2, 0xFC, 0x1C, 0xFF,
-  0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xDC, 0x84, 0xE5, 0xA0,
-  0xFF, 0xE5, 0xB8, 0xFF, 0xC4, 0xC0, 0xFF, 0x25, 0xD1, 0xFF, 0x04, 0xD1, 0xFF,
-  0xE4, 0xC8, 0xFF, 0x04, 0xD1, 0xFF, 0x04, 0xD9, 0xFF, 0xC4, 0xD8, 0xFF, 0xC4,
-  0xD8, 0xFF, 0xC4, 0xD8, 0xFF, 0xA4, 0xD8, 0xFF, 0xE6, 0xE0, 0xFF, 0xE6, 0xD8,
-  0xFF, 0xE6, 0xD0, 0xFF, 0xE5, 0xD0, 0xFF, 0xC5, 0xD0, 0xFF, 0xC5, 0xD0, 0xFF,
-  0xE5, 0xD8, 0xFF, 0xE4, 0xD8, 0xFF, 0x04, 0xD9, 0xFF, 0xC3, 0xD0, 0xFF, 0xC4,
-  0xE0, 0xFF, 0xE5, 0xD8, 0xFF, 0x06, 0xC1, 0xFF, 0xC4, 0x88, 0xFF, 0xFF, 0xFF,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xFE, 0x12, 0xE4, 0xB8, 0xFF, 0xE5, 0xD0,
-  0xFF, 0xA4, 0xD8, 0xFF, 0x26, 0xD9, 0xFF, 0xC4, 0xA8, 0xFF, 0x71, 0xE4, 0x8B,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFE, 0x05, 0x6D, 0xBB,
+  0xFD, 0x42, 0x8A, 0x00, 0x00, 0x00, 0x04, 0x51, 0xDC, 0x9E, 0x45, 0x99, 0xFF,
+  0xE4, 0xB0, 0xFF, 0x25, 0xC9, 0xFF, 0xE5, 0xD0, 0xFF, 0x81, 0x05, 0xD9, 0xFF,
+  0x05, 0xE4, 0xD0, 0xFF, 0xE5, 0xD8, 0xFF, 0x05, 0xD9, 0xFF, 0xE5, 0xD8, 0xFF,
+  0xC4, 0xD8, 0xFF, 0xE5, 0xD0, 0xFF, 0x81, 0x05, 0xD1, 0xFF, 0x00, 0x05, 0xD9,
+  0xFF, 0x81, 0xE5, 0xD8, 0xFF, 0x06, 0xE4, 0xD8, 0xFF, 0x04, 0xD1, 0xFF, 0xE4,
+  0xD8, 0xFF, 0xC5, 0xE0, 0xFF, 0xE5, 0xD8, 0xFF, 0x06, 0xC1, 0xFF, 0x67, 0x91,
+  0xFF, 0x8A, 0x00, 0x00, 0x00, 0x04, 0x29, 0xC2, 0xFF, 0x27, 0xD1, 0xFF, 0xE6,
+  0xD0, 0xFF, 0x84, 0xA8, 0xFF, 0x2D, 0xCB, 0xD2, 0x84, 0x00, 0x00, 0x00, 0x92,
+  0x00, 0x00, 0x00, 0x04, 0x52, 0xF4, 0x76, 0xA7, 0xA1, 0xFF, 0x45, 0x89, 0xFF,
+  0xEB, 0xA2, 0xFC, 0x1C, 0xFF, 0x12, 0x8A, 0x00, 0x00, 0x00, 0x08, 0x11, 0xDC,
+  0x84, 0xE5, 0xA0, 0xFF, 0xE5, 0xB8, 0xFF, 0xC4, 0xC0, 0xFF, 0x25, 0xD1, 0xFF,
+  0x04, 0xD1, 0xFF, 0xE4, 0xC8, 0xFF, 0x04, 0xD1, 0xFF, 0x04, 0xD9, 0xFF, 0x82,
+  0xC4, 0xD8, 0xFF, 0x04, 0xA4, 0xD8, 0xFF, 0xE6, 0xE0, 0xFF, 0xE6, 0xD8, 0xFF,
+  0xE6, 0xD0, 0xFF, 0xE5, 0xD0, 0xFF, 0x81, 0xC5, 0xD0, 0xFF, 0x08, 0xE5, 0xD8,
+  0xFF, 0xE4, 0xD8, 0xFF, 0x04, 0xD9, 0xFF, 0xC3, 0xD0, 0xFF, 0xC4, 0xE0, 0xFF,
+  0xE5, 0xD8, 0xFF, 0x06, 0xC1, 0xFF, 0xC4, 0x88, 0xFF, 0xFF, 0xFF, 0x01, 0x88,
+  0x00, 0x00, 0x00, 0x06, 0x38, 0xFE, 0x12, 0xE4, 0xB8, 0xFF, 0xE5, 0xD0, 0xFF,
+  0xA4, 0xD8, 0xFF, 0x26, 0xD9, 0xFF, 0xC4, 0xA8, 0xFF, 0x71, 0xE4, 0x8B, 0x83,
+  0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x05, 0x79, 0xFE, 0x05, 0x6D, 0xBB,
   0xB8, 0x25, 0x91, 0xFF, 0xE4, 0x90, 0xFF, 0x29, 0xB2, 0xFF, 0xF9, 0xFD, 0x13,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0xE9, 0xA9, 0xFF,
-  0x06, 0xB1, 0xFF, 0x27, 0xD1, 0xFF, 0xE6, 0xD8, 0xFF, 0xA4, 0xD8, 0xFF, 0xE5,
-  0xD8, 0xFF, 0x04, 0xD1, 0xFF, 0x04, 0xD1, 0xFF, 0xE4, 0xD0, 0xFF, 0x04, 0xD1,
-  0xFF, 0x05, 0xD9, 0xFF, 0xE5, 0xE0, 0xFF, 0xE5, 0xE0, 0xFF,
-  0xE5, 0xE0, 0xFF, 0xA4, 0xD8, 0xFF, 0xC5, 0xD8, 0xFF, 0xE6, 0xD8, 0xFF, 0x06,
-  0xD9, 0xFF, 0x06, 0xD9, 0xFF, 0x06, 0xD9, 0xFF, 0x05, 0xD9, 0xFF, 0x05, 0xD9,
-  0xFF, 0xA3, 0xD0, 0xFF, 0x25, 0xE1, 0xFF, 0xC4, 0xE0, 0xFF, 0xC5, 0xD0, 0xFF,
-  0xA4, 0xB0, 0xFF, 0xB4, 0xFC, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFE, 0x1B, 0x25, 0xA9, 0xFF,
-  0xC4, 0xC0, 0xFF, 0x25, 0xE1, 0xFF, 0xE4, 0xE0, 0xFF, 0x83, 0xD0, 0xFF, 0x45,
-  0xC9, 0xFF, 0x44, 0x99, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xFE, 0x1A, 0x6B, 0xCA, 0xD3,
-  0xE4, 0xA8, 0xFF, 0x24, 0xA9, 0xFF, 0xC3, 0x88, 0xFF, 0x71, 0xE4, 0x94, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA,
+  0x8A, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x02, 0xE9, 0xA9, 0xFF, 0x06, 0xB1,
+  0xFF, 0x27, 0xD1, 0xFF, 0xE6, 0xD8, 0xFF, 0xA4, 0xD8, 0xFF, 0xE5, 0xD8, 0xFF,
+  0x81, 0x04, 0xD1, 0xFF, 0x02, 0xE4, 0xD0, 0xFF, 0x04, 0xD1, 0xFF, 0x05, 0xD9,
+  0xFF, 0x82, 0xE5, 0xE0, 0xFF, 0x02, 0xA4, 0xD8, 0xFF, 0xC5, 0xD8, 0xFF, 0xE6,
+  0xD8, 0xFF, 0x82, 0x06, 0xD9, 0xFF, 0x81, 0x05, 0xD9, 0xFF, 0x05, 0xA3, 0xD0,
+  0xFF, 0x25, 0xE1, 0xFF, 0xC4, 0xE0, 0xFF, 0xC5, 0xD0, 0xFF, 0xA4, 0xB0, 0xFF,
+  0xB4, 0xFC, 0x58, 0x88, 0x00, 0x00, 0x00, 0x07, 0x9A, 0xFE, 0x1B, 0x25, 0xA9,
+  0xFF, 0xC4, 0xC0, 0xFF, 0x25, 0xE1, 0xFF, 0xE4, 0xE0, 0xFF, 0x83, 0xD0, 0xFF,
+  0x45, 0xC9, 0xFF, 0x44, 0x99, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x8D, 0x00, 0x00,
+  0x00, 0x05, 0x38, 0xFE, 0x1A, 0x6B, 0xCA, 0xD3, 0xE4, 0xA8, 0xFF, 0x24, 0xA9,
+  0xFF, 0xC3, 0x88, 0xFF, 0x71, 0xE4, 0x94, 0x8B, 0x00, 0x00, 0x00, 0x10, 0xBA,
   0xFE, 0x12, 0xC4, 0xA0, 0xFF, 0x06, 0xB9, 0xFF, 0x06, 0xC9, 0xFF, 0xC5, 0xD0,
   0xFF, 0xA5, 0xD8, 0xFF, 0x26, 0xE9, 0xFF, 0x84, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF,
   0x05, 0xD9, 0xFF, 0x26, 0xD9, 0xFF, 0xE5, 0xD0, 0xFF, 0xC5, 0xD0, 0xFF, 0xC5,
-  0xD8, 0xFF, 0xA5, 0xD8, 0xFF, 0xA4, 0xD8, 0xFF, 0xE5, 0xE0, 0xFF, 0xE4, 0xD8,
-  0xFF, 0xE4, 0xD8, 0xFF, 0xE4, 0xD0, 0xFF, 0xE4, 0xD0, 0xFF, 0xE4, 0xD0, 0xFF,
-  0xE4, 0xD0, 0xFF, 0xE5, 0xD8, 0xFF, 0xC5, 0xE0, 0xFF, 0xA4, 0xD8, 0xFF, 0xA4,
-  0xD0, 0xFF, 0x87, 0xD1, 0xFF, 0x97, 0xFD, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xFD, 0x40, 0xCC, 0xD2, 0xE8, 0xC4,
-  0xA8, 0xFF, 0x25, 0xC9, 0xFF, 0x04, 0xD1, 0xFF, 0x05, 0xD9, 0xFF, 0x04, 0xD9,
-  0xFF, 0x25, 0xD1, 0xFF, 0x45, 0xC1, 0xFF, 0xC2, 0x98, 0xFF, 0xF7, 0xFD, 0x39,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFE, 0x0A, 0x8A,
-  0xBA, 0xD6, 0xE5, 0xA8, 0xFF, 0xE5, 0xC0, 0xFF, 0xE5, 0xC8, 0xFF, 0xA4, 0xA8,
-  0xFF, 0x14, 0xFD, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x66, 0xA9, 0xFF, 0x05, 0xC9, 0xFF, 0xC5, 0xC8, 0xFF,
-  0xE5, 0xD0, 0xFF, 0xE5, 0xD0, 0xFF, 0xC5, 0xD0, 0xFF, 0x06, 0xD9, 0xFF, 0xE5,
-  0xD0, 0xFF, 0x05, 0xC9, 0xFF, 0x05, 0xC9, 0xFF, 0x05, 0xC1, 0xFF, 0xE5, 0xB8,
-  0xFF, 0x06, 0xC1, 0xFF, 0xE6, 0xC0, 0xFF, 0xE6, 0xB8, 0xFF, 0x06, 0xC1, 0xFF,
-  0xE4, 0xB8, 0xFF, 0xE4, 0xB8, 0xFF, 0xE4, 0xB8, 0xFF, 0xE4, 0xB8, 0xFF, 0x04,
-  0xB1, 0xFF, 0x04, 0xB1, 0xFF, 0x05, 0xB9, 0xFF, 0xE5, 0xC0, 0xFF, 0xE5, 0xC8,
-  0xFF, 0xE5, 0xC8, 0xFF, 0x06, 0xC1, 0xFF, 0x26, 0xB1, 0xFF, 0x05, 0x99, 0xFF,
-  0x25, 0x99, 0xFF, 0xA7, 0xA9, 0xFF, 0xAC, 0xC2, 0xFF, 0xCF, 0xDB, 0xB8, 0x14,
-  0xFD, 0x6F, 0x14, 0xF5, 0x58, 0x0C, 0xBB, 0xDF, 0x05, 0x99, 0xFF, 0xA4, 0xA8,
-  0xFF, 0xE5, 0xC8, 0xFF, 0xE5, 0xD0, 0xFF, 0x05, 0xD9, 0xFF,
-  0xE4, 0xD0, 0xFF, 0xC3, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0x05, 0xD1, 0xFF, 0x25,
-  0xC1, 0xFF, 0x04, 0xA1, 0xFF, 0xD7, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xDB,
-  0xB3, 0xE5, 0xA8, 0xFF, 0xE5, 0xB8, 0xFF, 0xC4, 0xC8, 0xFF, 0x05, 0xC9, 0xFF,
-  0x06, 0xB1, 0xFF, 0xF1, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xFE, 0x2C, 0xC3, 0xA8, 0xFF, 0xC4,
-  0xD8, 0xFF, 0x25, 0xD9, 0xFF, 0x04, 0xC9, 0xFF, 0x05, 0xC1, 0xFF, 0x05, 0xC1,
-  0xFF, 0xA3, 0xA8, 0xFF, 0xE4, 0xA8, 0xFF, 0x05, 0xA9, 0xFF, 0x25, 0xA1, 0xFF,
-  0x66, 0xA1, 0xFF, 0x09, 0xAA, 0xFF, 0xCC, 0xBA, 0xFF, 0x2D, 0xC3, 0xFB, 0x6E,
-  0xCB, 0xD9, 0xF0, 0xDB, 0xC0, 0x31, 0xD4, 0xA7, 0x52, 0xDC, 0xA1, 0x72, 0xE4,
-  0xA0, 0x52, 0xEC, 0xA9, 0x31, 0xE4, 0xBB, 0xCF, 0xD3, 0xD7,
-  0x6E, 0xCB, 0xF9, 0x0D, 0xCB, 0xFF, 0x6B, 0xC2, 0xFF, 0x87, 0xA9, 0xFF, 0x46,
-  0xA1, 0xFF, 0x66, 0xA1, 0xFF, 0xE3, 0x90, 0xFF, 0x24, 0xA1, 0xFF, 0xC4, 0xA8,
-  0xFF, 0x05, 0xC1, 0xFF, 0xC4, 0xB8, 0xFF, 0xA3, 0xB0, 0xFF, 0xE4, 0xB0, 0xFF,
-  0x25, 0xC1, 0xFF, 0x26, 0xD1, 0xFF, 0x05, 0xD9, 0xFF, 0xE4, 0xD0, 0xFF, 0x05,
-  0xD9, 0xFF, 0xC3, 0xD0, 0xFF, 0xE4, 0xD8, 0xFF, 0xE5, 0xE0, 0xFF, 0xE5, 0xE0,
-  0xFF, 0xE6, 0xE0, 0xFF, 0xC5, 0xC0, 0xFF, 0x25, 0x99, 0xFF, 0xF7, 0xFD, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFD, 0x2E,
-  0x46, 0xA1, 0xFE, 0xE5, 0xB0, 0xFF, 0xE6, 0xD0, 0xFF, 0xE5, 0xD8, 0xFF, 0xE5,
-  0xD8, 0xFF, 0x05, 0xC9, 0xFF, 0x07, 0xA1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFE,
-  0x17, 0xC3, 0xA0, 0xFF, 0x04, 0xD1, 0xFF, 0xE4, 0xC8, 0xFF,
-  0xA7, 0xD1, 0xFF, 0x6A, 0xDA, 0xF8, 0x4D, 0xEB, 0xA1, 0xD4, 0xFC, 0x63, 0xB7,
-  0xFD, 0x30, 0xDB, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFD, 0x04, 0xF7, 0xFD, 0x32,
-  0x92, 0xFC, 0x78, 0xEB, 0xD2, 0xD6, 0x45, 0xB1, 0xFF, 0xC3, 0xB0, 0xFF, 0x05,
-  0xC1, 0xFF, 0x05, 0xD1, 0xFF, 0xC4, 0xD0, 0xFF, 0xA4, 0xD8, 0xFF, 0xC4, 0xE0,
-  0xFF, 0x04, 0xD9, 0xFF, 0xE4, 0xD0, 0xFF, 0x25, 0xD9, 0xFF, 0xE4, 0xD8, 0xFF,
-  0xA4, 0xD8, 0xFF, 0xC5, 0xE0, 0xFF, 0xA5, 0xD0, 0xFF, 0x06, 0xB9, 0xFF, 0xAB,
-  0xBA, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
-  0xDB, 0x9E, 0xA4, 0xA8, 0xFF, 0x05, 0xC1, 0xFF, 0x06, 0xD1, 0xFF, 0xE4, 0xD0,
-  0xFF, 0x05, 0xD9, 0xFF, 0xC4, 0xD8, 0xFF, 0xE5, 0xC0, 0xFF,
-  0xA8, 0xA9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xDB, 0xA7, 0xC4,
-  0xA0, 0xFF, 0x66, 0xB1, 0xFF, 0xD4, 0xFC, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xD7, 0xFD, 0x31, 0xCB, 0xC2, 0xE1, 0x84, 0xA8, 0xFF, 0xE6, 0xD0, 0xFF,
-  0xC5, 0xD8, 0xFF, 0xC5, 0xD8, 0xFF, 0x05, 0xD1, 0xFF, 0x25, 0xD1, 0xFF, 0x05,
+  0xD8, 0xFF, 0xA5, 0xD8, 0xFF, 0xA4, 0xD8, 0xFF, 0xE5, 0xE0, 0xFF, 0x81, 0xE4,
+  0xD8, 0xFF, 0x83, 0xE4, 0xD0, 0xFF, 0x05, 0xE5, 0xD8, 0xFF, 0xC5, 0xE0, 0xFF,
+  0xA4, 0xD8, 0xFF, 0xA4, 0xD0, 0xFF, 0x87, 0xD1, 0xFF, 0x97, 0xFD, 0x2B, 0x87,
+  0x00, 0x00, 0x00, 0x0A, 0x57, 0xFD, 0x40, 0xCC, 0xD2, 0xE8, 0xC4, 0xA8, 0xFF,
+  0x25, 0xC9, 0xFF, 0x04, 0xD1, 0xFF, 0x05, 0xD9, 0xFF, 0x04, 0xD9, 0xFF, 0x25,
+  0xD1, 0xFF, 0x45, 0xC1, 0xFF, 0xC2, 0x98, 0xFF, 0xF7, 0xFD, 0x39, 0x82, 0x00,
+  0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x06, 0x79, 0xFE, 0x0A, 0x8A, 0xBA, 0xD6,
+  0xE5, 0xA8, 0xFF, 0xE5, 0xC0, 0xFF, 0xE5, 0xC8, 0xFF, 0xA4, 0xA8, 0xFF, 0x14,
+  0xFD, 0x55, 0x8C, 0x00, 0x00, 0x00, 0x02, 0x66, 0xA9, 0xFF, 0x05, 0xC9, 0xFF,
+  0xC5, 0xC8, 0xFF, 0x81, 0xE5, 0xD0, 0xFF, 0x02, 0xC5, 0xD0, 0xFF, 0x06, 0xD9,
+  0xFF, 0xE5, 0xD0, 0xFF, 0x81, 0x05, 0xC9, 0xFF, 0x05, 0x05, 0xC1, 0xFF, 0xE5,
+  0xB8, 0xFF, 0x06, 0xC1, 0xFF, 0xE6, 0xC0, 0xFF, 0xE6, 0xB8, 0xFF, 0x06, 0xC1,
+  0xFF, 0x83, 0xE4, 0xB8, 0xFF, 0x81, 0x04, 0xB1, 0xFF, 0x01, 0x05, 0xB9, 0xFF,
+  0xE5, 0xC0, 0xFF, 0x81, 0xE5, 0xC8, 0xFF, 0x15, 0x06, 0xC1, 0xFF, 0x26, 0xB1,
+  0xFF, 0x05, 0x99, 0xFF, 0x25, 0x99, 0xFF, 0xA7, 0xA9, 0xFF, 0xAC, 0xC2, 0xFF,
+  0xCF, 0xDB, 0xB8, 0x14, 0xFD, 0x6F, 0x14, 0xF5, 0x58, 0x0C, 0xBB, 0xDF, 0x05,
+  0x99, 0xFF, 0xA4, 0xA8, 0xFF, 0xE5, 0xC8, 0xFF, 0xE5, 0xD0, 0xFF, 0x05, 0xD9,
+  0xFF, 0xE4, 0xD0, 0xFF, 0xC3, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0x05, 0xD1, 0xFF,
+  0x25, 0xC1, 0xFF, 0x04, 0xA1, 0xFF, 0xD7, 0xFD, 0x3F, 0x82, 0x00, 0x00, 0x00,
+  0x8A, 0x00, 0x00, 0x00, 0x06, 0x6F, 0xDB, 0xB3, 0xE5, 0xA8, 0xFF, 0xE5, 0xB8,
+  0xFF, 0xC4, 0xC8, 0xFF, 0x05, 0xC9, 0xFF, 0x06, 0xB1, 0xFF, 0xF1, 0xEB, 0xA0,
+  0x8C, 0x00, 0x00, 0x00, 0x04, 0x38, 0xFE, 0x2C, 0xC3, 0xA8, 0xFF, 0xC4, 0xD8,
+  0xFF, 0x25, 0xD9, 0xFF, 0x04, 0xC9, 0xFF, 0x81, 0x05, 0xC1, 0xFF, 0x23, 0xA3,
+  0xA8, 0xFF, 0xE4, 0xA8, 0xFF, 0x05, 0xA9, 0xFF, 0x25, 0xA1, 0xFF, 0x66, 0xA1,
+  0xFF, 0x09, 0xAA, 0xFF, 0xCC, 0xBA, 0xFF, 0x2D, 0xC3, 0xFB, 0x6E, 0xCB, 0xD9,
+  0xF0, 0xDB, 0xC0, 0x31, 0xD4, 0xA7, 0x52, 0xDC, 0xA1, 0x72, 0xE4, 0xA0, 0x52,
+  0xEC, 0xA9, 0x31, 0xE4, 0xBB, 0xCF, 0xD3, 0xD7, 0x6E, 0xCB, 0xF9, 0x0D, 0xCB,
+  0xFF, 0x6B, 0xC2, 0xFF, 0x87, 0xA9, 0xFF, 0x46, 0xA1, 0xFF, 0x66, 0xA1, 0xFF,
+  0xE3, 0x90, 0xFF, 0x24, 0xA1, 0xFF, 0xC4, 0xA8, 0xFF, 0x05, 0xC1, 0xFF, 0xC4,
+  0xB8, 0xFF, 0xA3, 0xB0, 0xFF, 0xE4, 0xB0, 0xFF, 0x25, 0xC1, 0xFF, 0x26, 0xD1,
+  0xFF, 0x05, 0xD9, 0xFF, 0xE4, 0xD0, 0xFF, 0x05, 0xD9, 0xFF, 0xC3, 0xD0, 0xFF,
+  0xE4, 0xD8, 0xFF, 0x81, 0xE5, 0xE0, 0xFF, 0x03, 0xE6, 0xE0, 0xFF, 0xC5, 0xC0,
+  0xFF, 0x25, 0x99, 0xFF, 0xF7, 0xFD, 0x04, 0x82, 0x00, 0x00, 0x00, 0x88, 0x00,
+  0x00, 0x00, 0x03, 0xF8, 0xFD, 0x2E, 0x46, 0xA1, 0xFE, 0xE5, 0xB0, 0xFF, 0xE6,
+  0xD0, 0xFF, 0x81, 0xE5, 0xD8, 0xFF, 0x01, 0x05, 0xC9, 0xFF, 0x07, 0xA1, 0xFF,
+  0x8D, 0x00, 0x00, 0x00, 0x09, 0x9A, 0xFE, 0x17, 0xC3, 0xA0, 0xFF, 0x04, 0xD1,
+  0xFF, 0xE4, 0xC8, 0xFF, 0xA7, 0xD1, 0xFF, 0x6A, 0xDA, 0xF8, 0x4D, 0xEB, 0xA1,
+  0xD4, 0xFC, 0x63, 0xB7, 0xFD, 0x30, 0xDB, 0xFE, 0x07, 0x91, 0x00, 0x00, 0x00,
+  0x13, 0xF7, 0xFD, 0x04, 0xF7, 0xFD, 0x32, 0x92, 0xFC, 0x78, 0xEB, 0xD2, 0xD6,
+  0x45, 0xB1, 0xFF, 0xC3, 0xB0, 0xFF, 0x05, 0xC1, 0xFF, 0x05, 0xD1, 0xFF, 0xC4,
+  0xD0, 0xFF, 0xA4, 0xD8, 0xFF, 0xC4, 0xE0, 0xFF, 0x04, 0xD9, 0xFF, 0xE4, 0xD0,
+  0xFF, 0x25, 0xD9, 0xFF, 0xE4, 0xD8, 0xFF, 0xA4, 0xD8, 0xFF, 0xC5, 0xE0, 0xFF,
+  0xA5, 0xD0, 0xFF, 0x06, 0xB9, 0xFF, 0xAB, 0xBA, 0xDB, 0x83, 0x00, 0x00, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x08, 0xAF, 0xDB, 0x9E, 0xA4, 0xA8, 0xFF, 0x05, 0xC1,
+  0xFF, 0x06, 0xD1, 0xFF, 0xE4, 0xD0, 0xFF, 0x05, 0xD9, 0xFF, 0xC4, 0xD8, 0xFF,
+  0xE5, 0xC0, 0xFF, 0xA8, 0xA9, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0x03, 0x6E, 0xDB,
+  0xA7, 0xC4, 0xA0, 0xFF, 0x66, 0xB1, 0xFF, 0xD4, 0xFC, 0x4B, 0x9B, 0x00, 0x00,
+  0x00, 0x03, 0xD7, 0xFD, 0x31, 0xCB, 0xC2, 0xE1, 0x84, 0xA8, 0xFF, 0xE6, 0xD0,
+  0xFF, 0x81, 0xC5, 0xD8, 0xFF, 0x08, 0x05, 0xD1, 0xFF, 0x25, 0xD1, 0xFF, 0x05,
   0xD1, 0xFF, 0x05, 0xD9, 0xFF, 0xA4, 0xD8, 0xFF, 0xC5, 0xD8, 0xFF, 0x06, 0xD1,
-  0xFF, 0xC4, 0x98, 0xFF, 0xDB, 0xFE, 0x0E, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xCB, 0xB2, 0xC5, 0xE5, 0xB0, 0xFF, 0xA4, 0xC8, 0xFF,
-  0x06, 0xE1, 0xFF, 0xC4, 0xD8, 0xFF, 0xC4, 0xD0, 0xFF, 0x05, 0xD9, 0xFF, 0xC5,
-  0xD8, 0xFF, 0x26, 0xD1, 0xFF, 0x05, 0xA9, 0xFF, 0x7B, 0xFE, 0x0F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xD3, 0xF4, 0x53, 0x29, 0xA2, 0xFF, 0x05, 0x81, 0xFF,
-  0x25, 0x81, 0xFF, 0x6A, 0xA2, 0xFF, 0x10, 0xCC, 0xC2, 0xB3, 0xD4, 0x87, 0x55,
-  0xDD, 0x6A, 0xB6, 0xE5, 0x53, 0xF7, 0xED, 0x46, 0x18, 0xEE, 0x40, 0x5A, 0xF6,
-  0x2B, 0xDB, 0xFE, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xB7, 0xFD, 0x2E, 0xE5, 0xB0, 0xFF, 0xC6, 0xC8, 0xFF, 0xE6, 0xD8,
-  0xFF, 0x05, 0xD1, 0xFF, 0xC4, 0xC8, 0xFF, 0x05, 0xD1, 0xFF, 0xA4, 0xD0, 0xFF,
-  0x06, 0xE1, 0xFF, 0xC5, 0xC8, 0xFF, 0xC4, 0xA0, 0xFF, 0x55, 0xFD, 0x59, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xCA, 0xC9, 0xC5, 0xB8, 0xFF, 0xC4,
-  0xC0, 0xFF, 0x26, 0xD9, 0xFF, 0xA4, 0xD8, 0xFF, 0xA4, 0xD8, 0xFF, 0x05, 0xE1,
-  0xFF, 0x05, 0xD9, 0xFF, 0xC5, 0xD0, 0xFF, 0xC5, 0xD0, 0xFF, 0xE6, 0xC8, 0xFF,
-  0x25, 0xB1, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x99, 0xFE, 0x17, 0x92, 0xD4, 0x8F, 0xEC, 0xAA, 0xFF, 0xE8, 0x99,
-  0xFF, 0x26, 0x89, 0xFF, 0x25, 0x81, 0xFF, 0x25, 0x81, 0xFF,
-  0x25, 0x79, 0xFF, 0x24, 0x79, 0xFF, 0x04, 0x71, 0xFF, 0x24, 0x79, 0xFF, 0x24,
-  0x81, 0xFF, 0x24, 0x81, 0xFF, 0x29, 0xA2, 0xFF, 0x8F, 0xCB, 0xB6, 0xF9, 0xFD,
-  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xFE, 0x1D,
-  0xA4, 0xA8, 0xFF, 0xC5, 0xD0, 0xFF, 0x05, 0xD9, 0xFF, 0x04, 0xD9, 0xFF, 0xE4,
-  0xD8, 0xFF, 0xE5, 0xD8, 0xFF, 0x06, 0xD9, 0xFF, 0xA5, 0xA8, 0xFF, 0x14, 0xE5,
-  0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xCB, 0x9B, 0xA5, 0xB8,
-  0xFF, 0xA6, 0xD8, 0xFF, 0x26, 0xD9, 0xFF, 0x04, 0xD9, 0xFF, 0xA3, 0xD8, 0xFF,
-  0x05, 0xE9, 0xFF, 0xE5, 0xD8, 0xFF, 0xE5, 0xD0, 0xFF, 0xE5, 0xD0, 0xFF, 0x06,
-  0xD9, 0xFF, 0x06, 0xE1, 0xFF, 0xE5, 0xC8, 0xFF, 0x45, 0xA1, 0xFF, 0xB2, 0xE4,
-  0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x9A, 0xFE, 0x0B, 0xB6, 0xFD, 0x20, 0x14, 0xFD, 0x45, 0xF0, 0xFB, 0x87,
-  0x09, 0xC2, 0xFF, 0x84, 0x98, 0xFF, 0xA8, 0xA9, 0xFC, 0x18, 0xFE, 0x35, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xD2, 0xFF, 0xE5, 0xD0, 0xFF, 0xE4, 0xE0,
-  0xFF, 0xC3, 0xD8, 0xFF, 0xE3, 0xD0, 0xFF, 0x25, 0xC9, 0xFF, 0x63, 0xA0, 0xFF,
-  0xD4, 0xFC, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x5A, 0xFE, 0x17, 0xC5, 0x98, 0xFF, 0xE6, 0xC8, 0xFF, 0xC6, 0xD8, 0xFF, 0xE5,
-  0xD0, 0xFF, 0xE4, 0xD0, 0xFF, 0x04, 0xD9, 0xFF, 0x25, 0xD9, 0xFF, 0xA3, 0xC8,
-  0xFF, 0x05, 0xD1, 0xFF, 0x05, 0xD9, 0xFF, 0xE5, 0xD0, 0xFF, 0xC4, 0xD8, 0xFF,
-  0x04, 0xD1, 0xFF, 0xE4, 0xC0, 0xFF, 0x05, 0xB1, 0xFF, 0x25, 0xA9, 0xFF, 0xED,
-  0xD2, 0xCA, 0x56, 0xFD, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79,
-  0xFE, 0x0F, 0x75, 0xFD, 0x45, 0x31, 0xFC, 0x82, 0x68, 0xD9, 0xFF, 0xC6, 0xC0,
-  0xFF, 0xC5, 0xA0, 0xFF, 0x97, 0xFD, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x09, 0xBA, 0xFF, 0xA4, 0xC8, 0xFF, 0x05, 0xE9, 0xFF, 0xE4, 0xD8, 0xFF, 0xE3,
-  0xB0, 0xFF, 0x86, 0xA1, 0xFF, 0xBC, 0xFE, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD3, 0xBD, 0xE6, 0xB8, 0xFF, 0xE6, 0xD0,
-  0xFF, 0xE5, 0xD8, 0xFF, 0x05, 0xD9, 0xFF, 0x05, 0xD1, 0xFF, 0x04, 0xD1, 0xFF,
-  0xC4, 0xD0, 0xFF, 0xE4, 0xD0, 0xFF, 0x26, 0xE1, 0xFF, 0xC4, 0xD0, 0xFF, 0xC4,
-  0xD0, 0xFF, 0xE4, 0xD0, 0xFF, 0x05, 0xD1, 0xFF, 0x25, 0xC9, 0xFF, 0xE4, 0xB8,
-  0xFF, 0xE5, 0xB8, 0xFF, 0x05, 0xB1, 0xFF, 0xE5, 0xA0, 0xFF, 0x05, 0x99, 0xFF,
-  0xA7, 0xA9, 0xFF, 0x8A, 0xBA, 0xF0, 0xCF, 0xDB, 0xB0, 0xD2, 0xEC, 0x7F, 0x55,
-  0xFD, 0x61, 0xD7, 0xFD, 0x4B, 0x38, 0xFE, 0x36, 0x5A, 0xFE, 0x27, 0x5A, 0xFE,
-  0x1D, 0xBB, 0xFE, 0x18, 0xBB, 0xFE, 0x18, 0x9B, 0xFE, 0x1C, 0x7A, 0xFE, 0x24,
-  0x39, 0xFE, 0x31, 0xB6, 0xF5, 0x42, 0x75, 0xED, 0x54, 0x14, 0xE5, 0x6C, 0x92,
-  0xE4, 0x87, 0xEF, 0xD3, 0xA7, 0xEB, 0xBA, 0xCF, 0x29, 0xAA, 0xFF, 0x87, 0xA1,
-  0xFF, 0x25, 0x99, 0xFF, 0xE4, 0x98, 0xFF, 0xE3, 0xA0, 0xFF,
+  0xFF, 0xC4, 0x98, 0xFF, 0xDB, 0xFE, 0x0E, 0x83, 0x00, 0x00, 0x00, 0x86, 0x00,
+  0x00, 0x00, 0x0A, 0xCB, 0xB2, 0xC5, 0xE5, 0xB0, 0xFF, 0xA4, 0xC8, 0xFF, 0x06,
+  0xE1, 0xFF, 0xC4, 0xD8, 0xFF, 0xC4, 0xD0, 0xFF, 0x05, 0xD9, 0xFF, 0xC5, 0xD8,
+  0xFF, 0x26, 0xD1, 0xFF, 0x05, 0xA9, 0xFF, 0x7B, 0xFE, 0x0F, 0x8E, 0x00, 0x00,
+  0x00, 0x0C, 0xD3, 0xF4, 0x53, 0x29, 0xA2, 0xFF, 0x05, 0x81, 0xFF, 0x25, 0x81,
+  0xFF, 0x6A, 0xA2, 0xFF, 0x10, 0xCC, 0xC2, 0xB3, 0xD4, 0x87, 0x55, 0xDD, 0x6A,
+  0xB6, 0xE5, 0x53, 0xF7, 0xED, 0x46, 0x18, 0xEE, 0x40, 0x5A, 0xF6, 0x2B, 0xDB,
+  0xFE, 0x14, 0x93, 0x00, 0x00, 0x00, 0x0B, 0xB7, 0xFD, 0x2E, 0xE5, 0xB0, 0xFF,
+  0xC6, 0xC8, 0xFF, 0xE6, 0xD8, 0xFF, 0x05, 0xD1, 0xFF, 0xC4, 0xC8, 0xFF, 0x05,
+  0xD1, 0xFF, 0xA4, 0xD0, 0xFF, 0x06, 0xE1, 0xFF, 0xC5, 0xC8, 0xFF, 0xC4, 0xA0,
+  0xFF, 0x55, 0xFD, 0x59, 0x84, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x03,
+  0x6B, 0xCA, 0xC9, 0xC5, 0xB8, 0xFF, 0xC4, 0xC0, 0xFF, 0x26, 0xD9, 0xFF, 0x81,
+  0xA4, 0xD8, 0xFF, 0x01, 0x05, 0xE1, 0xFF, 0x05, 0xD9, 0xFF, 0x81, 0xC5, 0xD0,
+  0xFF, 0x02, 0xE6, 0xC8, 0xFF, 0x25, 0xB1, 0xFF, 0xFF, 0xFF, 0x05, 0x8F, 0x00,
+  0x00, 0x00, 0x04, 0x99, 0xFE, 0x17, 0x92, 0xD4, 0x8F, 0xEC, 0xAA, 0xFF, 0xE8,
+  0x99, 0xFF, 0x26, 0x89, 0xFF, 0x81, 0x25, 0x81, 0xFF, 0x03, 0x25, 0x79, 0xFF,
+  0x24, 0x79, 0xFF, 0x04, 0x71, 0xFF, 0x24, 0x79, 0xFF, 0x81, 0x24, 0x81, 0xFF,
+  0x02, 0x29, 0xA2, 0xFF, 0x8F, 0xCB, 0xB6, 0xF9, 0xFD, 0x30, 0x8F, 0x00, 0x00,
+  0x00, 0x09, 0x59, 0xFE, 0x1D, 0xA4, 0xA8, 0xFF, 0xC5, 0xD0, 0xFF, 0x05, 0xD9,
+  0xFF, 0x04, 0xD9, 0xFF, 0xE4, 0xD8, 0xFF, 0xE5, 0xD8, 0xFF, 0x06, 0xD9, 0xFF,
+  0xA5, 0xA8, 0xFF, 0x14, 0xE5, 0x7B, 0x85, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00,
+  0x00, 0x07, 0x8F, 0xCB, 0x9B, 0xA5, 0xB8, 0xFF, 0xA6, 0xD8, 0xFF, 0x26, 0xD9,
+  0xFF, 0x04, 0xD9, 0xFF, 0xA3, 0xD8, 0xFF, 0x05, 0xE9, 0xFF, 0xE5, 0xD8, 0xFF,
+  0x81, 0xE5, 0xD0, 0xFF, 0x04, 0x06, 0xD9, 0xFF, 0x06, 0xE1, 0xFF, 0xE5, 0xC8,
+  0xFF, 0x45, 0xA1, 0xFF, 0xB2, 0xE4, 0x76, 0x98, 0x00, 0x00, 0x00, 0x07, 0x9A,
+  0xFE, 0x0B, 0xB6, 0xFD, 0x20, 0x14, 0xFD, 0x45, 0xF0, 0xFB, 0x87, 0x09, 0xC2,
+  0xFF, 0x84, 0x98, 0xFF, 0xA8, 0xA9, 0xFC, 0x18, 0xFE, 0x35, 0x8E, 0x00, 0x00,
+  0x00, 0x07, 0x4A, 0xD2, 0xFF, 0xE5, 0xD0, 0xFF, 0xE4, 0xE0, 0xFF, 0xC3, 0xD8,
+  0xFF, 0xE3, 0xD0, 0xFF, 0x25, 0xC9, 0xFF, 0x63, 0xA0, 0xFF, 0xD4, 0xFC, 0x5A,
+  0x86, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x12, 0x5A, 0xFE, 0x17, 0xC5,
+  0x98, 0xFF, 0xE6, 0xC8, 0xFF, 0xC6, 0xD8, 0xFF, 0xE5, 0xD0, 0xFF, 0xE4, 0xD0,
+  0xFF, 0x04, 0xD9, 0xFF, 0x25, 0xD9, 0xFF, 0xA3, 0xC8, 0xFF, 0x05, 0xD1, 0xFF,
+  0x05, 0xD9, 0xFF, 0xE5, 0xD0, 0xFF, 0xC4, 0xD8, 0xFF, 0x04, 0xD1, 0xFF, 0xE4,
+  0xC0, 0xFF, 0x05, 0xB1, 0xFF, 0x25, 0xA9, 0xFF, 0xED, 0xD2, 0xCA, 0x56, 0xFD,
+  0x55, 0x97, 0x00, 0x00, 0x00, 0x06, 0x79, 0xFE, 0x0F, 0x75, 0xFD, 0x45, 0x31,
+  0xFC, 0x82, 0x68, 0xD9, 0xFF, 0xC6, 0xC0, 0xFF, 0xC5, 0xA0, 0xFF, 0x97, 0xFD,
+  0x43, 0x8D, 0x00, 0x00, 0x00, 0x06, 0x09, 0xBA, 0xFF, 0xA4, 0xC8, 0xFF, 0x05,
+  0xE9, 0xFF, 0xE4, 0xD8, 0xFF, 0xE3, 0xB0, 0xFF, 0x86, 0xA1, 0xFF, 0xBC, 0xFE,
+  0x19, 0x87, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x09, 0x0D, 0xD3, 0xBD,
+  0xE6, 0xB8, 0xFF, 0xE6, 0xD0, 0xFF, 0xE5, 0xD8, 0xFF, 0x05, 0xD9, 0xFF, 0x05,
+  0xD1, 0xFF, 0x04, 0xD1, 0xFF, 0xC4, 0xD0, 0xFF, 0xE4, 0xD0, 0xFF, 0x26, 0xE1,
+  0xFF, 0x81, 0xC4, 0xD0, 0xFF, 0x10, 0xE4, 0xD0, 0xFF, 0x05, 0xD1, 0xFF, 0x25,
+  0xC9, 0xFF, 0xE4, 0xB8, 0xFF, 0xE5, 0xB8, 0xFF, 0x05, 0xB1, 0xFF, 0xE5, 0xA0,
+  0xFF, 0x05, 0x99, 0xFF, 0xA7, 0xA9, 0xFF, 0x8A, 0xBA, 0xF0, 0xCF, 0xDB, 0xB0,
+  0xD2, 0xEC, 0x7F, 0x55, 0xFD, 0x61, 0xD7, 0xFD, 0x4B, 0x38, 0xFE, 0x36, 0x5A,
+  0xFE, 0x27, 0x5A, 0xFE, 0x1D, 0x81, 0xBB, 0xFE, 0x18, 0x12, 0x9B, 0xFE, 0x1C,
+  0x7A, 0xFE, 0x24, 0x39, 0xFE, 0x31, 0xB6, 0xF5, 0x42, 0x75, 0xED, 0x54, 0x14,
+  0xE5, 0x6C, 0x92, 0xE4, 0x87, 0xEF, 0xD3, 0xA7, 0xEB, 0xBA, 0xCF, 0x29, 0xAA,
+  0xFF, 0x87, 0xA1, 0xFF, 0x25, 0x99, 0xFF, 0xE4, 0x98, 0xFF, 0xE3, 0xA0, 0xFF,
   0x04, 0xB9, 0xFF, 0xE5, 0xD8, 0xFF, 0xA5, 0xD0, 0xFF, 0xE6, 0xB8, 0xFF, 0xCC,
-  0xC2, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFB, 0xFD, 0x08, 0x05, 0xA1, 0xFF, 0x26, 0xC9, 0xFF, 0xC4, 0xC0,
-  0xFF, 0xA3, 0xA8, 0xFF, 0xCE, 0xE3, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xB1, 0xFF,
-  0xC5, 0xD0, 0xFF, 0xE6, 0xD8, 0xFF, 0xE5, 0xD8, 0xFF, 0xE5, 0xD0, 0xFF, 0x05,
-  0xD1, 0xFF, 0xE5, 0xD8, 0xFF, 0xC4, 0xD0, 0xFF, 0xE5, 0xE0, 0xFF, 0xC5, 0xE0,
-  0xFF, 0xC4, 0xD8, 0xFF, 0x05, 0xD9, 0xFF, 0xC5, 0xC8, 0xFF, 0x83, 0xA8, 0xFF,
-  0xEC, 0xDA, 0xEF, 0xAA, 0xC2, 0xFF, 0x66, 0xA1, 0xFF, 0x25, 0xA1, 0xFF, 0x05,
-  0xA9, 0xFF, 0xE5, 0xB8, 0xFF, 0xE5, 0xC0, 0xFF, 0x05, 0xC1, 0xFF, 0x25, 0xB9,
-  0xFF, 0x04, 0xB1, 0xFF, 0xC3, 0xB0, 0xFF, 0xA3, 0xA8, 0xFF,
-  0xA4, 0xA8, 0xFF, 0xC4, 0xB0, 0xFF, 0xA5, 0xB0, 0xFF, 0xA4, 0xB0, 0xFF, 0xA4,
-  0xB0, 0xFF, 0xC4, 0xA8, 0xFF, 0xC4, 0xA8, 0xFF, 0xC4, 0xB0, 0xFF, 0xC4, 0xB0,
-  0xFF, 0xE5, 0xB8, 0xFF, 0xA3, 0xB0, 0xFF, 0xE4, 0xB0, 0xFF, 0x04, 0xB9, 0xFF,
-  0x04, 0xB9, 0xFF, 0x05, 0xC1, 0xFF, 0x05, 0xC9, 0xFF, 0xE5, 0xD0, 0xFF, 0xE5,
-  0xD0, 0xFF, 0x25, 0xD9, 0xFF, 0xE4, 0xD0, 0xFF, 0xE5, 0xE0, 0xFF, 0xE6, 0xD0,
-  0xFF, 0x06, 0xB1, 0xFF, 0x8F, 0xCB, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xA9, 0xFF, 0x26, 0xB1, 0xFF,
-  0xC4, 0x98, 0xFF, 0xCB, 0xBA, 0xE8, 0xDB, 0xFE, 0x0E, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xE6, 0xB0, 0xFF, 0xE7, 0xD8, 0xFF, 0x84, 0xC8, 0xFF, 0x06, 0xD9,
-  0xFF, 0xE5, 0xD0, 0xFF, 0xE5, 0xD0, 0xFF, 0xE5, 0xD8, 0xFF,
-  0xC5, 0xD8, 0xFF, 0xC5, 0xE0, 0xFF, 0xC5, 0xD0, 0xFF, 0xE4, 0xC8, 0xFF, 0xA3,
-  0xA8, 0xFF, 0x4A, 0xCA, 0xE6, 0x5A, 0xFE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x19, 0xFE, 0x19, 0x52, 0xFC, 0x6D, 0xAC, 0xEA, 0xD8,
-  0x26, 0xD9, 0xFF, 0xE5, 0xD8, 0xFF, 0xE4, 0xD0, 0xFF, 0xE4, 0xD0, 0xFF, 0xE4,
-  0xD8, 0xFF, 0x05, 0xD9, 0xFF, 0xE5, 0xE0, 0xFF, 0xC5, 0xE0, 0xFF, 0xC5, 0xD8,
-  0xFF, 0xC5, 0xD8, 0xFF, 0xC5, 0xD8, 0xFF, 0xE5, 0xD8, 0xFF, 0xC5, 0xD8, 0xFF,
-  0xC5, 0xD8, 0xFF, 0xC5, 0xE0, 0xFF, 0xC4, 0xD8, 0xFF, 0xE5, 0xE0, 0xFF, 0xE5,
-  0xD8, 0xFF, 0xE4, 0xD8, 0xFF, 0xE4, 0xD8, 0xFF, 0xE4, 0xD8, 0xFF, 0xE5, 0xE0,
-  0xFF, 0xC5, 0xE0, 0xFF, 0xA4, 0xE0, 0xFF, 0xC4, 0xD8, 0xFF, 0xE5, 0xD8, 0xFF,
-  0xE5, 0xD0, 0xFF, 0x06, 0xB9, 0xFF, 0x46, 0x99, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x99, 0xFF, 0xE5,
-  0x90, 0xFF, 0x4A, 0xB2, 0xFC, 0x19, 0xFE, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xC2, 0xFF,
-  0xE6, 0xC8, 0xFF, 0xC5, 0xD0, 0xFF, 0xE5, 0xE0, 0xFF, 0xE5, 0xD8, 0xFF, 0xE4,
-  0xD8, 0xFF, 0xE5, 0xD8, 0xFF, 0xE5, 0xD8, 0xFF, 0xC5, 0xD0, 0xFF, 0xE5, 0xB8,
-  0xFF, 0x24, 0x99, 0xFF, 0xB6, 0xFD, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFB, 0xAC, 0xC4, 0xC8, 0xFF, 0xE4, 0xD0,
-  0xFF, 0x04, 0xD9, 0xFF, 0xC3, 0xC8, 0xFF, 0x04, 0xD9, 0xFF, 0xA3, 0xD8, 0xFF,
-  0xE5, 0xE0, 0xFF, 0xE5, 0xD8, 0xFF, 0xE5, 0xD0, 0xFF, 0xE5, 0xD8, 0xFF, 0xE5,
-  0xD8, 0xFF, 0xE5, 0xD8, 0xFF, 0xE5, 0xD8, 0xFF, 0xC5, 0xD8, 0xFF, 0xE4, 0xD8,
-  0xFF, 0xE5, 0xE0, 0xFF, 0xE4, 0xD8, 0xFF, 0xE4, 0xD8, 0xFF, 0xE4, 0xD8, 0xFF,
-  0xE4, 0xD8, 0xFF, 0xE5, 0xD8, 0xFF, 0xE5, 0xE0, 0xFF, 0xE5, 0xD8, 0xFF, 0xE5,
-  0xD8, 0xFF, 0x05, 0xC9, 0xFF, 0xC4, 0xA8, 0xFF, 0x29, 0xAA, 0xFF, 0xFF, 0xFF,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xEC,
-  0x67, 0x25, 0x71, 0xFF, 0x0C, 0xA3, 0xFA, 0x9A, 0xFE, 0x1C, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x76, 0xFD, 0x4D, 0x84, 0xA0, 0xFF, 0xE6, 0xD0, 0xFF, 0xA5, 0xD8,
-  0xFF, 0xC4, 0xD0, 0xFF, 0xE4, 0xD8, 0xFF, 0x05, 0xE1, 0xFF, 0xC4, 0xC8, 0xFF,
-  0xE5, 0xB0, 0xFF, 0x4A, 0xBA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xAB, 0xE3, 0xE5, 0xA0, 0xFF,
-  0x06, 0xD1, 0xFF, 0xC5, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0x04, 0xD1, 0xFF, 0x24,
-  0xD9, 0xFF, 0xE4, 0xE0, 0xFF, 0xA3, 0xD0, 0xFF, 0x05, 0xD1, 0xFF, 0x05, 0xD1,
-  0xFF, 0xE5, 0xD0, 0xFF, 0xE5, 0xD8, 0xFF, 0xC4, 0xD8, 0xFF,
-  0xC4, 0xD8, 0xFF, 0xE4, 0xD8, 0xFF, 0xE4, 0xD8, 0xFF, 0xC4, 0xD0, 0xFF, 0xC4,
-  0xD8, 0xFF, 0xC4, 0xD8, 0xFF, 0xC5, 0xD8, 0xFF, 0xE5, 0xD8, 0xFF, 0x05, 0xD1,
-  0xFF, 0x05, 0xC9, 0xFF, 0x05, 0xC1, 0xFF, 0xC4, 0xA8, 0xFF, 0x05, 0xA1, 0xFF,
-  0x51, 0xEC, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDE, 0x42,
-  0xAB, 0x82, 0xFF, 0xAF, 0xBB, 0xCF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xCB, 0xB7,
-  0xE5, 0xB8, 0xFF, 0xC4, 0xD0, 0xFF, 0x04, 0xD1, 0xFF, 0x65, 0xD9, 0xFF, 0xC3,
-  0xD0, 0xFF, 0x24, 0xC1, 0xFF, 0xEB, 0xC2, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0xC4, 0xA1, 0x84, 0x98, 0xFF, 0x07, 0xD9, 0xFF, 0xE6, 0xE0,
-  0xFF, 0xE5, 0xE0, 0xFF, 0x05, 0xD9, 0xFF, 0xE4, 0xD0, 0xFF, 0xE5, 0xD8, 0xFF,
-  0xE5, 0xD0, 0xFF, 0x04, 0xC9, 0xFF, 0x04, 0xC9, 0xFF, 0xE4, 0xD8, 0xFF, 0xE4,
-  0xD8, 0xFF, 0xE4, 0xE0, 0xFF, 0xE4, 0xD8, 0xFF, 0xE4, 0xD8, 0xFF, 0xE4, 0xD0,
-  0xFF, 0xE5, 0xD8, 0xFF, 0xE5, 0xD8, 0xFF, 0xE6, 0xE0, 0xFF, 0xC6, 0xD8, 0xFF,
-  0xC5, 0xC8, 0xFF, 0xE5, 0xB8, 0xFF, 0x25, 0xB1, 0xFF, 0x86, 0x99, 0xFF, 0x91,
-  0xDC, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xDE, 0x57, 0xD3,
-  0xAC, 0xBB, 0xD7, 0xCD, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xDB, 0xAA, 0xA3, 0xA8,
-  0xFF, 0x44, 0xC1, 0xFF, 0xE3, 0xC0, 0xFF, 0x04, 0xD9, 0xFF, 0xC3, 0xB0, 0xFF,
-  0xF7, 0xFD, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xFC, 0x75,
-  0xA5, 0xA0, 0xFF, 0xC4, 0xB0, 0xFF, 0xE5, 0xC0, 0xFF, 0xC4, 0xB8, 0xFF, 0x46,
-  0xD1, 0xFF, 0xC5, 0xC0, 0xFF, 0x25, 0xC9, 0xFF, 0x25, 0xC9, 0xFF, 0x24, 0xC9,
-  0xFF, 0x24, 0xC9, 0xFF, 0x05, 0xD1, 0xFF, 0x05, 0xD1, 0xFF, 0x25, 0xC9, 0xFF,
-  0x25, 0xC9, 0xFF, 0x25, 0xC1, 0xFF, 0x05, 0xB9, 0xFF, 0xE4, 0xB8, 0xFF, 0xA4,
-  0xB0, 0xFF, 0xC5, 0xA8, 0xFF, 0xA8, 0xB9, 0xFF, 0x6E, 0xDB, 0xAC, 0xB7, 0xFD,
-  0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xE6,
-  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x38, 0xFE, 0x39, 0xC7, 0xA9, 0xFF, 0xC4, 0xB0, 0xFF, 0xE5,
-  0xD0, 0xFF, 0xA5, 0xB8, 0xFF, 0x56, 0xFD, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xF5, 0x56, 0x4D, 0xC3,
-  0xDF, 0xC8, 0xA9, 0xFF, 0xE5, 0xA0, 0xFF, 0x05, 0xA1, 0xFF, 0xE5, 0xA8, 0xFF,
-  0x04, 0xA9, 0xFF, 0xE3, 0xA8, 0xFF, 0xC3, 0xA0, 0xFF, 0xC3, 0xA0, 0xFF, 0xC3,
-  0xA0, 0xFF, 0x04, 0xA1, 0xFF, 0x45, 0xA1, 0xFF, 0x86, 0xA1, 0xFF, 0xAB, 0xBA,
-  0xFE, 0xEF, 0xD3, 0xA1, 0x96, 0xFD, 0x4C, 0x79, 0xFE, 0x05,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x15, 0xFD, 0x40, 0x0B, 0xCA, 0xFA, 0x64, 0x90, 0xFF, 0x46, 0x89, 0xFF,
-  0xD8, 0xFD, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x79, 0xFE, 0x10, 0xD8, 0xFD, 0x29, 0x76, 0xFD, 0x35, 0x76, 0xFD,
-  0x3B, 0xB6, 0xFD, 0x37, 0xF7, 0xFD, 0x2B, 0x78, 0xFE, 0x15, 0x79, 0xFE, 0x05,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xDC, 0x61, 0x0C, 0x9B, 0xFF, 0x4B, 0x93,
-  0xFF, 0xF6, 0xD5, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xEE, 0x0D, 0xF7, 0xD5, 0x33, 0xBA,
-  0xEE, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xC6, 0x2C, 0xAA,
-  0x52, 0xB6, 0xCB, 0x5A, 0xAA, 0xAA, 0x52, 0xA8, 0x18, 0xC6, 0x1E, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xAE,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x4A, 0xB1, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x8A, 0x52, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x79, 0xCE, 0x10, 0x8A, 0x52, 0xB3, 0xAA, 0x52, 0xB0, 0x8A, 0x52, 0xB5, 0x9A,
-  0xD6, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x5A,
-  0xA9, 0xAA, 0x52, 0xAE, 0x8A, 0x52, 0xB6, 0x55, 0xAD, 0x43, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x75, 0xAD, 0x4E, 0x6D, 0x6B, 0x95, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x8A, 0x52, 0xB5, 0x1C, 0xE7, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x6B, 0x99, 0xB6, 0xB5, 0x40, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xAE, 0x73, 0x8F, 0xF3, 0x9C, 0x5B, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x5A, 0xAE, 0x8A,
-  0x52, 0xA8, 0xCB, 0x5A, 0xA9, 0x8A, 0x52, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x6D, 0x6B, 0x89, 0x8A, 0x52, 0xA7,
-  0x8A, 0x52, 0xA8, 0x8E, 0x73, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC7, 0x39, 0xD4, 0x49, 0x4A, 0xAB,
-  0xE3, 0x18, 0xE4, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79,
-  0xCE, 0x0F, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xDB, 0xDE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x65, 0x29, 0xE7, 0x69, 0x4A,
-  0xAF, 0x24, 0x21, 0xE6, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xC7, 0x39, 0xCD, 0x61, 0x08, 0xFF, 0x8A, 0x52, 0xB3, 0x28, 0x42, 0xC2, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x6B, 0x92, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xFF, 0xF7, 0xBD, 0x32,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08,
-  0xFF, 0x71, 0x8C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0xE3, 0x18, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0x39, 0xC6, 0xAA, 0x52, 0xB1,
-  0xA2, 0x10, 0xFF, 0x04, 0x21, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x84, 0x6A, 0x00,
-  0x00, 0xFF, 0x8A, 0x52, 0xAD, 0x8A, 0x52, 0xAE, 0x00, 0x00, 0xFF, 0xB6, 0xB5,
-  0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x5D,
-  0xEF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x6B, 0x89, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xDB, 0xDE, 0x0D, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xFE, 0xFF, 0xFF, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0xF7, 0xBD, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xAB, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x29, 0xD7, 0x10, 0x84, 0x7C, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xCF, 0x7B, 0x82, 0x00, 0x00, 0xFF, 0xCB, 0x5A, 0x9F, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x79, 0xCE, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xF3, 0x92, 0x94, 0x68, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xD7, 0xBD, 0x2D, 0x20, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x8C, 0x6A, 0x04, 0x21, 0xED, 0x00, 0x00,
-  0x00, 0x30, 0x84, 0x7C, 0x45, 0x29, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xEB, 0x5A, 0x9E, 0x79, 0xCE, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x96, 0xB5, 0x45, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xDE, 0x0D, 0x00,
-  0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFE, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x96, 0xB5, 0x41, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x65, 0x29, 0xD2, 0xAE, 0x73, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x73, 0x84, 0x00, 0x00,
-  0xFF, 0x20, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x59, 0xCE, 0x2A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x10,
-  0xF1, 0x71, 0x8C, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x52, 0xA5, 0x2C, 0x63, 0x8F, 0x04,
-  0x21, 0xF0, 0x34, 0xA5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x8C, 0x6C,
-  0x24, 0x21, 0xE1, 0x00, 0x00, 0x00, 0x34, 0xA5, 0x46, 0x00, 0x00, 0xFF, 0xAA,
-  0x52, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB,
-  0x5A, 0xA1, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x9A, 0xD6, 0x1D, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xDB, 0xDE, 0x0D, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xFF,
-  0x96, 0xB5, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x31, 0xD0, 0x6D, 0x6B, 0x87, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x4D, 0x6B, 0x8B, 0xAA, 0x52, 0xA4, 0x41, 0x08, 0xF1, 0x51, 0x8C, 0x65, 0x20,
-  0x00, 0xFF, 0x59, 0xCE, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x61, 0x08, 0xF1, 0x92, 0x94, 0x65, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x79, 0xCE, 0x1E, 0x6D, 0x6B, 0x84, 0xC7, 0x39, 0xCB,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xF7, 0xBD, 0x33, 0x20, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0xEB, 0x5A, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x39, 0xD7,
-  0x20, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xDE, 0x0D, 0x00,
-  0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0x75, 0xAD, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x31, 0xCE,
-  0x8E, 0x73, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x6B, 0x8C, 0x69, 0x4A, 0xB6, 0x75, 0xAD,
-  0x3C, 0x20, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x18, 0xC6, 0x21,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08,
-  0xF1, 0xD3, 0x9C, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xDE, 0x10, 0x34,
-  0xA5, 0x51, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x38, 0xC6, 0x35, 0xFF, 0xFF, 0x03, 0x2C, 0x63, 0x93,
-  0x08, 0x42, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xD7, 0xBD, 0x3D, 0x00, 0x00, 0xFF, 0x96, 0xB5, 0x3C, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x4A, 0xBF, 0xFF, 0xFF, 0x02, 0x00,
-  0x00, 0x00, 0x55, 0xAD, 0x49, 0x82, 0x10, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xDB, 0xDE, 0x0D, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-  0xD7, 0xBD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xA7, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x29, 0xCD, 0xCF, 0x7B, 0x7B, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x6D, 0x6B, 0x8C, 0xC7, 0x39, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-  0x00, 0xFF, 0x59, 0xCE, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x82, 0x10, 0xEF, 0xD3, 0x9C, 0x57, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x8C, 0x68, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xBA, 0xD6, 0x12,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x71, 0x8C, 0x69, 0xE3, 0x18, 0xE8, 0x00, 0x00, 0x00, 0x75, 0xAD,
-  0x44, 0xEF, 0x7B, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xFF,
-  0x96, 0xB5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xAE, 0x73, 0x8A, 0x55, 0xAD, 0x59, 0x8A, 0x52, 0xA6,
-  0x41, 0x08, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xD6, 0x12, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x10, 0x84, 0x70, 0xD3, 0x9C, 0x54, 0x71, 0x8C, 0x66, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x20, 0x00, 0xFE, 0x0C, 0x63, 0x8F, 0x34, 0xA5, 0x44, 0x4D, 0x6B,
-  0x89, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x29, 0xCD,
-  0xC7, 0x39, 0xC7, 0x14, 0xA5, 0x4A, 0xB2, 0x94, 0x5F, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x6B, 0x92, 0xC7, 0x39, 0xC3, 0x00, 0x00,
-  0x00, 0x8E, 0x73, 0x7C, 0x00, 0x00, 0xFF, 0x38, 0xC6, 0x20, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0xEC, 0x8A, 0x52,
-  0xA8, 0x14, 0xA5, 0x4F, 0x71, 0x8C, 0x62, 0xFB, 0xDE, 0x0F, 0x00, 0x00, 0x00,
-  0xE3, 0x18, 0xE6, 0xCF, 0x7B, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3,
-  0x18, 0xDE, 0x8E, 0x73, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0x30, 0x84, 0x70, 0x55, 0xAD, 0x4F, 0x28, 0x42, 0xB6,
-  0x04, 0x21, 0xE0, 0x00, 0x00, 0x00, 0xAE, 0x73, 0x81, 0x00, 0x00, 0xFF, 0x14,
-  0xA5, 0x4B, 0x34, 0xA5, 0x4C, 0x00, 0x00, 0xFF, 0x96, 0xB5, 0x40, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x7C, 0x41, 0x08, 0xFF, 0x00,
-  0x00, 0xFF, 0x61, 0x08, 0xFF, 0x75, 0xAD, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xDB, 0xDE, 0x0D, 0x20, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x61, 0x08, 0xEC, 0x82, 0x10, 0xF0, 0x41, 0x08, 0xF7, 0x20,
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xA5, 0x4F, 0x00, 0x00, 0xFC,
-  0x41, 0x08, 0xF5, 0x41, 0x08, 0xF9, 0xB2, 0x94, 0x5D, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x38, 0xC6, 0x1F, 0x61, 0x08, 0xF1, 0x41, 0x08, 0xF3, 0x00, 0x00,
-  0xFB, 0x2C, 0x63, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x7B, 0x75,
-  0x8A, 0x52, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x9A,
-  0xD6, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x08, 0x42, 0xBD, 0x41, 0x08, 0xF5, 0x41, 0x08, 0xFB, 0x00,
-  0x00, 0xFF, 0x34, 0xA5, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x79, 0xCE,
-  0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x8C, 0x68, 0x86, 0x31, 0xC8,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x10, 0xEF, 0x20, 0x00, 0xF7, 0x20,
-  0x00, 0xFE, 0x41, 0x08, 0xFD, 0xF7, 0xBD, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xC3, 0x18, 0xE1, 0x41, 0x08, 0xFD, 0x61, 0x08, 0xFE, 0x65, 0x29, 0xC6,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xC2, 0xEF, 0x8C, 0x00, 0x00, 0x00, 0x05, 0xFB, 0xFD, 0x08, 0x05, 0xA1, 0xFF,
+  0x26, 0xC9, 0xFF, 0xC4, 0xC0, 0xFF, 0xA3, 0xA8, 0xFF, 0xCE, 0xE3, 0x96, 0x89,
+  0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x1C, 0x47, 0xB1, 0xFF, 0xC5, 0xD0,
+  0xFF, 0xE6, 0xD8, 0xFF, 0xE5, 0xD8, 0xFF, 0xE5, 0xD0, 0xFF, 0x05, 0xD1, 0xFF,
+  0xE5, 0xD8, 0xFF, 0xC4, 0xD0, 0xFF, 0xE5, 0xE0, 0xFF, 0xC5, 0xE0, 0xFF, 0xC4,
+  0xD8, 0xFF, 0x05, 0xD9, 0xFF, 0xC5, 0xC8, 0xFF, 0x83, 0xA8, 0xFF, 0xEC, 0xDA,
+  0xEF, 0xAA, 0xC2, 0xFF, 0x66, 0xA1, 0xFF, 0x25, 0xA1, 0xFF, 0x05, 0xA9, 0xFF,
+  0xE5, 0xB8, 0xFF, 0xE5, 0xC0, 0xFF, 0x05, 0xC1, 0xFF, 0x25, 0xB9, 0xFF, 0x04,
+  0xB1, 0xFF, 0xC3, 0xB0, 0xFF, 0xA3, 0xA8, 0xFF, 0xA4, 0xA8, 0xFF, 0xC4, 0xB0,
+  0xFF, 0xA5, 0xB0, 0xFF, 0x81, 0xA4, 0xB0, 0xFF, 0x81, 0xC4, 0xA8, 0xFF, 0x81,
+  0xC4, 0xB0, 0xFF, 0x02, 0xE5, 0xB8, 0xFF, 0xA3, 0xB0, 0xFF, 0xE4, 0xB0, 0xFF,
+  0x81, 0x04, 0xB9, 0xFF, 0x01, 0x05, 0xC1, 0xFF, 0x05, 0xC9, 0xFF, 0x81, 0xE5,
+  0xD0, 0xFF, 0x05, 0x25, 0xD9, 0xFF, 0xE4, 0xD0, 0xFF, 0xE5, 0xE0, 0xFF, 0xE6,
+  0xD0, 0xFF, 0x06, 0xB1, 0xFF, 0x8F, 0xCB, 0xAF, 0x8C, 0x00, 0x00, 0x00, 0x04,
+  0xA8, 0xA9, 0xFF, 0x26, 0xB1, 0xFF, 0xC4, 0x98, 0xFF, 0xCB, 0xBA, 0xE8, 0xDB,
+  0xFE, 0x0E, 0x8A, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x03, 0xE6, 0xB0,
+  0xFF, 0xE7, 0xD8, 0xFF, 0x84, 0xC8, 0xFF, 0x06, 0xD9, 0xFF, 0x81, 0xE5, 0xD0,
+  0xFF, 0x07, 0xE5, 0xD8, 0xFF, 0xC5, 0xD8, 0xFF, 0xC5, 0xE0, 0xFF, 0xC5, 0xD0,
+  0xFF, 0xE4, 0xC8, 0xFF, 0xA3, 0xA8, 0xFF, 0x4A, 0xCA, 0xE6, 0x5A, 0xFE, 0x13,
+  0x82, 0x00, 0x00, 0x00, 0x04, 0x19, 0xFE, 0x19, 0x52, 0xFC, 0x6D, 0xAC, 0xEA,
+  0xD8, 0x26, 0xD9, 0xFF, 0xE5, 0xD8, 0xFF, 0x81, 0xE4, 0xD0, 0xFF, 0x03, 0xE4,
+  0xD8, 0xFF, 0x05, 0xD9, 0xFF, 0xE5, 0xE0, 0xFF, 0xC5, 0xE0, 0xFF, 0x82, 0xC5,
+  0xD8, 0xFF, 0x00, 0xE5, 0xD8, 0xFF, 0x81, 0xC5, 0xD8, 0xFF, 0x03, 0xC5, 0xE0,
+  0xFF, 0xC4, 0xD8, 0xFF, 0xE5, 0xE0, 0xFF, 0xE5, 0xD8, 0xFF, 0x82, 0xE4, 0xD8,
+  0xFF, 0x07, 0xE5, 0xE0, 0xFF, 0xC5, 0xE0, 0xFF, 0xA4, 0xE0, 0xFF, 0xC4, 0xD8,
+  0xFF, 0xE5, 0xD8, 0xFF, 0xE5, 0xD0, 0xFF, 0x06, 0xB9, 0xFF, 0x46, 0x99, 0xFF,
+  0x8C, 0x00, 0x00, 0x00, 0x03, 0xA8, 0x99, 0xFF, 0xE5, 0x90, 0xFF, 0x4A, 0xB2,
+  0xFC, 0x19, 0xFE, 0x1D, 0x8C, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x05,
+  0x2A, 0xC2, 0xFF, 0xE6, 0xC8, 0xFF, 0xC5, 0xD0, 0xFF, 0xE5, 0xE0, 0xFF, 0xE5,
+  0xD8, 0xFF, 0xE4, 0xD8, 0xFF, 0x81, 0xE5, 0xD8, 0xFF, 0x03, 0xC5, 0xD0, 0xFF,
+  0xE5, 0xB8, 0xFF, 0x24, 0x99, 0xFF, 0xB6, 0xFD, 0x44, 0x87, 0x00, 0x00, 0x00,
+  0x09, 0x4E, 0xFB, 0xAC, 0xC4, 0xC8, 0xFF, 0xE4, 0xD0, 0xFF, 0x04, 0xD9, 0xFF,
+  0xC3, 0xC8, 0xFF, 0x04, 0xD9, 0xFF, 0xA3, 0xD8, 0xFF, 0xE5, 0xE0, 0xFF, 0xE5,
+  0xD8, 0xFF, 0xE5, 0xD0, 0xFF, 0x83, 0xE5, 0xD8, 0xFF, 0x02, 0xC5, 0xD8, 0xFF,
+  0xE4, 0xD8, 0xFF, 0xE5, 0xE0, 0xFF, 0x83, 0xE4, 0xD8, 0xFF, 0x01, 0xE5, 0xD8,
+  0xFF, 0xE5, 0xE0, 0xFF, 0x81, 0xE5, 0xD8, 0xFF, 0x03, 0x05, 0xC9, 0xFF, 0xC4,
+  0xA8, 0xFF, 0x29, 0xAA, 0xFF, 0xFF, 0xFF, 0x02, 0x8A, 0x00, 0x00, 0x00, 0x03,
+  0xF5, 0xEC, 0x67, 0x25, 0x71, 0xFF, 0x0C, 0xA3, 0xFA, 0x9A, 0xFE, 0x1C, 0x8E,
+  0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x09, 0x76, 0xFD, 0x4D, 0x84, 0xA0,
+  0xFF, 0xE6, 0xD0, 0xFF, 0xA5, 0xD8, 0xFF, 0xC4, 0xD0, 0xFF, 0xE4, 0xD8, 0xFF,
+  0x05, 0xE1, 0xFF, 0xC4, 0xC8, 0xFF, 0xE5, 0xB0, 0xFF, 0x4A, 0xBA, 0xFF, 0x88,
+  0x00, 0x00, 0x00, 0x08, 0x2C, 0xAB, 0xE3, 0xE5, 0xA0, 0xFF, 0x06, 0xD1, 0xFF,
+  0xC5, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0x04, 0xD1, 0xFF, 0x24, 0xD9, 0xFF, 0xE4,
+  0xE0, 0xFF, 0xA3, 0xD0, 0xFF, 0x81, 0x05, 0xD1, 0xFF, 0x01, 0xE5, 0xD0, 0xFF,
+  0xE5, 0xD8, 0xFF, 0x81, 0xC4, 0xD8, 0xFF, 0x81, 0xE4, 0xD8, 0xFF, 0x00, 0xC4,
+  0xD0, 0xFF, 0x81, 0xC4, 0xD8, 0xFF, 0x07, 0xC5, 0xD8, 0xFF, 0xE5, 0xD8, 0xFF,
+  0x05, 0xD1, 0xFF, 0x05, 0xC9, 0xFF, 0x05, 0xC1, 0xFF, 0xC4, 0xA8, 0xFF, 0x05,
+  0xA1, 0xFF, 0x51, 0xEC, 0x8A, 0x8A, 0x00, 0x00, 0x00, 0x03, 0x18, 0xDE, 0x42,
+  0xAB, 0x82, 0xFF, 0xAF, 0xBB, 0xCF, 0xFF, 0xFF, 0x02, 0x90, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x07, 0xAF, 0xCB, 0xB7, 0xE5, 0xB8, 0xFF, 0xC4, 0xD0,
+  0xFF, 0x04, 0xD1, 0xFF, 0x65, 0xD9, 0xFF, 0xC3, 0xD0, 0xFF, 0x24, 0xC1, 0xFF,
+  0xEB, 0xC2, 0xE4, 0x89, 0x00, 0x00, 0x00, 0x08, 0x10, 0xC4, 0xA1, 0x84, 0x98,
+  0xFF, 0x07, 0xD9, 0xFF, 0xE6, 0xE0, 0xFF, 0xE5, 0xE0, 0xFF, 0x05, 0xD9, 0xFF,
+  0xE4, 0xD0, 0xFF, 0xE5, 0xD8, 0xFF, 0xE5, 0xD0, 0xFF, 0x81, 0x04, 0xC9, 0xFF,
+  0x81, 0xE4, 0xD8, 0xFF, 0x00, 0xE4, 0xE0, 0xFF, 0x81, 0xE4, 0xD8, 0xFF, 0x00,
+  0xE4, 0xD0, 0xFF, 0x81, 0xE5, 0xD8, 0xFF, 0x06, 0xE6, 0xE0, 0xFF, 0xC6, 0xD8,
+  0xFF, 0xC5, 0xC8, 0xFF, 0xE5, 0xB8, 0xFF, 0x25, 0xB1, 0xFF, 0x86, 0x99, 0xFF,
+  0x91, 0xDC, 0x93, 0x8A, 0x00, 0x00, 0x00, 0x02, 0x39, 0xDE, 0x57, 0xD3, 0xAC,
+  0xBB, 0xD7, 0xCD, 0x60, 0x93, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x06,
+  0x4E, 0xDB, 0xAA, 0xA3, 0xA8, 0xFF, 0x44, 0xC1, 0xFF, 0xE3, 0xC0, 0xFF, 0x04,
+  0xD9, 0xFF, 0xC3, 0xB0, 0xFF, 0xF7, 0xFD, 0x18, 0x8A, 0x00, 0x00, 0x00, 0x06,
+  0x93, 0xFC, 0x75, 0xA5, 0xA0, 0xFF, 0xC4, 0xB0, 0xFF, 0xE5, 0xC0, 0xFF, 0xC4,
+  0xB8, 0xFF, 0x46, 0xD1, 0xFF, 0xC5, 0xC0, 0xFF, 0x81, 0x25, 0xC9, 0xFF, 0x81,
+  0x24, 0xC9, 0xFF, 0x81, 0x05, 0xD1, 0xFF, 0x81, 0x25, 0xC9, 0xFF, 0x07, 0x25,
+  0xC1, 0xFF, 0x05, 0xB9, 0xFF, 0xE4, 0xB8, 0xFF, 0xA4, 0xB0, 0xFF, 0xC5, 0xA8,
+  0xFF, 0xA8, 0xB9, 0xFF, 0x6E, 0xDB, 0xAC, 0xB7, 0xFD, 0x31, 0x8B, 0x00, 0x00,
+  0x00, 0x00, 0x7B, 0xE6, 0x30, 0x96, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x05, 0x38, 0xFE, 0x39, 0xC7, 0xA9, 0xFF, 0xC4, 0xB0, 0xFF, 0xE5, 0xD0, 0xFF,
+  0xA5, 0xB8, 0xFF, 0x56, 0xFD, 0x3B, 0x8C, 0x00, 0x00, 0x00, 0x07, 0x74, 0xF5,
+  0x56, 0x4D, 0xC3, 0xDF, 0xC8, 0xA9, 0xFF, 0xE5, 0xA0, 0xFF, 0x05, 0xA1, 0xFF,
+  0xE5, 0xA8, 0xFF, 0x04, 0xA9, 0xFF, 0xE3, 0xA8, 0xFF, 0x82, 0xC3, 0xA0, 0xFF,
+  0x06, 0x04, 0xA1, 0xFF, 0x45, 0xA1, 0xFF, 0x86, 0xA1, 0xFF, 0xAB, 0xBA, 0xFE,
+  0xEF, 0xD3, 0xA1, 0x96, 0xFD, 0x4C, 0x79, 0xFE, 0x05, 0xA6, 0x00, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x04, 0x15, 0xFD, 0x40, 0x0B, 0xCA, 0xFA, 0x64, 0x90,
+  0xFF, 0x46, 0x89, 0xFF, 0xD8, 0xFD, 0x33, 0x8F, 0x00, 0x00, 0x00, 0x07, 0x79,
+  0xFE, 0x10, 0xD8, 0xFD, 0x29, 0x76, 0xFD, 0x35, 0x76, 0xFD, 0x3B, 0xB6, 0xFD,
+  0x37, 0xF7, 0xFD, 0x2B, 0x78, 0xFE, 0x15, 0x79, 0xFE, 0x05, 0xAC, 0x00, 0x00,
+  0x00, 0x8B, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xDC, 0x61, 0x0C, 0x9B, 0xFF, 0x4B,
+  0x93, 0xFF, 0xF6, 0xD5, 0x38, 0xC2, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00,
+  0x02, 0xD8, 0xEE, 0x0D, 0xF7, 0xD5, 0x33, 0xBA, 0xEE, 0x0C, 0xC0, 0x00, 0x00,
+  0x00, 0xD2, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x04, 0x38, 0xC6, 0x2C,
+  0xAA, 0x52, 0xB6, 0xCB, 0x5A, 0xAA, 0xAA, 0x52, 0xA8, 0x18, 0xC6, 0x1E, 0x82,
+  0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xAE, 0x82, 0x00, 0x00, 0x00, 0x00, 0x69,
+  0x4A, 0xB1, 0x84, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x52, 0xB5, 0x82, 0x00, 0x00,
+  0x00, 0x04, 0x79, 0xCE, 0x10, 0x8A, 0x52, 0xB3, 0xAA, 0x52, 0xB0, 0x8A, 0x52,
+  0xB5, 0x9A, 0xD6, 0x1C, 0x82, 0x00, 0x00, 0x00, 0x03, 0xCB, 0x5A, 0xA9, 0xAA,
+  0x52, 0xAE, 0x8A, 0x52, 0xB6, 0x55, 0xAD, 0x43, 0x81, 0x00, 0x00, 0x00, 0x01,
+  0x75, 0xAD, 0x4E, 0x6D, 0x6B, 0x95, 0x81, 0x00, 0x00, 0x00, 0x01, 0x8A, 0x52,
+  0xB5, 0x1C, 0xE7, 0x12, 0x87, 0x00, 0x00, 0x00, 0x01, 0x6D, 0x6B, 0x99, 0xB6,
+  0xB5, 0x40, 0x85, 0x00, 0x00, 0x00, 0x01, 0xAE, 0x73, 0x8F, 0xF3, 0x9C, 0x5B,
+  0x83, 0x00, 0x00, 0x00, 0x03, 0xCB, 0x5A, 0xAE, 0x8A, 0x52, 0xA8, 0xCB, 0x5A,
+  0xA9, 0x8A, 0x52, 0xA9, 0x82, 0x00, 0x00, 0x00, 0x03, 0x6D, 0x6B, 0x89, 0x8A,
+  0x52, 0xA7, 0x8A, 0x52, 0xA8, 0x8E, 0x73, 0x8A, 0x83, 0x00, 0x00, 0x00, 0x83,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xFF, 0xC7, 0x39, 0xD4, 0x49, 0x4A, 0xAB,
+  0xE3, 0x18, 0xE4, 0x00, 0x00, 0xF9, 0x81, 0x00, 0x00, 0x00, 0x01, 0x79, 0xCE,
+  0x0F, 0x00, 0x00, 0xFE, 0x82, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB,
+  0xDE, 0x07, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x82, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0xFF, 0x65, 0x29, 0xE7, 0x69, 0x4A, 0xAF, 0x24, 0x21,
+  0xE6, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x04, 0xC7, 0x39, 0xCD, 0x61,
+  0x08, 0xFF, 0x8A, 0x52, 0xB3, 0x28, 0x42, 0xC2, 0x00, 0x00, 0xFF, 0x81, 0x00,
+  0x00, 0x00, 0x01, 0x4D, 0x6B, 0x92, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00,
+  0x01, 0x20, 0x00, 0xFF, 0xF7, 0xBD, 0x32, 0x87, 0x00, 0x00, 0x00, 0x01, 0x41,
+  0x08, 0xFF, 0x71, 0x8C, 0x70, 0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFF,
+  0xE3, 0x18, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0xFF, 0xE7, 0x39,
+  0xC6, 0xAA, 0x52, 0xB1, 0xA2, 0x10, 0xFF, 0x04, 0x21, 0xE0, 0x00, 0x00, 0x00,
+  0x10, 0x84, 0x6A, 0x00, 0x00, 0xFF, 0x8A, 0x52, 0xAD, 0x8A, 0x52, 0xAE, 0x00,
+  0x00, 0xFF, 0xB6, 0xB5, 0x42, 0x82, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0xFF, 0x5D, 0xEF, 0x0B, 0x81, 0x00, 0x00, 0x00, 0x00, 0x4D,
+  0x6B, 0x89, 0x81, 0x00, 0x00, 0x00, 0x01, 0xDB, 0xDE, 0x0D, 0x00, 0x00, 0xFE,
+  0x82, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0xFE, 0xFF, 0xFF, 0x04, 0x83, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x82, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0xFF, 0xF7, 0xBD, 0x32, 0x81, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xAB, 0x81,
+  0x00, 0x00, 0x00, 0x01, 0x45, 0x29, 0xD7, 0x10, 0x84, 0x7C, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x05, 0xCF, 0x7B, 0x82,
+  0x00, 0x00, 0xFF, 0xCB, 0x5A, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x79,
+  0xCE, 0x2D, 0x87, 0x00, 0x00, 0x00, 0x01, 0x41, 0x08, 0xF3, 0x92, 0x94, 0x68,
+  0x84, 0x00, 0x00, 0x00, 0x02, 0xD7, 0xBD, 0x2D, 0x20, 0x00, 0xFF, 0x00, 0x00,
+  0xFF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x81, 0x00, 0x00, 0x00,
+  0x04, 0x71, 0x8C, 0x6A, 0x04, 0x21, 0xED, 0x00, 0x00, 0x00, 0x30, 0x84, 0x7C,
+  0x45, 0x29, 0xDF, 0x81, 0x00, 0x00, 0x00, 0x01, 0xEB, 0x5A, 0x9E, 0x79, 0xCE,
+  0x24, 0x82, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0xFF,
+  0x00, 0x96, 0xB5, 0x45, 0x83, 0x00, 0x00, 0x00, 0x01, 0xDB, 0xDE, 0x0D, 0x00,
+  0x00, 0xFE, 0x82, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x02,
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x82, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0xFF, 0x96, 0xB5, 0x41, 0x84, 0x00, 0x00, 0x00, 0x01, 0x65, 0x29,
+  0xD2, 0xAE, 0x73, 0x86, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x81,
+  0x00, 0x00, 0x00, 0x05, 0xAE, 0x73, 0x84, 0x00, 0x00, 0xFF, 0x20, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x59, 0xCE, 0x2A, 0x87, 0x00, 0x00, 0x00,
+  0x01, 0xA2, 0x10, 0xF1, 0x71, 0x8C, 0x66, 0x84, 0x00, 0x00, 0x00, 0x03, 0x8A,
+  0x52, 0xA5, 0x2C, 0x63, 0x8F, 0x04, 0x21, 0xF0, 0x34, 0xA5, 0x55, 0x82, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x81, 0x00, 0x00, 0x00, 0x05, 0x71, 0x8C,
+  0x6C, 0x24, 0x21, 0xE1, 0x00, 0x00, 0x00, 0x34, 0xA5, 0x46, 0x00, 0x00, 0xFF,
+  0xAA, 0x52, 0xAB, 0x85, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0xEB,
+  0x5A, 0xA1, 0x81, 0x00, 0x00, 0xFF, 0x00, 0x9A, 0xD6, 0x1D, 0x81, 0x00, 0x00,
+  0x00, 0x01, 0xDB, 0xDE, 0x0D, 0x00, 0x00, 0xFE, 0x82, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x02, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFE, 0x82, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0xFF, 0x96, 0xB5, 0x42, 0x84,
+  0x00, 0x00, 0x00, 0x01, 0x86, 0x31, 0xD0, 0x6D, 0x6B, 0x87, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x05, 0x4D, 0x6B, 0x8B,
+  0xAA, 0x52, 0xA4, 0x41, 0x08, 0xF1, 0x51, 0x8C, 0x65, 0x20, 0x00, 0xFF, 0x59,
+  0xCE, 0x26, 0x87, 0x00, 0x00, 0x00, 0x01, 0x61, 0x08, 0xF1, 0x92, 0x94, 0x65,
+  0x84, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xFF, 0x79, 0xCE, 0x1E, 0x6D, 0x6B,
+  0x84, 0xC7, 0x39, 0xCB, 0x82, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0xFF, 0x00,
+  0x20, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x03, 0xF7, 0xBD, 0x33, 0x20, 0x00,
+  0xFF, 0x00, 0x00, 0xFF, 0xEB, 0x5A, 0x9E, 0x83, 0x00, 0x00, 0x00, 0x86, 0x00,
+  0x00, 0x00, 0x01, 0xC7, 0x39, 0xD7, 0x20, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00,
+  0x01, 0xDB, 0xDE, 0x0D, 0x00, 0x00, 0xFE, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFE, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x82, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0xFE, 0x75, 0xAD, 0x3F, 0x84, 0x00, 0x00, 0x00, 0x01,
+  0x86, 0x31, 0xCE, 0x8E, 0x73, 0x85, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x81, 0x00, 0x00, 0x00, 0x05, 0x4D, 0x6B, 0x8C, 0x69, 0x4A, 0xB6, 0x75,
+  0xAD, 0x3C, 0x20, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x18, 0xC6, 0x21, 0x87, 0x00,
+  0x00, 0x00, 0x01, 0x41, 0x08, 0xF1, 0xD3, 0x9C, 0x64, 0x84, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0xFF, 0xFB, 0xDE, 0x10, 0x34, 0xA5, 0x51, 0x00, 0x00, 0xFF,
+  0x82, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xFF, 0x38, 0xC6, 0x35, 0xFF, 0xFF,
+  0x03, 0x2C, 0x63, 0x93, 0x08, 0x42, 0xBD, 0x83, 0x00, 0x00, 0x00, 0x02, 0xD7,
+  0xBD, 0x3D, 0x00, 0x00, 0xFF, 0x96, 0xB5, 0x3C, 0x82, 0x00, 0x00, 0x00, 0x83,
+  0x00, 0x00, 0x00, 0x04, 0x69, 0x4A, 0xBF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+  0x55, 0xAD, 0x49, 0x82, 0x10, 0xF9, 0x81, 0x00, 0x00, 0x00, 0x01, 0xDB, 0xDE,
+  0x0D, 0x00, 0x00, 0xFE, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x84,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x82, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0xFE, 0xD7, 0xBD, 0x30, 0x81, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xA7,
+  0x81, 0x00, 0x00, 0x00, 0x01, 0x65, 0x29, 0xCD, 0xCF, 0x7B, 0x7B, 0x81, 0x00,
+  0x00, 0x00, 0x00, 0x20, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x05, 0x6D, 0x6B,
+  0x8C, 0xC7, 0x39, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF,
+  0x59, 0xCE, 0x1C, 0x87, 0x00, 0x00, 0x00, 0x01, 0x82, 0x10, 0xEF, 0xD3, 0x9C,
+  0x57, 0x83, 0x00, 0x00, 0x00, 0x00, 0x71, 0x8C, 0x68, 0x83, 0x00, 0x00, 0xFF,
+  0x00, 0xBA, 0xD6, 0x12, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x81,
+  0x00, 0x00, 0x00, 0x04, 0x71, 0x8C, 0x69, 0xE3, 0x18, 0xE8, 0x00, 0x00, 0x00,
+  0x75, 0xAD, 0x44, 0xEF, 0x7B, 0x7C, 0x81, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00,
+  0xFF, 0x96, 0xB5, 0x40, 0x82, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0xFF, 0xAE, 0x73, 0x8A, 0x55, 0xAD, 0x59, 0x8A, 0x52, 0xA6, 0x41,
+  0x08, 0xF9, 0x81, 0x00, 0x00, 0x00, 0x01, 0xBA, 0xD6, 0x12, 0x00, 0x00, 0xFF,
+  0x82, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xFF, 0x10, 0x84, 0x70, 0xD3, 0x9C,
+  0x54, 0x71, 0x8C, 0x66, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x82,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x00, 0xFE, 0x0C, 0x63, 0x8F, 0x34, 0xA5, 0x44,
+  0x4D, 0x6B, 0x89, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x04, 0x65, 0x29,
+  0xCD, 0xC7, 0x39, 0xC7, 0x14, 0xA5, 0x4A, 0xB2, 0x94, 0x5F, 0x00, 0x00, 0xFF,
+  0x81, 0x00, 0x00, 0x00, 0x05, 0x4D, 0x6B, 0x92, 0xC7, 0x39, 0xC3, 0x00, 0x00,
+  0x00, 0x8E, 0x73, 0x7C, 0x00, 0x00, 0xFF, 0x38, 0xC6, 0x20, 0x87, 0x00, 0x00,
+  0x00, 0x07, 0x61, 0x08, 0xEC, 0x8A, 0x52, 0xA8, 0x14, 0xA5, 0x4F, 0x71, 0x8C,
+  0x62, 0xFB, 0xDE, 0x0F, 0x00, 0x00, 0x00, 0xE3, 0x18, 0xE6, 0xCF, 0x7B, 0x81,
+  0x81, 0x00, 0x00, 0x00, 0x01, 0xE3, 0x18, 0xDE, 0x8E, 0x73, 0x89, 0x81, 0x00,
+  0x00, 0x00, 0x0B, 0x00, 0x00, 0xFF, 0x30, 0x84, 0x70, 0x55, 0xAD, 0x4F, 0x28,
+  0x42, 0xB6, 0x04, 0x21, 0xE0, 0x00, 0x00, 0x00, 0xAE, 0x73, 0x81, 0x00, 0x00,
+  0xFF, 0x14, 0xA5, 0x4B, 0x34, 0xA5, 0x4C, 0x00, 0x00, 0xFF, 0x96, 0xB5, 0x40,
+  0x82, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x04, 0x10, 0x84, 0x7C, 0x41,
+  0x08, 0xFF, 0x00, 0x00, 0xFF, 0x61, 0x08, 0xFF, 0x75, 0xAD, 0x45, 0x81, 0x00,
+  0x00, 0x00, 0x01, 0xDB, 0xDE, 0x0D, 0x20, 0x00, 0xFA, 0x82, 0x00, 0x00, 0x00,
+  0x03, 0x61, 0x08, 0xEC, 0x82, 0x10, 0xF0, 0x41, 0x08, 0xF7, 0x20, 0x00, 0xFF,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x82, 0x00, 0x00, 0x00, 0x04,
+  0x34, 0xA5, 0x4F, 0x00, 0x00, 0xFC, 0x41, 0x08, 0xF5, 0x41, 0x08, 0xF9, 0xB2,
+  0x94, 0x5D, 0x81, 0x00, 0x00, 0x00, 0x04, 0x38, 0xC6, 0x1F, 0x61, 0x08, 0xF1,
+  0x41, 0x08, 0xF3, 0x00, 0x00, 0xFB, 0x2C, 0x63, 0x8F, 0x81, 0x00, 0x00, 0x00,
+  0x01, 0xEF, 0x7B, 0x75, 0x8A, 0x52, 0xA3, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0xFE, 0x9A, 0xD6, 0x17, 0x87, 0x00, 0x00, 0x00, 0x07, 0x08, 0x42, 0xBD,
+  0x41, 0x08, 0xF5, 0x41, 0x08, 0xFB, 0x00, 0x00, 0xFF, 0x34, 0xA5, 0x4C, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFE, 0x79, 0xCE, 0x0A, 0x81, 0x00, 0x00, 0x00, 0x01,
+  0x71, 0x8C, 0x68, 0x86, 0x31, 0xC8, 0x81, 0x00, 0x00, 0x00, 0x04, 0xA2, 0x10,
+  0xEF, 0x20, 0x00, 0xF7, 0x20, 0x00, 0xFE, 0x41, 0x08, 0xFD, 0xF7, 0xBD, 0x35,
+  0x81, 0x00, 0x00, 0x00, 0x03, 0xC3, 0x18, 0xE1, 0x41, 0x08, 0xFD, 0x61, 0x08,
+  0xFE, 0x65, 0x29, 0xC6, 0x83, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0xD2,
+  0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0xD2, 0x00,
+  0x00, 0x00, 0xD2, 0x00, 0x00, 0x00,
 };
 const lv_img_dsc_t ui_img_1228364278 = {
   .header.always_zero = 0,
   .header.w = 83,
   .header.h = 48,
   .data_size = sizeof(ui_img_1228364278_data),
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = ui_img_1228364278_data
 };
@@ -10,427 +10,258 @@
 #endif
 
 // IMAGE DATA: assets\button_off_ic_1.png
+// RLE encoded by tools/img_rle_convert.py, 5292 bytes raw
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_button_off_ic_1_png_data[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x08, 0xEA, 0x43, 0x96, 0xE5, 0xD9, 0x38, 0xC6, 0xFF, 0x18, 0xC6, 0xFF,
-  0x96, 0xB5, 0xFF, 0x55, 0xAD, 0xFF, 0x34, 0xA5, 0xFF, 0x75, 0xAD, 0xFF, 0xD7,
-  0xBD, 0xFF, 0x18, 0xC6, 0xFB, 0x55, 0xAD, 0xC8, 0xAE, 0x7B, 0x71, 0x08, 0x42,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x24, 0xD9, 0x22, 0xB3, 0xF4, 0xB3, 0xB6, 0xB5, 0xFF,
-  0x30, 0x84, 0xFF, 0x2C, 0x63, 0xFF, 0xAA, 0x52, 0xFF, 0x49, 0x4A, 0xFF, 0x28,
-  0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x28, 0x42, 0xFF, 0x28, 0x42,
-  0xFF, 0x69, 0x4A, 0xFF, 0xEB, 0x5A, 0xFF, 0xAE, 0x73, 0xFF, 0xD3, 0x9C, 0xFF,
-  0x75, 0xB5, 0xD2, 0x49, 0x52, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xD9, 0x2E, 0xB3, 0xEC, 0xB7,
-  0xB6, 0xB5, 0xFF, 0x2C, 0x63, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08,
-  0x42, 0xFF, 0x28, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42,
-  0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF,
-  0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x28, 0x42, 0xFF, 0x49,
-  0x4A, 0xFF, 0x92, 0x94, 0xFF, 0x14, 0xA5, 0xC2, 0x69, 0x52, 0x37, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x4D, 0xF3, 0x75, 0xF7, 0xBD, 0xFF, 0xAE, 0x73, 0xFF, 0x49,
-  0x4A, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42,
-  0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF,
-  0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08,
-  0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42,
-  0xFF, 0xCB, 0x5A, 0xFF, 0xB2, 0x94, 0xFF, 0xEF, 0x83, 0x7E, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xC8, 0x19, 0x92,
-  0xF4, 0xAD, 0x75, 0xAD, 0xFF, 0x6A, 0x3A, 0xFF, 0x08, 0x42, 0xFF, 0x07, 0x42,
-  0xFF, 0x27, 0x3A, 0xFF, 0xE7, 0x49, 0xFF, 0xE8, 0x49, 0xFF, 0x09, 0x42, 0xFF,
-  0x08, 0x3A, 0xFF, 0x28, 0x3A, 0xFF, 0x07, 0x42, 0xFF, 0x07, 0x4A, 0xFF, 0x07,
-  0x42, 0xFF, 0x07, 0x4A, 0xFF, 0xE8, 0x49, 0xFF, 0x08, 0x42, 0xFF, 0x09, 0x42,
-  0xFF, 0x07, 0x42, 0xFF, 0x28, 0x3A, 0xFF, 0xE8, 0x41, 0xFF, 0xC8, 0x51, 0xFF,
-  0x08, 0x42, 0xFF, 0x08, 0x3A, 0xFF, 0x8E, 0x73, 0xFF, 0x30, 0x8C, 0x94, 0x00,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x24, 0xD1, 0x1C, 0x75, 0xED, 0xCF, 0xB2, 0x94, 0xFF, 0x49, 0x4A,
-  0xFF, 0xC6, 0x49, 0xFF, 0x07, 0x3A, 0xFF, 0x08, 0x42, 0xFF, 0xE8, 0x41, 0xFF,
-  0x28, 0x3A, 0xFF, 0xE6, 0x49, 0xFF, 0xA5, 0x61, 0xFF, 0x45, 0x79, 0xFF, 0xE4,
-  0x98, 0xFF, 0xA4, 0xA8, 0xFF, 0x83, 0xB8, 0xFF, 0x62, 0xC0, 0xFF, 0x82, 0xB8,
-  0xFF, 0xA3, 0xA8, 0xFF, 0x24, 0x91, 0xFF, 0x64, 0x79, 0xFF,
-  0xA7, 0x51, 0xFF, 0xE7, 0x49, 0xFF, 0x27, 0x3A, 0xFF, 0x07, 0x3A, 0xFF, 0x07,
-  0x42, 0xFF, 0x07, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x0C, 0x63, 0xFF, 0xEF, 0x83,
-  0x8C, 0x65, 0x39, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x14, 0xED, 0xC2, 0x92, 0x94, 0xFF, 0x08, 0x42, 0xFF, 0xE7, 0x39, 0xFF,
-  0x06, 0x42, 0xFF, 0xE8, 0x41, 0xFF, 0x08, 0x3A, 0xFF, 0x07, 0x42, 0xFF, 0x65,
-  0x69, 0xFF, 0xA2, 0xA8, 0xFF, 0x41, 0xC8, 0xFF, 0x01, 0xE0, 0xFF, 0x00, 0xE8,
-  0xFF, 0x00, 0xE8, 0xFF, 0x00, 0xE0, 0xFF, 0x20, 0xD8, 0xFF, 0x00, 0xE8, 0xFF,
-  0x00, 0xE8, 0xFF, 0x00, 0xE0, 0xFF, 0x40, 0xD0, 0xFF, 0x43, 0xC0, 0xFF, 0x63,
+  0x52, 0x4C, 0x45, 0x03, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x38, 0x00, 0x74,
+  0x00, 0xA5, 0x00, 0xC8, 0x00, 0x25, 0x01, 0x87, 0x01, 0xE8, 0x01, 0x41, 0x02,
+  0x9E, 0x02, 0x0B, 0x03, 0x6E, 0x03, 0xC7, 0x03, 0x28, 0x04, 0x82, 0x04, 0xE5,
+  0x04, 0x2F, 0x05, 0x76, 0x05, 0xB8, 0x05, 0xFE, 0x05, 0x44, 0x06, 0x9A, 0x06,
+  0xDF, 0x06, 0x33, 0x07, 0x7D, 0x07, 0xDD, 0x07, 0x40, 0x08, 0xA8, 0x08, 0xFF,
+  0x08, 0x65, 0x09, 0xC6, 0x09, 0x30, 0x0A, 0x89, 0x0A, 0xE1, 0x0A, 0x3B, 0x0B,
+  0x81, 0x0B, 0xB9, 0x0B, 0xDE, 0x0B, 0x01, 0x0C, 0x05, 0x0C, 0xA9, 0x00, 0x00,
+  0x00, 0xA9, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x0C, 0x08, 0xEA, 0x43,
+  0x96, 0xE5, 0xD9, 0x38, 0xC6, 0xFF, 0x18, 0xC6, 0xFF, 0x96, 0xB5, 0xFF, 0x55,
+  0xAD, 0xFF, 0x34, 0xA5, 0xFF, 0x75, 0xAD, 0xFF, 0xD7, 0xBD, 0xFF, 0x18, 0xC6,
+  0xFB, 0x55, 0xAD, 0xC8, 0xAE, 0x7B, 0x71, 0x08, 0x42, 0x24, 0x8D, 0x00, 0x00,
+  0x00, 0x8B, 0x00, 0x00, 0x00, 0x07, 0x24, 0xD9, 0x22, 0xB3, 0xF4, 0xB3, 0xB6,
+  0xB5, 0xFF, 0x30, 0x84, 0xFF, 0x2C, 0x63, 0xFF, 0xAA, 0x52, 0xFF, 0x49, 0x4A,
+  0xFF, 0x28, 0x42, 0xFF, 0x81, 0x08, 0x42, 0xFF, 0x81, 0x28, 0x42, 0xFF, 0x05,
+  0x69, 0x4A, 0xFF, 0xEB, 0x5A, 0xFF, 0xAE, 0x73, 0xFF, 0xD3, 0x9C, 0xFF, 0x75,
+  0xB5, 0xD2, 0x49, 0x52, 0x34, 0x8B, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x03, 0x86, 0xD9, 0x2E, 0xB3, 0xEC, 0xB7, 0xB6, 0xB5, 0xFF, 0x2C, 0x63, 0xFF,
+  0x82, 0x08, 0x42, 0xFF, 0x00, 0x28, 0x42, 0xFF, 0x88, 0x08, 0x42, 0xFF, 0x04,
+  0x28, 0x42, 0xFF, 0x49, 0x4A, 0xFF, 0x92, 0x94, 0xFF, 0x14, 0xA5, 0xC2, 0x69,
+  0x52, 0x37, 0x89, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x03, 0x4D, 0xF3,
+  0x75, 0xF7, 0xBD, 0xFF, 0xAE, 0x73, 0xFF, 0x49, 0x4A, 0xFF, 0x90, 0x08, 0x42,
+  0xFF, 0x02, 0xCB, 0x5A, 0xFF, 0xB2, 0x94, 0xFF, 0xEF, 0x83, 0x7E, 0x88, 0x00,
+  0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x1B, 0xE3, 0xC8, 0x19, 0x92, 0xF4, 0xAD,
+  0x75, 0xAD, 0xFF, 0x6A, 0x3A, 0xFF, 0x08, 0x42, 0xFF, 0x07, 0x42, 0xFF, 0x27,
+  0x3A, 0xFF, 0xE7, 0x49, 0xFF, 0xE8, 0x49, 0xFF, 0x09, 0x42, 0xFF, 0x08, 0x3A,
+  0xFF, 0x28, 0x3A, 0xFF, 0x07, 0x42, 0xFF, 0x07, 0x4A, 0xFF, 0x07, 0x42, 0xFF,
+  0x07, 0x4A, 0xFF, 0xE8, 0x49, 0xFF, 0x08, 0x42, 0xFF, 0x09, 0x42, 0xFF, 0x07,
+  0x42, 0xFF, 0x28, 0x3A, 0xFF, 0xE8, 0x41, 0xFF, 0xC8, 0x51, 0xFF, 0x08, 0x42,
+  0xFF, 0x08, 0x3A, 0xFF, 0x8E, 0x73, 0xFF, 0x30, 0x8C, 0x94, 0x00, 0x00, 0x02,
+  0x86, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x17, 0x24, 0xD1, 0x1C, 0x75,
+  0xED, 0xCF, 0xB2, 0x94, 0xFF, 0x49, 0x4A, 0xFF, 0xC6, 0x49, 0xFF, 0x07, 0x3A,
+  0xFF, 0x08, 0x42, 0xFF, 0xE8, 0x41, 0xFF, 0x28, 0x3A, 0xFF, 0xE6, 0x49, 0xFF,
+  0xA5, 0x61, 0xFF, 0x45, 0x79, 0xFF, 0xE4, 0x98, 0xFF, 0xA4, 0xA8, 0xFF, 0x83,
+  0xB8, 0xFF, 0x62, 0xC0, 0xFF, 0x82, 0xB8, 0xFF, 0xA3, 0xA8, 0xFF, 0x24, 0x91,
+  0xFF, 0x64, 0x79, 0xFF, 0xA7, 0x51, 0xFF, 0xE7, 0x49, 0xFF, 0x27, 0x3A, 0xFF,
+  0x07, 0x3A, 0xFF, 0x81, 0x07, 0x42, 0xFF, 0x03, 0x08, 0x42, 0xFF, 0x0C, 0x63,
+  0xFF, 0xEF, 0x83, 0x8C, 0x65, 0x39, 0x11, 0x85, 0x00, 0x00, 0x00, 0x85, 0x00,
+  0x00, 0x00, 0x0B, 0x14, 0xED, 0xC2, 0x92, 0x94, 0xFF, 0x08, 0x42, 0xFF, 0xE7,
+  0x39, 0xFF, 0x06, 0x42, 0xFF, 0xE8, 0x41, 0xFF, 0x08, 0x3A, 0xFF, 0x07, 0x42,
+  0xFF, 0x65, 0x69, 0xFF, 0xA2, 0xA8, 0xFF, 0x41, 0xC8, 0xFF, 0x01, 0xE0, 0xFF,
+  0x81, 0x00, 0xE8, 0xFF, 0x01, 0x00, 0xE0, 0xFF, 0x20, 0xD8, 0xFF, 0x81, 0x00,
+  0xE8, 0xFF, 0x0B, 0x00, 0xE0, 0xFF, 0x40, 0xD0, 0xFF, 0x43, 0xC0, 0xFF, 0x63,
   0x71, 0xFF, 0x25, 0x3A, 0xFF, 0x06, 0x3A, 0xFF, 0xE8, 0x39, 0xFF, 0x08, 0x3A,
   0xFF, 0xE7, 0x39, 0xFF, 0x08, 0x42, 0xFF, 0xCB, 0x5A, 0xFF, 0xAE, 0x7B, 0x7F,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF3, 0x92,
-  0x34, 0xA5, 0xFF, 0x28, 0x42, 0xFF, 0xE7, 0x39, 0xFF, 0xE7, 0x39, 0xFF, 0xE8,
-  0x39, 0xFF, 0x07, 0x32, 0xFF, 0xA6, 0x51, 0xFF, 0x03, 0x89, 0xFF, 0x41, 0xC8,
-  0xFF, 0x40, 0xD0, 0xFF, 0x20, 0xD0, 0xFF, 0x00, 0xE0, 0xFF, 0x00, 0xE0, 0xFF,
-  0x20, 0xD8, 0xFF, 0x40, 0xD0, 0xFF, 0x20, 0xD0, 0xFF, 0x00, 0xD8, 0xFF, 0x00,
-  0xE0, 0xFF, 0x00, 0xE0, 0xFF, 0x00, 0xE0, 0xFF, 0x00, 0xE0, 0xFF, 0x20, 0xD0,
-  0xFF, 0xA2, 0xB0, 0xFF, 0x45, 0x71, 0xFF, 0xE8, 0x39, 0xFF, 0xE7, 0x39, 0xFF,
-  0xE7, 0x39, 0xFF, 0xE7, 0x39, 0xFF, 0xE7, 0x39, 0xFF, 0x2C, 0x63, 0xFF, 0x6D,
-  0x73, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xA6, 0xE1, 0x35, 0x96, 0xCD, 0xE8, 0x28, 0x42, 0xFF, 0xE7,
-  0x39, 0xFF, 0xE7, 0x39, 0xFF, 0xE7, 0x39, 0xFF, 0xE7, 0x39, 0xFF, 0x65, 0x61,
-  0xFF, 0xA2, 0xA8, 0xFF, 0x00, 0xD8, 0xFF, 0x00, 0xD8, 0xFF, 0x00, 0xD8, 0xFF,
-  0x20, 0xD8, 0xFF, 0x41, 0xD0, 0xFF, 0x41, 0xC8, 0xFF, 0x41, 0xC0, 0xFF, 0x21,
-  0xB8, 0xFF, 0x02, 0xB8, 0xFF, 0x42, 0xB8, 0xFF, 0x82, 0xB8, 0xFF, 0x61, 0xC0,
-  0xFF, 0x41, 0xD0, 0xFF, 0x00, 0xD8, 0xFF, 0x20, 0xD8, 0xFF,
-  0x00, 0xE0, 0xFF, 0x22, 0xC8, 0xFF, 0x23, 0x79, 0xFF, 0xE6, 0x41, 0xFF, 0xE7,
-  0x39, 0xFF, 0xE7, 0x39, 0xFF, 0xE7, 0x39, 0xFF, 0xE7, 0x39, 0xFF, 0xCF, 0x7B,
-  0xFF, 0xCB, 0x62, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x54, 0xDD, 0xD5, 0x4C, 0x6B, 0xFF, 0x07, 0x3A, 0xFF, 0xC7, 0x39,
-  0xFF, 0xC7, 0x39, 0xFF, 0x06, 0x32, 0xFF, 0x64, 0x61, 0xFF, 0x82, 0xB0, 0xFF,
-  0x00, 0xD8, 0xFF, 0x00, 0xD8, 0xFF, 0x00, 0xD0, 0xFF, 0x41, 0xC8, 0xFF, 0x41,
-  0xB0, 0xFF, 0x20, 0x98, 0xFF, 0x20, 0x88, 0xFF, 0x20, 0x80, 0xFF, 0x20, 0x80,
-  0xFF, 0x00, 0x80, 0xFF, 0x20, 0x80, 0xFF, 0x20, 0x80, 0xFF, 0x20, 0x90, 0xFF,
-  0x40, 0xA0, 0xFF, 0x61, 0xB8, 0xFF, 0x40, 0xC8, 0xFF, 0x00, 0xD8, 0xFF, 0x20,
-  0xD0, 0xFF, 0x40, 0xC8, 0xFF, 0xC3, 0x90, 0xFF, 0xE6, 0x39, 0xFF, 0xE8, 0x31,
-  0xFF, 0xE7, 0x39, 0xFF, 0xE7, 0x39, 0xFF, 0x48, 0x3A, 0xFF, 0x8E, 0x73, 0x89,
-  0xA6, 0x31, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 0xF2, 0x65, 0x34, 0xAD,
-  0xFF, 0x27, 0x3A, 0xFF, 0xE7, 0x31, 0xFF, 0xC7, 0x39, 0xFF,
-  0xC6, 0x39, 0xFF, 0x85, 0x49, 0xFF, 0xC2, 0xA0, 0xFF, 0x21, 0xD0, 0xFF, 0x00,
-  0xD8, 0xFF, 0x60, 0xC0, 0xFF, 0x61, 0xC0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0x90,
-  0xFF, 0x00, 0x88, 0xFF, 0x00, 0x88, 0xFF, 0x00, 0x88, 0xFF, 0x00, 0x88, 0xFF,
-  0x00, 0x88, 0xFF, 0x00, 0x88, 0xFF, 0x00, 0x88, 0xFF, 0x00, 0x80, 0xFF, 0x00,
-  0x88, 0xFF, 0x00, 0x90, 0xFF, 0x40, 0xB0, 0xFF, 0x20, 0xC8, 0xFF, 0x00, 0xD0,
-  0xFF, 0x00, 0xD0, 0xFF, 0x61, 0xB8, 0xFF, 0x24, 0x79, 0xFF, 0xC7, 0x39, 0xFF,
-  0xC7, 0x39, 0xFF, 0xE7, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0x0C, 0x63, 0xFF, 0xEB,
-  0x62, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xE5, 0xD3, 0x0B, 0x63, 0xFF,
-  0xE6, 0x31, 0xFF, 0xC7, 0x31, 0xFF, 0xC6, 0x39, 0xFF, 0xC5, 0x39, 0xFF, 0xC4,
-  0x88, 0xFF, 0x20, 0xC8, 0xFF, 0x00, 0xD8, 0xFF, 0x00, 0xD0, 0xFF, 0x61, 0xB0,
-  0xFF, 0x20, 0x90, 0xFF, 0x00, 0x88, 0xFF, 0x00, 0x88, 0xFF, 0x00, 0x88, 0xFF,
-  0x00, 0x88, 0xFF, 0x00, 0x88, 0xFF, 0x00, 0x88, 0xFF, 0x00, 0x88, 0xFF, 0x00,
-  0x88, 0xFF, 0x00, 0x88, 0xFF, 0x00, 0x88, 0xFF, 0x00, 0x88, 0xFF, 0x00, 0x88,
-  0xFF, 0x00, 0x90, 0xFF, 0x40, 0xA0, 0xFF, 0x40, 0xC0, 0xFF,
-  0x00, 0xD0, 0xFF, 0x40, 0xC0, 0xFF, 0x22, 0xC0, 0xFF, 0x45, 0x61, 0xFF, 0xC6,
-  0x39, 0xFF, 0xE7, 0x31, 0xFF, 0xA7, 0x41, 0xFF, 0xE7, 0x39, 0xFF, 0xCF, 0x7B,
-  0xA9, 0xC7, 0x41, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x49, 0xEA, 0x4E, 0x75, 0xAD, 0xFF, 0xC6, 0x39, 0xFF, 0xC6,
-  0x31, 0xFF, 0xC7, 0x39, 0xFF, 0xA6, 0x39, 0xFF, 0x63, 0x59, 0xFF, 0x21, 0xC0,
-  0xFF, 0x20, 0xD0, 0xFF, 0x20, 0xC8, 0xFF, 0x40, 0xC0, 0xFF, 0x00, 0x98, 0xFF,
-  0x00, 0x90, 0xFF, 0x00, 0x88, 0xFF, 0x00, 0x88, 0xFF, 0x00, 0x88, 0xFF, 0x00,
-  0x90, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x90,
-  0xFF, 0x00, 0x90, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x88, 0xFF,
-  0x20, 0x88, 0xFF, 0x20, 0x88, 0xFF, 0x40, 0xA8, 0xFF, 0x20, 0xC8, 0xFF, 0x20,
-  0xC8, 0xFF, 0x00, 0xD0, 0xFF, 0xA3, 0x98, 0xFF, 0xE5, 0x31, 0xFF, 0xC7, 0x39,
-  0xFF, 0xE7, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0xEB, 0x5A, 0xFF, 0x0C, 0x63, 0x5A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-  0xEC, 0xC4, 0x8E, 0x73, 0xFF, 0xC6, 0x31, 0xFF, 0xA6, 0x39, 0xFF, 0xA7, 0x31,
-  0xFF, 0xA5, 0x39, 0xFF, 0xA2, 0x90, 0xFF, 0x00, 0xC8, 0xFF,
-  0x00, 0xC8, 0xFF, 0x40, 0xB8, 0xFF, 0x20, 0xA0, 0xFF, 0x00, 0x98, 0xFF, 0x00,
-  0x90, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x98, 0xFF, 0x00, 0x98,
-  0xFF, 0x00, 0x90, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x90, 0xFF,
-  0x00, 0x90, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x90, 0xFF, 0x00,
-  0x90, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x98, 0xFF, 0x20, 0xB8, 0xFF, 0x20, 0xC0,
-  0xFF, 0x20, 0xC8, 0xFF, 0x21, 0xB8, 0xFF, 0x45, 0x59, 0xFF, 0xA7, 0x39, 0xFF,
-  0xC6, 0x31, 0xFF, 0xA6, 0x31, 0xFF, 0x28, 0x42, 0xFF, 0x0C, 0x63, 0x65, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xDD,
-  0xD4, 0x8A, 0x52, 0xFF, 0xC6, 0x31, 0xFF, 0x66, 0x41, 0xFF, 0xA7, 0x31, 0xFF,
-  0xA5, 0x41, 0xFF, 0x21, 0xB8, 0xFF, 0x20, 0xC0, 0xFF, 0x01, 0xC8, 0xFF, 0x41,
-  0xB0, 0xFF, 0x20, 0x90, 0xFF, 0x20, 0x90, 0xFF, 0x20, 0x90, 0xFF, 0x00, 0x98,
-  0xFF, 0x00, 0x98, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x20, 0x98, 0xFF,
-  0x20, 0x98, 0xFF, 0x00, 0x98, 0xFF, 0x00, 0x98, 0xFF, 0x00, 0x98, 0xFF, 0x00,
-  0x98, 0xFF, 0x00, 0x98, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0x98, 0xFF, 0x00, 0x98,
-  0xFF, 0x00, 0x98, 0xFF, 0x00, 0xA0, 0xFF, 0x21, 0xB8, 0xFF,
-  0x00, 0xC8, 0xFF, 0x20, 0xB8, 0xFF, 0x85, 0x90, 0xFF, 0xC6, 0x31, 0xFF, 0x86,
-  0x41, 0xFF, 0xC7, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0x6D, 0x73, 0x93, 0x86, 0x31,
-  0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xB5, 0xF9,
-  0x28, 0x42, 0xFF, 0xA6, 0x31, 0xFF, 0x86, 0x39, 0xFF, 0xC6, 0x31, 0xFF, 0x23,
-  0x71, 0xFF, 0x01, 0xC8, 0xFF, 0x00, 0xC0, 0xFF, 0x20, 0xB8, 0xFF, 0x00, 0xA8,
-  0xFF, 0x00, 0x98, 0xFF, 0x00, 0x98, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF,
-  0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00,
-  0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0,
-  0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF,
-  0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x20, 0xB8, 0xFF, 0x20, 0xB8, 0xFF, 0x00,
-  0xC0, 0xFF, 0x61, 0xA8, 0xFF, 0xA4, 0x31, 0xFF, 0x87, 0x39, 0xFF, 0xA6, 0x31,
-  0xFF, 0xA6, 0x31, 0xFF, 0xCF, 0x7B, 0xFE, 0xEB, 0x62, 0x53, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xA5, 0xFF, 0xC7, 0x39, 0xFF, 0xA6,
-  0x31, 0xFF, 0x86, 0x39, 0xFF, 0x85, 0x39, 0xFF, 0xC3, 0x88, 0xFF, 0x00, 0xC8,
-  0xFF, 0x20, 0xB8, 0xFF, 0x20, 0xB8, 0xFF, 0x00, 0xA8, 0xFF,
-  0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00,
-  0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0,
-  0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF,
-  0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00,
-  0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0xB0, 0xFF, 0x20, 0xB8, 0xFF, 0x00, 0xB8,
-  0xFF, 0x40, 0xB0, 0xFF, 0x84, 0x49, 0xFF, 0x67, 0x39, 0xFF, 0x86, 0x31, 0xFF,
-  0x86, 0x31, 0xFF, 0xCB, 0x5A, 0xFF, 0x6D, 0x73, 0x6B, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0C, 0xEB, 0x70, 0xD3, 0x9C, 0xFF, 0x86, 0x31, 0xFF, 0xA6, 0x31,
-  0xFF, 0xA6, 0x31, 0xFF, 0x65, 0x41, 0xFF, 0x42, 0x98, 0xFF, 0x00, 0xC0, 0xFF,
-  0x20, 0xB0, 0xFF, 0x40, 0xB0, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00,
-  0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8,
-  0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF,
-  0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00,
-  0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8,
-  0xFF, 0x20, 0xB0, 0xFF, 0x20, 0xB8, 0xFF, 0x20, 0xB8, 0xFF,
-  0x20, 0xB8, 0xFF, 0x23, 0x59, 0xFF, 0x66, 0x39, 0xFF, 0x86, 0x31, 0xFF, 0x86,
-  0x31, 0xFF, 0x08, 0x42, 0xFF, 0x6D, 0x73, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xAF, 0xEB, 0x92, 0x10, 0xA4, 0xE4, 0x86, 0x31, 0xFF, 0x86, 0x31, 0xFF,
-  0x86, 0x31, 0xFF, 0x64, 0x39, 0xFF, 0x21, 0xA0, 0xFF, 0x00, 0xB8, 0xFF, 0x00,
-  0xB0, 0xFF, 0x41, 0xB0, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xA8,
-  0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF,
-  0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00,
-  0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8,
-  0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0xA8, 0xFF,
-  0x20, 0xA8, 0xFF, 0x20, 0xC0, 0xFF, 0x40, 0xA8, 0xFF, 0x00, 0xB8, 0xFF, 0xE3,
-  0x68, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0xA6, 0x31,
-  0xFF, 0x0C, 0x6B, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 0xEA, 0x69,
-  0x4D, 0xBB, 0xC1, 0x65, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0x84,
-  0x31, 0xFF, 0x21, 0xA0, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB8, 0xFF, 0x41, 0xB0,
-  0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF,
-  0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x00,
-  0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0,
-  0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF,
-  0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x20,
-  0xA8, 0xFF, 0x20, 0xC0, 0xFF, 0x40, 0xA0, 0xFF, 0x00, 0xB8, 0xFF, 0xE3, 0x68,
-  0xFF, 0xA6, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0xA6, 0x31, 0xFF,
-  0x2C, 0x6B, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xD9, 0x27, 0x4D,
-  0xBB, 0xB8, 0x65, 0x29, 0xFF, 0x65, 0x31, 0xFF, 0xA5, 0x21, 0xFF, 0x84, 0x31,
-  0xFF, 0x42, 0x98, 0xFF, 0x00, 0xB0, 0xFF, 0x20, 0xA8, 0xFF, 0x40, 0xB8, 0xFF,
-  0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x20, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x00,
-  0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0,
-  0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF,
-  0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x20, 0xB0, 0xFF, 0x20, 0xB0, 0xFF, 0x20,
-  0xB0, 0xFF, 0x20, 0xB0, 0xFF, 0x00, 0xB8, 0xFF, 0x00, 0xC0, 0xFF, 0x61, 0xA0,
-  0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB8, 0xFF, 0x02, 0x61, 0xFF,
-  0x86, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0xA6, 0x31, 0xFF, 0x6D,
-  0x73, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xB4,
-  0xD9, 0x86, 0x31, 0xFF, 0x65, 0x31, 0xFF, 0xA5, 0x21, 0xFF, 0x65, 0x31, 0xFF,
-  0x42, 0x90, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xA8, 0xFF, 0x20, 0xB8, 0xFF, 0x20,
-  0xB8, 0xFF, 0x00, 0xB8, 0xFF, 0x00, 0xB8, 0xFF, 0x00, 0xB8, 0xFF, 0x00, 0xB8,
-  0xFF, 0x00, 0xB8, 0xFF, 0x00, 0xB8, 0xFF, 0x00, 0xB8, 0xFF, 0x00, 0xB8, 0xFF,
-  0x00, 0xB8, 0xFF, 0x00, 0xB8, 0xFF, 0x00, 0xB8, 0xFF, 0x00, 0xB8, 0xFF, 0x00,
-  0xB8, 0xFF, 0x00, 0xB8, 0xFF, 0x00, 0xB8, 0xFF, 0x00, 0xB8, 0xFF, 0x00, 0xB8,
-  0xFF, 0x00, 0xB8, 0xFF, 0x00, 0xB8, 0xFF, 0x00, 0xC0, 0xFF, 0x40, 0xA0, 0xFF,
-  0x00, 0xB0, 0xFF, 0x00, 0xB0, 0xFF, 0x03, 0x59, 0xFF, 0x86, 0x29, 0xFF, 0x65,
-  0x29, 0xFF, 0x65, 0x29, 0xFF, 0x08, 0x42, 0xFF, 0x4D, 0x73, 0x69, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x9C, 0xE6, 0x86, 0x31, 0xFF,
-  0x65, 0x29, 0xFF, 0x85, 0x29, 0xFF, 0x65, 0x31, 0xFF, 0xA2, 0x78, 0xFF, 0x00,
-  0xA8, 0xFF, 0x00, 0xB0, 0xFF, 0x20, 0xB0, 0xFF, 0x20, 0xB8, 0xFF, 0x00, 0xC0,
-  0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xB8, 0xFF,
-  0x20, 0xB8, 0xFF, 0x20, 0xB8, 0xFF, 0x20, 0xB8, 0xFF, 0x20, 0xB8, 0xFF, 0x20,
-  0xB8, 0xFF, 0x20, 0xB8, 0xFF, 0x20, 0xB8, 0xFF, 0x20, 0xB8, 0xFF, 0x20, 0xB8,
-  0xFF, 0x20, 0xB8, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF,
-  0x00, 0xC0, 0xFF, 0x20, 0xB8, 0xFF, 0x20, 0xC0, 0xFF, 0x20, 0xA0, 0xFF, 0x00,
-  0xB0, 0xFF, 0x21, 0xA0, 0xFF, 0x23, 0x49, 0xFF, 0x65, 0x29, 0xFF, 0x65, 0x29,
-  0xFF, 0x65, 0x29, 0xFF, 0xAA, 0x52, 0xFF, 0x0C, 0x6B, 0x58, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xA5, 0xEC, 0xC7, 0x39, 0xFF, 0x65,
-  0x29, 0xFF, 0x65, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0xE3, 0x58, 0xFF, 0x20, 0xA0,
-  0xFF, 0x00, 0xA8, 0xFF, 0x20, 0xA8, 0xFF, 0x41, 0xB8, 0xFF, 0x00, 0xC0, 0xFF,
-  0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x00,
-  0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0,
-  0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF,
-  0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x20,
-  0xB8, 0xFF, 0x21, 0xB0, 0xFF, 0x20, 0xA0, 0xFF, 0x00, 0xA8, 0xFF, 0x62, 0x80,
-  0xFF, 0x44, 0x39, 0xFF, 0x65, 0x29, 0xFF, 0x65, 0x29, 0xFF,
-  0x45, 0x29, 0xFF, 0xCF, 0x7B, 0xFF, 0xC7, 0x41, 0x1A, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xA5, 0xD4, 0x49, 0x4A, 0xFF, 0x44, 0x21,
-  0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x23, 0x41, 0xFF, 0x40, 0x90, 0xFF,
-  0x20, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x41, 0xB0, 0xFF, 0x00, 0xC0, 0xFF, 0x00,
-  0xC8, 0xFF, 0x00, 0xC0, 0xFF, 0x20, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0,
-  0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF,
-  0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xFF, 0x20,
-  0xC0, 0xFF, 0x00, 0xC8, 0xFF, 0x00, 0xC8, 0xFF, 0x00, 0xC0, 0xFF, 0x40, 0xB8,
-  0xFF, 0x20, 0xA8, 0xFF, 0x20, 0xA0, 0xFF, 0x00, 0xA8, 0xFF, 0xA3, 0x68, 0xFF,
-  0x65, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x65, 0x29, 0xFF, 0x10,
-  0x84, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x30, 0x8C, 0xA1, 0x6D, 0x6B, 0xFF, 0x44, 0x21, 0xFF, 0x25, 0x29, 0xFF,
-  0x45, 0x29, 0xFF, 0x43, 0x29, 0xFF, 0xA1, 0x68, 0xFF, 0x20, 0xA0, 0xFF, 0x00,
-  0x98, 0xFF, 0x20, 0xA0, 0xFF, 0x41, 0xC0, 0xFF, 0x00, 0xD0, 0xFF, 0x20, 0xC8,
-  0xFF, 0x20, 0xC8, 0xFF, 0x20, 0xC8, 0xFF, 0x20, 0xC8, 0xFF,
-  0x20, 0xC8, 0xFF, 0x00, 0xC8, 0xFF, 0x20, 0xC8, 0xFF, 0x20, 0xC8, 0xFF, 0x20,
-  0xC8, 0xFF, 0x20, 0xC8, 0xFF, 0x20, 0xC8, 0xFF, 0x20, 0xC8, 0xFF, 0x40, 0xB8,
-  0xFF, 0x00, 0xC8, 0xFF, 0x00, 0xD0, 0xFF, 0x20, 0xC0, 0xFF, 0x40, 0xB0, 0xFF,
-  0x20, 0x98, 0xFF, 0x00, 0xA0, 0xFF, 0x21, 0x98, 0xFF, 0xE3, 0x48, 0xFF, 0x65,
-  0x21, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0xC7, 0x39, 0xFF, 0x8E, 0x73,
-  0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x34, 0xA5, 0xEF, 0x44, 0x21, 0xFF, 0x25, 0x29, 0xFF, 0x45,
-  0x29, 0xFF, 0x64, 0x21, 0xFF, 0xE2, 0x40, 0xFF, 0x41, 0x90, 0xFF, 0x00, 0xA0,
-  0xFF, 0x00, 0x98, 0xFF, 0x40, 0xA8, 0xFF, 0x41, 0xC8, 0xFF, 0x00, 0xD0, 0xFF,
-  0x00, 0xC8, 0xFF, 0x20, 0xC8, 0xFF, 0x20, 0xC8, 0xFF, 0x00, 0xC8, 0xFF, 0x00,
-  0xC8, 0xFF, 0x20, 0xC8, 0xFF, 0x20, 0xC8, 0xFF, 0x20, 0xC8, 0xFF, 0x20, 0xC8,
-  0xFF, 0x00, 0xD0, 0xFF, 0x20, 0xC8, 0xFF, 0x20, 0xC8, 0xFF, 0x00, 0xD0, 0xFF,
-  0x00, 0xC8, 0xFF, 0x61, 0xB8, 0xFF, 0x00, 0x98, 0xFF, 0x00, 0x98, 0xFF, 0x00,
-  0x98, 0xFF, 0x83, 0x70, 0xFF, 0x24, 0x31, 0xFF, 0x65, 0x21, 0xFF, 0x25, 0x29,
-  0xFF, 0x45, 0x29, 0xFF, 0xAA, 0x52, 0xFF, 0x0C, 0x6B, 0x5B,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x51, 0x8C, 0xAB, 0xEB, 0x5A, 0xFF, 0x44, 0x21, 0xFF, 0x25, 0x29,
-  0xFF, 0x44, 0x21, 0xFF, 0x24, 0x31, 0xFF, 0xC3, 0x58, 0xFF, 0x00, 0x98, 0xFF,
-  0x00, 0xA0, 0xFF, 0x00, 0x98, 0xFF, 0x60, 0xA0, 0xFF, 0x21, 0xC8, 0xFF, 0x00,
-  0xD0, 0xFF, 0x00, 0xD0, 0xFF, 0x00, 0xD0, 0xFF, 0x00, 0xD0, 0xFF, 0x00, 0xD0,
-  0xFF, 0x00, 0xD0, 0xFF, 0x00, 0xD0, 0xFF, 0x00, 0xD0, 0xFF, 0x00, 0xD0, 0xFF,
-  0x00, 0xD0, 0xFF, 0x00, 0xD0, 0xFF, 0x00, 0xE0, 0xFF, 0x20, 0xC8, 0xFF, 0x60,
-  0xB8, 0xFF, 0x20, 0xA0, 0xFF, 0x00, 0x98, 0xFF, 0x00, 0x98, 0xFF, 0x81, 0x78,
-  0xFF, 0x03, 0x39, 0xFF, 0x44, 0x21, 0xFF, 0x25, 0x29, 0xFF, 0x25, 0x29, 0xFF,
-  0x45, 0x29, 0xFF, 0x51, 0x8C, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21,
-  0x0D, 0xF3, 0x9C, 0xF7, 0x65, 0x29, 0xFF, 0x25, 0x29, 0xFF, 0x24, 0x21, 0xFF,
-  0x24, 0x21, 0xFF, 0x04, 0x29, 0xFF, 0xA1, 0x68, 0xFF, 0x00, 0x98, 0xFF, 0x00,
-  0xA8, 0xFF, 0x00, 0x98, 0xFF, 0x20, 0xA0, 0xFF, 0x21, 0xC8, 0xFF, 0x00, 0xD0,
-  0xFF, 0x00, 0xD0, 0xFF, 0x00, 0xD8, 0xFF, 0x00, 0xE0, 0xFF,
-  0x00, 0xE0, 0xFF, 0x00, 0xD8, 0xFF, 0x00, 0xD8, 0xFF, 0x00, 0xD8, 0xFF, 0x00,
-  0xD8, 0xFF, 0x00, 0xD8, 0xFF, 0x41, 0xD0, 0xFF, 0x80, 0xB0, 0xFF, 0x20, 0x90,
-  0xFF, 0x00, 0x98, 0xFF, 0x00, 0x98, 0xFF, 0x21, 0x88, 0xFF, 0xC2, 0x48, 0xFF,
-  0x63, 0x11, 0xFF, 0x44, 0x19, 0xFF, 0x05, 0x29, 0xFF, 0x24, 0x21, 0xFF, 0xEB,
-  0x5A, 0xFF, 0xEB, 0x62, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x8E, 0x73, 0x88, 0xEC, 0x62, 0xFF, 0x24, 0x21, 0xFF, 0x24, 0x21, 0xFF, 0x24,
-  0x21, 0xFF, 0x44, 0x19, 0xFF, 0xE3, 0x38, 0xFF, 0x82, 0x60, 0xFF, 0x00, 0x88,
-  0xFF, 0x00, 0x98, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0xA0, 0xFF, 0x21, 0xB8, 0xFF,
-  0x41, 0xC0, 0xFF, 0x41, 0xC8, 0xFF, 0x20, 0xD0, 0xFF, 0x20, 0xD0, 0xFF, 0x20,
-  0xD0, 0xFF, 0x20, 0xD0, 0xFF, 0x40, 0xC8, 0xFF, 0x40, 0xC8, 0xFF, 0x20, 0xB8,
-  0xFF, 0x20, 0xA0, 0xFF, 0x20, 0x88, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x90, 0xFF,
-  0x61, 0x78, 0xFF, 0xC2, 0x48, 0xFF, 0x03, 0x29, 0xFF, 0x44, 0x19, 0xFF, 0x25,
-  0x21, 0xFF, 0x04, 0x21, 0xFF, 0xA5, 0x31, 0xFF, 0x71, 0x94, 0xCE, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xCF, 0x83, 0x9B, 0xC6, 0x31, 0xFF, 0x23, 0x21, 0xFF, 0x03, 0x21,
-  0xFF, 0x23, 0x21, 0xFF, 0xE4, 0x28, 0xFF, 0x02, 0x29, 0xFF, 0x81, 0x58, 0xFF,
-  0x00, 0x90, 0xFF, 0x00, 0x98, 0xFF, 0x20, 0x88, 0xFF, 0x20, 0x88, 0xFF, 0x00,
-  0x90, 0xFF, 0x00, 0xA0, 0xFF, 0x20, 0xA8, 0xFF, 0x40, 0xB0, 0xFF, 0x00, 0xB8,
-  0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0x98, 0xFF, 0x00, 0x90, 0xFF,
-  0x00, 0x90, 0xFF, 0x00, 0x88, 0xFF, 0x00, 0x98, 0xFF, 0x01, 0x90, 0xFF, 0xC1,
-  0x50, 0xFF, 0x42, 0x19, 0xFF, 0x24, 0x21, 0xFF, 0xE5, 0x28, 0xFF, 0x05, 0x21,
-  0xFF, 0x24, 0x19, 0xFF, 0xCE, 0x73, 0xFF, 0x2C, 0x6B, 0x60, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x84, 0xC8, 0x86, 0x31, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF,
-  0x04, 0x21, 0xFF, 0x24, 0x19, 0xFF, 0x03, 0x29, 0xFF, 0xA2, 0x50, 0xFF, 0x21,
-  0x78, 0xFF, 0x00, 0x88, 0xFF, 0x00, 0x88, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x90,
-  0xFF, 0x00, 0x88, 0xFF, 0x20, 0x80, 0xFF, 0x00, 0x88, 0xFF,
-  0x00, 0x88, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x88, 0xFF, 0x00, 0x88, 0xFF, 0x00,
-  0x88, 0xFF, 0x20, 0x80, 0xFF, 0x62, 0x68, 0xFF, 0xA3, 0x40, 0xFF, 0x04, 0x21,
-  0xFF, 0x04, 0x19, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x24, 0x21, 0xFF,
-  0xEB, 0x5A, 0xFF, 0x8E, 0x73, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xAE, 0x7B, 0xC5, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x03,
-  0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x19, 0xFF, 0x03, 0x21, 0xFF, 0xE1, 0x30,
-  0xFF, 0xA0, 0x50, 0xFF, 0x80, 0x60, 0xFF, 0x40, 0x78, 0xFF, 0x00, 0x88, 0xFF,
-  0x00, 0x90, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x90, 0xFF, 0x00,
-  0x88, 0xFF, 0x00, 0x88, 0xFF, 0x20, 0x80, 0xFF, 0x41, 0x60, 0xFF, 0xA1, 0x40,
-  0xFF, 0x22, 0x21, 0xFF, 0x23, 0x19, 0xFF, 0x04, 0x21, 0xFF, 0xE4, 0x20, 0xFF,
-  0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x28, 0x42, 0xFF, 0xCF, 0x83, 0x94, 0x45,
-  0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x73, 0xB4, 0x86, 0x31, 0xFF, 0x03, 0x21,
-  0xFF, 0xE3, 0x18, 0xFF, 0x04, 0x19, 0xFF, 0x04, 0x19, 0xFF, 0x23, 0x11, 0xFF,
-  0x03, 0x21, 0xFF, 0xC2, 0x30, 0xFF, 0xA2, 0x40, 0xFF, 0x82, 0x50, 0xFF, 0x61,
-  0x58, 0xFF, 0x61, 0x58, 0xFF, 0x61, 0x60, 0xFF, 0x62, 0x60, 0xFF, 0x62, 0x58,
-  0xFF, 0x82, 0x48, 0xFF, 0xA2, 0x40, 0xFF, 0xC3, 0x28, 0xFF, 0x03, 0x21, 0xFF,
-  0x44, 0x11, 0xFF, 0x24, 0x11, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x24,
-  0x21, 0xFF, 0xCB, 0x5A, 0xFF, 0xAE, 0x7B, 0x84, 0xC7, 0x41, 0x16, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0C, 0x63, 0x80, 0xC6, 0x31, 0xFF, 0x04, 0x21, 0xFF,
-  0xE4, 0x20, 0xFF, 0xE4, 0x20, 0xFF, 0xE4, 0x20, 0xFF, 0x04, 0x19, 0xFF, 0x04,
-  0x19, 0xFF, 0x04, 0x19, 0xFF, 0x04, 0x19, 0xFF, 0x03, 0x19, 0xFF, 0x03, 0x19,
-  0xFF, 0x03, 0x19, 0xFF, 0xE3, 0x18, 0xFF, 0x04, 0x19, 0xFF,
-  0x24, 0x11, 0xFF, 0x44, 0x09, 0xFF, 0x24, 0x11, 0xFF, 0x04, 0x19, 0xFF, 0xC4,
-  0x20, 0xFF, 0xE4, 0x20, 0xFF, 0x04, 0x19, 0xFF, 0xE3, 0x18, 0xFF, 0x6D, 0x6B,
-  0xFF, 0x4D, 0x73, 0x70, 0x45, 0x29, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x5A, 0x5E, 0x2C, 0x63, 0xFF, 0x85,
-  0x29, 0xFF, 0x03, 0x19, 0xFF, 0xE3, 0x20, 0xFF, 0xE3, 0x18, 0xFF, 0x03, 0x19,
-  0xFF, 0x03, 0x19, 0xFF, 0x03, 0x19, 0xFF, 0x03, 0x19, 0xFF, 0x03, 0x19, 0xFF,
-  0xE3, 0x18, 0xFF, 0xE3, 0x20, 0xFF, 0xE3, 0x20, 0xFF, 0xE3, 0x20, 0xFF, 0x03,
-  0x19, 0xFF, 0x03, 0x19, 0xFF, 0x03, 0x19, 0xFF, 0x03, 0x19, 0xFF, 0x04, 0x21,
-  0xFF, 0x28, 0x42, 0xFF, 0x30, 0x84, 0xE4, 0x0C, 0x63, 0x58, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x31,
-  0x0F, 0xEB, 0x5A, 0xFF, 0xE3, 0x18, 0xFF, 0xE3, 0x18, 0xFF, 0xE3, 0x18, 0xFF,
-  0xE3, 0x18, 0xFF, 0xE3, 0x18, 0xFF, 0xE3, 0x18, 0xFF, 0xE3, 0x18, 0xFF, 0xE3,
-  0x18, 0xFF, 0xE3, 0x18, 0xFF, 0xE3, 0x18, 0xFF, 0xE3, 0x18, 0xFF, 0x03, 0x19,
-  0xFF, 0xE3, 0x18, 0xFF, 0xE3, 0x18, 0xFF, 0xA6, 0x31, 0xFF, 0xAE, 0x73, 0xBC,
-  0x69, 0x52, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x31, 0x8B, 0x65,
-  0x29, 0xFF, 0x24, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21,
-  0xFF, 0x24, 0x21, 0xFF, 0x86, 0x31, 0xEA, 0xC7, 0x39, 0x82,
-  0xA6, 0x31, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xF3, 0x92, 0x34,
+  0xA5, 0xFF, 0x28, 0x42, 0xFF, 0x81, 0xE7, 0x39, 0xFF, 0x06, 0xE8, 0x39, 0xFF,
+  0x07, 0x32, 0xFF, 0xA6, 0x51, 0xFF, 0x03, 0x89, 0xFF, 0x41, 0xC8, 0xFF, 0x40,
+  0xD0, 0xFF, 0x20, 0xD0, 0xFF, 0x81, 0x00, 0xE0, 0xFF, 0x03, 0x20, 0xD8, 0xFF,
+  0x40, 0xD0, 0xFF, 0x20, 0xD0, 0xFF, 0x00, 0xD8, 0xFF, 0x83, 0x00, 0xE0, 0xFF,
+  0x03, 0x20, 0xD0, 0xFF, 0xA2, 0xB0, 0xFF, 0x45, 0x71, 0xFF, 0xE8, 0x39, 0xFF,
+  0x83, 0xE7, 0x39, 0xFF, 0x01, 0x2C, 0x63, 0xFF, 0x6D, 0x73, 0x6A, 0x84, 0x00,
+  0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x02, 0xA6, 0xE1, 0x35, 0x96, 0xCD, 0xE8,
+  0x28, 0x42, 0xFF, 0x83, 0xE7, 0x39, 0xFF, 0x01, 0x65, 0x61, 0xFF, 0xA2, 0xA8,
+  0xFF, 0x82, 0x00, 0xD8, 0xFF, 0x0F, 0x20, 0xD8, 0xFF, 0x41, 0xD0, 0xFF, 0x41,
+  0xC8, 0xFF, 0x41, 0xC0, 0xFF, 0x21, 0xB8, 0xFF, 0x02, 0xB8, 0xFF, 0x42, 0xB8,
+  0xFF, 0x82, 0xB8, 0xFF, 0x61, 0xC0, 0xFF, 0x41, 0xD0, 0xFF, 0x00, 0xD8, 0xFF,
+  0x20, 0xD8, 0xFF, 0x00, 0xE0, 0xFF, 0x22, 0xC8, 0xFF, 0x23, 0x79, 0xFF, 0xE6,
+  0x41, 0xFF, 0x83, 0xE7, 0x39, 0xFF, 0x01, 0xCF, 0x7B, 0xFF, 0xCB, 0x62, 0x4D,
+  0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x02, 0x54, 0xDD, 0xD5, 0x4C,
+  0x6B, 0xFF, 0x07, 0x3A, 0xFF, 0x81, 0xC7, 0x39, 0xFF, 0x02, 0x06, 0x32, 0xFF,
+  0x64, 0x61, 0xFF, 0x82, 0xB0, 0xFF, 0x81, 0x00, 0xD8, 0xFF, 0x04, 0x00, 0xD0,
+  0xFF, 0x41, 0xC8, 0xFF, 0x41, 0xB0, 0xFF, 0x20, 0x98, 0xFF, 0x20, 0x88, 0xFF,
+  0x81, 0x20, 0x80, 0xFF, 0x00, 0x00, 0x80, 0xFF, 0x81, 0x20, 0x80, 0xFF, 0x09,
+  0x20, 0x90, 0xFF, 0x40, 0xA0, 0xFF, 0x61, 0xB8, 0xFF, 0x40, 0xC8, 0xFF, 0x00,
+  0xD8, 0xFF, 0x20, 0xD0, 0xFF, 0x40, 0xC8, 0xFF, 0xC3, 0x90, 0xFF, 0xE6, 0x39,
+  0xFF, 0xE8, 0x31, 0xFF, 0x81, 0xE7, 0x39, 0xFF, 0x02, 0x48, 0x3A, 0xFF, 0x8E,
+  0x73, 0x89, 0xA6, 0x31, 0x0E, 0x82, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x0D, 0xCB, 0xF2, 0x65, 0x34, 0xAD, 0xFF, 0x27, 0x3A, 0xFF, 0xE7, 0x31, 0xFF,
+  0xC7, 0x39, 0xFF, 0xC6, 0x39, 0xFF, 0x85, 0x49, 0xFF, 0xC2, 0xA0, 0xFF, 0x21,
+  0xD0, 0xFF, 0x00, 0xD8, 0xFF, 0x60, 0xC0, 0xFF, 0x61, 0xC0, 0xFF, 0x00, 0xA0,
+  0xFF, 0x00, 0x90, 0xFF, 0x86, 0x00, 0x88, 0xFF, 0x04, 0x00, 0x80, 0xFF, 0x00,
+  0x88, 0xFF, 0x00, 0x90, 0xFF, 0x40, 0xB0, 0xFF, 0x20, 0xC8, 0xFF, 0x81, 0x00,
+  0xD0, 0xFF, 0x01, 0x61, 0xB8, 0xFF, 0x24, 0x79, 0xFF, 0x81, 0xC7, 0x39, 0xFF,
+  0x03, 0xE7, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0x0C, 0x63, 0xFF, 0xEB, 0x62, 0x50,
+  0x82, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0B, 0x55, 0xE5, 0xD3, 0x0B,
+  0x63, 0xFF, 0xE6, 0x31, 0xFF, 0xC7, 0x31, 0xFF, 0xC6, 0x39, 0xFF, 0xC5, 0x39,
+  0xFF, 0xC4, 0x88, 0xFF, 0x20, 0xC8, 0xFF, 0x00, 0xD8, 0xFF, 0x00, 0xD0, 0xFF,
+  0x61, 0xB0, 0xFF, 0x20, 0x90, 0xFF, 0x8B, 0x00, 0x88, 0xFF, 0x0C, 0x00, 0x90,
+  0xFF, 0x40, 0xA0, 0xFF, 0x40, 0xC0, 0xFF, 0x00, 0xD0, 0xFF, 0x40, 0xC0, 0xFF,
+  0x22, 0xC0, 0xFF, 0x45, 0x61, 0xFF, 0xC6, 0x39, 0xFF, 0xE7, 0x31, 0xFF, 0xA7,
+  0x41, 0xFF, 0xE7, 0x39, 0xFF, 0xCF, 0x7B, 0xA9, 0xC7, 0x41, 0x1E, 0x81, 0x00,
+  0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x0C, 0x49, 0xEA, 0x4E, 0x75, 0xAD, 0xFF,
+  0xC6, 0x39, 0xFF, 0xC6, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0xA6, 0x39, 0xFF, 0x63,
+  0x59, 0xFF, 0x21, 0xC0, 0xFF, 0x20, 0xD0, 0xFF, 0x20, 0xC8, 0xFF, 0x40, 0xC0,
+  0xFF, 0x00, 0x98, 0xFF, 0x00, 0x90, 0xFF, 0x82, 0x00, 0x88, 0xFF, 0x87, 0x00,
+  0x90, 0xFF, 0x00, 0x00, 0x88, 0xFF, 0x81, 0x20, 0x88, 0xFF, 0x00, 0x40, 0xA8,
+  0xFF, 0x81, 0x20, 0xC8, 0xFF, 0x07, 0x00, 0xD0, 0xFF, 0xA3, 0x98, 0xFF, 0xE5,
+  0x31, 0xFF, 0xC7, 0x39, 0xFF, 0xE7, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0xEB, 0x5A,
+  0xFF, 0x0C, 0x63, 0x5A, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x06,
+  0xF4, 0xEC, 0xC4, 0x8E, 0x73, 0xFF, 0xC6, 0x31, 0xFF, 0xA6, 0x39, 0xFF, 0xA7,
+  0x31, 0xFF, 0xA5, 0x39, 0xFF, 0xA2, 0x90, 0xFF, 0x81, 0x00, 0xC8, 0xFF, 0x02,
+  0x40, 0xB8, 0xFF, 0x20, 0xA0, 0xFF, 0x00, 0x98, 0xFF, 0x82, 0x00, 0x90, 0xFF,
+  0x81, 0x00, 0x98, 0xFF, 0x89, 0x00, 0x90, 0xFF, 0x0A, 0x00, 0x98, 0xFF, 0x20,
+  0xB8, 0xFF, 0x20, 0xC0, 0xFF, 0x20, 0xC8, 0xFF, 0x21, 0xB8, 0xFF, 0x45, 0x59,
+  0xFF, 0xA7, 0x39, 0xFF, 0xC6, 0x31, 0xFF, 0xA6, 0x31, 0xFF, 0x28, 0x42, 0xFF,
+  0x0C, 0x63, 0x65, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x09, 0x14,
+  0xDD, 0xD4, 0x8A, 0x52, 0xFF, 0xC6, 0x31, 0xFF, 0x66, 0x41, 0xFF, 0xA7, 0x31,
+  0xFF, 0xA5, 0x41, 0xFF, 0x21, 0xB8, 0xFF, 0x20, 0xC0, 0xFF, 0x01, 0xC8, 0xFF,
+  0x41, 0xB0, 0xFF, 0x82, 0x20, 0x90, 0xFF, 0x81, 0x00, 0x98, 0xFF, 0x81, 0x00,
+  0xA0, 0xFF, 0x81, 0x20, 0x98, 0xFF, 0x84, 0x00, 0x98, 0xFF, 0x00, 0x00, 0xA0,
+  0xFF, 0x82, 0x00, 0x98, 0xFF, 0x06, 0x00, 0xA0, 0xFF, 0x21, 0xB8, 0xFF, 0x00,
+  0xC8, 0xFF, 0x20, 0xB8, 0xFF, 0x85, 0x90, 0xFF, 0xC6, 0x31, 0xFF, 0x86, 0x41,
+  0xFF, 0x81, 0xC7, 0x39, 0xFF, 0x02, 0x6D, 0x73, 0x93, 0x86, 0x31, 0x0F, 0x00,
+  0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x09, 0x75, 0xB5, 0xF9, 0x28, 0x42, 0xFF,
+  0xA6, 0x31, 0xFF, 0x86, 0x39, 0xFF, 0xC6, 0x31, 0xFF, 0x23, 0x71, 0xFF, 0x01,
+  0xC8, 0xFF, 0x00, 0xC0, 0xFF, 0x20, 0xB8, 0xFF, 0x00, 0xA8, 0xFF, 0x81, 0x00,
+  0x98, 0xFF, 0x90, 0x00, 0xA0, 0xFF, 0x81, 0x20, 0xB8, 0xFF, 0x03, 0x00, 0xC0,
+  0xFF, 0x61, 0xA8, 0xFF, 0xA4, 0x31, 0xFF, 0x87, 0x39, 0xFF, 0x81, 0xA6, 0x31,
+  0xFF, 0x02, 0xCF, 0x7B, 0xFE, 0xEB, 0x62, 0x53, 0x00, 0x00, 0x00, 0x81, 0x00,
+  0x00, 0x00, 0x06, 0x34, 0xA5, 0xFF, 0xC7, 0x39, 0xFF, 0xA6, 0x31, 0xFF, 0x86,
+  0x39, 0xFF, 0x85, 0x39, 0xFF, 0xC3, 0x88, 0xFF, 0x00, 0xC8, 0xFF, 0x81, 0x20,
+  0xB8, 0xFF, 0x00, 0x00, 0xA8, 0xFF, 0x92, 0x00, 0xA0, 0xFF, 0x05, 0x00, 0xB0,
+  0xFF, 0x20, 0xB8, 0xFF, 0x00, 0xB8, 0xFF, 0x40, 0xB0, 0xFF, 0x84, 0x49, 0xFF,
+  0x67, 0x39, 0xFF, 0x81, 0x86, 0x31, 0xFF, 0x02, 0xCB, 0x5A, 0xFF, 0x6D, 0x73,
+  0x6B, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0C, 0xEB, 0x70, 0xD3, 0x9C,
+  0xFF, 0x86, 0x31, 0xFF, 0x81, 0xA6, 0x31, 0xFF, 0x04, 0x65, 0x41, 0xFF, 0x42,
+  0x98, 0xFF, 0x00, 0xC0, 0xFF, 0x20, 0xB0, 0xFF, 0x40, 0xB0, 0xFF, 0x93, 0x00,
+  0xA8, 0xFF, 0x00, 0x20, 0xB0, 0xFF, 0x82, 0x20, 0xB8, 0xFF, 0x01, 0x23, 0x59,
+  0xFF, 0x66, 0x39, 0xFF, 0x81, 0x86, 0x31, 0xFF, 0x02, 0x08, 0x42, 0xFF, 0x6D,
+  0x73, 0x6B, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xAF, 0xEB, 0x92, 0x10,
+  0xA4, 0xE4, 0x82, 0x86, 0x31, 0xFF, 0x06, 0x64, 0x39, 0xFF, 0x21, 0xA0, 0xFF,
+  0x00, 0xB8, 0xFF, 0x00, 0xB0, 0xFF, 0x41, 0xB0, 0xFF, 0x00, 0xA8, 0xFF, 0x00,
+  0xB0, 0xFF, 0x91, 0x00, 0xA8, 0xFF, 0x04, 0x20, 0xA8, 0xFF, 0x20, 0xC0, 0xFF,
+  0x40, 0xA8, 0xFF, 0x00, 0xB8, 0xFF, 0xE3, 0x68, 0xFF, 0x82, 0x86, 0x31, 0xFF,
+  0x02, 0xA6, 0x31, 0xFF, 0x0C, 0x6B, 0x5F, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0xCB, 0xEA, 0x69, 0x4D, 0xBB, 0xC1, 0x65, 0x29, 0xFF, 0x81, 0x86, 0x31,
+  0xFF, 0x04, 0x84, 0x31, 0xFF, 0x21, 0xA0, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xB8,
+  0xFF, 0x41, 0xB0, 0xFF, 0x93, 0x00, 0xB0, 0xFF, 0x05, 0x20, 0xA8, 0xFF, 0x20,
+  0xC0, 0xFF, 0x40, 0xA0, 0xFF, 0x00, 0xB8, 0xFF, 0xE3, 0x68, 0xFF, 0xA6, 0x29,
+  0xFF, 0x81, 0x86, 0x31, 0xFF, 0x02, 0xA6, 0x31, 0xFF, 0x2C, 0x6B, 0x68, 0x00,
+  0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x24, 0xD9, 0x27, 0x4D, 0xBB, 0xB8, 0x65,
+  0x29, 0xFF, 0x65, 0x31, 0xFF, 0xA5, 0x21, 0xFF, 0x84, 0x31, 0xFF, 0x42, 0x98,
+  0xFF, 0x00, 0xB0, 0xFF, 0x20, 0xA8, 0xFF, 0x40, 0xB8, 0xFF, 0x81, 0x00, 0xB0,
+  0xFF, 0x00, 0x20, 0xB0, 0xFF, 0x8B, 0x00, 0xB0, 0xFF, 0x83, 0x20, 0xB0, 0xFF,
+  0x06, 0x00, 0xB8, 0xFF, 0x00, 0xC0, 0xFF, 0x61, 0xA0, 0xFF, 0x00, 0xB0, 0xFF,
+  0x00, 0xB8, 0xFF, 0x02, 0x61, 0xFF, 0x86, 0x29, 0xFF, 0x81, 0x86, 0x31, 0xFF,
+  0x02, 0xA6, 0x31, 0xFF, 0x6D, 0x73, 0x6E, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00,
+  0x00, 0x07, 0x10, 0xB4, 0xD9, 0x86, 0x31, 0xFF, 0x65, 0x31, 0xFF, 0xA5, 0x21,
+  0xFF, 0x65, 0x31, 0xFF, 0x42, 0x90, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xA8, 0xFF,
+  0x81, 0x20, 0xB8, 0xFF, 0x92, 0x00, 0xB8, 0xFF, 0x01, 0x00, 0xC0, 0xFF, 0x40,
+  0xA0, 0xFF, 0x81, 0x00, 0xB0, 0xFF, 0x01, 0x03, 0x59, 0xFF, 0x86, 0x29, 0xFF,
+  0x81, 0x65, 0x29, 0xFF, 0x02, 0x08, 0x42, 0xFF, 0x4D, 0x73, 0x69, 0x00, 0x00,
+  0x00, 0x81, 0x00, 0x00, 0x00, 0x09, 0xD3, 0x9C, 0xE6, 0x86, 0x31, 0xFF, 0x65,
+  0x29, 0xFF, 0x85, 0x29, 0xFF, 0x65, 0x31, 0xFF, 0xA2, 0x78, 0xFF, 0x00, 0xA8,
+  0xFF, 0x00, 0xB0, 0xFF, 0x20, 0xB0, 0xFF, 0x20, 0xB8, 0xFF, 0x82, 0x00, 0xC0,
+  0xFF, 0x00, 0x00, 0xB8, 0xFF, 0x89, 0x20, 0xB8, 0xFF, 0x83, 0x00, 0xC0, 0xFF,
+  0x05, 0x20, 0xB8, 0xFF, 0x20, 0xC0, 0xFF, 0x20, 0xA0, 0xFF, 0x00, 0xB0, 0xFF,
+  0x21, 0xA0, 0xFF, 0x23, 0x49, 0xFF, 0x82, 0x65, 0x29, 0xFF, 0x02, 0xAA, 0x52,
+  0xFF, 0x0C, 0x6B, 0x58, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x01, 0x14,
+  0xA5, 0xEC, 0xC7, 0x39, 0xFF, 0x81, 0x65, 0x29, 0xFF, 0x05, 0x45, 0x29, 0xFF,
+  0xE3, 0x58, 0xFF, 0x20, 0xA0, 0xFF, 0x00, 0xA8, 0xFF, 0x20, 0xA8, 0xFF, 0x41,
+  0xB8, 0xFF, 0x91, 0x00, 0xC0, 0xFF, 0x05, 0x20, 0xB8, 0xFF, 0x21, 0xB0, 0xFF,
+  0x20, 0xA0, 0xFF, 0x00, 0xA8, 0xFF, 0x62, 0x80, 0xFF, 0x44, 0x39, 0xFF, 0x81,
+  0x65, 0x29, 0xFF, 0x03, 0x45, 0x29, 0xFF, 0xCF, 0x7B, 0xFF, 0xC7, 0x41, 0x1A,
+  0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x02, 0x14, 0xA5, 0xD4, 0x49, 0x4A,
+  0xFF, 0x44, 0x21, 0xFF, 0x81, 0x45, 0x29, 0xFF, 0x08, 0x23, 0x41, 0xFF, 0x40,
+  0x90, 0xFF, 0x20, 0xA0, 0xFF, 0x00, 0xA0, 0xFF, 0x41, 0xB0, 0xFF, 0x00, 0xC0,
+  0xFF, 0x00, 0xC8, 0xFF, 0x00, 0xC0, 0xFF, 0x20, 0xC0, 0xFF, 0x89, 0x00, 0xC0,
+  0xFF, 0x00, 0x20, 0xC0, 0xFF, 0x81, 0x00, 0xC8, 0xFF, 0x0A, 0x00, 0xC0, 0xFF,
+  0x40, 0xB8, 0xFF, 0x20, 0xA8, 0xFF, 0x20, 0xA0, 0xFF, 0x00, 0xA8, 0xFF, 0xA3,
+  0x68, 0xFF, 0x65, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x65, 0x29,
+  0xFF, 0x10, 0x84, 0xC7, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x0B,
+  0x30, 0x8C, 0xA1, 0x6D, 0x6B, 0xFF, 0x44, 0x21, 0xFF, 0x25, 0x29, 0xFF, 0x45,
+  0x29, 0xFF, 0x43, 0x29, 0xFF, 0xA1, 0x68, 0xFF, 0x20, 0xA0, 0xFF, 0x00, 0x98,
+  0xFF, 0x20, 0xA0, 0xFF, 0x41, 0xC0, 0xFF, 0x00, 0xD0, 0xFF, 0x84, 0x20, 0xC8,
+  0xFF, 0x00, 0x00, 0xC8, 0xFF, 0x85, 0x20, 0xC8, 0xFF, 0x09, 0x40, 0xB8, 0xFF,
+  0x00, 0xC8, 0xFF, 0x00, 0xD0, 0xFF, 0x20, 0xC0, 0xFF, 0x40, 0xB0, 0xFF, 0x20,
+  0x98, 0xFF, 0x00, 0xA0, 0xFF, 0x21, 0x98, 0xFF, 0xE3, 0x48, 0xFF, 0x65, 0x21,
+  0xFF, 0x81, 0x45, 0x29, 0xFF, 0x01, 0xC7, 0x39, 0xFF, 0x8E, 0x73, 0x83, 0x81,
+  0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0C, 0x34, 0xA5, 0xEF, 0x44, 0x21,
+  0xFF, 0x25, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x64, 0x21, 0xFF, 0xE2, 0x40, 0xFF,
+  0x41, 0x90, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0x98, 0xFF, 0x40, 0xA8, 0xFF, 0x41,
+  0xC8, 0xFF, 0x00, 0xD0, 0xFF, 0x00, 0xC8, 0xFF, 0x81, 0x20, 0xC8, 0xFF, 0x81,
+  0x00, 0xC8, 0xFF, 0x83, 0x20, 0xC8, 0xFF, 0x00, 0x00, 0xD0, 0xFF, 0x81, 0x20,
+  0xC8, 0xFF, 0x02, 0x00, 0xD0, 0xFF, 0x00, 0xC8, 0xFF, 0x61, 0xB8, 0xFF, 0x82,
+  0x00, 0x98, 0xFF, 0x06, 0x83, 0x70, 0xFF, 0x24, 0x31, 0xFF, 0x65, 0x21, 0xFF,
+  0x25, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0xAA, 0x52, 0xFF, 0x0C, 0x6B, 0x5B, 0x81,
+  0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0B, 0x51, 0x8C, 0xAB, 0xEB, 0x5A,
+  0xFF, 0x44, 0x21, 0xFF, 0x25, 0x29, 0xFF, 0x44, 0x21, 0xFF, 0x24, 0x31, 0xFF,
+  0xC3, 0x58, 0xFF, 0x00, 0x98, 0xFF, 0x00, 0xA0, 0xFF, 0x00, 0x98, 0xFF, 0x60,
+  0xA0, 0xFF, 0x21, 0xC8, 0xFF, 0x8A, 0x00, 0xD0, 0xFF, 0x03, 0x00, 0xE0, 0xFF,
+  0x20, 0xC8, 0xFF, 0x60, 0xB8, 0xFF, 0x20, 0xA0, 0xFF, 0x81, 0x00, 0x98, 0xFF,
+  0x02, 0x81, 0x78, 0xFF, 0x03, 0x39, 0xFF, 0x44, 0x21, 0xFF, 0x81, 0x25, 0x29,
+  0xFF, 0x01, 0x45, 0x29, 0xFF, 0x51, 0x8C, 0xD5, 0x82, 0x00, 0x00, 0x00, 0x82,
+  0x00, 0x00, 0x00, 0x03, 0x24, 0x21, 0x0D, 0xF3, 0x9C, 0xF7, 0x65, 0x29, 0xFF,
+  0x25, 0x29, 0xFF, 0x81, 0x24, 0x21, 0xFF, 0x06, 0x04, 0x29, 0xFF, 0xA1, 0x68,
+  0xFF, 0x00, 0x98, 0xFF, 0x00, 0xA8, 0xFF, 0x00, 0x98, 0xFF, 0x20, 0xA0, 0xFF,
+  0x21, 0xC8, 0xFF, 0x81, 0x00, 0xD0, 0xFF, 0x00, 0x00, 0xD8, 0xFF, 0x81, 0x00,
+  0xE0, 0xFF, 0x84, 0x00, 0xD8, 0xFF, 0x02, 0x41, 0xD0, 0xFF, 0x80, 0xB0, 0xFF,
+  0x20, 0x90, 0xFF, 0x81, 0x00, 0x98, 0xFF, 0x07, 0x21, 0x88, 0xFF, 0xC2, 0x48,
+  0xFF, 0x63, 0x11, 0xFF, 0x44, 0x19, 0xFF, 0x05, 0x29, 0xFF, 0x24, 0x21, 0xFF,
+  0xEB, 0x5A, 0xFF, 0xEB, 0x62, 0x51, 0x82, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00,
+  0x00, 0x01, 0x8E, 0x73, 0x88, 0xEC, 0x62, 0xFF, 0x82, 0x24, 0x21, 0xFF, 0x09,
+  0x44, 0x19, 0xFF, 0xE3, 0x38, 0xFF, 0x82, 0x60, 0xFF, 0x00, 0x88, 0xFF, 0x00,
+  0x98, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0xA0, 0xFF, 0x21, 0xB8, 0xFF, 0x41, 0xC0,
+  0xFF, 0x41, 0xC8, 0xFF, 0x83, 0x20, 0xD0, 0xFF, 0x81, 0x40, 0xC8, 0xFF, 0x02,
+  0x20, 0xB8, 0xFF, 0x20, 0xA0, 0xFF, 0x20, 0x88, 0xFF, 0x81, 0x00, 0x90, 0xFF,
+  0x07, 0x61, 0x78, 0xFF, 0xC2, 0x48, 0xFF, 0x03, 0x29, 0xFF, 0x44, 0x19, 0xFF,
+  0x25, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0xA5, 0x31, 0xFF, 0x71, 0x94, 0xCE, 0x83,
+  0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x09, 0xCF, 0x83, 0x9B, 0xC6, 0x31,
+  0xFF, 0x23, 0x21, 0xFF, 0x03, 0x21, 0xFF, 0x23, 0x21, 0xFF, 0xE4, 0x28, 0xFF,
+  0x02, 0x29, 0xFF, 0x81, 0x58, 0xFF, 0x00, 0x90, 0xFF, 0x00, 0x98, 0xFF, 0x81,
+  0x20, 0x88, 0xFF, 0x07, 0x00, 0x90, 0xFF, 0x00, 0xA0, 0xFF, 0x20, 0xA8, 0xFF,
+  0x40, 0xB0, 0xFF, 0x00, 0xB8, 0xFF, 0x00, 0xB0, 0xFF, 0x00, 0xA0, 0xFF, 0x00,
+  0x98, 0xFF, 0x81, 0x00, 0x90, 0xFF, 0x0A, 0x00, 0x88, 0xFF, 0x00, 0x98, 0xFF,
+  0x01, 0x90, 0xFF, 0xC1, 0x50, 0xFF, 0x42, 0x19, 0xFF, 0x24, 0x21, 0xFF, 0xE5,
+  0x28, 0xFF, 0x05, 0x21, 0xFF, 0x24, 0x19, 0xFF, 0xCE, 0x73, 0xFF, 0x2C, 0x6B,
+  0x60, 0x83, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0xC8,
+  0x86, 0x31, 0xFF, 0x82, 0x04, 0x21, 0xFF, 0x03, 0x24, 0x19, 0xFF, 0x03, 0x29,
+  0xFF, 0xA2, 0x50, 0xFF, 0x21, 0x78, 0xFF, 0x81, 0x00, 0x88, 0xFF, 0x81, 0x00,
+  0x90, 0xFF, 0x01, 0x00, 0x88, 0xFF, 0x20, 0x80, 0xFF, 0x81, 0x00, 0x88, 0xFF,
+  0x00, 0x00, 0x90, 0xFF, 0x82, 0x00, 0x88, 0xFF, 0x04, 0x20, 0x80, 0xFF, 0x62,
+  0x68, 0xFF, 0xA3, 0x40, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x19, 0xFF, 0x81, 0x04,
+  0x21, 0xFF, 0x02, 0x24, 0x21, 0xFF, 0xEB, 0x5A, 0xFF, 0x8E, 0x73, 0x78, 0x84,
+  0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x7B, 0xC5, 0x81, 0x04,
+  0x21, 0xFF, 0x08, 0x03, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x19, 0xFF, 0x03,
+  0x21, 0xFF, 0xE1, 0x30, 0xFF, 0xA0, 0x50, 0xFF, 0x80, 0x60, 0xFF, 0x40, 0x78,
+  0xFF, 0x00, 0x88, 0xFF, 0x83, 0x00, 0x90, 0xFF, 0x81, 0x00, 0x88, 0xFF, 0x06,
+  0x20, 0x80, 0xFF, 0x41, 0x60, 0xFF, 0xA1, 0x40, 0xFF, 0x22, 0x21, 0xFF, 0x23,
+  0x19, 0xFF, 0x04, 0x21, 0xFF, 0xE4, 0x20, 0xFF, 0x81, 0x04, 0x21, 0xFF, 0x02,
+  0x28, 0x42, 0xFF, 0xCF, 0x83, 0x94, 0x45, 0x29, 0x06, 0x84, 0x00, 0x00, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x03, 0x6D, 0x73, 0xB4, 0x86, 0x31, 0xFF, 0x03, 0x21,
+  0xFF, 0xE3, 0x18, 0xFF, 0x81, 0x04, 0x19, 0xFF, 0x04, 0x23, 0x11, 0xFF, 0x03,
+  0x21, 0xFF, 0xC2, 0x30, 0xFF, 0xA2, 0x40, 0xFF, 0x82, 0x50, 0xFF, 0x81, 0x61,
+  0x58, 0xFF, 0x08, 0x61, 0x60, 0xFF, 0x62, 0x60, 0xFF, 0x62, 0x58, 0xFF, 0x82,
+  0x48, 0xFF, 0xA2, 0x40, 0xFF, 0xC3, 0x28, 0xFF, 0x03, 0x21, 0xFF, 0x44, 0x11,
+  0xFF, 0x24, 0x11, 0xFF, 0x81, 0x04, 0x21, 0xFF, 0x03, 0x24, 0x21, 0xFF, 0xCB,
+  0x5A, 0xFF, 0xAE, 0x7B, 0x84, 0xC7, 0x41, 0x16, 0x85, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x02, 0x0C, 0x63, 0x80, 0xC6, 0x31, 0xFF, 0x04, 0x21, 0xFF,
+  0x82, 0xE4, 0x20, 0xFF, 0x83, 0x04, 0x19, 0xFF, 0x82, 0x03, 0x19, 0xFF, 0x0C,
+  0xE3, 0x18, 0xFF, 0x04, 0x19, 0xFF, 0x24, 0x11, 0xFF, 0x44, 0x09, 0xFF, 0x24,
+  0x11, 0xFF, 0x04, 0x19, 0xFF, 0xC4, 0x20, 0xFF, 0xE4, 0x20, 0xFF, 0x04, 0x19,
+  0xFF, 0xE3, 0x18, 0xFF, 0x6D, 0x6B, 0xFF, 0x4D, 0x73, 0x70, 0x45, 0x29, 0x06,
+  0x86, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x05, 0x8A, 0x5A, 0x5E, 0x2C,
+  0x63, 0xFF, 0x85, 0x29, 0xFF, 0x03, 0x19, 0xFF, 0xE3, 0x20, 0xFF, 0xE3, 0x18,
+  0xFF, 0x84, 0x03, 0x19, 0xFF, 0x00, 0xE3, 0x18, 0xFF, 0x82, 0xE3, 0x20, 0xFF,
+  0x83, 0x03, 0x19, 0xFF, 0x03, 0x04, 0x21, 0xFF, 0x28, 0x42, 0xFF, 0x30, 0x84,
+  0xE4, 0x0C, 0x63, 0x58, 0x88, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x01,
+  0x04, 0x31, 0x0F, 0xEB, 0x5A, 0xFF, 0x8A, 0xE3, 0x18, 0xFF, 0x00, 0x03, 0x19,
+  0xFF, 0x81, 0xE3, 0x18, 0xFF, 0x02, 0xA6, 0x31, 0xFF, 0xAE, 0x73, 0xBC, 0x69,
+  0x52, 0x41, 0x8A, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x02, 0x86, 0x31,
+  0x8B, 0x65, 0x29, 0xFF, 0x24, 0x21, 0xFF, 0x82, 0x04, 0x21, 0xFF, 0x03, 0x24,
+  0x21, 0xFF, 0x86, 0x31, 0xEA, 0xC7, 0x39, 0x82, 0xA6, 0x31, 0x0E, 0x8E, 0x00,
+  0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00,
 };
 const lv_img_dsc_t ui_img_button_off_ic_1_png = {
   .header.always_zero = 0,
   .header.w = 42,
   .header.h = 42,
   .data_size = sizeof(ui_img_button_off_ic_1_png_data),
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = ui_img_button_off_ic_1_png_data
 };
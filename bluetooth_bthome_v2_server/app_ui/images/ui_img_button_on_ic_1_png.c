@@ -10,416 +10,252 @@
 #endif
 
 // IMAGE DATA: assets\button_on_ic_1.png
+// RLE encoded by tools/img_rle_convert.py, 5160 bytes raw
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_button_on_ic_1_png_data[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x33, 0x18, 0x58,
-  0xC6, 0xEA, 0x59, 0xCE, 0xFF, 0x38, 0xC6, 0xFF, 0xD7, 0xBD, 0xFF, 0x75, 0xAD,
-  0xFF, 0x34, 0xA5, 0xFF, 0x55, 0xAD, 0xFF, 0x96, 0xB5, 0xFF, 0xF7, 0xBD, 0xFF,
-  0x38, 0xC6, 0xFF, 0x79, 0xCE, 0xFF, 0x54, 0xA5, 0xC2, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0E, 0x7D, 0x7F, 0x79, 0xCE, 0xFF, 0xD3, 0x9C, 0xFF, 0x8E, 0x73,
-  0xFF, 0xEB, 0x5A, 0xFF, 0x69, 0x4A, 0xFF, 0x28, 0x42, 0xFF,
-  0x28, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x28, 0x42, 0xFF, 0x49,
-  0x4A, 0xFF, 0xAA, 0x52, 0xFF, 0x2C, 0x63, 0xFF, 0x30, 0x84, 0xFF, 0xB6, 0xB5,
-  0xFF, 0x8C, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x85,
-  0x85, 0x38, 0xC6, 0xF4, 0x92, 0x94, 0xFF, 0x69, 0x4A, 0xFF, 0x08, 0x42, 0xFF,
-  0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08,
-  0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42,
-  0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF,
-  0x2C, 0x63, 0xFF, 0x34, 0xA5, 0xE7, 0xA8, 0x42, 0x44, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x43, 0x28, 0xB3, 0xA5, 0xB9,
-  0xD3, 0x9C, 0xFF, 0xCB, 0x5A, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08,
-  0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42,
-  0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF,
-  0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x08,
-  0x42, 0xFF, 0x08, 0x42, 0xFF, 0x49, 0x4A, 0xFF, 0xAE, 0x73, 0xFF, 0x2E, 0x7C,
-  0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x6B, 0x64, 0x55, 0xF6, 0xB5, 0xE0, 0xAF, 0x73, 0xFF, 0x07,
-  0x3A, 0xFF, 0x27, 0x3A, 0xFF, 0x07, 0x3A, 0xFF, 0x08, 0x42, 0xFF, 0x08, 0x42,
-  0xFF, 0x08, 0x42, 0xFF, 0xE8, 0x41, 0xFF, 0x09, 0x42, 0xFF,
-  0x09, 0x42, 0xFF, 0x27, 0x3A, 0xFF, 0x47, 0x3A, 0xFF, 0x47, 0x3A, 0xFF, 0x28,
-  0x3A, 0xFF, 0x09, 0x42, 0xFF, 0x08, 0x42, 0xFF, 0x07, 0x42, 0xFF, 0x07, 0x42,
-  0xFF, 0xE7, 0x41, 0xFF, 0x07, 0x42, 0xFF, 0x27, 0x3A, 0xFF, 0x27, 0x3A, 0xFF,
-  0x69, 0x42, 0xFF, 0xEE, 0x73, 0xA7, 0x05, 0x32, 0x23, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x6A, 0x64, 0x56, 0x17, 0xC6, 0xFF, 0x4B, 0x63, 0xFF, 0x26, 0x3A,
-  0xFF, 0x07, 0x42, 0xFF, 0xE8, 0x41, 0xFF, 0xA9, 0x49, 0xFF, 0xE8, 0x41, 0xFF,
-  0x06, 0x3A, 0xFF, 0x65, 0x32, 0xFF, 0xE5, 0x32, 0xFF, 0xC3, 0x33, 0xFF, 0x03,
-  0x34, 0xFF, 0x43, 0x3C, 0xFF, 0x62, 0x3C, 0xFF, 0x62, 0x3C, 0xFF, 0x43, 0x34,
-  0xFF, 0xE5, 0x33, 0xFF, 0x64, 0x2B, 0xFF, 0xA5, 0x32, 0xFF, 0x27, 0x3A, 0xFF,
-  0xE9, 0x41, 0xFF, 0xE8, 0x41, 0xFF, 0xE8, 0x41, 0xFF, 0xE8, 0x41, 0xFF, 0xE7,
-  0x39, 0xFF, 0x49, 0x4A, 0xFF, 0x0F, 0x7C, 0xD9, 0x46, 0x3A, 0x30, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x08, 0x54, 0x41, 0x17, 0xC6, 0xFF, 0xCA, 0x52, 0xFF, 0x26, 0x3A, 0xFF,
-  0x26, 0x3A, 0xFF, 0xE7, 0x41, 0xFF, 0xC9, 0x49, 0xFF, 0xE7, 0x41, 0xFF, 0x45,
-  0x32, 0xFF, 0x44, 0x33, 0xFF, 0x64, 0x3C, 0xFF, 0x03, 0x35, 0xFF, 0x42, 0x2D,
-  0xFF, 0x42, 0x25, 0xFF, 0x42, 0x25, 0xFF, 0x41, 0x25, 0xFF, 0x41, 0x25, 0xFF,
-  0x41, 0x25, 0xFF, 0x40, 0x25, 0xFF, 0x22, 0x2D, 0xFF, 0xC4, 0x3C, 0xFF, 0xE6,
-  0x3B, 0xFF, 0xC4, 0x2A, 0xFF, 0x07, 0x3A, 0xFF, 0xE7, 0x39, 0xFF, 0xE8, 0x41,
-  0xFF, 0xE8, 0x41, 0xFF, 0x07, 0x3A, 0xFF, 0x07, 0x3A, 0xFF, 0x0F, 0x7C, 0xD2,
-  0x05, 0x32, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x3B, 0x1B,
-  0x16, 0xBE, 0xE3, 0x4C, 0x63, 0xFF, 0x08, 0x3A, 0xFF, 0xE8, 0x39, 0xFF, 0xE7,
-  0x39, 0xFF, 0x07, 0x3A, 0xFF, 0x07, 0x32, 0xFF, 0x23, 0x2B, 0xFF, 0x24, 0x34,
-  0xFF, 0xE2, 0x2C, 0xFF, 0x40, 0x25, 0xFF, 0x60, 0x1D, 0xFF,
-  0x40, 0x25, 0xFF, 0x40, 0x25, 0xFF, 0x20, 0x25, 0xFF, 0x20, 0x25, 0xFF, 0x20,
-  0x25, 0xFF, 0x20, 0x25, 0xFF, 0x40, 0x2D, 0xFF, 0x40, 0x25, 0xFF, 0x20, 0x2D,
+  0x52, 0x4C, 0x45, 0x03, 0x00, 0x00, 0x30, 0x00, 0x69, 0x00, 0x8C, 0x00, 0xAF,
+  0x00, 0x01, 0x01, 0x5C, 0x01, 0xB8, 0x01, 0x1B, 0x02, 0x7E, 0x02, 0xE1, 0x02,
+  0x4C, 0x03, 0x9D, 0x03, 0xFD, 0x03, 0x47, 0x04, 0xAD, 0x04, 0xFD, 0x04, 0x47,
+  0x05, 0x96, 0x05, 0xE6, 0x05, 0x35, 0x06, 0x85, 0x06, 0xC9, 0x06, 0x0D, 0x07,
+  0x57, 0x07, 0x9D, 0x07, 0xEB, 0x07, 0x4D, 0x08, 0xB8, 0x08, 0x1A, 0x09, 0x73,
+  0x09, 0xDD, 0x09, 0x2E, 0x0A, 0x7C, 0x0A, 0xD1, 0x0A, 0x19, 0x0B, 0x59, 0x0B,
+  0x83, 0x0B, 0xB2, 0x0B, 0xB6, 0x0B, 0x8F, 0x00, 0x00, 0x00, 0x0C, 0x45, 0x33,
+  0x18, 0x58, 0xC6, 0xEA, 0x59, 0xCE, 0xFF, 0x38, 0xC6, 0xFF, 0xD7, 0xBD, 0xFF,
+  0x75, 0xAD, 0xFF, 0x34, 0xA5, 0xFF, 0x55, 0xAD, 0xFF, 0x96, 0xB5, 0xFF, 0xF7,
+  0xBD, 0xFF, 0x38, 0xC6, 0xFF, 0x79, 0xCE, 0xFF, 0x54, 0xA5, 0xC2, 0x8D, 0x00,
+  0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x05, 0x0E, 0x7D, 0x7F, 0x79, 0xCE, 0xFF,
+  0xD3, 0x9C, 0xFF, 0x8E, 0x73, 0xFF, 0xEB, 0x5A, 0xFF, 0x69, 0x4A, 0xFF, 0x81,
+  0x28, 0x42, 0xFF, 0x81, 0x08, 0x42, 0xFF, 0x06, 0x28, 0x42, 0xFF, 0x49, 0x4A,
+  0xFF, 0xAA, 0x52, 0xFF, 0x2C, 0x63, 0xFF, 0x30, 0x84, 0xFF, 0xB6, 0xB5, 0xFF,
+  0x8C, 0x63, 0x72, 0x8B, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x03, 0x2F,
+  0x85, 0x85, 0x38, 0xC6, 0xF4, 0x92, 0x94, 0xFF, 0x69, 0x4A, 0xFF, 0x8D, 0x08,
+  0x42, 0xFF, 0x02, 0x2C, 0x63, 0xFF, 0x34, 0xA5, 0xE7, 0xA8, 0x42, 0x44, 0x89,
+  0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x03, 0xC7, 0x43, 0x28, 0xB3, 0xA5,
+  0xB9, 0xD3, 0x9C, 0xFF, 0xCB, 0x5A, 0xFF, 0x90, 0x08, 0x42, 0xFF, 0x02, 0x49,
+  0x4A, 0xFF, 0xAE, 0x73, 0xFF, 0x2E, 0x7C, 0x9F, 0x88, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x05, 0x6B, 0x64, 0x55, 0xF6, 0xB5, 0xE0, 0xAF, 0x73, 0xFF,
+  0x07, 0x3A, 0xFF, 0x27, 0x3A, 0xFF, 0x07, 0x3A, 0xFF, 0x82, 0x08, 0x42, 0xFF,
+  0x00, 0xE8, 0x41, 0xFF, 0x81, 0x09, 0x42, 0xFF, 0x00, 0x27, 0x3A, 0xFF, 0x81,
+  0x47, 0x3A, 0xFF, 0x02, 0x28, 0x3A, 0xFF, 0x09, 0x42, 0xFF, 0x08, 0x42, 0xFF,
+  0x81, 0x07, 0x42, 0xFF, 0x01, 0xE7, 0x41, 0xFF, 0x07, 0x42, 0xFF, 0x81, 0x27,
+  0x3A, 0xFF, 0x02, 0x69, 0x42, 0xFF, 0xEE, 0x73, 0xA7, 0x05, 0x32, 0x23, 0x86,
+  0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0D, 0x6A, 0x64, 0x56, 0x17, 0xC6,
+  0xFF, 0x4B, 0x63, 0xFF, 0x26, 0x3A, 0xFF, 0x07, 0x42, 0xFF, 0xE8, 0x41, 0xFF,
+  0xA9, 0x49, 0xFF, 0xE8, 0x41, 0xFF, 0x06, 0x3A, 0xFF, 0x65, 0x32, 0xFF, 0xE5,
+  0x32, 0xFF, 0xC3, 0x33, 0xFF, 0x03, 0x34, 0xFF, 0x43, 0x3C, 0xFF, 0x81, 0x62,
+  0x3C, 0xFF, 0x05, 0x43, 0x34, 0xFF, 0xE5, 0x33, 0xFF, 0x64, 0x2B, 0xFF, 0xA5,
+  0x32, 0xFF, 0x27, 0x3A, 0xFF, 0xE9, 0x41, 0xFF, 0x82, 0xE8, 0x41, 0xFF, 0x03,
+  0xE7, 0x39, 0xFF, 0x49, 0x4A, 0xFF, 0x0F, 0x7C, 0xD9, 0x46, 0x3A, 0x30, 0x85,
+  0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x02, 0x08, 0x54, 0x41, 0x17, 0xC6,
+  0xFF, 0xCA, 0x52, 0xFF, 0x81, 0x26, 0x3A, 0xFF, 0x07, 0xE7, 0x41, 0xFF, 0xC9,
+  0x49, 0xFF, 0xE7, 0x41, 0xFF, 0x45, 0x32, 0xFF, 0x44, 0x33, 0xFF, 0x64, 0x3C,
+  0xFF, 0x03, 0x35, 0xFF, 0x42, 0x2D, 0xFF, 0x81, 0x42, 0x25, 0xFF, 0x82, 0x41,
+  0x25, 0xFF, 0x06, 0x40, 0x25, 0xFF, 0x22, 0x2D, 0xFF, 0xC4, 0x3C, 0xFF, 0xE6,
+  0x3B, 0xFF, 0xC4, 0x2A, 0xFF, 0x07, 0x3A, 0xFF, 0xE7, 0x39, 0xFF, 0x81, 0xE8,
+  0x41, 0xFF, 0x81, 0x07, 0x3A, 0xFF, 0x01, 0x0F, 0x7C, 0xD2, 0x05, 0x32, 0x22,
+  0x84, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x0C, 0x85, 0x3B, 0x1B, 0x16,
+  0xBE, 0xE3, 0x4C, 0x63, 0xFF, 0x08, 0x3A, 0xFF, 0xE8, 0x39, 0xFF, 0xE7, 0x39,
+  0xFF, 0x07, 0x3A, 0xFF, 0x07, 0x32, 0xFF, 0x23, 0x2B, 0xFF, 0x24, 0x34, 0xFF,
+  0xE2, 0x2C, 0xFF, 0x40, 0x25, 0xFF, 0x60, 0x1D, 0xFF, 0x81, 0x40, 0x25, 0xFF,
+  0x83, 0x20, 0x25, 0xFF, 0x0D, 0x40, 0x2D, 0xFF, 0x40, 0x25, 0xFF, 0x20, 0x2D,
   0xFF, 0x21, 0x2D, 0xFF, 0xE1, 0x2C, 0xFF, 0xA5, 0x33, 0xFF, 0x84, 0x2A, 0xFF,
   0x06, 0x3A, 0xFF, 0xE7, 0x41, 0xFF, 0x07, 0x3A, 0xFF, 0xE7, 0x39, 0xFF, 0x28,
-  0x42, 0xFF, 0xCD, 0x73, 0xAA, 0x84, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3,
-  0xA5, 0xC0, 0xCF, 0x7B, 0xFF, 0x07, 0x3A, 0xFF, 0x07, 0x3A, 0xFF, 0xC8, 0x41,
-  0xFF, 0xC8, 0x41, 0xFF, 0x45, 0x2A, 0xFF, 0x64, 0x2B, 0xFF, 0xE2, 0x2C, 0xFF,
-  0x01, 0x25, 0xFF, 0x40, 0x25, 0xFF, 0x20, 0x25, 0xFF, 0x01, 0x2D, 0xFF, 0x02,
-  0x35, 0xFF, 0xE2, 0x2C, 0xFF, 0xC2, 0x2C, 0xFF, 0xA1, 0x2C, 0xFF, 0xA1, 0x2C,
-  0xFF, 0xC2, 0x34, 0xFF, 0xE3, 0x34, 0xFF, 0xE1, 0x2C, 0xFF, 0x20, 0x25, 0xFF,
-  0x20, 0x25, 0xFF, 0x20, 0x25, 0xFF, 0x20, 0x25, 0xFF, 0x44, 0x34, 0xFF, 0x84,
-  0x32, 0xFF, 0x07, 0x3A, 0xFF, 0x07, 0x3A, 0xFF, 0xE7, 0x39, 0xFF, 0xC7, 0x39,
-  0xFF, 0x28, 0x42, 0xFF, 0xAD, 0x6B, 0x85, 0x24, 0x21, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x64,
-  0x5C, 0x75, 0xAD, 0xFF, 0x28, 0x42, 0xFF, 0xE6, 0x39, 0xFF, 0xE6, 0x31, 0xFF,
-  0xA8, 0x41, 0xFF, 0x05, 0x32, 0xFF, 0x82, 0x2B, 0xFF, 0xC3, 0x2C, 0xFF, 0x01,
-  0x25, 0xFF, 0x01, 0x25, 0xFF, 0x02, 0x2D, 0xFF, 0xC2, 0x2C, 0xFF, 0x21, 0x24,
-  0xFF, 0xC1, 0x1B, 0xFF, 0x80, 0x13, 0xFF, 0x80, 0x13, 0xFF, 0x80, 0x13, 0xFF,
-  0x80, 0x13, 0xFF, 0x80, 0x13, 0xFF, 0xA1, 0x1B, 0xFF, 0x01, 0x1C, 0xFF, 0x82,
-  0x24, 0xFF, 0xE2, 0x2C, 0xFF, 0x02, 0x2D, 0xFF, 0x40, 0x1D, 0xFF, 0x02, 0x25,
-  0xFF, 0x43, 0x34, 0xFF, 0xA3, 0x2A, 0xFF, 0xE7, 0x39, 0xFF, 0xE7, 0x39, 0xFF,
-  0xE7, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0x6C, 0x63, 0xFF, 0x2A, 0x53, 0x63, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xB6, 0xDA,
-  0xEB, 0x5A, 0xFF, 0xC7, 0x39, 0xFF, 0xC6, 0x31, 0xFF, 0xC7, 0x39, 0xFF, 0xC7,
-  0x39, 0xFF, 0x04, 0x33, 0xFF, 0xC3, 0x2C, 0xFF, 0xE1, 0x24, 0xFF, 0xE1, 0x24,
-  0xFF, 0xE2, 0x2C, 0xFF, 0x82, 0x24, 0xFF, 0xC0, 0x13, 0xFF,
-  0xA0, 0x1B, 0xFF, 0x80, 0x13, 0xFF, 0xA0, 0x1B, 0xFF, 0xA0, 0x1B, 0xFF, 0x80,
-  0x13, 0xFF, 0x80, 0x13, 0xFF, 0x80, 0x13, 0xFF, 0x81, 0x1B, 0xFF, 0xA0, 0x13,
-  0xFF, 0xA0, 0x13, 0xFF, 0x00, 0x1C, 0xFF, 0xE3, 0x2C, 0xFF, 0xE1, 0x24, 0xFF,
-  0x01, 0x25, 0xFF, 0x01, 0x2D, 0xFF, 0x03, 0x34, 0xFF, 0x25, 0x32, 0xFF, 0xE6,
-  0x31, 0xFF, 0xC7, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0x27, 0x3A, 0xFF, 0xED, 0x73,
-  0xAF, 0x84, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x6C, 0x6C, 0xF3,
-  0x9C, 0xFF, 0xC7, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0xC7, 0x39,
-  0xFF, 0x84, 0x2A, 0xFF, 0x63, 0x34, 0xFF, 0xE0, 0x24, 0xFF, 0xE0, 0x24, 0xFF,
-  0xC2, 0x2C, 0xFF, 0x41, 0x24, 0xFF, 0xC0, 0x13, 0xFF, 0xA0, 0x1B, 0xFF, 0xA0,
-  0x1B, 0xFF, 0xA0, 0x1B, 0xFF, 0xA0, 0x1B, 0xFF, 0xA0, 0x1B, 0xFF, 0xA0, 0x1B,
-  0xFF, 0xA0, 0x1B, 0xFF, 0xA0, 0x1B, 0xFF, 0xA0, 0x1B, 0xFF, 0xA0, 0x1B, 0xFF,
-  0xA0, 0x1B, 0xFF, 0xA0, 0x1B, 0xFF, 0xC1, 0x1B, 0xFF, 0xA1, 0x2C, 0xFF, 0xE2,
-  0x2C, 0xFF, 0xE0, 0x24, 0xFF, 0xA1, 0x34, 0xFF, 0xA3, 0x33, 0xFF, 0x25, 0x32,
-  0xFF, 0xC7, 0x39, 0xFF, 0xA8, 0x41, 0xFF, 0xE6, 0x31, 0xFF,
-  0x2B, 0x5B, 0xFF, 0x2A, 0x5B, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xB5,
-  0xD9, 0xEB, 0x5A, 0xFF, 0xC7, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0xC7, 0x39, 0xFF,
-  0xE6, 0x31, 0xFF, 0xC3, 0x2B, 0xFF, 0xE1, 0x24, 0xFF, 0xE0, 0x24, 0xFF, 0xC1,
-  0x2C, 0xFF, 0x61, 0x2C, 0xFF, 0xC0, 0x13, 0xFF, 0xA1, 0x1B, 0xFF, 0xA0, 0x1B,
-  0xFF, 0xA0, 0x1B, 0xFF, 0xA0, 0x1B, 0xFF, 0xA0, 0x1B, 0xFF, 0xA0, 0x1B, 0xFF,
-  0xA0, 0x1B, 0xFF, 0xA0, 0x1B, 0xFF, 0xC0, 0x1B, 0xFF, 0xC0, 0x13, 0xFF, 0xA0,
-  0x1B, 0xFF, 0xA0, 0x1B, 0xFF, 0xA1, 0x1B, 0xFF, 0xA1, 0x1B, 0xFF, 0xC0, 0x1B,
-  0xFF, 0xA2, 0x2C, 0xFF, 0xE0, 0x24, 0xFF, 0xE0, 0x24, 0xFF, 0xA2, 0x2C, 0xFF,
-  0xA3, 0x2A, 0xFF, 0xC6, 0x31, 0xFF, 0xA8, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0xC6,
-  0x31, 0xFF, 0x2F, 0x7C, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xB5, 0xFE,
-  0x28, 0x42, 0xFF, 0xC7, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0xC6, 0x31, 0xFF, 0x84,
-  0x2A, 0xFF, 0xA2, 0x2C, 0xFF, 0xE0, 0x1C, 0xFF, 0xC1, 0x2C, 0xFF, 0x81, 0x24,
-  0xFF, 0xC0, 0x1B, 0xFF, 0xC0, 0x1B, 0xFF, 0xC0, 0x1B, 0xFF,
-  0xC0, 0x1B, 0xFF, 0xC0, 0x1B, 0xFF, 0xC0, 0x1B, 0xFF, 0xC0, 0x1B, 0xFF, 0xC0,
-  0x1B, 0xFF, 0xC0, 0x1B, 0xFF, 0xC0, 0x1B, 0xFF, 0xC0, 0x1B, 0xFF, 0xC0, 0x1B,
-  0xFF, 0xC0, 0x1B, 0xFF, 0xC0, 0x1B, 0xFF, 0xC0, 0x1B, 0xFF, 0xC0, 0x1B, 0xFF,
-  0xC0, 0x1B, 0xFF, 0x21, 0x24, 0xFF, 0xC1, 0x2C, 0xFF, 0xC0, 0x24, 0xFF, 0xA1,
-  0x24, 0xFF, 0x83, 0x33, 0xFF, 0x04, 0x2A, 0xFF, 0xC7, 0x31, 0xFF, 0xC7, 0x31,
-  0xFF, 0xC6, 0x31, 0xFF, 0x8D, 0x73, 0xFF, 0xE9, 0x52, 0x53, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x5C, 0x55, 0x13,
-  0x9D, 0xFF, 0xC7, 0x39, 0xFF, 0xA6, 0x31, 0xFF, 0xA6, 0x31, 0xFF, 0xC6, 0x31,
-  0xFF, 0x64, 0x3B, 0xFF, 0x80, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0x62, 0x2C, 0xFF,
-  0x20, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x01, 0x1C, 0xFF, 0xE1, 0x1B, 0xFF, 0x00,
-  0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0xE0, 0x23, 0xFF, 0xE1, 0x23, 0xFF, 0xE1, 0x23,
-  0xFF, 0xE1, 0x23, 0xFF, 0xE1, 0x23, 0xFF, 0xE1, 0x23, 0xFF, 0x01, 0x1C, 0xFF,
-  0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00,
-  0x1C, 0xFF, 0xE1, 0x1B, 0xFF, 0x81, 0x24, 0xFF, 0xA0, 0x2C, 0xFF, 0xA1, 0x24,
-  0xFF, 0x44, 0x34, 0xFF, 0x63, 0x22, 0xFF, 0xC7, 0x31, 0xFF,
-  0xC7, 0x31, 0xFF, 0xC6, 0x31, 0xFF, 0x69, 0x52, 0xFF, 0xC8, 0x4A, 0x56, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x95,
-  0xAE, 0xCF, 0x7B, 0xFF, 0xA6, 0x31, 0xFF, 0xA6, 0x39, 0xFF, 0xA6, 0x31, 0xFF,
-  0x05, 0x2A, 0xFF, 0x03, 0x2C, 0xFF, 0x81, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA2,
-  0x2C, 0xFF, 0xE0, 0x23, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C,
-  0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF,
-  0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00,
-  0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C,
-  0xFF, 0xE0, 0x1B, 0xFF, 0xE0, 0x1B, 0xFF, 0x21, 0x24, 0xFF, 0x81, 0x2C, 0xFF,
-  0xA0, 0x24, 0xFF, 0xA1, 0x24, 0xFF, 0x22, 0x23, 0xFF, 0xC6, 0x29, 0xFF, 0x87,
-  0x31, 0xFF, 0xA6, 0x31, 0xFF, 0x08, 0x42, 0xFF, 0x88, 0x42, 0x4E, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xAE, 0xD4,
-  0xCA, 0x52, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0xA6, 0x31, 0xFF, 0x25,
-  0x2A, 0xFF, 0x42, 0x2C, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x1C, 0xFF, 0x82, 0x24,
-  0xFF, 0x00, 0x24, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF,
-  0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00,
-  0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C,
-  0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF,
-  0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x20, 0x1C, 0xFF, 0x81,
-  0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x1C, 0xFF, 0xA3, 0x33, 0xFF, 0xC5, 0x29,
-  0xFF, 0x86, 0x31, 0xFF, 0xA6, 0x31, 0xFF, 0xA6, 0x31, 0xFF, 0x05, 0x32, 0x32,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
-  0xB6, 0xE7, 0x08, 0x42, 0xFF, 0x86, 0x31, 0xFF, 0xA6, 0x31, 0xFF, 0xC5, 0x29,
-  0xFF, 0x64, 0x2A, 0xFF, 0x61, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0xC1, 0x24, 0xFF,
-  0x41, 0x1C, 0xFF, 0x20, 0x24, 0xFF, 0x20, 0x1C, 0xFF, 0x20, 0x1C, 0xFF, 0x20,
-  0x1C, 0xFF, 0x20, 0x1C, 0xFF, 0x20, 0x1C, 0xFF, 0x20, 0x1C, 0xFF, 0x20, 0x1C,
-  0xFF, 0x20, 0x1C, 0xFF, 0x20, 0x1C, 0xFF, 0x20, 0x1C, 0xFF, 0x20, 0x1C, 0xFF,
-  0x20, 0x1C, 0xFF, 0x20, 0x1C, 0xFF, 0x20, 0x1C, 0xFF, 0x20, 0x1C, 0xFF, 0x20,
-  0x1C, 0xFF, 0x20, 0x24, 0xFF, 0x20, 0x24, 0xFF, 0x20, 0x1C, 0xFF, 0xA2, 0x24,
-  0xFF, 0x80, 0x24, 0xFF, 0x80, 0x1C, 0xFF, 0xC3, 0x2B, 0xFF,
-  0xE5, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0xA5, 0x31, 0xFF, 0xA5, 0x31, 0xFF, 0xE5,
-  0x29, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xF5, 0xB5, 0xE6, 0xA6, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x29, 0xFF,
-  0xC5, 0x29, 0xFF, 0xA4, 0x2A, 0xFF, 0x61, 0x24, 0xFF, 0x80, 0x1C, 0xFF, 0xC1,
-  0x2C, 0xFF, 0x41, 0x1C, 0xFF, 0x20, 0x24, 0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x1C,
-  0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x1C, 0xFF,
-  0x40, 0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x40,
-  0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x1C,
-  0xFF, 0x40, 0x1C, 0xFF, 0x20, 0x24, 0xFF, 0x20, 0x24, 0xFF, 0x21, 0x1C, 0xFF,
-  0xA2, 0x24, 0xFF, 0x80, 0x1C, 0xFF, 0xA0, 0x14, 0xFF, 0xC3, 0x2B, 0xFF, 0xE5,
-  0x29, 0xFF, 0x86, 0x31, 0xFF, 0x85, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0xC4, 0x29,
-  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x42, 0xFF, 0xCD, 0x73, 0xAA, 0x84, 0x21, 0x10, 0x83, 0x00, 0x00, 0x00, 0x85,
+  0x00, 0x00, 0x00, 0x01, 0xD3, 0xA5, 0xC0, 0xCF, 0x7B, 0xFF, 0x81, 0x07, 0x3A,
+  0xFF, 0x81, 0xC8, 0x41, 0xFF, 0x09, 0x45, 0x2A, 0xFF, 0x64, 0x2B, 0xFF, 0xE2,
+  0x2C, 0xFF, 0x01, 0x25, 0xFF, 0x40, 0x25, 0xFF, 0x20, 0x25, 0xFF, 0x01, 0x2D,
+  0xFF, 0x02, 0x35, 0xFF, 0xE2, 0x2C, 0xFF, 0xC2, 0x2C, 0xFF, 0x81, 0xA1, 0x2C,
+  0xFF, 0x02, 0xC2, 0x34, 0xFF, 0xE3, 0x34, 0xFF, 0xE1, 0x2C, 0xFF, 0x83, 0x20,
+  0x25, 0xFF, 0x01, 0x44, 0x34, 0xFF, 0x84, 0x32, 0xFF, 0x81, 0x07, 0x3A, 0xFF,
+  0x04, 0xE7, 0x39, 0xFF, 0xC7, 0x39, 0xFF, 0x28, 0x42, 0xFF, 0xAD, 0x6B, 0x85,
+  0x24, 0x21, 0x07, 0x82, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x08, 0x8B,
+  0x64, 0x5C, 0x75, 0xAD, 0xFF, 0x28, 0x42, 0xFF, 0xE6, 0x39, 0xFF, 0xE6, 0x31,
+  0xFF, 0xA8, 0x41, 0xFF, 0x05, 0x32, 0xFF, 0x82, 0x2B, 0xFF, 0xC3, 0x2C, 0xFF,
+  0x81, 0x01, 0x25, 0xFF, 0x03, 0x02, 0x2D, 0xFF, 0xC2, 0x2C, 0xFF, 0x21, 0x24,
+  0xFF, 0xC1, 0x1B, 0xFF, 0x84, 0x80, 0x13, 0xFF, 0x08, 0xA1, 0x1B, 0xFF, 0x01,
+  0x1C, 0xFF, 0x82, 0x24, 0xFF, 0xE2, 0x2C, 0xFF, 0x02, 0x2D, 0xFF, 0x40, 0x1D,
+  0xFF, 0x02, 0x25, 0xFF, 0x43, 0x34, 0xFF, 0xA3, 0x2A, 0xFF, 0x82, 0xE7, 0x39,
+  0xFF, 0x02, 0xC7, 0x39, 0xFF, 0x6C, 0x63, 0xFF, 0x2A, 0x53, 0x63, 0x82, 0x00,
+  0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x03, 0x15, 0xB6, 0xDA, 0xEB, 0x5A, 0xFF,
+  0xC7, 0x39, 0xFF, 0xC6, 0x31, 0xFF, 0x81, 0xC7, 0x39, 0xFF, 0x01, 0x04, 0x33,
+  0xFF, 0xC3, 0x2C, 0xFF, 0x81, 0xE1, 0x24, 0xFF, 0x04, 0xE2, 0x2C, 0xFF, 0x82,
+  0x24, 0xFF, 0xC0, 0x13, 0xFF, 0xA0, 0x1B, 0xFF, 0x80, 0x13, 0xFF, 0x81, 0xA0,
+  0x1B, 0xFF, 0x82, 0x80, 0x13, 0xFF, 0x00, 0x81, 0x1B, 0xFF, 0x81, 0xA0, 0x13,
+  0xFF, 0x07, 0x00, 0x1C, 0xFF, 0xE3, 0x2C, 0xFF, 0xE1, 0x24, 0xFF, 0x01, 0x25,
+  0xFF, 0x01, 0x2D, 0xFF, 0x03, 0x34, 0xFF, 0x25, 0x32, 0xFF, 0xE6, 0x31, 0xFF,
+  0x81, 0xC7, 0x39, 0xFF, 0x02, 0x27, 0x3A, 0xFF, 0xED, 0x73, 0xAF, 0x84, 0x21,
+  0x10, 0x81, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x01, 0xAC, 0x6C, 0x6C,
+  0xF3, 0x9C, 0xFF, 0x83, 0xC7, 0x39, 0xFF, 0x01, 0x84, 0x2A, 0xFF, 0x63, 0x34,
+  0xFF, 0x81, 0xE0, 0x24, 0xFF, 0x02, 0xC2, 0x2C, 0xFF, 0x41, 0x24, 0xFF, 0xC0,
+  0x13, 0xFF, 0x8B, 0xA0, 0x1B, 0xFF, 0x0B, 0xC1, 0x1B, 0xFF, 0xA1, 0x2C, 0xFF,
+  0xE2, 0x2C, 0xFF, 0xE0, 0x24, 0xFF, 0xA1, 0x34, 0xFF, 0xA3, 0x33, 0xFF, 0x25,
+  0x32, 0xFF, 0xC7, 0x39, 0xFF, 0xA8, 0x41, 0xFF, 0xE6, 0x31, 0xFF, 0x2B, 0x5B,
+  0xFF, 0x2A, 0x5B, 0x62, 0x81, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x01,
+  0xF5, 0xB5, 0xD9, 0xEB, 0x5A, 0xFF, 0x82, 0xC7, 0x39, 0xFF, 0x07, 0xE6, 0x31,
+  0xFF, 0xC3, 0x2B, 0xFF, 0xE1, 0x24, 0xFF, 0xE0, 0x24, 0xFF, 0xC1, 0x2C, 0xFF,
+  0x61, 0x2C, 0xFF, 0xC0, 0x13, 0xFF, 0xA1, 0x1B, 0xFF, 0x86, 0xA0, 0x1B, 0xFF,
+  0x01, 0xC0, 0x1B, 0xFF, 0xC0, 0x13, 0xFF, 0x81, 0xA0, 0x1B, 0xFF, 0x81, 0xA1,
+  0x1B, 0xFF, 0x01, 0xC0, 0x1B, 0xFF, 0xA2, 0x2C, 0xFF, 0x81, 0xE0, 0x24, 0xFF,
+  0x06, 0xA2, 0x2C, 0xFF, 0xA3, 0x2A, 0xFF, 0xC6, 0x31, 0xFF, 0xA8, 0x39, 0xFF,
+  0xC7, 0x39, 0xFF, 0xC6, 0x31, 0xFF, 0x2F, 0x7C, 0xB2, 0x81, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x01, 0xB6, 0xB5, 0xFE, 0x28, 0x42, 0xFF, 0x81, 0xC7,
+  0x39, 0xFF, 0x05, 0xC6, 0x31, 0xFF, 0x84, 0x2A, 0xFF, 0xA2, 0x2C, 0xFF, 0xE0,
+  0x1C, 0xFF, 0xC1, 0x2C, 0xFF, 0x81, 0x24, 0xFF, 0x90, 0xC0, 0x1B, 0xFF, 0x05,
+  0x21, 0x24, 0xFF, 0xC1, 0x2C, 0xFF, 0xC0, 0x24, 0xFF, 0xA1, 0x24, 0xFF, 0x83,
+  0x33, 0xFF, 0x04, 0x2A, 0xFF, 0x81, 0xC7, 0x31, 0xFF, 0x03, 0xC6, 0x31, 0xFF,
+  0x8D, 0x73, 0xFF, 0xE9, 0x52, 0x53, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x02, 0x4A, 0x5C, 0x55, 0x13, 0x9D, 0xFF, 0xC7, 0x39, 0xFF, 0x81, 0xA6, 0x31,
+  0xFF, 0x08, 0xC6, 0x31, 0xFF, 0x64, 0x3B, 0xFF, 0x80, 0x24, 0xFF, 0xA0, 0x24,
+  0xFF, 0x62, 0x2C, 0xFF, 0x20, 0x1C, 0xFF, 0x00, 0x1C, 0xFF, 0x01, 0x1C, 0xFF,
+  0xE1, 0x1B, 0xFF, 0x81, 0x00, 0x1C, 0xFF, 0x00, 0xE0, 0x23, 0xFF, 0x84, 0xE1,
+  0x23, 0xFF, 0x00, 0x01, 0x1C, 0xFF, 0x84, 0x00, 0x1C, 0xFF, 0x05, 0xE1, 0x1B,
+  0xFF, 0x81, 0x24, 0xFF, 0xA0, 0x2C, 0xFF, 0xA1, 0x24, 0xFF, 0x44, 0x34, 0xFF,
+  0x63, 0x22, 0xFF, 0x81, 0xC7, 0x31, 0xFF, 0x03, 0xC6, 0x31, 0xFF, 0x69, 0x52,
+  0xFF, 0xC8, 0x4A, 0x56, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0A, 0x92,
+  0x95, 0xAE, 0xCF, 0x7B, 0xFF, 0xA6, 0x31, 0xFF, 0xA6, 0x39, 0xFF, 0xA6, 0x31,
+  0xFF, 0x05, 0x2A, 0xFF, 0x03, 0x2C, 0xFF, 0x81, 0x24, 0xFF, 0xA0, 0x24, 0xFF,
+  0xA2, 0x2C, 0xFF, 0xE0, 0x23, 0xFF, 0x8F, 0x00, 0x1C, 0xFF, 0x81, 0xE0, 0x1B,
+  0xFF, 0x0A, 0x21, 0x24, 0xFF, 0x81, 0x2C, 0xFF, 0xA0, 0x24, 0xFF, 0xA1, 0x24,
+  0xFF, 0x22, 0x23, 0xFF, 0xC6, 0x29, 0xFF, 0x87, 0x31, 0xFF, 0xA6, 0x31, 0xFF,
+  0x08, 0x42, 0xFF, 0x88, 0x42, 0x4E, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x01, 0x15, 0xAE, 0xD4, 0xCA, 0x52, 0xFF, 0x81, 0x86, 0x31, 0xFF, 0x06, 0xA6,
+  0x31, 0xFF, 0x25, 0x2A, 0xFF, 0x42, 0x2C, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x1C,
+  0xFF, 0x82, 0x24, 0xFF, 0x00, 0x24, 0xFF, 0x91, 0x00, 0x1C, 0xFF, 0x06, 0x20,
+  0x1C, 0xFF, 0x81, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x1C, 0xFF, 0xA3, 0x33,
+  0xFF, 0xC5, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x81, 0xA6, 0x31, 0xFF, 0x01, 0x05,
+  0x32, 0x32, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0A, 0x36, 0xB6, 0xE7,
+  0x08, 0x42, 0xFF, 0x86, 0x31, 0xFF, 0xA6, 0x31, 0xFF, 0xC5, 0x29, 0xFF, 0x64,
+  0x2A, 0xFF, 0x61, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0xC1, 0x24, 0xFF, 0x41, 0x1C,
+  0xFF, 0x20, 0x24, 0xFF, 0x8F, 0x20, 0x1C, 0xFF, 0x81, 0x20, 0x24, 0xFF, 0x06,
+  0x20, 0x1C, 0xFF, 0xA2, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x1C, 0xFF, 0xC3,
+  0x2B, 0xFF, 0xE5, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x81, 0xA5, 0x31, 0xFF, 0x01,
+  0xE5, 0x29, 0x26, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0A, 0xF5, 0xB5,
+  0xE6, 0xA6, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x29, 0xFF, 0xC5, 0x29, 0xFF,
+  0xA4, 0x2A, 0xFF, 0x61, 0x24, 0xFF, 0x80, 0x1C, 0xFF, 0xC1, 0x2C, 0xFF, 0x41,
+  0x1C, 0xFF, 0x20, 0x24, 0xFF, 0x8F, 0x40, 0x1C, 0xFF, 0x81, 0x20, 0x24, 0xFF,
+  0x0A, 0x21, 0x1C, 0xFF, 0xA2, 0x24, 0xFF, 0x80, 0x1C, 0xFF, 0xA0, 0x14, 0xFF,
+  0xC3, 0x2B, 0xFF, 0xE5, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x85, 0x31, 0xFF, 0x86,
+  0x31, 0xFF, 0xC4, 0x29, 0x23, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0A,
   0xB3, 0xA5, 0xD5, 0xA6, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x29, 0xFF, 0xC4,
   0x29, 0xFF, 0xA3, 0x2A, 0xFF, 0x61, 0x1C, 0xFF, 0x60, 0x1C, 0xFF, 0xA1, 0x24,
-  0xFF, 0x41, 0x24, 0xFF, 0x40, 0x24, 0xFF, 0x40, 0x1C, 0xFF,
-  0x40, 0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x40,
-  0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x1C,
-  0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x1C, 0xFF,
-  0x40, 0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x40, 0x24, 0xFF, 0x40, 0x24, 0xFF, 0x41,
-  0x1C, 0xFF, 0xA2, 0x24, 0xFF, 0x61, 0x1C, 0xFF, 0x80, 0x14, 0xFF, 0xE3, 0x2B,
-  0xFF, 0xE5, 0x29, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x31, 0xFF, 0x66, 0x29, 0xFF,
-  0xC4, 0x29, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xB4, 0xAD, 0xD8, 0xC7, 0x39, 0xFF, 0x86, 0x31, 0xFF, 0x86, 0x31,
-  0xFF, 0x65, 0x29, 0xFF, 0x65, 0x32, 0xFF, 0x40, 0x24, 0xFF, 0x22, 0x2C, 0xFF,
-  0xA2, 0x24, 0xFF, 0x80, 0x1C, 0xFF, 0x41, 0x24, 0xFF, 0x60, 0x1C, 0xFF, 0x60,
-  0x1C, 0xFF, 0x60, 0x1C, 0xFF, 0x60, 0x1C, 0xFF, 0x60, 0x1C, 0xFF, 0x60, 0x1C,
-  0xFF, 0x60, 0x1C, 0xFF, 0x60, 0x1C, 0xFF, 0x60, 0x1C, 0xFF, 0x60, 0x1C, 0xFF,
-  0x60, 0x1C, 0xFF, 0x60, 0x1C, 0xFF, 0x60, 0x1C, 0xFF, 0x60, 0x1C, 0xFF, 0x60,
-  0x1C, 0xFF, 0x60, 0x1C, 0xFF, 0x60, 0x24, 0xFF, 0x60, 0x1C, 0xFF, 0x60, 0x1C,
-  0xFF, 0xC2, 0x2C, 0xFF, 0x40, 0x1C, 0xFF, 0x80, 0x1C, 0xFF,
-  0xC3, 0x2B, 0xFF, 0xC5, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0x85, 0x31, 0xFF, 0x65,
-  0x29, 0xFF, 0x46, 0x3A, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xD5, 0xAD, 0xDC, 0x08, 0x42, 0xFF, 0x65, 0x29, 0xFF,
-  0x65, 0x29, 0xFF, 0x65, 0x29, 0xFF, 0x24, 0x2A, 0xFF, 0x21, 0x24, 0xFF, 0x21,
-  0x24, 0xFF, 0x81, 0x24, 0xFF, 0xA1, 0x24, 0xFF, 0x61, 0x24, 0xFF, 0x80, 0x24,
-  0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF,
-  0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80,
-  0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24,
-  0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF,
-  0x81, 0x24, 0xFF, 0x81, 0x24, 0xFF, 0x60, 0x1C, 0xFF, 0x80, 0x1C, 0xFF, 0x83,
-  0x2B, 0xFF, 0xC4, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0x85, 0x31, 0xFF, 0x85, 0x31,
-  0xFF, 0x67, 0x3A, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x71, 0x95, 0xAF, 0xAA, 0x52, 0xFF, 0x65, 0x29, 0xFF, 0x65,
-  0x29, 0xFF, 0x65, 0x29, 0xFF, 0xE4, 0x29, 0xFF, 0xE2, 0x23, 0xFF, 0x40, 0x1C,
-  0xFF, 0x40, 0x1C, 0xFF, 0xE2, 0x2C, 0xFF, 0xA0, 0x1C, 0xFF,
-  0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80,
-  0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24,
-  0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF,
-  0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80, 0x24, 0xFF, 0x80,
-  0x24, 0xFF, 0x81, 0x24, 0xFF, 0x81, 0x24, 0xFF, 0x40, 0x1C, 0xFF, 0x60, 0x1C,
-  0xFF, 0x42, 0x23, 0xFF, 0xA4, 0x21, 0xFF, 0x66, 0x31, 0xFF, 0x86, 0x31, 0xFF,
-  0x86, 0x31, 0xFF, 0x67, 0x42, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x33, 0x1C, 0xCF, 0x7B, 0xFF, 0x65, 0x29,
-  0xFF, 0x65, 0x29, 0xFF, 0x65, 0x29, 0xFF, 0xA4, 0x29, 0xFF, 0x83, 0x2B, 0xFF,
-  0x20, 0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x82, 0x2C, 0xFF, 0xC0, 0x1C, 0xFF, 0xA0,
-  0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24,
-  0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF,
-  0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0,
-  0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0x80, 0x24,
-  0xFF, 0xA1, 0x2C, 0xFF, 0x41, 0x24, 0xFF, 0x21, 0x24, 0xFF,
-  0x01, 0x24, 0xFF, 0xA2, 0x22, 0xFF, 0x65, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x45,
-  0x29, 0xFF, 0xC7, 0x39, 0xFF, 0x2A, 0x5B, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x9C, 0xFF,
-  0x65, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x64, 0x21, 0xFF, 0xE4,
-  0x2A, 0xFF, 0x20, 0x1C, 0xFF, 0x20, 0x1C, 0xFF, 0x02, 0x2C, 0xFF, 0xC0, 0x24,
-  0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF,
-  0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0,
-  0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24,
-  0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF, 0xA0, 0x24, 0xFF,
-  0xA0, 0x24, 0xFF, 0xC2, 0x2C, 0xFF, 0x20, 0x24, 0xFF, 0x00, 0x1C, 0xFF, 0x83,
-  0x2B, 0xFF, 0xC2, 0x19, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x64, 0x21,
-  0xFF, 0x48, 0x42, 0xFF, 0xEA, 0x52, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xAD, 0xFE, 0xC7,
-  0x39, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0xE3, 0x19,
-  0xFF, 0xE0, 0x23, 0xFF, 0x00, 0x1C, 0xFF, 0xE2, 0x23, 0xFF,
-  0x82, 0x2C, 0xFF, 0xC1, 0x2C, 0xFF, 0xC0, 0x24, 0xFF, 0xC0, 0x24, 0xFF, 0xC0,
-  0x24, 0xFF, 0xC0, 0x24, 0xFF, 0xC0, 0x24, 0xFF, 0xC0, 0x24, 0xFF, 0xC0, 0x24,
-  0xFF, 0xC0, 0x24, 0xFF, 0xC0, 0x24, 0xFF, 0xC0, 0x24, 0xFF, 0xC0, 0x24, 0xFF,
-  0xC0, 0x24, 0xFF, 0xC0, 0x24, 0xFF, 0xC0, 0x24, 0xFF, 0xC0, 0x24, 0xFF, 0xC1,
-  0x24, 0xFF, 0xA2, 0x2C, 0xFF, 0x21, 0x24, 0xFF, 0x00, 0x14, 0xFF, 0x01, 0x24,
-  0xFF, 0xA4, 0x2A, 0xFF, 0x43, 0x21, 0xFF, 0x25, 0x29, 0xFF, 0x45, 0x29, 0xFF,
-  0x44, 0x21, 0xFF, 0x6D, 0x6B, 0xFF, 0x47, 0x3A, 0x3E, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0x8C,
-  0xB6, 0xAA, 0x52, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x45, 0x29, 0xFF,
-  0x64, 0x19, 0xFF, 0xC1, 0x1A, 0xFF, 0xE0, 0x1B, 0xFF, 0x00, 0x1C, 0xFF, 0xE0,
-  0x1B, 0xFF, 0xC2, 0x2C, 0xFF, 0xC1, 0x2C, 0xFF, 0xC0, 0x24, 0xFF, 0xE0, 0x24,
-  0xFF, 0xE1, 0x24, 0xFF, 0xC1, 0x24, 0xFF, 0xC0, 0x24, 0xFF, 0xC0, 0x24, 0xFF,
-  0xC0, 0x24, 0xFF, 0xC0, 0x24, 0xFF, 0xC0, 0x24, 0xFF, 0xC0, 0x24, 0xFF, 0xE0,
-  0x24, 0xFF, 0xC0, 0x24, 0xFF, 0xE0, 0x24, 0xFF, 0xE0, 0x24, 0xFF, 0xE1, 0x24,
-  0xFF, 0x42, 0x24, 0xFF, 0xE0, 0x1B, 0xFF, 0x20, 0x14, 0xFF,
-  0xA2, 0x23, 0xFF, 0xA4, 0x21, 0xFF, 0x24, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x45,
-  0x29, 0xFF, 0x45, 0x29, 0xFF, 0x50, 0x84, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xB2, 0x94, 0xEF, 0x45, 0x29, 0xFF, 0x24, 0x21, 0xFF, 0x24,
-  0x29, 0xFF, 0x44, 0x29, 0xFF, 0xC4, 0x19, 0xFF, 0x42, 0x23, 0xFF, 0xE0, 0x1B,
-  0xFF, 0x00, 0x14, 0xFF, 0x20, 0x1C, 0xFF, 0xC2, 0x2C, 0xFF, 0xE1, 0x2C, 0xFF,
-  0xE0, 0x24, 0xFF, 0x00, 0x25, 0xFF, 0xE1, 0x24, 0xFF, 0xE1, 0x2C, 0xFF, 0xE1,
-  0x2C, 0xFF, 0xE1, 0x2C, 0xFF, 0xE1, 0x2C, 0xFF, 0xE1, 0x24, 0xFF, 0x00, 0x25,
-  0xFF, 0xE0, 0x24, 0xFF, 0xE1, 0x24, 0xFF, 0x01, 0x2D, 0xFF, 0x01, 0x2D, 0xFF,
-  0x81, 0x24, 0xFF, 0x00, 0x14, 0xFF, 0x00, 0x14, 0xFF, 0xC1, 0x23, 0xFF, 0x83,
-  0x22, 0xFF, 0x64, 0x21, 0xFF, 0x45, 0x29, 0xFF, 0x24, 0x21, 0xFF, 0x24, 0x21,
-  0xFF, 0xCB, 0x5A, 0xFF, 0x2B, 0x5B, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x4F, 0x7C, 0x95, 0xEB, 0x5A, 0xFF, 0x24, 0x21, 0xFF, 0x24, 0x21,
-  0xFF, 0x04, 0x29, 0xFF, 0x26, 0x19, 0xFF, 0x02, 0x1A, 0xFF,
-  0x80, 0x23, 0xFF, 0xC0, 0x1B, 0xFF, 0xC0, 0x1B, 0xFF, 0xC0, 0x13, 0xFF, 0xC2,
-  0x2C, 0xFF, 0x02, 0x2D, 0xFF, 0x01, 0x25, 0xFF, 0x00, 0x25, 0xFF, 0x20, 0x25,
-  0xFF, 0x20, 0x25, 0xFF, 0x20, 0x25, 0xFF, 0x20, 0x25, 0xFF, 0x20, 0x25, 0xFF,
-  0x01, 0x25, 0xFF, 0x02, 0x2D, 0xFF, 0xE1, 0x2C, 0xFF, 0x03, 0x2D, 0xFF, 0x40,
-  0x1C, 0xFF, 0xE1, 0x1B, 0xFF, 0xE0, 0x13, 0xFF, 0xA1, 0x1B, 0xFF, 0xC3, 0x2A,
-  0xFF, 0x63, 0x21, 0xFF, 0x24, 0x21, 0xFF, 0x24, 0x21, 0xFF, 0x24, 0x21, 0xFF,
-  0x86, 0x31, 0xFF, 0x71, 0x8C, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x7C, 0xB1, 0x86, 0x31, 0xFF,
-  0x24, 0x21, 0xFF, 0x24, 0x21, 0xFF, 0x05, 0x29, 0xFF, 0x44, 0x19, 0xFF, 0x22,
-  0x1A, 0xFF, 0x62, 0x23, 0xFF, 0xC0, 0x1B, 0xFF, 0xC0, 0x1B, 0xFF, 0xC0, 0x13,
-  0xFF, 0x21, 0x24, 0xFF, 0xC2, 0x2C, 0xFF, 0x21, 0x2D, 0xFF, 0x21, 0x2D, 0xFF,
-  0x21, 0x2D, 0xFF, 0x21, 0x2D, 0xFF, 0x21, 0x2D, 0xFF, 0x21, 0x2D, 0xFF, 0x02,
-  0x2D, 0xFF, 0xC2, 0x2C, 0xFF, 0x82, 0x24, 0xFF, 0x01, 0x1C, 0xFF, 0xC0, 0x13,
-  0xFF, 0xA1, 0x1B, 0xFF, 0xC1, 0x1B, 0xFF, 0xE3, 0x22, 0xFF,
-  0x64, 0x21, 0xFF, 0x24, 0x21, 0xFF, 0x24, 0x21, 0xFF, 0x24, 0x21, 0xFF, 0x24,
-  0x21, 0xFF, 0xEB, 0x5A, 0xFF, 0x0A, 0x53, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x4A, 0x3E, 0xAE,
-  0x73, 0xFF, 0x04, 0x19, 0xFF, 0x24, 0x19, 0xFF, 0x03, 0x21, 0xFF, 0xE5, 0x20,
-  0xFF, 0x44, 0x19, 0xFF, 0x20, 0x1A, 0xFF, 0x80, 0x13, 0xFF, 0xA0, 0x1B, 0xFF,
-  0xA1, 0x1B, 0xFF, 0xA1, 0x1B, 0xFF, 0xC0, 0x1B, 0xFF, 0xC0, 0x13, 0xFF, 0x20,
-  0x1C, 0xFF, 0x81, 0x24, 0xFF, 0xA2, 0x2C, 0xFF, 0x81, 0x24, 0xFF, 0x61, 0x24,
-  0xFF, 0x00, 0x14, 0xFF, 0xE0, 0x13, 0xFF, 0xE0, 0x1B, 0xFF, 0xA1, 0x1B, 0xFF,
-  0xA1, 0x1B, 0xFF, 0x81, 0x1B, 0xFF, 0x00, 0x13, 0xFF, 0x82, 0x11, 0xFF, 0xE6,
-  0x28, 0xFF, 0x25, 0x21, 0xFF, 0x44, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0xC7, 0x39,
-  0xFF, 0xEE, 0x73, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x6B,
-  0x76, 0xEB, 0x5A, 0xFF, 0x24, 0x21, 0xFF, 0x04, 0x21, 0xFF,
-  0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0xA2, 0x19, 0xFF, 0xC2,
-  0x22, 0xFF, 0x60, 0x1B, 0xFF, 0x80, 0x1B, 0xFF, 0x81, 0x1B, 0xFF, 0x81, 0x1B,
-  0xFF, 0xA0, 0x1B, 0xFF, 0xA0, 0x13, 0xFF, 0xA0, 0x13, 0xFF, 0xA0, 0x13, 0xFF,
-  0xA0, 0x13, 0xFF, 0xA0, 0x13, 0xFF, 0xA0, 0x13, 0xFF, 0xA0, 0x13, 0xFF, 0x80,
-  0x1B, 0xFF, 0x40, 0x1B, 0xFF, 0x23, 0x22, 0xFF, 0x62, 0x19, 0xFF, 0x24, 0x21,
-  0xFF, 0x04, 0x21, 0xFF, 0x23, 0x19, 0xFF, 0x04, 0x21, 0xFF, 0x86, 0x31, 0xFF,
-  0x30, 0x84, 0xD5, 0x84, 0x21, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xED, 0x73, 0x8F, 0x49, 0x4A, 0xFF, 0x04, 0x21, 0xFF, 0x04,
-  0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x22, 0x19,
-  0xFF, 0xC1, 0x19, 0xFF, 0xC1, 0x1A, 0xFF, 0x62, 0x1B, 0xFF, 0x80, 0x1B, 0xFF,
-  0x80, 0x1B, 0xFF, 0x80, 0x1B, 0xFF, 0xA0, 0x13, 0xFF, 0xA0, 0x13, 0xFF, 0xA0,
-  0x13, 0xFF, 0x80, 0x1B, 0xFF, 0x62, 0x1B, 0xFF, 0x03, 0x2B, 0xFF, 0x03, 0x22,
-  0xFF, 0x42, 0x19, 0xFF, 0x42, 0x19, 0xFF, 0x23, 0x19, 0xFF,
-  0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x23, 0x19, 0xFF, 0x03, 0x21, 0xFF, 0xCE,
-  0x7B, 0xD1, 0xA5, 0x29, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x63, 0x78, 0xAA, 0x52,
-  0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x19, 0xFF,
-  0xE4, 0x20, 0xFF, 0xE4, 0x20, 0xFF, 0x22, 0x19, 0xFF, 0xA2, 0x11, 0xFF, 0x21,
-  0x12, 0xFF, 0x62, 0x1A, 0xFF, 0x82, 0x1A, 0xFF, 0xA2, 0x22, 0xFF, 0xA2, 0x1A,
-  0xFF, 0x82, 0x1A, 0xFF, 0x22, 0x1A, 0xFF, 0xC2, 0x19, 0xFF, 0x62, 0x19, 0xFF,
-  0x23, 0x19, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0xE4, 0x20, 0xFF, 0xE4,
-  0x20, 0xFF, 0x04, 0x21, 0xFF, 0x85, 0x29, 0xFF, 0xAE, 0x73, 0xD0, 0xE5, 0x29,
-  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x4A, 0x53, 0x53, 0x6D, 0x6B, 0xFF, 0xE3, 0x18, 0xFF, 0xE3, 0x18, 0xFF, 0x22,
-  0x11, 0xFF, 0x03, 0x19, 0xFF, 0xC4, 0x20, 0xFF, 0xC5, 0x20, 0xFF, 0xC5, 0x20,
-  0xFF, 0x04, 0x19, 0xFF, 0x04, 0x19, 0xFF, 0x04, 0x19, 0xFF, 0x03, 0x19, 0xFF,
-  0x03, 0x11, 0xFF, 0x03, 0x19, 0xFF, 0xE4, 0x20, 0xFF, 0xE4, 0x20, 0xFF, 0x03,
-  0x21, 0xFF, 0x23, 0x19, 0xFF, 0x23, 0x11, 0xFF, 0xE4, 0x20, 0xFF, 0xE4, 0x20,
-  0xFF, 0xE4, 0x20, 0xFF, 0xA6, 0x31, 0xFF, 0x2B, 0x5B, 0x90, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x5B, 0x80, 0x28, 0x42, 0xFF, 0x04, 0x21,
-  0xFF, 0xE3, 0x18, 0xFF, 0x02, 0x19, 0xFF, 0x02, 0x19, 0xFF, 0xE3, 0x18, 0xFF,
-  0xE3, 0x18, 0xFF, 0xE4, 0x18, 0xFF, 0xE4, 0x18, 0xFF, 0xE3, 0x18, 0xFF, 0x03,
-  0x19, 0xFF, 0xE3, 0x18, 0xFF, 0xE4, 0x18, 0xFF, 0xE4, 0x20, 0xFF, 0xE4, 0x20,
-  0xFF, 0x03, 0x19, 0xFF, 0x03, 0x19, 0xFF, 0x03, 0x19, 0xFF,
-  0x85, 0x29, 0xFF, 0x4C, 0x63, 0xFF, 0x88, 0x42, 0x5A, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x09, 0x53, 0x69, 0xA6, 0x31, 0xFF, 0xE3, 0x18, 0xFF, 0xE3, 0x18, 0xFF, 0xE3,
-  0x18, 0xFF, 0xE3, 0x18, 0xFF, 0xE3, 0x18, 0xFF, 0xE3, 0x18, 0xFF, 0x03, 0x19,
-  0xFF, 0xE3, 0x18, 0xFF, 0xE3, 0x18, 0xFF, 0xE3, 0x18, 0xFF, 0x04, 0x19, 0xFF,
-  0xE3, 0x18, 0xFF, 0xE3, 0x18, 0xFF, 0xE3, 0x18, 0xFF, 0xEB, 0x5A, 0xFF, 0xC5,
-  0x29, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x39, 0x09, 0xCA, 0x52,
-  0xC8, 0x28, 0x42, 0xFF, 0xA6, 0x31, 0xFF, 0x24, 0x21, 0xFF, 0x04, 0x21, 0xFF,
-  0xE3, 0x18, 0xFF, 0x04, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x65, 0x29, 0xFF, 0xC7,
-  0x39, 0xFF, 0x69, 0x4A, 0xEF, 0xA5, 0x29, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x41, 0x24, 0xFF, 0x40, 0x24, 0xFF, 0x8F, 0x40, 0x1C, 0xFF, 0x81, 0x40,
+  0x24, 0xFF, 0x05, 0x41, 0x1C, 0xFF, 0xA2, 0x24, 0xFF, 0x61, 0x1C, 0xFF, 0x80,
+  0x14, 0xFF, 0xE3, 0x2B, 0xFF, 0xE5, 0x29, 0xFF, 0x81, 0x86, 0x31, 0xFF, 0x02,
+  0x66, 0x29, 0xFF, 0xC4, 0x29, 0x28, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x01, 0xB4, 0xAD, 0xD8, 0xC7, 0x39, 0xFF, 0x81, 0x86, 0x31, 0xFF, 0x06, 0x65,
+  0x29, 0xFF, 0x65, 0x32, 0xFF, 0x40, 0x24, 0xFF, 0x22, 0x2C, 0xFF, 0xA2, 0x24,
+  0xFF, 0x80, 0x1C, 0xFF, 0x41, 0x24, 0xFF, 0x8F, 0x60, 0x1C, 0xFF, 0x00, 0x60,
+  0x24, 0xFF, 0x81, 0x60, 0x1C, 0xFF, 0x09, 0xC2, 0x2C, 0xFF, 0x40, 0x1C, 0xFF,
+  0x80, 0x1C, 0xFF, 0xC3, 0x2B, 0xFF, 0xC5, 0x29, 0xFF, 0x66, 0x31, 0xFF, 0x85,
+  0x31, 0xFF, 0x65, 0x29, 0xFF, 0x46, 0x3A, 0x51, 0x00, 0x00, 0x00, 0x82, 0x00,
+  0x00, 0x00, 0x01, 0xD5, 0xAD, 0xDC, 0x08, 0x42, 0xFF, 0x82, 0x65, 0x29, 0xFF,
+  0x00, 0x24, 0x2A, 0xFF, 0x81, 0x21, 0x24, 0xFF, 0x02, 0x81, 0x24, 0xFF, 0xA1,
+  0x24, 0xFF, 0x61, 0x24, 0xFF, 0x91, 0x80, 0x24, 0xFF, 0x81, 0x81, 0x24, 0xFF,
+  0x04, 0x60, 0x1C, 0xFF, 0x80, 0x1C, 0xFF, 0x83, 0x2B, 0xFF, 0xC4, 0x29, 0xFF,
+  0x66, 0x31, 0xFF, 0x81, 0x85, 0x31, 0xFF, 0x01, 0x67, 0x3A, 0x56, 0x00, 0x00,
+  0x00, 0x82, 0x00, 0x00, 0x00, 0x01, 0x71, 0x95, 0xAF, 0xAA, 0x52, 0xFF, 0x82,
+  0x65, 0x29, 0xFF, 0x01, 0xE4, 0x29, 0xFF, 0xE2, 0x23, 0xFF, 0x81, 0x40, 0x1C,
+  0xFF, 0x01, 0xE2, 0x2C, 0xFF, 0xA0, 0x1C, 0xFF, 0x91, 0x80, 0x24, 0xFF, 0x81,
+  0x81, 0x24, 0xFF, 0x04, 0x40, 0x1C, 0xFF, 0x60, 0x1C, 0xFF, 0x42, 0x23, 0xFF,
+  0xA4, 0x21, 0xFF, 0x66, 0x31, 0xFF, 0x81, 0x86, 0x31, 0xFF, 0x01, 0x67, 0x42,
+  0x51, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x01, 0x65, 0x33, 0x1C, 0xCF,
+  0x7B, 0xFF, 0x82, 0x65, 0x29, 0xFF, 0x05, 0xA4, 0x29, 0xFF, 0x83, 0x2B, 0xFF,
+  0x20, 0x1C, 0xFF, 0x40, 0x1C, 0xFF, 0x82, 0x2C, 0xFF, 0xC0, 0x1C, 0xFF, 0x90,
+  0xA0, 0x24, 0xFF, 0x06, 0x80, 0x24, 0xFF, 0xA1, 0x2C, 0xFF, 0x41, 0x24, 0xFF,
+  0x21, 0x24, 0xFF, 0x01, 0x24, 0xFF, 0xA2, 0x22, 0xFF, 0x65, 0x29, 0xFF, 0x81,
+  0x45, 0x29, 0xFF, 0x02, 0xC7, 0x39, 0xFF, 0x2A, 0x5B, 0x76, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x01, 0xD3, 0x9C, 0xFF, 0x65, 0x29, 0xFF, 0x81, 0x45,
+  0x29, 0xFF, 0x01, 0x64, 0x21, 0xFF, 0xE4, 0x2A, 0xFF, 0x81, 0x20, 0x1C, 0xFF,
+  0x01, 0x02, 0x2C, 0xFF, 0xC0, 0x24, 0xFF, 0x91, 0xA0, 0x24, 0xFF, 0x04, 0xC2,
+  0x2C, 0xFF, 0x20, 0x24, 0xFF, 0x00, 0x1C, 0xFF, 0x83, 0x2B, 0xFF, 0xC2, 0x19,
+  0xFF, 0x81, 0x45, 0x29, 0xFF, 0x03, 0x64, 0x21, 0xFF, 0x48, 0x42, 0xFF, 0xEA,
+  0x52, 0x68, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x01, 0x75, 0xAD, 0xFE,
+  0xC7, 0x39, 0xFF, 0x82, 0x45, 0x29, 0xFF, 0x05, 0xE3, 0x19, 0xFF, 0xE0, 0x23,
+  0xFF, 0x00, 0x1C, 0xFF, 0xE2, 0x23, 0xFF, 0x82, 0x2C, 0xFF, 0xC1, 0x2C, 0xFF,
+  0x8E, 0xC0, 0x24, 0xFF, 0x0C, 0xC1, 0x24, 0xFF, 0xA2, 0x2C, 0xFF, 0x21, 0x24,
+  0xFF, 0x00, 0x14, 0xFF, 0x01, 0x24, 0xFF, 0xA4, 0x2A, 0xFF, 0x43, 0x21, 0xFF,
+  0x25, 0x29, 0xFF, 0x45, 0x29, 0xFF, 0x44, 0x21, 0xFF, 0x6D, 0x6B, 0xFF, 0x47,
+  0x3A, 0x3E, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x01, 0xD1, 0x8C, 0xB6,
+  0xAA, 0x52, 0xFF, 0x82, 0x45, 0x29, 0xFF, 0x0A, 0x64, 0x19, 0xFF, 0xC1, 0x1A,
+  0xFF, 0xE0, 0x1B, 0xFF, 0x00, 0x1C, 0xFF, 0xE0, 0x1B, 0xFF, 0xC2, 0x2C, 0xFF,
+  0xC1, 0x2C, 0xFF, 0xC0, 0x24, 0xFF, 0xE0, 0x24, 0xFF, 0xE1, 0x24, 0xFF, 0xC1,
+  0x24, 0xFF, 0x85, 0xC0, 0x24, 0xFF, 0x01, 0xE0, 0x24, 0xFF, 0xC0, 0x24, 0xFF,
+  0x81, 0xE0, 0x24, 0xFF, 0x06, 0xE1, 0x24, 0xFF, 0x42, 0x24, 0xFF, 0xE0, 0x1B,
+  0xFF, 0x20, 0x14, 0xFF, 0xA2, 0x23, 0xFF, 0xA4, 0x21, 0xFF, 0x24, 0x21, 0xFF,
+  0x82, 0x45, 0x29, 0xFF, 0x00, 0x50, 0x84, 0xC5, 0x81, 0x00, 0x00, 0x00, 0x84,
+  0x00, 0x00, 0x00, 0x0E, 0xB2, 0x94, 0xEF, 0x45, 0x29, 0xFF, 0x24, 0x21, 0xFF,
+  0x24, 0x29, 0xFF, 0x44, 0x29, 0xFF, 0xC4, 0x19, 0xFF, 0x42, 0x23, 0xFF, 0xE0,
+  0x1B, 0xFF, 0x00, 0x14, 0xFF, 0x20, 0x1C, 0xFF, 0xC2, 0x2C, 0xFF, 0xE1, 0x2C,
+  0xFF, 0xE0, 0x24, 0xFF, 0x00, 0x25, 0xFF, 0xE1, 0x24, 0xFF, 0x83, 0xE1, 0x2C,
+  0xFF, 0x03, 0xE1, 0x24, 0xFF, 0x00, 0x25, 0xFF, 0xE0, 0x24, 0xFF, 0xE1, 0x24,
+  0xFF, 0x81, 0x01, 0x2D, 0xFF, 0x00, 0x81, 0x24, 0xFF, 0x81, 0x00, 0x14, 0xFF,
+  0x03, 0xC1, 0x23, 0xFF, 0x83, 0x22, 0xFF, 0x64, 0x21, 0xFF, 0x45, 0x29, 0xFF,
+  0x81, 0x24, 0x21, 0xFF, 0x01, 0xCB, 0x5A, 0xFF, 0x2B, 0x5B, 0x6E, 0x81, 0x00,
+  0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x01, 0x4F, 0x7C, 0x95, 0xEB, 0x5A, 0xFF,
+  0x81, 0x24, 0x21, 0xFF, 0x03, 0x04, 0x29, 0xFF, 0x26, 0x19, 0xFF, 0x02, 0x1A,
+  0xFF, 0x80, 0x23, 0xFF, 0x81, 0xC0, 0x1B, 0xFF, 0x04, 0xC0, 0x13, 0xFF, 0xC2,
+  0x2C, 0xFF, 0x02, 0x2D, 0xFF, 0x01, 0x25, 0xFF, 0x00, 0x25, 0xFF, 0x84, 0x20,
+  0x25, 0xFF, 0x09, 0x01, 0x25, 0xFF, 0x02, 0x2D, 0xFF, 0xE1, 0x2C, 0xFF, 0x03,
+  0x2D, 0xFF, 0x40, 0x1C, 0xFF, 0xE1, 0x1B, 0xFF, 0xE0, 0x13, 0xFF, 0xA1, 0x1B,
+  0xFF, 0xC3, 0x2A, 0xFF, 0x63, 0x21, 0xFF, 0x82, 0x24, 0x21, 0xFF, 0x01, 0x86,
+  0x31, 0xFF, 0x71, 0x8C, 0xE4, 0x82, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x01, 0x2F, 0x7C, 0xB1, 0x86, 0x31, 0xFF, 0x81, 0x24, 0x21, 0xFF, 0x03, 0x05,
+  0x29, 0xFF, 0x44, 0x19, 0xFF, 0x22, 0x1A, 0xFF, 0x62, 0x23, 0xFF, 0x81, 0xC0,
+  0x1B, 0xFF, 0x02, 0xC0, 0x13, 0xFF, 0x21, 0x24, 0xFF, 0xC2, 0x2C, 0xFF, 0x85,
+  0x21, 0x2D, 0xFF, 0x08, 0x02, 0x2D, 0xFF, 0xC2, 0x2C, 0xFF, 0x82, 0x24, 0xFF,
+  0x01, 0x1C, 0xFF, 0xC0, 0x13, 0xFF, 0xA1, 0x1B, 0xFF, 0xC1, 0x1B, 0xFF, 0xE3,
+  0x22, 0xFF, 0x64, 0x21, 0xFF, 0x83, 0x24, 0x21, 0xFF, 0x01, 0xEB, 0x5A, 0xFF,
+  0x0A, 0x53, 0x6D, 0x82, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x09, 0xE8,
+  0x4A, 0x3E, 0xAE, 0x73, 0xFF, 0x04, 0x19, 0xFF, 0x24, 0x19, 0xFF, 0x03, 0x21,
+  0xFF, 0xE5, 0x20, 0xFF, 0x44, 0x19, 0xFF, 0x20, 0x1A, 0xFF, 0x80, 0x13, 0xFF,
+  0xA0, 0x1B, 0xFF, 0x81, 0xA1, 0x1B, 0xFF, 0x09, 0xC0, 0x1B, 0xFF, 0xC0, 0x13,
+  0xFF, 0x20, 0x1C, 0xFF, 0x81, 0x24, 0xFF, 0xA2, 0x2C, 0xFF, 0x81, 0x24, 0xFF,
+  0x61, 0x24, 0xFF, 0x00, 0x14, 0xFF, 0xE0, 0x13, 0xFF, 0xE0, 0x1B, 0xFF, 0x81,
+  0xA1, 0x1B, 0xFF, 0x08, 0x81, 0x1B, 0xFF, 0x00, 0x13, 0xFF, 0x82, 0x11, 0xFF,
+  0xE6, 0x28, 0xFF, 0x25, 0x21, 0xFF, 0x44, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0xC7,
+  0x39, 0xFF, 0xEE, 0x73, 0xA7, 0x83, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x02, 0xCC, 0x6B, 0x76, 0xEB, 0x5A, 0xFF, 0x24, 0x21, 0xFF, 0x83, 0x04, 0x21,
+  0xFF, 0x03, 0xA2, 0x19, 0xFF, 0xC2, 0x22, 0xFF, 0x60, 0x1B, 0xFF, 0x80, 0x1B,
+  0xFF, 0x81, 0x81, 0x1B, 0xFF, 0x00, 0xA0, 0x1B, 0xFF, 0x86, 0xA0, 0x13, 0xFF,
+  0x0A, 0x80, 0x1B, 0xFF, 0x40, 0x1B, 0xFF, 0x23, 0x22, 0xFF, 0x62, 0x19, 0xFF,
+  0x24, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0x23, 0x19, 0xFF, 0x04, 0x21, 0xFF, 0x86,
+  0x31, 0xFF, 0x30, 0x84, 0xD5, 0x84, 0x21, 0x0F, 0x83, 0x00, 0x00, 0x00, 0x87,
+  0x00, 0x00, 0x00, 0x01, 0xED, 0x73, 0x8F, 0x49, 0x4A, 0xFF, 0x84, 0x04, 0x21,
+  0xFF, 0x03, 0x22, 0x19, 0xFF, 0xC1, 0x19, 0xFF, 0xC1, 0x1A, 0xFF, 0x62, 0x1B,
+  0xFF, 0x82, 0x80, 0x1B, 0xFF, 0x82, 0xA0, 0x13, 0xFF, 0x03, 0x80, 0x1B, 0xFF,
+  0x62, 0x1B, 0xFF, 0x03, 0x2B, 0xFF, 0x03, 0x22, 0xFF, 0x81, 0x42, 0x19, 0xFF,
+  0x00, 0x23, 0x19, 0xFF, 0x81, 0x04, 0x21, 0xFF, 0x03, 0x23, 0x19, 0xFF, 0x03,
+  0x21, 0xFF, 0xCE, 0x7B, 0xD1, 0xA5, 0x29, 0x13, 0x84, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x01, 0xAC, 0x63, 0x78, 0xAA, 0x52, 0xFF, 0x82, 0x04, 0x21,
+  0xFF, 0x00, 0x04, 0x19, 0xFF, 0x81, 0xE4, 0x20, 0xFF, 0x0B, 0x22, 0x19, 0xFF,
+  0xA2, 0x11, 0xFF, 0x21, 0x12, 0xFF, 0x62, 0x1A, 0xFF, 0x82, 0x1A, 0xFF, 0xA2,
+  0x22, 0xFF, 0xA2, 0x1A, 0xFF, 0x82, 0x1A, 0xFF, 0x22, 0x1A, 0xFF, 0xC2, 0x19,
+  0xFF, 0x62, 0x19, 0xFF, 0x23, 0x19, 0xFF, 0x81, 0x04, 0x21, 0xFF, 0x81, 0xE4,
+  0x20, 0xFF, 0x03, 0x04, 0x21, 0xFF, 0x85, 0x29, 0xFF, 0xAE, 0x73, 0xD0, 0xE5,
+  0x29, 0x11, 0x85, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x01, 0x4A, 0x53,
+  0x53, 0x6D, 0x6B, 0xFF, 0x81, 0xE3, 0x18, 0xFF, 0x02, 0x22, 0x11, 0xFF, 0x03,
+  0x19, 0xFF, 0xC4, 0x20, 0xFF, 0x81, 0xC5, 0x20, 0xFF, 0x82, 0x04, 0x19, 0xFF,
+  0x02, 0x03, 0x19, 0xFF, 0x03, 0x11, 0xFF, 0x03, 0x19, 0xFF, 0x81, 0xE4, 0x20,
+  0xFF, 0x02, 0x03, 0x21, 0xFF, 0x23, 0x19, 0xFF, 0x23, 0x11, 0xFF, 0x82, 0xE4,
+  0x20, 0xFF, 0x01, 0xA6, 0x31, 0xFF, 0x2B, 0x5B, 0x90, 0x87, 0x00, 0x00, 0x00,
+  0x8B, 0x00, 0x00, 0x00, 0x03, 0x4A, 0x5B, 0x80, 0x28, 0x42, 0xFF, 0x04, 0x21,
+  0xFF, 0xE3, 0x18, 0xFF, 0x81, 0x02, 0x19, 0xFF, 0x81, 0xE3, 0x18, 0xFF, 0x81,
+  0xE4, 0x18, 0xFF, 0x03, 0xE3, 0x18, 0xFF, 0x03, 0x19, 0xFF, 0xE3, 0x18, 0xFF,
+  0xE4, 0x18, 0xFF, 0x81, 0xE4, 0x20, 0xFF, 0x82, 0x03, 0x19, 0xFF, 0x02, 0x85,
+  0x29, 0xFF, 0x4C, 0x63, 0xFF, 0x88, 0x42, 0x5A, 0x88, 0x00, 0x00, 0x00, 0x8D,
+  0x00, 0x00, 0x00, 0x01, 0x09, 0x53, 0x69, 0xA6, 0x31, 0xFF, 0x85, 0xE3, 0x18,
+  0xFF, 0x00, 0x03, 0x19, 0xFF, 0x82, 0xE3, 0x18, 0xFF, 0x00, 0x04, 0x19, 0xFF,
+  0x82, 0xE3, 0x18, 0xFF, 0x01, 0xEB, 0x5A, 0xFF, 0xC5, 0x29, 0x24, 0x8A, 0x00,
+  0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x06, 0xC7, 0x39, 0x09, 0xCA, 0x52, 0xC8,
+  0x28, 0x42, 0xFF, 0xA6, 0x31, 0xFF, 0x24, 0x21, 0xFF, 0x04, 0x21, 0xFF, 0xE3,
+  0x18, 0xFF, 0x81, 0x04, 0x21, 0xFF, 0x03, 0x65, 0x29, 0xFF, 0xC7, 0x39, 0xFF,
+  0x69, 0x4A, 0xEF, 0xA5, 0x29, 0x38, 0x8D, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00,
+  0x00, 0xAA, 0x00, 0x00, 0x00,
 };
 const lv_img_dsc_t ui_img_button_on_ic_1_png = {
   .header.always_zero = 0,
   .header.w = 43,
   .header.h = 40,
   .data_size = sizeof(ui_img_button_on_ic_1_png_data),
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = ui_img_button_on_ic_1_png_data
 };
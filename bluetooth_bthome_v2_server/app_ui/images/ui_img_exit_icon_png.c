@@ -10,3853 +10,95 @@
 #endif
 
 // IMAGE DATA: assets\exit_icon.png
+// Scaled to zoom 50 from 128x128 by tools/img_rle_convert.py
+// RLE encoded by tools/img_rle_convert.py, 1875 bytes raw
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_exit_icon_png_data[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFA, 0x09, 0xAA, 0xFA,
-  0x12, 0xCA, 0xFA, 0x22, 0xCA, 0xFA, 0x2D, 0xCA, 0xFA, 0x37,
-  0xCA, 0xFA, 0x36, 0xEA, 0xFA, 0x2C, 0xCA, 0xFA, 0x22, 0xAA, 0xFA, 0x12, 0x0C,
-  0xFB, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0x02,
-  0xAA, 0xFA, 0x26, 0xCA, 0xFA, 0x4D, 0xCA, 0xFA, 0x72, 0xCA, 0xFA, 0x97, 0xCA,
-  0xFA, 0xBC, 0xCA, 0xFA, 0xE0, 0xCA, 0xFA, 0xFD, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFD, 0xCA, 0xFA, 0xDF, 0xCA, 0xFA, 0xBA, 0xCA, 0xFA,
-  0x96, 0xCA, 0xFA, 0x71, 0xCA, 0xFA, 0x4B, 0xCA, 0xFA, 0x25, 0x00, 0xF8, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFA,
-  0x03, 0xCA, 0xFA, 0x2B, 0xCA, 0xFA, 0x66, 0xCA, 0xFA, 0xAA, 0xCA, 0xFA, 0xEB,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xF1,
-  0xCA, 0xFA, 0xBB, 0xCA, 0xFA, 0x77, 0xCA, 0xFA, 0x3C, 0x2C, 0xFB, 0x05, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x09, 0xFB, 0x0D, 0xCA, 0xFA, 0x5D, 0xCA, 0xFA, 0xB3, 0xCA, 0xFA,
-  0xF2, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xF1, 0xCA,
-  0xFA, 0xB0, 0xCA, 0xFA, 0x59, 0xEB, 0xFA, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFA, 0x07, 0xCA, 0xFA, 0x4D, 0xCA,
-  0xFA, 0xA2, 0xCA, 0xFA, 0xF3, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xF6, 0xCA, 0xFA, 0xB3, 0xCA, 0xFA,
-  0x55, 0xAA, 0xFA, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xCB, 0xFA, 0x1D, 0xCA, 0xFA, 0x8E, 0xCA, 0xFA, 0xEE, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xEC, 0xCA, 0xFA, 0x8A, 0xCB, 0xFA, 0x1A, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0xFA, 0x2C, 0xCA, 0xFA, 0x99,
-  0xCA, 0xFA, 0xF8, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xF9, 0xCA, 0xFA, 0xA2,
-  0xCA, 0xFA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xCA, 0xFA, 0x3B, 0xCA, 0xFA, 0xB4, 0xCA, 0xFA, 0xFE, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFD, 0xCA, 0xFA, 0xAF, 0xCA, 0xFA, 0x36, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x25, 0xCA, 0xFA,
-  0xAA, 0xCA, 0xFA, 0xFE, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xB3, 0xAA,
-  0xFA, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xEB, 0xFA, 0x0B, 0xCA, 0xFA, 0x8C, 0xCA, 0xFA, 0xFA, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xF8, 0xCA, 0xFA, 0x84, 0xAA, 0xFA, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA,
-  0xFA, 0x4A, 0xCA, 0xFA, 0xDF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xDB, 0xCA, 0xFA, 0x44, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xFB, 0x0A, 0xCA, 0xFA, 0x91, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFE, 0xCA, 0xFA,
-  0x99, 0xEB, 0xFA, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xCA, 0xFA, 0x39, 0xCA, 0xFA, 0xDE, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xD8, 0xEA, 0xFA, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xCA, 0xFA, 0x66, 0xCA, 0xFA, 0xF9, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xF8, 0xCA, 0xFA, 0x6F, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFB, 0x08, 0xCA, 0xFA, 0xA3,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0x9B,
-  0xAA, 0xFA, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xEA, 0xFA, 0x13, 0xCA, 0xFA, 0xC1, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xC4, 0xCB, 0xFA, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xEA, 0xFA, 0x24, 0xCA, 0xFA, 0xDC, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xD7, 0xCA, 0xFA, 0x1F, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA,
-  0x28, 0xCA, 0xFA, 0xE4, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xE6, 0xCA, 0xFA, 0x2B, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x30, 0xCA, 0xFA,
-  0xEA, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xE7, 0xEA,
-  0xFA, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0xFA, 0x27, 0xCA, 0xFA, 0xE8, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xE9, 0xCA, 0xFA, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xEA, 0xFA, 0x24, 0xCA, 0xFA, 0xE5, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xE3, 0xEA, 0xFA, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA,
-  0xFA, 0x13, 0xCA, 0xFA, 0xDB, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xD7, 0xCB, 0xFA, 0x11, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFB, 0x08, 0xCA,
-  0xFA, 0xC5, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xC1, 0x49, 0xFA,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0xA5, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x6F, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xCA, 0xFA, 0x3A, 0xCA, 0xFA, 0xFA, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xF7, 0xCA, 0xFA, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xAA, 0xFA, 0x0C, 0xCA, 0xFA, 0xDC, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xD7, 0x29, 0xFB, 0x0A, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xCA, 0xFA, 0x9F, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0x93, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x4C,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFE, 0xCA, 0xFA, 0x42,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xFB, 0x0A, 0xCA, 0xFA, 0xDE,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xDA,
-  0x0C, 0xFB, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x8E, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xEA, 0xFA, 0x27, 0xCA, 0xFA, 0xFA, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x0B, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF,
-  0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C,
-  0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB,
-  0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF,
-  0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C,
-  0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB,
-  0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF,
-  0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C,
-  0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB,
-  0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF,
-  0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x2C,
-  0xFB, 0xFF, 0x2C, 0xFB, 0xFF, 0x0B, 0xFB, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xF7, 0xCB, 0xFA, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0xB2, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xEA, 0xFA, 0x3D, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFE, 0xCA, 0xFA, 0x33, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xCA, 0xFA, 0xB8, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xAC, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA,
-  0x2E, 0xCA, 0xFA, 0xFE, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFD, 0xAA, 0xFA, 0x29, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA,
-  0xA5, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0x99, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 0xFA, 0x1D, 0xCA, 0xFA,
-  0xFA, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xF8, 0xEA,
-  0xFA, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x91, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFB, 0x08, 0xCA, 0xFA, 0xF0, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x71, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC,
-  0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF,
-  0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51,
-  0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC,
-  0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF,
-  0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51,
-  0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC,
-  0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x7D, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xEA, 0x08, 0xFA, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x53, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x1C, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0xAC, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x1C, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xCB, 0xFA, 0x0E, 0xCA, 0xFA, 0xF6, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x1C, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89,
-  0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xF2, 0xAA, 0xFA, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xCA, 0xFA, 0x61, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x1C, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xCA, 0xFA, 0xB7, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x1C, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-  0xFA, 0x04, 0xCA, 0xFA, 0xF3, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x1C, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xEC, 0x10, 0xFC, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA,
-  0xFA, 0x38, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x1C, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0x2B, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA,
-  0xFA, 0x77, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x92, 0xEC, 0xFF,
-  0x14, 0xED, 0xFF, 0x14, 0xED, 0xFF, 0x14, 0xED, 0xFF, 0x14, 0xED, 0xFF, 0x14,
-  0xED, 0xFF, 0x14, 0xED, 0xFF, 0xEF, 0xE3, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0x6A, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA,
-  0xFA, 0xB4, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x29, 0xDA, 0xFF, 0xCF, 0xE3, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xA8, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0x02, 0xCA,
-  0xFA, 0xEF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0x28, 0xDA, 0xFF, 0xBA, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x51, 0xEC, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xE7, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x2A, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0x28, 0xDA, 0xFF, 0xBA, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x51, 0xEC, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCB, 0xFA,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x51, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x29, 0xDA,
-  0xFF, 0xBA, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0xEC, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x76, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x29, 0xDA, 0xFF, 0xBA, 0xF6,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0xEC, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x9B, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x9A, 0xF6, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
-  0xEC, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0xC0, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x4D, 0xE3, 0xFF, 0xBE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x51, 0xEC, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0xE5, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x4D, 0xE3,
-  0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0xEC, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89,
-  0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xDA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0x02, 0xCA, 0xFA, 0xFE, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0x4D, 0xE3, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0xEC, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFB, 0x0D, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0x4D, 0xE3, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0xEC,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0x08, 0xFA, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0xFA, 0x19, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x69, 0xDA,
-  0xFF, 0x96, 0xF5, 0xFF, 0x96, 0xF5, 0xFF, 0x96, 0xF5, 0xFF,
-  0x96, 0xF5, 0xFF, 0x96, 0xF5, 0xFF, 0x96, 0xF5, 0xFF, 0x96, 0xF5, 0xFF, 0x96,
-  0xF5, 0xFF, 0x96, 0xF5, 0xFF, 0x96, 0xF5, 0xFF, 0x96, 0xF5, 0xFF, 0x96, 0xF5,
-  0xFF, 0x96, 0xF5, 0xFF, 0x96, 0xF5, 0xFF, 0x96, 0xF5, 0xFF, 0x96, 0xF5, 0xFF,
-  0x96, 0xF5, 0xFF, 0x96, 0xF5, 0xFF, 0x96, 0xF5, 0xFF, 0x96, 0xF5, 0xFF, 0x96,
-  0xF5, 0xFF, 0x96, 0xF5, 0xFF, 0x96, 0xF5, 0xFF, 0x96, 0xF5, 0xFF, 0x96, 0xF5,
-  0xFF, 0x96, 0xF5, 0xFF, 0x96, 0xF5, 0xFF, 0xDB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x30, 0xEC, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xAA, 0xFA, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x25, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xCB, 0xE2,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0xEC, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xEA, 0xFA, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x31, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xCB, 0xE2,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0xEC, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xEA, 0xFA, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0xFA, 0x3D, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xCB, 0xE2,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0xEC, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x3C, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xCB, 0xE2,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xF5, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x31, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xCB, 0xE2,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xF5, 0xFF, 0xE7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xEA, 0xFA, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x25, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xCB, 0xE2,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xF5, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xEA, 0xFA, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0xFA, 0x19, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xAB, 0xE2,
-  0xFF, 0x3C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF,
-  0x3C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x3C,
-  0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x3C, 0xFF,
-  0xFF, 0x3C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF,
-  0x3C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x3C,
-  0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x3C, 0xFF,
-  0xFF, 0x3C, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x96, 0xF5, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCB, 0xFA, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFB, 0x0D, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0x8A, 0xDA, 0xFF, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xF5,
-  0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFE, 0xAA, 0xFA, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0x02, 0xCA, 0xFA, 0xFD, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0x8A, 0xDA, 0xFF, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xF5, 0xFF, 0xE7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0xE4, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x8A, 0xDA,
-  0xFF, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xF5, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89,
-  0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0xBF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x8A, 0xDA, 0xFF, 0x3C, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x96, 0xF5, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x9A, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xBA, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96,
-  0xF5, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x75, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xEB, 0xE2, 0xFF, 0x9E, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xF5, 0xFF, 0xE7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA,
-  0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x50, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xEB, 0xE2,
-  0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xF5, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x69, 0xF2,
-  0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x2A, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xEB, 0xE2, 0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x96, 0xF5, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x49, 0xEA,
-  0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0x02, 0xCA,
-  0xFA, 0xEF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xEB, 0xE2, 0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x96, 0xF5, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xE7, 0xD9, 0xFD, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA,
-  0xFA, 0xB3, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xEC, 0xE2, 0xFF, 0x55, 0xED, 0xFF,
-  0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x08, 0xE2, 0xE4, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA,
-  0xFA, 0x76, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x92, 0xEC, 0xFF,
-  0x14, 0xED, 0xFF, 0x14, 0xED, 0xFF, 0x14, 0xED, 0xFF, 0x14, 0xED, 0xFF, 0x14,
-  0xED, 0xFF, 0x14, 0xED, 0xFF, 0xEF, 0xE3, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x28, 0xE2, 0xB0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA,
-  0xFA, 0x37, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x1C, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x08, 0xE2, 0x5F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-  0xFA, 0x04, 0xCA, 0xFA, 0xF2, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x1C, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xE7, 0xD9, 0xFE, 0x24, 0xD9, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xCA, 0xFA, 0xB5, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x1C, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x08, 0xE2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xCA, 0xFA, 0x5E, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x1C, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x28, 0xEA, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x09, 0xFB, 0x0D, 0xCA, 0xFA, 0xF6, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x1C, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x69, 0xEA, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0xAA, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x1C, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0x08, 0xE2, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x51, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x1C, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0x28, 0xE2, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFA, 0x06, 0xCA, 0xFA, 0xED, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x71, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC,
-  0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF,
-  0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51,
-  0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC,
-  0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF,
-  0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51,
-  0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC,
-  0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x51, 0xEC, 0xFF, 0x7D, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xE7,
-  0xD9, 0xFD, 0xC7, 0xE1, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x90, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x28,
-  0xEA, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x1C, 0xCA, 0xFA,
-  0xF9, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x28,
-  0xE2, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA,
-  0xA2, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x08, 0xE2, 0xDE, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA,
-  0x2D, 0xCA, 0xFA, 0xFE, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x48, 0xEA, 0x4D, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xCA, 0xFA, 0xB5, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x08, 0xE2, 0xE3, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xCA, 0xFA, 0x3C, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x48, 0xEA, 0x58, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0xAF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0x14, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF5, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0x08, 0xE2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xAA, 0xFA, 0x23, 0xCA, 0xFA, 0xF9, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xEB, 0xFA, 0xFF, 0x6A, 0xE2, 0xFF,
-  0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69,
-  0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA,
-  0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF,
-  0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69,
-  0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA,
-  0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF,
-  0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69,
-  0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA,
-  0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF,
-  0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x69,
-  0xDA, 0xFF, 0x69, 0xDA, 0xFF, 0x28, 0xDA, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0x69, 0xEA, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x8B, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF,
-  0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0x28, 0xEA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xFB, 0x0A, 0xCA, 0xFA, 0xDD,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xE7, 0xE1, 0xF9,
-  0x69, 0xEA, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x4A,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x48, 0xEA, 0x71,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xCA, 0xFA, 0x9B, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x28, 0xE2, 0xCE, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xEB, 0xFA, 0x0B, 0xCA, 0xFA, 0xDA, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xE7, 0xE1, 0xF8, 0x28, 0xF2, 0x12, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xCA, 0xFA, 0x37, 0xCA, 0xFA, 0xF9, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA,
-  0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0x28, 0xEA, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x6B, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0x28, 0xEA, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0xA2, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x08, 0xE2,
-  0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFA, 0x06, 0xCA,
-  0xFA, 0xBF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x08, 0xE2, 0xED, 0x69, 0xE2,
-  0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA,
-  0xFA, 0x13, 0xCA, 0xFA, 0xDA, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA,
-  0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xE8, 0xE1, 0xF8, 0x4A, 0xEA, 0x1F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xAA, 0xFA, 0x23, 0xCA, 0xFA, 0xE5, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xE7, 0xD9, 0xFC, 0x49, 0xEA, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFA, 0x26, 0xCA, 0xFA, 0xE8, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xE7,
-  0xD9, 0xFD, 0x48, 0xEA, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x30, 0xCA, 0xFA,
-  0xEA, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xE7, 0xD9, 0xFC, 0x68,
-  0xEA, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0xFA,
-  0x28, 0xCA, 0xFA, 0xE3, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF,
-  0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xE7, 0xD9, 0xFC, 0x28, 0xEA, 0x45, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xAA, 0xFA, 0x23, 0xCA, 0xFA, 0xDB, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xE7, 0xE1, 0xF8, 0x69, 0xEA, 0x3B, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xAA, 0xFA, 0x12, 0xCA, 0xFA, 0xC0, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0x08, 0xE2, 0xED, 0x89, 0xEA, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFA, 0x07, 0xCA, 0xFA, 0xA1,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x28, 0xE2, 0xD6,
-  0x69, 0xE2, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xCA, 0xFA, 0x5E, 0xCA, 0xFA, 0xF6, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x28, 0xEA, 0xA2, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xCA, 0xFA, 0x35, 0xCA, 0xFA, 0xDB, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA,
-  0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xE8, 0xE1, 0xF8, 0x28, 0xEA, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFA, 0x09, 0xCA, 0xFA, 0x91, 0xCA,
-  0xFA, 0xFE, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x28, 0xE2,
-  0xD3, 0xAA, 0xF2, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA,
-  0xFA, 0x48, 0xCA, 0xFA, 0xDD, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xE7, 0xD9, 0xF9, 0x28, 0xEA, 0x73, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x29, 0xFB, 0x0A, 0xCA, 0xFA, 0x87, 0xCA, 0xFA, 0xF9, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0x28, 0xE2, 0xC0, 0x49, 0xEA, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0xFA, 0x1E, 0xCA, 0xFA,
-  0xA2, 0xCA, 0xFA, 0xFE, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA,
-  0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x08, 0xE2, 0xE1, 0x69,
-  0xEA, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xCA, 0xFA, 0x38, 0xCA, 0xFA, 0xB1, 0xCA, 0xFA, 0xFE, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0x08, 0xE2, 0xE6, 0x28, 0xEA, 0x5D, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0xFA, 0x24, 0xCA, 0xFA, 0x91,
-  0xCA, 0xFA, 0xF7, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x08, 0xE2, 0xE3,
-  0x28, 0xEA, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xCA, 0xFA, 0x1C, 0xCA, 0xFA, 0x8C, 0xCA, 0xFA, 0xED, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF,
-  0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xE7, 0xD9, 0xFD, 0x28, 0xE2, 0xC7, 0x48, 0xEA, 0x39, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFA, 0x03, 0xCA, 0xFA, 0x44, 0xCA,
-  0xFA, 0xA2, 0xCA, 0xFA, 0xF2, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0x08, 0xE2, 0xE8, 0x28, 0xEA,
-  0x88, 0x69, 0xE2, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xEB, 0xFA, 0x0B, 0xCA, 0xFA, 0x59, 0xCA, 0xFA, 0xAF, 0xCA, 0xFA,
-  0xEF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xE7, 0xD9, 0xFE, 0x08,
-  0xE2, 0xE3, 0x28, 0xEA, 0x99, 0x09, 0xE2, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xCA, 0xFA, 0x22, 0xCA, 0xFA, 0x66, 0xCA, 0xFA, 0xA2, 0xCA, 0xFA, 0xE3,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA,
-  0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xE7, 0xD9, 0xFD,
-  0x08, 0xE2, 0xE9, 0x28, 0xE2, 0xBB, 0x48, 0xEA, 0x63, 0x2C, 0xFB, 0x05, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01,
-  0xEA, 0xFA, 0x24, 0xCA, 0xFA, 0x49, 0xCA, 0xFA, 0x6F, 0xCA, 0xFA, 0x94, 0xCA,
-  0xFA, 0xB9, 0xCA, 0xFA, 0xDE, 0xCA, 0xFA, 0xFA, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA,
-  0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF,
-  0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0xFF, 0xAA, 0xFA, 0xFF, 0xE7,
-  0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xE7, 0xD9, 0xFA, 0x08, 0xE2, 0xEC, 0x08, 0xE2,
-  0xD6, 0x28, 0xE2, 0xB5, 0x28, 0xEA, 0x81, 0x49, 0xEA, 0x3B, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFB, 0x05, 0xCB, 0xFA,
-  0x11, 0xCB, 0xFA, 0x20, 0xCA, 0xFA, 0x2B, 0xCA, 0xFA, 0x35,
-  0xCA, 0xFA, 0x34, 0xCA, 0xFA, 0x2A, 0xCB, 0xFA, 0x20, 0xCB, 0xFA, 0x11, 0x08,
-  0xEA, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x52, 0x4C, 0x45, 0x03, 0x00, 0x00, 0x24, 0x00, 0x4A, 0x00, 0x64, 0x00, 0x84,
+  0x00, 0x9E, 0x00, 0xB8, 0x00, 0xE0, 0x00, 0x05, 0x01, 0x36, 0x01, 0x6A, 0x01,
+  0x95, 0x01, 0xCB, 0x01, 0xF9, 0x01, 0x2C, 0x02, 0x51, 0x02, 0x7F, 0x02, 0xAA,
+  0x02, 0xCC, 0x02, 0xF4, 0x02, 0x16, 0x03, 0x38, 0x03, 0x60, 0x03, 0x82, 0x03,
+  0xB0, 0x03, 0x87, 0x00, 0x00, 0x00, 0x08, 0xCA, 0xFA, 0x01, 0xCA, 0xFA, 0x14,
+  0xCA, 0xFA, 0x48, 0xCA, 0xFA, 0x68, 0xCA, 0xFA, 0x73, 0xCA, 0xFA, 0x68, 0xCA,
+  0xFA, 0x48, 0xCA, 0xFA, 0x16, 0xCA, 0xFA, 0x01, 0x87, 0x00, 0x00, 0x00, 0x85,
+  0x00, 0x00, 0x00, 0x03, 0xCA, 0xFA, 0x06, 0xCA, 0xFA, 0x5A, 0xCA, 0xFA, 0xC2,
+  0xCA, 0xFA, 0xFC, 0x84, 0xCA, 0xFA, 0xFF, 0x03, 0xCA, 0xFA, 0xFC, 0xCA, 0xFA,
+  0xC2, 0xCA, 0xFA, 0x5A, 0xCA, 0xFA, 0x06, 0x85, 0x00, 0x00, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x01, 0xCA, 0xFA, 0x39, 0xCA, 0xFA, 0xD2, 0x8A, 0xCA, 0xFA, 0xFF,
+  0x01, 0xCA, 0xFA, 0xD1, 0xCA, 0xFA, 0x38, 0x84, 0x00, 0x00, 0x00, 0x82, 0x00,
+  0x00, 0x00, 0x02, 0xCA, 0xFA, 0x00, 0xCA, 0xFA, 0x64, 0xCA, 0xFA, 0xF7, 0x8C,
+  0xCA, 0xFA, 0xFF, 0x02, 0xCA, 0xFA, 0xF7, 0xCA, 0xFA, 0x64, 0xEA, 0xFA, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x01, 0xCA, 0xFA, 0x64, 0xCA,
+  0xFA, 0xFC, 0x8E, 0xCA, 0xFA, 0xFF, 0x01, 0xCA, 0xFA, 0xFC, 0xCA, 0xFA, 0x64,
+  0x82, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x01, 0xCA, 0xFA, 0x39, 0xCA,
+  0xFA, 0xF7, 0x90, 0xCA, 0xFA, 0xFF, 0x01, 0xCA, 0xFA, 0xF7, 0xCA, 0xFA, 0x38,
+  0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x06, 0xCA, 0xFA,
+  0xD2, 0x83, 0xCA, 0xFA, 0xFF, 0x00, 0x0F, 0xFC, 0xFF, 0x87, 0xB2, 0xFC, 0xFF,
+  0x00, 0x6C, 0xFB, 0xFF, 0x84, 0xCA, 0xFA, 0xFF, 0x02, 0xCA, 0xFA, 0xD0, 0xCA,
+  0xFA, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x5B, 0x84,
+  0xCA, 0xFA, 0xFF, 0x00, 0x38, 0xFE, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x01, 0xEF,
+  0xEB, 0xFF, 0x89, 0xF2, 0xFF, 0x84, 0xCA, 0xFA, 0xFF, 0x01, 0xCA, 0xFA, 0x59,
+  0x00, 0x00, 0x00, 0x01, 0xCA, 0xFA, 0x01, 0xCA, 0xFA, 0xC3, 0x84, 0xCA, 0xFA,
+  0xFF, 0x01, 0x38, 0xFE, 0xFF, 0xDB, 0xF6, 0xFF, 0x84, 0x49, 0xDA, 0xFF, 0x04,
+  0x0C, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xE3, 0xFF, 0xC7, 0xD9, 0xFF, 0x89,
+  0xF2, 0xFF, 0x83, 0xCA, 0xFA, 0xFF, 0x01, 0xCA, 0xFA, 0xC1, 0xCA, 0xFA, 0x00,
+  0x01, 0xCA, 0xFA, 0x15, 0xCA, 0xFA, 0xFC, 0x84, 0xCA, 0xFA, 0xFF, 0x01, 0x38,
+  0xFE, 0xFF, 0xBA, 0xF6, 0xFF, 0x84, 0xC7, 0xD9, 0xFF, 0x05, 0x49, 0xDA, 0xFF,
+  0xF7, 0xF5, 0xFF, 0x2D, 0xE3, 0xFF, 0x08, 0xDA, 0xFF, 0xC7, 0xD9, 0xFF, 0x89,
+  0xF2, 0xFF, 0x82, 0xCA, 0xFA, 0xFF, 0x01, 0xCA, 0xFA, 0xFC, 0xCA, 0xFA, 0x13,
+  0x00, 0xCA, 0xFA, 0x49, 0x85, 0xCA, 0xFA, 0xFF, 0x01, 0x38, 0xFE, 0xFF, 0xBA,
+  0xF6, 0xFF, 0x86, 0xC7, 0xD9, 0xFF, 0x04, 0x4D, 0xE3, 0xFF, 0x3C, 0xFF, 0xFF,
+  0xEB, 0xE2, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0x82, 0xCA, 0xFA, 0xFF,
+  0x00, 0xCA, 0xFA, 0x47, 0x00, 0xCA, 0xFA, 0x69, 0x85, 0xCA, 0xFA, 0xFF, 0x01,
+  0x38, 0xFE, 0xFF, 0xBA, 0xF6, 0xFF, 0x81, 0xC7, 0xD9, 0xFF, 0x00, 0xE8, 0xD9,
+  0xFF, 0x83, 0x0C, 0xE3, 0xFF, 0x05, 0xCF, 0xE3, 0xFF, 0x9E, 0xFF, 0xFF, 0x7D,
+  0xFF, 0xFF, 0xEB, 0xE2, 0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0x81, 0xCA,
+  0xFA, 0xFF, 0x00, 0xCA, 0xFA, 0x67, 0x00, 0xCA, 0xFA, 0x74, 0x85, 0xCA, 0xFA,
+  0xFF, 0x01, 0x38, 0xFE, 0xFF, 0xBA, 0xF6, 0xFF, 0x81, 0xC7, 0xD9, 0xFF, 0x00,
+  0x8A, 0xE2, 0xFF, 0x86, 0xFF, 0xFF, 0xFF, 0x05, 0xFB, 0xF6, 0xFF, 0xE8, 0xD9,
+  0xFF, 0xC7, 0xD9, 0xFF, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0xFF, 0xCA, 0xFA, 0x72,
+  0x00, 0xCA, 0xFA, 0x69, 0x85, 0xCA, 0xFA, 0xFF, 0x01, 0x38, 0xFE, 0xFF, 0xBA,
+  0xF6, 0xFF, 0x81, 0xC7, 0xD9, 0xFF, 0x00, 0xE8, 0xD9, 0xFF, 0x83, 0x6D, 0xE3,
+  0xFF, 0x03, 0xF0, 0xEB, 0xFF, 0xBE, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0x2C, 0xE3,
+  0xFF, 0x82, 0xC7, 0xD9, 0xFF, 0x01, 0x89, 0xF2, 0xFF, 0xCA, 0xFA, 0x67, 0x00,
+  0xCA, 0xFA, 0x49, 0x85, 0xCA, 0xFA, 0xFF, 0x01, 0x38, 0xFE, 0xFF, 0xBA, 0xF6,
+  0xFF, 0x86, 0xC7, 0xD9, 0xFF, 0x02, 0x6D, 0xE3, 0xFF, 0x5D, 0xFF, 0xFF, 0x0C,
+  0xE3, 0xFF, 0x84, 0xC7, 0xD9, 0xFF, 0x00, 0x48, 0xEA, 0x4A, 0x01, 0xCA, 0xFA,
+  0x15, 0xCA, 0xFA, 0xFC, 0x84, 0xCA, 0xFA, 0xFF, 0x01, 0x38, 0xFE, 0xFF, 0xBA,
+  0xF6, 0xFF, 0x84, 0xC7, 0xD9, 0xFF, 0x03, 0x49, 0xDA, 0xFF, 0xF7, 0xF5, 0xFF,
+  0x2D, 0xE3, 0xFF, 0x08, 0xDA, 0xFF, 0x84, 0xC7, 0xD9, 0xFF, 0x01, 0xC7, 0xD9,
+  0xFE, 0x08, 0xE2, 0x1B, 0x01, 0xCA, 0xFA, 0x01, 0xCA, 0xFA, 0xC2, 0x84, 0xCA,
+  0xFA, 0xFF, 0x01, 0x38, 0xFE, 0xFF, 0xDB, 0xF6, 0xFF, 0x84, 0x49, 0xDA, 0xFF,
+  0x02, 0x0C, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xE3, 0xFF, 0x85, 0xC7, 0xD9,
+  0xFF, 0x01, 0xC7, 0xD9, 0xC9, 0x28, 0xEA, 0x01, 0x01, 0x00, 0x00, 0x00, 0xCA,
+  0xFA, 0x5B, 0x84, 0xCA, 0xFA, 0xFF, 0x00, 0x38, 0xFE, 0xFF, 0x87, 0xFF, 0xFF,
+  0xFF, 0x00, 0xEF, 0xE3, 0xFF, 0x85, 0xC7, 0xD9, 0xFF, 0x01, 0xE7, 0xD9, 0x63,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xCA, 0xFA, 0x06, 0xCA, 0xFA, 0xD1,
+  0x83, 0xCA, 0xFA, 0xFF, 0x00, 0xEF, 0xF3, 0xFF, 0x87, 0x30, 0xE4, 0xFF, 0x00,
+  0x8A, 0xE2, 0xFF, 0x84, 0xC7, 0xD9, 0xFF, 0x02, 0xC7, 0xD9, 0xD7, 0x08, 0xE2,
+  0x07, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x01, 0xCA, 0xFA, 0x39, 0xCA,
+  0xFA, 0xF7, 0x83, 0xCA, 0xFA, 0xFF, 0x00, 0x48, 0xEA, 0xFF, 0x8B, 0xC7, 0xD9,
+  0xFF, 0x01, 0xC7, 0xD9, 0xF9, 0xE7, 0xE1, 0x3F, 0x81, 0x00, 0x00, 0x00, 0x82,
+  0x00, 0x00, 0x00, 0x01, 0xCA, 0xFA, 0x64, 0xCA, 0xFA, 0xFC, 0x83, 0xCA, 0xFA,
+  0xFF, 0x00, 0x48, 0xEA, 0xFF, 0x89, 0xC7, 0xD9, 0xFF, 0x01, 0xC7, 0xD9, 0xFD,
+  0xE7, 0xD9, 0x6C, 0x82, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x02, 0xCA,
+  0xFA, 0x00, 0xCA, 0xFA, 0x64, 0xCA, 0xFA, 0xF7, 0x83, 0xCA, 0xFA, 0xFF, 0x00,
+  0x48, 0xEA, 0xFF, 0x87, 0xC7, 0xD9, 0xFF, 0x02, 0xC7, 0xD9, 0xFA, 0xE7, 0xD9,
+  0x6C, 0x68, 0xEA, 0x01, 0x82, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x01,
+  0xCA, 0xFA, 0x38, 0xCA, 0xFA, 0xD1, 0x83, 0xCA, 0xFA, 0xFF, 0x00, 0x48, 0xEA,
+  0xFF, 0x85, 0xC7, 0xD9, 0xFF, 0x01, 0xC7, 0xD9, 0xD7, 0xE7, 0xE1, 0x40, 0x84,
+  0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x03, 0xCA, 0xFA, 0x06, 0xCA, 0xFA,
+  0x59, 0xCA, 0xFA, 0xC1, 0xCA, 0xFA, 0xFC, 0x81, 0xCA, 0xFA, 0xFF, 0x00, 0x48,
+  0xEA, 0xFF, 0x81, 0xC7, 0xD9, 0xFF, 0x03, 0xC7, 0xD9, 0xFE, 0xC7, 0xD9, 0xCB,
+  0xE7, 0xD9, 0x64, 0x08, 0xE2, 0x08, 0x85, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00,
+  0x00, 0x08, 0xCA, 0xFA, 0x01, 0xCA, 0xFA, 0x13, 0xCA, 0xFA, 0x47, 0xCA, 0xFA,
+  0x68, 0xCA, 0xFA, 0x72, 0x08, 0xE2, 0x6B, 0xE7, 0xD9, 0x51, 0x08, 0xE2, 0x1C,
+  0x28, 0xEA, 0x01, 0x87, 0x00, 0x00, 0x00,
 };
 const lv_img_dsc_t ui_img_exit_icon_png = {
   .header.always_zero = 0,
-  .header.w = 128,
-  .header.h = 128,
+  .header.w = 25,
+  .header.h = 25,
   .data_size = sizeof(ui_img_exit_icon_png_data),
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = ui_img_exit_icon_png_data
 };
@@ -10,1195 +10,230 @@
 #endif
 
 // IMAGE DATA: assets\light_off_icon.png
+// Scaled to zoom 150 from 63x80 by tools/img_rle_convert.py
+// RLE encoded by tools/img_rle_convert.py, 5217 bytes raw
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_light_off_icon_png_data[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0x1E, 0xFF, 0xFF, 0x30, 0xFF, 0xFF, 0x3D, 0xDF,
-  0xFF, 0x44, 0xFF, 0xFF, 0x44, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0x33, 0xFF, 0xFF,
-  0x25, 0xFF, 0xFF, 0x16, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x15, 0xBE, 0xF7, 0x3D, 0x9E, 0xF7, 0x53,
-  0x7D, 0xEF, 0x6C, 0x7D, 0xEF, 0x83, 0x5D, 0xEF, 0x93, 0x3C, 0xE7, 0x9D, 0x3C,
-  0xE7, 0xA0, 0x3C, 0xE7, 0x9C, 0x7D, 0xEF, 0x95, 0x9E, 0xF7, 0x86, 0xBE, 0xF7,
-  0x74, 0xDF, 0xFF, 0x62, 0xFF, 0xFF, 0x4E, 0xFF, 0xFF, 0x36, 0xFF, 0xFF, 0x1D,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0x0D, 0xBE, 0xF7, 0x1B, 0x7D, 0xEF, 0x1F, 0x7D, 0xEF,
-  0x28, 0x3C, 0xE7, 0x33, 0x1C, 0xE7, 0x55, 0xDB, 0xDE, 0x8F, 0xDB, 0xDE, 0xB0,
-  0xDB, 0xDE, 0xBE, 0xDB, 0xDE, 0xC6, 0xDB, 0xDE, 0xCC, 0xDB, 0xDE, 0xD2, 0xDB,
-  0xDE, 0xD5, 0xFB, 0xDE, 0xD4, 0xFB, 0xDE, 0xD1, 0x1C, 0xE7, 0xC3, 0x3C, 0xE7,
-  0xAD, 0x5D, 0xEF, 0x9C, 0x7D, 0xEF, 0x90, 0xBE, 0xF7, 0x77, 0xDF, 0xFF, 0x57,
-  0xFF, 0xFF, 0x2D, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x33, 0xDF, 0xFF, 0x58, 0x7D,
-  0xEF, 0x5E, 0x1C, 0xE7, 0x4A, 0xDB, 0xDE, 0x55, 0xDB, 0xDE, 0x71, 0xFB, 0xDE,
-  0x8E, 0xFB, 0xDE, 0xA6, 0xFB, 0xDE, 0xB1, 0xFB, 0xDE, 0xB7, 0xFB, 0xDE, 0xBD,
-  0xFB, 0xDE, 0xC4, 0xFB, 0xDE, 0xCE, 0x1C, 0xE7, 0xDC, 0x1C, 0xE7, 0xE6, 0xFB,
-  0xDE, 0xE9, 0xDB, 0xDE, 0xE8, 0xDB, 0xDE, 0xE3, 0xDB, 0xDE, 0xDC, 0xDB, 0xDE,
-  0xD6, 0xFB, 0xDE, 0xD8, 0x1C, 0xE7, 0xD1, 0x5D, 0xEF, 0xAF, 0x9E, 0xF7, 0x8C,
-  0xDF, 0xFF, 0x70, 0xFF, 0xFF, 0x50, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x34,
-  0xDF, 0xFF, 0x6D, 0x9E, 0xF7, 0x90, 0x1C, 0xE7, 0xA5, 0xBA, 0xD6, 0xA5, 0xDB,
-  0xDE, 0x95, 0xFB, 0xDE, 0x88, 0x1C, 0xE7, 0x8D, 0x1C, 0xE7, 0x99, 0x1C, 0xE7,
-  0xA0, 0x1C, 0xE7, 0xA5, 0x1C, 0xE7, 0xAB, 0x1C, 0xE7, 0xAE, 0x1C, 0xE7, 0xB9,
-  0x1C, 0xE7, 0xD0, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C,
-  0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFD, 0xFB, 0xDE,
-  0xF7, 0xFB, 0xDE, 0xEF, 0xDB, 0xDE, 0xEA, 0xFB, 0xDE, 0xEA, 0x5D, 0xEF, 0xC7,
-  0xBE, 0xF7, 0x9E, 0xFF, 0xFF, 0x73, 0xFF, 0xFF, 0x3D, 0xFF, 0xFF, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x48, 0x9E, 0xF7, 0x97, 0x1C, 0xE7, 0xB9,
-  0xFB, 0xDE, 0xB9, 0xDB, 0xDE, 0xB6, 0xDB, 0xDE, 0xB3, 0xFB, 0xDE, 0x9F, 0x1C,
-  0xE7, 0x92, 0xFB, 0xDE, 0x8D, 0xFB, 0xDE, 0x8E, 0x1C, 0xE7, 0x93, 0x1C, 0xE7,
-  0x9E, 0x1C, 0xE7, 0xAB, 0x1C, 0xE7, 0xA8, 0x1C, 0xE7, 0xB6, 0x3C, 0xE7, 0xD4,
-  0x3C, 0xE7, 0xFD, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0x1C, 0xE7,
-  0xFF, 0xFB, 0xDE, 0xFF, 0xDB, 0xDE, 0xFA, 0xDB, 0xDE, 0xF1, 0x1C, 0xE7, 0xEC,
-  0x7D, 0xEF, 0xBA, 0xDF, 0xFF, 0x79, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0x05, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x14, 0xFF, 0xFF,
-  0x70, 0x5D, 0xEF, 0xAF, 0x1C, 0xE7, 0xC3, 0xDB, 0xDE, 0xC4, 0xDB, 0xDE, 0xBE,
-  0xFB, 0xDE, 0xB7, 0x1C, 0xE7, 0x9B, 0x1C, 0xE7, 0x7A, 0x1C, 0xE7, 0x61, 0x5D,
-  0xEF, 0x59, 0x7D, 0xEF, 0x59, 0xBE, 0xF7, 0x5F, 0x9E, 0xF7, 0x6E, 0x9E, 0xF7,
-  0x89, 0x7D, 0xEF, 0xA6, 0x5D, 0xEF, 0xB8, 0x3C, 0xE7, 0xE3, 0x3C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7,
-  0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xBA, 0xD6, 0xFC, 0xDB, 0xDE, 0xF1,
-  0x5D, 0xEF, 0xC4, 0xBE, 0xF7, 0x80, 0xDF, 0xFF, 0x42, 0xFF, 0xFF, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0x09, 0xDF, 0xFF, 0x6F, 0x3C, 0xE7, 0xB4, 0xFB, 0xDE,
-  0xCA, 0xFB, 0xDE, 0xCB, 0xDB, 0xDE, 0xC7, 0xFB, 0xDE, 0xBB, 0x1C, 0xE7, 0x9A,
-  0x5D, 0xEF, 0x6A, 0x9E, 0xF7, 0x53, 0xDF, 0xFF, 0x45, 0xFF, 0xFF, 0x38, 0xFF,
-  0xFF, 0x35, 0xFF, 0xFF, 0x37, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x7E, 0xDF, 0xFF,
-  0xA4, 0x9E, 0xF7, 0xC5, 0x7D, 0xEF, 0xF9, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF,
-  0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7,
-  0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xED,
-  0xFB, 0xDE, 0xC8, 0x9E, 0xF7, 0x72, 0xDF, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
-  0xF7, 0x49, 0x7D, 0xEF, 0xA0, 0xFB, 0xDE, 0xC6, 0xFB, 0xDE, 0xCA, 0xFB, 0xDE,
-  0xC4, 0x1C, 0xE7, 0xB8, 0x3C, 0xE7, 0x89, 0x7D, 0xEF, 0x5C, 0xBE, 0xF7, 0x42,
-  0xFF, 0xFF, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x99, 0xDF, 0xFF, 0xB4, 0x9E, 0xF7,
-  0xE6, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF,
-  0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7,
-  0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xDB, 0xDE, 0xEC,
-  0x3C, 0xE7, 0xB7, 0x7D, 0xEF, 0x6F, 0xDF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xF7, 0x29, 0x3C, 0xE7, 0x81, 0xFB,
-  0xDE, 0xC6, 0xDB, 0xDE, 0xCC, 0xDB, 0xDE, 0xCE, 0x1C, 0xE7, 0xB9, 0x5D, 0xEF,
-  0x86, 0x9E, 0xF7, 0x59, 0xDF, 0xFF, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x20, 0xFF, 0xFF, 0x67, 0xFF,
-  0xFF, 0x97, 0xFF, 0xFF, 0xB3, 0xDF, 0xFF, 0xE5, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF,
-  0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF,
-  0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7,
-  0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xDB, 0xDE, 0xFE, 0xDB, 0xDE, 0xE8,
-  0xFB, 0xDE, 0xAC, 0xBE, 0xF7, 0x5C, 0xFF, 0xFF, 0x22, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x5D, 0xEF, 0x5A, 0xFB, 0xDE, 0xB5, 0xDB, 0xDE, 0xCD, 0xDB,
-  0xDE, 0xCA, 0xFB, 0xDE, 0xB5, 0x7D, 0xEF, 0x7A, 0xDF, 0xFF, 0x54, 0xFF, 0xFF,
-  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x24,
-  0xFF, 0xFF, 0x45, 0xFF, 0xFF, 0x74, 0xDF, 0xFF, 0x9F, 0xBE, 0xF7, 0xD0, 0xBE,
-  0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF,
-  0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF,
-  0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7,
-  0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xDB, 0xDE, 0xF6, 0xBA, 0xD6, 0xDF,
-  0x1C, 0xE7, 0x8A, 0xDF, 0xFF, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xEF, 0x25,
-  0x1C, 0xE7, 0x8B, 0xDB, 0xDE, 0xC3, 0xFB, 0xDE, 0xC3, 0x1C, 0xE7, 0xAF, 0x7D,
-  0xEF, 0x7E, 0xDF, 0xFF, 0x53, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x4F, 0xDF, 0xFF, 0x82,
-  0xBE, 0xF7, 0xB1, 0x9E, 0xF7, 0xED, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x9E,
-  0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF,
-  0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7,
-  0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xDB, 0xDE, 0xEC, 0xDB, 0xDE, 0xC4,
-  0x3C, 0xE7, 0x6B, 0xDF, 0xFF, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0x01, 0x1C, 0xE7, 0x4A, 0xDB, 0xDE, 0xAD,
-  0xDB, 0xDE, 0xBC, 0x1C, 0xE7, 0xAB, 0x5D, 0xEF, 0x78, 0xFF, 0xFF, 0x55, 0xFF,
-  0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x20, 0xDF, 0xFF, 0x5A, 0xBE, 0xF7, 0x96, 0x9E, 0xF7, 0xD3, 0x9E, 0xF7, 0xFF,
-  0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E,
-  0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF,
-  0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7,
-  0xFF, 0xFB, 0xDE, 0xFF, 0x1C, 0xE7, 0xFF, 0xDB, 0xDE, 0xE6, 0xDB, 0xDE, 0xC3,
-  0x7D, 0xEF, 0x68, 0xFF, 0xFF, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xEF,
-  0x2C, 0xDB, 0xDE, 0x75, 0xDB, 0xDE, 0xAE, 0xFB, 0xDE, 0xB2,
-  0x3C, 0xE7, 0x85, 0xBE, 0xF7, 0x55, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0x06, 0xDF, 0xFF, 0x2C, 0xDF, 0xFF, 0x67, 0xBE, 0xF7,
-  0xB2, 0x9E, 0xF7, 0xF2, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF,
-  0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E,
-  0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF,
-  0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D,
-  0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE,
-  0xFF, 0x3C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xBA, 0xD6, 0xE3, 0x1C, 0xE7, 0xB3,
-  0xBE, 0xF7, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x08, 0xFB, 0xDE, 0x4F, 0xDB, 0xDE,
-  0x8C, 0xFB, 0xDE, 0x9F, 0x1C, 0xE7, 0x89, 0x7D, 0xEF, 0x61,
-  0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x05, 0xFF,
-  0xFF, 0x47, 0xDF, 0xFF, 0x82, 0x9E, 0xF7, 0xC5, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF,
-  0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE,
-  0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF,
-  0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D,
-  0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE,
-  0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFB, 0xDB, 0xDE, 0xE8, 0x5D, 0xEF, 0xA1,
-  0xFF, 0xFF, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3C, 0xE7, 0x28, 0xDB, 0xDE, 0x74, 0xFB, 0xDE, 0x8E, 0xFB, 0xDE,
-  0x8C, 0x3C, 0xE7, 0x66, 0xDF, 0xFF, 0x47, 0xFF, 0xFF, 0x08,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x4C, 0xDF, 0xFF, 0x8E, 0x9E,
-  0xF7, 0xCF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7,
-  0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF,
-  0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE,
-  0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF,
-  0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7,
-  0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xF9, 0xFB, 0xDE, 0xF2, 0xBE, 0xF7, 0x7B,
-  0xFF, 0xFF, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xEF, 0x1B, 0xDB,
-  0xDE, 0x44, 0xBA, 0xD6, 0x86, 0xFB, 0xDE, 0x88, 0x1C, 0xE7, 0x71, 0x7D, 0xEF,
-  0x4F, 0xDF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x4D, 0xFF, 0xFF, 0x95, 0xBE, 0xF7, 0xD7, 0x7D, 0xEF, 0xFF, 0x9E,
-  0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7,
-  0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE,
-  0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF,
-  0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7,
-  0xFF, 0xFB, 0xDE, 0xFF, 0xDB, 0xDE, 0xFF, 0x5D, 0xEF, 0xE0, 0xFF, 0xFF, 0x5B,
-  0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xEF, 0x39, 0xFB, 0xDE, 0x68, 0xDB,
-  0xDE, 0x8B, 0xFB, 0xDE, 0x7E, 0x3C, 0xE7, 0x5A, 0xBE, 0xF7, 0x40, 0xFF, 0xFF,
-  0x09, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x99,
-  0xBE, 0xF7, 0xD8, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE,
-  0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7,
-  0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7,
-  0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF,
-  0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE,
-  0xFF, 0xDB, 0xDE, 0xFF, 0x1C, 0xE7, 0xFF, 0xBE, 0xF7, 0x9A, 0xFF, 0xFF, 0x39,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xDF, 0xFF, 0x24, 0x1C, 0xE7, 0x5B, 0xFB, 0xDE, 0x80, 0xFB, 0xDE, 0x94, 0xFB,
-  0xDE, 0x79, 0x3C, 0xE7, 0x52, 0xBE, 0xF7, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x04, 0xFF, 0xFF, 0x89, 0xDF, 0xFF, 0xD1, 0x9E, 0xF7, 0xFF,
-  0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE,
-  0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7,
-  0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF,
-  0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE,
-  0xFF, 0xDB, 0xDE, 0xFF, 0x7D, 0xEF, 0xDF, 0xFF, 0xFF, 0x69, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x28, 0x9E, 0xF7, 0x3F,
-  0xDB, 0xDE, 0x77, 0xFB, 0xDE, 0x87, 0x1C, 0xE7, 0x8B, 0x1C, 0xE7, 0x74, 0x5D,
-  0xEF, 0x52, 0xBE, 0xF7, 0x42, 0xFF, 0xFF, 0x3B, 0xFF, 0xFF, 0x76, 0xDF, 0xFF,
-  0xB9, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF,
-  0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF,
-  0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x5D,
-  0xEF, 0xFF, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xBA, 0xD6,
-  0xFF, 0x5D, 0xEF, 0xFE, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0x29, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0x4E, 0x5D, 0xEF, 0x4E, 0xDB, 0xDE, 0x88,
-  0x1C, 0xE7, 0x83, 0x1C, 0xE7, 0x77, 0x1C, 0xE7, 0x62, 0x3C, 0xE7, 0x48, 0x9E,
-  0xF7, 0x4B, 0xDF, 0xFF, 0x64, 0xFF, 0xFF, 0xA9, 0x9E, 0xF7, 0xE0, 0x9E, 0xF7,
-  0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF,
-  0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF,
-  0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C,
-  0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xDB, 0xDE, 0xFF, 0x1C, 0xE7,
-  0xFF, 0xFF, 0xFF, 0xB9, 0xFF, 0xFF, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x91, 0xFF, 0xFF, 0x70, 0xFB, 0xDE, 0x5A, 0xDB, 0xDE, 0x8B, 0xFB, 0xDE, 0x75,
-  0xFB, 0xDE, 0x57, 0x3C, 0xE7, 0x43, 0x5D, 0xEF, 0x38, 0x5D, 0xEF, 0x4A, 0x5D,
-  0xEF, 0x8D, 0x9E, 0xF7, 0xC8, 0x9E, 0xF7, 0xFD, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF,
-  0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C,
-  0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xDB, 0xDE, 0xFF, 0xDF, 0xFF,
-  0xDC, 0xFF, 0xFF, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB4, 0xFF, 0xFF,
-  0x8C, 0xDB, 0xDE, 0x69, 0xDB, 0xDE, 0x8C, 0x1C, 0xE7, 0x5F, 0x7D, 0xEF, 0x39,
-  0xDF, 0xFF, 0x2B, 0xFF, 0xFF, 0x29, 0xBE, 0xF7, 0x4D, 0x7D, 0xEF, 0xA2, 0x7D,
-  0xEF, 0xDC, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7,
-  0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE,
-  0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF,
-  0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C,
-  0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xBA, 0xD6, 0xFF, 0xBE, 0xF7, 0xFC, 0xFF, 0xFF,
-  0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC9, 0xBE, 0xF7, 0xA1, 0xFB, 0xDE,
-  0x82, 0xDB, 0xDE, 0x8B, 0x1C, 0xE7, 0x4C, 0xDF, 0xFF, 0x2A, 0xFF, 0xFF, 0x10,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x4C, 0xDF, 0xFF, 0xA4, 0x5D, 0xEF, 0xE7, 0x7D,
-  0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE,
-  0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF,
-  0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB,
-  0xDE, 0xFF, 0xDB, 0xDE, 0xFF, 0x5D, 0xEF, 0xFF, 0xFF, 0xFF, 0x9A, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0xDC, 0x9E, 0xF7, 0xAF, 0xBA, 0xD6, 0x94, 0x1C, 0xE7,
-  0x96, 0x3C, 0xE7, 0x4B, 0xDF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x5C, 0xDF, 0xFF, 0xAF, 0x7D, 0xEF, 0xF3, 0x7D, 0xEF, 0xFF, 0x9E,
-  0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE,
-  0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xDB,
-  0xDE, 0xFF, 0x3C, 0xE7, 0xFC, 0xFF, 0xFF, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0xFF, 0xE8, 0x9E, 0xF7, 0xB7, 0xBA, 0xD6, 0xA9, 0xFB, 0xDE, 0xA7, 0x1C, 0xE7,
-  0x62, 0xBE, 0xF7, 0x43, 0xFF, 0xFF, 0x30, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0x94,
-  0xBE, 0xF7, 0xCA, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE,
-  0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE,
-  0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0x3C,
-  0xE7, 0xF3, 0xDF, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xEC, 0xBE,
-  0xF7, 0xB5, 0xDB, 0xDE, 0xAF, 0xFB, 0xDE, 0xB9, 0xFB, 0xDE, 0x8E, 0x7D, 0xEF,
-  0x70, 0xDF, 0xFF, 0x76, 0xDF, 0xFF, 0x99, 0xDF, 0xFF, 0xC3, 0x9E, 0xF7, 0xEF,
-  0x5D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE,
-  0xF7, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE,
-  0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF,
-  0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0x3C, 0xE7, 0xE4, 0xDF,
-  0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xED, 0xBE, 0xF7, 0xAB, 0xDB,
-  0xDE, 0xAB, 0xFB, 0xDE, 0xC8, 0xFB, 0xDE, 0xBB, 0x3C, 0xE7, 0xB6, 0x5D, 0xEF,
-  0xC1, 0x5D, 0xEF, 0xD0, 0x7D, 0xEF, 0xF2, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF,
-  0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E,
-  0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF,
-  0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF,
-  0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0x3C, 0xE7, 0xC5, 0xFF, 0xFF, 0x5F, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE9, 0xBE, 0xF7, 0x9C, 0xDB, 0xDE, 0x9A, 0xFB,
-  0xDE, 0xD1, 0xFB, 0xDE, 0xCD, 0x3C, 0xE7, 0xD0, 0x3C, 0xE7, 0xDF, 0x3C, 0xE7,
-  0xF8, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF,
-  0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E,
-  0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF,
-  0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF,
-  0xDB, 0xDE, 0xFF, 0x5D, 0xEF, 0x94, 0xDF, 0xFF, 0x3A, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xCE, 0xBE, 0xF7, 0x86, 0xFB, 0xDE, 0x7C, 0xFB, 0xDE, 0xD9, 0x1C,
-  0xE7, 0xE2, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF,
-  0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF,
-  0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF,
-  0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7,
-  0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xDB, 0xDE, 0xF1,
-  0x9E, 0xF7, 0x50, 0xFF, 0xFF, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x5D,
-  0xFF, 0xFF, 0x66, 0x1C, 0xE7, 0x63, 0xFB, 0xDE, 0xCF, 0xFB, 0xDE, 0xDC, 0x1C,
-  0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF,
-  0xFF, 0x5D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF,
-  0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF,
-  0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7,
-  0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xC5, 0xFF, 0xFF, 0x13,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x38,
-  0xBE, 0xF7, 0x59, 0xFB, 0xDE, 0xAD, 0xFB, 0xDE, 0xDC, 0x1C, 0xE7, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF,
-  0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF,
-  0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF,
-  0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7,
-  0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x05, 0xDF, 0xFF, 0x35,
-  0xFB, 0xDE, 0x74, 0xFB, 0xDE, 0xCF, 0x1C, 0xE7, 0xF6, 0x3C, 0xE7, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xF7,
-  0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF,
-  0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE,
-  0xDD, 0x7D, 0xEF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x06, 0x3C, 0xE7, 0x40,
-  0xFB, 0xDE, 0x9A, 0xFB, 0xDE, 0xDC, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF,
-  0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7,
-  0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF,
-  0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0xDB, 0xDE, 0xFF, 0xFB, 0xDE, 0x51, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xF7, 0x12, 0xDB, 0xDE, 0x31,
-  0xDB, 0xDE, 0xC4, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x5D,
-  0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF,
-  0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C,
-  0xE7, 0xFF, 0xDB, 0xDE, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xE7, 0x13, 0xDB, 0xDE, 0x65,
-  0x1C, 0xE7, 0xDF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x5D,
-  0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE,
-  0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0xDB, 0xDE, 0xFF, 0xFB,
-  0xDE, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xDE, 0x15, 0xDB, 0xDE, 0x8E,
-  0x1C, 0xE7, 0xF6, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE,
-  0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF,
-  0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x1C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xDB, 0xDE, 0xBC, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xD6, 0x13, 0x1C, 0xE7, 0xA6,
-  0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E,
-  0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF,
-  0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF,
-  0xFB, 0xDE, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xDE, 0x26, 0x1C, 0xE7, 0xF3,
-  0x1C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF,
-  0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF,
-  0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0x08,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xDE, 0x7E, 0x3C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7,
-  0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF,
-  0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7,
-  0xFF, 0x3C, 0xE7, 0xFF, 0xFB, 0xDE, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xDE, 0xBE, 0x1C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7,
-  0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7,
-  0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF,
-  0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE,
-  0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xBA, 0xD6, 0x12, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF,
-  0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF,
-  0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D,
-  0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFB, 0xDE, 0x76, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF,
-  0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE,
-  0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF,
-  0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C,
-  0xE7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1C, 0xE7, 0xF8, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF,
-  0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE,
-  0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF,
-  0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF,
-  0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xE7, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFB, 0xDE, 0x46, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF,
-  0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E,
-  0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF,
-  0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFB, 0xDE, 0xEA, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF,
-  0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7,
-  0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF,
-  0x1C, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xDE,
-  0x54, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF,
-  0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7,
-  0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0x1C, 0xE7, 0x2C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xD6, 0x06, 0xFB, 0xDE,
-  0xF9, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7,
-  0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF,
-  0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D,
-  0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0xFB, 0xDE,
-  0xFF, 0x1C, 0xE7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xDE, 0x9E, 0x1C, 0xE7,
-  0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D,
-  0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF,
-  0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF,
-  0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE,
-  0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xDE, 0x63, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE,
-  0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D,
-  0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF,
-  0xFF, 0x7D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF,
-  0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C,
-  0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xDB, 0xDE, 0x81, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFB, 0xDE, 0x0F, 0x1C, 0xE7, 0xC0, 0xFB, 0xDE, 0xFF, 0x1C, 0xE7,
-  0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D,
-  0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF,
-  0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB,
-  0xDE, 0xFF, 0x1C, 0xE7, 0xFF, 0xBA, 0xD6, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFB, 0xDE, 0x90, 0xFB, 0xDE, 0xFF, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7,
-  0xFF, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D,
-  0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF,
-  0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0x1C,
-  0xE7, 0xF4, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB,
-  0xDE, 0x6C, 0xFB, 0xDE, 0xFE, 0xFB, 0xDE, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7,
-  0xFF, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x5D,
-  0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7,
-  0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF,
-  0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xB1, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xD6, 0x18, 0xFB,
-  0xDE, 0xAB, 0xFB, 0xDE, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7,
-  0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7,
-  0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF,
-  0xFB, 0xDE, 0xFF, 0xDB, 0xDE, 0xFF, 0xFB, 0xDE, 0x51, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xDE, 0x6C, 0xFB,
-  0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0x1C, 0xE7,
-  0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF,
-  0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x3C,
-  0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7,
-  0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF,
-  0xDB, 0xDE, 0xAF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xDE, 0x32, 0xBA, 0xD6, 0x94, 0xDB,
-  0xDE, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE,
-  0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF,
-  0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C,
-  0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE,
-  0xFF, 0xFB, 0xDE, 0xFF, 0x1C, 0xE7, 0xFF, 0xBA, 0xD6, 0xCE, 0xBA, 0xD6, 0x5D,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xDE, 0x5B, 0xFB, 0xDE, 0xAF, 0xDB,
-  0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE,
-  0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF,
-  0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB,
-  0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xBA, 0xD6,
-  0xFF, 0xDB, 0xDE, 0xD6, 0xDB, 0xDE, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFB, 0xDE, 0x24, 0xDB, 0xDE, 0x62, 0xDB, 0xDE, 0xAA, 0xFB,
-  0xDE, 0xFD, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE,
-  0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF,
-  0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB,
-  0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0x1C, 0xE7, 0xCC, 0xDB, 0xDE,
-  0x92, 0x1C, 0xE7, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3C, 0xE7, 0x3F, 0x1C, 0xE7, 0x65, 0xFB, 0xDE, 0x9F, 0xFB,
-  0xDE, 0xD1, 0xFB, 0xDE, 0xF8, 0x1C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE,
-  0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF,
-  0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB,
-  0xDE, 0xC8, 0xFB, 0xDE, 0xB7, 0x1C, 0xE7, 0x58, 0x7D, 0xEF, 0x10, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x0A, 0xBE, 0xF7, 0x1B, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0x59, 0xFF,
-  0xFF, 0x71, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0xAD, 0xFF, 0xFF, 0xC4, 0xFF, 0xFF,
-  0xD6, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xE6, 0xFF, 0xFF, 0xE5,
-  0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xB4, 0xFF, 0xFF, 0x82, 0xFF,
-  0xFF, 0x68, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xAD, 0x19,
-  0x14, 0xA5, 0x5E, 0x14, 0xA5, 0x7F, 0x14, 0xA5, 0x8E, 0xF3, 0x9C, 0x95, 0x14,
-  0xA5, 0x9B, 0x14, 0xA5, 0x9E, 0x14, 0xA5, 0xA2, 0x14, 0xA5, 0xA3, 0xF3, 0x9C,
-  0xA5, 0x14, 0xA5, 0xA6, 0x14, 0xA5, 0xA7, 0xF3, 0x9C, 0xA8, 0x14, 0xA5, 0xA7,
-  0x14, 0xA5, 0xA6, 0x14, 0xA5, 0xA3, 0x14, 0xA5, 0x9E, 0x14, 0xA5, 0x99, 0xFF,
-  0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0x37, 0x28, 0x42, 0x8E,
-  0x69, 0x4A, 0xAB, 0x69, 0x4A, 0xB5, 0x69, 0x4A, 0xBB, 0x69, 0x4A, 0xBF, 0x69,
-  0x4A, 0xC2, 0x69, 0x4A, 0xC4, 0x69, 0x4A, 0xC6, 0x69, 0x4A, 0xC7, 0x49, 0x4A,
-  0xC8, 0x69, 0x4A, 0xC8, 0x69, 0x4A, 0xC7, 0x69, 0x4A, 0xC5, 0x69, 0x4A, 0xC2,
-  0x69, 0x4A, 0xBF, 0x49, 0x4A, 0xBA, 0x69, 0x4A, 0xA2, 0x51, 0x8C, 0x2E, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xE7, 0x39, 0x25, 0x69, 0x4A, 0xAC, 0x49, 0x4A, 0xD3,
-  0x49, 0x4A, 0xE1, 0x49, 0x4A, 0xEB, 0x49, 0x4A, 0xF3, 0x49, 0x4A, 0xFB, 0x49,
-  0x4A, 0xFF, 0x49, 0x4A, 0xFF, 0x49, 0x4A, 0xFF, 0x49, 0x4A, 0xFF, 0x49, 0x4A,
-  0xFF, 0x69, 0x4A, 0xFF, 0x69, 0x4A, 0xF7, 0x69, 0x4A, 0xE6, 0x69, 0x4A, 0xD3,
-  0x49, 0x4A, 0xBA, 0x49, 0x4A, 0xA3, 0x51, 0x8C, 0x2E, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xB6, 0xB5, 0x1C, 0x96, 0xB5, 0x9C, 0x75, 0xAD, 0xF2, 0x75, 0xAD, 0xFF,
-  0x75, 0xAD, 0xFF, 0x75, 0xAD, 0xFF, 0x75, 0xAD, 0xFF, 0x75, 0xAD, 0xFF, 0x55,
-  0xAD, 0xFF, 0x55, 0xAD, 0xFF, 0x75, 0xAD, 0xFF, 0x55, 0xAD, 0xFF, 0x75, 0xAD,
-  0xFF, 0x55, 0xAD, 0xFF, 0x34, 0xA5, 0xFF, 0x34, 0xA5, 0xFF, 0x75, 0xAD, 0xBF,
-  0x96, 0xB5, 0x74, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xB6, 0xB5, 0x7A, 0xB6, 0xB5, 0xD3, 0xB6, 0xB5, 0xFF, 0xB6, 0xB5, 0xFF,
-  0xB6, 0xB5, 0xFF, 0xB6, 0xB5, 0xFF, 0xB6, 0xB5, 0xFF, 0xB6, 0xB5, 0xFF, 0xB6,
-  0xB5, 0xFF, 0xB6, 0xB5, 0xFF, 0x96, 0xB5, 0xFF, 0xB6, 0xB5, 0xFF, 0xB6, 0xB5,
-  0xFF, 0xB6, 0xB5, 0xFF, 0xB6, 0xB5, 0xFF, 0xB6, 0xB5, 0xC2, 0xB6, 0xB5, 0x6B,
-  0xBA, 0xD6, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42,
-  0x92, 0x28, 0x42, 0xEF, 0x28, 0x42, 0xFF, 0x28, 0x42, 0xFF, 0x28, 0x42, 0xFF,
-  0x28, 0x42, 0xFF, 0x28, 0x42, 0xFF, 0x28, 0x42, 0xFF, 0x28, 0x42, 0xFF, 0x49,
-  0x4A, 0xFF, 0x49, 0x4A, 0xFF, 0x49, 0x4A, 0xFF, 0x49, 0x4A, 0xFF, 0x49, 0x4A,
-  0xFF, 0x28, 0x42, 0xFF, 0x49, 0x4A, 0xD1, 0x69, 0x4A, 0xB0, 0x71, 0x8C, 0x19,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0x80, 0x69, 0x4A,
-  0xDC, 0x69, 0x4A, 0xFF, 0x69, 0x4A, 0xFF, 0x69, 0x4A, 0xFF, 0x69, 0x4A, 0xFF,
-  0x69, 0x4A, 0xFF, 0x69, 0x4A, 0xFF, 0x69, 0x4A, 0xFF, 0x69, 0x4A, 0xFF, 0x69,
-  0x4A, 0xFF, 0x69, 0x4A, 0xFF, 0x69, 0x4A, 0xFF, 0x69, 0x4A, 0xFF, 0x49, 0x4A,
-  0xFF, 0x49, 0x4A, 0xD2, 0x8A, 0x52, 0xAA, 0x30, 0x84, 0x1D, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x8C, 0x3A, 0xD3, 0x9C, 0x9E, 0xB2, 0x94,
-  0xFC, 0xB2, 0x94, 0xFF, 0xB2, 0x94, 0xFF, 0xB2, 0x94, 0xFF, 0xB2, 0x94, 0xFF,
-  0xB2, 0x94, 0xFF, 0xB2, 0x94, 0xFF, 0xB2, 0x94, 0xFF, 0x92, 0x94, 0xFF, 0x92,
-  0x94, 0xFF, 0xB2, 0x94, 0xFF, 0xD3, 0x9C, 0xFF, 0xB2, 0x94, 0xFF, 0xB2, 0x94,
-  0xBE, 0xF3, 0x9C, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xDB, 0xDE, 0x07, 0x79, 0xCE, 0x50, 0x79, 0xCE, 0xA9, 0x79, 0xCE,
-  0xFF, 0x79, 0xCE, 0xFF, 0x79, 0xCE, 0xFF, 0x79, 0xCE, 0xFF, 0x79, 0xCE, 0xFF,
-  0x79, 0xCE, 0xFF, 0x79, 0xCE, 0xFF, 0x9A, 0xD6, 0xFF, 0x79, 0xCE, 0xFF, 0x79,
-  0xCE, 0xFF, 0x79, 0xCE, 0xFF, 0x59, 0xCE, 0xFF, 0xBA, 0xD6, 0x72, 0x7D, 0xEF,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x8A, 0x52, 0x8E, 0x8A, 0x52, 0xB3, 0x8A, 0x52, 0xFF, 0x8A, 0x52,
-  0xFF, 0x8A, 0x52, 0xFF, 0x8A, 0x52, 0xFF, 0x8A, 0x52, 0xFF, 0x8A, 0x52, 0xFF,
-  0x69, 0x4A, 0xFF, 0x8A, 0x52, 0xFF, 0x8A, 0x52, 0xFF, 0x69, 0x4A, 0xFF, 0x49,
-  0x4A, 0xFD, 0x28, 0x42, 0xE1, 0xAA, 0x52, 0xC4, 0xAE, 0x73, 0x6A, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69,
-  0x4A, 0x75, 0x8A, 0x52, 0xAA, 0x69, 0x4A, 0xCC, 0x69, 0x4A, 0xEC, 0x69, 0x4A,
-  0xFF, 0x69, 0x4A, 0xFF, 0x69, 0x4A, 0xFF, 0x69, 0x4A, 0xFF, 0x8A, 0x52, 0xFF,
-  0x8A, 0x52, 0xFF, 0x69, 0x4A, 0xFF, 0x69, 0x4A, 0xFD, 0xAA, 0x52, 0xDA, 0x8A,
-  0x52, 0xC9, 0x8A, 0x52, 0xB7, 0x2C, 0x63, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xAD, 0x53, 0x75,
-  0xAD, 0x8C, 0x75, 0xAD, 0xB0, 0x75, 0xAD, 0xD4, 0x96, 0xB5, 0xF9, 0x96, 0xB5,
-  0xFF, 0x75, 0xAD, 0xFF, 0x75, 0xAD, 0xFF, 0x55, 0xAD, 0xFE, 0x55, 0xAD, 0xF9,
-  0xB6, 0xB5, 0xEA, 0x96, 0xB5, 0xD8, 0x96, 0xB5, 0xBD, 0x75, 0xAD, 0x96, 0xB6,
-  0xB5, 0x59, 0x5D, 0xEF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xDE, 0x15, 0xDB, 0xDE, 0x37, 0xFB,
-  0xDE, 0x50, 0xDB, 0xDE, 0x65, 0x9A, 0xD6, 0x70, 0xBA, 0xD6, 0x6F, 0xFB, 0xDE,
-  0x68, 0xBA, 0xD6, 0x65, 0xDB, 0xDE, 0x66, 0xBA, 0xD6, 0x6B, 0xDB, 0xDE, 0x79,
-  0x9A, 0xD6, 0x86, 0xBA, 0xD6, 0x71, 0x9A, 0xD6, 0x49, 0x7D, 0xEF, 0x1F, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x49, 0x4A, 0x18, 0xAA, 0x52, 0x91, 0xAA, 0x52, 0xAB, 0xAA,
-  0x52, 0xC4, 0xAA, 0x52, 0xD4, 0xAA, 0x52, 0xE5, 0x8A, 0x52, 0xEF, 0xAA, 0x52,
-  0xF4, 0xAA, 0x52, 0xF5, 0x49, 0x4A, 0xF1, 0xAA, 0x52, 0xEE, 0xCB, 0x5A, 0xE2,
-  0xAA, 0x52, 0xDB, 0x8A, 0x52, 0xBE, 0xF7, 0xBD, 0x38, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xAA, 0x52, 0x73, 0x08, 0x42, 0xAC, 0xCB, 0x5A, 0xC3, 0xAA,
-  0x52, 0xCF, 0x69, 0x4A, 0xD3, 0x8A, 0x52, 0xD3, 0xAA, 0x52, 0xD3, 0x8A, 0x52,
-  0xD6, 0xAA, 0x52, 0xD6, 0x69, 0x4A, 0xD4, 0x08, 0x42, 0xD4, 0xEB, 0x5A, 0xC0,
-  0x92, 0x94, 0x7D, 0x9E, 0xF7, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x59, 0xCE, 0x3B, 0xB2, 0x94, 0x71, 0x2C, 0x63, 0x8D, 0x8A, 0x52, 0xAE, 0x69,
-  0x4A, 0xBE, 0x28, 0x42, 0xC8, 0x08, 0x42, 0xCD, 0x49, 0x4A, 0xCC, 0xAA, 0x52,
-  0xC7, 0x6D, 0x6B, 0xB6, 0xD3, 0x9C, 0x8F, 0xBA, 0xD6, 0x42, 0x7D, 0xEF, 0x10,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x06, 0xFB, 0xDE, 0x20, 0x9A, 0xD6, 0x34, 0xBA,
-  0xD6, 0x3B, 0x79, 0xCE, 0x3A, 0xDB, 0xDE, 0x30, 0x7D, 0xEF, 0x1F, 0x9E, 0xF7,
-  0x11, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0xFF,
-  0xFF, 0x02, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x04, 0xFF, 0xFF,
-  0x02, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00,
+  0x52, 0x4C, 0x45, 0x03, 0x00, 0x00, 0x21, 0x00, 0x54, 0x00, 0x99, 0x00, 0xDA,
+  0x00, 0x1F, 0x01, 0x67, 0x01, 0xAD, 0x01, 0xFA, 0x01, 0x4F, 0x02, 0x9A, 0x02,
+  0xE9, 0x02, 0x3A, 0x03, 0x89, 0x03, 0xDC, 0x03, 0x2E, 0x04, 0x7F, 0x04, 0xCF,
+  0x04, 0x1F, 0x05, 0x70, 0x05, 0xB8, 0x05, 0xFD, 0x05, 0x44, 0x06, 0x84, 0x06,
+  0xBF, 0x06, 0xFA, 0x06, 0x29, 0x07, 0x60, 0x07, 0x90, 0x07, 0xC5, 0x07, 0xF6,
+  0x07, 0x1E, 0x08, 0x4B, 0x08, 0x70, 0x08, 0x98, 0x08, 0xBE, 0x08, 0xEE, 0x08,
+  0x1E, 0x09, 0x4A, 0x09, 0x6A, 0x09, 0x8E, 0x09, 0xB4, 0x09, 0xDA, 0x09, 0x01,
+  0x0A, 0x25, 0x0A, 0x49, 0x0A, 0x6D, 0x0A, 0x8E, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0xFF, 0x00, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x16, 0xDF, 0xFF, 0x1B, 0xFF, 0xFF,
+  0x1A, 0xFF, 0xFF, 0x12, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x01, 0x8D, 0x00, 0x00,
+  0x00, 0x8B, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x02, 0x9D, 0xEF, 0x07, 0x9D,
+  0xEF, 0x0E, 0x7D, 0xEF, 0x33, 0x3D, 0xEF, 0x63, 0x3C, 0xE7, 0x87, 0x3C, 0xE7,
+  0x97, 0x3C, 0xE7, 0x9A, 0x5D, 0xEF, 0x8D, 0x7D, 0xEF, 0x74, 0x9E, 0xF7, 0x57,
+  0xBE, 0xF7, 0x37, 0xDF, 0xFF, 0x13, 0xFF, 0xFF, 0x04, 0x8A, 0x00, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x13, 0xFF, 0xFF, 0x00, 0xDF, 0xFF, 0x05, 0xBF, 0xFF,
+  0x28, 0x7D, 0xEF, 0x43, 0x1C, 0xE7, 0x42, 0xFB, 0xDE, 0x5E, 0xFB, 0xDE, 0x86,
+  0xFB, 0xDE, 0xAD, 0xFB, 0xDE, 0xBF, 0xFB, 0xDE, 0xCE, 0xFC, 0xE6, 0xDF, 0xFB,
+  0xDE, 0xE2, 0xFB, 0xDE, 0xD7, 0xFB, 0xDE, 0xC7, 0x3C, 0xE7, 0xBA, 0x7D, 0xEF,
+  0x8B, 0xBE, 0xF7, 0x55, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x16, 0x9E,
+  0xF7, 0x77, 0x3C, 0xE7, 0xA3, 0xDB, 0xDE, 0xAB, 0xFB, 0xDE, 0x93, 0x1C, 0xE7,
+  0x8F, 0x1C, 0xE7, 0x99, 0x1C, 0xE7, 0xA7, 0x1C, 0xE7, 0xB0, 0x1C, 0xE7, 0xD6,
+  0x82, 0x1C, 0xE7, 0xFF, 0x06, 0x1C, 0xE7, 0xFE, 0xFB, 0xDE, 0xF9, 0xFB, 0xDE,
+  0xF3, 0x1C, 0xE7, 0xDD, 0x7D, 0xEF, 0xA9, 0xDF, 0xFF, 0x45, 0xFF, 0xFF, 0x08,
+  0x87, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x01, 0xBE,
+  0xF7, 0x32, 0x5D, 0xEF, 0x97, 0xFC, 0xE6, 0xC2, 0xFB, 0xDE, 0xBA, 0x1C, 0xE7,
+  0x97, 0x3C, 0xE7, 0x68, 0x5D, 0xEF, 0x56, 0x9E, 0xF7, 0x5A, 0x9E, 0xF7, 0x7B,
+  0x7D, 0xEF, 0xAD, 0x5C, 0xE7, 0xE4, 0x83, 0x3C, 0xE7, 0xFF, 0x81, 0x1C, 0xE7,
+  0xFF, 0x04, 0xFB, 0xDE, 0xFD, 0xFB, 0xDE, 0xF4, 0x5D, 0xEF, 0xB2, 0x9E, 0xF7,
+  0x4B, 0xDF, 0xFF, 0x07, 0x86, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x0B,
+  0x9E, 0xF7, 0x19, 0x5D, 0xEF, 0x8B, 0xFB, 0xDE, 0xC7, 0xFB, 0xDE, 0xBE, 0x3C,
+  0xE7, 0x8D, 0x7D, 0xEF, 0x4F, 0xDF, 0xFF, 0x20, 0xFF, 0xFF, 0x11, 0xFF, 0xFF,
+  0x1C, 0xFF, 0xFF, 0x65, 0xBF, 0xFF, 0xC5, 0x7D, 0xEF, 0xF8, 0x82, 0x5D, 0xEF,
+  0xFF, 0x82, 0x3C, 0xE7, 0xFF, 0x05, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB,
+  0xDE, 0xF1, 0x3C, 0xE7, 0xA6, 0x9E, 0xF7, 0x3D, 0xFF, 0xFF, 0x02, 0x85, 0x00,
+  0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x0A, 0x3C, 0xE7, 0x61, 0xFB, 0xDE, 0xC0,
+  0xDB, 0xDE, 0xC4, 0x5D, 0xEF, 0x84, 0xBE, 0xF7, 0x3A, 0xDF, 0xFF, 0x08, 0xFF,
+  0xFF, 0x0A, 0xFF, 0xFF, 0x30, 0xDF, 0xFF, 0x7D, 0xDE, 0xF7, 0xCB, 0xBE, 0xF7,
+  0xF7, 0x82, 0x7D, 0xEF, 0xFF, 0x82, 0x5D, 0xEF, 0xFF, 0x81, 0x3C, 0xE7, 0xFF,
+  0x04, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xDB, 0xDE, 0xE9, 0x1C, 0xE7, 0x90,
+  0xDF, 0xFF, 0x21, 0x85, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+  0xFF, 0x00, 0x3C, 0xE7, 0x1A, 0xFB, 0xDE, 0xA0, 0xFB, 0xDE, 0xB6, 0x5D, 0xEF,
+  0x82, 0xDF, 0xFF, 0x26, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x0C, 0xDF, 0xFF, 0x4C,
+  0xBE, 0xF7, 0xA6, 0x9E, 0xF7, 0xE7, 0x9E, 0xF7, 0xFE, 0x82, 0x9E, 0xF7, 0xFF,
+  0x82, 0x7D, 0xEF, 0xFF, 0x81, 0x5D, 0xEF, 0xFF, 0x81, 0x3C, 0xE7, 0xFF, 0x04,
+  0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFC, 0xDB, 0xDE, 0xD8, 0x3C, 0xE7, 0x6B, 0xBE,
+  0xF7, 0x0E, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x09, 0x5D, 0xEF,
+  0x06, 0xFB, 0xDE, 0x4F, 0xDB, 0xDE, 0xA9, 0x3C, 0xE7, 0x86, 0xBE, 0xF7, 0x3E,
+  0xFF, 0xFF, 0x02, 0xDF, 0xFF, 0x17, 0xBF, 0xFF, 0x5C, 0x9E, 0xF7, 0xC6, 0x7D,
+  0xEF, 0xF6, 0x81, 0x9E, 0xF7, 0xFF, 0x02, 0xBE, 0xF7, 0xFF, 0x9E, 0xF7, 0xFF,
+  0xBE, 0xF7, 0xFF, 0x81, 0x9E, 0xF7, 0xFF, 0x82, 0x7D, 0xEF, 0xFF, 0x00, 0x5D,
+  0xEF, 0xFF, 0x81, 0x3C, 0xE7, 0xFF, 0x04, 0x1B, 0xDF, 0xFF, 0xFB, 0xDE, 0xFA,
+  0xFB, 0xDE, 0xC8, 0x7D, 0xEF, 0x4C, 0xFF, 0xFF, 0x02, 0x83, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x09, 0x7D, 0xEF, 0x00, 0x1C, 0xE7, 0x1D, 0xDB, 0xDE,
+  0x7B, 0xFB, 0xDE, 0x87, 0x7D, 0xEF, 0x4F, 0xFF, 0xFF, 0x0C, 0xFF, 0xFF, 0x15,
+  0xDF, 0xFF, 0x78, 0x9E, 0xF7, 0xD7, 0x9E, 0xF7, 0xFF, 0x86, 0xBE, 0xF7, 0xFF,
+  0x82, 0x9E, 0xF7, 0xFF, 0x81, 0x7D, 0xEF, 0xFF, 0x00, 0x5D, 0xEF, 0xFF, 0x81,
+  0x3C, 0xE7, 0xFF, 0x04, 0x1C, 0xE7, 0xFF, 0xFC, 0xE6, 0xF8, 0x1C, 0xE7, 0xB4,
+  0xDE, 0xF7, 0x24, 0xFF, 0xFF, 0x00, 0x82, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00,
+  0x00, 0x07, 0x5D, 0xEF, 0x0C, 0xFB, 0xDE, 0x4E, 0xDB, 0xDE, 0x86, 0x3C, 0xE7,
+  0x5D, 0xBE, 0xF7, 0x24, 0xFF, 0xFF, 0x0C, 0xDF, 0xFF, 0x8B, 0x9E, 0xF7, 0xE5,
+  0x81, 0x9E, 0xF7, 0xFF, 0x82, 0xBE, 0xF7, 0xFF, 0x81, 0xDF, 0xFF, 0xFF, 0x83,
+  0xBE, 0xF7, 0xFF, 0x81, 0x9E, 0xF7, 0xFF, 0x81, 0x7D, 0xEF, 0xFF, 0x06, 0x5D,
+  0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFF, 0xFB, 0xDE,
+  0xFA, 0x9E, 0xF7, 0x90, 0xFF, 0xFF, 0x0D, 0x82, 0x00, 0x00, 0x00, 0x81, 0x00,
+  0x00, 0x00, 0x09, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x05, 0x5D, 0xEF, 0x33, 0xFB,
+  0xDE, 0x77, 0xFB, 0xDE, 0x83, 0x5D, 0xEF, 0x4D, 0xDF, 0xFF, 0x1D, 0xFF, 0xFF,
+  0x5E, 0xBE, 0xF7, 0xE3, 0x7D, 0xEF, 0xFE, 0x82, 0xBE, 0xF7, 0xFF, 0x86, 0xDF,
+  0xFF, 0xFF, 0x82, 0xBE, 0xF7, 0xFF, 0x01, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF,
+  0x81, 0x5D, 0xEF, 0xFF, 0x05, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE,
+  0xFF, 0x3C, 0xE7, 0xDA, 0xFF, 0xFF, 0x38, 0xFF, 0xFF, 0x01, 0x81, 0x00, 0x00,
+  0x00, 0x81, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x3D, 0x3C,
+  0xE7, 0x5A, 0xFB, 0xDE, 0x82, 0x1C, 0xE7, 0x70, 0x5D, 0xEF, 0x4B, 0xDF, 0xFF,
+  0x62, 0xBE, 0xF7, 0xBE, 0x81, 0x9E, 0xF7, 0xFF, 0x81, 0xBE, 0xF7, 0xFF, 0x88,
+  0xDF, 0xFF, 0xFF, 0x81, 0xBE, 0xF7, 0xFF, 0x00, 0x9E, 0xF7, 0xFF, 0x81, 0x7D,
+  0xEF, 0xFF, 0x06, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFC,
+  0xE6, 0xFF, 0x1C, 0xE7, 0xF6, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0x06, 0x81, 0x00,
+  0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0x91,
+  0xFB, 0xDE, 0x71, 0xFB, 0xDE, 0x6F, 0x5C, 0xE7, 0x3F, 0x9E, 0xF7, 0x3B, 0x7D,
+  0xEF, 0x92, 0x9E, 0xF7, 0xEC, 0x9E, 0xF7, 0xFF, 0x81, 0xBE, 0xF7, 0xFF, 0x82,
+  0xDF, 0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0xFF, 0x81, 0xDF, 0xFF, 0xFF, 0x82, 0xBE,
+  0xF7, 0xFF, 0x01, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF, 0xFF, 0x81, 0x5D, 0xEF, 0xFF,
+  0x04, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFD, 0xDF, 0xFF, 0xBA,
+  0xFF, 0xFF, 0x09, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x09, 0xFF,
+  0xFF, 0x0D, 0xDF, 0xFF, 0xB9, 0xFB, 0xDE, 0x8B, 0x1C, 0xE7, 0x5C, 0xDF, 0xFF,
+  0x1B, 0xFF, 0xFF, 0x21, 0xBE, 0xF7, 0xA1, 0x7D, 0xEF, 0xF7, 0x9E, 0xF7, 0xFF,
+  0xBE, 0xF7, 0xFF, 0x82, 0xDF, 0xFF, 0xFF, 0x86, 0xFF, 0xFF, 0xFF, 0x81, 0xDF,
+  0xFF, 0xFF, 0x81, 0xBE, 0xF7, 0xFF, 0x00, 0x9E, 0xF7, 0xFF, 0x81, 0x7D, 0xEF,
+  0xFF, 0x05, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE,
+  0xFF, 0x9E, 0xF7, 0xC8, 0xFF, 0xFF, 0x0A, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00,
+  0x00, 0x00, 0x09, 0xFF, 0xFF, 0x0F, 0xDF, 0xFF, 0xCE, 0xFB, 0xDE, 0xA6, 0x1C,
+  0xE7, 0x71, 0xDE, 0xF7, 0x36, 0xFF, 0xFF, 0x58, 0xBE, 0xF7, 0xC4, 0x7D, 0xEF,
+  0xFE, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x81, 0xDF, 0xFF, 0xFF, 0x87, 0xFF,
+  0xFF, 0xFF, 0x82, 0xDF, 0xFF, 0xFF, 0x00, 0xBE, 0xF7, 0xFF, 0x81, 0x9E, 0xF7,
+  0xFF, 0x06, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7,
+  0xFF, 0xFB, 0xDE, 0xFE, 0x7D, 0xEF, 0xBC, 0xDF, 0xFF, 0x09, 0x81, 0x00, 0x00,
+  0x00, 0x81, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0F, 0xDF, 0xFF, 0xCF, 0xFB,
+  0xDE, 0xB3, 0xFB, 0xDE, 0xAC, 0x7D, 0xEF, 0x9B, 0x9E, 0xF7, 0xC4, 0x9E, 0xF7,
+  0xF3, 0x81, 0x9E, 0xF7, 0xFF, 0x00, 0xBE, 0xF7, 0xFF, 0x81, 0xDF, 0xFF, 0xFF,
+  0x87, 0xFF, 0xFF, 0xFF, 0x82, 0xDF, 0xFF, 0xFF, 0x00, 0xBE, 0xF7, 0xFF, 0x81,
+  0x9E, 0xF7, 0xFF, 0x06, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF,
+  0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xFA, 0x7D, 0xEF, 0x9C, 0xDF, 0xFF, 0x07, 0x81,
+  0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0E, 0xDF, 0xFF,
+  0xBB, 0xFB, 0xDE, 0xA5, 0x1B, 0xDF, 0xD6, 0x3C, 0xE7, 0xE6, 0x5D, 0xEF, 0xFA,
+  0x5D, 0xEF, 0xFF, 0x81, 0x9E, 0xF7, 0xFF, 0x00, 0xBE, 0xF7, 0xFF, 0x81, 0xDF,
+  0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x82, 0xDF, 0xFF, 0xFF, 0x00, 0xBE, 0xF7,
+  0xFF, 0x81, 0x9E, 0xF7, 0xFF, 0x06, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C,
+  0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xED, 0x9E, 0xF7, 0x53, 0xDF, 0xFF,
+  0x03, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x06,
+  0xFF, 0xFF, 0x63, 0x1C, 0xE7, 0x84, 0xFB, 0xDE, 0xDC, 0x1C, 0xE7, 0xFF, 0x5C,
+  0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7,
+  0xFF, 0x81, 0xDF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x82, 0xDF, 0xFF, 0xFF,
+  0x00, 0xBE, 0xF7, 0xFF, 0x81, 0x9E, 0xF7, 0xFF, 0x06, 0x7D, 0xEF, 0xFF, 0x5D,
+  0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xBD, 0xBE, 0xF7,
+  0x10, 0xFF, 0xFF, 0x00, 0x81, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x08,
+  0xDF, 0xFF, 0x0C, 0x5D, 0xEF, 0x53, 0xFB, 0xDE, 0xC2, 0x3C, 0xE7, 0xFC, 0x3C,
+  0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7,
+  0xFF, 0x82, 0xDF, 0xFF, 0xFF, 0x86, 0xFF, 0xFF, 0xFF, 0x81, 0xDF, 0xFF, 0xFF,
+  0x81, 0xBE, 0xF7, 0xFF, 0x81, 0x9E, 0xF7, 0xFF, 0x04, 0x7D, 0xEF, 0xFF, 0x5D,
+  0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x1B, 0xDF, 0xF8, 0x1C, 0xE7, 0x60, 0x83, 0x00,
+  0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x04, 0x5D, 0xEF, 0x0F, 0xFB, 0xDE, 0x67,
+  0x1C, 0xE7, 0xEA, 0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x81, 0x7D, 0xEF, 0xFF,
+  0x81, 0xBE, 0xF7, 0xFF, 0x82, 0xDF, 0xFF, 0xFF, 0x85, 0xFF, 0xFF, 0xFF, 0x81,
+  0xDF, 0xFF, 0xFF, 0x81, 0xBE, 0xF7, 0xFF, 0x02, 0x9E, 0xF7, 0xFF, 0x7D, 0xEF,
+  0xFF, 0x5D, 0xEF, 0xFF, 0x81, 0x3C, 0xE7, 0xFF, 0x01, 0xFB, 0xDE, 0xB6, 0xFB,
+  0xDE, 0x0E, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x04, 0x9E, 0xF7,
+  0x01, 0xFB, 0xDE, 0x18, 0xFC, 0xE6, 0x9B, 0x1C, 0xE7, 0xFB, 0x3C, 0xE7, 0xFF,
+  0x81, 0x7D, 0xEF, 0xFF, 0x01, 0x9E, 0xF7, 0xFF, 0xBE, 0xF7, 0xFF, 0x83, 0xDF,
+  0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0xFF, 0x81, 0xDF, 0xFF, 0xFF, 0x00, 0xBE, 0xF7,
+  0xFF, 0x81, 0x9E, 0xF7, 0xFF, 0x04, 0x7D, 0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C,
+  0xE7, 0xFF, 0x1C, 0xE7, 0xF7, 0xDB, 0xDE, 0x3A, 0x84, 0x00, 0x00, 0x00, 0x84,
+  0x00, 0x00, 0x00, 0x05, 0xDB, 0xDE, 0x01, 0xDB, 0xDE, 0x22, 0x1C, 0xE7, 0xCA,
+  0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x81, 0x9E, 0xF7, 0xFF,
+  0x00, 0xBE, 0xF7, 0xFF, 0x88, 0xDF, 0xFF, 0xFF, 0x81, 0xBE, 0xF7, 0xFF, 0x00,
+  0x9E, 0xF7, 0xFF, 0x81, 0x7D, 0xEF, 0xFF, 0x03, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7,
+  0xFD, 0xFB, 0xDE, 0x91, 0xDB, 0xDE, 0x08, 0x84, 0x00, 0x00, 0x00, 0x86, 0x00,
+  0x00, 0x00, 0x01, 0xFC, 0xE6, 0x4F, 0x3C, 0xE7, 0xEF, 0x81, 0x5D, 0xEF, 0xFF,
+  0x00, 0x7D, 0xEF, 0xFF, 0x81, 0x9E, 0xF7, 0xFF, 0x81, 0xBE, 0xF7, 0xFF, 0x85,
+  0xDF, 0xFF, 0xFF, 0x81, 0xBE, 0xF7, 0xFF, 0x81, 0x9E, 0xF7, 0xFF, 0x04, 0x7D,
+  0xEF, 0xFF, 0x5D, 0xEF, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xB3, 0xFB, 0xDE,
+  0x02, 0x85, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x03, 0xDB, 0xDE, 0x04,
+  0x1B, 0xDF, 0x85, 0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x81, 0x7D, 0xEF, 0xFF,
+  0x00, 0x9E, 0xF7, 0xFF, 0x82, 0xBE, 0xF7, 0xFF, 0x83, 0xDF, 0xFF, 0xFF, 0x82,
+  0xBE, 0xF7, 0xFF, 0x00, 0x9E, 0xF7, 0xFF, 0x81, 0x7D, 0xEF, 0xFF, 0x02, 0x5D,
+  0xEF, 0xFF, 0x1C, 0xE7, 0xDC, 0xFB, 0xDE, 0x25, 0x86, 0x00, 0x00, 0x00, 0x87,
+  0x00, 0x00, 0x00, 0x04, 0xFB, 0xDE, 0x1D, 0x1C, 0xE7, 0xCF, 0x3C, 0xE7, 0xFF,
+  0x5D, 0xEF, 0xFF, 0x7D, 0xEF, 0xFF, 0x82, 0x9E, 0xF7, 0xFF, 0x85, 0xBE, 0xF7,
+  0xFF, 0x82, 0x9E, 0xF7, 0xFF, 0x81, 0x5D, 0xEF, 0xFF, 0x01, 0x3C, 0xE7, 0xFE,
+  0x1C, 0xE7, 0x57, 0x87, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x03, 0x1C,
+  0xE7, 0x5B, 0x1C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x5D, 0xEF, 0xFF, 0x81, 0x7D,
+  0xEF, 0xFF, 0x82, 0x9E, 0xF7, 0xFF, 0x82, 0xBE, 0xF7, 0xFF, 0x81, 0x9E, 0xF7,
+  0xFF, 0x00, 0x7D, 0xEF, 0xFF, 0x81, 0x5D, 0xEF, 0xFF, 0x02, 0x3C, 0xE7, 0xFF,
+  0x1C, 0xE7, 0xC2, 0xFB, 0xDE, 0x13, 0x87, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+  0x00, 0x01, 0xFB, 0xDE, 0x04, 0x1C, 0xE7, 0xD2, 0x81, 0x3C, 0xE7, 0xFF, 0x00,
+  0x5D, 0xEF, 0xFF, 0x82, 0x7D, 0xEF, 0xFF, 0x84, 0x9E, 0xF7, 0xFF, 0x81, 0x7D,
+  0xEF, 0xFF, 0x03, 0x5C, 0xE7, 0xFF, 0x3C, 0xE7, 0xFF, 0x1C, 0xE7, 0xFF, 0x1C,
+  0xE7, 0x65, 0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x02, 0xFB, 0xDE,
+  0x00, 0xFB, 0xDE, 0x6F, 0x1C, 0xE7, 0xFB, 0x81, 0x3C, 0xE7, 0xFF, 0x00, 0x5D,
+  0xEF, 0xFF, 0x82, 0x7D, 0xEF, 0xFF, 0x82, 0x9E, 0xF7, 0xFF, 0x00, 0x7D, 0xEF,
+  0xFF, 0x81, 0x5D, 0xEF, 0xFF, 0x81, 0x3C, 0xE7, 0xFF, 0x01, 0xFB, 0xDE, 0xFA,
+  0x1C, 0xE7, 0x09, 0x88, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x01, 0xFB,
+  0xDE, 0x33, 0x1C, 0xE7, 0xE8, 0x81, 0x1C, 0xE7, 0xFF, 0x00, 0x3C, 0xE7, 0xFF,
+  0x81, 0x5D, 0xEF, 0xFF, 0x83, 0x7D, 0xEF, 0xFF, 0x81, 0x5D, 0xEF, 0xFF, 0x81,
+  0x3C, 0xE7, 0xFF, 0x02, 0x1C, 0xE7, 0xFF, 0xFB, 0xDE, 0xC7, 0xDB, 0xDE, 0x03,
+  0x88, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x02, 0xFB, 0xDE, 0x04, 0xFB,
+  0xDE, 0xA6, 0x1C, 0xE7, 0xFF, 0x82, 0x3C, 0xE7, 0xFF, 0x85, 0x5D, 0xEF, 0xFF,
+  0x82, 0x3C, 0xE7, 0xFF, 0x02, 0xFB, 0xDE, 0xFE, 0x1C, 0xE7, 0x7B, 0xBA, 0xD6,
+  0x00, 0x88, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x01, 0xFB, 0xDE, 0x70,
+  0xFB, 0xDE, 0xF7, 0x81, 0x1C, 0xE7, 0xFF, 0x82, 0x3C, 0xE7, 0xFF, 0x81, 0x5D,
+  0xEF, 0xFF, 0x82, 0x3C, 0xE7, 0xFF, 0x81, 0x1C, 0xE7, 0xFF, 0x02, 0xFB, 0xDE,
+  0xF0, 0xFB, 0xDE, 0x45, 0xFF, 0xFF, 0x00, 0x88, 0x00, 0x00, 0x00, 0x8A, 0x00,
+  0x00, 0x00, 0x01, 0xFB, 0xDE, 0x23, 0xFB, 0xDE, 0xCC, 0x83, 0x1C, 0xE7, 0xFF,
+  0x83, 0x3C, 0xE7, 0xFF, 0x82, 0x1C, 0xE7, 0xFF, 0x02, 0xFB, 0xDE, 0xFD, 0xDB,
+  0xDE, 0xB4, 0xFB, 0xDE, 0x0B, 0x89, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00,
+  0x02, 0xDB, 0xDE, 0x06, 0xDB, 0xDE, 0x5F, 0xFB, 0xDE, 0xEA, 0x82, 0xFB, 0xDE,
+  0xFF, 0x83, 0x1C, 0xE7, 0xFF, 0x81, 0xFB, 0xDE, 0xFF, 0x02, 0xDB, 0xDE, 0xFF,
+  0xFB, 0xDE, 0xDB, 0xBA, 0xD6, 0x49, 0x8A, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00,
+  0x00, 0x03, 0xFB, 0xDE, 0x18, 0xFB, 0xDE, 0x7A, 0xFB, 0xDE, 0xDD, 0xFB, 0xDE,
+  0xF9, 0x85, 0xFB, 0xDE, 0xFF, 0x03, 0xFB, 0xDE, 0xF2, 0xFB, 0xDE, 0xC7, 0xFB,
+  0xDE, 0x52, 0xFB, 0xDE, 0x04, 0x8A, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00,
+  0x0C, 0x1C, 0xE7, 0x02, 0xDB, 0xDE, 0x29, 0xFB, 0xDE, 0x68, 0x1C, 0xE7, 0x95,
+  0x3C, 0xE7, 0xB8, 0x5C, 0xE7, 0xD1, 0x5C, 0xE7, 0xDD, 0x5D, 0xEF, 0xE1, 0x5C,
+  0xE7, 0xE0, 0x5C, 0xE7, 0xD3, 0x3C, 0xE7, 0xA4, 0x3C, 0xE7, 0x55, 0x7D, 0xEF,
+  0x06, 0x8B, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x0C, 0xEB, 0x5A, 0x03,
+  0x0C, 0x63, 0x51, 0x4D, 0x6B, 0x99, 0x6D, 0x6B, 0xAA, 0x6D, 0x6B, 0xB1, 0x6D,
+  0x6B, 0xB6, 0x6D, 0x6B, 0xB8, 0x6D, 0x6B, 0xBA, 0x6D, 0x6B, 0xB9, 0x6D, 0x6B,
+  0xB6, 0x6D, 0x6B, 0xAE, 0xAE, 0x73, 0x5C, 0x92, 0x94, 0x02, 0x8B, 0x00, 0x00,
+  0x00, 0x8B, 0x00, 0x00, 0x00, 0x04, 0x2C, 0x63, 0x03, 0x8E, 0x73, 0x62, 0xAE,
+  0x73, 0xDE, 0xAE, 0x73, 0xF1, 0x8E, 0x73, 0xFA, 0x82, 0x8E, 0x73, 0xFE, 0x04,
+  0xAE, 0x73, 0xFC, 0x8E, 0x73, 0xEE, 0x8E, 0x73, 0xC5, 0x8E, 0x73, 0x56, 0x92,
+  0x94, 0x02, 0x8B, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x02, 0xB6, 0xB5,
+  0x00, 0xD3, 0x9C, 0x44, 0xD3, 0x9C, 0xE1, 0x86, 0xD3, 0x9C, 0xFF, 0x02, 0xD3,
+  0x9C, 0xD0, 0xB2, 0x94, 0x42, 0x95, 0xAD, 0x01, 0x8B, 0x00, 0x00, 0x00, 0x8C,
+  0x00, 0x00, 0x00, 0x01, 0x89, 0x4A, 0x40, 0x69, 0x4A, 0xE1, 0x83, 0x69, 0x4A,
+  0xFF, 0x81, 0x89, 0x4A, 0xFF, 0x03, 0x69, 0x4A, 0xFF, 0x69, 0x4A, 0xDC, 0xCB,
+  0x5A, 0x60, 0x50, 0x84, 0x02, 0x8B, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00,
+  0x02, 0xB2, 0x94, 0x11, 0x55, 0xAD, 0x8F, 0x75, 0xAD, 0xF4, 0x82, 0x75, 0xAD,
+  0xFF, 0x04, 0x76, 0xB5, 0xFF, 0x75, 0xAD, 0xFF, 0x96, 0xB5, 0xFF, 0x75, 0xAD,
+  0xB3, 0x75, 0xAD, 0x24, 0x8C, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x03,
+  0xDB, 0xDE, 0x00, 0xEB, 0x5A, 0x82, 0x0C, 0x63, 0xE0, 0x0C, 0x63, 0xFD, 0x82,
+  0x0C, 0x63, 0xFF, 0x03, 0xEB, 0x5A, 0xFF, 0xEB, 0x5A, 0xEF, 0xEB, 0x5A, 0xBB,
+  0xAE, 0x73, 0x30, 0x8C, 0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x09, 0x51,
+  0x8C, 0x5F, 0x71, 0x8C, 0xA9, 0x92, 0x94, 0xDF, 0x92, 0x94, 0xEE, 0x91, 0x8C,
+  0xEE, 0x72, 0x94, 0xEB, 0x92, 0x94, 0xDF, 0x92, 0x94, 0xB8, 0x51, 0x8C, 0x77,
+  0xEF, 0x7B, 0x14, 0x8C, 0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x08, 0xEF,
+  0x7B, 0x2E, 0xEF, 0x7B, 0x7C, 0xEF, 0x7B, 0x9E, 0xCF, 0x7B, 0xAD, 0xCF, 0x7B,
+  0xB0, 0xAE, 0x73, 0xB1, 0x10, 0x84, 0xB6, 0xEF, 0x7B, 0xA1, 0xB2, 0x94, 0x45,
+  0x8D, 0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x08, 0x6D, 0x6B, 0x20, 0xEB,
+  0x5A, 0x8C, 0xCB, 0x5A, 0xBB, 0x69, 0x4A, 0xCE, 0x69, 0x4A, 0xD3, 0x8A, 0x52,
+  0xD3, 0xCB, 0x5A, 0xC5, 0x8E, 0x73, 0x8B, 0x14, 0xA5, 0x25, 0x8D, 0x00, 0x00,
+  0x00, 0x8D, 0x00, 0x00, 0x00, 0x08, 0x59, 0xCE, 0x04, 0xB2, 0x94, 0x19, 0xCF,
+  0x7B, 0x32, 0x10, 0x84, 0x4E, 0xEF, 0x7B, 0x52, 0x10, 0x84, 0x46, 0x92, 0x94,
+  0x2E, 0x59, 0xCE, 0x11, 0x9E, 0xF7, 0x02, 0x8D, 0x00, 0x00, 0x00, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x82, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF,
+  0x00, 0x8E, 0x00, 0x00, 0x00,
 };
 const lv_img_dsc_t ui_img_light_off_icon_png = {
   .header.always_zero = 0,
-  .header.w = 63,
-  .header.h = 80,
+  .header.w = 37,
+  .header.h = 47,
   .data_size = sizeof(ui_img_light_off_icon_png_data),
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = ui_img_light_off_icon_png_data
 };
@@ -10,957 +10,251 @@
 #endif
 
 // IMAGE DATA: assets\light_on_icon_1.png
+// Scaled to zoom 150 from 53x76 by tools/img_rle_convert.py
+// RLE encoded by tools/img_rle_convert.py, 4185 bytes raw
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_light_on_icon_1_png_data[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x97, 0xFF, 0x13, 0x75, 0xFF, 0x59, 0x52, 0xFF, 0x91, 0x51, 0xFF, 0xA0,
-  0x2F, 0xF7, 0xBF, 0x2E, 0xF7, 0xD4, 0x0D, 0xEF, 0xD8, 0xED, 0xEE, 0xD9, 0x0D,
-  0xEF, 0xD3, 0x2E, 0xF7, 0xC3, 0x70, 0xF7, 0xAA, 0x51, 0xFF, 0x7A, 0xB4, 0xFF,
-  0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFF, 0x2B, 0x70, 0xFF,
-  0x83, 0xEB, 0xF6, 0xBF, 0xA8, 0xF6, 0xE4, 0x86, 0xEE, 0xFF,
-  0x85, 0xF6, 0xFF, 0xA6, 0xF6, 0xFF, 0xA6, 0xF6, 0xFF, 0xC6, 0xEE, 0xFF, 0xA6,
-  0xEE, 0xFF, 0xA5, 0xEE, 0xFF, 0xC5, 0xEE, 0xFF, 0xE5, 0xF6, 0xFF, 0xE6, 0xF6,
-  0xFF, 0xE7, 0xF6, 0xFF, 0xA7, 0xEE, 0xFF, 0xC9, 0xEE, 0xEA, 0x0C, 0xEF, 0xCC,
-  0x70, 0xF7, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xFF, 0x33, 0x10, 0xF7,
-  0x83, 0xCC, 0xF6, 0xBB, 0x87, 0xEE, 0xF4, 0xA5, 0xF6, 0xFF, 0xC3, 0xFE, 0xFF,
-  0xE2, 0xFE, 0xFF, 0xC2, 0xFE, 0xFF, 0xE2, 0xFE, 0xFF, 0xC2, 0xF6, 0xFF, 0xC3,
-  0xF6, 0xFF, 0xE3, 0xF6, 0xFF, 0xE3, 0xF6, 0xFF, 0xE2, 0xF6, 0xFF, 0xC2, 0xFE,
-  0xFF, 0xC2, 0xFE, 0xFF, 0xA2, 0xF6, 0xFF, 0xE3, 0xF6, 0xFF,
-  0xC4, 0xEE, 0xFF, 0xA5, 0xEE, 0xFF, 0xC8, 0xEE, 0xF5, 0x0D, 0xEF, 0xCA, 0x91,
-  0xFF, 0x8E, 0xF6, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0x22, 0x6E, 0xF7,
-  0x80, 0xE8, 0xEE, 0xD2, 0xC5, 0xEE, 0xFF, 0xA3, 0xEE, 0xFF, 0xC3, 0xF6, 0xFF,
-  0xE4, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xC3, 0xFE, 0xFF, 0xC3, 0xF6, 0xFF, 0xC3,
-  0xF6, 0xFF, 0xE3, 0xFE, 0xFF, 0xE3, 0xF6, 0xFF, 0xE3, 0xF6, 0xFF, 0xE3, 0xFE,
-  0xFF, 0xC3, 0xFE, 0xFF, 0xC3, 0xFE, 0xFF, 0xA3, 0xFE, 0xFF, 0xC3, 0xFE, 0xFF,
-  0xE2, 0xFE, 0xFF, 0xE3, 0xF6, 0xFF, 0xC5, 0xF6, 0xFF, 0x85, 0xEE, 0xFF, 0x84,
-  0xE6, 0xFF, 0xC5, 0xE6, 0xF9, 0x28, 0xEF, 0xCA, 0x6D, 0xF7, 0x7F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFF,
-  0x57, 0xEC, 0xF6, 0xAE, 0xE6, 0xEE, 0xF4, 0xE3, 0xE6, 0xF8, 0x02, 0xF7, 0xFC,
-  0xC2, 0xF6, 0xFF, 0xC4, 0xEE, 0xFF, 0xC6, 0xEE, 0xFF, 0xC8, 0xEE, 0xFF, 0xC9,
-  0xEE, 0xFF, 0xCA, 0xEE, 0xFF, 0xE9, 0xEE, 0xFF, 0x08, 0xF7, 0xFF, 0xE6, 0xF6,
-  0xFF, 0xE4, 0xF6, 0xFF, 0xE4, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xC4, 0xFE, 0xFF,
-  0xC4, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE2, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE4,
-  0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE2, 0xF6, 0xFF, 0xE2, 0xF6, 0xFF, 0x02, 0xF7,
-  0xFF, 0x26, 0xEF, 0xE8, 0x0B, 0xEF, 0xB1, 0x93, 0xFF, 0x55, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
-  0x18, 0x50, 0xFF, 0x80, 0xC8, 0xEE, 0xDE, 0x83, 0xE6, 0xF3, 0xC3, 0xEE, 0xF3,
-  0x04, 0xF7, 0xF8, 0xA5, 0xEE, 0xFF, 0xC8, 0xEE, 0xFD, 0x0D, 0xF7, 0xE0, 0x51,
-  0xF7, 0xA9, 0xB4, 0xFF, 0x8D, 0xF7, 0xFF, 0x7A, 0xD8, 0xFF, 0x7B, 0xD7, 0xFF,
-  0x75, 0x52, 0xF7, 0xB2, 0x2D, 0xF7, 0xDF, 0x08, 0xF7, 0xFF, 0xE5, 0xF6, 0xFF,
-  0xE4, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE4, 0xF6, 0xFF, 0xE4,
-  0xF6, 0xFF, 0xE3, 0xF6, 0xFF, 0xC3, 0xF6, 0xFF, 0xC3, 0xFE, 0xFF, 0xE3, 0xFE,
-  0xFF, 0xC3, 0xFE, 0xFF, 0xA2, 0xF6, 0xFF, 0x82, 0xEE, 0xFF, 0xA3, 0xEE, 0xFE,
-  0xE8, 0xEE, 0xD2, 0x6F, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFF,
-  0x27, 0x2F, 0xF7, 0x99, 0xC8, 0xEE, 0xE7, 0xC3, 0xEE, 0xEE,
-  0xE3, 0xF6, 0xF1, 0xE5, 0xEE, 0xF1, 0xC7, 0xEE, 0xE2, 0x2D, 0xFF, 0xBC, 0xB2,
-  0xFF, 0x89, 0xF7, 0xFF, 0x54, 0xFA, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x2A, 0xB2, 0xFF, 0x97,
-  0x2A, 0xFF, 0xFF, 0xE6, 0xF6, 0xFF, 0xE5, 0xF6, 0xFF, 0xE5, 0xF6, 0xFF, 0x05,
-  0xF7, 0xFF, 0x05, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x03, 0xFF,
-  0xFF, 0xE3, 0xFE, 0xFF, 0xC4, 0xFE, 0xFF, 0xC4, 0xFE, 0xFF, 0xC3, 0xFE, 0xFF,
-  0xE3, 0xFE, 0xFF, 0x01, 0xFF, 0xFF, 0xA2, 0xEE, 0xFF, 0xA7, 0xE6, 0xE4, 0x4F,
-  0xF7, 0x82, 0xB7, 0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xF7, 0xFF, 0x21, 0xED, 0xEE, 0x8E, 0xC6, 0xE6, 0xE2, 0xE4, 0xF6, 0xF4,
-  0xC3, 0xEE, 0xF3, 0xA5, 0xEE, 0xEB, 0x0D, 0xF7, 0xD4, 0x73, 0xFF, 0x9E, 0xD8,
-  0xFF, 0x6E, 0xFA, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x09, 0xFC, 0xFF, 0x4C,
-  0xF9, 0xFF, 0x3B, 0x92, 0xFF, 0xA5, 0x0B, 0xFF, 0xFF, 0xE7, 0xF6, 0xFF, 0xE6,
-  0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0x05, 0xF7, 0xFF, 0x05, 0xFF,
-  0xFF, 0x04, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xE4, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF,
-  0xC4, 0xFE, 0xFF, 0xC4, 0xFE, 0xFF, 0xC3, 0xFE, 0xFF, 0xA1, 0xFE, 0xFF, 0xE2,
-  0xFE, 0xFF, 0xE4, 0xF6, 0xFF, 0xA7, 0xE6, 0xD6, 0x0E, 0xEF, 0x79, 0xF5, 0xFF,
-  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x0E, 0xEF, 0xAC, 0xE8, 0xEE, 0xE2,
-  0xC4, 0xEE, 0xE8, 0xA3, 0xEE, 0xEA, 0xE7, 0xF6, 0xF0, 0x4D, 0xFF, 0xC1, 0xB5,
-  0xFF, 0x7C, 0xFA, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x2F, 0xFC, 0xFF, 0x47, 0xFB, 0xFF, 0x3F,
-  0xF8, 0xFF, 0x4E, 0x94, 0xFF, 0xA2, 0x4F, 0xFF, 0xE3, 0xE9, 0xFE, 0xFF, 0xE7,
-  0xFE, 0xFF, 0xE7, 0xFE, 0xFF, 0xE7, 0xFE, 0xFF, 0xE7, 0xFE, 0xFF, 0x06, 0xFF,
-  0xFF, 0x05, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0x05, 0xFF, 0xFF,
-  0x05, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xE4, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xC4,
-  0xFE, 0xFF, 0xC2, 0xFE, 0xFF, 0xC2, 0xFE, 0xFF, 0xC2, 0xF6, 0xFF, 0xA3, 0xEE,
-  0xFF, 0xC8, 0xEE, 0xD5, 0x4F, 0xF7, 0x7C, 0xF8, 0xFF, 0x09, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFF, 0x1D, 0x2E, 0xF7, 0x7D,
-  0xA6, 0xEE, 0xE2, 0xE4, 0xF6, 0xF1, 0xC4, 0xEE, 0xF1, 0xA7, 0xEE, 0xFA, 0x30,
-  0xFF, 0xB0, 0xD7, 0xFF, 0x7B, 0xFC, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x41, 0xFC, 0xFF, 0x35, 0xD9, 0xFF, 0x3E,
-  0xD6, 0xFF, 0x86, 0x93, 0xFF, 0xC2, 0x4F, 0xFF, 0xF9, 0x2D, 0xFF, 0xFF, 0x0A,
-  0xF7, 0xFF, 0xE8, 0xF6, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF,
-  0xFF, 0xE7, 0xFE, 0xFF, 0xE7, 0xFE, 0xFF, 0x06, 0xFF, 0xFF, 0x06, 0xFF, 0xFF,
-  0x06, 0xFF, 0xFF, 0x05, 0xF7, 0xFF, 0x05, 0xF7, 0xFF, 0x05, 0xF7, 0xFF, 0xE4,
-  0xF6, 0xFF, 0xE4, 0xF6, 0xFF, 0x03, 0xFF, 0xFF, 0xE2, 0xFE, 0xFF, 0xC1, 0xF6,
-  0xFF, 0xC2, 0xF6, 0xFF, 0xC4, 0xEE, 0xEF, 0xC9, 0xEE, 0xE7,
-  0x50, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x50, 0xFF, 0x71, 0xA8, 0xEE, 0xD4, 0xC4, 0xF6, 0xED, 0xA3, 0xF6, 0xF1, 0xC7,
-  0xF6, 0xE7, 0x4E, 0xFF, 0xC5, 0xB8, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xFD, 0xFF, 0x46, 0xFA, 0xFF, 0x5D,
-  0xB7, 0xFF, 0xA5, 0x73, 0xF7, 0xDB, 0x2F, 0xF7, 0xFF, 0xEC, 0xF6, 0xFF, 0xCA,
-  0xF6, 0xFF, 0x09, 0xFF, 0xFF, 0xE8, 0xFE, 0xFF, 0x07, 0xFF, 0xFF, 0x08, 0xFF,
-  0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xE8, 0xFE, 0xFF, 0xE8, 0xFE, 0xFF,
-  0xE7, 0xFE, 0xFF, 0x07, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x06, 0xF7, 0xFF, 0x26,
-  0xF7, 0xFF, 0x05, 0xF7, 0xFF, 0x05, 0xF7, 0xFF, 0x04, 0xF7, 0xFF, 0x04, 0xFF,
-  0xFF, 0xE3, 0xFE, 0xFF, 0xE2, 0xFE, 0xFF, 0xE2, 0xFE, 0xFF, 0xC3, 0xF6, 0xFF,
-  0xA5, 0xEE, 0xF2, 0xE9, 0xF6, 0xC9, 0x70, 0xFF, 0x49, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x94, 0xFF, 0x4A, 0xEA, 0xF6, 0xB2, 0x85, 0xEE, 0xF6, 0xA5,
-  0xF6, 0xF3, 0x86, 0xEE, 0xED, 0x0D, 0xF7, 0xBF, 0xF6, 0xFF, 0x4A, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x0C, 0xFC, 0xFF, 0x23,
-  0xD8, 0xFF, 0x79, 0x93, 0xF7, 0xC7, 0x2F, 0xEF, 0xFF, 0x0B, 0xF7, 0xFF, 0xE9,
-  0xF6, 0xFF, 0xE9, 0xFE, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF,
-  0xFF, 0x09, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x08, 0xFF, 0xFF,
-  0xE9, 0xFE, 0xFF, 0xE9, 0xFE, 0xFF, 0xE8, 0xFE, 0xFF, 0x07, 0xFF, 0xFF, 0x07,
-  0xFF, 0xFF, 0x07, 0xF7, 0xFF, 0x07, 0xF7, 0xFF, 0x06, 0xF7, 0xFF, 0x05, 0xF7,
-  0xFF, 0x05, 0xF7, 0xFF, 0xE5, 0xF6, 0xFF, 0xC4, 0xF6, 0xFF, 0xC3, 0xFE, 0xFF,
-  0xE3, 0xFE, 0xFF, 0xE2, 0xF6, 0xFF, 0xC2, 0xF6, 0xFF, 0xC4, 0xF6, 0xF0, 0xE9,
-  0xEE, 0x9F, 0xD4, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0x90, 0xA6, 0xF6, 0xF5, 0xC4,
-  0xF6, 0xFF, 0xA5, 0xF6, 0xFB, 0xCA, 0xF6, 0xD0, 0x94, 0xFF, 0x98, 0xFF, 0xFF,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x05,
-  0xFA, 0xFF, 0x29, 0xD7, 0xFF, 0x8D, 0x71, 0xF7, 0xCF, 0x0C, 0xEF, 0xFF, 0x0A,
-  0xEF, 0xFF, 0x08, 0xF7, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x29, 0xFF,
-  0xFF, 0x09, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xF7, 0xFF,
-  0x29, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09,
-  0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xF7,
-  0xFF, 0x06, 0xF7, 0xFF, 0x06, 0xF7, 0xFF, 0xE6, 0xF6, 0xFF, 0xE5, 0xFE, 0xFF,
-  0xE5, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE2, 0xFE, 0xFF, 0xE2,
-  0xFE, 0xFF, 0xC2, 0xF6, 0xFF, 0xC5, 0xEE, 0xD2, 0x6F, 0xF7, 0x6B, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0x59, 0xE9,
-  0xEE, 0xCF, 0xA4, 0xEE, 0xFF, 0xE4, 0xF6, 0xFF, 0xC7, 0xF6, 0xFE, 0x6F, 0xFF,
-  0xA3, 0xF9, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFB, 0xFF, 0x3F, 0x97, 0xFF, 0x90, 0x2F, 0xF7, 0xE5, 0xEB, 0xF6, 0xFF, 0xE9,
-  0xF6, 0xFF, 0x08, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x08, 0xFF,
-  0xFF, 0x08, 0xF7, 0xFF, 0x29, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF,
-  0x2A, 0xF7, 0xFF, 0x2A, 0xF7, 0xFF, 0x29, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x29,
-  0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x28, 0xFF,
-  0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xE7, 0xFE, 0xFF,
-  0xE6, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0x05, 0xFF, 0xFF, 0xE4, 0xFE, 0xFF, 0xE4,
-  0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xC3, 0xFE, 0xFF, 0xC5, 0xEE,
-  0xEE, 0xCB, 0xDE, 0xBC, 0x93, 0xF7, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x2D, 0xF7, 0xB7, 0xA6, 0xE6, 0xFF, 0xC3, 0xF6, 0xFF, 0xE5, 0xF6,
-  0xFD, 0xEA, 0xF6, 0xD5, 0xB3, 0xFF, 0x7C, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x31, 0xB7, 0xFF, 0x8E, 0x31, 0xFF, 0xF2, 0xAB,
-  0xF6, 0xFF, 0xE9, 0xFE, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF,
-  0xFF, 0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x09, 0xF7, 0xFF,
-  0x2A, 0xF7, 0xFF, 0x2B, 0xF7, 0xFF, 0x2A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x29,
-  0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0x29, 0xF7,
-  0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
-  0x07, 0xFF, 0xFF, 0xE7, 0xFE, 0xFF, 0xE7, 0xFE, 0xFF, 0xC6, 0xFE, 0xFF, 0xE5,
-  0xFE, 0xFF, 0x05, 0xFF, 0xFF, 0xE4, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xC3, 0xF6,
-  0xFF, 0xC3, 0xF6, 0xFF, 0xC5, 0xF6, 0xFF, 0x65, 0xD6, 0xE4, 0x4E, 0xEF, 0x83,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xFF, 0x3A, 0xC9, 0xEE, 0xF7, 0xE5, 0xF6,
-  0xFF, 0xE3, 0xF6, 0xFF, 0xC6, 0xF6, 0xF6, 0xEF, 0xF6, 0xA1, 0xF8, 0xFF, 0x5E,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x25, 0xF9, 0xFF, 0x76, 0x71,
-  0xFF, 0xC8, 0xEB, 0xF6, 0xFF, 0x0A, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF,
-  0xFF, 0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF,
-  0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B,
-  0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF,
-  0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x08, 0xFF, 0xFF,
-  0x08, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xE7, 0xFE, 0xFF, 0xE7,
-  0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE4, 0xFE,
-  0xFF, 0xE3, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE3, 0xF6, 0xFF,
-  0xC3, 0xEE, 0xEE, 0x87, 0xE6, 0xCF, 0x54, 0xFF, 0x27, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF,
-  0x84, 0x86, 0xEE, 0xFF, 0xA3, 0xF6, 0xFF, 0xC2, 0xF6, 0xFF, 0xC7, 0xF6, 0xFF,
-  0x72, 0xFF, 0x7F, 0xFA, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x07, 0xFB,
-  0xFF, 0x37, 0x95, 0xF7, 0xB7, 0x0D, 0xF7, 0xFF, 0xC8, 0xFE, 0xFF, 0x09, 0xFF,
-  0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF,
-  0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B,
-  0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF,
-  0xFF, 0x2B, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF,
-  0x2A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08,
-  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xE6, 0xFE, 0xFF, 0xE6, 0xFE,
-  0xFF, 0xE5, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF,
-  0xE2, 0xFE, 0xFF, 0xE1, 0xF6, 0xFF, 0x44, 0xE6, 0xFC, 0xB0, 0xF6, 0x65, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFF,
-  0x30, 0xCC, 0xF6, 0xC0, 0x85, 0xEE, 0xFD, 0xC3, 0xF6, 0xFF,
-  0xE3, 0xFE, 0xFF, 0xC7, 0xF6, 0xE9, 0x93, 0xFF, 0x88, 0xFA, 0xFF, 0x0B, 0xFF,
-  0xFF, 0x05, 0xFC, 0xFF, 0x41, 0xF8, 0xFF, 0x96, 0x51, 0xF7, 0xEC, 0x0B, 0xFF,
-  0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF,
-  0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2B,
-  0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF,
-  0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF,
-  0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x29,
-  0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x07, 0xFF,
-  0xFF, 0x07, 0xFF, 0xFF, 0xE6, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF,
-  0xE4, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE2, 0xFE, 0xFF, 0xE2, 0xFE, 0xFF, 0x23,
-  0xE6, 0xE2, 0x0C, 0xE6, 0xB2, 0xD9, 0xFF, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x92, 0xFF, 0x6C, 0xC9, 0xF6, 0xFA, 0xE5, 0xFE, 0xFF,
-  0xE3, 0xFE, 0xFF, 0xE4, 0xF6, 0xFF, 0xC7, 0xEE, 0xFF, 0x71, 0xFF, 0x9B, 0xF8,
-  0xFF, 0x48, 0xFA, 0xFF, 0x26, 0xD8, 0xFF, 0x7E, 0x72, 0xF7, 0xE4, 0x0D, 0xEF,
-  0xFF, 0x0A, 0xFF, 0xFF, 0xE8, 0xFE, 0xFF, 0x09, 0xFF, 0xFF,
-  0x09, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A,
-  0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF,
-  0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF,
-  0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A,
-  0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x08, 0xFF,
-  0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x06, 0xFF, 0xFF,
-  0xE6, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE3,
-  0xFE, 0xFF, 0xE2, 0xFE, 0xFF, 0x23, 0xEE, 0xFD, 0xA8, 0xD5, 0xCF, 0x76, 0xFF,
-  0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x8B,
-  0xA6, 0xEE, 0xFF, 0xE4, 0xF6, 0xFF, 0xC2, 0xF6, 0xFF, 0xC3, 0xEE, 0xFF, 0xC7,
-  0xEE, 0xFF, 0x0D, 0xF7, 0xB9, 0xB2, 0xFF, 0x92, 0xD2, 0xFF, 0x93, 0x70, 0xF7,
-  0xBA, 0x2B, 0xEF, 0xFF, 0x09, 0xF7, 0xFF, 0x09, 0xFF, 0xFF, 0xE9, 0xFE, 0xFF,
-  0x09, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2B,
-  0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF,
-  0xFF, 0x4C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF,
-  0x2C, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B,
-  0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x29, 0xFF,
-  0xFF, 0x29, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF,
-  0x07, 0xFF, 0xFF, 0xE7, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0xE4,
-  0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0x43, 0xEE,
-  0xFF, 0x87, 0xD5, 0xE6, 0x32, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x0E,
-  0xF9, 0xFF, 0x14, 0x4D, 0xFF, 0xB0, 0xA5, 0xEE, 0xFF, 0xC4, 0xF6, 0xFF, 0xC5,
-  0xEE, 0xFF, 0x28, 0xF7, 0xFF, 0x6C, 0xF7, 0xFF, 0x0D, 0xEF, 0xFF, 0x0E, 0xEF,
-  0xFF, 0x0C, 0xEF, 0xFF, 0x0A, 0xEF, 0xFF, 0x28, 0xF7, 0xFF, 0x28, 0xF7, 0xFF,
-  0x29, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A,
-  0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF,
-  0xFF, 0x2C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF,
-  0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2B,
-  0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF,
-  0xFF, 0x2A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x09, 0xFF, 0xFF,
-  0x29, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x06,
-  0xFF, 0xFF, 0xE5, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xC3, 0xFE,
-  0xFF, 0xC3, 0xFE, 0xFF, 0x43, 0xF6, 0xFF, 0xC5, 0xDD, 0xFD, 0xCE, 0xF6, 0x9C,
-  0x00, 0x00, 0x00, 0xFB, 0xFF, 0x28, 0xF7, 0xFF, 0x3C, 0x0B, 0xF7, 0xC1, 0xA6,
-  0xEE, 0xFF, 0xC7, 0xEE, 0xFF, 0x4C, 0xFF, 0xBE, 0xD2, 0xFF, 0x8B, 0xF5, 0xFF,
-  0x65, 0xB4, 0xFF, 0x82, 0x51, 0xF7, 0xDB, 0xEB, 0xE6, 0xFF, 0x08, 0xEF, 0xFF,
-  0x28, 0xF7, 0xFF, 0x08, 0xF7, 0xFF, 0x29, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x2A,
-  0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF,
-  0xFF, 0x2B, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF,
-  0x4C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x4C,
-  0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF,
-  0xFF, 0x2B, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF,
-  0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x07,
-  0xFF, 0xFF, 0xE6, 0xFE, 0xFF, 0x06, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xE5, 0xFE,
-  0xFF, 0xE4, 0xFE, 0xFF, 0xC3, 0xFE, 0xFF, 0x02, 0xF6, 0xFF,
-  0xE4, 0xE5, 0xFF, 0x6B, 0xEE, 0xAE, 0xF6, 0xFF, 0x0A, 0xFA, 0xFF, 0x29, 0xF6,
-  0xFF, 0x59, 0xEB, 0xEE, 0xD5, 0x87, 0xE6, 0xFF, 0xEA, 0xEE, 0xFF, 0xB1, 0xFF,
-  0x98, 0xF9, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x38, 0xB4, 0xFF, 0xBB,
-  0x2C, 0xF7, 0xFF, 0x08, 0xEF, 0xFF, 0x08, 0xF7, 0xFF, 0x28, 0xF7, 0xFF, 0x49,
-  0xFF, 0xFF, 0x29, 0xF7, 0xFF, 0x2A, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF,
-  0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF,
-  0x2C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x4C,
-  0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF,
-  0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF,
-  0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x09,
-  0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xE6, 0xFE,
-  0xFF, 0x05, 0xFF, 0xFF, 0xE5, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xC4, 0xFE, 0xFF,
-  0xE1, 0xED, 0xFF, 0xE3, 0xED, 0xFF, 0x48, 0xE6, 0xC2, 0xF6, 0xFF, 0x25, 0xF8,
-  0xFF, 0x1B, 0xF5, 0xFF, 0x58, 0xCA, 0xE6, 0xCF, 0xA8, 0xE6, 0xFF, 0xEA, 0xEE,
-  0xF2, 0xD3, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFC, 0xFF, 0x5A, 0x76, 0xFF, 0xB4, 0x0D, 0xF7, 0xF1, 0xE9, 0xF6, 0xFF, 0x0A,
-  0xF7, 0xFF, 0x2A, 0xFF, 0xFF, 0x49, 0xF7, 0xFF, 0x28, 0xF7, 0xFF, 0x4A, 0xFF,
-  0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF,
-  0x4C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x4D, 0xFF, 0xFF, 0x4D,
-  0xFF, 0xFF, 0x4D, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x2C, 0xFF,
-  0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF,
-  0x4B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A,
-  0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF,
-  0xFF, 0x07, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x05, 0xFF, 0xFF,
-  0xC4, 0xFE, 0xFF, 0xA3, 0xFE, 0xFF, 0xE1, 0xF5, 0xFF, 0xE2, 0xED, 0xFF, 0x27,
-  0xE6, 0xCD, 0xF5, 0xFF, 0x2A, 0xF9, 0xFF, 0x2F, 0xF6, 0xFF, 0x7E, 0xCA, 0xE6,
-  0xE6, 0xA7, 0xEE, 0xFF, 0xE9, 0xEE, 0xFF, 0xB0, 0xFF, 0xAA, 0xF8, 0xFF, 0x42,
-  0xFA, 0xFF, 0x26, 0xF9, 0xFF, 0x24, 0x74, 0xFF, 0xC5, 0x0C, 0xFF, 0xFF, 0xE9,
-  0xF6, 0xFF, 0xEA, 0xFE, 0xFF, 0x2A, 0xFF, 0xFF, 0x48, 0xFF, 0xFF, 0x48, 0xFF,
-  0xFF, 0x2A, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF,
-  0x2B, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C,
-  0xFF, 0xFF, 0x4D, 0xFF, 0xFF, 0x4D, 0xFF, 0xFF, 0x4D, 0xFF, 0xFF, 0x4D, 0xFF,
-  0xFF, 0x4C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF,
-  0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B,
-  0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x29, 0xFF,
-  0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x06, 0xFF, 0xFF,
-  0x06, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xC4, 0xFE, 0xFF, 0x63, 0xFE, 0xFF, 0xE1,
-  0xF5, 0xFF, 0x02, 0xEE, 0xFF, 0x27, 0xE6, 0xD6, 0xF5, 0xFF, 0x32, 0xFB, 0xFF,
-  0x27, 0xF7, 0xFF, 0x7F, 0xC9, 0xEE, 0xEF, 0xC6, 0xEE, 0xFF, 0xC6, 0xF6, 0xFF,
-  0x2A, 0xF7, 0xDE, 0xB0, 0xFF, 0xB9, 0xB2, 0xFF, 0x97, 0x91, 0xFF, 0xAE, 0x4E,
-  0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0xE8, 0xFE, 0xFF, 0xE9, 0xFE, 0xFF, 0x0A, 0xFF,
-  0xFF, 0x29, 0xFF, 0xFF, 0x49, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF,
-  0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C,
-  0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x4D, 0xFF, 0xFF, 0x4D, 0xFF, 0xFF, 0x4D, 0xFF,
-  0xFF, 0x4D, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF,
-  0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C,
-  0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF,
-  0xFF, 0x2A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x08, 0xFF, 0xFF,
-  0x07, 0xFF, 0xFF, 0xE6, 0xFE, 0xFF, 0x06, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xC4,
-  0xFE, 0xFF, 0x42, 0xFE, 0xFF, 0xC1, 0xF5, 0xFF, 0xE3, 0xED, 0xFF, 0x27, 0xE6,
-  0xD9, 0xF5, 0xFF, 0x32, 0xFC, 0xFF, 0x2C, 0xF7, 0xFF, 0x73, 0xA9, 0xEE, 0xE4,
-  0xC5, 0xF6, 0xFF, 0xC4, 0xF6, 0xFF, 0xC5, 0xEE, 0xFF, 0x29, 0xF7, 0xFF, 0x0A,
-  0xF7, 0xFF, 0x0A, 0xF7, 0xFF, 0x09, 0xF7, 0xFF, 0xE7, 0xFE, 0xFF, 0xE7, 0xFE,
-  0xFF, 0xE9, 0xFE, 0xFF, 0x0A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF,
-  0x2A, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2C,
-  0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x4D, 0xFF,
-  0xFF, 0x4D, 0xFF, 0xFF, 0x4D, 0xFF, 0xFF, 0x4D, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF,
-  0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C,
-  0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2A, 0xFF,
-  0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x09, 0xFF, 0xFF,
-  0x09, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xE6, 0xFE, 0xFF, 0x06,
-  0xFF, 0xFF, 0xE5, 0xFE, 0xFF, 0xA4, 0xFE, 0xFF, 0x01, 0xF6, 0xFF, 0xC1, 0xF5,
-  0xFF, 0xE3, 0xED, 0xFF, 0x28, 0xE6, 0xD5, 0xF7, 0xFF, 0x25, 0xFD, 0xFF, 0x35,
-  0xD8, 0xFF, 0x69, 0xCA, 0xEE, 0xE5, 0xC5, 0xF6, 0xFF, 0xE4, 0xFE, 0xFF, 0xC4,
-  0xF6, 0xFF, 0xE6, 0xF6, 0xFF, 0xE6, 0xEE, 0xFF, 0x06, 0xF7, 0xFF, 0x06, 0xFF,
-  0xFF, 0x06, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF,
-  0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B,
-  0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF,
-  0xFF, 0x2C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF,
-  0x4C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C,
-  0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2B, 0xFF,
-  0xFF, 0x2B, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF,
-  0x09, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xE6,
-  0xFE, 0xFF, 0x06, 0xFF, 0xFF, 0xE5, 0xFE, 0xFF, 0x83, 0xFE, 0xFF, 0xE0, 0xF5,
-  0xFF, 0xC1, 0xF5, 0xFF, 0xC4, 0xED, 0xFF, 0x4A, 0xE6, 0xD2,
-  0xF7, 0xFF, 0x1E, 0xFE, 0xFF, 0x26, 0xD8, 0xFF, 0x3B, 0x0B, 0xF7, 0xD0, 0xC5,
-  0xF6, 0xFF, 0xE4, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0x05, 0xF7, 0xFF, 0xE5, 0xF6,
-  0xFF, 0x05, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
-  0x09, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A,
-  0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF,
-  0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF,
-  0x4C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C,
-  0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF,
-  0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF,
-  0x2A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08,
-  0xFF, 0xFF, 0xE7, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0xC4, 0xFE,
-  0xFF, 0x62, 0xF6, 0xFF, 0xE0, 0xF5, 0xFF, 0xE1, 0xED, 0xFF, 0xC5, 0xE5, 0xFF,
-  0x8D, 0xF6, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x13, 0xFA, 0xFF, 0x22, 0x8E,
-  0xFF, 0xC7, 0xC5, 0xF6, 0xFF, 0xC3, 0xF6, 0xFF, 0xE3, 0xFE, 0xFF, 0xE4, 0xF6,
-  0xFF, 0xE5, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF,
-  0x06, 0xFF, 0xFF, 0xE7, 0xFE, 0xFF, 0x09, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0x29,
-  0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF,
-  0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF,
-  0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C,
-  0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF,
-  0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF,
-  0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x09,
-  0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xE7, 0xFE, 0xFF, 0xE6, 0xFE,
-  0xFF, 0xE5, 0xFE, 0xFF, 0xA4, 0xF6, 0xFF, 0x01, 0xEE, 0xFF, 0xE0, 0xF5, 0xFF,
-  0xC1, 0xED, 0xFF, 0xC5, 0xE5, 0xFF, 0x10, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0x9B, 0xC7, 0xEE, 0xFC, 0xA3, 0xF6,
-  0xFF, 0xE3, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0x05, 0xFF, 0xFF, 0xE5, 0xFE, 0xFF,
-  0x06, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x09, 0xF7, 0xFF, 0x2A,
-  0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF,
-  0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF,
-  0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C,
-  0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x2C, 0xFF,
-  0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF,
-  0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A,
-  0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF,
-  0xFF, 0x07, 0xFF, 0xFF, 0xE6, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0x83, 0xF6, 0xFF,
-  0xE0, 0xED, 0xFF, 0xE0, 0xF5, 0xFF, 0xE2, 0xED, 0xFF, 0xC7, 0xE5, 0xF6, 0x53,
-  0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0xD5, 0xFF,
-  0x75, 0xCB, 0xEE, 0xC2, 0xC6, 0xF6, 0xFF, 0xE3, 0xFE, 0xFF, 0xC2, 0xFE, 0xFF,
-  0xE3, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0x06, 0xF7, 0xFF, 0x07,
-  0xF7, 0xFF, 0x08, 0xF7, 0xFF, 0x08, 0xF7, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF,
-  0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF,
-  0x2B, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x2C,
-  0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF,
-  0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF,
-  0x2C, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2A,
-  0xF7, 0xFF, 0x2A, 0xF7, 0xFF, 0x29, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x08, 0xFF,
-  0xFF, 0x28, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x06, 0xFF, 0xFF,
-  0x84, 0xFE, 0xFF, 0x01, 0xEE, 0xFF, 0xE1, 0xF5, 0xFF, 0xE0, 0xF5, 0xFF, 0xC3,
-  0xE5, 0xFF, 0x4C, 0xEE, 0xC6, 0xD7, 0xFF, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x35, 0x30, 0xF7, 0x9C, 0xA7, 0xEE, 0xFF,
-  0xC4, 0xF6, 0xFF, 0xE2, 0xFE, 0xFF, 0xE2, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE6,
-  0xFE, 0xFF, 0x06, 0xF7, 0xFF, 0x06, 0xF7, 0xFF, 0x07, 0xF7, 0xFF, 0x08, 0xFF,
-  0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF,
-  0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0x2C,
-  0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF,
-  0xFF, 0x4C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF,
-  0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B,
-  0xFF, 0xFF, 0x2A, 0xF7, 0xFF, 0x2A, 0xF7, 0xFF, 0x29, 0xFF, 0xFF, 0x09, 0xFF,
-  0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xE7, 0xFE, 0xFF,
-  0x06, 0xFF, 0xFF, 0xE5, 0xFE, 0xFF, 0x62, 0xF6, 0xFF, 0xE0, 0xED, 0xFF, 0xE1,
-  0xF5, 0xFF, 0xE1, 0xED, 0xFF, 0xC5, 0xE5, 0xFF, 0xF1, 0xFE, 0x91, 0xF7, 0xFF,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x0E,
-  0xD5, 0xFF, 0x62, 0xA8, 0xEE, 0xF0, 0xA4, 0xEE, 0xFF, 0x04, 0xFF, 0xFF, 0xC3,
-  0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0x06, 0xF7, 0xFF, 0x06, 0xF7,
-  0xFF, 0x07, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF,
-  0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2B,
-  0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF,
-  0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF,
-  0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B,
-  0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF,
-  0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xE8, 0xFE, 0xFF,
-  0x07, 0xFF, 0xFF, 0xE5, 0xFE, 0xFF, 0x83, 0xF6, 0xFF, 0x21, 0xEE, 0xFF, 0xE0,
-  0xF5, 0xFF, 0xE1, 0xF5, 0xFF, 0xC2, 0xE5, 0xFF, 0x08, 0xE6, 0xFF, 0xB5, 0xFF,
-  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x32, 0x2D, 0xF7, 0xB7, 0xA6,
-  0xE6, 0xF4, 0xE5, 0xF6, 0xFF, 0xE4, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE5, 0xFE,
-  0xFF, 0x06, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x08, 0xFF, 0xFF,
-  0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A,
-  0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF,
-  0xFF, 0x2B, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF,
-  0x2C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B,
-  0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2A, 0xFF,
-  0xFF, 0x0A, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x08, 0xFF, 0xFF,
-  0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xE7, 0xFE, 0xFF, 0xC5, 0xF6, 0xFF, 0x42,
-  0xEE, 0xFF, 0x00, 0xEE, 0xFF, 0xE0, 0xF5, 0xFF, 0xC1, 0xED, 0xFF, 0xA5, 0xE5,
-  0xFF, 0xAD, 0xF6, 0xBA, 0xF9, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x0C, 0xB3,
-  0xFF, 0x74, 0xAA, 0xE6, 0xC6, 0xC5, 0xEE, 0xFF, 0xE4, 0xF6, 0xFF, 0xE4, 0xFE,
-  0xFF, 0xE5, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF,
-  0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x09,
-  0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF,
-  0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF,
-  0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B,
-  0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0x4A, 0xFF,
-  0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF,
-  0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xC6,
-  0xFE, 0xFF, 0x63, 0xF6, 0xFF, 0x21, 0xEE, 0xFF, 0x00, 0xEE, 0xFF, 0xE0, 0xED,
-  0xFF, 0xA2, 0xE5, 0xFF, 0xE9, 0xE5, 0xFF, 0x74, 0xFF, 0x51, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x31, 0x0F, 0xF7, 0x9B, 0xC7, 0xEE,
-  0xF5, 0xC4, 0xEE, 0xFF, 0xE4, 0xF6, 0xFF, 0xE4, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF,
-  0xE6, 0xFE, 0xFF, 0xE7, 0xFE, 0xFF, 0x07, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x28,
-  0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x2A, 0xFF,
-  0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF,
-  0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B,
-  0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x4B, 0xFF,
-  0xFF, 0x4A, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF,
-  0x09, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08,
-  0xFF, 0xFF, 0xE7, 0xFE, 0xFF, 0x84, 0xFE, 0xFF, 0x21, 0xF6, 0xFF, 0xE0, 0xED,
-  0xFF, 0xE0, 0xED, 0xFF, 0xE1, 0xED, 0xFF, 0xE5, 0xE5, 0xFF, 0x8F, 0xF6, 0xAF,
-  0xF9, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x96, 0xFF, 0x6C, 0x0B, 0xEF, 0xB0, 0xE5, 0xEE, 0xFF, 0xE3, 0xF6, 0xFF,
-  0xE3, 0xFE, 0xFF, 0xC5, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0x07,
-  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x28, 0xF7, 0xFF, 0x08, 0xFF, 0xFF, 0x29, 0xFF,
-  0xFF, 0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF,
-  0x2A, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B,
-  0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF,
-  0xFF, 0x2A, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF,
-  0x2A, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x07,
-  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xE7, 0xFE, 0xFF, 0x85, 0xFE, 0xFF, 0x22, 0xF6,
-  0xFF, 0x00, 0xF6, 0xFF, 0x00, 0xF6, 0xFF, 0xC1, 0xED, 0xFF, 0xE4, 0xE5, 0xFF,
-  0x6A, 0xEE, 0xCD, 0x75, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x2D, 0x2F, 0xF7, 0x8B,
-  0xE7, 0xEE, 0xEB, 0xE4, 0xF6, 0xFF, 0xE3, 0xF6, 0xFF, 0xC5, 0xFE, 0xFF, 0xC6,
-  0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0x06, 0xFF, 0xFF, 0x07, 0xF7, 0xFF, 0x27, 0xF7,
-  0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF,
-  0x29, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2B,
-  0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFF, 0x2B, 0xFF,
-  0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF,
-  0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x27,
-  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xC6, 0xFE, 0xFF, 0x43, 0xFE,
-  0xFF, 0xE0, 0xF5, 0xFF, 0xE0, 0xF5, 0xFF, 0x01, 0xF6, 0xFF,
-  0xC2, 0xE5, 0xFF, 0x07, 0xE6, 0xFF, 0xF0, 0xF6, 0x9E, 0xFA, 0xFF, 0x06, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xB5, 0xFF, 0x5A, 0x4D, 0xF7, 0xA5, 0xC5, 0xEE, 0xFF, 0xE3,
-  0xF6, 0xFF, 0xE5, 0xFE, 0xFF, 0xC5, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0x05, 0xFF,
-  0xFF, 0x06, 0xF7, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x08, 0xFF, 0xFF,
-  0x08, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x2A,
-  0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF,
-  0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF,
-  0x2A, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x08,
-  0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x27, 0xF7, 0xFF, 0x06, 0xFF, 0xFF, 0x06, 0xFF,
-  0xFF, 0x63, 0xF6, 0xFF, 0x01, 0xF6, 0xFF, 0x00, 0xFE, 0xFF, 0xC0, 0xED, 0xFF,
-  0xE2, 0xED, 0xFF, 0xC5, 0xDD, 0xFF, 0x6C, 0xE6, 0xB0, 0xB7, 0xFF, 0x42, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x1B, 0xB3,
-  0xFF, 0x69, 0x09, 0xEF, 0xD0, 0xC5, 0xEE, 0xFF, 0xC5, 0xF6, 0xFF, 0x05, 0xFF,
-  0xFF, 0xE4, 0xFE, 0xFF, 0x05, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xE7, 0xF6, 0xFF,
-  0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x28,
-  0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF,
-  0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF,
-  0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0x0A,
-  0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x08, 0xF7, 0xFF, 0x27, 0xF7, 0xFF, 0x27, 0xF7,
-  0xFF, 0x06, 0xFF, 0xFF, 0xE5, 0xFE, 0xFF, 0x42, 0xF6, 0xFF, 0xE0, 0xF5, 0xFF,
-  0xE0, 0xF5, 0xFF, 0xE1, 0xF5, 0xFF, 0xC4, 0xE5, 0xFF, 0x2A, 0xE6, 0xEE, 0xD5,
-  0xFF, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xF9, 0xFF, 0x22, 0x90, 0xFF, 0x7E, 0xA8, 0xE6, 0xE1, 0xC5, 0xEE,
-  0xFF, 0x04, 0xFF, 0xFF, 0xE4, 0xF6, 0xFF, 0xE4, 0xFE, 0xFF,
-  0x06, 0xFF, 0xFF, 0xE6, 0xF6, 0xFF, 0x06, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x07,
-  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x09, 0xFF,
-  0xFF, 0x09, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF,
-  0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09,
-  0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF,
-  0xFF, 0x07, 0xF7, 0xFF, 0x27, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x83, 0xF6, 0xFF,
-  0x00, 0xF6, 0xFF, 0xE0, 0xED, 0xFF, 0xE0, 0xF5, 0xFF, 0xE3, 0xED, 0xFF, 0x07,
-  0xE6, 0xFA, 0xF0, 0xF6, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
-  0x37, 0x0E, 0xF7, 0x93, 0xE7, 0xEE, 0xFF, 0xE4, 0xEE, 0xFF, 0xE3, 0xF6, 0xFF,
-  0xE4, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0x06, 0xFF, 0xFF, 0xE6, 0xFE, 0xFF, 0x06,
-  0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x28, 0xFF,
-  0xFF, 0x08, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x29, 0xFF, 0xFF,
-  0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x29,
-  0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x08, 0xFF,
-  0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x07, 0xF7, 0xFF, 0x07, 0xFF, 0xFF,
-  0xE5, 0xFE, 0xFF, 0x42, 0xEE, 0xFF, 0xE0, 0xED, 0xFF, 0xE0, 0xED, 0xFF, 0xE2,
-  0xED, 0xFF, 0xC5, 0xE5, 0xFF, 0xAE, 0xF6, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0x68, 0x0B, 0xF7, 0xB0,
-  0xC5, 0xE6, 0xFF, 0xE4, 0xF6, 0xFF, 0x04, 0xFF, 0xFF, 0xC4, 0xFE, 0xFF, 0xE5,
-  0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0x06, 0xF7, 0xFF, 0x06, 0xFF, 0xFF, 0x07, 0xFF,
-  0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x08, 0xFF, 0xFF,
-  0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x09,
-  0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x08, 0xFF,
-  0xFF, 0x07, 0xF7, 0xFF, 0x27, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
-  0xE7, 0xF6, 0xFF, 0xE6, 0xFE, 0xFF, 0xA4, 0xFE, 0xFF, 0x00, 0xEE, 0xFF, 0xE0,
-  0xED, 0xFF, 0xE0, 0xED, 0xFF, 0xE4, 0xE5, 0xFF, 0x4B, 0xEE, 0xBF, 0x95, 0xFF,
-  0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFA, 0xFF, 0x16, 0x90, 0xFF, 0x6A, 0xC8, 0xE6, 0xFF, 0xE5, 0xF6, 0xFF, 0x04,
-  0xFF, 0xFF, 0xA3, 0xF6, 0xFF, 0xE4, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0x05, 0xFF,
-  0xFF, 0x06, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
-  0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x29,
-  0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF,
-  0xFF, 0x08, 0xFF, 0xFF, 0x27, 0xFF, 0xFF, 0x06, 0xF7, 0xFF, 0x07, 0xFF, 0xFF,
-  0x07, 0xFF, 0xFF, 0xE7, 0xFE, 0xFF, 0xC6, 0xFE, 0xFF, 0x63, 0xFE, 0xFF, 0xE0,
-  0xED, 0xFF, 0x00, 0xEE, 0xFF, 0xE1, 0xE5, 0xFF, 0xE7, 0xDD, 0xFF, 0x31, 0xFF,
-  0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0x59, 0x0C,
-  0xEF, 0xC4, 0xC5, 0xEE, 0xFF, 0x03, 0xFF, 0xFF, 0xC2, 0xFE, 0xFF, 0xC3, 0xFE,
-  0xFF, 0xE4, 0xFE, 0xFF, 0xE5, 0xF6, 0xFF, 0xE5, 0xF6, 0xFF, 0x06, 0xFF, 0xFF,
-  0x06, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x08,
-  0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF,
-  0xFF, 0x08, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x26, 0xF7, 0xFF,
-  0x06, 0xF7, 0xFF, 0x06, 0xF7, 0xFF, 0xE7, 0xFE, 0xFF, 0xC7, 0xFE, 0xFF, 0xA6,
-  0xFE, 0xFF, 0x42, 0xFE, 0xFF, 0xE0, 0xED, 0xFF, 0x00, 0xEE, 0xFF, 0xE2, 0xE5,
-  0xFF, 0x4A, 0xE6, 0xC4, 0xD7, 0xFF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xD9, 0xFF, 0x41, 0x0F, 0xEF, 0x8F, 0xA5, 0xE6, 0xFF, 0xC2, 0xF6,
-  0xFF, 0xE3, 0xFE, 0xFF, 0xC3, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE4, 0xF6, 0xFF,
-  0xE5, 0xF6, 0xFF, 0x05, 0xF7, 0xFF, 0x06, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x06,
-  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x08, 0xFF,
-  0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
-  0x07, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x06, 0xF7, 0xFF, 0x05, 0xF7, 0xFF, 0xE6,
-  0xFE, 0xFF, 0xC7, 0xFE, 0xFF, 0x85, 0xFE, 0xFF, 0x02, 0xFE, 0xFF, 0xE0, 0xF5,
-  0xFF, 0xE0, 0xED, 0xFF, 0xE3, 0xE5, 0xFF, 0xCF, 0xF6, 0x82, 0xDA, 0xFF, 0x3A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x1D, 0x93, 0xFF, 0x5A, 0xA6, 0xE6,
-  0xE7, 0xE4, 0xF6, 0xFF, 0xC4, 0xFE, 0xFF, 0xA4, 0xFE, 0xFF,
-  0xC4, 0xFE, 0xFF, 0xE4, 0xF6, 0xFF, 0xE4, 0xFE, 0xFF, 0x04, 0xFF, 0xFF, 0x05,
-  0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x06, 0xFF,
-  0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
-  0x07, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xE6, 0xFE, 0xFF, 0xC6, 0xFE, 0xFF, 0xE6,
-  0xFE, 0xFF, 0x05, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xC5, 0xFE, 0xFF, 0x64, 0xFE,
-  0xFF, 0xE2, 0xFD, 0xFF, 0xA1, 0xF5, 0xFF, 0xC0, 0xED, 0xFF, 0x05, 0xEE, 0xFA,
-  0x74, 0xFF, 0x3D, 0xBB, 0xFF, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xB5, 0xFF, 0x3E, 0xE9, 0xEE, 0xCB, 0xC4, 0xF6, 0xFF, 0xA4, 0xFE, 0xFF,
-  0xA3, 0xFE, 0xFF, 0xC3, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0x04,
-  0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0x06, 0xFF,
-  0xFF, 0x06, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
-  0x06, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x06,
-  0xFF, 0xFF, 0xE6, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0x04, 0xFF, 0xFF, 0x24, 0xFF,
-  0xFF, 0xC4, 0xFE, 0xFF, 0x63, 0xF6, 0xFF, 0xE2, 0xF5, 0xFF, 0xC1, 0xF5, 0xFF,
-  0xA1, 0xED, 0xFF, 0x49, 0xF6, 0xD8, 0x97, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xFF, 0x23, 0x4C, 0xF7, 0xA7,
-  0xA4, 0xEE, 0xFF, 0xC3, 0xFE, 0xFF, 0xA2, 0xFE, 0xFF, 0xC3, 0xFE, 0xFF, 0xC4,
-  0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE5, 0xFE,
-  0xFF, 0xE5, 0xFE, 0xFF, 0x06, 0xFF, 0xFF, 0xE6, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF,
-  0xE6, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0xE6,
-  0xFE, 0xFF, 0x05, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0x04, 0xF7, 0xFF, 0x03, 0xF7,
-  0xFF, 0x23, 0xFF, 0xFF, 0xC3, 0xFE, 0xFF, 0x42, 0xF6, 0xFF,
-  0xE1, 0xED, 0xFF, 0xE2, 0xED, 0xFF, 0xA4, 0xDD, 0xFF, 0xED, 0xFE, 0xAB, 0xD9,
-  0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xF9, 0xFF, 0x15, 0x90, 0xFF, 0x7C, 0xA6, 0xEE, 0xDC, 0xC3, 0xF6, 0xFF, 0xC1,
-  0xFE, 0xFF, 0xC2, 0xFE, 0xFF, 0xC3, 0xFE, 0xFF, 0xC4, 0xFE, 0xFF, 0xE4, 0xFE,
-  0xFF, 0xE4, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF,
-  0xE6, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0xE6,
-  0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0x05, 0xF7, 0xFF, 0x04, 0xF7,
-  0xFF, 0x03, 0xF7, 0xFF, 0x02, 0xF7, 0xFF, 0xE2, 0xFE, 0xFF, 0x82, 0xF6, 0xFF,
-  0x00, 0xEE, 0xFF, 0xE0, 0xED, 0xFF, 0x02, 0xEE, 0xFF, 0xE6, 0xDD, 0xF0, 0x52,
-  0xFF, 0x68, 0xFB, 0xFF, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0x51, 0xC8,
-  0xEE, 0xB1, 0xC3, 0xF6, 0xFF, 0xE1, 0xFE, 0xFF, 0xC2, 0xF6, 0xFF, 0xC3, 0xFE,
-  0xFF, 0xC3, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF,
-  0xE4, 0xFE, 0xFF, 0xE4, 0xF6, 0xFF, 0xE5, 0xFE, 0xFF, 0x05, 0xF7, 0xFF, 0x05,
-  0xF7, 0xFF, 0x05, 0xF7, 0xFF, 0x05, 0xF7, 0xFF, 0xE4, 0xF6, 0xFF, 0xE4, 0xF6,
-  0xFF, 0x04, 0xF7, 0xFF, 0xE4, 0xF6, 0xFF, 0x04, 0xF7, 0xFF, 0x03, 0xFF, 0xFF,
-  0xA1, 0xFE, 0xFF, 0x21, 0xF6, 0xFF, 0xE0, 0xED, 0xFF, 0x00, 0xEE, 0xFF, 0x02,
-  0xE6, 0xFF, 0x09, 0xDE, 0xCD, 0xB5, 0xFF, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xD6, 0xFF, 0x2A, 0x0C, 0xF7, 0x8F, 0xC4, 0xEE, 0xFF, 0xE1, 0xF6,
-  0xFF, 0xC2, 0xF6, 0xFF, 0xC2, 0xF6, 0xFF, 0xC3, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF,
-  0xE3, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE3, 0xF6, 0xFF, 0xE3, 0xF6, 0xFF, 0xE4,
-  0xF6, 0xFF, 0xE4, 0xF6, 0xFF, 0xE4, 0xF6, 0xFF, 0x04, 0xF7, 0xFF, 0xE4, 0xF6,
-  0xFF, 0x04, 0xF7, 0xFF, 0xE4, 0xF6, 0xFF, 0xE4, 0xF6, 0xFF, 0xE4, 0xF6, 0xFF,
-  0xE4, 0xFE, 0xFF, 0xC2, 0xFE, 0xFF, 0x41, 0xFE, 0xFF, 0xC0, 0xF5, 0xFF, 0xC0,
-  0xF5, 0xFF, 0xE0, 0xED, 0xFF, 0x03, 0xDE, 0xFF, 0x6D, 0xDE, 0xA8, 0xD8, 0xFF,
-  0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x0B, 0x50, 0xFF, 0x75, 0xA6, 0xE6,
-  0xEF, 0xE3, 0xEE, 0xFF, 0xC2, 0xF6, 0xFF, 0xC2, 0xF6, 0xFF,
-  0xC2, 0xFE, 0xFF, 0xE2, 0xFE, 0xFF, 0xE2, 0xFE, 0xFF, 0xE2, 0xFE, 0xFF, 0xE3,
-  0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE3, 0xFE,
-  0xFF, 0xE3, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE2, 0xFE, 0xFF,
-  0xE3, 0xFE, 0xFF, 0xC4, 0xFE, 0xFF, 0x83, 0xFE, 0xFF, 0x41, 0xFE, 0xFF, 0xE0,
-  0xFD, 0xFF, 0xA0, 0xFD, 0xFF, 0xA1, 0xF5, 0xFF, 0xE1, 0xED, 0xFF, 0xE5, 0xDD,
-  0xE0, 0x11, 0xF7, 0x7F, 0xFB, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x95, 0xFF, 0x67, 0xAA, 0xE6, 0xCB, 0xC6, 0xEE, 0xED, 0xC3, 0xF6, 0xFF,
-  0xC2, 0xF6, 0xFF, 0xC2, 0xF6, 0xFF, 0xC2, 0xFE, 0xFF, 0xC2, 0xFE, 0xFF, 0xE2,
-  0xFE, 0xFF, 0xE2, 0xFE, 0xFF, 0xC2, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE3, 0xFE,
-  0xFF, 0xC3, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE2, 0xFE, 0xFF,
-  0xC2, 0xFE, 0xFF, 0xC2, 0xFE, 0xFF, 0xC2, 0xFE, 0xFF, 0xC2, 0xFE, 0xFF, 0x41,
-  0xFE, 0xFF, 0xC0, 0xF5, 0xFF, 0xA0, 0xFD, 0xFF, 0xA1, 0xFD, 0xFF, 0xA3, 0xF5,
-  0xFF, 0xE4, 0xE5, 0xFF, 0xE8, 0xD5, 0xC0, 0xB6, 0xFF, 0x64, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x1F, 0x71, 0xF7, 0x70,
-  0xA9, 0xE6, 0xDF, 0xC4, 0xF6, 0xFF, 0xA1, 0xF6, 0xFF, 0xC2, 0xF6, 0xFF, 0xA1,
-  0xF6, 0xFF, 0xE2, 0xFE, 0xFF, 0x02, 0xFF, 0xFF, 0xA1, 0xF6, 0xFF, 0xC1, 0xFE,
-  0xFF, 0xA1, 0xF6, 0xFF, 0xA1, 0xFE, 0xFF, 0xA2, 0xFE, 0xFF, 0xC2, 0xFE, 0xFF,
-  0xC2, 0xFE, 0xFF, 0xA1, 0xFE, 0xFF, 0x81, 0xF6, 0xFF, 0x60, 0xF6, 0xFF, 0x00,
-  0xEE, 0xFF, 0x00, 0xEE, 0xFF, 0xC0, 0xF5, 0xFF, 0xA0, 0xF5, 0xFF, 0xC3, 0xFD,
-  0xFF, 0x85, 0xE5, 0xFF, 0xE8, 0xDD, 0xD8, 0x31, 0xFF, 0x8C,
-  0xFA, 0xFF, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xD6, 0xFF, 0x27, 0x50, 0xF7, 0x82, 0xA8, 0xEE, 0xD5, 0xE6,
-  0xF6, 0xFF, 0xC5, 0xEE, 0xFF, 0xE5, 0xF6, 0xFF, 0xA4, 0xEE, 0xFF, 0xA4, 0xF6,
-  0xFF, 0xC5, 0xF6, 0xFF, 0xC5, 0xFE, 0xFF, 0xC5, 0xFE, 0xFF, 0xC5, 0xFE, 0xFF,
-  0x85, 0xF6, 0xFF, 0x64, 0xF6, 0xFF, 0x64, 0xF6, 0xFF, 0x43, 0xEE, 0xFF, 0x02,
-  0xEE, 0xFF, 0x02, 0xE6, 0xFF, 0x02, 0xE6, 0xFF, 0xC1, 0xDD, 0xFF, 0xE2, 0xED,
-  0xFF, 0xC4, 0xED, 0xFF, 0xC7, 0xED, 0xFF, 0xEA, 0xE5, 0xDC, 0xD0, 0xF6, 0x8E,
-  0xB7, 0xFF, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0xF8,
-  0xFF, 0x27, 0xB2, 0xFF, 0x7F, 0x2E, 0xEF, 0xBD, 0xCC, 0xE6, 0xE8, 0xAB, 0xE6,
-  0xFF, 0x8B, 0xE6, 0xFF, 0xAB, 0xE6, 0xFF, 0x8B, 0xE6, 0xFF, 0x29, 0xDE, 0xFF,
-  0x09, 0xDE, 0xFF, 0x09, 0xDE, 0xFF, 0xE9, 0xDD, 0xFF, 0xE9, 0xDD, 0xFF, 0xE9,
-  0xDD, 0xFF, 0xE9, 0xDD, 0xFF, 0xE9, 0xDD, 0xFF, 0x09, 0xDE, 0xFF, 0x28, 0xDE,
-  0xFF, 0x28, 0xDE, 0xFF, 0x09, 0xDE, 0xFF, 0xC9, 0xDD, 0xEF, 0x6F, 0xEE, 0xC0,
-  0x75, 0xFF, 0x7B, 0xFA, 0xFF, 0x35, 0xFB, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
-  0x0D, 0xF7, 0xFF, 0x2D, 0xB5, 0xFF, 0x33, 0xD6, 0xFF, 0x3D, 0xD6, 0xFF, 0x4D,
-  0x95, 0xFF, 0x55, 0xB6, 0xFF, 0x4D, 0xB6, 0xFF, 0x4C, 0xB6, 0xFF, 0x4B, 0xB6,
-  0xFF, 0x4B, 0xD6, 0xFF, 0x49, 0xD6, 0xFF, 0x45, 0xD7, 0xFF, 0x44, 0xB6, 0xFF,
-  0x43, 0xB6, 0xFF, 0x3D, 0xD5, 0xFF, 0x35, 0xD5, 0xFF, 0x33, 0xD5, 0xFF, 0x2C,
-  0xF7, 0xFF, 0x1A, 0xF8, 0xFF, 0x12, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x39, 0xE7, 0x0A, 0x31, 0xA5, 0x9D, 0xAA, 0x73, 0xF1,
-  0x69, 0x6B, 0xF8, 0xAA, 0x73, 0xFB, 0x8A, 0x73, 0xFB, 0x8A, 0x73, 0xFF, 0x6A,
-  0x73, 0xFF, 0x6A, 0x73, 0xFF, 0x6A, 0x73, 0xFF, 0x6A, 0x73, 0xFF, 0x6A, 0x73,
-  0xFF, 0x4A, 0x73, 0xFF, 0x49, 0x6B, 0xFF, 0x49, 0x6B, 0xFF, 0x4A, 0x73, 0xF9,
-  0x8B, 0x73, 0xEF, 0x4A, 0x73, 0xE3, 0xAC, 0x7B, 0xE3, 0x4F, 0x8C, 0xC6, 0x1B,
-  0xEF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xCE, 0x27, 0x07, 0x3A, 0xF1,
-  0x48, 0x42, 0xFF, 0xCA, 0x52, 0xFF, 0x68, 0x4A, 0xFF, 0x68, 0x4A, 0xFF, 0xC9,
-  0x5A, 0xFF, 0x89, 0x52, 0xFF, 0x89, 0x52, 0xFF, 0x89, 0x52, 0xFF, 0x89, 0x52,
-  0xFF, 0x89, 0x52, 0xFF, 0xA9, 0x52, 0xFF, 0x89, 0x52, 0xFF,
-  0xAA, 0x52, 0xFF, 0x8A, 0x52, 0xFF, 0x69, 0x4A, 0xFF, 0x6A, 0x52, 0xFD, 0x8A,
-  0x5A, 0xF1, 0x49, 0x4A, 0xFF, 0x96, 0xB5, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0C, 0x63, 0xB3, 0x28, 0x42, 0xE0, 0x08, 0x42, 0xEB, 0x48,
-  0x4A, 0xFF, 0x48, 0x4A, 0xFF, 0x07, 0x42, 0xFF, 0x28, 0x4A, 0xFF, 0x28, 0x4A,
-  0xFF, 0x28, 0x42, 0xFF, 0x28, 0x42, 0xFF, 0x28, 0x42, 0xFF, 0x28, 0x42, 0xFF,
-  0x28, 0x42, 0xFF, 0x28, 0x42, 0xFF, 0x49, 0x4A, 0xFF, 0x28, 0x42, 0xF8, 0x29,
-  0x4A, 0xE9, 0x29, 0x4A, 0xEC, 0xAA, 0x5A, 0xC2, 0x17, 0xC6, 0x2A, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xD6, 0x06, 0x59,
-  0xCE, 0x35, 0x59, 0xCE, 0x39, 0x38, 0xC6, 0x3E, 0x38, 0xCE, 0x42, 0x59, 0xCE,
-  0x45, 0x59, 0xCE, 0x45, 0x59, 0xCE, 0x47, 0x59, 0xCE, 0x47, 0x59, 0xCE, 0x46,
-  0x59, 0xCE, 0x45, 0x59, 0xCE, 0x43, 0x39, 0xC6, 0x40, 0x59, 0xCE, 0x3C, 0x59,
-  0xCE, 0x38, 0x59, 0xCE, 0x33, 0x59, 0xCE, 0x2E, 0x18, 0xC6, 0x32, 0xBA, 0xEE,
-  0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x30, 0x84, 0x75, 0x69, 0x4A, 0xBA, 0x49, 0x4A, 0xC5, 0x8A, 0x52,
-  0xD4, 0x69, 0x4A, 0xE3, 0x49, 0x4A, 0xED, 0x49, 0x4A, 0xF4, 0x69, 0x4A, 0xF8,
-  0x69, 0x4A, 0xFA, 0x69, 0x4A, 0xFA, 0x69, 0x4A, 0xF9, 0x69, 0x4A, 0xF7, 0x69,
-  0x4A, 0xF2, 0x69, 0x4A, 0xEA, 0x49, 0x4A, 0xDF, 0x49, 0x4A, 0xD2, 0x8A, 0x52,
-  0xC5, 0x8A, 0x52, 0xB7, 0x8E, 0x73, 0x86, 0xDB, 0xDE, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xCE, 0x17, 0x28, 0x42, 0xBE, 0x69, 0x4A,
-  0xB4, 0xAA, 0x52, 0xC2, 0x28, 0x42, 0xCF, 0x8A, 0x52, 0xE0, 0xAA, 0x52, 0xEC,
-  0x8A, 0x52, 0xF5, 0x8A, 0x52, 0xFB, 0x8A, 0x52, 0xFD, 0x8A, 0x52, 0xFC, 0x8A,
-  0x52, 0xF9, 0x8A, 0x52, 0xF4, 0x8A, 0x52, 0xEF, 0x8A, 0x52, 0xE9, 0x69, 0x4A,
-  0xDF, 0xAA, 0x52, 0xD3, 0x69, 0x4A, 0xC5, 0x8A, 0x52, 0xB7, 0x69, 0x4A, 0xC7,
-  0x96, 0xB5, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x63,
-  0x94, 0x28, 0x42, 0xC0, 0x28, 0x42, 0xCF, 0x69, 0x4A, 0xDD,
-  0x69, 0x4A, 0xE7, 0x28, 0x42, 0xF2, 0x49, 0x4A, 0xFA, 0x49, 0x4A, 0xFF, 0x49,
-  0x4A, 0xFF, 0x49, 0x4A, 0xFD, 0x49, 0x4A, 0xF8, 0x49, 0x4A, 0xF2, 0x49, 0x4A,
-  0xEC, 0x49, 0x4A, 0xE4, 0x49, 0x4A, 0xD9, 0x28, 0x42, 0xCC, 0x49, 0x4A, 0xC2,
-  0x69, 0x4A, 0xBC, 0xEB, 0x5A, 0x9F, 0xBA, 0xD6, 0x06, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xEF, 0x0B, 0xDB, 0xDE, 0x14,
-  0xFB, 0xDE, 0x17, 0xFB, 0xDE, 0x24, 0xBA, 0xD6, 0x26, 0xFB, 0xDE, 0x28, 0x1C,
-  0xE7, 0x2A, 0x1C, 0xE7, 0x29, 0xFB, 0xDE, 0x27, 0x1C, 0xE7, 0x24, 0xFB, 0xDE,
-  0x20, 0x3C, 0xE7, 0x1C, 0xFB, 0xDE, 0x16, 0xFB, 0xDE, 0x0F,
-  0xFB, 0xDE, 0x08, 0x79, 0xCE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x30, 0x84, 0x87, 0xCB, 0x5A, 0xC0, 0xEB, 0x5A, 0xCF, 0x2C, 0x63, 0xCF, 0x6D,
-  0x6B, 0xD1, 0x0C, 0x63, 0xDC, 0x0C, 0x63, 0xE1, 0x0C, 0x63, 0xE4, 0x0C, 0x63,
-  0xE5, 0x0C, 0x63, 0xE3, 0x0C, 0x63, 0xDF, 0x0C, 0x63, 0xD8, 0x0C, 0x63, 0xCE,
-  0x2C, 0x63, 0xC3, 0x0C, 0x63, 0xB7, 0x2C, 0x63, 0xB1, 0xCF, 0x7B, 0x95, 0x79,
-  0xCE, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x79, 0xCE, 0x24, 0x49, 0x4A, 0xDF, 0x8A, 0x52, 0xFF, 0x8A,
-  0x52, 0xFC, 0x28, 0x42, 0xFF, 0x49, 0x4A, 0xFF, 0x69, 0x4A, 0xFF, 0x69, 0x4A,
-  0xFF, 0x69, 0x4A, 0xFF, 0x69, 0x4A, 0xFF, 0x69, 0x4A, 0xFF, 0x69, 0x4A, 0xFF,
-  0x69, 0x4A, 0xFF, 0x69, 0x4A, 0xFF, 0x8A, 0x52, 0xFF, 0x49, 0x4A, 0xFA, 0x8A,
-  0x52, 0xF0, 0xC7, 0x39, 0xFF, 0xD3, 0x9C, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92,
-  0x94, 0x8F, 0x4D, 0x6B, 0xC6, 0x0C, 0x63, 0xDB, 0x6D, 0x6B, 0xE7, 0x4D, 0x6B,
-  0xEA, 0x2C, 0x63, 0xE9, 0x2C, 0x63, 0xE7, 0x2C, 0x63, 0xE8, 0x2C, 0x63, 0xE9,
-  0x2C, 0x63, 0xE9, 0x2C, 0x63, 0xE7, 0x2C, 0x63, 0xE0, 0x2C, 0x63, 0xD8, 0x4D,
-  0x6B, 0xCD, 0x4D, 0x6B, 0xC3, 0x4D, 0x6B, 0xC0, 0x10, 0x84, 0xA6, 0x38, 0xC6,
-  0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x1C, 0xE7, 0x22, 0x5D, 0xEF,
-  0x26, 0x3C, 0xE7, 0x27, 0x3C, 0xE7, 0x28, 0x3C, 0xE7, 0x2A, 0x3C, 0xE7, 0x29,
-  0x3C, 0xE7, 0x29, 0x3C, 0xE7, 0x29, 0x3C, 0xE7, 0x28, 0x5D, 0xEF, 0x25, 0x5D,
-  0xEF, 0x21, 0x5D, 0xEF, 0x18, 0x5D, 0xEF, 0x0D, 0x5D, 0xEF, 0x0C, 0x1C, 0xE7,
-  0x11, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xEF, 0x0D, 0x10, 0x84,
-  0xB1, 0x8A, 0x52, 0xFF, 0x4D, 0x6B, 0xFF, 0xEB, 0x5A, 0xFF,
-  0xEB, 0x5A, 0xFF, 0x0C, 0x63, 0xFF, 0xEB, 0x5A, 0xFF, 0xCB, 0x5A, 0xFF, 0x0C,
-  0x63, 0xFF, 0x0C, 0x63, 0xFF, 0xEB, 0x5A, 0xFF, 0xCB, 0x5A, 0xFF, 0x4D, 0x6B,
-  0xE8, 0x49, 0x4A, 0xFF, 0x8E, 0x73, 0xD7, 0xFB, 0xDE, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x59, 0xCE, 0x51, 0x4D, 0x6B, 0xFF, 0x28, 0x42, 0xFF,
-  0x8A, 0x52, 0xFF, 0xAA, 0x52, 0xFF, 0xAA, 0x52, 0xFF, 0x8A, 0x52, 0xFF, 0x8A,
-  0x52, 0xFF, 0xAA, 0x52, 0xFF, 0xAA, 0x52, 0xFF, 0x8A, 0x52, 0xFF, 0xAA, 0x52,
-  0xFF, 0x28, 0x42, 0xFF, 0xEB, 0x5A, 0xFF, 0x14, 0xA5, 0x79,
-  0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03,
-  0xBA, 0xD6, 0x3E, 0xD3, 0x9C, 0xB4, 0x2C, 0x63, 0xFF, 0x69, 0x4A, 0xFF, 0x49,
-  0x4A, 0xFF, 0x28, 0x42, 0xFF, 0x28, 0x42, 0xFF, 0x49, 0x4A, 0xFF, 0x49, 0x4A,
-  0xFF, 0x8A, 0x52, 0xFF, 0xEB, 0x5A, 0xFF, 0x51, 0x8C, 0xC2, 0x59, 0xCE, 0x46,
-  0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x01, 0x5D,
-  0xEF, 0x27, 0x38, 0xC6, 0x73, 0xB6, 0xB5, 0x9E, 0x14, 0xA5, 0xBC, 0xD3, 0x9C,
-  0xC5, 0xD3, 0x9C, 0xB8, 0x34, 0xA5, 0xA5, 0x59, 0xCE, 0x5E, 0x7D, 0xEF, 0x1B,
-  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x52, 0x4C, 0x45, 0x03, 0x00, 0x00, 0x24, 0x00, 0x5A, 0x00, 0x97, 0x00, 0xDF,
+  0x00, 0x2C, 0x01, 0x7C, 0x01, 0xD1, 0x01, 0x27, 0x02, 0x7F, 0x02, 0xD2, 0x02,
+  0x1F, 0x03, 0x69, 0x03, 0xBE, 0x03, 0x11, 0x04, 0x64, 0x04, 0xB7, 0x04, 0x08,
+  0x05, 0x57, 0x05, 0xA7, 0x05, 0xF3, 0x05, 0x3F, 0x06, 0x8A, 0x06, 0xD7, 0x06,
+  0x26, 0x07, 0x70, 0x07, 0xB4, 0x07, 0xFE, 0x07, 0x3D, 0x08, 0x7B, 0x08, 0xB6,
+  0x08, 0xF6, 0x08, 0x2E, 0x09, 0x64, 0x09, 0x9D, 0x09, 0xD6, 0x09, 0x09, 0x0A,
+  0x32, 0x0A, 0x62, 0x0A, 0x95, 0x0A, 0xC8, 0x0A, 0xF5, 0x0A, 0x21, 0x0B, 0x4B,
+  0x0B, 0x74, 0x0B, 0x8A, 0x00, 0x00, 0x00, 0x08, 0x97, 0xFF, 0x02, 0x74, 0xFF,
+  0x1F, 0x51, 0xFF, 0x3E, 0x2F, 0xF7, 0x51, 0x0D, 0xEF, 0x58, 0x0D, 0xEF, 0x57,
+  0x4F, 0xF7, 0x4B, 0x71, 0xFF, 0x2C, 0xB4, 0xFF, 0x06, 0x8A, 0x00, 0x00, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x0E, 0xB6, 0xFF, 0x03, 0x31, 0xF7, 0x19, 0x0E, 0xF7,
+  0x62, 0xC9, 0xF6, 0xAE, 0xA6, 0xF6, 0xDA, 0xC6, 0xF6, 0xEC, 0xC6, 0xF6, 0xF4,
+  0xC6, 0xEE, 0xF8, 0xC6, 0xEE, 0xF7, 0xE6, 0xF6, 0xF2, 0xE7, 0xF6, 0xE4, 0xC7,
+  0xEE, 0xC8, 0x0B, 0xEF, 0x94, 0x2E, 0xF7, 0x2D, 0xB2, 0xFF, 0x09, 0x87, 0x00,
+  0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x06, 0x93, 0xFF, 0x0D, 0x4C, 0xF7, 0x5A,
+  0xE8, 0xEE, 0xBE, 0xA5, 0xEE, 0xF0, 0xC4, 0xFE, 0xFF, 0xC3, 0xFE, 0xFF, 0xC3,
+  0xF6, 0xFF, 0x81, 0xE3, 0xF6, 0xFF, 0x00, 0xE3, 0xFE, 0xFF, 0x81, 0xC3, 0xFE,
+  0xFF, 0x05, 0xE3, 0xF6, 0xFF, 0xA6, 0xEE, 0xFD, 0xC7, 0xEE, 0xE3, 0x28, 0xEF,
+  0x8E, 0x4C, 0xF7, 0x26, 0x93, 0xFF, 0x02, 0x85, 0x00, 0x00, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x14, 0xF6, 0xFF, 0x02, 0x71, 0xFF, 0x25, 0xC9, 0xEE, 0xA8, 0xE5,
+  0xEE, 0xED, 0xE3, 0xEE, 0xFB, 0xC6, 0xEE, 0xF8, 0x0A, 0xEF, 0xD8, 0x0D, 0xF7,
+  0xC6, 0x2D, 0xF7, 0xC2, 0x0B, 0xF7, 0xE3, 0xE6, 0xF6, 0xFC, 0xE4, 0xFE, 0xFF,
+  0xC4, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE3,
+  0xF6, 0xFF, 0xE2, 0xF6, 0xFD, 0xE6, 0xEE, 0xDE, 0x2C, 0xF7, 0x63, 0x6F, 0xFF,
+  0x07, 0x84, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x03,
+  0x2F, 0xF7, 0x3D, 0xE9, 0xEE, 0xBF, 0xC4, 0xEE, 0xEE, 0xE6, 0xEE, 0xE6, 0x0B,
+  0xF7, 0xBA, 0x71, 0xF7, 0x67, 0x94, 0xFF, 0x25, 0xD6, 0xFF, 0x13, 0xD9, 0xFF,
+  0x1D, 0x93, 0xFF, 0x66, 0x2A, 0xFF, 0xEC, 0x81, 0xE5, 0xF6, 0xFF, 0x08, 0x05,
+  0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xE3, 0xFE, 0xFF, 0xC4, 0xFE, 0xFF, 0xC3, 0xFE,
+  0xFF, 0xE2, 0xFE, 0xFF, 0xC4, 0xEE, 0xEB, 0x0B, 0xEF, 0x7C, 0x52, 0xF7, 0x12,
+  0x83, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0C, 0xB7, 0xFF, 0x01, 0x2E,
+  0xEF, 0x32, 0xE9, 0xEE, 0xBA, 0xC4, 0xEE, 0xEB, 0xE8, 0xF6, 0xDE, 0x50, 0xF7,
+  0x89, 0xB6, 0xFF, 0x2D, 0xFC, 0xFF, 0x05, 0xFC, 0xFF, 0x0D, 0xFB, 0xFF, 0x2F,
+  0xD8, 0xFF, 0x4B, 0x72, 0xFF, 0xA1, 0x0A, 0xFF, 0xF5, 0x81, 0xE7, 0xFE, 0xFF,
+  0x00, 0x06, 0xFF, 0xFF, 0x81, 0x05, 0xFF, 0xFF, 0x81, 0xE4, 0xFE, 0xFF, 0x04,
+  0xC3, 0xFE, 0xFF, 0xC2, 0xFE, 0xFF, 0xC5, 0xEE, 0xE5, 0x0B, 0xEF, 0x74, 0x94,
+  0xFF, 0x05, 0x82, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0C, 0x71, 0xFF,
+  0x22, 0xC8, 0xEE, 0xB3, 0xC4, 0xF6, 0xEE, 0xE8, 0xF6, 0xE5, 0x73, 0xFF, 0x69,
+  0xD8, 0xFF, 0x0F, 0xFD, 0xFF, 0x02, 0xFC, 0xFF, 0x37, 0xB7, 0xFF, 0x72, 0x72,
+  0xF7, 0xB6, 0x2E, 0xF7, 0xEF, 0x0A, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x81, 0x07,
+  0xFF, 0xFF, 0x02, 0xE7, 0xFE, 0xFF, 0x06, 0xFF, 0xFF, 0x06, 0xF7, 0xFF, 0x81,
+  0x05, 0xF7, 0xFF, 0x05, 0x04, 0xFF, 0xFF, 0xE2, 0xFE, 0xFF, 0xC2, 0xF6, 0xFD,
+  0xC6, 0xEE, 0xE6, 0x2C, 0xF7, 0x55, 0x70, 0xFF, 0x03, 0x81, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x0A, 0x71, 0xFF, 0x07, 0x0B, 0xF7, 0x8A, 0xA5, 0xF6,
+  0xF0, 0xA7, 0xF6, 0xE2, 0x50, 0xF7, 0x74, 0xB7, 0xFF, 0x06, 0xFC, 0xFF, 0x05,
+  0xD8, 0xFF, 0x34, 0x93, 0xF7, 0xAB, 0x2D, 0xEF, 0xF3, 0x0A, 0xF7, 0xFE, 0x82,
+  0x09, 0xFF, 0xFF, 0x0C, 0x29, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xE9, 0xFE, 0xFF,
+  0x08, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0xF7, 0xFF, 0x05, 0xF7, 0xFF, 0xE5,
+  0xF6, 0xFF, 0xC4, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xC2, 0xF6, 0xFD, 0xC5, 0xF6,
+  0xCA, 0x6F, 0xF7, 0x2F, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x0D,
+  0x6F, 0xF7, 0x3A, 0xC7, 0xEE, 0xDF, 0xC5, 0xF6, 0xFC, 0x0C, 0xF7, 0xB3, 0xD7,
+  0xFF, 0x27, 0xFC, 0xFF, 0x02, 0xB8, 0xFF, 0x3E, 0x51, 0xF7, 0xB4, 0x0B, 0xF7,
+  0xF8, 0x09, 0xF7, 0xFF, 0x28, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x29, 0xFF, 0xFF,
+  0x2A, 0xF7, 0xFF, 0x81, 0x29, 0xFF, 0xFF, 0x81, 0x09, 0xFF, 0xFF, 0x01, 0x08,
+  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x81, 0xE6, 0xFE, 0xFF, 0x06, 0xE5, 0xFE, 0xFF,
+  0xE4, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xC4, 0xF6, 0xF3, 0xEB, 0xE6, 0x84, 0x71,
+  0xF7, 0x0B, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x94, 0xFF, 0x07, 0xEB,
+  0xEE, 0x9C, 0xC4, 0xF6, 0xFF, 0xE7, 0xF6, 0xE5, 0x71, 0xFF, 0x70, 0xFF, 0xFF,
+  0x00, 0xFB, 0xFF, 0x2D, 0x72, 0xFF, 0xAD, 0xEC, 0xFE, 0xFD, 0x09, 0xFF, 0xFF,
+  0x81, 0x29, 0xFF, 0xFF, 0x81, 0x2A, 0xFF, 0xFF, 0x00, 0x2B, 0xFF, 0xFF, 0x83,
+  0x2A, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xFF, 0x81, 0x07, 0xFF, 0xFF, 0x07, 0xE7,
+  0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xE3, 0xF6,
+  0xFF, 0xA5, 0xE6, 0xD6, 0xEC, 0xEE, 0x36, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x30, 0xFF, 0x2E, 0xA8, 0xEE, 0xDA, 0xC3, 0xF6, 0xFF, 0xE9, 0xF6, 0xD3,
+  0x94, 0xFF, 0x33, 0xFD, 0xFF, 0x10, 0xB6, 0xF7, 0x81, 0x0D, 0xF7, 0xF2, 0x81,
+  0x09, 0xFF, 0xFF, 0x81, 0x2A, 0xFF, 0xFF, 0x84, 0x2B, 0xFF, 0xFF, 0x81, 0x2A,
+  0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xFF, 0x81, 0x08, 0xFF, 0xFF, 0x07, 0x07, 0xFF,
+  0xFF, 0xE6, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF,
+  0xA2, 0xF6, 0xF9, 0x4A, 0xEE, 0x85, 0xD9, 0xFF, 0x05, 0x08, 0x00, 0x00, 0x00,
+  0x2D, 0xF7, 0x73, 0xC6, 0xF6, 0xF8, 0xE3, 0xF6, 0xFF, 0xE9, 0xF6, 0xDC, 0xB4,
+  0xFF, 0x58, 0xD6, 0xFF, 0x58, 0x50, 0xF7, 0xE2, 0x0A, 0xFF, 0xFE, 0x81, 0x09,
+  0xFF, 0xFF, 0x81, 0x2A, 0xFF, 0xFF, 0x85, 0x2B, 0xFF, 0xFF, 0x81, 0x2A, 0xFF,
+  0xFF, 0x00, 0x29, 0xFF, 0xFF, 0x81, 0x08, 0xFF, 0xFF, 0x06, 0x07, 0xFF, 0xFF,
+  0xE6, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0xE3, 0xFE, 0xFF, 0xA2, 0xF6, 0xFC, 0xE8,
+  0xDD, 0xC0, 0x75, 0xFF, 0x1E, 0x09, 0xFB, 0xFF, 0x09, 0x0B, 0xF7, 0x9E, 0xC4,
+  0xF6, 0xFF, 0xE5, 0xEE, 0xFF, 0x0A, 0xF7, 0xF5, 0x2E, 0xF7, 0xD4, 0x2D, 0xEF,
+  0xDA, 0x29, 0xF7, 0xFE, 0x09, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0x81, 0x2A, 0xFF,
+  0xFF, 0x81, 0x2B, 0xFF, 0xFF, 0x00, 0x4C, 0xFF, 0xFF, 0x82, 0x2C, 0xFF, 0xFF,
+  0x81, 0x2B, 0xFF, 0xFF, 0x0A, 0x2A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x09, 0xFF,
+  0xFF, 0x08, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xE6, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF,
+  0xE3, 0xFE, 0xFF, 0xA3, 0xFE, 0xFF, 0x06, 0xE6, 0xE5, 0xF0, 0xF6, 0x3B, 0x08,
+  0xF8, 0xFF, 0x34, 0xEA, 0xEE, 0xC0, 0xC8, 0xEE, 0xF9, 0x8F, 0xFF, 0x8B, 0xD4,
+  0xFF, 0x52, 0x71, 0xF7, 0xBC, 0x0A, 0xEF, 0xFF, 0x28, 0xF7, 0xFF, 0x29, 0xFF,
+  0xFF, 0x81, 0x2A, 0xFF, 0xFF, 0x81, 0x2B, 0xFF, 0xFF, 0x00, 0x2C, 0xFF, 0xFF,
+  0x82, 0x4C, 0xFF, 0xFF, 0x81, 0x2C, 0xFF, 0xFF, 0x81, 0x2B, 0xFF, 0xFF, 0x09,
+  0x2A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x06,
+  0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xE4, 0xFE, 0xFF, 0x83, 0xFE, 0xFF, 0x04, 0xEE,
+  0xF2, 0x8B, 0xEE, 0x57, 0x09, 0xF7, 0xFF, 0x3C, 0xCA, 0xE6, 0xCB, 0xE9, 0xEE,
+  0xF3, 0xD3, 0xFF, 0x5A, 0xFB, 0xFF, 0x1D, 0x74, 0xFF, 0xA4, 0x0A, 0xF7, 0xFB,
+  0x0A, 0xF7, 0xFF, 0x49, 0xF7, 0xFF, 0x29, 0xFF, 0xFF, 0x81, 0x2B, 0xFF, 0xFF,
+  0x81, 0x2C, 0xFF, 0xFF, 0x81, 0x4D, 0xFF, 0xFF, 0x00, 0x4C, 0xFF, 0xFF, 0x82,
+  0x2C, 0xFF, 0xFF, 0x81, 0x2B, 0xFF, 0xFF, 0x08, 0x2A, 0xFF, 0xFF, 0x29, 0xFF,
+  0xFF, 0x08, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xE4, 0xFE, 0xFF,
+  0x63, 0xFE, 0xFF, 0xE3, 0xED, 0xF6, 0x8A, 0xEE, 0x6E, 0x09, 0xF8, 0xFF, 0x4D,
+  0xEA, 0xEE, 0xDE, 0xC7, 0xEE, 0xFB, 0x6E, 0xFF, 0xAB, 0xB2, 0xFF, 0x73, 0x4F,
+  0xFF, 0xCE, 0xE9, 0xFE, 0xFF, 0x0A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x2A, 0xFF,
+  0xFF, 0x81, 0x2B, 0xFF, 0xFF, 0x81, 0x2C, 0xFF, 0xFF, 0x81, 0x4D, 0xFF, 0xFF,
+  0x00, 0x4C, 0xFF, 0xFF, 0x82, 0x2C, 0xFF, 0xFF, 0x81, 0x2B, 0xFF, 0xFF, 0x08,
+  0x2A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x06,
+  0xFF, 0xFF, 0xE4, 0xFE, 0xFF, 0x22, 0xFE, 0xFF, 0xE3, 0xED, 0xF8, 0x8A, 0xEE,
+  0x77, 0x03, 0xF9, 0xFF, 0x4A, 0xC9, 0xEE, 0xD7, 0xC4, 0xF6, 0xFF, 0xE6, 0xF6,
+  0xFF, 0x81, 0x08, 0xF7, 0xFF, 0x00, 0xE7, 0xFE, 0xFF, 0x81, 0x09, 0xFF, 0xFF,
+  0x00, 0x2A, 0xFF, 0xFF, 0x81, 0x2B, 0xFF, 0xFF, 0x81, 0x2C, 0xFF, 0xFF, 0x81,
+  0x4D, 0xFF, 0xFF, 0x00, 0x4C, 0xFF, 0xFF, 0x82, 0x2C, 0xFF, 0xFF, 0x81, 0x2B,
+  0xFF, 0xFF, 0x08, 0x2A, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x07,
+  0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xC4, 0xFE, 0xFF, 0xE1, 0xF5, 0xFF, 0xE4, 0xED,
+  0xF8, 0x8B, 0xEE, 0x6C, 0x09, 0xFB, 0xFF, 0x2E, 0x0A, 0xF7, 0xC3, 0xE4, 0xFE,
+  0xFF, 0xE4, 0xF6, 0xFF, 0xE5, 0xF6, 0xFF, 0x05, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
+  0x09, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x81, 0x2B, 0xFF, 0xFF,
+  0x81, 0x2C, 0xFF, 0xFF, 0x81, 0x4C, 0xFF, 0xFF, 0x83, 0x2C, 0xFF, 0xFF, 0x81,
+  0x2B, 0xFF, 0xFF, 0x08, 0x2A, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x08, 0xFF, 0xFF,
+  0xE7, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0x83, 0xF6, 0xFF, 0xE0, 0xF5, 0xFF, 0xE5,
+  0xED, 0xF4, 0xAD, 0xF6, 0x51, 0x09, 0xFC, 0xFF, 0x09, 0x4C, 0xF7, 0xA2, 0xC4,
+  0xF6, 0xFD, 0xE3, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0x07, 0xFF,
+  0xFF, 0x09, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x81, 0x2B, 0xFF,
+  0xFF, 0x83, 0x2C, 0xFF, 0xFF, 0x00, 0x4C, 0xFF, 0xFF, 0x82, 0x2C, 0xFF, 0xFF,
+  0x00, 0x2B, 0xFF, 0xFF, 0x81, 0x2A, 0xFF, 0xFF, 0x07, 0x29, 0xFF, 0xFF, 0x08,
+  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xE5, 0xFE, 0xFF, 0x42, 0xEE, 0xFF, 0xE1, 0xF5,
+  0xFF, 0xE6, 0xED, 0xE4, 0x32, 0xFF, 0x35, 0x02, 0xFF, 0xFF, 0x01, 0x72, 0xF7,
+  0x5F, 0xC8, 0xF6, 0xE4, 0x81, 0xE3, 0xFE, 0xFF, 0x03, 0xE6, 0xFE, 0xFF, 0x06,
+  0xF7, 0xFF, 0x08, 0xF7, 0xFF, 0x09, 0xFF, 0xFF, 0x82, 0x2A, 0xFF, 0xFF, 0x01,
+  0x4B, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0x84, 0x2C, 0xFF, 0xFF, 0x81, 0x2B, 0xFF,
+  0xFF, 0x01, 0x2A, 0xF7, 0xFF, 0x29, 0xFF, 0xFF, 0x81, 0x08, 0xFF, 0xFF, 0x05,
+  0x06, 0xFF, 0xFF, 0x84, 0xFE, 0xFF, 0xE1, 0xF5, 0xFF, 0xE2, 0xED, 0xFF, 0x4A,
+  0xEE, 0xA8, 0xD7, 0xFF, 0x08, 0x07, 0x00, 0x00, 0x00, 0xD6, 0xFF, 0x20, 0xEA,
+  0xEE, 0xB7, 0xC4, 0xF6, 0xFD, 0xE4, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0x06, 0xF7,
+  0xFF, 0x07, 0xFF, 0xFF, 0x81, 0x09, 0xFF, 0xFF, 0x81, 0x2A, 0xFF, 0xFF, 0x81,
+  0x2B, 0xFF, 0xFF, 0x83, 0x2C, 0xFF, 0xFF, 0x82, 0x2B, 0xFF, 0xFF, 0x09, 0x2A,
+  0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xE8, 0xFE, 0xFF, 0xC5, 0xFE,
+  0xFF, 0x41, 0xEE, 0xFF, 0xE1, 0xF5, 0xFF, 0xE4, 0xE5, 0xF9, 0xAE, 0xF6, 0x65,
+  0xF7, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x06, 0x70, 0xF7, 0x64,
+  0xC7, 0xEE, 0xE7, 0xE4, 0xF6, 0xFF, 0xE5, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0x07,
+  0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x81, 0x2A, 0xFF, 0xFF, 0x86,
+  0x2B, 0xFF, 0xFF, 0x02, 0x4A, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x09, 0xFF, 0xFF,
+  0x81, 0x08, 0xFF, 0xFF, 0x06, 0xE7, 0xFE, 0xFF, 0x63, 0xF6, 0xFF, 0x00, 0xEE,
+  0xFF, 0xC1, 0xED, 0xFF, 0x09, 0xEE, 0xC8, 0x32, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x08, 0xB6, 0xFF, 0x18, 0x0C, 0xF7, 0xAA, 0xE5, 0xEE,
+  0xFB, 0xE4, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0xE7, 0xFE, 0xFF, 0x08, 0xFF, 0xFF,
+  0x28, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x81, 0x2A, 0xFF, 0xFF, 0x84, 0x2B, 0xFF,
+  0xFF, 0x81, 0x4A, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0xFF, 0x81, 0x08, 0xFF, 0xFF,
+  0x07, 0x07, 0xFF, 0xFF, 0x85, 0xFE, 0xFF, 0x21, 0xF6, 0xFF, 0xE1, 0xED, 0xFF,
+  0x05, 0xE6, 0xF2, 0xAF, 0xF6, 0x5C, 0xF9, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x81,
+  0x00, 0x00, 0x00, 0x09, 0xDA, 0xFF, 0x03, 0x72, 0xF7, 0x51, 0xE7, 0xEE, 0xDB,
+  0xE4, 0xF6, 0xFF, 0xC5, 0xFE, 0xFF, 0xE6, 0xFE, 0xFF, 0x07, 0xF7, 0xFF, 0x27,
+  0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x81, 0x2A, 0xFF, 0xFF, 0x82,
+  0x2B, 0xFF, 0xFF, 0x82, 0x2A, 0xFF, 0xFF, 0x08, 0x29, 0xFF, 0xFF, 0x28, 0xFF,
+  0xFF, 0x07, 0xFF, 0xFF, 0xC6, 0xFE, 0xFF, 0x22, 0xFE, 0xFF, 0xE0, 0xF5, 0xFF,
+  0xE3, 0xE5, 0xFD, 0x6B, 0xEE, 0xB5, 0x33, 0xF7, 0x10, 0x81, 0x00, 0x00, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x05, 0xD7, 0xFF, 0x14, 0x4D, 0xF7, 0x89, 0xE6, 0xEE,
+  0xF1, 0xE5, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF, 0x06, 0xFF, 0xFF, 0x81, 0x07, 0xFF,
+  0xFF, 0x01, 0x08, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x84, 0x2A, 0xFF, 0xFF, 0x81,
+  0x0A, 0xFF, 0xFF, 0x08, 0x08, 0xFF, 0xFF, 0x27, 0xF7, 0xFF, 0x06, 0xFF, 0xFF,
+  0x83, 0xF6, 0xFF, 0xE0, 0xF5, 0xFF, 0xE2, 0xED, 0xFF, 0x07, 0xE6, 0xDE, 0x31,
+  0xF7, 0x36, 0xB7, 0xFF, 0x01, 0x81, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0x04, 0xD4, 0xFF, 0x25, 0xEB, 0xEE, 0xA9, 0xE5, 0xF6, 0xFF, 0xE4, 0xF6, 0xFF,
+  0xE5, 0xFE, 0xFF, 0x81, 0x06, 0xFF, 0xFF, 0x02, 0x07, 0xFF, 0xFF, 0x08, 0xFF,
+  0xFF, 0x09, 0xFF, 0xFF, 0x83, 0x29, 0xFF, 0xFF, 0x81, 0x09, 0xFF, 0xFF, 0x06,
+  0x28, 0xFF, 0xFF, 0x07, 0xF7, 0xFF, 0xE5, 0xFE, 0xFF, 0x21, 0xEE, 0xFF, 0xE0,
+  0xED, 0xFF, 0xE5, 0xED, 0xF2, 0x8C, 0xEE, 0x60, 0x83, 0x00, 0x00, 0x00, 0x83,
+  0x00, 0x00, 0x00, 0x06, 0xF7, 0xFF, 0x01, 0x72, 0xFF, 0x45, 0xE8, 0xEE, 0xD4,
+  0xE4, 0xF6, 0xFF, 0xC4, 0xFE, 0xFF, 0xE5, 0xFE, 0xFF, 0x06, 0xFF, 0xFF, 0x81,
+  0x07, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0xFF, 0x81, 0x29, 0xFF, 0xFF, 0x81, 0x09,
+  0xFF, 0xFF, 0x08, 0x08, 0xFF, 0xFF, 0x07, 0xF7, 0xFF, 0x07, 0xFF, 0xFF, 0xE7,
+  0xFE, 0xFF, 0x84, 0xFE, 0xFF, 0x00, 0xEE, 0xFF, 0xE2, 0xE5, 0xFF, 0x6B, 0xEE,
+  0x94, 0x74, 0xFF, 0x11, 0x83, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x06,
+  0xD5, 0xFF, 0x10, 0x2D, 0xEF, 0x98, 0xE4, 0xF6, 0xFE, 0xC3, 0xFE, 0xFF, 0xE4,
+  0xFE, 0xFF, 0xE5, 0xF6, 0xFF, 0x06, 0xFF, 0xFF, 0x81, 0x07, 0xFF, 0xFF, 0x83,
+  0x08, 0xFF, 0xFF, 0x07, 0x07, 0xFF, 0xFF, 0x06, 0xF7, 0xFF, 0x06, 0xFF, 0xFF,
+  0xC7, 0xFE, 0xFF, 0x43, 0xFE, 0xFF, 0xE0, 0xED, 0xFF, 0x05, 0xE6, 0xE7, 0x31,
+  0xF7, 0x51, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x05, 0xDA, 0xFF,
+  0x07, 0x73, 0xF7, 0x53, 0xC5, 0xEE, 0xF4, 0xC3, 0xFE, 0xFF, 0xC4, 0xFE, 0xFF,
+  0xE4, 0xF6, 0xFF, 0x81, 0x05, 0xFF, 0xFF, 0x00, 0x06, 0xFF, 0xFF, 0x83, 0x07,
+  0xFF, 0xFF, 0x81, 0xE6, 0xFE, 0xFF, 0x05, 0x05, 0xFF, 0xFF, 0xA5, 0xFE, 0xFF,
+  0x02, 0xFE, 0xFF, 0xC0, 0xED, 0xFF, 0x27, 0xEE, 0xB6, 0x77, 0xFF, 0x24, 0x84,
+  0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xFF, 0x00, 0xB6, 0xFF,
+  0x1D, 0xE7, 0xEE, 0xD5, 0xA3, 0xFE, 0xFF, 0xC3, 0xFE, 0xFF, 0xE4, 0xFE, 0xFF,
+  0x04, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0x85, 0x06, 0xFF, 0xFF, 0x06, 0xE5, 0xFE,
+  0xFF, 0x24, 0xFF, 0xFF, 0xA3, 0xFE, 0xFF, 0x02, 0xF6, 0xFF, 0xC2, 0xED, 0xFE,
+  0xAC, 0xF6, 0x82, 0xB8, 0xFF, 0x06, 0x84, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00,
+  0x00, 0x04, 0xF8, 0xFF, 0x0B, 0x0A, 0xF7, 0x9F, 0xC3, 0xF6, 0xF8, 0xC2, 0xFE,
+  0xFF, 0xC3, 0xFE, 0xFF, 0x81, 0xE4, 0xFE, 0xFF, 0x00, 0xE5, 0xFE, 0xFF, 0x82,
+  0xE6, 0xFE, 0xFF, 0x08, 0xE5, 0xFE, 0xFF, 0x05, 0xF7, 0xFF, 0x04, 0xF7, 0xFF,
+  0xE2, 0xFE, 0xFF, 0x61, 0xF6, 0xFF, 0x01, 0xEE, 0xFF, 0xE4, 0xE5, 0xF1, 0x53,
+  0xFF, 0x4C, 0xFA, 0xFF, 0x05, 0x84, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x03, 0x4E, 0xF7, 0x5E, 0xC4, 0xF6, 0xEC, 0xC2, 0xF6, 0xFF, 0xC3, 0xFE, 0xFF,
+  0x81, 0xE3, 0xFE, 0xFF, 0x01, 0xE3, 0xF6, 0xFF, 0xE4, 0xF6, 0xFF, 0x81, 0x04,
+  0xF7, 0xFF, 0x82, 0xE4, 0xF6, 0xFF, 0x04, 0xA2, 0xFE, 0xFF, 0xE0, 0xF5, 0xFF,
+  0xE1, 0xED, 0xFF, 0x27, 0xDE, 0xD0, 0xD7, 0xFF, 0x22, 0x85, 0x00, 0x00, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x03, 0x73, 0xFF, 0x30, 0xC8, 0xEE, 0xD0, 0xC3, 0xF6,
+  0xFC, 0xC2, 0xF6, 0xFF, 0x81, 0xE2, 0xFE, 0xFF, 0x83, 0xE3, 0xFE, 0xFF, 0x07,
+  0xE2, 0xFE, 0xFF, 0xC3, 0xFE, 0xFF, 0x82, 0xFE, 0xFF, 0xE0, 0xFD, 0xFF, 0xA1,
+  0xFD, 0xFF, 0xE3, 0xED, 0xF7, 0x8C, 0xE6, 0x97, 0xFB, 0xFF, 0x09, 0x85, 0x00,
+  0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x05, 0xD7, 0xFF, 0x0E, 0x0E, 0xEF, 0x73,
+  0xC6, 0xEE, 0xE6, 0xC3, 0xF6, 0xFF, 0xC2, 0xF6, 0xFF, 0xE2, 0xFE, 0xFF, 0x81,
+  0xC2, 0xFE, 0xFF, 0x81, 0xA3, 0xFE, 0xFF, 0x06, 0x82, 0xF6, 0xFF, 0x41, 0xF6,
+  0xFF, 0x01, 0xEE, 0xFF, 0xC1, 0xF5, 0xFF, 0xA4, 0xF5, 0xFC, 0x09, 0xE6, 0xC7,
+  0x53, 0xF7, 0x4F, 0x86, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0F, 0xB4,
+  0xFF, 0x18, 0x4E, 0xF7, 0x7A, 0xEA, 0xEE, 0xD5, 0xA9, 0xEE, 0xF0, 0xA9, 0xEE,
+  0xF3, 0x88, 0xEE, 0xF4, 0x48, 0xEE, 0xF3, 0x28, 0xE6, 0xF3, 0x27, 0xE6, 0xF3,
+  0x07, 0xE6, 0xF3, 0x07, 0xDE, 0xF2, 0x06, 0xDE, 0xF2, 0xE7, 0xE5, 0xEB, 0x4C,
+  0xEE, 0xB8, 0x12, 0xF7, 0x55, 0xB8, 0xFF, 0x09, 0x86, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x0D, 0xB7, 0xF7, 0x01, 0x13, 0xBE, 0x34, 0x8D, 0x94, 0x8B,
+  0xAD, 0x94, 0x9D, 0x8D, 0x94, 0xA2, 0x6D, 0x94, 0xA1, 0x6D, 0x94, 0xA0, 0x6D,
+  0x94, 0x9E, 0x4D, 0x94, 0x9C, 0x2C, 0x8C, 0x97, 0x4D, 0x8C, 0x8D, 0x2D, 0x8C,
+  0x7E, 0xD0, 0x9C, 0x49, 0x3C, 0xEF, 0x04, 0x87, 0x00, 0x00, 0x00, 0x88, 0x00,
+  0x00, 0x00, 0x04, 0x9A, 0xCE, 0x01, 0x0B, 0x5B, 0x71, 0x89, 0x4A, 0xF2, 0x89,
+  0x52, 0xFD, 0x88, 0x52, 0xFF, 0x84, 0x89, 0x52, 0xFF, 0x03, 0x89, 0x52, 0xFB,
+  0x8A, 0x5A, 0xF1, 0x0C, 0x63, 0xAF, 0xB6, 0xBD, 0x11, 0x87, 0x00, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x0C, 0x6D, 0x6B, 0x21, 0x4D, 0x6B, 0x73, 0x4D, 0x6B,
+  0x86, 0x4D, 0x6B, 0x8E, 0x6D, 0x73, 0x90, 0x6D, 0x6B, 0x91, 0x6D, 0x6B, 0x90,
+  0x4D, 0x6B, 0x8E, 0x4D, 0x6B, 0x89, 0x2D, 0x6B, 0x80, 0x2D, 0x6B, 0x77, 0x6D,
+  0x73, 0x3A, 0x17, 0xC6, 0x03, 0x87, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x0D, 0x59, 0xCE, 0x01, 0x2C, 0x63, 0x4F, 0x89, 0x4A, 0xB7, 0x69, 0x4A, 0xD0,
+  0x8A, 0x52, 0xE7, 0x6A, 0x52, 0xF6, 0x8A, 0x52, 0xFB, 0x8A, 0x52, 0xFA, 0x8A,
+  0x52, 0xF3, 0x69, 0x4A, 0xE7, 0x69, 0x4A, 0xD5, 0x8A, 0x52, 0xBE, 0x2C, 0x63,
+  0x79, 0xB6, 0xB5, 0x08, 0x87, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x0D,
+  0x59, 0xCE, 0x00, 0x0C, 0x63, 0x31, 0x69, 0x4A, 0x84, 0x8A, 0x52, 0x99, 0xAA,
+  0x52, 0xAB, 0xAA, 0x52, 0xB6, 0xAA, 0x52, 0xB8, 0xAA, 0x52, 0xB4, 0x8A, 0x52,
+  0xAB, 0x8A, 0x52, 0x9F, 0x69, 0x4A, 0x8E, 0x69, 0x4A, 0x81, 0xEB, 0x5A, 0x4A,
+  0x18, 0xC6, 0x02, 0x87, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x0B, 0x79,
+  0xCE, 0x02, 0x6D, 0x6B, 0x73, 0xEB, 0x5A, 0xA3, 0x4C, 0x63, 0xAA, 0x2C, 0x63,
+  0xB3, 0x2C, 0x63, 0xB6, 0x2C, 0x63, 0xB5, 0x0C, 0x63, 0xAF, 0x0C, 0x63, 0xA3,
+  0x0C, 0x63, 0x95, 0x2C, 0x63, 0x85, 0x14, 0xA5, 0x1D, 0x88, 0x00, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x03, 0x79, 0xCE, 0x08, 0x2D, 0x6B, 0xAE, 0xCB, 0x5A,
+  0xE8, 0xCB, 0x5A, 0xF3, 0x81, 0xCB, 0x5A, 0xF2, 0x05, 0xCB, 0x5A, 0xF3, 0xCB,
+  0x5A, 0xF0, 0xCB, 0x5A, 0xE8, 0xCB, 0x5A, 0xDD, 0xCB, 0x5A, 0xD1, 0xD3, 0x9C,
+  0x38, 0x88, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x0A, 0xF4, 0xA4, 0x23,
+  0xCF, 0x7B, 0x74, 0xEF, 0x7B, 0x7F, 0xCF, 0x7B, 0x80, 0xCE, 0x73, 0x7F, 0xCF,
+  0x7B, 0x7F, 0xAF, 0x7B, 0x7C, 0x6E, 0x73, 0x71, 0x0C, 0x63, 0x69, 0x10, 0x84,
+  0x34, 0xF7, 0xBD, 0x02, 0x88, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x04,
+  0x75, 0xAD, 0x1C, 0x6E, 0x73, 0xB9, 0xCB, 0x5A, 0xF9, 0xAA, 0x52, 0xFF, 0x8A,
+  0x52, 0xFF, 0x81, 0xAA, 0x52, 0xFF, 0x03, 0xAA, 0x52, 0xFA, 0xEB, 0x5A, 0xD7,
+  0x92, 0x94, 0x3B, 0x7D, 0xEF, 0x00, 0x88, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00,
+  0x00, 0x09, 0xFF, 0xFF, 0x01, 0x18, 0xC6, 0x1A, 0x30, 0x84, 0x67, 0xEF, 0x7B,
+  0xB4, 0xAE, 0x73, 0xD5, 0x8E, 0x73, 0xD7, 0xCF, 0x7B, 0xB7, 0xCF, 0x7B, 0x73,
+  0x55, 0xAD, 0x2B, 0xFF, 0xFF, 0x03, 0x89, 0x00, 0x00, 0x00,
 };
 const lv_img_dsc_t ui_img_light_on_icon_1_png = {
   .header.always_zero = 0,
-  .header.w = 53,
-  .header.h = 76,
+  .header.w = 31,
+  .header.h = 45,
   .data_size = sizeof(ui_img_light_on_icon_1_png_data),
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = ui_img_light_on_icon_1_png_data
 };
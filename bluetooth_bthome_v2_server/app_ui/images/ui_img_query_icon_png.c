@@ -10,6550 +10,2767 @@
 #endif
 
 // IMAGE DATA: assets\query_icon.png
+// RLE encoded by tools/img_rle_convert.py, 83664 bytes raw
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_query_icon_png_data[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xF7, 0xFD, 0x04, 0x57, 0xFF, 0x0B, 0xD6, 0xF6, 0x1A,
-  0xD5, 0xFE, 0x27, 0xB5, 0xF6, 0x32, 0xB4, 0xF6, 0x3B, 0x93, 0xF6, 0x4A, 0x72,
-  0xEE, 0x5A, 0x52, 0xEE, 0x67, 0x52, 0xEE, 0x6F, 0x52, 0xEE, 0x72, 0x52, 0xEE,
-  0x72, 0x52, 0xF6, 0x6F, 0x52, 0xF6, 0x67, 0x53, 0xF6, 0x5C,
-  0x74, 0xFE, 0x4B, 0xB4, 0xF6, 0x3C, 0xB5, 0xF6, 0x32, 0xD5, 0xF6, 0x29, 0xB7,
-  0xF6, 0x19, 0x57, 0xFF, 0x0B, 0xF5, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0xF5, 0xFF, 0x03, 0xF4, 0xFE,
-  0x16, 0x50, 0xFE, 0x55, 0xEE, 0xF5, 0x94, 0x6B, 0xED, 0xD0, 0x4A, 0xED, 0xEB,
-  0x49, 0xF5, 0xF2, 0x48, 0xF5, 0xFB, 0x28, 0xED, 0xFF, 0x27, 0xED, 0xFF, 0x07,
-  0xED, 0xFF, 0x07, 0xED, 0xFF, 0x07, 0xED, 0xFF, 0x06, 0xED, 0xFF, 0x06, 0xED,
-  0xFF, 0x06, 0xED, 0xFF, 0x06, 0xED, 0xFF, 0xE6, 0xEC, 0xFF, 0x06, 0xED, 0xFF,
-  0x06, 0xED, 0xFF, 0x07, 0xED, 0xFF, 0x07, 0xED, 0xFF, 0x08, 0xED, 0xFF, 0x28,
+  0x52, 0x4C, 0x45, 0x03, 0x00, 0x00, 0x08, 0x00, 0x52, 0x00, 0xB2, 0x00, 0x07,
+  0x01, 0x71, 0x01, 0xDD, 0x01, 0x6B, 0x02, 0x02, 0x03, 0xCE, 0x03, 0xA6, 0x04,
+  0x3F, 0x05, 0x22, 0x06, 0x0B, 0x07, 0xD9, 0x07, 0xB4, 0x08, 0x95, 0x09, 0x47,
+  0x0A, 0xFC, 0x0A, 0xB9, 0x0B, 0x7B, 0x0C, 0x45, 0x0D, 0x15, 0x0E, 0xEB, 0x0E,
+  0xCC, 0x0F, 0x85, 0x10, 0x3C, 0x11, 0xFB, 0x11, 0xB8, 0x12, 0x74, 0x13, 0x31,
+  0x14, 0x05, 0x15, 0xE8, 0x15, 0xD0, 0x16, 0x99, 0x17, 0x5E, 0x18, 0x3D, 0x19,
+  0x11, 0x1A, 0xD5, 0x1A, 0xAE, 0x1B, 0x8F, 0x1C, 0x95, 0x1D, 0xAC, 0x1E, 0xC3,
+  0x1F, 0xE2, 0x20, 0x00, 0x22, 0x1E, 0x23, 0x35, 0x24, 0x64, 0x25, 0x89, 0x26,
+  0x95, 0x27, 0xB1, 0x28, 0xD1, 0x29, 0xEF, 0x2A, 0x19, 0x2C, 0x56, 0x2D, 0x8C,
+  0x2E, 0xB5, 0x2F, 0xF3, 0x30, 0x22, 0x32, 0x65, 0x33, 0xA6, 0x34, 0xCE, 0x35,
+  0x0E, 0x37, 0x54, 0x38, 0x7B, 0x39, 0x80, 0x3A, 0x7F, 0x3B, 0x7D, 0x3C, 0x8C,
+  0x3D, 0xAA, 0x3E, 0xCC, 0x3F, 0xEF, 0x40, 0xF9, 0x41, 0xE9, 0x42, 0xD8, 0x43,
+  0xC4, 0x44, 0xC6, 0x45, 0xC5, 0x46, 0xE2, 0x47, 0xF7, 0x48, 0xE9, 0x49, 0xCC,
+  0x4A, 0xB1, 0x4B, 0x90, 0x4C, 0x6A, 0x4D, 0x42, 0x4E, 0x17, 0x4F, 0xF1, 0x4F,
+  0xC0, 0x50, 0xA1, 0x51, 0x7A, 0x52, 0x59, 0x53, 0x31, 0x54, 0x01, 0x55, 0xDC,
+  0x55, 0xC4, 0x56, 0xB9, 0x57, 0x9F, 0x58, 0x81, 0x59, 0x6A, 0x5A, 0x4A, 0x5B,
+  0x21, 0x5C, 0x00, 0x5D, 0xE9, 0x5D, 0xCA, 0x5E, 0x9F, 0x5F, 0x75, 0x60, 0x47,
+  0x61, 0x0E, 0x62, 0xD6, 0x62, 0xA6, 0x63, 0x8B, 0x64, 0x9F, 0x65, 0xA8, 0x66,
+  0xA5, 0x67, 0x98, 0x68, 0x7D, 0x69, 0x6D, 0x6A, 0x5C, 0x6B, 0x3A, 0x6C, 0x0B,
+  0x6D, 0xEC, 0x6D, 0xB4, 0x6E, 0x84, 0x6F, 0x40, 0x70, 0x03, 0x71, 0xC0, 0x71,
+  0x9A, 0x72, 0x80, 0x73, 0x37, 0x74, 0xF0, 0x74, 0xA4, 0x75, 0x49, 0x76, 0xF4,
+  0x76, 0x97, 0x77, 0x2F, 0x78, 0xEB, 0x78, 0xA1, 0x79, 0x5B, 0x7A, 0x0A, 0x7B,
+  0xB0, 0x7B, 0x52, 0x7C, 0xF5, 0x7C, 0xB2, 0x7D, 0xA9, 0x7E, 0x99, 0x7F, 0x88,
+  0x80, 0x69, 0x81, 0x46, 0x82, 0x29, 0x83, 0x17, 0x84, 0xFE, 0x84, 0xBC, 0x85,
+  0x8F, 0x86, 0x56, 0x87, 0xDE, 0x87, 0x4F, 0x88, 0xCE, 0x88, 0x3C, 0x89, 0xA3,
+  0x89, 0x08, 0x8A, 0x5C, 0x8A, 0x64, 0x8A, 0x6C, 0x8A, 0x74, 0x8A, 0xFF, 0x00,
+  0x00, 0x00, 0xA7, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00, 0x09, 0xF7, 0xFD,
+  0x04, 0x57, 0xFF, 0x0B, 0xD6, 0xF6, 0x1A, 0xD5, 0xFE, 0x27, 0xB5, 0xF6, 0x32,
+  0xB4, 0xF6, 0x3B, 0x93, 0xF6, 0x4A, 0x72, 0xEE, 0x5A, 0x52, 0xEE, 0x67, 0x52,
+  0xEE, 0x6F, 0x81, 0x52, 0xEE, 0x72, 0x09, 0x52, 0xF6, 0x6F, 0x52, 0xF6, 0x67,
+  0x53, 0xF6, 0x5C, 0x74, 0xFE, 0x4B, 0xB4, 0xF6, 0x3C, 0xB5, 0xF6, 0x32, 0xD5,
+  0xF6, 0x29, 0xB7, 0xF6, 0x19, 0x57, 0xFF, 0x0B, 0xF5, 0xFF, 0x03, 0xC8, 0x00,
+  0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x02, 0xF5, 0xFF, 0x03,
+  0xF4, 0xFE, 0x16, 0x50, 0xFE, 0x55, 0xEE, 0xF5, 0x94, 0x6B, 0xED, 0xD0, 0x4A,
+  0xED, 0xEB, 0x49, 0xF5, 0xF2, 0x48, 0xF5, 0xFB, 0x28, 0xED, 0xFF, 0x27, 0xED,
+  0xFF, 0x82, 0x07, 0xED, 0xFF, 0x83, 0x06, 0xED, 0xFF, 0x00, 0xE6, 0xEC, 0xFF,
+  0x81, 0x06, 0xED, 0xFF, 0x81, 0x07, 0xED, 0xFF, 0x0A, 0x08, 0xED, 0xFF, 0x28,
   0xED, 0xFF, 0x29, 0xF5, 0xFC, 0x49, 0xED, 0xF3, 0x69, 0xED, 0xEC, 0x6A, 0xED,
   0xD2, 0xED, 0xF5, 0x96, 0x50, 0xFE, 0x58, 0xB3, 0xFE, 0x19, 0xF5, 0xFF, 0x03,
-  0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFE, 0x05, 0xF7,
-  0xFE, 0x28, 0x94, 0xF6, 0x5A, 0x11, 0xEE, 0x90, 0xAF, 0xE5, 0xC6, 0x4C, 0xE5,
-  0xF3, 0x29, 0xE5, 0xFF, 0x27, 0xED, 0xFF, 0x06, 0xF5, 0xFF,
-  0x05, 0xF5, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD,
-  0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x05, 0xF5, 0xFF, 0x07, 0xED, 0xFF,
-  0x28, 0xED, 0xFF, 0x6A, 0xE5, 0xF1, 0xAD, 0xE5, 0xC6, 0x10, 0xEE, 0x8F, 0x93,
-  0xF6, 0x5C, 0x16, 0xFF, 0x29, 0xF5, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xF5, 0xFF, 0x03, 0x15, 0xFF, 0x09, 0xB2, 0xFE, 0x20, 0xED,
-  0xFD, 0x88, 0x29, 0xED, 0xF5, 0xE7, 0xEC, 0xFF, 0xE7, 0xEC, 0xFF, 0xE6, 0xF4,
-  0xFF, 0xE6, 0xF4, 0xFF, 0xE5, 0xF4, 0xFF, 0xE5, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF,
-  0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0x04, 0xFD, 0xFF, 0x04, 0xF5, 0xFF, 0x04, 0xF5, 0xFF, 0x05, 0xF5, 0xFF, 0x05,
-  0xED, 0xFF, 0x05, 0xED, 0xFF, 0x06, 0xED, 0xFF, 0x07, 0xE5, 0xFF, 0x49, 0xE5,
-  0xF5, 0xED, 0xF5, 0x8E, 0xB3, 0xFE, 0x25, 0xF7, 0xFE, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xB7, 0xFE, 0x0C, 0x74, 0xF6, 0x57, 0xD0, 0xED, 0xB2, 0x4B,
-  0xE5, 0xEA, 0x08, 0xE5, 0xFF, 0x05, 0xF5, 0xFF, 0x04, 0xFD, 0xFF, 0xC3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2,
-  0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xF5,
-  0xFF, 0x05, 0xF5, 0xFF, 0x06, 0xED, 0xFF, 0x28, 0xE5, 0xFF, 0x4B, 0xE5, 0xEA,
-  0xCF, 0xE5, 0xB6, 0x53, 0xEE, 0x5D, 0x36, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFE, 0x0C,
-  0xD3, 0xFE, 0x34, 0xCE, 0xFD, 0x8B, 0x6A, 0xF5, 0xF6, 0xE7, 0xEC, 0xFF, 0xC5,
-  0xEC, 0xFF, 0x05, 0xF5, 0xFF, 0x25, 0xFD, 0xFF, 0x04, 0xF5, 0xFF, 0xC3, 0xF4,
-  0xFF, 0xC3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
-  0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03,
-  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xC4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF,
-  0xC2, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD,
-  0xFF, 0x04, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0x05, 0xFD, 0xFF, 0x06, 0xF5, 0xFF, 0xE7, 0xEC, 0xFF, 0x08, 0xED, 0xFF, 0x4A,
-  0xF5, 0xF9, 0x8C, 0xF5, 0x94, 0xB2, 0xFE, 0x37, 0xD4, 0xFE, 0x0E, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xFE, 0x0B,
-  0x52, 0xF6, 0x6C, 0x8C, 0xED, 0xED, 0xE8, 0xE4, 0xFF, 0xE6, 0xF4, 0xFF, 0xE4,
-  0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03,
-  0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0x04, 0xF5, 0xFF, 0x04, 0xF5, 0xFF, 0x05, 0xF5,
-  0xFF, 0xE5, 0xF4, 0xFF, 0xE5, 0xF4, 0xFF, 0xE6, 0xF4, 0xFF, 0xC6, 0xF4, 0xFF,
-  0xE6, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x05,
-  0xF5, 0xFF, 0x06, 0xF5, 0xFF, 0x06, 0xF5, 0xFF, 0x06, 0xF5, 0xFF, 0x06, 0xF5,
-  0xFF, 0x06, 0xF5, 0xFF, 0x06, 0xF5, 0xFF, 0x05, 0xF5, 0xFF, 0xE5, 0xF4, 0xFF,
-  0xE5, 0xF4, 0xFF, 0xE4, 0xF4, 0xFF, 0xE4, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4,
-  0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0xE7, 0xE4,
-  0xFF, 0x8B, 0xED, 0xF4, 0x30, 0xF6, 0x73, 0x76, 0xFE, 0x0A, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x04, 0xB3, 0xFE, 0x2A, 0xEF, 0xFD, 0x8E,
-  0x4B, 0xF5, 0xEC, 0xE7, 0xF4, 0xFF, 0xE6, 0xF4, 0xFF, 0x05, 0xF5, 0xFF, 0xE4,
-  0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE5, 0xFC,
-  0xFF, 0xE6, 0xF4, 0xFF, 0x07, 0xED, 0xFF, 0x08, 0xED, 0xFF, 0x09, 0xE5, 0xFF,
-  0x4A, 0xE5, 0xFF, 0x6B, 0xE5, 0xFF, 0x8C, 0xE5, 0xF7, 0x8D, 0xE5, 0xE9, 0xAE,
-  0xE5, 0xDD, 0xAE, 0xE5, 0xD5, 0xCE, 0xED, 0xD1, 0xCE, 0xED, 0xCF, 0xAD, 0xED,
-  0xD2, 0xAD, 0xED, 0xD6, 0x8C, 0xED, 0xE2, 0x8C, 0xE5, 0xF1, 0x6B, 0xE5, 0xFF,
-  0x2A, 0xE5, 0xFF, 0x09, 0xE5, 0xFF, 0x08, 0xED, 0xFF, 0x07, 0xED, 0xFF, 0x07,
-  0xED, 0xFF, 0xE6, 0xEC, 0xFF, 0xE4, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04,
-  0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC,
-  0xFF, 0x04, 0xF5, 0xFF, 0x05, 0xED, 0xFF, 0x07, 0xED, 0xFF, 0x4A, 0xED, 0xF3,
-  0xEF, 0xF5, 0x91, 0xB4, 0xFE, 0x30, 0xF5, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x03, 0xB4, 0xFE, 0x1F, 0xEF, 0xF5, 0xA4,
-  0x2A, 0xED, 0xFF, 0xE7, 0xF4, 0xFF, 0xC5, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3,
+  0xFF, 0xFF, 0x01, 0xC2, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0A, 0x79,
+  0xFE, 0x05, 0xF7, 0xFE, 0x28, 0x94, 0xF6, 0x5A, 0x11, 0xEE, 0x90, 0xAF, 0xE5,
+  0xC6, 0x4C, 0xE5, 0xF3, 0x29, 0xE5, 0xFF, 0x27, 0xED, 0xFF, 0x06, 0xF5, 0xFF,
+  0x05, 0xF5, 0xFF, 0x04, 0xFD, 0xFF, 0x85, 0xE3, 0xFC, 0xFF, 0x81, 0x03, 0xFD,
+  0xFF, 0x8C, 0xE3, 0xFC, 0xFF, 0x09, 0x04, 0xFD, 0xFF, 0x05, 0xF5, 0xFF, 0x07,
+  0xED, 0xFF, 0x28, 0xED, 0xFF, 0x6A, 0xE5, 0xF1, 0xAD, 0xE5, 0xC6, 0x10, 0xEE,
+  0x8F, 0x93, 0xF6, 0x5C, 0x16, 0xFF, 0x29, 0xF5, 0xFF, 0x03, 0xBE, 0x00, 0x00,
+  0x00, 0xBA, 0x00, 0x00, 0x00, 0x04, 0xF5, 0xFF, 0x03, 0x15, 0xFF, 0x09, 0xB2,
+  0xFE, 0x20, 0xED, 0xFD, 0x88, 0x29, 0xED, 0xF5, 0x81, 0xE7, 0xEC, 0xFF, 0x81,
+  0xE6, 0xF4, 0xFF, 0x81, 0xE5, 0xF4, 0xFF, 0x02, 0xE4, 0xFC, 0xFF, 0x03, 0xFD,
+  0xFF, 0xE3, 0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x84, 0xE3, 0xFC, 0xFF, 0x01,
+  0x03, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0x8B, 0xE3, 0xFC, 0xFF, 0x02, 0xE2, 0xFC,
+  0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x81, 0x04, 0xF5, 0xFF, 0x00, 0x05,
+  0xF5, 0xFF, 0x81, 0x05, 0xED, 0xFF, 0x05, 0x06, 0xED, 0xFF, 0x07, 0xE5, 0xFF,
+  0x49, 0xE5, 0xF5, 0xED, 0xF5, 0x8E, 0xB3, 0xFE, 0x25, 0xF7, 0xFE, 0x08, 0xBB,
+  0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x07, 0xB7, 0xFE, 0x0C, 0x74, 0xF6,
+  0x57, 0xD0, 0xED, 0xB2, 0x4B, 0xE5, 0xEA, 0x08, 0xE5, 0xFF, 0x05, 0xF5, 0xFF,
+  0x04, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0x82, 0xE3, 0xFC, 0xFF, 0x85, 0xE2, 0xFC,
+  0xFF, 0x83, 0xE3, 0xFC, 0xFF, 0x00, 0xC3, 0xFC, 0xFF, 0x84, 0xE3, 0xFC, 0xFF,
+  0x82, 0xE4, 0xFC, 0xFF, 0x84, 0xE3, 0xFC, 0xFF, 0x83, 0xE2, 0xFC, 0xFF, 0x81,
+  0x03, 0xFD, 0xFF, 0x01, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x81, 0x02, 0xFD,
+  0xFF, 0x08, 0x03, 0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0x05, 0xF5, 0xFF, 0x06, 0xED,
+  0xFF, 0x28, 0xE5, 0xFF, 0x4B, 0xE5, 0xEA, 0xCF, 0xE5, 0xB6, 0x53, 0xEE, 0x5D,
+  0x36, 0xFF, 0x0A, 0xB8, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, 0x0A, 0xB5,
+  0xFE, 0x0C, 0xD3, 0xFE, 0x34, 0xCE, 0xFD, 0x8B, 0x6A, 0xF5, 0xF6, 0xE7, 0xEC,
+  0xFF, 0xC5, 0xEC, 0xFF, 0x05, 0xF5, 0xFF, 0x25, 0xFD, 0xFF, 0x04, 0xF5, 0xFF,
+  0xC3, 0xF4, 0xFF, 0xC3, 0xFC, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x81, 0x03, 0xFD,
+  0xFF, 0x81, 0x02, 0xFD, 0xFF, 0x83, 0x03, 0xFD, 0xFF, 0x01, 0xE3, 0xFC, 0xFF,
+  0xE4, 0xFC, 0xFF, 0x82, 0xC4, 0xFC, 0xFF, 0x82, 0xC2, 0xFC, 0xFF, 0x00, 0xC3,
+  0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x01, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
+  0x82, 0x04, 0xFD, 0xFF, 0x01, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x87, 0xE3,
+  0xFC, 0xFF, 0x00, 0xE2, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x09, 0xC3, 0xFC,
+  0xFF, 0xE4, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0x06, 0xF5, 0xFF, 0xE7, 0xEC, 0xFF,
+  0x08, 0xED, 0xFF, 0x4A, 0xF5, 0xF9, 0x8C, 0xF5, 0x94, 0xB2, 0xFE, 0x37, 0xD4,
+  0xFE, 0x0E, 0xB5, 0x00, 0x00, 0x00, 0xB3, 0x00, 0x00, 0x00, 0x0D, 0x97, 0xFE,
+  0x0B, 0x52, 0xF6, 0x6C, 0x8C, 0xED, 0xED, 0xE8, 0xE4, 0xFF, 0xE6, 0xF4, 0xFF,
+  0xE4, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3,
   0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xE4, 0xF4, 0xFF, 0x05, 0xF5, 0xFF, 0x05, 0xF5, 0xFF, 0x06,
-  0xF5, 0xFF, 0xE6, 0xF4, 0xFF, 0x08, 0xF5, 0xFF, 0x09, 0xF5, 0xFF, 0x2A, 0xF5,
-  0xFF, 0x8C, 0xF5, 0xE7, 0xCE, 0xFD, 0x97, 0x51, 0xFE, 0x5A, 0xD3, 0xFE, 0x27,
-  0xB5, 0xFE, 0x0C, 0xB5, 0xFE, 0x06, 0xD6, 0xFE, 0x07, 0xD6, 0xFE, 0x07, 0xBA,
-  0xFE, 0x06, 0x79, 0xFE, 0x05, 0xF7, 0xFF, 0x04, 0xF5, 0xFF, 0x03, 0xF5, 0xFF,
-  0x03, 0xF7, 0xFD, 0x04, 0xF7, 0xFF, 0x04, 0x79, 0xFE, 0x05,
-  0xB5, 0xFE, 0x06, 0xD6, 0xFE, 0x07, 0xF3, 0xFE, 0x08, 0x33, 0xFF, 0x0A, 0xB2,
-  0xFE, 0x24, 0x51, 0xFE, 0x54, 0xEF, 0xF5, 0x93, 0xCD, 0xF5, 0xE1, 0x4A, 0xE5,
-  0xFF, 0x49, 0xED, 0xFF, 0x28, 0xED, 0xFF, 0x07, 0xED, 0xFF, 0x06, 0xED, 0xFF,
-  0xE5, 0xF4, 0xFF, 0xE5, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xC2, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0xE7, 0xEC, 0xFF, 0x2A, 0xE5, 0xFF, 0xEF,
-  0xED, 0xAB, 0xB4, 0xF6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x93, 0xFE, 0x21, 0xAD, 0xF5, 0xB4,
-  0x2A, 0xF5, 0xFF, 0xC7, 0xF4, 0xFF, 0xC5, 0xF4, 0xFF, 0xE5, 0xFC, 0xFF, 0x24,
-  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF,
-  0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xF4, 0xFF, 0x28, 0xED, 0xFF, 0x09,
-  0xE5, 0xFF, 0x4B, 0xE5, 0xFF, 0xCE, 0xED, 0xA3, 0x72, 0xFE, 0x55, 0xB5, 0xFE,
-  0x2F, 0xD6, 0xFE, 0x1B, 0x97, 0xFE, 0x0B, 0xF7, 0xFF, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF,
-  0x03, 0xF7, 0xFE, 0x08, 0xF7, 0xF6, 0x17, 0xB4, 0xF6, 0x2B, 0x52, 0xF6, 0x4E,
-  0xEE, 0xF5, 0x96, 0x6A, 0xED, 0xFA, 0x27, 0xED, 0xFF, 0x05, 0xED, 0xFF, 0x04,
-  0xF5, 0xFF, 0xE3, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD,
-  0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x05, 0xFD, 0xFF, 0xE4,
-  0xFC, 0xFF, 0xC4, 0xF4, 0xFF, 0x06, 0xED, 0xFF, 0x49, 0xED, 0xFF, 0xCD, 0xED,
-  0xBA, 0xD3, 0xFE, 0x28, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xD4, 0xF6, 0x1A, 0xEF, 0xF5, 0x84, 0x29, 0xED, 0xFF,
-  0x06, 0xF5, 0xFF, 0xC4, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x05, 0xF5, 0xFF,
-  0xE5, 0xE4, 0xFF, 0x06, 0xE5, 0xFF, 0x88, 0xF5, 0xFF, 0xAB, 0xF5, 0xD6, 0x10,
-  0xF6, 0x7B, 0xD5, 0xFE, 0x28, 0x36, 0xFF, 0x0A, 0xFF, 0xFF, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xD6, 0x0C,
-  0xFA, 0xC5, 0x28, 0x99, 0xB5, 0x40, 0xF6, 0xA4, 0x58, 0x54, 0x8C, 0x7A, 0x70,
-  0x73, 0x96, 0xAD, 0x5A, 0xB1, 0x2B, 0x4A, 0xC8, 0xCA, 0x41, 0xDC, 0x28, 0x31,
-  0xE8, 0x07, 0x31, 0xEE, 0x07, 0x29, 0xF1, 0xE7, 0x28, 0xF2, 0xE7, 0x28, 0xF2,
-  0x07, 0x29, 0xF1, 0x28, 0x29, 0xEF, 0x28, 0x31, 0xE9, 0xCB, 0x41, 0xDC, 0x0B,
-  0x4A, 0xC9, 0x8D, 0x5A, 0xB3, 0x50, 0x73, 0x99, 0x13, 0x8C, 0x7B, 0xD6, 0xA4,
-  0x59, 0x98, 0xBD, 0x41, 0xFA, 0xC5, 0x27, 0x9A, 0xD6, 0x0B, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFE, 0x06, 0xD3,
-  0xFE, 0x21, 0x2F, 0xFE, 0x74, 0x8B, 0xF5, 0xCF, 0x69, 0xED, 0xFF, 0x06, 0xED,
-  0xFF, 0xE5, 0xEC, 0xFF, 0x05, 0xF5, 0xFF, 0x24, 0xF5, 0xFF, 0x03, 0xF5, 0xFF,
-  0x03, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xC2,
-  0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xF4,
-  0xFF, 0x27, 0xED, 0xFF, 0x4A, 0xE5, 0xFF, 0xF0, 0xED, 0x8C, 0xB5, 0xF6, 0x1E,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xD6, 0xFE, 0x07, 0x70, 0xF6, 0x61, 0x49, 0xE5, 0xFF,
-  0x06, 0xED, 0xFF, 0x26, 0xFD, 0xFF, 0xC3, 0xF4, 0xFF, 0x02, 0xFD, 0xFF, 0x22,
-  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD,
-  0xFF, 0xE2, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xF4, 0xFF,
-  0x07, 0xED, 0xFF, 0x4A, 0xE5, 0xFF, 0xCE, 0xE5, 0xD4, 0x73, 0xEE, 0x3B, 0x57,
-  0xFF, 0x0B, 0xF7, 0xFD, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xB8, 0xCD, 0x3C, 0x4F, 0x7B, 0x90, 0xA9, 0x41, 0xD3,
-  0x08, 0x31, 0xE7, 0xE8, 0x28, 0xED, 0xE8, 0x28, 0xEF, 0xE8, 0x28, 0xEF, 0xE8,
+  0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x82, 0x03, 0xFD, 0xFF, 0x00, 0x03, 0xF5, 0xFF,
+  0x81, 0x04, 0xF5, 0xFF, 0x00, 0x05, 0xF5, 0xFF, 0x81, 0xE5, 0xF4, 0xFF, 0x02,
+  0xE6, 0xF4, 0xFF, 0xC6, 0xF4, 0xFF, 0xE6, 0xFC, 0xFF, 0x82, 0xE5, 0xFC, 0xFF,
+  0x00, 0x05, 0xF5, 0xFF, 0x85, 0x06, 0xF5, 0xFF, 0x00, 0x05, 0xF5, 0xFF, 0x81,
+  0xE5, 0xF4, 0xFF, 0x81, 0xE4, 0xF4, 0xFF, 0x00, 0x04, 0xFD, 0xFF, 0x87, 0xE3,
+  0xFC, 0xFF, 0x02, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x81,
+  0xE4, 0xFC, 0xFF, 0x81, 0xC4, 0xFC, 0xFF, 0x04, 0xE6, 0xF4, 0xFF, 0xE7, 0xE4,
+  0xFF, 0x8B, 0xED, 0xF4, 0x30, 0xF6, 0x73, 0x76, 0xFE, 0x0A, 0xB3, 0x00, 0x00,
+  0x00, 0xB0, 0x00, 0x00, 0x00, 0x09, 0xF7, 0xFF, 0x04, 0xB3, 0xFE, 0x2A, 0xEF,
+  0xFD, 0x8E, 0x4B, 0xF5, 0xEC, 0xE7, 0xF4, 0xFF, 0xE6, 0xF4, 0xFF, 0x05, 0xF5,
+  0xFF, 0xE4, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xE3, 0xFC,
+  0xFF, 0x81, 0xC3, 0xFC, 0xFF, 0x03, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02,
+  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF,
+  0x15, 0xC4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0x07, 0xED, 0xFF,
+  0x08, 0xED, 0xFF, 0x09, 0xE5, 0xFF, 0x4A, 0xE5, 0xFF, 0x6B, 0xE5, 0xFF, 0x8C,
+  0xE5, 0xF7, 0x8D, 0xE5, 0xE9, 0xAE, 0xE5, 0xDD, 0xAE, 0xE5, 0xD5, 0xCE, 0xED,
+  0xD1, 0xCE, 0xED, 0xCF, 0xAD, 0xED, 0xD2, 0xAD, 0xED, 0xD6, 0x8C, 0xED, 0xE2,
+  0x8C, 0xE5, 0xF1, 0x6B, 0xE5, 0xFF, 0x2A, 0xE5, 0xFF, 0x09, 0xE5, 0xFF, 0x08,
+  0xED, 0xFF, 0x81, 0x07, 0xED, 0xFF, 0x01, 0xE6, 0xEC, 0xFF, 0xE4, 0xF4, 0xFF,
+  0x83, 0xE4, 0xFC, 0xFF, 0x01, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0x81, 0xE3,
+  0xFC, 0xFF, 0x0D, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC3,
+  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xF5,
+  0xFF, 0x05, 0xED, 0xFF, 0x07, 0xED, 0xFF, 0x4A, 0xED, 0xF3, 0xEF, 0xF5, 0x91,
+  0xB4, 0xFE, 0x30, 0xF5, 0xFF, 0x03, 0xB0, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00,
+  0x00, 0x06, 0xF5, 0xFF, 0x03, 0xB4, 0xFE, 0x1F, 0xEF, 0xF5, 0xA4, 0x2A, 0xED,
+  0xFF, 0xE7, 0xF4, 0xFF, 0xC5, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0x81, 0xE3, 0xFC,
+  0xFF, 0x03, 0x04, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC,
+  0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x02, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4,
+  0xF4, 0xFF, 0x81, 0x05, 0xF5, 0xFF, 0x0A, 0x06, 0xF5, 0xFF, 0xE6, 0xF4, 0xFF,
+  0x08, 0xF5, 0xFF, 0x09, 0xF5, 0xFF, 0x2A, 0xF5, 0xFF, 0x8C, 0xF5, 0xE7, 0xCE,
+  0xFD, 0x97, 0x51, 0xFE, 0x5A, 0xD3, 0xFE, 0x27, 0xB5, 0xFE, 0x0C, 0xB5, 0xFE,
+  0x06, 0x81, 0xD6, 0xFE, 0x07, 0x02, 0xBA, 0xFE, 0x06, 0x79, 0xFE, 0x05, 0xF7,
+  0xFF, 0x04, 0x81, 0xF5, 0xFF, 0x03, 0x0F, 0xF7, 0xFD, 0x04, 0xF7, 0xFF, 0x04,
+  0x79, 0xFE, 0x05, 0xB5, 0xFE, 0x06, 0xD6, 0xFE, 0x07, 0xF3, 0xFE, 0x08, 0x33,
+  0xFF, 0x0A, 0xB2, 0xFE, 0x24, 0x51, 0xFE, 0x54, 0xEF, 0xF5, 0x93, 0xCD, 0xF5,
+  0xE1, 0x4A, 0xE5, 0xFF, 0x49, 0xED, 0xFF, 0x28, 0xED, 0xFF, 0x07, 0xED, 0xFF,
+  0x06, 0xED, 0xFF, 0x81, 0xE5, 0xF4, 0xFF, 0x01, 0xE4, 0xFC, 0xFF, 0x04, 0xFD,
+  0xFF, 0x82, 0xE3, 0xFC, 0xFF, 0x81, 0xC2, 0xFC, 0xFF, 0x09, 0xE3, 0xFC, 0xFF,
+  0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE5,
+  0xF4, 0xFF, 0xE7, 0xEC, 0xFF, 0x2A, 0xE5, 0xFF, 0xEF, 0xED, 0xAB, 0xB4, 0xF6,
+  0x20, 0xAF, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x06, 0x93, 0xFE, 0x21,
+  0xAD, 0xF5, 0xB4, 0x2A, 0xF5, 0xFF, 0xC7, 0xF4, 0xFF, 0xC5, 0xF4, 0xFF, 0xE5,
+  0xFC, 0xFF, 0x24, 0xFD, 0xFF, 0x83, 0x03, 0xFD, 0xFF, 0x81, 0xE3, 0xFC, 0xFF,
+  0x83, 0x03, 0xFD, 0xFF, 0x09, 0xE4, 0xF4, 0xFF, 0x28, 0xED, 0xFF, 0x09, 0xE5,
+  0xFF, 0x4B, 0xE5, 0xFF, 0xCE, 0xED, 0xA3, 0x72, 0xFE, 0x55, 0xB5, 0xFE, 0x2F,
+  0xD6, 0xFE, 0x1B, 0x97, 0xFE, 0x0B, 0xF7, 0xFF, 0x04, 0x95, 0x00, 0x00, 0x00,
+  0x0B, 0xF5, 0xFF, 0x03, 0xF7, 0xFE, 0x08, 0xF7, 0xF6, 0x17, 0xB4, 0xF6, 0x2B,
+  0x52, 0xF6, 0x4E, 0xEE, 0xF5, 0x96, 0x6A, 0xED, 0xFA, 0x27, 0xED, 0xFF, 0x05,
+  0xED, 0xFF, 0x04, 0xF5, 0xFF, 0xE3, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x81, 0x03,
+  0xFD, 0xFF, 0x83, 0xE2, 0xFC, 0xFF, 0x09, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF,
+  0x05, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xF4, 0xFF, 0x06, 0xED, 0xFF, 0x49,
+  0xED, 0xFF, 0xCD, 0xED, 0xBA, 0xD3, 0xFE, 0x28, 0xFF, 0xFF, 0x02, 0xAC, 0x00,
+  0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x08, 0xD4, 0xF6, 0x1A, 0xEF, 0xF5, 0x84,
+  0x29, 0xED, 0xFF, 0x06, 0xF5, 0xFF, 0xC4, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x04,
+  0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x82, 0xE2, 0xFC, 0xFF, 0x81,
+  0xE3, 0xFC, 0xFF, 0x09, 0x04, 0xFD, 0xFF, 0x05, 0xF5, 0xFF, 0xE5, 0xE4, 0xFF,
+  0x06, 0xE5, 0xFF, 0x88, 0xF5, 0xFF, 0xAB, 0xF5, 0xD6, 0x10, 0xF6, 0x7B, 0xD5,
+  0xFE, 0x28, 0x36, 0xFF, 0x0A, 0xFF, 0xFF, 0x01, 0x82, 0x00, 0x00, 0x00, 0x0B,
+  0xBA, 0xD6, 0x0C, 0xFA, 0xC5, 0x28, 0x99, 0xB5, 0x40, 0xF6, 0xA4, 0x58, 0x54,
+  0x8C, 0x7A, 0x70, 0x73, 0x96, 0xAD, 0x5A, 0xB1, 0x2B, 0x4A, 0xC8, 0xCA, 0x41,
+  0xDC, 0x28, 0x31, 0xE8, 0x07, 0x31, 0xEE, 0x07, 0x29, 0xF1, 0x81, 0xE7, 0x28,
+  0xF2, 0x0B, 0x07, 0x29, 0xF1, 0x28, 0x29, 0xEF, 0x28, 0x31, 0xE9, 0xCB, 0x41,
+  0xDC, 0x0B, 0x4A, 0xC9, 0x8D, 0x5A, 0xB3, 0x50, 0x73, 0x99, 0x13, 0x8C, 0x7B,
+  0xD6, 0xA4, 0x59, 0x98, 0xBD, 0x41, 0xFA, 0xC5, 0x27, 0x9A, 0xD6, 0x0B, 0x83,
+  0x00, 0x00, 0x00, 0x0A, 0xB5, 0xFE, 0x06, 0xD3, 0xFE, 0x21, 0x2F, 0xFE, 0x74,
+  0x8B, 0xF5, 0xCF, 0x69, 0xED, 0xFF, 0x06, 0xED, 0xFF, 0xE5, 0xEC, 0xFF, 0x05,
+  0xF5, 0xFF, 0x24, 0xF5, 0xFF, 0x03, 0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xC3,
+  0xFC, 0xFF, 0x81, 0xC2, 0xFC, 0xFF, 0x00, 0xE2, 0xFC, 0xFF, 0x81, 0x03, 0xFD,
+  0xFF, 0x04, 0xE4, 0xF4, 0xFF, 0x27, 0xED, 0xFF, 0x4A, 0xE5, 0xFF, 0xF0, 0xED,
+  0x8C, 0xB5, 0xF6, 0x1E, 0xAB, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x08,
+  0xD6, 0xFE, 0x07, 0x70, 0xF6, 0x61, 0x49, 0xE5, 0xFF, 0x06, 0xED, 0xFF, 0x26,
+  0xFD, 0xFF, 0xC3, 0xF4, 0xFF, 0x02, 0xFD, 0xFF, 0x22, 0xFD, 0xFF, 0x03, 0xFD,
+  0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x0A, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xC2,
+  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xF4, 0xFF, 0x07, 0xED, 0xFF, 0x4A, 0xE5,
+  0xFF, 0xCE, 0xE5, 0xD4, 0x73, 0xEE, 0x3B, 0x57, 0xFF, 0x0B, 0xF7, 0xFD, 0x04,
+  0x83, 0x00, 0x00, 0x00, 0x04, 0xB8, 0xCD, 0x3C, 0x4F, 0x7B, 0x90, 0xA9, 0x41,
+  0xD3, 0x08, 0x31, 0xE7, 0xE8, 0x28, 0xED, 0x81, 0xE8, 0x28, 0xEF, 0x04, 0xE8,
   0x28, 0xF1, 0xE8, 0x30, 0xF7, 0xE8, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xA7, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xF7, 0xE8, 0x28,
-  0xF0, 0xE7, 0x28, 0xEE, 0xE8, 0x28, 0xEE, 0x07, 0x29, 0xED,
-  0x27, 0x31, 0xE7, 0x88, 0x39, 0xD5, 0x0E, 0x6B, 0x95, 0x98, 0xC5, 0x41, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x02, 0xF7, 0xFE, 0x08, 0x93, 0xFE, 0x33, 0xCE, 0xED, 0xC3, 0x4A, 0xE5, 0xFF,
-  0x07, 0xE5, 0xFF, 0x05, 0xED, 0xFF, 0x05, 0xF5, 0xFF, 0xE5, 0xF4, 0xFF, 0x04,
-  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE1, 0xFC, 0xFF, 0x02, 0xFD,
-  0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xA4, 0xFC, 0xFF, 0x06, 0xFD, 0xFF,
-  0xE6, 0xEC, 0xFF, 0x29, 0xE5, 0xFF, 0x70, 0xF6, 0x6A, 0xF7, 0xFF, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x94, 0xF6, 0x3A, 0x8D, 0xED, 0xC9, 0x07, 0xE5, 0xFF,
-  0x25, 0xF5, 0xFF, 0x24, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x01,
-  0xFD, 0xFF, 0xE1, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0x04, 0xFD,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF,
-  0xE7, 0xF4, 0xFF, 0x8B, 0xF5, 0xDB, 0x51, 0xFE, 0x6A, 0xF4, 0xF6, 0x1D, 0xF7,
-  0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xE7, 0x09, 0xD5, 0xA4,
-  0x52, 0xD1, 0x83, 0x90, 0x4B, 0x52, 0xBF, 0x48, 0x31, 0xE7, 0xE7, 0x28, 0xF4,
-  0xE7, 0x28, 0xF9, 0xE8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xE9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xE8, 0x28, 0xFA, 0xC8,
-  0x28, 0xF3, 0x08, 0x31, 0xE8, 0x0C, 0x4A, 0xC3, 0x92, 0x7B, 0x95, 0xF7, 0xA4,
-  0x55, 0xDD, 0xDE, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xB5, 0xFE, 0x18, 0x71, 0xFE, 0x5F, 0xCD, 0xED, 0xCA, 0x09, 0xE5, 0xFF, 0x08,
-  0xED, 0xFF, 0xE6, 0xF4, 0xFF, 0x05, 0xF5, 0xFF, 0x23, 0xFD, 0xFF, 0x22, 0xFD,
-  0xFF, 0xE2, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF,
-  0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xF5, 0xFF, 0x07,
-  0xE5, 0xFF, 0xAC, 0xE5, 0xCF, 0x93, 0xF6, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xD6, 0xFE, 0x0D, 0x10, 0xFE, 0x7B, 0x2A, 0xED, 0xFF,
-  0xE6, 0xEC, 0xFF, 0x05, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03,
-  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xC5, 0xF4, 0xFF, 0xE7, 0xEC, 0xFF, 0x4A, 0xED, 0xFF,
-  0xAE, 0xED, 0xC1, 0xB4, 0xFE, 0x2B, 0xBA, 0xFE, 0x06, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x7B, 0xDE, 0x0F, 0x57, 0xB5, 0x42, 0x0F, 0x6B, 0xAC, 0x08, 0x29,
-  0xEE, 0xE8, 0x28, 0xF7, 0xC8, 0x28, 0xFC, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28,
-  0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xE9, 0x28,
-  0xFF, 0xC8, 0x28, 0xF8, 0xC7, 0x20, 0xF5, 0xE8, 0x20, 0xEF, 0xCE, 0x62, 0xAF,
-  0x36, 0xB5, 0x47, 0x5B, 0xDE, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xD5, 0xFE, 0x21, 0xAE, 0xED, 0xA6, 0x4A, 0xED, 0xFF, 0x07, 0xE5,
-  0xFF, 0xE4, 0xEC, 0xFF, 0xE3, 0xF4, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x03,
-  0xF5, 0xFF, 0x24, 0xF5, 0xFF, 0x05, 0xED, 0xFF, 0x28, 0xED, 0xFF, 0x0F, 0xFE,
-  0x89, 0xF7, 0xEE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x73, 0xF6, 0x35, 0x8D, 0xED, 0xE0,
-  0x08, 0xED, 0xFF, 0xE5, 0xF4, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xC4, 0xF4,
-  0xFF, 0xE5, 0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0xE7, 0xEC, 0xFF, 0x4A, 0xED, 0xFF,
-  0x10, 0xFE, 0x77, 0xD4, 0xFE, 0x1A, 0xF7, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x77, 0xB5, 0x3F, 0x0F, 0x6B, 0xB4, 0x69, 0x39, 0xE4, 0xE8, 0x28,
-  0xF5, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x20, 0xFF, 0xE8, 0x20, 0xFF, 0x08, 0x29, 0xF7, 0x89, 0x39, 0xE3, 0xCE,
-  0x62, 0xB3, 0x36, 0xB5, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xF4, 0xFE, 0x16, 0x2F, 0xF6, 0x66, 0x6A, 0xE5, 0xFF, 0x07, 0xE5, 0xFF,
-  0x05, 0xF5, 0xFF, 0x04, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0x07, 0xED, 0xFF, 0x6E, 0xE5, 0xE5, 0x74, 0xEE, 0x3D,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xB7, 0xFE, 0x0C, 0x11, 0xF6, 0x6E, 0x2A, 0xE5, 0xFA,
-  0x07, 0xED, 0xFF, 0xE5, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2,
-  0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0x05, 0xF5, 0xFF, 0x07, 0xED, 0xFF, 0x6A, 0xED, 0xFF, 0x0F, 0xF6, 0x85,
-  0x17, 0xFF, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xDE, 0x16, 0x74,
-  0x94, 0x66, 0x8D, 0x52, 0xC7, 0x07, 0x29, 0xF5, 0xC7, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x30, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x28, 0xF5, 0x0C, 0x52, 0xC8, 0x54, 0x9C,
-  0x67, 0x38, 0xDE, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xFF, 0x0D,
-  0x10, 0xEE, 0x79, 0x6B, 0xE5, 0xFA, 0x28, 0xED, 0xFF, 0xE5, 0xF4, 0xFF, 0x04,
-  0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD, 0xFF,
-  0xE5, 0xF4, 0xFF, 0x08, 0xED, 0xFF, 0x0F, 0xF6, 0x76, 0xD6, 0xFE, 0x0E, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xFE, 0x10, 0x8E, 0xED, 0xC7,
-  0x09, 0xED, 0xFF, 0x26, 0xF5, 0xFF, 0xE4, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x24, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xF4,
-  0xFF, 0x05, 0xFD, 0xFF, 0x07, 0xF5, 0xFF, 0x09, 0xE5, 0xFF, 0xCE, 0xED, 0x8F,
-  0xD6, 0xFE, 0x0D, 0xF0, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x04, 0xD2,
-  0x83, 0x87, 0xE7, 0x20, 0xEB, 0x29, 0x29, 0xF5, 0xE8, 0x20, 0xFF, 0xC7, 0x28,
-  0xFF, 0x08, 0x31, 0xFF, 0xE8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF,
-  0xA8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9,
-  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xA8, 0x28,
-  0xFF, 0x88, 0x20, 0xFF, 0x29, 0x31, 0xF8, 0xE7, 0x28, 0xEC, 0xB1, 0x83, 0x90,
-  0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xFF, 0x09, 0xEF,
-  0xF5, 0x7C, 0x09, 0xE5, 0xFF, 0xC6, 0xEC, 0xFF, 0x26, 0xFD, 0xFF, 0xC4, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF,
-  0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x25, 0xFD, 0xFF, 0x28, 0xED, 0xFF, 0x8D,
-  0xED, 0xD6, 0xB5, 0xF6, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFE, 0x36, 0x6B, 0xF5, 0xDC,
+  0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF,
+  0x00, 0xC8, 0x20, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x08, 0xE8, 0x28, 0xF7, 0xE8,
+  0x28, 0xF0, 0xE7, 0x28, 0xEE, 0xE8, 0x28, 0xEE, 0x07, 0x29, 0xED, 0x27, 0x31,
+  0xE7, 0x88, 0x39, 0xD5, 0x0E, 0x6B, 0x95, 0x98, 0xC5, 0x41, 0x83, 0x00, 0x00,
+  0x00, 0x15, 0xFF, 0xFF, 0x02, 0xF7, 0xFE, 0x08, 0x93, 0xFE, 0x33, 0xCE, 0xED,
+  0xC3, 0x4A, 0xE5, 0xFF, 0x07, 0xE5, 0xFF, 0x05, 0xED, 0xFF, 0x05, 0xF5, 0xFF,
+  0xE5, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE1,
+  0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xA4, 0xFC,
+  0xFF, 0x06, 0xFD, 0xFF, 0xE6, 0xEC, 0xFF, 0x29, 0xE5, 0xFF, 0x70, 0xF6, 0x6A,
+  0xF7, 0xFF, 0x04, 0xA9, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x0B, 0x94,
+  0xF6, 0x3A, 0x8D, 0xED, 0xC9, 0x07, 0xE5, 0xFF, 0x25, 0xF5, 0xFF, 0x24, 0xFD,
+  0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x01, 0xFD, 0xFF, 0xE1, 0xFC, 0xFF,
+  0x02, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0x81, 0xE4, 0xFC, 0xFF,
+  0x05, 0xE5, 0xFC, 0xFF, 0xE7, 0xF4, 0xFF, 0x8B, 0xF5, 0xDB, 0x51, 0xFE, 0x6A,
+  0xF4, 0xF6, 0x1D, 0xF7, 0xFF, 0x04, 0x81, 0x00, 0x00, 0x00, 0x0A, 0x1C, 0xE7,
+  0x09, 0xD5, 0xA4, 0x52, 0xD1, 0x83, 0x90, 0x4B, 0x52, 0xBF, 0x48, 0x31, 0xE7,
+  0xE7, 0x28, 0xF4, 0xE7, 0x28, 0xF9, 0xE8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xE9,
+  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x82, 0xA8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF,
+  0x00, 0xE9, 0x30, 0xFF, 0x8E, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x07,
+  0xE8, 0x30, 0xFF, 0xE8, 0x28, 0xFA, 0xC8, 0x28, 0xF3, 0x08, 0x31, 0xE8, 0x0C,
+  0x4A, 0xC3, 0x92, 0x7B, 0x95, 0xF7, 0xA4, 0x55, 0xDD, 0xDE, 0x0E, 0x82, 0x00,
+  0x00, 0x00, 0x09, 0xB5, 0xFE, 0x18, 0x71, 0xFE, 0x5F, 0xCD, 0xED, 0xCA, 0x09,
+  0xE5, 0xFF, 0x08, 0xED, 0xFF, 0xE6, 0xF4, 0xFF, 0x05, 0xF5, 0xFF, 0x23, 0xFD,
+  0xFF, 0x22, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x83, 0xC3, 0xFC, 0xFF, 0x04, 0x03,
+  0xFD, 0xFF, 0x04, 0xF5, 0xFF, 0x07, 0xE5, 0xFF, 0xAC, 0xE5, 0xCF, 0x93, 0xF6,
+  0x40, 0xA8, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0x06, 0xD6, 0xFE, 0x0D,
+  0x10, 0xFE, 0x7B, 0x2A, 0xED, 0xFF, 0xE6, 0xEC, 0xFF, 0x05, 0xFD, 0xFF, 0xE4,
+  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x83, 0x03, 0xFD, 0xFF, 0x07, 0xE3, 0xFC, 0xFF,
+  0xE4, 0xFC, 0xFF, 0xC5, 0xF4, 0xFF, 0xE7, 0xEC, 0xFF, 0x4A, 0xED, 0xFF, 0xAE,
+  0xED, 0xC1, 0xB4, 0xFE, 0x2B, 0xBA, 0xFE, 0x06, 0x81, 0x00, 0x00, 0x00, 0x05,
+  0x7B, 0xDE, 0x0F, 0x57, 0xB5, 0x42, 0x0F, 0x6B, 0xAC, 0x08, 0x29, 0xEE, 0xE8,
+  0x28, 0xF7, 0xC8, 0x28, 0xFC, 0x83, 0xE8, 0x28, 0xFF, 0x02, 0xC8, 0x28, 0xFF,
+  0xC8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0x84, 0xE9, 0x28, 0xFF, 0x01, 0xC9, 0x28,
+  0xFF, 0xA8, 0x28, 0xFF, 0x85, 0xC8, 0x28, 0xFF, 0x83, 0xC8, 0x30, 0xFF, 0x01,
+  0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28,
+  0xFF, 0x0B, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x28,
+  0xFF, 0xE9, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xF8, 0xC7, 0x20, 0xF5,
+  0xE8, 0x20, 0xEF, 0xCE, 0x62, 0xAF, 0x36, 0xB5, 0x47, 0x5B, 0xDE, 0x0E, 0x82,
+  0x00, 0x00, 0x00, 0x06, 0xD5, 0xFE, 0x21, 0xAE, 0xED, 0xA6, 0x4A, 0xED, 0xFF,
+  0x07, 0xE5, 0xFF, 0xE4, 0xEC, 0xFF, 0xE3, 0xF4, 0xFF, 0xE2, 0xFC, 0xFF, 0x83,
+  0xE3, 0xFC, 0xFF, 0x06, 0xC2, 0xFC, 0xFF, 0x03, 0xF5, 0xFF, 0x24, 0xF5, 0xFF,
+  0x05, 0xED, 0xFF, 0x28, 0xED, 0xFF, 0x0F, 0xFE, 0x89, 0xF7, 0xEE, 0x10, 0xA6,
+  0x00, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x00, 0x04, 0x73, 0xF6, 0x35, 0x8D, 0xED,
+  0xE0, 0x08, 0xED, 0xFF, 0xE5, 0xF4, 0xFF, 0xC4, 0xFC, 0xFF, 0x82, 0xE3, 0xFC,
+  0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x07, 0xC4, 0xF4, 0xFF, 0xE5, 0xFC, 0xFF, 0x06,
+  0xF5, 0xFF, 0xE7, 0xEC, 0xFF, 0x4A, 0xED, 0xFF, 0x10, 0xFE, 0x77, 0xD4, 0xFE,
+  0x1A, 0xF7, 0xFF, 0x04, 0x81, 0x00, 0x00, 0x00, 0x07, 0x77, 0xB5, 0x3F, 0x0F,
+  0x6B, 0xB4, 0x69, 0x39, 0xE4, 0xE8, 0x28, 0xF5, 0xE8, 0x28, 0xFF, 0xE9, 0x28,
+  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x83, 0xC8, 0x28, 0xFF, 0x85, 0xE8,
+  0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x00, 0xE9, 0x28,
+  0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x82, 0xC8, 0x30, 0xFF,
+  0x00, 0xC8, 0x28, 0xFF, 0x82, 0xC8, 0x30, 0xFF, 0x00, 0xE8, 0x30, 0xFF, 0x81,
+  0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x01, 0xC8, 0x28, 0xFF, 0xA8, 0x28,
+  0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x00, 0xE8, 0x28, 0xFF, 0x81, 0xE8, 0x20, 0xFF,
+  0x03, 0x08, 0x29, 0xF7, 0x89, 0x39, 0xE3, 0xCE, 0x62, 0xB3, 0x36, 0xB5, 0x45,
+  0x82, 0x00, 0x00, 0x00, 0x06, 0xF4, 0xFE, 0x16, 0x2F, 0xF6, 0x66, 0x6A, 0xE5,
+  0xFF, 0x07, 0xE5, 0xFF, 0x05, 0xF5, 0xFF, 0x04, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF,
+  0x81, 0xE3, 0xFC, 0xFF, 0x07, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD,
+  0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x07, 0xED, 0xFF, 0x6E, 0xE5, 0xE5,
+  0x74, 0xEE, 0x3D, 0xA5, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x00, 0x10, 0xB7,
+  0xFE, 0x0C, 0x11, 0xF6, 0x6E, 0x2A, 0xE5, 0xFA, 0x07, 0xED, 0xFF, 0xE5, 0xF4,
+  0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
+  0x02, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x07,
+  0xED, 0xFF, 0x6A, 0xED, 0xFF, 0x0F, 0xF6, 0x85, 0x17, 0xFF, 0x12, 0x81, 0x00,
+  0x00, 0x00, 0x05, 0x9A, 0xDE, 0x16, 0x74, 0x94, 0x66, 0x8D, 0x52, 0xC7, 0x07,
+  0x29, 0xF5, 0xC7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x01,
+  0xE9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xA6, 0xC8, 0x28, 0xFF, 0x81, 0xE9, 0x28,
+  0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x03, 0xC7, 0x28, 0xF5,
+  0x0C, 0x52, 0xC8, 0x54, 0x9C, 0x67, 0x38, 0xDE, 0x1B, 0x81, 0x00, 0x00, 0x00,
+  0x07, 0x58, 0xFF, 0x0D, 0x10, 0xEE, 0x79, 0x6B, 0xE5, 0xFA, 0x28, 0xED, 0xFF,
+  0xE5, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x81,
+  0xE4, 0xFC, 0xFF, 0x06, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD, 0xFF,
+  0xE5, 0xF4, 0xFF, 0x08, 0xED, 0xFF, 0x0F, 0xF6, 0x76, 0xD6, 0xFE, 0x0E, 0xA3,
+  0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x04, 0x75, 0xFE, 0x10, 0x8E, 0xED,
+  0xC7, 0x09, 0xED, 0xFF, 0x26, 0xF5, 0xFF, 0xE4, 0xF4, 0xFF, 0x82, 0xE3, 0xFC,
+  0xFF, 0x15, 0x24, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xF4, 0xFF, 0x05, 0xFD,
+  0xFF, 0x07, 0xF5, 0xFF, 0x09, 0xE5, 0xFF, 0xCE, 0xED, 0x8F, 0xD6, 0xFE, 0x0D,
+  0xF0, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x04, 0xD2, 0x83, 0x87, 0xE7,
+  0x20, 0xEB, 0x29, 0x29, 0xF5, 0xE8, 0x20, 0xFF, 0xC7, 0x28, 0xFF, 0x08, 0x31,
+  0xFF, 0xE8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF,
+  0xC9, 0x28, 0xFF, 0xA7, 0xC8, 0x28, 0xFF, 0x00, 0xE9, 0x30, 0xFF, 0x81, 0xC8,
+  0x28, 0xFF, 0x06, 0xE9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0x88, 0x20, 0xFF, 0x29,
+  0x31, 0xF8, 0xE7, 0x28, 0xEC, 0xB1, 0x83, 0x90, 0xFF, 0xFF, 0x01, 0x81, 0x00,
+  0x00, 0x00, 0x08, 0x15, 0xFF, 0x09, 0xEF, 0xF5, 0x7C, 0x09, 0xE5, 0xFF, 0xC6,
+  0xEC, 0xFF, 0x26, 0xFD, 0xFF, 0xC4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC,
+  0xFF, 0xC2, 0xFC, 0xFF, 0x81, 0x02, 0xFD, 0xFF, 0x04, 0xE2, 0xFC, 0xFF, 0x25,
+  0xFD, 0xFF, 0x28, 0xED, 0xFF, 0x8D, 0xED, 0xD6, 0xB5, 0xF6, 0x12, 0xA2, 0x00,
+  0x00, 0x00, 0xA1, 0x00, 0x00, 0x00, 0x17, 0x52, 0xFE, 0x36, 0x6B, 0xF5, 0xDC,
   0xE6, 0xF4, 0xFF, 0xC3, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x45,
   0xFD, 0xFF, 0xA3, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE4, 0xFC,
-  0xFF, 0x06, 0xF5, 0xFF, 0x29, 0xE5, 0xFF, 0xCF, 0xED, 0xA4,
-  0xD5, 0xFE, 0x28, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x19, 0xDE, 0x1E, 0x50,
-  0x7B, 0x92, 0x8A, 0x41, 0xE2, 0xC8, 0x28, 0xF8, 0xE9, 0x28, 0xFF, 0xA9, 0x28,
-  0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xA7, 0x28, 0xFF,
-  0xA8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF,
-  0xE8, 0x30, 0xFF, 0xA7, 0x20, 0xF9, 0x68, 0x39, 0xE0, 0x6F, 0x7B, 0x96, 0x38,
-  0xD6, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFE, 0x23, 0xEF, 0xF5,
-  0x93, 0x08, 0xED, 0xFF, 0xC4, 0xF4, 0xFF, 0xC2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF,
-  0x22, 0xFD, 0xFF, 0xC2, 0xF4, 0xFF, 0x23, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x04,
-  0xF5, 0xFF, 0xE4, 0xF4, 0xFF, 0xE7, 0xEC, 0xFF, 0x6B, 0xF5, 0xE4, 0x72, 0xFE,
-  0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x52, 0xFE, 0x5A,
-  0x29, 0xED, 0xFF, 0xC4, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x01, 0xFD, 0xFF, 0xC2,
-  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xA3, 0xF4, 0xFF, 0x26, 0xFD, 0xFF, 0xE5, 0xFC,
-  0xFF, 0xE6, 0xF4, 0xFF, 0x08, 0xED, 0xFF, 0x6C, 0xED, 0xF5, 0x94, 0xFE, 0x49,
-  0x79, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x7B, 0xDE, 0x0F, 0xF1, 0x8B, 0x72, 0x48,
-  0x39, 0xE6, 0xC8, 0x28, 0xFC, 0xC9, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xA9, 0x28,
-  0xFF, 0xEA, 0x38, 0xFF, 0xA9, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xA8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x30, 0xFF,
-  0xE9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xE7,
-  0x28, 0xFF, 0x27, 0x31, 0xED, 0xB1, 0x83, 0x7A, 0x79, 0xDE, 0x10, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x92, 0xFE, 0x3D, 0x6B, 0xF5, 0xF2, 0x27, 0xF5, 0xFF,
-  0x04, 0xFD, 0xFF, 0xC2, 0xF4, 0xFF, 0x24, 0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x03,
-  0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xC5, 0xF4,
-  0xFF, 0x29, 0xED, 0xFF, 0x52, 0xF6, 0x61, 0xFF, 0xFF, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFE, 0x07,
-  0xF0, 0xFD, 0x92, 0x09, 0xED, 0xFF, 0xC5, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE1,
-  0xFC, 0xFF, 0xE0, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xC3, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0x09, 0xED, 0xFF, 0x10, 0xF6, 0x82,
-  0x18, 0xFF, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0x9C, 0x65, 0x8A,
-  0x39, 0xDF, 0x08, 0x29, 0xF8, 0x08, 0x29, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0x88, 0x30, 0xFF, 0x68, 0x30, 0xFF,
-  0x88, 0x30, 0xFF, 0xC9, 0x38, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x30,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0xEA, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x07, 0x31,
-  0xFC, 0x89, 0x41, 0xDE, 0x53, 0x94, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x57, 0xFF, 0x0B, 0x30, 0xEE, 0x70, 0x29, 0xE5, 0xFF, 0x27, 0xF5, 0xFF, 0xC4,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC5, 0xF4, 0xFF, 0x08, 0xF5, 0xFF,
-  0xEF, 0xF5, 0x9E, 0x57, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFE, 0x11,
-  0xF0, 0xF5, 0xA0, 0xE8, 0xF4, 0xFF, 0xC5, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x03,
-  0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE1, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0x04, 0xFD, 0xFF, 0x06, 0xF5, 0xFF, 0x8B, 0xF5, 0xE8, 0x93, 0xFE, 0x3E,
-  0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xD8, 0xBD, 0x32, 0xAD, 0x5A, 0xB5, 0x08,
-  0x29, 0xF5, 0xE9, 0x20, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x20, 0xFF, 0xC8, 0x20,
-  0xFF, 0x09, 0x29, 0xFF, 0xA8, 0x20, 0xFF, 0xC9, 0x30, 0xFF,
-  0xC9, 0x38, 0xFF, 0xC9, 0x38, 0xFF, 0xC9, 0x38, 0xFF, 0xA8, 0x30, 0xFF, 0xA8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF,
-  0xA8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xEA,
-  0x28, 0xFF, 0xA9, 0x20, 0xFF, 0x0A, 0x31, 0xFF, 0xA8, 0x28, 0xFF, 0xA8, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x20, 0xF4,
-  0x6D, 0x52, 0xBE, 0xD8, 0xBD, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93,
-  0xFE, 0x34, 0x8C, 0xED, 0xC7, 0xE8, 0xF4, 0xFF, 0xE5, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE7, 0xF4, 0xFF, 0xEF, 0xED, 0xAE, 0xF7,
-  0xF6, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xD6, 0xFE, 0x0E, 0xCF, 0xF5, 0xC2, 0xE8, 0xEC, 0xFF, 0xC4, 0xF4, 0xFF, 0x04,
-  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xF4, 0xFF, 0x24, 0xFD, 0xFF, 0x03, 0xFD,
-  0xFF, 0xC2, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x07, 0xED, 0xFF, 0xEE, 0xF5, 0xAF,
-  0xD6, 0xFE, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x8B, 0x7E, 0x07,
-  0x29, 0xF0, 0xE7, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xC7, 0x20,
-  0xFF, 0x08, 0x29, 0xFF, 0xE7, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0xE7, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xA8, 0x20,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0xC8, 0x28, 0xFF,
-  0xE9, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0x88, 0x28, 0xFF, 0x09, 0x31, 0xFF,
-  0xC8, 0x28, 0xFF, 0x29, 0x29, 0xFF, 0xC7, 0x18, 0xEF, 0x91, 0x73, 0x8E, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFE, 0x07, 0xD0, 0xF5, 0x8F, 0xE9, 0xEC,
-  0xFF, 0x06, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x24, 0xFD, 0xFF,
-  0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC4, 0xF4, 0xFF, 0xC7,
-  0xEC, 0xFF, 0xCE, 0xF5, 0xD1, 0xF7, 0xEE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x06, 0xF5, 0xFF, 0x29, 0xE5, 0xFF, 0xCF, 0xED, 0xA4, 0xD5, 0xFE, 0x28,
+  0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x19, 0xDE, 0x1E, 0x50, 0x7B, 0x92, 0x8A,
+  0x41, 0xE2, 0xC8, 0x28, 0xF8, 0xE9, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xA8, 0x28,
+  0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x03, 0xA7, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE9,
+  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA8, 0xC8, 0x28, 0xFF, 0x0B, 0xE9, 0x30, 0xFF,
+  0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC8,
+  0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xA7, 0x20, 0xF9, 0x68, 0x39,
+  0xE0, 0x6F, 0x7B, 0x96, 0x38, 0xD6, 0x24, 0x81, 0x00, 0x00, 0x00, 0x0E, 0xD5,
+  0xFE, 0x23, 0xEF, 0xF5, 0x93, 0x08, 0xED, 0xFF, 0xC4, 0xF4, 0xFF, 0xC2, 0xFC,
+  0xFF, 0x02, 0xFD, 0xFF, 0x22, 0xFD, 0xFF, 0xC2, 0xF4, 0xFF, 0x23, 0xFD, 0xFF,
+  0x03, 0xFD, 0xFF, 0x04, 0xF5, 0xFF, 0xE4, 0xF4, 0xFF, 0xE7, 0xEC, 0xFF, 0x6B,
+  0xF5, 0xE4, 0x72, 0xFE, 0x42, 0xA1, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0xFF, 0x01, 0x52, 0xFE, 0x5A, 0x29, 0xED, 0xFF, 0xC4, 0xF4, 0xFF,
+  0x03, 0xFD, 0xFF, 0x01, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xA3,
+  0xF4, 0xFF, 0x26, 0xFD, 0xFF, 0xE5, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0x08, 0xED,
+  0xFF, 0x6C, 0xED, 0xF5, 0x94, 0xFE, 0x49, 0x79, 0xFE, 0x05, 0x00, 0x00, 0x00,
+  0x7B, 0xDE, 0x0F, 0xF1, 0x8B, 0x72, 0x48, 0x39, 0xE6, 0xC8, 0x28, 0xFC, 0xC9,
+  0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xA9, 0x28, 0xFF, 0xEA, 0x38, 0xFF, 0xA9, 0x30,
+  0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x28, 0xFF,
+  0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xA9, 0xC8, 0x28, 0xFF, 0x01, 0xC9, 0x28,
+  0xFF, 0xE9, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xE9, 0x30, 0xFF, 0x81,
+  0xC9, 0x28, 0xFF, 0x04, 0xC7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0x27, 0x31, 0xED,
+  0xB1, 0x83, 0x7A, 0x79, 0xDE, 0x10, 0x81, 0x00, 0x00, 0x00, 0x0E, 0x92, 0xFE,
+  0x3D, 0x6B, 0xF5, 0xF2, 0x27, 0xF5, 0xFF, 0x04, 0xFD, 0xFF, 0xC2, 0xF4, 0xFF,
+  0x24, 0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x03,
+  0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xC5, 0xF4, 0xFF, 0x29, 0xED, 0xFF, 0x52, 0xF6,
+  0x61, 0xFF, 0xFF, 0x01, 0x9F, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x0E,
+  0xD6, 0xFE, 0x07, 0xF0, 0xFD, 0x92, 0x09, 0xED, 0xFF, 0xC5, 0xF4, 0xFF, 0x03,
+  0xFD, 0xFF, 0xE1, 0xFC, 0xFF, 0xE0, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC,
+  0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0x09, 0xED, 0xFF,
+  0x10, 0xF6, 0x82, 0x18, 0xFF, 0x11, 0x81, 0x00, 0x00, 0x00, 0x04, 0xB5, 0x9C,
+  0x65, 0x8A, 0x39, 0xDF, 0x08, 0x29, 0xF8, 0x08, 0x29, 0xFF, 0xE9, 0x28, 0xFF,
+  0x81, 0xC9, 0x28, 0xFF, 0x05, 0xA9, 0x30, 0xFF, 0x88, 0x30, 0xFF, 0x68, 0x30,
+  0xFF, 0x88, 0x30, 0xFF, 0xC9, 0x38, 0xFF, 0xC9, 0x30, 0xFF, 0x81, 0xC8, 0x28,
+  0xFF, 0x00, 0xE9, 0x28, 0xFF, 0xA7, 0xC8, 0x28, 0xFF, 0x00, 0xE9, 0x30, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x00, 0xE9, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x02,
+  0xA8, 0x20, 0xFF, 0xEA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF,
+  0x03, 0xC7, 0x28, 0xFF, 0x07, 0x31, 0xFC, 0x89, 0x41, 0xDE, 0x53, 0x94, 0x6F,
+  0x81, 0x00, 0x00, 0x00, 0x0E, 0x57, 0xFF, 0x0B, 0x30, 0xEE, 0x70, 0x29, 0xE5,
+  0xFF, 0x27, 0xF5, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
+  0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC5,
+  0xF4, 0xFF, 0x08, 0xF5, 0xFF, 0xEF, 0xF5, 0x9E, 0x57, 0xFF, 0x0B, 0x9E, 0x00,
+  0x00, 0x00, 0x9D, 0x00, 0x00, 0x00, 0x13, 0x96, 0xFE, 0x11, 0xF0, 0xF5, 0xA0,
+  0xE8, 0xF4, 0xFF, 0xC5, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x02,
+  0xFD, 0xFF, 0xE1, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD,
+  0xFF, 0x06, 0xF5, 0xFF, 0x8B, 0xF5, 0xE8, 0x93, 0xFE, 0x3E, 0xFF, 0xFF, 0x02,
+  0x00, 0x00, 0x00, 0xD8, 0xBD, 0x32, 0xAD, 0x5A, 0xB5, 0x08, 0x29, 0xF5, 0xE9,
+  0x20, 0xFF, 0x81, 0xE8, 0x20, 0xFF, 0x03, 0xC8, 0x20, 0xFF, 0x09, 0x29, 0xFF,
+  0xA8, 0x20, 0xFF, 0xC9, 0x30, 0xFF, 0x82, 0xC9, 0x38, 0xFF, 0x02, 0xA8, 0x30,
+  0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF, 0x00, 0xC9,
+  0x28, 0xFF, 0xA6, 0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28,
+  0xFF, 0x81, 0xA8, 0x28, 0xFF, 0x0C, 0xC9, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xE9,
+  0x28, 0xFF, 0xEA, 0x28, 0xFF, 0xA9, 0x20, 0xFF, 0x0A, 0x31, 0xFF, 0xA8, 0x28,
+  0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x20, 0xF4,
+  0x6D, 0x52, 0xBE, 0xD8, 0xBD, 0x3D, 0x81, 0x00, 0x00, 0x00, 0x04, 0x93, 0xFE,
+  0x34, 0x8C, 0xED, 0xC7, 0xE8, 0xF4, 0xFF, 0xE5, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
+  0x81, 0xE2, 0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x04, 0xE3, 0xFC, 0xFF, 0xC4,
+  0xFC, 0xFF, 0xE7, 0xF4, 0xFF, 0xEF, 0xED, 0xAE, 0xF7, 0xF6, 0x16, 0x9D, 0x00,
+  0x00, 0x00, 0x9C, 0x00, 0x00, 0x00, 0x0D, 0xD6, 0xFE, 0x0E, 0xCF, 0xF5, 0xC2,
+  0xE8, 0xEC, 0xFF, 0xC4, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE2,
+  0xF4, 0xFF, 0x24, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x04, 0xFD,
+  0xFF, 0x07, 0xED, 0xFF, 0xEE, 0xF5, 0xAF, 0xD6, 0xFE, 0x0E, 0x81, 0x00, 0x00,
+  0x00, 0x0A, 0xD2, 0x8B, 0x7E, 0x07, 0x29, 0xF0, 0xE7, 0x20, 0xFF, 0xC8, 0x28,
+  0xFF, 0x09, 0x31, 0xFF, 0xC7, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0xE7, 0x28, 0xFF,
+  0xC7, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF,
+  0x01, 0xA8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF, 0x01, 0xA8,
+  0x20, 0xFF, 0xC9, 0x28, 0xFF, 0xA6, 0xC8, 0x28, 0xFF, 0x03, 0xA8, 0x20, 0xFF,
+  0xC8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF,
+  0x00, 0xA8, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x81,
+  0xC9, 0x30, 0xFF, 0x05, 0x88, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xC8, 0x28, 0xFF,
+  0x29, 0x29, 0xFF, 0xC7, 0x18, 0xEF, 0x91, 0x73, 0x8E, 0x81, 0x00, 0x00, 0x00,
+  0x0D, 0xD6, 0xFE, 0x07, 0xD0, 0xF5, 0x8F, 0xE9, 0xEC, 0xFF, 0x06, 0xFD, 0xFF,
+  0xC3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x24, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3,
+  0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC4, 0xF4, 0xFF, 0xC7, 0xEC, 0xFF, 0xCE, 0xF5,
+  0xD1, 0xF7, 0xEE, 0x0F, 0x9C, 0x00, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x00, 0x1D,
   0xD5, 0xF6, 0x1B, 0xAE, 0xE5, 0xD1, 0x08, 0xED, 0xFF, 0xE5, 0xF4, 0xFF, 0x04,
   0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0xE4, 0xF4,
-  0xFF, 0xE5, 0xF4, 0xFF, 0x06, 0xF5, 0xFF, 0x08, 0xED, 0xFF,
-  0x50, 0xFE, 0x5A, 0xF7, 0xFE, 0x08, 0x00, 0x00, 0x00, 0x79, 0xBD, 0x33, 0x6D,
-  0x5A, 0xC4, 0xC7, 0x28, 0xF8, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x30,
-  0xFF, 0x87, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xC7, 0x28, 0xFF, 0xE7, 0x28, 0xFF,
-  0x28, 0x29, 0xFF, 0x07, 0x29, 0xFF, 0xC7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x28, 0xFF, 0x89, 0x28, 0xFF,
-  0x0A, 0x39, 0xFF, 0x88, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x20, 0xFF, 0x09,
-  0x29, 0xFF, 0x09, 0x21, 0xFA, 0x6D, 0x52, 0xC7, 0x56, 0xB5, 0x3B, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x53, 0xFE, 0x49, 0x0A, 0xE5, 0xFF, 0x08, 0xF5, 0xFF,
-  0xE5, 0xF4, 0xFF, 0xE4, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xC2,
-  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC4, 0xFC, 0xFF, 0xE7, 0xF4, 0xFF, 0x8E, 0xE5,
-  0xDA, 0xB5, 0xF6, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x96, 0xF6, 0x1C, 0x8B, 0xE5, 0xCE, 0x26, 0xE5, 0xFF, 0x25,
-  0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD,
+  0xFF, 0xE5, 0xF4, 0xFF, 0x06, 0xF5, 0xFF, 0x08, 0xED, 0xFF, 0x50, 0xFE, 0x5A,
+  0xF7, 0xFE, 0x08, 0x00, 0x00, 0x00, 0x79, 0xBD, 0x33, 0x6D, 0x5A, 0xC4, 0xC7,
+  0x28, 0xF8, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0x87, 0x28,
+  0xFF, 0x09, 0x31, 0xFF, 0xC7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0x28, 0x29, 0xFF,
+  0x07, 0x29, 0xFF, 0xC7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x81,
+  0xE9, 0x28, 0xFF, 0x01, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xE9, 0x28,
+  0xFF, 0xA7, 0xC8, 0x28, 0xFF, 0x04, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xA8,
+  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x0D,
+  0xE9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9,
+  0x28, 0xFF, 0x89, 0x28, 0xFF, 0x0A, 0x39, 0xFF, 0x88, 0x28, 0xFF, 0xE9, 0x30,
+  0xFF, 0xC8, 0x20, 0xFF, 0x09, 0x29, 0xFF, 0x09, 0x21, 0xFA, 0x6D, 0x52, 0xC7,
+  0x56, 0xB5, 0x3B, 0x81, 0x00, 0x00, 0x00, 0x0C, 0x53, 0xFE, 0x49, 0x0A, 0xE5,
+  0xFF, 0x08, 0xF5, 0xFF, 0xE5, 0xF4, 0xFF, 0xE4, 0xF4, 0xFF, 0x03, 0xFD, 0xFF,
+  0xE2, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC4, 0xFC, 0xFF, 0xE7,
+  0xF4, 0xFF, 0x8E, 0xE5, 0xDA, 0xB5, 0xF6, 0x1F, 0x9B, 0x00, 0x00, 0x00, 0x9A,
+  0x00, 0x00, 0x00, 0x04, 0x96, 0xF6, 0x1C, 0x8B, 0xE5, 0xCE, 0x26, 0xE5, 0xFF,
+  0x25, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x05, 0x03, 0xFD,
   0xFF, 0xE3, 0xF4, 0xFF, 0x25, 0xFD, 0xFF, 0xE6, 0xE4, 0xFF, 0x8C, 0xE5, 0xEC,
-  0xD4, 0xFE, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xAC, 0x5B, 0x49,
-  0x39, 0xE9, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0xE7, 0x30,
-  0xFF, 0xA8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF,
-  0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xA8, 0x20, 0xFF, 0xE8, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0x07, 0x31,
-  0xE8, 0x93, 0x9C, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xB5, 0xF6, 0x19, 0x8E, 0xED, 0xDB, 0x08, 0xED, 0xFF, 0xE4, 0xF4, 0xFF, 0xE3,
-  0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE5, 0xFC, 0xFF, 0xC6, 0xF4, 0xFF, 0x6B, 0xF5, 0xDF, 0xB5, 0xF6, 0x20,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFE, 0x0F, 0xD0, 0xED, 0xD5, 0x06,
-  0xED, 0xFF, 0xE3, 0xF4, 0xFF, 0x02, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD,
+  0xD4, 0xFE, 0x22, 0x81, 0x00, 0x00, 0x00, 0x06, 0xD6, 0xAC, 0x5B, 0x49, 0x39,
+  0xE9, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0xE7, 0x30, 0xFF,
+  0xA8, 0x30, 0xFF, 0x81, 0xA9, 0x30, 0xFF, 0x01, 0xC8, 0x30, 0xFF, 0xC8, 0x28,
+  0xFF, 0x83, 0xE8, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF,
+  0x00, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0xAF, 0xC8, 0x28, 0xFF, 0x81,
+  0xC8, 0x30, 0xFF, 0x81, 0xA9, 0x30, 0xFF, 0x00, 0xC9, 0x30, 0xFF, 0x82, 0xC9,
+  0x28, 0xFF, 0x01, 0xE9, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0x81, 0xE8, 0x30, 0xFF,
+  0x01, 0x07, 0x31, 0xE8, 0x93, 0x9C, 0x63, 0x81, 0x00, 0x00, 0x00, 0x06, 0xB5,
+  0xF6, 0x19, 0x8E, 0xED, 0xDB, 0x08, 0xED, 0xFF, 0xE4, 0xF4, 0xFF, 0xE3, 0xFC,
+  0xFF, 0x02, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x03, 0xE5,
+  0xFC, 0xFF, 0xC6, 0xF4, 0xFF, 0x6B, 0xF5, 0xDF, 0xB5, 0xF6, 0x20, 0x9A, 0x00,
+  0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x03, 0xF7, 0xFE, 0x0F, 0xD0, 0xED, 0xD5,
+  0x06, 0xED, 0xFF, 0xE3, 0xF4, 0xFF, 0x81, 0x02, 0xFD, 0xFF, 0x0F, 0x03, 0xFD,
   0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xF4, 0xFF, 0x28, 0xED, 0xFF,
   0xCD, 0xED, 0xC9, 0xB7, 0xF6, 0x12, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xCE,
   0x62, 0xAB, 0xE8, 0x30, 0xF6, 0x88, 0x28, 0xFF, 0xEA, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0x08, 0x31, 0xFF, 0xC7, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF,
-  0xA9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0x87, 0x28,
-  0xFF, 0xC7, 0x30, 0xFF, 0xE7, 0x28, 0xFF, 0x07, 0x29, 0xF0, 0x8C, 0x52, 0xB3,
-  0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xD6, 0xFE, 0x0E, 0xAE, 0xF5, 0xAC, 0x28,
-  0xED, 0xFF, 0x05, 0xF5, 0xFF, 0x23, 0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xC5, 0xF4, 0xFF,
-  0xCE, 0xED, 0xDF, 0xF5, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xF6, 0x19, 0xCD, 0xF5, 0xCD, 0x06,
-  0xED, 0xFF, 0xE4, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE1, 0xFC, 0xFF, 0xE1, 0xFC,
-  0xFF, 0xC2, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0x07, 0xED, 0xFF,
-  0xEF, 0xED, 0x9B, 0xD6, 0xEE, 0x0E, 0x00, 0x00, 0x00, 0xF9, 0xC5, 0x22, 0x4C,
-  0x5A, 0xC8, 0xC6, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xA8, 0x28, 0xFF,
-  0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xE7,
-  0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0x68, 0x28,
-  0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xA7, 0x28, 0xFF,
-  0x08, 0x31, 0xFF, 0x07, 0x29, 0xFE, 0xEA, 0x49, 0xCC, 0x97, 0xC5, 0x2F, 0x00,
-  0x00, 0x00, 0x79, 0xFE, 0x05, 0x2F, 0xEE, 0x87, 0x27, 0xE5, 0xFF, 0x04, 0xED,
-  0xFF, 0x24, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0x02, 0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x06, 0xED, 0xFF, 0xAC, 0xED, 0xDB, 0xB4,
-  0xF6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFE, 0x0E, 0xF0,
-  0xF5, 0xBB, 0x06, 0xED, 0xFF, 0xC2, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE1, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC5, 0xFC, 0xFF,
-  0x28, 0xF5, 0xFF, 0x2F, 0xFE, 0x7A, 0xD6, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x58,
-  0xB5, 0x39, 0x28, 0x31, 0xE9, 0xC7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x09, 0x29,
-  0xFF, 0x87, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
-  0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7,
-  0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30,
-  0xFF, 0xCA, 0x30, 0xFF, 0xAA, 0x30, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
-  0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0x08, 0x31, 0xFF, 0xC6,
-  0x28, 0xED, 0x36, 0xB5, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF6,
-  0x66, 0x28, 0xE5, 0xFF, 0xE5, 0xEC, 0xFF, 0x04, 0xFD, 0xFF,
-  0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x43, 0xFD, 0xFF, 0xE3,
-  0xF4, 0xFF, 0xE6, 0xE4, 0xFF, 0xCE, 0xF5, 0xCE, 0xD6, 0xFE, 0x0D, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFE, 0x08, 0xCE,
-  0xED, 0xAF, 0x28, 0xED, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x24, 0xFD, 0xFF,
-  0x05, 0xFD, 0xFF, 0x08, 0xED, 0xFF, 0x52, 0xF6, 0x5F, 0xBA, 0xFE, 0x06, 0x00,
-  0x00, 0x00, 0x53, 0x9C, 0x69, 0x07, 0x41, 0xE9, 0xC7, 0x38, 0xFF, 0xC8, 0x30,
-  0xFF, 0xA8, 0x20, 0xFF, 0x0A, 0x29, 0xFF, 0x09, 0x29, 0xFF, 0xE8, 0x28, 0xFF,
-  0xA7, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC9, 0x30, 0xFF,
-  0x88, 0x28, 0xFF, 0x88, 0x20, 0xFF, 0xE9, 0x30, 0xFF, 0x2A, 0x31, 0xFF, 0xA8,
-  0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0x27, 0x31, 0xEC, 0x12, 0x8C,
-  0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xFE, 0x4C, 0x08, 0xED, 0xFF,
-  0xE5, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0x03,
-  0xF5, 0xFF, 0x04, 0xF5, 0xFF, 0xE4, 0xF4, 0xFF, 0x27, 0xF5, 0xFF, 0x8C, 0xF5,
-  0xC2, 0xF5, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x31, 0xF6, 0x79, 0x28, 0xED, 0xFF, 0xE4, 0xF4, 0xFF, 0xE3, 0xFC,
-  0xFF, 0x02, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0xE5, 0xF4, 0xFF, 0x49, 0xF5, 0xFF, 0xF0, 0xF5, 0x6F, 0xF5, 0xFF, 0x03, 0x00,
-  0x00, 0x00, 0x74, 0x9C, 0x69, 0x08, 0x39, 0xEF, 0xC7, 0x38, 0xFF, 0x86, 0x30,
-  0xFF, 0xE9, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x20, 0xFF, 0xC8, 0x18, 0xFF,
-  0xA7, 0x20, 0xFF, 0xE8, 0x30, 0xFF, 0xE9, 0x38, 0xFF, 0x87, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xA8,
-  0x28, 0xFF, 0xA8, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xC8, 0x28,
-  0xFF, 0x08, 0x29, 0xFF, 0x08, 0x29, 0xF2, 0x53, 0x94, 0x78, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0xFE, 0x5B, 0x49, 0xF5, 0xFF, 0xE5, 0xEC, 0xFF, 0x04,
-  0xF5, 0xFF, 0x03, 0xF5, 0xFF, 0xE3, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0x04, 0xFD,
-  0xFF, 0xE4, 0xF4, 0xFF, 0x06, 0xED, 0xFF, 0xEE, 0xF5, 0x90, 0xF0, 0xFF, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xF6, 0x65, 0x49, 0xED, 0xFF, 0x05, 0xF5,
-  0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x29, 0xED, 0xFF, 0x52, 0xF6, 0x53, 0xF7,
-  0xFF, 0x04, 0x00, 0x00, 0x00, 0x70, 0x7B, 0x88, 0xE7, 0x28, 0xF4, 0xC8, 0x20,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x87, 0x28, 0xFF, 0xE9, 0x28, 0xFF,
-  0xE9, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0x08, 0x31, 0xFF, 0xE8, 0x30, 0xFF, 0xC8,
-  0x28, 0xFF, 0x09, 0x31, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0xC8, 0x20,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA8, 0x28, 0xF6,
-  0x31, 0x7B, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFE, 0x46, 0x49,
-  0xED, 0xFF, 0xE5, 0xF4, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xC3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x24, 0xF5, 0xFF,
-  0x48, 0xE5, 0xFF, 0x2F, 0xEE, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xF6, 0x30, 0x8A, 0xF5, 0xF1, 0xC4, 0xEC,
-  0xFF, 0xC3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0x04, 0xFD, 0xFF, 0xE5, 0xF4, 0xFF, 0x09, 0xED, 0xFF, 0x11, 0xFE, 0x6D, 0xF7,
-  0xFF, 0x04, 0xFF, 0xFF, 0x01, 0xB1, 0x83, 0x86, 0x08, 0x31, 0xF4, 0x09, 0x31,
-  0xFF, 0xC9, 0x20, 0xFF, 0x09, 0x29, 0xFF, 0xC8, 0x20, 0xFF,
-  0x09, 0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x30, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE9, 0x28, 0xFF,
-  0xA9, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xE9, 0x30, 0xF8, 0x30, 0x7B, 0x95, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF6, 0x58, 0x49, 0xED, 0xFF, 0xE5, 0xFC,
+  0xFF, 0x08, 0x31, 0xFF, 0xC7, 0x30, 0xFF, 0x82, 0xA9, 0x30, 0xFF, 0x01, 0xC8,
+  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF,
+  0x83, 0xC9, 0x28, 0xFF, 0xB1, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x00,
+  0xC9, 0x30, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x0E, 0xC9,
+  0x30, 0xFF, 0xE9, 0x30, 0xFF, 0x87, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xE7, 0x28,
+  0xFF, 0x07, 0x29, 0xF0, 0x8C, 0x52, 0xB3, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
+  0xD6, 0xFE, 0x0E, 0xAE, 0xF5, 0xAC, 0x28, 0xED, 0xFF, 0x05, 0xF5, 0xFF, 0x23,
+  0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x04, 0x04, 0xFD, 0xFF,
+  0xC3, 0xFC, 0xFF, 0xC5, 0xF4, 0xFF, 0xCE, 0xED, 0xDF, 0xF5, 0xFE, 0x0F, 0x99,
+  0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x04, 0xB7, 0xF6, 0x19, 0xCD, 0xF5,
+  0xCD, 0x06, 0xED, 0xFF, 0xE4, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x81, 0xE1, 0xFC,
+  0xFF, 0x0F, 0xC2, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0x07, 0xED,
+  0xFF, 0xEF, 0xED, 0x9B, 0xD6, 0xEE, 0x0E, 0x00, 0x00, 0x00, 0xF9, 0xC5, 0x22,
+  0x4C, 0x5A, 0xC8, 0xC6, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xC9,
+  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0x82, 0xC9,
+  0x30, 0xFF, 0x01, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x86, 0xC9, 0x28, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0xAE, 0xC8, 0x28, 0xFF, 0x82,
+  0xC9, 0x28, 0xFF, 0x06, 0xE8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xE7, 0x28, 0xFF,
+  0xC7, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0x68, 0x28, 0xFF, 0x82,
+  0xC9, 0x30, 0xFF, 0x0A, 0xA7, 0x28, 0xFF, 0x08, 0x31, 0xFF, 0x07, 0x29, 0xFE,
+  0xEA, 0x49, 0xCC, 0x97, 0xC5, 0x2F, 0x00, 0x00, 0x00, 0x79, 0xFE, 0x05, 0x2F,
+  0xEE, 0x87, 0x27, 0xE5, 0xFF, 0x04, 0xED, 0xFF, 0x24, 0xFD, 0xFF, 0x81, 0xE3,
+  0xFC, 0xFF, 0x05, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x06,
+  0xED, 0xFF, 0xAC, 0xED, 0xDB, 0xB4, 0xF6, 0x20, 0x98, 0x00, 0x00, 0x00, 0x97,
+  0x00, 0x00, 0x00, 0x03, 0xD6, 0xFE, 0x0E, 0xF0, 0xF5, 0xBB, 0x06, 0xED, 0xFF,
+  0xC2, 0xF4, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x11, 0xE1, 0xFC, 0xFF, 0x02, 0xFD,
+  0xFF, 0xE3, 0xFC, 0xFF, 0xC5, 0xFC, 0xFF, 0x28, 0xF5, 0xFF, 0x2F, 0xFE, 0x7A,
+  0xD6, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x58, 0xB5, 0x39, 0x28, 0x31, 0xE9, 0xC7,
+  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0x87, 0x20, 0xFF, 0xC8, 0x28,
+  0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0x84, 0xC8, 0x28,
+  0xFF, 0x86, 0xC9, 0x28, 0xFF, 0x83, 0xC8, 0x30, 0xFF, 0xAE, 0xC8, 0x28, 0xFF,
+  0x81, 0xC9, 0x28, 0xFF, 0x01, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x82, 0xE7,
+  0x28, 0xFF, 0x0B, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xCA, 0x30, 0xFF, 0xAA,
+  0x30, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x28,
+  0xFF, 0xA7, 0x20, 0xFF, 0x08, 0x31, 0xFF, 0xC6, 0x28, 0xED, 0x36, 0xB5, 0x47,
+  0x81, 0x00, 0x00, 0x00, 0x0B, 0x4F, 0xF6, 0x66, 0x28, 0xE5, 0xFF, 0xE5, 0xEC,
+  0xFF, 0x04, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF,
+  0x43, 0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0xE6, 0xE4, 0xFF, 0xCE, 0xF5, 0xCE, 0xD6,
+  0xFE, 0x0D, 0x97, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x16, 0xF7, 0xFE,
+  0x08, 0xCE, 0xED, 0xAF, 0x28, 0xED, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
+  0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x24, 0xFD, 0xFF, 0x05,
+  0xFD, 0xFF, 0x08, 0xED, 0xFF, 0x52, 0xF6, 0x5F, 0xBA, 0xFE, 0x06, 0x00, 0x00,
+  0x00, 0x53, 0x9C, 0x69, 0x07, 0x41, 0xE9, 0xC7, 0x38, 0xFF, 0xC8, 0x30, 0xFF,
+  0xA8, 0x20, 0xFF, 0x0A, 0x29, 0xFF, 0x09, 0x29, 0xFF, 0xE8, 0x28, 0xFF, 0xA7,
+  0x28, 0xFF, 0x81, 0xA8, 0x30, 0xFF, 0x83, 0xE8, 0x28, 0xFF, 0x83, 0xC8, 0x28,
+  0xFF, 0x87, 0xC8, 0x30, 0xFF, 0xB0, 0xC8, 0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF,
+  0x0E, 0xE8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF,
+  0xA8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0x88, 0x28, 0xFF, 0x88, 0x20, 0xFF, 0xE9,
+  0x30, 0xFF, 0x2A, 0x31, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xE8, 0x30,
+  0xFF, 0x27, 0x31, 0xEC, 0x12, 0x8C, 0x77, 0x81, 0x00, 0x00, 0x00, 0x04, 0x93,
+  0xFE, 0x4C, 0x08, 0xED, 0xFF, 0xE5, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x03, 0xFD,
+  0xFF, 0x81, 0x03, 0xF5, 0xFF, 0x04, 0x04, 0xF5, 0xFF, 0xE4, 0xF4, 0xFF, 0x27,
+  0xF5, 0xFF, 0x8C, 0xF5, 0xC2, 0xF5, 0xFE, 0x0F, 0x96, 0x00, 0x00, 0x00, 0x96,
+  0x00, 0x00, 0x00, 0x18, 0x31, 0xF6, 0x79, 0x28, 0xED, 0xFF, 0xE4, 0xF4, 0xFF,
+  0xE3, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4,
+  0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0x49, 0xF5, 0xFF, 0xF0, 0xF5, 0x6F, 0xF5, 0xFF,
+  0x03, 0x00, 0x00, 0x00, 0x74, 0x9C, 0x69, 0x08, 0x39, 0xEF, 0xC7, 0x38, 0xFF,
+  0x86, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x20, 0xFF, 0xC8,
+  0x18, 0xFF, 0xA7, 0x20, 0xFF, 0xE8, 0x30, 0xFF, 0xE9, 0x38, 0xFF, 0x87, 0x28,
+  0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x8A, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x30, 0xFF,
+  0xAF, 0xC8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x83, 0xE8, 0x28, 0xFF, 0x81,
+  0xC8, 0x28, 0xFF, 0x0B, 0xC8, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
+  0xE9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0x09,
+  0x31, 0xFF, 0xC8, 0x28, 0xFF, 0x08, 0x29, 0xFF, 0x08, 0x29, 0xF2, 0x53, 0x94,
+  0x78, 0x81, 0x00, 0x00, 0x00, 0x05, 0x10, 0xFE, 0x5B, 0x49, 0xF5, 0xFF, 0xE5,
+  0xEC, 0xFF, 0x04, 0xF5, 0xFF, 0x03, 0xF5, 0xFF, 0xE3, 0xF4, 0xFF, 0x81, 0x04,
+  0xFD, 0xFF, 0x03, 0xE4, 0xF4, 0xFF, 0x06, 0xED, 0xFF, 0xEE, 0xF5, 0x90, 0xF0,
+  0xFF, 0x02, 0x95, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x14, 0x31, 0xF6,
+  0x65, 0x49, 0xED, 0xFF, 0x05, 0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF,
+  0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x29,
+  0xED, 0xFF, 0x52, 0xF6, 0x53, 0xF7, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x70, 0x7B,
+  0x88, 0xE7, 0x28, 0xF4, 0xC8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
+  0x87, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0x81, 0xE9, 0x28, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81,
+  0xC9, 0x28, 0xFF, 0x00, 0xC9, 0x30, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xC8,
+  0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x83, 0xC9, 0x28,
+  0xFF, 0xAE, 0xC8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x00, 0xC9, 0x30, 0xFF,
+  0x83, 0xC9, 0x28, 0xFF, 0x06, 0xE8, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0x08, 0x31,
+  0xFF, 0xE8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xE9, 0x28, 0xFF,
+  0x81, 0xC8, 0x20, 0xFF, 0x04, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28,
+  0xFF, 0xA8, 0x28, 0xF6, 0x31, 0x7B, 0x94, 0x81, 0x00, 0x00, 0x00, 0x0A, 0x51,
+  0xFE, 0x46, 0x49, 0xED, 0xFF, 0xE5, 0xF4, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC,
+  0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x24, 0xF5, 0xFF,
+  0x48, 0xE5, 0xFF, 0x2F, 0xEE, 0x78, 0x95, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00,
+  0x00, 0x04, 0x73, 0xF6, 0x30, 0x8A, 0xF5, 0xF1, 0xC4, 0xEC, 0xFF, 0xC3, 0xFC,
+  0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x0F, 0x04, 0xFD, 0xFF, 0xE5,
+  0xF4, 0xFF, 0x09, 0xED, 0xFF, 0x11, 0xFE, 0x6D, 0xF7, 0xFF, 0x04, 0xFF, 0xFF,
+  0x01, 0xB1, 0x83, 0x86, 0x08, 0x31, 0xF4, 0x09, 0x31, 0xFF, 0xC9, 0x20, 0xFF,
+  0x09, 0x29, 0xFF, 0xC8, 0x20, 0xFF, 0x09, 0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xA8,
+  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x01, 0xE9, 0x28, 0xFF,
+  0xC8, 0x28, 0xFF, 0x83, 0xC9, 0x28, 0xFF, 0x00, 0xA9, 0x30, 0xFF, 0x82, 0xC9,
+  0x28, 0xFF, 0x84, 0xE8, 0x28, 0xFF, 0x85, 0xC9, 0x28, 0xFF, 0x88, 0xC8, 0x28,
+  0xFF, 0x83, 0xC9, 0x28, 0xFF, 0x90, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF,
+  0x02, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x84, 0xC9, 0x28,
+  0xFF, 0x85, 0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x30, 0xFF, 0x82, 0xA9, 0x30, 0xFF,
+  0x81, 0xC9, 0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x00, 0xC7, 0x28, 0xFF, 0x82,
+  0xC8, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF, 0x05, 0xE8, 0x20, 0xFF, 0xE9, 0x28,
+  0xFF, 0xA9, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xE9, 0x30, 0xF8, 0x30, 0x7B, 0x95,
+  0x81, 0x00, 0x00, 0x00, 0x0A, 0x30, 0xF6, 0x58, 0x49, 0xED, 0xFF, 0xE5, 0xFC,
   0xFF, 0xE4, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x23, 0xFD, 0xFF,
-  0xE2, 0xF4, 0xFF, 0x05, 0xE5, 0xFF, 0x6A, 0xED, 0xFF, 0x51, 0xFE, 0x3F, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xFE, 0x1C, 0x2A, 0xE5,
+  0xE2, 0xF4, 0xFF, 0x05, 0xE5, 0xFF, 0x6A, 0xED, 0xFF, 0x51, 0xFE, 0x3F, 0x94,
+  0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x10, 0x94, 0xFE, 0x1C, 0x2A, 0xE5,
   0xF7, 0x25, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
   0xE4, 0xFC, 0xFF, 0xC4, 0xF4, 0xFF, 0x25, 0xFD, 0xFF, 0x28, 0xED, 0xFF, 0x11,
   0xEE, 0x7E, 0xBA, 0xFE, 0x06, 0x00, 0x00, 0x00, 0xB2, 0x83, 0x79, 0x08, 0x31,
-  0xF6, 0xA7, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xCA, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF,
-  0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x30, 0xFF, 0xE8, 0x30, 0xF9, 0x70, 0x7B, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x52, 0xF6, 0x6C, 0x29, 0xED, 0xFF, 0x06, 0xFD, 0xFF, 0xA2, 0xFC, 0xFF,
-  0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x05,
-  0xF5, 0xFF, 0x08, 0xED, 0xFF, 0x92, 0xFE, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFE, 0x07, 0xAC, 0xED,
-  0xB0, 0x06, 0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x27,
-  0xED, 0xFF, 0xCD, 0xED, 0x90, 0x36, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xB2, 0x83,
-  0x7E, 0x8B, 0x41, 0xF2, 0xA8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
-  0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x87, 0x20, 0xFF, 0x8A, 0x41, 0xF6, 0x70, 0x73,
-  0x8E, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x0F, 0xF6, 0x77, 0x28, 0xED, 0xFF,
-  0x05, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3,
-  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x8B, 0xED, 0xC9, 0xB5, 0xFE,
-  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x11, 0xF6, 0x78, 0x08, 0xED, 0xFF, 0xE4, 0xF4, 0xFF, 0x03, 0xFD, 0xFF,
-  0xE2, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x27,
-  0xFD, 0xFF, 0x6D, 0xE5, 0xC5, 0x58, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xB4, 0xA4,
-  0x57, 0x08, 0x31, 0xEE, 0xA8, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xA8, 0x28,
-  0xFF, 0xA7, 0x28, 0xFF, 0x07, 0x31, 0xF1, 0x53, 0x94, 0x67, 0x00, 0x00, 0x00,
-  0xB5, 0xFE, 0x06, 0xEE, 0xED, 0xAC, 0xE7, 0xEC, 0xFF, 0x05, 0xFD, 0xFF, 0xA2,
-  0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC,
-  0xFF, 0x06, 0xED, 0xFF, 0x2F, 0xEE, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x95, 0xFE, 0x23, 0x2A, 0xE5, 0xFB, 0x06, 0xF5, 0xFF,
-  0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC4,
-  0xF4, 0xFF, 0xE5, 0xF4, 0xFF, 0x29, 0xED, 0xF9, 0x16, 0xFF, 0x11, 0x00, 0x00,
-  0x00, 0x56, 0xBD, 0x49, 0xE7, 0x30, 0xF1, 0xC7, 0x28, 0xFF, 0x09, 0x31, 0xFF,
-  0xE8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xA8,
-  0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF,
-  0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xE9, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xC8, 0x28, 0xFF,
-  0x07, 0x29, 0xEF, 0xF5, 0xAC, 0x58, 0x00, 0x00, 0x00, 0x57, 0xFF, 0x0B, 0xAD,
-  0xF5, 0xDD, 0xA6, 0xEC, 0xFF, 0x24, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x29, 0xE5, 0xFF,
-  0x92, 0xFE, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xF7, 0xFE, 0x10, 0x8C, 0xED, 0xDC, 0xE6, 0xF4, 0xFF,
-  0xC4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x24,
-  0xFD, 0xFF, 0x05, 0xF5, 0xFF, 0x29, 0xE5, 0xFF, 0xD3, 0xFE, 0x30, 0x00, 0x00,
-  0x00, 0x1A, 0xD6, 0x22, 0x69, 0x39, 0xDF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xA9, 0x30, 0xFF, 0xAA, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF,
-  0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x20, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
-  0xA9, 0x30, 0xFF, 0xAA, 0x30, 0xFF, 0xAA, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x69, 0x39, 0xE0, 0xD8, 0xC5, 0x31, 0x00,
-  0x00, 0x00, 0xB5, 0xFE, 0x25, 0x4B, 0xE5, 0xFF, 0xC4, 0xF4, 0xFF, 0x03, 0xFD,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
-  0x05, 0xF5, 0xFF, 0x6A, 0xED, 0xE9, 0xF5, 0xF6, 0x16, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xED, 0x88,
-  0xE7, 0xEC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x03,
-  0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x07, 0xED, 0xFF, 0x72, 0xFE,
-  0x51, 0x00, 0x00, 0x00, 0x79, 0xDE, 0x10, 0xA9, 0x41, 0xDE, 0x09, 0x29, 0xFF,
-  0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF,
-  0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9,
-  0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x30, 0xFF, 0xAA, 0x30, 0xFF, 0xAA, 0x30, 0xFF, 0xAA, 0x30, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x09,
-  0x29, 0xFF, 0x69, 0x31, 0xDD, 0x7B, 0xDE, 0x14, 0x00, 0x00, 0x00, 0xB3, 0xFE,
-  0x36, 0xE8, 0xEC, 0xFF, 0xC5, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
-  0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x06, 0xED, 0xFF, 0xEF,
-  0xF5, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x93, 0xFE, 0x27, 0x29, 0xED, 0xFE, 0x06, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03,
-  0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE5, 0xFC, 0xFF, 0xA6, 0xEC,
-  0xFF, 0x2F, 0xFE, 0xA3, 0x79, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x2F, 0x7B, 0xAA,
-  0xC7, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xC9, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0x09,
-  0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28,
-  0xFF, 0xA8, 0x20, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9,
-  0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9,
-  0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0xAD, 0x62, 0xB5, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x71, 0xFE, 0x7C, 0xE8, 0xEC, 0xFF,
-  0x04, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x09, 0xED, 0xFF, 0x52, 0xFE, 0x36, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x36, 0xFF, 0x0A, 0x8B, 0xED, 0xD9, 0x05, 0xF5, 0xFF, 0x04, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x24, 0xFD, 0xFF, 0xA3, 0xF4, 0xFF, 0x06, 0xF5,
-  0xFF, 0x6B, 0xED, 0xF9, 0xD6, 0xFE, 0x15, 0x00, 0x00, 0x00, 0x95, 0x94, 0x76,
-  0xA6, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28,
-  0xFF, 0xC7, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xAA, 0x30, 0xFF,
-  0xAA, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9,
-  0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xC9, 0x30, 0xFF,
-  0xE8, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9,
-  0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE7, 0x28, 0xF6, 0x11, 0x8C, 0x7E, 0x00, 0x00, 0x00, 0x36, 0xFF, 0x0A,
-  0x8D, 0xED, 0xC5, 0x26, 0xF5, 0xFF, 0xA1, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE2,
-  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xA6, 0xF4, 0xFF, 0x4B, 0xF5,
-  0xE4, 0x57, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF6, 0x58, 0x06, 0xED, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xC5, 0xF4, 0xFF, 0x29, 0xED, 0xFF, 0xB5, 0xFE, 0x26, 0x00, 0x00, 0x00,
-  0x7B, 0xDE, 0x14, 0x28, 0x31, 0xEC, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xA8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28,
-  0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xE9, 0x30,
-  0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x08, 0x31, 0xFF, 0xC7, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9,
-  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE7, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE9,
-  0x20, 0xFF, 0xE9, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30,
-  0xFF, 0xE8, 0x38, 0xFF, 0x87, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0x48, 0x31, 0xE3,
-  0x39, 0xCE, 0x1A, 0x00, 0x00, 0x00, 0xF6, 0xFE, 0x1D, 0x08, 0xE5, 0xFF, 0x25,
-  0xFD, 0xFF, 0xC2, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xE7, 0xF4, 0xFF, 0x10, 0xFE, 0x66, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFE, 0x18, 0x6A, 0xED, 0xF3, 0x03,
-  0xF5, 0xFF, 0xC1, 0xFC, 0xFF, 0x24, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC,
-  0xFF, 0xE5, 0xFC, 0xFF, 0x27, 0xED, 0xFF, 0x0F, 0xEE, 0x8B,
-  0xFF, 0xFF, 0x02, 0xDB, 0xDE, 0x0E, 0x0A, 0x4A, 0xD6, 0xA7, 0x28, 0xFF, 0x09,
-  0x31, 0xFF, 0xC9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0x09, 0x39, 0xFF, 0xC7, 0x28, 0xFF, 0x88, 0x28, 0xFF, 0xA9,
-  0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xCA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0x09, 0x31, 0xFF, 0xA8, 0x28, 0xFF, 0x87, 0x20, 0xFF, 0x08, 0x31, 0xFF, 0xE7,
-  0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xC6, 0x30, 0xFF, 0xC5, 0x30, 0xFF, 0xC5, 0x30,
-  0xFF, 0xC6, 0x30, 0xFF, 0xE6, 0x30, 0xFF, 0xE6, 0x30, 0xFF,
-  0xC5, 0x30, 0xFF, 0xE6, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xE9, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0x08, 0x29, 0xFF,
-  0xC7, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9,
-  0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
-  0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0x87, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE7, 0x20, 0xFF, 0xA9, 0x39, 0xD7, 0x79, 0xCE, 0x10, 0x00, 0x00, 0x00, 0x71,
-  0xFE, 0x6F, 0xC7, 0xE4, 0xFF, 0x25, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x24, 0xFD,
-  0xFF, 0x03, 0xFD, 0xFF, 0xA2, 0xFC, 0xFF, 0xC5, 0xFC, 0xFF,
-  0x4B, 0xED, 0xFB, 0x73, 0xFE, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE,
-  0xF5, 0x99, 0x06, 0xED, 0xFF, 0x24, 0xFD, 0xFF, 0xC1, 0xFC, 0xFF, 0x04, 0xFD,
-  0xFF, 0xC4, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0x07, 0xFD, 0xFF, 0x2B, 0xDD, 0xEB,
-  0x56, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x52, 0x84, 0x7F, 0xC6, 0x30, 0xFF, 0xC8,
-  0x38, 0xFF, 0xC9, 0x30, 0xFF, 0x87, 0x20, 0xFF, 0xC9, 0x30, 0xFF, 0x0A, 0x39,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA6, 0x28, 0xFF, 0xE8,
-  0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xCA, 0x28, 0xFF, 0xAA, 0x28, 0xFF, 0xCA, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xE8,
-  0x38, 0xFF, 0xA5, 0x30, 0xFF, 0x63, 0x38, 0xFF, 0xA2, 0x40, 0xFF, 0xC2, 0x48,
-  0xFF, 0xE1, 0x48, 0xFF, 0xE1, 0x48, 0xFF, 0xE1, 0x48, 0xFF, 0xE1, 0x40, 0xFF,
-  0xE1, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xC4, 0x38, 0xFF, 0xA5, 0x38, 0xFF, 0xA7,
-  0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xCA, 0x30, 0xFF, 0xCA, 0x30,
-  0xFF, 0xA9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0x09, 0x29, 0xFF,
-  0x08, 0x21, 0xFF, 0xC7, 0x20, 0xFF, 0x09, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x20, 0xFF, 0xE9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x0A, 0x39, 0xFF, 0x88, 0x28, 0xFF,
-  0xC9, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0x28, 0x29, 0xFF, 0x90,
-  0x73, 0x8F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xAE, 0xF5, 0xCA, 0xE5, 0xF4,
-  0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xE7, 0xF4, 0xFF, 0xAD, 0xF5, 0xAF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xF5, 0xFE, 0x16, 0x49, 0xED, 0xF9, 0x04, 0xFD, 0xFF, 0xC2, 0xFC,
-  0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xA5, 0xF4, 0xFF,
-  0x09, 0xE5, 0xFF, 0xB4, 0xF6, 0x43, 0x00, 0x00, 0x00, 0xF8, 0xBD, 0x2C, 0x47,
-  0x29, 0xED, 0xE7, 0x30, 0xFF, 0x66, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x09, 0x31,
-  0xFF, 0xE9, 0x30, 0xFF, 0x87, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x08,
-  0x31, 0xFF, 0xC7, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xEA, 0x28,
-  0xFF, 0xC9, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0x08, 0x31, 0xFF,
-  0xC6, 0x28, 0xFF, 0x06, 0x31, 0xFF, 0xC5, 0x30, 0xFF, 0xC3, 0x38, 0xFF, 0xC3,
-  0x40, 0xFF, 0xA2, 0x40, 0xFF, 0x44, 0x59, 0xFF, 0xA8, 0x8A, 0xFF, 0x8A, 0xB3,
-  0xFF, 0xEA, 0xC3, 0xFF, 0x2A, 0xCC, 0xFF, 0x6A, 0xD4, 0xFF, 0x6A, 0xD4, 0xFF,
-  0x69, 0xCC, 0xFF, 0x49, 0xC4, 0xFF, 0x4A, 0xC4, 0xFF, 0xEA, 0xB3, 0xFF, 0x28,
-  0x9B, 0xFF, 0x06, 0x72, 0xFF, 0x24, 0x59, 0xFF, 0xC4, 0x48, 0xFF, 0xA4, 0x40,
-  0xFF, 0x85, 0x38, 0xFF, 0x86, 0x38, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xE8, 0x20, 0xFF, 0xC8, 0x20, 0xFF, 0x09,
-  0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30,
-  0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF,
-  0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9,
-  0x20, 0xFF, 0xE9, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
-  0x68, 0x20, 0xFF, 0xEA, 0x30, 0xFF, 0xEA, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xC7,
-  0x28, 0xFF, 0xE7, 0x28, 0xFF, 0x27, 0x29, 0xED, 0x77, 0xB5, 0x3F, 0x00, 0x00,
-  0x00, 0xB5, 0xFE, 0x35, 0x08, 0xE5, 0xFF, 0x04, 0xF5, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xF5, 0xFF, 0xE5, 0xFC, 0xFF, 0x4A,
-  0xF5, 0xFF, 0x94, 0xFE, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xED, 0xAE, 0xE6, 0xEC, 0xFF, 0x03, 0xFD,
-  0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF,
-  0xE7, 0xEC, 0xFF, 0xCE, 0xF5, 0xB9, 0xD6, 0xFE, 0x07, 0xDB, 0xDE, 0x07, 0x6C,
-  0x52, 0xCC, 0x85, 0x20, 0xFF, 0x08, 0x39, 0xFF, 0xA7, 0x30, 0xFF, 0x88, 0x28,
-  0xFF, 0xA8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE9, 0x30, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x08, 0x29,
-  0xFF, 0x08, 0x29, 0xFF, 0xE8, 0x20, 0xFF, 0xC8, 0x20, 0xFF, 0xC8, 0x20, 0xFF,
-  0xC7, 0x28, 0xFF, 0xE5, 0x30, 0xFF, 0xE2, 0x38, 0xFF, 0xA1, 0x61, 0xFF, 0xC3,
-  0x8A, 0xFF, 0xC5, 0xBB, 0xFF, 0xA8, 0xE4, 0xFF, 0x09, 0xF5, 0xFF, 0xC8, 0xF4,
-  0xFF, 0xA7, 0xF4, 0xFF, 0xC7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF,
-  0xE6, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0x06, 0xF5, 0xFF, 0x06, 0xF5, 0xFF, 0x06,
-  0xF5, 0xFF, 0x07, 0xED, 0xFF, 0x07, 0xED, 0xFF, 0xE8, 0xE4, 0xFF, 0x68, 0xD4,
-  0xFF, 0x86, 0xB3, 0xFF, 0x42, 0x8A, 0xFF, 0x62, 0x69, 0xFF,
-  0x83, 0x38, 0xFF, 0xC7, 0x38, 0xFF, 0xC7, 0x38, 0xFF, 0x87, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0x09, 0x29, 0xFF, 0xA8, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xA7, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC9, 0x28, 0xFF, 0xEA, 0x28, 0xFF, 0xEA, 0x28, 0xFF, 0x68, 0x20, 0xFF, 0xA8,
-  0x28, 0xFF, 0x09, 0x31, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0xEA, 0x49,
-  0xD4, 0x7F, 0xCE, 0x05, 0x00, 0x00, 0x00, 0x30, 0xF6, 0x90, 0x06, 0xED, 0xFF,
-  0x04, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0xC4,
-  0xFC, 0xFF, 0xE7, 0xF4, 0xFF, 0x8E, 0xF5, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xF6, 0x36, 0x29, 0xDD,
-  0xFF, 0xE4, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF,
-  0x04, 0xFD, 0xFF, 0x26, 0xF5, 0xFF, 0x8A, 0xED, 0xFF, 0x35, 0xFF, 0x1C, 0x00,
-  0x00, 0x00, 0xB6, 0xA4, 0x56, 0xC7, 0x28, 0xFB, 0xE8, 0x30, 0xFF, 0xA7, 0x28,
-  0xFF, 0xE9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF,
-  0x09, 0x29, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28,
-  0xFF, 0xE8, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0xC7, 0x28, 0xFF, 0xC6, 0x28, 0xFF,
-  0xE6, 0x30, 0xFF, 0xE5, 0x38, 0xFF, 0xC3, 0x40, 0xFF, 0xE5, 0x69, 0xFF, 0x2A,
-  0xBC, 0xFF, 0x6B, 0xED, 0xFF, 0x27, 0xED, 0xFF, 0xE4, 0xF4, 0xFF, 0x03, 0xFD,
-  0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD,
-  0xFF, 0x24, 0xFD, 0xFF, 0x05, 0xF5, 0xFF, 0x06, 0xF5, 0xFF, 0xE6, 0xEC, 0xFF,
-  0xC9, 0xE4, 0xFF, 0xAA, 0xB3, 0xFF, 0x23, 0x59, 0xFF, 0xA2, 0x40, 0xFF, 0xE5,
-  0x40, 0xFF, 0xA6, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xA8, 0x20,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x30, 0xFF,
-  0xC7, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x0A, 0x29, 0xFF, 0xA9,
-  0x20, 0xFF, 0xEA, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0xE8, 0x30,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFA, 0x54, 0x94, 0x69, 0x00, 0x00, 0x00,
-  0xF7, 0xFE, 0x08, 0x4A, 0xE5, 0xF7, 0x25, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2,
-  0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0xC4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x09, 0xED,
-  0xFF, 0x72, 0xFE, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xEE,
-  0x9E, 0x06, 0xED, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xEC, 0xFF, 0x67, 0xF5, 0xFF, 0xCE,
-  0xDD, 0x86, 0xF5, 0xFF, 0x03, 0x9B, 0xEE, 0x17, 0x29, 0x41, 0xE4, 0xC8, 0x30,
-  0xFF, 0xA8, 0x30, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x20, 0xFF, 0xE9, 0x30, 0xFF, 0xE7, 0x38, 0xFF,
-  0x84, 0x38, 0xFF, 0xA2, 0x48, 0xFF, 0x04, 0x82, 0xFF, 0xC8, 0xC3, 0xFF, 0xC9,
-  0xEC, 0xFF, 0xC6, 0xF4, 0xFF, 0xE5, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x26, 0xFD, 0xFF, 0xE6, 0xEC, 0xFF, 0xE8,
-  0xE4, 0xFF, 0x86, 0xB3, 0xFF, 0xA2, 0x69, 0xFF, 0xA3, 0x40, 0xFF, 0x85, 0x30,
-  0xFF, 0xA8, 0x30, 0xFF, 0xEA, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x20, 0xFF, 0xC9, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x38,
-  0xFF, 0x67, 0x28, 0xFF, 0x0A, 0x39, 0xFF, 0xC8, 0x28, 0xFF,
-  0x89, 0x39, 0xE4, 0xF8, 0xCD, 0x22, 0x00, 0x00, 0x00, 0x31, 0xEE, 0x74, 0x06,
-  0xF5, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xE5, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0xCC, 0xFD, 0xB6, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xB5, 0xF6, 0x1F, 0x48, 0xE5, 0xFF, 0x04, 0xF5, 0xFF, 0x04, 0xFD, 0xFF,
-  0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x45, 0xF5, 0xFF, 0x69,
-  0xDD, 0xFF, 0x37, 0xFF, 0x13, 0x00, 0x00, 0x00, 0x50, 0x83, 0x92, 0xC8, 0x38,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x20, 0xFF, 0xE9, 0x30, 0xFF,
-  0xA7, 0x38, 0xFF, 0x63, 0x40, 0xFF, 0x63, 0x69, 0xFF, 0x47, 0xB3, 0xFF, 0xA9,
-  0xEC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC,
-  0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2,
-  0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03,
-  0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x27, 0xED, 0xFF, 0xEA, 0xE4, 0xFF, 0xC6, 0x92,
-  0xFF, 0xE2, 0x50, 0xFF, 0xA6, 0x38, 0xFF, 0x87, 0x30, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xC8, 0x20, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xC9, 0x38, 0xFF, 0xA9, 0x30, 0xFF,
-  0xA8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0x2E, 0x6B, 0x9E, 0x00, 0x00, 0x00, 0x39,
-  0xFF, 0x0A, 0x49, 0xE5, 0xF8, 0x04, 0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x27, 0xF5, 0xFF,
-  0xB5, 0xF6, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xED, 0xAE, 0x06, 0xF5, 0xFF,
+  0xF6, 0xA7, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x00, 0xE9,
+  0x28, 0xFF, 0x83, 0xC8, 0x28, 0xFF, 0x8A, 0xC9, 0x28, 0xFF, 0x86, 0xC8, 0x28,
+  0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xCA, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF,
+  0x83, 0xC8, 0x28, 0xFF, 0x06, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30,
+  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
+  0x81, 0xC9, 0x28, 0xFF, 0x86, 0xE8, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x82,
+  0xC9, 0x28, 0xFF, 0x83, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x00, 0xC9,
+  0x30, 0xFF, 0x84, 0xA9, 0x30, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x83, 0xE8, 0x28,
+  0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x84, 0xC9, 0x28, 0xFF, 0x86, 0xC8, 0x28, 0xFF,
+  0x81, 0xC9, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF, 0x04, 0xC9, 0x20, 0xFF, 0xC9,
+  0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xE8, 0x30, 0xF9, 0x70, 0x7B, 0x87, 0x81, 0x00,
+  0x00, 0x00, 0x0A, 0x52, 0xF6, 0x6C, 0x29, 0xED, 0xFF, 0x06, 0xFD, 0xFF, 0xA2,
+  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC,
+  0xFF, 0x05, 0xF5, 0xFF, 0x08, 0xED, 0xFF, 0x92, 0xFE, 0x22, 0x93, 0x00, 0x00,
+  0x00, 0x92, 0x00, 0x00, 0x00, 0x04, 0xD6, 0xFE, 0x07, 0xAC, 0xED, 0xB0, 0x06,
+  0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x81, 0xC3, 0xFC, 0xFF, 0x09,
+  0xC4, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x27, 0xED, 0xFF, 0xCD, 0xED, 0x90, 0x36,
+  0xFF, 0x0A, 0x00, 0x00, 0x00, 0xB2, 0x83, 0x7E, 0x8B, 0x41, 0xF2, 0xA8, 0x28,
+  0xFF, 0x09, 0x31, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x01, 0xE9, 0x30, 0xFF, 0xA8,
+  0x28, 0xFF, 0x83, 0xC8, 0x28, 0xFF, 0x83, 0xC9, 0x28, 0xFF, 0x8E, 0xC8, 0x28,
+  0xFF, 0x84, 0xC9, 0x28, 0xFF, 0x85, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF,
+  0x81, 0xC9, 0x30, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x8F, 0xC8, 0x28, 0xFF, 0x00,
+  0xE8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x00, 0xC9, 0x30, 0xFF, 0x82, 0xA9,
+  0x30, 0xFF, 0x00, 0xC9, 0x30, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x00, 0xC8, 0x28,
+  0xFF, 0x83, 0xE8, 0x28, 0xFF, 0x90, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF,
+  0x11, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x87, 0x20, 0xFF, 0x8A, 0x41, 0xF6,
+  0x70, 0x73, 0x8E, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x0F, 0xF6, 0x77, 0x28,
+  0xED, 0xFF, 0x05, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC,
+  0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x8B, 0xED, 0xC9,
+  0xB5, 0xFE, 0x06, 0x92, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x0F, 0x11,
+  0xF6, 0x78, 0x08, 0xED, 0xFF, 0xE4, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC,
+  0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x27, 0xFD, 0xFF,
+  0x6D, 0xE5, 0xC5, 0x58, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xB4, 0xA4, 0x57, 0x08,
+  0x31, 0xEE, 0xA8, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x81,
+  0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x85, 0xC8, 0x28, 0xFF, 0x81, 0xC9,
+  0x28, 0xFF, 0x91, 0xC8, 0x28, 0xFF, 0x85, 0xE8, 0x28, 0xFF, 0x86, 0xC8, 0x28,
+  0xFF, 0x83, 0xC8, 0x30, 0xFF, 0x82, 0xC9, 0x30, 0xFF, 0x81, 0xC8, 0x30, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x00, 0xC7, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x01,
+  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x83, 0xE8, 0x28, 0xFF, 0x84, 0xC9, 0x28,
+  0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x93, 0xC8, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF,
+  0x00, 0xC9, 0x28, 0xFF, 0x81, 0xE9, 0x30, 0xFF, 0x0F, 0xA8, 0x28, 0xFF, 0xA7,
+  0x28, 0xFF, 0x07, 0x31, 0xF1, 0x53, 0x94, 0x67, 0x00, 0x00, 0x00, 0xB5, 0xFE,
+  0x06, 0xEE, 0xED, 0xAC, 0xE7, 0xEC, 0xFF, 0x05, 0xFD, 0xFF, 0xA2, 0xFC, 0xFF,
+  0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0x06,
+  0xED, 0xFF, 0x2F, 0xEE, 0x8F, 0x92, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x03, 0x95, 0xFE, 0x23, 0x2A, 0xE5, 0xFB, 0x06, 0xF5, 0xFF, 0x03, 0xFD, 0xFF,
+  0x81, 0xE2, 0xFC, 0xFF, 0x0B, 0xE3, 0xFC, 0xFF, 0xC4, 0xF4, 0xFF, 0xE5, 0xF4,
+  0xFF, 0x29, 0xED, 0xF9, 0x16, 0xFF, 0x11, 0x00, 0x00, 0x00, 0x56, 0xBD, 0x49,
+  0xE7, 0x30, 0xF1, 0xC7, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xE8, 0x28, 0xFF, 0xA8,
+  0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x01, 0xA8, 0x28, 0xFF, 0xE9, 0x30, 0xFF,
+  0x85, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x99, 0xC8, 0x28, 0xFF, 0x00,
+  0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x02, 0xE8, 0x28, 0xFF, 0xE7, 0x28,
+  0xFF, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x01, 0xA8, 0x30, 0xFF, 0xA9,
+  0x30, 0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x87, 0xC8, 0x28,
+  0xFF, 0x01, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x83,
+  0xE9, 0x28, 0xFF, 0x83, 0xE8, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x82, 0xC8,
+  0x30, 0xFF, 0x8F, 0xC8, 0x28, 0xFF, 0x0F, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
+  0xA8, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xE8,
+  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x07, 0x29, 0xEF, 0xF5, 0xAC, 0x58, 0x00, 0x00,
+  0x00, 0x57, 0xFF, 0x0B, 0xAD, 0xF5, 0xDD, 0xA6, 0xEC, 0xFF, 0x24, 0xFD, 0xFF,
+  0xC2, 0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x03, 0xE3, 0xFC, 0xFF, 0x05, 0xF5,
+  0xFF, 0x29, 0xE5, 0xFF, 0x92, 0xFE, 0x2E, 0x91, 0x00, 0x00, 0x00, 0x90, 0x00,
+  0x00, 0x00, 0x04, 0xF7, 0xFE, 0x10, 0x8C, 0xED, 0xDC, 0xE6, 0xF4, 0xFF, 0xC4,
+  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x06, 0x24, 0xFD, 0xFF,
+  0x05, 0xF5, 0xFF, 0x29, 0xE5, 0xFF, 0xD3, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x1A,
+  0xD6, 0x22, 0x69, 0x39, 0xDF, 0x81, 0xE8, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF,
+  0x81, 0xE8, 0x28, 0xFF, 0x02, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x30,
+  0xFF, 0x9A, 0xC8, 0x28, 0xFF, 0x02, 0xC9, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xAA,
+  0x30, 0xFF, 0x82, 0xA9, 0x30, 0xFF, 0x00, 0xC9, 0x30, 0xFF, 0x82, 0xC9, 0x28,
+  0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x01, 0xE7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0x82,
+  0xC9, 0x28, 0xFF, 0x84, 0xC8, 0x28, 0xFF, 0x83, 0xC9, 0x28, 0xFF, 0x81, 0xC8,
+  0x28, 0xFF, 0x8B, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x01, 0xC9, 0x30,
+  0xFF, 0xA9, 0x30, 0xFF, 0x81, 0xAA, 0x30, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x91,
+  0xC8, 0x28, 0xFF, 0x01, 0xC8, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0x81, 0xC9, 0x30,
+  0xFF, 0x0F, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x69, 0x39, 0xE0, 0xD8, 0xC5,
+  0x31, 0x00, 0x00, 0x00, 0xB5, 0xFE, 0x25, 0x4B, 0xE5, 0xFF, 0xC4, 0xF4, 0xFF,
+  0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3,
+  0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x6A, 0xED, 0xE9, 0xF5, 0xF6, 0x16, 0x90, 0x00,
+  0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x0E, 0xF0, 0xED, 0x88, 0xE7, 0xEC, 0xFF,
+  0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3,
+  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x07, 0xED, 0xFF, 0x72, 0xFE, 0x51, 0x00, 0x00,
+  0x00, 0x79, 0xDE, 0x10, 0xA9, 0x41, 0xDE, 0x09, 0x29, 0xFF, 0xE9, 0x28, 0xFF,
+  0x86, 0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x97, 0xC8, 0x28, 0xFF, 0x82,
+  0xC9, 0x28, 0xFF, 0x83, 0xA9, 0x30, 0xFF, 0x82, 0xC9, 0x30, 0xFF, 0x01, 0xC9,
+  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x83, 0xE8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF,
+  0x83, 0xC8, 0x28, 0xFF, 0x85, 0xC9, 0x28, 0xFF, 0x01, 0xC8, 0x28, 0xFF, 0xE8,
+  0x28, 0xFF, 0x85, 0xC8, 0x28, 0xFF, 0x84, 0xE8, 0x28, 0xFF, 0x02, 0xC8, 0x28,
+  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x82, 0xAA, 0x30, 0xFF, 0x00, 0xC9,
+  0x28, 0xFF, 0x8E, 0xC8, 0x28, 0xFF, 0x00, 0xE8, 0x30, 0xFF, 0x81, 0xC8, 0x30,
+  0xFF, 0x00, 0xC9, 0x30, 0xFF, 0x84, 0xC9, 0x28, 0xFF, 0x08, 0x09, 0x29, 0xFF,
+  0x69, 0x31, 0xDD, 0x7B, 0xDE, 0x14, 0x00, 0x00, 0x00, 0xB3, 0xFE, 0x36, 0xE8,
+  0xEC, 0xFF, 0xC5, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xE2,
+  0xFC, 0xFF, 0x02, 0x03, 0xFD, 0xFF, 0x06, 0xED, 0xFF, 0xEF, 0xF5, 0x96, 0x90,
+  0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x17, 0x93, 0xFE, 0x27, 0x29, 0xED,
+  0xFE, 0x06, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF,
+  0x04, 0xFD, 0xFF, 0xE5, 0xFC, 0xFF, 0xA6, 0xEC, 0xFF, 0x2F, 0xFE, 0xA3, 0x79,
+  0xFE, 0x05, 0x00, 0x00, 0x00, 0x2F, 0x7B, 0xAA, 0xC7, 0x28, 0xFF, 0xE8, 0x20,
+  0xFF, 0xC9, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xC8, 0x28, 0xFF,
+  0xA8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0xE9,
+  0x30, 0xFF, 0x96, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x87, 0xC8, 0x28,
+  0xFF, 0x81, 0xC7, 0x30, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x01, 0xA9, 0x30, 0xFF,
+  0xC9, 0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x00, 0xE9, 0x28, 0xFF, 0x87, 0xC9,
+  0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x83, 0xA9, 0x30,
+  0xFF, 0x00, 0xC9, 0x30, 0xFF, 0x85, 0xC8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF,
+  0x82, 0xC9, 0x30, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x8E, 0xC8, 0x28, 0xFF, 0x01,
+  0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x83, 0xC9, 0x28,
+  0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x01, 0xC7, 0x20, 0xFF, 0xAD, 0x62, 0xB5, 0x81,
+  0x00, 0x00, 0x00, 0x09, 0x71, 0xFE, 0x7C, 0xE8, 0xEC, 0xFF, 0x04, 0xFD, 0xFF,
+  0x23, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x05,
+  0xF5, 0xFF, 0x09, 0xED, 0xFF, 0x52, 0xFE, 0x36, 0x8F, 0x00, 0x00, 0x00, 0x8E,
+  0x00, 0x00, 0x00, 0x0F, 0x36, 0xFF, 0x0A, 0x8B, 0xED, 0xD9, 0x05, 0xF5, 0xFF,
+  0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x24, 0xFD, 0xFF, 0xA3,
+  0xF4, 0xFF, 0x06, 0xF5, 0xFF, 0x6B, 0xED, 0xF9, 0xD6, 0xFE, 0x15, 0x00, 0x00,
+  0x00, 0x95, 0x94, 0x76, 0xA6, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x20, 0xFF,
+  0x81, 0xE9, 0x28, 0xFF, 0x02, 0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x30,
+  0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x00, 0xE9, 0x30, 0xFF, 0x97, 0xC8, 0x28, 0xFF,
+  0x82, 0xC9, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x84, 0xE8, 0x28, 0xFF, 0x05,
+  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xC8,
+  0x30, 0xFF, 0xC9, 0x30, 0xFF, 0x81, 0xAA, 0x30, 0xFF, 0x82, 0xE8, 0x28, 0xFF,
+  0x00, 0xE9, 0x28, 0xFF, 0x85, 0xC9, 0x28, 0xFF, 0x84, 0xC8, 0x28, 0xFF, 0x00,
+  0xC9, 0x30, 0xFF, 0x82, 0xA9, 0x30, 0xFF, 0x00, 0xC9, 0x30, 0xFF, 0x88, 0xC8,
+  0x30, 0xFF, 0x92, 0xC8, 0x28, 0xFF, 0x02, 0xA8, 0x30, 0xFF, 0xC9, 0x30, 0xFF,
+  0xE8, 0x30, 0xFF, 0x82, 0xE9, 0x28, 0xFF, 0x01, 0xC9, 0x20, 0xFF, 0xE9, 0x28,
+  0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x0E, 0xC8, 0x28, 0xFF, 0xE7, 0x28, 0xF6, 0x11,
+  0x8C, 0x7E, 0x00, 0x00, 0x00, 0x36, 0xFF, 0x0A, 0x8D, 0xED, 0xC5, 0x26, 0xF5,
+  0xFF, 0xA1, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
+  0x04, 0xFD, 0xFF, 0xA6, 0xF4, 0xFF, 0x4B, 0xF5, 0xE4, 0x57, 0xFF, 0x0B, 0x8E,
+  0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x10, 0x30, 0xF6, 0x58, 0x06, 0xED,
+  0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
+  0xE4, 0xFC, 0xFF, 0xC5, 0xF4, 0xFF, 0x29, 0xED, 0xFF, 0xB5, 0xFE, 0x26, 0x00,
+  0x00, 0x00, 0x7B, 0xDE, 0x14, 0x28, 0x31, 0xEC, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
+  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x02, 0xA8,
+  0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0x83, 0xC9, 0x28, 0xFF, 0x01,
+  0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x28,
+  0xFF, 0x00, 0xE9, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF,
+  0x82, 0xE8, 0x28, 0xFF, 0x82, 0xE9, 0x28, 0xFF, 0x02, 0xC8, 0x28, 0xFF, 0xE8,
+  0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF,
+  0x04, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x28, 0xFF,
+  0xE9, 0x30, 0xFF, 0x81, 0xC7, 0x28, 0xFF, 0x03, 0x08, 0x31, 0xFF, 0xC7, 0x28,
+  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x81, 0xA9, 0x30, 0xFF, 0x02, 0xC9,
+  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x81, 0xE7, 0x28, 0xFF, 0x00,
+  0xE8, 0x28, 0xFF, 0x8E, 0xC8, 0x28, 0xFF, 0x03, 0xC9, 0x28, 0xFF, 0xC9, 0x30,
+  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xE9, 0x20, 0xFF, 0x0C, 0xE9,
+  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xE8, 0x38, 0xFF, 0x87, 0x28,
+  0xFF, 0xE7, 0x28, 0xFF, 0x48, 0x31, 0xE3, 0x39, 0xCE, 0x1A, 0x00, 0x00, 0x00,
+  0xF6, 0xFE, 0x1D, 0x08, 0xE5, 0xFF, 0x25, 0xFD, 0xFF, 0xC2, 0xF4, 0xFF, 0x81,
+  0xE3, 0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x01, 0xE7, 0xF4, 0xFF, 0x10, 0xFE,
+  0x66, 0x8E, 0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x0F, 0xB3, 0xFE, 0x18,
+  0x6A, 0xED, 0xF3, 0x03, 0xF5, 0xFF, 0xC1, 0xFC, 0xFF, 0x24, 0xFD, 0xFF, 0xE4,
+  0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x27, 0xED, 0xFF, 0x0F, 0xEE,
+  0x8B, 0xFF, 0xFF, 0x02, 0xDB, 0xDE, 0x0E, 0x0A, 0x4A, 0xD6, 0xA7, 0x28, 0xFF,
+  0x09, 0x31, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xA8, 0x28, 0xFF, 0x9F, 0xC8, 0x28,
+  0xFF, 0x05, 0x09, 0x39, 0xFF, 0xC7, 0x28, 0xFF, 0x88, 0x28, 0xFF, 0xA9, 0x28,
+  0xFF, 0xCA, 0x30, 0xFF, 0xCA, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xE8,
+  0x28, 0xFF, 0x05, 0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xA8,
+  0x28, 0xFF, 0x87, 0x20, 0xFF, 0x08, 0x31, 0xFF, 0x81, 0xE7, 0x30, 0xFF, 0x00,
+  0xC6, 0x30, 0xFF, 0x81, 0xC5, 0x30, 0xFF, 0x00, 0xC6, 0x30, 0xFF, 0x81, 0xE6,
+  0x30, 0xFF, 0x05, 0xC5, 0x30, 0xFF, 0xE6, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xE8,
+  0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xA9, 0x28, 0xFF, 0x07,
+  0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0x08,
+  0x29, 0xFF, 0xC7, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0x82, 0xA9,
+  0x30, 0xFF, 0x02, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x81,
+  0xE7, 0x28, 0xFF, 0x00, 0xE8, 0x28, 0xFF, 0x8D, 0xC8, 0x28, 0xFF, 0x82, 0xC9,
+  0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x01, 0xE8, 0x28, 0xFF, 0xE9, 0x20, 0xFF,
+  0x81, 0xC9, 0x28, 0xFF, 0x11, 0x87, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xE9, 0x30,
+  0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x20, 0xFF, 0xA9, 0x39, 0xD7, 0x79, 0xCE, 0x10,
+  0x00, 0x00, 0x00, 0x71, 0xFE, 0x6F, 0xC7, 0xE4, 0xFF, 0x25, 0xFD, 0xFF, 0xE2,
+  0xFC, 0xFF, 0x24, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xA2, 0xFC, 0xFF, 0xC5, 0xFC,
+  0xFF, 0x4B, 0xED, 0xFB, 0x73, 0xFE, 0x24, 0x8D, 0x00, 0x00, 0x00, 0x8D, 0x00,
+  0x00, 0x00, 0x11, 0xCE, 0xF5, 0x99, 0x06, 0xED, 0xFF, 0x24, 0xFD, 0xFF, 0xC1,
+  0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC4, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0x07, 0xFD,
+  0xFF, 0x2B, 0xDD, 0xEB, 0x56, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x52, 0x84, 0x7F,
+  0xC6, 0x30, 0xFF, 0xC8, 0x38, 0xFF, 0xC9, 0x30, 0xFF, 0x87, 0x20, 0xFF, 0xC9,
+  0x30, 0xFF, 0x0A, 0x39, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x12, 0xA6, 0x28, 0xFF,
+  0xE8, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xCA, 0x28, 0xFF, 0xAA, 0x28, 0xFF, 0xCA,
+  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x28,
+  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x30, 0xFF,
+  0xE8, 0x38, 0xFF, 0xA5, 0x30, 0xFF, 0x63, 0x38, 0xFF, 0xA2, 0x40, 0xFF, 0xC2,
+  0x48, 0xFF, 0x82, 0xE1, 0x48, 0xFF, 0x81, 0xE1, 0x40, 0xFF, 0x05, 0xC2, 0x40,
+  0xFF, 0xC4, 0x38, 0xFF, 0xA5, 0x38, 0xFF, 0xA7, 0x30, 0xFF, 0xA8, 0x30, 0xFF,
+  0xA9, 0x30, 0xFF, 0x81, 0xCA, 0x30, 0xFF, 0x08, 0xA9, 0x28, 0xFF, 0xE9, 0x28,
+  0xFF, 0xC8, 0x20, 0xFF, 0x09, 0x29, 0xFF, 0x08, 0x21, 0xFF, 0xC7, 0x20, 0xFF,
+  0x09, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x82, 0xA9, 0x30, 0xFF,
+  0x81, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x8E, 0xC8, 0x28, 0xFF, 0x04,
+  0xC9, 0x28, 0xFF, 0xE9, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC7,
+  0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x11, 0x0A, 0x39,
+  0xFF, 0x88, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xA7, 0x20, 0xFF,
+  0x28, 0x29, 0xFF, 0x90, 0x73, 0x8F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xAE,
+  0xF5, 0xCA, 0xE5, 0xF4, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD,
+  0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE7, 0xF4, 0xFF, 0xAD, 0xF5, 0xAF,
+  0x8D, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x12, 0xF5, 0xFE, 0x16, 0x49,
+  0xED, 0xF9, 0x04, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC,
+  0xFF, 0xE4, 0xFC, 0xFF, 0xA5, 0xF4, 0xFF, 0x09, 0xE5, 0xFF, 0xB4, 0xF6, 0x43,
+  0x00, 0x00, 0x00, 0xF8, 0xBD, 0x2C, 0x47, 0x29, 0xED, 0xE7, 0x30, 0xFF, 0x66,
+  0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x09, 0x31, 0xFF, 0xE9, 0x30, 0xFF, 0x87, 0x20,
+  0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x12, 0x08, 0x31, 0xFF, 0xC7, 0x28, 0xFF, 0xA8,
+  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xEA, 0x28, 0xFF, 0xC9, 0x20, 0xFF, 0xE9, 0x28,
+  0xFF, 0x08, 0x31, 0xFF, 0xC6, 0x28, 0xFF, 0x06, 0x31, 0xFF, 0xC5, 0x30, 0xFF,
+  0xC3, 0x38, 0xFF, 0xC3, 0x40, 0xFF, 0xA2, 0x40, 0xFF, 0x44, 0x59, 0xFF, 0xA8,
+  0x8A, 0xFF, 0x8A, 0xB3, 0xFF, 0xEA, 0xC3, 0xFF, 0x2A, 0xCC, 0xFF, 0x81, 0x6A,
+  0xD4, 0xFF, 0x0B, 0x69, 0xCC, 0xFF, 0x49, 0xC4, 0xFF, 0x4A, 0xC4, 0xFF, 0xEA,
+  0xB3, 0xFF, 0x28, 0x9B, 0xFF, 0x06, 0x72, 0xFF, 0x24, 0x59, 0xFF, 0xC4, 0x48,
+  0xFF, 0xA4, 0x40, 0xFF, 0x85, 0x38, 0xFF, 0x86, 0x38, 0xFF, 0xC8, 0x30, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x05, 0x09, 0x29, 0xFF, 0xE8, 0x20, 0xFF, 0xC8, 0x20,
+  0xFF, 0x09, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x82, 0xC9, 0x30,
+  0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF, 0x8E, 0xC8, 0x28, 0xFF,
+  0x00, 0xC9, 0x28, 0xFF, 0x81, 0xE9, 0x20, 0xFF, 0x00, 0xE8, 0x28, 0xFF, 0x81,
+  0xC7, 0x30, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x01, 0xC9, 0x28, 0xFF, 0x68, 0x20,
+  0xFF, 0x81, 0xEA, 0x30, 0xFF, 0x08, 0xE9, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xE7,
+  0x28, 0xFF, 0x27, 0x29, 0xED, 0x77, 0xB5, 0x3F, 0x00, 0x00, 0x00, 0xB5, 0xFE,
+  0x35, 0x08, 0xE5, 0xFF, 0x04, 0xF5, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x04, 0x03,
+  0xFD, 0xFF, 0x04, 0xF5, 0xFF, 0xE5, 0xFC, 0xFF, 0x4A, 0xF5, 0xFF, 0x94, 0xFE,
+  0x1D, 0x8C, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0xED, 0xAE,
+  0xE6, 0xEC, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE4,
+  0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0xE7, 0xEC, 0xFF, 0xCE, 0xF5, 0xB9, 0xD6, 0xFE,
+  0x07, 0xDB, 0xDE, 0x07, 0x6C, 0x52, 0xCC, 0x85, 0x20, 0xFF, 0x08, 0x39, 0xFF,
+  0xA7, 0x30, 0xFF, 0x88, 0x28, 0xFF, 0x81, 0xA8, 0x28, 0xFF, 0x00, 0xE9, 0x30,
+  0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x9D, 0xC8, 0x28, 0xFF, 0x01, 0xA8, 0x28, 0xFF,
+  0xE8, 0x28, 0xFF, 0x81, 0x08, 0x29, 0xFF, 0x00, 0xE8, 0x20, 0xFF, 0x81, 0xC8,
+  0x20, 0xFF, 0x0A, 0xC7, 0x28, 0xFF, 0xE5, 0x30, 0xFF, 0xE2, 0x38, 0xFF, 0xA1,
+  0x61, 0xFF, 0xC3, 0x8A, 0xFF, 0xC5, 0xBB, 0xFF, 0xA8, 0xE4, 0xFF, 0x09, 0xF5,
+  0xFF, 0xC8, 0xF4, 0xFF, 0xA7, 0xF4, 0xFF, 0xC7, 0xFC, 0xFF, 0x81, 0xE7, 0xFC,
+  0xFF, 0x01, 0xE6, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0x82, 0x06, 0xF5, 0xFF, 0x81,
+  0x07, 0xED, 0xFF, 0x05, 0xE8, 0xE4, 0xFF, 0x68, 0xD4, 0xFF, 0x86, 0xB3, 0xFF,
+  0x42, 0x8A, 0xFF, 0x62, 0x69, 0xFF, 0x83, 0x38, 0xFF, 0x81, 0xC7, 0x38, 0xFF,
+  0x04, 0x87, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xA8, 0x20, 0xFF,
+  0xE9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x81, 0xC8,
+  0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x8E, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x06, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x30,
+  0xFF, 0xA7, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xEA, 0x28,
+  0xFF, 0x10, 0x68, 0x20, 0xFF, 0xA8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xE8, 0x28,
+  0xFF, 0xC7, 0x20, 0xFF, 0xEA, 0x49, 0xD4, 0x7F, 0xCE, 0x05, 0x00, 0x00, 0x00,
+  0x30, 0xF6, 0x90, 0x06, 0xED, 0xFF, 0x04, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03,
+  0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0xC4, 0xFC, 0xFF, 0xE7, 0xF4, 0xFF, 0x8E, 0xF5,
+  0xC8, 0x8C, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x0F, 0xB4, 0xF6, 0x36,
+  0x29, 0xDD, 0xFF, 0xE4, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC2,
+  0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x26, 0xF5, 0xFF, 0x8A, 0xED, 0xFF, 0x35, 0xFF,
+  0x1C, 0x00, 0x00, 0x00, 0xB6, 0xA4, 0x56, 0xC7, 0x28, 0xFB, 0xE8, 0x30, 0xFF,
+  0xA7, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x01, 0xC8, 0x28,
+  0xFF, 0x09, 0x29, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x9C, 0xC8, 0x28, 0xFF, 0x0E,
+  0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0xC7,
+  0x28, 0xFF, 0xC6, 0x28, 0xFF, 0xE6, 0x30, 0xFF, 0xE5, 0x38, 0xFF, 0xC3, 0x40,
+  0xFF, 0xE5, 0x69, 0xFF, 0x2A, 0xBC, 0xFF, 0x6B, 0xED, 0xFF, 0x27, 0xED, 0xFF,
+  0xE4, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xC3, 0xFC, 0xFF, 0x82, 0xE4, 0xFC,
+  0xFF, 0x82, 0xC3, 0xFC, 0xFF, 0x12, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE2,
+  0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x24, 0xFD, 0xFF, 0x05, 0xF5,
+  0xFF, 0x06, 0xF5, 0xFF, 0xE6, 0xEC, 0xFF, 0xC9, 0xE4, 0xFF, 0xAA, 0xB3, 0xFF,
+  0x23, 0x59, 0xFF, 0xA2, 0x40, 0xFF, 0xE5, 0x40, 0xFF, 0xA6, 0x30, 0xFF, 0xE8,
+  0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xA8, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xC8,
+  0x28, 0xFF, 0x00, 0xC8, 0x30, 0xFF, 0x92, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28,
+  0xFF, 0x01, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x81, 0xC7, 0x30, 0xFF, 0x15,
+  0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x0A, 0x29, 0xFF, 0xA9, 0x20, 0xFF, 0xEA,
+  0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xC8, 0x28,
+  0xFF, 0xE8, 0x28, 0xFA, 0x54, 0x94, 0x69, 0x00, 0x00, 0x00, 0xF7, 0xFE, 0x08,
+  0x4A, 0xE5, 0xF7, 0x25, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xF4, 0xFF, 0x04,
+  0xFD, 0xFF, 0xC4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x09, 0xED, 0xFF, 0x72, 0xFE,
+  0x45, 0x8B, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x10, 0x0D, 0xEE, 0x9E,
+  0x06, 0xED, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3,
+  0xFC, 0xFF, 0xC2, 0xEC, 0xFF, 0x67, 0xF5, 0xFF, 0xCE, 0xDD, 0x86, 0xF5, 0xFF,
+  0x03, 0x9B, 0xEE, 0x17, 0x29, 0x41, 0xE4, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF,
+  0xA9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF,
+  0x01, 0xA8, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x9A, 0xC8,
+  0x28, 0xFF, 0x0D, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x20, 0xFF, 0xE9,
+  0x30, 0xFF, 0xE7, 0x38, 0xFF, 0x84, 0x38, 0xFF, 0xA2, 0x48, 0xFF, 0x04, 0x82,
+  0xFF, 0xC8, 0xC3, 0xFF, 0xC9, 0xEC, 0xFF, 0xC6, 0xF4, 0xFF, 0xE5, 0xFC, 0xFF,
+  0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x01, 0xE3, 0xFC,
+  0xFF, 0xE2, 0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x00,
+  0x03, 0xFD, 0xFF, 0x83, 0xE3, 0xFC, 0xFF, 0x83, 0xE4, 0xFC, 0xFF, 0x09, 0x04,
+  0xFD, 0xFF, 0x26, 0xFD, 0xFF, 0xE6, 0xEC, 0xFF, 0xE8, 0xE4, 0xFF, 0x86, 0xB3,
+  0xFF, 0xA2, 0x69, 0xFF, 0xA3, 0x40, 0xFF, 0x85, 0x30, 0xFF, 0xA8, 0x30, 0xFF,
+  0xEA, 0x30, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x82, 0xC8, 0x30, 0xFF, 0x00, 0xC8,
+  0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x8E, 0xC8, 0x28, 0xFF, 0x84, 0xC9, 0x28,
+  0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xC7, 0x30, 0xFF, 0x0D, 0xC8, 0x28, 0xFF,
+  0xC8, 0x20, 0xFF, 0xC9, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC8,
+  0x38, 0xFF, 0x67, 0x28, 0xFF, 0x0A, 0x39, 0xFF, 0xC8, 0x28, 0xFF, 0x89, 0x39,
+  0xE4, 0xF8, 0xCD, 0x22, 0x00, 0x00, 0x00, 0x31, 0xEE, 0x74, 0x06, 0xF5, 0xFF,
+  0x81, 0xE2, 0xFC, 0xFF, 0x04, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xE5, 0xFC,
+  0xFF, 0xE5, 0xF4, 0xFF, 0xCC, 0xFD, 0xB6, 0x8B, 0x00, 0x00, 0x00, 0x8A, 0x00,
+  0x00, 0x00, 0x03, 0xB5, 0xF6, 0x1F, 0x48, 0xE5, 0xFF, 0x04, 0xF5, 0xFF, 0x04,
+  0xFD, 0xFF, 0x81, 0xC3, 0xFC, 0xFF, 0x09, 0xE3, 0xFC, 0xFF, 0x45, 0xF5, 0xFF,
+  0x69, 0xDD, 0xFF, 0x37, 0xFF, 0x13, 0x00, 0x00, 0x00, 0x50, 0x83, 0x92, 0xC8,
+  0x38, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x28, 0xFF, 0x81, 0xC9,
+  0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x00, 0xC8, 0x28,
+  0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x91, 0xC8, 0x28, 0xFF, 0x01, 0xC9, 0x28, 0xFF,
+  0xE8, 0x28, 0xFF, 0x85, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x09, 0xA9,
+  0x20, 0xFF, 0xE9, 0x30, 0xFF, 0xA7, 0x38, 0xFF, 0x63, 0x40, 0xFF, 0x63, 0x69,
+  0xFF, 0x47, 0xB3, 0xFF, 0xA9, 0xEC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF,
+  0x03, 0xFD, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x03, 0xE2,
+  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x82, 0xE2,
+  0xFC, 0xFF, 0x83, 0xE3, 0xFC, 0xFF, 0x02, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF,
+  0xE4, 0xFC, 0xFF, 0x82, 0xE3, 0xFC, 0xFF, 0x08, 0xE2, 0xFC, 0xFF, 0x03, 0xFD,
+  0xFF, 0xE3, 0xF4, 0xFF, 0x27, 0xED, 0xFF, 0xEA, 0xE4, 0xFF, 0xC6, 0x92, 0xFF,
+  0xE2, 0x50, 0xFF, 0xA6, 0x38, 0xFF, 0x87, 0x30, 0xFF, 0x81, 0xC9, 0x28, 0xFF,
+  0x83, 0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x30, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x8D,
+  0xC8, 0x28, 0xFF, 0x01, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x82, 0xC9, 0x28,
+  0xFF, 0x01, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x14,
+  0x09, 0x29, 0xFF, 0xC8, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xA8,
+  0x30, 0xFF, 0xC9, 0x38, 0xFF, 0xA9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xE7, 0x28,
+  0xFF, 0x2E, 0x6B, 0x9E, 0x00, 0x00, 0x00, 0x39, 0xFF, 0x0A, 0x49, 0xE5, 0xF8,
+  0x04, 0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4,
+  0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x27, 0xF5, 0xFF, 0xB5, 0xF6, 0x2A, 0x8A, 0x00,
+  0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x0C, 0xAD, 0xED, 0xAE, 0x06, 0xF5, 0xFF,
   0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE3,
   0xFC, 0xFF, 0x28, 0xE5, 0xFF, 0x71, 0xEE, 0x5F, 0x00, 0x00, 0x00, 0xFB, 0xDE,
-  0x08, 0x28, 0x39, 0xE5, 0xC7, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x20, 0xFF, 0xE9, 0x20, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x88, 0x28, 0xFF, 0xE9, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x20, 0xFF, 0xCA, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xA7, 0x30, 0xFF, 0x84, 0x48, 0xFF, 0xC4, 0x81, 0xFF, 0x88,
-  0xE4, 0xFF, 0x07, 0xFD, 0xFF, 0xA4, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xFD,
-  0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE2,
-  0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x44, 0xFD,
-  0xFF, 0xC3, 0xEC, 0xFF, 0x28, 0xFD, 0xFF, 0x08, 0xCC, 0xFF, 0xA1, 0x50, 0xFF,
-  0xC5, 0x40, 0xFF, 0xC8, 0x30, 0xFF, 0xE9, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xE7,
-  0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x30,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0x48,
-  0x39, 0xE9, 0xBD, 0xD6, 0x0C, 0x00, 0x00, 0x00, 0x92, 0xFE, 0x4C, 0x07, 0xE5,
-  0xFF, 0xE4, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC3, 0xF4, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0x8E, 0xE5, 0xC1, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFE, 0x18, 0x6A, 0xF5, 0xFA,
-  0xE4, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xA1,
-  0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0x8C, 0xE5, 0xFF, 0xF7, 0xF6, 0x16, 0x00, 0x00,
-  0x00, 0xEE, 0x62, 0xAF, 0xC7, 0x28, 0xFF, 0xE8, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE9,
-  0x20, 0xFF, 0xE9, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x89, 0x30,
-  0xFF, 0xEA, 0x38, 0xFF, 0xA8, 0x20, 0xFF, 0x09, 0x29, 0xFF, 0xC9, 0x20, 0xFF,
-  0xE9, 0x30, 0xFF, 0xC6, 0x30, 0xFF, 0xC3, 0x40, 0xFF, 0xC7, 0x9A, 0xFF, 0xAA,
-  0xEC, 0xFF, 0xC5, 0xFC, 0xFF, 0xA2, 0xFC, 0xFF, 0x24, 0xFD, 0xFF, 0x03, 0xFD,
-  0xFF, 0xE3, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xC2, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE2, 0xFC, 0xFF, 0xE1, 0xFC, 0xFF, 0x23, 0xFD, 0xFF, 0xA2, 0xFC, 0xFF,
-  0xE7, 0xF4, 0xFF, 0x8B, 0xDC, 0xFF, 0xA5, 0x69, 0xFF, 0xC5, 0x30, 0xFF, 0xE8,
-  0x28, 0xFF, 0xA6, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0x0A, 0x39, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9,
-  0x30, 0xFF, 0xC7, 0x28, 0xFF, 0x6C, 0x52, 0xB8, 0x00, 0x00, 0x00, 0xD6, 0xFE,
-  0x0D, 0x8C, 0xE5, 0xF8, 0x26, 0xF5, 0xFF, 0xE3, 0xFC, 0xFF,
-  0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x4A,
-  0xED, 0xFE, 0x93, 0xFE, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x30, 0xFE, 0x5F, 0x08, 0xF5, 0xFF, 0xC4, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE6, 0xEC, 0xFF, 0x30, 0xF6,
-  0x81, 0x79, 0xFE, 0x05, 0x19, 0xCE, 0x2E, 0x08, 0x29, 0xF2, 0xC7, 0x28, 0xFF,
-  0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x20, 0xFF, 0xC8, 0x28,
-  0xFF, 0xA8, 0x28, 0xFF, 0xCA, 0x38, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
-  0x08, 0x29, 0xFF, 0xA7, 0x28, 0xFF, 0xC5, 0x30, 0xFF, 0xC1, 0x40, 0xFF, 0x46,
-  0x9B, 0xFF, 0xE8, 0xE4, 0xFF, 0x26, 0xF5, 0xFF, 0xE5, 0xF4, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x23, 0xF5, 0xFF, 0x03, 0xF5, 0xFF, 0x03, 0xF5,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
-  0x03, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xA2, 0xF4, 0xFF, 0xC3,
-  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC,
-  0xFF, 0xA3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x24, 0xFD, 0xFF,
-  0x04, 0xFD, 0xFF, 0xC4, 0xF4, 0xFF, 0x48, 0xF5, 0xFF, 0x89, 0xD4, 0xFF, 0x64,
-  0x59, 0xFF, 0xA5, 0x38, 0xFF, 0x28, 0x39, 0xFF, 0xE8, 0x28, 0xFF, 0x08, 0x31,
-  0xFF, 0xA8, 0x28, 0xFF, 0x88, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE7, 0x28,
-  0xEF, 0xD8, 0xCD, 0x34, 0x00, 0x00, 0x00, 0x31, 0xEE, 0x61, 0xE6, 0xE4, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4,
-  0xF4, 0xFF, 0x27, 0xED, 0xFF, 0x2F, 0xF6, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x18, 0xFF, 0x09, 0x6C, 0xF5, 0xE9, 0xE6, 0xF4, 0xFF, 0xE3,
-  0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x06, 0xFD,
-  0xFF, 0x29, 0xE5, 0xFF, 0x16, 0xFF, 0x11, 0x00, 0x00, 0x00, 0x90, 0x7B, 0x90,
-  0x08, 0x29, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x20,
-  0xFF, 0xC9, 0x28, 0xFF, 0xEA, 0x30, 0xFF, 0x89, 0x30, 0xFF, 0x89, 0x30, 0xFF,
-  0x2A, 0x31, 0xFF, 0xA7, 0x20, 0xFF, 0xE6, 0x38, 0xFF, 0xC1, 0x40, 0xFF, 0x25,
-  0xA3, 0xFF, 0xE7, 0xDC, 0xFF, 0x45, 0xF5, 0xFF, 0x03, 0xF5, 0xFF, 0xE4, 0xF4,
-  0xFF, 0x05, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
-  0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x03,
-  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x23, 0xF5,
-  0xFF, 0x23, 0xF5, 0xFF, 0x23, 0xF5, 0xFF, 0x23, 0xFD, 0xFF, 0x03, 0xFD, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xA2, 0xFC, 0xFF, 0x03,
-  0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xF4, 0xFF, 0x23, 0xFD, 0xFF, 0xE3,
-  0xF4, 0xFF, 0x27, 0xF5, 0xFF, 0x4B, 0xCC, 0xFF, 0x44, 0x59, 0xFF, 0xA5, 0x30,
-  0xFF, 0xE7, 0x30, 0xFF, 0xA7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x30, 0xFF,
-  0xA9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x30, 0xFD, 0x0F, 0x73, 0x9A, 0x00, 0x00, 0x00,
-  0xD6, 0xFE, 0x07, 0x49, 0xED, 0xF2, 0x05, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3,
-  0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xF4, 0xFF, 0x04, 0xF5, 0xFF, 0x6A, 0xED,
-  0xF4, 0x97, 0xEE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xEE, 0x4C, 0x09, 0xED, 0xFF, 0xE5,
-  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x05, 0xFD,
-  0xFF, 0xE7, 0xEC, 0xFF, 0xEF, 0xF5, 0x91, 0xFF, 0xFF, 0x02, 0x1A, 0xE6, 0x11,
-  0x89, 0x39, 0xE5, 0xC8, 0x20, 0xFF, 0xE9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xA8, 0x30,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xA9, 0x28, 0xFF,
-  0xCA, 0x30, 0xFF, 0xAA, 0x30, 0xFF, 0xA9, 0x28, 0xFF, 0xE7, 0x30, 0xFF, 0xC2,
-  0x40, 0xFF, 0xA4, 0x8A, 0xFF, 0x28, 0xED, 0xFF, 0x04, 0xF5, 0xFF, 0xE3, 0xF4,
-  0xFF, 0x23, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2,
-  0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4,
-  0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC,
-  0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x23, 0xFD, 0xFF,
-  0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x02,
-  0xF5, 0xFF, 0x22, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0xA3, 0xF4, 0xFF, 0x08, 0xFD,
-  0xFF, 0xC8, 0xC3, 0xFF, 0xC3, 0x48, 0xFF, 0xC6, 0x30, 0xFF, 0xE7, 0x30, 0xFF,
-  0x08, 0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x30, 0xEA,
-  0x1A, 0xCE, 0x1D, 0x00, 0x00, 0x00, 0x2F, 0xF6, 0x7B, 0x06, 0xED, 0xFF, 0xE5,
-  0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x03, 0xFD,
-  0xFF, 0x06, 0xED, 0xFF, 0x52, 0xEE, 0x59, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-  0xE5, 0xAC, 0xE6, 0xEC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD,
-  0xFF, 0xC2, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x0A, 0xE5, 0xFF, 0xB4, 0xFE, 0x31,
-  0x00, 0x00, 0x00, 0xF1, 0x8B, 0x93, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xA9, 0x30,
-  0xFF, 0xA9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE9, 0x28, 0xFF, 0x68, 0x20, 0xFF, 0xEA, 0x38, 0xFF, 0xA9, 0x30, 0xFF, 0x68,
-  0x28, 0xFF, 0xC5, 0x38, 0xFF, 0xA3, 0x69, 0xFF, 0xA8, 0xDC, 0xFF, 0xE4, 0xF4,
-  0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0x03, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xF5,
-  0xFF, 0x26, 0xF5, 0xFF, 0x07, 0xF5, 0xFF, 0x07, 0xF5, 0xFF, 0xE7, 0xF4, 0xFF,
-  0x08, 0xED, 0xFF, 0x09, 0xED, 0xFF, 0x09, 0xED, 0xFF, 0xE8, 0xEC, 0xFF, 0xE8,
-  0xEC, 0xFF, 0xE8, 0xF4, 0xFF, 0xC7, 0xF4, 0xFF, 0xC6, 0xFC, 0xFF, 0xC5, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xF4, 0xFF, 0x02, 0xF5, 0xFF,
-  0x23, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC4, 0xFC, 0xFF, 0x04,
-  0xFD, 0xFF, 0x42, 0xFD, 0xFF, 0xE0, 0xF4, 0xFF, 0xC2, 0xFC, 0xFF, 0x04, 0xFD,
-  0xFF, 0xA3, 0xFC, 0xFF, 0xC8, 0xF4, 0xFF, 0xE8, 0x92, 0xFF, 0xC4, 0x40, 0xFF,
-  0xC6, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0x09, 0x31, 0xFF,
-  0xA9, 0x28, 0xFF, 0xC9, 0x30, 0xFE, 0x71, 0x73, 0x9E, 0x00, 0x00, 0x00, 0x94,
-  0xFE, 0x23, 0x09, 0xE5, 0xFF, 0xE5, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE5, 0xEC, 0xFF, 0xCE, 0xED, 0xB6,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
-  0xFF, 0x0A, 0x6B, 0xE5, 0xF2, 0xE5, 0xF4, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD,
-  0xFF, 0x02, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF,
-  0x8E, 0xE5, 0xD8, 0xF7, 0xFE, 0x08, 0x1C, 0xE7, 0x09, 0xCA, 0x49, 0xDC, 0xA8,
-  0x20, 0xFF, 0xEA, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0x09, 0x31, 0xFF, 0x68, 0x20, 0xFF, 0xC9,
-  0x30, 0xFF, 0xC8, 0x38, 0xFF, 0xE4, 0x48, 0xFF, 0x08, 0xC4, 0xFF, 0x07, 0xF5,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x43, 0xFD,
-  0xFF, 0x24, 0xF5, 0xFF, 0x88, 0xD4, 0xFF, 0xE9, 0xBB, 0xFF,
-  0x65, 0x82, 0xFF, 0xE4, 0x69, 0xFF, 0x43, 0x51, 0xFF, 0xE2, 0x40, 0xFF, 0xC2,
-  0x38, 0xFF, 0xE2, 0x40, 0xFF, 0x44, 0x51, 0xFF, 0xA4, 0x61, 0xFF, 0x45, 0x82,
-  0xFF, 0x87, 0xBB, 0xFF, 0xA9, 0xE4, 0xFF, 0xE7, 0xF4, 0xFF, 0x04, 0xF5, 0xFF,
-  0x24, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC2,
-  0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE1, 0xF4, 0xFF, 0x42, 0xFD,
-  0xFF, 0xC4, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x06, 0xFD, 0xFF,
-  0x69, 0xD4, 0xFF, 0x01, 0x51, 0xFF, 0xC5, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xA7,
-  0x20, 0xFF, 0x29, 0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x8B,
-  0x39, 0xD8, 0x79, 0xCE, 0x05, 0x00, 0x00, 0x00, 0xCE, 0xED, 0xAB, 0xE6, 0xF4,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
-  0x05, 0xF5, 0xFF, 0x4A, 0xED, 0xF7, 0xD6, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFE, 0x4B, 0x27, 0xE5, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF,
-  0x07, 0xF5, 0xFF, 0x93, 0xFE, 0x3C, 0x00, 0x00, 0x00, 0xD8, 0xC5, 0x36, 0xE7,
-  0x28, 0xF3, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xA8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
-  0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0xA7, 0x8A,
-  0xFF, 0x09, 0xED, 0xFF, 0x05, 0xFD, 0xFF, 0xC4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0xC3, 0xFC, 0xFF, 0xA2, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2,
-  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC,
-  0xFF, 0xE5, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x25, 0xC4, 0xFF, 0x24, 0x7A, 0xFF,
-  0x81, 0x38, 0xFF, 0xC5, 0x38, 0xFF, 0xC6, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA7, 0x30, 0xFF, 0xC7, 0x38,
+  0x08, 0x28, 0x39, 0xE5, 0xC7, 0x30, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x83, 0xC9,
+  0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x8E, 0xC8, 0x28,
+  0xFF, 0x01, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x01,
+  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xE9, 0x20, 0xFF, 0x11, 0xE8, 0x28,
+  0xFF, 0xC7, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x88, 0x28, 0xFF, 0xE9, 0x28, 0xFF,
+  0xE8, 0x28, 0xFF, 0xC9, 0x20, 0xFF, 0xCA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA7,
+  0x30, 0xFF, 0x84, 0x48, 0xFF, 0xC4, 0x81, 0xFF, 0x88, 0xE4, 0xFF, 0x07, 0xFD,
+  0xFF, 0xA4, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x03, 0xFD, 0xFF,
+  0x81, 0xE2, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x00, 0x03, 0xFD, 0xFF, 0x82,
+  0xE3, 0xFC, 0xFF, 0x83, 0xC3, 0xFC, 0xFF, 0x82, 0xE3, 0xFC, 0xFF, 0x00, 0xE4,
+  0xFC, 0xFF, 0x82, 0xE3, 0xFC, 0xFF, 0x00, 0xC2, 0xFC, 0xFF, 0x83, 0xE2, 0xFC,
+  0xFF, 0x0E, 0x44, 0xFD, 0xFF, 0xC3, 0xEC, 0xFF, 0x28, 0xFD, 0xFF, 0x08, 0xCC,
+  0xFF, 0xA1, 0x50, 0xFF, 0xC5, 0x40, 0xFF, 0xC8, 0x30, 0xFF, 0xE9, 0x20, 0xFF,
+  0xE8, 0x28, 0xFF, 0xE7, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9,
+  0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0x8E, 0xC8, 0x28, 0xFF, 0x83,
+  0xC9, 0x28, 0xFF, 0x87, 0xC8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x0E, 0xC9,
+  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0x48, 0x39, 0xE9, 0xBD, 0xD6,
+  0x0C, 0x00, 0x00, 0x00, 0x92, 0xFE, 0x4C, 0x07, 0xE5, 0xFF, 0xE4, 0xF4, 0xFF,
+  0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC3, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE6,
+  0xF4, 0xFF, 0x8E, 0xE5, 0xC1, 0x8A, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x02, 0xB3, 0xFE, 0x18, 0x6A, 0xF5, 0xFA, 0xE4, 0xF4, 0xFF, 0x82, 0xE3, 0xFC,
+  0xFF, 0x08, 0xA1, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0x8C, 0xE5, 0xFF, 0xF7, 0xF6,
+  0x16, 0x00, 0x00, 0x00, 0xEE, 0x62, 0xAF, 0xC7, 0x28, 0xFF, 0xE8, 0x30, 0xFF,
+  0xC8, 0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x85, 0xC9, 0x28, 0xFF, 0x8E, 0xC8,
+  0x28, 0xFF, 0x05, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA8,
+  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xE9, 0x20, 0xFF, 0x10,
+  0xE8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x89, 0x30, 0xFF, 0xEA, 0x38, 0xFF, 0xA8,
+  0x20, 0xFF, 0x09, 0x29, 0xFF, 0xC9, 0x20, 0xFF, 0xE9, 0x30, 0xFF, 0xC6, 0x30,
+  0xFF, 0xC3, 0x40, 0xFF, 0xC7, 0x9A, 0xFF, 0xAA, 0xEC, 0xFF, 0xC5, 0xFC, 0xFF,
+  0xA2, 0xFC, 0xFF, 0x24, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x82,
+  0x03, 0xFD, 0xFF, 0x82, 0xE3, 0xFC, 0xFF, 0x00, 0x03, 0xFD, 0xFF, 0x87, 0xE3,
+  0xFC, 0xFF, 0x04, 0xC2, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xE3,
+  0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x83, 0xE3, 0xFC, 0xFF, 0x0F, 0xE2, 0xFC, 0xFF,
+  0xE1, 0xFC, 0xFF, 0x23, 0xFD, 0xFF, 0xA2, 0xFC, 0xFF, 0xE7, 0xF4, 0xFF, 0x8B,
+  0xDC, 0xFF, 0xA5, 0x69, 0xFF, 0xC5, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xA6, 0x20,
+  0xFF, 0x08, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x0A, 0x39, 0xFF,
+  0xA9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x9E, 0xC8, 0x28, 0xFF, 0x08, 0xE9, 0x30,
+  0xFF, 0xC7, 0x28, 0xFF, 0x6C, 0x52, 0xB8, 0x00, 0x00, 0x00, 0xD6, 0xFE, 0x0D,
+  0x8C, 0xE5, 0xF8, 0x26, 0xF5, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x81,
+  0xE3, 0xFC, 0xFF, 0x02, 0xE5, 0xFC, 0xFF, 0x4A, 0xED, 0xFE, 0x93, 0xFE, 0x1D,
+  0x89, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x03, 0x30, 0xFE, 0x5F, 0x08,
+  0xF5, 0xFF, 0xC4, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x07,
+  0x04, 0xFD, 0xFF, 0xE6, 0xEC, 0xFF, 0x30, 0xF6, 0x81, 0x79, 0xFE, 0x05, 0x19,
+  0xCE, 0x2E, 0x08, 0x29, 0xF2, 0xC7, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0x85, 0xC8,
+  0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x8E, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28,
+  0xFF, 0x03, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28,
+  0xFF, 0x81, 0xE8, 0x20, 0xFF, 0x0D, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xCA,
+  0x38, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0x08, 0x29, 0xFF, 0xA7, 0x28,
+  0xFF, 0xC5, 0x30, 0xFF, 0xC1, 0x40, 0xFF, 0x46, 0x9B, 0xFF, 0xE8, 0xE4, 0xFF,
+  0x26, 0xF5, 0xFF, 0xE5, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x81, 0xE2, 0xFC, 0xFF,
+  0x81, 0x03, 0xFD, 0xFF, 0x82, 0xE3, 0xFC, 0xFF, 0x03, 0xC3, 0xFC, 0xFF, 0xE3,
+  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x23, 0xF5, 0xFF, 0x81, 0x03, 0xF5, 0xFF, 0x82,
+  0xE3, 0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x05, 0x23, 0xFD, 0xFF, 0xE3, 0xFC,
+  0xFF, 0xA2, 0xF4, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF,
+  0x81, 0xC3, 0xFC, 0xFF, 0x10, 0xA3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC2, 0xFC,
+  0xFF, 0x24, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xC4, 0xF4, 0xFF, 0x48, 0xF5, 0xFF,
+  0x89, 0xD4, 0xFF, 0x64, 0x59, 0xFF, 0xA5, 0x38, 0xFF, 0x28, 0x39, 0xFF, 0xE8,
+  0x28, 0xFF, 0x08, 0x31, 0xFF, 0xA8, 0x28, 0xFF, 0x88, 0x28, 0xFF, 0xC9, 0x30,
+  0xFF, 0xC9, 0x28, 0xFF, 0x9E, 0xC8, 0x28, 0xFF, 0x06, 0xE8, 0x28, 0xFF, 0xC8,
+  0x28, 0xFF, 0xE7, 0x28, 0xEF, 0xD8, 0xCD, 0x34, 0x00, 0x00, 0x00, 0x31, 0xEE,
+  0x61, 0xE6, 0xE4, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x04, 0xC3, 0xFC, 0xFF, 0x04,
+  0xFD, 0xFF, 0xE4, 0xF4, 0xFF, 0x27, 0xED, 0xFF, 0x2F, 0xF6, 0x76, 0x89, 0x00,
+  0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x0D, 0x18, 0xFF, 0x09, 0x6C, 0xF5, 0xE9,
+  0xE6, 0xF4, 0xFF, 0xE3, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4,
+  0xFC, 0xFF, 0x06, 0xFD, 0xFF, 0x29, 0xE5, 0xFF, 0x16, 0xFF, 0x11, 0x00, 0x00,
+  0x00, 0x90, 0x7B, 0x90, 0x08, 0x29, 0xFF, 0xE9, 0x30, 0xFF, 0x86, 0xC8, 0x28,
+  0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x8F, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF,
+  0x07, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
+  0xE8, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0xEA, 0x30, 0xFF, 0x81,
+  0x89, 0x30, 0xFF, 0x0A, 0x2A, 0x31, 0xFF, 0xA7, 0x20, 0xFF, 0xE6, 0x38, 0xFF,
+  0xC1, 0x40, 0xFF, 0x25, 0xA3, 0xFF, 0xE7, 0xDC, 0xFF, 0x45, 0xF5, 0xFF, 0x03,
+  0xF5, 0xFF, 0xE4, 0xF4, 0xFF, 0x05, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0x81, 0x03,
+  0xFD, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x00, 0xE4, 0xFC, 0xFF, 0x81, 0x03, 0xFD,
+  0xFF, 0x01, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x82, 0x23, 0xF5, 0xFF, 0x02,
+  0x23, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x81, 0xC2, 0xFC, 0xFF,
+  0x01, 0xA2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0x04, 0xFD, 0xFF, 0x81, 0xE4,
+  0xFC, 0xFF, 0x12, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3,
+  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xF4, 0xFF, 0x23, 0xFD,
+  0xFF, 0xE3, 0xF4, 0xFF, 0x27, 0xF5, 0xFF, 0x4B, 0xCC, 0xFF, 0x44, 0x59, 0xFF,
+  0xA5, 0x30, 0xFF, 0xE7, 0x30, 0xFF, 0xA7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xE9,
+  0x30, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA0, 0xC8, 0x28, 0xFF, 0x0C,
+  0xE9, 0x30, 0xFD, 0x0F, 0x73, 0x9A, 0x00, 0x00, 0x00, 0xD6, 0xFE, 0x07, 0x49,
+  0xED, 0xF2, 0x05, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x04, 0xFD,
+  0xFF, 0xE4, 0xF4, 0xFF, 0x04, 0xF5, 0xFF, 0x6A, 0xED, 0xF4, 0x97, 0xEE, 0x0B,
+  0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x02, 0x74, 0xEE, 0x4C, 0x09,
+  0xED, 0xFF, 0xE5, 0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x0B, 0xC2, 0xFC, 0xFF,
+  0x05, 0xFD, 0xFF, 0xE7, 0xEC, 0xFF, 0xEF, 0xF5, 0x91, 0xFF, 0xFF, 0x02, 0x1A,
+  0xE6, 0x11, 0x89, 0x39, 0xE5, 0xC8, 0x20, 0xFF, 0xE9, 0x30, 0xFF, 0xA8, 0x28,
+  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x81, 0xC8,
+  0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x90, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28,
+  0xFF, 0x02, 0xC8, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0x81, 0xE8,
+  0x28, 0xFF, 0x0B, 0xE9, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xAA,
+  0x30, 0xFF, 0xA9, 0x28, 0xFF, 0xE7, 0x30, 0xFF, 0xC2, 0x40, 0xFF, 0xA4, 0x8A,
+  0xFF, 0x28, 0xED, 0xFF, 0x04, 0xF5, 0xFF, 0xE3, 0xF4, 0xFF, 0x23, 0xFD, 0xFF,
+  0x81, 0x03, 0xFD, 0xFF, 0x03, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC,
+  0xFF, 0xC3, 0xFC, 0xFF, 0x83, 0xE2, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x00,
+  0x03, 0xFD, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x01, 0xE3, 0xFC, 0xFF, 0x03, 0xFD,
+  0xFF, 0x82, 0xE3, 0xFC, 0xFF, 0x00, 0xE4, 0xFC, 0xFF, 0x81, 0xC3, 0xFC, 0xFF,
+  0x00, 0xE3, 0xFC, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x0F, 0x02, 0xFD, 0xFF, 0x23,
+  0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC,
+  0xFF, 0x02, 0xF5, 0xFF, 0x22, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0xA3, 0xF4, 0xFF,
+  0x08, 0xFD, 0xFF, 0xC8, 0xC3, 0xFF, 0xC3, 0x48, 0xFF, 0xC6, 0x30, 0xFF, 0xE7,
+  0x30, 0xFF, 0x08, 0x31, 0xFF, 0xA2, 0xC8, 0x28, 0xFF, 0x0D, 0xE9, 0x28, 0xFF,
+  0xA8, 0x28, 0xFF, 0xE8, 0x30, 0xEA, 0x1A, 0xCE, 0x1D, 0x00, 0x00, 0x00, 0x2F,
+  0xF6, 0x7B, 0x06, 0xED, 0xFF, 0xE5, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC,
+  0xFF, 0x04, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x06, 0xED, 0xFF, 0x52, 0xEE, 0x59,
+  0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xE5, 0xAC, 0xE6,
+  0xEC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xC2, 0xFC,
+  0xFF, 0xE5, 0xFC, 0xFF, 0x0A, 0xE5, 0xFF, 0xB4, 0xFE, 0x31, 0x00, 0x00, 0x00,
+  0xF1, 0x8B, 0x93, 0xE8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x02, 0xA8, 0x28,
+  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x02, 0xC8,
+  0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0x91, 0xC8, 0x28, 0xFF, 0x81,
+  0xE8, 0x28, 0xFF, 0x81, 0xA9, 0x30, 0xFF, 0x0F, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
+  0xFF, 0xE9, 0x28, 0xFF, 0x68, 0x20, 0xFF, 0xEA, 0x38, 0xFF, 0xA9, 0x30, 0xFF,
+  0x68, 0x28, 0xFF, 0xC5, 0x38, 0xFF, 0xA3, 0x69, 0xFF, 0xA8, 0xDC, 0xFF, 0xE4,
+  0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE2, 0xFC,
+  0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xC3, 0xFC, 0xFF, 0x01, 0xC4, 0xFC, 0xFF, 0xE3,
+  0xFC, 0xFF, 0x82, 0xE2, 0xFC, 0xFF, 0x01, 0x03, 0xF5, 0xFF, 0x26, 0xF5, 0xFF,
+  0x81, 0x07, 0xF5, 0xFF, 0x01, 0xE7, 0xF4, 0xFF, 0x08, 0xED, 0xFF, 0x81, 0x09,
+  0xED, 0xFF, 0x81, 0xE8, 0xEC, 0xFF, 0x17, 0xE8, 0xF4, 0xFF, 0xC7, 0xF4, 0xFF,
+  0xC6, 0xFC, 0xFF, 0xC5, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2,
+  0xF4, 0xFF, 0x02, 0xF5, 0xFF, 0x23, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x04, 0xFD,
+  0xFF, 0xC4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x42, 0xFD, 0xFF, 0xE0, 0xF4, 0xFF,
+  0xC2, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xA3, 0xFC, 0xFF, 0xC8, 0xF4, 0xFF, 0xE8,
+  0x92, 0xFF, 0xC4, 0x40, 0xFF, 0xC6, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xE8, 0x28,
+  0xFF, 0xA0, 0xC8, 0x28, 0xFF, 0x0E, 0xC8, 0x20, 0xFF, 0x09, 0x31, 0xFF, 0xA9,
+  0x28, 0xFF, 0xC9, 0x30, 0xFE, 0x71, 0x73, 0x9E, 0x00, 0x00, 0x00, 0x94, 0xFE,
+  0x23, 0x09, 0xE5, 0xFF, 0xE5, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
+  0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE5, 0xEC, 0xFF, 0xCE, 0xED, 0xB6, 0x88,
+  0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x11, 0x36, 0xFF, 0x0A, 0x6B, 0xE5,
+  0xF2, 0xE5, 0xF4, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF,
+  0xC3, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0x8E, 0xE5, 0xD8, 0xF7, 0xFE, 0x08, 0x1C,
+  0xE7, 0x09, 0xCA, 0x49, 0xDC, 0xA8, 0x20, 0xFF, 0xEA, 0x28, 0xFF, 0xA9, 0x28,
+  0xFF, 0xE9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x82, 0xE8, 0x28,
+  0xFF, 0x02, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0x8E, 0xC8,
+  0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28,
+  0xFF, 0x81, 0xA9, 0x30, 0xFF, 0x0F, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
+  0x20, 0xFF, 0x09, 0x31, 0xFF, 0x68, 0x20, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x38,
+  0xFF, 0xE4, 0x48, 0xFF, 0x08, 0xC4, 0xFF, 0x07, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF,
+  0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3,
+  0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x27, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF,
+  0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x43, 0xFD, 0xFF, 0x24, 0xF5, 0xFF, 0x88,
+  0xD4, 0xFF, 0xE9, 0xBB, 0xFF, 0x65, 0x82, 0xFF, 0xE4, 0x69, 0xFF, 0x43, 0x51,
+  0xFF, 0xE2, 0x40, 0xFF, 0xC2, 0x38, 0xFF, 0xE2, 0x40, 0xFF, 0x44, 0x51, 0xFF,
+  0xA4, 0x61, 0xFF, 0x45, 0x82, 0xFF, 0x87, 0xBB, 0xFF, 0xA9, 0xE4, 0xFF, 0xE7,
+  0xF4, 0xFF, 0x04, 0xF5, 0xFF, 0x24, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xC2, 0xFC,
+  0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
+  0xE1, 0xF4, 0xFF, 0x42, 0xFD, 0xFF, 0xC4, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0xC3,
+  0xFC, 0xFF, 0x06, 0xFD, 0xFF, 0x69, 0xD4, 0xFF, 0x01, 0x51, 0xFF, 0xC5, 0x30,
+  0xFF, 0xE8, 0x30, 0xFF, 0xA7, 0x20, 0xFF, 0x29, 0x31, 0xFF, 0xA0, 0xC8, 0x28,
+  0xFF, 0x07, 0xC9, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x8B, 0x39,
+  0xD8, 0x79, 0xCE, 0x05, 0x00, 0x00, 0x00, 0xCE, 0xED, 0xAB, 0xE6, 0xF4, 0xFF,
+  0x82, 0xE3, 0xFC, 0xFF, 0x03, 0x03, 0xFD, 0xFF, 0x05, 0xF5, 0xFF, 0x4A, 0xED,
+  0xF7, 0xD6, 0xFE, 0x07, 0x87, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x03,
+  0x92, 0xFE, 0x4B, 0x27, 0xE5, 0xFF, 0xE4, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x81,
+  0x03, 0xFD, 0xFF, 0x05, 0xE4, 0xFC, 0xFF, 0x07, 0xF5, 0xFF, 0x93, 0xFE, 0x3C,
+  0x00, 0x00, 0x00, 0xD8, 0xC5, 0x36, 0xE7, 0x28, 0xF3, 0x81, 0xC9, 0x28, 0xFF,
+  0x01, 0xE9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x82, 0xE8,
+  0x28, 0xFF, 0x02, 0xC8, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0x8E,
+  0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x03, 0xC9,
+  0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xE8,
+  0x28, 0xFF, 0x18, 0xA9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0xA7,
+  0x8A, 0xFF, 0x09, 0xED, 0xFF, 0x05, 0xFD, 0xFF, 0xC4, 0xFC, 0xFF, 0xE4, 0xFC,
+  0xFF, 0xC3, 0xFC, 0xFF, 0xA2, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
+  0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4,
+  0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x25, 0xC4, 0xFF, 0x24, 0x7A,
+  0xFF, 0x81, 0x38, 0xFF, 0xC5, 0x38, 0xFF, 0xC6, 0x30, 0xFF, 0xC7, 0x28, 0xFF,
+  0x81, 0xE8, 0x28, 0xFF, 0x0A, 0xC8, 0x28, 0xFF, 0xA7, 0x30, 0xFF, 0xC7, 0x38,
   0xFF, 0xA4, 0x38, 0xFF, 0xA2, 0x40, 0xFF, 0xE3, 0x71, 0xFF, 0x08, 0xBC, 0xFF,
-  0x28, 0xED, 0xFF, 0xE6, 0xF4, 0xFF, 0xA4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x02,
-  0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x22, 0xFD,
-  0xFF, 0x02, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF,
-  0xC2, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x07, 0xF5, 0xFF, 0x66, 0xA3, 0xFF, 0xC4,
-  0x38, 0xFF, 0xE8, 0x30, 0xFF, 0xA7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xE8, 0x28, 0xF3, 0x16, 0xAD, 0x48, 0x00, 0x00, 0x00, 0xD4, 0xFE,
-  0x28, 0xE7, 0xEC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0xE6, 0xE4, 0xFF, 0x70, 0xFE, 0x63, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xE5,
-  0xD4, 0x05, 0xED, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0x04, 0xFD, 0xFF, 0xE5, 0xFC, 0xFF, 0x4A, 0xED, 0xFF, 0xD6, 0xFE, 0x0D, 0x00,
-  0x00, 0x00, 0x8C, 0x5A, 0xBB, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA9,
-  0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xE7,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE7, 0x38, 0xFF, 0xA1, 0x48,
-  0xFF, 0x8A, 0xD4, 0xFF, 0xE6, 0xF4, 0xFF, 0x03, 0xFD, 0xFF,
-  0xC4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2,
-  0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xF4, 0xFF, 0x07, 0xF5, 0xFF, 0xE8, 0xC3, 0xFF,
-  0x01, 0x59, 0xFF, 0xA3, 0x40, 0xFF, 0xC6, 0x38, 0xFF, 0xA8, 0x30, 0xFF, 0xA9,
-  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC7, 0x30, 0xFF,
-  0xE5, 0x38, 0xFF, 0x23, 0x49, 0xFF, 0x47, 0xA3, 0xFF, 0xEA, 0xEC, 0xFF, 0xE6,
-  0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xC4, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xF4, 0xFF, 0x08,
-  0xE5, 0xFF, 0x85, 0x59, 0xFF, 0xA7, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xCA, 0x49,
-  0xCE, 0x00, 0x00, 0x00, 0x15, 0xFF, 0x09, 0x8B, 0xF5, 0xEE, 0xC4, 0xF4, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0x26,
-  0xFD, 0xFF, 0x4A, 0xE5, 0xE9, 0xF5, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xF6,
-  0x18, 0x49, 0xED, 0xFF, 0xE3, 0xF4, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x06, 0xF5, 0xFF, 0xAD, 0xF5, 0xB9, 0xF7,
-  0xFF, 0x04, 0x39, 0xCE, 0x23, 0x27, 0x29, 0xF0, 0xE8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xE7, 0x30, 0xFF, 0xC8, 0x28,
-  0xFF, 0xA4, 0x30, 0xFF, 0xE6, 0x92, 0xFF, 0xC8, 0xE4, 0xFF, 0xE4, 0xF4, 0xFF,
-  0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2,
-  0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0x06, 0xED, 0xFF, 0x27, 0xCC, 0xFF,
-  0x02, 0x59, 0xFF, 0xA5, 0x40, 0xFF, 0xE8, 0x38, 0xFF, 0xA8, 0x28, 0xFF, 0xA9,
-  0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xAA, 0x28, 0xFF, 0xCA, 0x28, 0xFF,
+  0x28, 0xED, 0xFF, 0xE6, 0xF4, 0xFF, 0xA4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x81,
+  0x02, 0xFD, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x0B, 0x22, 0xFD, 0xFF, 0x02, 0xFD,
+  0xFF, 0xC3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF,
+  0x07, 0xF5, 0xFF, 0x66, 0xA3, 0xFF, 0xC4, 0x38, 0xFF, 0xE8, 0x30, 0xFF, 0xA7,
+  0x20, 0xFF, 0xE8, 0x28, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF,
+  0x81, 0xC9, 0x28, 0xFF, 0x0B, 0xE8, 0x28, 0xF3, 0x16, 0xAD, 0x48, 0x00, 0x00,
+  0x00, 0xD4, 0xFE, 0x28, 0xE7, 0xEC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
+  0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0xE6, 0xE4, 0xFF, 0x70,
+  0xFE, 0x63, 0x87, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x02, 0x8B, 0xE5,
+  0xD4, 0x05, 0xED, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x07, 0x04,
+  0xFD, 0xFF, 0xE5, 0xFC, 0xFF, 0x4A, 0xED, 0xFF, 0xD6, 0xFE, 0x0D, 0x00, 0x00,
+  0x00, 0x8C, 0x5A, 0xBB, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x00, 0xA8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF,
+  0x00, 0xC8, 0x28, 0xFF, 0x81, 0xA9, 0x30, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x8D,
+  0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC9,
+  0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x07, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
+  0xA8, 0x28, 0xFF, 0xE7, 0x38, 0xFF, 0xA1, 0x48, 0xFF, 0x8A, 0xD4, 0xFF, 0xE6,
+  0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xC4, 0xFC, 0xFF, 0x00, 0xC3, 0xFC, 0xFF,
+  0x83, 0xE2, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x09, 0xE4, 0xFC, 0xFF, 0xE4,
+  0xF4, 0xFF, 0x07, 0xF5, 0xFF, 0xE8, 0xC3, 0xFF, 0x01, 0x59, 0xFF, 0xA3, 0x40,
+  0xFF, 0xC6, 0x38, 0xFF, 0xA8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x07,
+  0xC8, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xE5, 0x38, 0xFF, 0x23, 0x49, 0xFF, 0x47,
+  0xA3, 0xFF, 0xEA, 0xEC, 0xFF, 0xE6, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x81, 0xE2,
+  0xFC, 0xFF, 0x0C, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03,
+  0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0xE4, 0xFC,
+  0xFF, 0xE3, 0xF4, 0xFF, 0x08, 0xE5, 0xFF, 0x85, 0x59, 0xFF, 0xA7, 0x30, 0xFF,
+  0xE8, 0x28, 0xFF, 0xA1, 0xC8, 0x28, 0xFF, 0x08, 0xE9, 0x28, 0xFF, 0xC9, 0x28,
+  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xCA, 0x49, 0xCE, 0x00, 0x00, 0x00,
+  0x15, 0xFF, 0x09, 0x8B, 0xF5, 0xEE, 0xC4, 0xF4, 0xFF, 0x82, 0xE3, 0xFC, 0xFF,
+  0x03, 0xC4, 0xFC, 0xFF, 0x26, 0xFD, 0xFF, 0x4A, 0xE5, 0xE9, 0xF5, 0xFF, 0x03,
+  0x86, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x02, 0xB7, 0xF6, 0x18, 0x49,
+  0xED, 0xFF, 0xE3, 0xF4, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x07, 0xE3, 0xFC, 0xFF,
+  0x04, 0xFD, 0xFF, 0x06, 0xF5, 0xFF, 0xAD, 0xF5, 0xB9, 0xF7, 0xFF, 0x04, 0x39,
+  0xCE, 0x23, 0x27, 0x29, 0xF0, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x01,
+  0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28,
+  0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xA9, 0x30, 0xFF, 0x00, 0xC9, 0x28, 0xFF,
+  0x8D, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x01, 0xC8, 0x30, 0xFF, 0xC8,
+  0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x0D, 0xC8, 0x30, 0xFF, 0xC7, 0x30, 0xFF,
+  0xC7, 0x28, 0xFF, 0xE7, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xA4, 0x30, 0xFF, 0xE6,
+  0x92, 0xFF, 0xC8, 0xE4, 0xFF, 0xE4, 0xF4, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC,
+  0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x81, 0x02, 0xFD,
+  0xFF, 0x00, 0xE2, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x08, 0x05, 0xFD, 0xFF,
+  0x06, 0xED, 0xFF, 0x27, 0xCC, 0xFF, 0x02, 0x59, 0xFF, 0xA5, 0x40, 0xFF, 0xE8,
+  0x38, 0xFF, 0xA8, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0x81, 0xC8,
+  0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x09, 0xAA, 0x28, 0xFF, 0xCA, 0x28, 0xFF,
   0xA8, 0x20, 0xFF, 0x09, 0x29, 0xFF, 0xA7, 0x20, 0xFF, 0xE6, 0x30, 0xFF, 0xC2,
-  0x40, 0xFF, 0x68, 0xB3, 0xFF, 0xE8, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0xE2, 0xFC,
-  0xFF, 0xE2, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x07, 0xED, 0xFF, 0x66, 0x82, 0xFF, 0xA5, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC7, 0x28,
-  0xFF, 0x27, 0x31, 0xF3, 0xB8, 0xBD, 0x31, 0x00, 0x00, 0x00,
-  0xEE, 0xF5, 0x96, 0xE6, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4,
-  0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x27, 0xED, 0xFF, 0xF5, 0xFE,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x74, 0xF6, 0x4B, 0x07, 0xED, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x08,
-  0xED, 0xFF, 0x72, 0xFE, 0x47, 0x00, 0x00, 0x00, 0x94, 0x94, 0x71, 0xC6, 0x20,
-  0xF9, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x28,
-  0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0x04, 0x41, 0xFF, 0xCA, 0xDC, 0xFF,
-  0x05, 0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x02, 0xFD,
-  0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x06, 0xF5, 0xFF,
-  0x09, 0xE5, 0xFF, 0xC2, 0x69, 0xFF, 0xA5, 0x40, 0xFF, 0xA8, 0x30, 0xFF, 0xA8,
-  0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE7, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xAA, 0x28, 0xFF, 0xAA, 0x30, 0xFF,
-  0xC9, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0x47, 0x29, 0xFF, 0xE7, 0x20, 0xFF, 0xE7,
-  0x28, 0xFF, 0xA5, 0x38, 0xFF, 0xE1, 0x50, 0xFF, 0xA9, 0xDC, 0xFF, 0xE5, 0xF4,
-  0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC5, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03,
-  0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE7, 0xF4, 0xFF, 0xA9, 0xAB,
-  0xFF, 0xA3, 0x38, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x07, 0x29, 0xF9, 0xF1, 0x83, 0x7C,
-  0x00, 0x00, 0x00, 0x92, 0xFE, 0x31, 0x29, 0xED, 0xFF, 0xE5, 0xFC, 0xFF, 0xE4,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x06, 0xED,
-  0xFF, 0x51, 0xF6, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xED, 0x94,
-  0xE5, 0xF4, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC3,
-  0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0x4B, 0xE5, 0xFF, 0xF6, 0xFE, 0x1E, 0x00, 0x00,
-  0x00, 0xAD, 0x5A, 0xB6, 0x28, 0x31, 0xFF, 0xA7, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC7, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xC6, 0x30, 0xFF, 0xE5, 0x69, 0xFF,
-  0x09, 0xED, 0xFF, 0x03, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD,
-  0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xE7, 0xE4, 0xFF, 0x25, 0x9B, 0xFF, 0xE2, 0x40, 0xFF, 0xA7,
-  0x30, 0xFF, 0xEA, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xCA, 0x28, 0xFF,
-  0xCA, 0x28, 0xFF, 0xAA, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0x06, 0x29, 0xFF, 0xC5,
-  0x20, 0xFF, 0x08, 0x29, 0xFF, 0x08, 0x29, 0xFF, 0xE7, 0x30, 0xFF, 0xA3, 0x38,
-  0xFF, 0x21, 0x7A, 0xFF, 0x07, 0xED, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03,
-  0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC,
+  0x40, 0xFF, 0x68, 0xB3, 0xFF, 0xE8, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x81, 0xE2,
+  0xFC, 0xFF, 0x82, 0xE4, 0xFC, 0xFF, 0x09, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
+  0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x07,
+  0xED, 0xFF, 0x66, 0x82, 0xFF, 0xA5, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0x81, 0xC9,
+  0x28, 0xFF, 0x9E, 0xC8, 0x28, 0xFF, 0x10, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
+  0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x27, 0x31, 0xF3, 0xB8,
+  0xBD, 0x31, 0x00, 0x00, 0x00, 0xEE, 0xF5, 0x96, 0xE6, 0xF4, 0xFF, 0xE4, 0xFC,
+  0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF,
+  0x27, 0xED, 0xFF, 0xF5, 0xFE, 0x24, 0x86, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00,
+  0x00, 0x01, 0x74, 0xF6, 0x4B, 0x07, 0xED, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x07,
+  0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x08, 0xED, 0xFF, 0x72,
+  0xFE, 0x47, 0x00, 0x00, 0x00, 0x94, 0x94, 0x71, 0xC6, 0x20, 0xF9, 0x81, 0xE8,
+  0x28, 0xFF, 0x02, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x82,
+  0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xA9,
+  0x30, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x8E, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x01, 0xC8, 0x30, 0xFF,
+  0xC7, 0x30, 0xFF, 0x81, 0xC7, 0x28, 0xFF, 0x05, 0xC7, 0x30, 0xFF, 0x04, 0x41,
+  0xFF, 0xCA, 0xDC, 0xFF, 0x05, 0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF,
+  0x81, 0xE3, 0xFC, 0xFF, 0x83, 0x02, 0xFD, 0xFF, 0x09, 0xE2, 0xFC, 0xFF, 0xE3,
+  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0x09, 0xE5, 0xFF, 0xC2, 0x69,
+  0xFF, 0xA5, 0x40, 0xFF, 0xA8, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xE9, 0x30, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x13, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28,
+  0xFF, 0xAA, 0x28, 0xFF, 0xAA, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE7, 0x28, 0xFF,
+  0x47, 0x29, 0xFF, 0xE7, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0xA5, 0x38, 0xFF, 0xE1,
+  0x50, 0xFF, 0xA9, 0xDC, 0xFF, 0xE5, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC,
+  0xFF, 0xE4, 0xFC, 0xFF, 0xC5, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
+  0x82, 0x03, 0xFD, 0xFF, 0x05, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE7, 0xF4,
+  0xFF, 0xA9, 0xAB, 0xFF, 0xA3, 0x38, 0xFF, 0xC8, 0x30, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x00, 0xE9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF,
+  0x07, 0xC7, 0x28, 0xFF, 0x07, 0x29, 0xF9, 0xF1, 0x83, 0x7C, 0x00, 0x00, 0x00,
+  0x92, 0xFE, 0x31, 0x29, 0xED, 0xFF, 0xE5, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x82,
+  0xE3, 0xFC, 0xFF, 0x01, 0x06, 0xED, 0xFF, 0x51, 0xF6, 0x54, 0x86, 0x00, 0x00,
+  0x00, 0x86, 0x00, 0x00, 0x00, 0x01, 0xF0, 0xED, 0x94, 0xE5, 0xF4, 0xFF, 0x81,
+  0xE2, 0xFC, 0xFF, 0x08, 0x03, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0x06, 0xF5, 0xFF,
+  0x4B, 0xE5, 0xFF, 0xF6, 0xFE, 0x1E, 0x00, 0x00, 0x00, 0xAD, 0x5A, 0xB6, 0x28,
+  0x31, 0xFF, 0xA7, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x04, 0xC7, 0x28, 0xFF,
+  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0x81,
+  0xE8, 0x28, 0xFF, 0x03, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF,
+  0xC9, 0x28, 0xFF, 0x8E, 0xC8, 0x28, 0xFF, 0x02, 0xE8, 0x28, 0xFF, 0xC8, 0x28,
+  0xFF, 0xC9, 0x30, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x08, 0xC8, 0x30, 0xFF, 0xC7,
+  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xC6, 0x30, 0xFF, 0xE5, 0x69,
+  0xFF, 0x09, 0xED, 0xFF, 0x03, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0x81, 0xE2, 0xFC,
+  0xFF, 0x00, 0xE3, 0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x81, 0x02, 0xFD, 0xFF,
+  0x08, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE7, 0xE4, 0xFF,
+  0x25, 0x9B, 0xFF, 0xE2, 0x40, 0xFF, 0xA7, 0x30, 0xFF, 0xEA, 0x30, 0xFF, 0xC9,
+  0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x02, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF,
+  0xE8, 0x28, 0xFF, 0x81, 0xCA, 0x28, 0xFF, 0x03, 0xAA, 0x30, 0xFF, 0xC8, 0x30,
+  0xFF, 0x06, 0x29, 0xFF, 0xC5, 0x20, 0xFF, 0x81, 0x08, 0x29, 0xFF, 0x05, 0xE7,
+  0x30, 0xFF, 0xA3, 0x38, 0xFF, 0x21, 0x7A, 0xFF, 0x07, 0xED, 0xFF, 0x04, 0xFD,
+  0xFF, 0xE3, 0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x00,
+  0x03, 0xFD, 0xFF, 0x81, 0x02, 0xFD, 0xFF, 0x05, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC,
   0xFF, 0xC6, 0xF4, 0xFF, 0x8B, 0xD4, 0xFF, 0xE2, 0x48, 0xFF, 0xA6, 0x30, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x20,
-  0xFF, 0x08, 0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0x08, 0x29, 0xFF, 0x8C, 0x52, 0xBD, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x03, 0x6D,
-  0xED, 0xED, 0xE6, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD,
-  0xFF, 0xE2, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0xCE, 0xED, 0xA7, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x04,
-  0x8C, 0xE5, 0xE7, 0xE5, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x07, 0xF5, 0xFF, 0xAE, 0xED, 0xA0, 0x18, 0xFF,
-  0x09, 0x7F, 0xFE, 0x05, 0x28, 0x29, 0xE7, 0xE8, 0x30, 0xFF, 0xA7, 0x28, 0xFF,
-  0xE8, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC9,
-  0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x30, 0xFF,
-  0xC4, 0x38, 0xFF, 0xE7, 0x8A, 0xFF, 0xE7, 0xEC, 0xFF, 0xC2, 0xFC, 0xFF, 0x03,
-  0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD,
-  0xFF, 0x04, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xE6, 0xEC, 0xFF, 0x0A, 0xE5, 0xFF, 0x42, 0x51, 0xFF, 0xE5,
-  0x38, 0xFF, 0xA7, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x20, 0xFF,
-  0xCA, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC6,
-  0x28, 0xFF, 0xE6, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0xC9, 0x20, 0xFF, 0xA8, 0x28,
-  0xFF, 0x06, 0x41, 0xFF, 0x80, 0x38, 0xFF, 0x88, 0xCC, 0xFF,
-  0xE6, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x02, 0xFD,
-  0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC6, 0xF4, 0xFF, 0xEB, 0xE4, 0xFF,
-  0x43, 0x59, 0xFF, 0xA6, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
-  0xC8, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0x48, 0x31, 0xEB, 0x7C, 0xE6, 0x0A, 0x00,
-  0x00, 0x00, 0xF0, 0xED, 0x82, 0xE7, 0xEC, 0xFF, 0xE3, 0xFC, 0xFF, 0x02, 0xFD,
-  0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE6, 0xFC, 0xFF,
-  0x4B, 0xED, 0xF4, 0xF5, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xB2, 0xFE, 0x24, 0x28, 0xE5, 0xFF, 0xE5, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x27, 0xED,
-  0xFF, 0x52, 0xF6, 0x4E, 0x00, 0x00, 0x00, 0xF6, 0xAC, 0x5E, 0xC8, 0x28, 0xFE,
-  0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x08,
-  0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0x07, 0x39, 0xFF, 0xC3, 0x38, 0xFF, 0x88, 0xA3, 0xFF, 0x07,
-  0xF5, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC,
-  0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x08, 0xED, 0xFF, 0x66,
-  0xA3, 0xFF, 0xC3, 0x40, 0xFF, 0x86, 0x28, 0xFF, 0x4A, 0x31, 0xFF, 0xC8, 0x20,
-  0xFF, 0xA8, 0x20, 0xFF, 0x09, 0x31, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE9, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xC8, 0x20,
-  0xFF, 0xC9, 0x20, 0xFF, 0x0A, 0x31, 0xFF, 0xA6, 0x30, 0xFF, 0xC2, 0x40, 0xFF,
-  0xC8, 0xAB, 0xFF, 0xE7, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE2, 0xFC, 0xFF, 0x23, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF,
-  0xEA, 0xEC, 0xFF, 0xE3, 0x71, 0xFF, 0xC5, 0x38, 0xFF, 0xE9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xA9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC7,
-  0x20, 0xF8, 0x53, 0x94, 0x75, 0x00, 0x00, 0x00, 0x74, 0xF6, 0x3F, 0x28, 0xED,
-  0xFF, 0xE3, 0xF4, 0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE5, 0xFC, 0xFF, 0x08, 0xED, 0xFF, 0x92, 0xFE, 0x3D, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF6, 0x6F, 0x06, 0xE5, 0xFF, 0xC5,
-  0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x04, 0xFD,
-  0xFF, 0x28, 0xED, 0xFF, 0xB5, 0xFE, 0x25, 0x00, 0x00, 0x00,
-  0x4D, 0x5A, 0xC5, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xA8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xA8, 0x20, 0xFF, 0xA9, 0x30,
-  0xFF, 0xAA, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE7, 0x28,
-  0xFF, 0xE7, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE7, 0x30, 0xFF, 0xC1, 0x40, 0xFF, 0x29,
-  0xC4, 0xFF, 0x08, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xA2, 0xFC, 0xFF, 0x03, 0xFD,
-  0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF,
-  0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0xA9,
-  0xDC, 0xFF, 0xE0, 0x50, 0xFF, 0xA4, 0x30, 0xFF, 0x09, 0x31, 0xFF, 0xA9, 0x20,
-  0xFF, 0xE9, 0x28, 0xFF, 0x88, 0x20, 0xFF, 0xA8, 0x28, 0xFF,
-  0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC9, 0x30,
-  0xFF, 0x88, 0x20, 0xFF, 0xEA, 0x28, 0xFF, 0xEA, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC7, 0x38, 0xFF, 0x83, 0x38, 0xFF, 0x28, 0xA3, 0xFF, 0xE7, 0xEC, 0xFF, 0x03,
-  0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xC4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
-  0x02, 0xFD, 0xFF, 0x05, 0xF5, 0xFF, 0xE8, 0xEC, 0xFF, 0x43, 0x82, 0xFF, 0xC4,
-  0x38, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xA9,
-  0x30, 0xFF, 0x0A, 0x39, 0xFF, 0xC8, 0x28, 0xFF, 0xEB, 0x49, 0xD1, 0x00, 0x00,
-  0x00, 0xB7, 0xFE, 0x19, 0x28, 0xED, 0xFF, 0x03, 0xF5, 0xFF, 0x23, 0xFD, 0xFF,
-  0xE2, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xC5, 0xFC, 0xFF, 0xE7, 0xEC, 0xFF, 0x0F,
-  0xFE, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xEC,
-  0xED, 0xBD, 0xE5, 0xEC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC,
-  0xFF, 0x04, 0xFD, 0xFF, 0x05, 0xF5, 0xFF, 0x29, 0xE5, 0xFF, 0xF7, 0xFE, 0x10,
-  0xBA, 0xE6, 0x12, 0x69, 0x39, 0xEC, 0xA8, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xA8,
-  0x28, 0xFF, 0x09, 0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0xE9, 0x28,
-  0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA6,
-  0x30, 0xFF, 0xC1, 0x40, 0xFF, 0xCB, 0xD4, 0xFF, 0xC6, 0xEC, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xA3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF,
+  0x81, 0xC9, 0x28, 0xFF, 0x9E, 0xC8, 0x28, 0xFF, 0x10, 0xC7, 0x20, 0xFF, 0x08,
+  0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x08, 0x29,
+  0xFF, 0x8C, 0x52, 0xBD, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x03, 0x6D, 0xED, 0xED,
+  0xE6, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE2,
+  0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0xCE, 0xED, 0xA7, 0x86, 0x00, 0x00, 0x00, 0x85,
+  0x00, 0x00, 0x00, 0x03, 0xF7, 0xFF, 0x04, 0x8C, 0xE5, 0xE7, 0xE5, 0xFC, 0xFF,
+  0xE2, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x0F, 0xC3, 0xFC, 0xFF, 0x07, 0xF5,
+  0xFF, 0xAE, 0xED, 0xA0, 0x18, 0xFF, 0x09, 0x7F, 0xFE, 0x05, 0x28, 0x29, 0xE7,
+  0xE8, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xC7,
+  0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30,
+  0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x02, 0xC9, 0x28, 0xFF, 0xC9,
+  0x30, 0xFF, 0xC9, 0x28, 0xFF, 0x8E, 0xC8, 0x28, 0xFF, 0x00, 0xE8, 0x28, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x08, 0xC8, 0x28, 0xFF, 0xC8,
+  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xC4, 0x38, 0xFF, 0xE7, 0x8A,
+  0xFF, 0xE7, 0xEC, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xE2, 0xFC,
+  0xFF, 0x00, 0x03, 0xFD, 0xFF, 0x81, 0x04, 0xFD, 0xFF, 0x0F, 0x03, 0xFD, 0xFF,
+  0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE6, 0xEC, 0xFF, 0x0A,
+  0xE5, 0xFF, 0x42, 0x51, 0xFF, 0xE5, 0x38, 0xFF, 0xA7, 0x28, 0xFF, 0xC9, 0x28,
+  0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
+  0xE8, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0x81, 0xCA, 0x28, 0xFF, 0x0B, 0xA9, 0x30,
+  0xFF, 0xC8, 0x30, 0xFF, 0xC6, 0x28, 0xFF, 0xE6, 0x28, 0xFF, 0xC8, 0x20, 0xFF,
+  0xC9, 0x20, 0xFF, 0xA8, 0x28, 0xFF, 0x06, 0x41, 0xFF, 0x80, 0x38, 0xFF, 0x88,
+  0xCC, 0xFF, 0xE6, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x83, 0xE3, 0xFC, 0xFF, 0x00,
+  0x03, 0xFD, 0xFF, 0x82, 0x02, 0xFD, 0xFF, 0x05, 0xE3, 0xFC, 0xFF, 0xC6, 0xF4,
+  0xFF, 0xEB, 0xE4, 0xFF, 0x43, 0x59, 0xFF, 0xA6, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
+  0x9F, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x09, 0xA8, 0x28, 0xFF, 0xC9,
+  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0x48, 0x31, 0xEB, 0x7C, 0xE6,
+  0x0A, 0x00, 0x00, 0x00, 0xF0, 0xED, 0x82, 0xE7, 0xEC, 0xFF, 0xE3, 0xFC, 0xFF,
+  0x81, 0x02, 0xFD, 0xFF, 0x03, 0xE3, 0xFC, 0xFF, 0xE6, 0xFC, 0xFF, 0x4B, 0xED,
+  0xF4, 0xF5, 0xFF, 0x03, 0x85, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x02,
+  0xB2, 0xFE, 0x24, 0x28, 0xE5, 0xFF, 0xE5, 0xFC, 0xFF, 0x83, 0xE3, 0xFC, 0xFF,
+  0x0B, 0x27, 0xED, 0xFF, 0x52, 0xF6, 0x4E, 0x00, 0x00, 0x00, 0xF6, 0xAC, 0x5E,
+  0xC8, 0x28, 0xFE, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC7,
+  0x28, 0xFF, 0x08, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x81, 0xA9,
+  0x30, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x82, 0xC9, 0x28,
+  0xFF, 0x92, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF,
+  0x08, 0x07, 0x39, 0xFF, 0xC3, 0x38, 0xFF, 0x88, 0xA3, 0xFF, 0x07, 0xF5, 0xFF,
+  0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03,
+  0xFD, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x82, 0xE3, 0xFC, 0xFF, 0x19, 0xE4, 0xFC,
+  0xFF, 0x08, 0xED, 0xFF, 0x66, 0xA3, 0xFF, 0xC3, 0x40, 0xFF, 0x86, 0x28, 0xFF,
+  0x4A, 0x31, 0xFF, 0xC8, 0x20, 0xFF, 0xA8, 0x20, 0xFF, 0x09, 0x31, 0xFF, 0xA9,
+  0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE9, 0x20,
+  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC7, 0x30, 0xFF,
+  0xE8, 0x30, 0xFF, 0xC8, 0x20, 0xFF, 0xC9, 0x20, 0xFF, 0x0A, 0x31, 0xFF, 0xA6,
+  0x30, 0xFF, 0xC2, 0x40, 0xFF, 0xC8, 0xAB, 0xFF, 0xE7, 0xF4, 0xFF, 0x81, 0xE3,
+  0xFC, 0xFF, 0x00, 0xE2, 0xFC, 0xFF, 0x83, 0xE3, 0xFC, 0xFF, 0x07, 0xE2, 0xFC,
+  0xFF, 0x23, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0xEA, 0xEC, 0xFF,
+  0xE3, 0x71, 0xFF, 0xC5, 0x38, 0xFF, 0xE9, 0x28, 0xFF, 0x9F, 0xC8, 0x28, 0xFF,
+  0x81, 0xE8, 0x28, 0xFF, 0x0F, 0xC9, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xA9, 0x28,
+  0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x20, 0xF8, 0x53, 0x94, 0x75, 0x00, 0x00, 0x00,
+  0x74, 0xF6, 0x3F, 0x28, 0xED, 0xFF, 0xE3, 0xF4, 0xFF, 0x02, 0xFD, 0xFF, 0xE2,
+  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x08, 0xED, 0xFF, 0x92, 0xFE,
+  0x3D, 0x85, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x04, 0x4F, 0xF6, 0x6F,
+  0x06, 0xE5, 0xFF, 0xC5, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x81,
+  0x04, 0xFD, 0xFF, 0x04, 0x28, 0xED, 0xFF, 0xB5, 0xFE, 0x25, 0x00, 0x00, 0x00,
+  0x4D, 0x5A, 0xC5, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x07, 0xA8, 0x28,
+  0xFF, 0xC8, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xA8, 0x20, 0xFF, 0xA9, 0x30, 0xFF,
+  0xAA, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0x81, 0xE8, 0x28, 0xFF,
+  0x01, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x8F, 0xC8, 0x28, 0xFF, 0x01, 0xC9,
+  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xE7, 0x28, 0xFF, 0x84, 0xC9, 0x28, 0xFF,
+  0x05, 0xE7, 0x30, 0xFF, 0xC1, 0x40, 0xFF, 0x29, 0xC4, 0xFF, 0x08, 0xFD, 0xFF,
+  0xE4, 0xFC, 0xFF, 0xA2, 0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x03, 0xE3, 0xFC,
+  0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x81, 0xE3, 0xFC,
+  0xFF, 0x0C, 0x05, 0xF5, 0xFF, 0xA9, 0xDC, 0xFF, 0xE0, 0x50, 0xFF, 0xA4, 0x30,
+  0xFF, 0x09, 0x31, 0xFF, 0xA9, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0x88, 0x20, 0xFF,
+  0xA8, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
+  0x20, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x03, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF,
+  0xC9, 0x30, 0xFF, 0x88, 0x20, 0xFF, 0x81, 0xEA, 0x28, 0xFF, 0x06, 0xC8, 0x28,
+  0xFF, 0xC7, 0x38, 0xFF, 0x83, 0x38, 0xFF, 0x28, 0xA3, 0xFF, 0xE7, 0xEC, 0xFF,
+  0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x00, 0xE3, 0xFC,
+  0xFF, 0x81, 0xC4, 0xFC, 0xFF, 0x07, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x02,
+  0xFD, 0xFF, 0x05, 0xF5, 0xFF, 0xE8, 0xEC, 0xFF, 0x43, 0x82, 0xFF, 0xC4, 0x38,
+  0xFF, 0xE8, 0x28, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x0F,
+  0xC9, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0x0A, 0x39, 0xFF, 0xC8,
+  0x28, 0xFF, 0xEB, 0x49, 0xD1, 0x00, 0x00, 0x00, 0xB7, 0xFE, 0x19, 0x28, 0xED,
+  0xFF, 0x03, 0xF5, 0xFF, 0x23, 0xFD, 0xFF, 0xE2, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF,
+  0xC5, 0xFC, 0xFF, 0xE7, 0xEC, 0xFF, 0x0F, 0xFE, 0x8C, 0x85, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x01, 0xEC, 0xED, 0xBD, 0xE5, 0xEC,
+  0xFF, 0x82, 0xE4, 0xFC, 0xFF, 0x0D, 0x04, 0xFD, 0xFF, 0x05, 0xF5, 0xFF, 0x29,
+  0xE5, 0xFF, 0xF7, 0xFE, 0x10, 0xBA, 0xE6, 0x12, 0x69, 0x39, 0xEC, 0xA8, 0x28,
+  0xFF, 0xA9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xC8, 0x28, 0xFF,
+  0xC8, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x81, 0xA9, 0x30, 0xFF,
+  0x00, 0xC8, 0x30, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x01, 0xC8, 0x28, 0xFF, 0xC9,
+  0x28, 0xFF, 0x8F, 0xC8, 0x28, 0xFF, 0x01, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
+  0x81, 0xE7, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x83, 0xC9, 0x28, 0xFF, 0x06,
+  0xA6, 0x30, 0xFF, 0xC1, 0x40, 0xFF, 0xCB, 0xD4, 0xFF, 0xC6, 0xEC, 0xFF, 0xE4,
+  0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x0F,
   0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x02,
   0xFD, 0xFF, 0x06, 0xED, 0xFF, 0xA8, 0xB3, 0xFF, 0xE3, 0x48, 0xFF, 0xC6, 0x30,
   0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30,
-  0xFF, 0xA9, 0x30, 0xFF, 0xEA, 0x30, 0xFF, 0xCA, 0x28, 0xFF, 0xC9, 0x20, 0xFF,
-  0xC7, 0x28, 0xFF, 0xC6, 0x30, 0xFF, 0xE5, 0x40, 0xFF, 0xC7, 0x92, 0xFF, 0xE7,
-  0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC5, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xF5, 0xFF, 0xE7,
-  0xEC, 0xFF, 0x63, 0x8A, 0xFF, 0xC4, 0x38, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0x08, 0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xCA,
-  0x30, 0xFF, 0x68, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0x29, 0x31,
-  0xEB, 0x5B, 0xD6, 0x18, 0x79, 0xFE, 0x05, 0x49, 0xED, 0xFB, 0x04, 0xF5, 0xFF,
-  0x24, 0xFD, 0xFF, 0xE2, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE6,
-  0xF4, 0xFF, 0xCC, 0xF5, 0xD4, 0xF7, 0xFD, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xD6, 0xFE, 0x07, 0x49, 0xED, 0xE2, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC,
-  0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xF4, 0xFF, 0xE7, 0xEC, 0xFF,
-  0x0F, 0xF6, 0xA9, 0xF7, 0xFF, 0x04, 0xD9, 0xC5, 0x32, 0xE8, 0x28, 0xF4, 0xC9,
-  0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9,
-  0x28, 0xFF, 0xE7, 0x38, 0xFF, 0xA1, 0x40, 0xFF, 0xCB, 0xD4, 0xFF, 0xE5, 0xEC,
-  0xFF, 0x03, 0xFD, 0xFF, 0xC4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF,
-  0x24, 0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0xC4, 0xFC, 0xFF, 0xC3,
-  0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x00, 0xF5, 0xFF, 0x46, 0xED, 0xFF, 0x45, 0x82,
-  0xFF, 0xE6, 0x40, 0xFF, 0xC7, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xC8, 0x20, 0xFF,
-  0xE9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF,
-  0xAA, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xE8, 0x38, 0xFF, 0xA5, 0x30, 0xFF, 0xC3,
-  0x38, 0xFF, 0x68, 0xA3, 0xFF, 0xE7, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE2, 0xFC, 0xFF, 0x01, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF,
-  0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x25,
-  0xFD, 0xFF, 0x07, 0xED, 0xFF, 0x22, 0x7A, 0xFF, 0xC5, 0x38, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xF0, 0xB8, 0xBD, 0x37, 0x00, 0x00, 0x00,
-  0x30, 0xF6, 0x81, 0x07, 0xE5, 0xFF, 0x25, 0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0xC3,
-  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x4A, 0xED, 0xEF, 0x36, 0xFF,
-  0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xFF, 0x0C, 0x48, 0xF5, 0xF6, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xF5, 0xFF,
-  0x08, 0xE5, 0xFF, 0x93, 0xFE, 0x3E, 0x00, 0x00, 0x00, 0xD5, 0xAC, 0x5B, 0xE8,
-  0x28, 0xFC, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xEA, 0x30, 0xFF, 0x86, 0x30, 0xFF, 0xC2, 0x40,
-  0xFF, 0x6A, 0xC4, 0xFF, 0x47, 0xED, 0xFF, 0x23, 0xFD, 0xFF, 0xA3, 0xFC, 0xFF,
-  0xA4, 0xFC, 0xFF, 0xC3, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xC4,
-  0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0xE7, 0xDC,
-  0xFF, 0x44, 0x59, 0xFF, 0x87, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x08, 0x21, 0xFF,
-  0xC8, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0x09, 0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xAA, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xA7,
-  0x30, 0xFF, 0xE5, 0x38, 0xFF, 0xC1, 0x40, 0xFF, 0x87, 0xAB, 0xFF, 0xE6, 0xFC,
-  0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE2,
-  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC4, 0xEC, 0xFF, 0x49, 0xED, 0xFF, 0xC1, 0x69,
-  0xFF, 0xE6, 0x38, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC7,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC7, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xF3,
+  0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0x83, 0xE8, 0x28, 0xFF,
+  0x0B, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xEA, 0x30, 0xFF,
+  0xCA, 0x28, 0xFF, 0xC9, 0x20, 0xFF, 0xC7, 0x28, 0xFF, 0xC6, 0x30, 0xFF, 0xE5,
+  0x40, 0xFF, 0xC7, 0x92, 0xFF, 0xE7, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x81, 0xE2,
+  0xFC, 0xFF, 0x0B, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC5,
+  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xF5,
+  0xFF, 0xE7, 0xEC, 0xFF, 0x63, 0x8A, 0xFF, 0xC4, 0x38, 0xFF, 0xC9, 0x28, 0xFF,
+  0x9F, 0xC8, 0x28, 0xFF, 0x12, 0x08, 0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
+  0xFF, 0xCA, 0x30, 0xFF, 0x68, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
+  0x29, 0x31, 0xEB, 0x5B, 0xD6, 0x18, 0x79, 0xFE, 0x05, 0x49, 0xED, 0xFB, 0x04,
+  0xF5, 0xFF, 0x24, 0xFD, 0xFF, 0xE2, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC,
+  0xFF, 0xE6, 0xF4, 0xFF, 0xCC, 0xF5, 0xD4, 0xF7, 0xFD, 0x04, 0x84, 0x00, 0x00,
+  0x00, 0x84, 0x00, 0x00, 0x00, 0x0D, 0xD6, 0xFE, 0x07, 0x49, 0xED, 0xE2, 0xE4,
+  0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xF4,
+  0xFF, 0xE7, 0xEC, 0xFF, 0x0F, 0xF6, 0xA9, 0xF7, 0xFF, 0x04, 0xD9, 0xC5, 0x32,
+  0xE8, 0x28, 0xF4, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x84, 0xC8, 0x28, 0xFF,
+  0x82, 0xC9, 0x28, 0xFF, 0x96, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x82,
+  0xC8, 0x28, 0xFF, 0x06, 0xC9, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xE7, 0x38, 0xFF,
+  0xA1, 0x40, 0xFF, 0xCB, 0xD4, 0xFF, 0xE5, 0xEC, 0xFF, 0x03, 0xFD, 0xFF, 0x81,
+  0xC4, 0xFC, 0xFF, 0x11, 0x24, 0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x04, 0xFD, 0xFF,
+  0xC4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x00, 0xF5, 0xFF, 0x46,
+  0xED, 0xFF, 0x45, 0x82, 0xFF, 0xE6, 0x40, 0xFF, 0xC7, 0x28, 0xFF, 0x09, 0x29,
+  0xFF, 0xC8, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x30, 0xFF,
+  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x08, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xAA,
+  0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xE8, 0x38, 0xFF, 0xA5, 0x30, 0xFF, 0xC3, 0x38,
+  0xFF, 0x68, 0xA3, 0xFF, 0xE7, 0xF4, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x02, 0xE2,
+  0xFC, 0xFF, 0x01, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x81, 0xC4, 0xFC, 0xFF, 0x06,
+  0xE3, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x25, 0xFD, 0xFF, 0x07,
+  0xED, 0xFF, 0x22, 0x7A, 0xFF, 0xC5, 0x38, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x9E,
+  0xC8, 0x28, 0xFF, 0x01, 0xC7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xCA, 0x28,
+  0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x0C, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xF0, 0xB8,
+  0xBD, 0x37, 0x00, 0x00, 0x00, 0x30, 0xF6, 0x81, 0x07, 0xE5, 0xFF, 0x25, 0xF5,
+  0xFF, 0x03, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF,
+  0x4A, 0xED, 0xEF, 0x36, 0xFF, 0x0A, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00,
+  0x00, 0x01, 0x57, 0xFF, 0x0C, 0x48, 0xF5, 0xF6, 0x81, 0xE3, 0xFC, 0xFF, 0x08,
+  0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x08, 0xE5, 0xFF, 0x93,
+  0xFE, 0x3E, 0x00, 0x00, 0x00, 0xD5, 0xAC, 0x5B, 0xE8, 0x28, 0xFC, 0xC9, 0x28,
+  0xFF, 0xA5, 0xC8, 0x28, 0xFF, 0x15, 0xEA, 0x30, 0xFF, 0x86, 0x30, 0xFF, 0xC2,
+  0x40, 0xFF, 0x6A, 0xC4, 0xFF, 0x47, 0xED, 0xFF, 0x23, 0xFD, 0xFF, 0xA3, 0xFC,
+  0xFF, 0xA4, 0xFC, 0xFF, 0xC3, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF,
+  0xC4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0xE7,
+  0xDC, 0xFF, 0x44, 0x59, 0xFF, 0x87, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x08, 0x21,
+  0xFF, 0xC8, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x85, 0xC9,
+  0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x0A, 0x09, 0x31, 0xFF, 0xC8, 0x28, 0xFF,
+  0xAA, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xA7, 0x30, 0xFF, 0xE5, 0x38, 0xFF, 0xC1,
+  0x40, 0xFF, 0x87, 0xAB, 0xFF, 0xE6, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC,
+  0xFF, 0x82, 0xE2, 0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x08, 0x03, 0xFD, 0xFF,
+  0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC4, 0xEC, 0xFF, 0x49, 0xED, 0xFF, 0xC1,
+  0x69, 0xFF, 0xE6, 0x38, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x9E, 0xC8,
+  0x28, 0xFF, 0x01, 0xC7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xCA, 0x28, 0xFF,
+  0x0E, 0xC8, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xF3,
   0x94, 0x94, 0x6C, 0x00, 0x00, 0x00, 0x73, 0xFE, 0x25, 0x29, 0xE5, 0xFF, 0x25,
   0xED, 0xFF, 0x03, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE5, 0xFC,
-  0xFF, 0x28, 0xED, 0xFF, 0xB5, 0xFE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xEE,
-  0x20, 0x28, 0xF5, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0x09, 0xE5, 0xFF, 0xD5, 0xFE, 0x1C, 0x00,
-  0x00, 0x00, 0x70, 0x73, 0xA3, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x87, 0x20,
-  0xFF, 0xE8, 0x38, 0xFF, 0xC4, 0x38, 0xFF, 0xC7, 0x8A, 0xFF, 0x08, 0xE5, 0xFF,
-  0x04, 0xED, 0xFF, 0xC1, 0xF4, 0xFF, 0x22, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x04,
-  0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x63, 0xFC, 0xFF, 0xC6, 0xFC,
-  0xFF, 0x29, 0xF5, 0xFF, 0x47, 0xAB, 0xFF, 0xA5, 0x40, 0xFF, 0x88, 0x30, 0xFF,
-  0xE9, 0x28, 0xFF, 0x08, 0x21, 0xFF, 0xE7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC9,
-  0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x2B, 0x31, 0xFF, 0x68,
-  0x18, 0xFF, 0xC8, 0x30, 0xFF, 0xE5, 0x40, 0xFF, 0xC0, 0x50, 0xFF, 0xCA, 0xE4,
-  0xFF, 0xE6, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3,
+  0xFF, 0x28, 0xED, 0xFF, 0xB5, 0xFE, 0x13, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x01, 0xB4, 0xEE, 0x20, 0x28, 0xF5, 0xFF, 0x83, 0xE3, 0xFC, 0xFF,
+  0x05, 0x05, 0xFD, 0xFF, 0x09, 0xE5, 0xFF, 0xD5, 0xFE, 0x1C, 0x00, 0x00, 0x00,
+  0x70, 0x73, 0xA3, 0xE8, 0x28, 0xFF, 0x9E, 0xC8, 0x28, 0xFF, 0x85, 0xC9, 0x28,
+  0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x09, 0x87, 0x20, 0xFF, 0xE8, 0x38, 0xFF, 0xC4,
+  0x38, 0xFF, 0xC7, 0x8A, 0xFF, 0x08, 0xE5, 0xFF, 0x04, 0xED, 0xFF, 0xC1, 0xF4,
+  0xFF, 0x22, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x81, 0xC3, 0xFC,
+  0xFF, 0x0B, 0x63, 0xFC, 0xFF, 0xC6, 0xFC, 0xFF, 0x29, 0xF5, 0xFF, 0x47, 0xAB,
+  0xFF, 0xA5, 0x40, 0xFF, 0x88, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0x08, 0x21, 0xFF,
+  0xE7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0x82,
+  0xC9, 0x28, 0xFF, 0x84, 0xC8, 0x28, 0xFF, 0x08, 0xC7, 0x28, 0xFF, 0xC8, 0x28,
+  0xFF, 0x2B, 0x31, 0xFF, 0x68, 0x18, 0xFF, 0xC8, 0x30, 0xFF, 0xE5, 0x40, 0xFF,
+  0xC0, 0x50, 0xFF, 0xCA, 0xE4, 0xFF, 0xE6, 0xFC, 0xFF, 0x82, 0xE3, 0xFC, 0xFF,
+  0x00, 0xE4, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x09, 0xE2, 0xFC, 0xFF, 0xE3,
   0xFC, 0xFF, 0xA2, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x26, 0xF5, 0xFF, 0xE9, 0xDC,
-  0xFF, 0x20, 0x51, 0xFF, 0xC6, 0x38, 0xFF, 0xA9, 0x30, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xCA, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
-  0xE8, 0x28, 0xFD, 0xCD, 0x5A, 0xAE, 0x00, 0x00, 0x00, 0x73, 0xFE, 0x05, 0x4B,
-  0xE5, 0xFF, 0x05, 0xED, 0xFF, 0x03, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0x08, 0xED, 0xFF, 0x93, 0xF6, 0x33, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x52, 0xEE, 0x5D, 0x27, 0xED, 0xFF, 0xE3, 0xFC, 0xFF,
-  0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0x4B,
-  0xE5, 0xFD, 0xF7, 0xFE, 0x10, 0x00, 0x00, 0x00, 0xEA, 0x41, 0xDC, 0xE8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0x09, 0x31, 0xFF, 0xC7, 0x30, 0xFF, 0xA5, 0x30, 0xFF, 0x44, 0x51, 0xFF,
-  0xEC, 0xD4, 0xFF, 0xE6, 0xE4, 0xFF, 0x44, 0xF5, 0xFF, 0xE1, 0xF4, 0xFF, 0xE2,
-  0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC5, 0xFC,
-  0xFF, 0x09, 0xFD, 0xFF, 0x4A, 0xD4, 0xFF, 0x44, 0x69, 0xFF,
-  0xA7, 0x40, 0xFF, 0xC9, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30,
-  0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x09,
-  0x29, 0xFF, 0xA8, 0x18, 0xFF, 0x09, 0x29, 0xFF, 0xC7, 0x30, 0xFF, 0xA3, 0x40,
-  0xFF, 0x46, 0xAB, 0xFF, 0xE8, 0xF4, 0xFF, 0xE5, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE2,
-  0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x04, 0xFD,
-  0xFF, 0x27, 0xF5, 0xFF, 0x69, 0xC4, 0xFF, 0xC0, 0x40, 0xFF, 0xC6, 0x38, 0xFF,
-  0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x69, 0x31, 0xDE, 0x00,
-  0x00, 0x00, 0xF5, 0xFF, 0x03, 0x8C, 0xED, 0xEC, 0x26, 0xED, 0xFF, 0x03, 0xFD,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x07, 0xED, 0xFF,
-  0x30, 0xEE, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xE5, 0xA5, 0x07, 0xED, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE5,
-  0xF4, 0xFF, 0xAE, 0xED, 0xD1, 0x18, 0xFF, 0x09, 0x9A, 0xE6, 0x11, 0x07, 0x29,
-  0xF8, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x28, 0xFF,
-  0xA8, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0x63, 0x59, 0xFF, 0xCB, 0xD4, 0xFF, 0x48,
-  0xED, 0xFF, 0x03, 0xED, 0xFF, 0xE1, 0xFC, 0xFF, 0x42, 0xFD, 0xFF, 0xE1, 0xFC,
-  0xFF, 0xE2, 0xF4, 0xFF, 0x47, 0xFD, 0xFF, 0xC9, 0xDC, 0xFF, 0xC7, 0x92, 0xFF,
-  0xA4, 0x40, 0xFF, 0xA7, 0x38, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x20, 0xFF, 0xC8,
-  0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xAA, 0x30,
-  0xFF, 0xA9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC7,
-  0x20, 0xFF, 0x29, 0x29, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC6, 0x40,
-  0xFF, 0xC4, 0x71, 0xFF, 0xC8, 0xEC, 0xFF, 0xE5, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x04,
-  0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xA4, 0xFC,
-  0xFF, 0x05, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC5, 0xDC, 0xFF, 0x67, 0xA3, 0xFF,
-  0xC3, 0x40, 0xFF, 0xA7, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7,
-  0x28, 0xEF, 0xF8, 0xD5, 0x23, 0xFF, 0xFF, 0x02, 0xAE, 0xED, 0xC1, 0x26, 0xF5,
-  0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0x07, 0xED, 0xFF, 0xAE, 0xE5, 0xC4, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x8D, 0xE5, 0xE2, 0xE6, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0x10, 0xF6, 0x9D, 0x79, 0xFE,
-  0x05, 0xB8, 0xC5, 0x46, 0xC7, 0x20, 0xFD, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0x88, 0x28, 0xFF, 0xE8, 0x40, 0xFF, 0xA4,
+  0xFF, 0x20, 0x51, 0xFF, 0xC6, 0x38, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
+  0xA0, 0xC8, 0x28, 0xFF, 0x01, 0xCA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xC8,
+  0x30, 0xFF, 0x07, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFD, 0xCD, 0x5A, 0xAE, 0x00,
+  0x00, 0x00, 0x73, 0xFE, 0x05, 0x4B, 0xE5, 0xFF, 0x05, 0xED, 0xFF, 0x03, 0xFD,
+  0xFF, 0x81, 0xC3, 0xFC, 0xFF, 0x02, 0xE4, 0xFC, 0xFF, 0x08, 0xED, 0xFF, 0x93,
+  0xF6, 0x33, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x03, 0x52, 0xEE,
+  0x5D, 0x27, 0xED, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xE3, 0xFC,
+  0xFF, 0x05, 0x05, 0xFD, 0xFF, 0x4B, 0xE5, 0xFD, 0xF7, 0xFE, 0x10, 0x00, 0x00,
+  0x00, 0xEA, 0x41, 0xDC, 0xE8, 0x28, 0xFF, 0x9D, 0xC8, 0x28, 0xFF, 0x86, 0xC9,
+  0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x07, 0x09, 0x31, 0xFF, 0xC7, 0x30, 0xFF,
+  0xA5, 0x30, 0xFF, 0x44, 0x51, 0xFF, 0xEC, 0xD4, 0xFF, 0xE6, 0xE4, 0xFF, 0x44,
+  0xF5, 0xFF, 0xE1, 0xF4, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x09, 0xC2, 0xFC, 0xFF,
+  0x04, 0xFD, 0xFF, 0xC5, 0xFC, 0xFF, 0x09, 0xFD, 0xFF, 0x4A, 0xD4, 0xFF, 0x44,
+  0x69, 0xFF, 0xA7, 0x40, 0xFF, 0xC9, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x20,
+  0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x00, 0xA9, 0x28, 0xFF, 0x81, 0xA9, 0x30, 0xFF,
+  0x00, 0xC9, 0x30, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x84, 0xC8, 0x28, 0xFF, 0x07,
+  0x09, 0x29, 0xFF, 0xA8, 0x18, 0xFF, 0x09, 0x29, 0xFF, 0xC7, 0x30, 0xFF, 0xA3,
+  0x40, 0xFF, 0x46, 0xAB, 0xFF, 0xE8, 0xF4, 0xFF, 0xE5, 0xFC, 0xFF, 0x82, 0xE3,
+  0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x81, 0xC3, 0xFC,
+  0xFF, 0x06, 0x04, 0xFD, 0xFF, 0x27, 0xF5, 0xFF, 0x69, 0xC4, 0xFF, 0xC0, 0x40,
+  0xFF, 0xC6, 0x38, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xA0, 0xC8, 0x28,
+  0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x07, 0xC9, 0x28, 0xFF,
+  0xE8, 0x28, 0xFF, 0x69, 0x31, 0xDE, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x03, 0x8C,
+  0xED, 0xEC, 0x26, 0xED, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x02,
+  0xE4, 0xFC, 0xFF, 0x07, 0xED, 0xFF, 0x30, 0xEE, 0x77, 0x84, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x01, 0xF0, 0xE5, 0xA5, 0x07, 0xED, 0xFF, 0x82, 0xE3,
+  0xFC, 0xFF, 0x06, 0xC3, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0xAE, 0xED, 0xD1, 0x18,
+  0xFF, 0x09, 0x9A, 0xE6, 0x11, 0x07, 0x29, 0xF8, 0xE8, 0x28, 0xFF, 0x9D, 0xC8,
+  0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x81, 0xC7, 0x28, 0xFF, 0x0F, 0xA8, 0x30, 0xFF,
+  0xA5, 0x38, 0xFF, 0x63, 0x59, 0xFF, 0xCB, 0xD4, 0xFF, 0x48, 0xED, 0xFF, 0x03,
+  0xED, 0xFF, 0xE1, 0xFC, 0xFF, 0x42, 0xFD, 0xFF, 0xE1, 0xFC, 0xFF, 0xE2, 0xF4,
+  0xFF, 0x47, 0xFD, 0xFF, 0xC9, 0xDC, 0xFF, 0xC7, 0x92, 0xFF, 0xA4, 0x40, 0xFF,
+  0xA7, 0x38, 0xFF, 0xC9, 0x30, 0xFF, 0x81, 0xC8, 0x20, 0xFF, 0x81, 0xE8, 0x28,
+  0xFF, 0x03, 0xA9, 0x28, 0xFF, 0xAA, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC8, 0x30,
+  0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x82, 0xC8, 0x30, 0xFF, 0x0C, 0xC8, 0x28, 0xFF,
+  0xC7, 0x20, 0xFF, 0x29, 0x29, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC6,
+  0x40, 0xFF, 0xC4, 0x71, 0xFF, 0xC8, 0xEC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE4, 0xFC,
+  0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0x04, 0xFD,
+  0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x08, 0xA4, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0xE3,
+  0xFC, 0xFF, 0xC5, 0xDC, 0xFF, 0x67, 0xA3, 0xFF, 0xC3, 0x40, 0xFF, 0xA7, 0x30,
+  0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xA0, 0xC8, 0x28, 0xFF, 0x81, 0xC9,
+  0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x0C, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
+  0xE7, 0x28, 0xEF, 0xF8, 0xD5, 0x23, 0xFF, 0xFF, 0x02, 0xAE, 0xED, 0xC1, 0x26,
+  0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC,
+  0xFF, 0x07, 0xED, 0xFF, 0xAE, 0xE5, 0xC4, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x01, 0x8D, 0xE5, 0xE2, 0xE6, 0xF4, 0xFF, 0x82, 0xE3, 0xFC, 0xFF,
+  0x06, 0xC3, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0x10, 0xF6, 0x9D, 0x79, 0xFE, 0x05,
+  0xB8, 0xC5, 0x46, 0xC7, 0x20, 0xFD, 0xE8, 0x28, 0xFF, 0x85, 0xC8, 0x28, 0xFF,
+  0x00, 0xC9, 0x28, 0xFF, 0x96, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81,
+  0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xE8,
+  0x28, 0xFF, 0x16, 0x09, 0x31, 0xFF, 0x88, 0x28, 0xFF, 0xE8, 0x40, 0xFF, 0xA4,
   0x40, 0xFF, 0x83, 0x61, 0xFF, 0x29, 0xBC, 0xFF, 0x08, 0xE5, 0xFF, 0x06, 0xF5,
   0xFF, 0xC5, 0xEC, 0xFF, 0x06, 0xED, 0xFF, 0x48, 0xF5, 0xFF, 0xA8, 0xD4, 0xFF,
   0x64, 0x82, 0xFF, 0xA3, 0x40, 0xFF, 0x86, 0x38, 0xFF, 0xA7, 0x30, 0xFF, 0xE9,
   0x28, 0xFF, 0xC9, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0x08, 0x29, 0xFF, 0xC7, 0x28,
-  0xFF, 0xA9, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9,
-  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0xE7, 0x28,
-  0xFF, 0xE5, 0x38, 0xFF, 0xE2, 0x50, 0xFF, 0x4A, 0xCC, 0xFF, 0xC6, 0xF4, 0xFF,
-  0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x02,
-  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC,
-  0xFF, 0xA4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x69, 0xED, 0xFF,
-  0x04, 0x6A, 0xFF, 0xC5, 0x38, 0xFF, 0xA7, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xF2, 0xD5, 0xAC, 0x52, 0x00, 0x00,
-  0x00, 0x11, 0xEE, 0x89, 0x07, 0xF5, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0x6C, 0xDD, 0xFF, 0xF5,
-  0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xD6, 0xFE, 0x07, 0x2B, 0xE5, 0xFF, 0xE5, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x07, 0xF5, 0xFF, 0x32, 0xF6,
-  0x6E, 0x00, 0x00, 0x00, 0x73, 0x9C, 0x76, 0xC7, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0x0A, 0x31, 0xFF, 0x88,
-  0x28, 0xFF, 0x87, 0x30, 0xFF, 0xC6, 0x40, 0xFF, 0xC3, 0x48, 0xFF, 0x25, 0x7A,
-  0xFF, 0x69, 0xAB, 0xFF, 0xCA, 0xBB, 0xFF, 0xAA, 0xAB, 0xFF, 0x66, 0x82, 0xFF,
-  0x43, 0x51, 0xFF, 0xE4, 0x40, 0xFF, 0xE8, 0x38, 0xFF, 0xA9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0x09, 0x29, 0xFF, 0xE9, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC7, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xCA,
-  0x28, 0xFF, 0xAA, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x09, 0x31,
-  0xFF, 0xC7, 0x28, 0xFF, 0xA5, 0x38, 0xFF, 0x22, 0x51, 0xFF, 0x27, 0xCC, 0xFF,
-  0xE6, 0xEC, 0xFF, 0x05, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x02, 0xF5, 0xFF, 0x03, 0xFD,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF,
-  0x05, 0xF5, 0xFF, 0x88, 0xCC, 0xFF, 0xE2, 0x48, 0xFF, 0xC7, 0x30, 0xFF, 0xA8,
-  0x28, 0xFF, 0xEA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
-  0xF4, 0xB1, 0x8B, 0x80, 0x00, 0x00, 0x00, 0x53, 0xF6, 0x5B, 0x07, 0xED, 0xFF,
-  0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x06,
-  0xF5, 0xFF, 0x2A, 0xDD, 0xFF, 0xF5, 0xFE, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFE, 0x1C, 0x09, 0xE5, 0xFF, 0xE5,
-  0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC,
+  0xFF, 0xA9, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x81, 0xC8,
+  0x28, 0xFF, 0x00, 0xC8, 0x30, 0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x19, 0xC8, 0x28,
+  0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0xE5, 0x38, 0xFF,
+  0xE2, 0x50, 0xFF, 0x4A, 0xCC, 0xFF, 0xC6, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0xE4,
+  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD,
+  0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xA4, 0xFC, 0xFF,
+  0xC4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x69, 0xED, 0xFF, 0x04, 0x6A, 0xFF, 0xC5,
+  0x38, 0xFF, 0xA7, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0x9E, 0xC8,
+  0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x84, 0xC8, 0x28, 0xFF, 0x05, 0xE8, 0x28,
+  0xF2, 0xD5, 0xAC, 0x52, 0x00, 0x00, 0x00, 0x11, 0xEE, 0x89, 0x07, 0xF5, 0xFF,
+  0xE3, 0xFC, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x03, 0xE3, 0xFC, 0xFF, 0x06, 0xF5,
+  0xFF, 0x6C, 0xDD, 0xFF, 0xF5, 0xFF, 0x03, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00,
+  0x00, 0x00, 0x02, 0xD6, 0xFE, 0x07, 0x2B, 0xE5, 0xFF, 0xE5, 0xF4, 0xFF, 0x83,
+  0xE3, 0xFC, 0xFF, 0x04, 0x07, 0xF5, 0xFF, 0x32, 0xF6, 0x6E, 0x00, 0x00, 0x00,
+  0x73, 0x9C, 0x76, 0xC7, 0x28, 0xFF, 0x85, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x97, 0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x83, 0xC8, 0x28, 0xFF,
+  0x81, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x14, 0xA7, 0x20, 0xFF, 0x0A,
+  0x31, 0xFF, 0x88, 0x28, 0xFF, 0x87, 0x30, 0xFF, 0xC6, 0x40, 0xFF, 0xC3, 0x48,
+  0xFF, 0x25, 0x7A, 0xFF, 0x69, 0xAB, 0xFF, 0xCA, 0xBB, 0xFF, 0xAA, 0xAB, 0xFF,
+  0x66, 0x82, 0xFF, 0x43, 0x51, 0xFF, 0xE4, 0x40, 0xFF, 0xE8, 0x38, 0xFF, 0xA9,
+  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xE9, 0x28, 0xFF, 0x09, 0x29,
+  0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x82, 0xC8, 0x30, 0xFF, 0x81, 0xE8,
+  0x28, 0xFF, 0x1D, 0xC8, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xAA, 0x30, 0xFF, 0xC9,
+  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xC7, 0x28, 0xFF, 0xA5, 0x38,
+  0xFF, 0x22, 0x51, 0xFF, 0x27, 0xCC, 0xFF, 0xE6, 0xEC, 0xFF, 0x05, 0xFD, 0xFF,
+  0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02,
+  0xFD, 0xFF, 0x02, 0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC,
+  0xFF, 0xC3, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x88, 0xCC, 0xFF,
+  0xE2, 0x48, 0xFF, 0xC7, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xEA, 0x28, 0xFF, 0xC9,
+  0x28, 0xFF, 0x9D, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x03, 0xC8, 0x28,
+  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x28,
+  0xFF, 0x05, 0xE8, 0x28, 0xF4, 0xB1, 0x8B, 0x80, 0x00, 0x00, 0x00, 0x53, 0xF6,
+  0x5B, 0x07, 0xED, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x03, 0xE3,
+  0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0x2A, 0xDD, 0xFF, 0xF5, 0xFE, 0x16, 0x83, 0x00,
+  0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x02, 0xD5, 0xFE, 0x1C, 0x09, 0xE5, 0xFF,
+  0xE5, 0xF4, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x06, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC,
   0xFF, 0x07, 0xF5, 0xFF, 0x53, 0xEE, 0x4B, 0x00, 0x00, 0x00, 0x70, 0x7B, 0xA3,
-  0xC7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0x29,
-  0x31, 0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xEA, 0x38, 0xFF, 0x88, 0x30,
-  0xFF, 0xC7, 0x40, 0xFF, 0xA5, 0x40, 0xFF, 0x63, 0x38, 0xFF, 0xC5, 0x48, 0xFF,
-  0xA5, 0x38, 0xFF, 0xC5, 0x38, 0xFF, 0xE6, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xA9,
-  0x28, 0xFF, 0xEA, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xA8, 0x20,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xE8, 0x30, 0xFF,
-  0xA7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xA7, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0x22, 0x59, 0xFF, 0x6A, 0xCC, 0xFF,
-  0x06, 0xED, 0xFF, 0x23, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x02, 0xFD,
-  0xFF, 0x02, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF,
-  0xC3, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0xE9, 0xEC, 0xFF, 0x80, 0x69, 0xFF, 0xC4,
-  0x40, 0xFF, 0xC8, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x20, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
-  0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFB, 0xCF, 0x6A, 0xA5, 0x00, 0x00, 0x00, 0x95, 0xF6, 0x38,
-  0x08, 0xED, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2,
-  0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0x08, 0xDD, 0xFF, 0xD4, 0xFE, 0x32, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92,
-  0xFE, 0x37, 0x08, 0xED, 0xFF, 0xE5, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE7, 0xEC, 0xFF, 0xD6, 0xFE, 0x2A,
-  0x00, 0x00, 0x00, 0xAE, 0x62, 0xBD, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA8, 0x30, 0xFF,
-  0xC7, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xC8,
-  0x20, 0xFF, 0xEA, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xA5, 0x40, 0xFF, 0x22, 0x59, 0xFF,
-  0x27, 0xCC, 0xFF, 0x26, 0xF5, 0xFF, 0xC2, 0xEC, 0xFF, 0x43, 0xFD, 0xFF, 0xE3,
-  0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC,
-  0xFF, 0x23, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
+  0xC7, 0x28, 0xFF, 0x84, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x97, 0xC8,
+  0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x83, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28,
+  0xFF, 0x1B, 0xC8, 0x20, 0xFF, 0x29, 0x31, 0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x28,
+  0xFF, 0xEA, 0x38, 0xFF, 0x88, 0x30, 0xFF, 0xC7, 0x40, 0xFF, 0xA5, 0x40, 0xFF,
+  0x63, 0x38, 0xFF, 0xC5, 0x48, 0xFF, 0xA5, 0x38, 0xFF, 0xC5, 0x38, 0xFF, 0xE6,
+  0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xEA, 0x28, 0xFF, 0xE9, 0x28,
+  0xFF, 0xE8, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
+  0xC7, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE8,
+  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xCA, 0x28, 0xFF, 0x0C,
+  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA7, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0x22,
+  0x59, 0xFF, 0x6A, 0xCC, 0xFF, 0x06, 0xED, 0xFF, 0x23, 0xFD, 0xFF, 0xE3, 0xFC,
+  0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
+  0x82, 0x02, 0xFD, 0xFF, 0x0A, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC3, 0xFC,
+  0xFF, 0x05, 0xFD, 0xFF, 0xE9, 0xEC, 0xFF, 0x80, 0x69, 0xFF, 0xC4, 0x40, 0xFF,
+  0xC8, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0x9D,
+  0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x81, 0xE8,
+  0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x06, 0xC8, 0x28, 0xFB, 0xCF, 0x6A, 0xA5,
+  0x00, 0x00, 0x00, 0x95, 0xF6, 0x38, 0x08, 0xED, 0xFF, 0x03, 0xFD, 0xFF, 0x02,
+  0xFD, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x02, 0x05, 0xFD, 0xFF, 0x08, 0xDD, 0xFF,
+  0xD4, 0xFE, 0x32, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x02, 0x92,
+  0xFE, 0x37, 0x08, 0xED, 0xFF, 0xE5, 0xF4, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x06,
+  0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE7, 0xEC, 0xFF, 0xD6, 0xFE, 0x2A, 0x00,
+  0x00, 0x00, 0xAE, 0x62, 0xBD, 0xE8, 0x28, 0xFF, 0x9E, 0xC8, 0x28, 0xFF, 0x82,
+  0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x01, 0xCA,
+  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF,
+  0x81, 0xA9, 0x30, 0xFF, 0x00, 0xA8, 0x30, 0xFF, 0x81, 0xC7, 0x30, 0xFF, 0x01,
+  0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x85, 0xE8, 0x28, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x13, 0xE8, 0x20, 0xFF,
+  0xC8, 0x20, 0xFF, 0xEA, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9,
+  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xA5, 0x40, 0xFF, 0x22, 0x59,
+  0xFF, 0x27, 0xCC, 0xFF, 0x26, 0xF5, 0xFF, 0xC2, 0xEC, 0xFF, 0x43, 0xFD, 0xFF,
+  0xE3, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2,
+  0xFC, 0xFF, 0x23, 0xFD, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x0A, 0x03, 0xFD, 0xFF,
   0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x06, 0xED, 0xFF, 0xA9, 0xB3, 0xFF, 0xA2,
   0x48, 0xFF, 0x85, 0x30, 0xFF, 0x09, 0x39, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x20,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x6E, 0x62, 0xB9,
-  0x00, 0x00, 0x00, 0x18, 0xFF, 0x1A, 0x08, 0xED, 0xFF, 0x03, 0xFD, 0xFF, 0xE2,
-  0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE4, 0xF4, 0xFF, 0x08, 0xE5,
-  0xFF, 0x92, 0xFE, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x71, 0xFE, 0x50, 0x07, 0xED, 0xFF, 0xE4, 0xF4, 0xFF, 0x03, 0xFD,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x08, 0xED, 0xFF,
-  0x17, 0xF7, 0x12, 0x00, 0x00, 0x00, 0x6D, 0x5A, 0xCA, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xCA,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x20, 0xFF, 0x2A, 0x31, 0xFF, 0xCA, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xE9, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0x84, 0x38, 0xFF,
-  0x63, 0x69, 0xFF, 0xAB, 0xE4, 0xFF, 0x06, 0xF5, 0xFF, 0xA1, 0xF4, 0xFF, 0x23,
-  0xFD, 0xFF, 0xC1, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD,
-  0xFF, 0xA2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF,
-  0x03, 0xFD, 0xFF, 0xC1, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x25, 0xF5, 0xFF, 0xC9,
-  0xD4, 0xFF, 0x23, 0x51, 0xFF, 0xC7, 0x40, 0xFF, 0xC7, 0x38, 0xFF, 0x87, 0x28,
-  0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x30, 0xFF, 0x0D, 0x52, 0xCC, 0x00, 0x00, 0x00, 0xD6, 0xFE, 0x07, 0x09,
-  0xED, 0xFF, 0x04, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0x07, 0xED, 0xFF, 0x70, 0xFE, 0x64, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFE, 0x68, 0x07, 0xF5,
-  0xFF, 0xE4, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0x29, 0xED, 0xFF, 0x18, 0xFF, 0x09, 0xFF, 0xFF, 0x01, 0xEB,
-  0x49, 0xD5, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
-  0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0xC8, 0x28,
-  0xFF, 0x09, 0x31, 0xFF, 0xE9, 0x28, 0xFF, 0x85, 0x28, 0xFF, 0xE4, 0x40, 0xFF,
-  0x45, 0x7A, 0xFF, 0x48, 0xD4, 0xFF, 0x27, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03,
-  0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x24, 0xFD, 0xFF, 0xE3, 0xF4,
-  0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xA2, 0xF4, 0xFF,
-  0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0xE8,
-  0xDC, 0xFF, 0x44, 0x72, 0xFF, 0xC5, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xA8, 0x30,
-  0xFF, 0xE8, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x30, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xAB, 0x41, 0xD9, 0x00, 0x00, 0x00, 0x79,
-  0xFE, 0x05, 0x4A, 0xED, 0xFD, 0x05, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC,
-  0xFF, 0xE2, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x06, 0xED, 0xFF, 0x4F, 0xFE, 0x79,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-  0x7A, 0xE6, 0xF4, 0xFF, 0x04, 0xF5, 0xFF, 0x03, 0xFD, 0xFF,
-  0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0x4A, 0xED, 0xFF, 0xDB,
-  0xFE, 0x07, 0xFF, 0xFF, 0x03, 0xAA, 0x41, 0xDD, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF,
-  0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0xE7, 0x38, 0xFF,
-  0xE4, 0x40, 0xFF, 0x23, 0x7A, 0xFF, 0xA9, 0xDC, 0xFF, 0x46, 0xFD, 0xFF, 0xC2,
-  0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x24, 0xFD,
-  0xFF, 0xE3, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x24, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xA3, 0xFC, 0xFF, 0x05,
-  0xFD, 0xFF, 0xE8, 0xE4, 0xFF, 0xE6, 0x8A, 0xFF, 0xA2, 0x30, 0xFF, 0x08, 0x31,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xA8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x49,
-  0x39, 0xE4, 0xFF, 0xFF, 0x01, 0xF7, 0xFF, 0x04, 0x6B, 0xED, 0xDC, 0x05, 0xFD,
-  0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x04, 0xFD, 0xFF,
-  0xE6, 0xF4, 0xFF, 0x0E, 0xFE, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xEE, 0xFD, 0x8C, 0x06, 0xF5, 0xFF, 0x04, 0xF5, 0xFF,
-  0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE5, 0xF4, 0xFF, 0x8C,
-  0xED, 0xE1, 0xBA, 0xFE, 0x06, 0xFF, 0xBD, 0x04, 0x69, 0x39, 0xE5, 0xC8, 0x30,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xA7, 0x30, 0xFF, 0xC6, 0x38, 0xFF,
-  0xC3, 0x48, 0xFF, 0x85, 0x8A, 0xFF, 0x29, 0xED, 0xFF, 0x04, 0xED, 0xFF, 0x02,
-  0xF5, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC2, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF,
-  0x24, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4,
-  0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0xC9, 0xE4, 0xFF, 0xE6, 0x9A, 0xFF, 0xC3, 0x40,
-  0xFF, 0xE7, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x30, 0xFF, 0x08, 0x31, 0xED, 0xFF, 0xBD, 0x04, 0xFF, 0xFF, 0x02, 0xAC, 0xF5,
-  0xB8, 0xE5, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE5, 0xF4, 0xFF, 0xED, 0xFD, 0x9E, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xFD, 0x99,
-  0xE6, 0xF4, 0xFF, 0x04, 0xF5, 0xFF, 0x03, 0xF5, 0xFF, 0x02, 0xFD, 0xFF, 0x03,
-  0xFD, 0xFF, 0xE5, 0xF4, 0xFF, 0xAD, 0xF5, 0xC5, 0xBA, 0xFE, 0x06, 0xFB, 0xDE,
-  0x08, 0x28, 0x39, 0xEB, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE7, 0x28,
-  0xFF, 0xC7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30,
-  0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xAA, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xCA, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xA6, 0x28, 0xFF,
-  0xA6, 0x38, 0xFF, 0xA3, 0x40, 0xFF, 0xA6, 0x9A, 0xFF, 0xEA, 0xEC, 0xFF, 0xC3,
-  0xEC, 0xFF, 0x42, 0xFD, 0xFF, 0x43, 0xFD, 0xFF, 0xE2, 0xF4, 0xFF, 0xC3, 0xFC,
-  0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x04, 0xFD, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE2, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xA4,
-  0xF4, 0xFF, 0x07, 0xFD, 0xFF, 0xC9, 0xE4, 0xFF, 0xA5, 0x92, 0xFF, 0xC2, 0x48,
-  0xFF, 0x86, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xA7, 0x20, 0xFF, 0x09, 0x31, 0xFF, 0xA8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xE7, 0x30, 0xF1, 0xFB, 0xDE,
-  0x08, 0xFF, 0xFF, 0x01, 0xED, 0xF5, 0x9B, 0xE5, 0xF4, 0xFF, 0x04, 0xFD, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE5, 0xF4, 0xFF, 0xCD,
-  0xFD, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xCD, 0xFD, 0xA8, 0xE6, 0xF4, 0xFF, 0x04, 0xF5, 0xFF, 0x03, 0xF5, 0xFF, 0x02,
-  0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0xED, 0xF5, 0xB0, 0x79, 0xFE,
-  0x05, 0x1C, 0xE7, 0x09, 0x07, 0x31, 0xF1, 0xC7, 0x30, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xAA, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xCA, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE7, 0x30, 0xFF, 0xC3, 0x48, 0xFF, 0xE8, 0xA2, 0xFF, 0xA9,
-  0xEC, 0xFF, 0xC5, 0xF4, 0xFF, 0x23, 0xFD, 0xFF, 0xE1, 0xFC, 0xFF, 0xC2, 0xF4,
-  0xFF, 0x24, 0xFD, 0xFF, 0x24, 0xFD, 0xFF, 0xA2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0x03, 0xFD, 0xFF, 0xA2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x02,
-  0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x06, 0xFD, 0xFF, 0xA8, 0xE4, 0xFF, 0xC5, 0x9A,
-  0xFF, 0xA2, 0x40, 0xFF, 0xC6, 0x38, 0xFF, 0xE9, 0x30, 0xFF, 0xCA, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0x08, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0x2A,
-  0x39, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30,
-  0xFF, 0xE7, 0x28, 0xF3, 0x5A, 0xCE, 0x18, 0xFF, 0xFF, 0x01, 0x0E, 0xFE, 0x8A,
-  0xE6, 0xF4, 0xFF, 0x05, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04,
-  0xFD, 0xFF, 0xE5, 0xF4, 0xFF, 0xAD, 0xF5, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xFD, 0xB0, 0xE6, 0xF4, 0xFF, 0x04,
-  0xF5, 0xFF, 0xE3, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x06, 0xF5,
-  0xFF, 0x0E, 0xFE, 0x9F, 0xF7, 0xFF, 0x04, 0xFB, 0xDE, 0x0F, 0x07, 0x31, 0xF5,
-  0xA7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xAA, 0x28,
-  0xFF, 0xAA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xAA, 0x28,
-  0xFF, 0xAA, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xCA,
-  0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
-  0xA9, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xC3, 0x38, 0xFF, 0xE7, 0x9A, 0xFF, 0xAA,
-  0xEC, 0xFF, 0xC6, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02,
-  0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0x06, 0xF5, 0xFF, 0xA8, 0xE4, 0xFF, 0x44, 0x82,
-  0xFF, 0xA2, 0x40, 0xFF, 0xC6, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xA9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE7, 0x28, 0xF5, 0x39, 0xC6, 0x28, 0xFF, 0xFF, 0x01,
-  0x2E, 0xFE, 0x7D, 0x06, 0xF5, 0xFF, 0x05, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xF4, 0xFF, 0xAC, 0xF5, 0xC3, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD,
-  0xFD, 0xB4, 0xE6, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0xEE, 0xF5, 0x97, 0xF7, 0xFF, 0x04,
-  0xDB, 0xDE, 0x14, 0xE7, 0x28, 0xF6, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xE7,
-  0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x28,
-  0xFF, 0xCA, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF,
-  0xE7, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xA7, 0x30, 0xFF, 0x82, 0x40, 0xFF, 0xC6,
-  0x9A, 0xFF, 0xA8, 0xEC, 0xFF, 0x06, 0xFD, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0x02, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2,
-  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x05, 0xED, 0xFF, 0x89, 0xD4,
-  0xFF, 0x45, 0x82, 0xFF, 0xA3, 0x38, 0xFF, 0xC6, 0x38, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA9,
-  0x30, 0xFF, 0xAA, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xE7, 0x20, 0xF6,
-  0x1A, 0xBE, 0x31, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x76, 0x06, 0xF5, 0xFF, 0xE4,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xF5,
-  0xFF, 0xAB, 0xF5, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xAD, 0xFD, 0xB6, 0xE6, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0x06, 0xF5, 0xFF, 0xEE, 0xFD, 0x94,
-  0xF5, 0xFF, 0x03, 0x7B, 0xDE, 0x15, 0xE7, 0x28, 0xF6, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8,
-  0x30, 0xFF, 0xE7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xCA, 0x28, 0xFF, 0xAA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0x63, 0x30, 0xFF, 0x45,
-  0x8A, 0xFF, 0x68, 0xDC, 0xFF, 0x26, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC,
-  0xFF, 0x04, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0x44, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC3, 0xF4, 0xFF, 0xE6, 0xEC,
-  0xFF, 0x2A, 0xE5, 0xFF, 0xC3, 0x71, 0xFF, 0x62, 0x38, 0xFF, 0xE8, 0x38, 0xFF,
-  0xA9, 0x28, 0xFF, 0x29, 0x29, 0xFF, 0xC8, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0xC7,
-  0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xAA, 0x30, 0xFF, 0xA9, 0x30,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xE9, 0x28, 0xFF, 0xC7, 0x20, 0xF6, 0xFA, 0xBD, 0x33, 0x00, 0x00, 0x00, 0x2F,
-  0xFE, 0x74, 0x06, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xF5, 0xFF, 0xCB, 0xF5, 0xCA, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xFD, 0xB4, 0xE6, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF,
-  0xE6, 0xF4, 0xFF, 0x0E, 0xFE, 0x96, 0xF7, 0xFF, 0x04, 0xDC, 0xDE, 0x14, 0xE7,
-  0x28, 0xF6, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xE7, 0x28, 0xFF, 0xE7, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x28, 0xFF,
+  0xFF, 0xC9, 0x28, 0xFF, 0x9D, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81,
+  0xC8, 0x30, 0xFF, 0x01, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x82, 0xC8, 0x28,
+  0xFF, 0x0A, 0x6E, 0x62, 0xB9, 0x00, 0x00, 0x00, 0x18, 0xFF, 0x1A, 0x08, 0xED,
+  0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF,
+  0xE4, 0xF4, 0xFF, 0x08, 0xE5, 0xFF, 0x92, 0xFE, 0x4D, 0x83, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x03, 0x71, 0xFE, 0x50, 0x07, 0xED, 0xFF, 0xE4, 0xF4,
+  0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x04, 0xE4, 0xFC, 0xFF, 0x08,
+  0xED, 0xFF, 0x17, 0xF7, 0x12, 0x00, 0x00, 0x00, 0x6D, 0x5A, 0xCA, 0xA0, 0xC8,
+  0x28, 0xFF, 0x85, 0xC9, 0x28, 0xFF, 0x02, 0xCA, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
+  0xE9, 0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x86, 0xC9, 0x28, 0xFF, 0x00, 0xE9,
+  0x28, 0xFF, 0x82, 0xE8, 0x20, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x0D, 0xC8, 0x20, 0xFF,
+  0x2A, 0x31, 0xFF, 0xCA, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8,
+  0x28, 0xFF, 0xC7, 0x30, 0xFF, 0x84, 0x38, 0xFF, 0x63, 0x69, 0xFF, 0xAB, 0xE4,
+  0xFF, 0x06, 0xF5, 0xFF, 0xA1, 0xF4, 0xFF, 0x23, 0xFD, 0xFF, 0xC1, 0xF4, 0xFF,
+  0x81, 0x03, 0xFD, 0xFF, 0x01, 0x04, 0xFD, 0xFF, 0xA2, 0xFC, 0xFF, 0x81, 0x03,
+  0xFD, 0xFF, 0x0A, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC1, 0xFC, 0xFF, 0x03,
+  0xFD, 0xFF, 0x25, 0xF5, 0xFF, 0xC9, 0xD4, 0xFF, 0x23, 0x51, 0xFF, 0xC7, 0x40,
+  0xFF, 0xC7, 0x38, 0xFF, 0x87, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0x9F, 0xC8, 0x28,
+  0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x00, 0xE8, 0x28, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x0B, 0xC8, 0x30, 0xFF, 0x0D, 0x52, 0xCC, 0x00, 0x00,
+  0x00, 0xD6, 0xFE, 0x07, 0x09, 0xED, 0xFF, 0x04, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF,
+  0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x07, 0xED, 0xFF, 0x70,
+  0xFE, 0x64, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x0A, 0x50, 0xFE,
+  0x68, 0x07, 0xF5, 0xFF, 0xE4, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF,
+  0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x29, 0xED, 0xFF, 0x18, 0xFF, 0x09, 0xFF,
+  0xFF, 0x01, 0xEB, 0x49, 0xD5, 0xA2, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x85, 0xE8, 0x28, 0xFF, 0x00,
+  0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x00, 0xE9, 0x28, 0xFF, 0x82, 0xE8,
+  0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x81, 0xC8, 0x28,
+  0xFF, 0x00, 0xE8, 0x28, 0xFF, 0x82, 0xE9, 0x28, 0xFF, 0x19, 0xA8, 0x20, 0xFF,
+  0xC8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xE9, 0x28, 0xFF, 0x85, 0x28, 0xFF, 0xE4,
+  0x40, 0xFF, 0x45, 0x7A, 0xFF, 0x48, 0xD4, 0xFF, 0x27, 0xFD, 0xFF, 0xE3, 0xFC,
+  0xFF, 0x03, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x24, 0xFD, 0xFF,
+  0xE3, 0xF4, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xA2,
+  0xF4, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x05, 0xF5,
+  0xFF, 0xE8, 0xDC, 0xFF, 0x44, 0x72, 0xFF, 0xC5, 0x30, 0xFF, 0x81, 0xA8, 0x30,
+  0xFF, 0x02, 0xE8, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0x9F, 0xC8,
+  0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x86, 0xC8, 0x28, 0xFF, 0x06, 0xC8, 0x30,
+  0xFF, 0xAB, 0x41, 0xD9, 0x00, 0x00, 0x00, 0x79, 0xFE, 0x05, 0x4A, 0xED, 0xFD,
+  0x05, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x02, 0xE4, 0xFC,
+  0xFF, 0x06, 0xED, 0xFF, 0x4F, 0xFE, 0x79, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00,
+  0x00, 0x00, 0x0A, 0x0F, 0xFE, 0x7A, 0xE6, 0xF4, 0xFF, 0x04, 0xF5, 0xFF, 0x03,
+  0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0x4A, 0xED,
+  0xFF, 0xDB, 0xFE, 0x07, 0xFF, 0xFF, 0x03, 0xAA, 0x41, 0xDD, 0xA0, 0xC8, 0x28,
+  0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x84, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF,
+  0x86, 0xE8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x02,
+  0xE7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x81, 0xA9, 0x30, 0xFF,
+  0x03, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
+  0x81, 0xC9, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x07,
+  0xA7, 0x28, 0xFF, 0xE7, 0x38, 0xFF, 0xE4, 0x40, 0xFF, 0x23, 0x7A, 0xFF, 0xA9,
+  0xDC, 0xFF, 0x46, 0xFD, 0xFF, 0xC2, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xC2,
+  0xFC, 0xFF, 0x0F, 0x24, 0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x24,
+  0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD,
+  0xFF, 0xA3, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0xE8, 0xE4, 0xFF, 0xE6, 0x8A, 0xFF,
+  0xA2, 0x30, 0xFF, 0x08, 0x31, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x81,
+  0xC8, 0x30, 0xFF, 0x00, 0xA8, 0x30, 0xFF, 0xA7, 0xC8, 0x28, 0xFF, 0x0B, 0xC8,
+  0x30, 0xFF, 0x49, 0x39, 0xE4, 0xFF, 0xFF, 0x01, 0xF7, 0xFF, 0x04, 0x6B, 0xED,
+  0xDC, 0x05, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
+  0x04, 0xFD, 0xFF, 0xE6, 0xF4, 0xFF, 0x0E, 0xFE, 0x8D, 0x83, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x0B, 0xEE, 0xFD, 0x8C, 0x06, 0xF5, 0xFF, 0x04, 0xF5,
+  0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE5, 0xF4, 0xFF,
+  0x8C, 0xED, 0xE1, 0xBA, 0xFE, 0x06, 0xFF, 0xBD, 0x04, 0x69, 0x39, 0xE5, 0xC8,
+  0x30, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x01, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC7, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x01,
+  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x03, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30,
+  0xFF, 0x84, 0xC8, 0x30, 0xFF, 0x82, 0xA9, 0x30, 0xFF, 0x12, 0xC8, 0x30, 0xFF,
+  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xC9,
+  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xA7, 0x30, 0xFF, 0xC6, 0x38,
+  0xFF, 0xC3, 0x48, 0xFF, 0x85, 0x8A, 0xFF, 0x29, 0xED, 0xFF, 0x04, 0xED, 0xFF,
+  0x02, 0xF5, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC2,
+  0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x02, 0x04, 0xFD, 0xFF, 0x24, 0xFD, 0xFF,
+  0xE3, 0xFC, 0xFF, 0x82, 0xE4, 0xFC, 0xFF, 0x04, 0xE6, 0xF4, 0xFF, 0xC9, 0xE4,
+  0xFF, 0xE6, 0x9A, 0xFF, 0xC3, 0x40, 0xFF, 0xE7, 0x30, 0xFF, 0x82, 0xE8, 0x28,
+  0xFF, 0x02, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA2, 0xC8,
+  0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x83, 0xC8, 0x28, 0xFF, 0x06, 0xC8, 0x30,
+  0xFF, 0x08, 0x31, 0xED, 0xFF, 0xBD, 0x04, 0xFF, 0xFF, 0x02, 0xAC, 0xF5, 0xB8,
+  0xE5, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x02, 0x04, 0xFD,
+  0xFF, 0xE5, 0xF4, 0xFF, 0xED, 0xFD, 0x9E, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00,
+  0x00, 0x00, 0x0B, 0xEE, 0xFD, 0x99, 0xE6, 0xF4, 0xFF, 0x04, 0xF5, 0xFF, 0x03,
+  0xF5, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE5, 0xF4, 0xFF, 0xAD, 0xF5,
+  0xC5, 0xBA, 0xFE, 0x06, 0xFB, 0xDE, 0x08, 0x28, 0x39, 0xEB, 0xC8, 0x30, 0xFF,
+  0xA3, 0xC8, 0x28, 0xFF, 0x02, 0xE7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC8, 0x28,
+  0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x83, 0xC8, 0x30, 0xFF, 0x03,
+  0xC9, 0x30, 0xFF, 0xAA, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0x81,
+  0xC8, 0x28, 0xFF, 0x01, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x81, 0xCA, 0x28,
+  0xFF, 0x19, 0xE8, 0x30, 0xFF, 0xA6, 0x28, 0xFF, 0xA6, 0x38, 0xFF, 0xA3, 0x40,
+  0xFF, 0xA6, 0x9A, 0xFF, 0xEA, 0xEC, 0xFF, 0xC3, 0xEC, 0xFF, 0x42, 0xFD, 0xFF,
+  0x43, 0xFD, 0xFF, 0xE2, 0xF4, 0xFF, 0xC3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3,
+  0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xF4,
+  0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xA4, 0xF4, 0xFF, 0x07, 0xFD, 0xFF,
+  0xC9, 0xE4, 0xFF, 0xA5, 0x92, 0xFF, 0xC2, 0x48, 0xFF, 0x86, 0x30, 0xFF, 0xE9,
+  0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x03, 0xA7, 0x20, 0xFF, 0x09, 0x31, 0xFF,
+  0xA8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xA1, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28,
+  0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x06, 0xC8, 0x30, 0xFF, 0xE7, 0x30, 0xF1, 0xFB,
+  0xDE, 0x08, 0xFF, 0xFF, 0x01, 0xED, 0xF5, 0x9B, 0xE5, 0xF4, 0xFF, 0x04, 0xFD,
+  0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x02, 0x04, 0xFD, 0xFF, 0xE5, 0xF4, 0xFF, 0xCD,
+  0xFD, 0xAD, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x0B, 0xCD, 0xFD,
+  0xA8, 0xE6, 0xF4, 0xFF, 0x04, 0xF5, 0xFF, 0x03, 0xF5, 0xFF, 0x02, 0xFD, 0xFF,
+  0xE3, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0xED, 0xF5, 0xB0, 0x79, 0xFE, 0x05, 0x1C,
+  0xE7, 0x09, 0x07, 0x31, 0xF1, 0xC7, 0x30, 0xFF, 0x9E, 0xC8, 0x28, 0xFF, 0x00,
+  0xC9, 0x28, 0xFF, 0x81, 0xCA, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x82, 0xC8,
+  0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x04, 0xE7, 0x28,
+  0xFF, 0xC8, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xAA, 0x28, 0xFF, 0xCA, 0x28, 0xFF,
+  0x83, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x81,
+  0xCA, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x0C, 0xE7,
+  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xC8, 0x28,
+  0xFF, 0xE7, 0x30, 0xFF, 0xC3, 0x48, 0xFF, 0xE8, 0xA2, 0xFF, 0xA9, 0xEC, 0xFF,
+  0xC5, 0xF4, 0xFF, 0x23, 0xFD, 0xFF, 0xE1, 0xFC, 0xFF, 0xC2, 0xF4, 0xFF, 0x81,
+  0x24, 0xFD, 0xFF, 0x04, 0xA2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
+  0xA2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0x02, 0xFD, 0xFF, 0x0E, 0xE3, 0xFC,
+  0xFF, 0x06, 0xFD, 0xFF, 0xA8, 0xE4, 0xFF, 0xC5, 0x9A, 0xFF, 0xA2, 0x40, 0xFF,
+  0xC6, 0x38, 0xFF, 0xE9, 0x30, 0xFF, 0xCA, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x08,
+  0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0x2A, 0x39, 0xFF, 0xA8, 0x28,
+  0xFF, 0xC9, 0x28, 0xFF, 0x9E, 0xC8, 0x28, 0xFF, 0x02, 0xC8, 0x30, 0xFF, 0xC8,
+  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x00, 0xC8, 0x30, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x06, 0xC8, 0x30, 0xFF, 0xE7, 0x28, 0xF3, 0x5A, 0xCE,
+  0x18, 0xFF, 0xFF, 0x01, 0x0E, 0xFE, 0x8A, 0xE6, 0xF4, 0xFF, 0x05, 0xFD, 0xFF,
+  0x81, 0xE3, 0xFC, 0xFF, 0x02, 0x04, 0xFD, 0xFF, 0xE5, 0xF4, 0xFF, 0xAD, 0xF5,
+  0xBB, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x03, 0xCD, 0xFD, 0xB0,
+  0xE6, 0xF4, 0xFF, 0x04, 0xF5, 0xFF, 0xE3, 0xF4, 0xFF, 0x81, 0xE3, 0xFC, 0xFF,
+  0x05, 0x06, 0xF5, 0xFF, 0x0E, 0xFE, 0x9F, 0xF7, 0xFF, 0x04, 0xFB, 0xDE, 0x0F,
+  0x07, 0x31, 0xF5, 0xA7, 0x28, 0xFF, 0x9E, 0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x28,
+  0xFF, 0x81, 0xAA, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF,
+  0x81, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x04, 0xC7, 0x28, 0xFF, 0xC8,
+  0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xAA, 0x28, 0xFF, 0xAA, 0x30, 0xFF, 0x83, 0xC9,
+  0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x81, 0xCA, 0x28, 0xFF, 0x00, 0xC9, 0x28,
+  0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x1D, 0xE7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
+  0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xC3, 0x38, 0xFF, 0xE7, 0x9A,
+  0xFF, 0xAA, 0xEC, 0xFF, 0xC6, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x02, 0xFD, 0xFF,
+  0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3,
+  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC,
+  0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0x06, 0xF5, 0xFF, 0xA8, 0xE4, 0xFF,
+  0x44, 0x82, 0xFF, 0xA2, 0x40, 0xFF, 0xC6, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xA9,
+  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x02, 0xE9, 0x28, 0xFF,
+  0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x9E, 0xC8, 0x28,
+  0xFF, 0x02, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0x81, 0xC9,
+  0x28, 0xFF, 0x00, 0xC8, 0x30, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x0A, 0xE7, 0x28,
+  0xF5, 0x39, 0xC6, 0x28, 0xFF, 0xFF, 0x01, 0x2E, 0xFE, 0x7D, 0x06, 0xF5, 0xFF,
+  0x05, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4,
+  0xF4, 0xFF, 0xAC, 0xF5, 0xC3, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0x02, 0xAD, 0xFD, 0xB4, 0xE6, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x81, 0xE3, 0xFC,
+  0xFF, 0x05, 0xE4, 0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0xEE, 0xF5, 0x97, 0xF7, 0xFF,
+  0x04, 0xDB, 0xDE, 0x14, 0xE7, 0x28, 0xF6, 0x9F, 0xC8, 0x28, 0xFF, 0x83, 0xC9,
+  0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x83, 0xC8, 0x28,
+  0xFF, 0x85, 0xC9, 0x28, 0xFF, 0x01, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0x81,
+  0xE7, 0x28, 0xFF, 0x05, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x28, 0xFF,
+  0xCA, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x81, 0xE7, 0x28, 0xFF,
+  0x07, 0xE9, 0x30, 0xFF, 0xA7, 0x30, 0xFF, 0x82, 0x40, 0xFF, 0xC6, 0x9A, 0xFF,
+  0xA8, 0xEC, 0xFF, 0x06, 0xFD, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x81,
+  0x02, 0xFD, 0xFF, 0x01, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xE3, 0xFC,
+  0xFF, 0x02, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x81, 0x03,
+  0xFD, 0xFF, 0x0B, 0x05, 0xED, 0xFF, 0x89, 0xD4, 0xFF, 0x45, 0x82, 0xFF, 0xA3,
+  0x38, 0xFF, 0xC6, 0x38, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0xE8, 0x28,
+  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xAA, 0x30, 0xFF,
+  0x82, 0xC9, 0x28, 0xFF, 0xA1, 0xC8, 0x28, 0xFF, 0x83, 0xC9, 0x28, 0xFF, 0x81,
+  0xC8, 0x30, 0xFF, 0x06, 0xC9, 0x30, 0xFF, 0xE7, 0x20, 0xF6, 0x1A, 0xBE, 0x31,
+  0x00, 0x00, 0x00, 0x2F, 0xFE, 0x76, 0x06, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0x81,
+  0xE3, 0xFC, 0xFF, 0x02, 0xE4, 0xFC, 0xFF, 0x04, 0xF5, 0xFF, 0xAB, 0xF5, 0xC7,
+  0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x02, 0xAD, 0xFD, 0xB6, 0xE6,
+  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x05, 0x05, 0xFD, 0xFF,
+  0x06, 0xF5, 0xFF, 0xEE, 0xFD, 0x94, 0xF5, 0xFF, 0x03, 0x7B, 0xDE, 0x15, 0xE7,
+  0x28, 0xF6, 0xAF, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x01, 0xC9, 0x30,
+  0xFF, 0xC8, 0x30, 0xFF, 0x81, 0xE7, 0x28, 0xFF, 0x10, 0xE8, 0x28, 0xFF, 0xC9,
+  0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xAA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28,
+  0xFF, 0xE7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0x63, 0x30, 0xFF,
+  0x45, 0x8A, 0xFF, 0x68, 0xDC, 0xFF, 0x26, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4,
+  0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x01,
+  0x44, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0x82, 0xE3, 0xFC, 0xFF, 0x10, 0x03, 0xFD,
+  0xFF, 0xC3, 0xF4, 0xFF, 0xE6, 0xEC, 0xFF, 0x2A, 0xE5, 0xFF, 0xC3, 0x71, 0xFF,
+  0x62, 0x38, 0xFF, 0xE8, 0x38, 0xFF, 0xA9, 0x28, 0xFF, 0x29, 0x29, 0xFF, 0xC8,
+  0x20, 0xFF, 0xE7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA9, 0x30,
+  0xFF, 0xAA, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xA3, 0xC8, 0x28,
+  0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x07, 0xE9, 0x28, 0xFF,
+  0xC7, 0x20, 0xF6, 0xFA, 0xBD, 0x33, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x74, 0x06,
+  0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x01,
+  0x04, 0xF5, 0xFF, 0xCB, 0xF5, 0xCA, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00,
+  0x00, 0x02, 0xAD, 0xFD, 0xB4, 0xE6, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x81, 0xE3,
+  0xFC, 0xFF, 0x05, 0x04, 0xFD, 0xFF, 0xE6, 0xF4, 0xFF, 0x0E, 0xFE, 0x96, 0xF7,
+  0xFF, 0x04, 0xDC, 0xDE, 0x14, 0xE7, 0x28, 0xF6, 0xB0, 0xC8, 0x28, 0xFF, 0x81,
+  0xC9, 0x28, 0xFF, 0x01, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0x81, 0xE7, 0x28,
+  0xFF, 0x00, 0xE8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x0C, 0xA9, 0x28, 0xFF,
   0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE7, 0x30, 0xFF, 0xA5,
   0x30, 0xFF, 0x84, 0x61, 0xFF, 0x68, 0xD4, 0xFF, 0x06, 0xF5, 0xFF, 0x25, 0xFD,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x04,
-  0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x25, 0xFD, 0xFF, 0x07, 0xF5,
-  0xFF, 0x8A, 0xD4, 0xFF, 0x21, 0x59, 0xFF, 0xA3, 0x40, 0xFF, 0xC7, 0x40, 0xFF,
-  0x88, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0x09, 0x29, 0xFF, 0xE7,
-  0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30,
-  0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xC7, 0x20, 0xF6, 0x1A, 0xC6, 0x31, 0x00,
-  0x00, 0x00, 0x2F, 0xFE, 0x75, 0x06, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xF5, 0xFF, 0xCB, 0xF5, 0xC8,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xFD,
-  0xAE, 0xE6, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
-  0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE6, 0xF4, 0xFF, 0x0E, 0xFE, 0x9E, 0xF7,
-  0xFF, 0x04, 0x7B, 0xDE, 0x10, 0xE8, 0x28, 0xF4, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC7, 0x28,
-  0xFF, 0xE7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE7, 0x38, 0xFF, 0x82, 0x38, 0xFF, 0xA9, 0xAB, 0xFF, 0x27, 0xED,
-  0xFF, 0xE3, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC4, 0xFC, 0xFF,
-  0xC4, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x04,
-  0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x45, 0xFD,
-  0xFF, 0xA6, 0xE4, 0xFF, 0x49, 0xC4, 0xFF, 0x22, 0x59, 0xFF, 0xE6, 0x48, 0xFF,
-  0x86, 0x38, 0xFF, 0x88, 0x30, 0xFF, 0xCA, 0x30, 0xFF, 0xCA, 0x30, 0xFF, 0xE9,
-  0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE7,
-  0x20, 0xF5, 0x3A, 0xC6, 0x29, 0x00, 0x00, 0x00, 0x2E, 0xFE, 0x7A, 0x06, 0xF5,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0x05, 0xF5, 0xFF, 0xCB, 0xF5, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xCE, 0xF5, 0xA6, 0xE6, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF,
-  0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE5, 0xF4, 0xFF, 0xED,
-  0xFD, 0xAD, 0x79, 0xFE, 0x05, 0x3C, 0xE7, 0x0A, 0x08, 0x29, 0xEF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA5, 0x38, 0xFF, 0x82, 0x61, 0xFF, 0xEA, 0xE4,
-  0xFF, 0xE5, 0xEC, 0xFF, 0x43, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF,
-  0xE5, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE1, 0xFC, 0xFF, 0x01, 0xFD, 0xFF, 0x03,
-  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xA6, 0xE4, 0xFF, 0x6B, 0xCC, 0xFF, 0x23, 0x51, 0xFF,
-  0x85, 0x38, 0xFF, 0x87, 0x30, 0xFF, 0x88, 0x30, 0xFF, 0xCA, 0x30, 0xFF, 0xCA,
-  0x30, 0xFF, 0x89, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE8, 0x28, 0xF3, 0x7B, 0xCE, 0x1A, 0x00, 0x00, 0x00, 0x0E, 0xFE,
-  0x86, 0x06, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0xCC, 0xF5, 0xB8, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xFD, 0x97,
-  0x06, 0xF5, 0xFF, 0x04, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x04,
-  0xFD, 0xFF, 0xE5, 0xFC, 0xFF, 0xAC, 0xFD, 0xC2, 0xDB, 0xFE, 0x07, 0x1C, 0xE7,
-  0x09, 0x29, 0x31, 0xE9, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x08,
-  0x29, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC4, 0x40,
-  0xFF, 0xA8, 0xB3, 0xFF, 0xE7, 0xEC, 0xFF, 0x04, 0xFD, 0xFF, 0x02, 0xFD, 0xFF,
-  0x02, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE1,
-  0xFC, 0xFF, 0x01, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD,
-  0xFF, 0xE5, 0xFC, 0xFF, 0xC7, 0xF4, 0xFF, 0xA7, 0xBB, 0xFF, 0x03, 0x51, 0xFF,
-  0x85, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9,
-  0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x28, 0x29, 0xF2, 0x7C, 0xCE,
-  0x0A, 0xFF, 0xFF, 0x01, 0xED, 0xF5, 0x97, 0x06, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0xED,
-  0xF5, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xCE, 0xFD, 0x8B, 0x06, 0xF5, 0xFF, 0xE3, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x03,
-  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0x6A, 0xF5, 0xE0, 0x18, 0xFF,
-  0x09, 0x7F, 0xCE, 0x05, 0x6A, 0x39, 0xE2, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC7,
-  0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x38,
-  0xFF, 0xA5, 0x61, 0xFF, 0x0B, 0xED, 0xFF, 0xE6, 0xF4, 0xFF,
-  0x05, 0xFD, 0xFF, 0xA2, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x24, 0xFD, 0xFF, 0xC3,
-  0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x01, 0xFD, 0xFF, 0x03, 0xFD,
-  0xFF, 0xE3, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0xA5, 0xE4, 0xFF, 0x2A, 0xCC, 0xFF,
-  0x81, 0x48, 0xFF, 0xC6, 0x38, 0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x20, 0xFF, 0x09, 0x31, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x30,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0x49, 0x31, 0xEF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x01, 0xAC, 0xF5, 0xB4,
-  0x05, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4,
-  0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0xED, 0xF5, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF5, 0x7B, 0x07, 0xF5, 0xFF, 0x03,
-  0xF5, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC,
-  0xFF, 0x49, 0xF5, 0xFF, 0x39, 0xFF, 0x0A, 0xFF, 0xFF, 0x03, 0x8A, 0x39, 0xD9,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x20,
-  0xFF, 0xE7, 0x28, 0xFF, 0xC4, 0x30, 0xFF, 0x66, 0x82, 0xFF, 0x08, 0xF5, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3,
-  0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x06, 0xED, 0xFF, 0x88, 0xD4, 0xFF,
-  0xE2, 0x58, 0xFF, 0xA6, 0x40, 0xFF, 0xA8, 0x30, 0xFF, 0xEA, 0x30, 0xFF, 0xC8,
-  0x20, 0xFF, 0x08, 0x29, 0xFF, 0xC7, 0x20, 0xFF, 0xC7, 0x28, 0xFF, 0x08, 0x31,
-  0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE9, 0x30, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0x69, 0x39, 0xE7, 0xFF, 0xFF, 0x02, 0xF5, 0xFF, 0x03,
-  0x8B, 0xF5, 0xDA, 0x05, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x07, 0xF5, 0xFF, 0xEE, 0xF5, 0x8B, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-  0xF6, 0x67, 0x07, 0xED, 0xFF, 0x04, 0xF5, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD,
-  0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x08, 0xED, 0xFF, 0x57, 0xFF, 0x0B,
-  0xFF, 0xFF, 0x02, 0xEB, 0x49, 0xD1, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xC2, 0x30, 0xFF,
-  0x88, 0xAB, 0xFF, 0xE7, 0xF4, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC,
-  0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x06, 0xF5, 0xFF,
-  0xC9, 0xDC, 0xFF, 0x41, 0x59, 0xFF, 0xC5, 0x40, 0xFF, 0xC9, 0x30, 0xFF, 0xA8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xCA, 0x41, 0xDC,
-  0x00, 0x00, 0x00, 0xF7, 0xFF, 0x04, 0x29, 0xED, 0xFF, 0x05, 0xFD, 0xFF, 0xE4,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC4, 0xF4, 0xFF, 0x27, 0xED,
-  0xFF, 0x2F, 0xF6, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x71, 0xFE, 0x50, 0x08, 0xED, 0xFF, 0x04, 0xF5, 0xFF, 0xE2, 0xFC,
-  0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x07, 0xED, 0xFF,
-  0x17, 0xFF, 0x12, 0x00, 0x00, 0x00, 0x2C, 0x52, 0xC5, 0xE8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x20, 0xFF, 0xC6, 0x28, 0xFF,
-  0xE1, 0x40, 0xFF, 0x28, 0xBC, 0xFF, 0xE6, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE4, 0xF4, 0xFF, 0x08, 0xED, 0xFF, 0x07, 0x9B, 0xFF, 0xC3, 0x40, 0xFF, 0xC7,
-  0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9,
-  0x20, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xEA, 0x49, 0xCF, 0x00, 0x00, 0x00, 0xB5, 0xFE, 0x06, 0x28,
-  0xED, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0x28, 0xED, 0xFF, 0x51, 0xF6, 0x65, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xFE, 0x39, 0x09, 0xE5,
-  0xFF, 0x25, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
-  0x03, 0xFD, 0xFF, 0xE7, 0xEC, 0xFF, 0xD6, 0xFE, 0x2A, 0x00, 0x00, 0x00, 0xAD,
-  0x62, 0xB7, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xA9, 0x20, 0xFF, 0xC6, 0x30, 0xFF, 0x00, 0x41, 0xFF, 0xA9, 0xD4, 0xFF, 0xE6,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0x04, 0xF5, 0xFF, 0x2A, 0xED, 0xFF, 0x64, 0x59, 0xFF, 0xA6,
-  0x30, 0xFF, 0x07, 0x29, 0xFF, 0xE7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x28,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF,
-  0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xA9, 0x30, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0x4C, 0x5A, 0xBD, 0x00, 0x00, 0x00, 0xF5,
-  0xFE, 0x18, 0x07, 0xED, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0x09, 0xE5, 0xFF, 0x93, 0xFE, 0x4D,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFE,
-  0x1C, 0x0A, 0xDD, 0xFF, 0x25, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF,
-  0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC6, 0xEC, 0xFF, 0x94,
-  0xF6, 0x4A, 0x00, 0x00, 0x00, 0x4F, 0x7B, 0xA1, 0xE7, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC6, 0x30, 0xFF, 0x00,
-  0x49, 0xFF, 0xEA, 0xDC, 0xFF, 0xE5, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x26, 0xF5, 0xFF, 0x89,
-  0xD4, 0xFF, 0xC4, 0x40, 0xFF, 0xE8, 0x30, 0xFF, 0x07, 0x21, 0xFF, 0xE6, 0x20,
-  0xFF, 0xE7, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xA9, 0x30, 0xFF,
-  0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x30, 0xFF,
-  0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xED,
-  0x6A, 0xAA, 0x00, 0x00, 0x00, 0xB4, 0xFE, 0x35, 0xE7, 0xEC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xFD, 0xFF,
-  0x09, 0xDD, 0xFF, 0xD4, 0xFE, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xF7, 0xFE, 0x08, 0x2B, 0xDD, 0xFF, 0x05, 0xF5, 0xFF,
-  0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC6,
-  0xEC, 0xFF, 0x52, 0xF6, 0x6C, 0xFF, 0xFF, 0x02, 0x52, 0x9C, 0x78, 0xE7, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC6,
-  0x38, 0xFF, 0xE0, 0x48, 0xFF, 0x0B, 0xE5, 0xFF, 0xE6, 0xF4, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x07,
+  0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x81, 0xE2, 0xFC,
+  0xFF, 0x0F, 0x03, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xFD,
+  0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x25, 0xFD, 0xFF, 0x07, 0xF5, 0xFF,
+  0x8A, 0xD4, 0xFF, 0x21, 0x59, 0xFF, 0xA3, 0x40, 0xFF, 0xC7, 0x40, 0xFF, 0x88,
+  0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0x09, 0x29, 0xFF, 0x81, 0xE7,
+  0x28, 0xFF, 0x00, 0xC8, 0x30, 0xFF, 0x81, 0xA9, 0x30, 0xFF, 0x00, 0xC9, 0x28,
+  0xFF, 0x81, 0xE8, 0x28, 0xFF, 0xA2, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF,
+  0x81, 0xC8, 0x30, 0xFF, 0x07, 0xE9, 0x28, 0xFF, 0xC7, 0x20, 0xF6, 0x1A, 0xC6,
+  0x31, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x75, 0x06, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF,
+  0xE3, 0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x01, 0x04, 0xF5, 0xFF, 0xCB, 0xF5,
+  0xC8, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x0A, 0xAD, 0xFD, 0xAE,
+  0xE6, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x04,
+  0xFD, 0xFF, 0xE6, 0xF4, 0xFF, 0x0E, 0xFE, 0x9E, 0xF7, 0xFF, 0x04, 0x7B, 0xDE,
+  0x10, 0xE8, 0x28, 0xF4, 0xB0, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x06,
+  0xC8, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
+  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x07,
+  0xC8, 0x28, 0xFF, 0xE7, 0x38, 0xFF, 0x82, 0x38, 0xFF, 0xA9, 0xAB, 0xFF, 0x27,
+  0xED, 0xFF, 0xE3, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xC4,
+  0xFC, 0xFF, 0x03, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x04,
+  0xFD, 0xFF, 0x81, 0xC3, 0xFC, 0xFF, 0x07, 0x03, 0xFD, 0xFF, 0x45, 0xFD, 0xFF,
+  0xA6, 0xE4, 0xFF, 0x49, 0xC4, 0xFF, 0x22, 0x59, 0xFF, 0xE6, 0x48, 0xFF, 0x86,
+  0x38, 0xFF, 0x88, 0x30, 0xFF, 0x81, 0xCA, 0x30, 0xFF, 0x04, 0xE9, 0x28, 0xFF,
+  0xA7, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0x81,
+  0xC9, 0x30, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0xA2, 0xC8,
+  0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x07, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF,
+  0xE9, 0x28, 0xFF, 0xE7, 0x20, 0xF5, 0x3A, 0xC6, 0x29, 0x00, 0x00, 0x00, 0x2E,
+  0xFE, 0x7A, 0x06, 0xF5, 0xFF, 0x83, 0xE4, 0xFC, 0xFF, 0x01, 0x05, 0xF5, 0xFF,
+  0xCB, 0xF5, 0xC1, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x0B, 0xCE,
+  0xF5, 0xA6, 0xE6, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC,
+  0xFF, 0x04, 0xFD, 0xFF, 0xE5, 0xF4, 0xFF, 0xED, 0xFD, 0xAD, 0x79, 0xFE, 0x05,
+  0x3C, 0xE7, 0x0A, 0x08, 0x29, 0xEF, 0xC9, 0x28, 0xFF, 0xB0, 0xC8, 0x28, 0xFF,
+  0x81, 0xC9, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x02,
+  0xC8, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF,
+  0x0A, 0xA5, 0x38, 0xFF, 0x82, 0x61, 0xFF, 0xEA, 0xE4, 0xFF, 0xE5, 0xEC, 0xFF,
+  0x43, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE4,
+  0xFC, 0xFF, 0xE1, 0xFC, 0xFF, 0x01, 0xFD, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x00,
+  0xE3, 0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x05, 0xA6, 0xE4, 0xFF, 0x6B, 0xCC,
+  0xFF, 0x23, 0x51, 0xFF, 0x85, 0x38, 0xFF, 0x87, 0x30, 0xFF, 0x88, 0x30, 0xFF,
+  0x81, 0xCA, 0x30, 0xFF, 0x03, 0x89, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28,
+  0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x00, 0xC9, 0x30, 0xFF, 0x81,
+  0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0xA2, 0xC8, 0x28, 0xFF, 0x82, 0xC9,
+  0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x04, 0xE8, 0x28, 0xF3, 0x7B, 0xCE, 0x1A,
+  0x00, 0x00, 0x00, 0x0E, 0xFE, 0x86, 0x06, 0xF5, 0xFF, 0x81, 0xE4, 0xFC, 0xFF,
+  0x03, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0xCC, 0xF5, 0xB8,
+  0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x0B, 0xCE, 0xFD, 0x97, 0x06,
+  0xF5, 0xFF, 0x04, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD,
+  0xFF, 0xE5, 0xFC, 0xFF, 0xAC, 0xFD, 0xC2, 0xDB, 0xFE, 0x07, 0x1C, 0xE7, 0x09,
+  0x29, 0x31, 0xE9, 0xC9, 0x28, 0xFF, 0xB0, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x08, 0xC7, 0x28, 0xFF,
+  0x08, 0x29, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC4,
+  0x40, 0xFF, 0xA8, 0xB3, 0xFF, 0xE7, 0xEC, 0xFF, 0x04, 0xFD, 0xFF, 0x82, 0x02,
+  0xFD, 0xFF, 0x0C, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE1, 0xFC, 0xFF, 0x01,
+  0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE5, 0xFC,
+  0xFF, 0xC7, 0xF4, 0xFF, 0xA7, 0xBB, 0xFF, 0x03, 0x51, 0xFF, 0x85, 0x30, 0xFF,
+  0xC8, 0x30, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xA9, 0x28, 0xFF, 0x02, 0xC9,
+  0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x83,
+  0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x00, 0xE8,
+  0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28,
+  0xFF, 0x04, 0x28, 0x29, 0xF2, 0x7C, 0xCE, 0x0A, 0xFF, 0xFF, 0x01, 0xED, 0xF5,
+  0x97, 0x06, 0xF5, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x03, 0xE3, 0xFC, 0xFF, 0xE4,
+  0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0xED, 0xF5, 0xAC, 0x83, 0x00, 0x00, 0x00, 0x83,
+  0x00, 0x00, 0x00, 0x03, 0xCE, 0xFD, 0x8B, 0x06, 0xF5, 0xFF, 0xE3, 0xFC, 0xFF,
+  0x02, 0xFD, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x05, 0xE4, 0xFC, 0xFF, 0x6A, 0xF5,
+  0xE0, 0x18, 0xFF, 0x09, 0x7F, 0xCE, 0x05, 0x6A, 0x39, 0xE2, 0xC9, 0x28, 0xFF,
+  0xAF, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x83, 0xC8, 0x28, 0xFF, 0x1F,
+  0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xC8,
+  0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x38, 0xFF, 0xA5, 0x61, 0xFF, 0x0B, 0xED,
+  0xFF, 0xE6, 0xF4, 0xFF, 0x05, 0xFD, 0xFF, 0xA2, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF,
+  0x24, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x01,
+  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0xA5, 0xE4,
+  0xFF, 0x2A, 0xCC, 0xFF, 0x81, 0x48, 0xFF, 0xC6, 0x38, 0xFF, 0xA8, 0x28, 0xFF,
+  0xE8, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0x09, 0x31, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
+  0x28, 0xFF, 0xE9, 0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x85, 0xC9, 0x28, 0xFF,
+  0xA1, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x83,
+  0xC9, 0x28, 0xFF, 0x05, 0xC8, 0x28, 0xFF, 0x49, 0x31, 0xEF, 0xFF, 0xFF, 0x03,
+  0xFF, 0xFF, 0x01, 0xAC, 0xF5, 0xB4, 0x05, 0xF5, 0xFF, 0x81, 0xE4, 0xFC, 0xFF,
+  0x03, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0xED, 0xF5, 0x9E,
+  0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xF5, 0x7B, 0x07,
+  0xF5, 0xFF, 0x03, 0xF5, 0xFF, 0x02, 0xFD, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x05,
+  0xE4, 0xFC, 0xFF, 0x49, 0xF5, 0xFF, 0x39, 0xFF, 0x0A, 0xFF, 0xFF, 0x03, 0x8A,
+  0x39, 0xD9, 0xC9, 0x28, 0xFF, 0xAE, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF,
+  0x82, 0xC8, 0x28, 0xFF, 0x22, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30,
+  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE7, 0x28, 0xFF,
+  0xC4, 0x30, 0xFF, 0x66, 0x82, 0xFF, 0x08, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4,
+  0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC2, 0xFC,
+  0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
+  0x05, 0xF5, 0xFF, 0x06, 0xED, 0xFF, 0x88, 0xD4, 0xFF, 0xE2, 0x58, 0xFF, 0xA6,
+  0x40, 0xFF, 0xA8, 0x30, 0xFF, 0xEA, 0x30, 0xFF, 0xC8, 0x20, 0xFF, 0x08, 0x29,
+  0xFF, 0xC7, 0x20, 0xFF, 0xC7, 0x28, 0xFF, 0x08, 0x31, 0xFF, 0xC8, 0x28, 0xFF,
+  0xA8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0x84, 0xC9, 0x28, 0xFF, 0xA2, 0xC8, 0x28,
+  0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF,
+  0x05, 0xC8, 0x28, 0xFF, 0x69, 0x39, 0xE7, 0xFF, 0xFF, 0x02, 0xF5, 0xFF, 0x03,
+  0x8B, 0xF5, 0xDA, 0x05, 0xF5, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x03, 0xE3, 0xFC,
+  0xFF, 0xE4, 0xFC, 0xFF, 0x07, 0xF5, 0xFF, 0xEE, 0xF5, 0x8B, 0x83, 0x00, 0x00,
+  0x00, 0x83, 0x00, 0x00, 0x00, 0x03, 0x30, 0xF6, 0x67, 0x07, 0xED, 0xFF, 0x04,
+  0xF5, 0xFF, 0x02, 0xFD, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x04, 0xE3, 0xFC, 0xFF,
+  0x08, 0xED, 0xFF, 0x57, 0xFF, 0x0B, 0xFF, 0xFF, 0x02, 0xEB, 0x49, 0xD1, 0xAF,
+  0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC9,
+  0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x07, 0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
+  0xE9, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xC2, 0x30, 0xFF, 0x88, 0xAB, 0xFF, 0xE7,
+  0xF4, 0xFF, 0xC3, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x81, 0xC4, 0xFC, 0xFF,
+  0x00, 0xE3, 0xFC, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x05,
+  0x06, 0xF5, 0xFF, 0xC9, 0xDC, 0xFF, 0x41, 0x59, 0xFF, 0xC5, 0x40, 0xFF, 0xC9,
+  0x30, 0xFF, 0xA8, 0x28, 0xFF, 0x83, 0xE8, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF,
+  0x82, 0xC9, 0x28, 0xFF, 0x00, 0xE9, 0x28, 0xFF, 0x83, 0xE8, 0x28, 0xFF, 0x01,
+  0xC7, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x01, 0xE9, 0x28,
+  0xFF, 0xE8, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x06,
+  0xC8, 0x28, 0xFF, 0xCA, 0x41, 0xDC, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x04, 0x29,
+  0xED, 0xFF, 0x05, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x02,
+  0xC4, 0xF4, 0xFF, 0x27, 0xED, 0xFF, 0x2F, 0xF6, 0x79, 0x83, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x02, 0x71, 0xFE, 0x50, 0x08, 0xED, 0xFF, 0x04, 0xF5,
+  0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x06, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x07,
+  0xED, 0xFF, 0x17, 0xFF, 0x12, 0x00, 0x00, 0x00, 0x2C, 0x52, 0xC5, 0xE8, 0x28,
+  0xFF, 0xAE, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF,
+  0x81, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x05,
+  0xC9, 0x20, 0xFF, 0xC6, 0x28, 0xFF, 0xE1, 0x40, 0xFF, 0x28, 0xBC, 0xFF, 0xE6,
+  0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x02, 0xE4, 0xFC, 0xFF,
+  0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x07, 0xE3, 0xFC,
+  0xFF, 0xE4, 0xF4, 0xFF, 0x08, 0xED, 0xFF, 0x07, 0x9B, 0xFF, 0xC3, 0x40, 0xFF,
+  0xC7, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x83, 0xC8, 0x28, 0xFF,
+  0x81, 0xC8, 0x30, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x02, 0xE9, 0x28, 0xFF, 0xE9,
+  0x20, 0xFF, 0xE8, 0x20, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x00, 0xE7, 0x28, 0xFF,
+  0x81, 0xC8, 0x30, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x03, 0xE9, 0x28, 0xFF, 0xC9,
+  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81,
+  0xC9, 0x28, 0xFF, 0x06, 0xE8, 0x28, 0xFF, 0xEA, 0x49, 0xCF, 0x00, 0x00, 0x00,
+  0xB5, 0xFE, 0x06, 0x28, 0xED, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0x81,
+  0xE3, 0xFC, 0xFF, 0x02, 0xE4, 0xFC, 0xFF, 0x28, 0xED, 0xFF, 0x51, 0xF6, 0x65,
+  0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x0B, 0x93, 0xFE, 0x39, 0x09,
+  0xE5, 0xFF, 0x25, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC,
+  0xFF, 0x03, 0xFD, 0xFF, 0xE7, 0xEC, 0xFF, 0xD6, 0xFE, 0x2A, 0x00, 0x00, 0x00,
+  0xAD, 0x62, 0xB7, 0xE8, 0x28, 0xFF, 0xAE, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28,
+  0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF,
+  0x06, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x20, 0xFF, 0xC6, 0x30, 0xFF,
+  0x00, 0x41, 0xFF, 0xA9, 0xD4, 0xFF, 0xE6, 0xFC, 0xFF, 0x85, 0xE3, 0xFC, 0xFF,
+  0x81, 0xE2, 0xFC, 0xFF, 0x09, 0xE3, 0xFC, 0xFF, 0x04, 0xF5, 0xFF, 0x2A, 0xED,
+  0xFF, 0x64, 0x59, 0xFF, 0xA6, 0x30, 0xFF, 0x07, 0x29, 0xFF, 0xE7, 0x20, 0xFF,
+  0xE8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x83, 0xC9, 0x30, 0xFF,
+  0x82, 0xC9, 0x28, 0xFF, 0x01, 0xE9, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0x82, 0xE8,
+  0x28, 0xFF, 0x02, 0xC8, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0x9E,
+  0xC8, 0x28, 0xFF, 0x02, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
+  0x81, 0xC8, 0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x06,
+  0x09, 0x31, 0xFF, 0x4C, 0x5A, 0xBD, 0x00, 0x00, 0x00, 0xF5, 0xFE, 0x18, 0x07,
+  0xED, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x02,
+  0x05, 0xFD, 0xFF, 0x09, 0xE5, 0xFF, 0x93, 0xFE, 0x4D, 0x83, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x0B, 0xD5, 0xFE, 0x1C, 0x0A, 0xDD, 0xFF, 0x25, 0xFD,
+  0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
+  0xC6, 0xEC, 0xFF, 0x94, 0xF6, 0x4A, 0x00, 0x00, 0x00, 0x4F, 0x7B, 0xA1, 0xE7,
+  0x28, 0xFF, 0xAE, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x30,
+  0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x06, 0xC9, 0x28, 0xFF,
+  0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC6, 0x30, 0xFF, 0x00, 0x49, 0xFF, 0xEA,
+  0xDC, 0xFF, 0xE5, 0xF4, 0xFF, 0x84, 0xE3, 0xFC, 0xFF, 0x81, 0xE2, 0xFC, 0xFF,
+  0x0A, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x26, 0xF5, 0xFF, 0x89, 0xD4, 0xFF,
+  0xC4, 0x40, 0xFF, 0xE8, 0x30, 0xFF, 0x07, 0x21, 0xFF, 0xE6, 0x20, 0xFF, 0xE7,
+  0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0x82, 0xA9, 0x30, 0xFF, 0x00,
+  0xC9, 0x30, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x83, 0xE8, 0x28, 0xFF, 0x01, 0xC8,
+  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xA9, 0x30, 0xFF, 0x00, 0xC9, 0x28, 0xFF,
+  0x9D, 0xC8, 0x28, 0xFF, 0x02, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28,
+  0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF,
+  0x81, 0xE8, 0x28, 0xFF, 0x05, 0xED, 0x6A, 0xAA, 0x00, 0x00, 0x00, 0xB4, 0xFE,
+  0x35, 0xE7, 0xEC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x81, 0xE3, 0xFC,
+  0xFF, 0x02, 0x05, 0xFD, 0xFF, 0x09, 0xDD, 0xFF, 0xD4, 0xFE, 0x34, 0x83, 0x00,
+  0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFE, 0x08, 0x2B, 0xDD, 0xFF,
+  0x05, 0xF5, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3,
+  0xFC, 0xFF, 0xC6, 0xEC, 0xFF, 0x52, 0xF6, 0x6C, 0xFF, 0xFF, 0x02, 0x52, 0x9C,
+  0x78, 0xE7, 0x28, 0xFF, 0xAF, 0xC8, 0x28, 0xFF, 0x01, 0xC9, 0x28, 0xFF, 0xC8,
+  0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28,
+  0xFF, 0x06, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC6, 0x38,
+  0xFF, 0xE0, 0x48, 0xFF, 0x0B, 0xE5, 0xFF, 0xE6, 0xF4, 0xFF, 0x84, 0xE3, 0xFC,
+  0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x09, 0xE3, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x07,
   0xED, 0xFF, 0x25, 0x9B, 0xFF, 0xA3, 0x38, 0xFF, 0xE8, 0x30, 0xFF, 0xE7, 0x20,
-  0xFF, 0x07, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xCA, 0x28, 0xFF, 0xAA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7,
-  0x28, 0xF6, 0xB1, 0x8B, 0x87, 0x00, 0x00, 0x00, 0x52, 0xF6, 0x59, 0x06, 0xED,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0x0A, 0xDD, 0xFF, 0xF4, 0xFE, 0x17, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x03,
-  0x8D, 0xE5, 0xE0, 0x06, 0xF5, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0x10, 0xEE, 0x9A, 0xBA, 0xFE,
-  0x06, 0x56, 0xBD, 0x47, 0xC6, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF,
-  0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0xE1, 0x48, 0xFF, 0x0C, 0xE5,
-  0xFF, 0x06, 0xF5, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x08, 0xE5, 0xFF, 0xC1, 0x69, 0xFF, 0xA4, 0x38,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x28, 0xF2, 0xD5, 0xAC, 0x59, 0x00, 0x00,
-  0x00, 0x11, 0xEE, 0x85, 0x06, 0xF5, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0x4C, 0xE5, 0xFF, 0xF5,
-  0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xEF, 0xED, 0xA3, 0xE6, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x03,
-  0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x06, 0xF5, 0xFF, 0xCF, 0xE5,
-  0xCC, 0x5A, 0xFF, 0x0B, 0x9A, 0xDE, 0x16, 0x07, 0x31, 0xFC,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xA8, 0x30, 0xFF,
-  0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x20, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0xC1, 0x48,
-  0xFF, 0xCB, 0xDC, 0xFF, 0x27, 0xF5, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC4,
-  0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0xC9, 0xDC,
-  0xFF, 0x20, 0x51, 0xFF, 0xC5, 0x38, 0xFF, 0xA8, 0x30, 0xFF, 0xA9, 0x30, 0xFF,
-  0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x08, 0x31,
+  0xFF, 0x07, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x81, 0xC8, 0x30,
+  0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF,
+  0x81, 0xE8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x01, 0xCA, 0x28, 0xFF, 0xAA,
+  0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x9D, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28,
+  0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x06, 0xC9, 0x28, 0xFF,
+  0xE8, 0x28, 0xFF, 0xC7, 0x28, 0xF6, 0xB1, 0x8B, 0x87, 0x00, 0x00, 0x00, 0x52,
+  0xF6, 0x59, 0x06, 0xED, 0xFF, 0x83, 0xE3, 0xFC, 0xFF, 0x02, 0x06, 0xF5, 0xFF,
+  0x0A, 0xDD, 0xFF, 0xF4, 0xFE, 0x17, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00,
+  0x00, 0x0B, 0xF5, 0xFF, 0x03, 0x8D, 0xE5, 0xE0, 0x06, 0xF5, 0xFF, 0xE2, 0xFC,
+  0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF,
+  0x10, 0xEE, 0x9A, 0xBA, 0xFE, 0x06, 0x56, 0xBD, 0x47, 0xC6, 0x28, 0xFF, 0xB1,
+  0xC8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x0A, 0xC9, 0x30, 0xFF, 0xC9, 0x28,
+  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
+  0xA8, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0xE1, 0x48, 0xFF, 0x0C, 0xE5, 0xFF, 0x06,
+  0xF5, 0xFF, 0x84, 0xE3, 0xFC, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x09, 0xE3, 0xFC,
+  0xFF, 0x05, 0xF5, 0xFF, 0x08, 0xE5, 0xFF, 0xC1, 0x69, 0xFF, 0xA4, 0x38, 0xFF,
+  0xC8, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
+  0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x00, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF,
+  0x86, 0xC9, 0x28, 0xFF, 0x9D, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x82,
+  0xC8, 0x30, 0xFF, 0x08, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
+  0xC7, 0x28, 0xF2, 0xD5, 0xAC, 0x59, 0x00, 0x00, 0x00, 0x11, 0xEE, 0x85, 0x06,
+  0xF5, 0xFF, 0xE2, 0xFC, 0xFF, 0x82, 0xE3, 0xFC, 0xFF, 0x02, 0x06, 0xF5, 0xFF,
+  0x4C, 0xE5, 0xFF, 0xF5, 0xFF, 0x03, 0x83, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00,
+  0x00, 0x0A, 0xEF, 0xED, 0xA3, 0xE6, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD,
+  0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x06, 0xF5, 0xFF, 0xCF, 0xE5, 0xCC,
+  0x5A, 0xFF, 0x0B, 0x9A, 0xDE, 0x16, 0x07, 0x31, 0xFC, 0xAF, 0xC8, 0x28, 0xFF,
+  0x01, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xA8, 0x30, 0xFF, 0x01, 0xC9,
+  0x30, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x20, 0xFF, 0x07, 0xE8, 0x28, 0xFF,
+  0xC8, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xA6, 0x38, 0xFF, 0xC1, 0x48, 0xFF, 0xCB,
+  0xDC, 0xFF, 0x27, 0xF5, 0xFF, 0xE3, 0xFC, 0xFF, 0x82, 0xE2, 0xFC, 0xFF, 0x00,
+  0xE3, 0xFC, 0xFF, 0x81, 0xC4, 0xFC, 0xFF, 0x07, 0xE4, 0xFC, 0xFF, 0x06, 0xF5,
+  0xFF, 0xC9, 0xDC, 0xFF, 0x20, 0x51, 0xFF, 0xC5, 0x38, 0xFF, 0xA8, 0x30, 0xFF,
+  0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x82, 0xC8, 0x28,
+  0xFF, 0x83, 0xE8, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF,
+  0x81, 0xA9, 0x30, 0xFF, 0x01, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xE8,
+  0x28, 0xFF, 0x9E, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x82, 0xC8, 0x30,
+  0xFF, 0x09, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x08, 0x31,
   0xEF, 0xF9, 0xD5, 0x28, 0x00, 0x00, 0x00, 0xD0, 0xE5, 0xBC, 0x06, 0xF5, 0xFF,
-  0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x06,
-  0xF5, 0xFF, 0xAD, 0xED, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xEE, 0x5E, 0x06,
-  0xED, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE6, 0xF4, 0xFF, 0x8D, 0xE5, 0xF7, 0x18, 0xFF, 0x11, 0x00, 0x00, 0x00,
-  0xA9, 0x39, 0xDA, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8,
-  0x20, 0xFF, 0xE8, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30,
+  0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x01, 0x06, 0xF5,
+  0xFF, 0xAD, 0xED, 0xC4, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x01,
+  0x51, 0xEE, 0x5E, 0x06, 0xED, 0xFF, 0x83, 0xE3, 0xFC, 0xFF, 0x05, 0xE6, 0xF4,
+  0xFF, 0x8D, 0xE5, 0xF7, 0x18, 0xFF, 0x11, 0x00, 0x00, 0x00, 0xA9, 0x39, 0xDA,
+  0xE8, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x84, 0xC9, 0x28, 0xFF, 0xA8, 0xC8,
+  0x28, 0xFF, 0x03, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9,
+  0x28, 0xFF, 0x81, 0xE8, 0x20, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x05, 0xC8, 0x30,
   0xFF, 0xC6, 0x38, 0xFF, 0x81, 0x38, 0xFF, 0x4B, 0xCC, 0xFF, 0x07, 0xF5, 0xFF,
-  0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC5, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x06, 0xED,
-  0xFF, 0x49, 0xC4, 0xFF, 0xE1, 0x40, 0xFF, 0xC5, 0x38, 0xFF, 0xC9, 0x30, 0xFF,
-  0xA9, 0x30, 0xFF, 0x89, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9,
-  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA8,
-  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0x48, 0x39, 0xDE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x8E, 0xE5, 0xEB,
-  0x05, 0xF5, 0xFF, 0x02, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0x10, 0xEE, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x15, 0xFF, 0x22, 0x06, 0xED, 0xFF, 0xE2, 0xFC, 0xFF, 0xC2, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE5, 0xEC, 0xFF, 0x2A, 0xE5, 0xFF,
-  0xF6, 0xFE, 0x18, 0x00, 0x00, 0x00, 0x6F, 0x73, 0xA1, 0xE7, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28,
-  0xFF, 0xC9, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x20, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC6, 0x30, 0xFF, 0xE5, 0x38, 0xFF,
-  0x28, 0x93, 0xFF, 0xE8, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02,
-  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x28, 0xED, 0xFF, 0x49, 0x9B, 0xFF, 0xE4, 0x38, 0xFF,
-  0xA6, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x88, 0x30, 0xFF, 0xCA, 0x30, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xA7,
-  0x20, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xCA, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xCD, 0x6A, 0xAE, 0x00, 0x00, 0x00,
-  0x79, 0xFE, 0x05, 0x2A, 0xE5, 0xFF, 0xE5, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE2,
-  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE7, 0xEC, 0xFF, 0xD5, 0xFE,
-  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFE, 0x0D, 0x28, 0xED, 0xF7, 0x03, 0xFD,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE5, 0xF4, 0xFF,
-  0x08, 0xED, 0xFF, 0x92, 0xFE, 0x39, 0x00, 0x00, 0x00, 0x94, 0x94, 0x5C, 0xE7,
-  0x28, 0xF9, 0xC8, 0x28, 0xFF, 0xE9, 0x38, 0xFF, 0xC9, 0x30, 0xFF, 0x88, 0x20,
-  0xFF, 0xEA, 0x28, 0xFF, 0xEA, 0x20, 0xFF, 0xC9, 0x20, 0xFF,
-  0xC9, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xA8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0x08, 0x31, 0xFF,
-  0xC5, 0x28, 0xFF, 0x64, 0x51, 0xFF, 0xEB, 0xEC, 0xFF, 0x07, 0xFD, 0xFF, 0x05,
-  0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0x03, 0xF5, 0xFF, 0xE2, 0xF4, 0xFF, 0xA2, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0xCA, 0xDC, 0xFF,
-  0x64, 0x51, 0xFF, 0xA6, 0x28, 0xFF, 0x08, 0x31, 0xFF, 0xE9, 0x30, 0xFF, 0x88,
-  0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x09,
-  0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xA9, 0x30,
-  0xFF, 0xCA, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC7, 0x20, 0xF7,
-  0x12, 0x8C, 0x76, 0x00, 0x00, 0x00, 0xB2, 0xFE, 0x20, 0x08, 0xED, 0xFF, 0xE5,
-  0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC,
-  0xFF, 0x08, 0xED, 0xFF, 0xD6, 0xF6, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFE,
-  0x07, 0x6A, 0xED, 0xE3, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0xCE, 0xF5, 0x9C, 0xBA,
-  0xFE, 0x06, 0xD8, 0xC5, 0x31, 0x28, 0x29, 0xF4, 0xC8, 0x28, 0xFF, 0xA8, 0x30,
-  0xFF, 0xA8, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x20, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
-  0xA8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0x09, 0x39, 0xFF, 0xE5, 0x38, 0xFF, 0x63,
-  0x69, 0xFF, 0x29, 0xCC, 0xFF, 0xC7, 0xEC, 0xFF, 0xC4, 0xF4, 0xFF, 0x24, 0xFD,
-  0xFF, 0x03, 0xFD, 0xFF, 0xC3, 0xF4, 0xFF, 0x48, 0xFD, 0xFF, 0x8A, 0xD4, 0xFF,
-  0x25, 0x72, 0xFF, 0xA4, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0x89,
-  0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x38, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0x29, 0x31, 0xF4, 0x77, 0xBD, 0x3C, 0x00, 0x00, 0x00, 0xEF, 0xFD, 0x78, 0x07,
-  0xED, 0xFF, 0x05, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD,
-  0xFF, 0xE4, 0xFC, 0xFF, 0x4A, 0xF5, 0xED, 0x57, 0xFF, 0x0B, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0x02, 0xCD, 0xF5, 0xC2, 0xE6, 0xEC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE5,
-  0xFC, 0xFF, 0x2A, 0xE5, 0xFF, 0x57, 0xFF, 0x0C, 0xBA, 0xD6, 0x13, 0x48, 0x31,
-  0xE8, 0x09, 0x31, 0xFF, 0x87, 0x28, 0xFF, 0x88, 0x30, 0xFF, 0xE9, 0x38, 0xFF,
-  0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9,
-  0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE9, 0x30, 0xFF, 0x88, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xE9, 0x38, 0xFF, 0x87,
-  0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xA4, 0x38, 0xFF, 0x43, 0x59, 0xFF, 0x67, 0xAB,
-  0xFF, 0xEA, 0xEC, 0xFF, 0xE8, 0xEC, 0xFF, 0xC7, 0xEC, 0xFF, 0x2A, 0xF5, 0xFF,
-  0x86, 0xB3, 0xFF, 0x01, 0x51, 0xFF, 0xA3, 0x38, 0xFF, 0x07, 0x31, 0xFF, 0x09,
-  0x31, 0xFF, 0x89, 0x28, 0xFF, 0x89, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x48, 0x39, 0xED, 0x3B, 0xDE, 0x1B, 0xF5,
-  0xFF, 0x03, 0x6B, 0xED, 0xF4, 0x06, 0xF5, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0xAC, 0xF5, 0xD2,
-  0xD6, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF6, 0x72,
-  0x08, 0xE5, 0xFF, 0xE5, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC3,
-  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x07, 0xED, 0xFF, 0xD5, 0xF6, 0x22, 0xFF, 0xFF,
-  0x01, 0x4C, 0x52, 0xC6, 0xE8, 0x28, 0xFF, 0xE9, 0x38, 0xFF, 0xA8, 0x30, 0xFF,
-  0x87, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0x88, 0x20, 0xFF, 0x0A, 0x39, 0xFF, 0xA8, 0x30, 0xFF, 0x87,
-  0x28, 0xFF, 0x08, 0x31, 0xFF, 0xA7, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0xA5, 0x28,
-  0xFF, 0x83, 0x38, 0xFF, 0xA3, 0x48, 0xFF, 0x25, 0x59, 0xFF, 0x45, 0x61, 0xFF,
-  0xE4, 0x50, 0xFF, 0x83, 0x38, 0xFF, 0xA4, 0x30, 0xFF, 0x07, 0x39, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xA7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0x29, 0x31, 0xFF, 0xC7, 0x28, 0xFF, 0xA9, 0x41, 0xD7, 0x00,
-  0x00, 0x00, 0xB7, 0xF6, 0x19, 0x29, 0xE5, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF,
-  0xE7, 0xEC, 0xFF, 0x0F, 0xF6, 0x8D, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x94, 0xFE, 0x23, 0x2A, 0xE5, 0xFF, 0x05, 0xF5, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x26, 0xF5,
-  0xFF, 0x73, 0xF6, 0x4C, 0xFF, 0xFF, 0x02, 0xF5, 0xA4, 0x64, 0xA6, 0x18, 0xFF,
-  0xC9, 0x30, 0xFF, 0xC9, 0x38, 0xFF, 0x67, 0x28, 0xFF, 0xE8, 0x38, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xEA, 0x30, 0xFF, 0x68,
-  0x20, 0xFF, 0xE8, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xE7, 0x28, 0xFF, 0x08, 0x29,
-  0xFF, 0xE8, 0x18, 0xFF, 0x29, 0x29, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC9, 0x38, 0xFF, 0xA8, 0x38, 0xFF, 0x68, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x29,
-  0x39, 0xFF, 0xA7, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0x08, 0x29, 0xFF, 0xC8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0x08, 0x31, 0xFF,
-  0xC7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xE7,
-  0x28, 0xFF, 0xD1, 0x8B, 0x83, 0x00, 0x00, 0x00, 0x95, 0xEE, 0x41, 0x28, 0xED,
-  0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE5, 0xFC, 0xFF, 0x09, 0xED, 0xFF, 0x72, 0xF6, 0x40, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFD, 0x04, 0x8D, 0xE5, 0xE7, 0x06,
+  0x03, 0xFD, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x0B, 0x02, 0xFD, 0xFF, 0xE3, 0xFC,
+  0xFF, 0xC4, 0xFC, 0xFF, 0xC5, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x06, 0xED, 0xFF,
+  0x49, 0xC4, 0xFF, 0xE1, 0x40, 0xFF, 0xC5, 0x38, 0xFF, 0xC9, 0x30, 0xFF, 0xA9,
+  0x30, 0xFF, 0x89, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF,
+  0x85, 0xE8, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x81,
+  0xA9, 0x30, 0xFF, 0x03, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
+  0xE7, 0x28, 0xFF, 0x9E, 0xC8, 0x28, 0xFF, 0x05, 0xC9, 0x28, 0xFF, 0xE9, 0x28,
+  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
+  0x81, 0xC9, 0x28, 0xFF, 0x0B, 0xE8, 0x28, 0xFF, 0x48, 0x39, 0xDE, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x02, 0x8E, 0xE5, 0xEB, 0x05, 0xF5, 0xFF, 0x02, 0xFD, 0xFF,
+  0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0x10,
+  0xEE, 0x7B, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x0E, 0x15, 0xFF,
+  0x22, 0x06, 0xED, 0xFF, 0xE2, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
+  0x03, 0xFD, 0xFF, 0xE5, 0xEC, 0xFF, 0x2A, 0xE5, 0xFF, 0xF6, 0xFE, 0x18, 0x00,
+  0x00, 0x00, 0x6F, 0x73, 0xA1, 0xE7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28,
+  0xFF, 0xC9, 0x30, 0xFF, 0x81, 0xE9, 0x28, 0xFF, 0x03, 0xC9, 0x20, 0xFF, 0xE9,
+  0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x81,
+  0xE8, 0x28, 0xFF, 0xA3, 0xC8, 0x28, 0xFF, 0x82, 0xC8, 0x30, 0xFF, 0x00, 0xC8,
+  0x28, 0xFF, 0x81, 0xE8, 0x20, 0xFF, 0x09, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
+  0xA8, 0x28, 0xFF, 0xC6, 0x30, 0xFF, 0xE5, 0x38, 0xFF, 0x28, 0x93, 0xFF, 0xE8,
+  0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x81, 0x03,
+  0xFD, 0xFF, 0x0B, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x28,
+  0xED, 0xFF, 0x49, 0x9B, 0xFF, 0xE4, 0x38, 0xFF, 0xA6, 0x28, 0xFF, 0xC8, 0x30,
+  0xFF, 0x88, 0x30, 0xFF, 0xCA, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF,
+  0x89, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x00,
+  0xE8, 0x28, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x12, 0x09, 0x29, 0xFF, 0xA7, 0x20,
+  0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
+  0xCA, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xCD, 0x6A, 0xAE, 0x00, 0x00, 0x00, 0x79,
+  0xFE, 0x05, 0x2A, 0xE5, 0xFF, 0xE5, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC,
+  0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE7, 0xEC, 0xFF, 0xD5, 0xFE, 0x38,
+  0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x14, 0xD6, 0xFE, 0x0D, 0x28,
+  0xED, 0xF7, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x03, 0xFD,
+  0xFF, 0xE5, 0xF4, 0xFF, 0x08, 0xED, 0xFF, 0x92, 0xFE, 0x39, 0x00, 0x00, 0x00,
+  0x94, 0x94, 0x5C, 0xE7, 0x28, 0xF9, 0xC8, 0x28, 0xFF, 0xE9, 0x38, 0xFF, 0xC9,
+  0x30, 0xFF, 0x88, 0x20, 0xFF, 0xEA, 0x28, 0xFF, 0xEA, 0x20, 0xFF, 0xC9, 0x20,
+  0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x81, 0xE8,
+  0x28, 0xFF, 0xA1, 0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x84, 0xC8, 0x28,
+  0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x08, 0xA8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xA8,
+  0x28, 0xFF, 0x08, 0x31, 0xFF, 0xC5, 0x28, 0xFF, 0x64, 0x51, 0xFF, 0xEB, 0xEC,
+  0xFF, 0x07, 0xFD, 0xFF, 0x05, 0xFD, 0xFF, 0x81, 0x03, 0xF5, 0xFF, 0x0C, 0xE2,
+  0xF4, 0xFF, 0xA2, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0xCA, 0xDC,
+  0xFF, 0x64, 0x51, 0xFF, 0xA6, 0x28, 0xFF, 0x08, 0x31, 0xFF, 0xE9, 0x30, 0xFF,
+  0x88, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xAF,
+  0xC8, 0x28, 0xFF, 0x12, 0x09, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x30, 0xFF,
+  0xC8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xCA, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC7,
+  0x20, 0xF7, 0x12, 0x8C, 0x76, 0x00, 0x00, 0x00, 0xB2, 0xFE, 0x20, 0x08, 0xED,
+  0xFF, 0xE5, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
+  0xE4, 0xFC, 0xFF, 0x08, 0xED, 0xFF, 0xD6, 0xF6, 0x15, 0x84, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x04, 0xD6, 0xFE, 0x07, 0x6A, 0xED, 0xE3, 0x04, 0xFD,
+  0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x05, 0xE6,
+  0xF4, 0xFF, 0xCE, 0xF5, 0x9C, 0xBA, 0xFE, 0x06, 0xD8, 0xC5, 0x31, 0x28, 0x29,
+  0xF4, 0xC8, 0x28, 0xFF, 0x81, 0xA8, 0x30, 0xFF, 0x02, 0xC9, 0x28, 0xFF, 0xE9,
+  0x28, 0xFF, 0xC9, 0x20, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x82, 0xC8, 0x30, 0xFF,
+  0x01, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xA0, 0xC8, 0x28, 0xFF, 0x82, 0xC9,
+  0x28, 0xFF, 0x83, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x01, 0xC9, 0x28,
+  0xFF, 0xC9, 0x30, 0xFF, 0x81, 0xA8, 0x28, 0xFF, 0x12, 0x09, 0x39, 0xFF, 0xE5,
+  0x38, 0xFF, 0x63, 0x69, 0xFF, 0x29, 0xCC, 0xFF, 0xC7, 0xEC, 0xFF, 0xC4, 0xF4,
+  0xFF, 0x24, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xC3, 0xF4, 0xFF, 0x48, 0xFD, 0xFF,
+  0x8A, 0xD4, 0xFF, 0x25, 0x72, 0xFF, 0xA4, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xCA,
+  0x30, 0xFF, 0x89, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x38, 0xFF, 0xA9, 0x28,
+  0xFF, 0x81, 0xC9, 0x28, 0xFF, 0xAE, 0xC8, 0x28, 0xFF, 0x00, 0xE9, 0x28, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x0F, 0xE8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28,
+  0xFF, 0xC8, 0x28, 0xFF, 0x29, 0x31, 0xF4, 0x77, 0xBD, 0x3C, 0x00, 0x00, 0x00,
+  0xEF, 0xFD, 0x78, 0x07, 0xED, 0xFF, 0x05, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3,
+  0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0x4A, 0xF5, 0xED, 0x57, 0xFF,
+  0x0B, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x02,
+  0xCD, 0xF5, 0xC2, 0xE6, 0xEC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x81,
+  0xE4, 0xFC, 0xFF, 0x0C, 0xE5, 0xFC, 0xFF, 0x2A, 0xE5, 0xFF, 0x57, 0xFF, 0x0C,
+  0xBA, 0xD6, 0x13, 0x48, 0x31, 0xE8, 0x09, 0x31, 0xFF, 0x87, 0x28, 0xFF, 0x88,
+  0x30, 0xFF, 0xE9, 0x38, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
+  0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81,
+  0xE8, 0x28, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x04, 0xC9, 0x28, 0xFF, 0xA9, 0x30,
+  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x28,
+  0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x11, 0xE9, 0x30, 0xFF, 0x88, 0x28, 0xFF, 0xA8,
+  0x30, 0xFF, 0xE9, 0x38, 0xFF, 0x87, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0xA4, 0x38,
+  0xFF, 0x43, 0x59, 0xFF, 0x67, 0xAB, 0xFF, 0xEA, 0xEC, 0xFF, 0xE8, 0xEC, 0xFF,
+  0xC7, 0xEC, 0xFF, 0x2A, 0xF5, 0xFF, 0x86, 0xB3, 0xFF, 0x01, 0x51, 0xFF, 0xA3,
+  0x38, 0xFF, 0x07, 0x31, 0xFF, 0x09, 0x31, 0xFF, 0x81, 0x89, 0x28, 0xFF, 0x81,
+  0xC9, 0x30, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0xAF, 0xC8, 0x28, 0xFF, 0x02, 0xC9,
+  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x0C,
+  0xC7, 0x28, 0xFF, 0x48, 0x39, 0xED, 0x3B, 0xDE, 0x1B, 0xF5, 0xFF, 0x03, 0x6B,
+  0xED, 0xF4, 0x06, 0xF5, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC,
+  0xFF, 0xE4, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0xAC, 0xF5, 0xD2, 0xD6, 0xFE, 0x07,
+  0x84, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x0F, 0x30, 0xF6, 0x72, 0x08,
+  0xE5, 0xFF, 0xE5, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC3, 0xFC,
+  0xFF, 0xE4, 0xFC, 0xFF, 0x07, 0xED, 0xFF, 0xD5, 0xF6, 0x22, 0xFF, 0xFF, 0x01,
+  0x4C, 0x52, 0xC6, 0xE8, 0x28, 0xFF, 0xE9, 0x38, 0xFF, 0xA8, 0x30, 0xFF, 0x87,
+  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF,
+  0x00, 0xC8, 0x30, 0xFF, 0x84, 0xC9, 0x28, 0xFF, 0x9E, 0xC8, 0x28, 0xFF, 0x02,
+  0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF,
+  0x83, 0xC8, 0x28, 0xFF, 0x0F, 0x88, 0x20, 0xFF, 0x0A, 0x39, 0xFF, 0xA8, 0x30,
+  0xFF, 0x87, 0x28, 0xFF, 0x08, 0x31, 0xFF, 0xA7, 0x20, 0xFF, 0xE7, 0x28, 0xFF,
+  0xA5, 0x28, 0xFF, 0x83, 0x38, 0xFF, 0xA3, 0x48, 0xFF, 0x25, 0x59, 0xFF, 0x45,
+  0x61, 0xFF, 0xE4, 0x50, 0xFF, 0x83, 0x38, 0xFF, 0xA4, 0x30, 0xFF, 0x07, 0x39,
+  0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x02, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA7,
+  0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0xAE, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x0A, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xE8, 0x28,
+  0xFF, 0x29, 0x31, 0xFF, 0xC7, 0x28, 0xFF, 0xA9, 0x41, 0xD7, 0x00, 0x00, 0x00,
+  0xB7, 0xF6, 0x19, 0x29, 0xE5, 0xFF, 0x04, 0xFD, 0xFF, 0x81, 0xE3, 0xFC, 0xFF,
+  0x04, 0xC4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE7, 0xEC, 0xFF, 0x0F, 0xF6, 0x8D,
+  0xFF, 0xFF, 0x02, 0x84, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x0F, 0x94,
+  0xFE, 0x23, 0x2A, 0xE5, 0xFF, 0x05, 0xF5, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC,
+  0xFF, 0xA3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x26, 0xF5, 0xFF, 0x73, 0xF6, 0x4C,
+  0xFF, 0xFF, 0x02, 0xF5, 0xA4, 0x64, 0xA6, 0x18, 0xFF, 0xC9, 0x30, 0xFF, 0xC9,
+  0x38, 0xFF, 0x67, 0x28, 0xFF, 0xE8, 0x38, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x00,
+  0xC8, 0x28, 0xFF, 0x85, 0xC9, 0x28, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x01, 0xC8,
+  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF,
+  0x10, 0xC9, 0x28, 0xFF, 0xEA, 0x30, 0xFF, 0x68, 0x20, 0xFF, 0xE8, 0x30, 0xFF,
+  0xC7, 0x30, 0xFF, 0xE7, 0x28, 0xFF, 0x08, 0x29, 0xFF, 0xE8, 0x18, 0xFF, 0x29,
+  0x29, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x38, 0xFF, 0xA8, 0x38,
+  0xFF, 0x68, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x29, 0x39, 0xFF, 0xA7, 0x20, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x05, 0xE8, 0x28, 0xFF, 0x08, 0x29, 0xFF, 0xC8, 0x20,
+  0xFF, 0xE8, 0x28, 0xFF, 0x08, 0x31, 0xFF, 0xC7, 0x28, 0xFF, 0xAE, 0xC8, 0x28,
+  0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF,
+  0x06, 0xA7, 0x20, 0xFF, 0xE7, 0x28, 0xFF, 0xD1, 0x8B, 0x83, 0x00, 0x00, 0x00,
+  0x95, 0xEE, 0x41, 0x28, 0xED, 0xFF, 0x03, 0xFD, 0xFF, 0x82, 0xE3, 0xFC, 0xFF,
+  0x02, 0xE5, 0xFC, 0xFF, 0x09, 0xED, 0xFF, 0x72, 0xF6, 0x40, 0x85, 0x00, 0x00,
+  0x00, 0x85, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xFD, 0x04, 0x8D, 0xE5, 0xE7, 0x06,
   0xF5, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xA2, 0xFC, 0xFF, 0x02, 0xFD,
-  0xFF, 0x05, 0xF5, 0xFF, 0xEF, 0xED, 0x9E, 0xF7, 0xFE, 0x08,
-  0xBA, 0xD6, 0x06, 0x49, 0x29, 0xEB, 0xA8, 0x28, 0xFF, 0xC9, 0x38, 0xFF, 0xA8,
-  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9,
+  0xFF, 0x05, 0xF5, 0xFF, 0xEF, 0xED, 0x9E, 0xF7, 0xFE, 0x08, 0xBA, 0xD6, 0x06,
+  0x49, 0x29, 0xEB, 0xA8, 0x28, 0xFF, 0xC9, 0x38, 0xFF, 0xA8, 0x30, 0xFF, 0xC8,
+  0x30, 0xFF, 0x81, 0xC7, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x83, 0xC9, 0x28,
+  0xFF, 0xA1, 0xC8, 0x28, 0xFF, 0x01, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x81,
+  0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x0F, 0xA9,
   0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0x07, 0x31, 0xFF, 0x86, 0x20,
-  0xFF, 0x28, 0x29, 0xFF, 0x29, 0x29, 0xFF, 0xC8, 0x18, 0xFF,
-  0xE9, 0x20, 0xFF, 0xE8, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0x0A,
-  0x29, 0xFF, 0xC9, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0x09, 0x31, 0xFF, 0xE9, 0x28,
-  0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0xE8, 0x20, 0xFF,
-  0xE9, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0x86, 0x18, 0xFF, 0x49, 0x39, 0xEF, 0x5A, 0xD6, 0x13, 0x00, 0x00,
-  0x00, 0xF1, 0xED, 0x82, 0x27, 0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF,
-  0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x6B, 0xED, 0xF7, 0xD6,
-  0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xEF, 0xE5, 0x94, 0xE6, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xC3, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x04, 0xF5, 0xFF, 0x6B, 0xE5, 0xFF,
-  0x17, 0xFF, 0x19, 0x00, 0x00, 0x00, 0xAE, 0x5A, 0xB5, 0xE9, 0x28, 0xFF, 0xA8,
-  0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0x08, 0x31, 0xFF, 0xC7, 0x20,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC7, 0x28,
-  0xFF, 0xE7, 0x28, 0xFF, 0x08, 0x29, 0xFF, 0xA7, 0x20, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE6, 0x28, 0xFF, 0x05, 0x31, 0xFF, 0x05,
-  0x31, 0xFF, 0xC5, 0x28, 0xFF, 0xC6, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xA7, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x20, 0xFF,
-  0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x87, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC8,
-  0x20, 0xFF, 0xE8, 0x28, 0xFF, 0x29, 0x31, 0xFF, 0xEB, 0x49, 0xC0, 0x00, 0x00,
-  0x00, 0xBA, 0xFE, 0x06, 0x8D, 0xED, 0xEB, 0xE5, 0xF4, 0xFF, 0xE2, 0xFC, 0xFF,
-  0x02, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0xAD,
-  0xED, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xF6, 0x4B, 0x07, 0xED,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x02, 0xFD, 0xFF,
-  0x03, 0xF5, 0xFF, 0x28, 0xED, 0xFF, 0x72, 0xFE, 0x43, 0x00, 0x00, 0x00, 0x74,
-  0x8C, 0x74, 0xE8, 0x28, 0xF9, 0xC9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xAA, 0x30, 0xFF, 0xA9, 0x30,
-  0xFF, 0xA9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xE9, 0x28, 0xFF,
-  0xE9, 0x30, 0xFF, 0xA7, 0x38, 0xFF, 0xA6, 0x40, 0xFF, 0xA3, 0x40, 0xFF, 0xC1,
-  0x48, 0xFF, 0x62, 0x59, 0xFF, 0xE3, 0x69, 0xFF, 0xA2, 0x61, 0xFF, 0xE1, 0x48,
-  0xFF, 0xA2, 0x38, 0xFF, 0xC5, 0x38, 0xFF, 0xC8, 0x30, 0xFF, 0xE9, 0x28, 0xFF,
-  0xA9, 0x28, 0xFF, 0xEA, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE7, 0x28,
-  0xFB, 0xF3, 0x83, 0x82, 0x00, 0x00, 0x00, 0xB4, 0xFE, 0x30, 0x09, 0xED, 0xFF,
-  0x05, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x02,
-  0xFD, 0xFF, 0xE5, 0xF4, 0xFF, 0x72, 0xFE, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xF6,
+  0xFF, 0x28, 0x29, 0xFF, 0x29, 0x29, 0xFF, 0xC8, 0x18, 0xFF, 0xE9, 0x20, 0xFF,
+  0xE8, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0x0A, 0x29, 0xFF, 0xC9,
+  0x28, 0xFF, 0xA8, 0x20, 0xFF, 0x09, 0x31, 0xFF, 0x81, 0xE9, 0x28, 0xFF, 0x05,
+  0xE8, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0xE8, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xE8,
+  0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xAE, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF,
+  0x01, 0xA9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x0C, 0x86,
+  0x18, 0xFF, 0x49, 0x39, 0xEF, 0x5A, 0xD6, 0x13, 0x00, 0x00, 0x00, 0xF1, 0xED,
+  0x82, 0x27, 0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
+  0xE3, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x6B, 0xED, 0xF7, 0xD6, 0xFE, 0x07, 0x85,
+  0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xE5, 0x94, 0xE6, 0xF4,
+  0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x08, 0xC3, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x04,
+  0xF5, 0xFF, 0x6B, 0xE5, 0xFF, 0x17, 0xFF, 0x19, 0x00, 0x00, 0x00, 0xAE, 0x5A,
+  0xB5, 0xE9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0x81, 0xA8, 0x30, 0xFF, 0x03, 0x08,
+  0x31, 0xFF, 0xC7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0x81, 0xC9,
+  0x28, 0xFF, 0x01, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xA1, 0xC8, 0x28, 0xFF,
+  0x0D, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF,
+  0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xA9,
+  0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0x08, 0x29,
+  0xFF, 0xA7, 0x20, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x01, 0xE7, 0x28, 0xFF, 0xE6,
+  0x28, 0xFF, 0x81, 0x05, 0x31, 0xFF, 0x0B, 0xC5, 0x28, 0xFF, 0xC6, 0x30, 0xFF,
+  0xE8, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9,
+  0x28, 0xFF, 0xE9, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x87, 0x28,
+  0xFF, 0xE8, 0x30, 0xFF, 0xAE, 0xC8, 0x28, 0xFF, 0x11, 0xC9, 0x28, 0xFF, 0xA9,
+  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x20, 0xFF, 0xE8, 0x28,
+  0xFF, 0x29, 0x31, 0xFF, 0xEB, 0x49, 0xC0, 0x00, 0x00, 0x00, 0xBA, 0xFE, 0x06,
+  0x8D, 0xED, 0xEB, 0xE5, 0xF4, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x03,
+  0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0xAD, 0xED, 0xAB, 0x86, 0x00,
+  0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x12, 0xB4, 0xF6, 0x4B, 0x07, 0xED, 0xFF,
+  0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x03,
+  0xF5, 0xFF, 0x28, 0xED, 0xFF, 0x72, 0xFE, 0x43, 0x00, 0x00, 0x00, 0x74, 0x8C,
+  0x74, 0xE8, 0x28, 0xF9, 0xC9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
+  0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0x81,
+  0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0xA1, 0xC8, 0x28, 0xFF, 0x01, 0xC8,
+  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF,
+  0x17, 0xC9, 0x28, 0xFF, 0xAA, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x28, 0xFF,
+  0xE8, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xA7,
+  0x38, 0xFF, 0xA6, 0x40, 0xFF, 0xA3, 0x40, 0xFF, 0xC1, 0x48, 0xFF, 0x62, 0x59,
+  0xFF, 0xE3, 0x69, 0xFF, 0xA2, 0x61, 0xFF, 0xE1, 0x48, 0xFF, 0xA2, 0x38, 0xFF,
+  0xC5, 0x38, 0xFF, 0xC8, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xEA,
+  0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0xAF,
+  0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF, 0x0D, 0xC8,
+  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE7, 0x28, 0xFB, 0xF3, 0x83, 0x82, 0x00, 0x00,
+  0x00, 0xB4, 0xFE, 0x30, 0x09, 0xED, 0xFF, 0x05, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
+  0xE2, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE5, 0xF4, 0xFF, 0x72,
+  0xFE, 0x59, 0x86, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x0C, 0xD6, 0xF6,
   0x1A, 0x28, 0xED, 0xFF, 0xC4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
   0x02, 0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0x06, 0xF5, 0xFF, 0xEE, 0xF5, 0xAE, 0xF7,
-  0xFE, 0x08, 0x39, 0xC6, 0x27, 0xC7, 0x20, 0xEC, 0xA8, 0x20, 0xFF, 0xE9, 0x30,
-  0xFF, 0xE9, 0x30, 0xFF, 0xC7, 0x20, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE9, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xAA, 0x30,
-  0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xE9, 0x28, 0xFF,
-  0xA8, 0x28, 0xFF, 0x66, 0x30, 0xFF, 0x43, 0x40, 0xFF, 0x07, 0x82, 0xFF, 0xCA,
-  0xC3, 0xFF, 0x8B, 0xDC, 0xFF, 0xEB, 0xEC, 0xFF, 0xCA, 0xE4, 0xFF, 0xEA, 0xEC,
-  0xFF, 0xEB, 0xE4, 0xFF, 0xC9, 0xB3, 0xFF, 0x46, 0x7A, 0xFF,
-  0xE4, 0x38, 0xFF, 0xA6, 0x28, 0xFF, 0x0A, 0x31, 0xFF, 0x68, 0x20, 0xFF, 0xEA,
-  0x30, 0xFF, 0xC9, 0x30, 0xFF, 0x87, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0x09, 0x31, 0xFF, 0xA7, 0x20,
-  0xFF, 0xE7, 0x28, 0xF7, 0x99, 0xBD, 0x38, 0x00, 0x00, 0x00,
-  0xEF, 0xFD, 0x8D, 0xE7, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03,
-  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x06, 0xED, 0xFF, 0xD3, 0xFE,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x03, 0x8C, 0xF5, 0xD9, 0xC5, 0xF4, 0xFF,
-  0x05, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x24, 0xFD, 0xFF, 0xE4,
-  0xF4, 0xFF, 0x49, 0xED, 0xFF, 0x16, 0xFF, 0x11, 0x00, 0x00, 0x00, 0x6C, 0x52,
-  0xBC, 0x09, 0x29, 0xFF, 0xA8, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xC7, 0x20, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0xE6, 0x38, 0xFF, 0xE4, 0x50, 0xFF, 0xA7,
-  0x9A, 0xFF, 0x6A, 0xE4, 0xFF, 0xC7, 0xF4, 0xFF, 0xE6, 0xFC, 0xFF, 0xE7, 0xFC,
-  0xFF, 0xE6, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0x06, 0xF5, 0xFF,
-  0x09, 0xE5, 0xFF, 0x06, 0x93, 0xFF, 0x23, 0x49, 0xFF, 0xA6, 0x38, 0xFF, 0x88,
-  0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xA9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x30,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0x2A, 0x31,
-  0xFF, 0xA8, 0x20, 0xFF, 0x08, 0x31, 0xFF, 0xCA, 0x41, 0xD3, 0x00, 0x00, 0x00,
-  0x18, 0xFF, 0x09, 0x4A, 0xF5, 0xEE, 0xE5, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03,
-  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0x04, 0xF5, 0xFF, 0x69, 0xED,
-  0xED, 0xF7, 0xFE, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x71, 0xFE, 0x50, 0x08, 0xED, 0xFF, 0x25, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03,
-  0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x07, 0xED, 0xFF, 0x93, 0xFE,
-  0x34, 0x00, 0x00, 0x00, 0x77, 0xBD, 0x3B, 0xC7, 0x20, 0xF6, 0x2A, 0x29, 0xFF,
-  0x88, 0x18, 0xFF, 0x09, 0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF,
+  0xFE, 0x08, 0x39, 0xC6, 0x27, 0xC7, 0x20, 0xEC, 0xA8, 0x20, 0xFF, 0x81, 0xE9,
+  0x30, 0xFF, 0x03, 0xC7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x20, 0xFF, 0xE9,
+  0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x82, 0xC8, 0x30, 0xFF, 0xA2, 0xC8, 0x28,
+  0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x19, 0xC9, 0x28, 0xFF,
+  0xAA, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xE9,
+  0x28, 0xFF, 0xA8, 0x28, 0xFF, 0x66, 0x30, 0xFF, 0x43, 0x40, 0xFF, 0x07, 0x82,
+  0xFF, 0xCA, 0xC3, 0xFF, 0x8B, 0xDC, 0xFF, 0xEB, 0xEC, 0xFF, 0xCA, 0xE4, 0xFF,
+  0xEA, 0xEC, 0xFF, 0xEB, 0xE4, 0xFF, 0xC9, 0xB3, 0xFF, 0x46, 0x7A, 0xFF, 0xE4,
+  0x38, 0xFF, 0xA6, 0x28, 0xFF, 0x0A, 0x31, 0xFF, 0x68, 0x20, 0xFF, 0xEA, 0x30,
+  0xFF, 0xC9, 0x30, 0xFF, 0x87, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xAF, 0xC8, 0x28,
+  0xFF, 0x0A, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0x09, 0x31,
+  0xFF, 0xA7, 0x20, 0xFF, 0xE7, 0x28, 0xF7, 0x99, 0xBD, 0x38, 0x00, 0x00, 0x00,
+  0xEF, 0xFD, 0x8D, 0xE7, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x83, 0x03, 0xFD, 0xFF,
+  0x01, 0x06, 0xED, 0xFF, 0xD3, 0xFE, 0x28, 0x86, 0x00, 0x00, 0x00, 0x86, 0x00,
+  0x00, 0x00, 0x10, 0xF5, 0xFF, 0x03, 0x8C, 0xF5, 0xD9, 0xC5, 0xF4, 0xFF, 0x05,
+  0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x24, 0xFD, 0xFF, 0xE4, 0xF4,
+  0xFF, 0x49, 0xED, 0xFF, 0x16, 0xFF, 0x11, 0x00, 0x00, 0x00, 0x6C, 0x52, 0xBC,
+  0x09, 0x29, 0xFF, 0xA8, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0xE8,
+  0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x82, 0xC8, 0x30,
+  0xFF, 0xA2, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF,
+  0x00, 0xC9, 0x30, 0xFF, 0x81, 0xA9, 0x30, 0xFF, 0x16, 0xC9, 0x28, 0xFF, 0xC8,
+  0x20, 0xFF, 0x08, 0x29, 0xFF, 0xE6, 0x38, 0xFF, 0xE4, 0x50, 0xFF, 0xA7, 0x9A,
+  0xFF, 0x6A, 0xE4, 0xFF, 0xC7, 0xF4, 0xFF, 0xE6, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF,
+  0xE6, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0x06, 0xF5, 0xFF, 0x09,
+  0xE5, 0xFF, 0x06, 0x93, 0xFF, 0x23, 0x49, 0xFF, 0xA6, 0x38, 0xFF, 0x88, 0x28,
+  0xFF, 0xE9, 0x30, 0xFF, 0xA9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
+  0xB0, 0xC8, 0x28, 0xFF, 0x09, 0xA8, 0x20, 0xFF, 0x2A, 0x31, 0xFF, 0xA8, 0x20,
+  0xFF, 0x08, 0x31, 0xFF, 0xCA, 0x41, 0xD3, 0x00, 0x00, 0x00, 0x18, 0xFF, 0x09,
+  0x4A, 0xF5, 0xEE, 0xE5, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF,
+  0x03, 0x03, 0xF5, 0xFF, 0x04, 0xF5, 0xFF, 0x69, 0xED, 0xED, 0xF7, 0xFE, 0x08,
+  0x86, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x0F, 0x71, 0xFE, 0x50, 0x08,
+  0xED, 0xFF, 0x25, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD,
+  0xFF, 0xE3, 0xFC, 0xFF, 0x07, 0xED, 0xFF, 0x93, 0xFE, 0x34, 0x00, 0x00, 0x00,
+  0x77, 0xBD, 0x3B, 0xC7, 0x20, 0xF6, 0x2A, 0x29, 0xFF, 0x88, 0x18, 0xFF, 0x09,
+  0x31, 0xFF, 0xC8, 0x28, 0xFF, 0x83, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF,
+  0x01, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA1, 0xC8, 0x28, 0xFF, 0x81, 0xC9,
+  0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x09, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF,
   0xC9, 0x30, 0xFF, 0x09, 0x31, 0xFF, 0xC8, 0x20, 0xFF, 0xC6, 0x28, 0xFF, 0xC2,
-  0x38, 0xFF, 0xA5, 0x92, 0xFF, 0xCA, 0xEC, 0xFF, 0x07, 0xFD, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xC1, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0x09, 0xED, 0xFF, 0x06,
-  0x9B, 0xFF, 0xA3, 0x38, 0xFF, 0xC7, 0x38, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28,
-  0xFF, 0xE9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xF6,
-  0xD5, 0xAC, 0x55, 0x00, 0x00, 0x00, 0x94, 0xFE, 0x27, 0x08, 0xF5, 0xFF, 0xE4,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x04, 0xF5,
-  0xFF, 0x06, 0xED, 0xFF, 0x2F, 0xFE, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xF7, 0xFE, 0x08, 0x4B, 0xE5, 0xF2, 0x05, 0xF5, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x06, 0xF5,
-  0xFF, 0xAD, 0xED, 0xCB, 0x36, 0xFF, 0x0A, 0x9A, 0xEE, 0x0B, 0xAA, 0x39, 0xD0,
-  0xE8, 0x20, 0xFF, 0x2A, 0x31, 0xFF, 0xA7, 0x20, 0xFF, 0xE8, 0x30, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
-  0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE4,
-  0x30, 0xFF, 0x60, 0x61, 0xFF, 0xA8, 0xDC, 0xFF, 0x05, 0xFD, 0xFF, 0xC2, 0xF4,
-  0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE5, 0xFC, 0xFF, 0xC5, 0xFC, 0xFF, 0xE5,
-  0xFC, 0xFF, 0xE9, 0xE4, 0xFF, 0xC5, 0x69, 0xFF, 0xA5, 0x38, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF,
-  0x48, 0x39, 0xDC, 0x9A, 0xEE, 0x0B, 0x00, 0x00, 0x00, 0xAF, 0xED, 0xA4, 0xE6,
-  0xF4, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC,
-  0xFF, 0x26, 0xF5, 0xFF, 0x4A, 0xE5, 0xFC, 0x15, 0xFF, 0x09,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
-  0xE5, 0xAC, 0x06, 0xED, 0xFF, 0xE2, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC,
-  0xFF, 0xC3, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0x29, 0xED, 0xFF, 0x93, 0xFE, 0x2B,
-  0x00, 0x00, 0x00, 0xB1, 0x83, 0x8F, 0xC7, 0x18, 0xFB, 0xE9, 0x20, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x20, 0xFF, 0xE8, 0x30, 0xFF, 0xE4, 0x38, 0xFF, 0x66, 0xAB, 0xFF, 0x27, 0xFD,
-  0xFF, 0x23, 0xFD, 0xFF, 0xE1, 0xFC, 0xFF, 0x01, 0xFD, 0xFF, 0x02, 0xFD, 0xFF,
-  0xE4, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xA3, 0xFC, 0xFF, 0x84,
-  0xFC, 0xFF, 0xA4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x07, 0xF5, 0xFF, 0x48, 0xAB,
-  0xFF, 0xA3, 0x38, 0xFF, 0xE7, 0x28, 0xFF, 0xE9, 0x20, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0x09, 0x31, 0xFF,
-  0xC7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0x0D, 0x6B, 0xA7, 0x00, 0x00, 0x00, 0x94,
-  0xF6, 0x21, 0x4B, 0xED, 0xFF, 0xE5, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x22, 0xFD,
-  0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x07, 0xF5, 0xFF, 0x8D, 0xE5, 0xBE,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x54, 0xEE, 0x52, 0x27, 0xED, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0xE7, 0xEC, 0xFF, 0xEF, 0xF5, 0x83, 0xBA, 0xFE, 0x06, 0x79, 0xDE, 0x15, 0x69,
-  0x31, 0xE4, 0xC8, 0x20, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC9, 0x30,
-  0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC4, 0x40, 0xFF, 0xAA, 0xDC,
-  0xFF, 0xA4, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF,
-  0x22, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0xC4,
-  0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x23, 0xFD,
-  0xFF, 0xA5, 0xEC, 0xFF, 0x4A, 0xCC, 0xFF, 0xC2, 0x48, 0xFF, 0xC6, 0x30, 0xFF,
-  0xC8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xEA, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0x27, 0x29, 0xEA, 0x39,
-  0xCE, 0x27, 0x00, 0x00, 0x00, 0x10, 0xF6, 0x79, 0xC7, 0xE4, 0xFF, 0x04, 0xFD,
-  0xFF, 0x02, 0xFD, 0xFF, 0x22, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
-  0x07, 0xF5, 0xFF, 0x33, 0xF6, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xFF, 0x0B, 0x49, 0xED,
-  0xF0, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0x04, 0xFD, 0xFF, 0x06, 0xF5, 0xFF, 0x4A, 0xED, 0xFE, 0x18, 0xFF, 0x11, 0x00,
-  0x00, 0x00, 0x90, 0x7B, 0x8D, 0xE7, 0x20, 0xFF, 0x09, 0x31, 0xFF, 0xA8, 0x28,
-  0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0xA8, 0x30,
-  0xFF, 0x46, 0x59, 0xFF, 0x68, 0xDC, 0xFF, 0x25, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x02, 0xFD,
-  0xFF, 0xC2, 0xFC, 0xFF, 0x06, 0xFD, 0xFF, 0xCC, 0xE4, 0xFF, 0xA1, 0x48, 0xFF,
-  0xC6, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0x08, 0x29, 0xFF, 0x4E,
-  0x6B, 0xA7, 0x00, 0x00, 0x00, 0xF7, 0xFE, 0x08, 0x6B, 0xED, 0xF3, 0x06, 0xFD,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x23, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xF5, 0xFF,
-  0x04, 0xFD, 0xFF, 0x29, 0xED, 0xFF, 0xD6, 0xFE, 0x0E, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x70, 0xFE, 0x6A, 0xE6, 0xEC, 0xFF, 0xE5, 0xFC, 0xFF,
-  0xA3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x24, 0xF5, 0xFF, 0x06,
-  0xE5, 0xFF, 0x31, 0xF6, 0x6C, 0xF7, 0xFF, 0x04, 0xD7, 0xC5, 0x2F, 0xC6, 0x20,
-  0xEE, 0x09, 0x29, 0xFF, 0xEA, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x38, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9,
-  0x30, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xAA, 0x30, 0xFF, 0xAB,
-  0x30, 0xFF, 0xAA, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x20,
-  0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0x45, 0x59, 0xFF, 0xE8, 0xE4, 0xFF,
-  0xE2, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0xC4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF,
-  0xAC, 0xE4, 0xFF, 0xA1, 0x48, 0xFF, 0xC7, 0x38, 0xFF, 0xC8, 0x28, 0xFF, 0xE7,
-  0x20, 0xFF, 0x07, 0x21, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xE9, 0x20, 0xFF, 0xE9, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA8,
-  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xE9, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC7, 0x28, 0xF3, 0x56, 0xBD, 0x3E, 0x00, 0x00, 0x00, 0x72, 0xF6,
-  0x5C, 0xE7, 0xEC, 0xFF, 0x25, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0x03, 0xFD, 0xFF, 0xE4, 0xEC, 0xFF, 0x47, 0xED, 0xFF, 0xEE, 0xF5, 0x86, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0x1A, 0x29, 0xE5, 0xFF,
-  0xE5, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2,
-  0xF4, 0xFF, 0x46, 0xF5, 0xFF, 0x2A, 0xE5, 0xFF, 0xD4, 0xFE, 0x14, 0xFF, 0xFF,
-  0x01, 0xEE, 0x6A, 0xAC, 0x09, 0x21, 0xFF, 0xA9, 0x20, 0xFF,
-  0xA9, 0x30, 0xFF, 0x88, 0x30, 0xFF, 0x87, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xC7,
-  0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xAA,
-  0x30, 0xFF, 0xAA, 0x30, 0xFF, 0xAA, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0x08, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0x88, 0x30, 0xFF, 0x25, 0x51, 0xFF,
-  0xC7, 0xD4, 0xFF, 0x03, 0xF5, 0xFF, 0xC3, 0xFC, 0xFF, 0x82, 0xFC, 0xFF, 0xE4,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x01, 0xF5, 0xFF, 0x03, 0xFD,
-  0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xC6, 0xF4, 0xFF, 0xED, 0xE4, 0xFF, 0x60, 0x40, 0xFF, 0x87,
-  0x30, 0xFF, 0xEA, 0x30, 0xFF, 0xC7, 0x20, 0xFF, 0x28, 0x29, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xE9, 0x20, 0xFF, 0xE9, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x30, 0xFF, 0x88, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xE9, 0x30, 0xFF, 0x88,
-  0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x4C, 0x5A, 0xBD, 0xFF, 0xFF, 0x01, 0xD6, 0xFE,
-  0x0E, 0x8C, 0xE5, 0xF7, 0x26, 0xFD, 0xFF, 0x82, 0xFC, 0xFF,
-  0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0x06, 0xED, 0xFF, 0x6A,
-  0xE5, 0xFF, 0x92, 0xFE, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xCE, 0xED, 0xB6, 0xC6, 0xEC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0x27, 0xED,
-  0xFF, 0x30, 0xFE, 0x55, 0xF7, 0xFF, 0x04, 0x3C, 0xE6, 0x09, 0x08, 0x29, 0xE3,
-  0x0A, 0x31, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xE9, 0x38, 0xFF, 0xE9,
-  0x30, 0xFF, 0xC8, 0x20, 0xFF, 0x09, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0xE8, 0x30, 0xFF,
-  0x88, 0x30, 0xFF, 0xE5, 0x48, 0xFF, 0x69, 0xCC, 0xFF, 0x25, 0xED, 0xFF, 0x03,
-  0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD,
-  0xFF, 0x23, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0x02, 0xFD, 0xFF, 0x22, 0xFD, 0xFF, 0xE5, 0xE4, 0xFF, 0xC8, 0xB3, 0xFF, 0xC2,
-  0x48, 0xFF, 0xE9, 0x40, 0xFF, 0xA9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0xC8, 0x20, 0xFF,
-  0x09, 0x31, 0xFF, 0xA8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE9, 0x30, 0xFF, 0x09, 0x39, 0xFF, 0xC7, 0x28, 0xE7, 0x5A, 0xD6,
-  0x17, 0x00, 0x00, 0x00, 0x73, 0xFE, 0x4B, 0x09, 0xED, 0xFF, 0x05, 0xFD, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0x06,
-  0xED, 0xFF, 0xCD, 0xE5, 0xD2, 0x79, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFE, 0x24, 0x08,
-  0xE5, 0xFF, 0x05, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xC2, 0xFC,
-  0xFF, 0xC3, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x4A, 0xED, 0xFF, 0xD6, 0xF6, 0x15,
-  0x00, 0x00, 0x00, 0x90, 0x7B, 0x95, 0xA7, 0x20, 0xFF, 0xA8, 0x28, 0xFF, 0xC9,
-  0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0x09, 0x29,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0xA5,
-  0x8A, 0xFF, 0x08, 0xE5, 0xFF, 0x24, 0xF5, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0x27,
-  0xE5, 0xFF, 0xE6, 0x92, 0xFF, 0xC3, 0x40, 0xFF, 0x88, 0x30, 0xFF, 0xCB, 0x30,
-  0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0xE9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xA8,
-  0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0xA7, 0x20,
-  0xFF, 0x2F, 0x73, 0xA3, 0x00, 0x00, 0x00, 0x36, 0xFF, 0x0A, 0x6C, 0xED, 0xEB,
-  0x06, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0x04, 0xF5, 0xFF, 0x28, 0xE5, 0xFF, 0x93, 0xF6, 0x39, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xCE, 0xED, 0xAA, 0xE6, 0xEC, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD,
-  0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xA4, 0xFC, 0xFF, 0x08, 0xED, 0xFF,
-  0x51, 0xF6, 0x77, 0xF7, 0xFF, 0x04, 0x59, 0xCE, 0x1D, 0x69, 0x39, 0xE3, 0xC9,
-  0x30, 0xFF, 0xEA, 0x38, 0xFF, 0x68, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0x09, 0x31,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0x08, 0x29, 0xFF, 0xA7, 0x20, 0xFF, 0xC9, 0x30, 0xFF, 0xA7,
-  0x38, 0xFF, 0x80, 0x40, 0xFF, 0x6A, 0xCC, 0xFF, 0x27, 0xED, 0xFF, 0x24, 0xF5,
-  0xFF, 0xC3, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xF5, 0xFF, 0x07,
-  0xED, 0xFF, 0x8A, 0xCC, 0xFF, 0x02, 0x49, 0xFF, 0x85, 0x30, 0xFF, 0xEA, 0x38,
-  0xFF, 0xA9, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0x08, 0x29, 0xFF, 0xC8, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x30, 0xFF, 0xA8, 0x30, 0xFF, 0x87, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xE8, 0x28,
-  0xFF, 0x48, 0x31, 0xE6, 0xF8, 0xC5, 0x2B, 0x00, 0x00, 0x00, 0x72, 0xF6, 0x6A,
-  0xE7, 0xE4, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE5, 0xEC, 0xFF, 0xCC, 0xED, 0xC5, 0xF5, 0xFF,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xF6, 0x3E, 0x09, 0xE5,
-  0xFF, 0x04, 0xF5, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF,
-  0x04, 0xFD, 0xFF, 0x06, 0xF5, 0xFF, 0x4A, 0xE5, 0xFF, 0x15, 0xFF, 0x12, 0x00,
-  0x00, 0x00, 0xB5, 0x9C, 0x5D, 0xA8, 0x28, 0xF5, 0xCA, 0x30, 0xFF, 0xEA, 0x30,
-  0xFF, 0xE9, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0x29,
-  0x31, 0xFF, 0xA8, 0x28, 0xFF, 0x67, 0x30, 0xFF, 0x06, 0x49, 0xFF, 0x23, 0x59,
-  0xFF, 0xCA, 0xD4, 0xFF, 0x28, 0xE5, 0xFF, 0xE6, 0xEC, 0xFF, 0x05, 0xFD, 0xFF,
-  0x05, 0xFD, 0xFF, 0xC4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE6,
-  0xFC, 0xFF, 0xE8, 0xEC, 0xFF, 0x8B, 0xD4, 0xFF, 0x21, 0x51, 0xFF, 0x83, 0x30,
-  0xFF, 0x08, 0x39, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xE8, 0x30, 0xFF,
-  0xA7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xE9, 0x30,
-  0xFF, 0xE9, 0x30, 0xFF, 0xC7, 0x28, 0xFA, 0x53, 0x8C, 0x79, 0x00, 0x00, 0x00,
-  0x57, 0xFF, 0x0C, 0x8B, 0xE5, 0xF4, 0x05, 0xF5, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x07, 0xE5,
-  0xFF, 0x92, 0xFE, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF,
-  0x03, 0xF0, 0xED, 0xBB, 0x06, 0xED, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x24, 0xFD, 0xFF, 0xA3, 0xEC, 0xFF, 0x26,
-  0xED, 0xFF, 0xAD, 0xED, 0x9E, 0x39, 0xFF, 0x0A, 0xDB, 0xDE, 0x07, 0x0C, 0x4A,
-  0xCB, 0xA8, 0x20, 0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0x87, 0x28, 0xFF,
-  0xC7, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0x09, 0x29, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x88, 0x30,
-  0xFF, 0x85, 0x38, 0xFF, 0x43, 0x59, 0xFF, 0x88, 0xAB, 0xFF,
-  0xEA, 0xEC, 0xFF, 0xE7, 0xF4, 0xFF, 0xE5, 0xF4, 0xFF, 0xE4, 0xF4, 0xFF, 0x05,
-  0xFD, 0xFF, 0x27, 0xFD, 0xFF, 0x89, 0xDC, 0xFF, 0xAA, 0xBB, 0xFF, 0x65, 0x61,
-  0xFF, 0xE5, 0x40, 0xFF, 0x07, 0x31, 0xFF, 0xE7, 0x20, 0xFF, 0x08, 0x21, 0xFF,
-  0xC8, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0x09, 0x31, 0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xA8, 0x28,
-  0xFF, 0xE9, 0x28, 0xFF, 0x87, 0x18, 0xFF, 0xEB, 0x41, 0xD7,
-  0xBA, 0xD6, 0x0C, 0x00, 0x00, 0x00, 0xEE, 0xF5, 0x82, 0x27, 0xED, 0xFF, 0xC3,
-  0xF4, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC2, 0xFC,
-  0xFF, 0x05, 0xF5, 0xFF, 0xCD, 0xED, 0xD4, 0xB5, 0xFE, 0x06, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFE, 0x17, 0x08, 0xE5, 0xFE,
-  0x05, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03,
-  0xFD, 0xFF, 0x24, 0xFD, 0xFF, 0x08, 0xE5, 0xFF, 0x94, 0xF6, 0x3A, 0xFF, 0xFF,
-  0x01, 0x98, 0xBD, 0x36, 0x49, 0x31, 0xED, 0xA7, 0x28, 0xFF, 0xC7, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0x09, 0x29,
-  0xFF, 0xC9, 0x28, 0xFF, 0xAA, 0x30, 0xFF, 0x68, 0x30, 0xFF, 0xC6, 0x40, 0xFF,
-  0xA2, 0x40, 0xFF, 0x61, 0x69, 0xFF, 0xE4, 0x9A, 0xFF, 0x47, 0xCC, 0xFF, 0xA8,
-  0xD4, 0xFF, 0x27, 0xC4, 0xFF, 0x25, 0xA3, 0xFF, 0xA3, 0x69, 0xFF, 0x62, 0x38,
-  0xFF, 0xA5, 0x38, 0xFF, 0xA7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x08, 0x21, 0xFF,
-  0xC7, 0x18, 0xFF, 0x29, 0x29, 0xFF, 0xE9, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xA8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x08, 0x29, 0xF2,
+  0x38, 0xFF, 0xA5, 0x92, 0xFF, 0xCA, 0xEC, 0xFF, 0x07, 0xFD, 0xFF, 0x81, 0xE3,
+  0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x0B, 0xE2, 0xFC, 0xFF, 0xC1, 0xFC, 0xFF,
+  0xC2, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0x09, 0xED, 0xFF, 0x06, 0x9B, 0xFF, 0xA3,
+  0x38, 0xFF, 0xC7, 0x38, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE9, 0x30,
+  0xFF, 0xA8, 0x28, 0xFF, 0xB0, 0xC8, 0x28, 0xFF, 0x0E, 0xE9, 0x28, 0xFF, 0xC8,
+  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xF6, 0xD5, 0xAC, 0x55, 0x00, 0x00,
+  0x00, 0x94, 0xFE, 0x27, 0x08, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
+  0x03, 0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x04, 0xF5, 0xFF, 0x06, 0xED, 0xFF, 0x2F,
+  0xFE, 0x6C, 0x87, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x02, 0xF7, 0xFE,
+  0x08, 0x4B, 0xE5, 0xF2, 0x05, 0xF5, 0xFF, 0x83, 0xE3, 0xFC, 0xFF, 0x08, 0x06,
+  0xF5, 0xFF, 0xAD, 0xED, 0xCB, 0x36, 0xFF, 0x0A, 0x9A, 0xEE, 0x0B, 0xAA, 0x39,
+  0xD0, 0xE8, 0x20, 0xFF, 0x2A, 0x31, 0xFF, 0xA7, 0x20, 0xFF, 0xE8, 0x30, 0xFF,
+  0x82, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x00, 0xC8, 0x30, 0xFF, 0x82,
+  0xC9, 0x28, 0xFF, 0xA1, 0xC8, 0x28, 0xFF, 0x19, 0xC9, 0x28, 0xFF, 0xE8, 0x28,
+  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
+  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE4, 0x30, 0xFF, 0x60, 0x61, 0xFF, 0xA8,
+  0xDC, 0xFF, 0x05, 0xFD, 0xFF, 0xC2, 0xF4, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD,
+  0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF,
+  0xE5, 0xFC, 0xFF, 0xC5, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE9, 0xE4, 0xFF, 0xC5,
+  0x69, 0xFF, 0xA5, 0x38, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF, 0xB2,
+  0xC8, 0x28, 0xFF, 0x07, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0x48, 0x39, 0xDC,
+  0x9A, 0xEE, 0x0B, 0x00, 0x00, 0x00, 0xAF, 0xED, 0xA4, 0xE6, 0xF4, 0xFF, 0xC2,
+  0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x03, 0xE3, 0xFC, 0xFF, 0x26, 0xF5, 0xFF,
+  0x4A, 0xE5, 0xFC, 0x15, 0xFF, 0x09, 0x87, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+  0x00, 0x03, 0xAF, 0xE5, 0xAC, 0x06, 0xED, 0xFF, 0xE2, 0xFC, 0xFF, 0xE4, 0xFC,
+  0xFF, 0x81, 0xC3, 0xFC, 0xFF, 0x08, 0x05, 0xFD, 0xFF, 0x29, 0xED, 0xFF, 0x93,
+  0xFE, 0x2B, 0x00, 0x00, 0x00, 0xB1, 0x83, 0x8F, 0xC7, 0x18, 0xFB, 0xE9, 0x20,
+  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x82, 0xC8,
+  0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0xA1, 0xC8, 0x28, 0xFF, 0x00, 0xE8, 0x28,
+  0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x17, 0xA8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
+  0x28, 0xFF, 0xC8, 0x20, 0xFF, 0xE8, 0x30, 0xFF, 0xE4, 0x38, 0xFF, 0x66, 0xAB,
+  0xFF, 0x27, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0xE1, 0xFC, 0xFF, 0x01, 0xFD, 0xFF,
+  0x02, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xA3,
+  0xFC, 0xFF, 0x84, 0xFC, 0xFF, 0xA4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x07, 0xF5,
+  0xFF, 0x48, 0xAB, 0xFF, 0xA3, 0x38, 0xFF, 0xE7, 0x28, 0xFF, 0xE9, 0x20, 0xFF,
+  0xB1, 0xC8, 0x28, 0xFF, 0x0E, 0xA8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xC7, 0x28,
+  0xFF, 0xE7, 0x28, 0xFF, 0x0D, 0x6B, 0xA7, 0x00, 0x00, 0x00, 0x94, 0xF6, 0x21,
+  0x4B, 0xED, 0xFF, 0xE5, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x22, 0xFD, 0xFF, 0x02,
+  0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x07, 0xF5, 0xFF, 0x8D, 0xE5, 0xBE, 0x88, 0x00,
+  0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x03, 0x54, 0xEE, 0x52, 0x27, 0xED, 0xFF,
+  0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x81, 0xC3, 0xFC, 0xFF, 0x08, 0xE4, 0xFC,
+  0xFF, 0xE7, 0xEC, 0xFF, 0xEF, 0xF5, 0x83, 0xBA, 0xFE, 0x06, 0x79, 0xDE, 0x15,
+  0x69, 0x31, 0xE4, 0xC8, 0x20, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0x81,
+  0xC9, 0x30, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x82, 0xC9,
+  0x28, 0xFF, 0xA0, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x16, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xA8,
+  0x28, 0xFF, 0xC4, 0x40, 0xFF, 0xAA, 0xDC, 0xFF, 0xA4, 0xF4, 0xFF, 0x04, 0xFD,
+  0xFF, 0xE2, 0xFC, 0xFF, 0x22, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF,
+  0xA3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0xE2,
+  0xFC, 0xFF, 0x23, 0xFD, 0xFF, 0xA5, 0xEC, 0xFF, 0x4A, 0xCC, 0xFF, 0xC2, 0x48,
+  0xFF, 0xC6, 0x30, 0xFF, 0xC8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xAF, 0xC8, 0x28,
+  0xFF, 0x0F, 0xC9, 0x28, 0xFF, 0xEA, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x20,
+  0xFF, 0x27, 0x29, 0xEA, 0x39, 0xCE, 0x27, 0x00, 0x00, 0x00, 0x10, 0xF6, 0x79,
+  0xC7, 0xE4, 0xFF, 0x04, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x22, 0xFD, 0xFF, 0x02,
+  0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x07, 0xF5, 0xFF, 0x33, 0xF6, 0x63, 0x88, 0x00,
+  0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x01, 0x57, 0xFF, 0x0B, 0x49, 0xED, 0xF0,
+  0x81, 0xE4, 0xFC, 0xFF, 0x0A, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD,
+  0xFF, 0x06, 0xF5, 0xFF, 0x4A, 0xED, 0xFE, 0x18, 0xFF, 0x11, 0x00, 0x00, 0x00,
+  0x90, 0x7B, 0x8D, 0xE7, 0x20, 0xFF, 0x09, 0x31, 0xFF, 0xA8, 0x28, 0xFF, 0x81,
+  0xA9, 0x30, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x82, 0xC9,
+  0x28, 0xFF, 0xA1, 0xC8, 0x28, 0xFF, 0x0C, 0xC9, 0x28, 0xFF, 0xCA, 0x28, 0xFF,
+  0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
+  0x20, 0xFF, 0xA8, 0x30, 0xFF, 0x46, 0x59, 0xFF, 0x68, 0xDC, 0xFF, 0x25, 0xFD,
+  0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x81, 0x02, 0xFD, 0xFF, 0x81, 0xE3,
+  0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x81, 0x02, 0xFD, 0xFF, 0x05, 0xC2, 0xFC,
+  0xFF, 0x06, 0xFD, 0xFF, 0xCC, 0xE4, 0xFF, 0xA1, 0x48, 0xFF, 0xC6, 0x30, 0xFF,
+  0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x01, 0xC9,
+  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x00, 0xC8, 0x30, 0xFF,
+  0x82, 0xC8, 0x28, 0xFF, 0x83, 0xC9, 0x28, 0xFF, 0x83, 0xC8, 0x28, 0xFF, 0x0E,
+  0xC9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0x08, 0x29, 0xFF, 0x4E, 0x6B, 0xA7, 0x00,
+  0x00, 0x00, 0xF7, 0xFE, 0x08, 0x6B, 0xED, 0xF3, 0x06, 0xFD, 0xFF, 0xE3, 0xFC,
+  0xFF, 0x23, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xF5, 0xFF, 0x04, 0xFD, 0xFF,
+  0x29, 0xED, 0xFF, 0xD6, 0xFE, 0x0E, 0x88, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00,
+  0x00, 0x16, 0x70, 0xFE, 0x6A, 0xE6, 0xEC, 0xFF, 0xE5, 0xFC, 0xFF, 0xA3, 0xFC,
+  0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x24, 0xF5, 0xFF, 0x06, 0xE5, 0xFF,
+  0x31, 0xF6, 0x6C, 0xF7, 0xFF, 0x04, 0xD7, 0xC5, 0x2F, 0xC6, 0x20, 0xEE, 0x09,
+  0x29, 0xFF, 0xEA, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x38, 0xFF, 0xC8, 0x30,
+  0xFF, 0xC7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
+  0xA9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x9E, 0xC8, 0x28, 0xFF, 0x15, 0xE7, 0x28,
+  0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xAA, 0x30, 0xFF, 0xAB, 0x30, 0xFF,
+  0xAA, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0xC8,
+  0x28, 0xFF, 0xA8, 0x30, 0xFF, 0x45, 0x59, 0xFF, 0xE8, 0xE4, 0xFF, 0xE2, 0xF4,
+  0xFF, 0x04, 0xFD, 0xFF, 0xC4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
+  0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0x81,
+  0xC3, 0xFC, 0xFF, 0x08, 0xE4, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xAC, 0xE4, 0xFF,
+  0xA1, 0x48, 0xFF, 0xC7, 0x38, 0xFF, 0xC8, 0x28, 0xFF, 0xE7, 0x20, 0xFF, 0x07,
+  0x21, 0xFF, 0xE8, 0x28, 0xFF, 0x9D, 0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF,
+  0x81, 0xE9, 0x20, 0xFF, 0x02, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30,
+  0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x03, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9,
+  0x28, 0xFF, 0xA8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x10, 0xE9, 0x28, 0xFF,
+  0xE9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC7,
+  0x28, 0xF3, 0x56, 0xBD, 0x3E, 0x00, 0x00, 0x00, 0x72, 0xF6, 0x5C, 0xE7, 0xEC,
+  0xFF, 0x25, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
+  0xE4, 0xEC, 0xFF, 0x47, 0xED, 0xFF, 0xEE, 0xF5, 0x86, 0x89, 0x00, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x15, 0x14, 0xFF, 0x1A, 0x29, 0xE5, 0xFF, 0xE5, 0xF4,
+  0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xF4, 0xFF,
+  0x46, 0xF5, 0xFF, 0x2A, 0xE5, 0xFF, 0xD4, 0xFE, 0x14, 0xFF, 0xFF, 0x01, 0xEE,
+  0x6A, 0xAC, 0x09, 0x21, 0xFF, 0xA9, 0x20, 0xFF, 0xA9, 0x30, 0xFF, 0x88, 0x30,
+  0xFF, 0x87, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xC7, 0x20, 0xFF, 0xE8, 0x28, 0xFF,
+  0xA8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x81, 0xE7, 0x28,
+  0xFF, 0x00, 0xC9, 0x30, 0xFF, 0x82, 0xAA, 0x30, 0xFF, 0x0F, 0xC9, 0x28, 0xFF,
+  0xE8, 0x28, 0xFF, 0x08, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0x88, 0x30, 0xFF, 0x25,
+  0x51, 0xFF, 0xC7, 0xD4, 0xFF, 0x03, 0xF5, 0xFF, 0xC3, 0xFC, 0xFF, 0x82, 0xFC,
+  0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x01, 0xF5, 0xFF,
+  0x03, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0x82, 0xE3, 0xFC, 0xFF, 0x07, 0xC6, 0xF4,
+  0xFF, 0xED, 0xE4, 0xFF, 0x60, 0x40, 0xFF, 0x87, 0x30, 0xFF, 0xEA, 0x30, 0xFF,
+  0xC7, 0x20, 0xFF, 0x28, 0x29, 0xFF, 0xE8, 0x28, 0xFF, 0x9D, 0xC8, 0x28, 0xFF,
+  0x00, 0xC9, 0x28, 0xFF, 0x81, 0xE9, 0x20, 0xFF, 0x01, 0xC8, 0x28, 0xFF, 0xC8,
+  0x30, 0xFF, 0x81, 0xA8, 0x30, 0xFF, 0x17, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
+  0xE9, 0x28, 0xFF, 0xC9, 0x20, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
+  0x30, 0xFF, 0x88, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0xE9, 0x30, 0xFF, 0x88, 0x28,
+  0xFF, 0xC8, 0x30, 0xFF, 0x4C, 0x5A, 0xBD, 0xFF, 0xFF, 0x01, 0xD6, 0xFE, 0x0E,
+  0x8C, 0xE5, 0xF7, 0x26, 0xFD, 0xFF, 0x82, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x03,
+  0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0x06, 0xED, 0xFF, 0x6A, 0xE5, 0xFF, 0x92, 0xFE,
+  0x27, 0x89, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x0C, 0xCE, 0xED, 0xB6,
+  0xC6, 0xEC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x03,
+  0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0x27, 0xED, 0xFF, 0x30, 0xFE, 0x55, 0xF7, 0xFF,
+  0x04, 0x3C, 0xE6, 0x09, 0x08, 0x29, 0xE3, 0x0A, 0x31, 0xFF, 0x81, 0xC9, 0x30,
+  0xFF, 0x03, 0xE9, 0x38, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x20, 0xFF, 0x09, 0x29,
+  0xFF, 0xA1, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x1D, 0xC8, 0x28, 0xFF,
+  0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8,
+  0x28, 0xFF, 0xC7, 0x20, 0xFF, 0xE8, 0x30, 0xFF, 0x88, 0x30, 0xFF, 0xE5, 0x48,
+  0xFF, 0x69, 0xCC, 0xFF, 0x25, 0xED, 0xFF, 0x03, 0xFD, 0xFF, 0x23, 0xFD, 0xFF,
+  0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0x03,
+  0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x22, 0xFD,
+  0xFF, 0xE5, 0xE4, 0xFF, 0xC8, 0xB3, 0xFF, 0xC2, 0x48, 0xFF, 0xE9, 0x40, 0xFF,
+  0xA9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x9F, 0xC8, 0x28, 0xFF,
+  0x81, 0xE9, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x03, 0xA8, 0x30, 0xFF, 0xC8,
+  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x20, 0xFF, 0x01,
+  0x09, 0x31, 0xFF, 0xA8, 0x28, 0xFF, 0x81, 0xE9, 0x30, 0xFF, 0x0F, 0xC8, 0x28,
+  0xFF, 0xE9, 0x30, 0xFF, 0x09, 0x39, 0xFF, 0xC7, 0x28, 0xE7, 0x5A, 0xD6, 0x17,
+  0x00, 0x00, 0x00, 0x73, 0xFE, 0x4B, 0x09, 0xED, 0xFF, 0x05, 0xFD, 0xFF, 0xE3,
+  0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0x06, 0xED,
+  0xFF, 0xCD, 0xE5, 0xD2, 0x79, 0xFE, 0x05, 0x89, 0x00, 0x00, 0x00, 0x8A, 0x00,
+  0x00, 0x00, 0x14, 0xB5, 0xFE, 0x24, 0x08, 0xE5, 0xFF, 0x05, 0xFD, 0xFF, 0xE3,
+  0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE5, 0xFC,
+  0xFF, 0x4A, 0xED, 0xFF, 0xD6, 0xF6, 0x15, 0x00, 0x00, 0x00, 0x90, 0x7B, 0x95,
+  0xA7, 0x20, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC8,
+  0x28, 0xFF, 0xC8, 0x20, 0xFF, 0x09, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
+  0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x00, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF,
+  0x81, 0xC9, 0x30, 0xFF, 0x00, 0xC8, 0x30, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x07,
+  0xC8, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xA5, 0x38, 0xFF, 0xA5, 0x8A, 0xFF, 0x08,
+  0xE5, 0xFF, 0x24, 0xF5, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xE3,
+  0xFC, 0xFF, 0x01, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x81, 0xE2, 0xFC, 0xFF,
+  0x08, 0x02, 0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0x27, 0xE5, 0xFF, 0xE6, 0x92, 0xFF,
+  0xC3, 0x40, 0xFF, 0x88, 0x30, 0xFF, 0xCB, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xE8,
+  0x30, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x01, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
+  0x83, 0xC8, 0x30, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x0E, 0xC8, 0x20, 0xFF, 0xE9,
+  0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC8, 0x30,
+  0xFF, 0xA7, 0x28, 0xFF, 0xA7, 0x20, 0xFF, 0x2F, 0x73, 0xA3, 0x00, 0x00, 0x00,
+  0x36, 0xFF, 0x0A, 0x6C, 0xED, 0xEB, 0x06, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0x03,
+  0xFD, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x02, 0x04, 0xF5, 0xFF, 0x28, 0xE5, 0xFF,
+  0x93, 0xF6, 0x39, 0x8A, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x13, 0xCE,
+  0xED, 0xAA, 0xE6, 0xEC, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xC2, 0xFC,
+  0xFF, 0xE3, 0xFC, 0xFF, 0xA4, 0xFC, 0xFF, 0x08, 0xED, 0xFF, 0x51, 0xF6, 0x77,
+  0xF7, 0xFF, 0x04, 0x59, 0xCE, 0x1D, 0x69, 0x39, 0xE3, 0xC9, 0x30, 0xFF, 0xEA,
+  0x38, 0xFF, 0x68, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xE8, 0x28,
+  0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xA2, 0xC8, 0x28, 0xFF, 0x81, 0xC8,
+  0x30, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x08, 0x08, 0x29,
+  0xFF, 0xA7, 0x20, 0xFF, 0xC9, 0x30, 0xFF, 0xA7, 0x38, 0xFF, 0x80, 0x40, 0xFF,
+  0x6A, 0xCC, 0xFF, 0x27, 0xED, 0xFF, 0x24, 0xF5, 0xFF, 0xC3, 0xF4, 0xFF, 0x81,
+  0xE4, 0xFC, 0xFF, 0x83, 0xE3, 0xFC, 0xFF, 0x07, 0x04, 0xF5, 0xFF, 0x07, 0xED,
+  0xFF, 0x8A, 0xCC, 0xFF, 0x02, 0x49, 0xFF, 0x85, 0x30, 0xFF, 0xEA, 0x38, 0xFF,
+  0xA9, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0xA0, 0xC8, 0x28,
+  0xFF, 0x82, 0xC8, 0x30, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF,
+  0x0F, 0x08, 0x29, 0xFF, 0xC8, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF,
+  0xA8, 0x30, 0xFF, 0x87, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xE8, 0x28, 0xFF, 0x48,
+  0x31, 0xE6, 0xF8, 0xC5, 0x2B, 0x00, 0x00, 0x00, 0x72, 0xF6, 0x6A, 0xE7, 0xE4,
+  0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x81, 0xE3, 0xFC,
+  0xFF, 0x02, 0xE5, 0xEC, 0xFF, 0xCC, 0xED, 0xC5, 0xF5, 0xFF, 0x03, 0x8A, 0x00,
+  0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x12, 0x74, 0xF6, 0x3E, 0x09, 0xE5, 0xFF,
+  0x04, 0xF5, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0x04,
+  0xFD, 0xFF, 0x06, 0xF5, 0xFF, 0x4A, 0xE5, 0xFF, 0x15, 0xFF, 0x12, 0x00, 0x00,
+  0x00, 0xB5, 0x9C, 0x5D, 0xA8, 0x28, 0xF5, 0xCA, 0x30, 0xFF, 0xEA, 0x30, 0xFF,
+  0xE9, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xC7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x9F,
+  0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xC8,
+  0x30, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x08, 0xC7, 0x20,
+  0xFF, 0x29, 0x31, 0xFF, 0xA8, 0x28, 0xFF, 0x67, 0x30, 0xFF, 0x06, 0x49, 0xFF,
+  0x23, 0x59, 0xFF, 0xCA, 0xD4, 0xFF, 0x28, 0xE5, 0xFF, 0xE6, 0xEC, 0xFF, 0x81,
+  0x05, 0xFD, 0xFF, 0x0C, 0xC4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF,
+  0xE6, 0xFC, 0xFF, 0xE8, 0xEC, 0xFF, 0x8B, 0xD4, 0xFF, 0x21, 0x51, 0xFF, 0x83,
+  0x30, 0xFF, 0x08, 0x39, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xE8, 0x30,
+  0xFF, 0xA7, 0x28, 0xFF, 0xA0, 0xC8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x02,
+  0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF,
+  0x04, 0xC8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF,
+  0xC9, 0x30, 0xFF, 0x81, 0xE9, 0x30, 0xFF, 0x05, 0xC7, 0x28, 0xFA, 0x53, 0x8C,
+  0x79, 0x00, 0x00, 0x00, 0x57, 0xFF, 0x0C, 0x8B, 0xE5, 0xF4, 0x05, 0xF5, 0xFF,
+  0x82, 0xE3, 0xFC, 0xFF, 0x03, 0xE2, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x07, 0xE5,
+  0xFF, 0x92, 0xFE, 0x4F, 0x8B, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x12,
+  0xF5, 0xFF, 0x03, 0xF0, 0xED, 0xBB, 0x06, 0xED, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3,
+  0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x24, 0xFD, 0xFF, 0xA3, 0xEC, 0xFF, 0x26, 0xED,
+  0xFF, 0xAD, 0xED, 0x9E, 0x39, 0xFF, 0x0A, 0xDB, 0xDE, 0x07, 0x0C, 0x4A, 0xCB,
+  0xA8, 0x20, 0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0x87, 0x28, 0xFF, 0xC7,
+  0x30, 0xFF, 0xE8, 0x30, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x00, 0xC8, 0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81,
+  0xE8, 0x28, 0xFF, 0x16, 0x09, 0x29, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
+  0x88, 0x30, 0xFF, 0x85, 0x38, 0xFF, 0x43, 0x59, 0xFF, 0x88, 0xAB, 0xFF, 0xEA,
+  0xEC, 0xFF, 0xE7, 0xF4, 0xFF, 0xE5, 0xF4, 0xFF, 0xE4, 0xF4, 0xFF, 0x05, 0xFD,
+  0xFF, 0x27, 0xFD, 0xFF, 0x89, 0xDC, 0xFF, 0xAA, 0xBB, 0xFF, 0x65, 0x61, 0xFF,
+  0xE5, 0x40, 0xFF, 0x07, 0x31, 0xFF, 0xE7, 0x20, 0xFF, 0x08, 0x21, 0xFF, 0xC8,
+  0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xA0, 0xC8, 0x28, 0xFF, 0x01,
+  0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28,
+  0xFF, 0x02, 0xC8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xC9, 0x30, 0xFF, 0x81, 0xA8,
+  0x28, 0xFF, 0x0E, 0xE9, 0x28, 0xFF, 0x87, 0x18, 0xFF, 0xEB, 0x41, 0xD7, 0xBA,
+  0xD6, 0x0C, 0x00, 0x00, 0x00, 0xEE, 0xF5, 0x82, 0x27, 0xED, 0xFF, 0xC3, 0xF4,
+  0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF,
+  0x05, 0xF5, 0xFF, 0xCD, 0xED, 0xD4, 0xB5, 0xFE, 0x06, 0x8B, 0x00, 0x00, 0x00,
+  0x8C, 0x00, 0x00, 0x00, 0x0E, 0xF6, 0xFE, 0x17, 0x08, 0xE5, 0xFE, 0x05, 0xF5,
+  0xFF, 0xE4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
+  0x24, 0xFD, 0xFF, 0x08, 0xE5, 0xFF, 0x94, 0xF6, 0x3A, 0xFF, 0xFF, 0x01, 0x98,
+  0xBD, 0x36, 0x49, 0x31, 0xED, 0xA7, 0x28, 0xFF, 0xC7, 0x30, 0xFF, 0x82, 0xC8,
+  0x30, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28,
+  0xFF, 0x02, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xE8,
+  0x28, 0xFF, 0x17, 0xA7, 0x20, 0xFF, 0x09, 0x29, 0xFF, 0xC9, 0x28, 0xFF, 0xAA,
+  0x30, 0xFF, 0x68, 0x30, 0xFF, 0xC6, 0x40, 0xFF, 0xA2, 0x40, 0xFF, 0x61, 0x69,
+  0xFF, 0xE4, 0x9A, 0xFF, 0x47, 0xCC, 0xFF, 0xA8, 0xD4, 0xFF, 0x27, 0xC4, 0xFF,
+  0x25, 0xA3, 0xFF, 0xA3, 0x69, 0xFF, 0x62, 0x38, 0xFF, 0xA5, 0x38, 0xFF, 0xA7,
+  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x08, 0x21, 0xFF, 0xC7, 0x18, 0xFF, 0x29, 0x29,
+  0xFF, 0xE9, 0x28, 0xFF, 0xA8, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0xA0, 0xC8, 0x28,
+  0xFF, 0x84, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xA8, 0x28, 0xFF,
+  0x0F, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x08, 0x29, 0xF2,
   0x36, 0xAD, 0x50, 0x00, 0x00, 0x00, 0xB4, 0xF6, 0x32, 0x08, 0xED, 0xFF, 0xE4,
   0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x23, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0x28, 0xED, 0xFF, 0xB4, 0xFE, 0x24, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x01, 0x0F, 0xF6, 0xA4, 0xC6, 0xE4, 0xFF, 0x05, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xC1, 0xFC, 0xFF, 0x23, 0xFD, 0xFF, 0xE5, 0xEC,
-  0xFF, 0x8C, 0xED, 0xD7, 0xF7, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0xD1, 0x7B, 0x8B,
-  0xC6, 0x28, 0xFE, 0xC7, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC9,
-  0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xAA, 0x30, 0xFF,
-  0xAA, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xE4, 0x30, 0xFF, 0xE3,
-  0x30, 0xFF, 0xC3, 0x38, 0xFF, 0xC3, 0x38, 0xFF, 0xC4, 0x38, 0xFF, 0xC4, 0x38,
-  0xFF, 0xC5, 0x38, 0xFF, 0xC6, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30,
-  0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x20, 0xFF,
-  0x08, 0x29, 0xFF, 0x50, 0x6B, 0x9C, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x04, 0xAC,
-  0xED, 0xBC, 0xC5, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC5, 0xE4, 0xFF, 0x0E, 0xF6, 0xBB,
-  0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xF6, 0x1E, 0x8C, 0xED, 0xFA, 0x06,
-  0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC,
-  0xFF, 0x04, 0xFD, 0xFF, 0x08, 0xF5, 0xFF, 0xF0, 0xF5, 0x78,
-  0xBA, 0xFE, 0x06, 0xBA, 0xD6, 0x13, 0xA8, 0x39, 0xD9, 0x27, 0x29, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x88, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xAA, 0x28, 0xFF, 0xAA, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30,
+  0xFF, 0xE4, 0xFC, 0xFF, 0x28, 0xED, 0xFF, 0xB4, 0xFE, 0x24, 0x8C, 0x00, 0x00,
+  0x00, 0x8C, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x01, 0x0F, 0xF6, 0xA4, 0xC6,
+  0xE4, 0xFF, 0x05, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xC1, 0xFC,
+  0xFF, 0x23, 0xFD, 0xFF, 0xE5, 0xEC, 0xFF, 0x8C, 0xED, 0xD7, 0xF7, 0xFE, 0x0F,
+  0x00, 0x00, 0x00, 0xD1, 0x7B, 0x8B, 0xC6, 0x28, 0xFE, 0xC7, 0x28, 0xFF, 0xE8,
+  0x30, 0xFF, 0xA8, 0x28, 0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x9E, 0xC8, 0x28, 0xFF,
+  0x82, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x00,
+  0xC8, 0x28, 0xFF, 0x83, 0xE8, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xAA,
+  0x30, 0xFF, 0x03, 0xA9, 0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xE4, 0x30, 0xFF, 0xE3,
+  0x30, 0xFF, 0x81, 0xC3, 0x38, 0xFF, 0x81, 0xC4, 0x38, 0xFF, 0x04, 0xC5, 0x38,
+  0xFF, 0xC6, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF,
+  0x82, 0xC9, 0x28, 0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0xA0,
+  0xC8, 0x28, 0xFF, 0x84, 0xC9, 0x28, 0xFF, 0x82, 0xC9, 0x30, 0xFF, 0x10, 0xA9,
+  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0x50, 0x6B,
+  0x9C, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x04, 0xAC, 0xED, 0xBC, 0xC5, 0xF4, 0xFF,
+  0x04, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4,
+  0xFC, 0xFF, 0xC5, 0xE4, 0xFF, 0x0E, 0xF6, 0xBB, 0xFF, 0xFF, 0x02, 0x8C, 0x00,
+  0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x03, 0x74, 0xF6, 0x1E, 0x8C, 0xED, 0xFA,
+  0x06, 0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0x02, 0xFD, 0xFF, 0x0C, 0xE2, 0xFC,
+  0xFF, 0x04, 0xFD, 0xFF, 0x08, 0xF5, 0xFF, 0xF0, 0xF5, 0x78, 0xBA, 0xFE, 0x06,
+  0xBA, 0xD6, 0x13, 0xA8, 0x39, 0xD9, 0x27, 0x29, 0xFF, 0xE8, 0x28, 0xFF, 0xC9,
+  0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x88, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x9D, 0xC8,
+  0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x01, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81,
+  0xE8, 0x28, 0xFF, 0x06, 0xC9, 0x28, 0xFF, 0xAA, 0x28, 0xFF, 0xAA, 0x30, 0xFF,
+  0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x82,
+  0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF, 0x82, 0xC9,
+  0x28, 0xFF, 0x03, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9,
+  0x28, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x00, 0xE8, 0x28, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x0F, 0xCA, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30,
   0xFF, 0x88, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xCA, 0x28, 0xFF, 0x88, 0x20, 0xFF,
   0x29, 0x31, 0xFF, 0x89, 0x39, 0xE0, 0x3A, 0xD6, 0x1B, 0x00, 0x00, 0x00, 0x30,
-  0xF6, 0x64, 0x28, 0xED, 0xFF, 0xE4, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x05, 0xF5, 0xFF,
-  0x6B, 0xED, 0xFF, 0x73, 0xEE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x52, 0xFE, 0x61, 0x07, 0xED, 0xFF, 0xE3, 0xF4, 0xFF, 0x03, 0xFD,
-  0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE5, 0xFC, 0xFF,
-  0x29, 0xF5, 0xFF, 0xD4, 0xFE, 0x22, 0x00, 0x00, 0x00, 0x79, 0xCE, 0x19, 0x27,
-  0x21, 0xE7, 0x49, 0x29, 0xFF, 0xA8, 0x20, 0xFF, 0xEA, 0x28, 0xFF, 0xEA, 0x30,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF,
-  0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xA9, 0x30,
-  0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xEA, 0x38, 0xFF, 0xA8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xE7, 0x28, 0xEE, 0xB7, 0xC5, 0x2A, 0x00,
-  0x00, 0x00, 0xF5, 0xFE, 0x1E, 0x4A, 0xED, 0xFF, 0xE5, 0xF4, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xA3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xF4, 0xFF,
-  0x06, 0xED, 0xFF, 0x52, 0xEE, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFE, 0x0E, 0x6B, 0xED,
-  0xE1, 0xC5, 0xEC, 0xFF, 0x04, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xC2, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0x6B, 0xED, 0xE5, 0x15,
-  0xFF, 0x12, 0x00, 0x00, 0x00, 0x32, 0x84, 0x7E, 0xC7, 0x18, 0xF5, 0x09, 0x29,
-  0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE7,
-  0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xA8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x07, 0x29, 0xFD, 0x6F,
-  0x83, 0x91, 0x00, 0x00, 0x00, 0x18, 0xFF, 0x09, 0xAE, 0xE5, 0xC3, 0xE6, 0xF4,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0x05, 0xFD, 0xFF, 0xC5, 0xEC, 0xFF, 0x8B, 0xED, 0xF1, 0xD6, 0xF6, 0x15, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x92, 0xFE, 0x31, 0x4A, 0xED, 0xFF, 0x05, 0xF5, 0xFF, 0x03, 0xFD, 0xFF,
-  0x03, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE6,
-  0xF4, 0xFF, 0x2E, 0xFE, 0x8E, 0xF7, 0xFE, 0x08, 0x00, 0x00, 0x00, 0xEF, 0x62,
-  0xB3, 0x08, 0x21, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x30, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF,
-  0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30,
-  0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x20, 0xFF, 0x2B,
-  0x52, 0xC3, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x30, 0xFE, 0x75, 0x28, 0xED,
-  0xFF, 0xE5, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF,
-  0xE4, 0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0x49, 0xED, 0xFF, 0x72, 0xFE, 0x4A, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xED, 0x8E,
-  0x07, 0xE5, 0xFF, 0x04, 0xF5, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC4,
-  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xF4, 0xFF, 0x07, 0xED, 0xFF, 0x92, 0xFE,
-  0x3E, 0xFF, 0xFF, 0x02, 0x3A, 0xD6, 0x12, 0x69, 0x31, 0xDA, 0xC7, 0x28, 0xFF,
-  0xC7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30,
-  0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA9, 0x30,
-  0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x28, 0xFF,
-  0xE7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0x28,
-  0x29, 0xFF, 0x28, 0x31, 0xEE, 0x7A, 0xDE, 0x1E, 0x00, 0x00, 0x00, 0xD4, 0xFE,
-  0x31, 0x09, 0xE5, 0xFF, 0x06, 0xF5, 0xFF, 0xC4, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF,
-  0x24, 0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0xE4, 0xF4, 0xFF, 0x06, 0xED, 0xFF, 0xEF,
-  0xED, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xD6, 0xF6, 0x14, 0x8B, 0xED, 0xE4, 0x05, 0xED, 0xFF, 0xE3,
-  0xF4, 0xFF, 0x24, 0xFD, 0xFF, 0xC3, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0x24, 0xFD,
-  0xFF, 0xC4, 0xEC, 0xFF, 0x4A, 0xED, 0xFF, 0xF5, 0xFE, 0x28, 0x00, 0x00, 0x00,
-  0xFA, 0xC5, 0x2A, 0x89, 0x39, 0xDE, 0x07, 0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC9,
-  0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30, 0xFF,
-  0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0x28,
-  0x29, 0xFF, 0x07, 0x29, 0xEF, 0xB9, 0xBD, 0x3E, 0x00, 0x00, 0x00, 0xB6, 0xFE,
-  0x24, 0x4C, 0xE5, 0xFF, 0xC5, 0xEC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0xC4, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0x24, 0xFD, 0xFF, 0x02, 0xF5, 0xFF, 0x03,
-  0xF5, 0xFF, 0x89, 0xF5, 0xF0, 0x94, 0xF6, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFE, 0x27, 0x28,
-  0xE5, 0xFF, 0x25, 0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC5, 0xEC, 0xFF, 0x6B, 0xED, 0xEA,
-  0xF7, 0xFE, 0x10, 0x00, 0x00, 0x00, 0xF5, 0xAC, 0x53, 0xC6, 0x28, 0xF0, 0xC8,
-  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC9, 0x30, 0xFF, 0xCA, 0x28, 0xFF, 0xCA, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7,
-  0x28, 0xFF, 0xE7, 0x28, 0xFF, 0x27, 0x29, 0xF9, 0x73, 0x94, 0x6B, 0x00, 0x00,
-  0x00, 0x39, 0xFF, 0x0A, 0xAF, 0xED, 0xC3, 0xE8, 0xEC, 0xFF, 0x05, 0xFD, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x24,
-  0xF5, 0xFF, 0x26, 0xED, 0xFF, 0x70, 0xFE, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xEE, 0x88, 0x06, 0xE5, 0xFF, 0x03, 0xFD,
-  0xFF, 0x23, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0xCC, 0xED, 0xB5, 0xD6, 0xFE, 0x0D, 0x00,
-  0x00, 0x00, 0x95, 0xA4, 0x65, 0xE8, 0x38, 0xEF, 0xA8, 0x30, 0xFF, 0xE9, 0x30,
-  0xFF, 0xC9, 0x28, 0xFF, 0x88, 0x20, 0xFF, 0x0A, 0x31, 0xFF, 0xA9, 0x28, 0xFF,
-  0xA8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xEA, 0x20, 0xFF, 0xEA, 0x20,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xA8,
-  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x88, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x28, 0x29, 0xFF, 0x07, 0x21, 0xFB, 0x52, 0x8C,
-  0x7C, 0x00, 0x00, 0x00, 0xBA, 0xFE, 0x06, 0xAF, 0xED, 0x96, 0x09, 0xED, 0xFF,
-  0xE5, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x04,
-  0xFD, 0xFF, 0x04, 0xF5, 0xFF, 0xE6, 0xDC, 0xFF, 0x0F, 0xF6, 0xA1, 0xFF, 0xFF,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFE, 0x06, 0xEC, 0xED,
-  0xC2, 0xE4, 0xE4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xF5, 0xFF, 0x27,
-  0xED, 0xFF, 0x2F, 0xFE, 0x77, 0x39, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x71, 0x83,
-  0x8D, 0xE8, 0x30, 0xF4, 0xA8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x09, 0x31, 0xFF,
-  0xA8, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x09, 0x39, 0xFF, 0xA8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x20, 0xFF, 0x6F, 0x73,
-  0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFE, 0x66, 0x29, 0xED, 0xFF,
-  0xE5, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC6, 0xE4, 0xFF, 0xCD, 0xF5, 0xD3, 0xB5, 0xFE,
-  0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xF4, 0xF6, 0x1F, 0x8B, 0xE5, 0xFF, 0xE5, 0xF4, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x05,
-  0xFD, 0xFF, 0xC4, 0xF4, 0xFF, 0x08, 0xED, 0xFF, 0x51, 0xF6, 0x6A, 0xF7, 0xFF,
-  0x04, 0x00, 0x00, 0x00, 0xF3, 0x8B, 0x89, 0xE8, 0x28, 0xF4, 0xE9, 0x28, 0xFF,
-  0xC8, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0x08, 0x29, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28,
-  0xFF, 0x70, 0x7B, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xF6, 0x60,
-  0x28, 0xED, 0xFF, 0xE3, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE5, 0xEC, 0xFF, 0x4B, 0xED,
-  0xFF, 0x95, 0xFE, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF6, 0x64, 0x28, 0xED, 0xFF, 0xE4, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0x81, 0xE3,
+  0xFC, 0xFF, 0x03, 0x03, 0xFD, 0xFF, 0x05, 0xF5, 0xFF, 0x6B, 0xED, 0xFF, 0x73,
+  0xEE, 0x30, 0x8D, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x02, 0x52, 0xFE,
+  0x61, 0x07, 0xED, 0xFF, 0xE3, 0xF4, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x0C, 0xC2,
+  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE5, 0xFC, 0xFF, 0x29, 0xF5, 0xFF, 0xD4, 0xFE,
+  0x22, 0x00, 0x00, 0x00, 0x79, 0xCE, 0x19, 0x27, 0x21, 0xE7, 0x49, 0x29, 0xFF,
+  0xA8, 0x20, 0xFF, 0xEA, 0x28, 0xFF, 0xEA, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0x9D,
+  0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xE7, 0x28, 0xFF, 0x81, 0xC9,
+  0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x82, 0xE8, 0x28,
+  0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF,
+  0x83, 0xC9, 0x28, 0xFF, 0x82, 0xE9, 0x28, 0xFF, 0x00, 0xE8, 0x28, 0xFF, 0x81,
+  0xC8, 0x28, 0xFF, 0x01, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28,
+  0xFF, 0x9E, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF,
+  0x00, 0xCA, 0x28, 0xFF, 0x82, 0xA9, 0x30, 0xFF, 0x0B, 0xEA, 0x38, 0xFF, 0xA8,
+  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xE7, 0x28, 0xEE, 0xB7, 0xC5,
+  0x2A, 0x00, 0x00, 0x00, 0xF5, 0xFE, 0x1E, 0x4A, 0xED, 0xFF, 0xE5, 0xF4, 0xFF,
+  0xE4, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x02, 0xE3, 0xF4,
+  0xFF, 0x06, 0xED, 0xFF, 0x52, 0xEE, 0x7A, 0x8E, 0x00, 0x00, 0x00, 0x8E, 0x00,
+  0x00, 0x00, 0x11, 0xD6, 0xFE, 0x0E, 0x6B, 0xED, 0xE1, 0xC5, 0xEC, 0xFF, 0x04,
+  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE4, 0xFC,
+  0xFF, 0xE6, 0xF4, 0xFF, 0x6B, 0xED, 0xE5, 0x15, 0xFF, 0x12, 0x00, 0x00, 0x00,
+  0x32, 0x84, 0x7E, 0xC7, 0x18, 0xF5, 0x09, 0x29, 0xFF, 0xC9, 0x28, 0xFF, 0xA9,
+  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x9D, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF,
+  0x81, 0xE7, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81,
+  0xC9, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x82, 0xE7, 0x28, 0xFF, 0x81, 0xE8,
+  0x28, 0xFF, 0x01, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xC9, 0x30, 0xFF,
+  0x82, 0xC9, 0x28, 0xFF, 0x02, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28,
+  0xFF, 0x83, 0xC8, 0x30, 0xFF, 0x01, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x9F,
+  0xC8, 0x28, 0xFF, 0x01, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28,
+  0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x0B, 0xC8, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC9,
+  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x07, 0x29, 0xFD, 0x6F, 0x83, 0x91, 0x00, 0x00,
+  0x00, 0x18, 0xFF, 0x09, 0xAE, 0xE5, 0xC3, 0xE6, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF,
+  0xC3, 0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x03, 0x05, 0xFD, 0xFF, 0xC5, 0xEC,
+  0xFF, 0x8B, 0xED, 0xF1, 0xD6, 0xF6, 0x15, 0x8E, 0x00, 0x00, 0x00, 0x8F, 0x00,
+  0x00, 0x00, 0x02, 0x92, 0xFE, 0x31, 0x4A, 0xED, 0xFF, 0x05, 0xF5, 0xFF, 0x81,
+  0x03, 0xFD, 0xFF, 0x0A, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF,
+  0xE6, 0xF4, 0xFF, 0x2E, 0xFE, 0x8E, 0xF7, 0xFE, 0x08, 0x00, 0x00, 0x00, 0xEF,
+  0x62, 0xB3, 0x08, 0x21, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0x9E, 0xC8,
+  0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF,
+  0x82, 0xE7, 0x28, 0xFF, 0x02, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30,
+  0xFF, 0x83, 0xA9, 0x30, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF,
+  0x00, 0xC9, 0x30, 0xFF, 0x82, 0xA9, 0x30, 0xFF, 0x02, 0xA8, 0x30, 0xFF, 0xC8,
+  0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xA1, 0xC8, 0x28, 0xFF, 0x83, 0xC9, 0x28, 0xFF,
+  0x81, 0xC8, 0x30, 0xFF, 0x08, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x20,
+  0xFF, 0x2B, 0x52, 0xC3, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x30, 0xFE, 0x75,
+  0x28, 0xED, 0xFF, 0xE5, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x04, 0x04, 0xFD,
+  0xFF, 0xE4, 0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0x49, 0xED, 0xFF, 0x72, 0xFE, 0x4A,
+  0x8F, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x0C, 0xEF, 0xED, 0x8E, 0x07,
+  0xE5, 0xFF, 0x04, 0xF5, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC4, 0xFC,
+  0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xF4, 0xFF, 0x07, 0xED, 0xFF, 0x92, 0xFE, 0x3E,
+  0xFF, 0xFF, 0x02, 0x3A, 0xD6, 0x12, 0x69, 0x31, 0xDA, 0x81, 0xC7, 0x28, 0xFF,
+  0x9E, 0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x81,
+  0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x83, 0xC8,
+  0x30, 0xFF, 0x02, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0x81,
+  0xE8, 0x28, 0xFF, 0x02, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF,
+  0x81, 0xA9, 0x30, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x00,
+  0xC8, 0x30, 0xFF, 0x82, 0xA9, 0x30, 0xFF, 0x02, 0xA8, 0x30, 0xFF, 0xC8, 0x28,
+  0xFF, 0xE7, 0x28, 0xFF, 0xA1, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81,
+  0xC8, 0x28, 0xFF, 0x0F, 0xE8, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0x28, 0x29, 0xFF,
+  0x28, 0x31, 0xEE, 0x7A, 0xDE, 0x1E, 0x00, 0x00, 0x00, 0xD4, 0xFE, 0x31, 0x09,
+  0xE5, 0xFF, 0x06, 0xF5, 0xFF, 0xC4, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0x24, 0xFD,
+  0xFF, 0x03, 0xF5, 0xFF, 0xE4, 0xF4, 0xFF, 0x06, 0xED, 0xFF, 0xEF, 0xED, 0xA7,
+  0x90, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x0E, 0xD6, 0xF6, 0x14, 0x8B,
+  0xED, 0xE4, 0x05, 0xED, 0xFF, 0xE3, 0xF4, 0xFF, 0x24, 0xFD, 0xFF, 0xC3, 0xF4,
+  0xFF, 0x04, 0xFD, 0xFF, 0x24, 0xFD, 0xFF, 0xC4, 0xEC, 0xFF, 0x4A, 0xED, 0xFF,
+  0xF5, 0xFE, 0x28, 0x00, 0x00, 0x00, 0xFA, 0xC5, 0x2A, 0x89, 0x39, 0xDE, 0x07,
+  0x31, 0xFF, 0x9F, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x81, 0xC8, 0x28,
+  0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x83, 0xC8, 0x30, 0xFF,
+  0x82, 0xC9, 0x28, 0xFF, 0x04, 0xE8, 0x28, 0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x28,
+  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x81, 0xC9,
+  0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x03, 0xC8, 0x30, 0xFF, 0xC9, 0x30, 0xFF,
+  0xA9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0xA1, 0xC8, 0x28,
+  0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x00, 0xE8, 0x28, 0xFF, 0x81, 0xE7, 0x28, 0xFF,
+  0x0E, 0x28, 0x29, 0xFF, 0x07, 0x29, 0xEF, 0xB9, 0xBD, 0x3E, 0x00, 0x00, 0x00,
+  0xB6, 0xFE, 0x24, 0x4C, 0xE5, 0xFF, 0xC5, 0xEC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4,
+  0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0x24, 0xFD, 0xFF, 0x02, 0xF5, 0xFF, 0x03, 0xF5,
+  0xFF, 0x89, 0xF5, 0xF0, 0x94, 0xF6, 0x1C, 0x90, 0x00, 0x00, 0x00, 0x91, 0x00,
+  0x00, 0x00, 0x0D, 0x92, 0xFE, 0x27, 0x28, 0xE5, 0xFF, 0x25, 0xF5, 0xFF, 0x03,
+  0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD,
+  0xFF, 0xC5, 0xEC, 0xFF, 0x6B, 0xED, 0xEA, 0xF7, 0xFE, 0x10, 0x00, 0x00, 0x00,
+  0xF5, 0xAC, 0x53, 0xC6, 0x28, 0xF0, 0x81, 0xC8, 0x30, 0xFF, 0x83, 0xC8, 0x28,
+  0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x85, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF,
+  0x8C, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x00,
+  0xC8, 0x28, 0xFF, 0x83, 0xC9, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x82, 0xC8,
+  0x30, 0xFF, 0x00, 0xC9, 0x30, 0xFF, 0x81, 0xCA, 0x28, 0xFF, 0x01, 0xC9, 0x28,
+  0xFF, 0xE8, 0x28, 0xFF, 0x81, 0xE8, 0x20, 0xFF, 0x02, 0xE8, 0x28, 0xFF, 0xC8,
+  0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF, 0x92,
+  0xC8, 0x28, 0xFF, 0x83, 0xC9, 0x28, 0xFF, 0x8A, 0xC8, 0x28, 0xFF, 0x81, 0xC9,
+  0x28, 0xFF, 0x01, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x81, 0xE7, 0x28, 0xFF,
+  0x0D, 0x27, 0x29, 0xF9, 0x73, 0x94, 0x6B, 0x00, 0x00, 0x00, 0x39, 0xFF, 0x0A,
+  0xAF, 0xED, 0xC3, 0xE8, 0xEC, 0xFF, 0x05, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4,
+  0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x24, 0xF5, 0xFF, 0x26, 0xED,
+  0xFF, 0x70, 0xFE, 0x3A, 0x91, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x15,
+  0x30, 0xEE, 0x88, 0x06, 0xE5, 0xFF, 0x03, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0xE2,
+  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xF5,
+  0xFF, 0xCC, 0xED, 0xB5, 0xD6, 0xFE, 0x0D, 0x00, 0x00, 0x00, 0x95, 0xA4, 0x65,
+  0xE8, 0x38, 0xEF, 0xA8, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0x88,
+  0x20, 0xFF, 0x0A, 0x31, 0xFF, 0xA9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x28,
+  0xFF, 0x83, 0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x81, 0xEA, 0x20, 0xFF,
+  0x81, 0xC9, 0x28, 0xFF, 0x89, 0xC8, 0x28, 0xFF, 0x84, 0xC9, 0x28, 0xFF, 0x82,
+  0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x84, 0xC8, 0x28, 0xFF, 0x82, 0xC9,
+  0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x82, 0xC8, 0x28,
+  0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x84, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF,
+  0x92, 0xC8, 0x28, 0xFF, 0x83, 0xC9, 0x28, 0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x00,
+  0xA8, 0x30, 0xFF, 0x82, 0xC8, 0x30, 0xFF, 0x83, 0xC8, 0x28, 0xFF, 0x15, 0xE9,
+  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x88, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28,
+  0xFF, 0xE8, 0x28, 0xFF, 0x28, 0x29, 0xFF, 0x07, 0x21, 0xFB, 0x52, 0x8C, 0x7C,
+  0x00, 0x00, 0x00, 0xBA, 0xFE, 0x06, 0xAF, 0xED, 0x96, 0x09, 0xED, 0xFF, 0xE5,
+  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x04, 0xFD,
+  0xFF, 0x04, 0xF5, 0xFF, 0xE6, 0xDC, 0xFF, 0x0F, 0xF6, 0xA1, 0xFF, 0xFF, 0x01,
+  0x91, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x14, 0xB5, 0xFE, 0x06, 0xEC,
+  0xED, 0xC2, 0xE4, 0xE4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xC3, 0xFC,
+  0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xF5, 0xFF, 0x27, 0xED, 0xFF,
+  0x2F, 0xFE, 0x77, 0x39, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x71, 0x83, 0x8D, 0xE8,
+  0x30, 0xF4, 0xA8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xA8, 0x20,
+  0xFF, 0xC8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC8,
+  0x30, 0xFF, 0x01, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF,
+  0x81, 0xC9, 0x28, 0xFF, 0x89, 0xC8, 0x28, 0xFF, 0x84, 0xC9, 0x28, 0xFF, 0xB0,
+  0xC8, 0x28, 0xFF, 0x84, 0xC9, 0x28, 0xFF, 0x00, 0xC9, 0x30, 0xFF, 0x83, 0xC8,
+  0x30, 0xFF, 0x83, 0xC8, 0x28, 0xFF, 0x03, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
+  0x09, 0x39, 0xFF, 0xA8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x01, 0xE7, 0x20,
+  0xFF, 0x6F, 0x73, 0xA2, 0x81, 0x00, 0x00, 0x00, 0x02, 0x51, 0xFE, 0x66, 0x29,
+  0xED, 0xFF, 0xE5, 0xFC, 0xFF, 0x81, 0xC3, 0xFC, 0xFF, 0x00, 0xE2, 0xFC, 0xFF,
+  0x81, 0xE3, 0xFC, 0xFF, 0x02, 0xC6, 0xE4, 0xFF, 0xCD, 0xF5, 0xD3, 0xB5, 0xFE,
+  0x0C, 0x92, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x02, 0xF4, 0xF6, 0x1F,
+  0x8B, 0xE5, 0xFF, 0xE5, 0xF4, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x81, 0xE4, 0xFC,
+  0xFF, 0x09, 0x05, 0xFD, 0xFF, 0xC4, 0xF4, 0xFF, 0x08, 0xED, 0xFF, 0x51, 0xF6,
+  0x6A, 0xF7, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xF3, 0x8B, 0x89, 0xE8, 0x28, 0xF4,
+  0xE9, 0x28, 0xFF, 0xC8, 0x20, 0xFF, 0x81, 0xC7, 0x20, 0xFF, 0x02, 0x08, 0x29,
+  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x82, 0xA9, 0x30, 0xFF, 0x82, 0xC8,
+  0x30, 0xFF, 0x01, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0x89, 0xC8, 0x28, 0xFF,
+  0x84, 0xC9, 0x28, 0xFF, 0xB0, 0xC8, 0x28, 0xFF, 0x01, 0xC8, 0x30, 0xFF, 0xC9,
+  0x30, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF, 0x81, 0xE8, 0x28,
+  0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x81, 0xE9, 0x28, 0xFF,
+  0x00, 0xA8, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x03, 0xC8, 0x20, 0xFF, 0xE8,
+  0x28, 0xFF, 0xE7, 0x28, 0xFF, 0x70, 0x7B, 0x9D, 0x81, 0x00, 0x00, 0x00, 0x03,
+  0x52, 0xF6, 0x60, 0x28, 0xED, 0xFF, 0xE3, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x81,
+  0xE3, 0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x02, 0xE5, 0xEC, 0xFF, 0x4B, 0xED,
+  0xFF, 0x95, 0xFE, 0x2C, 0x93, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x0E,
   0x93, 0xF6, 0x3A, 0x49, 0xED, 0xFB, 0xE5, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3,
   0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC5, 0xF4,
   0xFF, 0x49, 0xED, 0xFF, 0x51, 0xF6, 0x58, 0xF5, 0xFF, 0x03, 0xFF, 0xFF, 0x02,
-  0x70, 0x7B, 0x96, 0xC7, 0x20, 0xF6, 0x08, 0x29, 0xFF, 0x08, 0x29, 0xFF, 0x08,
-  0x29, 0xFF, 0x08, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA9, 0x30,
-  0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC7, 0x30, 0xFF,
-  0xC7, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x20,
-  0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9,
-  0x30, 0xFF, 0xA8, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFE, 0xEE, 0x6A, 0xAA, 0xDB, 0xDE, 0x07, 0x00, 0x00, 0x00,
-  0x32, 0xF6, 0x50, 0x4A, 0xED, 0xFF, 0xC4, 0xEC, 0xFF, 0x02, 0xFD, 0xFF, 0x02,
-  0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xED,
-  0xFF, 0x49, 0xED, 0xFF, 0x73, 0xFE, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xEE, 0x73, 0x29, 0xE5, 0xFF, 0xE5,
-  0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x04, 0xFD,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xF4, 0xFF, 0x49, 0xED, 0xFF,
-  0x72, 0xF6, 0x43, 0xF7, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x8F, 0x7B, 0x98, 0x07,
-  0x21, 0xF5, 0xE8, 0x20, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF,
-  0xA8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA8, 0x28,
-  0xFF, 0xE7, 0x28, 0xFD, 0xEE, 0x6A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x94, 0xFE, 0x3C, 0x49, 0xF5, 0xFF, 0xE4, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x03,
-  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE1, 0xFC, 0xFF, 0x03, 0xFD,
-  0xFF, 0x26, 0xE5, 0xFF, 0x0E, 0xEE, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5,
-  0xFF, 0x03, 0x10, 0xEE, 0x8B, 0x07, 0xED, 0xFF, 0x05, 0xFD, 0xFF, 0x03, 0xFD,
-  0xFF, 0xC2, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF,
-  0xE4, 0xF4, 0xFF, 0x4A, 0xED, 0xFF, 0x71, 0xF6, 0x5A, 0xF7, 0xFD, 0x04, 0x00,
-  0x00, 0x00, 0xB1, 0x83, 0x7A, 0x29, 0x31, 0xF3, 0xE9, 0x28, 0xFF, 0xE9, 0x30,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE7, 0x28,
-  0xFF, 0xE7, 0x28, 0xFF, 0xE7, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC9, 0x28,
-  0xFF, 0x2A, 0x31, 0xFF, 0xE8, 0x30, 0xFB, 0x50, 0x7B, 0x8E, 0xFF, 0xFD, 0x04,
-  0x00, 0x00, 0x00, 0x93, 0xFE, 0x51, 0x4A, 0xE5, 0xFF, 0xC4, 0xF4, 0xFF, 0xC2,
-  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x23, 0xFD,
+  0x70, 0x7B, 0x96, 0xC7, 0x20, 0xF6, 0x83, 0x08, 0x29, 0xFF, 0x01, 0xC8, 0x28,
+  0xFF, 0xC8, 0x30, 0xFF, 0x82, 0xA9, 0x30, 0xFF, 0x00, 0xC8, 0x30, 0xFF, 0x81,
+  0xC7, 0x30, 0xFF, 0x01, 0xC8, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0x89, 0xC8, 0x28,
+  0xFF, 0x83, 0xC9, 0x28, 0xFF, 0xB1, 0xC8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF,
+  0x00, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x81, 0xE8, 0x20, 0xFF, 0x00,
+  0xE8, 0x28, 0xFF, 0x84, 0xC9, 0x28, 0xFF, 0x0B, 0xE9, 0x28, 0xFF, 0xE9, 0x30,
+  0xFF, 0xA8, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFE,
+  0xEE, 0x6A, 0xAA, 0xDB, 0xDE, 0x07, 0x00, 0x00, 0x00, 0x32, 0xF6, 0x50, 0x4A,
+  0xED, 0xFF, 0xC4, 0xEC, 0xFF, 0x81, 0x02, 0xFD, 0xFF, 0x05, 0xE2, 0xFC, 0xFF,
+  0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xED, 0xFF, 0x49, 0xED, 0xFF, 0x73,
+  0xFE, 0x4C, 0x94, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x03, 0x11, 0xEE,
+  0x73, 0x29, 0xE5, 0xFF, 0xE5, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0x81, 0xC3, 0xFC,
+  0xFF, 0x09, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xF4, 0xFF, 0x49, 0xED,
+  0xFF, 0x72, 0xF6, 0x43, 0xF7, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x8F, 0x7B, 0x98,
+  0x07, 0x21, 0xF5, 0xE8, 0x20, 0xFF, 0x84, 0xC8, 0x28, 0xFF, 0x00, 0xC8, 0x30,
+  0xFF, 0x81, 0xA8, 0x30, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x00, 0xC8, 0x28, 0xFF,
+  0x82, 0xC9, 0x28, 0xFF, 0x89, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0xAF,
+  0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x84, 0xE8,
+  0x28, 0xFF, 0x00, 0xE9, 0x28, 0xFF, 0x85, 0xC9, 0x28, 0xFF, 0x04, 0xA8, 0x28,
+  0xFF, 0xC9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE7, 0x28, 0xFD, 0xEE, 0x6A, 0xAA,
+  0x81, 0x00, 0x00, 0x00, 0x03, 0x94, 0xFE, 0x3C, 0x49, 0xF5, 0xFF, 0xE4, 0xF4,
+  0xFF, 0xE3, 0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x04, 0xE2, 0xFC, 0xFF, 0xE1,
+  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x26, 0xE5, 0xFF, 0x0E, 0xEE, 0x89, 0x95, 0x00,
+  0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x11, 0xF5, 0xFF, 0x03, 0x10, 0xEE, 0x8B,
+  0x07, 0xED, 0xFF, 0x05, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE4,
+  0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xE4, 0xF4, 0xFF, 0x4A, 0xED,
+  0xFF, 0x71, 0xF6, 0x5A, 0xF7, 0xFD, 0x04, 0x00, 0x00, 0x00, 0xB1, 0x83, 0x7A,
+  0x29, 0x31, 0xF3, 0xE9, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0x81, 0xE8, 0x28, 0xFF,
+  0x81, 0xC8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x83,
+  0xC9, 0x28, 0xFF, 0xBB, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x01, 0xC8,
+  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x82, 0xE7, 0x28, 0xFF, 0x01, 0xE8, 0x28, 0xFF,
+  0xC8, 0x28, 0xFF, 0x84, 0xC9, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x0A, 0xC9,
+  0x28, 0xFF, 0x2A, 0x31, 0xFF, 0xE8, 0x30, 0xFB, 0x50, 0x7B, 0x8E, 0xFF, 0xFD,
+  0x04, 0x00, 0x00, 0x00, 0x93, 0xFE, 0x51, 0x4A, 0xE5, 0xFF, 0xC4, 0xF4, 0xFF,
+  0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x04, 0x23, 0xFD,
   0xFF, 0x03, 0xFD, 0xFF, 0x05, 0xF5, 0xFF, 0x0D, 0xEE, 0xA2, 0xF7, 0xFE, 0x08,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFE, 0x0C, 0x8C, 0xE5,
-  0xBE, 0x26, 0xED, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xED, 0xFF, 0x48,
-  0xED, 0xFF, 0x71, 0xFE, 0x4B, 0x79, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x14, 0x94,
-  0x7B, 0x08, 0x29, 0xED, 0xC8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xA8, 0x20, 0xFF, 0x29, 0x29, 0xF6, 0xB1, 0x83, 0x8D, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x53, 0xFE, 0x44, 0x49, 0xED, 0xFF, 0xE5, 0xEC, 0xFF, 0x04,
-  0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xE5, 0xF4, 0xFF, 0x06, 0xED, 0xFF, 0xAB, 0xED, 0xC8,
-  0xF5, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x55, 0xFF, 0x0C, 0xCB, 0xED, 0xC6, 0x25, 0xED, 0xFF, 0x03, 0xFD, 0xFF,
-  0xE4, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x03,
-  0xFD, 0xFF, 0x05, 0xED, 0xFF, 0x09, 0xE5, 0xFF, 0x52, 0xFE, 0x66, 0xD6, 0xFE,
-  0x07, 0x00, 0x00, 0x00, 0x57, 0xB5, 0x4A, 0xE7, 0x20, 0xED,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0x08, 0x29, 0xF7, 0xB4, 0x9C, 0x5D,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xFE, 0x5A, 0x0A, 0xE5, 0xFF, 0x05,
+  0x95, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x10, 0xB7, 0xFE, 0x0C, 0x8C,
+  0xE5, 0xBE, 0x26, 0xED, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC,
+  0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xED, 0xFF,
+  0x48, 0xED, 0xFF, 0x71, 0xFE, 0x4B, 0x79, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x14,
+  0x94, 0x7B, 0x08, 0x29, 0xED, 0xC8, 0x20, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x00,
+  0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x00, 0xC8,
+  0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0xBB, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28,
+  0xFF, 0x83, 0xE8, 0x28, 0xFF, 0x83, 0xC8, 0x30, 0xFF, 0x82, 0xC8, 0x28, 0xFF,
+  0x05, 0xC8, 0x30, 0xFF, 0xA8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x20, 0xFF,
+  0x29, 0x29, 0xF6, 0xB1, 0x83, 0x8D, 0x81, 0x00, 0x00, 0x00, 0x05, 0x53, 0xFE,
+  0x44, 0x49, 0xED, 0xFF, 0xE5, 0xEC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
+  0x04, 0xFD, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x03, 0xE5, 0xF4, 0xFF, 0x06, 0xED,
+  0xFF, 0xAB, 0xED, 0xC8, 0xF5, 0xFE, 0x0F, 0x96, 0x00, 0x00, 0x00, 0x97, 0x00,
+  0x00, 0x00, 0x05, 0x55, 0xFF, 0x0C, 0xCB, 0xED, 0xC6, 0x25, 0xED, 0xFF, 0x03,
+  0xFD, 0xFF, 0xE4, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x81, 0xC2, 0xFC, 0xFF, 0x07,
+  0x03, 0xFD, 0xFF, 0x05, 0xED, 0xFF, 0x09, 0xE5, 0xFF, 0x52, 0xFE, 0x66, 0xD6,
+  0xFE, 0x07, 0x00, 0x00, 0x00, 0x57, 0xB5, 0x4A, 0xE7, 0x20, 0xED, 0x81, 0xE8,
+  0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x00, 0xE9, 0x28, 0xFF, 0x81, 0xE8, 0x28,
+  0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0xBD, 0xC8, 0x28, 0xFF,
+  0x81, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x83, 0xC8, 0x30, 0xFF, 0x82,
+  0xC8, 0x28, 0xFF, 0x82, 0xC8, 0x30, 0xFF, 0x01, 0x08, 0x29, 0xF7, 0xB4, 0x9C,
+  0x5D, 0x81, 0x00, 0x00, 0x00, 0x0B, 0x73, 0xFE, 0x5A, 0x0A, 0xE5, 0xFF, 0x05,
   0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD,
   0xFF, 0xE4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE7, 0xEC, 0xFF, 0x8B, 0xED, 0xD2,
-  0xD4, 0xFE, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xF6, 0x1C,
-  0xAB, 0xE5, 0xD6, 0x26, 0xED, 0xFF, 0x05, 0xF5, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xF5, 0xFF, 0x06, 0xF5,
-  0xFF, 0x09, 0xED, 0xFF, 0xCF, 0xF5, 0x8A, 0xD6, 0xFE, 0x0E, 0x00, 0x00, 0x00,
-  0xD8, 0xBD, 0x33, 0x2B, 0x4A, 0xD3, 0xE8, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0x89,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x20,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE8, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
-  0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x28, 0xFF, 0xA8,
-  0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xE8, 0x30,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xAA, 0x41, 0xDC,
-  0x76, 0xBD, 0x3F, 0x00, 0x00, 0x00, 0xD6, 0xFE, 0x07, 0xD0, 0xF5, 0x75, 0x08,
-  0xED, 0xFF, 0x05, 0xFD, 0xFF, 0x05, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0x04, 0xF5,
-  0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF,
-  0x6C, 0xED, 0xDE, 0xD6, 0xF6, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFE, 0x0E, 0xAC, 0xED, 0xDA, 0xC6,
-  0xEC, 0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0x08, 0xED, 0xFF,
-  0xCE, 0xED, 0xBF, 0xB5, 0xFE, 0x13, 0x00, 0x00, 0x00, 0xDB, 0xDE, 0x07, 0xAE,
-  0x62, 0xBF, 0xA8, 0x20, 0xF6, 0xEA, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xA7, 0x20, 0xFF,
-  0xA8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x08, 0x29, 0xFF,
-  0xC8, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xCA, 0x30, 0xFF, 0x89, 0x30, 0xFF, 0x89,
-  0x28, 0xFF, 0xEA, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xA8, 0x20, 0xFF, 0xC8, 0x28,
-  0xFF, 0x08, 0x31, 0xFF, 0xC7, 0x28, 0xFF, 0xE7, 0x28, 0xFE, 0x4C, 0x52, 0xC5,
-  0x9A, 0xD6, 0x11, 0x00, 0x00, 0x00, 0xF7, 0xFE, 0x0F, 0x0F, 0xF6, 0x8F, 0x29,
-  0xED, 0xFF, 0xE4, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xE3, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC4, 0xEC, 0xFF,
-  0x8B, 0xF5, 0xDE, 0x14, 0xFF, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5,
-  0xFE, 0x1C, 0x6C, 0xED, 0xD8, 0x07, 0xF5, 0xFF, 0x04, 0xF5, 0xFF, 0x03, 0xFD,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
-  0xE3, 0xF4, 0xFF, 0x06, 0xED, 0xFF, 0xCC, 0xF5, 0xEC, 0xD3, 0xFE, 0x1A, 0xFF,
-  0xFF, 0x01, 0xFF, 0xFF, 0x02, 0x95, 0x9C, 0x6E, 0x29, 0x29, 0xEE, 0xA8, 0x20,
-  0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0x88, 0x28, 0xFF,
-  0xA8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xE9, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x88,
-  0x28, 0xFF, 0xEA, 0x38, 0xFF, 0x0B, 0x39, 0xFF, 0x89, 0x20, 0xFF, 0xA9, 0x20,
-  0xFF, 0x0A, 0x29, 0xFF, 0xA7, 0x18, 0xFF, 0xC7, 0x20, 0xFF, 0x48, 0x31, 0xF5,
-  0x32, 0x8C, 0x7E, 0xBA, 0xD6, 0x06, 0x00, 0x00, 0x00, 0xD4, 0xF6, 0x14, 0xCD,
-  0xED, 0xC9, 0xE7, 0xEC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC,
-  0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF,
-  0xE5, 0xF4, 0xFF, 0x4A, 0xF5, 0xE0, 0xD4, 0xFE, 0x22, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFF, 0x1A, 0x6B, 0xE5,
-  0xD4, 0x26, 0xED, 0xFF, 0x04, 0xF5, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x03, 0xF5, 0xFF, 0x06,
+  0xD4, 0xFE, 0x0E, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x03, 0xD4,
+  0xF6, 0x1C, 0xAB, 0xE5, 0xD6, 0x26, 0xED, 0xFF, 0x05, 0xF5, 0xFF, 0x81, 0xC3,
+  0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x11, 0x04, 0xF5, 0xFF, 0x06, 0xF5, 0xFF,
+  0x09, 0xED, 0xFF, 0xCF, 0xF5, 0x8A, 0xD6, 0xFE, 0x0E, 0x00, 0x00, 0x00, 0xD8,
+  0xBD, 0x33, 0x2B, 0x4A, 0xD3, 0xE8, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0x89, 0x28,
+  0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x20, 0xFF,
+  0xC8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF,
+  0x81, 0xA8, 0x28, 0xFF, 0x00, 0xE9, 0x30, 0xFF, 0xB7, 0xC8, 0x28, 0xFF, 0x00,
+  0xE8, 0x20, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x00, 0xC9, 0x30, 0xFF, 0x82, 0xA9,
+  0x30, 0xFF, 0x0D, 0xA9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xC8,
+  0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
+  0xFF, 0xAA, 0x41, 0xDC, 0x76, 0xBD, 0x3F, 0x00, 0x00, 0x00, 0xD6, 0xFE, 0x07,
+  0xD0, 0xF5, 0x75, 0x08, 0xED, 0xFF, 0x81, 0x05, 0xFD, 0xFF, 0x07, 0x04, 0xFD,
+  0xFF, 0x04, 0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
+  0xE6, 0xF4, 0xFF, 0x6C, 0xED, 0xDE, 0xD6, 0xF6, 0x21, 0x98, 0x00, 0x00, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x05, 0xD4, 0xFE, 0x0E, 0xAC, 0xED, 0xDA, 0xC6, 0xEC,
+  0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0x81, 0xE3, 0xFC,
+  0xFF, 0x0A, 0xE4, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0x08, 0xED, 0xFF, 0xCE, 0xED,
+  0xBF, 0xB5, 0xFE, 0x13, 0x00, 0x00, 0x00, 0xDB, 0xDE, 0x07, 0xAE, 0x62, 0xBF,
+  0xA8, 0x20, 0xF6, 0xEA, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF,
+  0x03, 0xE8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xA7, 0x20, 0xFF, 0xA8, 0x28, 0xFF,
+  0x81, 0xE9, 0x30, 0xFF, 0xB9, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x1C,
+  0x08, 0x29, 0xFF, 0xC8, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xCA, 0x30, 0xFF, 0x89,
+  0x30, 0xFF, 0x89, 0x28, 0xFF, 0xEA, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xA8, 0x20,
+  0xFF, 0xC8, 0x28, 0xFF, 0x08, 0x31, 0xFF, 0xC7, 0x28, 0xFF, 0xE7, 0x28, 0xFE,
+  0x4C, 0x52, 0xC5, 0x9A, 0xD6, 0x11, 0x00, 0x00, 0x00, 0xF7, 0xFE, 0x0F, 0x0F,
+  0xF6, 0x8F, 0x29, 0xED, 0xFF, 0xE4, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xC3, 0xFC,
+  0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xF4, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF,
+  0xC4, 0xEC, 0xFF, 0x8B, 0xF5, 0xDE, 0x14, 0xFF, 0x11, 0x99, 0x00, 0x00, 0x00,
+  0x9A, 0x00, 0x00, 0x00, 0x1C, 0xD5, 0xFE, 0x1C, 0x6C, 0xED, 0xD8, 0x07, 0xF5,
+  0xFF, 0x04, 0xF5, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF,
+  0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x06, 0xED, 0xFF, 0xCC,
+  0xF5, 0xEC, 0xD3, 0xFE, 0x1A, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x02, 0x95, 0x9C,
+  0x6E, 0x29, 0x29, 0xEE, 0xA8, 0x20, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x30, 0xFF,
+  0x88, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0x09, 0x31, 0xFF, 0xE9, 0x30, 0xFF, 0xA8,
+  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28,
+  0xFF, 0xB7, 0xC8, 0x28, 0xFF, 0x00, 0xE8, 0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF,
+  0x11, 0xC8, 0x30, 0xFF, 0x88, 0x28, 0xFF, 0xEA, 0x38, 0xFF, 0x0B, 0x39, 0xFF,
+  0x89, 0x20, 0xFF, 0xA9, 0x20, 0xFF, 0x0A, 0x29, 0xFF, 0xA7, 0x18, 0xFF, 0xC7,
+  0x20, 0xFF, 0x48, 0x31, 0xF5, 0x32, 0x8C, 0x7E, 0xBA, 0xD6, 0x06, 0x00, 0x00,
+  0x00, 0xD4, 0xF6, 0x14, 0xCD, 0xED, 0xC9, 0xE7, 0xEC, 0xFF, 0xC4, 0xFC, 0xFF,
+  0xE3, 0xFC, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x05, 0x03, 0xFD, 0xFF, 0xE3, 0xFC,
+  0xFF, 0xC4, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0x4A, 0xF5, 0xE0, 0xD4, 0xFE, 0x22,
+  0x9A, 0x00, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x00, 0x06, 0x16, 0xFF, 0x1A, 0x6B,
+  0xE5, 0xD4, 0x26, 0xED, 0xFF, 0x04, 0xF5, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC,
+  0xFF, 0xE2, 0xFC, 0xFF, 0x81, 0x02, 0xFD, 0xFF, 0x0D, 0x03, 0xF5, 0xFF, 0x06,
   0xED, 0xFF, 0x29, 0xE5, 0xFF, 0x72, 0xFE, 0x4C, 0xD6, 0xFE, 0x07, 0x00, 0x00,
   0x00, 0x37, 0xAD, 0x43, 0x0C, 0x4A, 0xD0, 0x09, 0x31, 0xFF, 0xE9, 0x30, 0xFF,
-  0xA8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xA7, 0x20, 0xFF, 0xA7, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xE9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8,
-  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE9, 0x28,
-  0xFF, 0xEA, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xEA, 0x41, 0xD2,
-  0x56, 0xB5, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xF6, 0x45, 0x6C,
-  0xE5, 0xFF, 0x07, 0xED, 0xFF, 0xE4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD,
-  0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xE7, 0xF4, 0xFF, 0x2A, 0xED, 0xD7, 0xD4, 0xFE, 0x21, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xD6, 0xFE, 0x0D, 0x6B, 0xE5, 0xCF, 0x26, 0xED, 0xFF,
-  0xE4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2,
-  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x05, 0xF5, 0xFF, 0x08, 0xE5,
-  0xFF, 0x0F, 0xF6, 0x93, 0x76, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02,
-  0x0F, 0x6B, 0x9E, 0xE8, 0x30, 0xF5, 0xC8, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0xE8,
-  0x30, 0xFF, 0x08, 0x31, 0xFF, 0xE8, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xA9,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x08, 0x29,
-  0xFF, 0x08, 0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xF6,
-  0xEE, 0x6A, 0xA8, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xBA, 0xFE, 0x06, 0xF0,
-  0xED, 0x7C, 0x2A, 0xDD, 0xFF, 0x27, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF,
-  0xE4, 0xF4, 0xFF, 0x07, 0xF5, 0xFF, 0x4B, 0xED, 0xD5, 0xD6, 0xFE, 0x0E, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFE, 0x13,
-  0xCC, 0xF5, 0xAF, 0x07, 0xED, 0xFF, 0xE4, 0xF4, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x03, 0xFD,
-  0xFF, 0x05, 0xFD, 0xFF, 0x07, 0xED, 0xFF, 0x6C, 0xE5, 0xE4, 0xD4, 0xFE, 0x35,
-  0xF5, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x16, 0xB5, 0x43, 0x2C, 0x5A, 0xC7, 0xE8,
-  0x30, 0xF5, 0xC7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xA8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xE7, 0x28, 0xFC,
-  0xEA, 0x49, 0xCD, 0x36, 0xB5, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4,
-  0xFE, 0x2D, 0x6C, 0xE5, 0xC5, 0x29, 0xED, 0xFF, 0xE6, 0xEC, 0xFF, 0x04, 0xFD,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
-  0x03, 0xFD, 0xFF, 0xE4, 0xF4, 0xFF, 0x07, 0xED, 0xFF, 0xAD, 0xED, 0xBB, 0xB5,
-  0xFE, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xFF, 0x09, 0xCF, 0xF5, 0xA2, 0x29,
-  0xED, 0xFF, 0xE5, 0xEC, 0xFF, 0x24, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC,
-  0xFF, 0xC3, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0x25, 0xFD, 0xFF,
-  0x05, 0xF5, 0xFF, 0x07, 0xE5, 0xFF, 0x70, 0xFE, 0x64, 0xF5, 0xFE, 0x10, 0xFF,
-  0xFF, 0x01, 0x00, 0x00, 0x00, 0xF3, 0x8B, 0x7B, 0x8A, 0x41, 0xE1, 0xA7, 0x28,
-  0xF8, 0x09, 0x31, 0xFF, 0xA7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x2A, 0x39, 0xFF,
-  0xA8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0x2A, 0x39, 0xFF, 0xA8, 0x28,
-  0xFF, 0xA8, 0x28, 0xFF, 0x2A, 0x39, 0xFF, 0xA8, 0x20, 0xFE, 0x69, 0x31, 0xE6,
-  0xD1, 0x83, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xFF, 0x0B, 0x31,
-  0xF6, 0x59, 0x09, 0xE5, 0xFF, 0x27, 0xFD, 0xFF, 0x05, 0xFD, 0xFF, 0xC3, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xC4, 0xF4, 0xFF, 0x08, 0xED, 0xFF, 0xCE, 0xED, 0xB3, 0xF5,
-  0xEE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xA8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xA7, 0x20, 0xFF, 0xA7, 0x28, 0xFF, 0x82,
+  0xC8, 0x28, 0xFF, 0x01, 0xE9, 0x30, 0xFF, 0xE9, 0x28, 0xFF, 0xB6, 0xC8, 0x28,
+  0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x03, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE8,
+  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0x81, 0xA8, 0x28, 0xFF, 0x05, 0xE9, 0x28, 0xFF,
+  0xEA, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xEA, 0x41, 0xD2, 0x56,
+  0xB5, 0x4C, 0x81, 0x00, 0x00, 0x00, 0x05, 0xB4, 0xF6, 0x45, 0x6C, 0xE5, 0xFF,
+  0x07, 0xED, 0xFF, 0xE4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x81,
+  0xE2, 0xFC, 0xFF, 0x04, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE7, 0xF4, 0xFF,
+  0x2A, 0xED, 0xD7, 0xD4, 0xFE, 0x21, 0x9B, 0x00, 0x00, 0x00, 0x9C, 0x00, 0x00,
+  0x00, 0x03, 0xD6, 0xFE, 0x0D, 0x6B, 0xE5, 0xCF, 0x26, 0xED, 0xFF, 0xE4, 0xFC,
+  0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF,
+  0x0D, 0x05, 0xF5, 0xFF, 0x08, 0xE5, 0xFF, 0x0F, 0xF6, 0x93, 0x76, 0xFF, 0x0E,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x0F, 0x6B, 0x9E, 0xE8, 0x30, 0xF5, 0xC8,
+  0x30, 0xFF, 0xA7, 0x28, 0xFF, 0xE8, 0x30, 0xFF, 0x08, 0x31, 0xFF, 0xE8, 0x30,
+  0xFF, 0xE8, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x83, 0xC9, 0x28, 0xFF, 0xB2,
+  0xC8, 0x28, 0xFF, 0x07, 0xC9, 0x28, 0xFF, 0xCA, 0x30, 0xFF, 0xA9, 0x28, 0xFF,
+  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x08, 0x29, 0xFF, 0x08,
+  0x31, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x08, 0xE8, 0x28, 0xF6, 0xEE, 0x6A, 0xA8,
+  0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xBA, 0xFE, 0x06, 0xF0, 0xED, 0x7C, 0x2A,
+  0xDD, 0xFF, 0x27, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0x82, 0xE3, 0xFC, 0xFF, 0x81,
+  0x03, 0xFD, 0xFF, 0x03, 0xE4, 0xF4, 0xFF, 0x07, 0xF5, 0xFF, 0x4B, 0xED, 0xD5,
+  0xD6, 0xFE, 0x0E, 0x9C, 0x00, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x00, 0x05, 0xB4,
+  0xFE, 0x13, 0xCC, 0xF5, 0xAF, 0x07, 0xED, 0xFF, 0xE4, 0xF4, 0xFF, 0xC4, 0xFC,
+  0xFF, 0xE3, 0xFC, 0xFF, 0x82, 0xE2, 0xFC, 0xFF, 0x09, 0x03, 0xFD, 0xFF, 0x05,
+  0xFD, 0xFF, 0x07, 0xED, 0xFF, 0x6C, 0xE5, 0xE4, 0xD4, 0xFE, 0x35, 0xF5, 0xFF,
+  0x03, 0x00, 0x00, 0x00, 0x16, 0xB5, 0x43, 0x2C, 0x5A, 0xC7, 0xE8, 0x30, 0xF5,
+  0x81, 0xC7, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x01, 0xE9, 0x28, 0xFF, 0xA8,
+  0x28, 0xFF, 0x83, 0xC9, 0x28, 0xFF, 0xB2, 0xC8, 0x28, 0xFF, 0x00, 0xC9, 0x28,
+  0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x05, 0xE8, 0x28, 0xFF,
+  0xE7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xE7, 0x28, 0xFC, 0xEA, 0x49, 0xCD, 0x36,
+  0xB5, 0x4D, 0x81, 0x00, 0x00, 0x00, 0x07, 0xB4, 0xFE, 0x2D, 0x6C, 0xE5, 0xC5,
+  0x29, 0xED, 0xFF, 0xE6, 0xEC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3,
+  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x03, 0xE4, 0xF4, 0xFF,
+  0x07, 0xED, 0xFF, 0xAD, 0xED, 0xBB, 0xB5, 0xFE, 0x19, 0x9D, 0x00, 0x00, 0x00,
+  0x9E, 0x00, 0x00, 0x00, 0x18, 0x15, 0xFF, 0x09, 0xCF, 0xF5, 0xA2, 0x29, 0xED,
+  0xFF, 0xE5, 0xEC, 0xFF, 0x24, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF,
+  0xC3, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0x25, 0xFD, 0xFF, 0x05,
+  0xF5, 0xFF, 0x07, 0xE5, 0xFF, 0x70, 0xFE, 0x64, 0xF5, 0xFE, 0x10, 0xFF, 0xFF,
+  0x01, 0x00, 0x00, 0x00, 0xF3, 0x8B, 0x7B, 0x8A, 0x41, 0xE1, 0xA7, 0x28, 0xF8,
+  0x09, 0x31, 0xFF, 0xA7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x2A, 0x39, 0xFF, 0xA8,
+  0x28, 0xFF, 0x87, 0xC9, 0x28, 0xFF, 0xAF, 0xC8, 0x28, 0xFF, 0x01, 0xA8, 0x28,
+  0xFF, 0x2A, 0x39, 0xFF, 0x81, 0xA8, 0x28, 0xFF, 0x03, 0x2A, 0x39, 0xFF, 0xA8,
+  0x20, 0xFE, 0x69, 0x31, 0xE6, 0xD1, 0x83, 0x87, 0x81, 0x00, 0x00, 0x00, 0x05,
+  0x57, 0xFF, 0x0B, 0x31, 0xF6, 0x59, 0x09, 0xE5, 0xFF, 0x27, 0xFD, 0xFF, 0x05,
+  0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x81, 0x03, 0xFD, 0xFF,
+  0x04, 0xE3, 0xFC, 0xFF, 0xC4, 0xF4, 0xFF, 0x08, 0xED, 0xFF, 0xCE, 0xED, 0xB3,
+  0xF5, 0xEE, 0x0F, 0x9E, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x06, 0xFF,
   0xFF, 0x01, 0xF0, 0xF5, 0x64, 0x49, 0xE5, 0xFF, 0x06, 0xED, 0xFF, 0xE3, 0xF4,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xF5, 0xFF, 0x27,
-  0xED, 0xFF, 0x8C, 0xE5, 0xF4, 0xB5, 0xF6, 0x36, 0xBA, 0xFE, 0x06, 0x00, 0x00,
-  0x00, 0x9B, 0xDE, 0x16, 0x91, 0x83, 0x8B, 0x07, 0x31, 0xEC, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0x86, 0x20, 0xFF, 0x09, 0x31, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x08, 0x31,
-  0xFF, 0xA7, 0x20, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xF6,
-  0x30, 0x7B, 0x97, 0x5A, 0xD6, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4,
-  0xFE, 0x31, 0x6C, 0xDD, 0xDC, 0x49, 0xED, 0xFF, 0xE6, 0xF4, 0xFF, 0xA3, 0xFC,
-  0xFF, 0xC2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xC3, 0xF4, 0xFF, 0xE5, 0xFC, 0xFF, 0x28, 0xF5, 0xFF, 0xEF,
-  0xF5, 0x76, 0x36, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xFE,
-  0x44, 0x4B, 0xED, 0xE4, 0xC5, 0xEC, 0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF,
-  0xC3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x24, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3,
-  0xF4, 0xFF, 0x05, 0xF5, 0xFF, 0x06, 0xF5, 0xFF, 0x48, 0xF5, 0xFF, 0xAD, 0xF5,
-  0x8A, 0xF6, 0xFE, 0x1E, 0x79, 0xFE, 0x05, 0x00, 0x00, 0x00, 0xD9, 0xCD, 0x2B,
-  0x50, 0x73, 0xA6, 0x27, 0x31, 0xE5, 0xC6, 0x28, 0xFB, 0xE7, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x30,
-  0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9,
-  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x30, 0xFF,
-  0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA9, 0x28, 0xFF,
-  0xA9, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x20, 0xFF, 0xE9, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x09, 0x31, 0xEB, 0xD0, 0x6A, 0xA8,
-  0x99, 0xC5, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFE, 0x1A, 0xEE,
-  0xED, 0x7E, 0x49, 0xED, 0xFF, 0x06, 0xED, 0xFF, 0x05, 0xF5, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xE2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xF4, 0xFF, 0xC6, 0xE4, 0xFF, 0x6B,
-  0xED, 0xEA, 0x72, 0xF6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xFE, 0x10, 0xED, 0xFD, 0xD7,
-  0x07, 0xED, 0xFF, 0xC4, 0xEC, 0xFF, 0x03, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2,
-  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xC3, 0xF4,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x47, 0xFD, 0xFF, 0x2A, 0xDD, 0xFF, 0x51, 0xF6, 0x74,
-  0xD6, 0xFE, 0x0E, 0xF5, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x3C, 0xE6, 0x09, 0x6F,
-  0x7B, 0xA3, 0xE6, 0x28, 0xF1, 0xE7, 0x28, 0xF6, 0x09, 0x31, 0xFF, 0xE9, 0x28,
-  0xFF, 0xE9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0x88, 0x28, 0xFF, 0xC7, 0x28, 0xFF,
-  0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8,
-  0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xA8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9,
-  0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xE9, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8,
-  0x30, 0xFF, 0x87, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x09, 0x31, 0xFF, 0xE8, 0x28,
-  0xFF, 0x09, 0x31, 0xFF, 0xC8, 0x20, 0xFF, 0x08, 0x29, 0xFC, 0xCE, 0x62, 0xB0,
-  0x1C, 0xD6, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFE, 0x07, 0x51,
-  0xFE, 0x61, 0x4A, 0xE5, 0xFF, 0x47, 0xF5, 0xFF, 0xE4, 0xF4, 0xFF, 0xC3, 0xF4,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF,
-  0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xF4, 0xFF, 0x07, 0xED, 0xFF, 0xCD,
-  0xF5, 0xE4, 0x74, 0xF6, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x36, 0xFF, 0x0A, 0x10, 0xEE, 0x7B, 0x49, 0xED, 0xFF, 0xE5, 0xF4, 0xFF, 0x03,
-  0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD,
-  0xFF, 0x24, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xC3, 0xF4, 0xFF,
-  0x05, 0xF5, 0xFF, 0x27, 0xED, 0xFF, 0x69, 0xED, 0xF6, 0x6F, 0xFE, 0x6B, 0xF5,
-  0xFE, 0x10, 0xF5, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x3A, 0xC6, 0x23, 0x52, 0x8C,
-  0x72, 0xA9, 0x39, 0xD2, 0xC6, 0x20, 0xF5, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF,
-  0xC9, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF,
-  0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9, 0x30,
-  0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF,
-  0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC9,
-  0x30, 0xFF, 0xA9, 0x28, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xC9, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF,
-  0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8,
-  0x30, 0xFF, 0xC7, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0xA7, 0x28, 0xFF, 0xA7, 0x28,
-  0xFF, 0xA6, 0x28, 0xFB, 0x88, 0x41, 0xD9, 0xF2, 0x8B, 0x7F,
-  0xF9, 0xBD, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFE, 0x0C, 0x71,
-  0xFE, 0x67, 0x8B, 0xF5, 0xE6, 0x27, 0xF5, 0xFF, 0x05, 0xF5, 0xFF, 0xE2, 0xF4,
-  0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x05, 0xED, 0xFF, 0x49,
-  0xE5, 0xFF, 0xEF, 0xF5, 0x8F, 0x75, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72,
-  0xFE, 0x3E, 0x8B, 0xF5, 0xE4, 0x06, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF,
-  0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC3, 0xF4, 0xFF, 0x04, 0xF5, 0xFF, 0x06,
-  0xE5, 0xFF, 0x4B, 0xE5, 0xFF, 0x72, 0xF6, 0x60, 0x18, 0xFF, 0x19, 0x79, 0xFE,
-  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xAD, 0x53, 0x8C, 0x5A, 0xBA,
-  0x49, 0x39, 0xE1, 0xE8, 0x28, 0xF6, 0x08, 0x31, 0xFF, 0xC7, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xA9, 0x30,
-  0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF, 0xA9, 0x30, 0xFF,
-  0xC9, 0x30, 0xFF, 0xC9, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xA9,
-  0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xA9, 0x28, 0xFF, 0xC9, 0x30,
-  0xFF, 0xC9, 0x30, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x30, 0xFF, 0xA8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0x08, 0x31, 0xFF, 0xC7, 0x28, 0xFF, 0x07, 0x29, 0xFF, 0xE6, 0x28,
-  0xFC, 0x48, 0x39, 0xE6, 0x4B, 0x5A, 0xBD, 0xD4, 0xAC, 0x5C, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x57, 0xF7, 0x17, 0xB2, 0xF6, 0x5E, 0x6B,
-  0xDD, 0xFF, 0xE6, 0xDC, 0xFF, 0x05, 0xF5, 0xFF, 0xC3, 0xF4, 0xFF, 0xE2, 0xFC,
-  0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF,
-  0x04, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xF4, 0xFF, 0x06, 0xED, 0xFF, 0x8C,
-  0xED, 0xE9, 0x52, 0xEE, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFE, 0x0F, 0xF0, 0xED,
+  0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x81, 0xE3,
+  0xFC, 0xFF, 0x08, 0x04, 0xF5, 0xFF, 0x27, 0xED, 0xFF, 0x8C, 0xE5, 0xF4, 0xB5,
+  0xF6, 0x36, 0xBA, 0xFE, 0x06, 0x00, 0x00, 0x00, 0x9B, 0xDE, 0x16, 0x91, 0x83,
+  0x8B, 0x07, 0x31, 0xEC, 0x81, 0xE8, 0x28, 0xFF, 0x02, 0x86, 0x20, 0xFF, 0x09,
+  0x31, 0xFF, 0xC8, 0x28, 0xFF, 0x83, 0xC9, 0x28, 0xFF, 0x84, 0xC8, 0x28, 0xFF,
+  0x02, 0xC9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xA0, 0xC8, 0x28,
+  0xFF, 0x83, 0xC9, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x28, 0xFF,
+  0x07, 0xC8, 0x28, 0xFF, 0x08, 0x31, 0xFF, 0xA7, 0x20, 0xFF, 0xE9, 0x30, 0xFF,
+  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xF6, 0x30, 0x7B, 0x97, 0x5A, 0xD6, 0x1C, 0x81,
+  0x00, 0x00, 0x00, 0x0E, 0xD4, 0xFE, 0x31, 0x6C, 0xDD, 0xDC, 0x49, 0xED, 0xFF,
+  0xE6, 0xF4, 0xFF, 0xA3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xC3,
+  0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xF4, 0xFF, 0xE5, 0xFC,
+  0xFF, 0x28, 0xF5, 0xFF, 0xEF, 0xF5, 0x76, 0x36, 0xFF, 0x0A, 0x9F, 0x00, 0x00,
+  0x00, 0xA1, 0x00, 0x00, 0x00, 0x17, 0x73, 0xFE, 0x44, 0x4B, 0xED, 0xE4, 0xC5,
+  0xEC, 0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0x03, 0xFD,
+  0xFF, 0x24, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x05, 0xF5, 0xFF,
+  0x06, 0xF5, 0xFF, 0x48, 0xF5, 0xFF, 0xAD, 0xF5, 0x8A, 0xF6, 0xFE, 0x1E, 0x79,
+  0xFE, 0x05, 0x00, 0x00, 0x00, 0xD9, 0xCD, 0x2B, 0x50, 0x73, 0xA6, 0x27, 0x31,
+  0xE5, 0xC6, 0x28, 0xFB, 0xE7, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x28, 0xFF,
+  0x81, 0xA9, 0x28, 0xFF, 0x01, 0xC9, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0x83, 0xC8,
+  0x28, 0xFF, 0x00, 0xC9, 0x28, 0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x06, 0xC8, 0x28,
+  0xFF, 0xC9, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF,
+  0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xC8, 0x30, 0xFF, 0x82, 0xC8, 0x28,
+  0xFF, 0x01, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x88, 0xE8, 0x28, 0xFF, 0x82,
+  0xC8, 0x30, 0xFF, 0x01, 0xC8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0x84, 0xC8, 0x28,
+  0xFF, 0x82, 0xA9, 0x28, 0xFF, 0x01, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0x81,
+  0xC8, 0x28, 0xFF, 0x07, 0xC9, 0x28, 0xFF, 0xC9, 0x20, 0xFF, 0xE9, 0x28, 0xFF,
+  0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x09, 0x31, 0xEB, 0xD0, 0x6A, 0xA8, 0x99,
+  0xC5, 0x37, 0x81, 0x00, 0x00, 0x00, 0x05, 0xD4, 0xFE, 0x1A, 0xEE, 0xED, 0x7E,
+  0x49, 0xED, 0xFF, 0x06, 0xED, 0xFF, 0x05, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0x81,
+  0xE3, 0xFC, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x04, 0x03, 0xFD, 0xFF, 0xE4, 0xF4,
+  0xFF, 0xC6, 0xE4, 0xFF, 0x6B, 0xED, 0xEA, 0x72, 0xF6, 0x55, 0xA1, 0x00, 0x00,
+  0x00, 0xA2, 0x00, 0x00, 0x00, 0x04, 0x73, 0xFE, 0x10, 0xED, 0xFD, 0xD7, 0x07,
+  0xED, 0xFF, 0xC4, 0xEC, 0xFF, 0x03, 0xFD, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x81,
+  0x03, 0xFD, 0xFF, 0x12, 0x04, 0xFD, 0xFF, 0xC3, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF,
+  0x47, 0xFD, 0xFF, 0x2A, 0xDD, 0xFF, 0x51, 0xF6, 0x74, 0xD6, 0xFE, 0x0E, 0xF5,
+  0xFF, 0x03, 0x00, 0x00, 0x00, 0x3C, 0xE6, 0x09, 0x6F, 0x7B, 0xA3, 0xE6, 0x28,
+  0xF1, 0xE7, 0x28, 0xF6, 0x09, 0x31, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x30, 0xFF,
+  0xC9, 0x30, 0xFF, 0x88, 0x28, 0xFF, 0xC7, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF,
+  0x01, 0xE9, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0x81, 0xA8, 0x28, 0xFF, 0x81, 0xC9,
+  0x30, 0xFF, 0x00, 0xA8, 0x28, 0xFF, 0x87, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x28,
+  0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x88, 0xC8, 0x28, 0xFF,
+  0x02, 0xE9, 0x28, 0xFF, 0x09, 0x29, 0xFF, 0xE9, 0x28, 0xFF, 0x81, 0xC8, 0x28,
+  0xFF, 0x0C, 0xC9, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC8, 0x30,
+  0xFF, 0x87, 0x28, 0xFF, 0xC8, 0x30, 0xFF, 0x09, 0x31, 0xFF, 0xE8, 0x28, 0xFF,
+  0x09, 0x31, 0xFF, 0xC8, 0x20, 0xFF, 0x08, 0x29, 0xFC, 0xCE, 0x62, 0xB0, 0x1C,
+  0xD6, 0x11, 0x81, 0x00, 0x00, 0x00, 0x0F, 0xD6, 0xFE, 0x07, 0x51, 0xFE, 0x61,
+  0x4A, 0xE5, 0xFF, 0x47, 0xF5, 0xFF, 0xE4, 0xF4, 0xFF, 0xC3, 0xF4, 0xFF, 0xE3,
+  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC2, 0xFC,
+  0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xF4, 0xFF, 0x07, 0xED, 0xFF, 0xCD, 0xF5, 0xE4,
+  0x74, 0xF6, 0x1A, 0xA2, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x00, 0x05, 0x36,
+  0xFF, 0x0A, 0x10, 0xEE, 0x7B, 0x49, 0xED, 0xFF, 0xE5, 0xF4, 0xFF, 0x03, 0xFD,
+  0xFF, 0xE2, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x13, 0x03, 0xFD, 0xFF, 0x24,
+  0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xC3, 0xF4, 0xFF, 0x05, 0xF5, 0xFF, 0x27, 0xED,
+  0xFF, 0x69, 0xED, 0xF6, 0x6F, 0xFE, 0x6B, 0xF5, 0xFE, 0x10, 0xF5, 0xFF, 0x03,
+  0x00, 0x00, 0x00, 0x3A, 0xC6, 0x23, 0x52, 0x8C, 0x72, 0xA9, 0x39, 0xD2, 0xC6,
+  0x20, 0xF5, 0xC8, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xE8, 0x28,
+  0xFF, 0xC8, 0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x01, 0xE9, 0x30, 0xFF, 0xE8,
+  0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x84, 0xE9, 0x28, 0xFF, 0x00, 0xC9, 0x28,
+  0xFF, 0x82, 0xE9, 0x28, 0xFF, 0x02, 0xC9, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xA9,
+  0x30, 0xFF, 0x82, 0xC9, 0x30, 0xFF, 0x82, 0xC9, 0x28, 0xFF, 0x82, 0xC9, 0x30,
+  0xFF, 0x00, 0xA9, 0x28, 0xFF, 0x81, 0xA9, 0x30, 0xFF, 0x01, 0xC9, 0x30, 0xFF,
+  0xC8, 0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x82, 0xC9, 0x30, 0xFF, 0x82, 0xC8,
+  0x30, 0xFF, 0x01, 0xC7, 0x30, 0xFF, 0xE8, 0x30, 0xFF, 0x81, 0xA7, 0x28, 0xFF,
+  0x03, 0xA6, 0x28, 0xFB, 0x88, 0x41, 0xD9, 0xF2, 0x8B, 0x7F, 0xF9, 0xBD, 0x2B,
+  0x81, 0x00, 0x00, 0x00, 0x05, 0xB5, 0xFE, 0x0C, 0x71, 0xFE, 0x67, 0x8B, 0xF5,
+  0xE6, 0x27, 0xF5, 0xFF, 0x05, 0xF5, 0xFF, 0xE2, 0xF4, 0xFF, 0x81, 0x03, 0xFD,
+  0xFF, 0x83, 0xE3, 0xFC, 0xFF, 0x04, 0x04, 0xFD, 0xFF, 0x05, 0xED, 0xFF, 0x49,
+  0xE5, 0xFF, 0xEF, 0xF5, 0x8F, 0x75, 0xFE, 0x10, 0xA3, 0x00, 0x00, 0x00, 0xA5,
+  0x00, 0x00, 0x00, 0x03, 0x72, 0xFE, 0x3E, 0x8B, 0xF5, 0xE4, 0x06, 0xF5, 0xFF,
+  0xE4, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x81, 0xC2, 0xFC, 0xFF, 0x09, 0x03,
+  0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xC3, 0xF4, 0xFF, 0x04, 0xF5,
+  0xFF, 0x06, 0xE5, 0xFF, 0x4B, 0xE5, 0xFF, 0x72, 0xF6, 0x60, 0x18, 0xFF, 0x19,
+  0x79, 0xFE, 0x05, 0x81, 0x00, 0x00, 0x00, 0x06, 0x15, 0xAD, 0x53, 0x8C, 0x5A,
+  0xBA, 0x49, 0x39, 0xE1, 0xE8, 0x28, 0xF6, 0x08, 0x31, 0xFF, 0xC7, 0x28, 0xFF,
+  0xE8, 0x28, 0xFF, 0x81, 0xC7, 0x28, 0xFF, 0x00, 0xC8, 0x28, 0xFF, 0x81, 0xE8,
+  0x28, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x82, 0xE9, 0x28, 0xFF, 0x01, 0xC9, 0x28,
+  0xFF, 0xC8, 0x28, 0xFF, 0x82, 0xA8, 0x28, 0xFF, 0x84, 0xA9, 0x30, 0xFF, 0x00,
+  0xC9, 0x30, 0xFF, 0x81, 0xC9, 0x28, 0xFF, 0x84, 0xA9, 0x28, 0xFF, 0x82, 0xC9,
+  0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x00, 0xC8, 0x30, 0xFF, 0x82, 0xA8, 0x28,
+  0xFF, 0x07, 0xC8, 0x28, 0xFF, 0x08, 0x31, 0xFF, 0xC7, 0x28, 0xFF, 0x07, 0x29,
+  0xFF, 0xE6, 0x28, 0xFC, 0x48, 0x39, 0xE6, 0x4B, 0x5A, 0xBD, 0xD4, 0xAC, 0x5C,
+  0x81, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x01, 0x57, 0xF7, 0x17, 0xB2, 0xF6,
+  0x5E, 0x6B, 0xDD, 0xFF, 0xE6, 0xDC, 0xFF, 0x05, 0xF5, 0xFF, 0xC3, 0xF4, 0xFF,
+  0x82, 0xE2, 0xFC, 0xFF, 0x81, 0xC2, 0xFC, 0xFF, 0x81, 0x04, 0xFD, 0xFF, 0x03,
+  0xE4, 0xF4, 0xFF, 0x06, 0xED, 0xFF, 0x8C, 0xED, 0xE9, 0x52, 0xEE, 0x4D, 0xA5,
+  0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0x12, 0xF7, 0xFE, 0x0F, 0xF0, 0xED,
   0x94, 0x29, 0xE5, 0xFF, 0xC4, 0xEC, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF,
   0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE4,
   0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xC5, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF, 0xE7, 0xEC,
   0xFF, 0x09, 0xE5, 0xFF, 0xEF, 0xFD, 0x9A, 0xD4, 0xFE, 0x1A, 0xF7, 0xFE, 0x08,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xD6, 0x12, 0x16, 0xA5, 0x52, 0x4B,
-  0x4A, 0xBB, 0x07, 0x29, 0xF0, 0xC7, 0x28, 0xFA, 0x08, 0x29, 0xFE, 0xE8, 0x28,
-  0xFF, 0xC7, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC9, 0x30, 0xFF, 0xC9,
-  0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30,
-  0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE9,
-  0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28,
-  0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xE9, 0x30, 0xFF, 0xE9, 0x30, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC7, 0x20, 0xFF, 0x07, 0x21,
-  0xF6, 0x0B, 0x42, 0xC5, 0xF5, 0xA4, 0x5D, 0x9A, 0xDE, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xF5, 0xFF, 0x03, 0xF5, 0xFE, 0x18, 0x4F, 0xFE, 0x8D, 0x07,
-  0xDD, 0xFF, 0x07, 0xE5, 0xFF, 0x46, 0xED, 0xFF, 0x04, 0xED, 0xFF, 0x03, 0xFD,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF,
-  0xC3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x25, 0xF5, 0xFF, 0xE5, 0xE4, 0xFF, 0x28,
-  0xE5, 0xFF, 0xEE, 0xED, 0xA5, 0x95, 0xF6, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x72, 0xF6, 0x44, 0xAB, 0xF5, 0xD1, 0x07, 0xF5, 0xFF,
-  0xE4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xA3,
-  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xA4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x05, 0xFD,
-  0xFF, 0xE4, 0xFC, 0xFF, 0x25, 0xFD, 0xFF, 0xE6, 0xEC, 0xFF,
+  0x81, 0x00, 0x00, 0x00, 0x0A, 0xBA, 0xD6, 0x12, 0x16, 0xA5, 0x52, 0x4B, 0x4A,
+  0xBB, 0x07, 0x29, 0xF0, 0xC7, 0x28, 0xFA, 0x08, 0x29, 0xFE, 0xE8, 0x28, 0xFF,
+  0xC7, 0x28, 0xFF, 0xA8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0x82,
+  0xC8, 0x28, 0xFF, 0x81, 0xC9, 0x30, 0xFF, 0x86, 0xC8, 0x30, 0xFF, 0x84, 0xC8,
+  0x28, 0xFF, 0x84, 0xE9, 0x28, 0xFF, 0x00, 0xE8, 0x28, 0xFF, 0x82, 0xC8, 0x28,
+  0xFF, 0x81, 0xE9, 0x30, 0xFF, 0x81, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF,
+  0x04, 0xC7, 0x20, 0xFF, 0x07, 0x21, 0xF6, 0x0B, 0x42, 0xC5, 0xF5, 0xA4, 0x5D,
+  0x9A, 0xDE, 0x16, 0x81, 0x00, 0x00, 0x00, 0x0A, 0xF5, 0xFF, 0x03, 0xF5, 0xFE,
+  0x18, 0x4F, 0xFE, 0x8D, 0x07, 0xDD, 0xFF, 0x07, 0xE5, 0xFF, 0x46, 0xED, 0xFF,
+  0x04, 0xED, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE4,
+  0xFC, 0xFF, 0x81, 0xC3, 0xFC, 0xFF, 0x05, 0xE4, 0xFC, 0xFF, 0x25, 0xF5, 0xFF,
+  0xE5, 0xE4, 0xFF, 0x28, 0xE5, 0xFF, 0xEE, 0xED, 0xA5, 0x95, 0xF6, 0x16, 0xA6,
+  0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x72, 0xF6, 0x44, 0xAB, 0xF5,
+  0xD1, 0x07, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0x81, 0x04, 0xFD, 0xFF, 0x0D, 0xC3,
+  0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xA4, 0xFC, 0xFF, 0xE5, 0xFC,
+  0xFF, 0x05, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0x25, 0xFD, 0xFF, 0xE6, 0xEC, 0xFF,
   0x2A, 0xED, 0xFF, 0x6D, 0xED, 0xCD, 0x53, 0xF6, 0x59, 0x57, 0xFF, 0x17, 0x79,
-  0xFE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xCE, 0x1E, 0x94, 0x9C,
-  0x61, 0x30, 0x73, 0x9E, 0xEA, 0x49, 0xC9, 0x28, 0x31, 0xEF, 0xE8, 0x28, 0xFB,
-  0xC7, 0x20, 0xFF, 0xC7, 0x20, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xA8, 0x30, 0xFF, 0xA8, 0x30,
-  0xFF, 0xA8, 0x30, 0xFF, 0xA7, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0xC8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xE8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28,
-  0xFF, 0xC8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0xA7, 0x28, 0xFF, 0xE7,
-  0x28, 0xFF, 0x28, 0x31, 0xF9, 0xCA, 0x41, 0xD6, 0x30, 0x6B, 0xA9, 0x94, 0x94,
-  0x6C, 0x39, 0xCE, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01,
-  0x37, 0xFF, 0x13, 0x73, 0xF6, 0x54, 0xAF, 0xDD, 0xB2, 0x4B, 0xE5, 0xFF, 0xA5,
-  0xE4, 0xFF, 0x45, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x03, 0xFD,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF,
-  0xA3, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0xE5, 0xF4, 0xFF, 0x27,
-  0xED, 0xFF, 0xAC, 0xED, 0xDA, 0x71, 0xF6, 0x50, 0xF7, 0xFF, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xF7, 0xFD, 0x04, 0xF1, 0xED, 0x75, 0x2B, 0xED, 0xFF, 0x07, 0xED, 0xFF, 0xE5,
-  0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x82, 0xFC, 0xFF, 0x24, 0xFD,
-  0xFF, 0x04, 0xFD, 0xFF, 0xC2, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF,
+  0xFE, 0x05, 0x81, 0x00, 0x00, 0x00, 0x05, 0x19, 0xCE, 0x1E, 0x94, 0x9C, 0x61,
+  0x30, 0x73, 0x9E, 0xEA, 0x49, 0xC9, 0x28, 0x31, 0xEF, 0xE8, 0x28, 0xFB, 0x81,
+  0xC7, 0x20, 0xFF, 0x81, 0xE8, 0x28, 0xFF, 0x82, 0xC8, 0x28, 0xFF, 0x82, 0xA8,
+  0x30, 0xFF, 0x01, 0xA7, 0x30, 0xFF, 0xC8, 0x30, 0xFF, 0x84, 0xC8, 0x28, 0xFF,
+  0x81, 0xE8, 0x28, 0xFF, 0x83, 0xC8, 0x28, 0xFF, 0x82, 0xE8, 0x28, 0xFF, 0x01,
+  0xC7, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0x81, 0xA7, 0x28, 0xFF, 0x05, 0xE7, 0x28,
+  0xFF, 0x28, 0x31, 0xF9, 0xCA, 0x41, 0xD6, 0x30, 0x6B, 0xA9, 0x94, 0x94, 0x6C,
+  0x39, 0xCE, 0x24, 0x81, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x01, 0x37, 0xFF,
+  0x13, 0x73, 0xF6, 0x54, 0xAF, 0xDD, 0xB2, 0x4B, 0xE5, 0xFF, 0xA5, 0xE4, 0xFF,
+  0x45, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xE3, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x81,
+  0xE3, 0xFC, 0xFF, 0x08, 0xC3, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF,
+  0x05, 0xFD, 0xFF, 0xE5, 0xF4, 0xFF, 0x27, 0xED, 0xFF, 0xAC, 0xED, 0xDA, 0x71,
+  0xF6, 0x50, 0xF7, 0xFF, 0x04, 0xA7, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00,
+  0x0A, 0xF7, 0xFD, 0x04, 0xF1, 0xED, 0x75, 0x2B, 0xED, 0xFF, 0x07, 0xED, 0xFF,
+  0xE5, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x82, 0xFC, 0xFF, 0x24,
+  0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xC2, 0xF4, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x08,
   0x04, 0xFD, 0xFF, 0xE5, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x06, 0xF5, 0xFF, 0x08,
   0xE5, 0xFF, 0xCC, 0xED, 0xA4, 0xF3, 0xFE, 0x24, 0x36, 0xFF, 0x0A, 0xBA, 0xFE,
-  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xCE, 0x05,
-  0x16, 0xAD, 0x57, 0xCD, 0x62, 0xAF, 0x69, 0x39, 0xE8, 0x28, 0x29, 0xF0, 0x08,
-  0x29, 0xF8, 0x08, 0x29, 0xFA, 0xE8, 0x20, 0xFC, 0xC8, 0x20, 0xFD, 0xE8, 0x28,
-  0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE8, 0x28, 0xFF,
-  0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8, 0x28, 0xFF, 0xC8,
-  0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xE8, 0x28, 0xFF, 0xC9, 0x28, 0xFF, 0xE9, 0x28,
-  0xFF, 0xE9, 0x28, 0xFE, 0xE8, 0x28, 0xFD, 0xC8, 0x28, 0xFC, 0xC7, 0x28, 0xFC,
-  0xC7, 0x28, 0xFD, 0xE7, 0x28, 0xFC, 0x07, 0x31, 0xF9, 0x07, 0x31, 0xF5, 0x48,
-  0x31, 0xED, 0xAD, 0x5A, 0xBD, 0xF6, 0xA4, 0x67, 0x9D, 0xD6, 0x0B, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFE, 0x05, 0xB7, 0xFE, 0x0C,
-  0xB2, 0xFE, 0x24, 0xAC, 0xF5, 0x94, 0x08, 0xE5, 0xFF, 0x27, 0xF5, 0xFF, 0x07,
-  0xF5, 0xFF, 0x06, 0xFD, 0xFF, 0x25, 0xFD, 0xFF, 0xA2, 0xFC, 0xFF, 0x03, 0xFD,
-  0xFF, 0xC2, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x83, 0xFC, 0xFF,
-  0x05, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0x28,
-  0xE5, 0xFF, 0xCF, 0xED, 0x89, 0xD6, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5,
-  0xFE, 0x1B, 0xEE, 0xED, 0x94, 0x29, 0xE5, 0xFF, 0x06, 0xED, 0xFF, 0xE5, 0xF4,
-  0xFF, 0x25, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x23, 0xFD, 0xFF,
-  0xE2, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xF4, 0xFF, 0x26, 0xF5, 0xFF, 0x28, 0xE5,
-  0xFF, 0x6C, 0xE5, 0xFF, 0xAF, 0xE5, 0xC5, 0x54, 0xEE, 0x61, 0xD7, 0xF6, 0x1A,
-  0x39, 0xFF, 0x0A, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x79, 0xDE, 0x1A, 0xB8, 0xC5, 0x35, 0x36, 0xB5, 0x4E, 0x74, 0x94,
-  0x6E, 0x91, 0x7B, 0x94, 0xEF, 0x62, 0xB0, 0x2C, 0x4A, 0xC6, 0xAA, 0x39, 0xD7,
-  0x49, 0x31, 0xE8, 0xE7, 0x28, 0xEF, 0xE7, 0x28, 0xF1, 0xE7, 0x28, 0xF3, 0xE7,
-  0x28, 0xF4, 0xE7, 0x28, 0xF3, 0xE8, 0x28, 0xF2, 0xE8, 0x28, 0xF0, 0xE7, 0x28,
-  0xED, 0x29, 0x31, 0xE5, 0x8A, 0x39, 0xD4, 0x2C, 0x52, 0xC1, 0xCE, 0x6A, 0xAD,
-  0x90, 0x7B, 0x93, 0x53, 0x9C, 0x70, 0x16, 0xB5, 0x50, 0xB7, 0xC5, 0x37, 0x59,
-  0xDE, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFE,
-  0x05, 0x58, 0xFF, 0x0D, 0xF7, 0xF6, 0x1D, 0x73, 0xF6, 0x64,
-  0x8E, 0xE5, 0xBF, 0x6B, 0xED, 0xFC, 0x08, 0xED, 0xFF, 0x06, 0xF5, 0xFF, 0x04,
-  0xFD, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC,
-  0xFF, 0xC3, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xC4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0x06, 0xED, 0xFF, 0x27,
-  0xED, 0xFF, 0xCD, 0xF5, 0xA0, 0xD3, 0xFE, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xF6, 0x2D, 0xCF, 0xED,
-  0xC5, 0x29, 0xED, 0xFF, 0x26, 0xF5, 0xFF, 0x23, 0xF5, 0xFF, 0x22, 0xFD, 0xFF,
-  0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF,
+  0x06, 0x82, 0x00, 0x00, 0x00, 0x09, 0x79, 0xCE, 0x05, 0x16, 0xAD, 0x57, 0xCD,
+  0x62, 0xAF, 0x69, 0x39, 0xE8, 0x28, 0x29, 0xF0, 0x08, 0x29, 0xF8, 0x08, 0x29,
+  0xFA, 0xE8, 0x20, 0xFC, 0xC8, 0x20, 0xFD, 0xE8, 0x28, 0xFF, 0x81, 0xE9, 0x28,
+  0xFF, 0x00, 0xE8, 0x28, 0xFF, 0x84, 0xC8, 0x28, 0xFF, 0x81, 0xE8, 0x28, 0xFF,
+  0x0D, 0xC9, 0x28, 0xFF, 0xE9, 0x28, 0xFF, 0xE9, 0x28, 0xFE, 0xE8, 0x28, 0xFD,
+  0xC8, 0x28, 0xFC, 0xC7, 0x28, 0xFC, 0xC7, 0x28, 0xFD, 0xE7, 0x28, 0xFC, 0x07,
+  0x31, 0xF9, 0x07, 0x31, 0xF5, 0x48, 0x31, 0xED, 0xAD, 0x5A, 0xBD, 0xF6, 0xA4,
+  0x67, 0x9D, 0xD6, 0x0B, 0x82, 0x00, 0x00, 0x00, 0x0F, 0x79, 0xFE, 0x05, 0xB7,
+  0xFE, 0x0C, 0xB2, 0xFE, 0x24, 0xAC, 0xF5, 0x94, 0x08, 0xE5, 0xFF, 0x27, 0xF5,
+  0xFF, 0x07, 0xF5, 0xFF, 0x06, 0xFD, 0xFF, 0x25, 0xFD, 0xFF, 0xA2, 0xFC, 0xFF,
+  0x03, 0xFD, 0xFF, 0xC2, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x83,
+  0xFC, 0xFF, 0x05, 0xFD, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x03, 0x06, 0xF5, 0xFF,
+  0x28, 0xE5, 0xFF, 0xCF, 0xED, 0x89, 0xD6, 0xFE, 0x07, 0xA9, 0x00, 0x00, 0x00,
+  0xAB, 0x00, 0x00, 0x00, 0x09, 0xD5, 0xFE, 0x1B, 0xEE, 0xED, 0x94, 0x29, 0xE5,
+  0xFF, 0x06, 0xED, 0xFF, 0xE5, 0xF4, 0xFF, 0x25, 0xFD, 0xFF, 0x03, 0xFD, 0xFF,
+  0x02, 0xFD, 0xFF, 0x23, 0xFD, 0xFF, 0xE2, 0xF4, 0xFF, 0x83, 0xE3, 0xFC, 0xFF,
+  0x09, 0xC2, 0xFC, 0xFF, 0xE3, 0xF4, 0xFF, 0x26, 0xF5, 0xFF, 0x28, 0xE5, 0xFF,
+  0x6C, 0xE5, 0xFF, 0xAF, 0xE5, 0xC5, 0x54, 0xEE, 0x61, 0xD7, 0xF6, 0x1A, 0x39,
+  0xFF, 0x0A, 0xFF, 0xFF, 0x02, 0x82, 0x00, 0x00, 0x00, 0x19, 0x79, 0xDE, 0x1A,
+  0xB8, 0xC5, 0x35, 0x36, 0xB5, 0x4E, 0x74, 0x94, 0x6E, 0x91, 0x7B, 0x94, 0xEF,
+  0x62, 0xB0, 0x2C, 0x4A, 0xC6, 0xAA, 0x39, 0xD7, 0x49, 0x31, 0xE8, 0xE7, 0x28,
+  0xEF, 0xE7, 0x28, 0xF1, 0xE7, 0x28, 0xF3, 0xE7, 0x28, 0xF4, 0xE7, 0x28, 0xF3,
+  0xE8, 0x28, 0xF2, 0xE8, 0x28, 0xF0, 0xE7, 0x28, 0xED, 0x29, 0x31, 0xE5, 0x8A,
+  0x39, 0xD4, 0x2C, 0x52, 0xC1, 0xCE, 0x6A, 0xAD, 0x90, 0x7B, 0x93, 0x53, 0x9C,
+  0x70, 0x16, 0xB5, 0x50, 0xB7, 0xC5, 0x37, 0x59, 0xDE, 0x1D, 0x82, 0x00, 0x00,
+  0x00, 0x08, 0x79, 0xFE, 0x05, 0x58, 0xFF, 0x0D, 0xF7, 0xF6, 0x1D, 0x73, 0xF6,
+  0x64, 0x8E, 0xE5, 0xBF, 0x6B, 0xED, 0xFC, 0x08, 0xED, 0xFF, 0x06, 0xF5, 0xFF,
+  0x04, 0xFD, 0xFF, 0x81, 0xC3, 0xFC, 0xFF, 0x00, 0xE3, 0xFC, 0xFF, 0x81, 0xC3,
+  0xFC, 0xFF, 0x00, 0xC2, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x06, 0xC4, 0xFC,
+  0xFF, 0xE5, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0x06, 0xED, 0xFF, 0x27, 0xED, 0xFF,
+  0xCD, 0xF5, 0xA0, 0xD3, 0xFE, 0x28, 0xAB, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00,
+  0x00, 0x08, 0x94, 0xF6, 0x2D, 0xCF, 0xED, 0xC5, 0x29, 0xED, 0xFF, 0x26, 0xF5,
+  0xFF, 0x23, 0xF5, 0xFF, 0x22, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0xE2, 0xFC, 0xFF,
+  0xE3, 0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x00, 0x03,
+  0xFD, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x0B, 0xE5, 0xFC, 0xFF, 0xE6, 0xF4, 0xFF,
   0xE7, 0xEC, 0xFF, 0x29, 0xED, 0xFF, 0x8B, 0xF5, 0xED, 0xEE, 0xFD, 0x84, 0x71,
   0xFE, 0x43, 0xB3, 0xFE, 0x2B, 0xF5, 0xFE, 0x18, 0xD6, 0xFE, 0x0E, 0x18, 0xFF,
-  0x09, 0xF5, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
-  0xE7, 0x09, 0x7B, 0xCE, 0x14, 0x5A, 0xCE, 0x17, 0x5A, 0xCE, 0x17, 0xBA, 0xD6,
-  0x13, 0xDB, 0xDE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xBA, 0xFE, 0x06, 0x57, 0xFF, 0x0B, 0x14, 0xFF, 0x19, 0xB4, 0xFE,
-  0x2B, 0x72, 0xFE, 0x47, 0x0F, 0xF6, 0x8A, 0x8C, 0xED, 0xED, 0x29, 0xED, 0xFF,
-  0xE7, 0xEC, 0xFF, 0xE6, 0xF4, 0xFF, 0xE5, 0xF4, 0xFF, 0xE5, 0xFC, 0xFF, 0xE5,
-  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0x03, 0xFD, 0xFF, 0x04, 0xF5, 0xFF, 0x25, 0xED, 0xFF, 0x28, 0xE5, 0xFF, 0xCD,
-  0xED, 0xCC, 0x73, 0xF6, 0x39, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xB3, 0xFE, 0x24, 0xEC, 0xED, 0xBD,
-  0x27, 0xE5, 0xFF, 0x05, 0xED, 0xFF, 0x04, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4,
-  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE5, 0xF4, 0xFF, 0xE6,
-  0xF4, 0xFF, 0x07, 0xED, 0xFF, 0x28, 0xED, 0xFF, 0x4A, 0xED, 0xFF, 0x6C, 0xE5,
-  0xFF, 0xCE, 0xED, 0xD2, 0x31, 0xEE, 0x7F, 0x94, 0xF6, 0x46, 0xD5, 0xF6, 0x1C,
-  0x58, 0xFF, 0x0D, 0x57, 0xFF, 0x0C, 0x57, 0xFF, 0x0B, 0xF7, 0xFE, 0x08, 0xD6,
-  0xFE, 0x07, 0xF9, 0xFF, 0x05, 0x79, 0xFE, 0x05, 0xF7, 0xFF, 0x04, 0x79, 0xFE,
-  0x05, 0x79, 0xFE, 0x05, 0x79, 0xFE, 0x05, 0xBA, 0xFE, 0x06,
-  0xD6, 0xFE, 0x07, 0x18, 0xFF, 0x09, 0x39, 0xFF, 0x0A, 0x57, 0xFF, 0x0B, 0x17,
-  0xFF, 0x19, 0xB4, 0xF6, 0x44, 0x32, 0xEE, 0x7C, 0xF0, 0xE5, 0xC6, 0x8B, 0xDD,
-  0xFF, 0x6A, 0xE5, 0xFF, 0x29, 0xE5, 0xFF, 0x08, 0xED, 0xFF, 0xE6, 0xF4, 0xFF,
-  0xE5, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0x02, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0x05, 0xF5, 0xFF, 0x06, 0xED, 0xFF, 0x27, 0xE5, 0xFF, 0xEB,
-  0xED, 0xCA, 0xD1, 0xFE, 0x2F, 0xB5, 0xFE, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x02, 0xB4, 0xF6, 0x38, 0xCF, 0xED, 0xA0, 0x2A,
-  0xE5, 0xF9, 0xE7, 0xF4, 0xFF, 0xC5, 0xFC, 0xFF, 0xA4, 0xFC, 0xFF, 0xA3, 0xFC,
-  0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF,
-  0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xF4, 0xFF, 0xE4, 0xF4,
-  0xFF, 0xE5, 0xF4, 0xFF, 0xE6, 0xF4, 0xFF, 0x06, 0xED, 0xFF, 0x07, 0xED, 0xFF,
+  0x09, 0xF5, 0xFF, 0x03, 0x86, 0x00, 0x00, 0x00, 0x01, 0x1C, 0xE7, 0x09, 0x7B,
+  0xCE, 0x14, 0x81, 0x5A, 0xCE, 0x17, 0x01, 0xBA, 0xD6, 0x13, 0xDB, 0xDE, 0x07,
+  0x87, 0x00, 0x00, 0x00, 0x0A, 0xBA, 0xFE, 0x06, 0x57, 0xFF, 0x0B, 0x14, 0xFF,
+  0x19, 0xB4, 0xFE, 0x2B, 0x72, 0xFE, 0x47, 0x0F, 0xF6, 0x8A, 0x8C, 0xED, 0xED,
+  0x29, 0xED, 0xFF, 0xE7, 0xEC, 0xFF, 0xE6, 0xF4, 0xFF, 0xE5, 0xF4, 0xFF, 0x81,
+  0xE5, 0xFC, 0xFF, 0x00, 0xE4, 0xFC, 0xFF, 0x83, 0xE3, 0xFC, 0xFF, 0x81, 0xC3,
+  0xFC, 0xFF, 0x07, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x04, 0xF5, 0xFF, 0x25,
+  0xED, 0xFF, 0x28, 0xE5, 0xFF, 0xCD, 0xED, 0xCC, 0x73, 0xF6, 0x39, 0xFF, 0xFF,
+  0x01, 0xAC, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x01,
+  0xB3, 0xFE, 0x24, 0xEC, 0xED, 0xBD, 0x27, 0xE5, 0xFF, 0x05, 0xED, 0xFF, 0x04,
+  0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x82,
+  0xE3, 0xFC, 0xFF, 0x00, 0xC3, 0xFC, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x00, 0xE3,
+  0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x11, 0xE5, 0xF4, 0xFF, 0xE6, 0xF4, 0xFF,
+  0x07, 0xED, 0xFF, 0x28, 0xED, 0xFF, 0x4A, 0xED, 0xFF, 0x6C, 0xE5, 0xFF, 0xCE,
+  0xED, 0xD2, 0x31, 0xEE, 0x7F, 0x94, 0xF6, 0x46, 0xD5, 0xF6, 0x1C, 0x58, 0xFF,
+  0x0D, 0x57, 0xFF, 0x0C, 0x57, 0xFF, 0x0B, 0xF7, 0xFE, 0x08, 0xD6, 0xFE, 0x07,
+  0xF9, 0xFF, 0x05, 0x79, 0xFE, 0x05, 0xF7, 0xFF, 0x04, 0x82, 0x79, 0xFE, 0x05,
+  0x0F, 0xBA, 0xFE, 0x06, 0xD6, 0xFE, 0x07, 0x18, 0xFF, 0x09, 0x39, 0xFF, 0x0A,
+  0x57, 0xFF, 0x0B, 0x17, 0xFF, 0x19, 0xB4, 0xF6, 0x44, 0x32, 0xEE, 0x7C, 0xF0,
+  0xE5, 0xC6, 0x8B, 0xDD, 0xFF, 0x6A, 0xE5, 0xFF, 0x29, 0xE5, 0xFF, 0x08, 0xED,
+  0xFF, 0xE6, 0xF4, 0xFF, 0xE5, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0x81, 0x03, 0xFD,
+  0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x00, 0xC4, 0xFC, 0xFF, 0x82, 0xE3, 0xFC, 0xFF,
+  0x00, 0x02, 0xFD, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x06, 0xE4, 0xFC, 0xFF, 0x05,
+  0xF5, 0xFF, 0x06, 0xED, 0xFF, 0x27, 0xE5, 0xFF, 0xEB, 0xED, 0xCA, 0xD1, 0xFE,
+  0x2F, 0xB5, 0xFE, 0x06, 0xAE, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x09,
+  0xF0, 0xFF, 0x02, 0xB4, 0xF6, 0x38, 0xCF, 0xED, 0xA0, 0x2A, 0xE5, 0xF9, 0xE7,
+  0xF4, 0xFF, 0xC5, 0xFC, 0xFF, 0xA4, 0xFC, 0xFF, 0xA3, 0xFC, 0xFF, 0xC3, 0xFC,
+  0xFF, 0xE3, 0xFC, 0xFF, 0x82, 0x03, 0xFD, 0xFF, 0x02, 0xE3, 0xFC, 0xFF, 0xC3,
+  0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x82, 0xE3, 0xFC, 0xFF, 0x81, 0xE4, 0xF4, 0xFF,
+  0x0C, 0xE5, 0xF4, 0xFF, 0xE6, 0xF4, 0xFF, 0x06, 0xED, 0xFF, 0x07, 0xED, 0xFF,
   0x08, 0xED, 0xFF, 0x28, 0xED, 0xFF, 0x29, 0xED, 0xFF, 0x4A, 0xED, 0xFF, 0x6A,
   0xF5, 0xFD, 0x8B, 0xF5, 0xEE, 0xAC, 0xF5, 0xDF, 0xAC, 0xF5, 0xD2, 0xAC, 0xF5,
-  0xCE, 0xAD, 0xF5, 0xCA, 0xAD, 0xF5, 0xCA, 0xAC, 0xFD, 0xCC, 0xAC, 0xF5, 0xD2,
-  0x8C, 0xF5, 0xDE, 0x6B, 0xF5, 0xEB, 0x4A, 0xF5, 0xFB, 0x29, 0xF5, 0xFF, 0x28,
-  0xED, 0xFF, 0x08, 0xED, 0xFF, 0x07, 0xED, 0xFF, 0x07, 0xED, 0xFF, 0xE6, 0xEC,
-  0xFF, 0x05, 0xF5, 0xFF, 0xE5, 0xF4, 0xFF, 0xE4, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF,
-  0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0x03, 0xFD,
-  0xFF, 0x03, 0xFD, 0xFF, 0xE1, 0xFC, 0xFF, 0xE1, 0xFC, 0xFF,
+  0xCE, 0x81, 0xAD, 0xF5, 0xCA, 0x07, 0xAC, 0xFD, 0xCC, 0xAC, 0xF5, 0xD2, 0x8C,
+  0xF5, 0xDE, 0x6B, 0xF5, 0xEB, 0x4A, 0xF5, 0xFB, 0x29, 0xF5, 0xFF, 0x28, 0xED,
+  0xFF, 0x08, 0xED, 0xFF, 0x81, 0x07, 0xED, 0xFF, 0x05, 0xE6, 0xEC, 0xFF, 0x05,
+  0xF5, 0xFF, 0xE5, 0xF4, 0xFF, 0xE4, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0xC3, 0xFC,
+  0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x00, 0x03, 0xFD, 0xFF, 0x81, 0xE3, 0xFC, 0xFF,
+  0x81, 0x04, 0xFD, 0xFF, 0x81, 0x03, 0xFD, 0xFF, 0x81, 0xE1, 0xFC, 0xFF, 0x06,
   0xE2, 0xFC, 0xFF, 0x04, 0xF5, 0xFF, 0x06, 0xED, 0xFF, 0x29, 0xE5, 0xFB, 0xCF,
-  0xED, 0xA7, 0x94, 0xF6, 0x43, 0x79, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x36, 0xFF, 0x0A, 0xEF, 0xF5, 0x81, 0x0A, 0xF5, 0xF7, 0xE7, 0xFC,
-  0xFF, 0xC6, 0xFC, 0xFF, 0xC5, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF,
-  0xE3, 0xF4, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD,
-  0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC4,
-  0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE5, 0xFC,
-  0xFF, 0x05, 0xF5, 0xFF, 0x05, 0xF5, 0xFF, 0x05, 0xF5, 0xFF, 0x05, 0xF5, 0xFF,
-  0xE5, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0xE4,
-  0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xC2,
-  0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD,
-  0xFF, 0xE3, 0xF4, 0xFF, 0xE3, 0xF4, 0xFF, 0xE3, 0xF4, 0xFF, 0xE3, 0xFC, 0xFF,
-  0x04, 0xF5, 0xFF, 0x26, 0xED, 0xFF, 0x49, 0xED, 0xF7, 0xEE, 0xF5, 0x92, 0x14,
-  0xFF, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xD6, 0xFE, 0x0D, 0x93, 0xF6, 0x3D, 0xCE, 0xE5, 0xA1, 0x6B, 0xED, 0xFF,
-  0x08, 0xED, 0xFF, 0xE6, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF,
-  0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4,
-  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC,
-  0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF,
-  0xC3, 0xFC, 0xFF, 0xC4, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2, 0xFC,
-  0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x05, 0xED, 0xFF,
-  0x27, 0xED, 0xFF, 0x8A, 0xE5, 0xFF, 0xAD, 0xE5, 0xB0, 0x73, 0xF6, 0x47, 0xF7,
-  0xEE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xB5, 0xFE, 0x0C, 0x10, 0xF6, 0x64, 0x8C, 0xED, 0xBF, 0x49,
-  0xF5, 0xF2, 0x28, 0xF5, 0xFF, 0x07, 0xF5, 0xFF, 0x05, 0xF5, 0xFF, 0xE5, 0xF4,
-  0xFF, 0xE5, 0xF4, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0x04, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x03, 0xFD, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xC2, 0xFC,
-  0xFF, 0xC2, 0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF,
-  0x03, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE4,
-  0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xC4, 0xFC,
-  0xFF, 0xE5, 0xFC, 0xFF, 0x06, 0xFD, 0xFF, 0x27, 0xF5, 0xFF, 0x48, 0xED, 0xF3,
-  0x8B, 0xED, 0xCA, 0x2F, 0xEE, 0x70, 0xD4, 0xF6, 0x14, 0xFF, 0xFF, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
-  0xFF, 0x05, 0x36, 0xFF, 0x0A, 0x52, 0xF6, 0x36, 0xAE, 0xED, 0xA3, 0x2A, 0xE5,
-  0xFF, 0x08, 0xED, 0xFF, 0x06, 0xED, 0xFF, 0x06, 0xF5, 0xFF, 0xE5, 0xF4, 0xFF,
-  0x05, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xC2,
-  0xFC, 0xFF, 0xC2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x02, 0xFD,
-  0xFF, 0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC,
-  0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF, 0x03, 0xFD, 0xFF,
-  0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0xE3,
-  0xFC, 0xFF, 0xE3, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0x06, 0xF5,
-  0xFF, 0x07, 0xED, 0xFF, 0x28, 0xE5, 0xFF, 0x2A, 0xDD, 0xFF, 0xAE, 0xE5, 0xAC,
-  0x73, 0xEE, 0x41, 0xD6, 0xFE, 0x0D, 0xF9, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x36, 0xFF, 0x0A, 0x71, 0xFE, 0x2A, 0x4F, 0xFE, 0x5C,
-  0xCD, 0xF5, 0x95, 0x6B, 0xED, 0xCC, 0x29, 0xED, 0xFE, 0x08, 0xED, 0xFF, 0x07,
-  0xED, 0xFF, 0x06, 0xED, 0xFF, 0x06, 0xF5, 0xFF, 0x05, 0xF5, 0xFF, 0x04, 0xF5,
-  0xFF, 0x04, 0xFD, 0xFF, 0x04, 0xFD, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF,
-  0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4,
-  0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xFD, 0xFF, 0x04, 0xFD,
-  0xFF, 0x04, 0xF5, 0xFF, 0x04, 0xF5, 0xFF, 0xE4, 0xF4, 0xFF, 0xE5, 0xF4, 0xFF,
-  0xE5, 0xF4, 0xFF, 0xE5, 0xF4, 0xFF, 0x06, 0xF5, 0xFF, 0x06, 0xF5, 0xFF, 0x06,
-  0xED, 0xFF, 0x07, 0xED, 0xFF, 0x07, 0xED, 0xFF, 0x28, 0xED, 0xFF, 0x6A, 0xF5,
-  0xD7, 0xED, 0xF5, 0x9C, 0x50, 0xFE, 0x63, 0xB2, 0xFE, 0x32,
-  0xD6, 0xFE, 0x0E, 0xF5, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFE, 0x05, 0x79,
-  0xFE, 0x05, 0x94, 0xFE, 0x2E, 0x32, 0xEE, 0x73, 0xAF, 0xED, 0xB2, 0x4D, 0xDD,
-  0xE4, 0x4B, 0xE5, 0xF3, 0x2A, 0xE5, 0xFB, 0x29, 0xED, 0xFF, 0x08, 0xED, 0xFF,
-  0x08, 0xED, 0xFF, 0x08, 0xED, 0xFF, 0xE7, 0xEC, 0xFF, 0x07, 0xF5, 0xFF, 0x06,
-  0xF5, 0xFF, 0xE6, 0xF4, 0xFF, 0x06, 0xF5, 0xFF, 0x06, 0xED, 0xFF, 0x06, 0xED,
-  0xFF, 0x07, 0xED, 0xFF, 0x27, 0xED, 0xFF, 0x07, 0xED, 0xFF, 0x08, 0xED, 0xFF,
-  0x08, 0xED, 0xFF, 0x29, 0xE5, 0xFF, 0x29, 0xE5, 0xFF, 0x2A, 0xE5, 0xFE, 0x4A,
-  0xE5, 0xF5, 0x4B, 0xDD, 0xEA, 0xD0, 0xDD, 0xBA, 0x33, 0xE6, 0x77, 0xB5, 0xF6,
-  0x36, 0xF7, 0xFE, 0x08, 0xF7, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xF7, 0xFF, 0x04, 0x15, 0xFF, 0x09, 0xB5, 0xFE, 0x12, 0xB4, 0xFE, 0x20,
-  0x93, 0xFE, 0x2D, 0x72, 0xFE, 0x38, 0x71, 0xFE, 0x4C, 0x50, 0xFE, 0x60, 0x0F,
-  0xFE, 0x73, 0x0E, 0xFE, 0x83, 0x0E, 0xFE, 0x8A, 0xEE, 0xFD, 0x90, 0xEE, 0xF5,
-  0x90, 0x0E, 0xF6, 0x89, 0x0F, 0xF6, 0x81, 0x2F, 0xF6, 0x74,
-  0x50, 0xFE, 0x63, 0x71, 0xFE, 0x4E, 0x72, 0xFE, 0x39, 0xB2, 0xFE, 0x2C, 0xB3,
-  0xFE, 0x20, 0xD5, 0xFE, 0x15, 0x54, 0xFF, 0x0B, 0xB5, 0xFE, 0x06, 0xFF, 0xFF,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00,
+  0xED, 0xA7, 0x94, 0xF6, 0x43, 0x79, 0xFE, 0x05, 0xB0, 0x00, 0x00, 0x00, 0xB3,
+  0x00, 0x00, 0x00, 0x05, 0x36, 0xFF, 0x0A, 0xEF, 0xF5, 0x81, 0x0A, 0xF5, 0xF7,
+  0xE7, 0xFC, 0xFF, 0xC6, 0xFC, 0xFF, 0xC5, 0xFC, 0xFF, 0x81, 0xC4, 0xFC, 0xFF,
+  0x00, 0xE3, 0xF4, 0xFF, 0x82, 0x03, 0xFD, 0xFF, 0x01, 0xE3, 0xFC, 0xFF, 0xE2,
+  0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x83, 0x03, 0xFD, 0xFF, 0x00, 0xE3, 0xFC,
+  0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x82, 0xC4, 0xFC, 0xFF, 0x82, 0xE5, 0xFC, 0xFF,
+  0x83, 0x05, 0xF5, 0xFF, 0x83, 0xE5, 0xFC, 0xFF, 0x00, 0xE4, 0xFC, 0xFF, 0x81,
+  0xC4, 0xFC, 0xFF, 0x83, 0xE3, 0xFC, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x81, 0x03,
+  0xFD, 0xFF, 0x01, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x81, 0xC2, 0xFC, 0xFF,
+  0x82, 0x03, 0xFD, 0xFF, 0x82, 0xE3, 0xF4, 0xFF, 0x05, 0xE3, 0xFC, 0xFF, 0x04,
+  0xF5, 0xFF, 0x26, 0xED, 0xFF, 0x49, 0xED, 0xF7, 0xEE, 0xF5, 0x92, 0x14, 0xFF,
+  0x11, 0xB3, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, 0x05, 0xD6, 0xFE, 0x0D,
+  0x93, 0xF6, 0x3D, 0xCE, 0xE5, 0xA1, 0x6B, 0xED, 0xFF, 0x08, 0xED, 0xFF, 0xE6,
+  0xF4, 0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x81, 0x04, 0xFD,
+  0xFF, 0x00, 0xE4, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x84, 0xC3, 0xFC, 0xFF,
+  0x00, 0xE3, 0xFC, 0xFF, 0x8D, 0xE4, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x00,
+  0x03, 0xFD, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x82, 0xC3, 0xFC, 0xFF, 0x01, 0xC4,
+  0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x84, 0xE3, 0xFC, 0xFF, 0x81, 0xC2, 0xFC, 0xFF,
+  0x81, 0xE3, 0xFC, 0xFF, 0x05, 0x05, 0xED, 0xFF, 0x27, 0xED, 0xFF, 0x8A, 0xE5,
+  0xFF, 0xAD, 0xE5, 0xB0, 0x73, 0xF6, 0x47, 0xF7, 0xEE, 0x0F, 0xB5, 0x00, 0x00,
+  0x00, 0xB8, 0x00, 0x00, 0x00, 0x06, 0xB5, 0xFE, 0x0C, 0x10, 0xF6, 0x64, 0x8C,
+  0xED, 0xBF, 0x49, 0xF5, 0xF2, 0x28, 0xF5, 0xFF, 0x07, 0xF5, 0xFF, 0x05, 0xF5,
+  0xFF, 0x81, 0xE5, 0xF4, 0xFF, 0x82, 0xE4, 0xFC, 0xFF, 0x00, 0x04, 0xFD, 0xFF,
+  0x81, 0xE3, 0xFC, 0xFF, 0x00, 0x03, 0xFD, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x01,
+  0xE2, 0xFC, 0xFF, 0xC3, 0xFC, 0xFF, 0x8B, 0xE3, 0xFC, 0xFF, 0x00, 0xE2, 0xFC,
+  0xFF, 0x82, 0xC2, 0xFC, 0xFF, 0x81, 0xE3, 0xFC, 0xFF, 0x00, 0x03, 0xFD, 0xFF,
+  0x81, 0xE4, 0xFC, 0xFF, 0x02, 0xE3, 0xFC, 0xFF, 0xE4, 0xFC, 0xFF, 0x04, 0xFD,
+  0xFF, 0x81, 0xE4, 0xFC, 0xFF, 0x08, 0xC4, 0xFC, 0xFF, 0xE5, 0xFC, 0xFF, 0x06,
+  0xFD, 0xFF, 0x27, 0xF5, 0xFF, 0x48, 0xED, 0xF3, 0x8B, 0xED, 0xCA, 0x2F, 0xEE,
+  0x70, 0xD4, 0xF6, 0x14, 0xFF, 0xFF, 0x01, 0xB7, 0x00, 0x00, 0x00, 0xBA, 0x00,
+  0x00, 0x00, 0x0A, 0xF9, 0xFF, 0x05, 0x36, 0xFF, 0x0A, 0x52, 0xF6, 0x36, 0xAE,
+  0xED, 0xA3, 0x2A, 0xE5, 0xFF, 0x08, 0xED, 0xFF, 0x06, 0xED, 0xFF, 0x06, 0xF5,
+  0xFF, 0xE5, 0xF4, 0xFF, 0x05, 0xF5, 0xFF, 0xE4, 0xFC, 0xFF, 0x81, 0xE3, 0xFC,
+  0xFF, 0x81, 0xC2, 0xFC, 0xFF, 0x81, 0xE2, 0xFC, 0xFF, 0x03, 0x02, 0xFD, 0xFF,
+  0x03, 0xFD, 0xFF, 0xE3, 0xFC, 0xFF, 0xE2, 0xFC, 0xFF, 0x88, 0xE3, 0xFC, 0xFF,
+  0x83, 0x03, 0xFD, 0xFF, 0x85, 0xE3, 0xFC, 0xFF, 0x09, 0x04, 0xFD, 0xFF, 0xE4,
+  0xFC, 0xFF, 0x06, 0xF5, 0xFF, 0x07, 0xED, 0xFF, 0x28, 0xE5, 0xFF, 0x2A, 0xDD,
+  0xFF, 0xAE, 0xE5, 0xAC, 0x73, 0xEE, 0x41, 0xD6, 0xFE, 0x0D, 0xF9, 0xFF, 0x05,
+  0xBA, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0x36, 0xFF, 0x0A, 0x71,
+  0xFE, 0x2A, 0x4F, 0xFE, 0x5C, 0xCD, 0xF5, 0x95, 0x6B, 0xED, 0xCC, 0x29, 0xED,
+  0xFE, 0x08, 0xED, 0xFF, 0x07, 0xED, 0xFF, 0x06, 0xED, 0xFF, 0x06, 0xF5, 0xFF,
+  0x05, 0xF5, 0xFF, 0x04, 0xF5, 0xFF, 0x81, 0x04, 0xFD, 0xFF, 0x88, 0xE4, 0xFC,
+  0xFF, 0x81, 0x04, 0xFD, 0xFF, 0x81, 0x04, 0xF5, 0xFF, 0x00, 0xE4, 0xF4, 0xFF,
+  0x82, 0xE5, 0xF4, 0xFF, 0x81, 0x06, 0xF5, 0xFF, 0x00, 0x06, 0xED, 0xFF, 0x81,
+  0x07, 0xED, 0xFF, 0x06, 0x28, 0xED, 0xFF, 0x6A, 0xF5, 0xD7, 0xED, 0xF5, 0x9C,
+  0x50, 0xFE, 0x63, 0xB2, 0xFE, 0x32, 0xD6, 0xFE, 0x0E, 0xF5, 0xFF, 0x03, 0xBD,
+  0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0x81, 0x79, 0xFE, 0x05, 0x06, 0x94,
+  0xFE, 0x2E, 0x32, 0xEE, 0x73, 0xAF, 0xED, 0xB2, 0x4D, 0xDD, 0xE4, 0x4B, 0xE5,
+  0xF3, 0x2A, 0xE5, 0xFB, 0x29, 0xED, 0xFF, 0x82, 0x08, 0xED, 0xFF, 0x04, 0xE7,
+  0xEC, 0xFF, 0x07, 0xF5, 0xFF, 0x06, 0xF5, 0xFF, 0xE6, 0xF4, 0xFF, 0x06, 0xF5,
+  0xFF, 0x81, 0x06, 0xED, 0xFF, 0x02, 0x07, 0xED, 0xFF, 0x27, 0xED, 0xFF, 0x07,
+  0xED, 0xFF, 0x81, 0x08, 0xED, 0xFF, 0x81, 0x29, 0xE5, 0xFF, 0x07, 0x2A, 0xE5,
+  0xFE, 0x4A, 0xE5, 0xF5, 0x4B, 0xDD, 0xEA, 0xD0, 0xDD, 0xBA, 0x33, 0xE6, 0x77,
+  0xB5, 0xF6, 0x36, 0xF7, 0xFE, 0x08, 0xF7, 0xFF, 0x04, 0xC2, 0x00, 0x00, 0x00,
+  0xC7, 0x00, 0x00, 0x00, 0x18, 0xF7, 0xFF, 0x04, 0x15, 0xFF, 0x09, 0xB5, 0xFE,
+  0x12, 0xB4, 0xFE, 0x20, 0x93, 0xFE, 0x2D, 0x72, 0xFE, 0x38, 0x71, 0xFE, 0x4C,
+  0x50, 0xFE, 0x60, 0x0F, 0xFE, 0x73, 0x0E, 0xFE, 0x83, 0x0E, 0xFE, 0x8A, 0xEE,
+  0xFD, 0x90, 0xEE, 0xF5, 0x90, 0x0E, 0xF6, 0x89, 0x0F, 0xF6, 0x81, 0x2F, 0xF6,
+  0x74, 0x50, 0xFE, 0x63, 0x71, 0xFE, 0x4E, 0x72, 0xFE, 0x39, 0xB2, 0xFE, 0x2C,
+  0xB3, 0xFE, 0x20, 0xD5, 0xFE, 0x15, 0x54, 0xFF, 0x0B, 0xB5, 0xFE, 0x06, 0xFF,
+  0xFF, 0x01, 0xC6, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0xA7, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x00,
 };
 const lv_img_dsc_t ui_img_query_icon_png = {
   .header.always_zero = 0,
   .header.w = 168,
   .header.h = 166,
   .data_size = sizeof(ui_img_query_icon_png_data),
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = ui_img_query_icon_png_data
 };
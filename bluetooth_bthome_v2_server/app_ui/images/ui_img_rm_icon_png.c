@@ -10,3304 +10,63 @@
 #endif
 
 // IMAGE DATA: assets\rm_icon.png
+// Scaled to zoom 40 from 118x119 by tools/img_rle_convert.py
+// RLE encoded by tools/img_rle_convert.py, 1026 bytes raw
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_rm_icon_png_data[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03,
-  0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xFE, 0x06, 0xFB, 0xFE, 0x0F,
-  0x1C, 0xFF, 0x12, 0xBA, 0xFE, 0x19, 0x79, 0xFE, 0x30, 0x38, 0xFE, 0x40, 0x58,
-  0xFE, 0x3A, 0x59, 0xFE, 0x41, 0x39, 0xFE, 0x42, 0x18, 0xFE, 0x43, 0x39, 0xFE,
-  0x43, 0x39, 0xFE, 0x44, 0x39, 0xFE, 0x44, 0x39, 0xFE, 0x44, 0x39, 0xFE, 0x44,
-  0x39, 0xFE, 0x44, 0x39, 0xFE, 0x43, 0x18, 0xFE, 0x55, 0xD7, 0xF5, 0x53, 0xD8,
-  0xF5, 0x52, 0xF8, 0xF5, 0x51, 0xF7, 0xF5, 0x50, 0xD7, 0xFD, 0x4F, 0xD7, 0xFD,
-  0x4F, 0xD7, 0xFD, 0x4F, 0xD7, 0xFD, 0x4F, 0xD7, 0xFD, 0x4F, 0x39, 0xFE, 0x3E,
-  0x39, 0xFE, 0x3F, 0x39, 0xFE, 0x40, 0x39, 0xFE, 0x40, 0x39, 0xFE, 0x40, 0x39,
-  0xFE, 0x40, 0x39, 0xFE, 0x40, 0x39, 0xFE, 0x40, 0x18, 0xFE, 0x40, 0x39, 0xFE,
-  0x3F, 0x39, 0xFE, 0x3E, 0xF8, 0xFD, 0x4E, 0xF7, 0xF5, 0x4C, 0xF7, 0xFD, 0x4C,
-  0xF8, 0xFD, 0x4B, 0xD7, 0xFD, 0x4B, 0xD7, 0xFD, 0x4B, 0xF8, 0xFD, 0x4B, 0xD7,
-  0xFD, 0x4B, 0xF7, 0xF5, 0x4C, 0xF8, 0xFD, 0x4D, 0x39, 0xFE, 0x3D, 0x39, 0xFE,
-  0x3F, 0x18, 0xFE, 0x3F, 0x39, 0xFE, 0x40, 0x39, 0xFE, 0x40,
-  0x59, 0xFE, 0x41, 0x59, 0xFE, 0x41, 0x59, 0xFE, 0x41, 0x59, 0xFE, 0x41, 0x39,
-  0xFE, 0x40, 0x39, 0xFE, 0x3F, 0xD7, 0xFD, 0x4F, 0xF8, 0xFD, 0x4D, 0xF8, 0xFD,
-  0x4C, 0xD7, 0xFD, 0x4B, 0xF8, 0xFD, 0x4A, 0xF8, 0xFD, 0x49, 0xF8, 0xFD, 0x49,
-  0xF7, 0xF5, 0x48, 0xF8, 0xF5, 0x48, 0x18, 0xFE, 0x4A, 0x39, 0xFE, 0x3A, 0x59,
-  0xFE, 0x3D, 0x5A, 0xFE, 0x3A, 0xBA, 0xFE, 0x2F, 0xDC, 0xFE, 0x23, 0x1C, 0xFF,
-  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x09,
-  0x5A, 0xFE, 0x31, 0x35, 0xFD, 0x6F, 0x31, 0xEC, 0xBF, 0xB0, 0xEB, 0xE9, 0x4F,
-  0xEB, 0xF8, 0x2E, 0xE3, 0xFC, 0x0E, 0xE3, 0xFF, 0x2E, 0xE3, 0xFF, 0x2E, 0xE3,
-  0xFF, 0x2E, 0xE3, 0xFF, 0x2E, 0xE3, 0xFF, 0x4E, 0xEB, 0xFF, 0x2D, 0xE3, 0xFF,
-  0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D,
-  0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3,
-  0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF,
-  0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D,
-  0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3,
-  0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x4D, 0xEB, 0xFF, 0x4D, 0xEB, 0xFF,
-  0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xEB, 0xFF, 0x2D,
-  0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xEB, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3,
-  0xFF, 0x2D, 0xE3, 0xFF, 0x4D, 0xEB, 0xFF, 0x4D, 0xEB, 0xFF, 0x2D, 0xE3, 0xFF,
-  0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D,
-  0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3,
-  0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF,
-  0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D,
-  0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3, 0xFF, 0x2D, 0xE3,
-  0xFF, 0x2D, 0xE3, 0xFF, 0x4D, 0xE3, 0xFF, 0x6E, 0xE3, 0xFB, 0xAF, 0xDB, 0xE8,
-  0x52, 0xE4, 0xAB, 0x76, 0xFD, 0x5A, 0x9B, 0xFE, 0x1D, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFE, 0x1D,
-  0x55, 0xF5, 0x70, 0xCF, 0xD3, 0xCA, 0x0D, 0xD3, 0xF1, 0x4E, 0xEB, 0xFF, 0x2E,
-  0xF3, 0xFF, 0xAD, 0xF2, 0xFF, 0xCD, 0xFA, 0xFF, 0xAD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xF2, 0xFF, 0xED, 0xF2, 0xFF, 0x4E, 0xF3, 0xFF, 0x4E,
-  0xEB, 0xFF, 0x2D, 0xD3, 0xFA, 0xF0, 0xDB, 0xCC, 0x56, 0xF5, 0x65, 0xBA, 0xFE,
-  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1C, 0xFF, 0x21, 0xD3, 0xFC, 0x8A, 0x8F, 0xEB, 0xE9, 0x2D, 0xE3, 0xFA, 0x4E,
-  0xF3, 0xFF, 0x2E, 0xF3, 0xFF, 0xED, 0xF2, 0xFF, 0xAC, 0xF2, 0xFF, 0xED, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0x0D, 0xFB, 0xFF, 0x0D, 0xFB, 0xFF, 0x0D,
-  0xFB, 0xFF, 0xAC, 0xFA, 0xFF, 0xCC, 0xF2, 0xFF, 0x2E, 0xFB, 0xFF, 0x4F, 0xF3,
-  0xFF, 0x2E, 0xE3, 0xFF, 0xB0, 0xE3, 0xEB, 0xB4, 0xEC, 0x81,
-  0xBC, 0xFE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x9E, 0xFF, 0x11, 0x18, 0xFE, 0x71, 0xAE, 0xD3, 0xE8, 0x2D,
-  0xEB, 0xFF, 0xED, 0xF2, 0xFF, 0x0D, 0xFB, 0xFF, 0xCC, 0xF2, 0xFF, 0xCC, 0xF2,
-  0xFF, 0x0D, 0xFB, 0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCB, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x8B, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xF2, 0xFF, 0xAC, 0xF2, 0xFF, 0xED, 0xF2, 0xFF,
-  0xEE, 0xF2, 0xFF, 0x4E, 0xE3, 0xFF, 0xAF, 0xD3, 0xEA, 0x96, 0xF5, 0x69, 0x5D,
-  0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xFE, 0x2C, 0x72,
-  0xEC, 0xD5, 0x2D, 0xDB, 0xFF, 0x0D, 0xEB, 0xFF, 0x0D, 0xF3, 0xFF, 0xED, 0xF2,
-  0xFF, 0x0D, 0xFB, 0xFF, 0x0D, 0xF3, 0xFF, 0xCC, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF,
-  0xEC, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0x0C, 0xF3, 0xFF, 0x0C,
-  0xF3, 0xFF, 0x0C, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xAC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF,
-  0x0C, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xEC, 0xEA, 0xFF, 0x0D, 0xDB, 0xFF, 0x52, 0xDC, 0xC7, 0x59, 0xFE,
-  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0xFF, 0x04, 0x59, 0xFE, 0x5B, 0xF0, 0xE3, 0xEC, 0xED, 0xE2, 0xFF, 0x0D, 0xFB,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xF2, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xF2,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xF2, 0xFF, 0x0C, 0xFB, 0xFF, 0xEC,
-  0xFA, 0xFF, 0x0C, 0xFB, 0xFF, 0xCB, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xF2, 0xFF, 0x2E, 0xE3, 0xFF, 0x11, 0xDC, 0xE5, 0xD7, 0xF5, 0x3A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0x02, 0xB6, 0xFD, 0x72, 0xAF, 0xDB, 0xFA, 0xED, 0xE2,
-  0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0x0C, 0xF3, 0xFF, 0x0C, 0xF3, 0xFF, 0x0C, 0xF3,
-  0xFF, 0x0B, 0xFB, 0xFF, 0xEB, 0xFA, 0xFF, 0xCB, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0x2E, 0xFB, 0xFF, 0xCD, 0xE2, 0xFF, 0x6F, 0xDB, 0xF0, 0xF9, 0xFD, 0x3F, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xED,
-  0x7E, 0xD0, 0xDB, 0xFF, 0x0D, 0xE3, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xAC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xF2,
-  0xFF, 0x0C, 0xF3, 0xFF, 0x0C, 0xF3, 0xFF, 0x0C, 0xF3, 0xFF, 0x0C, 0xF3, 0xFF,
-  0xEC, 0xFA, 0xFF, 0x0C, 0xFB, 0xFF, 0xCC, 0xFA, 0xFF, 0x8C, 0xFA, 0xFF, 0x0E,
-  0xFB, 0xFF, 0x0E, 0xEB, 0xFF, 0x8F, 0xE3, 0xF1, 0xD7, 0xFD, 0x3B, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xB7, 0xFD, 0x67, 0xF0, 0xE3, 0xFF, 0xED, 0xDA, 0xFF,
-  0xED, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xF3, 0xFF, 0xED, 0xF2, 0xFF, 0x0D,
-  0xFB, 0xFF, 0xAC, 0xF2, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xF2,
-  0xFF, 0xEC, 0xE2, 0xFF, 0x8F, 0xEB, 0xF1, 0xB6, 0xFD, 0x35, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFE, 0x34,
-  0xB0, 0xE3, 0xFF, 0x0E, 0xEB, 0xFF, 0x0D, 0xF3, 0xFF, 0x2D, 0xFB, 0xFF, 0xCC,
-  0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0x0C, 0xFB, 0xFF, 0xCB, 0xF2, 0xFF, 0x0C, 0xF3,
-  0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xAC, 0xF2, 0xFF, 0x0E, 0xFB, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xF2, 0xFF,
-  0x0D, 0xF3, 0xFF, 0x8E, 0xEB, 0xE7, 0x79, 0xFE, 0x1E, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFD, 0xFE, 0x18, 0x31, 0xEC, 0xE2, 0x2E, 0xEB, 0xFF, 0xCD,
-  0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xFB, 0xFF, 0x2C, 0xF3, 0xFF, 0x0C, 0xEB,
-  0xFF, 0xEC, 0xF2, 0xFF, 0x0C, 0xFB, 0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0x0E, 0xFB, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xEA, 0xFF, 0x71,
-  0xEC, 0xC5, 0x5D, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76,
-  0xFD, 0x93, 0x0D, 0xDB, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCB, 0xFA,
-  0xFF, 0xCB, 0xF2, 0xFF, 0x2D, 0xF3, 0xFF, 0x0C, 0xF3, 0xFF, 0xCC, 0xF2, 0xFF,
-  0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xAC, 0xF2, 0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xF2, 0xFF, 0xCC, 0xF2, 0xFF, 0x0D,
-  0xFB, 0xFF, 0xAC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0x2D, 0xDB, 0xFF, 0x55, 0xFD,
-  0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3C, 0xFF, 0x1C, 0x8F, 0xDB, 0xFF, 0x0E, 0xEB, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEB, 0xF2, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xAD, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCB, 0xFA, 0xFF, 0x2D, 0xFB, 0xFF, 0xCB,
-  0xF2, 0xFF, 0x0C, 0xFB, 0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xF2, 0xFF, 0x0D, 0xFB,
-  0xFF, 0xCC, 0xF2, 0xFF, 0x0E, 0xF3, 0xFF, 0x6E, 0xDB, 0xED, 0xDB, 0xFE, 0x1A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xF5,
-  0xA4, 0x2E, 0xE3, 0xFF, 0x0D, 0xF3, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCB, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xF2,
-  0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xAC, 0xF2, 0xFF, 0xED, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0x2E, 0xEB, 0xFF, 0xF4, 0xF4, 0x86, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFB, 0xFE, 0x0F, 0x4E, 0xDB, 0xFF, 0xED, 0xEA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x0D,
-  0xF3, 0xFF, 0x6F, 0xE3, 0xED, 0x5A, 0xFE, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x76, 0xFD, 0x80, 0x2E, 0xEB, 0xFF, 0xED, 0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xF2,
-  0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0x0D, 0xE3,
-  0xFF, 0x15, 0xFD, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xD0, 0xE3, 0xE7, 0x0D,
-  0xEB, 0xFF, 0xED, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0x0D, 0xFB, 0xFF, 0x0E, 0xEB, 0xFF, 0x11, 0xE4, 0xD7,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x79, 0xFE, 0x38, 0x0D, 0xD3, 0xFF, 0x2E, 0xF3, 0xFF, 0x0D, 0xFB,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xEA, 0xFF, 0x4F, 0xD3, 0xFE, 0x1C, 0xFF, 0x22, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xF5, 0x7D, 0x2E, 0xE3,
-  0xFF, 0x0D, 0xFB, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xAD, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xF2, 0xFF, 0x2E,
-  0xDB, 0xFF, 0xB7, 0xF5, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0x04, 0x52, 0xDC, 0xCB, 0x2E, 0xEB, 0xFF, 0xCC, 0xF2, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xAC,
-  0xFA, 0xFF, 0xAD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xF2, 0xFF, 0x4E, 0xEB, 0xFF, 0x93, 0xE4,
-  0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x0A,
-  0xAF, 0xD3, 0xED, 0x2E, 0xF3, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xAC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCB, 0xF2,
-  0xFF, 0xCD, 0xFA, 0xFF, 0x2E, 0xEB, 0xFF, 0xD0, 0xDB, 0xEF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xFE, 0x15, 0x6E, 0xD3, 0xF9, 0xED,
-  0xF2, 0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCB, 0xF2, 0xFF, 0x0C, 0xF3,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xFB, 0xFF, 0xCB, 0xF2, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xF2, 0xFF, 0x8F, 0xDB, 0xFF, 0xBD, 0xFE, 0x0C, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x38, 0xFE, 0x30, 0x6E, 0xDB, 0xFC, 0xED, 0xF2, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEB, 0xF2, 0xFF, 0x0C, 0xFB, 0xFF, 0xCC, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E,
-  0xDB, 0xFF, 0x39, 0xFE, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFD,
-  0x3E, 0x4E, 0xDB, 0xFE, 0xED, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0x0C, 0xFB, 0xFF,
-  0xEC, 0xF2, 0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xF2,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0x0C, 0xFB, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0x2E, 0xE3, 0xFF, 0x19, 0xFE, 0x22, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xD8, 0xFD, 0x49, 0x4E, 0xDB, 0xFF,
-  0x0D, 0xF3, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xF3, 0xFF, 0x0C,
-  0xF3, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xFB, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xF2,
-  0xFF, 0x2E, 0xE3, 0xFF, 0xD8, 0xFD, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xB7, 0xFD, 0x4F, 0x2E, 0xDB, 0xFF, 0x0D, 0xF3, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0x2D, 0xE3, 0xFF,
-  0xB8, 0xFD, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFD, 0x50, 0x2E,
-  0xDB, 0xFF, 0x0D, 0xF3, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x2E, 0xE3, 0xFF, 0x97, 0xFD, 0x31, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFD, 0x44, 0x4E, 0xE3, 0xFF, 0x0E, 0xF3,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D,
-  0xF3, 0xFF, 0x4E, 0xE3, 0xFF, 0x76, 0xFD, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x19, 0xFE, 0x46, 0x4E, 0xE3, 0xFF, 0xED, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0x0D, 0xEB, 0xFF, 0x4E, 0xE3,
-  0xFF, 0x56, 0xFD, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFE, 0x47,
-  0x2E, 0xDB, 0xFF, 0xED, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x0D, 0xFB,
-  0xFF, 0x0D, 0xEB, 0xFF, 0x4E, 0xE3, 0xFF, 0x56, 0xFD, 0x41,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFE, 0x47, 0x4E, 0xE3, 0xFF, 0x0D,
-  0xF3, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xF3, 0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0x0C, 0xF3, 0xFF, 0x0C, 0xF3, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0x0C,
-  0xF3, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF,
-  0x2E, 0xDB, 0xFF, 0x76, 0xFD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-  0xFD, 0x47, 0x4D, 0xDB, 0xFF, 0x0D, 0xF3, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF,
-  0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0x0C, 0xFB, 0xFF, 0x0C, 0xFB,
-  0xFF, 0x0D, 0xFB, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xAC, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0x0D, 0xFB, 0xFF, 0x2D, 0xF3, 0xFF, 0x0C, 0xFB, 0xFF, 0x0C, 0xFB, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0x0C, 0xF3, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xAC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xFB, 0xFF,
-  0xEC, 0xF2, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0x76,
-  0xFD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFE, 0x47, 0x4E, 0xE3,
-  0xFF, 0x0D, 0xFB, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC,
-  0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0x0D, 0xF3, 0xFF, 0xCB, 0xEA, 0xFF, 0xCB, 0xEA, 0xFF, 0x0D, 0xF3, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2,
-  0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xF2, 0xFF, 0x0D, 0xFB, 0xFF, 0x0C, 0xF3, 0xFF, 0xCB, 0xEA, 0xFF, 0xAB,
-  0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x2E, 0xDB, 0xFF, 0x76, 0xFD, 0x40, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x19, 0xFE, 0x47, 0x4D, 0xE3, 0xFF, 0x0D, 0xF3, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xFB, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0xCC, 0xF2, 0xFF, 0x0D, 0xF3, 0xFF,
-  0x2D, 0xF3, 0xFF, 0x2E, 0xF3, 0xFF, 0x0D, 0xF3, 0xFF, 0xCC, 0xF2, 0xFF, 0xED,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0x0C, 0xF3, 0xFF, 0x0C, 0xF3, 0xFF,
-  0x0D, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC,
-  0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0x2D, 0xFB, 0xFF, 0x2D, 0xFB, 0xFF, 0xCC, 0xF2,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3,
-  0xFF, 0x2E, 0xDB, 0xFF, 0x96, 0xFD, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xF8, 0xFD, 0x47, 0x2D, 0xDB, 0xFF, 0xED, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0xED, 0xF2, 0xFF, 0x0D, 0xEB, 0xFF, 0xEE,
-  0xF2, 0xFF, 0xED, 0xF2, 0xFF, 0xCE, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xAC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xEA,
-  0xFF, 0x0D, 0xEB, 0xFF, 0x0D, 0xEB, 0xFF, 0xED, 0xF2, 0xFF, 0xED, 0xFA, 0xFF,
-  0xAD, 0xFA, 0xFF, 0xAD, 0xFA, 0xFF, 0xAD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF,
-  0x97, 0xFD, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFE, 0x47, 0x4D,
-  0xE3, 0xFF, 0x0D, 0xF3, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCD, 0xF2, 0xFF, 0x0D, 0xEB, 0xFF, 0x4E, 0xE3, 0xFF, 0xF0,
-  0xEB, 0xDF, 0xB3, 0xFC, 0xBA, 0xB4, 0xFC, 0xBB, 0xD0, 0xEB, 0xE4, 0x2F, 0xEB,
-  0xFF, 0xCD, 0xEA, 0xFF, 0xCD, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xF3,
-  0xFF, 0x0C, 0xF3, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xF2,
-  0xFF, 0xCD, 0xEA, 0xFF, 0x2E, 0xEB, 0xFB, 0xD0, 0xEB, 0xDF, 0xD3, 0xFC, 0xB7,
-  0xD3, 0xFC, 0xB6, 0xF0, 0xEB, 0xE1, 0x4E, 0xEB, 0xFF, 0xED, 0xF2, 0xFF, 0xAD,
-  0xFA, 0xFF, 0xAD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xF2,
-  0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x2E, 0xDB, 0xFF, 0x76, 0xFD, 0x42, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFE, 0x45, 0x4D, 0xE3, 0xFF, 0x0D, 0xFB,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0x4E,
-  0xEB, 0xFF, 0x10, 0xE4, 0xDA, 0x39, 0xFE, 0x36, 0xFF, 0xFF, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x59, 0xFE, 0x41, 0x10, 0xDC, 0xE1,
-  0x4E, 0xEB, 0xFF, 0xED, 0xF2, 0xFF, 0xCC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xF3,
-  0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xAD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x2E, 0xEB, 0xFF, 0xF0, 0xE3, 0xDE,
-  0x58, 0xFE, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x79, 0xFE, 0x33, 0x11, 0xDC, 0xDC, 0x4E, 0xEB, 0xFF, 0xED, 0xF2,
-  0xFF, 0xED, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x2E,
-  0xDB, 0xFF, 0x76, 0xFD, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xFD,
-  0x51, 0x2D, 0xDB, 0xFF, 0xED, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0x0D, 0xFB, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0x2E, 0xF3, 0xFF, 0xD0, 0xE3, 0xD7, 0x1C, 0xFF,
-  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x1C, 0xEF, 0xDB, 0xD0, 0x6E,
-  0xE3, 0xFF, 0xED, 0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xF3, 0xFF, 0x0C, 0xF3, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xF2, 0xFF,
-  0x2E, 0xEB, 0xFF, 0xD0, 0xE3, 0xD1, 0x1C, 0xFF, 0x19, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFB, 0xFE, 0x10, 0xD0, 0xE3, 0xD9, 0x4E, 0xEB, 0xFF, 0xED, 0xEA, 0xFF,
-  0xED, 0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xE3, 0xFF, 0xD7, 0xFD,
-  0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFD, 0x4E, 0x4E, 0xE3, 0xFF,
-  0xEC, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC,
-  0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x0D, 0xFB,
-  0xFF, 0x4E, 0xE3, 0xFF, 0x3A, 0xFE, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0x18, 0x30, 0xD4, 0xCE, 0x0D, 0xE3,
-  0xFF, 0x0E, 0xFB, 0xFF, 0xCD, 0xFA, 0xFF, 0xAD, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF,
-  0xCC, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEB, 0xFA, 0xFF, 0x2C, 0xFB, 0xFF, 0xCC, 0xF2, 0xFF, 0xCC, 0xF2, 0xFF,
-  0x0E, 0xFB, 0xFF, 0xED, 0xE2, 0xFF, 0xF1, 0xE3, 0xD0, 0xFD, 0xFE, 0x16, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x79, 0xFE, 0x35, 0x6E, 0xDB, 0xFF, 0x4E, 0xF3, 0xFF, 0xED, 0xF2, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0xD7, 0xFD, 0x34, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xB7, 0xFD, 0x4D, 0x4E, 0xE3, 0xFF, 0xEC, 0xF2, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xCC, 0xF2, 0xFF, 0xED, 0xFA,
-  0xFF, 0x0D, 0xFB, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xEA, 0xFF, 0x11, 0xF4, 0xDD,
-  0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFB, 0xFE, 0x18, 0x11, 0xE4, 0xCD, 0xEE, 0xEA, 0xFF,
-  0xEE, 0xFA, 0xFF, 0xEE, 0xFA, 0xFF, 0x8C, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x2D, 0xFB, 0xFF,
-  0xCB, 0xF2, 0xFF, 0x0D, 0xFB, 0xFF, 0x0D, 0xF3, 0xFF, 0x0D, 0xE3, 0xFF, 0x11,
-  0xE4, 0xD1, 0xFB, 0xFE, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xE4, 0xE1, 0xED,
-  0xE2, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xF2,
-  0xFF, 0x0C, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF,
-  0x4E, 0xDB, 0xFF, 0xB8, 0xFD, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7,
-  0xFD, 0x4C, 0x4E, 0xE3, 0xFF, 0xEC, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0x0D, 0xEB, 0xFF, 0xD3, 0xF4, 0xA9, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x5B, 0xFF, 0x16, 0x31, 0xDC, 0xCA, 0x2E, 0xEB, 0xFF, 0xAD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xAD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC,
-  0xEA, 0xFF, 0x4E, 0xE3, 0xFF, 0x31, 0xDC, 0xCF, 0x3B, 0xFF, 0x15, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xF4, 0xB9, 0x2D, 0xE3, 0xFF, 0xED, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0x0C, 0xF3, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0xD7,
-  0xFD, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xFD, 0x4B, 0x4E, 0xE3,
-  0xFF, 0xEC, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x4D, 0xEB, 0xFF, 0xD3,
-  0xF4, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x5D, 0xFF, 0x16, 0xF1, 0xE3, 0xCB, 0x0E, 0xEB, 0xFF, 0xEE, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0x2E, 0xE3, 0xFF, 0xF0, 0xDB,
-  0xCF, 0x5D, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xD2, 0xF4, 0xBD, 0x2D, 0xEB, 0xFF, 0xED, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0x0C, 0xFB, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0xD7, 0xFD, 0x37, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xD7, 0xFD, 0x4B, 0x4E, 0xE3, 0xFF, 0xEC, 0xF2, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xE3, 0xFF, 0x10, 0xE4, 0xE2, 0xFF, 0xFF,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF,
-  0x16, 0x11, 0xDC, 0xCB, 0x0E, 0xEB, 0xFF, 0xEE, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xED, 0xF2, 0xFF, 0xEE, 0xFA,
-  0xFF, 0x0E, 0xEB, 0xFF, 0x10, 0xDC, 0xCE, 0x3C, 0xFF, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x10, 0xEC, 0xE7,
-  0xED, 0xEA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0x0C,
-  0xFB, 0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB,
-  0xFF, 0xB8, 0xFD, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xB7, 0xFD, 0x4C, 0x4E, 0xE3, 0xFF, 0xEC, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0x18, 0xFE, 0x42, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFE, 0x18,
-  0x11, 0xE4, 0xCF, 0xED, 0xE2, 0xFF, 0xED, 0xEA, 0xFF, 0xED, 0xF2, 0xFF, 0xED,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xED, 0xEA, 0xFF, 0xED, 0xE2, 0xFF, 0xF1, 0xE3, 0xCE,
-  0x3C, 0xFF, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x18, 0xFE, 0x45, 0x4D, 0xE3, 0xFF, 0x0D, 0xF3, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0x0C, 0xFB, 0xFF, 0xEC, 0xF2,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0xD7, 0xFD, 0x3A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFD, 0x4D, 0x4E, 0xE3, 0xFF, 0xEC,
-  0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF,
-  0x0D, 0xEB, 0xFF, 0xD1, 0xE3, 0xE2, 0xDC, 0xFE, 0x1C, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFE, 0x18, 0x30,
-  0xD4, 0xCE, 0x4E, 0xE3, 0xFF, 0xED, 0xF2, 0xFF, 0xAC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0x4D, 0xEB, 0xFF,
-  0x31, 0xDC, 0xCD, 0x1C, 0xFF, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0xFE, 0x1C, 0xF0,
-  0xE3, 0xE0, 0x0D, 0xEB, 0xFF, 0x0E, 0xFB, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0xD7, 0xFD, 0x3B, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xB7, 0xFD, 0x4E, 0x4E, 0xE3, 0xFF, 0xEC, 0xF2, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEB, 0xF2, 0xFF,
-  0x0C, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xAB, 0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0x0D,
-  0xE3, 0xFF, 0x11, 0xDC, 0xD6, 0x1C, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x15, 0x10, 0xDC,
-  0xCB, 0x2E, 0xEB, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xCC, 0xF2, 0xFF, 0x2E, 0xEB, 0xFF, 0xF0, 0xE3, 0xCC, 0x1C, 0xFF, 0x12, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
-  0xFE, 0x17, 0x31, 0xDC, 0xD2, 0x2E, 0xE3, 0xFF, 0x0E, 0xFB, 0xFF, 0xAC, 0xF2,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E,
-  0xDB, 0xFF, 0xB7, 0xFD, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xFD,
-  0x4F, 0x2D, 0xDB, 0xFF, 0x0D, 0xFB, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xE3,
-  0xFF, 0x30, 0xE4, 0xD5, 0xFB, 0xFE, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x12, 0x10, 0xDC, 0xC9,
-  0x0D, 0xEB, 0xFF, 0xCD, 0xF2, 0xFF, 0xCD, 0xFA, 0xFF, 0x0E, 0xEB, 0xFF, 0xF1,
-  0xDB, 0xCA, 0xFB, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFE, 0x16, 0x30, 0xEC, 0xD0, 0x2D, 0xE3,
-  0xFF, 0x0D, 0xF3, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0xD8, 0xFD,
-  0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFD, 0x51, 0x2D, 0xDB, 0xFF,
-  0x0D, 0xFB, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0x2D, 0xE3, 0xFF,
-  0x10, 0xDC, 0xD4, 0x5B, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x12, 0x11, 0xE4, 0xC9, 0x4E,
-  0xE3, 0xFF, 0x2E, 0xE3, 0xFF, 0x11, 0xEC, 0xCC, 0x1C, 0xFF, 0x11, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFE,
-  0x17, 0x10, 0xDC, 0xD0, 0x2D, 0xEB, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0xB7, 0xFD, 0x3F, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x18, 0xFE, 0x45, 0x4D, 0xDB, 0xFF, 0x0D, 0xF3, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xF3,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0x0D, 0xFB, 0xFF, 0xEC, 0xEA, 0xFF, 0x4E, 0xEB, 0xFF, 0xF0, 0xE3, 0xD4, 0xFD,
-  0xFE, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x12, 0x30, 0xCC, 0xC7, 0x51, 0xCC,
-  0xCA, 0x3C, 0xFF, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0x17, 0xF0, 0xE3, 0xD2, 0x4E, 0xEB, 0xFF,
-  0xCD, 0xEA, 0xFF, 0x0D, 0xFB, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF,
-  0x2D, 0xDB, 0xFF, 0x96, 0xFD, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
-  0xFE, 0x47, 0x4D, 0xE3, 0xFF, 0x0D, 0xF3, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0x0E, 0xFB, 0xFF, 0xED, 0xE2, 0xFF, 0xD0, 0xDB, 0xD4, 0x5D, 0xFF,
-  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFB, 0xFE, 0x08, 0x1C, 0xFF, 0x09, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0x17,
-  0xF0, 0xD3, 0xD2, 0x0D, 0xE3, 0xFF, 0x0E, 0xFB, 0xFF, 0xCD, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x2D, 0xDB, 0xFF, 0x76, 0xFD, 0x53, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFD, 0x47, 0x2D, 0xDB, 0xFF, 0xED, 0xF2,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0x0E, 0xFB, 0xFF, 0x0E, 0xEB, 0xFF, 0xF0, 0xE3, 0xD4, 0xFB, 0xFE, 0x18,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x5B, 0xFF, 0x17, 0xF0, 0xE3, 0xD3, 0x0D, 0xEB, 0xFF, 0x0D,
-  0xFB, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D,
-  0xF3, 0xFF, 0x2E, 0xDB, 0xFF, 0x77, 0xFD, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x19, 0xFE, 0x46, 0x2D, 0xDB, 0xFF, 0xED, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0x0D, 0xFB, 0xFF, 0xAC, 0xF2, 0xFF, 0x0E, 0xFB, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xEE, 0xFA, 0xFF, 0x4E, 0xEB, 0xFF, 0x10, 0xDC, 0xD4, 0xFB, 0xFE, 0x18, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFE, 0x17, 0x30, 0xDC, 0xD3, 0x4E,
-  0xEB, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x0E, 0xFB, 0xFF, 0x8C, 0xFA,
-  0xFF, 0xEE, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB,
-  0xFF, 0x77, 0xFD, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xFE, 0x46,
-  0x4D, 0xDB, 0xFF, 0x0D, 0xF3, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xAC, 0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0xAC, 0xF2, 0xFF, 0xCC,
-  0xEA, 0xFF, 0x4E, 0xEB, 0xFF, 0x10, 0xE4, 0xD3, 0xFB, 0xFE, 0x17, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
-  0xFE, 0x17, 0x10, 0xE4, 0xD2, 0x4E, 0xF3, 0xFF, 0xEC, 0xEA, 0xFF, 0xCC, 0xF2,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xAC, 0xF2, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x2E, 0xDB, 0xFF, 0x76, 0xFD, 0x53,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFE, 0x46, 0x2D, 0xDB, 0xFF, 0xED,
-  0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xF2, 0xFF, 0x0D, 0xFB, 0xFF, 0x0D,
-  0xFB, 0xFF, 0xAC, 0xF2, 0xFF, 0x0D, 0xFB, 0xFF, 0x0D, 0xFB, 0xFF, 0xCC, 0xF2,
-  0xFF, 0x2D, 0xEB, 0xFF, 0x30, 0xDC, 0xD1, 0xFB, 0xFE, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFE, 0x17, 0x31, 0xE4, 0xD1, 0x0E, 0xEB,
-  0xFF, 0xAC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0x0D, 0xFB, 0xFF, 0xCB, 0xF2, 0xFF,
-  0x0C, 0xFB, 0xFF, 0xED, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0x96, 0xFD, 0x54, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x18, 0xFE, 0x46, 0x4E, 0xE3, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC,
-  0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0x0D, 0xEB, 0xFF, 0xF0, 0xE3, 0xCF, 0x5B, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF,
-  0x16, 0xF0, 0xE3, 0xD1, 0x0D, 0xEB, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x2D,
-  0xDB, 0xFF, 0x76, 0xFD, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFD,
-  0x46, 0x4D, 0xE3, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0x0D, 0xE3, 0xFF, 0x52,
-  0xE4, 0xCB, 0x5B, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0x16, 0x91, 0xE4, 0xCE, 0x0D, 0xEB, 0xFF,
-  0x0E, 0xFB, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCC, 0xF2, 0xFF, 0x0C, 0xF3, 0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xF2,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0x96, 0xFD, 0x54, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x18, 0xFE, 0x46, 0x4E, 0xE3, 0xFF,
-  0xEC, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xAD, 0xF2, 0xFF, 0x2E, 0xE3, 0xFF, 0x12, 0xDC,
-  0xCD, 0x7D, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0x0E,
-  0x50, 0xD4, 0xD3, 0x4D, 0xDB, 0xFF, 0xCC, 0xF2, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3,
-  0xFF, 0x2E, 0xDB, 0xFF, 0x76, 0xFD, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xF8, 0xFD, 0x44, 0x4E, 0xE3, 0xFF, 0xED, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0x0C, 0xF3, 0xFF, 0x0C, 0xF3, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0x0C, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xAC, 0xFA,
-  0xFF, 0xEE, 0xFA, 0xFF, 0x2F, 0xEB, 0xFF, 0xF2, 0xDB, 0xCE, 0xFD, 0xFE, 0x0F,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x5B, 0xFF, 0x0D, 0x30, 0xD4, 0xD4, 0x4E, 0xE3, 0xFF, 0x0D,
-  0xFB, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x2E, 0xDB, 0xFF,
-  0x96, 0xFD, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xFD, 0x4F, 0x4D,
-  0xDB, 0xFF, 0xED, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2,
-  0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xFB, 0xFF, 0x0C, 0xF3,
-  0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xEA, 0xFF,
-  0x32, 0xE4, 0xCC, 0xDC, 0xFE, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFB, 0xFE, 0x17, 0x31, 0xDC, 0xD2, 0x2D, 0xE3, 0xFF, 0xED, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0xB7, 0xFD, 0x42, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFD, 0x4C, 0x4D, 0xDB, 0xFF, 0x0D, 0xF3,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xCD, 0xF2, 0xFF,
-  0xED, 0xF2, 0xFF, 0x0D, 0xEB, 0xFF, 0xD0, 0xE3, 0xCE, 0x3C, 0xFF, 0x14, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x5D, 0xFF, 0x17, 0xF0, 0xE3, 0xD2, 0x0D, 0xE3, 0xFF, 0xED, 0xF2, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D,
-  0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0xD7, 0xFD, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xD7, 0xFD, 0x4B, 0x4E, 0xE3, 0xFF, 0x0D, 0xF3, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xED,
-  0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0x4E, 0xEB, 0xFF, 0x30,
-  0xDC, 0xCF, 0x3C, 0xFF, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x5D, 0xFF, 0x16, 0x30, 0xE4, 0xD1, 0x4E, 0xEB, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB,
-  0xFF, 0xD7, 0xFD, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFD, 0x4A,
-  0x4D, 0xDB, 0xFF, 0xED, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xF3, 0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0x2E,
-  0xF3, 0xFF, 0xD0, 0xE3, 0xD0, 0x3B, 0xFF, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
-  0xFE, 0x16, 0xCF, 0xE3, 0xD1, 0x4E, 0xEB, 0xFF, 0xEC, 0xF2, 0xFF, 0xCC, 0xFA,
-  0xFF, 0x0C, 0xFB, 0xFF, 0x0C, 0xFB, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xE3, 0xFF, 0xF7, 0xFD, 0x44,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFD, 0x49, 0x4D, 0xE3, 0xFF, 0xEC,
-  0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x0C, 0xF3,
-  0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF,
-  0xAD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xCC, 0xF2, 0xFF, 0xCC,
-  0xFA, 0xFF, 0x0E, 0xFB, 0xFF, 0xED, 0xE2, 0xFF, 0x11, 0xDC, 0xD0, 0x3C, 0xFF,
-  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF,
-  0x16, 0x11, 0xE4, 0xD1, 0xED, 0xEA, 0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xF2, 0xFF,
-  0xEB, 0xF2, 0xFF, 0x0D, 0xFB, 0xFF, 0xCC, 0xFA, 0xFF, 0x0C, 0xF3, 0xFF, 0xEC,
-  0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF,
-  0x4E, 0xDB, 0xFF, 0xD8, 0xFD, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7,
-  0xFD, 0x49, 0x4E, 0xE3, 0xFF, 0xEC, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x0C, 0xF3, 0xFF, 0x0C, 0xF3, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0x0D,
-  0xFB, 0xFF, 0xAC, 0xF2, 0xFF, 0x0D, 0xFB, 0xFF, 0xED, 0xF2, 0xFF, 0x0D, 0xE3,
-  0xFF, 0x11, 0xEC, 0xD0, 0xFD, 0xFE, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x16,
-  0x11, 0xEC, 0xD1, 0x0D, 0xE3, 0xFF, 0x0D, 0xF3, 0xFF, 0x0D, 0xFB, 0xFF, 0xAB,
-  0xF2, 0xFF, 0x0D, 0xFB, 0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xF2, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0xED, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0xD7,
-  0xFD, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xFD, 0x4A, 0x4D, 0xDB,
-  0xFF, 0xEC, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xF2, 0xFF, 0x0D, 0xFB,
-  0xFF, 0xCD, 0xF2, 0xFF, 0x2E, 0xE3, 0xFF, 0x31, 0xDC, 0xCE, 0x3B, 0xFF, 0x15,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x5D, 0xFF, 0x0D, 0x7D, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x15, 0x31, 0xDC, 0xD1, 0x2E,
-  0xF3, 0xFF, 0xAD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0xD8, 0xFD, 0x45, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xB7, 0xFD, 0x4C, 0x4D, 0xE3, 0xFF, 0xEC, 0xF2, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x2E, 0xE3, 0xFF,
-  0xF1, 0xDB, 0xCE, 0x5D, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0x16, 0x71, 0xC4, 0xD3, 0x51,
-  0xCC, 0xD9, 0x1C, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x15, 0xD0, 0xEB, 0xD2, 0xED, 0xF2,
-  0xFF, 0xED, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3,
-  0xFF, 0x4E, 0xDB, 0xFF, 0xD8, 0xFD, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xB7, 0xFD, 0x4D, 0x4E, 0xE3, 0xFF, 0xED, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0x0D, 0xE3, 0xFF, 0x31, 0xDC, 0xCC, 0x3C, 0xFF, 0x14, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B,
-  0xFF, 0x16, 0x10, 0xE4, 0xCE, 0x4E, 0xE3, 0xFF, 0x4E, 0xE3, 0xFF, 0xF1, 0xE3,
-  0xD7, 0x1C, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x14, 0x10, 0xDC, 0xD1, 0x2D, 0xE3, 0xFF,
-  0xED, 0xFA, 0xFF, 0xAD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF,
-  0xB7, 0xFD, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFD, 0x4F, 0x4D,
-  0xE3, 0xFF, 0xEC, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xED, 0xF2, 0xFF, 0xED, 0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xEA, 0xFF, 0xF0, 0xEB, 0xCE, 0x5D,
-  0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0x16, 0x30, 0xD4, 0xCE, 0x0D, 0xE3,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0x0E, 0xEB, 0xFF, 0xF1, 0xE3, 0xD5,
-  0x1D, 0xFF, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3C, 0xFF, 0x14, 0x31, 0xE4, 0xD0, 0x0D, 0xE3, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0x0C, 0xF3,
-  0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0xD7, 0xFD, 0x47, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFD, 0x51, 0x4D, 0xE3, 0xFF, 0xEC, 0xF2,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xF2, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0E,
-  0xF3, 0xFF, 0x10, 0xE4, 0xD0, 0xDB, 0xFE, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0x17, 0x0F, 0xDC,
-  0xCF, 0x4D, 0xE3, 0xFF, 0x2E, 0xFB, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xAD, 0xFA, 0xFF, 0x0E, 0xFB, 0xFF, 0x2E, 0xEB, 0xFF, 0xF0, 0xDB, 0xD6, 0x1C,
-  0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3C, 0xFF, 0x13, 0x31, 0xDC, 0xCF, 0x2E, 0xEB, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E,
-  0xDB, 0xFF, 0xB7, 0xFD, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFD,
-  0x46, 0x6E, 0xE3, 0xFF, 0xED, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0E, 0xFB, 0xFF, 0x6E, 0xE3, 0xE2, 0x1C, 0xFF,
-  0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1B, 0xFF, 0x1A, 0x50, 0xDC, 0xD2, 0x2D, 0xEB, 0xFF, 0xED, 0xFA, 0xFF,
-  0xAC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xAC, 0xF2, 0xFF, 0xEC,
-  0xF2, 0xFF, 0x2D, 0xE3, 0xFF, 0x31, 0xDC, 0xD7, 0x1C, 0xFF, 0x1A, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFB, 0xFE, 0x17, 0x8E, 0xDB, 0xE4, 0x2E, 0xEB, 0xFF, 0x0D, 0xF3, 0xFF,
-  0xED, 0xF2, 0xFF, 0xCC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x2D, 0xDB, 0xFF, 0x96, 0xFD,
-  0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFD, 0x48, 0x4D, 0xDB, 0xFF,
-  0x0D, 0xF3, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC,
-  0xF2, 0xFF, 0x2D, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0x2E, 0xFB,
-  0xFF, 0x2E, 0xE3, 0xFE, 0x19, 0xFE, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x1A, 0x10, 0xE4, 0xD2,
-  0x0C, 0xE3, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xF3,
-  0xFF, 0x0D, 0xE3, 0xFF, 0x11, 0xE4, 0xD8, 0x1C, 0xFF, 0x1B, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x38, 0xFE, 0x47, 0x2D, 0xDB, 0xFF, 0x4E, 0xF3, 0xFF, 0xCD, 0xFA, 0xFF, 0xAC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0x76, 0xFD, 0x59, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x18, 0xFE, 0x49, 0x4D, 0xDB, 0xFF, 0x0D, 0xF3, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCB, 0xF2, 0xFF, 0x0C, 0xFB, 0xFF, 0xEC, 0xEA, 0xFF, 0xCF, 0xDB, 0xE7,
-  0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x5B, 0xFF, 0x17, 0x10, 0xDC, 0xCF, 0x2D, 0xEB, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xF2,
-  0xFF, 0xEC, 0xF2, 0xFF, 0xEB, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0x0E, 0xEB, 0xFF, 0xF0, 0xDB, 0xD9, 0x1C, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x10, 0xE4, 0xE8, 0xED,
-  0xEA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xF2,
-  0xFF, 0x0C, 0xFB, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF,
-  0x4E, 0xDB, 0xFF, 0x96, 0xFD, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-  0xFD, 0x48, 0x4D, 0xDB, 0xFF, 0x0D, 0xF3, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xAC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF,
-  0x0C, 0xF3, 0xFF, 0x2D, 0xE3, 0xFF, 0xD3, 0xEC, 0xBE, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x1A, 0xCF, 0xE3, 0xD0, 0x2D,
-  0xF3, 0xFF, 0xCC, 0xEA, 0xFF, 0x0D, 0xFB, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEB, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xF2, 0xFF, 0x2E,
-  0xEB, 0xFF, 0xD1, 0xE3, 0xD9, 0x1D, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xF4, 0xC5, 0x0D, 0xEB, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xAC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0x96,
-  0xFD, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFD, 0x48, 0x4D, 0xDB,
-  0xFF, 0x0D, 0xF3, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0x8C, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xF3, 0xFF, 0x6D, 0xE3, 0xFF, 0xD3,
-  0xEC, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
-  0xFF, 0x1A, 0xCF, 0xDB, 0xCF, 0xEC, 0xEA, 0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xFA,
-  0xFF, 0x0D, 0xFB, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEE, 0xFA, 0xFF, 0xED, 0xE2,
-  0xFF, 0xF0, 0xD3, 0xD8, 0x1D, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x91, 0xF4, 0xC3, 0x0D, 0xEB, 0xFF, 0xCD, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0x96, 0xFD, 0x57, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFD, 0x48, 0x4D, 0xDB, 0xFF, 0x0D, 0xF3, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0x2D, 0xFB, 0xFF, 0x2C, 0xE3, 0xFF, 0xAF, 0xDB, 0xEA, 0xFF, 0xFF,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x5D, 0xFF, 0x16, 0xF0, 0xE3, 0xCC, 0x0D, 0xEB, 0xFF, 0x0D, 0xFB,
-  0xFF, 0xEC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xCC, 0xF2, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCB, 0xF2,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEE, 0xFA, 0xFF, 0xEE, 0xEA, 0xFF,
-  0xD1, 0xEB, 0xD8, 0x1C, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0xCF, 0xE3, 0xE7,
-  0xED, 0xEA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0x0C, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB,
-  0xFF, 0x77, 0xFD, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x18, 0xFE, 0x47, 0x4D, 0xDB, 0xFF, 0x0D, 0xF3, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0x0D, 0xEB, 0xFF, 0x0D, 0xDB, 0xFF, 0xD8, 0xFD, 0x4E, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0x19, 0x30, 0xD4,
-  0xCD, 0x2E, 0xEB, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF,
-  0xAB, 0xEA, 0xFF, 0x0D, 0xFB, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0x0C, 0xFB, 0xFF, 0xAB, 0xF2, 0xFF,
-  0x2D, 0xFB, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0x2E, 0xF3, 0xFF, 0x11,
-  0xDC, 0xD6, 0x1C, 0xFF, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xF7, 0xFD, 0x48, 0x0D, 0xDB, 0xFD, 0x0D, 0xF3, 0xFF, 0xED,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x0C, 0xFB, 0xFF, 0xEC, 0xF2,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0x77, 0xFD, 0x56,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFE, 0x47, 0x4D, 0xDB, 0xFF, 0x0D,
-  0xF3, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0x0E, 0xFB, 0xFF,
-  0xED, 0xF2, 0xFF, 0xB0, 0xEB, 0xE3, 0xDC, 0xFE, 0x22, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xDB, 0xFE, 0x1C, 0x10, 0xEC, 0xCD, 0x4D, 0xEB, 0xFF, 0xED, 0xF2, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C,
-  0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0x0C, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xAB, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xAC,
-  0xFA, 0xFF, 0xCC, 0xEA, 0xFF, 0x4E, 0xE3, 0xFF, 0x11, 0xDC, 0xD4, 0x1C, 0xFF,
-  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x1A, 0xD0,
-  0xE3, 0xDD, 0xED, 0xE2, 0xFF, 0x2E, 0xFB, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0x96, 0xFD, 0x54, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x18, 0xFE, 0x47, 0x4D, 0xDB, 0xFF, 0x0D, 0xF3, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0x0C, 0xFB, 0xFF, 0xEC, 0xF2, 0xFF,
-  0xCD, 0xF2, 0xFF, 0xCD, 0xFA, 0xFF, 0xAD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0x0E,
-  0xEB, 0xFF, 0xD0, 0xE3, 0xE2, 0xF8, 0xFD, 0x4E, 0xFF, 0xFF, 0x02, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x02, 0xF8, 0xFD, 0x48, 0xCF, 0xDB, 0xDC,
-  0x0C, 0xEB, 0xFF, 0xAC, 0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xAC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xAB, 0xF2, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x0C,
-  0xFB, 0xFF, 0x0C, 0xFB, 0xFF, 0xAB, 0xF2, 0xFF, 0x0D, 0xFB, 0xFF, 0x0D, 0xFB,
-  0xFF, 0xCD, 0xEA, 0xFF, 0x2E, 0xE3, 0xFF, 0x11, 0xDC, 0xDE, 0x19, 0xFE, 0x44,
-  0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x18,
-  0xFE, 0x47, 0xF0, 0xDB, 0xDC, 0x2E, 0xE3, 0xFF, 0x0D, 0xF3, 0xFF, 0xCC, 0xF2,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E,
-  0xDB, 0xFF, 0x76, 0xFD, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFD,
-  0x45, 0x6E, 0xE3, 0xFF, 0xED, 0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0x0D, 0xEB,
-  0xFF, 0x2D, 0xE3, 0xFF, 0xAF, 0xEB, 0xE8, 0x51, 0xFC, 0xCA, 0x51, 0xFC, 0xC1,
-  0xAF, 0xEB, 0xE7, 0x4D, 0xE3, 0xFD, 0x2D, 0xEB, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xF2, 0xFF,
-  0x0D, 0xF3, 0xFF, 0x2D, 0xEB, 0xFF, 0x4E, 0xE3, 0xFB, 0xAF, 0xEB, 0xE4, 0x51,
-  0xFC, 0xB9, 0x51, 0xFC, 0xC1, 0xAF, 0xEB, 0xE6, 0x4D, 0xE3, 0xFD, 0x2D, 0xEB,
-  0xFF, 0x0D, 0xF3, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x2D, 0xDB, 0xFF, 0x96, 0xFD,
-  0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFD, 0x50, 0x4D, 0xDB, 0xFF,
-  0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xF2, 0xFF,
-  0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xCC,
-  0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xF2, 0xFF, 0xCC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0x0D, 0xF3, 0xFF, 0x4E, 0xDB, 0xFF, 0xD7, 0xFD, 0x41, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xB7, 0xFD, 0x4D, 0x4D, 0xDB, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xF2, 0xFF, 0xCC,
-  0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xF2, 0xFF, 0xCC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF,
-  0x0D, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF,
-  0x4E, 0xDB, 0xFF, 0xB7, 0xFD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7,
-  0xFD, 0x4A, 0x4E, 0xE3, 0xFF, 0xED, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xF2, 0xFF, 0xEC,
-  0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0x0D, 0xFB, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xFB,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0x4E, 0xDB, 0xFF, 0xB7, 0xFD, 0x40, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFD, 0x49, 0x4D, 0xDB, 0xFF, 0xEC, 0xF2,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D,
-  0xEB, 0xFF, 0x4E, 0xDB, 0xFF, 0xB8, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xB7, 0xFD, 0x48, 0x4D, 0xDB, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xEB, 0xFF, 0x4E, 0xDB,
-  0xFF, 0xB8, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFD, 0x47,
-  0x4E, 0xDB, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xEB, 0xFF, 0x4E, 0xE3, 0xFF, 0xB8, 0xFD, 0x3E,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFD, 0x48, 0x4D, 0xDB, 0xFF, 0xEC,
-  0xF2, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xF2, 0xFF, 0x4E, 0xE3, 0xFF, 0xD8, 0xFD, 0x3D, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xB7, 0xFD, 0x49, 0x4D, 0xDB, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x4E,
-  0xE3, 0xFF, 0xD7, 0xFD, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFD,
-  0x4A, 0x4E, 0xDB, 0xFF, 0x0D, 0xF3, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0x0D, 0xF3, 0xFF, 0x2E, 0xDB, 0xFF, 0xB7, 0xFD, 0x3A, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xD7, 0xFD, 0x4C, 0x4D, 0xDB, 0xFF,
-  0x0D, 0xF3, 0xFF, 0x0C, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0D, 0xEB,
-  0xFF, 0x4E, 0xDB, 0xFF, 0xB7, 0xFD, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xF8, 0xFD, 0x4A, 0x4D, 0xDB, 0xFF, 0x0D, 0xF3, 0xFF, 0x0C, 0xFB, 0xFF, 0xEC,
-  0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xEB, 0xFF, 0x6E, 0xDB, 0xFF,
-  0xD7, 0xFD, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xFE, 0x34, 0x4D,
-  0xDB, 0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x0D, 0xFB,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0x0D, 0xEB, 0xFF, 0x4E, 0xDB, 0xFF, 0xD7, 0xFD, 0x33, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xFE, 0x2A, 0x6E, 0xDB, 0xFF, 0x0C, 0xEB,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D,
-  0xEB, 0xFF, 0x6E, 0xDB, 0xFF, 0x18, 0xFE, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xBC, 0xFE, 0x13, 0x6E, 0xE3, 0xFD, 0x0C, 0xEB, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xEB, 0xFF, 0x8F, 0xDB,
-  0xFF, 0x3A, 0xFE, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01,
-  0xAF, 0xDB, 0xEC, 0x0D, 0xEB, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0x0E, 0xEB, 0xFF, 0xD0, 0xDB, 0xF3, 0x9A, 0xFE, 0x0B,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xEC, 0xBA, 0x2D,
-  0xF3, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0x0C, 0xF3, 0xFF,
-  0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCB, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x2E, 0xEB, 0xFF,
-  0x72, 0xE4, 0xC0, 0xFB, 0xFE, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x96, 0xF5, 0x71, 0x2D, 0xE3, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x0C, 0xFB, 0xFF,
-  0x0C, 0xFB, 0xFF, 0xED, 0xF2, 0xFF, 0x2E, 0xE3, 0xFF, 0x76, 0xF5, 0x70, 0xFF,
-  0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xFE,
-  0x2D, 0x4E, 0xE3, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0x0C, 0xF3, 0xFF, 0xED, 0xF2, 0xFF, 0xCD, 0xFA, 0xFF, 0xAD, 0xFA, 0xFF, 0xAD,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0x0D, 0xDB, 0xFF, 0x7A, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xF0, 0xEB, 0xDB,
-  0x0D, 0xF3, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x0C, 0xF3, 0xFF, 0x0C,
-  0xF3, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x2E, 0xFB, 0xFF, 0xD0, 0xE3,
-  0xDB, 0x5D, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFD, 0x75, 0x0E, 0xE3, 0xFF, 0x0D,
-  0xF3, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0xAD, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0x2E, 0xE3, 0xFF, 0x15, 0xF5, 0x72, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xDC, 0xFE, 0x14, 0x8F, 0xD3, 0xF3, 0xED, 0xEA, 0xFF, 0x0D, 0xFB,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xAD, 0xFA, 0xFF,
-  0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xF2,
-  0xFF, 0xED, 0xFA, 0xFF, 0xAD, 0xFA, 0xFF, 0xCD, 0xF2, 0xFF,
-  0x8F, 0xDB, 0xF2, 0x9A, 0xFE, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x05, 0xF4, 0xE4, 0x90, 0xED, 0xE2, 0xFF, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0x0C, 0xF3, 0xFF, 0xEB, 0xFA, 0xFF, 0xEB, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xF3, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xEE, 0xFA, 0xFF, 0x0E, 0xE3, 0xFF, 0x75, 0xF5, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xFE, 0x1C,
-  0x70, 0xEB, 0xEF, 0xEE, 0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0x0C, 0xF3, 0xFF, 0xEB,
-  0xFA, 0xFF, 0xEB, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0x0E, 0xF3, 0xFF, 0x6F,
-  0xDB, 0xEA, 0x3C, 0xFF, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0xFD, 0x5F, 0xEE, 0xE2, 0xFF, 0x0D,
-  0xF3, 0xFF, 0x0D, 0xFB, 0xFF, 0x0C, 0xFB, 0xFF, 0xAB, 0xF2, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xF2, 0xFF, 0xED, 0xF2, 0xFF,
-  0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xAB, 0xFA, 0xFF,
-  0x0C, 0xFB, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xAC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x0D, 0xD3, 0xFF, 0x39, 0xFE, 0x5B, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0x02, 0xB4, 0xF4, 0xC2, 0x2D, 0xE3, 0xFF, 0xEC, 0xEA,
-  0xFF, 0xCB, 0xF2, 0xFF, 0x0D, 0xFB, 0xFF, 0xCC, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0x8B, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCB, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xED, 0xEA,
-  0xFF, 0xD4, 0xF4, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xDB, 0xFE, 0x1C, 0xD0, 0xE3, 0xE3, 0x4E, 0xF3, 0xFF, 0xEC, 0xF2, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C,
-  0xFB, 0xFF, 0xCC, 0xFA, 0xFF, 0x0C, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0x0D, 0xFB,
-  0xFF, 0xAB, 0xEA, 0xFF, 0x4E, 0xF3, 0xFF, 0x8F, 0xDB, 0xDF, 0xBC, 0xFE, 0x19,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x79, 0xFE, 0x33, 0x4E, 0xD3, 0xF5, 0x2E, 0xEB, 0xFF, 0x0D, 0xFB, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xAD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xEB, 0xF2, 0xFF, 0x0D, 0xFB,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xEA, 0xFF, 0x4E, 0xEB, 0xFF,
-  0x4E, 0xDB, 0xED, 0x59, 0xFE, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59,
-  0xFE, 0x43, 0x4E, 0xD3, 0xF7, 0x4E, 0xF3, 0xFF, 0xED, 0xF2, 0xFF, 0xCD, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xF2,
-  0xFF, 0xCB, 0xF2, 0xFF, 0x2D, 0xFB, 0xFF, 0xEC, 0xF2, 0xFF, 0xED, 0xEA, 0xFF,
-  0x4E, 0xEB, 0xFF, 0x4E, 0xD3, 0xF1, 0xF8, 0xFD, 0x4B, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xFE,
-  0x3F, 0x4E, 0xD3, 0xF3, 0x2E, 0xE3, 0xFF, 0xCC, 0xEA, 0xFF, 0xED, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCD,
-  0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x2D, 0xFB, 0xFF,
-  0xEC, 0xF2, 0xFF, 0xED, 0xF2, 0xFF, 0x2E, 0xE3, 0xFF, 0x8F, 0xDB, 0xEF, 0xB7,
-  0xFD, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xFE, 0x31,
-  0xCF, 0xE3, 0xE3, 0x4E, 0xF3, 0xFF, 0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xF3, 0xFF, 0x0C, 0xF3, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xAC, 0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0x2E,
-  0xF3, 0xFF, 0xB0, 0xE3, 0xE0, 0x18, 0xFE, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0xFE, 0x1B, 0x52, 0xEC, 0xBC, 0x4E,
-  0xDB, 0xFD, 0x2D, 0xE3, 0xFF, 0xED, 0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xF2, 0xFF, 0xED, 0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0xED,
-  0xFA, 0xFF, 0x0E, 0xFB, 0xFF, 0xED, 0xE2, 0xFE, 0x52, 0xF4, 0xBF, 0x5A, 0xFE,
-  0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xF6, 0x49, 0xF1, 0xD3,
-  0xE7, 0x2E, 0xEB, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF,
-  0xED, 0xFA, 0xFF, 0xAC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x0D, 0xFB, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xED, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0D, 0xFB,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xF2, 0xFF,
-  0xEC, 0xF2, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xAC,
-  0xFA, 0xFF, 0xEE, 0xFA, 0xFF, 0xEE, 0xF2, 0xFF, 0x4E, 0xE3, 0xFF, 0xB0, 0xDB,
-  0xE4, 0x76, 0xFD, 0x69, 0xDB, 0xFE, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xFE, 0x18, 0xB3, 0xF4, 0x8A,
-  0x8F, 0xEB, 0xEC, 0xCC, 0xDA, 0xFF, 0x0D, 0xE3, 0xFF, 0x2E, 0xF3, 0xFF, 0x0D,
-  0xF3, 0xFF, 0x0D, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCB, 0xFA, 0xFF, 0xCB, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xED, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC,
-  0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xCC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x2C, 0xFB, 0xFF, 0xCB, 0xF2, 0xFF, 0xEC,
-  0xF2, 0xFF, 0x2E, 0xFB, 0xFF, 0xCD, 0xEA, 0xFF, 0xED, 0xE2, 0xFF, 0x90, 0xE3,
-  0xE8, 0xF5, 0xF4, 0x7F, 0x3C, 0xFF, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x5A, 0xFF, 0x0B, 0xF7,
-  0xFD, 0x6B, 0x71, 0xDC, 0xD2, 0x6E, 0xCB, 0xF8, 0x2D, 0xDB, 0xFF, 0x2E, 0xF3,
-  0xFF, 0xCD, 0xF2, 0xFF, 0xED, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF, 0xCD, 0xFA, 0xFF,
-  0xED, 0xFA, 0xFF, 0xEE, 0xFA, 0xFF, 0xEE, 0xFA, 0xFF, 0xED, 0xF2, 0xFF, 0xED,
-  0xF2, 0xFF, 0x0D, 0xFB, 0xFF, 0x0C, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xFB,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x0C, 0xFB, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA,
-  0xFF, 0xEC, 0xFA, 0xFF, 0xCC, 0xFA, 0xFF, 0x0C, 0xFB, 0xFF, 0xCC, 0xFA, 0xFF,
-  0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0xEC,
-  0xF2, 0xFF, 0xCC, 0xF2, 0xFF, 0x2E, 0xF3, 0xFF, 0x4E, 0xEB, 0xFF, 0x6E, 0xDB,
-  0xFB, 0x10, 0xD4, 0xD2, 0xF7, 0xFD, 0x67, 0xDB, 0xFE, 0x0E, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x9A, 0xFE, 0x1C, 0x96, 0xFD, 0x5E, 0x93, 0xF4, 0xA7, 0xB0, 0xEB, 0xDA,
-  0x2E, 0xE3, 0xEB, 0x0E, 0xE3, 0xEE, 0x0E, 0xE3, 0xF1, 0x0E, 0xE3, 0xF5, 0x2E,
-  0xE3, 0xF7, 0x4E, 0xE3, 0xF7, 0x4E, 0xDB, 0xF8, 0x4E, 0xDB, 0xF8, 0x2D, 0xE3,
-  0xF9, 0x2D, 0xE3, 0xF9, 0x2D, 0xE3, 0xF9, 0x4D, 0xE3, 0xF9, 0x2D, 0xE3, 0xFA,
-  0x2D, 0xE3, 0xF9, 0x4D, 0xE3, 0xF7, 0x2D, 0xE3, 0xF7, 0x2D, 0xE3, 0xF8, 0x2D,
-  0xE3, 0xF8, 0x2D, 0xE3, 0xF8, 0x2D, 0xE3, 0xF8, 0x2D, 0xE3, 0xF8, 0x2D, 0xE3,
-  0xF9, 0x2D, 0xE3, 0xF8, 0x2D, 0xE3, 0xF9, 0x2D, 0xE3, 0xFB, 0x2D, 0xE3, 0xFC,
-  0x2D, 0xE3, 0xFC, 0x2D, 0xE3, 0xFC, 0x2D, 0xE3, 0xFC, 0x2D, 0xE3, 0xFC, 0x2D,
-  0xE3, 0xFC, 0x2D, 0xE3, 0xFC, 0x2D, 0xE3, 0xFC, 0x2D, 0xE3, 0xFD, 0x2D, 0xE3,
-  0xFD, 0x4D, 0xE3, 0xFA, 0x4D, 0xE3, 0xFB, 0x4D, 0xE3, 0xFB,
-  0x2D, 0xE3, 0xFC, 0x2D, 0xE3, 0xFC, 0x2D, 0xE3, 0xFC, 0x2D, 0xE3, 0xFD, 0x4D,
-  0xE3, 0xFD, 0x4D, 0xE3, 0xFD, 0x4D, 0xE3, 0xFD, 0x2D, 0xE3, 0xFE, 0x2D, 0xE3,
-  0xFE, 0x2D, 0xE3, 0xFE, 0x2D, 0xE3, 0xFE, 0x2D, 0xE3, 0xFE, 0x2D, 0xE3, 0xFD,
-  0x2D, 0xE3, 0xFD, 0x2D, 0xE3, 0xFD, 0x2D, 0xE3, 0xFD, 0x2D, 0xE3, 0xFD, 0x2D,
-  0xE3, 0xFD, 0x2D, 0xE3, 0xFB, 0x2D, 0xE3, 0xFB, 0x2D, 0xE3, 0xFB, 0x2D, 0xE3,
-  0xFA, 0x2D, 0xE3, 0xFA, 0x2D, 0xE3, 0xFA, 0x2D, 0xE3, 0xFA, 0x2D, 0xE3, 0xFA,
-  0x2D, 0xE3, 0xFA, 0x4D, 0xE3, 0xFA, 0x2D, 0xE3, 0xFC, 0x2D, 0xE3, 0xFC, 0x4D,
-  0xE3, 0xFB, 0x2D, 0xE3, 0xF9, 0x4D, 0xE3, 0xF7, 0x4E, 0xE3, 0xF4, 0x8F, 0xE3,
-  0xE4, 0x52, 0xF4, 0xB6, 0x55, 0xFD, 0x6C, 0x38, 0xFE, 0x30, 0x1C, 0xFF, 0x09,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0xFB,
-  0xFE, 0x10, 0xBA, 0xFE, 0x18, 0x18, 0xFE, 0x33, 0xF7, 0xF5, 0x36, 0xF7, 0xF5,
-  0x37, 0xF7, 0xF5, 0x38, 0xF8, 0xF5, 0x39, 0xF8, 0xF5, 0x39, 0xF8, 0xFD, 0x39,
-  0xB8, 0xF5, 0x39, 0xF8, 0xFD, 0x3A, 0xD8, 0xF5, 0x3B, 0xD7, 0xFD, 0x3C, 0x39,
-  0xFE, 0x2C, 0x19, 0xFE, 0x2E, 0x19, 0xFE, 0x2E, 0x59, 0xFE, 0x2E, 0x19, 0xFE,
-  0x2E, 0x59, 0xFE, 0x2E, 0x19, 0xFE, 0x2E, 0x59, 0xFE, 0x2E, 0x19, 0xFE, 0x2E,
-  0x39, 0xFE, 0x2C, 0xF8, 0xFD, 0x3D, 0xD7, 0xFD, 0x3C, 0xD8, 0xFD, 0x3C, 0xD7,
-  0xFD, 0x3C, 0xD8, 0xFD, 0x3C, 0xD7, 0xFD, 0x3C, 0xD8, 0xFD, 0x3C, 0xF8, 0xFD,
-  0x3D, 0xD8, 0xFD, 0x3E, 0xF8, 0xFD, 0x3E, 0xF8, 0xFD, 0x40, 0x19, 0xFE, 0x2F,
-  0x3A, 0xFE, 0x31, 0x39, 0xFE, 0x32, 0x19, 0xFE, 0x33, 0x39, 0xFE, 0x34, 0x39,
-  0xFE, 0x35, 0x39, 0xFE, 0x35, 0x39, 0xFE, 0x36, 0x39, 0xFE, 0x35, 0x39, 0xFE,
-  0x34, 0x18, 0xFE, 0x45, 0xF8, 0xFD, 0x44, 0xF7, 0xFD, 0x44,
-  0xF8, 0xFD, 0x44, 0xF7, 0xFD, 0x44, 0xF8, 0xFD, 0x44, 0xF8, 0xFD, 0x45, 0xF8,
-  0xFD, 0x45, 0xF8, 0xFD, 0x45, 0xD8, 0xFD, 0x46, 0xD8, 0xFD, 0x47, 0x19, 0xFE,
-  0x37, 0x39, 0xFE, 0x38, 0x39, 0xFE, 0x38, 0x39, 0xFE, 0x38, 0x19, 0xFE, 0x37,
-  0x19, 0xFE, 0x37, 0x39, 0xFE, 0x36, 0x39, 0xFE, 0x36, 0x39, 0xFE, 0x35, 0x59,
-  0xFE, 0x34, 0xD8, 0xFD, 0x42, 0xD8, 0xF5, 0x41, 0xF8, 0xFD, 0x3D, 0x18, 0xFE,
-  0x32, 0x3A, 0xFE, 0x23, 0xDB, 0xFE, 0x0D, 0xBA, 0xFE, 0x06, 0xFF, 0xFF, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x52, 0x4C, 0x45, 0x03, 0x00, 0x00, 0x35, 0x00, 0x4A, 0x00, 0x59, 0x00, 0x68,
+  0x00, 0x74, 0x00, 0x93, 0x00, 0xBC, 0x00, 0xE5, 0x00, 0x08, 0x01, 0x2E, 0x01,
+  0x54, 0x01, 0x80, 0x01, 0xA8, 0x01, 0xB4, 0x01, 0xD3, 0x01, 0xE2, 0x01, 0xF7,
+  0x01, 0x0C, 0x02, 0x06, 0x00, 0x00, 0x00, 0x18, 0xF6, 0x00, 0xAF, 0xEB, 0x45,
+  0x2E, 0xF3, 0xA3, 0x2D, 0xF3, 0xB8, 0x2D, 0xF3, 0xB9, 0x2D, 0xF3, 0xBB, 0x81,
+  0x2D, 0xF3, 0xB8, 0x02, 0x2D, 0xF3, 0xBA, 0x2D, 0xF3, 0xB9, 0x2D, 0xF3, 0xB8,
+  0x81, 0x2D, 0xF3, 0xB9, 0x03, 0x0D, 0xF3, 0xAE, 0x4E, 0xEB, 0x67, 0x93, 0xE4,
+  0x07, 0x00, 0x00, 0x00, 0x02, 0xFD, 0xFE, 0x00, 0x8F, 0xEB, 0x81, 0xEC, 0xFA,
+  0xFE, 0x8C, 0xEC, 0xFA, 0xFF, 0x01, 0x2E, 0xF3, 0xBD, 0x30, 0xEC, 0x09, 0x01,
+  0xB0, 0xEB, 0x31, 0xEC, 0xFA, 0xFC, 0x8E, 0xEC, 0xFA, 0xFF, 0x00, 0x4E, 0xF3,
+  0x78, 0x01, 0x4E, 0xEB, 0x81, 0xCC, 0xFA, 0xFF, 0x8E, 0xEC, 0xFA, 0xFF, 0x00,
+  0x0D, 0xF3, 0xCC, 0x00, 0x2E, 0xF3, 0x95, 0x8F, 0xEC, 0xFA, 0xFF, 0x00, 0x0D,
+  0xF3, 0xE0, 0x00, 0x2E, 0xF3, 0x95, 0x84, 0xEC, 0xFA, 0xFF, 0x00, 0x0D, 0xF3,
+  0xFC, 0x83, 0xEC, 0xFA, 0xFF, 0x01, 0x0D, 0xF3, 0xFC, 0xCC, 0xFA, 0xFF, 0x83,
+  0xEC, 0xFA, 0xFF, 0x00, 0x0D, 0xF3, 0xE2, 0x00, 0x2D, 0xF3, 0x96, 0x83, 0xEC,
+  0xFA, 0xFF, 0x07, 0x0D, 0xFB, 0xF3, 0xF0, 0xEB, 0x1F, 0x4E, 0xEB, 0x7D, 0xED,
+  0xFA, 0xFE, 0xEC, 0xFA, 0xFF, 0x2D, 0xF3, 0xBE, 0x31, 0xEC, 0x17, 0x2E, 0xF3,
+  0xB9, 0x83, 0xEC, 0xFA, 0xFF, 0x00, 0x0D, 0xF3, 0xE1, 0x00, 0x2D, 0xF3, 0x96,
+  0x83, 0xEC, 0xFA, 0xFF, 0x07, 0xEC, 0xFA, 0xFA, 0x8F, 0xEB, 0x39, 0x97, 0xED,
+  0x01, 0x4E, 0xEB, 0x84, 0x0D, 0xF3, 0xC5, 0x11, 0xE4, 0x0D, 0x10, 0xEC, 0x10,
+  0x0D, 0xF3, 0xD5, 0x83, 0xEC, 0xFA, 0xFF, 0x00, 0x2D, 0xF3, 0xE1, 0x00, 0x2D,
+  0xF3, 0x95, 0x84, 0xEC, 0xFA, 0xFF, 0x05, 0x0D, 0xF3, 0xED, 0xAF, 0xEB, 0x30,
+  0x1C, 0xFF, 0x00, 0x71, 0xD4, 0x0A, 0x31, 0xEC, 0x0C, 0x2D, 0xF3, 0xC3, 0x84,
+  0xEC, 0xFA, 0xFF, 0x00, 0x2D, 0xF3, 0xE5, 0x00, 0x2D, 0xF3, 0x95, 0x83, 0xEC,
+  0xFA, 0xFF, 0x06, 0xED, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x2E, 0xF3, 0xBC, 0x3D,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xEB, 0x70, 0xED, 0xFA, 0xFF, 0x84, 0xEC,
+  0xFA, 0xFF, 0x00, 0x2D, 0xF3, 0xE4, 0x00, 0x2D, 0xF3, 0x96, 0x84, 0xEC, 0xFA,
+  0xFF, 0x06, 0x0D, 0xF3, 0xDB, 0xD0, 0xEB, 0x1B, 0xB2, 0xEC, 0x06, 0x11, 0xDC,
+  0x1C, 0xB2, 0xEC, 0x03, 0x2E, 0xF3, 0xA5, 0xCC, 0xFA, 0xFF, 0x83, 0xEC, 0xFA,
+  0xFF, 0x00, 0x2D, 0xF3, 0xE3, 0x00, 0x2D, 0xF3, 0x96, 0x83, 0xEC, 0xFA, 0xFF,
+  0x08, 0x0D, 0xF3, 0xF6, 0xAF, 0xEB, 0x21, 0x72, 0xEC, 0x04, 0x2E, 0xF3, 0xA8,
+  0x0D, 0xF3, 0xDE, 0xD0, 0xEB, 0x1E, 0x92, 0xE4, 0x05, 0x2D, 0xF3, 0xC5, 0xCC,
+  0xFA, 0xFF, 0x82, 0xEC, 0xFA, 0xFF, 0x00, 0x2D, 0xF3, 0xE5, 0x00, 0x4D, 0xF3,
+  0x95, 0x83, 0xEC, 0xFA, 0xFF, 0x02, 0xED, 0xF2, 0xF8, 0x8F, 0xF3, 0x47, 0x2D,
+  0xF3, 0xA2, 0x81, 0xEC, 0xFA, 0xFF, 0x02, 0x0D, 0xF3, 0xD8, 0xAF, 0xEB, 0x3D,
+  0x0D, 0xF3, 0xCB, 0x83, 0xEC, 0xFA, 0xFF, 0x00, 0x2D, 0xF3, 0xE5, 0x00, 0x2D,
+  0xF3, 0x96, 0x8F, 0xEC, 0xFA, 0xFF, 0x00, 0x2D, 0xF3, 0xE2, 0x01, 0x4D, 0xF3,
+  0x94, 0xED, 0xFA, 0xFF, 0x83, 0xEC, 0xFA, 0xFF, 0x00, 0xCC, 0xFA, 0xFF, 0x83,
+  0xEC, 0xFA, 0xFF, 0x00, 0xCC, 0xFA, 0xFF, 0x84, 0xEC, 0xFA, 0xFF, 0x00, 0x0D,
+  0xF3, 0xE0, 0x01, 0x4E, 0xF3, 0x77, 0xCD, 0xFA, 0xFF, 0x8E, 0xEC, 0xFA, 0xFF,
+  0x00, 0x2D, 0xF3, 0xC6, 0x01, 0xD0, 0xE3, 0x20, 0x0D, 0xF3, 0xF5, 0x8C, 0xEC,
+  0xFA, 0xFF, 0x02, 0xCD, 0xFA, 0xFF, 0xEC, 0xFA, 0xFF, 0x4F, 0xF3, 0x63, 0x02,
+  0x00, 0x00, 0x00, 0x6F, 0xEB, 0x57, 0xED, 0xFA, 0xF6, 0x8C, 0xEC, 0xFA, 0xFF,
+  0x01, 0x4E, 0xEB, 0x9A, 0xB3, 0xEC, 0x03, 0x81, 0x00, 0x00, 0x00, 0x0F, 0xD0,
+  0xEB, 0x22, 0x2E, 0xF3, 0x75, 0x2E, 0xF3, 0x8C, 0x2D, 0xF3, 0x8D, 0x2D, 0xF3,
+  0x8B, 0x2D, 0xF3, 0x8D, 0x2D, 0xF3, 0x8E, 0x2D, 0xF3, 0x8C, 0x2D, 0xF3, 0x8E,
+  0x2D, 0xF3, 0x90, 0x2D, 0xF3, 0x8E, 0x2D, 0xF3, 0x8D, 0x2D, 0xF3, 0x85, 0x8F,
+  0xEB, 0x40, 0x56, 0xF5, 0x01, 0x00, 0x00, 0x00,
 };
 const lv_img_dsc_t ui_img_rm_icon_png = {
   .header.always_zero = 0,
-  .header.w = 118,
-  .header.h = 119,
+  .header.w = 18,
+  .header.h = 19,
   .data_size = sizeof(ui_img_rm_icon_png_data),
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = ui_img_rm_icon_png_data
 };
@@ -10,3387 +10,113 @@
 #endif
 
 // IMAGE DATA: assets\setting_icon.png
+// Scaled to zoom 50 from 118x122 by tools/img_rle_convert.py
+// RLE encoded by tools/img_rle_convert.py, 1656 bytes raw
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_setting_icon_png_data[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x35, 0x9D, 0x73, 0x72, 0x84, 0xD0, 0x11, 0x6C, 0xE3, 0x11, 0x6C, 0xE7, 0x11,
-  0x6C, 0xE8, 0x11, 0x6C, 0xE8, 0x11, 0x6C, 0xE8, 0x11, 0x6C, 0xE7, 0x11, 0x6C,
-  0xE7, 0x11, 0x6C, 0xE6, 0x11, 0x6C, 0xE6, 0x11, 0x6C, 0xE6, 0x11, 0x6C, 0xE6,
-  0x11, 0x6C, 0xE7, 0x11, 0x6C, 0xE7, 0x11, 0x6C, 0xE7, 0x11, 0x6C, 0xE7, 0x11,
-  0x6C, 0xE6, 0x10, 0x74, 0xE5, 0xF0, 0x73, 0xE3, 0x11, 0x74, 0xDF, 0x11, 0x74,
-  0xD8, 0xB3, 0x8C, 0xB2, 0x96, 0xAD, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xB6, 0x41, 0xF0, 0x73, 0xF3, 0xD0,
-  0x63, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x64,
-  0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x64, 0xFF,
-  0x31, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x31,
-  0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C,
-  0xFF, 0xF1, 0x6B, 0xFF, 0x11, 0x6C, 0xFF, 0xF0, 0x6B, 0xFF, 0xF0, 0x6B, 0xFF,
-  0x92, 0x84, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xF4, 0x94, 0x93, 0x11, 0x74, 0xFF, 0x72, 0x7C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x52, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0xF0, 0x63, 0xFF, 0x11, 0x6C, 0xFA, 0xD8,
-  0xAD, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x7C, 0xD5, 0xF1, 0x6B,
-  0xFF, 0xF0, 0x63, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x6C, 0xFF, 0x56, 0x95, 0x82, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xF7, 0xBD, 0x04, 0xF0, 0x6B, 0xF4, 0x31, 0x74, 0xFF, 0x32, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C,
-  0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x11, 0x6C, 0xFF, 0x93, 0x7C, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xB6, 0x3E,
-  0xF1, 0x6B, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C,
-  0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x12, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x6C, 0xFF,
-  0x31, 0x74, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x9D, 0x73, 0x11, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x11, 0x64, 0xFF, 0xF1, 0x6B, 0xFF, 0x31, 0x74, 0xFC, 0x19, 0xB6, 0x25, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xF4, 0x8C, 0xAB, 0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF,
-  0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31,
-  0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64,
-  0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x11, 0x74, 0xFF, 0xB7, 0xA5, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x7C,
-  0xE0, 0x11, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C,
-  0xFF, 0xF4, 0x94, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xF7, 0xBD, 0x04, 0xF1, 0x6B, 0xF7, 0x11, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x52, 0x7C, 0xCD,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xB5, 0x3F,
-  0xF0, 0x6B, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x74, 0xED, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x9D, 0x7B, 0x11, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x64, 0xFF,
-  0x32, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x11, 0x74, 0xFF, 0xF8, 0xB5, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x92, 0x8C, 0xB7, 0x11, 0x74, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x52,
-  0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x56, 0x9D,
-  0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x7C,
-  0xE6, 0x11, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x53, 0x6C, 0xFF, 0x11, 0x64,
-  0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xD4, 0x8C, 0xA6, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x59, 0xBE, 0x18, 0x11, 0x74, 0xFF, 0x11, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x11, 0x74, 0xFF, 0x52, 0x7C, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xF4, 0x94, 0x8B, 0xF1, 0x6B, 0xFF, 0x32, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0xF1,
-  0x63, 0xFF, 0x52, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64,
-  0xFF, 0x31, 0x64, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xF0,
-  0x6B, 0xFF, 0xD8, 0xAD, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xF7, 0xAD, 0x3E, 0x10, 0x6C, 0xFF, 0x31, 0x74, 0xFF, 0x11,
-  0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x52, 0x74, 0xFF, 0x11, 0x74,
-  0xE7, 0x3C, 0xC6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xAD, 0x4D, 0x31,
-  0x74, 0xF3, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x31, 0x64, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x74, 0xD7,
-  0x38, 0xBE, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
-  0xB6, 0x22, 0xD4, 0x84, 0xB1, 0x51, 0x74, 0xFF, 0xD0, 0x63, 0xFF, 0x32, 0x6C,
-  0xFF, 0x11, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x11, 0x64, 0xFF,
-  0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x52, 0x7C, 0xF9, 0xD4,
-  0x8C, 0x90, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x95, 0x80, 0x31, 0x74,
-  0xCE, 0x31, 0x74, 0xC1, 0x97, 0xA5, 0x6C, 0xBA, 0xBE, 0x0C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x38, 0xC6, 0x09, 0xD4, 0x8C, 0xA3, 0x10, 0x6C, 0xFA, 0x31, 0x6C,
-  0xFF, 0xF1, 0x63, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x12,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x73, 0x6C, 0xFF, 0xF0,
-  0x63, 0xFF, 0xD0, 0x63, 0xFF, 0x52, 0x74, 0xFF, 0xD0, 0x6B, 0xEC, 0x15, 0x9D,
-  0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xBE, 0x1E, 0x35,
-  0x95, 0x81, 0x31, 0x7C, 0xC9, 0x31, 0x74, 0xC1, 0x35, 0x9D, 0x5A, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x15, 0x95, 0x8B, 0x11, 0x74, 0xFF, 0xD0, 0x63, 0xFF, 0x31, 0x74, 0xFF,
-  0xF0, 0x6B, 0xFF, 0x11, 0x74, 0xF1, 0x92, 0x84, 0xC8, 0x76, 0x9D, 0x67, 0x9A,
-  0xBE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x95, 0x7B, 0x31, 0x74,
-  0xF1, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x53, 0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0x12,
-  0x6C, 0xFF, 0x52, 0x74, 0xFF, 0xF1, 0x63, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0xF1, 0x5B, 0xFF, 0x73, 0x74, 0xFF, 0x11, 0x64,
-  0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x51, 0x74, 0xD9,
-  0xD7, 0xAD, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xBE, 0x1A, 0x56,
-  0x95, 0x7C, 0x51, 0x74, 0xD0, 0xF0, 0x6B, 0xF9, 0xF0, 0x6B, 0xFF, 0x10, 0x6C,
-  0xFF, 0xF0, 0x6B, 0xFF, 0x52, 0x7C, 0xF4, 0xB7, 0xAD, 0x49, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xBE, 0x22, 0x11, 0x6C, 0xF1,
-  0xF1, 0x6B, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xED, 0x72, 0x7C,
-  0xC2, 0x76, 0x9D, 0x61, 0x38, 0xC6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xA5, 0x5B, 0x31, 0x74,
-  0xDF, 0xF0, 0x6B, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x11, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0x32, 0x74, 0xFF, 0x32, 0x74, 0xFF, 0xD0, 0x63,
-  0xFF, 0x32, 0x74, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0x52, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x31, 0x6C, 0xFF, 0xF0, 0x6B, 0xFF, 0x93,
-  0x84, 0xC1, 0xF8, 0xAD, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xBE, 0x1C, 0x35, 0x9D, 0x7D, 0x73,
-  0x7C, 0xD4, 0xF1, 0x6B, 0xFA, 0x11, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x52, 0x74,
-  0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x74, 0xFF,
-  0xD0, 0x6B, 0xFF, 0x31, 0x7C, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x72, 0x84, 0xBC, 0x31, 0x74, 0xFF, 0x11, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C,
-  0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x11, 0x6C, 0xF0, 0x72, 0x7C, 0xC9, 0x76, 0xA5, 0x66, 0xFB, 0xBE, 0x08, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xB6,
-  0x38, 0x72, 0x7C, 0xC6, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x12,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x11, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF,
-  0x52, 0x64, 0xFF, 0x52, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0xF1, 0x6B, 0xFF, 0x11, 0x6C,
-  0xFA, 0xF4, 0x8C, 0x9E, 0x5A, 0xB6, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xC6, 0x19, 0x35, 0x95, 0x7F, 0x52,
-  0x7C, 0xDC, 0x10, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xF4,
-  0x8C, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xA5, 0x57, 0x31,
-  0x74, 0xFF, 0xF1, 0x6B, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFC, 0x31, 0x74, 0xEC, 0x52, 0x7C,
-  0xD1, 0x93, 0x7C, 0xCF, 0x51, 0x74, 0xEE, 0xF0, 0x6B, 0xFF, 0x11, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x12,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0xF1, 0x5B, 0xFF, 0x53, 0x6C, 0xFF, 0x32, 0x64,
-  0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x51, 0x64, 0xFF, 0x31,
-  0x64, 0xFF, 0x31, 0x5C, 0xFF, 0x31, 0x5C, 0xFF, 0x72, 0x64, 0xFF, 0xB2, 0x6C,
-  0xFF, 0xD3, 0x6C, 0xFF, 0x35, 0x7D, 0xFF, 0x55, 0x7D, 0xFF,
-  0x35, 0x7D, 0xFF, 0x14, 0x75, 0xFF, 0xD3, 0x6C, 0xFF, 0xB3, 0x6C, 0xFF, 0x72,
-  0x64, 0xFF, 0x31, 0x5C, 0xFF, 0x51, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64,
-  0xFF, 0x31, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x12,
-  0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0x52, 0x64, 0xFF, 0x11, 0x64,
-  0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0xF1, 0x63, 0xFF, 0x11, 0x6C, 0xFF,
-  0x31, 0x74, 0xFD, 0x52, 0x74, 0xE2, 0x72, 0x7C, 0xC6, 0x92, 0x7C, 0xCF, 0x31,
-  0x74, 0xEE, 0x11, 0x74, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x74, 0xEC, 0x59, 0xB6,
-  0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x74, 0xDC, 0x11, 0x6C, 0xFF, 0xF1, 0x63,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C,
-  0xFF, 0xF1, 0x63, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11,
-  0x64, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x53, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0xF1, 0x5B, 0xFF, 0x32, 0x64, 0xFF, 0x52, 0x6C, 0xFF,
-  0x31, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x10,
-  0x5C, 0xFF, 0x91, 0x5C, 0xFF, 0x34, 0x6D, 0xFF, 0x17, 0x86, 0xFF, 0xDA, 0x9E,
-  0xFF, 0x5C, 0xAF, 0xFF, 0xBD, 0xB7, 0xFF, 0xDE, 0xB7, 0xFF, 0xDE, 0xB7, 0xFF,
-  0xBE, 0xB7, 0xFF, 0xFE, 0xB7, 0xFF, 0xFE, 0xB7, 0xFF, 0xDE, 0xB7, 0xFF, 0xDE,
-  0xB7, 0xFF, 0xBD, 0xB7, 0xFF, 0x9D, 0xAF, 0xFF, 0x5C, 0xAF, 0xFF, 0x99, 0x96,
-  0xFF, 0xF7, 0x85, 0xFF, 0x14, 0x6D, 0xFF, 0x71, 0x5C, 0xFF,
-  0x31, 0x5C, 0xFF, 0x51, 0x64, 0xFF, 0x51, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0xF1, 0x63,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x52, 0x6C, 0xFF,
-  0x52, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0xF1,
-  0x63, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C,
-  0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x11, 0x6C, 0xFF, 0xF1, 0x6B, 0xFF, 0xB3, 0x84, 0xAB, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x95, 0x89, 0xF0, 0x6B,
-  0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x6C, 0xFF, 0x52,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x52, 0x6C,
-  0xFF, 0x52, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF,
-  0x52, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x5C, 0xFF, 0x51, 0x64, 0xFF, 0x51,
-  0x5C, 0xFF, 0x92, 0x64, 0xFF, 0x96, 0x85, 0xFF, 0xDA, 0xA6, 0xFF, 0x9D, 0xB7,
-  0xFF, 0xDD, 0xB7, 0xFF, 0xDE, 0xB7, 0xFF, 0xDD, 0xB7, 0xFF, 0xDD, 0xAF, 0xFF,
-  0xDD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xFE, 0xB7, 0xFF, 0xBD, 0xAF, 0xFF,
-  0x9D, 0xB7, 0xFF, 0x9D, 0xB7, 0xFF, 0xB9, 0x9E, 0xFF, 0x34, 0x75, 0xFF, 0x51,
-  0x5C, 0xFF, 0x51, 0x5C, 0xFF, 0x31, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x11,
-  0x64, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x11, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x11,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0xD0, 0x6B, 0xFF, 0xB7, 0xAD, 0x3F, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xF9, 0xB5, 0x14, 0x11, 0x6C, 0xEC, 0x11, 0x6C, 0xFF, 0x52, 0x6C, 0xFF,
-  0x11, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11,
-  0x64, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x31, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x11, 0x64, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x31,
-  0x64, 0xFF, 0x71, 0x64, 0xFF, 0x14, 0x6D, 0xFF, 0x38, 0x96, 0xFF, 0x5C, 0xAF,
-  0xFF, 0xDE, 0xBF, 0xFF, 0xBD, 0xB7, 0xFF, 0xDD, 0xB7, 0xFF, 0xFD, 0xB7, 0xFF,
-  0xFE, 0xB7, 0xFF, 0xFD, 0xB7, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xFE, 0xB7, 0xFF, 0xFE, 0xB7, 0xFF, 0xBD,
-  0xAF, 0xFF, 0xDD, 0xB7, 0xFF, 0xFE, 0xBF, 0xFF, 0x3B, 0xAF, 0xFF, 0x17, 0x8E,
-  0xFF, 0x92, 0x64, 0xFF, 0x72, 0x64, 0xFF, 0x51, 0x64, 0xFF, 0x31, 0x64, 0xFF,
-  0x11, 0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64,
-  0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x11, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x31, 0x74, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x7C, 0xAE,
-  0x31, 0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x52, 0x6C, 0xFF,
-  0x12, 0x64, 0xFF, 0xF1, 0x63, 0xFF, 0x11, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0xF4, 0x74, 0xFF, 0x59, 0x9E,
-  0xFF, 0x9D, 0xB7, 0xFF, 0xFE, 0xBF, 0xFF, 0xDD, 0xB7, 0xFF, 0xDD, 0xAF, 0xFF,
-  0xFE, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xDD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7,
-  0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xAF,
-  0xFF, 0xDD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xFE, 0xB7, 0xFF, 0x9D, 0xB7, 0xFF,
-  0xF7, 0x85, 0xFF, 0x92, 0x64, 0xFF, 0x51, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x11,
-  0x64, 0xFF, 0xF1, 0x63, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x12, 0x64,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x64, 0xFF,
-  0x12, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x11,
-  0x64, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x64,
-  0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0xF1, 0x63, 0xFF, 0x52, 0x74, 0xFF, 0xF0, 0x6B,
-  0xFF, 0x14, 0x95, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x96, 0xA5, 0x4E, 0xD0, 0x6B, 0xFA, 0x52, 0x74, 0xFF, 0x11,
-  0x64, 0xFF, 0x11, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x11, 0x64,
-  0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF,
-  0x12, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0x39, 0xA6,
-  0xFF, 0x1C, 0xB7, 0xFF, 0xBE, 0xBF, 0xFF, 0xDD, 0xB7, 0xFF,
-  0xBD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD,
-  0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xB7, 0xFF, 0xFF, 0xBF, 0xFF, 0x7C,
-  0xAF, 0xFF, 0xB6, 0x85, 0xFF, 0x71, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x52, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12,
-  0x64, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x52, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x11, 0x64,
-  0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x74, 0xFF, 0xF0, 0x6B, 0xE6,
-  0x79, 0xCE, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-  0x74, 0xD5, 0x31, 0x74, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x64,
-  0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x52, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xF0, 0x6B,
-  0xFF, 0x15, 0x8D, 0xFF, 0xDB, 0xC6, 0xFF, 0xFC, 0xC6, 0xFF, 0x5C, 0xC7, 0xFF,
-  0x9D, 0xBF, 0xFF, 0xBD, 0xBF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD,
-  0xA7, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFC, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD,
-  0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD,
-  0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xBD, 0xA7, 0xFF, 0xDE, 0xB7, 0xFF, 0xFE, 0xBF,
-  0xFF, 0xDA, 0x9E, 0xFF, 0x14, 0x75, 0xFF, 0x31, 0x5C, 0xFF, 0x31, 0x64, 0xFF,
-  0x11, 0x64, 0xFF, 0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x12, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0xF1, 0x6B, 0xFF,
-  0x11, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0xF1, 0x63, 0xFF,
-  0x11, 0x6C, 0xFF, 0x31, 0x74, 0xFF, 0x93, 0x84, 0xA8, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x8C, 0x7C, 0x11, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x11, 0x64, 0xFF,
-  0x11, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x12,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64,
-  0xFF, 0x11, 0x64, 0xFF, 0x31, 0x6C, 0xFF, 0xD8, 0xA5, 0xFF, 0xFC, 0xD6, 0xFF,
-  0xDC, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xDB, 0xC6, 0xFF, 0x3C, 0xC7, 0xFF, 0x9D,
-  0xBF, 0xFF, 0xFD, 0xB7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0x9F,
-  0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD,
-  0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xB7, 0xFF,
-  0x9C, 0xAF, 0xFF, 0xF7, 0x85, 0xFF, 0x30, 0x5C, 0xFF, 0x31, 0x64, 0xFF, 0x11,
-  0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0x52, 0x6C,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x12, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x52,
-  0x74, 0xFF, 0xD0, 0x6B, 0xFA, 0xF8, 0xAD, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xBD, 0x12, 0x32, 0x74,
-  0xE7, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x64, 0xFF,
-  0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0x31,
-  0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64,
-  0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0x51, 0x6C, 0xFF,
-  0x7A, 0xB6, 0xFF, 0xDB, 0xC6, 0xFF, 0x9B, 0xCE, 0xFF, 0xDC, 0xDE, 0xFF, 0x9A,
-  0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0x3C, 0xCF, 0xFF, 0x5C, 0xBF, 0xFF, 0xBD, 0xB7,
-  0xFF, 0xFD, 0xB7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDC, 0xAF, 0xFF, 0xDD, 0xA7, 0xFF, 0xDD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFC, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xB7, 0xFF, 0x5C,
-  0xAF, 0xFF, 0x99, 0x9E, 0xFF, 0x71, 0x64, 0xFF, 0x72, 0x64, 0xFF, 0x31, 0x64,
-  0xFF, 0xF1, 0x63, 0xFF, 0x73, 0x74, 0xFF, 0x11, 0x64, 0xFF, 0xF1, 0x5B, 0xFF,
-  0x53, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x12,
-  0x64, 0xFF, 0x53, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x6C, 0xFF, 0x52, 0x74,
-  0xFF, 0x11, 0x74, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x72, 0x7C, 0xAC, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x31,
-  0x64, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0xF0, 0x6B, 0xFF, 0x72, 0x74, 0xFF, 0xFC, 0xCE, 0xFF, 0xDC, 0xCE, 0xFF, 0xFC,
-  0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDC, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xFB, 0xD6,
-  0xFF, 0xDB, 0xC6, 0xFF, 0x3B, 0xC7, 0xFF, 0x9D, 0xC7, 0xFF, 0xBC, 0xB7, 0xFF,
-  0xBC, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xB7, 0xFF, 0xFE, 0xB7, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFE, 0xB7, 0xFF, 0xFE, 0xBF, 0xFF, 0xDE, 0xBF, 0xFF, 0xDA, 0xA6,
-  0xFF, 0x51, 0x5C, 0xFF, 0x72, 0x6C, 0xFF, 0x11, 0x64, 0xFF,
-  0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C,
-  0xFF, 0x11, 0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xD0, 0x63, 0xFF,
-  0x56, 0x9D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xA5, 0x4F,
-  0x11, 0x6C, 0xF8, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31,
-  0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x11, 0x64,
-  0xFF, 0x32, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0x11, 0x64, 0xFF,
-  0x11, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0xF0, 0x63, 0xFF, 0xD3, 0x84, 0xFF, 0xDC,
-  0xC6, 0xFF, 0xBB, 0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xDC, 0xD6,
-  0xFF, 0xBB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFB, 0xD6, 0xFF, 0xFB, 0xCE, 0xFF,
-  0xFB, 0xC6, 0xFF, 0x5C, 0xC7, 0xFF, 0xBD, 0xBF, 0xFF, 0xFD, 0xB7, 0xFF, 0xDD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xDD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xFD, 0xB7, 0xFF, 0xFE, 0xB7, 0xFF,
-  0xBD, 0xAF, 0xFF, 0xBD, 0xAF, 0xFF, 0xDD, 0xB7, 0xFF, 0xDD, 0xB7, 0xFF, 0xDD,
-  0xB7, 0xFF, 0xDD, 0xB7, 0xFF, 0xDD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xFE, 0xAF,
-  0xFF, 0xDD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xFE, 0xB7, 0xFF, 0xFE, 0xB7, 0xFF,
-  0xDD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD,
-  0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xAF,
-  0xFF, 0xDD, 0xAF, 0xFF, 0xBD, 0xAF, 0xFF, 0xDE, 0xBF, 0xFF, 0x1B, 0xAF, 0xFF,
-  0x31, 0x54, 0xFF, 0x72, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x52,
-  0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0x52, 0x74, 0xFF, 0x11, 0x6C, 0xE3, 0xFA,
-  0xBD, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x6B, 0xD6, 0x52, 0x74, 0xFF, 0x11,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x31, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x6C, 0xFF, 0xB3,
-  0x84, 0xFF, 0xBB, 0xC6, 0xFF, 0xDC, 0xD6, 0xFF, 0xDC, 0xD6, 0xFF, 0xBB, 0xD6,
-  0xFF, 0xDC, 0xD6, 0xFF, 0xDC, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF,
-  0xDB, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0x1C, 0xD7, 0xFF, 0xDB,
-  0xBE, 0xFF, 0x3C, 0xBF, 0xFF, 0xDE, 0xBF, 0xFF, 0xFE, 0xBF, 0xFF, 0xBD, 0xB7,
-  0xFF, 0xDD, 0xB7, 0xFF, 0xDE, 0xB7, 0xFF, 0xBD, 0xB7, 0xFF, 0x5C, 0xAF, 0xFF,
-  0xDA, 0x9E, 0xFF, 0x37, 0x8E, 0xFF, 0xD6, 0x85, 0xFF, 0xF7, 0x85, 0xFF, 0xD6,
-  0x85, 0xFF, 0xD6, 0x85, 0xFF, 0xD6, 0x85, 0xFF, 0xF7, 0x85, 0xFF, 0x79, 0x96,
-  0xFF, 0x1B, 0xA7, 0xFF, 0x7D, 0xB7, 0xFF, 0xDE, 0xB7, 0xFF, 0xDD, 0xB7, 0xFF,
-  0xDD, 0xB7, 0xFF, 0xDD, 0xB7, 0xFF, 0xDD, 0xB7, 0xFF, 0xDD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFE, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xBD, 0xAF, 0xFF, 0xDE, 0xBF, 0xFF, 0x1B, 0xA7, 0xFF, 0x71,
-  0x5C, 0xFF, 0x51, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0xD0, 0x63, 0xFF, 0x32, 0x74,
-  0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xB3, 0x84, 0xA1, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-  0x95, 0x82, 0xF1, 0x63, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x93, 0x7C, 0xFF, 0xBB, 0xC6, 0xFF, 0x7A, 0xC6,
-  0xFF, 0xFC, 0xDE, 0xFF, 0xFC, 0xDE, 0xFF, 0x9B, 0xD6, 0xFF, 0xDC, 0xDE, 0xFF,
-  0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF, 0xDB,
-  0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xDB, 0xC6, 0xFF, 0x3C, 0xC7, 0xFF, 0xBE, 0xC7,
-  0xFF, 0x9D, 0xBF, 0xFF, 0xBD, 0xBF, 0xFF, 0x99, 0x9E, 0xFF,
-  0x34, 0x75, 0xFF, 0x30, 0x54, 0xFF, 0xAE, 0x43, 0xFF, 0x6D, 0x43, 0xFF, 0x8E,
-  0x4B, 0xFF, 0xAE, 0x4B, 0xFF, 0x8E, 0x4B, 0xFF, 0x8E, 0x4B, 0xFF, 0x8E, 0x4B,
-  0xFF, 0x8E, 0x4B, 0xFF, 0x6E, 0x43, 0xFF, 0x6E, 0x43, 0xFF, 0x8E, 0x43, 0xFF,
-  0xAE, 0x43, 0xFF, 0x71, 0x54, 0xFF, 0xB6, 0x7D, 0xFF, 0xFB, 0xA6, 0xFF, 0x9D,
-  0xBF, 0xFF, 0xBE, 0xBF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFE, 0xB7, 0xFF, 0xFD, 0xA7,
-  0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD,
-  0xAF, 0xFF, 0xFE, 0xB7, 0xFF, 0xBD, 0xB7, 0xFF, 0xDA, 0x9E, 0xFF, 0x30, 0x5C,
-  0xFF, 0x11, 0x64, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x52,
-  0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0x32, 0x74,
-  0xFF, 0xF1, 0x6B, 0xF3, 0xD7, 0xAD, 0x33, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xB6, 0x15, 0x10, 0x6C, 0xE6, 0x72, 0x74,
-  0xFF, 0x11, 0x5C, 0xFF, 0x52, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11,
-  0x64, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0xF1, 0x6B, 0xFF, 0x93, 0x7C,
-  0xFF, 0xF8, 0xAD, 0xFF, 0xDC, 0xCE, 0xFF, 0xFC, 0xDE, 0xFF, 0xDC, 0xD6, 0xFF,
-  0xBB, 0xD6, 0xFF, 0xDB, 0xDE, 0xFF, 0xBB, 0xD6, 0xFF, 0xFC, 0xDE, 0xFF, 0xBB,
-  0xCE, 0xFF, 0x9A, 0xCE, 0xFF, 0xFC, 0xDE, 0xFF, 0xFC, 0xDE, 0xFF, 0xBB, 0xCE,
-  0xFF, 0xDC, 0xCE, 0xFF, 0x3D, 0xCF, 0xFF, 0xBA, 0xAE, 0xFF, 0xB6, 0x8D, 0xFF,
-  0xCF, 0x53, 0xFF, 0x8E, 0x4B, 0xFF, 0x4D, 0x43, 0xFF, 0x6E, 0x4B, 0xFF, 0x6E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x4B, 0xFF, 0x2E, 0x4B, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x6E, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x4B, 0xFF, 0x8E,
-  0x43, 0xFF, 0x6E, 0x43, 0xFF, 0x8E, 0x43, 0xFF, 0x92, 0x64, 0xFF, 0x18, 0x96,
-  0xFF, 0x9D, 0xB7, 0xFF, 0xFE, 0xBF, 0xFF, 0xDD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xA7, 0xFF, 0xFC, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xB7,
-  0xFF, 0x9C, 0xA7, 0xFF, 0xDE, 0xB7, 0xFF, 0x37, 0x8E, 0xFF, 0x10, 0x54, 0xFF,
-  0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x12, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x32, 0x64,
-  0xFF, 0x12, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x6C, 0xFF,
-  0x52, 0x84, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0x8C,
-  0x85, 0x11, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x11, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0xF1, 0x6B,
-  0xFF, 0xF1, 0x6B, 0xFF, 0x32, 0x74, 0xFF, 0x77, 0x9D, 0xFF, 0x3D, 0xD7, 0xFF,
-  0xDC, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB,
-  0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDC, 0xD6,
-  0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF, 0x1C, 0xD7, 0xFF, 0xDC, 0xCE, 0xFF,
-  0x35, 0x95, 0xFF, 0xAF, 0x53, 0xFF, 0x6E, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x6E,
-  0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x5B, 0xFF,
-  0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x4B, 0xFF, 0x6E, 0x4B,
-  0xFF, 0x6E, 0x4B, 0xFF, 0x8E, 0x43, 0xFF, 0x51, 0x5C, 0xFF,
-  0x38, 0x8E, 0xFF, 0xDE, 0xBF, 0xFF, 0xDE, 0xB7, 0xFF, 0xDD, 0xAF, 0xFF, 0xDD,
-  0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7,
-  0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xBC, 0xA7, 0xFF, 0xFE, 0xB7, 0xFF,
-  0xFE, 0xAF, 0xFF, 0xBD, 0xAF, 0xFF, 0x54, 0x75, 0xFF, 0x10, 0x5C, 0xFF, 0x11,
-  0x64, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x31, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x52, 0x6C, 0xFF,
-  0x12, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x74, 0xFF, 0xF0, 0x6B, 0xF2, 0xD8,
-  0xB5, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x7C, 0xBC, 0x11, 0x6C, 0xFF,
-  0x11, 0x64, 0xFF, 0x72, 0x6C, 0xFF, 0xF1, 0x5B, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x52, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x11, 0x64,
-  0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0xD0, 0x6B, 0xFF,
-  0x15, 0x8D, 0xFF, 0x1D, 0xD7, 0xFF, 0xDB, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB,
-  0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0x1C, 0xDF, 0xFF, 0xDB, 0xCE, 0xFF, 0xDB, 0xD6,
-  0xFF, 0xDB, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF,
-  0xFD, 0xD6, 0xFF, 0x39, 0xB6, 0xFF, 0x11, 0x74, 0xFF, 0x2D, 0x53, 0xFF, 0x6E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x2E, 0x4B, 0xFF, 0x6F, 0x53, 0xFF, 0x6F, 0x53,
-  0xFF, 0x4F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4E, 0x5B, 0xFF,
-  0x2E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x4B, 0xFF,
-  0x8F, 0x4B, 0xFF, 0x8E, 0x4B, 0xFF, 0x6D, 0x43, 0xFF, 0xF3, 0x6C, 0xFF, 0x3C,
-  0xAF, 0xFF, 0xFE, 0xBF, 0xFF, 0xDD, 0xB7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7,
-  0xFF, 0xFE, 0xAF, 0xFF, 0xFC, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE,
-  0xAF, 0xFF, 0x7C, 0xAF, 0xFF, 0x30, 0x54, 0xFF, 0xF0, 0x5B, 0xFF, 0x11, 0x6C,
-  0xFF, 0x32, 0x74, 0xFF, 0xF1, 0x63, 0xFF, 0x11, 0x64, 0xFF, 0x52, 0x6C, 0xFF,
-  0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x12,
-  0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x74, 0xFF, 0xF4, 0x9C, 0x68, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x73, 0x84, 0xA1, 0x11, 0x74, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x64, 0xFF, 0x11, 0x5C, 0xFF, 0x52, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x52, 0x74, 0xFF,
-  0xF0, 0x63, 0xFF, 0x31, 0x74, 0xFF, 0x72, 0x7C, 0xFF, 0x5A, 0xBE, 0xFF, 0xFC,
-  0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xFB, 0xD6,
-  0xFF, 0xDB, 0xCE, 0xFF, 0x1C, 0xD7, 0xFF, 0xDB, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF,
-  0xBB, 0xD6, 0xFF, 0xBC, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0x76, 0x9D, 0xFF, 0x8F,
-  0x5B, 0xFF, 0x4D, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53,
-  0xFF, 0x8F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4F, 0x5B, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x5B, 0xFF,
-  0x2E, 0x5B, 0xFF, 0x6F, 0x5B, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x4B, 0xFF, 0x6E,
-  0x4B, 0xFF, 0x8E, 0x4B, 0xFF, 0x8E, 0x4B, 0xFF, 0x30, 0x5C, 0xFF, 0xDA, 0xA6,
-  0xFF, 0xDD, 0xB7, 0xFF, 0xFE, 0xB7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFC, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE,
-  0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xDD, 0xAF, 0xFF, 0x99, 0x9E,
-  0xFF, 0x6E, 0x43, 0xFF, 0x10, 0x64, 0xFF, 0xF1, 0x6B, 0xFF,
-  0x32, 0x74, 0xFF, 0x32, 0x74, 0xFF, 0x11, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x32,
-  0x64, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x12,
-  0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x74,
-  0xFF, 0xF0, 0x73, 0xF8, 0x34, 0x9D, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56,
-  0xA5, 0x4B, 0x31, 0x74, 0xEE, 0x11, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x31, 0x64,
-  0xFF, 0x11, 0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xF0, 0x6B, 0xFF, 0xD8,
-  0xAD, 0xFF, 0xFC, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xD6,
-  0xFF, 0xDB, 0xD6, 0xFF, 0xBA, 0xCE, 0xFF, 0xFB, 0xCE, 0xFF,
-  0xFB, 0xCE, 0xFF, 0xDB, 0xCE, 0xFF, 0xDC, 0xD6, 0xFF, 0xDC, 0xD6, 0xFF, 0xBB,
-  0xD6, 0xFF, 0x35, 0x9D, 0xFF, 0x8F, 0x63, 0xFF, 0x2D, 0x4B, 0xFF, 0x6E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x2E, 0x53, 0xFF,
-  0x4F, 0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0x2E, 0x5B, 0xFF, 0x4E,
-  0x53, 0xFF, 0x8F, 0x5B, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x4B, 0xFF, 0x6F, 0x53,
-  0xFF, 0x0D, 0x4B, 0xFF, 0x4D, 0x4B, 0xFF, 0xCF, 0x4B, 0xFF, 0xB9, 0x9E, 0xFF,
-  0xFE, 0xB7, 0xFF, 0xDD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFC, 0x9F,
-  0xFF, 0xFD, 0xA7, 0xFF, 0xDD, 0xA7, 0xFF, 0xDE, 0xB7, 0xFF, 0x13, 0x6D, 0xFF,
-  0x8E, 0x4B, 0xFF, 0xB0, 0x5B, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x74, 0xFF, 0xF1,
-  0x63, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x12, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xF1, 0x6B, 0xFF, 0x51, 0x84, 0xCC,
-  0x55, 0xAD, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x8C,
-  0x67, 0x31, 0x74, 0xF7, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0xF0,
-  0x63, 0xFF, 0x32, 0x74, 0xFF, 0x72, 0x7C, 0xFF, 0xDB, 0xCE, 0xFF, 0xDB, 0xCE,
-  0xFF, 0xDC, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0x9A, 0xCE, 0xFF,
-  0xFB, 0xD6, 0xFF, 0x1C, 0xD7, 0xFF, 0x9A, 0xC6, 0xFF, 0x1C, 0xD7, 0xFF, 0xBB,
-  0xCE, 0xFF, 0xDC, 0xD6, 0xFF, 0xF5, 0x94, 0xFF, 0x6E, 0x63, 0xFF, 0x0D, 0x4B,
-  0xFF, 0x8E, 0x5B, 0xFF, 0x4E, 0x4B, 0xFF, 0x4E, 0x53, 0xFF,
-  0x6F, 0x5B, 0xFF, 0x0E, 0x53, 0xFF, 0x4F, 0x5B, 0xFF, 0x2E, 0x53, 0xFF, 0x2E,
-  0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x4B, 0xFF, 0x4E, 0x4B,
-  0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x4B, 0xFF, 0x6E, 0x4B, 0xFF, 0x6E, 0x4B, 0xFF,
-  0x6E, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E,
-  0x53, 0xFF, 0x2E, 0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0x0D, 0x4B, 0xFF, 0x2E, 0x4B,
-  0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x8F, 0x5B, 0xFF,
-  0x6E, 0x53, 0xFF, 0x6E, 0x4B, 0xFF, 0xAE, 0x43, 0xFF, 0x99, 0x96, 0xFF, 0xFE,
-  0xB7, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFE, 0xAF, 0xFF,
-  0xDD, 0xA7, 0xFF, 0xBC, 0xAF, 0xFF, 0x5C, 0xAF, 0xFF, 0xAE, 0x4B, 0xFF, 0xAF,
-  0x53, 0xFF, 0xAF, 0x5B, 0xFF, 0x11, 0x6C, 0xFF, 0x52, 0x74, 0xFF, 0xF1, 0x63,
-  0xFF, 0x32, 0x64, 0xFF, 0x52, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x52, 0x7C, 0xD2, 0x15, 0x9D, 0x29, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x94, 0x53,
-  0x52, 0x7C, 0xEB, 0xF1, 0x6B, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C,
-  0xFF, 0x18, 0xAE, 0xFF, 0xFC, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF,
-  0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB,
-  0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xDB, 0xCE, 0xFF, 0x1C, 0xD7, 0xFF, 0x76, 0xA5,
-  0xFF, 0x6E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x4B, 0xFF, 0x4E, 0x4B,
-  0xFF, 0x8E, 0x4B, 0xFF, 0x8E, 0x4B, 0xFF, 0x6D, 0x43, 0xFF,
-  0xAE, 0x4B, 0xFF, 0xAE, 0x4B, 0xFF, 0x8E, 0x43, 0xFF, 0x6D, 0x43, 0xFF, 0x6E,
-  0x43, 0xFF, 0x8E, 0x4B, 0xFF, 0x6E, 0x4B, 0xFF, 0x4D, 0x4B, 0xFF, 0x4E, 0x53,
-  0xFF, 0x8F, 0x5B, 0xFF, 0x8F, 0x5B, 0xFF, 0x4E, 0x4B, 0xFF, 0x4E, 0x53, 0xFF,
-  0x6E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x6E,
-  0x53, 0xFF, 0x6D, 0x43, 0xFF, 0xEF, 0x4B, 0xFF, 0x3B, 0xA7, 0xFF, 0x9C, 0xAF,
-  0xFF, 0xFD, 0xB7, 0xFF, 0xDD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDC, 0xA7, 0xFF,
-  0xFD, 0xA7, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFE, 0xAF, 0xFF, 0xDD,
-  0xAF, 0xFF, 0xDD, 0xB7, 0xFF, 0x54, 0x75, 0xFF, 0xAE, 0x4B, 0xFF, 0x6E, 0x53,
-  0xFF, 0xB0, 0x5B, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x52, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF,
-  0x31, 0x74, 0xFF, 0xF0, 0x6B, 0xFF, 0x52, 0x7C, 0xC6, 0x55, 0xA5, 0x1B, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x9D, 0x3C, 0x52,
-  0x7C, 0xDD, 0xF1, 0x6B, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x31, 0x6C,
-  0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x74, 0xFF, 0x72, 0x7C, 0xFF, 0xFC, 0xCE, 0xFF,
-  0xDC, 0xCE, 0xFF, 0xFB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB,
-  0xCE, 0xFF, 0x3C, 0xDF, 0xFF, 0x9A, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0x1C, 0xD7,
-  0xFF, 0xDB, 0xCE, 0xFF, 0x19, 0xBE, 0xFF, 0x8F, 0x63, 0xFF, 0x4E, 0x5B, 0xFF,
-  0x6E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x8F, 0x5B, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x8F, 0x5B, 0xFF, 0x2E, 0x4B, 0xFF, 0x6E, 0x53,
-  0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x4B, 0xFF, 0xAE, 0x4B, 0xFF, 0x92, 0x64, 0xFF,
-  0xB6, 0x85, 0xFF, 0x79, 0x96, 0xFF, 0xFB, 0xA6, 0xFF, 0x1B, 0xAF, 0xFF, 0x1C,
-  0xAF, 0xFF, 0xFA, 0xA6, 0xFF, 0x58, 0x96, 0xFF, 0x75, 0x7D, 0xFF, 0x71, 0x5C,
-  0xFF, 0x8E, 0x43, 0xFF, 0x8E, 0x53, 0xFF, 0x2D, 0x43, 0xFF,
-  0x6E, 0x4B, 0xFF, 0x8F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E,
-  0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x2D, 0x53, 0xFF, 0x8F, 0x53,
-  0xFF, 0x6E, 0x4B, 0xFF, 0x0F, 0x4C, 0xFF, 0x9D, 0xB7, 0xFF, 0xFE, 0xB7, 0xFF,
-  0xDD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xB7, 0xFF, 0xDD, 0xAF,
-  0xFF, 0x5C, 0xAF, 0xFF, 0xEF, 0x4B, 0xFF, 0x6E, 0x4B, 0xFF, 0x6E, 0x53, 0xFF,
-  0xB0, 0x5B, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xF0, 0x63, 0xFF, 0x11, 0x6C, 0xFF, 0x72,
-  0x84, 0xB7, 0x55, 0x9D, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x9D, 0x30, 0x52, 0x7C, 0xCF, 0x32, 0x74,
-  0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x64, 0xFF,
-  0x11, 0x64, 0xFF, 0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0xB7, 0xA5, 0xFF, 0xFC, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xDB,
-  0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0x1C, 0xD7, 0xFF, 0xBA, 0xCE,
-  0xFF, 0x1C, 0xDF, 0xFF, 0xBB, 0xD6, 0xFF, 0x9B, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF,
-  0xF0, 0x6B, 0xFF, 0x2D, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x8F, 0x53,
-  0xFF, 0x2D, 0x4B, 0xFF, 0xAF, 0x53, 0xFF, 0x2D, 0x43, 0xFF, 0xCF, 0x4B, 0xFF,
-  0xB6, 0x85, 0xFF, 0x5C, 0xB7, 0xFF, 0xDE, 0xBF, 0xFF, 0xDD, 0xB7, 0xFF, 0xFE,
-  0xB7, 0xFF, 0xFE, 0xB7, 0xFF, 0xFE, 0xB7, 0xFF, 0xFE, 0xB7, 0xFF, 0xDE, 0xB7,
-  0xFF, 0xDE, 0xB7, 0xFF, 0xDD, 0xB7, 0xFF, 0x9C, 0xB7, 0xFF, 0x3C, 0xAF, 0xFF,
-  0xF3, 0x6C, 0xFF, 0xF0, 0x53, 0xFF, 0x2D, 0x43, 0xFF, 0x4E, 0x4B, 0xFF, 0x6E,
-  0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4F, 0x5B, 0xFF, 0x6F, 0x5B, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6F, 0x5B, 0xFF, 0x2D, 0x53, 0xFF, 0x6E, 0x53, 0xFF,
-  0x4D, 0x43, 0xFF, 0x54, 0x75, 0xFF, 0xDD, 0xB7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xDC, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xBF, 0xFF,
-  0x13, 0x65, 0xFF, 0x8E, 0x43, 0xFF, 0x4E, 0x4B, 0xFF, 0x4E, 0x53, 0xFF, 0xD0,
-  0x63, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0xF1, 0x63, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x93, 0x84, 0xA9, 0x55, 0xAD, 0x0C, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x96, 0xA5, 0x17, 0x31, 0x74, 0xB8, 0x31, 0x74, 0xFF,
-  0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x74, 0xFF, 0xDC,
-  0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xDB, 0xD6,
-  0xFF, 0xDB, 0xD6, 0xFF, 0xFB, 0xD6, 0xFF, 0xDB, 0xCE, 0xFF, 0xDC, 0xD6, 0xFF,
-  0xBB, 0xD6, 0xFF, 0xFC, 0xDE, 0xFF, 0x35, 0x9D, 0xFF, 0x2D, 0x53, 0xFF, 0x6E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x5B,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x4B, 0xFF, 0x8E, 0x4B, 0xFF,
-  0x6D, 0x3B, 0xFF, 0x54, 0x75, 0xFF, 0x3B, 0xAF, 0xFF, 0xDE, 0xBF, 0xFF, 0xDD,
-  0xB7, 0xFF, 0xDD, 0xB7, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF,
-  0xFE, 0xB7, 0xFF, 0xFE, 0xB7, 0xFF, 0xDD, 0xB7, 0xFF, 0xBD, 0xBF, 0xFF, 0xFB,
-  0xA6, 0xFF, 0x71, 0x5C, 0xFF, 0x6E, 0x43, 0xFF, 0x8F, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF,
-  0x4E, 0x5B, 0xFF, 0x6E, 0x5B, 0xFF, 0x8E, 0x53, 0xFF, 0x6D, 0x43, 0xFF, 0xFA,
-  0xA6, 0xFF, 0xDD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xA7, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xFE, 0xB7, 0xFF,
-  0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xB9, 0x96, 0xFF, 0xAE,
-  0x43, 0xFF, 0x6E, 0x4B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0xD0, 0x63,
-  0xFF, 0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFA, 0xB3, 0x8C,
-  0x8D, 0xD9, 0x9C, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xB6, 0xA5, 0x11, 0x92, 0x8C, 0xA6, 0x11, 0x74, 0xFF, 0xD0,
-  0x6B, 0xFF, 0x32, 0x74, 0xFF, 0x12, 0x6C, 0xFF, 0xF2, 0x63, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x35, 0x95, 0xFF, 0xFC, 0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xDB, 0xD6,
-  0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF,
-  0xFB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF, 0xDC, 0xD6, 0xFF, 0x9B,
-  0xCE, 0xFF, 0x6E, 0x5B, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53,
-  0xFF, 0x2E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4F, 0x5B, 0xFF, 0x2E, 0x53, 0xFF,
-  0x8E, 0x53, 0xFF, 0x6E, 0x43, 0xFF, 0xCE, 0x43, 0xFF, 0x98, 0x8E, 0xFF, 0xBD,
-  0xAF, 0xFF, 0xFE, 0xB7, 0xFF, 0xDD, 0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFE, 0xAF,
-  0xFF, 0xDD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xB7, 0xFF, 0xDD, 0xB7, 0xFF, 0xBD, 0xB7,
-  0xFF, 0x95, 0x75, 0xFF, 0x8E, 0x43, 0xFF, 0x6E, 0x4B, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E,
-  0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x8E, 0x4B, 0xFF, 0x30, 0x54, 0xFF, 0xDE, 0xBF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xDD, 0xB7, 0xFF, 0x50, 0x54, 0xFF, 0xAF, 0x4B, 0xFF, 0x2E, 0x4B,
-  0xFF, 0x6E, 0x5B, 0xFF, 0x6F, 0x53, 0xFF, 0x8F, 0x53, 0xFF,
-  0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0xF0, 0x6B,
-  0xFF, 0x31, 0x74, 0xF0, 0xD3, 0x8C, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x96, 0xB5, 0x0A, 0xB3, 0x8C, 0x92, 0x11, 0x74, 0xFF, 0xF1, 0x6B,
-  0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xF8, 0xAD,
-  0xFF, 0xDC, 0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFB, 0xD6, 0xFF,
-  0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xBB,
-  0xD6, 0xFF, 0xDC, 0xD6, 0xFF, 0x15, 0x95, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6E, 0x4B, 0xFF, 0x4E, 0x53, 0xFF, 0x4F, 0x53, 0xFF,
-  0x4F, 0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x4B, 0xFF, 0xEF,
-  0x4B, 0xFF, 0x99, 0x96, 0xFF, 0x9C, 0xA7, 0xFF, 0xFE, 0xB7, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xDC, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xDD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xBD, 0xAF, 0xFF,
-  0xB5, 0x7D, 0xFF, 0xAE, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6E, 0x4B, 0xFF, 0xCF, 0x53, 0xFF, 0x99, 0x96, 0xFF, 0xFE, 0xB7, 0xFF,
-  0xDD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xB7,
-  0xFF, 0x75, 0x75, 0xFF, 0x8E, 0x4B, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF,
-  0x6F, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x90, 0x5B, 0xFF, 0xF1, 0x63, 0xFF, 0x32,
-  0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C,
-  0xFF, 0x11, 0x6C, 0xFF, 0x51, 0x74, 0xE6, 0xF3, 0x94, 0x47,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x55, 0xAD, 0x06, 0xD3, 0x8C, 0x83, 0x11, 0x74, 0xFE, 0x11, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x12, 0x6C,
-  0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x74, 0xFF, 0xDC, 0xCE, 0xFF, 0xDB, 0xCE, 0xFF,
-  0xDC, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFB,
-  0xD6, 0xFF, 0xDB, 0xCE, 0xFF, 0x1C, 0xD7, 0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xCE,
-  0xFF, 0x8F, 0x63, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF,
-  0x8F, 0x5B, 0xFF, 0x0E, 0x4B, 0xFF, 0x4E, 0x5B, 0xFF, 0x6F, 0x5B, 0xFF, 0x4E,
-  0x4B, 0xFF, 0x8E, 0x4B, 0xFF, 0x38, 0x96, 0xFF, 0xDE, 0xBF, 0xFF, 0xFE, 0xB7,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xDC, 0xA7, 0xFF, 0xFE, 0xB7, 0xFF, 0xFE, 0xB7, 0xFF, 0xBD, 0xB7, 0xFF, 0x34,
-  0x75, 0xFF, 0x4D, 0x43, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53,
-  0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x6E, 0x4B, 0xFF, 0xD3, 0x6C, 0xFF, 0xFE, 0xBF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xDD, 0xB7, 0xFF, 0xDA, 0xA6, 0xFF,
-  0x6D, 0x43, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x2E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0xB0, 0x5B, 0xFF, 0x11, 0x64, 0xFF, 0x12, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x51, 0x74, 0xDE,
-  0xF4, 0x8C, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x79, 0x9E, 0x05, 0xD4, 0x8C, 0x8E, 0xF1, 0x6B, 0xFF, 0x11, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0xD4, 0x84, 0xFF, 0x3D, 0xD7, 0xFF, 0xDB, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB,
-  0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0xFB, 0xD6,
-  0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xCE, 0xFF, 0xF8, 0xB5, 0xFF, 0x2D, 0x53, 0xFF,
-  0x4E, 0x5B, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x4B, 0xFF, 0x6E, 0x4B, 0xFF, 0x34, 0x7D,
-  0xFF, 0x9D, 0xBF, 0xFF, 0xDE, 0xB7, 0xFF, 0xDD, 0xAF, 0xFF, 0xDD, 0xA7, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xA7, 0xFF, 0xFE, 0xAF, 0xFF, 0xBD, 0xB7, 0xFF, 0x9D, 0xBF, 0xFF, 0x31, 0x5C,
-  0xFF, 0x6E, 0x4B, 0xFF, 0x4E, 0x4B, 0xFF, 0x8F, 0x53, 0xFF, 0x2E, 0x53, 0xFF,
-  0x4E, 0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x4B, 0xFF, 0xCF,
-  0x4B, 0xFF, 0x5C, 0xAF, 0xFF, 0xFD, 0xB7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xDD, 0xB7, 0xFF, 0x9D, 0xBF, 0xFF, 0xCF, 0x4B, 0xFF, 0x6E,
-  0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x2E, 0x5B, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0xB0, 0x5B, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x31, 0x74, 0xE0, 0x14, 0x8D, 0x39, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96,
-  0x9D, 0x0A, 0x52, 0x74, 0xC7, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x97, 0xA5, 0xFF, 0xFC,
-  0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFB, 0xD6,
-  0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDC, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF,
-  0xDC, 0xD6, 0xFF, 0xB3, 0x8C, 0xFF, 0x2E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x6E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x8F, 0x5B,
-  0xFF, 0x6E, 0x4B, 0xFF, 0xEF, 0x53, 0xFF, 0x3C, 0xB7, 0xFF, 0xDD, 0xB7, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xAF,
-  0xFF, 0xBD, 0xBF, 0xFF, 0xBA, 0xA6, 0xFF, 0x6E, 0x43, 0xFF,
-  0x6E, 0x4B, 0xFF, 0x8F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x2E,
-  0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x43, 0xFF, 0x37, 0x8E,
-  0xFF, 0xDD, 0xB7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE,
-  0xB7, 0xFF, 0xDE, 0xBF, 0xFF, 0x92, 0x64, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x5B,
-  0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x4B, 0xFF,
-  0x6F, 0x53, 0xFF, 0xD0, 0x5B, 0xFF, 0xF1, 0x63, 0xFF, 0x11, 0x6C, 0xFF, 0xD3,
-  0x84, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x95, 0x4A, 0x32, 0x74,
-  0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x5A, 0xB6, 0xFF, 0xBB, 0xC6, 0xFF, 0xFC, 0xD6,
-  0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF,
-  0xDB, 0xD6, 0xFF, 0xDB, 0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0x8F,
-  0x63, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6F, 0x5B, 0xFF, 0x0D, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x8E, 0x4B, 0xFF,
-  0x96, 0x85, 0xFF, 0xBD, 0xBF, 0xFF, 0xFE, 0xB7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7,
-  0xFF, 0xFD, 0xA7, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xB7, 0xFF,
-  0xBE, 0xBF, 0xFF, 0xB2, 0x64, 0xFF, 0x6E, 0x43, 0xFF, 0x8E, 0x4B, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0x6F, 0x5B,
-  0xFF, 0x6E, 0x4B, 0xFF, 0x13, 0x6D, 0xFF, 0xBD, 0xB7, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xBD, 0xB7,
-  0xFF, 0x95, 0x7D, 0xFF, 0x6E, 0x4B, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF,
-  0x4E, 0x5B, 0xFF, 0x4F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x8F, 0x5B, 0xFF, 0x11, 0x6C, 0xCE, 0xB6, 0xA5, 0x11, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xD7, 0xA5, 0x0B, 0x31, 0x74, 0xEC, 0x11, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xBB, 0xC6,
-  0xFF, 0xBB, 0xCE, 0xFF, 0xDC, 0xD6, 0xFF, 0xFB, 0xD6, 0xFF,
-  0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB,
-  0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0x7A, 0xC6, 0xFF, 0x2D, 0x5B, 0xFF, 0x2D, 0x53,
-  0xFF, 0x4E, 0x5B, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x6F, 0x53, 0xFF, 0x2D, 0x4B, 0xFF, 0x8E, 0x4B, 0xFF, 0xBD, 0xBF, 0xFF, 0xBD,
-  0xB7, 0xFF, 0xDD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xBC, 0x9F, 0xFF, 0xFE, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xBD, 0xB7, 0xFF, 0x99,
-  0x9E, 0xFF, 0xAE, 0x4B, 0xFF, 0x6E, 0x4B, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53,
-  0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x8E, 0x53, 0xFF,
-  0x30, 0x54, 0xFF, 0xBD, 0xB7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD,
-  0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0x78, 0x8E, 0xFF,
-  0x8E, 0x43, 0xFF, 0x6E, 0x4B, 0xFF, 0x2D, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x2E, 0x4B, 0xFF, 0x4E, 0x53,
-  0xFF, 0xF0, 0x6B, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xF0, 0x6B, 0xE5, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11,
-  0x64, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xDC, 0xC6, 0xFF, 0xFC, 0xD6, 0xFF,
-  0xBB, 0xCE, 0xFF, 0xFB, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB,
-  0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDC, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF, 0xF8, 0xAD,
-  0xFF, 0x4E, 0x5B, 0xFF, 0x2E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF,
-  0x2E, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4E, 0x4B, 0xFF, 0xAF,
-  0x53, 0xFF, 0xB2, 0x6C, 0xFF, 0x9D, 0xB7, 0xFF, 0xFE, 0xB7, 0xFF, 0xFD, 0xA7,
-  0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xDD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFE, 0xAF, 0xFF, 0xDC,
-  0x9F, 0xFF, 0xFE, 0xB7, 0xFF, 0xBD, 0xAF, 0xFF, 0xBD, 0xBF, 0xFF, 0xCF, 0x4B,
-  0xFF, 0x8E, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF,
-  0x4E, 0x5B, 0xFF, 0x2E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x8E, 0x43, 0xFF, 0x7C,
-  0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7,
-  0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFE, 0xB7, 0xFF, 0xFA, 0x9E, 0xFF, 0x8E, 0x43, 0xFF, 0x8F, 0x53, 0xFF, 0x4D,
-  0x4B, 0xFF, 0x6E, 0x5B, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x4B, 0xFF, 0x6F, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0xAF, 0x63, 0xB9,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-  0x74, 0xE8, 0x11, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x93, 0x7C, 0xFF, 0xFC, 0xCE, 0xFF, 0xDC, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB,
-  0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6,
-  0xFF, 0xDC, 0xD6, 0xFF, 0x1C, 0xD7, 0xFF, 0x56, 0x9D, 0xFF, 0x4E, 0x5B, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x4B, 0xFF, 0x17, 0x8E, 0xFF, 0xDE, 0xBF,
-  0xFF, 0xBC, 0xA7, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xB7, 0xFF, 0x13, 0x6D, 0xFF, 0x6D, 0x4B, 0xFF,
-  0x4E, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6D, 0x43, 0xFF, 0x1B, 0xAF, 0xFF, 0xFD, 0xB7,
-  0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xA7, 0xFF, 0xFE, 0xAF, 0xFF,
-  0xDD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xDE, 0xB7, 0xFF, 0x7C,
-  0xAF, 0xFF, 0x8E, 0x43, 0xFF, 0x4E, 0x4B, 0xFF, 0x8F, 0x5B, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x5B, 0xFF, 0xD0, 0x6B, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x74, 0xED, 0x11, 0x6C,
-  0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF,
-  0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xB3, 0x84, 0xFF, 0xFC,
-  0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6,
-  0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xCE, 0xFF,
-  0xFC, 0xD6, 0xFF, 0x35, 0x95, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x8F, 0x53,
-  0xFF, 0x6E, 0x43, 0xFF, 0xDA, 0xA6, 0xFF, 0xDD, 0xB7, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xDD, 0xB7, 0xFF, 0x95, 0x7D, 0xFF, 0x8E, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x6E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53,
-  0xFF, 0x6E, 0x4B, 0xFF, 0x99, 0xA6, 0xFF, 0x9D, 0xB7, 0xFF, 0xDD, 0xB7, 0xFF,
-  0xFE, 0xB7, 0xFF, 0xDD, 0xAF, 0xFF, 0xFE, 0xBF, 0xFF, 0xDD, 0xB7, 0xFF, 0xFE,
-  0xB7, 0xFF, 0xDD, 0xB7, 0xFF, 0xDE, 0xBF, 0xFF, 0x5C, 0xB7, 0xFF, 0xAE, 0x4B,
-  0xFF, 0x2D, 0x4B, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6E, 0x53, 0xFF,
-  0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0xD0,
-  0x6B, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x74, 0xEE, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x32, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x31,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xD4, 0x84, 0xFF, 0xDC, 0xCE, 0xFF, 0xDB, 0xD6,
-  0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF,
-  0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDC, 0xD6, 0xFF, 0xDC, 0xCE, 0xFF, 0x15,
-  0x95, 0xFF, 0x4D, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x8E, 0x4B, 0xFF,
-  0x5C, 0xB7, 0xFF, 0xDD, 0xB7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD,
-  0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xB7, 0xFF, 0x38,
-  0x96, 0xFF, 0x8E, 0x4B, 0xFF, 0x8E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53,
-  0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x8E, 0x53, 0xFF,
-  0xB7, 0x95, 0xFF, 0xDB, 0xAE, 0xFF, 0xFB, 0xA6, 0xFF, 0x1B, 0xAF, 0xFF, 0xFA,
-  0xA6, 0xFF, 0x1B, 0xAF, 0xFF, 0xFB, 0xAE, 0xFF, 0x1B, 0xA7, 0xFF, 0xFB, 0xA6,
-  0xFF, 0xFB, 0xAE, 0xFF, 0xBA, 0xAE, 0xFF, 0xAF, 0x5B, 0xFF, 0x6E, 0x53, 0xFF,
-  0x6F, 0x5B, 0xFF, 0x8F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0xD0, 0x6B, 0xB5, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x11, 0x74, 0xEF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x11,
-  0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0xF4, 0x8C, 0xFF, 0xDC, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF,
-  0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB,
-  0xD6, 0xFF, 0xDC, 0xD6, 0xFF, 0xDC, 0xD6, 0xFF, 0x15, 0x95, 0xFF, 0x4D, 0x53,
-  0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4F, 0x53, 0xFF,
-  0x4F, 0x5B, 0xFF, 0x4E, 0x4B, 0xFF, 0xAF, 0x4B, 0xFF, 0x9D, 0xBF, 0xFF, 0xDE,
-  0xB7, 0xFF, 0xDD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xDD, 0xB7, 0xFF, 0x99, 0x9E, 0xFF, 0x6D, 0x4B, 0xFF, 0x6E, 0x53,
-  0xFF, 0x4D, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x0D, 0x4B, 0xFF, 0x93, 0x74, 0xFF, 0x96,
-  0x8D, 0xFF, 0x75, 0x85, 0xFF, 0x96, 0x85, 0xFF, 0x55, 0x85, 0xFF, 0x75, 0x85,
-  0xFF, 0x75, 0x85, 0xFF, 0x95, 0x85, 0xFF, 0x75, 0x85, 0xFF, 0x55, 0x85, 0xFF,
-  0x76, 0x8D, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x5B, 0xFF, 0xD0, 0x6B, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x74, 0xF0, 0x11, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64,
-  0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x74, 0xFF, 0xF4, 0x8C, 0xFF,
-  0xDC, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB,
-  0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDC, 0xD6,
-  0xFF, 0xDC, 0xD6, 0xFF, 0x15, 0x95, 0xFF, 0x4D, 0x53, 0xFF, 0x6E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4F, 0x5B, 0xFF, 0x4E,
-  0x4B, 0xFF, 0xCF, 0x4B, 0xFF, 0x9D, 0xBF, 0xFF, 0xFE, 0xB7, 0xFF, 0xDD, 0xA7,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xB7,
-  0xFF, 0x99, 0xA6, 0xFF, 0x6D, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x2D, 0x4B, 0xFF,
-  0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F,
-  0x5B, 0xFF, 0x92, 0x74, 0xFF, 0x76, 0x8D, 0xFF, 0x35, 0x8D, 0xFF, 0x56, 0x8D,
-  0xFF, 0x35, 0x8D, 0xFF, 0x55, 0x8D, 0xFF, 0x56, 0x8D, 0xFF,
-  0x76, 0x8D, 0xFF, 0x55, 0x8D, 0xFF, 0x35, 0x8D, 0xFF, 0x36, 0x95, 0xFF, 0x6F,
-  0x5B, 0xFF, 0x6F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF,
-  0xD0, 0x6B, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x11, 0x74, 0xF0, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x64,
-  0xFF, 0x31, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0xD4, 0x8C, 0xFF, 0xDC, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB,
-  0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6,
-  0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF,
-  0x14, 0x95, 0xFF, 0x4D, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0xAE, 0x4B,
-  0xFF, 0x7D, 0xB7, 0xFF, 0xDE, 0xB7, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7,
-  0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xB7, 0xFF, 0x38, 0x9E, 0xFF,
-  0x6E, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x4D, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x93, 0x7C,
-  0xFF, 0x56, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x36, 0x95, 0xFF,
-  0x36, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x56, 0x8D, 0xFF, 0x76, 0x8D, 0xFF, 0x36,
-  0x95, 0xFF, 0x36, 0x95, 0xFF, 0x4F, 0x5B, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0xD0, 0x6B, 0xB9, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x74,
-  0xF0, 0x11, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xB3,
-  0x84, 0xFF, 0xFB, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6,
-  0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF,
-  0xBB, 0xD6, 0xFF, 0xDC, 0xD6, 0xFF, 0x35, 0x95, 0xFF, 0x4D, 0x53, 0xFF, 0x6E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6F, 0x53, 0xFF, 0x8E, 0x43, 0xFF, 0xDA, 0xA6, 0xFF,
-  0xDE, 0xB7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xDD, 0xB7, 0xFF, 0xB6, 0x85, 0xFF, 0x6E, 0x53, 0xFF, 0x4E,
-  0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4F, 0x5B,
-  0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0xB4, 0x7C, 0xFF, 0x36, 0x8D, 0xFF,
-  0x36, 0x95, 0xFF, 0x16, 0x95, 0xFF, 0x16, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35,
-  0x95, 0xFF, 0x35, 0x8D, 0xFF, 0x56, 0x8D, 0xFF, 0x36, 0x95, 0xFF, 0x15, 0x95,
-  0xFF, 0x4F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x4B, 0xFF, 0x8F, 0x4B, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x5B, 0xFF, 0xD0, 0x6B, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x74, 0xED, 0x11, 0x6C, 0xFF,
-  0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11,
-  0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x92, 0x7C, 0xFF, 0xDC, 0xCE,
-  0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF,
-  0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFC,
-  0xD6, 0xFF, 0x55, 0x9D, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF,
-  0x8E, 0x4B, 0xFF, 0x38, 0x8E, 0xFF, 0xFE, 0xB7, 0xFF, 0xBD, 0xAF, 0xFF, 0xFE,
-  0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD,
-  0xB7, 0xFF, 0x34, 0x7D, 0xFF, 0x6E, 0x53, 0xFF, 0x2D, 0x53, 0xFF, 0x4E, 0x5B,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0xF4, 0x84, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x15,
-  0x95, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x56, 0x95,
-  0xFF, 0x56, 0x8D, 0xFF, 0x36, 0x95, 0xFF, 0xF5, 0x8C, 0xFF, 0x4F, 0x5B, 0xFF,
-  0x4F, 0x5B, 0xFF, 0x8F, 0x53, 0xFF, 0x6E, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x4F,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0xD0, 0x6B,
-  0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x31, 0x74, 0xE9, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x74, 0xFF, 0xDB, 0xCE, 0xFF, 0x1C, 0xD7, 0xFF,
-  0xBB, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0xFB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFC,
-  0xD6, 0xFF, 0xDB, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xB7, 0xA5,
-  0xFF, 0x4E, 0x53, 0xFF, 0x2D, 0x53, 0xFF, 0x8F, 0x5B, 0xFF, 0x2E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x8F, 0x53, 0xFF, 0x4D, 0x4B, 0xFF, 0x54,
-  0x7D, 0xFF, 0x9C, 0xB7, 0xFF, 0xFD, 0xB7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7,
-  0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xDD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xB7, 0xFF, 0xBD, 0xBF, 0xFF, 0xF0, 0x53,
-  0xFF, 0x6E, 0x53, 0xFF, 0x2D, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x5B, 0xFF,
-  0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x15,
-  0x8D, 0xFF, 0x15, 0x8D, 0xFF, 0x56, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x36, 0x95,
-  0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x8D, 0xFF, 0x56, 0x95, 0xFF,
-  0x36, 0x95, 0xFF, 0xD4, 0x84, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4F, 0x53,
-  0xFF, 0x2E, 0x53, 0xFF, 0x4D, 0x53, 0xFF, 0x10, 0x74, 0xBD, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-  0x63, 0xEA, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C,
-  0xFF, 0x12, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0xDB, 0xC6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFB,
-  0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDC, 0xD6, 0xFF, 0xDB, 0xCE,
-  0xFF, 0xBB, 0xCE, 0xFF, 0x1C, 0xD7, 0xFF, 0x59, 0xBE, 0xFF, 0x2D, 0x53, 0xFF,
-  0x2D, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x2E,
-  0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x8E, 0x53, 0xFF, 0xAE, 0x4B, 0xFF, 0xFE, 0xC7,
-  0xFF, 0xFD, 0xB7, 0xFF, 0xBC, 0xA7, 0xFF, 0xFC, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xB7, 0xFF, 0xFD,
-  0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xDD, 0xA7, 0xFF, 0xFE, 0xAF, 0xFF, 0xDE, 0xB7,
-  0xFF, 0xDB, 0xA6, 0xFF, 0xAF, 0x4B, 0xFF, 0x6E, 0x53, 0xFF,
-  0x2E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E,
-  0x53, 0xFF, 0x6E, 0x4B, 0xFF, 0x8F, 0x5B, 0xFF, 0x15, 0x8D, 0xFF, 0x35, 0x95,
-  0xFF, 0x56, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x36, 0x95, 0xFF, 0x35, 0x95, 0xFF,
-  0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x8D, 0xFF, 0xB4,
-  0x84, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6F, 0x53,
-  0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x4B, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x6E, 0x5B, 0xFF, 0x8E, 0x63, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xF7, 0xB5, 0x17, 0x32, 0x6C, 0xFC, 0x11, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x7A,
-  0xBE, 0xFF, 0xDB, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0x1C, 0xDF, 0xFF, 0xBB, 0xD6,
-  0xFF, 0xFB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF,
-  0xFC, 0xD6, 0xFF, 0xDB, 0xCE, 0xFF, 0x6E, 0x63, 0xFF, 0x4E, 0x5B, 0xFF, 0x2D,
-  0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x2E, 0x4B,
-  0xFF, 0x6E, 0x4B, 0xFF, 0x8E, 0x4B, 0xFF, 0x58, 0x96, 0xFF, 0xDD, 0xB7, 0xFF,
-  0xFD, 0xB7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFC, 0xA7, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFE, 0xAF, 0xFF, 0xBD, 0xAF, 0xFF, 0xDE, 0xBF, 0xFF, 0x54, 0x75, 0xFF,
-  0x4E, 0x43, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0xF0, 0x63,
-  0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x56, 0x95, 0xFF,
-  0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x56,
-  0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x8D, 0xFF, 0x72, 0x74, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6F, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x2D,
-  0x5B, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x8C,
-  0x8B, 0xF1, 0x6B, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xB7, 0xA5, 0xFF, 0xFC, 0xCE, 0xFF, 0xDB, 0xCE,
-  0xFF, 0xFC, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF,
-  0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDC, 0xD6, 0xFF, 0xDB, 0xCE, 0xFF, 0xDB,
-  0xCE, 0xFF, 0x72, 0x84, 0xFF, 0x4E, 0x5B, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x5B,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x8E, 0x53, 0xFF,
-  0x8E, 0x4B, 0xFF, 0x50, 0x54, 0xFF, 0xBD, 0xB7, 0xFF, 0xBD, 0xAF, 0xFF, 0xFE,
-  0xB7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7,
-  0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFE, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF,
-  0xFE, 0xB7, 0xFF, 0x1B, 0xA7, 0xFF, 0xCF, 0x43, 0xFF, 0x6E, 0x4B, 0xFF, 0x6E,
-  0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x2E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6E, 0x5B,
-  0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x52, 0x74, 0xFF, 0x56, 0x95, 0xFF,
-  0x36, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x35,
-  0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x56, 0x95,
-  0xFF, 0xF1, 0x63, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0xD3, 0x94,
-  0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xD7, 0xAD, 0x2C, 0x11, 0x6C, 0xFC, 0x11, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C,
-  0xFF, 0xF4, 0x8C, 0xFF, 0x1D, 0xD7, 0xFF, 0xDB, 0xCE, 0xFF, 0xFB, 0xD6, 0xFF,
-  0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFC,
-  0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xCE, 0xFF, 0xB7, 0xAD, 0xFF, 0x2D, 0x53,
-  0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x0D, 0x4B, 0xFF, 0xAF, 0x5B, 0xFF, 0x6E, 0x4B, 0xFF, 0x6E, 0x4B, 0xFF, 0x8E,
-  0x43, 0xFF, 0xB6, 0x85, 0xFF, 0xFE, 0xBF, 0xFF, 0xBC, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFE, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0x9C, 0xA7, 0xFF, 0xDE, 0xBF, 0xFF, 0x13,
-  0x6D, 0xFF, 0x4D, 0x3B, 0xFF, 0x8E, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x2E, 0x53, 0xFF,
-  0x6E, 0x5B, 0xFF, 0xD4, 0x84, 0xFF, 0x56, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35,
-  0x95, 0xFF, 0x35, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95,
-  0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x6F, 0x5B, 0xFF,
-  0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x2D, 0x53,
-  0xFF, 0x4E, 0x5B, 0xFF, 0x8F, 0x63, 0xD8, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xB6, 0x11,
-  0x11, 0x6C, 0xE1, 0xF1, 0x63, 0xFF, 0x53, 0x74, 0xFF, 0xF1, 0x63, 0xFF, 0x11,
-  0x64, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x52, 0x7C, 0xFF,
-  0xFC, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0xFB, 0xD6, 0xFF, 0xFB, 0xD6, 0xFF, 0xBB,
-  0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFC, 0xD6,
-  0xFF, 0xDC, 0xD6, 0xFF, 0x7A, 0xC6, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x2D,
-  0x4B, 0xFF, 0x8F, 0x53, 0xFF, 0x8E, 0x4B, 0xFF, 0x8E, 0x43, 0xFF, 0xFB, 0xAE,
-  0xFF, 0xDD, 0xBF, 0xFF, 0xFD, 0xB7, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF,
-  0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE,
-  0xB7, 0xFF, 0xFE, 0xBF, 0xFF, 0xD6, 0x85, 0xFF, 0xAE, 0x43, 0xFF, 0x8E, 0x4B,
-  0xFF, 0x6E, 0x4B, 0xFF, 0x4E, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x6F, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x2E, 0x53, 0xFF, 0xB0, 0x63, 0xFF, 0x35,
-  0x95, 0xFF, 0x56, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95,
-  0xFF, 0x56, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF,
-  0x36, 0x95, 0xFF, 0xF5, 0x84, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E,
-  0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x8F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF,
-  0x4E, 0x5B, 0xFF, 0xD0, 0x6B, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x19, 0xAE, 0x22, 0x10, 0x6C, 0xE6, 0x11, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x31, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x74, 0xFF, 0x39, 0xB6, 0xFF, 0xFC,
-  0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6,
-  0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF,
-  0xDC, 0xCE, 0xFF, 0xB3, 0x84, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x2D, 0x4B, 0xFF, 0x8F, 0x5B, 0xFF, 0x2D, 0x4B,
-  0xFF, 0x8F, 0x53, 0xFF, 0x6E, 0x43, 0xFF, 0x10, 0x54, 0xFF, 0x1B, 0xAF, 0xFF,
-  0x9C, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7,
-  0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xA7, 0xFF, 0xFE, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0x7C, 0xAF, 0xFF, 0xBA, 0xA6,
-  0xFF, 0xAF, 0x4B, 0xFF, 0x6E, 0x43, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF,
-  0x4E, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x72, 0x7C, 0xFF, 0x36, 0x95, 0xFF, 0x35, 0x95,
-  0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF,
-  0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x32,
-  0x74, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0xED,
-  0x4A, 0xFF, 0xAF, 0x63, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xA5, 0x40, 0x31,
-  0x6C, 0xF1, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x53, 0x74,
-  0xFF, 0xF2, 0x63, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x31, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x77, 0x9D, 0xFF, 0xFC, 0xCE, 0xFF, 0xDC, 0xD6,
-  0xFF, 0xBB, 0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF,
-  0xFC, 0xDE, 0xFF, 0xBB, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0x1C, 0xD7, 0xFF, 0x39,
-  0xB6, 0xFF, 0x6E, 0x5B, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF,
-  0x6E, 0x4B, 0xFF, 0x6E, 0x4B, 0xFF, 0x10, 0x54, 0xFF, 0x3B, 0xAF, 0xFF, 0xBC,
-  0xAF, 0xFF, 0xFD, 0xB7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF,
-  0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF,
-  0xFD, 0xA7, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0xDE, 0xBF,
-  0xFF, 0x79, 0x9E, 0xFF, 0xAE, 0x4B, 0xFF, 0x8E, 0x4B, 0xFF,
-  0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x4B, 0xFF, 0x6F,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x8F, 0x5B,
-  0xFF, 0x15, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x56, 0x95, 0xFF,
-  0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36,
-  0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0xB0, 0x63, 0xFF, 0x6F, 0x5B,
-  0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x8F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x2E, 0x53,
-  0xFF, 0x8E, 0x63, 0xCF, 0xF7, 0xAD, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
-  0x95, 0x65, 0x72, 0x74, 0xFF, 0xF0, 0x63, 0xFF, 0x11, 0x64, 0xFF, 0x52, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x6C, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0xF1, 0x6B,
-  0xFF, 0x73, 0x7C, 0xFF, 0xFC, 0xCE, 0xFF, 0xFC, 0xCE, 0xFF, 0xBB, 0xCE, 0xFF,
-  0xDC, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xBB,
-  0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xFC, 0xCE, 0xFF, 0x93, 0x84,
-  0xFF, 0x4D, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6F,
-  0x53, 0xFF, 0x8E, 0x4B, 0xFF, 0xEF, 0x4B, 0xFF, 0x17, 0x86, 0xFF, 0xBD, 0xBF,
-  0xFF, 0xDE, 0xBF, 0xFF, 0xBD, 0xAF, 0xFF, 0xFD, 0xB7, 0xFF, 0xFE, 0xB7, 0xFF,
-  0xDD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xA7, 0xFF, 0xFD,
-  0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xDD, 0xB7,
-  0xFF, 0xDE, 0xB7, 0xFF, 0x9D, 0xB7, 0xFF, 0x75, 0x7D, 0xFF, 0x6E, 0x43, 0xFF,
-  0x6E, 0x4B, 0xFF, 0x6F, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x8F, 0x5B, 0xFF, 0x2E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6E, 0x53, 0xFF, 0x52, 0x74, 0xFF, 0x56, 0x95, 0xFF,
-  0x56, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x35, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x36,
-  0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35, 0x95,
-  0xFF, 0xF4, 0x8C, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF,
-  0x4E, 0x5B, 0xDC, 0x76, 0xAD, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x8C, 0x89, 0x52, 0x74, 0xFF, 0x31, 0x6C,
-  0xFF, 0x11, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x64, 0xFF,
-  0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0xF1, 0x63, 0xFF,
-  0x3A, 0xB6, 0xFF, 0xBB, 0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xDC, 0xD6, 0xFF, 0xBB,
-  0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xDC, 0xD6,
-  0xFF, 0xDB, 0xCE, 0xFF, 0xDB, 0xCE, 0xFF, 0xBB, 0xC6, 0xFF, 0x8F, 0x63, 0xFF,
-  0x4D, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E,
-  0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x4B,
-  0xFF, 0x8E, 0x4B, 0xFF, 0x8D, 0x43, 0xFF, 0xB2, 0x64, 0xFF, 0x99, 0x9E, 0xFF,
-  0xDE, 0xC7, 0xFF, 0xDE, 0xBF, 0xFF, 0xBD, 0xB7, 0xFF, 0xDD, 0xB7, 0xFF, 0xBD,
-  0xAF, 0xFF, 0xFE, 0xB7, 0xFF, 0xFE, 0xB7, 0xFF, 0xDD, 0xB7, 0xFF, 0xBD, 0xAF,
-  0xFF, 0xBD, 0xB7, 0xFF, 0xDD, 0xB7, 0xFF, 0xBD, 0xB7, 0xFF, 0x17, 0x8E, 0xFF,
-  0x30, 0x54, 0xFF, 0x4D, 0x43, 0xFF, 0x8F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E,
-  0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x0D, 0x53, 0xFF, 0x8F, 0x5B, 0xFF, 0x2E, 0x4B,
-  0xFF, 0x4E, 0x4B, 0xFF, 0x4E, 0x53, 0xFF, 0x4D, 0x4B, 0xFF, 0x11, 0x6C, 0xFF,
-  0x15, 0x8D, 0xFF, 0x56, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36,
-  0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95,
-  0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x32, 0x74, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x6E, 0x5B, 0xFF, 0x2D,
-  0x5B, 0xE9, 0x34, 0x9D, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x84,
-  0xA2, 0x31, 0x74, 0xFF, 0xF0, 0x63, 0xFF, 0x31, 0x64, 0xFF, 0x52, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0xF5, 0x8C, 0xFF, 0xDC, 0xCE, 0xFF, 0xDC,
-  0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6,
-  0xFF, 0xBB, 0xD6, 0xFF, 0xFB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF,
-  0xDB, 0xCE, 0xFF, 0x1D, 0xD7, 0xFF, 0x76, 0xA5, 0xFF, 0x4E, 0x5B, 0xFF, 0x8F,
-  0x5B, 0xFF, 0x0D, 0x4B, 0xFF, 0x4E, 0x53, 0xFF, 0x8F, 0x5B, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF,
-  0x8E, 0x53, 0xFF, 0x6E, 0x4B, 0xFF, 0x6D, 0x4B, 0xFF, 0x30, 0x5C, 0xFF, 0xB6,
-  0x85, 0xFF, 0xDA, 0xA6, 0xFF, 0x5C, 0xB7, 0xFF, 0xBE, 0xBF, 0xFF, 0xBE, 0xBF,
-  0xFF, 0x9D, 0xBF, 0xFF, 0x9D, 0xB7, 0xFF, 0x7C, 0xB7, 0xFF, 0xBA, 0x9E, 0xFF,
-  0x54, 0x75, 0xFF, 0xEF, 0x4B, 0xFF, 0xAF, 0x4B, 0xFF, 0x4D, 0x43, 0xFF, 0x6E,
-  0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x0D, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x90, 0x63,
-  0xFF, 0x2E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF,
-  0x4E, 0x4B, 0xFF, 0x8F, 0x5B, 0xFF, 0xB3, 0x84, 0xFF, 0x76, 0x9D, 0xFF, 0x15,
-  0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95,
-  0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35, 0x95, 0xFF,
-  0x15, 0x8D, 0xFF, 0x6E, 0x5B, 0xFF, 0x6F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x2D, 0x53, 0xFF, 0x2D, 0x53, 0xFF, 0x8F, 0x63, 0xFF, 0x0C, 0x53,
-  0xF6, 0x72, 0x84, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x73, 0x7C, 0xB9, 0x52, 0x74, 0xFF, 0x11, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31,
-  0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x52,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x5A, 0xBE, 0xFF, 0xFC, 0xCE, 0xFF, 0xBB, 0xCE,
-  0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF,
-  0xDB, 0xD6, 0xFF, 0xFB, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0x9A, 0xC6, 0xFF, 0x1D,
-  0xD7, 0xFF, 0xD3, 0x8C, 0xFF, 0x0D, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E, 0x53,
-  0xFF, 0x2D, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x4F, 0x53, 0xFF,
-  0x2E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x2E, 0x53, 0xFF, 0x2D, 0x53, 0xFF, 0x6E,
-  0x53, 0xFF, 0xAF, 0x5B, 0xFF, 0x8E, 0x53, 0xFF, 0x4D, 0x43, 0xFF, 0x6D, 0x43,
-  0xFF, 0xAE, 0x4B, 0xFF, 0xAE, 0x4B, 0xFF, 0xEF, 0x53, 0xFF, 0x10, 0x54, 0xFF,
-  0xAE, 0x4B, 0xFF, 0x6D, 0x43, 0xFF, 0x6D, 0x43, 0xFF, 0x8E, 0x4B, 0xFF, 0xAE,
-  0x4B, 0xFF, 0x4D, 0x4B, 0xFF, 0x8F, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x2E, 0x53,
-  0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0x2E, 0x5B, 0xFF, 0x4F, 0x5B, 0xFF,
-  0x2E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x8F, 0x5B, 0xFF, 0x92,
-  0x74, 0xFF, 0x35, 0x8D, 0xFF, 0x35, 0x95, 0xFF, 0x15, 0x95, 0xFF, 0x56, 0x95,
-  0xFF, 0x15, 0x8D, 0xFF, 0x35, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x36, 0x95, 0xFF,
-  0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x72, 0x7C, 0xFF, 0x2D,
-  0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x0D, 0x4B, 0xFF, 0x6F, 0x5B,
-  0xFF, 0x2D, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x8E, 0x63, 0xFF,
-  0x10, 0x74, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xB5, 0x07, 0x72, 0x7C, 0xCA,
-  0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C,
-  0xFF, 0xF5, 0x8C, 0xFF, 0xDC, 0xCE, 0xFF, 0xBB, 0xCE, 0xFF, 0x1C, 0xDF, 0xFF,
-  0xBA, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xFC, 0xDE, 0xFF, 0xBB, 0xD6, 0xFF, 0xDB,
-  0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFB, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xBB, 0xCE,
-  0xFF, 0x72, 0x7C, 0xFF, 0x6E, 0x5B, 0xFF, 0x2D, 0x53, 0xFF, 0x6F, 0x5B, 0xFF,
-  0x6E, 0x5B, 0xFF, 0x0D, 0x4B, 0xFF, 0x2E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x6E,
-  0x5B, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x2D, 0x4B, 0xFF, 0x4E, 0x53,
-  0xFF, 0x8E, 0x53, 0xFF, 0x8E, 0x53, 0xFF, 0x6E, 0x4B, 0xFF,
-  0x8E, 0x53, 0xFF, 0x6E, 0x4B, 0xFF, 0x6E, 0x4B, 0xFF, 0x6E, 0x4B, 0xFF, 0x6E,
-  0x4B, 0xFF, 0x6E, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6F, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4F, 0x5B, 0xFF,
-  0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x32, 0x74, 0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95,
-  0xFF, 0x15, 0x8D, 0xFF, 0x56, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35, 0x95, 0xFF,
-  0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x56,
-  0x95, 0xFF, 0x15, 0x8D, 0xFF, 0xAF, 0x63, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x2E, 0x53, 0xFF,
-  0x6E, 0x5B, 0xFF, 0x2D, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x31, 0x74, 0xA9, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x9A, 0xBE, 0x0B, 0x31, 0x7C, 0xCE, 0x11, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x31, 0x64, 0xFF,
-  0x52, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x33, 0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x19, 0xB6, 0xFF, 0x1C, 0xD7, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB,
-  0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xD6,
-  0xFF, 0x1C, 0xDF, 0xFF, 0xDB, 0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xBB, 0xC6, 0xFF,
-  0x72, 0x7C, 0xFF, 0x4D, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6E, 0x5B, 0xFF, 0x6E, 0x5B, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4D, 0x4B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x4B, 0xFF, 0x4E,
-  0x53, 0xFF, 0x8F, 0x5B, 0xFF, 0x8F, 0x5B, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6E, 0x5B, 0xFF,
-  0x6F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x6F,
-  0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x2D, 0x4B, 0xFF, 0x6F, 0x5B, 0xFF, 0x52, 0x74,
-  0xFF, 0x15, 0x8D, 0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x55, 0x95, 0xFF,
-  0x35, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x15,
-  0x8D, 0xFF, 0x15, 0x8D, 0xFF, 0x76, 0x9D, 0xFF, 0x15, 0x8D, 0xFF, 0x52, 0x74,
-  0xFF, 0x2D, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2D, 0x4B, 0xFF,
-  0x6E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x2D, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2D, 0x53, 0xFF, 0x10, 0x74, 0xB7, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x94, 0x7E, 0x11, 0x6C, 0xFF, 0xF0,
-  0x63, 0xFF, 0x52, 0x6C, 0xFF, 0x52, 0x64, 0xFF, 0x11, 0x5C, 0xFF, 0x32, 0x64,
-  0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C,
-  0xFF, 0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x33, 0x6C, 0xFF,
-  0x12, 0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0xB3, 0x84, 0xFF, 0xBB,
-  0xCE, 0xFF, 0xBB, 0xCE, 0xFF, 0xFB, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xBB, 0xD6,
-  0xFF, 0xBB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF,
-  0x1C, 0xDF, 0xFF, 0x9A, 0xCE, 0xFF, 0xDB, 0xCE, 0xFF, 0xBB, 0xC6, 0xFF, 0xD4,
-  0x8C, 0xFF, 0x2D, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x8F, 0x5B, 0xFF, 0x2E, 0x53,
-  0xFF, 0x2E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x6F,
-  0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53,
-  0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF,
-  0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x8F,
-  0x5B, 0xFF, 0x6E, 0x53, 0xFF, 0x2E, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x6F, 0x53,
-  0xFF, 0x52, 0x74, 0xFF, 0x36, 0x95, 0xFF, 0x56, 0x95, 0xFF,
-  0x15, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x55, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x35,
-  0x95, 0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x35, 0x95,
-  0xFF, 0x36, 0x95, 0xFF, 0x93, 0x7C, 0xFF, 0x8F, 0x5B, 0xFF, 0x2D, 0x53, 0xFF,
-  0x6E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6E, 0x5B, 0xFF, 0xEC, 0x52, 0xFE, 0x55, 0xA5, 0x3E, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x51, 0x7C, 0xB8, 0x10, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0x52, 0x64,
-  0xFF, 0x12, 0x64, 0xFF, 0x52, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x64, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12,
-  0x64, 0xFF, 0x32, 0x6C, 0xFF, 0xD0, 0x6B, 0xFF, 0x97, 0xA5, 0xFF, 0xDB, 0xD6,
-  0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF,
-  0xBB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFC,
-  0xD6, 0xFF, 0xDB, 0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xFC, 0xCE, 0xFF, 0x96, 0x9D,
-  0xFF, 0x8F, 0x5B, 0xFF, 0x0D, 0x4B, 0xFF, 0x6E, 0x5B, 0xFF, 0x6E, 0x5B, 0xFF,
-  0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x6E, 0x5B, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x4B,
-  0xFF, 0x6F, 0x53, 0xFF, 0x8F, 0x5B, 0xFF, 0xD4, 0x84, 0xFF, 0x56, 0x95, 0xFF,
-  0x36, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x56, 0x9D, 0xFF, 0x35, 0x95, 0xFF, 0xF4,
-  0x8C, 0xFF, 0x76, 0x9D, 0xFF, 0x56, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x15, 0x8D,
-  0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0xF4, 0x8C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x2D, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x5B,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x2D, 0x4B, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6F, 0x53, 0xFF, 0x2E, 0x4B, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x6D, 0x63, 0xFF, 0x50, 0x84, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0x8C,
-  0x9F, 0xF0, 0x6B, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x64, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x6C, 0xFF, 0x52, 0x74, 0xFF, 0xD0, 0x63,
-  0xFF, 0x31, 0x74, 0xFF, 0x7A, 0xBE, 0xFF, 0xFC, 0xD6, 0xFF,
-  0xDB, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xBB,
-  0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xFC, 0xD6,
-  0xFF, 0xDC, 0xD6, 0xFF, 0xDB, 0xCE, 0xFF, 0xBB, 0xCE, 0xFF, 0x7A, 0xC6, 0xFF,
-  0x72, 0x84, 0xFF, 0x2D, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x6E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x6E, 0x5B,
-  0xFF, 0x4E, 0x53, 0xFF, 0x2D, 0x4B, 0xFF, 0x8F, 0x5B, 0xFF, 0x52, 0x74, 0xFF,
-  0x15, 0x8D, 0xFF, 0x56, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x35,
-  0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95,
-  0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF,
-  0x35, 0x95, 0xFF, 0x73, 0x7C, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6F, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x2E, 0x4B, 0xFF, 0x6F, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2C, 0x5B, 0xFF, 0xF3,
-  0x9C, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xA5, 0x41, 0x10, 0x6C, 0xFE,
-  0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x74, 0xFF, 0x11, 0x6C, 0xFF,
-  0x52, 0x74, 0xFF, 0x9B, 0xC6, 0xFF, 0x1C, 0xD7, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB,
-  0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xBB, 0xD6, 0xFF, 0xDB, 0xD6,
-  0xFF, 0xDC, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF,
-  0xFC, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF, 0xF7,
-  0xAD, 0xFF, 0x51, 0x7C, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F,
-  0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53,
-  0xFF, 0x6E, 0x5B, 0xFF, 0x2D, 0x53, 0xFF, 0x2D, 0x53, 0xFF, 0x6E, 0x5B, 0xFF,
-  0x11, 0x6C, 0xFF, 0xD4, 0x84, 0xFF, 0x35, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x15,
-  0x8D, 0xFF, 0x35, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x35, 0x95,
-  0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x56, 0x9D, 0xFF,
-  0x15, 0x95, 0xFF, 0x15, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x93, 0x7C, 0xFF, 0x2E,
-  0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F,
-  0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0x4D, 0x63, 0xE0, 0xB6, 0xB5, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x84, 0xB1, 0x11, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0xF1, 0x63, 0xFF, 0x11, 0x6C, 0xFF, 0x52, 0x74, 0xFF, 0xB0, 0x5B, 0xFF, 0x15,
-  0x8D, 0xFF, 0xDB, 0xCE, 0xFF, 0xDB, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0x1C, 0xDF,
-  0xFF, 0xBB, 0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xFB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF,
-  0xDB, 0xD6, 0xFF, 0xFB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFB, 0xD6, 0xFF, 0xFC,
-  0xD6, 0xFF, 0xDB, 0xCE, 0xFF, 0x1C, 0xD7, 0xFF, 0xBB, 0xCE, 0xFF, 0x15, 0x8D,
-  0xFF, 0x73, 0x74, 0xFF, 0xAF, 0x5B, 0xFF, 0x2E, 0x53, 0xFF,
-  0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6F,
-  0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0xD0, 0x63, 0xFF, 0x93, 0x7C, 0xFF, 0x15, 0x8D, 0xFF, 0x56, 0x95, 0xFF, 0x56,
-  0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95,
-  0xFF, 0x56, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF,
-  0x36, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x36, 0x95, 0xFF, 0x56,
-  0x95, 0xFF, 0xF5, 0x8C, 0xFF, 0x8F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53,
-  0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x4B, 0xFF, 0x6F, 0x5B, 0xFF, 0x4E,
-  0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x2D, 0x53, 0xFF, 0x51, 0x84,
-  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x56, 0x9D, 0x24, 0x31, 0x74, 0xF9, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0xF1,
-  0x63, 0xFF, 0x52, 0x6C, 0xFF, 0x52, 0x74, 0xFF, 0xD0, 0x63, 0xFF, 0x35, 0x95,
-  0xFF, 0xDC, 0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xDC, 0xCE, 0xFF, 0xBB, 0xCE, 0xFF,
-  0xFC, 0xD6, 0xFF, 0x9A, 0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFC,
-  0xD6, 0xFF, 0xBB, 0xCE, 0xFF, 0xDB, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xCE,
-  0xFF, 0xFC, 0xD6, 0xFF, 0x7A, 0xBE, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x8D, 0xFF,
-  0x35, 0x8D, 0xFF, 0xF5, 0x8C, 0xFF, 0xB3, 0x7C, 0xFF, 0x52, 0x74, 0xFF, 0x11,
-  0x6C, 0xFF, 0xF1, 0x6B, 0xFF, 0xD0, 0x63, 0xFF, 0xD0, 0x63, 0xFF, 0xD0, 0x63,
-  0xFF, 0xD0, 0x63, 0xFF, 0xF1, 0x63, 0xFF, 0x31, 0x6C, 0xFF,
-  0x73, 0x74, 0xFF, 0xB3, 0x7C, 0xFF, 0x15, 0x8D, 0xFF, 0x15, 0x8D, 0xFF, 0x35,
-  0x95, 0xFF, 0x35, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x15, 0x8D, 0xFF, 0x36, 0x95,
-  0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35, 0x95, 0xFF,
-  0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35,
-  0x95, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x8F, 0x5B,
-  0xFF, 0x6F, 0x5B, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x5B,
-  0xFF, 0x4E, 0x53, 0xFF, 0x8F, 0x63, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0x84,
-  0x94, 0xF1, 0x6B, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF,
-  0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x52,
-  0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0xD0, 0x5B,
-  0xFF, 0x52, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x35, 0x95, 0xFF,
-  0xDC, 0xCE, 0xFF, 0xDB, 0xCE, 0xFF, 0x1D, 0xDF, 0xFF, 0x7A, 0xC6, 0xFF, 0xFC,
-  0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6,
-  0xFF, 0xFC, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF, 0x1D, 0xD7, 0xFF, 0xFC, 0xCE, 0xFF,
-  0x55, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x56,
-  0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x15, 0x8D, 0xFF, 0x35, 0x95, 0xFF, 0x56, 0x95,
-  0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF,
-  0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x56,
-  0x95, 0xFF, 0x56, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95,
-  0xFF, 0x56, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x15, 0x8D, 0xFF,
-  0x56, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x56,
-  0x95, 0xFF, 0x35, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x35, 0x95, 0xFF, 0x56, 0x95,
-  0xFF, 0x35, 0x95, 0xFF, 0x8F, 0x5B, 0xFF, 0x6E, 0x53, 0xFF, 0x2E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E, 0x53, 0xF0,
-  0xB3, 0x8C, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x9D, 0x0D, 0x31, 0x74, 0xE5,
-  0x11, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C,
-  0xFF, 0x11, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0x11, 0x64, 0xFF,
-  0x52, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x15, 0x8D, 0xFF, 0xDC,
-  0xC6, 0xFF, 0xDC, 0xCE, 0xFF, 0x1D, 0xDF, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6,
-  0xFF, 0xFB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF,
-  0xDB, 0xCE, 0xFF, 0xDB, 0xCE, 0xFF, 0x39, 0xB6, 0xFF, 0x76, 0x9D, 0xFF, 0x56,
-  0x95, 0xFF, 0x35, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x15, 0x8D, 0xFF, 0x56, 0x95,
-  0xFF, 0x56, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x15, 0x8D, 0xFF,
-  0x15, 0x8D, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x36,
-  0x95, 0xFF, 0x36, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95,
-  0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x35, 0x95, 0xFF,
-  0x36, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35,
-  0x95, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95,
-  0xFF, 0x56, 0x95, 0xFF, 0xD4, 0x84, 0xFF, 0xD0, 0x63, 0xFF,
-  0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x2E, 0x4B, 0xFF, 0x8F,
-  0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x2D, 0x53, 0xFF, 0xD0, 0x6B, 0xA4, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x95, 0x5D, 0x52, 0x74, 0xFF, 0x11,
-  0x64, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x52, 0x6C,
-  0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF,
-  0x12, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x93, 0x7C, 0xFF, 0xBB, 0xC6,
-  0xFF, 0xBB, 0xCE, 0xFF, 0xBB, 0xCE, 0xFF, 0xFB, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF,
-  0xFC, 0xD6, 0xFF, 0xDB, 0xD6, 0xFF, 0xBA, 0xCE, 0xFF, 0xFC, 0xD6, 0xFF, 0xFC,
-  0xCE, 0xFF, 0x76, 0x9D, 0xFF, 0x15, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95,
-  0xFF, 0x56, 0x95, 0xFF, 0x55, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF,
-  0x35, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x55, 0x95, 0xFF, 0x35,
-  0x95, 0xFF, 0x35, 0x95, 0xFF, 0x15, 0x95, 0xFF, 0x15, 0x95, 0xFF, 0x35, 0x95,
-  0xFF, 0x35, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x15, 0x8D, 0xFF,
-  0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35,
-  0x95, 0xFF, 0x35, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x15, 0x8D,
-  0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0xD4, 0x84, 0xFF,
-  0xB0, 0x63, 0xFF, 0x2D, 0x4B, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x2E,
-  0x4B, 0xFF, 0xAF, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2D, 0x5B, 0xFF, 0x8E,
-  0x63, 0xD9, 0xF5, 0x94, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x74, 0xB7, 0x11, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0x52, 0x6C, 0xFF,
-  0x12, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0xF1,
-  0x63, 0xFF, 0x52, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x11, 0x64,
-  0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x74, 0xFF, 0x39, 0xB6, 0xFF,
-  0x1C, 0xD7, 0xFF, 0xDB, 0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF, 0xFB,
-  0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF, 0x7A, 0xBE, 0xFF, 0x15, 0x95,
-  0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF,
-  0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35,
-  0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95,
-  0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF,
-  0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35,
-  0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x15, 0x8D,
-  0xFF, 0x56, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x36, 0x95, 0xFF,
-  0x36, 0x95, 0xFF, 0x72, 0x7C, 0xFF, 0x6F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x6F,
-  0x5B, 0xFF, 0x2E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x8F, 0x5B, 0xFF, 0x2E, 0x4B,
-  0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E,
-  0x53, 0xFF, 0x2D, 0x53, 0xFF, 0x4E, 0x5B, 0xFC, 0x31, 0x7C, 0x6F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x96, 0x9D, 0x1E, 0x10, 0x6C, 0xF2, 0x31, 0x6C, 0xFF, 0x11, 0x64, 0xFF,
-  0x52, 0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0x32, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0x11,
-  0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x12,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x52, 0x74, 0xFF,
-  0xF1, 0x6B, 0xFF, 0xF0, 0x6B, 0xFF, 0x35, 0x95, 0xFF, 0xDB, 0xD6, 0xFF, 0xDB,
-  0xD6, 0xFF, 0xFC, 0xD6, 0xFF, 0xDB, 0xCE, 0xFF, 0xDC, 0xCE, 0xFF, 0xFC, 0xCE,
-  0xFF, 0x76, 0x9D, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF,
-  0x55, 0x95, 0xFF, 0x55, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35,
-  0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x55, 0x95, 0xFF, 0x35, 0x95,
-  0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF,
-  0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35,
-  0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95,
-  0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF,
-  0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0xF4, 0x8C, 0xFF, 0x11, 0x6C, 0xFF, 0x6E,
-  0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x2D, 0x53, 0xFF, 0x8E, 0x63,
-  0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xB3, 0x84, 0x85, 0xF0, 0x63, 0xFF, 0x52, 0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0x32,
-  0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x64, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x52, 0x6C, 0xFF,
-  0x32, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x11, 0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0xD0,
-  0x63, 0xFF, 0xD0, 0x6B, 0xFF, 0x10, 0x74, 0xFF, 0x59, 0xBE, 0xFF, 0xDB, 0xCE,
-  0xFF, 0xFC, 0xD6, 0xFF, 0xFC, 0xCE, 0xFF, 0x39, 0xB6, 0xFF, 0x56, 0x95, 0xFF,
-  0x56, 0x9D, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35,
-  0x95, 0xFF, 0x35, 0x95, 0xFF, 0x55, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95,
-  0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF,
-  0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35,
-  0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95,
-  0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35, 0x95, 0xFF,
-  0x35, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x93,
-  0x7C, 0xFF, 0xD0, 0x63, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x6F, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x2D, 0x53,
-  0xFF, 0x6E, 0x5B, 0xFF, 0x4D, 0x5B, 0xED, 0x93, 0x8C, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x31,
-  0x74, 0xDB, 0x31, 0x74, 0xFF, 0xF1, 0x63, 0xFF, 0x52, 0x6C, 0xFF, 0x11, 0x64,
-  0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64,
-  0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF,
-  0x11, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0xF0, 0x6B,
-  0xFF, 0x8F, 0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0xD4, 0x8C, 0xFF, 0x39, 0xB6, 0xFF,
-  0x1C, 0xCF, 0xFF, 0x97, 0xA5, 0xFF, 0x15, 0x8D, 0xFF, 0x35, 0x95, 0xFF, 0x15,
-  0x8D, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x15, 0x8D,
-  0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF,
-  0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x56,
-  0x95, 0xFF, 0x36, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x36, 0x95,
-  0xFF, 0x36, 0x95, 0xFF, 0x35, 0x8D, 0xFF, 0x36, 0x8D, 0xFF,
-  0x36, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35,
-  0x8D, 0xFF, 0x93, 0x7C, 0xFF, 0xF0, 0x63, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x2E, 0x4B, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x6E, 0x5B,
-  0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x2D, 0x53, 0xFF, 0x2D, 0x5B, 0xFF,
-  0xD0, 0x73, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x95, 0x46, 0x11, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF,
-  0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x6E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x8F, 0x5B, 0xFF, 0xB3, 0x84, 0xFF, 0xB3,
-  0x84, 0xFF, 0x35, 0x95, 0xFF, 0x76, 0x9D, 0xFF, 0x55, 0x95, 0xFF, 0x56, 0x95,
-  0xFF, 0x56, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF,
-  0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x56, 0x95, 0xFF, 0x36,
-  0x95, 0xFF, 0x36, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95,
-  0xFF, 0x35, 0x95, 0xFF, 0x35, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF,
-  0x36, 0x8D, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x8D, 0xFF, 0x15,
-  0x8D, 0xFF, 0xF4, 0x84, 0xFF, 0x11, 0x6C, 0xFF, 0x8F, 0x5B, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x8F, 0x5B, 0xFF, 0x6F, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x2E, 0x5B, 0xD4, 0xF5, 0x9C, 0x12, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x72, 0x7C, 0xB5, 0x11, 0x6C, 0xFF, 0x11, 0x64, 0xFF,
-  0x52, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0x11, 0x64, 0xFF, 0xF1, 0x63, 0xFF, 0xF1, 0x63, 0xFF, 0x32, 0x6C, 0xFF, 0xAF,
-  0x5B, 0xFF, 0x2E, 0x4B, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0xD0, 0x63,
-  0xFF, 0x93, 0x7C, 0xFF, 0x35, 0x8D, 0xFF, 0x35, 0x8D, 0xFF, 0x35, 0x8D, 0xFF,
-  0x35, 0x8D, 0xFF, 0x35, 0x8D, 0xFF, 0x35, 0x8D, 0xFF, 0x36, 0x8D, 0xFF, 0x56,
-  0x95, 0xFF, 0x56, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x35, 0x8D, 0xFF, 0x36, 0x8D,
-  0xFF, 0x36, 0x8D, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x56, 0x95, 0xFF,
-  0x36, 0x95, 0xFF, 0x36, 0x8D, 0xFF, 0x36, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x36,
-  0x95, 0xFF, 0xF5, 0x84, 0xFF, 0x72, 0x74, 0xFF, 0xB0, 0x63, 0xFF, 0x4E, 0x53,
-  0xFF, 0x2E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF,
-  0x6E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6E, 0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x5B, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4D,
-  0x5B, 0xF8, 0x51, 0x7C, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x76, 0x9D, 0x1C, 0xF1, 0x6B, 0xF4, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x52, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0xB0, 0x5B,
-  0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x6E, 0x53, 0xFF, 0xF0, 0x6B, 0xFF, 0x52, 0x74, 0xFF, 0xD4, 0x84, 0xFF, 0x36,
-  0x8D, 0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x15, 0x8D,
-  0xFF, 0x36, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x56, 0x95, 0xFF,
-  0x36, 0x95, 0xFF, 0x56, 0x95, 0xFF, 0x36, 0x95, 0xFF, 0x36, 0x8D, 0xFF, 0x15,
-  0x8D, 0xFF, 0xB4, 0x7C, 0xFF, 0x31, 0x6C, 0xFF, 0xB0, 0x5B, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F,
-  0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x2D, 0x4B, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x53,
-  0xFF, 0x6F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x2E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x5B, 0xB9, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
-  0x84, 0x88, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x31, 0x6C,
-  0xFF, 0x11, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFD, 0x32, 0x74, 0xFE, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11,
-  0x64, 0xFF, 0x11, 0x64, 0xFF, 0x12, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x52, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0x6F, 0x53, 0xFF,
-  0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4D, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x5B,
-  0xFF, 0xD0, 0x63, 0xFF, 0x11, 0x6C, 0xFF, 0x52, 0x74, 0xFF, 0x52, 0x74, 0xFF,
-  0x52, 0x74, 0xFF, 0x52, 0x74, 0xFF, 0x11, 0x6C, 0xFF, 0xF1, 0x6B, 0xFF, 0xD0,
-  0x63, 0xFF, 0xB0, 0x63, 0xFF, 0x8F, 0x5B, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x6E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x6F,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x5B, 0xF7, 0x6F, 0x5B, 0xEE, 0x4E,
-  0x53, 0xF0, 0x4E, 0x5B, 0xFB, 0x2E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x2E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x5B, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x5B,
-  0xE0, 0x93, 0x84, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xBD, 0x04, 0x31, 0x74,
-  0xD4, 0x11, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C,
-  0xF8, 0x52, 0x7C, 0xD0, 0xD4, 0x8C, 0x65, 0x56, 0x95, 0x27, 0x56, 0x9D, 0x15,
-  0x56, 0x95, 0x18, 0x14, 0x8D, 0x36, 0xB3, 0x84, 0xAB, 0x51, 0x74, 0xF1, 0x11,
-  0x6C, 0xFF, 0xF0, 0x6B, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64,
-  0xFF, 0x12, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x12, 0x64, 0xFF,
-  0x52, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4F,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x53,
-  0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x8F, 0x63, 0xDE, 0x52,
-  0x7C, 0x72, 0x15, 0x8D, 0x1B, 0xB6, 0x95, 0x07, 0xF6, 0x9C, 0x0D, 0xD5, 0x8C,
-  0x23, 0x52, 0x7C, 0x73, 0xAF, 0x63, 0xCF, 0x4E, 0x5B, 0xF1, 0x2D, 0x53, 0xFF,
-  0x4E, 0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFD, 0x8F, 0x63, 0x90, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x94, 0x37, 0x31, 0x74, 0xF5,
-  0x10, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x74,
-  0xEF, 0x72, 0x7C, 0xBE, 0x93, 0x8C, 0x5A, 0x55, 0xAD, 0x09, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xA5, 0x16, 0xB2, 0x84, 0x9F, 0xF0, 0x6B,
-  0xF0, 0xF0, 0x6B, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x8F, 0x53, 0xFF, 0x2E, 0x4B, 0xFF, 0x6E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4F,
-  0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x8F, 0x53, 0xFF, 0x2E, 0x4B, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF,
-  0x2D, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x2D, 0x5B, 0xFF, 0x4D,
-  0x5B, 0xE3, 0x10, 0x7C, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xD4, 0x9C, 0x14, 0x11, 0x7C, 0x6A, 0x8E, 0x63, 0xC9, 0x4D,
-  0x5B, 0xEA, 0x4D, 0x5B, 0xFF, 0x2D, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x2D, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x6E, 0x5B, 0xFF, 0x0D, 0x53, 0xFF,
-  0x4E, 0x5B, 0xC2, 0x17, 0xA5, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0x84, 0x8C, 0x11, 0x74, 0xFA, 0x10,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x10, 0x6C,
-  0xE6, 0x31, 0x74, 0xA4, 0xD3, 0x8C, 0x42, 0x55, 0xAD, 0x09, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x95, 0x24, 0x72, 0x7C, 0xBB,
-  0x10, 0x6C, 0xFC, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x31, 0x64, 0xFF, 0x31, 0x6C,
-  0xFF, 0xF1, 0x63, 0xFF, 0x8F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4F, 0x53,
-  0xFF, 0x4F, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x4B, 0xFF,
-  0x6E, 0x53, 0xFF, 0x4D, 0x4B, 0xFF, 0x4D, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x0D,
-  0x53, 0xFF, 0x2D, 0x5B, 0xF1, 0xF0, 0x73, 0x9D, 0xF3, 0x8C, 0x10, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x94, 0x13, 0x31, 0x7C,
-  0x61, 0x8F, 0x5B, 0xBB, 0x6E, 0x5B, 0xE3, 0x4D, 0x53, 0xFA, 0x4D, 0x53, 0xFF,
-  0x4E, 0x5B, 0xFF, 0x2D, 0x53, 0xFB, 0x4E, 0x5B, 0xCB, 0x51, 0x7C, 0x4D, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x31, 0x7C, 0x82, 0xF0, 0x6B, 0xBC, 0x11, 0x74, 0xBB, 0x52, 0x74,
-  0x8C, 0xD3, 0x8C, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x94, 0x3F, 0x51,
-  0x74, 0xC9, 0xF0, 0x6B, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0xF1, 0x63, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4F, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4F, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4D, 0x53, 0xFF, 0x6E,
-  0x5B, 0xFF, 0x2D, 0x53, 0xF8, 0x4E, 0x5B, 0xBA, 0xF4, 0x94, 0x28, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xB4, 0x84, 0x11, 0x31, 0x74, 0x56, 0x8E, 0x63, 0x9B, 0x2D, 0x5B, 0xB1, 0x2D,
-  0x5B, 0xA3, 0xF0, 0x73, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x84,
-  0x57, 0x31, 0x74, 0xDB, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0xD0,
-  0x63, 0xFF, 0x8F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53,
-  0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4F, 0x53, 0xFF,
-  0x4F, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x2D, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0xAF, 0x63, 0xCD, 0x52, 0x84,
-  0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xA5, 0x0E,
-  0x93, 0x84, 0x97, 0x11, 0x74, 0xFF, 0xF1, 0x6B, 0xFF, 0x11, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0xD0, 0x63,
-  0xFF, 0x8F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF,
-  0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4F,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x6E, 0x5B,
-  0xED, 0x31, 0x7C, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0x84, 0x79, 0x11,
-  0x74, 0xFF, 0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x12, 0x64,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0xD0, 0x63, 0xFF,
-  0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6E, 0x5B, 0xFF, 0x2D, 0x53, 0xEE, 0x92, 0x84, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x84, 0xA6, 0x11, 0x74,
-  0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x64, 0xFF,
-  0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xD0, 0x63, 0xFF, 0x8F, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x2D, 0x53, 0xFF,
-  0x92, 0x84, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x15, 0x95, 0x2C, 0x31, 0x74, 0xFF, 0x11, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0xD0, 0x5B, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53,
-  0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x5B, 0xE1, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x6C, 0xE0, 0x11, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x12,
-  0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0xF1, 0x63, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x4B, 0xFF,
-  0x8F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0xCF,
-  0x6B, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52,
-  0x7C, 0xB5, 0x31, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x64,
-  0xFF, 0x12, 0x64, 0xFF, 0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0xD0, 0x63, 0xFF, 0x8F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x6E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x4B, 0xFF, 0x6F, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x72, 0x84, 0x5E, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x8C, 0x70, 0x31, 0x6C,
-  0xFF, 0x11, 0x64, 0xFF, 0x52, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x11, 0x64, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0xD0, 0x63, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x5B, 0xF2, 0x35, 0x9D, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x75, 0x9D, 0x36, 0x11, 0x6C, 0xFF, 0x11, 0x64, 0xFF,
-  0x52, 0x6C, 0xFF, 0x31, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64,
-  0xFF, 0xF0, 0x63, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xDF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x84, 0x02,
-  0xF0, 0x6B, 0xF0, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64,
-  0xFF, 0x11, 0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF,
-  0xB0, 0x5B, 0xFF, 0x6F, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E,
-  0x5B, 0xFF, 0x6E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF,
-  0x6E, 0x53, 0xFF, 0x4D, 0x53, 0xFF, 0x6E, 0x63, 0xC4, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x74, 0xD3, 0x11,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x64,
-  0xFF, 0x12, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x11, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xD0, 0x63, 0xFF, 0x6E,
-  0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4D,
-  0x53, 0xFF, 0x10, 0x74, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0x84, 0xA4, 0x11, 0x6C, 0xFF, 0x11, 0x6C,
-  0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x64, 0xFF, 0x12, 0x64, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xB0, 0x63, 0xFF, 0x6F, 0x5B,
-  0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E,
-  0x53, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0xB3, 0x8C, 0x51, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xF4, 0x94, 0x61, 0xF0, 0x6B, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11,
-  0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xB0, 0x63, 0xFF, 0x4F, 0x53, 0xFF,
-  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4F, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x4F,
-  0x5B, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x6E, 0x5B, 0xEB, 0x55, 0x9D, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xA5, 0x29,
-  0x11, 0x74, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12,
-  0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C,
-  0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF,
-  0x12, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xB0, 0x63, 0xFF, 0x4E, 0x53, 0xFF, 0x2E,
-  0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x2E, 0x53, 0xFF, 0x6F, 0x53,
-  0xFF, 0x4E, 0x53, 0xFF, 0x2D, 0x53, 0xFF, 0x6E, 0x5B, 0xFF, 0x2D, 0x5B, 0xD6,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x6B, 0xE5, 0x11,
-  0x64, 0xFF, 0x31, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32,
-  0x6C, 0xFF, 0x11, 0x64, 0xFF, 0xB0, 0x5B, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53,
-  0xFF, 0x4E, 0x4B, 0xFF, 0x4F, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x4E, 0x53, 0xFF,
-  0x4E, 0x5B, 0xFF, 0x6E, 0x5B, 0xFF, 0x8E, 0x63, 0xAF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x11, 0x74, 0xC0, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C,
-  0xFF, 0x11, 0x64, 0xFF, 0xB0, 0x5B, 0xFF, 0x6E, 0x53, 0xFF, 0x4E, 0x4B, 0xFF,
-  0x6F, 0x53, 0xFF, 0x6F, 0x53, 0xFF, 0x2D, 0x53, 0xFF, 0x4E, 0x5B, 0xFF, 0x2D,
-  0x5B, 0xFF, 0x10, 0x7C, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x84,
-  0x81, 0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF,
-  0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x11, 0x64, 0xFF, 0x11, 0x64,
-  0xFF, 0x11, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xFF,
-  0x11, 0x64, 0xFF, 0xB0, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFF, 0x6F,
-  0x5B, 0xFF, 0x4E, 0x5B, 0xFF, 0x6E, 0x5B, 0xFF, 0x2D, 0x5B, 0xEB, 0x93, 0x8C,
-  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x9D, 0x2B, 0xF0, 0x6B, 0xEF,
-  0xF0, 0x63, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31,
-  0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C,
-  0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x64, 0xFF,
-  0x11, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x31, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xB0,
-  0x63, 0xFF, 0x4E, 0x53, 0xFF, 0x2D, 0x5B, 0xFF, 0x2D, 0x5B, 0xFF, 0x2D, 0x5B,
-  0xFF, 0x6E, 0x63, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x84, 0x77, 0x31, 0x74, 0xE3, 0x11,
-  0x6C, 0xFE, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C,
-  0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0x11, 0x6C, 0xFF, 0xF1, 0x6B, 0xFE,
-  0x11, 0x6C, 0xFC, 0x11, 0x74, 0xFA, 0x11, 0x6C, 0xF9, 0xF1, 0x6B, 0xF9, 0x11,
-  0x6C, 0xFA, 0x11, 0x6C, 0xFA, 0x11, 0x6C, 0xF9, 0x11, 0x74, 0xF0, 0x6E, 0x63,
-  0xF1, 0x4E, 0x5B, 0xEE, 0x4D, 0x5B, 0xE6, 0x2D, 0x5B, 0xB4, 0x10, 0x74, 0x2E,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x95, 0x11, 0x15, 0x95,
-  0x16, 0x55, 0x9D, 0x18, 0x15, 0x9D, 0x19, 0x15, 0x9D, 0x19, 0x36, 0x9D, 0x17,
-  0x55, 0x9D, 0x15, 0x15, 0xA5, 0x13, 0xF5, 0x9C, 0x10, 0xF6, 0x9C, 0x0D, 0x17,
-  0xA5, 0x0B, 0x96, 0x9D, 0x0A, 0x17, 0xA5, 0x0B, 0x14, 0xA5, 0x0B, 0x55, 0x95,
-  0x0C, 0x14, 0xA5, 0x0B, 0xF3, 0x9C, 0x08, 0x10, 0x84, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x52, 0x4C, 0x45, 0x03, 0x00, 0x00, 0x1A, 0x00, 0x31, 0x00, 0x4E, 0x00, 0x6F,
+  0x00, 0xAC, 0x00, 0xF1, 0x00, 0x28, 0x01, 0x6A, 0x01, 0xAD, 0x01, 0xF3, 0x01,
+  0x30, 0x02, 0x65, 0x02, 0x9D, 0x02, 0xDD, 0x02, 0x22, 0x03, 0x60, 0x03, 0x9A,
+  0x03, 0xCB, 0x03, 0x11, 0x04, 0x4F, 0x04, 0x6C, 0x04, 0x8A, 0x04, 0xA7, 0x04,
+  0x87, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x94, 0x0D, 0x31, 0x6C, 0x91, 0x81, 0x31,
+  0x64, 0x96, 0x01, 0x11, 0x6C, 0x95, 0x31, 0x74, 0x58, 0x88, 0x00, 0x00, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x00, 0x52, 0x74, 0x47, 0x83, 0x31, 0x6C, 0xFF, 0x01,
+  0x32, 0x6C, 0xD3, 0xB7, 0xA5, 0x01, 0x87, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00,
+  0x00, 0x01, 0x31, 0x74, 0x7B, 0x32, 0x6C, 0xFF, 0x81, 0x12, 0x6C, 0xFF, 0x02,
+  0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFA, 0xD4, 0x8C, 0x0F, 0x87, 0x00, 0x00, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x8C, 0x0A, 0x31, 0x6C, 0xC8, 0x32, 0x64,
+  0xFF, 0x81, 0x31, 0x6C, 0xFF, 0x81, 0x32, 0x6C, 0xFF, 0x01, 0x52, 0x74, 0x61,
+  0x36, 0x9D, 0x00, 0x86, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x76, 0xA5,
+  0x00, 0x32, 0x74, 0x8A, 0x32, 0x74, 0xA7, 0x52, 0x74, 0x51, 0x72, 0x7C, 0x15,
+  0x52, 0x74, 0x54, 0x32, 0x6C, 0xDB, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x83,
+  0x32, 0x6C, 0xFF, 0x06, 0x32, 0x6C, 0xFC, 0x32, 0x6C, 0xA4, 0x72, 0x7C, 0x25,
+  0x72, 0x7C, 0x26, 0x52, 0x74, 0x76, 0x31, 0x74, 0xC1, 0x52, 0x7C, 0x30, 0x81,
+  0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x52, 0x74, 0x36, 0x32, 0x6C, 0xFB,
+  0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x31, 0x6C, 0xFC, 0x31, 0x64, 0xFF, 0x32,
+  0x6C, 0xFF, 0x55, 0x7D, 0xFF, 0xDA, 0x9E, 0xFF, 0x7C, 0xA7, 0xFF, 0x9C, 0xA7,
+  0xFF, 0x3B, 0xA7, 0xFF, 0x58, 0x8E, 0xFF, 0xB3, 0x74, 0xFF, 0x32, 0x6C, 0xFF,
+  0x32, 0x6C, 0xFD, 0x31, 0x6C, 0xFE, 0x81, 0x32, 0x64, 0xFF, 0x02, 0x32, 0x6C,
+  0xBF, 0xB3, 0x84, 0x02, 0x00, 0x00, 0x00, 0x03, 0xF5, 0x8C, 0x03, 0x31, 0x6C,
+  0xC5, 0x32, 0x6C, 0xFF, 0x12, 0x6C, 0xFF, 0x81, 0x32, 0x6C, 0xFF, 0x02, 0x72,
+  0x74, 0xFF, 0x39, 0xB6, 0xFF, 0x7C, 0xBF, 0xFF, 0x84, 0xFD, 0xAF, 0xFF, 0x03,
+  0xDD, 0xAF, 0xFF, 0xB6, 0x85, 0xFF, 0x32, 0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x82,
+  0x32, 0x6C, 0xFF, 0x01, 0x32, 0x74, 0x59, 0x00, 0x00, 0x00, 0x00, 0x32, 0x74,
+  0x5D, 0x82, 0x32, 0x6C, 0xFF, 0x12, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x5A,
+  0xBE, 0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xC6, 0xFF, 0x95, 0x85, 0xFF, 0x72, 0x64,
+  0xFF, 0x31, 0x64, 0xFF, 0xD3, 0x6C, 0xFF, 0x79, 0x96, 0xFF, 0xFD, 0xAF, 0xFF,
+  0xDD, 0xAF, 0xFF, 0xB6, 0x85, 0xFF, 0x12, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x31,
+  0x6C, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xE1, 0xD4, 0x94, 0x08, 0x02, 0x52,
+  0x74, 0x4F, 0x11, 0x6C, 0xF8, 0x31, 0x6C, 0xFF, 0x81, 0x32, 0x64, 0xFF, 0x06,
+  0x97, 0xA5, 0xFF, 0xDB, 0xD6, 0xFF, 0x5A, 0xC6, 0xFF, 0xD0, 0x63, 0xFF, 0x4E,
+  0x53, 0xFF, 0x8F, 0x53, 0xFF, 0xF0, 0x5B, 0xFF, 0x81, 0x6E, 0x53, 0xFF, 0x04,
+  0x54, 0x75, 0xFF, 0xFD, 0xAF, 0xFF, 0xBD, 0xA7, 0xFF, 0x52, 0x6C, 0xFF, 0x32,
+  0x64, 0xFF, 0x81, 0x31, 0x6C, 0xFF, 0x01, 0x31, 0x6C, 0xCA, 0xB3, 0x8C, 0x07,
+  0x16, 0x15, 0x9D, 0x00, 0x52, 0x74, 0x4A, 0x11, 0x6C, 0xF2, 0x32, 0x6C, 0xFF,
+  0x52, 0x6C, 0xFF, 0xBB, 0xCE, 0xFF, 0xDB, 0xD6, 0xFF, 0x31, 0x74, 0xFF, 0x4E,
+  0x53, 0xFF, 0xB5, 0x7D, 0xFF, 0xBD, 0xAF, 0xFF, 0xDD, 0xAF, 0xFF, 0x1B, 0x9F,
+  0xFF, 0x31, 0x64, 0xFF, 0x4E, 0x53, 0xFF, 0x78, 0x8E, 0xFF, 0xFD, 0xAF, 0xFF,
+  0xF6, 0x85, 0xFF, 0xB0, 0x5B, 0xFF, 0x12, 0x6C, 0xFF, 0x31, 0x6C, 0xB8, 0x72,
+  0x7C, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x55, 0xAD, 0x00, 0x32,
+  0x74, 0x62, 0x32, 0x6C, 0xFF, 0xD4, 0x84, 0xFF, 0xDB, 0xD6, 0xFF, 0x59, 0xC6,
+  0xFF, 0x4E, 0x53, 0xFF, 0xB3, 0x6C, 0xFF, 0x83, 0xFD, 0xAF, 0xFF, 0x07, 0x3B,
+  0xA7, 0xFF, 0x6E, 0x53, 0xFF, 0xB3, 0x6C, 0xFF, 0xFD, 0xAF, 0xFF, 0x1A, 0x9F,
+  0xFF, 0x4E, 0x53, 0xFF, 0xB0, 0x5B, 0xE3, 0x92, 0x7C, 0x0A, 0x81, 0x00, 0x00,
+  0x00, 0x81, 0x00, 0x00, 0x00, 0x06, 0x11, 0x74, 0x42, 0x31, 0x6C, 0xFF, 0x15,
+  0x95, 0xFF, 0xDB, 0xD6, 0xFF, 0xF8, 0xB5, 0xFF, 0x4E, 0x53, 0xFF, 0x17, 0x8E,
+  0xFF, 0x84, 0xFD, 0xAF, 0xFF, 0x05, 0x10, 0x5C, 0xFF, 0xF0, 0x63, 0xFF, 0xBA,
+  0x9E, 0xFF, 0x79, 0x9E, 0xFF, 0x6E, 0x53, 0xFF, 0x6E, 0x5B, 0xD2, 0x82, 0x00,
+  0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x06, 0x11, 0x6C, 0x42, 0x11, 0x6C, 0xFF,
+  0x15, 0x8D, 0xFF, 0xDB, 0xD6, 0xFF, 0xF8, 0xB5, 0xFF, 0x4E, 0x53, 0xFF, 0xD6,
+  0x85, 0xFF, 0x83, 0xFD, 0xAF, 0xFF, 0x06, 0xDD, 0xAF, 0xFF, 0xCF, 0x5B, 0xFF,
+  0xAF, 0x5B, 0xFF, 0x36, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0x4E, 0x53, 0xFF, 0x6E,
+  0x5B, 0xD4, 0x82, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x55, 0x95, 0x01,
+  0x32, 0x6C, 0x8D, 0x32, 0x64, 0xFF, 0xB3, 0x7C, 0xFF, 0xDB, 0xD6, 0xFF, 0x9A,
+  0xCE, 0xFF, 0x6E, 0x5B, 0xFF, 0x10, 0x5C, 0xFF, 0xBC, 0xAF, 0xFF, 0x82, 0xFD,
+  0xAF, 0xFF, 0x07, 0x58, 0x8E, 0xFF, 0x6E, 0x53, 0xFF, 0x11, 0x6C, 0xFF, 0x35,
+  0x95, 0xFF, 0xB4, 0x84, 0xFF, 0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xF4, 0x6F, 0x5B,
+  0x2A, 0x81, 0x00, 0x00, 0x00, 0x11, 0x72, 0x7C, 0x03, 0x52, 0x74, 0x92, 0x32,
+  0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x7A, 0xBE, 0xFF, 0xDB, 0xD6,
+  0xFF, 0xF4, 0x8C, 0xFF, 0x4E, 0x53, 0xFF, 0x51, 0x64, 0xFF, 0x58, 0x96, 0xFF,
+  0xD9, 0x96, 0xFF, 0xB6, 0x7D, 0xFF, 0x8F, 0x5B, 0xFF, 0x6E, 0x53, 0xFF, 0xF4,
+  0x8C, 0xFF, 0x36, 0x95, 0xFF, 0x11, 0x6C, 0xFF, 0x81, 0x4E, 0x53, 0xFF, 0x02,
+  0x4E, 0x53, 0xE7, 0x8E, 0x63, 0x3B, 0x00, 0x00, 0x00, 0x09, 0x31, 0x74, 0x73,
+  0x32, 0x64, 0xFF, 0x32, 0x6C, 0xFF, 0x32, 0x64, 0xFF, 0x12, 0x6C, 0xFF, 0x15,
+  0x8D, 0xFF, 0xDB, 0xD6, 0xFF, 0xBB, 0xCE, 0xFF, 0xB3, 0x84, 0xFF, 0x6E, 0x53,
+  0xFF, 0x82, 0x4E, 0x53, 0xFF, 0x04, 0x8F, 0x5B, 0xFF, 0xB3, 0x84, 0xFF, 0x35,
+  0x95, 0xFF, 0xF4, 0x8C, 0xFF, 0x6E, 0x53, 0xFF, 0x82, 0x4E, 0x53, 0xFF, 0x01,
+  0x4E, 0x53, 0xF3, 0x50, 0x84, 0x10, 0x01, 0x52, 0x74, 0x36, 0x32, 0x6C, 0xFC,
+  0x82, 0x32, 0x6C, 0xFF, 0x01, 0x31, 0x6C, 0xFF, 0x97, 0xA5, 0xFF, 0x81, 0xDB,
+  0xD6, 0xFF, 0x07, 0x35, 0x95, 0xFF, 0x72, 0x74, 0xFF, 0x52, 0x74, 0xFF, 0x93,
+  0x7C, 0xFF, 0x15, 0x8D, 0xFF, 0x35, 0x95, 0xFF, 0x15, 0x8D, 0xFF, 0xB0, 0x5B,
+  0xFF, 0x83, 0x4E, 0x53, 0xFF, 0x01, 0x6E, 0x5B, 0xBD, 0xF0, 0x7B, 0x02, 0x01,
+  0x14, 0x95, 0x00, 0x31, 0x6C, 0x99, 0x82, 0x32, 0x6C, 0xFF, 0x03, 0x32, 0x64,
+  0xFF, 0x32, 0x6C, 0xFF, 0x15, 0x95, 0xFF, 0x39, 0xB6, 0xFF, 0x84, 0x35, 0x95,
+  0xFF, 0x01, 0xD4, 0x84, 0xFF, 0x8F, 0x5B, 0xFF, 0x83, 0x4E, 0x53, 0xFF, 0x02,
+  0x4E, 0x53, 0xF8, 0x8E, 0x63, 0x2D, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x52, 0x74, 0x16, 0x31, 0x6C, 0xEA, 0x32, 0x6C, 0xFF, 0x32, 0x6C, 0xEF, 0x32,
+  0x6C, 0xBB, 0x31, 0x6C, 0xEB, 0x11, 0x6C, 0xFF, 0xB0, 0x5B, 0xFF, 0x11, 0x6C,
+  0xFF, 0x52, 0x74, 0xFF, 0x72, 0x74, 0xFF, 0x32, 0x74, 0xFF, 0xB0, 0x63, 0xFF,
+  0x4E, 0x53, 0xFF, 0x4E, 0x53, 0xFE, 0x4E, 0x5B, 0xC8, 0x4E, 0x53, 0xCB, 0x4E,
+  0x53, 0xFB, 0x4E, 0x53, 0xFF, 0x6E, 0x5B, 0x8B, 0xF5, 0x9C, 0x00, 0x00, 0x00,
+  0x00, 0x81, 0x00, 0x00, 0x00, 0x07, 0x31, 0x74, 0x3A, 0x31, 0x6C, 0x4A, 0x52,
+  0x7C, 0x0C, 0x00, 0x00, 0x00, 0x51, 0x7C, 0x12, 0x31, 0x6C, 0x8B, 0x11, 0x6C,
+  0xFC, 0x8F, 0x5B, 0xFF, 0x82, 0x4E, 0x53, 0xFF, 0x07, 0x4F, 0x53, 0xFF, 0x6E,
+  0x53, 0xDB, 0x6E, 0x5B, 0x4E, 0x10, 0x7C, 0x02, 0x52, 0x84, 0x01, 0x8E, 0x63,
+  0x22, 0x4E, 0x5B, 0x5E, 0x8F, 0x63, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x86, 0x00,
+  0x00, 0x00, 0x03, 0xB3, 0x84, 0x00, 0x31, 0x6C, 0xA2, 0x12, 0x64, 0xFF, 0x8F,
+  0x5B, 0xFF, 0x82, 0x4E, 0x53, 0xFF, 0x00, 0x8F, 0x63, 0x31, 0x87, 0x00, 0x00,
+  0x00, 0x87, 0x00, 0x00, 0x00, 0x06, 0x31, 0x6C, 0x64, 0x32, 0x6C, 0xFF, 0x11,
+  0x6C, 0xFF, 0x8F, 0x5B, 0xFF, 0x4E, 0x53, 0xFF, 0x6E, 0x53, 0xEC, 0xD0, 0x6B,
+  0x05, 0x87, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x00, 0x31, 0x74, 0x2D,
+  0x81, 0x31, 0x6C, 0xFF, 0x03, 0x11, 0x6C, 0xFF, 0x8F, 0x5B, 0xFF, 0x4E, 0x5B,
+  0xB6, 0x55, 0x9D, 0x00, 0x87, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x05,
+  0x92, 0x84, 0x01, 0x31, 0x74, 0x34, 0x31, 0x6C, 0x3B, 0x11, 0x6C, 0x38, 0xD0,
+  0x6B, 0x36, 0x4D, 0x5B, 0x17, 0x88, 0x00, 0x00, 0x00,
 };
 const lv_img_dsc_t ui_img_setting_icon_png = {
   .header.always_zero = 0,
-  .header.w = 118,
-  .header.h = 122,
+  .header.w = 23,
+  .header.h = 24,
   .data_size = sizeof(ui_img_setting_icon_png_data),
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = ui_img_setting_icon_png_data
 };
@@ -10,3883 +10,247 @@
 #endif
 
 // IMAGE DATA: assets\temperature_icon.png
+// Scaled to zoom 80 from 128x129 by tools/img_rle_convert.py
+// RLE encoded by tools/img_rle_convert.py, 4800 bytes raw
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_temperature_icon_png_data[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0xF7, 0xFD, 0x04,
-  0x55, 0xFE, 0x21, 0xD3, 0xFD, 0x4F, 0x0F, 0xFD, 0x7A, 0xCD, 0xFC, 0xAF, 0x4B,
-  0xFC, 0xDE, 0x0A, 0xFC, 0xF3, 0xE9, 0xFB, 0xFF, 0xA8, 0xFB, 0xFF, 0x68, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0xA9, 0xFB, 0xFF, 0xEA, 0xFB, 0xFB, 0x0C,
-  0xFC, 0xEF, 0x6D, 0xFC, 0xDF, 0xAF, 0xFC, 0xB6, 0x10, 0xFD, 0x7D, 0xB3, 0xFD,
-  0x4C, 0xD4, 0xFD, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x79, 0xFE, 0x05, 0x97, 0xFE,
-  0x17, 0xD4, 0xF5, 0x51, 0x51, 0xED, 0x9C, 0x8E, 0xDC, 0xDC, 0xEC, 0xD3, 0xFC,
-  0x8A, 0xD3, 0xFF, 0x69, 0xDB, 0xFF, 0x69, 0xEB, 0xFF, 0x89, 0xF3, 0xFF, 0x68,
-  0xF3, 0xFF, 0x67, 0xF3, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x68, 0xF3, 0xFF, 0x68,
-  0xF3, 0xFF, 0x69, 0xEB, 0xFF, 0x89, 0xEB, 0xFF, 0x8A, 0xEB, 0xFF, 0x49, 0xE3,
-  0xFF, 0x8A, 0xDB, 0xFF, 0xEC, 0xE3, 0xFD, 0x6E, 0xE4, 0xDD, 0x31, 0xE5, 0x9F,
-  0xF4, 0xED, 0x50, 0x77, 0xFE, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x38,
-  0xFE, 0x09, 0xD5, 0xFD, 0x40, 0x11, 0xFD, 0x94, 0x0C, 0xEC, 0xE2, 0x69, 0xE3,
-  0xFF, 0x68, 0xE3, 0xFF, 0x68, 0xEB, 0xFF, 0x68, 0xEB, 0xFF, 0x69, 0xF3, 0xFF,
-  0x69, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xF3, 0xFF, 0x67, 0xF3, 0xFF, 0x88, 0xFB,
-  0xFF, 0x68, 0xF3, 0xFF, 0x67, 0xF3, 0xFF, 0x68, 0xEB, 0xFF, 0x68, 0xE3, 0xFF,
-  0x89, 0xE3, 0xFF, 0xCB, 0xEB, 0xFF, 0x0C, 0xE4, 0xE3, 0x50, 0xFD, 0x94, 0xD3,
-  0xFD, 0x3C, 0xF7, 0xFD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x18, 0xFF, 0x09, 0xF5, 0xF5, 0x44, 0xF1, 0xE4, 0xA4, 0x0D,
-  0xDC, 0xF2, 0x6A, 0xDB, 0xFF, 0x29, 0xEB, 0xFF, 0x28, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x06, 0xFB, 0xFF,
-  0x07, 0xFB, 0xFF, 0x07, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x67, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xF3, 0xFF, 0x47, 0xE3, 0xFF, 0xA8,
-  0xE3, 0xFF, 0x2B, 0xE4, 0xF5, 0xF0, 0xEC, 0xA8, 0xF5, 0xFD, 0x44, 0xF7, 0xFE,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFD, 0x04, 0x35, 0xFE, 0x23,
-  0x51, 0xF5, 0x87, 0xEB, 0xDB, 0xED, 0xA9, 0xE3, 0xFF, 0x89, 0xEB, 0xFF, 0x68,
-  0xF3, 0xFF, 0x68, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x68,
-  0xF3, 0xFF, 0x68, 0xF3, 0xFF, 0x48, 0xEB, 0xFF, 0x69, 0xE3, 0xFF, 0x0B, 0xE4,
-  0xEE, 0x31, 0xF5, 0x85, 0x16, 0xFE, 0x1E, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x79, 0xFE, 0x05, 0x35, 0xFE, 0x3F, 0xAE, 0xDC, 0xBF, 0xCA, 0xDB, 0xFF,
-  0xA9, 0xEB, 0xFF, 0x88, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x67, 0xFB,
-  0xFF, 0x67, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x07, 0xFB, 0xFF, 0x07, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x07,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x68, 0xF3,
-  0xFF, 0x89, 0xE3, 0xFF, 0xCB, 0xDB, 0xFF, 0x8F, 0xDC, 0xBA, 0x15, 0xFE, 0x39,
-  0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFE, 0x05, 0xF5, 0xFD,
-  0x4C, 0x4E, 0xE4, 0xD7, 0x69, 0xDB, 0xFF, 0x68, 0xEB, 0xFF, 0x88, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x07, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x67, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xF3,
-  0xFF, 0x47, 0xF3, 0xFF, 0x68, 0xF3, 0xFF, 0x89, 0xF3, 0xFF, 0x68, 0xDB, 0xFF,
-  0x2C, 0xE4, 0xD4, 0xB3, 0xFD, 0x42, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xF7, 0xFD, 0x04, 0xF4, 0xFD, 0x45, 0x8F, 0xE4, 0xD4, 0x8A, 0xDB,
-  0xFF, 0x69, 0xE3, 0xFF, 0x89, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x06, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x67, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x67, 0xFB, 0xFF,
-  0x68, 0xEB, 0xFF, 0x89, 0xDB, 0xFF, 0x6E, 0xE4, 0xD0, 0xF5, 0xF5, 0x3E, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56,
-  0xFE, 0x2A, 0x8E, 0xEC, 0xC1, 0x89, 0xEB, 0xFF, 0x68, 0xF3, 0xFF, 0x68, 0xF3,
-  0xFF, 0x68, 0xF3, 0xFF, 0x68, 0xF3, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF,
-  0x66, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x48, 0xFB, 0xFF, 0x89, 0xF3, 0xFF, 0x69, 0xE3, 0xFF, 0xAA, 0xDB, 0xFF, 0xAF,
-  0xEC, 0xBB, 0x55, 0xFE, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xFE, 0x0D, 0xF1, 0xE4, 0x8D, 0x6A,
-  0xD3, 0xFD, 0xAA, 0xF3, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x67, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x06, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x67, 0xF3, 0xFF, 0x67,
-  0xF3, 0xFF, 0x67, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xF3, 0xFF, 0x48, 0xEB, 0xFF, 0x68,
-  0xEB, 0xFF, 0xCA, 0xE3, 0xF8, 0x10, 0xE5, 0x87, 0x39, 0xFF, 0x0A, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x01, 0x15, 0xFE, 0x3E, 0x2C, 0xE4, 0xDF, 0x69, 0xE3, 0xFF, 0x89,
-  0xFB, 0xFF, 0x07, 0xF3, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x28,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x06, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x87, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xF3, 0xFF, 0xA9, 0xE3, 0xFF, 0x2C, 0xDC, 0xDD, 0xF4, 0xFD,
-  0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFE, 0x0C,
-  0x31, 0xED, 0x92, 0x8A, 0xDB, 0xFF, 0x68, 0xF3, 0xFF, 0x68, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x67, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xF3, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xF3, 0xFF, 0x26, 0xF3, 0xFF, 0x46,
-  0xF3, 0xFF, 0x67, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x28, 0xFB, 0xFF, 0x28, 0xFB, 0xFF,
-  0x28, 0xFB, 0xFF, 0x08, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x67, 0xFB, 0xFF,
-  0x67, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xF3, 0xFF, 0xA9, 0xF3, 0xFF, 0x8A, 0xDB,
-  0xFD, 0x11, 0xED, 0x8C, 0xFB, 0xFE, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFE, 0x2B, 0x8E, 0xEC, 0xD7,
-  0x68, 0xEB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x67,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x66, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x06, 0xFB, 0xFF, 0x06, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x88, 0xFB, 0xFF,
-  0x48, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x28, 0xFB, 0xFF, 0x28, 0xFB, 0xFF,
-  0x28, 0xFB, 0xFF, 0x28, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x66, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x69, 0xF3,
-  0xFF, 0x6A, 0xE3, 0xFF, 0x4F, 0xEC, 0xD3, 0x17, 0xFE, 0x22, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xD4, 0xED, 0x52, 0xCB, 0xDB, 0xF5, 0x69, 0xEB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x25, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x67,
-  0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x66,
-  0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x47, 0xF3, 0xFF, 0x48, 0xF3,
-  0xFF, 0x89, 0xF3, 0xFF, 0xA9, 0xEB, 0xFF, 0x48, 0xDB, 0xFF,
-  0xAA, 0xEB, 0xFF, 0x68, 0xEB, 0xFF, 0x47, 0xEB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0xE5, 0xFA, 0xFF, 0x67, 0xFB, 0xFF, 0x48, 0xFB,
-  0xFF, 0x48, 0xFB, 0xFF, 0x49, 0xE3, 0xFF, 0xEC, 0xDB, 0xF0, 0xB4, 0xF5, 0x4A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xFE,
-  0x09, 0x52, 0xF5, 0x92, 0xCB, 0xDB, 0xFF, 0x88, 0xEB, 0xFF, 0x67, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xEB, 0xFF, 0x89, 0xEB, 0xFF, 0xCB, 0xE3, 0xFF, 0x6D, 0xE4,
-  0xFF, 0x92, 0xFD, 0xFF, 0x35, 0xFE, 0xEE, 0xB3, 0xF5, 0xB3,
-  0x10, 0xF5, 0xBE, 0x6E, 0xEC, 0xDE, 0xCA, 0xE3, 0xFF, 0x69, 0xEB, 0xFF, 0x68,
-  0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x06, 0xFB, 0xFF, 0x26, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x48, 0xEB, 0xFF, 0xAA, 0xDB, 0xFD,
-  0x11, 0xED, 0x89, 0xD6, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xFE, 0x11, 0xD0, 0xEC,
-  0xC0, 0x69, 0xDB, 0xFF, 0x68, 0xEB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x89,
-  0xF3, 0xFF, 0x8A, 0xDB, 0xFF, 0xF0, 0xF4, 0xFF, 0xD8, 0xFE, 0xFF, 0x9C, 0xFF,
-  0xFF, 0xBD, 0xFF, 0xFE, 0x9C, 0xFF, 0xDF, 0xD9, 0xF6, 0x62,
-  0xB7, 0xFE, 0x18, 0xF7, 0xFD, 0x04, 0x56, 0xFE, 0x17, 0xAF, 0xEC, 0xA4, 0x8A,
-  0xE3, 0xFF, 0x48, 0xEB, 0xFF, 0x48, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x67,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x88, 0xF3, 0xFF,
-  0x89, 0xE3, 0xFF, 0xB0, 0xEC, 0xB7, 0x59, 0xFE, 0x0E, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xFE, 0x19, 0x2D, 0xEC, 0xD3, 0x49, 0xE3,
-  0xFF, 0xA8, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x06, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x49, 0xF3, 0xFF, 0xAA,
-  0xD3, 0xFF, 0x55, 0xFE, 0xFF, 0xBC, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFF, 0xEE, 0x1A, 0xEF, 0x82,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93,
-  0xF5, 0x50, 0x8B, 0xDB, 0xFE, 0x69, 0xFB, 0xFF, 0xE6, 0xFA, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x49, 0xE3, 0xFF, 0x4E, 0xEC, 0xD0, 0x97, 0xFE, 0x16, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x97, 0xFE, 0x1C, 0x0D, 0xDC, 0xDE, 0xAA, 0xF3, 0xFF, 0x68, 0xFB,
-  0xFF, 0xE5, 0xF2, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xF3, 0xFF, 0x8A, 0xE3, 0xFF, 0xF4,
-  0xFD, 0xFF, 0x7B, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xF5, 0xFA, 0xE6, 0x7E,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x73, 0xFD, 0x55, 0x6A, 0xEB, 0xFF, 0x28, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0xA9, 0xEB, 0xFF, 0x2D, 0xDC, 0xDB, 0xB7,
-  0xFE, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97,
-  0xFE, 0x22, 0xED, 0xD3, 0xE2, 0x8B, 0xE3, 0xFF, 0x49, 0xF3, 0xFF, 0x07, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x49, 0xEB, 0xFF, 0xAF, 0xF4, 0xFF, 0x9B,
-  0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0x1B, 0xE7, 0x5E,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xE4, 0xA8, 0x6A, 0xEB, 0xFF, 0x48, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x28, 0xFB, 0xFF, 0x07, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x68, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xF3, 0xFF, 0x89, 0xEB, 0xFF, 0x0C,
-  0xDC, 0xDF, 0x97, 0xFE, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFE, 0x1B, 0xEC,
-  0xDB, 0xE2, 0x8A, 0xE3, 0xFF, 0x49, 0xEB, 0xFF, 0x28, 0xFB, 0xFF, 0x68, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x28, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xF3, 0xFF, 0xAA, 0xE3, 0xFF, 0x76, 0xFE, 0xFF, 0xBC,
-  0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x3B, 0xDF, 0x30,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xF5, 0x1E, 0x29, 0xC3, 0xFA, 0x49, 0xF3,
-  0xFF, 0x47, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x45, 0xFB, 0xFF, 0x45, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x89,
-  0xF3, 0xFF, 0x0C, 0xDC, 0xE0, 0x56, 0xFE, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFE, 0x18, 0x4D, 0xEC, 0xDB, 0x89,
-  0xEB, 0xFF, 0x28, 0xF3, 0xFF, 0x48, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x06, 0xFB,
-  0xFF, 0x48, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x66,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x48, 0xEB, 0xFF, 0x6D, 0xEC, 0xFF, 0x9B, 0xFF, 0xFF, 0xDD,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xD9, 0x1C, 0xE7, 0x11,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAB, 0xC4, 0xE8, 0xD2,
-  0xFF, 0x27, 0xF3, 0xFF, 0x67, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x45, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x28, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x28, 0xFB, 0xFF, 0x28, 0xFB, 0xFF, 0x28, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0x4D, 0xE4, 0xDA, 0x97, 0xFE, 0x17, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x77, 0xFE, 0x10, 0x8F, 0xEC, 0xD2, 0x48, 0xE3, 0xFF, 0x67,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x06, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x48, 0xFB, 0xFF,
-  0x48, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x07, 0xFB, 0xFF, 0x89, 0xF3, 0xFF, 0x10, 0xF5, 0xFF, 0xBC, 0xFF, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x5D, 0xEF, 0x0B,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xBC, 0x88, 0x67, 0xB2,
-  0xF3, 0xC7, 0xDA, 0xFF, 0x67, 0xF3, 0xFF, 0x67, 0xFB, 0xFF, 0x66, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x67, 0xF3, 0xFF, 0x66,
-  0xF3, 0xFF, 0x47, 0xF3, 0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x28, 0xFB,
-  0xFF, 0x48, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x28, 0xFB, 0xFF, 0x28, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x87, 0xFB, 0xFF, 0x25, 0xFB, 0xFF, 0x05,
-  0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x49, 0xE3, 0xFF, 0x6E, 0xE4, 0xD2, 0x59, 0xFE,
-  0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x38, 0xFE, 0x09, 0xD1, 0xF4, 0xBC, 0x29, 0xE3, 0xFF, 0x88, 0xFB, 0xFF, 0xE5,
-  0xF2, 0xFF, 0x67, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x28, 0xFB, 0xFF,
-  0x28, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0x72, 0xF5, 0xFF, 0xBC, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0x1C, 0xE7, 0x09,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xCC, 0x78, 0x47, 0xA2,
-  0xF9, 0x66, 0xC2, 0xFF, 0xE6, 0xDA, 0xFF, 0x47, 0xEB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x68, 0xF3, 0xFF, 0x68, 0xEB, 0xFF, 0xA9,
-  0xE3, 0xFF, 0xC9, 0xE3, 0xFF, 0xA9, 0xDB, 0xFF, 0xA9, 0xE3, 0xFF, 0x8A, 0xEB,
-  0xFF, 0x4A, 0xFB, 0xFF, 0x09, 0xFB, 0xFF, 0x28, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x25, 0xF3, 0xFF, 0x66, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x06, 0xF3, 0xFF, 0x48, 0xF3, 0xFF, 0x69, 0xEB, 0xFF, 0xAF, 0xF4,
-  0xBB, 0xD6, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x32, 0xE5, 0x91, 0x8B, 0xE3, 0xFF, 0x49, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x67,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x28, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x06, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x68, 0xE3, 0xFF, 0xB3, 0xFD, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xCC, 0x1C, 0xE7, 0x09,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xC4, 0x79, 0x88, 0xAA,
-  0xFF, 0x25, 0xB2, 0xFF, 0x65, 0xC2, 0xFF, 0x07, 0xDB, 0xFF, 0x48, 0xF3, 0xFF,
-  0x69, 0xF3, 0xFF, 0x69, 0xEB, 0xFF, 0x8A, 0xE3, 0xFF, 0x6E, 0xEC, 0xFF, 0x92,
-  0xFD, 0xFF, 0xB6, 0xFE, 0xFF, 0xF7, 0xFE, 0xFF, 0xD7, 0xFE, 0xFF, 0x35, 0xFE,
-  0xFF, 0xD0, 0xFC, 0xFF, 0x8B, 0xEB, 0xFF, 0x4A, 0xEB, 0xFF, 0x49, 0xF3, 0xFF,
-  0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xF3, 0xFF, 0x67, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x69, 0xEB,
-  0xFF, 0x31, 0xF5, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFD, 0x51,
-  0x8A, 0xDB, 0xFF, 0x89, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB3, 0xF5, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0x3C, 0xE7, 0x0A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xC4, 0x7B, 0x88, 0xA2,
-  0xFF, 0x46, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x44, 0xBA, 0xFF, 0xC7, 0xD2, 0xFF,
-  0x8B, 0xEB, 0xFF, 0xEC, 0xDB, 0xFF, 0x35, 0xFE, 0xFF, 0x9D, 0xFF, 0xFF, 0xBE,
-  0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xDD, 0xFF,
-  0xFF, 0x9C, 0xFF, 0xFF, 0x3A, 0xFF, 0xFF, 0xF1, 0xF4, 0xFF, 0x8B, 0xE3, 0xFF,
-  0x29, 0xF3, 0xFF, 0x68, 0xFB, 0xFF, 0x06, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF,
-  0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x89, 0xE3, 0xFF, 0xB3, 0xFD, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFE, 0x2B, 0xEB, 0xDB, 0xF0,
-  0x89, 0xF3, 0xFF, 0x07, 0xF3, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB3, 0xFD, 0xFF, 0xBD, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x3C, 0xE7, 0x0A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xC4, 0x7D, 0x46, 0x9A,
-  0xFF, 0xC7, 0xBA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xB2, 0xFF, 0x87, 0xBA, 0xFF,
-  0x4B, 0xC3, 0xFF, 0xF9, 0xFE, 0xFF, 0x9C, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0x3B, 0xFF, 0xFF, 0x94, 0xFD, 0xFF,
-  0x6B, 0xEB, 0xFF, 0x08, 0xF3, 0xFF, 0x68, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x87,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x66, 0xFB, 0xFF,
-  0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x28, 0xFB, 0xFF, 0x28,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x88, 0xF3, 0xFF, 0xEA, 0xDB, 0xF0, 0x96, 0xFE, 0x23, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xD8, 0xFE, 0x0D, 0x4C, 0xEC, 0xD6, 0x67, 0xEB, 0xFF,
-  0x06, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB3, 0xFD, 0xFF, 0xBD, 0xFF, 0xFF, 0xBF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x3C, 0xE7, 0x0A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC4, 0x7D, 0xC7, 0xA2,
-  0xFF, 0x65, 0xAA, 0xFF, 0x44, 0xAA, 0xFF, 0xA6, 0xAA, 0xFF, 0xA8, 0x9A, 0xFF,
-  0x58, 0xFE, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x7B, 0xFF, 0xFF,
-  0xAF, 0xEC, 0xFF, 0x6A, 0xE3, 0xFF, 0x48, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x66, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x28, 0xFB, 0xFF, 0x28,
-  0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x66, 0xFB, 0xFF, 0x67, 0xE3, 0xFF, 0x8E, 0xE4, 0xD2, 0xF7, 0xFE, 0x08,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xF4, 0x97, 0x68, 0xEB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x25, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB3, 0xF5, 0xFF, 0xBD, 0xFF, 0xFF, 0xBF,
-  0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x3C, 0xE7, 0x0A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xBC, 0x7E, 0xA7, 0x9A,
-  0xFF, 0x85, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x86, 0xA2, 0xFF, 0xD1, 0xCC, 0xFF,
-  0xDE, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xDE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF,
-  0xF8, 0xFE, 0xFF, 0x8A, 0xCB, 0xFF, 0x69, 0xEB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x28,
-  0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x45, 0xFB, 0xFF, 0x87, 0xFB, 0xFF, 0x69, 0xDB, 0xFF, 0x32, 0xF5, 0x91,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xD5, 0xF5, 0x3F, 0x8A, 0xE3, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x66, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB3, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xBF,
-  0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x3C, 0xE7, 0x0A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xBC, 0x7D, 0x86, 0x9A,
-  0xFF, 0xA5, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0xA7, 0xA2, 0xFF, 0x3A, 0xFF, 0xFF,
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x9C,
-  0xFF, 0xFF, 0xF1, 0xCC, 0xFF, 0x6B, 0xAB, 0xFF, 0xED, 0xC3, 0xFF, 0x36, 0xF6,
-  0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xBC, 0xFF, 0xFF, 0x4D, 0xCC, 0xFF, 0x08, 0xCB, 0xFF, 0x48, 0xF3, 0xFF, 0x48,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x69, 0xFB, 0xFF, 0x4A, 0xDB, 0xFD,
-  0xF5, 0xFD, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xFE,
-  0x0D, 0x2D, 0xD4, 0xE0, 0x69, 0xF3, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x25, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xD3, 0xED, 0xFF, 0xDD, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3C, 0xE7, 0x0A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC4, 0x7D, 0xC7, 0x9A,
-  0xFF, 0x65, 0xA2, 0xFF, 0x46, 0xAA, 0xFF, 0x6B, 0xBB, 0xFF, 0xDD, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xCC,
-  0xA3, 0xFF, 0x09, 0xAB, 0xFF, 0x66, 0xA2, 0xFF, 0x46, 0xA2, 0xFF, 0xE9, 0xA2,
-  0xFF, 0x99, 0xF6, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xDD, 0xFF, 0xFF, 0xD4, 0xED, 0xFF, 0x86, 0xAA, 0xFF, 0x27, 0xDB, 0xFF, 0x07,
-  0xF3, 0xFF, 0x68, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x66, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x49, 0xF3, 0xFF,
-  0x4D, 0xDC, 0xDB, 0x39, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xF5,
-  0x8E, 0x89, 0xDB, 0xFF, 0x68, 0xF3, 0xFF, 0x68, 0xFB, 0xFF, 0x07, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xD3, 0xED, 0xFF, 0xFD, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x3C, 0xE7, 0x0A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xCC, 0x7D, 0x86, 0x9A,
-  0xFF, 0x66, 0xA2, 0xFF, 0x67, 0xAA, 0xFF, 0x0F, 0xC4, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0x57, 0xF6, 0xFF, 0xC8,
-  0x92, 0xFF, 0x86, 0x9A, 0xFF, 0xA6, 0xAA, 0xFF, 0xC7, 0xAA, 0xFF, 0x47, 0x92,
-  0xFF, 0xCF, 0xB3, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDE, 0xFF, 0xFF, 0xB8, 0xFE, 0xFF, 0xC7, 0xA2, 0xFF, 0x64, 0xB2, 0xFF, 0xC6,
-  0xDA, 0xFF, 0x07, 0xF3, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x66, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x88, 0xFB, 0xFF,
-  0x89, 0xE3, 0xFF, 0x31, 0xF5, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xFE, 0x28, 0xAA, 0xDB,
-  0xFB, 0x89, 0xF3, 0xFF, 0x47, 0xF3, 0xFF, 0x47, 0xF3, 0xFF, 0x68, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xD3, 0xED, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x5D, 0xEF, 0x0B,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xCC, 0x7C, 0xA7, 0xA2,
-  0xFF, 0x86, 0xAA, 0xFF, 0x88, 0xAA, 0xFF, 0x2F, 0xC4, 0xFF, 0xDE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0x37, 0xF6, 0xFF, 0x88,
-  0x92, 0xFF, 0xC7, 0xA2, 0xFF, 0x85, 0xA2, 0xFF, 0x85, 0xA2, 0xFF, 0xC8, 0xA2,
-  0xFF, 0x8D, 0xAB, 0xFF, 0x9F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDE, 0xFF, 0xFF, 0x1A, 0xFF, 0xFF, 0xC7, 0x92, 0xFF, 0x85, 0xAA, 0xFF, 0x65,
-  0xBA, 0xFF, 0xC6, 0xDA, 0xFF, 0x28, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x66, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x27, 0xF3, 0xFF, 0xCA, 0xE3, 0xFA, 0x56, 0xFE, 0x22, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x8E, 0xE4, 0xBD, 0x89, 0xEB,
-  0xFF, 0x48, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x5D, 0xEF, 0x0B,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC4, 0x7C, 0xC8, 0xA2,
-  0xFF, 0x86, 0xA2, 0xFF, 0x66, 0xA2, 0xFF, 0xCD, 0xBB, 0xFF, 0xBD, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0xFF, 0xFF, 0xE9,
-  0x92, 0xFF, 0x87, 0x9A, 0xFF, 0xC7, 0xAA, 0xFF, 0x85, 0xA2, 0xFF, 0xA7, 0x9A,
-  0xFF, 0xF2, 0xC4, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0x78, 0xF6, 0xFF, 0xC8, 0x9A, 0xFF, 0x66, 0xA2, 0xFF, 0x86,
-  0xB2, 0xFF, 0x24, 0xBA, 0xFF, 0xC6, 0xDA, 0xFF, 0x27, 0xF3, 0xFF, 0x88, 0xFB,
-  0xFF, 0x67, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x68, 0xF3, 0xFF, 0x6D, 0xEC, 0xBE, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFD, 0x46, 0xCA, 0xE3, 0xFF, 0x68, 0xF3,
-  0xFF, 0x47, 0xFB, 0xFF, 0x28, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xFD, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xBA, 0xD6, 0x0C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xC4, 0x7B, 0x66, 0x9A,
-  0xFF, 0xA7, 0xAA, 0xFF, 0xA7, 0xA2, 0xFF, 0xE9, 0xA2, 0xFF, 0x7C, 0xFF, 0xFF,
-  0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF, 0x17,
-  0xE6, 0xFF, 0xE9, 0x92, 0xFF, 0x86, 0x92, 0xFF, 0xE8, 0x9A, 0xFF, 0xCC, 0xAB,
-  0xFF, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xBE, 0xFF, 0xFF, 0x74, 0xE5, 0xFF, 0x67, 0x92, 0xFF, 0xA7, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x86, 0xBA, 0xFF, 0x45, 0xBA, 0xFF, 0xE6, 0xDA, 0xFF, 0x48, 0xF3,
-  0xFF, 0x47, 0xF3, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x67, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xF3, 0xFF, 0xCA, 0xEB, 0xFF, 0xB4, 0xFD, 0x41, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x79, 0xFE, 0x05, 0x6E, 0xEC, 0xD1, 0x69, 0xEB, 0xFF, 0x48, 0xF3,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xFD, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xBA, 0xD6, 0x0C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xC4, 0x7B, 0xC8, 0xA2,
-  0xFF, 0x66, 0xA2, 0xFF, 0x65, 0xA2, 0xFF, 0x08, 0xA3, 0xFF, 0x95, 0xE5, 0xFF,
-  0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xBE,
-  0xFF, 0xFF, 0x7C, 0xFF, 0xFF, 0x16, 0xE6, 0xFF, 0x77, 0xEE, 0xFF, 0xDD, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF,
-  0x9D, 0xFF, 0xFF, 0x6C, 0xB3, 0xFF, 0xC8, 0xAA, 0xFF, 0x66, 0xA2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x45, 0xAA, 0xFF, 0x45, 0xB2, 0xFF, 0x65, 0xBA, 0xFF, 0xC6, 0xD2,
-  0xFF, 0x48, 0xF3, 0xFF, 0x68, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xF3, 0xFF, 0x68, 0xEB, 0xFF, 0x4E, 0xEC, 0xD2, 0xF7,
-  0xFD, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xF4, 0xF5, 0x4C, 0xAA, 0xE3, 0xFF, 0x48, 0xF3, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xFD, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0xBA, 0xD6, 0x0C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xC4, 0x7B, 0xA8, 0xA2,
-  0xFF, 0x66, 0xAA, 0xFF, 0xA6, 0xAA, 0xFF, 0x66, 0x9A, 0xFF, 0x8C, 0xAB, 0xFF,
-  0xBD, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF,
-  0xB5, 0xED, 0xFF, 0x87, 0x9A, 0xFF, 0x66, 0xA2, 0xFF, 0x86, 0xB2, 0xFF, 0x86,
-  0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xB2, 0xFF, 0x45, 0xAA, 0xFF, 0x45, 0xBA,
-  0xFF, 0xE7, 0xDA, 0xFF, 0x68, 0xF3, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xF3, 0xFF, 0x8A, 0xE3, 0xFF, 0xD5,
-  0xF5, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7,
-  0xFD, 0x04, 0x8D, 0xDC, 0xD7, 0x68, 0xEB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xFD, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0xDB, 0xDE, 0x0D,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC4, 0x7A, 0x87, 0xA2,
-  0xFF, 0x86, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0xA7, 0xAA, 0xFF, 0x88, 0x92, 0xFF,
-  0xB1, 0xCC, 0xFF, 0xBD, 0xFF, 0xFF, 0xDE, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xFA, 0xFE, 0xFF,
-  0xC8, 0x9A, 0xFF, 0x87, 0xAA, 0xFF, 0xA7, 0xB2, 0xFF, 0x45, 0xAA, 0xFF, 0x65,
-  0xAA, 0xFF, 0xA7, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x65, 0xB2,
-  0xFF, 0x45, 0xBA, 0xFF, 0xA6, 0xD2, 0xFF, 0x48, 0xF3, 0xFF, 0x68, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x66,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xF3, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x49, 0xEB, 0xFF, 0x6F,
-  0xE4, 0xD4, 0xF7, 0xFD, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
-  0xFE, 0x42, 0xA9, 0xDB, 0xFF, 0x68, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xFD, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0xDB, 0xDE, 0x0D,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC4, 0x7A, 0xA8, 0xA2,
-  0xFF, 0x45, 0xAA, 0xFF, 0x86, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0xA7, 0xA2, 0xFF,
-  0xA8, 0x9A, 0xFF, 0xB0, 0xCC, 0xFF, 0x7C, 0xFF, 0xFF, 0xDD, 0xFF, 0xFC, 0xFE,
-  0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xB8, 0xFE, 0xFF, 0x09, 0x9B, 0xFF,
-  0x87, 0xA2, 0xFF, 0xC7, 0xB2, 0xFF, 0x45, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86,
-  0xAA, 0xFF, 0x45, 0xA2, 0xFF, 0x66, 0xAA, 0xFF, 0x87, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x45, 0xAA, 0xFF, 0x65, 0xBA, 0xFF, 0xE6, 0xDA, 0xFF, 0x48, 0xF3, 0xFF,
-  0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xF3, 0xFF, 0x66, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xF3, 0xFF, 0x8A,
-  0xDB, 0xFF, 0xF5, 0xFD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xCF,
-  0xEC, 0xBE, 0x68, 0xEB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xFD, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDC, 0xDB, 0xDE, 0x0D,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xC4, 0x7B, 0xA8, 0xA2,
-  0xFF, 0x46, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x86, 0xB2, 0xFF, 0x66, 0xA2, 0xFF,
-  0x87, 0x9A, 0xFF, 0xC8, 0x9A, 0xFF, 0xAB, 0xAB, 0xFF, 0x35, 0xEE, 0xFF, 0x7B,
-  0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xBE, 0xFF,
-  0xFF, 0xFA, 0xFE, 0xFF, 0xB0, 0xCC, 0xFF, 0xC8, 0x92, 0xFF, 0xE8, 0xA2, 0xFF,
-  0x65, 0xA2, 0xFF, 0x65, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x45, 0xAA, 0xFF, 0xA7,
-  0xB2, 0xFF, 0x87, 0xB2, 0xFF, 0x87, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xB2, 0xFF, 0x65, 0xBA, 0xFF, 0xC6, 0xD2, 0xFF,
-  0x48, 0xF3, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x48,
-  0xEB, 0xFF, 0xCF, 0xF4, 0xC1, 0xF5, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xFE, 0x23, 0xAA,
-  0xDB, 0xFF, 0x67, 0xFB, 0xFF, 0x25, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xFD, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xDB, 0xDE, 0x0D,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xC4, 0x7C, 0x67, 0x9A,
-  0xFF, 0x87, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x66, 0xAA, 0xFF,
-  0x87, 0xAA, 0xFF, 0xA7, 0xA2, 0xFF, 0xA7, 0x9A, 0xFF, 0xC7, 0x92, 0xFF, 0x08,
-  0x93, 0xFF, 0xCD, 0xB3, 0xFF, 0x70, 0xC4, 0xFF, 0x2F, 0xBC, 0xFF, 0x4C, 0xA3,
-  0xFF, 0xC8, 0x9A, 0xFF, 0xA7, 0x9A, 0xFF, 0xA6, 0xA2, 0xFF, 0x85, 0xA2, 0xFF,
-  0xA6, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0xA7, 0xB2, 0xFF, 0x25,
-  0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x45, 0xAA, 0xFF, 0x65, 0xBA, 0xFF,
-  0xC6, 0xD2, 0xFF, 0x68, 0xF3, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x67, 0xFB, 0xFF,
-  0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x8A, 0xE3, 0xFF, 0x78, 0xFE, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xE5, 0x87, 0x69,
-  0xEB, 0xFF, 0x47, 0xFB, 0xFF, 0x45, 0xFB, 0xFF, 0x45, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xFD, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xDB, 0xDE, 0x0D,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xC4, 0x7C, 0x88, 0xA2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xA2, 0xFF, 0xA5, 0xA2, 0xFF, 0xA6,
-  0xA2, 0xFF, 0x87, 0xA2, 0xFF, 0x88, 0xA2, 0xFF, 0x88, 0xA2, 0xFF, 0x87, 0xA2,
-  0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF,
-  0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x65, 0xB2, 0xFF,
-  0x65, 0xBA, 0xFF, 0xE6, 0xD2, 0xFF, 0x27, 0xEB, 0xFF, 0x68, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x68, 0xF3, 0xFF, 0xF2, 0xE4, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFE, 0x05, 0x2E, 0xDC, 0xE9, 0x48,
-  0xF3, 0xFF, 0x26, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xFD, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xDB, 0xDE, 0x0D,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xC4, 0x7D, 0x88, 0xA2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x46, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x66, 0xB2,
-  0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x65, 0xB2, 0xFF, 0x65, 0xBA, 0xFF, 0xE6, 0xDA, 0xFF, 0x48, 0xF3, 0xFF, 0x27,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x48, 0xF3, 0xFF, 0x0E, 0xDC, 0xEF, 0xBA, 0xFE, 0x0C, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFD, 0x48, 0x6B, 0xDB, 0xFF, 0x48,
-  0xF3, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xFD, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xDB, 0xDE, 0x0D,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xC4, 0x7E, 0x88, 0xA2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x46, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xB2, 0xFF, 0x67, 0xB2, 0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xB2, 0xFF, 0x66, 0xB2,
-  0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF,
-  0x46, 0xB2, 0xFF, 0x67, 0xB2, 0xFF, 0x67, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x86,
-  0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x65, 0xB2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF,
-  0x86, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x65, 0xBA, 0xFF, 0xC6, 0xD2, 0xFF, 0x48,
-  0xF3, 0xFF, 0x68, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x6A, 0xDB, 0xFF, 0xF5, 0xFD, 0x49, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xB0, 0xF4, 0xA5, 0x6A, 0xEB, 0xFF, 0x68,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xFD, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xBA, 0xD6, 0x0C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xC4, 0x7E, 0xA8, 0x9A,
-  0xFF, 0x66, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x46, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xB2, 0xFF, 0x67, 0xB2, 0xFF, 0x67, 0xB2, 0xFF, 0x67, 0xAA, 0xFF, 0x66, 0xB2,
-  0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF,
-  0x46, 0xB2, 0xFF, 0x47, 0xB2, 0xFF, 0x67, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x86,
-  0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x65, 0xB2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF,
-  0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x45, 0xAA, 0xFF, 0x65, 0xBA, 0xFF, 0x07,
-  0xDB, 0xFF, 0x68, 0xF3, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xAF, 0xEC, 0xAD, 0xFF, 0xFF,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x18, 0xFF, 0x09, 0xAB, 0xE3, 0xEF, 0x69, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x06, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xFD, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x5D, 0xEF, 0x0B,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC4, 0x7D, 0xA8, 0x9A,
-  0xFF, 0x66, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xB2, 0xFF, 0x67, 0xB2, 0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x46, 0xB2, 0xFF, 0x46, 0xB2, 0xFF, 0x67, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x86,
-  0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF,
-  0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x45,
-  0xBA, 0xFF, 0xC6, 0xD2, 0xFF, 0x48, 0xF3, 0xFF, 0x68, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x28, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x68, 0xF3, 0xFF, 0xCB, 0xDB, 0xF4, 0xD8, 0xFE,
-  0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x15, 0xFE, 0x3F, 0xA9, 0xE3, 0xFF, 0x47, 0xF3, 0xFF, 0x47,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x07, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xFD, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x3C, 0xE7, 0x0A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xBC, 0x7C, 0xA8, 0x9A,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x67, 0xB2, 0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x86,
-  0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x87, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x45,
-  0xAA, 0xFF, 0x65, 0xBA, 0xFF, 0xE6, 0xDA, 0xFF, 0x48, 0xF3, 0xFF, 0x68, 0xFB,
-  0xFF, 0x28, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x67,
-  0xFB, 0xFF, 0x26, 0xF3, 0xFF, 0x47, 0xFB, 0xFF, 0x89, 0xE3, 0xFF, 0x16, 0xFE,
-  0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x11, 0xE5, 0x8B, 0xA8, 0xE3, 0xFF, 0x46, 0xF3, 0xFF, 0x47,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xFD, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDC, 0x1C, 0xE7, 0x09,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xBC, 0x7B, 0xA8, 0x9A,
-  0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x65,
-  0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2,
-  0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF,
-  0x65, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x86, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x65, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x87, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x87,
-  0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xBA, 0xFF, 0xC6, 0xD2, 0xFF, 0x48, 0xF3,
-  0xFF, 0x28, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x67,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xF1, 0xEC,
-  0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x79, 0xFE, 0x05, 0x2C, 0xDC, 0xD5, 0x87, 0xE3, 0xFF, 0x87, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x28, 0xFB, 0xFF, 0x07, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x68, 0xEB, 0xFF, 0xB3, 0xFD, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0xDB, 0xDE, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC4, 0x7A, 0xA7, 0x9A,
-  0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x67, 0xAA, 0xFF,
-  0x67, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85,
-  0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF,
-  0x65, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x86, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x65, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x87,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x45, 0xAA, 0xFF, 0x65, 0xBA, 0xFF, 0xC6, 0xD2,
-  0xFF, 0x48, 0xF3, 0xFF, 0x48, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x68, 0xEB, 0xFF, 0x2D, 0xE4,
-  0xDF, 0x9A, 0xFE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x32, 0xFE, 0x16, 0xA9, 0xE3, 0xFB, 0x88, 0xEB, 0xFF, 0x67, 0xF3, 0xFF, 0x47,
-  0xFB, 0xFF, 0x07, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x07, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x68, 0xF3, 0xFF, 0xB3, 0xFD, 0xFF, 0xDD, 0xFF, 0xFF, 0xFD,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD4, 0xF7, 0xFF, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xC4, 0x7A, 0xA7, 0x9A,
-  0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x87, 0xAA, 0xFF, 0x67, 0xAA, 0xFF,
-  0x67, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2,
-  0xFF, 0xE7, 0xD2, 0xFF, 0x47, 0xEB, 0xFF, 0x68, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x06, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xF3, 0xFF, 0x47,
-  0xFB, 0xFF, 0x07, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x69, 0xF3, 0xFF, 0xAA, 0xDB,
-  0xFF, 0x56, 0xFE, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x90, 0xFD, 0x4A, 0x88, 0xEB, 0xFF, 0x68, 0xEB, 0xFF, 0x48, 0xF3, 0xFF, 0x48,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x68, 0xF3, 0xFF, 0xB3, 0xFD, 0xFF, 0xDD, 0xFF, 0xFF, 0xFD,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xCA, 0xFF, 0xFF, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xC4, 0x7B, 0xA6, 0xA2,
-  0xFF, 0x85, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x87, 0xAA, 0xFF, 0x87, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x65, 0xB2,
-  0xFF, 0x65, 0xB2, 0xFF, 0xE6, 0xD2, 0xFF, 0x48, 0xF3, 0xFF, 0x27, 0xFB, 0xFF,
-  0x07, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x46, 0xF3, 0xFF, 0x47,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x68, 0xF3, 0xFF, 0x89, 0xE3,
-  0xFF, 0xB3, 0xFD, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xCD, 0xFC, 0x8F, 0x68, 0xEB, 0xFF, 0x68, 0xF3, 0xFF, 0x47, 0xF3, 0xFF, 0x48,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x49, 0xF3, 0xFF, 0x94, 0xFD, 0xFF, 0xBD, 0xFF, 0xFF, 0xDE,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xC1, 0xFF, 0xFF, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC4, 0x7E, 0x87, 0xA2,
-  0xFF, 0x65, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF,
-  0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2,
-  0xFF, 0x45, 0xB2, 0xFF, 0x65, 0xBA, 0xFF, 0xC6, 0xD2, 0xFF, 0x48, 0xF3, 0xFF,
-  0x68, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xF3, 0xFF, 0x69, 0xEB,
-  0xFF, 0xF0, 0xF4, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0A, 0xFC, 0xD9, 0x68, 0xEB, 0xFF, 0x68, 0xF3, 0xFF, 0x27, 0xF3, 0xFF, 0x48,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0x94, 0xFD, 0xFF, 0xBE, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0xFF, 0xFF, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xC4, 0x82, 0x87, 0xA2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2,
-  0xFF, 0x86, 0xB2, 0xFF, 0x24, 0xB2, 0xFF, 0x44, 0xBA, 0xFF, 0xE6, 0xDA, 0xFF,
-  0x48, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x69, 0xF3,
-  0xFF, 0x2D, 0xEC, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x88, 0xFB, 0xFF, 0x67, 0xF3, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0x8D, 0xF7, 0xBF, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC4, 0x88, 0x87, 0xA2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x67, 0xB2, 0xFF, 0x67, 0xB2, 0xFF, 0x67, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x44, 0xBA, 0xFF,
-  0xA6, 0xDA, 0xFF, 0x48, 0xF3, 0xFF, 0x68, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x68, 0xFB,
-  0xFF, 0xAB, 0xDB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xDE,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xF7, 0x61, 0x5B, 0xDF, 0x0D,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xC4, 0x8F, 0x87, 0xA2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x67, 0xB2, 0xFF, 0x47, 0xB2, 0xFF, 0x67, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xB2, 0xFF, 0x65, 0xAA, 0xFF, 0x44, 0xAA, 0xFF,
-  0x45, 0xC2, 0xFF, 0xC6, 0xDA, 0xFF, 0x48, 0xF3, 0xFF, 0x67, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x48, 0xFB,
-  0xFF, 0x6A, 0xDB, 0xFC, 0x79, 0xFE, 0x05, 0x00, 0x00, 0x00,
-  0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7,
-  0xFF, 0xFF, 0xF7, 0xE1, 0xFF, 0xF7, 0x40, 0xFD, 0xDE, 0x16,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x03, 0xD1, 0xC4, 0x94, 0xA7, 0x9A,
-  0xFF, 0x86, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xB2, 0xFF, 0x67, 0xB2, 0xFF,
-  0x47, 0xB2, 0xFF, 0x46, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x87, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x86, 0xB2, 0xFF,
-  0x45, 0xBA, 0xFF, 0x45, 0xC2, 0xFF, 0xC6, 0xD2, 0xFF, 0x67, 0xF3, 0xFF, 0x47,
-  0xF3, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x69, 0xE3, 0xFF, 0xF5, 0xF5, 0x24, 0x00, 0x00, 0x00,
-  0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xBF, 0xD7, 0xFF, 0xBF, 0xC7,
-  0xFF, 0xBF, 0xC7, 0xE3, 0x9F, 0xC7, 0x6B, 0xBD, 0xA6, 0x53,
-  0xBE, 0xA6, 0x40, 0xBE, 0xAE, 0x3E, 0xBD, 0xB6, 0x47, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xEE, 0x10, 0xD1, 0xC4, 0x98, 0xA7, 0x9A,
-  0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF,
-  0x46, 0xB2, 0xFF, 0x25, 0xB2, 0xFF, 0x65, 0xC2, 0xFF, 0xE6, 0xD2, 0xFF, 0x68,
-  0xF3, 0xFF, 0x67, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x89, 0xEB, 0xFF, 0x73, 0xED, 0x59, 0x00, 0x00, 0x00,
-  0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xD7, 0xFF, 0xDA, 0x6D, 0xFF, 0x1D, 0x5E,
-  0xFF, 0x1E, 0x4E, 0xFF, 0x1E, 0x46, 0xFF, 0x7B, 0x2D, 0xFF,
-  0x7B, 0x25, 0xFF, 0x7A, 0x2D, 0xFF, 0x38, 0x3D, 0xFF, 0x3F, 0x9F, 0x1F, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xEE, 0x18, 0xB1, 0xC4, 0x9A, 0xA7, 0xA2,
-  0xFF, 0x85, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF,
-  0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x45, 0xBA, 0xFF, 0xC6,
-  0xD2, 0xFF, 0x68, 0xF3, 0xFF, 0x67, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x89, 0xF3, 0xFF, 0x11, 0xED, 0xC1, 0x00, 0x00, 0x00,
-  0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x68, 0xEB, 0xFF, 0xB3, 0xF5, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x36, 0xFF, 0x7F, 0x2E, 0xFF, 0xDE, 0x0D, 0xFF,
-  0xDE, 0x05, 0xFF, 0xBD, 0x0D, 0xFF, 0x7A, 0x2D, 0xFF, 0x5F, 0x97, 0x25, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xEE, 0x1A, 0xB1, 0xC4, 0x9A, 0x87, 0xA2,
-  0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF,
-  0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x85, 0xAA, 0xFF, 0x86, 0xA2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x86,
-  0xBA, 0xFF, 0xC6, 0xD2, 0xFF, 0x47, 0xEB, 0xFF, 0x88, 0xFB, 0xFF, 0x26, 0xFB,
-  0xFF, 0x68, 0xEB, 0xFF, 0x10, 0xED, 0xE6, 0x00, 0x00, 0x00,
-  0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0x93, 0xFD, 0xFF, 0xBD, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x26, 0xFF, 0xBF, 0x0D, 0xFF,
-  0xBF, 0x05, 0xFF, 0x9E, 0x0D, 0xFF, 0x5C, 0x2D, 0xFF, 0x3F, 0x97, 0x29, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xF6, 0x19, 0xB1, 0xC4, 0x9A, 0xA7, 0xA2,
-  0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x85, 0xA2, 0xFF, 0x86, 0xA2, 0xFF,
-  0x86, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x46,
-  0xAA, 0xFF, 0x45, 0xB2, 0xFF, 0xE6, 0xD2, 0xFF, 0x68, 0xF3, 0xFF, 0x47, 0xFB,
-  0xFF, 0x48, 0xEB, 0xFF, 0xAF, 0xE4, 0xF0, 0x00, 0x00, 0x00,
-  0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xB3, 0xFD, 0xFF, 0xBD, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x26, 0xFF, 0xBF, 0x0D, 0xFF,
-  0xBF, 0x05, 0xFF, 0x9F, 0x0D, 0xFF, 0x5C, 0x35, 0xFF, 0x5F, 0x9F, 0x2C, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xF6, 0x19, 0xD1, 0xC4, 0x99, 0xA7, 0x9A,
-  0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xB2, 0xFF, 0x67, 0xB2, 0xFF, 0x67, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2,
-  0xFF, 0x46, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x85, 0xAA, 0xFF, 0xA5, 0xA2, 0xFF,
-  0x86, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x86, 0xB2, 0xFF, 0x65, 0xBA, 0xFF, 0xC6, 0xD2, 0xFF, 0x47, 0xF3,
-  0xFF, 0x89, 0xEB, 0xFF, 0x4D, 0xDC, 0xFB, 0x00, 0x00, 0x00,
-  0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x88, 0xEB, 0xFF, 0xB3, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0x1B, 0x5E, 0xFF, 0x7E, 0x3E,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x5F, 0x2E, 0xFF, 0xBF, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0x9E, 0x0D, 0xFF, 0x5B, 0x2D, 0xFF, 0x5F, 0x9F, 0x2E, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xF6, 0x19, 0xB1, 0xC4, 0x97, 0xA7, 0xA2,
-  0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF,
-  0x67, 0xB2, 0xFF, 0x47, 0xB2, 0xFF, 0x67, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2,
-  0xFF, 0x46, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF,
-  0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x67,
-  0xAA, 0xFF, 0x87, 0xB2, 0xFF, 0x45, 0xB2, 0xFF, 0x44, 0xBA, 0xFF, 0xE6, 0xDA,
-  0xFF, 0x69, 0xE3, 0xFF, 0x2D, 0xD4, 0xFF, 0x00, 0x00, 0x00,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x89, 0xE3, 0xFF, 0xB3, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0x1B, 0x5E, 0xFF, 0x7E, 0x3E,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x5F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x5A, 0x2D, 0xFF, 0x5F, 0x9F, 0x2E, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xF6, 0x18, 0xB1, 0xCC, 0x94, 0x87, 0xA2,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x67, 0xB2, 0xFF, 0x67, 0xB2, 0xFF,
-  0x67, 0xB2, 0xFF, 0x67, 0xB2, 0xFF, 0x67, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x67, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF,
-  0x85, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x67,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xB2, 0xFF, 0x45, 0xB2, 0xFF, 0x64, 0xC2,
-  0xFF, 0x08, 0xCB, 0xFF, 0xEC, 0xCB, 0xFF, 0x00, 0x00, 0x00,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xE3, 0xFF, 0xB4, 0xF5, 0xFF, 0xBE, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5E, 0x3E,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x7A, 0x2D, 0xFF, 0x5F, 0x9F, 0x2E, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xF6, 0x16, 0xB1, 0xCC, 0x91, 0x87, 0xA2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF,
-  0x65, 0xB2, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x46, 0xAA, 0xFF, 0x87, 0xB2, 0xFF, 0x86, 0xB2, 0xFF, 0x44, 0xB2,
-  0xFF, 0xA6, 0xB2, 0xFF, 0x4B, 0xB3, 0xFF, 0x00, 0x00, 0x00,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xBE, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5E, 0x3E,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0x9E, 0x0D, 0xFF, 0x7A, 0x2D, 0xFF, 0x7F, 0x97, 0x2C, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xF6, 0x14, 0xD1, 0xCC, 0x8F, 0x87, 0xA2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xB2, 0xFF,
-  0x65, 0xB2, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x67,
-  0xB2, 0xFF, 0x67, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x86, 0xB2,
-  0xFF, 0x66, 0xA2, 0xFF, 0xA8, 0x9A, 0xDE, 0x00, 0x00, 0x00,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDE, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x5B, 0x2D, 0xFF, 0x7F, 0x9F, 0x2A, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xF6, 0x12, 0xD1, 0xC4, 0x8E, 0x87, 0xA2,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x45, 0xAA,
-  0xFF, 0xA7, 0xAA, 0xFF, 0xA9, 0x92, 0xE6, 0x00, 0x00, 0x00,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x7B, 0x2D, 0xFF, 0x7F, 0x9F, 0x28, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xEE, 0x10, 0xD1, 0xBC, 0x8C, 0xA7, 0x9A,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA,
-  0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xAA,
-  0xFF, 0xA7, 0xAA, 0xFF, 0xC9, 0x92, 0xEC, 0x00, 0x00, 0x00,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x7B, 0x2D, 0xFF, 0x5F, 0x97, 0x27, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xEE, 0x0F, 0xD1, 0xC4, 0x8B, 0xA7, 0x9A,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA,
-  0xFF, 0x85, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2,
-  0xFF, 0x87, 0xAA, 0xFF, 0xC9, 0x92, 0xF1, 0x00, 0x00, 0x00,
-  0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x7B, 0x2D, 0xFF, 0x5F, 0x97, 0x27, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xEE, 0x0E, 0xD1, 0xC4, 0x8B, 0xA7, 0x9A,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x86, 0xB2,
-  0xFF, 0x87, 0xA2, 0xFF, 0xEA, 0x9A, 0xF1, 0x00, 0x00, 0x00,
-  0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x7B, 0x2D, 0xFF, 0x5F, 0x9F, 0x26, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xEE, 0x0E, 0xD1, 0xC4, 0x8B, 0xA7, 0x9A,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x86, 0xB2,
-  0xFF, 0x87, 0xA2, 0xFF, 0x4B, 0xA3, 0xE5, 0x00, 0x00, 0x00,
-  0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x7B, 0x2D, 0xFF, 0x5F, 0x9F, 0x26, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xEE, 0x0D, 0xD1, 0xC4, 0x8A, 0xA7, 0x9A,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x66, 0xB2,
-  0xFF, 0x87, 0xA2, 0xFF, 0xAD, 0xAB, 0xD3, 0x00, 0x00, 0x00,
-  0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x7B, 0x2D, 0xFF, 0x5F, 0x9F, 0x25, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xEE, 0x0C, 0xD1, 0xC4, 0x8A, 0xA7, 0x9A,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x86, 0xB2, 0xFF, 0x66, 0xAA,
-  0xFF, 0xA7, 0xA2, 0xFF, 0x0E, 0xB4, 0xC7, 0x00, 0x00, 0x00,
-  0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x7B, 0x2D, 0xFF, 0x5F, 0x9F, 0x24, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xEE, 0x0C, 0xD1, 0xC4, 0x8A, 0xA7, 0x9A,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x86, 0xB2, 0xFF, 0x45, 0xAA,
-  0xFF, 0xA8, 0xA2, 0xFF, 0x6F, 0xBC, 0x8E, 0x00, 0x00, 0x00,
-  0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x7B, 0x2D, 0xFF, 0x5F, 0x9F, 0x23, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xEE, 0x0C, 0xD1, 0xC4, 0x8A, 0xA7, 0x9A,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x86, 0xAA,
-  0xFF, 0x87, 0x9A, 0xFF, 0x33, 0xCD, 0x3C, 0x00, 0x00, 0x00,
-  0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x7B, 0x2D, 0xFF, 0x5F, 0x97, 0x22, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xEE, 0x0B, 0xD1, 0xC4, 0x8B, 0xA7, 0x9A,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA,
-  0xFF, 0xA8, 0x9A, 0xFB, 0x95, 0xDD, 0x1E, 0x00, 0x00, 0x00,
-  0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xF9, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x7B, 0x2D, 0xFF, 0x5F, 0x97, 0x22, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xEE, 0x0B, 0xD1, 0xC4, 0x8B, 0xA7, 0x9A,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x87, 0xAA,
-  0xFF, 0xA8, 0x9A, 0xF2, 0xBA, 0xD6, 0x06, 0x00, 0x00, 0x00,
-  0x88, 0xFB, 0xFF, 0x67, 0xF3, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xF4, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x7B, 0x2D, 0xFF, 0x5F, 0x9F, 0x21, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xE7, 0x0A, 0xD1, 0xC4, 0x8B, 0xA7, 0x9A,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x87, 0xA2,
-  0xFF, 0xE9, 0x9A, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0A, 0xFC, 0xDF, 0x68, 0xEB, 0xFF, 0x68, 0xF3, 0xFF, 0x27, 0xF3, 0xFF, 0x48,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDE, 0xFF, 0xF7, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x7B, 0x2D, 0xFF, 0x5F, 0x9F, 0x21, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xE7, 0x0A, 0xD1, 0xBC, 0x8C, 0xA7, 0x9A,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x87, 0xAA, 0xFF, 0x67, 0xA2,
-  0xFF, 0x6B, 0xAB, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xCD, 0xFC, 0x92, 0x68, 0xEB, 0xFF, 0x68, 0xF3, 0xFF, 0x47, 0xF3, 0xFF, 0x48,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x7B, 0x2D, 0xFF, 0x3F, 0x97, 0x20, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xE7, 0x0A, 0xD1, 0xBC, 0x8C, 0xA7, 0x9A,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x87, 0xAA, 0xFF, 0x87, 0x9A,
-  0xFF, 0x4F, 0xC4, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x90, 0xFD, 0x47, 0x88, 0xEB, 0xFF, 0x68, 0xEB, 0xFF, 0x48, 0xF3, 0xFF, 0x48,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x89, 0xEB, 0xFF, 0xB4, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x7B, 0x2D, 0xFF, 0x3F, 0x97, 0x20, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xE7, 0x0A, 0xD1, 0xC4, 0x8B, 0xA7, 0x9A,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0xA7, 0xA2,
-  0xFF, 0x74, 0xE5, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xF3, 0xFD, 0x10, 0xA9, 0xE3, 0xFF, 0x88, 0xEB, 0xFF, 0x67, 0xF3, 0xFF, 0x47,
-  0xFB, 0xFF, 0x07, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x07, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x88, 0xEB, 0xFF, 0xB3, 0xF5, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x5D, 0xFF, 0x5E, 0x46,
-  0xFF, 0x7F, 0x36, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x0D, 0xFF, 0x5B, 0x2D, 0xFF, 0x3F, 0x97, 0x20, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xE7, 0x09, 0xD1, 0xC4, 0x8A, 0x87, 0xA2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x87, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xA2, 0xFF, 0xC8, 0x9A,
-  0xFF, 0x57, 0xF6, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x01, 0x2C, 0xDC, 0xDB, 0x87, 0xE3, 0xFF, 0x87, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x28, 0xFB, 0xFF, 0x07, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x07, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x67, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x68, 0xEB, 0xFF, 0xD3, 0xFD, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xDC, 0x5D, 0xFF, 0x5E, 0x46,
-  0xFF, 0x7F, 0x36, 0xFF, 0x7F, 0x2E, 0xFF, 0xBF, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0x9D, 0x0D, 0xFF, 0x5A, 0x2D, 0xFF, 0x7F, 0x9F, 0x20, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xE7, 0x09, 0xD1, 0xC4, 0x89, 0x88, 0xA2,
-  0xFF, 0x67, 0xBA, 0xFF, 0x45, 0xAA, 0xFF, 0xA6, 0xB2, 0xFF, 0x65, 0xAA, 0xFF,
-  0xA6, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x86, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x46, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x86, 0xB2, 0xFF, 0x87, 0xA2, 0xFF, 0x6B, 0xA3,
-  0xEA, 0xB9, 0xF6, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x11, 0xE5, 0x8C, 0xA8, 0xE3, 0xFF, 0x46, 0xF3, 0xFF, 0x47,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x48, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x66, 0xFB, 0xFF, 0xA9, 0xF3, 0xFF, 0x51, 0xF5, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xDC, 0x5D, 0xFF, 0x5E, 0x46,
-  0xFF, 0x7F, 0x36, 0xFF, 0x7F, 0x26, 0xFF, 0xBF, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x15, 0xFF, 0x5A, 0x2D, 0xFF, 0x3F, 0x97, 0x20, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xDE, 0x08, 0xD1, 0xBC, 0x86, 0x67, 0xA2,
-  0xFF, 0x66, 0xBA, 0xFF, 0x86, 0xB2, 0xFF, 0x45, 0xAA, 0xFF, 0x65, 0xA2, 0xFF,
-  0x86, 0xAA, 0xFF, 0xA6, 0xB2, 0xFF, 0x45, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x46, 0xB2, 0xFF, 0x46, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xB2, 0xFF, 0x66,
-  0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x87, 0x9A, 0xFF, 0x8F, 0xBC,
-  0x99, 0x5A, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x15, 0xFE, 0x3F, 0xA9, 0xE3, 0xFF, 0x47, 0xF3, 0xFF, 0x47,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x07, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x25, 0xF3, 0xFF,
-  0x26, 0xFB, 0xFF, 0xA9, 0xF3, 0xFF, 0xD4, 0xFD, 0xFF, 0x7C, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x5D, 0xFF, 0x5E, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x26, 0xFF, 0xDE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBF, 0x0D, 0xFF, 0x7B, 0x2D, 0xFF, 0x5F, 0x97, 0x21, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xDE, 0x07, 0xD1, 0xBC, 0x83, 0xA7, 0xAA,
-  0xFF, 0x44, 0xB2, 0xFF, 0x65, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF,
-  0xA7, 0xAA, 0xFF, 0x25, 0xA2, 0xFF, 0x87, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x46, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x87, 0xAA, 0xFF, 0x67, 0x92, 0xFF, 0xD4, 0xE5,
-  0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x9A, 0xFE, 0x0B, 0xAB, 0xE3, 0xEF, 0x69, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x06, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x45, 0xF3, 0xFF, 0x86, 0xFB, 0xFF,
-  0x88, 0xFB, 0xFF, 0x28, 0xD3, 0xFF, 0xB4, 0xF5, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x26, 0xFF, 0xDE, 0x05, 0xFF,
-  0xBF, 0x05, 0xFF, 0xBF, 0x0D, 0xFF, 0x7B, 0x2D, 0xFF, 0x5F, 0x97, 0x22, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xC5, 0x82, 0x45, 0x92,
-  0xFF, 0xC6, 0xB2, 0xFF, 0x45, 0xA2, 0xFF, 0xA7, 0xB2, 0xFF, 0x86, 0xA2, 0xFF,
-  0x86, 0xAA, 0xFF, 0x87, 0xB2, 0xFF, 0x46, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0xA7, 0xAA, 0xFF, 0xC8, 0x9A, 0xFD, 0xB9, 0xF6,
-  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x79, 0xFE, 0x05, 0xB0, 0xF4, 0xA5, 0x6A, 0xEB, 0xFF, 0x68,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x87, 0xFB, 0xFF, 0x87, 0xF3, 0xFF,
-  0x89, 0xEB, 0xFF, 0x0C, 0xDC, 0xFF, 0xB9, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xD7, 0xFF, 0xDC, 0x5D, 0xFF, 0x5F, 0x46,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x26, 0xFF, 0xDE, 0x05, 0xFF,
-  0xBF, 0x05, 0xFF, 0xBF, 0x0D, 0xFF, 0x5A, 0x2D, 0xFF, 0x5F, 0x9F, 0x24, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xD5, 0x33, 0x6A, 0xA3,
-  0xE8, 0x86, 0x9A, 0xFF, 0xA7, 0xA2, 0xFF, 0x66, 0xA2, 0xFF, 0xA7, 0xAA, 0xFF,
-  0x67, 0xAA, 0xFF, 0x47, 0xB2, 0xFF, 0x47, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x87, 0xAA, 0xFF, 0x67, 0x9A, 0xFF, 0x2E, 0xBC, 0xB4, 0xDB, 0xFE,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFD, 0x48, 0x6B, 0xDB, 0xFF, 0x48,
-  0xF3, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xF3, 0xFF, 0xA9, 0xEB, 0xFF,
-  0x2C, 0xE4, 0xFF, 0x3A, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xD7, 0xFF, 0xDC, 0x65, 0xFF, 0x3F, 0x46,
-  0xFF, 0x7F, 0x36, 0xFF, 0x7F, 0x26, 0xFF, 0xDE, 0x05, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBF, 0x0D, 0xFF, 0x59, 0x2D, 0xFF, 0x5F, 0xA7, 0x26, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xF6,
-  0x11, 0x2A, 0x9B, 0xCF, 0xC7, 0x9A, 0xFF, 0xA7, 0xA2, 0xFF, 0x46, 0xA2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x67, 0xBA, 0xFF, 0x46, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x85, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x86,
-  0xAA, 0xFF, 0x86, 0xA2, 0xFF, 0x87, 0x8A, 0xFF, 0xB5, 0xE5, 0x52, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFE, 0x05, 0x2E, 0xDC, 0xE8, 0x48,
-  0xF3, 0xFF, 0x26, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x8A, 0xF3, 0xFF, 0x2D, 0xE4, 0xFF,
-  0x9B, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xDC, 0x5D, 0xFF, 0x3F, 0x4E,
-  0xFF, 0x5F, 0x36, 0xFF, 0x7F, 0x26, 0xFF, 0xDF, 0x05, 0xFF,
-  0xDF, 0x05, 0xFF, 0xBE, 0x15, 0xFF, 0x59, 0x2D, 0xFF, 0x7F, 0x9F, 0x28, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x18, 0xFF, 0x09, 0xCC, 0xA3, 0xC1, 0x86, 0x92, 0xFF, 0xC7, 0xAA, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x26, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x65, 0xB2, 0xFF, 0x85, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66,
-  0xB2, 0xFF, 0x87, 0xA2, 0xFF, 0x6A, 0x9B, 0xF5, 0xD8, 0xEE, 0x0D, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xE5, 0x84, 0x69,
-  0xEB, 0xFF, 0x47, 0xFB, 0xFF, 0x45, 0xFB, 0xFF, 0x45, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x68, 0xF3, 0xFF, 0xED, 0xEB, 0xFF, 0x5B, 0xFF, 0xFF,
-  0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0x5D, 0xFF, 0x3E, 0x4E,
-  0xFF, 0x5F, 0x3E, 0xFF, 0x7F, 0x26, 0xFF, 0xDF, 0x05, 0xFF,
-  0xBF, 0x05, 0xFF, 0xBE, 0x15, 0xFF, 0x7A, 0x2D, 0xFF, 0x7F, 0x9F, 0x2A, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x79, 0xE6, 0x0A, 0xAC, 0xAB, 0xD3, 0x66, 0x9A, 0xFF,
-  0x45, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x46, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2,
-  0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF,
-  0x46, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0xA7, 0xA2, 0xFF, 0x8F, 0xBC, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xF6, 0x20, 0xAA,
-  0xDB, 0xFF, 0x67, 0xFB, 0xFF, 0x25, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0xAA, 0xE3, 0xFF, 0xFA, 0xFE, 0xFF, 0xBE, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFE,
-  0xF7, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFC, 0x5D, 0xFF, 0x3E, 0x4E,
-  0xFF, 0x5F, 0x36, 0xFF, 0x7F, 0x26, 0xFF, 0xDF, 0x05, 0xFF,
-  0xDF, 0x05, 0xFF, 0x9D, 0x0D, 0xFF, 0x9B, 0x25, 0xFF, 0x7F, 0x8F, 0x2C, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xEE, 0x16, 0xC8, 0xA2, 0xEF,
-  0xA6, 0xAA, 0xFF, 0x45, 0xAA, 0xFF, 0x86, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2,
-  0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x46, 0xA2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x45, 0xB2, 0xFF, 0xA6, 0xB2, 0xFF, 0x85, 0xA2, 0xFF, 0xA7,
-  0xAA, 0xFF, 0x88, 0x92, 0xFF, 0x56, 0xEE, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xCF,
-  0xEC, 0xBA, 0x68, 0xEB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xF3,
-  0xFF, 0x69, 0xEB, 0xFF, 0xB3, 0xFD, 0xFF, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFE, 0xEF, 0xFF, 0xFF,
-  0xEF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xBF, 0xFF, 0x1D, 0x56, 0xFF, 0x3E, 0x46,
-  0xFF, 0x9F, 0x36, 0xFF, 0x9F, 0x2E, 0xFF, 0xBE, 0x05, 0xFF,
-  0xBF, 0x05, 0xFF, 0xDF, 0x0D, 0xFF, 0x7C, 0x15, 0xFF, 0xBF, 0x87, 0x37, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xD5, 0x5F,
-  0xA6, 0x9A, 0xFF, 0xA6, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xB2, 0xFF, 0x45, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xA2, 0xFF, 0x87,
-  0x9A, 0xFF, 0x0E, 0xBC, 0xCC, 0xF5, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
-  0xFE, 0x3E, 0xA9, 0xDB, 0xFF, 0x68, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x48, 0xEB,
-  0xFF, 0x4D, 0xE4, 0xFF, 0x5B, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-  0xE7, 0xFF, 0xBF, 0xB7, 0xFF, 0x1F, 0x7F, 0xFF, 0x1D, 0x46, 0xFF, 0x3E, 0x3E,
-  0xFF, 0x7F, 0x36, 0xFF, 0x7F, 0x26, 0xFF, 0xDE, 0x05, 0xFF,
-  0x9E, 0x05, 0xFF, 0x1F, 0x16, 0xFF, 0xBE, 0x0D, 0xFF, 0xFE, 0x35, 0xD7, 0x3F,
-  0x97, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02,
-  0x6A, 0xA3, 0xDF, 0xC7, 0xA2, 0xFF, 0x65, 0xA2, 0xFF, 0x86, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2,
-  0xFF, 0x86, 0xB2, 0xFF, 0x46, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF,
-  0x66, 0xB2, 0xFF, 0x46, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x87, 0xA2, 0xFF, 0xA8,
-  0x92, 0xFF, 0xD4, 0xDD, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7,
-  0xFD, 0x04, 0x8E, 0xDC, 0xD2, 0x68, 0xEB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x69, 0xE3,
-  0xFF, 0xF4, 0xFD, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0x9F,
-  0xB7, 0xFF, 0x5D, 0x76, 0xFF, 0xFD, 0x4D, 0xFF, 0x1E, 0x3E, 0xFF, 0x7F, 0x46,
-  0xFF, 0x7F, 0x36, 0xFF, 0x5F, 0x26, 0xFF, 0xFE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0x9F, 0x05, 0xFF, 0x9D, 0x15, 0xFF, 0x5A,
-  0x3D, 0xFF, 0xDF, 0x96, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x52, 0xC5, 0x55, 0xA6, 0x92, 0xFF, 0x85, 0xA2, 0xFF, 0x86, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x87, 0xB2, 0xFF, 0x46, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x88, 0x9A, 0xFF, 0xCC,
-  0xA3, 0xE2, 0xF5, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xF4, 0xF5, 0x47, 0xAA, 0xE3, 0xFF, 0x48, 0xF3, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xF3, 0xFF, 0x68, 0xFB, 0xFF, 0xCB, 0xE3,
-  0xFF, 0x7B, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xEF, 0xFF, 0xBF, 0xBF, 0xFF, 0x3C,
-  0x6E, 0xFF, 0xFD, 0x4D, 0xFF, 0x3F, 0x46, 0xFF, 0x5F, 0x3E, 0xFF, 0x7F, 0x36,
-  0xFF, 0x9F, 0x2E, 0xFF, 0x5F, 0x26, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0xBF, 0x0D, 0xFF, 0x9D,
-  0x1D, 0xFF, 0x39, 0x35, 0xFF, 0xDD, 0x9E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x79, 0xFE, 0x05, 0xE8, 0x92, 0xF4, 0xA6, 0xA2, 0xFF, 0x86, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x87, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x65, 0xAA, 0xFF,
-  0x65, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x47, 0xA2, 0xFF, 0xC9, 0x9A, 0xFF, 0xB5,
-  0xD5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xF5, 0xFF, 0x03, 0x6E, 0xEC, 0xCD, 0x69, 0xEB, 0xFF, 0x48, 0xF3,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x48, 0xF3, 0xFF, 0x48, 0xF3, 0xFF, 0x8E, 0xF4,
-  0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xD7, 0xFF, 0x5D, 0x7E, 0xFF, 0x1D,
-  0x4E, 0xFF, 0x5F, 0x3E, 0xFF, 0x7F, 0x3E, 0xFF, 0x7F, 0x36, 0xFF, 0x7F, 0x36,
-  0xFF, 0x9F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xBE, 0x05, 0xFF, 0x3F, 0x06, 0xFF, 0xBF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0xDF,
-  0x0D, 0xFF, 0x5C, 0x1D, 0xFF, 0x7A, 0x45, 0xFF, 0x5F, 0xAF, 0x19, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xEC, 0xB3, 0xA9, 0xA7, 0xA2, 0xFF, 0x86, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xB2, 0xFF, 0x65, 0xB2, 0xFF,
-  0x85, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x67, 0xA2, 0xFF, 0x8D, 0xAB, 0xDE, 0xF5,
-  0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFD, 0x40, 0xCA, 0xE3, 0xFF, 0x68, 0xF3,
-  0xFF, 0x47, 0xFB, 0xFF, 0x28, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x68, 0xF3, 0xFF, 0x68, 0xF3, 0xFF, 0x72, 0xFD,
-  0xFF, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x7F, 0xA7, 0xFF, 0xFD, 0x4D, 0xFF, 0x7F,
-  0x46, 0xFF, 0x7F, 0x36, 0xFF, 0x5F, 0x36, 0xFF, 0x5F, 0x2E, 0xFF, 0x9F, 0x36,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0x9F, 0x0D, 0xFF,
-  0xFF, 0x05, 0xFF, 0x9E, 0x05, 0xFF, 0x1F, 0x06, 0xFF, 0xBF, 0x05, 0xFF, 0xBF,
-  0x05, 0xFF, 0xDF, 0x0D, 0xFF, 0xBD, 0x25, 0xFF, 0x9E, 0x66, 0x92, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xF2, 0xD4, 0x65, 0xA7, 0xA2, 0xFF, 0x86, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x87, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x65, 0xB2, 0xFF,
-  0x65, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0xEA, 0xAA, 0xFF, 0x54, 0xDD, 0x4A, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xE4, 0xB4, 0x89, 0xEB,
-  0xFF, 0x48, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x68, 0xF3, 0xFF, 0x68, 0xEB, 0xFF, 0x35, 0xFE,
-  0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x5D, 0x6E, 0xFF, 0x5F, 0x46, 0xFF, 0x5F,
-  0x2E, 0xFF, 0x9F, 0x2E, 0xFF, 0x9F, 0x36, 0xFF, 0x5F, 0x2E, 0xFF, 0x9F, 0x36,
-  0xFF, 0x7F, 0x2E, 0xFF, 0x7F, 0x2E, 0xFF, 0x9E, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xFF, 0x05, 0xFF, 0xBF, 0x05, 0xFF, 0xFF, 0x05, 0xFF, 0xDF,
-  0x05, 0xFF, 0xDF, 0x05, 0xFF, 0x9E, 0x05, 0xFF, 0xDC, 0x35, 0xFF, 0xFF, 0xBE,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xB4, 0xE5, 0x34, 0x87, 0x9A, 0xFF, 0x87, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x65, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x67, 0xA2, 0xFF, 0xAD, 0xB3, 0xC0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xFE, 0x24, 0xAA, 0xDB,
-  0xFA, 0x89, 0xF3, 0xFF, 0x47, 0xF3, 0xFF, 0x47, 0xF3, 0xFF, 0x68, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x48, 0xF3, 0xFF, 0x89, 0xF3, 0xFF, 0xAA, 0xE3, 0xFF, 0x97, 0xFE,
-  0xFF, 0x9E, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xDF, 0xFF, 0x1D, 0x5E, 0xFF, 0x5F, 0x3E, 0xFF, 0x7F,
-  0x36, 0xFF, 0x9F, 0x36, 0xFF, 0x7F, 0x2E, 0xFF, 0x9F, 0x36, 0xFF, 0x7F, 0x2E,
-  0xFF, 0x9F, 0x36, 0xFF, 0x5F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDE, 0x05, 0xFF, 0xFF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0xBF, 0x05, 0xFF, 0xDF,
-  0x05, 0xFF, 0xBF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0x9C, 0x25, 0xFF, 0xDF, 0xAE,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x36, 0xEE, 0x1B, 0xC8, 0x92, 0xFF, 0x87, 0xA2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA,
-  0xFF, 0x85, 0xAA, 0xFF, 0xA6, 0xB2, 0xFF, 0x85, 0xB2, 0xFF, 0x46, 0xAA, 0xFF,
-  0x87, 0xAA, 0xFF, 0xA9, 0x9A, 0xFA, 0xF7, 0xED, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xF5,
-  0x88, 0x89, 0xDB, 0xFF, 0x68, 0xF3, 0xFF, 0x68, 0xFB, 0xFF, 0x07, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x69, 0xEB, 0xFF, 0xAA, 0xDB, 0xFF, 0xB7, 0xFE,
-  0xFF, 0xBE, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF,
-  0xFF, 0xF7, 0xFF, 0xBF, 0xCF, 0xFF, 0x1E, 0x56, 0xFF, 0x5F, 0x3E, 0xFF, 0x7F,
-  0x36, 0xFF, 0x9F, 0x36, 0xFF, 0x7F, 0x36, 0xFF, 0x7F, 0x36, 0xFF, 0x7F, 0x36,
-  0xFF, 0x9F, 0x36, 0xFF, 0x5F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDE, 0x05, 0xFF, 0xFF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0xDF,
-  0x05, 0xFF, 0xDF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0x9C, 0x1D, 0xFF, 0x9E, 0x9E,
-  0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xD6, 0xFE, 0x07, 0xC9, 0x9A, 0xFD, 0x87, 0xA2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x65, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x45, 0xAA, 0xFF, 0xC8, 0xB2, 0xFF,
-  0x67, 0x9A, 0xFF, 0x70, 0xC4, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFE,
-  0x08, 0x2D, 0xD4, 0xDB, 0x69, 0xF3, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x25, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x68, 0xEB, 0xFF, 0xAA, 0xE3, 0xFF, 0xD7, 0xFE,
-  0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF,
-  0xFF, 0xF7, 0xFF, 0x9F, 0xBF, 0xFF, 0xFD, 0x4D, 0xFF, 0x5F, 0x3E, 0xFF, 0x7F,
-  0x36, 0xFF, 0x7F, 0x36, 0xFF, 0x5F, 0x3E, 0xFF, 0x5F, 0x3E, 0xFF, 0x5F, 0x3E,
-  0xFF, 0x7F, 0x36, 0xFF, 0x5F, 0x26, 0xFF, 0xBF, 0x0D, 0xFF,
-  0xBF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0xFF, 0x05, 0xFF, 0x1F,
-  0x06, 0xFF, 0x1F, 0x06, 0xFF, 0xFF, 0x05, 0xFF, 0x9C, 0x1D, 0xFF, 0xBD, 0x96,
-  0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x79, 0xE6, 0x0A, 0xA9, 0x9A, 0xFD, 0x87, 0xA2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x86, 0xB2, 0xFF, 0x24, 0xA2, 0xFF, 0xA7, 0xAA, 0xFF, 0x87, 0x9A, 0xFF,
-  0x2A, 0xA3, 0xE1, 0xDB, 0xFE, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xF5, 0xF5, 0x3A, 0x8A, 0xE3, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x66, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x48, 0xEB, 0xFF, 0xAA, 0xE3, 0xFF, 0x96, 0xFE,
-  0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF7, 0xFF, 0xDF, 0xC7, 0xFF, 0xFC, 0x4D, 0xFF, 0x7F, 0x3E, 0xFF, 0x7F,
-  0x36, 0xFF, 0x7F, 0x36, 0xFF, 0x5F, 0x3E, 0xFF, 0x5F, 0x3E, 0xFF, 0x5F, 0x36,
-  0xFF, 0x7F, 0x36, 0xFF, 0x5F, 0x26, 0xFF, 0xBF, 0x0D, 0xFF,
-  0xDF, 0x0D, 0xFF, 0xBF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0x1F,
-  0x06, 0xFF, 0x1F, 0x06, 0xFF, 0xFF, 0x05, 0xFF, 0x9C, 0x1D, 0xFF, 0xFE, 0x9E,
-  0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xF7, 0xED, 0x23, 0x89, 0x92, 0xFF, 0x87, 0xA2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xB2, 0xFF, 0x87, 0xB2, 0xFF, 0x87, 0xA2, 0xFF, 0x87, 0x92, 0xFB,
-  0xB4, 0xE5, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xF4, 0x8E, 0x68, 0xEB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x25, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x28, 0xF3, 0xFF, 0x89, 0xEB, 0xFF, 0xF4, 0xFD,
-  0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x5C, 0x56, 0xFF, 0x9E, 0x36, 0xFF, 0x7F,
-  0x36, 0xFF, 0x7F, 0x36, 0xFF, 0x5F, 0x3E, 0xFF, 0x5F, 0x3E, 0xFF, 0x7F, 0x36,
-  0xFF, 0x9F, 0x2E, 0xFF, 0x7F, 0x26, 0xFF, 0xBF, 0x0D, 0xFF,
-  0xBF, 0x0D, 0xFF, 0xBF, 0x05, 0xFF, 0xFF, 0x05, 0xFF, 0xDE, 0x05, 0xFF, 0xFF,
-  0x05, 0xFF, 0x1F, 0x06, 0xFF, 0xDF, 0x05, 0xFF, 0x7C, 0x25, 0xFF, 0x3F, 0xB7,
-  0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x74, 0xDD, 0x42, 0x88, 0x92, 0xFF, 0x87, 0xA2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86,
-  0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2,
-  0xFF, 0x46, 0xB2, 0xFF, 0x67, 0xAA, 0xFF, 0x88, 0x92, 0xFF, 0xB0, 0xBC, 0x98,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xF7, 0xFE, 0x08, 0x6C, 0xEC, 0xD3, 0x67, 0xEB, 0xFF,
-  0x06, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xF3, 0xFF, 0x68, 0xF3, 0xFF, 0x30, 0xFD,
-  0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xBE, 0x6E, 0xFF, 0x3D, 0x36, 0xFF, 0x7F,
-  0x3E, 0xFF, 0x7F, 0x36, 0xFF, 0x5F, 0x36, 0xFF, 0x7F, 0x36, 0xFF, 0x9F, 0x2E,
-  0xFF, 0xBF, 0x2E, 0xFF, 0x5F, 0x2E, 0xFF, 0xBF, 0x0D, 0xFF,
-  0x9F, 0x05, 0xFF, 0xBF, 0x05, 0xFF, 0xFF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0xFF,
-  0x05, 0xFF, 0xDF, 0x05, 0xFF, 0x9E, 0x0D, 0xFF, 0xDC, 0x45, 0xF2, 0xFF, 0xBF,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x90, 0xC4, 0x83, 0xA8, 0xA2, 0xFF, 0x86, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xB2, 0xFF, 0x67, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86,
-  0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2,
-  0xFF, 0x27, 0xAA, 0xFF, 0x68, 0xA2, 0xFF, 0x6B, 0xA3, 0xD8, 0x5A, 0xFF, 0x0B,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xFE, 0x28, 0xEB, 0xDB, 0xF2,
-  0x89, 0xF3, 0xFF, 0x07, 0xF3, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xF3, 0xFF, 0x4C, 0xEC,
-  0xFF, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0x9F, 0xA7, 0xFF, 0x3D, 0x56, 0xFF, 0x5F,
-  0x46, 0xFF, 0x7F, 0x36, 0xFF, 0x7F, 0x36, 0xFF, 0x7F, 0x2E, 0xFF, 0x9F, 0x2E,
-  0xFF, 0x9F, 0x2E, 0xFF, 0x5F, 0x2E, 0xFF, 0xBE, 0x15, 0xFF,
-  0xBF, 0x05, 0xFF, 0xBF, 0x05, 0xFF, 0xFF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0xDF,
-  0x05, 0xFF, 0x9E, 0x0D, 0xFF, 0x7C, 0x2D, 0xFF, 0xBE, 0x7E, 0x6B, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x6B, 0xB3, 0xD3, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x46, 0xB2, 0xFF,
-  0x46, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xA2, 0xFF, 0xA6,
-  0xA2, 0xFF, 0x86, 0xA2, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x46, 0xB2,
-  0xFF, 0x88, 0xAA, 0xFF, 0xEA, 0xA2, 0xF1, 0x37, 0xEE, 0x2C, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFD, 0x4D,
-  0x8A, 0xDB, 0xFF, 0x89, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xF3, 0xFF, 0xAA, 0xE3,
-  0xFF, 0x19, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0x7E, 0xFF, 0x1D,
-  0x4E, 0xFF, 0x5F, 0x3E, 0xFF, 0x7F, 0x36, 0xFF, 0x9F, 0x2E, 0xFF, 0x7F, 0x36,
-  0xFF, 0x9F, 0x36, 0xFF, 0x5F, 0x2E, 0xFF, 0xBE, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0xBF, 0x05, 0xFF, 0xBE,
-  0x0D, 0xFF, 0x5B, 0x1D, 0xFF, 0x9B, 0x4D, 0xF8, 0x5F, 0xAF, 0x0C, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x37, 0xEE, 0x1B, 0x87, 0x9A, 0xFC, 0x65, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x46, 0xB2, 0xFF,
-  0x46, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86,
-  0xA2, 0xFF, 0x86, 0xA2, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x67, 0xAA,
-  0xFF, 0x88, 0x9A, 0xFC, 0x53, 0xDD, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x32, 0xE5, 0x8C, 0x8B, 0xE3, 0xFF, 0x49, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x67,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x28, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x69, 0xEB,
-  0xFF, 0x32, 0xFD, 0xFF, 0x5B, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0x3B,
-  0x66, 0xFF, 0x7D, 0x4E, 0xFF, 0x5F, 0x3E, 0xFF, 0x3F, 0x36, 0xFF, 0x7F, 0x3E,
-  0xFF, 0x7F, 0x36, 0xFF, 0x5F, 0x2E, 0xFF, 0xBF, 0x0D, 0xFF,
-  0xDF, 0x05, 0xFF, 0xDF, 0x05, 0xFF, 0x9F, 0x05, 0xFF, 0xBF, 0x0D, 0xFF, 0x7B,
-  0x1D, 0xFF, 0xBA, 0x45, 0xFF, 0xFD, 0x9E, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x90, 0xC4, 0x8E, 0x66, 0x9A, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x45, 0xAA, 0xFF, 0xA6, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0xA7, 0xAA, 0xFF, 0x46, 0xA2, 0xFF, 0xA8, 0xA2,
-  0xFF, 0x90, 0xC4, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xDB, 0xFE, 0x07, 0xD0, 0xF4, 0xB8, 0x29, 0xE3, 0xFF, 0x88, 0xFB, 0xFF, 0xE5,
-  0xF2, 0xFF, 0x67, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x28, 0xFB, 0xFF,
-  0x28, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xF3,
-  0xFF, 0x6A, 0xE3, 0xFF, 0xD9, 0xFE, 0xFF, 0x9C, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-  0xC7, 0xFF, 0x5B, 0x76, 0xFF, 0xFC, 0x4D, 0xFF, 0x7F, 0x4E, 0xFF, 0x3F, 0x46,
-  0xFF, 0xFF, 0x35, 0xFF, 0x5F, 0x2E, 0xFF, 0xDF, 0x0D, 0xFF,
-  0xBE, 0x05, 0xFF, 0x1F, 0x0E, 0xFF, 0x9E, 0x15, 0xFF, 0x3C, 0x25, 0xFF, 0xBB,
-  0x4D, 0xFF, 0x1E, 0x9F, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFE, 0x14,
-  0x88, 0x92, 0xF6, 0xC8, 0xAA, 0xFF, 0x65, 0xA2, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x86, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x46, 0xB2, 0xFF, 0x87,
-  0xB2, 0xFF, 0x46, 0xA2, 0xFF, 0x46, 0x9A, 0xFF, 0xC8, 0xA2, 0xFF, 0xCC, 0xB3,
-  0xB8, 0xBA, 0xFE, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x38, 0xFE, 0x0D, 0x6F, 0xEC, 0xD0, 0x48, 0xE3, 0xFF, 0x67,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x06, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x48, 0xFB, 0xFF,
-  0x48, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xFB,
-  0xFF, 0x6A, 0xF3, 0xFF, 0x6E, 0xEC, 0xFF, 0xBC, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF,
-  0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFE, 0xA6, 0xFF, 0xBA, 0x5D, 0xFF, 0x1D, 0x56,
-  0xFF, 0x5F, 0x4E, 0xFF, 0x3F, 0x36, 0xFF, 0xBD, 0x15, 0xFF,
-  0xDC, 0x15, 0xFF, 0x7A, 0x15, 0xFF, 0x7B, 0x35, 0xFF, 0x5E, 0x76, 0xB7, 0x3F,
-  0xB7, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xB3, 0xB3,
-  0x87, 0x9A, 0xFF, 0x66, 0xA2, 0xFF, 0x87, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xA2, 0xFF,
-  0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x45, 0xAA, 0xFF, 0x67, 0xBA, 0xFF, 0x26,
-  0xB2, 0xFF, 0x88, 0xB2, 0xFF, 0xC8, 0xA2, 0xFF, 0x8B, 0xA3, 0xD3, 0x77, 0xEE,
-  0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xFE, 0x15, 0x4D, 0xEC, 0xD9, 0x89,
-  0xEB, 0xFF, 0x28, 0xF3, 0xFF, 0x48, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x06, 0xFB,
-  0xFF, 0x48, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x66,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x48, 0xFB, 0xFF, 0xAB, 0xEB, 0xFF, 0xB3, 0xFD, 0xFF, 0xDC, 0xFF, 0xFF,
-  0xDD, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9F, 0xA7,
-  0xFF, 0x1F, 0x7F, 0xFF, 0xFF, 0x76, 0xFF, 0xDB, 0x4D, 0xFF,
-  0x5C, 0x56, 0xFC, 0xFD, 0x76, 0x93, 0x3F, 0x9F, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCD, 0x5D, 0x88, 0x9A, 0xFF,
-  0x87, 0xAA, 0xFF, 0xA7, 0xAA, 0xFF, 0x86, 0xA2, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0xA5, 0xA2, 0xFF,
-  0xA5, 0xA2, 0xFF, 0x65, 0xA2, 0xFF, 0x87, 0xB2, 0xFF, 0x05, 0xAA, 0xFF, 0x67,
-  0xB2, 0xFF, 0x88, 0xA2, 0xFF, 0x2B, 0xA3, 0xDC, 0x97, 0xF6, 0x17, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFE, 0x17, 0x0C,
-  0xDC, 0xE0, 0x8A, 0xE3, 0xFF, 0x49, 0xEB, 0xFF, 0x28, 0xFB, 0xFF, 0x68, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xEB, 0xFF, 0xAA, 0xE3, 0xFF, 0x35, 0xFE, 0xFF,
-  0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xE7,
-  0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0x7F, 0xCF, 0x73,
-  0x5E, 0xC7, 0x26, 0xBF, 0xD6, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x95, 0xDD, 0x39, 0xA9, 0x92, 0xF7, 0xA8, 0xAA, 0xFF,
-  0x87, 0xAA, 0xFF, 0x85, 0xA2, 0xFF, 0x85, 0xA2, 0xFF, 0x86, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xA2, 0xFF,
-  0x86, 0xA2, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x88, 0xAA, 0xFF, 0x68,
-  0xA2, 0xFF, 0x0A, 0xA3, 0xE3, 0x17, 0xEE, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97,
-  0xFE, 0x1C, 0x0D, 0xD4, 0xE0, 0x8B, 0xE3, 0xFF, 0x49, 0xF3, 0xFF, 0x07, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x88, 0xFB, 0xFF, 0xA9, 0xDB, 0xFF,
-  0xB6, 0xFE, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xF2, 0xFC, 0xE6, 0x83,
-  0xFC, 0xDE, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x54, 0xDD, 0x3F, 0xEA, 0xA2, 0xF0, 0x87, 0xA2, 0xFF, 0x67, 0xAA, 0xFF,
-  0x45, 0xAA, 0xFF, 0xA6, 0xAA, 0xFF, 0x85, 0xA2, 0xFF, 0x86, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF,
-  0x86, 0xAA, 0xFF, 0xA7, 0xAA, 0xFF, 0x46, 0x9A, 0xFF, 0xA8, 0xA2, 0xFF, 0x4B,
-  0xAB, 0xE2, 0x37, 0xEE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x97, 0xFE, 0x16, 0x2D, 0xE4, 0xDB, 0xAA, 0xF3, 0xFF, 0x68, 0xFB,
-  0xFF, 0xE5, 0xF2, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x07, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x67, 0xF3, 0xFF,
-  0x48, 0xD3, 0xFF, 0x52, 0xF5, 0xFF, 0x7C, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xDA, 0xDE, 0xA6,
-  0xDC, 0xE6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xF1, 0xDC,
-  0x71, 0xA8, 0xA2, 0xFC, 0x86, 0xA2, 0xFF, 0x66, 0xAA, 0xFF, 0x46, 0xAA, 0xFF,
-  0x67, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x67, 0xB2, 0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x87, 0xAA, 0xFF, 0x87, 0x9A, 0xFF, 0x4A, 0x9B, 0xDF, 0x77,
-  0xEE, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xFE, 0x14, 0x2D, 0xEC, 0xD0, 0x49, 0xE3,
-  0xFF, 0xA8, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x48, 0xFB, 0xFF, 0x06, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x68, 0xF3, 0xFF, 0x8A, 0xE3, 0xFF, 0xCC, 0xC3, 0xFF, 0x77, 0xFE, 0xFF, 0xDD,
-  0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xDE, 0xFF, 0xFF, 0xDD, 0xFF, 0xFD, 0x1B, 0xEF, 0xB7,
-  0xFB, 0xE6, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xE5, 0x2B, 0xCC, 0xAB, 0xD0, 0x67, 0xA2,
-  0xFF, 0x45, 0xAA, 0xFF, 0x86, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x46, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x46, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x87, 0x9A, 0xFF, 0xAB, 0xAB, 0xD3, 0x97, 0xF6, 0x17, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xFE, 0x0D, 0xD0, 0xEC,
-  0xB7, 0x69, 0xDB, 0xFF, 0x68, 0xEB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x88, 0xF3, 0xFF, 0x48, 0xD3, 0xFF, 0x08, 0xBB, 0xFF, 0xEC,
-  0xC3, 0xFF, 0xD5, 0xED, 0xFF, 0x7C, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xDE, 0xFF,
-  0xFF, 0xDE, 0xFF, 0xFF, 0x9D, 0xFF, 0xFE, 0xDA, 0xEE, 0xB9,
-  0xDB, 0xEE, 0x27, 0xDB, 0xDE, 0x07, 0xF7, 0xFD, 0x04, 0x79, 0xFE, 0x05, 0x94,
-  0xE5, 0x49, 0xCD, 0xB3, 0xC0, 0xA8, 0x9A, 0xFF, 0x87, 0xA2, 0xFF, 0x67, 0xAA,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x46, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xAA, 0xFF, 0x87, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x46, 0xAA,
-  0xFF, 0x46, 0xAA, 0xFF, 0x87, 0xBA, 0xFF, 0x46, 0xAA, 0xFF, 0x67, 0xAA, 0xFF,
-  0xA8, 0x9A, 0xFF, 0xEC, 0xAB, 0xBC, 0xD6, 0xEE, 0x0E, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFE,
-  0x08, 0x52, 0xF5, 0x8E, 0xCB, 0xDB, 0xFF, 0x88, 0xEB, 0xFF, 0x67, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x87, 0xF3, 0xFF, 0x68, 0xE3, 0xFF, 0xC6,
-  0xBA, 0xFF, 0xA7, 0xAA, 0xFF, 0xE9, 0xA2, 0xFF, 0xAD, 0xB3, 0xFF, 0xD1, 0xCC,
-  0xFF, 0x74, 0xDD, 0xFF, 0xB5, 0xDD, 0xFF, 0xB5, 0xDD, 0xD4,
-  0x74, 0xD5, 0x9C, 0xD1, 0xC4, 0xA8, 0xCD, 0xAB, 0xD2, 0xE9, 0x9A, 0xF3, 0x87,
-  0x9A, 0xFF, 0x87, 0xA2, 0xFF, 0x87, 0xAA, 0xFF, 0x87, 0xB2, 0xFF, 0x67, 0xB2,
-  0xFF, 0x47, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x45, 0xAA, 0xFF, 0x86, 0xB2, 0xFF,
-  0xA7, 0xB2, 0xFF, 0x87, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x46,
-  0xAA, 0xFF, 0x46, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0xA6, 0xB2, 0xFF, 0x86, 0xB2,
-  0xFF, 0x87, 0xB2, 0xFF, 0x46, 0xA2, 0xFF, 0x87, 0xA2, 0xFF, 0xC9, 0x9A, 0xFD,
-  0x4F, 0xBC, 0x97, 0xDB, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xD4, 0xED, 0x4E, 0xCB, 0xDB, 0xF6, 0x69, 0xEB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x25, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x67,
-  0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x66,
-  0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x68, 0xF3, 0xFF, 0x48,
-  0xEB, 0xFF, 0xC6, 0xCA, 0xFF, 0x65, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0xA7, 0xA2,
-  0xFF, 0x87, 0x9A, 0xFF, 0x87, 0x9A, 0xFF, 0xC8, 0xA2, 0xFF,
-  0x87, 0x9A, 0xFF, 0xA7, 0xA2, 0xFF, 0xA7, 0xA2, 0xFF, 0x66, 0xA2, 0xFF, 0x86,
-  0xAA, 0xFF, 0xA6, 0xB2, 0xFF, 0x86, 0xB2, 0xFF, 0x25, 0xAA, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x86, 0xB2, 0xFF, 0x65, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0xA7,
-  0xB2, 0xFF, 0x86, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x45, 0xAA, 0xFF, 0x86, 0xAA,
-  0xFF, 0x87, 0xA2, 0xFF, 0xA8, 0x9A, 0xFF, 0xC9, 0x92, 0xF3, 0x53, 0xD5, 0x5E,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFE, 0x27, 0x6E, 0xEC, 0xD5,
-  0x68, 0xEB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x67,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48,
-  0xFB, 0xFF, 0x27, 0xEB, 0xFF, 0xC6, 0xD2, 0xFF, 0x65, 0xBA, 0xFF, 0x44, 0xB2,
-  0xFF, 0x85, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x65,
-  0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x85, 0xB2, 0xFF, 0xA6, 0xB2, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x67, 0xB2, 0xFF, 0x47,
-  0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x86, 0xB2, 0xFF, 0x45, 0xAA, 0xFF,
-  0x45, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x86, 0xB2, 0xFF, 0x65, 0xAA, 0xFF, 0x65,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0xA7, 0xA2,
-  0xFF, 0x67, 0x92, 0xFF, 0x8B, 0xA3, 0xDC, 0x57, 0xEE, 0x2C, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xFF, 0x0A,
-  0x31, 0xED, 0x8F, 0x8A, 0xDB, 0xFF, 0x68, 0xF3, 0xFF, 0x68, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xF3, 0xFF, 0x47, 0xFB, 0xFF, 0x48, 0xFB, 0xFF,
-  0x48, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x28, 0xFB, 0xFF, 0x48,
-  0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x07, 0xEB, 0xFF, 0x85, 0xCA, 0xFF, 0x44, 0xBA,
-  0xFF, 0x65, 0xB2, 0xFF, 0xA6, 0xB2, 0xFF, 0x86, 0xAA, 0xFF,
-  0xA7, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85,
-  0xAA, 0xFF, 0x64, 0xAA, 0xFF, 0x64, 0xA2, 0xFF, 0x65, 0xA2, 0xFF, 0x85, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF,
-  0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xB2, 0xFF, 0x85, 0xB2, 0xFF, 0x65, 0xAA, 0xFF, 0x85,
-  0xAA, 0xFF, 0xA6, 0xB2, 0xFF, 0x46, 0xAA, 0xFF, 0x87, 0xA2, 0xFF, 0x87, 0x92,
-  0xFD, 0xB0, 0xC4, 0x9C, 0xD9, 0xEE, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x15, 0xFE, 0x3B, 0x0C, 0xE4, 0xE1, 0x69, 0xE3, 0xFF, 0x89,
-  0xFB, 0xFF, 0x07, 0xF3, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x28,
-  0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x67, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x48, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x28, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x48, 0xF3, 0xFF, 0xC6, 0xD2,
-  0xFF, 0x24, 0xB2, 0xFF, 0x24, 0xAA, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x86,
-  0xAA, 0xFF, 0xA6, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA,
-  0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF,
-  0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66,
-  0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x86, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x45, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0xA6, 0xAA, 0xFF, 0x85,
-  0xAA, 0xFF, 0x66, 0xA2, 0xFF, 0xC8, 0xA2, 0xFF, 0x2A, 0xA3, 0xE4, 0xB4, 0xED,
-  0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFE, 0x0B, 0xF1, 0xE4, 0x8A, 0x6A,
-  0xD3, 0xFF, 0xAA, 0xF3, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x06, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x68, 0xF3, 0xFF, 0x48, 0xEB,
-  0xFF, 0xC6, 0xCA, 0xFF, 0x65, 0xBA, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x87, 0xAA, 0xFF, 0x87, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA,
-  0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF,
-  0x66, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x45, 0xAA, 0xFF, 0x86, 0xB2, 0xFF,
-  0x86, 0xAA, 0xFF, 0x66, 0xA2, 0xFF, 0xA7, 0xAA, 0xFF, 0x86, 0xA2, 0xFF, 0x66,
-  0x9A, 0xFF, 0xE9, 0xA2, 0xFD, 0x70, 0xC4, 0x96, 0xD9, 0xFE, 0x0E, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
-  0xFE, 0x23, 0x8E, 0xEC, 0xB7, 0x89, 0xEB, 0xFF, 0x68, 0xF3, 0xFF, 0x68, 0xF3,
-  0xFF, 0x68, 0xF3, 0xFF, 0x68, 0xF3, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB,
-  0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x68, 0xF3,
-  0xFF, 0x48, 0xEB, 0xFF, 0xC6, 0xCA, 0xFF, 0x25, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x46, 0xAA, 0xFF, 0x46, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2,
-  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2,
-  0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x65, 0xAA, 0xFF, 0x86, 0xB2, 0xFF,
-  0x66, 0xA2, 0xFF, 0x87, 0xA2, 0xFF, 0xA8, 0x9A, 0xFF, 0xA8, 0x92, 0xFF, 0xED,
-  0xB3, 0xC9, 0x17, 0xEE, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0x01, 0xD4, 0xFD, 0x3F, 0x8E, 0xE4, 0xCF, 0x8A, 0xDB,
-  0xFF, 0x69, 0xE3, 0xFF, 0x89, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x06, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x67, 0xFB,
-  0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x25,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x67, 0xFB,
-  0xFF, 0x68, 0xFB, 0xFF, 0x27, 0xEB, 0xFF, 0xC6, 0xD2, 0xFF,
-  0x45, 0xBA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x46,
-  0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x86, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2,
-  0xFF, 0x46, 0xB2, 0xFF, 0x46, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66,
-  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xAA,
-  0xFF, 0x85, 0xAA, 0xFF, 0x85, 0xB2, 0xFF, 0x65, 0xAA, 0xFF, 0x86, 0xAA, 0xFF,
-  0x87, 0xA2, 0xFF, 0x88, 0x9A, 0xFF, 0x8D, 0xAB, 0xDF, 0x95, 0xDD, 0x51, 0xFF,
-  0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x03, 0xF5, 0xFD,
-  0x48, 0x4E, 0xE4, 0xD6, 0x69, 0xDB, 0xFF, 0x68, 0xEB, 0xFF, 0x88, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x06, 0xFB, 0xFF, 0x06, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x48, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x25, 0xFB, 0xFF, 0x46, 0xFB,
-  0xFF, 0x67, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x48, 0xEB, 0xFF,
-  0x86, 0xCA, 0xFF, 0x45, 0xBA, 0xFF, 0x24, 0xB2, 0xFF, 0x65, 0xB2, 0xFF, 0x86,
-  0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x45, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xB2,
-  0xFF, 0x86, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF,
-  0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x87, 0xB2, 0xFF, 0x87,
-  0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0xA6, 0xAA,
-  0xFF, 0xA6, 0xAA, 0xFF, 0x86, 0xA2, 0xFF, 0xA7, 0xA2, 0xFF, 0x87, 0x9A, 0xFF,
-  0x8C, 0xB3, 0xE0, 0x74, 0xE5, 0x56, 0xBA, 0xFE, 0x06, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xDB, 0xFE, 0x07, 0x15, 0xFE, 0x40, 0xAE, 0xDC, 0xBE, 0xCA, 0xDB, 0xFF,
-  0xA9, 0xEB, 0xFF, 0x88, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
-  0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46,
-  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xF3, 0xFF,
-  0x48, 0xEB, 0xFF, 0xA6, 0xCA, 0xFF, 0x44, 0xBA, 0xFF, 0x65, 0xB2, 0xFF, 0xA6,
-  0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0xC6, 0xAA, 0xFF, 0x65, 0xA2,
-  0xFF, 0x66, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x65, 0xB2, 0xFF,
-  0x86, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x45, 0xAA, 0xFF, 0x45, 0xA2, 0xFF, 0x46,
-  0xA2, 0xFF, 0x66, 0xAA, 0xFF, 0x87, 0xAA, 0xFF, 0x67, 0xAA, 0xFF, 0x67, 0xA2,
-  0xFF, 0x87, 0x9A, 0xFF, 0xC8, 0x9A, 0xFF, 0xED, 0xB3, 0xC7, 0xB4, 0xDD, 0x4C,
-  0xF7, 0xFD, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFE, 0x07, 0x15, 0xFE, 0x26,
-  0x51, 0xF5, 0x89, 0xEB, 0xDB, 0xEE, 0xA9, 0xE3, 0xFF, 0x89, 0xEB, 0xFF, 0x68,
-  0xF3, 0xFF, 0x68, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x48, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26,
-  0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x47, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x48, 0xFB, 0xFF,
-  0x89, 0xFB, 0xFF, 0x48, 0xEB, 0xFF, 0xA6, 0xCA, 0xFF, 0x44, 0xB2, 0xFF, 0x24,
-  0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x85, 0xA2, 0xFF, 0x65, 0xA2, 0xFF, 0xA6, 0xAA,
-  0xFF, 0xA6, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0x65, 0xAA, 0xFF,
-  0x66, 0xB2, 0xFF, 0x86, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0xA7, 0xB2, 0xFF, 0xA7,
-  0xAA, 0xFF, 0x87, 0xA2, 0xFF, 0x87, 0xA2, 0xFF, 0x67, 0x9A, 0xFF, 0x0A, 0xA3,
-  0xED, 0x91, 0xC4, 0x94, 0x38, 0xEE, 0x29, 0x79, 0xFE, 0x05, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xF5, 0xFF, 0x03, 0x98, 0xFE, 0x11, 0x15, 0xF6, 0x49, 0xF1, 0xE4, 0xA6, 0x0D,
-  0xDC, 0xF3, 0x6A, 0xDB, 0xFF, 0x29, 0xEB, 0xFF, 0x28, 0xFB, 0xFF, 0x48, 0xFB,
-  0xFF, 0x68, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x67,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
-  0x47, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x28, 0xEB, 0xFF, 0xA6, 0xCA, 0xFF, 0x65,
-  0xBA, 0xFF, 0x86, 0xB2, 0xFF, 0xA6, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x66, 0xA2,
-  0xFF, 0x66, 0xA2, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x87, 0xB2, 0xFF,
-  0x86, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x87, 0xAA, 0xFF, 0x87, 0xAA, 0xFF, 0x66,
-  0x9A, 0xFF, 0xC8, 0x9A, 0xFA, 0x2E, 0xBC, 0xB4, 0xD5, 0xDD, 0x56, 0xBA, 0xEE,
-  0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFE, 0x08, 0xB9,
-  0xFE, 0x13, 0xF5, 0xFD, 0x46, 0x10, 0xFD, 0x93, 0x2C, 0xEC, 0xDF, 0x89, 0xE3,
-  0xFF, 0x89, 0xE3, 0xFF, 0x89, 0xE3, 0xFF, 0x88, 0xEB, 0xFF, 0x88, 0xEB, 0xFF,
-  0x88, 0xF3, 0xFF, 0x88, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x67,
-  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x27, 0xFB,
-  0xFF, 0x27, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x06, 0xFB, 0xFF,
-  0x26, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x68, 0xFB, 0xFF, 0x48, 0xE3, 0xFF, 0xE7,
-  0xCA, 0xFF, 0x86, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xA2, 0xFF, 0xA7, 0xAA,
-  0xFF, 0x87, 0xA2, 0xFF, 0x87, 0xA2, 0xFF, 0x87, 0xA2, 0xFF, 0x87, 0x9A, 0xFF,
-  0xA8, 0x9A, 0xFF, 0xC9, 0x9A, 0xFF, 0x0A, 0xA3, 0xEA, 0x6F, 0xCC, 0x9D, 0x94,
-  0xED, 0x51, 0xD8, 0xFE, 0x15, 0xDB, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xFE, 0x06, 0xB9, 0xFE, 0x19, 0xB8, 0xFE,
-  0x2A, 0xD4, 0xF5, 0x51, 0x52, 0xED, 0x92, 0x6E, 0xE4, 0xC6, 0xEB, 0xD3, 0xE7,
-  0x89, 0xD3, 0xF4, 0x69, 0xDB, 0xFB, 0x69, 0xE3, 0xFF, 0x89, 0xEB, 0xFF, 0x69,
-  0xEB, 0xFF, 0x68, 0xF3, 0xFF, 0x68, 0xF3, 0xFF, 0x68, 0xF3, 0xFF, 0x68, 0xFB,
-  0xFF, 0x67, 0xFB, 0xFF, 0x66, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
-  0x46, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x88, 0xF3, 0xFF, 0x48,
-  0xDB, 0xFF, 0xC7, 0xBA, 0xFF, 0x87, 0xAA, 0xFA, 0xA7, 0xAA, 0xF6, 0x67, 0x9A,
-  0xED, 0xA8, 0x9A, 0xE7, 0x0A, 0xA3, 0xE2, 0x8C, 0xAB, 0xCD, 0x70, 0xB4, 0xA0,
-  0x54, 0xD5, 0x58, 0x78, 0xEE, 0x29, 0xFB, 0xFE, 0x10, 0x1C, 0xE7, 0x09, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xF4, 0xFD, 0x17, 0x72, 0xFD, 0x35, 0xF1, 0xF4, 0x9A, 0xAF,
-  0xEC, 0xDF, 0x8E, 0xEC, 0xEF, 0x2D, 0xEC, 0xFA, 0xEC, 0xE3, 0xFF, 0xAA, 0xDB,
-  0xFF, 0xAA, 0xE3, 0xFF, 0xA9, 0xE3, 0xFF, 0xA9, 0xE3, 0xFF,
-  0xA8, 0xEB, 0xFF, 0xA9, 0xE3, 0xFF, 0xEA, 0xE3, 0xFF, 0x4C, 0xEC, 0xFF, 0x8E,
-  0xE4, 0xFF, 0x8F, 0xDC, 0xE4, 0xB0, 0xDC, 0x6E, 0xD1, 0xD4, 0x26, 0xB4, 0xED,
-  0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x20, 0x07, 0x00, 0x28, 0x0C, 0x00, 0x20, 0x10, 0x00, 0x28,
-  0x11, 0x00, 0x28, 0x13, 0x00, 0x20, 0x14, 0x00, 0x20, 0x15,
-  0x00, 0x30, 0x15, 0x00, 0x20, 0x15, 0x00, 0x20, 0x15, 0x00, 0x20, 0x14, 0x60,
-  0x20, 0x14, 0x00, 0x20, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x52, 0x4C, 0x45, 0x03, 0x00, 0x00, 0x36, 0x00, 0x77, 0x00, 0xAA, 0x00, 0xE7,
+  0x00, 0x3B, 0x01, 0x83, 0x01, 0xDD, 0x01, 0x3A, 0x02, 0x9B, 0x02, 0x02, 0x03,
+  0x52, 0x03, 0xAA, 0x03, 0xFE, 0x03, 0x4F, 0x04, 0xA2, 0x04, 0xDF, 0x04, 0x21,
+  0x05, 0x63, 0x05, 0x9B, 0x05, 0xD1, 0x05, 0x05, 0x06, 0x38, 0x06, 0x72, 0x06,
+  0xB4, 0x06, 0xF4, 0x06, 0x3A, 0x07, 0x7E, 0x07, 0xCC, 0x07, 0x17, 0x08, 0x61,
+  0x08, 0xC4, 0x08, 0x20, 0x09, 0x7F, 0x09, 0xD2, 0x09, 0x24, 0x0A, 0x7E, 0x0A,
+  0xC2, 0x0A, 0x01, 0x0B, 0x41, 0x0B, 0x8B, 0x00, 0x00, 0x00, 0x0E, 0x36, 0xF6,
+  0x01, 0xB0, 0xE4, 0x14, 0xEC, 0xEB, 0x53, 0xEA, 0xEB, 0x92, 0xAA, 0xEB, 0xC0,
+  0xA9, 0xFB, 0xEC, 0x67, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x89,
+  0xFB, 0xF7, 0xAA, 0xF3, 0xCF, 0xCA, 0xEB, 0xA6, 0xEB, 0xEB, 0x6B, 0xAD, 0xF4,
+  0x26, 0x52, 0xF5, 0x05, 0x8C, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x04,
+  0x73, 0xF5, 0x06, 0x2C, 0xE4, 0x47, 0xCA, 0xEB, 0xAB, 0x88, 0xF3, 0xF2, 0x47,
+  0xFB, 0xFF, 0x81, 0x27, 0xFB, 0xFF, 0x81, 0x47, 0xFB, 0xFF, 0x02, 0x26, 0xFB,
+  0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x81, 0x47, 0xFB, 0xFF, 0x05, 0x27,
+  0xFB, 0xFF, 0x68, 0xF3, 0xFD, 0xA9, 0xF3, 0xCB, 0x0C, 0xE4, 0x6B, 0x6D, 0xEC,
+  0x13, 0xFF, 0xFF, 0x00, 0x89, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x03,
+  0xD8, 0xFE, 0x01, 0x2D, 0xE4, 0x42, 0xA9, 0xF3, 0xC4, 0x68, 0xF3, 0xFD, 0x83,
+  0x47, 0xFB, 0xFF, 0x82, 0x46, 0xFB, 0xFF, 0x83, 0x47, 0xFB, 0xFF, 0x81, 0x46,
+  0xFB, 0xFF, 0x82, 0x47, 0xFB, 0xFF, 0x02, 0x89, 0xEB, 0xE4, 0xEB, 0xE3, 0x72,
+  0x31, 0xE5, 0x09, 0x88, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x04, 0x10,
+  0xF5, 0x10, 0xCA, 0xEB, 0x99, 0x48, 0xF3, 0xF9, 0x27, 0xFB, 0xFF, 0x26, 0xFB,
+  0xFF, 0x85, 0x47, 0xFB, 0xFF, 0x00, 0x27, 0xFB, 0xFF, 0x81, 0x47, 0xFB, 0xFF,
+  0x01, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x81, 0x27, 0xFB, 0xFF, 0x83, 0x46,
+  0xFB, 0xFF, 0x02, 0x47, 0xFB, 0xFF, 0xA9, 0xEB, 0xCC, 0x4E, 0xEC, 0x33, 0x87,
+  0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x03, 0x77, 0xFE, 0x00, 0x6E, 0xEC,
+  0x2C, 0xA9, 0xEB, 0xD2, 0x46, 0xFB, 0xFF, 0x84, 0x47, 0xFB, 0xFF, 0x0B, 0x46,
+  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xF3, 0xFF, 0x6D, 0xF4,
+  0xFF, 0x72, 0xF5, 0xE2, 0xEB, 0xEB, 0xA5, 0x68, 0xF3, 0xF3, 0x26, 0xFB, 0xFF,
+  0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x81, 0x47, 0xFB, 0xFF,
+  0x00, 0x46, 0xFB, 0xFF, 0x81, 0x47, 0xFB, 0xFF, 0x02, 0x68, 0xF3, 0xF3, 0x0C,
+  0xEC, 0x65, 0x33, 0xF5, 0x02, 0x85, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x04, 0x2D, 0xDC, 0x39, 0x89, 0xF3, 0xE9, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
+  0x27, 0xFB, 0xFF, 0x86, 0x47, 0xFB, 0xFF, 0x06, 0x31, 0xF5, 0xFF, 0xDE, 0xFF,
+  0xFF, 0xDE, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x0D, 0xEC, 0x3E, 0x48, 0xF3, 0xF5,
+  0x46, 0xFB, 0xFF, 0x82, 0x47, 0xFB, 0xFF, 0x82, 0x46, 0xFB, 0xFF, 0x81, 0x47,
+  0xFB, 0xFF, 0x02, 0x47, 0xF3, 0xFD, 0xEB, 0xEB, 0x80, 0x31, 0xED, 0x03, 0x84,
+  0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x02, 0x6E, 0xEC, 0x31, 0x68, 0xF3,
+  0xEB, 0x27, 0xFB, 0xFF, 0x81, 0x47, 0xFB, 0xFF, 0x00, 0x46, 0xFB, 0xFF, 0x85,
+  0x47, 0xFB, 0xFF, 0x0C, 0x68, 0xF3, 0xFF, 0x3A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xDF, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0xD5, 0xF5, 0x01, 0x09, 0xCB, 0xB6, 0x46,
+  0xF3, 0xFF, 0x47, 0xFB, 0xFF, 0x67, 0xF3, 0xFF, 0x48, 0xFB, 0xFF, 0x47, 0xFB,
+  0xFF, 0x46, 0xFB, 0xFF, 0x81, 0x47, 0xFB, 0xFF, 0x04, 0x27, 0xFB, 0xFF, 0x47,
+  0xFB, 0xFF, 0x47, 0xFB, 0xFD, 0xEB, 0xEB, 0x7E, 0xD6, 0xFE, 0x00, 0x83, 0x00,
+  0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x06, 0xAE, 0xEC, 0x18, 0x8A, 0xF3, 0xDD,
+  0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46,
+  0xFB, 0xFF, 0x85, 0x47, 0xFB, 0xFF, 0x03, 0xA9, 0xF3, 0xFF, 0x7C, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA3, 0x81, 0x00, 0x00, 0x00, 0x08, 0xE9, 0xB2,
+  0xA6, 0xA6, 0xCA, 0xFF, 0x4D, 0xEC, 0xFF, 0x98, 0xF6, 0xFF, 0xD8, 0xFE, 0xFF,
+  0x32, 0xF5, 0xFF, 0x68, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x81,
+  0x46, 0xFB, 0xFF, 0x02, 0x47, 0xFB, 0xFF, 0x47, 0xFB, 0xFC, 0x2C, 0xEC, 0x57,
+  0x83, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x06, 0xB4, 0xF5, 0x04, 0xA9,
+  0xF3, 0xB3, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x26, 0xFB,
+  0xFF, 0x46, 0xFB, 0xFF, 0x86, 0x47, 0xFB, 0xFF, 0x03, 0xA9, 0xF3, 0xFF, 0x5C,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA3, 0x81, 0x00, 0x00, 0x00, 0x0E,
+  0x29, 0xAB, 0xA7, 0x08, 0xB3, 0xFF, 0x7C, 0xF7, 0xFF, 0x7D, 0xF7, 0xFF, 0xFA,
+  0xEE, 0xFF, 0xDE, 0xFF, 0xFF, 0xF0, 0xEC, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
+  0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
+  0x88, 0xF3, 0xEE, 0x4E, 0xEC, 0x26, 0x82, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x0C, 0xE4, 0x64, 0x48, 0xF3, 0xFE, 0x81, 0x46, 0xFB,
+  0xFF, 0x03, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB,
+  0xFF, 0x85, 0x47, 0xFB, 0xFF, 0x03, 0xA9, 0xF3, 0xFF, 0x7C, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0x81, 0x00, 0x00, 0x00, 0x0A, 0x09, 0xAB, 0xA6,
+  0x2F, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0xBC, 0xFF, 0xC8, 0xAA, 0xFF, 0x3C,
+  0xF7, 0xFF, 0x36, 0xE6, 0xFF, 0xC6, 0xD2, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB,
+  0xFF, 0x27, 0xFB, 0xFF, 0x81, 0x47, 0xFB, 0xFF, 0x02, 0x27, 0xFB, 0xFF, 0xAA,
+  0xEB, 0xBC, 0x31, 0xF5, 0x05, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xCF, 0xEC, 0x14, 0x89, 0xF3, 0xE2, 0x8C, 0x47, 0xFB, 0xFF, 0x03, 0xA9, 0xF3,
+  0xFF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0x81, 0x00, 0x00,
+  0x00, 0x08, 0x09, 0xAB, 0xA6, 0xAB, 0xB3, 0xFF, 0xBE, 0xFF, 0xFF, 0x17, 0xDE,
+  0xFF, 0x32, 0xCD, 0xFF, 0xBE, 0xFF, 0xFF, 0x74, 0xD5, 0xFF, 0x66, 0xAA, 0xFF,
+  0xC6, 0xD2, 0xFF, 0x82, 0x47, 0xFB, 0xFF, 0x03, 0x46, 0xFB, 0xFF, 0x47, 0xFB,
+  0xFF, 0x47, 0xFB, 0xFD, 0x0C, 0xEC, 0x57, 0x81, 0x00, 0x00, 0x00, 0x02, 0xFF,
+  0xFF, 0x00, 0x0B, 0xEC, 0x76, 0x47, 0xFB, 0xFF, 0x81, 0x46, 0xFB, 0xFF, 0x8A,
+  0x47, 0xFB, 0xFF, 0x03, 0xA9, 0xF3, 0xFF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xA8, 0x81, 0x00, 0x00, 0x00, 0x06, 0x09, 0xAB, 0xA6, 0x86, 0xAA,
+  0xFF, 0x53, 0xD5, 0xFF, 0xBE, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x99, 0xEE, 0xFF,
+  0x09, 0xB3, 0xFF, 0x81, 0x66, 0xAA, 0xFF, 0x02, 0xC6, 0xD2, 0xFF, 0x47, 0xFB,
+  0xFF, 0x46, 0xFB, 0xFF, 0x81, 0x47, 0xFB, 0xFF, 0x03, 0x46, 0xFB, 0xFF, 0x8A,
+  0xEB, 0xCE, 0x51, 0xF5, 0x08, 0x00, 0x00, 0x00, 0x02, 0xD1, 0xE4, 0x08, 0x89,
+  0xF3, 0xDB, 0x46, 0xFB, 0xFF, 0x8C, 0x47, 0xFB, 0xFF, 0x03, 0xA9, 0xF3, 0xFF,
+  0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA9, 0x81, 0x00, 0x00, 0x00,
+  0x06, 0x0A, 0xAB, 0xA6, 0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x29, 0xAB, 0xFF,
+  0x6B, 0xB3, 0xFF, 0xA6, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x81, 0x66, 0xB2, 0xFF,
+  0x03, 0x66, 0xAA, 0xFF, 0xC6, 0xD2, 0xFF, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
+  0x81, 0x47, 0xFB, 0xFF, 0x02, 0x47, 0xFB, 0xFE, 0x2D, 0xE4, 0x47, 0x00, 0x00,
+  0x00, 0x01, 0x2D, 0xEC, 0x44, 0x48, 0xF3, 0xFF, 0x8D, 0x47, 0xFB, 0xFF, 0x03,
+  0xA9, 0xF3, 0xFF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA9, 0x81,
+  0x00, 0x00, 0x00, 0x01, 0x0A, 0xAB, 0xA7, 0x65, 0xB2, 0xFF, 0x81, 0x66, 0xB2,
+  0xFF, 0x09, 0x66, 0xAA, 0xFF, 0x65, 0xB2, 0xFF, 0x66, 0xB2, 0xFF, 0x86, 0xAA,
+  0xFF, 0x85, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0xC6, 0xD2, 0xFF,
+  0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x81, 0x47, 0xFB, 0xFF, 0x01, 0xCA, 0xEB,
+  0xA5, 0x98, 0xFE, 0x00, 0x00, 0xEA, 0xE3, 0x91, 0x82, 0x47, 0xFB, 0xFF, 0x00,
+  0x26, 0xFB, 0xFF, 0x8A, 0x47, 0xFB, 0xFF, 0x03, 0xA9, 0xF3, 0xFF, 0x7C, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0x81, 0x00, 0x00, 0x00, 0x00, 0x29,
+  0xAB, 0xA6, 0x82, 0x66, 0xAA, 0xFF, 0x02, 0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF,
+  0x66, 0xB2, 0xFF, 0x81, 0x66, 0xAA, 0xFF, 0x08, 0x85, 0xAA, 0xFF, 0x66, 0xB2,
+  0xFF, 0x66, 0xAA, 0xFF, 0xC6, 0xCA, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF,
+  0x47, 0xFB, 0xFF, 0x89, 0xF3, 0xE7, 0xD0, 0xEC, 0x0C, 0x03, 0xA9, 0xF3, 0xD2,
+  0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x8B, 0x47, 0xFB, 0xFF,
+  0x03, 0x89, 0xFB, 0xFF, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E,
+  0x81, 0x00, 0x00, 0x00, 0x01, 0x09, 0xAB, 0xA7, 0x86, 0xAA, 0xFF, 0x8A, 0x66,
+  0xAA, 0xFF, 0x04, 0xC6, 0xCA, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x48,
+  0xF3, 0xFF, 0x8E, 0xEC, 0x35, 0x01, 0x67, 0xFB, 0xFE, 0x47, 0xFB, 0xFF, 0x81,
+  0x46, 0xFB, 0xFF, 0x00, 0x27, 0xFB, 0xFF, 0x89, 0x47, 0xFB, 0xFF, 0x08, 0x46,
+  0xFB, 0xFF, 0xA9, 0xF3, 0xFF, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x82, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x00, 0x29, 0xAB, 0xAC, 0x67, 0xB2, 0xFF,
+  0x8A, 0x66, 0xAA, 0xFF, 0x01, 0x66, 0xB2, 0xFF, 0xA6, 0xD2, 0xFF, 0x81, 0x47,
+  0xFB, 0xFF, 0x00, 0xAA, 0xE3, 0x5F, 0x81, 0x26, 0xFB, 0xFF, 0x02, 0x46, 0xFB,
+  0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x89, 0x47, 0xFB, 0xFF, 0x09, 0x46,
+  0xFB, 0xFF, 0x89, 0xF3, 0xFF, 0x7C, 0xFF, 0xFF, 0x3E, 0xAF, 0xFF, 0x7E, 0x56,
+  0xD6, 0xBB, 0x35, 0xAC, 0x3D, 0xB7, 0x08, 0x4A, 0xAB, 0xB3, 0x86, 0xAA, 0xFF,
+  0x85, 0xAA, 0xFF, 0x8A, 0x66, 0xAA, 0xFF, 0x03, 0x66, 0xB2, 0xFF, 0xC6, 0xCA,
+  0xFF, 0x47, 0xFB, 0xFF, 0x0B, 0xEC, 0x93, 0x01, 0x26, 0xFB, 0xFF, 0x46, 0xFB,
+  0xFF, 0x8D, 0x47, 0xFB, 0xFF, 0x08, 0x89, 0xF3, 0xFF, 0x7C, 0xFF, 0xFF, 0xFE,
+  0x8E, 0xFF, 0x3F, 0x26, 0xFF, 0x9E, 0x15, 0xF2, 0x3E, 0xAF, 0x0E, 0x4A, 0xAB,
+  0xB4, 0x86, 0xAA, 0xFF, 0x67, 0xB2, 0xFF, 0x8A, 0x66, 0xAA, 0xFF, 0x03, 0x86,
+  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0xC6, 0xCA, 0xFF, 0xCB, 0xE3, 0xAE, 0x82, 0x47,
+  0xFB, 0xFF, 0x00, 0x27, 0xFB, 0xFF, 0x8B, 0x47, 0xFB, 0xFF, 0x07, 0xA9, 0xF3,
+  0xFF, 0x7D, 0xFF, 0xFF, 0xFE, 0x8E, 0xFF, 0x3F, 0x26, 0xFF, 0xBD, 0x15, 0xF2,
+  0x5E, 0xAF, 0x0E, 0x2A, 0xB3, 0xB1, 0x66, 0xB2, 0xFF, 0x8B, 0x66, 0xAA, 0xFF,
+  0x03, 0x65, 0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0xE8, 0xB2, 0xAB,
+  0x8F, 0x47, 0xFB, 0xFF, 0x08, 0xA9, 0xF3, 0xFF, 0x7C, 0xFF, 0xFF, 0xFE, 0x8E,
+  0xFF, 0x3F, 0x26, 0xFF, 0xBD, 0x15, 0xF2, 0x5E, 0xA7, 0x0C, 0x2A, 0xAB, 0xAE,
+  0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x89, 0x66, 0xAA, 0xFF, 0x04, 0x86, 0xAA,
+  0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x65, 0xAA, 0xFF, 0xA8, 0xA2, 0xAA,
+  0x00, 0x26, 0xFB, 0xFF, 0x81, 0x46, 0xFB, 0xFF, 0x8C, 0x47, 0xFB, 0xFF, 0x08,
+  0xA9, 0xF3, 0xFF, 0x7C, 0xFF, 0xFF, 0xFE, 0x8E, 0xFF, 0x3F, 0x26, 0xFF, 0xBD,
+  0x15, 0xF1, 0x3E, 0xA7, 0x0B, 0x2A, 0xAB, 0xAD, 0x66, 0xB2, 0xFF, 0x86, 0xAA,
+  0xFF, 0x8C, 0x66, 0xAA, 0xFF, 0x01, 0x65, 0xB2, 0xFF, 0xE9, 0xA2, 0xA3, 0x01,
+  0x47, 0xFB, 0xFF, 0x26, 0xFB, 0xFF, 0x81, 0x46, 0xFB, 0xFF, 0x00, 0x27, 0xFB,
+  0xFF, 0x8A, 0x47, 0xFB, 0xFF, 0x08, 0xA9, 0xF3, 0xFF, 0x7C, 0xFF, 0xFF, 0xFE,
+  0x8E, 0xFF, 0x3F, 0x26, 0xFF, 0xBD, 0x15, 0xF1, 0x3E, 0xA7, 0x0A, 0x29, 0xAB,
+  0xAD, 0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x8C, 0x66, 0xAA, 0xFF, 0x01, 0x66,
+  0xB2, 0xFF, 0x09, 0xA3, 0x77, 0x01, 0x88, 0xF3, 0xF8, 0x27, 0xFB, 0xFF, 0x81,
+  0x46, 0xFB, 0xFF, 0x00, 0x27, 0xFB, 0xFF, 0x8A, 0x47, 0xFB, 0xFF, 0x08, 0xA9,
+  0xF3, 0xFF, 0x7C, 0xFF, 0xFD, 0xFE, 0x8E, 0xFF, 0x3F, 0x26, 0xFF, 0xBD, 0x15,
+  0xF1, 0x5E, 0xA7, 0x0A, 0x29, 0xAB, 0xAD, 0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF,
+  0x89, 0x66, 0xAA, 0xFF, 0x01, 0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x81, 0x66,
+  0xAA, 0xFF, 0x00, 0x09, 0xA3, 0x56, 0x03, 0xA9, 0xEB, 0xBE, 0x47, 0xFB, 0xFF,
+  0x26, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x8B, 0x47, 0xFB, 0xFF, 0x08, 0xA9, 0xF3,
+  0xFF, 0x7C, 0xFF, 0xFF, 0xFE, 0x8E, 0xFF, 0x3F, 0x26, 0xFF, 0xBD, 0x15, 0xF1,
+  0x3E, 0x9F, 0x09, 0x2A, 0xAB, 0xAD, 0x66, 0xB2, 0xFF, 0x86, 0xAA, 0xFF, 0x89,
+  0x66, 0xAA, 0xFF, 0x00, 0x66, 0xB2, 0xFF, 0x81, 0x66, 0xAA, 0xFF, 0x01, 0x87,
+  0xAA, 0xFE, 0x2E, 0xC4, 0x26, 0x04, 0xEB, 0xE3, 0x7B, 0x47, 0xFB, 0xFF, 0x27,
+  0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x84, 0x47, 0xFB, 0xFF, 0x00,
+  0x46, 0xFB, 0xFF, 0x84, 0x47, 0xFB, 0xFF, 0x08, 0xA9, 0xF3, 0xFF, 0x7C, 0xFF,
+  0xFF, 0xFE, 0x8E, 0xFF, 0x3F, 0x26, 0xFF, 0xBD, 0x15, 0xF1, 0x5F, 0x9F, 0x09,
+  0x09, 0xAB, 0xAA, 0x66, 0xAA, 0xFF, 0x86, 0xAA, 0xFF, 0x8B, 0x66, 0xAA, 0xFF,
+  0x02, 0x66, 0xB2, 0xFF, 0xC8, 0xAA, 0xD9, 0x32, 0xCD, 0x08, 0x01, 0x6F, 0xEC,
+  0x2B, 0x68, 0xF3, 0xFD, 0x89, 0x47, 0xFB, 0xFF, 0x81, 0x46, 0xFB, 0xFF, 0x0A,
+  0x26, 0xFB, 0xFF, 0x67, 0xFB, 0xFF, 0x72, 0xF5, 0xFF, 0xDE, 0xFF, 0xFF, 0xDE,
+  0x8E, 0xFF, 0x3F, 0x26, 0xFF, 0x9D, 0x15, 0xF1, 0x5F, 0x9F, 0x09, 0x6A, 0xA3,
+  0x40, 0xA7, 0xA2, 0xEB, 0x66, 0xB2, 0xFF, 0x89, 0x66, 0xAA, 0xFF, 0x00, 0x86,
+  0xAA, 0xFF, 0x81, 0x66, 0xAA, 0xFF, 0x01, 0x29, 0xA3, 0x8D, 0xDA, 0xFE, 0x00,
+  0x02, 0x73, 0xE5, 0x03, 0xA9, 0xEB, 0xBF, 0x26, 0xFB, 0xFF, 0x81, 0x46, 0xFB,
+  0xFF, 0x84, 0x47, 0xFB, 0xFF, 0x00, 0x27, 0xFB, 0xFF, 0x81, 0x46, 0xFB, 0xFF,
+  0x81, 0x47, 0xFB, 0xFF, 0x09, 0xF0, 0xF4, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xF7,
+  0xFF, 0xDE, 0x86, 0xFF, 0x3F, 0x26, 0xFF, 0xBD, 0x15, 0xF3, 0x1F, 0x77, 0x11,
+  0x00, 0x00, 0x00, 0x4A, 0xAB, 0x42, 0x86, 0xAA, 0xF9, 0x8A, 0x66, 0xAA, 0xFF,
+  0x03, 0x66, 0xB2, 0xFF, 0xA7, 0xA2, 0xF9, 0xCC, 0xB3, 0x2D, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2C, 0xE4, 0x50, 0x48, 0xF3, 0xFD, 0x47, 0xFB, 0xFF,
+  0x46, 0xFB, 0xFF, 0x85, 0x47, 0xFB, 0xFF, 0x81, 0x46, 0xFB, 0xFF, 0x0B, 0x47,
+  0xFB, 0xFF, 0x68, 0xF3, 0xFF, 0x5C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0xAF,
+  0xFF, 0x5E, 0x4E, 0xFF, 0x3F, 0x26, 0xFF, 0xDF, 0x05, 0xFE, 0x9D, 0x2D, 0xB4,
+  0x1B, 0x66, 0x0D, 0xFF, 0xFF, 0x00, 0xE7, 0xA2, 0xB2, 0x8B, 0x66, 0xAA, 0xFF,
+  0x02, 0x09, 0xA3, 0xB1, 0xF4, 0xDD, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0xF0, 0xF4, 0x06, 0xAA, 0xEB, 0xC1, 0x87, 0x47, 0xFB, 0xFF, 0x00, 0x27,
+  0xFB, 0xFF, 0x81, 0x47, 0xFB, 0xFF, 0x0A, 0x2C, 0xF4, 0xFF, 0xDE, 0xFF, 0xFF,
+  0xDF, 0xEF, 0xFF, 0x7E, 0x4E, 0xFF, 0x7F, 0x36, 0xFF, 0x3F, 0x26, 0xFF, 0xDF,
+  0x05, 0xFF, 0xBF, 0x0D, 0xFF, 0xDD, 0x35, 0x6E, 0x00, 0x00, 0x00, 0x29, 0xAB,
+  0x68, 0x89, 0x66, 0xAA, 0xFF, 0x02, 0x86, 0xAA, 0xFF, 0x87, 0xAA, 0xF6, 0x8D,
+  0xB3, 0x34, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x05, 0x4D, 0xE4,
+  0x37, 0x68, 0xF3, 0xF6, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF,
+  0x27, 0xFB, 0xFF, 0x81, 0x47, 0xFB, 0xFF, 0x0E, 0x46, 0xFB, 0xFF, 0x27, 0xFB,
+  0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x8D, 0xEC, 0xFF, 0xDE, 0xFF, 0xFF,
+  0x9F, 0xD7, 0xFF, 0x5F, 0x3E, 0xFF, 0x7F, 0x36, 0xFF, 0x3F, 0x26, 0xFF, 0xDF,
+  0x05, 0xFF, 0xFF, 0x05, 0xFF, 0xDD, 0x25, 0x95, 0x00, 0x00, 0x00, 0xEA, 0x9A,
+  0x55, 0x86, 0x66, 0xAA, 0xFF, 0x01, 0x86, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x81,
+  0x66, 0xAA, 0xFF, 0x01, 0x09, 0xAB, 0x90, 0xF7, 0xED, 0x01, 0x81, 0x00, 0x00,
+  0x00, 0x81, 0x00, 0x00, 0x00, 0x02, 0xF5, 0xF5, 0x00, 0xEA, 0xEB, 0x7D, 0x47,
+  0xFB, 0xFE, 0x81, 0x47, 0xFB, 0xFF, 0x00, 0x26, 0xFB, 0xFF, 0x82, 0x47, 0xFB,
+  0xFF, 0x08, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0xEA, 0xF3,
+  0xFF, 0xDE, 0xFF, 0xFF, 0xDF, 0xE7, 0xFF, 0x7E, 0x4E, 0xFF, 0x7F, 0x36, 0xFF,
+  0x3F, 0x26, 0xFF, 0x81, 0xDF, 0x05, 0xFF, 0x02, 0xDD, 0x35, 0x6F, 0x00, 0x00,
+  0x00, 0x09, 0xAB, 0x7D, 0x86, 0x66, 0xAA, 0xFF, 0x04, 0x66, 0xB2, 0xFF, 0x86,
+  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0xA9, 0xAA, 0xD1, 0xD0, 0xBC, 0x0D, 0x82, 0x00,
+  0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x06, 0xD3, 0xFD, 0x05, 0xCB, 0xEB, 0xB0,
+  0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x27, 0xFB, 0xFF, 0x46,
+  0xFB, 0xFF, 0x81, 0x47, 0xFB, 0xFF, 0x81, 0x46, 0xFB, 0xFF, 0x0A, 0x47, 0xF3,
+  0xFF, 0x98, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xAF, 0xFF, 0x5E, 0x4E, 0xFF,
+  0x1F, 0x26, 0xFF, 0xBE, 0x0D, 0xFE, 0xBC, 0x2D, 0xBF, 0xFC, 0x5D, 0x0F, 0x50,
+  0xC4, 0x07, 0xA7, 0xA2, 0xD3, 0x84, 0x66, 0xAA, 0xFF, 0x05, 0x86, 0xAA, 0xFF,
+  0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0xA7, 0xAA, 0xEC, 0xCD,
+  0xB3, 0x29, 0x83, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xEC,
+  0x0E, 0xAA, 0xEB, 0xC2, 0x48, 0xFB, 0xFF, 0x81, 0x47, 0xFB, 0xFF, 0x00, 0x46,
+  0xFB, 0xFF, 0x83, 0x47, 0xFB, 0xFF, 0x0A, 0x46, 0xFB, 0xFF, 0x2C, 0xF4, 0xFF,
+  0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xD7, 0xFF, 0x1E, 0x9F, 0xE9, 0x3C,
+  0x4E, 0x5E, 0x7E, 0x7E, 0x0A, 0x54, 0xDD, 0x02, 0x0A, 0xAB, 0x84, 0x86, 0xA2,
+  0xFE, 0x84, 0x66, 0xAA, 0xFF, 0x00, 0x66, 0xB2, 0xFF, 0x81, 0x86, 0xAA, 0xFF,
+  0x01, 0x88, 0xAA, 0xF0, 0x6B, 0xAB, 0x42, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x01, 0x8F, 0xE4, 0x11, 0xAA, 0xEB, 0xBA, 0x81, 0x46, 0xFB, 0xFF,
+  0x0E, 0x27, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27, 0xFB, 0xFF,
+  0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x0B, 0xEC, 0xFF, 0x77,
+  0xEE, 0xFF, 0xDE, 0xFF, 0xFF, 0x9D, 0xF7, 0xE4, 0xDB, 0xE6, 0x10, 0xEE, 0xBB,
+  0x21, 0xE9, 0xAA, 0x9E, 0x66, 0xAA, 0xFC, 0x86, 0x66, 0xAA, 0xFF, 0x03, 0x66,
+  0xB2, 0xFF, 0xA7, 0xAA, 0xEB, 0x6B, 0xAB, 0x42, 0x37, 0xEE, 0x00, 0x84, 0x00,
+  0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x02, 0x11, 0xED, 0x0A, 0xEB, 0xEB, 0x91,
+  0x47, 0xFB, 0xFB, 0x81, 0x47, 0xFB, 0xFF, 0x00, 0x27, 0xFB, 0xFF, 0x81, 0x47,
+  0xFB, 0xFF, 0x07, 0x46, 0xFB, 0xFF, 0x47, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x27,
+  0xE3, 0xFF, 0x08, 0xBB, 0xFF, 0xAB, 0xBB, 0xFA, 0x09, 0xAB, 0xDF, 0x86, 0xAA,
+  0xF9, 0x81, 0x66, 0xB2, 0xFF, 0x09, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x86,
+  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x66, 0xB2, 0xFF, 0x66, 0xAA, 0xFF, 0x86, 0xAA,
+  0xFF, 0xC8, 0xA2, 0xCF, 0xCD, 0xB3, 0x2B, 0xD6, 0xEE, 0x00, 0x85, 0x00, 0x00,
+  0x00, 0x86, 0x00, 0x00, 0x00, 0x04, 0x39, 0xFF, 0x01, 0x2C, 0xEC, 0x4D, 0x89,
+  0xF3, 0xDC, 0x27, 0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x84, 0x47, 0xFB, 0xFF, 0x05,
+  0x27, 0xFB, 0xFF, 0x27, 0xEB, 0xFF, 0x85, 0xBA, 0xFF, 0x66, 0xAA, 0xFF, 0x86,
+  0xAA, 0xFF, 0x66, 0xAA, 0xFF, 0x81, 0x86, 0xAA, 0xFF, 0x82, 0x66, 0xB2, 0xFF,
+  0x03, 0x86, 0xAA, 0xFF, 0xA6, 0xAA, 0xF7, 0x09, 0xAB, 0x8A, 0xF1, 0xCC, 0x0C,
+  0x87, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xEC, 0x0E, 0xEB,
+  0xEB, 0x79, 0x89, 0xEB, 0xE4, 0x82, 0x47, 0xFB, 0xFF, 0x01, 0x26, 0xFB, 0xFF,
+  0x47, 0xFB, 0xFF, 0x81, 0x46, 0xFB, 0xFF, 0x02, 0x27, 0xEB, 0xFF, 0x66, 0xBA,
+  0xFF, 0x66, 0xAA, 0xFF, 0x82, 0x66, 0xB2, 0xFF, 0x04, 0x66, 0xAA, 0xFF, 0x86,
+  0xAA, 0xFF, 0xA6, 0xAA, 0xF6, 0xE9, 0xAA, 0xAC, 0xCD, 0xB3, 0x31, 0x89, 0x00,
+  0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x07, 0xDB, 0xFE, 0x00, 0xEF, 0xE4, 0x12,
+  0x2C, 0xEC, 0x5F, 0xCA, 0xEB, 0xB7, 0x69, 0xF3, 0xF2, 0x47, 0xF3, 0xFF, 0x47,
+  0xFB, 0xFF, 0x46, 0xFB, 0xFF, 0x81, 0x27, 0xFB, 0xFF, 0x01, 0x27, 0xEB, 0xFF,
+  0x86, 0xBA, 0xFF, 0x81, 0x86, 0xAA, 0xFF, 0x04, 0x87, 0xAA, 0xFD, 0xC8, 0xAA,
+  0xD3, 0x0A, 0xAB, 0x85, 0xCD, 0xB3, 0x2A, 0xB4, 0xDD, 0x01, 0x8A, 0x00, 0x00,
+  0x00, 0x8C, 0x00, 0x00, 0x00, 0x05, 0x36, 0xFE, 0x02, 0x10, 0xF5, 0x15, 0x8E,
+  0xE4, 0x3F, 0xAA, 0xDB, 0x62, 0xEB, 0xEB, 0x97, 0x89, 0xEB, 0xB3, 0x81, 0x67,
+  0xEB, 0xB6, 0x05, 0x8A, 0xD3, 0xAD, 0xC8, 0xAA, 0x68, 0x2B, 0xA3, 0x51, 0x2F,
+  0xBC, 0x22, 0x53, 0xDD, 0x07, 0xDB, 0xFE, 0x00, 0x8C, 0x00, 0x00, 0x00,
 };
 const lv_img_dsc_t ui_img_temperature_icon_png = {
   .header.always_zero = 0,
-  .header.w = 128,
-  .header.h = 129,
+  .header.w = 40,
+  .header.h = 40,
   .data_size = sizeof(ui_img_temperature_icon_png_data),
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = ui_img_temperature_icon_png_data
 };
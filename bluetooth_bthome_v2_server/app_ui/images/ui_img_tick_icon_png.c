@@ -10,1787 +10,124 @@
 #endif
 
 // IMAGE DATA: assets\tick_icon.png
+// Scaled to zoom 75 from 87x87 by tools/img_rle_convert.py
+// RLE encoded by tools/img_rle_convert.py, 1875 bytes raw
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_tick_icon_png_data[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xAF, 0x03, 0x79, 0xCF,
-  0x0E, 0x16, 0xB7, 0x23, 0x36, 0xB7, 0x39, 0x16, 0xAF, 0x47, 0xF5, 0xA6, 0x50,
-  0x15, 0xA7, 0x51, 0x16, 0xA7, 0x4A, 0x37, 0xAF, 0x3D, 0x57, 0xAF, 0x26, 0x99,
-  0xCF, 0x13, 0xF9, 0xCF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x36, 0xBF, 0x1C, 0x93, 0xAE, 0x5C, 0xF0, 0x8D, 0xA5, 0x6E, 0x7D, 0xDA, 0x0C,
-  0x65, 0xFE, 0xEB, 0x5C, 0xFF, 0x0B, 0x5D, 0xFF, 0x0B, 0x55, 0xFF, 0x0A, 0x4D,
-  0xFF, 0x0A, 0x4D, 0xFF, 0x0A, 0x4D, 0xFF, 0x0B, 0x4D, 0xFF, 0x2B, 0x4D, 0xFF,
-  0x2B, 0x4D, 0xFF, 0x0B, 0x55, 0xFF, 0x4B, 0x65, 0xFF, 0x8E, 0x75, 0xE2, 0x10,
-  0x86, 0xAF, 0x94, 0xA6, 0x66, 0x17, 0xBF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xAF, 0x03, 0x35, 0xA7, 0x4C, 0xEF, 0x75,
-  0xB0, 0x6C, 0x65, 0xFC, 0x0B, 0x55, 0xFF, 0x0A, 0x55, 0xFF,
-  0x0A, 0x55, 0xFF, 0x2A, 0x55, 0xFF, 0x09, 0x4D, 0xFF, 0x29, 0x45, 0xFF, 0x49,
-  0x4D, 0xFF, 0x49, 0x4D, 0xFF, 0x49, 0x4D, 0xFF, 0x49, 0x4D, 0xFF, 0x49, 0x4D,
-  0xFF, 0x4A, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x29, 0x45, 0xFF,
-  0x29, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x29, 0x4D, 0xFF, 0x2A, 0x4D, 0xFF, 0x2B,
-  0x55, 0xFF, 0x6D, 0x65, 0xFF, 0xB0, 0x7D, 0xBA, 0xF6, 0xB6, 0x54, 0xFB, 0xDF,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xB7, 0x2A, 0xD0, 0x7D, 0xA7, 0xEB,
-  0x54, 0xFF, 0x0A, 0x45, 0xFF, 0x6A, 0x4D, 0xFF, 0x29, 0x45, 0xFF, 0x08, 0x3D,
-  0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x89, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x48,
-  0x45, 0xFF, 0x48, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x48, 0x45,
-  0xFF, 0x89, 0x45, 0xFF, 0x89, 0x45, 0xFF, 0x89, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x48, 0x3D, 0xFF, 0x28, 0x3D, 0xFF, 0x29, 0x45, 0xFF, 0x4B, 0x55, 0xFF, 0xCA,
-  0x54, 0xFF, 0xEC, 0x64, 0xFF, 0x90, 0x85, 0xB1, 0xF6, 0xBE, 0x35, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xD5, 0xAE, 0x54, 0x4E, 0x6D, 0xE0, 0x0B, 0x55, 0xFF,
-  0x2B, 0x4D, 0xFF, 0x4A, 0x4D, 0xFF, 0x29, 0x45, 0xFF, 0x49, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x89, 0x45, 0xFF, 0x89, 0x3D, 0xFF, 0x68, 0x3D,
-  0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x88, 0x45, 0xFF, 0x68, 0x45, 0xFF,
-  0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x3D, 0xFF, 0x49, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x89, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x68, 0x45, 0xFF, 0x28, 0x45, 0xFF, 0x29, 0x45, 0xFF, 0x4A, 0x4D, 0xFF, 0x0A,
-  0x55, 0xFF, 0xCB, 0x54, 0xFF, 0x6F, 0x75, 0xDD, 0xD5, 0xAE, 0x54, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xB4, 0xAE, 0x48, 0x6E, 0x6D, 0xEB, 0xCA, 0x4C, 0xFF, 0x2A, 0x4D,
-  0xFF, 0x6A, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x48,
-  0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x68, 0x3D,
-  0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x6A, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x48, 0x3D,
-  0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x89, 0x45, 0xFF,
-  0x48, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x6B, 0x4D, 0xFF, 0x0A, 0x4D, 0xFF, 0xCA,
-  0x4C, 0xFF, 0x8E, 0x6D, 0xE8, 0xB4, 0x9E, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xF7, 0xB6, 0x24, 0xAF, 0x75, 0xD2, 0x0B, 0x4D, 0xFF, 0x4A,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x2A, 0x4D, 0xFF, 0xCE,
-  0x6D, 0xCD, 0x36, 0xAF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x32, 0x8E, 0x8A, 0x2C, 0x55, 0xFF, 0x2A, 0x45, 0xFF,
-  0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x68,
-  0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x88, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x4A, 0x45, 0xFF, 0x2B, 0x55, 0xFF, 0x31,
-  0x8E, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x78, 0xBF, 0x1D, 0x6D, 0x65, 0xE2, 0x2A, 0x4D, 0xFF, 0x6A, 0x45,
-  0xFF, 0x48, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68,
-  0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x48, 0x3D, 0xFF,
-  0x6A, 0x4D, 0xFF, 0x2A, 0x55, 0xFF, 0x4D, 0x6D, 0xD6, 0x78, 0xC7, 0x1D, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xA6, 0x48, 0x0C, 0x5D, 0xFF, 0x4A,
-  0x4D, 0xFF, 0x49, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x68, 0x3D,
-  0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x68,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x89, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x2B, 0x55, 0xFF, 0x0C, 0x5D, 0xFB, 0xB4, 0xA6, 0x47, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x86, 0x7F, 0x0B, 0x55, 0xFF,
-  0x4A, 0x55, 0xFF, 0x08, 0x45, 0xFF, 0x88, 0x45, 0xFF, 0x67, 0x3D, 0xFF, 0x67,
-  0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF,
-  0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D,
-  0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D,
-  0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF,
-  0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x48, 0x3D,
-  0xFF, 0x89, 0x45, 0xFF, 0x29, 0x3D, 0xFF, 0x4A, 0x4D, 0xFF, 0x0B, 0x55, 0xFF,
-  0x32, 0x96, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x76, 0x9F, 0x4B, 0x4D,
-  0xFF, 0x2A, 0x4D, 0xFF, 0x29, 0x45, 0xFF, 0x69, 0x4D, 0xFF,
-  0x27, 0x3D, 0xFF, 0x88, 0x45, 0xFF, 0xA9, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D,
-  0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D,
-  0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x8A,
-  0x4D, 0xFF, 0x69, 0x45, 0xFF, 0x28, 0x35, 0xFF, 0xA9, 0x45, 0xFF, 0x68, 0x45,
-  0xFF, 0x29, 0x4D, 0xFF, 0x0B, 0x5D, 0xFF, 0xD0, 0x85, 0x9B, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2,
-  0x95, 0xA9, 0x0A, 0x4D, 0xFF, 0x8A, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x29, 0x3D, 0xFF, 0x8A, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF,
-  0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x29, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x89,
-  0x4D, 0xFF, 0x48, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x8A, 0x4D,
-  0xFF, 0x0A, 0x4D, 0xFF, 0x32, 0x86, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xD2, 0x95, 0xA1, 0xAB, 0x5C, 0xFF, 0x2A, 0x4D, 0xFF, 0x48, 0x3D, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45,
-  0xFF, 0x49, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D,
-  0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x69, 0x4D, 0xFF, 0x48, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x88, 0x3D, 0xFF, 0x88,
-  0x3D, 0xFF, 0x48, 0x35, 0xFF, 0x4A, 0x45, 0xFF, 0xEB, 0x4C, 0xFF, 0x12, 0x8E,
-  0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x86, 0x92, 0x2B, 0x5D, 0xFF, 0x09, 0x4D, 0xFF,
-  0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x69, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x88, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x28, 0x45, 0xFF, 0x69,
-  0x4D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x89, 0x3D, 0xFF, 0x68, 0x3D,
-  0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x48, 0x3D, 0xFF,
-  0x89, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x29,
-  0x45, 0xFF, 0x4B, 0x55, 0xFF, 0xF1, 0x85, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x96, 0x61, 0x0A, 0x4D, 0xFF, 0x6A, 0x4D,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68,
-  0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D,
-  0xFF, 0x68, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x45, 0xFF,
-  0x48, 0x3D, 0xFF, 0x89, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x8A, 0x4D,
-  0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x3D, 0xFF, 0x49, 0x45, 0xFF,
-  0x89, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x6A, 0x4D, 0xFF, 0x0A,
-  0x4D, 0xFF, 0x93, 0x96, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xB7, 0x2E, 0xEB, 0x54, 0xFB, 0x4A,
-  0x55, 0xFF, 0x08, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x89,
-  0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x28, 0x3D, 0xFF, 0x48, 0x45, 0xFF, 0x89, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x0A,
-  0x55, 0xFF, 0x6C, 0x65, 0xFB, 0x6B, 0x55, 0xFF, 0x2A, 0x45, 0xFF, 0x6A, 0x4D,
-  0xFF, 0x69, 0x45, 0xFF, 0x28, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x89, 0x45, 0xFF,
-  0x08, 0x3D, 0xFF, 0x4A, 0x4D, 0xFF, 0x0B, 0x55, 0xFF, 0x36, 0xAF, 0x33, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC7, 0x09,
-  0x2C, 0x65, 0xEA, 0x2A, 0x55, 0xFF, 0x29, 0x45, 0xFF, 0x69, 0x4D, 0xFF, 0x49,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x89, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x28, 0x45, 0xFF, 0x69, 0x4D, 0xFF,
-  0x09, 0x4D, 0xFF, 0x2D, 0x6D, 0xE7, 0xF6, 0xB7, 0x07, 0xF8, 0xBF, 0x12, 0x4C,
-  0x5D, 0xE9, 0x09, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x89, 0x45, 0xFF, 0x49, 0x3D, 0xFF,
-  0x6A, 0x4D, 0xFF, 0x2C, 0x5D, 0xF4, 0x79, 0xCF, 0x0E, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xCF, 0x7D, 0xB7, 0x4A, 0x55, 0xFF, 0x07, 0x3D, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x88, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x6A,
-  0x45, 0xFF, 0x8A, 0x45, 0xFF, 0x28, 0x35, 0xFF, 0xAA, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x29, 0x45, 0xFF, 0x2A, 0x4D, 0xFF, 0x6D, 0x75, 0xE8, 0xFB, 0xDF, 0x08,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xBF, 0x12, 0x4C, 0x5D, 0xED, 0x4A,
-  0x4D, 0xFF, 0x69, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x89, 0x45,
-  0xFF, 0x89, 0x3D, 0xFF, 0x28, 0x3D, 0xFF, 0x4A, 0x55, 0xFF, 0xCF, 0x7D, 0xC1,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x74, 0xA6, 0x56, 0xEA, 0x4C, 0xFF, 0x69, 0x4D, 0xFF, 0x68, 0x45,
-  0xFF, 0x68, 0x3D, 0xFF, 0x48, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D,
-  0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x29, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0xA9, 0x45, 0xFF, 0x27,
-  0x35, 0xFF, 0x49, 0x45, 0xFF, 0x6B, 0x55, 0xFF, 0x0C, 0x5D, 0xEA, 0x5A, 0xD7,
-  0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x98, 0xBF, 0x12, 0x0B, 0x55, 0xEF, 0x2A, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x6A, 0x4D,
-  0xFF, 0xEA, 0x4C, 0xFF, 0x74, 0xA6, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC7, 0x09, 0x2C, 0x65, 0xF9, 0x29,
-  0x4D, 0xFF, 0x48, 0x3D, 0xFF, 0xA8, 0x45, 0xFF, 0x88, 0x3D, 0xFF, 0x48, 0x3D,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x68,
-  0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x48, 0x3D, 0xFF,
-  0x88, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x4B, 0x4D, 0xFF, 0x0C, 0x5D, 0xE9, 0xFC,
-  0xE7, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xBF, 0x14,
-  0x0C, 0x5D, 0xF1, 0x2A, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x89,
-  0x45, 0xFF, 0xAA, 0x45, 0xFF, 0x2A, 0x45, 0xFF, 0x0A, 0x4D, 0xFF, 0x2C, 0x65,
-  0xFF, 0x58, 0xC7, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x85, 0x9C,
-  0x2B, 0x55, 0xFF, 0x49, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x67, 0x35, 0xFF, 0x68,
-  0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x68, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D,
-  0xFF, 0x68, 0x3D, 0xFF, 0xA9, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x09, 0x45, 0xFF,
-  0x6D, 0x65, 0xEC, 0xFA, 0xBF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xB9, 0xCF, 0x17, 0x0C, 0x65, 0xF0, 0x29, 0x4D, 0xFF,
-  0x69, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x29, 0x3D, 0xFF, 0x2A, 0x45, 0xFF, 0x2A,
-  0x4D, 0xFF, 0x2A, 0x4D, 0xFF, 0x30, 0x86, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xC7,
-  0x19, 0xEB, 0x54, 0xFF, 0x4A, 0x4D, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0xA9, 0x45, 0xFF,
-  0x48, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68,
-  0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0xA8, 0x3D, 0xFF, 0x48, 0x3D, 0xFF, 0x4A, 0x4D,
-  0xFF, 0x4C, 0x65, 0xED, 0x58, 0xC7, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xC7,
-  0x1A, 0x2C, 0x5D, 0xF1, 0x2A, 0x4D, 0xFF, 0x2A, 0x45, 0xFF, 0x2A, 0x45, 0xFF,
-  0x4B, 0x4D, 0xFF, 0x2A, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x4A, 0x4D, 0xFF, 0x38,
-  0xBF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x85, 0xB1, 0x0A, 0x55, 0xFF, 0x49, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x88, 0x45,
-  0xFF, 0x27, 0x3D, 0xFF, 0xAA, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x3D, 0xFF,
-  0x69, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x6A,
-  0x4D, 0xFF, 0x2C, 0x65, 0xEE, 0x79, 0xCF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xBF, 0x1C, 0x2C, 0x65,
-  0xEC, 0x2B, 0x55, 0xFF, 0x2A, 0x45, 0xFF, 0x2A, 0x45, 0xFF, 0x6A, 0x45, 0xFF,
-  0xA9, 0x45, 0xFF, 0x4A, 0x45, 0xFF, 0xF1, 0x7D, 0xBF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xB7, 0x15, 0xEB, 0x5C, 0xFF, 0x29,
-  0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x48, 0x35, 0xFF, 0x89, 0x3D, 0xFF, 0x88, 0x3D, 0xFF,
-  0x68, 0x45, 0xFF, 0x29, 0x45, 0xFF, 0x2C, 0x65, 0xED, 0x79, 0xCF, 0x0E, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x37, 0xB7, 0x1D, 0x6D, 0x65, 0xED, 0x4A, 0x45, 0xFF, 0x48, 0x3D,
-  0xFF, 0x89, 0x3D, 0xFF, 0x48, 0x3D, 0xFF, 0x4A, 0x45, 0xFF, 0xEC, 0x54, 0xFF,
-  0x38, 0xBF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x85, 0xA1,
-  0x2B, 0x55, 0xFF, 0x49, 0x4D, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69,
-  0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x28, 0x3D, 0xFF, 0xA9, 0x45, 0xFF, 0x68, 0x3D,
-  0xFF, 0x69, 0x45, 0xFF, 0x29, 0x45, 0xFF, 0x4C, 0x65, 0xEB, 0x79, 0xCF, 0x10,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xAF, 0x1E, 0x4A,
-  0x45, 0xFF, 0x89, 0x3D, 0xFF, 0x88, 0x35, 0xFF, 0x89, 0x45, 0xFF, 0x4A, 0x45,
-  0xFF, 0x2C, 0x55, 0xFF, 0xF1, 0x7D, 0xAF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0x02, 0xEB, 0x54, 0xFF, 0x6A, 0x4D, 0xFF, 0x48, 0x45, 0xFF,
-  0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x8A, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x08, 0x3D, 0xFF, 0xAA, 0x55, 0xFF, 0x49,
-  0x45, 0xFF, 0x29, 0x3D, 0xFF, 0x4A, 0x4D, 0xFF, 0x6D, 0x65, 0xE6, 0x79, 0xCF,
-  0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x75, 0xA7, 0x3A, 0x4A, 0x45, 0xFF, 0xA9, 0x3D, 0xFF, 0x88,
-  0x35, 0xFF, 0x69, 0x45, 0xFF, 0x4A, 0x4D, 0xFF, 0x6B, 0x55, 0xFF, 0x0C, 0x55,
-  0xFF, 0xF7, 0xBF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xA6, 0x66, 0x2B, 0x55, 0xFF, 0x29, 0x3D,
-  0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x3D, 0xFF, 0x89, 0x45, 0xFF,
-  0x89, 0x4D, 0xFF, 0x08, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x4B, 0x55, 0xFF, 0x0C,
-  0x5D, 0xE5, 0x58, 0xC7, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xB4, 0xAE, 0x3A, 0x0B, 0x55, 0xFF, 0x49, 0x45, 0xFF,
-  0x89, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x28, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x09,
-  0x3D, 0xFF, 0x2B, 0x55, 0xFF, 0x93, 0x9E, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x75, 0xCE, 0x4B,
-  0x55, 0xFF, 0x29, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D,
-  0xFF, 0x69, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x6B, 0x55, 0xFF,
-  0xEB, 0x5C, 0xE7, 0xFA, 0xD7, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xB7, 0x37, 0xEB, 0x5C, 0xFF, 0x0A, 0x4D,
-  0xFF, 0x2A, 0x4D, 0xFF, 0x29, 0x45, 0xFF, 0x69, 0x4D, 0xFF,
-  0x89, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x28, 0x3D, 0xFF, 0x6B, 0x4D, 0xFF, 0x8E,
-  0x75, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFA, 0xD7, 0x06, 0x0B, 0x5D, 0xFF, 0xE9, 0x44, 0xFF, 0x8A, 0x4D, 0xFF, 0x68,
-  0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D,
-  0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x29, 0x45,
-  0xFF, 0x2C, 0x65, 0xEA, 0x79, 0xCF, 0x0E, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xB7, 0x37, 0xEB,
-  0x54, 0xFF, 0x4A, 0x4D, 0xFF, 0x4A, 0x4D, 0xFF, 0x2A, 0x45, 0xFF, 0x29, 0x4D,
-  0xFF, 0x29, 0x4D, 0xFF, 0x48, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0xAA, 0x45, 0xFF,
-  0x09, 0x3D, 0xFF, 0x0B, 0x5D, 0xFF, 0xF8, 0xC7, 0x0D, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x94, 0x96, 0x5B, 0x4B, 0x55, 0xFF, 0x29, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x49, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x89, 0x3D, 0xFF,
-  0x69, 0x3D, 0xFF, 0x49, 0x3D, 0xFF, 0x49, 0x3D, 0xFF, 0x6A, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x48, 0x4D, 0xFF, 0x49, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF,
-  0x88, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x47, 0x3D,
-  0xFF, 0xA9, 0x4D, 0xFF, 0x48, 0x45, 0xFF, 0x08, 0x3D, 0xFF, 0x6A, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x29,
-  0x3D, 0xFF, 0x4A, 0x4D, 0xFF, 0x4C, 0x5D, 0xEB, 0x79, 0xCF, 0x0E, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xB7, 0x37,
-  0xEB, 0x4C, 0xFF, 0x4A, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x4D, 0xFF, 0x49, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x29, 0x45, 0xFF, 0x2A, 0x4D, 0xFF, 0xD4, 0x9E, 0x63,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x7E, 0xB4, 0x4A, 0x4D,
-  0xFF, 0x29, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x68, 0x3D, 0xFF,
-  0x88, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x4D, 0xFF, 0x49, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x48, 0x3D, 0xFF, 0x89, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x28, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x48,
-  0x45, 0xFF, 0x48, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x88, 0x3D,
-  0xFF, 0x88, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x88,
-  0x3D, 0xFF, 0xA8, 0x45, 0xFF, 0x27, 0x3D, 0xFF, 0x89, 0x4D, 0xFF, 0x49, 0x45,
-  0xFF, 0x6A, 0x45, 0xFF, 0x49, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x89, 0x3D, 0xFF,
-  0x69, 0x45, 0xFF, 0x2A, 0x4D, 0xFF, 0x0C, 0x5D, 0xEF, 0xF9, 0xCF, 0x0E, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xB6,
-  0x34, 0x0C, 0x5D, 0xFF, 0x4B, 0x4D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x2A, 0x45, 0xFF, 0x30, 0x7E, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x4D, 0x65, 0xEB, 0x2A, 0x45, 0xFF, 0x69, 0x4D, 0xFF, 0x48, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x89,
-  0x45, 0xFF, 0x28, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x8A, 0x45, 0xFF, 0x68, 0x3D,
-  0xFF, 0x68, 0x3D, 0xFF, 0xA9, 0x45, 0xFF, 0x88, 0x3D, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF,
-  0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x89, 0x3D,
-  0xFF, 0x89, 0x45, 0xFF, 0x29, 0x45, 0xFF, 0x0B, 0x5D, 0xF2,
-  0x79, 0xCF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xF6, 0xB6, 0x37, 0x0C, 0x5D, 0xFF, 0x0A, 0x4D, 0xFF, 0x4A, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x29, 0x45, 0xFF, 0x6D, 0x65, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x39, 0xCF, 0x0A, 0xEB, 0x4C, 0xFF, 0x4A, 0x45, 0xFF, 0x69,
-  0x4D, 0xFF, 0x48, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x89, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x67, 0x3D, 0xFF, 0x87, 0x3D, 0xFF, 0x67, 0x3D,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF,
-  0x69, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x88, 0x3D,
-  0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x49, 0x3D, 0xFF, 0x8A, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x28, 0x3D, 0xFF, 0x89,
-  0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x08, 0x45, 0xFF, 0x2B, 0x5D,
-  0xF6, 0xF9, 0xCF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x17, 0xB7, 0x34, 0x0C, 0x5D, 0xFF, 0x0A, 0x4D, 0xFF, 0x4A,
-  0x4D, 0xFF, 0x6A, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x0B,
-  0x55, 0xFF, 0x98, 0xC7, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xAE, 0x48,
-  0x0A, 0x4D, 0xFF, 0x49, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x89, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0xA8,
-  0x45, 0xFF, 0xA8, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68,
-  0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x6A, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x28, 0x35, 0xFF,
-  0xCA, 0x4D, 0xFF, 0x28, 0x3D, 0xFF, 0x28, 0x45, 0xFF, 0x4A, 0x55, 0xFF, 0x4C,
-  0x65, 0xF8, 0x77, 0xBF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x36, 0xAF, 0x33, 0x2C, 0x5D, 0xFF,
-  0x2A, 0x45, 0xFF, 0x4A, 0x45, 0xFF, 0x6A, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x48,
-  0x4D, 0xFF, 0x48, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D,
-  0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x68, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x0A, 0x4D, 0xFF, 0xB6, 0xAE, 0x4F, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x32, 0x96, 0x85, 0x4B, 0x4D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF,
-  0x68, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x4A, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x89, 0x3D, 0xFF, 0x48, 0x3D, 0xFF, 0x48, 0x45, 0xFF,
-  0x4A, 0x55, 0xFF, 0xEA, 0x5C, 0xFB, 0x77, 0xCF, 0x0F, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xB7, 0x33, 0x2C, 0x5D,
-  0xFF, 0x0A, 0x45, 0xFF, 0x49, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x45, 0xFF,
-  0x48, 0x45, 0xFF, 0x48, 0x4D, 0xFF, 0x48, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68,
-  0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D,
-  0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x2B, 0x55, 0xFF,
-  0x13, 0x96, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x85, 0xAD, 0x4B, 0x4D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x49, 0x3D, 0xFF, 0x69, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x09, 0x45, 0xFF, 0x6B, 0x55, 0xFF,
-  0x8C, 0x5D, 0xFF, 0x0A, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x89, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF,
-  0x48, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x4A, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x48, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x89, 0x45,
-  0xFF, 0x4A, 0x4D, 0xFF, 0xEB, 0x54, 0xFC, 0x9A, 0xD7, 0x11, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xBF, 0x32, 0x2C,
-  0x5D, 0xFF, 0x0A, 0x4D, 0xFF, 0x4A, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x48, 0x3D,
-  0xFF, 0x48, 0x45, 0xFF, 0x69, 0x4D, 0xFF, 0x48, 0x45, 0xFF, 0x68, 0x45, 0xFF,
-  0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x69,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x89, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x45,
-  0xFF, 0x2A, 0x4D, 0xFF, 0xD1, 0x85, 0xBC, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
-  0x7D, 0xCD, 0x2A, 0x45, 0xFF, 0x69, 0x35, 0xFF, 0x89, 0x3D, 0xFF, 0x69, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x68, 0x45, 0xFF,
-  0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x6A, 0x4D, 0xFF, 0xE9, 0x4C, 0xFF, 0x4C, 0x65,
-  0xFF, 0x16, 0xAF, 0x24, 0x57, 0xB7, 0x17, 0x4D, 0x65, 0xEC, 0x2A, 0x4D, 0xFF,
-  0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x87, 0x3D, 0xFF, 0x88, 0x3D,
-  0xFF, 0x68, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x4A, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x29, 0x45, 0xFF, 0x0B, 0x55, 0xFD, 0x77, 0xBF, 0x10, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x58, 0xC7, 0x2E, 0x0C, 0x5D, 0xFF, 0x2A, 0x4D, 0xFF, 0x29, 0x45, 0xFF, 0x8A,
-  0x45, 0xFF, 0x89, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x48, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x88, 0x3D, 0xFF, 0x89, 0x3D, 0xFF,
-  0x89, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x09, 0x45, 0xFF, 0x90, 0x7D,
-  0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x2D, 0x6D, 0xE2, 0x6A, 0x45, 0xFF, 0x69, 0x35, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x47, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x89, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x29, 0x3D, 0xFF, 0x2A, 0x4D, 0xFF, 0xEB,
-  0x5C, 0xFF, 0x17, 0xBF, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xC7,
-  0x12, 0x2C, 0x5D, 0xE6, 0x4B, 0x4D, 0xFF, 0x49, 0x3D, 0xFF, 0x89, 0x45, 0xFF,
-  0x49, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x89, 0x45, 0xFF, 0x47, 0x3D, 0xFF, 0x26,
-  0x3D, 0xFF, 0xC9, 0x4D, 0xFF, 0x48, 0x3D, 0xFF, 0x29, 0x3D, 0xFF, 0x49, 0x45,
-  0xFF, 0x6A, 0x45, 0xFF, 0x49, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x88, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x4A, 0x4D, 0xFF, 0xEB, 0x5C, 0xF9, 0x77,
-  0xBF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x57, 0xC7, 0x2E, 0xEB, 0x5C, 0xFF, 0x2A, 0x4D, 0xFF, 0x49, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x89, 0x3D,
-  0xFF, 0x89, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x4A,
-  0x4D, 0xFF, 0x2E, 0x6D, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x65, 0xEF, 0x6A, 0x45, 0xFF,
-  0x69, 0x35, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x88, 0x45, 0xFF, 0xA8, 0x3D, 0xFF, 0x67, 0x35,
-  0xFF, 0xA9, 0x45, 0xFF, 0x28, 0x3D, 0xFF, 0x49, 0x3D, 0xFF,
-  0x6A, 0x4D, 0xFF, 0xEB, 0x5C, 0xFF, 0x37, 0xBF, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xBF, 0x10, 0x4D, 0x5D,
-  0xE9, 0x4A, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x48, 0x3D, 0xFF,
-  0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x88, 0x45, 0xFF, 0x27, 0x3D, 0xFF, 0x89,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x6A, 0x45, 0xFF, 0x49, 0x3D, 0xFF, 0x68, 0x3D,
-  0xFF, 0x89, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x4D, 0xFF, 0x0B, 0x5D, 0xF8,
-  0x77, 0xBF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x37, 0xBF, 0x2B, 0xCB, 0x5C, 0xFF, 0x4B, 0x55, 0xFF, 0x49, 0x45,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF,
-  0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x68, 0x45, 0xFF,
-  0x68, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x29, 0x4D, 0xFF, 0x2E, 0x6D, 0xFF, 0xFF,
-  0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0C, 0x65, 0xF7, 0x4A, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x69, 0x3D, 0xFF, 0x8A, 0x45, 0xFF, 0x28, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0xA8,
-  0x45, 0xFF, 0x47, 0x35, 0xFF, 0xA9, 0x45, 0xFF, 0x28, 0x3D, 0xFF, 0x6A, 0x4D,
-  0xFF, 0x29, 0x4D, 0xFF, 0xEA, 0x54, 0xFF, 0x17, 0xBF, 0x2B, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x98, 0xB7, 0x11, 0x2C, 0x5D, 0xEC, 0x4A, 0x4D, 0xFF, 0x28, 0x3D,
-  0xFF, 0x89, 0x4D, 0xFF, 0x48, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x48, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x29, 0x4D, 0xFF, 0xEB, 0x5C,
-  0xF7, 0x77, 0xBF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xB7, 0x29, 0xEB, 0x54, 0xFF, 0x4A,
-  0x55, 0xFF, 0x29, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF,
-  0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x29, 0x45, 0xFF,
-  0x0D, 0x65, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x65, 0xFA, 0x49, 0x45, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x88, 0x45, 0xFF, 0x47, 0x3D, 0xFF, 0xA9, 0x45, 0xFF, 0x28, 0x35, 0xFF, 0x4A,
-  0x4D, 0xFF, 0xEA, 0x4C, 0xFF, 0x2B, 0x5D, 0xFF, 0x16, 0xB7, 0x2E, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xBF, 0x13, 0x2B,
-  0x5D, 0xEF, 0x4A, 0x55, 0xFF, 0x08, 0x3D, 0xFF, 0x69, 0x4D, 0xFF, 0x49, 0x45,
-  0xFF, 0x28, 0x45, 0xFF, 0x69, 0x4D, 0xFF, 0x49, 0x45, 0xFF,
-  0x28, 0x3D, 0xFF, 0xA9, 0x45, 0xFF, 0x89, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x08,
-  0x45, 0xFF, 0x0B, 0x5D, 0xF8, 0x98, 0xC7, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xB7, 0x26, 0x0A, 0x55, 0xFF,
-  0x4A, 0x4D, 0xFF, 0x29, 0x45, 0xFF, 0x8A, 0x4D, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x49, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45,
-  0xFF, 0x29, 0x45, 0xFF, 0x0D, 0x65, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x65, 0xFA, 0x49,
-  0x4D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x28, 0x3D,
-  0xFF, 0xAA, 0x4D, 0xFF, 0x48, 0x45, 0xFF, 0x68, 0x45, 0xFF,
-  0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0xEA, 0x54, 0xFF, 0x0C, 0x65, 0xFF, 0xD6,
-  0xB6, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xC7, 0x15, 0x0B, 0x5D, 0xF0, 0x2A,
-  0x4D, 0xFF, 0x29, 0x45, 0xFF, 0x6A, 0x4D, 0xFF, 0x6A, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x08, 0x3D, 0xFF, 0xAA, 0x55, 0xFF, 0x48, 0x3D, 0xFF, 0x49, 0x45, 0xFF,
-  0x4A, 0x4D, 0xFF, 0x2C, 0x5D, 0xF6, 0x37, 0xBF, 0x14, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xBF, 0x25, 0x2B, 0x55,
-  0xFF, 0x69, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x49, 0x45, 0xFF, 0x49, 0x4D, 0xFF, 0x49, 0x4D, 0xFF,
-  0x49, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x29, 0x4D, 0xFF, 0x0D, 0x65,
-  0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0B, 0x65, 0xF7, 0x49, 0x4D, 0xFF, 0x68, 0x3D, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x48, 0x45,
-  0xFF, 0x89, 0x45, 0xFF, 0x28, 0x3D, 0xFF, 0x2A, 0x4D, 0xFF, 0x0C, 0x65, 0xFF,
-  0xD6, 0xB6, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x56, 0xBF, 0x18, 0x2C, 0x5D, 0xF5, 0x2B, 0x4D, 0xFF, 0x29, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x89, 0x4D, 0xFF, 0x28, 0x45, 0xFF, 0x28, 0x45,
-  0xFF, 0x29, 0x4D, 0xFF, 0xCA, 0x54, 0xF9, 0x97, 0xBF, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57,
-  0xBF, 0x24, 0xCA, 0x54, 0xFF, 0x49, 0x4D, 0xFF, 0x68, 0x3D, 0xFF, 0x88, 0x3D,
-  0xFF, 0x69, 0x45, 0xFF, 0x49, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x49, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x29,
-  0x4D, 0xFF, 0x0D, 0x65, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x65, 0xF0, 0x49, 0x4D, 0xFF,
-  0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x29,
-  0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x29, 0x45, 0xFF, 0xAB, 0x55, 0xFF, 0x2B, 0x55,
-  0xFF, 0xD5, 0xAE, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xB7, 0x1B,
-  0x2C, 0x5D, 0xF7, 0x4B, 0x4D, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x89,
-  0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x4A, 0x55, 0xFF, 0xAA, 0x54, 0xFC, 0xB9, 0xCF,
-  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x57, 0xBF, 0x23, 0xEB, 0x5C, 0xFF, 0x4A, 0x55, 0xFF, 0x08, 0x3D, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF,
-  0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45,
-  0xFF, 0x88, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x48, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x29, 0x4D, 0xFF, 0x2D, 0x6D, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x6D,
-  0xE2, 0x49, 0x4D, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF,
-  0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x6A, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x48,
-  0x45, 0xFF, 0x6A, 0x4D, 0xFF, 0x54, 0x9F, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x78, 0xBF, 0x1D, 0x0B, 0x5D, 0xF3, 0x2A, 0x4D, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x09, 0x45, 0xFF, 0x0B, 0x5D, 0xFA, 0x57,
-  0xC7, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x78, 0xC7, 0x20, 0xEB, 0x5C, 0xFF, 0x4A, 0x55, 0xFF, 0x29, 0x45, 0xFF,
-  0x8A, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x29, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x68,
-  0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x49, 0x4D, 0xFF,
-  0x2E, 0x6D, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x7D, 0xCE, 0x29, 0x4D, 0xFF, 0x68, 0x3D,
-  0xFF, 0x89, 0x35, 0xFF, 0x89, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x89, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0xAA, 0x55, 0xFF, 0x95, 0xA7, 0x25, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xCF,
-  0x1A, 0xEB, 0x64, 0xE7, 0x0A, 0x55, 0xFF, 0x0A, 0x55, 0xFF, 0xCB, 0x54, 0xF1,
-  0xB8, 0xBF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xBF, 0x1F, 0x0C, 0x5D, 0xFF, 0x2A, 0x4D,
-  0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x68, 0x45,
-  0xFF, 0x09, 0x45, 0xFF, 0xB0, 0x7D, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x85, 0xAF, 0x4A,
-  0x55, 0xFF, 0x69, 0x3D, 0xFF, 0x89, 0x35, 0xFF, 0x89, 0x3D, 0xFF, 0x49, 0x45,
-  0xFF, 0x29, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x4D, 0xFF,
-  0x2B, 0x5D, 0xF9, 0x9A, 0xCF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xCF, 0x14, 0xCC, 0x64,
-  0xDC, 0xCD, 0x64, 0xE0, 0x97, 0xBF, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xC7, 0x1D, 0x2C, 0x5D, 0xFF, 0x4A,
-  0x4D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45,
-  0xFF, 0x48, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x48,
-  0x45, 0xFF, 0x88, 0x45, 0xFF, 0x29, 0x4D, 0xFF, 0xD1, 0x8D, 0xBC, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xF2, 0x95, 0x88, 0x4B, 0x55, 0xFF, 0x69, 0x3D, 0xFF, 0x68,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x29, 0x45, 0xFF, 0x8A, 0x4D, 0xFF, 0x68, 0x3D,
-  0xFF, 0x47, 0x3D, 0xFF, 0x48, 0x45, 0xFF, 0x4A, 0x55, 0xFF, 0xCD, 0x64, 0xF5,
-  0xF8, 0xBE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x79, 0xBF, 0x0F, 0xD9, 0xCE, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xC7, 0x1D, 0x0C, 0x5D, 0xFF,
-  0x2A, 0x4D, 0xFF, 0x29, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x45, 0xFF, 0x48, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x4A,
-  0x55, 0xFF, 0x12, 0x96, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xB6, 0x4B, 0x0A, 0x4D, 0xFF,
-  0x49, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x48, 0x45, 0xFF, 0x69, 0x4D, 0xFF, 0x28,
-  0x45, 0xFF, 0x68, 0x3D, 0xFF, 0xA9, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x29, 0x4D,
-  0xFF, 0xEB, 0x54, 0xFF, 0x2E, 0x6D, 0xF6, 0xF7, 0xBE, 0x1E, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xBF,
-  0x1C, 0xEB, 0x54, 0xFF, 0x4B, 0x4D, 0xFF, 0x29, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x48, 0x45, 0xFF, 0x09, 0x4D, 0xFF, 0xD5, 0xAE, 0x4F, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xC7,
-  0x0D, 0x0B, 0x55, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x48, 0x45, 0xFF,
-  0x07, 0x3D, 0xFF, 0x89, 0x4D, 0xFF, 0x68, 0x45, 0xFF, 0x47, 0x3D, 0xFF, 0xA9,
-  0x4D, 0xFF, 0x08, 0x3D, 0xFF, 0x6B, 0x4D, 0xFF, 0xEA, 0x4C, 0xFF, 0x2D, 0x65,
-  0xF9, 0x78, 0xC7, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58,
-  0xC7, 0x1A, 0x2C, 0x5D, 0xFF, 0x4A, 0x4D, 0xFF, 0x28, 0x3D, 0xFF, 0x89, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x89, 0x3D,
-  0xFF, 0x89, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x0A, 0x55, 0xFF,
-  0x77, 0xBF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x65, 0xF3, 0x2A, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x48, 0x45, 0xFF,
-  0x89, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x07, 0x35, 0xFF, 0xA9, 0x45, 0xFF, 0x49,
-  0x3D, 0xFF, 0x4A, 0x45, 0xFF, 0x2A, 0x4D, 0xFF, 0x0C, 0x5D, 0xF8, 0x78, 0xC7,
-  0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xB8, 0xCF, 0x1A, 0xEC, 0x5C, 0xFF, 0x0A, 0x4D, 0xFF, 0x69, 0x45, 0xFF, 0x88,
-  0x3D, 0xFF, 0x47, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x29, 0x45,
-  0xFF, 0x6C, 0x65, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
-  0x85, 0xB8, 0x2A, 0x4D, 0xFF, 0x28, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x89, 0x45,
-  0xFF, 0x28, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x8A, 0x45, 0xFF, 0x48, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0xA8, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x2A,
-  0x4D, 0xFF, 0xEC, 0x64, 0xF8, 0x79, 0xCF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xB8, 0xC7, 0x19, 0xEB, 0x54, 0xFF, 0x4B, 0x55, 0xFF,
-  0x29, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x88, 0x45, 0xFF, 0x68, 0x4D, 0xFF, 0x47,
-  0x4D, 0xFF, 0x48, 0x4D, 0xFF, 0x48, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x89, 0x3D,
-  0xFF, 0x89, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF,
-  0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x29, 0x4D, 0xFF, 0x10, 0x86, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x94, 0x9E, 0x5F, 0x2B, 0x55, 0xFF, 0x29, 0x45, 0xFF, 0x89,
-  0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x89, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x67, 0x3D, 0xFF,
-  0xA8, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x29, 0x45, 0xFF, 0x2B, 0x55, 0xFF, 0x2D,
-  0x65, 0xF6, 0x78, 0xCF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xCF, 0x17, 0xEB, 0x54, 0xFF, 0x6B, 0x4D,
-  0xFF, 0x09, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF,
-  0x68, 0x4D, 0xFF, 0x27, 0x45, 0xFF, 0x48, 0x4D, 0xFF, 0x48, 0x45, 0xFF, 0x69,
-  0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x49, 0x3D, 0xFF, 0x0B, 0x55, 0xFF, 0x93,
-  0xA6, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xD7, 0x0C,
-  0xEB, 0x5C, 0xFF, 0x08, 0x3D, 0xFF, 0xC9, 0x45, 0xFF, 0x88, 0x3D, 0xFF, 0x68,
-  0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x3D,
-  0xFF, 0x88, 0x3D, 0xFF, 0x87, 0x3D, 0xFF, 0x48, 0x3D, 0xFF, 0x69, 0x45, 0xFF,
-  0x6A, 0x45, 0xFF, 0x0A, 0x45, 0xFF, 0x4D, 0x65, 0xF7, 0x78, 0xC7, 0x1D, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0xCF, 0x17, 0xEC, 0x54, 0xFF, 0x4A,
-  0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x48, 0x45, 0xFF, 0x48, 0x4D, 0xFF, 0x48, 0x4D, 0xFF,
-  0x48, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x89,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0xA9, 0x45, 0xFF, 0x09, 0x3D, 0xFF,
-  0x0C, 0x5D, 0xFF, 0x57, 0xD7, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x6F, 0x75, 0xCE, 0x6B, 0x4D, 0xFF, 0x48, 0x35, 0xFF,
-  0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x4A, 0x45, 0xFF, 0x4A,
-  0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x67, 0x45, 0xFF, 0x68, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x6B, 0x4D, 0xFF,
-  0x0C, 0x5D, 0xF9, 0xB9, 0xCF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0xCF, 0x18,
-  0x0C, 0x5D, 0xFF, 0x4B, 0x4D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x48, 0x45,
-  0xFF, 0x48, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x28, 0x3D,
-  0xFF, 0x4B, 0x4D, 0xFF, 0x6F, 0x75, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xA6, 0x63, 0x4C, 0x4D,
-  0xFF, 0x49, 0x35, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x49, 0x45, 0xFF, 0x4A, 0x45, 0xFF, 0x4A, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x89, 0x45, 0xFF, 0x88, 0x3D,
-  0xFF, 0x48, 0x35, 0xFF, 0x48, 0x3D, 0xFF, 0x8B, 0x4D, 0xFF, 0xEB, 0x54, 0xF9,
-  0x77, 0xBF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xC7,
-  0x16, 0xEB, 0x5C, 0xFF, 0x29, 0x4D, 0xFF, 0x48, 0x3D, 0xFF, 0x68, 0x45, 0xFF,
-  0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x68, 0x3D,
-  0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x29, 0x45, 0xFF, 0x2B, 0x55, 0xFF, 0x75, 0xA6,
-  0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xF9, 0xCF, 0x05, 0x0C, 0x55, 0xFF, 0x8B, 0x4D, 0xFF, 0x69, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x6A, 0x3D, 0xFF,
-  0x69, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x69, 0x4D, 0xFF, 0x48,
-  0x3D, 0xFF, 0x47, 0x3D, 0xFF, 0xC9, 0x45, 0xFF, 0x88, 0x3D, 0xFF, 0x28, 0x35,
-  0xFF, 0x4A, 0x4D, 0xFF, 0x4D, 0x65, 0xF8, 0x39, 0xCF, 0x1C, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9,
-  0xCF, 0x17, 0x0C, 0x5D, 0xFF, 0x29, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x88, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x48, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x89,
-  0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x48, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x6B, 0x55, 0xFF, 0xEC,
-  0x5C, 0xFF, 0xF7, 0xBF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0x85, 0xA2, 0x2C,
-  0x55, 0xFF, 0x49, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x48, 0x45, 0xFF,
-  0x48, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x27, 0x3D, 0xFF, 0xC9,
-  0x45, 0xFF, 0x48, 0x35, 0xFF, 0x6A, 0x45, 0xFF, 0x0A, 0x45, 0xFF, 0x0D, 0x65,
-  0xF8, 0xB9, 0xCF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xB9, 0xCF, 0x17, 0x2C, 0x5D, 0xFF, 0x4A, 0x45, 0xFF, 0x69,
-  0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x88, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x48, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x89, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x2A, 0x55, 0xFF, 0xD1, 0x85, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x18, 0xBF, 0x1A, 0xCC, 0x5C, 0xFF, 0x2A, 0x4D, 0xFF, 0x68,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x48, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x27, 0x3D, 0xFF, 0xA9, 0x45, 0xFF, 0x89,
-  0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x2B, 0x55, 0xFF, 0xEC, 0x64, 0xF6, 0x59, 0xC7,
-  0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x98, 0xD7, 0x16, 0x2B, 0x5D, 0xFF, 0x29, 0x45, 0xFF,
-  0x69, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x48, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D,
-  0xFF, 0x68, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x49, 0x4D, 0xFF, 0xEA, 0x54, 0xFF, 0x57, 0xBF, 0x18,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0x85, 0xB3,
-  0x0A, 0x55, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x8A, 0x4D,
-  0xFF, 0x08, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x48, 0x3D, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x28, 0x3D, 0xFF, 0x4A, 0x45, 0xFF, 0x2B,
-  0x4D, 0xFF, 0xEC, 0x5C, 0xF6, 0xB9, 0xCF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xC7, 0x16, 0x0C, 0x5D, 0xFF, 0x2A, 0x4D,
-  0xFF, 0x49, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x48, 0x3D, 0xFF,
-  0x8A, 0x4D, 0xFF, 0x49, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D,
-  0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x87, 0x3D, 0xFF, 0x87,
-  0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x4D, 0xFF, 0x10, 0x7E,
-  0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x37, 0xC7, 0x1E, 0xEB, 0x54, 0xFF, 0x49, 0x4D, 0xFF, 0x68, 0x45, 0xFF,
-  0x88, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x28, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x68, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x29, 0x3D, 0xFF, 0x4B, 0x55, 0xFF, 0x4D,
-  0x65, 0xF3, 0x59, 0xCF, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xD7, 0x17, 0x0C,
-  0x65, 0xFF, 0x2A, 0x55, 0xFF, 0x08, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x6A, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x87, 0x3D, 0xFF, 0x87, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x2A,
-  0x4D, 0xFF, 0x57, 0xBF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x8D,
-  0xA3, 0x2A, 0x55, 0xFF, 0x69, 0x45, 0xFF, 0x89, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x69, 0x4D, 0xFF, 0x49, 0x4D, 0xFF, 0x68, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x89, 0x3D, 0xFF,
-  0x49, 0x3D, 0xFF, 0x09, 0x45, 0xFF, 0x4D, 0x65, 0xF3, 0x98, 0xC7, 0x15, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xC7, 0x16,
-  0x0C, 0x5D, 0xFF, 0x0A, 0x55, 0xFF, 0x49, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x67, 0x45, 0xFF, 0x67, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x89, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x3D, 0xFF, 0x49, 0x45, 0xFF,
-  0x2A, 0x4D, 0xFF, 0x2A, 0x4D, 0xFF, 0x30, 0x7E, 0xA5, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x57, 0xBF, 0x0C, 0x2C, 0x65, 0xF9, 0x2A, 0x45, 0xFF, 0x49, 0x3D,
-  0xFF, 0xAA, 0x45, 0xFF, 0x89, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x48, 0x45, 0xFF,
-  0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D,
-  0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x6B, 0x5D, 0xFF,
-  0xEC, 0x5C, 0xEF, 0xF9, 0xD7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xC7,
-  0x16, 0x0B, 0x5D, 0xFF, 0x2A, 0x55, 0xFF, 0x49, 0x4D, 0xFF,
-  0x49, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x67, 0x45, 0xFF, 0x67, 0x45, 0xFF, 0x68, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x4A, 0x45, 0xFF, 0x4A, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x8A, 0x45,
-  0xFF, 0x2A, 0x45, 0xFF, 0x0A, 0x55, 0xFF, 0x2C, 0x65, 0xFF, 0x57, 0xBF, 0x0B,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x9E, 0x55, 0xEB,
-  0x4C, 0xFF, 0x6B, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x48, 0x45,
-  0xFF, 0x48, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x8A, 0x4D,
-  0xFF, 0x09, 0x3D, 0xFF, 0x2A, 0x4D, 0xFF, 0x4C, 0x55, 0xFF, 0x0C, 0x55, 0xED,
-  0x98, 0xBF, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x98, 0xC7, 0x15, 0xCB, 0x5C, 0xFF, 0x0B, 0x55, 0xFF, 0x2A, 0x4D,
-  0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF,
-  0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68,
-  0x45, 0xFF, 0x48, 0x45, 0xFF, 0x6A, 0x4D, 0xFF, 0xEB, 0x54, 0xFF, 0x74, 0xA6,
-  0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x7D, 0xBC, 0x4B, 0x55, 0xFF, 0x29,
-  0x35, 0xFF, 0x89, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x08, 0x3D, 0xFF, 0xAB, 0x55, 0xFF, 0x2A, 0x45, 0xFF, 0x0A, 0x45,
-  0xFF, 0x4B, 0x4D, 0xFF, 0x8D, 0x5D, 0xE5, 0x9A, 0xC7, 0x11, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x98, 0xC7, 0x15, 0x2D, 0x65, 0xFC, 0x0B, 0x55, 0xFF, 0x2A,
-  0x4D, 0xFF, 0x29, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D,
-  0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x88, 0x45, 0xFF, 0x07, 0x3D, 0xFF, 0x4B,
-  0x55, 0xFF, 0xD0, 0x7D, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xC7, 0x0D,
-  0x2D, 0x65, 0xF2, 0x4B, 0x4D, 0xFF, 0x49, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x68,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x68, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x35, 0xFF,
-  0x68, 0x35, 0xFF, 0x89, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x29, 0x45, 0xFF, 0x6A,
-  0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x6A, 0x45, 0xFF, 0x2A, 0x45, 0xFF, 0x4D, 0x65,
-  0xE9, 0xF7, 0xBF, 0x14, 0xF8, 0xBF, 0x16, 0x4C, 0x65, 0xFD,
-  0xCA, 0x4C, 0xFF, 0x2A, 0x4D, 0xFF, 0x29, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x4A, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x88, 0x45, 0xFF, 0x48, 0x3D, 0xFF,
-  0x49, 0x4D, 0xFF, 0x2C, 0x65, 0xF1, 0x5A, 0xD7, 0x0B, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x37, 0xB7, 0x38, 0xEB, 0x54, 0xFF,
-  0x4A, 0x4D, 0xFF, 0x28, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D,
-  0xFF, 0x89, 0x35, 0xFF, 0x89, 0x35, 0xFF, 0x68, 0x35, 0xFF, 0x89, 0x3D, 0xFF,
-  0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x28, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x8A,
-  0x3D, 0xFF, 0x6A, 0x45, 0xFF, 0x2A, 0x4D, 0xFF, 0x6C, 0x5D, 0xFF, 0x4B, 0x55,
-  0xFF, 0x2A, 0x4D, 0xFF, 0x6A, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x28, 0x3D, 0xFF,
-  0x89, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x4A, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x89,
-  0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x89, 0x45, 0xFF, 0x07, 0x3D,
-  0xFF, 0x6A, 0x4D, 0xFF, 0x0A, 0x55, 0xFF, 0x36, 0xB7, 0x30,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x73, 0x9E, 0x67, 0xEB, 0x54, 0xFF, 0x6A, 0x4D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x68, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0xA9, 0x3D,
-  0xFF, 0x27, 0x35, 0xFF, 0xA9, 0x4D, 0xFF, 0x68, 0x45, 0xFF, 0x48, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x6A, 0x45, 0xFF, 0x49, 0x3D, 0xFF, 0x29, 0x45, 0xFF, 0x6A,
-  0x4D, 0xFF, 0x29, 0x45, 0xFF, 0x6A, 0x45, 0xFF, 0x29, 0x3D, 0xFF, 0x69, 0x45,
-  0xFF, 0x89, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x6A, 0x4D, 0xFF, 0xEA, 0x54, 0xFF, 0x93, 0x96,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0x8D, 0x96, 0x2B, 0x55,
-  0xFF, 0x29, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0xA8, 0x45, 0xFF, 0x47, 0x3D, 0xFF, 0x68, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x3D, 0xFF,
-  0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x48,
-  0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x48, 0x3D, 0xFF, 0x89, 0x45,
-  0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF,
-  0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x29, 0x45, 0xFF, 0x2B, 0x55, 0xFF, 0xF1,
-  0x85, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x8E, 0xA8, 0xEA, 0x4C, 0xFF, 0x49, 0x45,
-  0xFF, 0x48, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x89, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x67, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x88, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x88, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x49, 0x45, 0xFF,
-  0xEA, 0x54, 0xFF, 0x11, 0x8E, 0xAC, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-  0x8E, 0xAB, 0x0A, 0x4D, 0xFF, 0x6A, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x3D,
-  0xFF, 0x48, 0x3D, 0xFF, 0x89, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x48, 0x45, 0xFF,
-  0x48, 0x4D, 0xFF, 0x48, 0x4D, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68,
-  0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0xA9,
-  0x4D, 0xFF, 0x67, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x6A, 0x4D,
-  0xFF, 0x0A, 0x55, 0xFF, 0x11, 0x8E, 0xAF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x86, 0x99, 0x0A, 0x4D, 0xFF, 0x4A,
-  0x45, 0xFF, 0x8A, 0x45, 0xFF, 0x89, 0x3D, 0xFF, 0x47, 0x35, 0xFF, 0xA9, 0x45,
-  0xFF, 0x89, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x88,
-  0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0xA9, 0x3D, 0xFF,
-  0x89, 0x3D, 0xFF, 0x47, 0x3D, 0xFF, 0xA9, 0x4D, 0xFF, 0x68, 0x45, 0xFF, 0x29,
-  0x45, 0xFF, 0x0B, 0x55, 0xFF, 0xF1, 0x85, 0xA1, 0xF5, 0xAF, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x32, 0x8E, 0x76, 0x0B, 0x55, 0xFF, 0x6B, 0x4D, 0xFF, 0x28,
-  0x35, 0xFF, 0x89, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x48, 0x3D, 0xFF, 0x69, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x3D, 0xFF, 0x48, 0x3D, 0xFF, 0x69, 0x45, 0xFF,
-  0x28, 0x3D, 0xFF, 0x6A, 0x4D, 0xFF, 0x2A, 0x55, 0xFF, 0x52, 0x8E, 0x84, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xA6, 0x45,
-  0x0C, 0x5D, 0xFF, 0x4B, 0x55, 0xFF, 0x29, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x89,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x6A, 0x45, 0xFF, 0x4A, 0x45,
-  0xFF, 0x29, 0x3D, 0xFF, 0x4A, 0x4D, 0xFF, 0x2C, 0x5D, 0xFF, 0xB4, 0xA6, 0x53,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x17, 0xBF, 0x1B, 0x6E, 0x75, 0xD8,
-  0x0A, 0x55, 0xFF, 0x4A, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x29,
-  0x45, 0xFF, 0x4B, 0x55, 0xFF, 0x2B, 0x55, 0xFF, 0x6E, 0x6D, 0xDE, 0x38, 0xC7,
-  0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x11, 0x96, 0x83, 0x0B, 0x5D, 0xFF, 0x2A, 0x4D, 0xFF,
-  0x49, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x68, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68,
-  0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x2A, 0x4D, 0xFF, 0x2C, 0x5D, 0xFF, 0x32,
-  0x96, 0x8B, 0xFA, 0xD7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xB7,
-  0x23, 0xAE, 0x75, 0xCF, 0x0B, 0x55, 0xFF, 0x2A, 0x4D, 0xFF, 0x49, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D,
-  0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF,
-  0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45,
-  0xFF, 0x49, 0x45, 0xFF, 0x49, 0x4D, 0xFF, 0x2A, 0x4D, 0xFF, 0xCF, 0x75, 0xD5,
-  0xF6, 0xAE, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xA6,
-  0x4F, 0x6F, 0x75, 0xED, 0xAA, 0x4C, 0xFF, 0x0A, 0x4D, 0xFF, 0x6A, 0x4D, 0xFF,
-  0x49, 0x45, 0xFF, 0x48, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
-  0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x48, 0x3D, 0xFF, 0x48, 0x3D, 0xFF, 0x89, 0x45,
-  0xFF, 0x89, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
-  0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49,
-  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x4D, 0xFF, 0x69, 0x4D, 0xFF, 0x49, 0x45,
-  0xFF, 0x48, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x88, 0x3D, 0xFF,
-  0x68, 0x3D, 0xFF, 0x89, 0x3D, 0xFF, 0x48, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x6A,
-  0x4D, 0xFF, 0x0A, 0x4D, 0xFF, 0xCA, 0x4C, 0xFF, 0xAE, 0x6D, 0xF1, 0xB3, 0x9E,
-  0x5A, 0xF7, 0xBF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xAE, 0x54, 0x8E, 0x6D,
-  0xE5, 0xEA, 0x4C, 0xFF, 0x2A, 0x4D, 0xFF, 0x6A, 0x4D, 0xFF, 0x49, 0x45, 0xFF,
-  0x49, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x8A, 0x45, 0xFF, 0x89, 0x45, 0xFF, 0x89,
-  0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x89, 0x3D,
-  0xFF, 0x89, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF,
-  0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x28, 0x45, 0xFF, 0x48,
-  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x89, 0x45, 0xFF, 0x89, 0x45, 0xFF, 0x69, 0x45,
-  0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x29, 0x45, 0xFF,
-  0x6A, 0x4D, 0xFF, 0x2B, 0x55, 0xFF, 0xCB, 0x54, 0xFF, 0x8E, 0x75, 0xEB, 0xF5,
-  0xA6, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xB7, 0x34, 0xD0, 0x85, 0xB3, 0xEB, 0x5C,
-  0xFF, 0xEA, 0x54, 0xFF, 0x6A, 0x55, 0xFF, 0x49, 0x45, 0xFF,
-  0x28, 0x3D, 0xFF, 0x48, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x89, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x48, 0x45,
-  0xFF, 0x48, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x48, 0x45, 0xFF, 0x48, 0x45, 0xFF,
-  0x48, 0x45, 0xFF, 0x89, 0x45, 0xFF, 0x89, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69,
-  0x45, 0xFF, 0x48, 0x45, 0xFF, 0x28, 0x3D, 0xFF, 0x29, 0x45, 0xFF, 0x4B, 0x55,
-  0xFF, 0xEA, 0x54, 0xFF, 0xEC, 0x5C, 0xFF, 0xB0, 0x85, 0xB9, 0xF7, 0xBE, 0x3B,
-  0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xBF, 0x04, 0xF5, 0xB6, 0x57, 0xCF, 0x7D,
-  0xC0, 0x8C, 0x65, 0xFF, 0x2B, 0x55, 0xFF, 0x0A, 0x55, 0xFF, 0x2A, 0x55, 0xFF,
-  0x2A, 0x55, 0xFF, 0x29, 0x4D, 0xFF, 0x29, 0x45, 0xFF, 0x49, 0x4D, 0xFF, 0x49,
-  0x4D, 0xFF, 0x49, 0x4D, 0xFF, 0x49, 0x4D, 0xFF, 0x49, 0x4D, 0xFF, 0x49, 0x4D,
-  0xFF, 0x49, 0x4D, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x49, 0x45, 0xFF,
-  0x29, 0x45, 0xFF, 0x2A, 0x4D, 0xFF, 0x2A, 0x55, 0xFF, 0x2B, 0x5D, 0xFF, 0x6D,
-  0x6D, 0xFF, 0xAF, 0x7D, 0xBF, 0xF6, 0xAE, 0x55, 0xFF, 0xFF, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x17, 0xC7, 0x2D, 0x74, 0xAE,
-  0x79, 0xD1, 0x95, 0xBC, 0x4E, 0x7D, 0xF1, 0x0D, 0x6D, 0xFF, 0xEB, 0x5C, 0xFF,
-  0xEB, 0x5C, 0xFF, 0x0B, 0x55, 0xFF, 0x0B, 0x55, 0xFF, 0x0A, 0x4D, 0xFF, 0x0A,
-  0x4D, 0xFF, 0x2B, 0x4D, 0xFF, 0x2B, 0x4D, 0xFF, 0x2B, 0x55, 0xFF, 0xEB, 0x54,
-  0xFF, 0x2D, 0x65, 0xFF, 0x8F, 0x75, 0xF5, 0x11, 0x8E, 0xBD,
-  0x94, 0x9E, 0x7C, 0x36, 0xBF, 0x30, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x5A, 0xD7, 0x0B, 0x17, 0xBF, 0x25, 0x17, 0xB7, 0x3D,
-  0x16, 0xAF, 0x4A, 0x16, 0xA7, 0x54, 0x16, 0xA7, 0x54, 0x16, 0xAF, 0x4A, 0x36,
-  0xAF, 0x3E, 0x56, 0xB7, 0x27, 0x5A, 0xBF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x52, 0x4C, 0x45, 0x03, 0x00, 0x00, 0x1E, 0x00, 0x47, 0x00, 0x78, 0x00, 0xB4,
+  0x00, 0xE8, 0x00, 0x17, 0x01, 0x48, 0x01, 0x78, 0x01, 0xA1, 0x01, 0xE8, 0x01,
+  0x30, 0x02, 0x78, 0x02, 0xBE, 0x02, 0x01, 0x03, 0x3E, 0x03, 0x75, 0x03, 0xAD,
+  0x03, 0xEE, 0x03, 0x35, 0x04, 0x6E, 0x04, 0xA3, 0x04, 0xD4, 0x04, 0xFC, 0x04,
+  0x2C, 0x05, 0x88, 0x00, 0x00, 0x00, 0x06, 0x36, 0xBF, 0x01, 0xCF, 0x85, 0x16,
+  0x6D, 0x6D, 0x2B, 0xCE, 0x6D, 0x39, 0xAE, 0x6D, 0x31, 0xAE, 0x75, 0x1E, 0xB5,
+  0xAE, 0x05, 0x88, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x04, 0xD0, 0x7D,
+  0x16, 0x4C, 0x5D, 0x75, 0x6A, 0x4D, 0xC9, 0x4A, 0x4D, 0xF1, 0x49, 0x4D, 0xFF,
+  0x81, 0x49, 0x45, 0xFF, 0x03, 0x6A, 0x4D, 0xF9, 0x4A, 0x4D, 0xDA, 0x4C, 0x5D,
+  0x93, 0x8F, 0x75, 0x2D, 0x86, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x03,
+  0xAE, 0x6D, 0x08, 0x6C, 0x5D, 0x7B, 0x4A, 0x45, 0xF2, 0x68, 0x45, 0xFF, 0x81,
+  0x69, 0x45, 0xFF, 0x81, 0x69, 0x3D, 0xFF, 0x81, 0x69, 0x45, 0xFF, 0x04, 0x69,
+  0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFD, 0x6B, 0x55, 0xA6, 0xAE, 0x75,
+  0x1B, 0x84, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x10, 0xEF, 0x6D, 0x18,
+  0x4B, 0x55, 0xBE, 0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x68,
+  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D,
+  0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x88, 0x3D, 0xFF, 0x69, 0x3D, 0xFF,
+  0x69, 0x45, 0xFF, 0x4A, 0x4D, 0xE2, 0x6D, 0x6D, 0x3C, 0x83, 0x00, 0x00, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x01, 0xCE, 0x75, 0x16, 0x4B, 0x55, 0xD3, 0x81, 0x69,
+  0x45, 0xFF, 0x00, 0x68, 0x45, 0xFF, 0x84, 0x69, 0x45, 0xFF, 0x81, 0x68, 0x3D,
+  0xFF, 0x01, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x81, 0x69, 0x45, 0xFF, 0x02,
+  0x68, 0x45, 0xFF, 0x4A, 0x4D, 0xF3, 0xAE, 0x6D, 0x40, 0x82, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x7D, 0x06, 0x4B, 0x55, 0xB6, 0x89, 0x69,
+  0x45, 0xFF, 0x08, 0x69, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49,
+  0x45, 0xFF, 0x4A, 0x55, 0xBD, 0x4A, 0x4D, 0xC9, 0x69, 0x45, 0xFF, 0x4A, 0x4D,
+  0xE7, 0xAE, 0x6D, 0x22, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x01,
+  0x6C, 0x5D, 0x6E, 0x68, 0x45, 0xFF, 0x89, 0x69, 0x45, 0xFF, 0x0A, 0x68, 0x45,
+  0xFF, 0x49, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x4A, 0x4D, 0xB8, 0x6E, 0x6D, 0x0B,
+  0x6D, 0x65, 0x12, 0x4A, 0x4D, 0xC7, 0x69, 0x45, 0xFF, 0x4B, 0x55, 0xB9, 0x38,
+  0xBF, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xF1, 0x8D, 0x0C, 0x4A,
+  0x4D, 0xEA, 0x81, 0x69, 0x3D, 0xFF, 0x89, 0x69, 0x45, 0xFF, 0x02, 0x69, 0x3D,
+  0xFF, 0x4A, 0x4D, 0xBB, 0x8E, 0x75, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x04, 0xAE,
+  0x6D, 0x13, 0x4B, 0x4D, 0xCB, 0x69, 0x45, 0xFE, 0x8F, 0x6D, 0x44, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x4C, 0x65, 0x66, 0x68, 0x45, 0xFF, 0x8B, 0x69,
+  0x45, 0xFF, 0x01, 0x4B, 0x55, 0xB7, 0xAE, 0x6D, 0x0C, 0x82, 0x00, 0x00, 0x00,
+  0x04, 0xCF, 0x7D, 0x0F, 0x4A, 0x4D, 0xC6, 0x69, 0x45, 0xFF, 0x4B, 0x55, 0xB1,
+  0xF8, 0xC7, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x4B, 0x55, 0xB6, 0x68, 0x3D, 0xFF,
+  0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x68,
+  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45,
+  0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x4A, 0x4D, 0xBB, 0x8E, 0x75, 0x0C,
+  0x82, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x7D, 0x10, 0x4B, 0x4D, 0xC0, 0x81, 0x49,
+  0x45, 0xFF, 0x01, 0x4A, 0x4D, 0xEF, 0x10, 0x7E, 0x14, 0x0E, 0x53, 0x9E, 0x0A,
+  0x4A, 0x4D, 0xE4, 0x48, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69,
+  0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x69, 0x45,
+  0xFF, 0x68, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x4A, 0x55, 0xBD,
+  0x8D, 0x6D, 0x0D, 0x82, 0x00, 0x00, 0x00, 0x06, 0xF0, 0x7D, 0x0F, 0x4B, 0x4D,
+  0xC2, 0x49, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x49, 0x45, 0xFF,
+  0x8E, 0x6D, 0x3B, 0x0D, 0x6E, 0x75, 0x1D, 0x6A, 0x45, 0xF9, 0x49, 0x45, 0xFF,
+  0x68, 0x3D, 0xFF, 0x69, 0x3D, 0xFF, 0x2A, 0x4D, 0xD4, 0x6C, 0x5D, 0x60, 0x4A,
+  0x45, 0xF3, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x3D,
+  0xFF, 0x4A, 0x4D, 0xBD, 0x4D, 0x65, 0x0D, 0x82, 0x00, 0x00, 0x00, 0x07, 0x8F,
+  0x7D, 0x0F, 0x4B, 0x55, 0xBF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x89, 0x3D,
+  0xFF, 0x69, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x4D, 0x65, 0x66, 0x0C, 0x0C, 0x65,
+  0x22, 0x49, 0x45, 0xFE, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x2A, 0x55, 0xD4,
+  0x8D, 0x6D, 0x1B, 0x77, 0xBF, 0x00, 0x6C, 0x5D, 0x48, 0x49, 0x4D, 0xF5, 0x49,
+  0x45, 0xFF, 0x69, 0x45, 0xFF, 0x4A, 0x4D, 0xBD, 0x6D, 0x6D, 0x0D, 0x82, 0x00,
+  0x00, 0x00, 0x01, 0xAE, 0x75, 0x0E, 0x4A, 0x4D, 0xBF, 0x81, 0x69, 0x45, 0xFF,
+  0x00, 0x69, 0x3D, 0xFF, 0x81, 0x49, 0x45, 0xFF, 0x01, 0x68, 0x45, 0xFF, 0x0C,
+  0x5D, 0x6D, 0x04, 0x4C, 0x6D, 0x20, 0x69, 0x4D, 0xFB, 0x69, 0x45, 0xFF, 0x6A,
+  0x4D, 0xE4, 0xAF, 0x7D, 0x1C, 0x82, 0x00, 0x00, 0x00, 0x03, 0x6C, 0x5D, 0x4D,
+  0x4A, 0x4D, 0xF4, 0x2A, 0x4D, 0xBE, 0x4D, 0x6D, 0x0E, 0x82, 0x00, 0x00, 0x00,
+  0x02, 0xAF, 0x75, 0x0E, 0x2A, 0x55, 0xBD, 0x49, 0x45, 0xFF, 0x81, 0x69, 0x45,
+  0xFF, 0x04, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x49, 0x45,
+  0xFF, 0x2C, 0x65, 0x6B, 0x05, 0xF1, 0x95, 0x12, 0x6A, 0x4D, 0xEC, 0x49, 0x45,
+  0xFF, 0x69, 0x45, 0xFA, 0x2D, 0x65, 0x58, 0x78, 0xC7, 0x00, 0x81, 0x00, 0x00,
+  0x00, 0x02, 0x59, 0xCF, 0x00, 0x0D, 0x6D, 0x35, 0x4E, 0x6D, 0x0D, 0x82, 0x00,
+  0x00, 0x00, 0x03, 0xAE, 0x75, 0x0C, 0x4B, 0x55, 0xBD, 0x69, 0x45, 0xFF, 0x49,
+  0x45, 0xFF, 0x84, 0x69, 0x45, 0xFF, 0x01, 0x68, 0x45, 0xFF, 0xAE, 0x75, 0x4A,
+  0x01, 0x58, 0xC7, 0x00, 0x4B, 0x55, 0xCA, 0x81, 0x68, 0x45, 0xFF, 0x02, 0x49,
+  0x45, 0xF8, 0x4C, 0x65, 0x5A, 0x78, 0xCF, 0x00, 0x85, 0x00, 0x00, 0x00, 0x05,
+  0x8E, 0x6D, 0x0D, 0x2B, 0x55, 0xBC, 0x68, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69,
+  0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x83, 0x69, 0x45, 0xFF, 0x01, 0x69, 0x45, 0xF8,
+  0xAE, 0x75, 0x1E, 0x07, 0x00, 0x00, 0x00, 0x4C, 0x5D, 0x7F, 0x69, 0x3D, 0xFF,
+  0x49, 0x45, 0xFF, 0x68, 0x45, 0xFF, 0x69, 0x45, 0xF9, 0x6C, 0x5D, 0x57, 0x39,
+  0xCF, 0x00, 0x83, 0x00, 0x00, 0x00, 0x04, 0x8E, 0x75, 0x0C, 0x4A, 0x4D, 0xBB,
+  0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x85, 0x69, 0x45, 0xFF,
+  0x01, 0x4B, 0x55, 0xC8, 0xD4, 0xB6, 0x02, 0x08, 0x00, 0x00, 0x00, 0x8F, 0x6D,
+  0x20, 0x4A, 0x4D, 0xF9, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x68, 0x45, 0xFF,
+  0x4A, 0x45, 0xF9, 0x4D, 0x65, 0x59, 0xB9, 0xCF, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x06, 0x8E, 0x75, 0x0D, 0x4A, 0x4D, 0xBC, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF,
+  0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x84, 0x69, 0x45, 0xFF,
+  0x01, 0x4C, 0x65, 0x64, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x0A, 0x4B,
+  0x5D, 0x9A, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45,
+  0xFF, 0x49, 0x45, 0xF8, 0x6D, 0x65, 0x54, 0x98, 0xBF, 0x00, 0x8E, 0x75, 0x0C,
+  0x2B, 0x55, 0xBB, 0x49, 0x45, 0xFF, 0x81, 0x69, 0x45, 0xFF, 0x00, 0x68, 0x45,
+  0xFF, 0x81, 0x69, 0x45, 0xFF, 0x00, 0x68, 0x45, 0xFF, 0x81, 0x69, 0x45, 0xFF,
+  0x03, 0x69, 0x3D, 0xFF, 0x4A, 0x4D, 0xDD, 0x72, 0x8E, 0x07, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0x75, 0x16, 0x4B, 0x4D, 0xDF, 0x68, 0x45,
+  0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x45, 0xFF, 0x4A, 0x4D, 0xF7,
+  0x6C, 0x5D, 0x60, 0x2B, 0x55, 0xBC, 0x49, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x85,
+  0x69, 0x45, 0xFF, 0x81, 0x69, 0x3D, 0xFF, 0x01, 0x49, 0x45, 0xF9, 0x6D, 0x6D,
+  0x45, 0x81, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x09, 0x6E, 0x6D, 0x39,
+  0x4A, 0x4D, 0xF3, 0x49, 0x45, 0xFF, 0x69, 0x3D, 0xFF, 0x68, 0x45, 0xFF, 0x69,
+  0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x68, 0x3D, 0xFF, 0x69, 0x3D,
+  0xFF, 0x86, 0x69, 0x45, 0xFF, 0x02, 0x49, 0x45, 0xFE, 0x6C, 0x65, 0x78, 0x36,
+  0xB7, 0x01, 0x81, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x04, 0x8D, 0x65,
+  0x41, 0x4A, 0x4D, 0xE9, 0x69, 0x3D, 0xFF, 0x49, 0x45, 0xFF, 0x68, 0x3D, 0xFF,
+  0x83, 0x69, 0x45, 0xFF, 0x00, 0x68, 0x45, 0xFF, 0x83, 0x69, 0x45, 0xFF, 0x03,
+  0x69, 0x3D, 0xFF, 0x69, 0x45, 0xFA, 0x6C, 0x65, 0x7C, 0xFF, 0xFF, 0x00, 0x82,
+  0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x02, 0x6E, 0x6D, 0x26, 0x4B, 0x55,
+  0xC1, 0x49, 0x45, 0xFF, 0x81, 0x69, 0x45, 0xFF, 0x81, 0x68, 0x3D, 0xFF, 0x85,
+  0x69, 0x45, 0xFF, 0x02, 0x4A, 0x4D, 0xE4, 0x8D, 0x65, 0x4E, 0xB4, 0xA6, 0x01,
+  0x83, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x0C, 0x95, 0xA6, 0x02, 0x4D,
+  0x65, 0x53, 0x4B, 0x55, 0xC0, 0x6A, 0x4D, 0xF7, 0x69, 0x45, 0xFF, 0x69, 0x3D,
+  0xFF, 0x69, 0x45, 0xFF, 0x49, 0x45, 0xFF, 0x69, 0x45, 0xFF, 0x69, 0x45, 0xFD,
+  0x4B, 0x55, 0xD7, 0x4C, 0x65, 0x76, 0x31, 0x86, 0x0E, 0x85, 0x00, 0x00, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x08, 0x15, 0xB7, 0x01, 0xCE, 0x75, 0x1F, 0x6E, 0x75,
+  0x57, 0x2B, 0x5D, 0x74, 0x6C, 0x5D, 0x83, 0x6C, 0x5D, 0x7A, 0x6D, 0x65, 0x64,
+  0xAE, 0x75, 0x2E, 0x73, 0x9E, 0x06, 0x87, 0x00, 0x00, 0x00,
 };
 const lv_img_dsc_t ui_img_tick_icon_png = {
   .header.always_zero = 0,
-  .header.w = 87,
-  .header.h = 87,
+  .header.w = 25,
+  .header.h = 25,
   .data_size = sizeof(ui_img_tick_icon_png_data),
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = ui_img_tick_icon_png_data
 };
@@ -10,2849 +10,290 @@
 #endif
 
 // IMAGE DATA: assets\warning_icon.png
+// Scaled to zoom 100 from 110x110 by tools/img_rle_convert.py
+// RLE encoded by tools/img_rle_convert.py, 5547 bytes raw
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_warning_icon_png_data[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x05, 0xFB, 0xFE, 0x0F,
-  0x1C, 0xFF, 0x12, 0xDC, 0xFE, 0x15, 0x7D, 0xFF, 0x0E, 0xFF, 0xFF, 0x01, 0xFF,
-  0xFF, 0x01, 0xFF, 0xFF, 0x01, 0xFD, 0xFE, 0x16, 0xDC, 0xFE, 0x14, 0x3C, 0xFF,
-  0x13, 0x3C, 0xFF, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xF7, 0xFF, 0x04, 0x7B, 0xFF, 0x0F, 0x5D, 0xFF, 0x0D, 0xBA, 0xFE, 0x1E, 0x17,
-  0xFE, 0x45, 0x14, 0xED, 0x77, 0x11, 0xDC, 0xAB, 0xAF, 0xDB, 0xCF, 0x4D, 0xCB,
-  0xDC, 0xEC, 0xC2, 0xE2, 0xCB, 0xC2, 0xE7, 0x6A, 0xBA, 0xEB,
-  0x6A, 0xBA, 0xED, 0x29, 0xB2, 0xF0, 0x4A, 0xB2, 0xEF, 0x6A, 0xB2, 0xEB, 0xCB,
-  0xBA, 0xE5, 0x6D, 0xC3, 0xD7, 0x0F, 0xD4, 0xBE, 0xB2, 0xDC, 0x97, 0x34, 0xED,
-  0x70, 0x75, 0xF5, 0x4C, 0x7A, 0xFE, 0x24, 0xFB, 0xFE, 0x0F, 0x5D, 0xFF, 0x0D,
-  0xFA, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0xFF, 0x01, 0x5A, 0xFF, 0x0B, 0xFA, 0xFF, 0x06, 0x37, 0xFE, 0x2D, 0xF1, 0xFC,
-  0x79, 0x4C, 0xDB, 0xC9, 0x68, 0xCA, 0xF6, 0xC6, 0xC1, 0xFF, 0xC7, 0xC1, 0xFF,
-  0xC7, 0xC9, 0xFF, 0xE7, 0xD1, 0xFF, 0xC7, 0xC9, 0xFF, 0x86, 0xC9, 0xFF, 0xA6,
-  0xC9, 0xFF, 0xA6, 0xC9, 0xFF, 0xA6, 0xC9, 0xFF, 0xC6, 0xD1, 0xFF, 0xC6, 0xC9,
-  0xFF, 0xC6, 0xD1, 0xFF, 0xC6, 0xC9, 0xFF, 0xC6, 0xC9, 0xFF, 0xC6, 0xC9, 0xFF,
-  0xC6, 0xC9, 0xFF, 0xC6, 0xC1, 0xFF, 0xC6, 0xC9, 0xFF, 0xE7, 0xC9, 0xFF, 0xE7,
-  0xC9, 0xFF, 0x69, 0xCA, 0xEE, 0x8E, 0xDB, 0xC0, 0xD2, 0xEC, 0x81, 0x17, 0xFE,
-  0x3F, 0xFB, 0xFE, 0x17, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0x0C, 0x9A, 0xFE, 0x16, 0x55, 0xF5, 0x57,
-  0xEE, 0xD3, 0xAD, 0x48, 0xBA, 0xEF, 0x07, 0xBA, 0xFF, 0xE6, 0xC9, 0xFF, 0xC6,
-  0xD1, 0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x65, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF, 0xC6, 0xD1, 0xFF,
-  0xC6, 0xD1, 0xFF, 0xA5, 0xD1, 0xFF, 0xC6, 0xD1, 0xFF, 0xA5, 0xC9, 0xFF, 0xA5,
-  0xC9, 0xFF, 0xA5, 0xC9, 0xFF, 0xC6, 0xD1, 0xFF, 0xA6, 0xD9, 0xFF, 0xA6, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xE1, 0xFF,
-  0x65, 0xD9, 0xFF, 0xA6, 0xD1, 0xFF, 0xA6, 0xB9, 0xFF, 0xC7, 0xA9, 0xFF, 0x8A,
-  0xB2, 0xF1, 0x30, 0xD4, 0xA8, 0xD7, 0xFD, 0x52, 0x5D, 0xFF, 0x0C, 0xFF, 0xFF,
-  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xF8, 0xFD, 0x39, 0xF0,
-  0xE3, 0xA8, 0x4A, 0xCA, 0xF6, 0xC7, 0xC9, 0xFF, 0x86, 0xC9, 0xFF, 0xA6, 0xD1,
-  0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0xC6, 0xD1, 0xFF,
-  0xA6, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF, 0xC7,
-  0xC9, 0xFF, 0x08, 0xC2, 0xFF, 0xE7, 0xC1, 0xFF, 0xE7, 0xB9, 0xFF, 0xE6, 0xB1,
-  0xFF, 0xE6, 0xB1, 0xFF, 0x27, 0xB2, 0xFF, 0x27, 0xB2, 0xFF, 0x27, 0xBA, 0xFF,
-  0x07, 0xBA, 0xFF, 0xE7, 0xC1, 0xFF, 0xA6, 0xC1, 0xFF, 0xC7, 0xC9, 0xFF, 0xA7,
-  0xD1, 0xFF, 0xA8, 0xD9, 0xFF, 0x87, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x65, 0xD9,
-  0xFF, 0x66, 0xE1, 0xFF, 0xA6, 0xE1, 0xFF, 0xC7, 0xD9, 0xFF, 0xC7, 0xD1, 0xFF,
-  0xA6, 0xC1, 0xFF, 0xE8, 0xC1, 0xFF, 0x09, 0xC2, 0xF4, 0xF0, 0xEB, 0xA4, 0x76,
-  0xFD, 0x48, 0xDB, 0xFE, 0x15, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x3A, 0xFF,
-  0x13, 0x34, 0xED, 0x69, 0xEB, 0xBA, 0xD9, 0x08, 0xBA, 0xFF, 0xA7, 0xC9, 0xFF,
-  0x66, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x87, 0xD9, 0xFF, 0xA7,
-  0xD1, 0xFF, 0xC7, 0xC1, 0xFF, 0xE7, 0xB9, 0xFF, 0xE7, 0xB9, 0xFF, 0x08, 0xBA,
-  0xFF, 0xAA, 0xCA, 0xFF, 0x4C, 0xDB, 0xFF, 0x30, 0xE4, 0xFF, 0xD3, 0xF4, 0xFF,
-  0x55, 0xFD, 0xFF, 0xF7, 0xFD, 0xFF, 0x38, 0xFE, 0xFF, 0x79, 0xFE, 0xFF, 0x99,
-  0xFE, 0xFF, 0x79, 0xFE, 0xFF, 0x78, 0xFE, 0xFF, 0x37, 0xFE, 0xFF, 0xD7, 0xFD,
-  0xFF, 0x55, 0xFD, 0xFF, 0xF4, 0xFC, 0xFF, 0xF1, 0xEB, 0xFF,
-  0x2E, 0xDB, 0xFF, 0x8B, 0xCA, 0xFF, 0xE8, 0xB9, 0xFF, 0xE7, 0xC1, 0xFF, 0xC7,
-  0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0x66, 0xD1, 0xFF, 0xA6, 0xE1, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0xA7, 0xD9, 0xFF, 0xA7, 0xD1, 0xFF, 0xE8, 0xB9, 0xFF,
-  0x0C, 0xCB, 0xDD, 0xF3, 0xE4, 0x6C, 0x1C, 0xFF, 0x1A, 0xFF, 0xFF, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFB, 0xFE, 0x08, 0xF3, 0xFC, 0x71, 0x69, 0xC2, 0xE9, 0xC6,
-  0xC1, 0xFF, 0xC6, 0xC9, 0xFF, 0xA5, 0xD1, 0xFF, 0x85, 0xD9, 0xFF, 0xC6, 0xD9,
-  0xFF, 0x86, 0xD1, 0xFF, 0xA6, 0xC9, 0xFF, 0xC8, 0xB9, 0xFF, 0x49, 0xB2, 0xFF,
-  0x4E, 0xC3, 0xFF, 0xB3, 0xDC, 0xFF, 0x18, 0xFE, 0xFF, 0xFC, 0xFE, 0xFF, 0x7D,
-  0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBE, 0xFF,
-  0xFF, 0x9E, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF,
-  0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE,
-  0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x9E, 0xFF,
-  0xFF, 0x1C, 0xFF, 0xFF, 0x18, 0xFE, 0xFF, 0xB3, 0xE4, 0xFF, 0x4D, 0xCB, 0xFF,
-  0x28, 0xC2, 0xFF, 0xC7, 0xC9, 0xFF, 0xC6, 0xD1, 0xFF, 0xA5, 0xD1, 0xFF, 0xA6,
-  0xD9, 0xFF, 0x85, 0xD1, 0xFF, 0xA6, 0xD9, 0xFF, 0x87, 0xC9, 0xFF, 0xA8, 0xC1,
-  0xFF, 0x8B, 0xCA, 0xED, 0x51, 0xE4, 0x7F, 0xDB, 0xFE, 0x1B,
-  0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0x02, 0x1A, 0xFF, 0x11, 0x75, 0xF5, 0x61, 0x6A, 0xBA,
-  0xE3, 0xC7, 0xC1, 0xFF, 0x85, 0xD1, 0xFF, 0xC6, 0xE1, 0xFF,
-  0x85, 0xD9, 0xFF, 0x65, 0xC9, 0xFF, 0xE7, 0xD1, 0xFF, 0xC6, 0xB9, 0xFF, 0x07,
-  0xB2, 0xFF, 0x10, 0xE4, 0xFF, 0x96, 0xFD, 0xFF, 0xDB, 0xFE, 0xFF, 0x9E, 0xFF,
-  0xFF, 0xBF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF,
-  0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF,
-  0xFF, 0x9E, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF,
-  0xDE, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0xFB, 0xFE,
-  0xFF, 0x95, 0xFD, 0xFF, 0xAD, 0xE3, 0xFF, 0x47, 0xBA, 0xFF, 0xE6, 0xC1, 0xFF,
-  0xC6, 0xC9, 0xFF, 0xC7, 0xD9, 0xFF, 0x87, 0xE1, 0xFF, 0x67, 0xD9, 0xFF, 0xA8,
-  0xD9, 0xFF, 0xE8, 0xC9, 0xFF, 0x29, 0xBA, 0xE9, 0xF3, 0xF4, 0x72, 0x1C, 0xFF,
-  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x0A,
-  0xB6, 0xFD, 0x4B, 0xEB, 0xCA, 0xDB, 0xE8, 0xC9, 0xFF, 0x86, 0xC9, 0xFF, 0xA7,
-  0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0xC7, 0xD1, 0xFF, 0x08, 0xBA,
-  0xFF, 0x2C, 0xC3, 0xFF, 0x96, 0xFD, 0xFF, 0x5D, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF,
-  0xDE, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xDE,
-  0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x7D, 0xFF,
-  0xFF, 0x5D, 0xFF, 0xFF, 0xFB, 0xFE, 0xFF, 0x9A, 0xFE, 0xFF,
-  0x39, 0xFE, 0xFF, 0xF8, 0xFD, 0xFF, 0xF7, 0xFD, 0xFF, 0xD7, 0xFD, 0xFF, 0xF8,
-  0xFD, 0xFF, 0x59, 0xFE, 0xFF, 0xDA, 0xFE, 0xFF, 0x3C, 0xFF, 0xFF, 0x5C, 0xFF,
-  0xFF, 0x7D, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xDE,
-  0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x5C, 0xFF, 0xFF, 0x95, 0xF5, 0xFF, 0x2C, 0xCB,
-  0xFF, 0xC8, 0xC1, 0xFF, 0xA7, 0xD1, 0xFF, 0x67, 0xD9, 0xFF, 0x66, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0xE7, 0xD1, 0xFF, 0xA6, 0xC1, 0xFF, 0xCB, 0xD2, 0xD6, 0xF7,
-  0xFD, 0x45, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xFF, 0x13, 0xEF, 0xD3, 0xA9, 0x08, 0xB2,
-  0xFF, 0xA7, 0xC9, 0xFF, 0x25, 0xC9, 0xFF, 0x08, 0xE2, 0xFF, 0x45, 0xC9, 0xFF,
-  0xA7, 0xC9, 0xFF, 0xE8, 0xC1, 0xFF, 0xAF, 0xE3, 0xFF, 0x18, 0xFE, 0xFF, 0x7D,
-  0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xDE, 0xFF,
-  0xFF, 0xDE, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF,
-  0x38, 0xFE, 0xFF, 0xF3, 0xEC, 0xFF, 0x10, 0xD4, 0xFF, 0xEB, 0xC2, 0xFF, 0x8A,
-  0xC2, 0xFF, 0x28, 0xB2, 0xFF, 0xE7, 0xB1, 0xFF, 0xE7, 0xB1, 0xFF, 0x07, 0xBA,
-  0xFF, 0x08, 0xBA, 0xFF, 0x07, 0xBA, 0xFF, 0x08, 0xBA, 0xFF, 0x07, 0xBA, 0xFF,
-  0x07, 0xB2, 0xFF, 0x28, 0xAA, 0xFF, 0xA9, 0xB2, 0xFF, 0x6C, 0xC3, 0xFF, 0x4F,
-  0xDC, 0xFF, 0xF2, 0xE4, 0xFF, 0x38, 0xFE, 0xFF, 0x3C, 0xFF, 0xFF, 0x9E, 0xFF,
-  0xFF, 0xBE, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF,
-  0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0x18,
-  0xFE, 0xFF, 0x8E, 0xE3, 0xFF, 0xE8, 0xC1, 0xFF, 0xC6, 0xC9, 0xFF, 0xC6, 0xD1,
-  0xFF, 0x85, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0xC7, 0xD1, 0xFF, 0x28, 0xBA, 0xFF,
-  0xAE, 0xCB, 0xAF, 0x9A, 0xFE, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03,
-  0x96, 0xFD, 0x52, 0x49, 0xBA, 0xE8, 0xC7, 0xC9, 0xFF, 0xA7, 0xD1, 0xFF, 0xA7,
-  0xD1, 0xFF, 0xA7, 0xC9, 0xFF, 0x86, 0xB9, 0xFF, 0x49, 0xBA, 0xFF, 0xF0, 0xD3,
-  0xFF, 0x7A, 0xFE, 0xFF, 0x9E, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x5D, 0xFF, 0xFF, 0x59,
-  0xFE, 0xFF, 0x92, 0xFC, 0xFF, 0xCB, 0xD2, 0xFF, 0xE7, 0xB9, 0xFF, 0xE7, 0xC1,
-  0xFF, 0xE7, 0xC1, 0xFF, 0xA6, 0xC1, 0xFF, 0x07, 0xCA, 0xFF, 0xE6, 0xC9, 0xFF,
-  0xA6, 0xC9, 0xFF, 0xA6, 0xC9, 0xFF, 0xA6, 0xC9, 0xFF, 0xC6, 0xD1, 0xFF, 0xA6,
-  0xD1, 0xFF, 0x85, 0xC9, 0xFF, 0xA6, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF, 0xC6, 0xC9,
-  0xFF, 0xC6, 0xC9, 0xFF, 0xA5, 0xC1, 0xFF, 0xC6, 0xC1, 0xFF, 0xE6, 0xC1, 0xFF,
-  0x27, 0xC2, 0xFF, 0x27, 0xBA, 0xFF, 0x69, 0xBA, 0xFF, 0xEB, 0xCA, 0xFF, 0x31,
-  0xEC, 0xFF, 0x39, 0xFE, 0xFF, 0x7E, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF,
-  0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF,
-  0xD9, 0xFE, 0xFF, 0x0F, 0xDC, 0xFF, 0xE6, 0xB1, 0xFF, 0x07, 0xCA, 0xFF, 0xA7,
-  0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0xC7, 0xC9, 0xFF, 0x08, 0xC2, 0xFF, 0xAB, 0xBA,
-  0xE4, 0xB6, 0xFD, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFB, 0xFE, 0x10, 0x30, 0xCC, 0xA0, 0x08, 0xBA, 0xFF, 0x86, 0xC9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xC1, 0xFF, 0x28, 0xC2, 0xFF,
-  0x6D, 0xD3, 0xFF, 0x79, 0xFE, 0xFF, 0x9E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9E,
-  0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x7A, 0xFE,
-  0xFF, 0x92, 0xDC, 0xFF, 0xCB, 0xBA, 0xFF, 0x08, 0xBA, 0xFF,
-  0x86, 0xC1, 0xFF, 0x86, 0xD1, 0xFF, 0xA6, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x65, 0xD1, 0xFF, 0x85, 0xD1, 0xFF, 0x85, 0xD9,
-  0xFF, 0xA5, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0xA5, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0xA6,
-  0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD1,
-  0xFF, 0x65, 0xC9, 0xFF, 0xA6, 0xD1, 0xFF, 0xE7, 0xD1, 0xFF, 0xE8, 0xC9, 0xFF,
-  0xE8, 0xB9, 0xFF, 0x8B, 0xBA, 0xFF, 0x93, 0xE4, 0xFF, 0x9B, 0xFE, 0xFF, 0xBE,
-  0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xBD, 0xFF,
-  0xFF, 0x9D, 0xFF, 0xFF, 0x79, 0xFE, 0xFF, 0x4D, 0xCB, 0xFF, 0xC7, 0xB9, 0xFF,
-  0x09, 0xD2, 0xFF, 0x86, 0xC9, 0xFF, 0x86, 0xC9, 0xFF, 0xA6, 0xC1, 0xFF, 0x08,
-  0xBA, 0xFE, 0x71, 0xE4, 0x9B, 0x1C, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFE, 0x21,
-  0x0C, 0xC3, 0xD4, 0xE7, 0xC1, 0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xC6,
-  0xD9, 0xFF, 0xC6, 0xC9, 0xFF, 0x89, 0xBA, 0xFF, 0xB6, 0xFD, 0xFF, 0x9E, 0xFF,
-  0xFF, 0xBE, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF,
-  0x5D, 0xFF, 0xFF, 0xD7, 0xFD, 0xFF, 0x2D, 0xDB, 0xFF, 0xE7, 0xC1, 0xFF, 0xC7,
-  0xD1, 0xFF, 0xA6, 0xC9, 0xFF, 0xA7, 0xD1, 0xFF, 0xC7, 0xD1, 0xFF, 0xA7, 0xD9,
-  0xFF, 0xA6, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x45, 0xD9, 0xFF,
-  0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0xA6, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x65,
-  0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xE1, 0xFF, 0x65, 0xD9,
-  0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF,
-  0x86, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0xA6,
-  0xE9, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD1, 0xFF, 0xC6, 0xD9, 0xFF, 0xC7, 0xD1,
-  0xFF, 0xA7, 0xC9, 0xFF, 0xA7, 0xC9, 0xFF, 0xE8, 0xC1, 0xFF, 0x2D, 0xD3, 0xFF,
-  0xF7, 0xFD, 0xFF, 0x9D, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0x9E,
-  0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xD7, 0xFD, 0xFF, 0x8A, 0xBA,
-  0xFF, 0xE7, 0xC9, 0xFF, 0x86, 0xD1, 0xFF, 0xE7, 0xE9, 0xFF, 0x85, 0xD9, 0xFF,
-  0xC6, 0xC1, 0xFF, 0x6C, 0xD3, 0xCF, 0x99, 0xFE, 0x26, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFD, 0x43, 0x8A, 0xBA, 0xEA, 0xA6, 0xC1,
-  0xFF, 0xC7, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD1, 0xFF, 0xE6, 0xC1, 0xFF,
-  0x0F, 0xE4, 0xFF, 0x1B, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x75, 0xFD, 0xFF, 0x0B, 0xCB,
-  0xFF, 0xC7, 0xC1, 0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xE1, 0xFF, 0x45, 0xE1, 0xFF,
-  0x65, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD1, 0xFF, 0x66,
-  0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1,
-  0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xE1, 0xFF,
-  0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66,
-  0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x66, 0xE1,
-  0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE9, 0xFF, 0x46, 0xE9, 0xFF, 0x65, 0xE1, 0xFF,
-  0xA6, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD1, 0xFF, 0xA6, 0xE1, 0xFF, 0x86,
-  0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0xC7, 0xD1, 0xFF, 0xC7, 0xB9, 0xFF, 0xEB, 0xBA,
-  0xFF, 0x95, 0xF5, 0xFF, 0x9E, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xDB, 0xFE, 0xFF, 0x10,
-  0xE4, 0xFF, 0x07, 0xC2, 0xFF, 0x45, 0xC9, 0xFF, 0xC6, 0xE1, 0xFF, 0xA5, 0xD9,
-  0xFF, 0xC6, 0xC1, 0xFF, 0xAA, 0xBA, 0xE6, 0x59, 0xFE, 0x38, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x75, 0xFD, 0x5B,
-  0xE7, 0xC1, 0xFC, 0x85, 0xD1, 0xFF, 0xA6, 0xE1, 0xFF, 0xA5, 0xD1, 0xFF, 0xC7,
-  0xC9, 0xFF, 0x49, 0xBA, 0xFF, 0x96, 0xFD, 0xFF, 0x9E, 0xFF, 0xFF, 0xDE, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF,
-  0x95, 0xFD, 0xFF, 0x0B, 0xDB, 0xFF, 0xA6, 0xB9, 0xFF, 0xE7, 0xC9, 0xFF, 0xA6,
-  0xD1, 0xFF, 0x65, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x66, 0xD9,
-  0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65,
-  0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF,
-  0x85, 0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x66,
-  0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xE1, 0xFF,
-  0x66, 0xE1, 0xFF, 0x45, 0xE1, 0xFF, 0xC7, 0xE1, 0xFF, 0xA7, 0xC9, 0xFF, 0xA7,
-  0xB1, 0xFF, 0x2C, 0xCB, 0xFF, 0xD6, 0xFD, 0xFF, 0x9C, 0xFF, 0xFF, 0xBD, 0xFF,
-  0xFF, 0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xB6, 0xFD, 0xFF,
-  0x69, 0xBA, 0xFF, 0xA6, 0xC1, 0xFF, 0xC6, 0xD9, 0xFF, 0x85, 0xD1, 0xFF, 0xE7,
-  0xC9, 0xFF, 0x07, 0xB2, 0xF3, 0xD7, 0xFD, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xF5, 0x70, 0x07, 0xB2, 0xFF, 0xA6, 0xD9,
-  0xFF, 0x85, 0xE1, 0xFF, 0x65, 0xD1, 0xFF, 0xC6, 0xC1, 0xFF, 0xEB, 0xC2, 0xFF,
-  0xFC, 0xFE, 0xFF, 0x9E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x7D,
-  0xFF, 0xFF, 0xDB, 0xFE, 0xFF, 0xCE, 0xDB, 0xFF, 0x07, 0xCA, 0xFF, 0x65, 0xD1,
-  0xFF, 0x86, 0xD1, 0xFF, 0xA6, 0xD9, 0xFF, 0x65, 0xD1, 0xFF, 0x86, 0xD9, 0xFF,
-  0xA6, 0xE1, 0xFF, 0x45, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66,
-  0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xE1, 0xFF,
-  0xA5, 0xD9, 0xFF, 0x85, 0xD1, 0xFF, 0x65, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1,
-  0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0x86, 0xE1, 0xFF,
-  0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6,
-  0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0x85, 0xE1, 0xFF, 0x65, 0xE1,
-  0xFF, 0x66, 0xF1, 0xFF, 0x45, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xC6, 0xC1, 0xFF, 0x27, 0xB2, 0xFF, 0x2F, 0xDC, 0xFF, 0x98, 0xFE, 0xFF, 0x9E,
-  0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xDB, 0xFE,
-  0xFF, 0xEB, 0xCA, 0xFF, 0xE7, 0xC9, 0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xD1, 0xFF,
-  0x08, 0xD2, 0xFF, 0x28, 0xB2, 0xFC, 0x75, 0xF5, 0x65, 0x5D, 0xFF, 0x0B, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x75, 0xFD, 0x71, 0xA7, 0xB1, 0xFF, 0xC6, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0xA6,
-  0xD1, 0xFF, 0xE7, 0xB9, 0xFF, 0xF0, 0xDB, 0xFF, 0x5D, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0x34, 0xFD, 0xFF,
-  0x49, 0xBA, 0xFF, 0xC7, 0xB9, 0xFF, 0x86, 0xC9, 0xFF, 0x85, 0xD1, 0xFF, 0xA6,
-  0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x65, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xE1,
-  0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF,
-  0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0xA6, 0xD9, 0xFF, 0xA6, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x45, 0xE1, 0xFF,
-  0x66, 0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x64,
-  0xD1, 0xFF, 0x85, 0xD1, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA5, 0xD1, 0xFF,
-  0xA5, 0xD1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65,
-  0xE1, 0xFF, 0x25, 0xE1, 0xFF, 0x45, 0xE1, 0xFF, 0xA7, 0xE1, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xA7, 0xC9, 0xFF, 0xE7, 0xC1, 0xFF, 0x69, 0xC2, 0xFF, 0x35, 0xFD, 0xFF,
-  0x3D, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x5C,
-  0xFF, 0xFF, 0xAF, 0xDB, 0xFF, 0xC8, 0xC1, 0xFF, 0x86, 0xD1, 0xFF, 0x66, 0xD9,
-  0xFF, 0x86, 0xC9, 0xFF, 0x28, 0xC2, 0xFF, 0x54, 0xFD, 0x74, 0x5D, 0xFF, 0x0C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0x01, 0x14, 0xF5, 0x71, 0xE7, 0xB1, 0xFF, 0xC7, 0xD1,
-  0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xC1, 0xFF, 0xE7, 0xB9, 0xFF,
-  0xB3, 0xEC, 0xFF, 0x7E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xDE,
-  0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x6D, 0xD3, 0xFF, 0xA7, 0xB9, 0xFF, 0xC7, 0xD1,
-  0xFF, 0xA6, 0xD1, 0xFF, 0xC7, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x86, 0xD1, 0xFF,
-  0xA6, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86,
-  0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xE1, 0xFF, 0xA5, 0xE1, 0xFF, 0xA5, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF,
-  0x66, 0xE1, 0xFF, 0x46, 0xD9, 0xFF, 0x46, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x87,
-  0xD9, 0xFF, 0xA7, 0xD1, 0xFF, 0xC7, 0xB9, 0xFF, 0xAE, 0xDB, 0xFF, 0x5C, 0xFF,
-  0xFF, 0xDD, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF,
-  0x3D, 0xFF, 0xFF, 0x72, 0xEC, 0xFF, 0xC8, 0xC1, 0xFF, 0xC7, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0xA6, 0xD1, 0xFF, 0xE7, 0xB1, 0xFF, 0x75, 0xFD, 0x62, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x55, 0xF5, 0x5D, 0x28, 0xC2, 0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0xA6,
-  0xD1, 0xFF, 0x28, 0xB2, 0xFF, 0xF3, 0xEC, 0xFF, 0x7E, 0xFF, 0xFF, 0xBF, 0xFF,
-  0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x7A, 0xFE, 0xFF, 0xAA, 0xC2, 0xFF,
-  0xA6, 0xC1, 0xFF, 0xE7, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x45,
-  0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xE1, 0xFF,
-  0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x45, 0xE1, 0xFF, 0x46, 0xE1, 0xFF, 0x66, 0xD9, 0xFF,
-  0x65, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xA5, 0xD1, 0xFF, 0x85,
-  0xD1, 0xFF, 0x44, 0xD9, 0xFF, 0x44, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x65, 0xD9, 0xFF,
-  0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9,
-  0xFF, 0x86, 0xE1, 0xFF, 0x87, 0xE1, 0xFF, 0x87, 0xE9, 0xFF, 0x66, 0xE1, 0xFF,
-  0x46, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x07, 0xCA, 0xFF, 0x69, 0xBA, 0xFF, 0x38,
-  0xFE, 0xFF, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9E, 0xFF,
-  0xFF, 0xD3, 0xF4, 0xFF, 0xE7, 0xB9, 0xFF, 0xA5, 0xD1, 0xFF, 0x84, 0xD1, 0xFF,
-  0xE7, 0xD9, 0xFF, 0x07, 0xC2, 0xFA, 0x76, 0xFD, 0x4F, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFD, 0x43, 0x69, 0xB2,
-  0xFE, 0xA6, 0xD1, 0xFF, 0x45, 0xD9, 0xFF, 0x86, 0xD1, 0xFF, 0x08, 0xC2, 0xFF,
-  0x34, 0xED, 0xFF, 0xBE, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x9E,
-  0xFF, 0xFF, 0xD7, 0xFD, 0xFF, 0x29, 0xBA, 0xFF, 0xE7, 0xD1, 0xFF, 0xC6, 0xD9,
-  0xFF, 0x45, 0xD1, 0xFF, 0x86, 0xE1, 0xFF, 0x45, 0xD9, 0xFF, 0x86, 0xE1, 0xFF,
-  0xA6, 0xE1, 0xFF, 0xA6, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9,
-  0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD1, 0xFF, 0x65, 0xD9, 0xFF, 0x66,
-  0xE9, 0xFF, 0x87, 0xE9, 0xFF, 0xA7, 0xD9, 0xFF, 0xA6, 0xC9, 0xFF, 0xA6, 0xC9,
-  0xFF, 0xC6, 0xC9, 0xFF, 0xE6, 0xC9, 0xFF, 0xC6, 0xD1, 0xFF,
-  0xA6, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1,
-  0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x65, 0xD1, 0xFF, 0xA6, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x65,
-  0xD9, 0xFF, 0x45, 0xD9, 0xFF, 0x46, 0xE1, 0xFF, 0x66, 0xE9, 0xFF, 0x46, 0xE9,
-  0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xD1, 0xFF, 0xC7, 0xC9, 0xFF, 0x8A, 0xC2, 0xFF,
-  0xD7, 0xFD, 0xFF, 0x5D, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x7D,
-  0xFF, 0xFF, 0x13, 0xF5, 0xFF, 0xE6, 0xB9, 0xFF, 0xC6, 0xD1, 0xFF, 0x86, 0xD1,
-  0xFF, 0xA6, 0xD1, 0xFF, 0x28, 0xBA, 0xF2, 0x38, 0xFE, 0x38, 0xFF, 0xFF, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xDB, 0xFE, 0x22, 0x6A, 0xB2, 0xEC, 0x87, 0xC1, 0xFF, 0xA6,
-  0xD9, 0xFF, 0x85, 0xD1, 0xFF, 0x29, 0xC2, 0xFF, 0xB3, 0xEC, 0xFF, 0x9E, 0xFF,
-  0xFF, 0x9E, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0xF4, 0xFC, 0xFF,
-  0xC7, 0xB9, 0xFF, 0xA6, 0xC9, 0xFF, 0xA6, 0xD1, 0xFF, 0x65, 0xD9, 0xFF, 0x86,
-  0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD9,
-  0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0xA6, 0xE1, 0xFF, 0x86, 0xE1, 0xFF,
-  0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66,
-  0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x46, 0xE1, 0xFF,
-  0x46, 0xD9, 0xFF, 0xA7, 0xC1, 0xFF, 0x08, 0xC2, 0xFF, 0x08, 0xBA, 0xFF, 0xE7,
-  0xB9, 0xFF, 0xC7, 0xB9, 0xFF, 0xA6, 0xC1, 0xFF, 0x66, 0xD1, 0xFF, 0x66, 0xD9,
-  0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x66,
-  0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xD9,
-  0xFF, 0x85, 0xD1, 0xFF, 0x85, 0xC9, 0xFF, 0xA6, 0xD9, 0xFF,
-  0xA6, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0xA6,
-  0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD1, 0xFF, 0xA7, 0xC9, 0xFF, 0xE8, 0xB1,
-  0xFF, 0x35, 0xFD, 0xFF, 0x9E, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF,
-  0xBD, 0xFF, 0xFF, 0x13, 0xF5, 0xFF, 0xE6, 0xB1, 0xFF, 0xA6, 0xC9, 0xFF, 0x86,
-  0xD1, 0xFF, 0xE7, 0xD1, 0xFF, 0x69, 0xC2, 0xE7, 0x58, 0xFE, 0x2C, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xFE, 0x12, 0x0C, 0xBB,
-  0xD4, 0xC8, 0xC1, 0xFF, 0xA7, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0x07, 0xCA, 0xFF,
-  0x72, 0xE4, 0xFF, 0x5E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x5E,
-  0xFF, 0xFF, 0x92, 0xF4, 0xFF, 0xC7, 0xC1, 0xFF, 0xA6, 0xD1, 0xFF, 0x85, 0xD1,
-  0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF,
-  0x45, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x45, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xE1,
-  0xFF, 0x86, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF,
-  0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD1, 0xFF, 0x87, 0xC9, 0xFF, 0x29, 0xCA,
-  0xFF, 0xCF, 0xE3, 0xFF, 0x96, 0xFD, 0xFF, 0x79, 0xFE, 0xFF, 0x79, 0xFE, 0xFF,
-  0x58, 0xFE, 0xFF, 0xD3, 0xFC, 0xFF, 0x0C, 0xDB, 0xFF, 0xC8, 0xC9, 0xFF, 0x87,
-  0xD1, 0xFF, 0x87, 0xE1, 0xFF, 0xA6, 0xE1, 0xFF, 0x64, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x66, 0xE1, 0xFF,
-  0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD1, 0xFF, 0xA6,
-  0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xD1, 0xFF, 0x85, 0xD1, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x45, 0xD1, 0xFF, 0xA6, 0xE1, 0xFF,
-  0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0xA7, 0xC9, 0xFF, 0x08, 0xBA, 0xFF, 0x92,
-  0xEC, 0xFF, 0x9D, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0x9D, 0xFF,
-  0xFF, 0x91, 0xE4, 0xFF, 0xC8, 0xB9, 0xFF, 0xC7, 0xD1, 0xFF,
-  0x45, 0xC9, 0xFF, 0xE6, 0xC9, 0xFF, 0x6C, 0xCB, 0xD2, 0x1C, 0xFF, 0x09, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x04, 0x30, 0xDC, 0xA5, 0xE7, 0xB9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xC7, 0xB9, 0xFF, 0xEF, 0xDB, 0xFF, 0x9E, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x7E, 0xFF, 0xFF, 0x93, 0xFC, 0xFF,
-  0xC6, 0xC1, 0xFF, 0xA5, 0xD1, 0xFF, 0xA4, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9,
-  0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF,
-  0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66,
-  0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x66, 0xE1, 0xFF, 0xA7, 0xD1, 0xFF, 0xAA, 0xC2, 0xFF, 0x59, 0xFE, 0xFF, 0xBD,
-  0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xDD, 0xFF,
-  0xFF, 0xBD, 0xFF, 0xFF, 0x5C, 0xFF, 0xFF, 0x72, 0xE4, 0xFF, 0xC8, 0xC1, 0xFF,
-  0x87, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9,
-  0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0xC6, 0xD9, 0xFF, 0x86, 0xC1, 0xFF, 0x08, 0xC2, 0xFF,
-  0x92, 0xF4, 0xFF, 0x9D, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D,
-  0xFF, 0xFF, 0xD0, 0xE3, 0xFF, 0xC8, 0xC9, 0xFF, 0x65, 0xD1, 0xFF, 0xA6, 0xD1,
-  0xFF, 0x07, 0xC2, 0xFF, 0x51, 0xE4, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x75, 0xF5, 0x55, 0xE7, 0xB9, 0xFF, 0xA6, 0xC9, 0xFF, 0xA6, 0xD9, 0xFF,
-  0x86, 0xC9, 0xFF, 0x2C, 0xCB, 0xFF, 0x7D, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBF,
-  0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x15, 0xFD, 0xFF, 0xE8, 0xC1, 0xFF, 0xA6, 0xD9,
-  0xFF, 0x84, 0xD9, 0xFF, 0x84, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x66,
-  0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9,
-  0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF,
-  0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD1, 0xFF, 0x49, 0xCA,
-  0xFF, 0x99, 0xFE, 0xFF, 0xBD, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFE, 0xF7, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFE,
-  0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x0D, 0xD3, 0xFF, 0xA7, 0xC9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x64, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x65, 0xD9,
-  0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x65,
-  0xD1, 0xFF, 0xA5, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x45, 0xC9, 0xFF, 0x08, 0xCA,
-  0xFF, 0xF4, 0xEC, 0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
-  0xFC, 0xFE, 0xFF, 0xEC, 0xD2, 0xFF, 0x08, 0xD2, 0xFF, 0x85, 0xD1, 0xFF, 0xA6,
-  0xC9, 0xFF, 0x08, 0xBA, 0xFF, 0xB7, 0xFD, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xFE, 0x15, 0x8A, 0xC2, 0xE9, 0xA7,
-  0xD1, 0xFF, 0x66, 0xD9, 0xFF, 0x85, 0xC9, 0xFF, 0x89, 0xCA, 0xFF, 0xBA, 0xFE,
-  0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF,
-  0x97, 0xFD, 0xFF, 0xE8, 0xB9, 0xFF, 0x85, 0xC1, 0xFF, 0x85, 0xD9, 0xFF, 0x65,
-  0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66,
-  0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0xA6, 0xD1, 0xFF, 0x08, 0xC2, 0xFF, 0xF3, 0xFC, 0xFF, 0x9D,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xBF, 0xFF, 0xFF, 0x76, 0xFD, 0xFF, 0xA7, 0xC1, 0xFF, 0x85, 0xD1, 0xFF, 0x65,
-  0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65,
-  0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x66, 0xE1,
-  0xFF, 0x45, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x86, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0xC6, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xC9, 0xFF, 0x49,
-  0xBA, 0xFF, 0x96, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF,
-  0xFF, 0xDB, 0xFE, 0xFF, 0x08, 0xB2, 0xFF, 0xE8, 0xC9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x66, 0xC9, 0xFF, 0x8B, 0xC2, 0xEB, 0x9A, 0xFE, 0x26, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1C, 0xFF, 0x09, 0xCE, 0xDB, 0xAF, 0xA6, 0xC1, 0xFF, 0x86, 0xD1, 0xFF,
-  0xC7, 0xE1, 0xFF, 0xC6, 0xB9, 0xFF, 0x95, 0xFD, 0xFF, 0x9E, 0xFF, 0xFF, 0xBE,
-  0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0x58, 0xFE, 0xFF, 0x29, 0xBA, 0xFF, 0xA7, 0xD1,
-  0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x66, 0xE1, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9,
-  0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF,
-  0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0xA6, 0xC9, 0xFF, 0x89, 0xBA, 0xFF, 0x7C, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF,
-  0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xFF,
-  0xFF, 0x1D, 0xFF, 0xFF, 0x29, 0xBA, 0xFF, 0x86, 0xD1, 0xFF, 0x65, 0xE1, 0xFF,
-  0x65, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1,
-  0xFF, 0x66, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF,
-  0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x45,
-  0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x45, 0xD9, 0xFF, 0x65, 0xE1,
-  0xFF, 0x65, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x87, 0xC9, 0xFF, 0x4A, 0xBA, 0xFF,
-  0x59, 0xFE, 0xFF, 0x9E, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x96,
-  0xFD, 0xFF, 0xE8, 0xB1, 0xFF, 0xC7, 0xD9, 0xFF, 0x87, 0xD9, 0xFF, 0xA8, 0xB9,
-  0xFF, 0xAF, 0xD3, 0xBB, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6,
-  0xFD, 0x4D, 0xA6, 0xB1, 0xFF, 0xC7, 0xD9, 0xFF, 0x87, 0xD1, 0xFF, 0x86, 0xB9,
-  0xFF, 0x30, 0xE4, 0xFF, 0x9D, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF,
-  0xFB, 0xFE, 0xFF, 0xCA, 0xC2, 0xFF, 0xA6, 0xC9, 0xFF, 0x65, 0xD1, 0xFF, 0xA6,
-  0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xC7, 0xC9, 0xFF, 0xCE,
-  0xCB, 0xFF, 0x9D, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x5D,
-  0xFF, 0xFF, 0x2C, 0xC3, 0xFF, 0xC6, 0xC9, 0xFF, 0x65, 0xE1, 0xFF, 0x66, 0xE1,
-  0xFF, 0x46, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65,
-  0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1,
-  0xFF, 0x66, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x65, 0xD9, 0xFF,
-  0x46, 0xE1, 0xFF, 0x46, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x45,
-  0xE1, 0xFF, 0x45, 0xE1, 0xFF, 0x46, 0xE1, 0xFF, 0x87, 0xC9, 0xFF, 0xEB, 0xC2,
-  0xFF, 0xFB, 0xFE, 0xFF, 0xBD, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF,
-  0x31, 0xD4, 0xFF, 0xA7, 0xB9, 0xFF, 0xA7, 0xD9, 0xFF, 0xC8, 0xD1, 0xFF, 0x09,
-  0xBA, 0xFF, 0xF7, 0xFD, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xDB, 0xFE, 0x14, 0xEB, 0xC2, 0xDA,
-  0xC7, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0xC7, 0xC9, 0xFF, 0x8A, 0xC2, 0xFF, 0xFB,
-  0xFE, 0xFF, 0x9D, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0xCF, 0xE3,
-  0xFF, 0xA6, 0xC1, 0xFF, 0xA6, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x45, 0xD9, 0xFF,
-  0x86, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xC7, 0xC1, 0xFF, 0xF2, 0xE4, 0xFF,
-  0xBD, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0xEF, 0xCB, 0xFF,
-  0xC7, 0xC9, 0xFF, 0x65, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66,
-  0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF,
-  0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD1, 0xFF, 0x86, 0xE1, 0xFF, 0x66, 0xE1,
-  0xFF, 0x45, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0xA7, 0xE1, 0xFF, 0x86, 0xE1, 0xFF,
-  0x86, 0xE1, 0xFF, 0x46, 0xE9, 0xFF, 0x87, 0xE1, 0xFF, 0xA6, 0xC1, 0xFF, 0xEE,
-  0xDB, 0xFF, 0x9D, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFC, 0xFE,
-  0xFF, 0xAB, 0xC2, 0xFF, 0xA6, 0xC9, 0xFF, 0x66, 0xC9, 0xFF, 0xE8, 0xC9, 0xFF,
-  0x2C, 0xCB, 0xE1, 0xDB, 0xFE, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xF4, 0xFC, 0x68, 0xC7, 0xC1, 0xFF, 0x66, 0xD1, 0xFF, 0xA7, 0xD1,
-  0xFF, 0xA6, 0xB1, 0xFF, 0xD7, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0x7D, 0xFF, 0xFF, 0x75, 0xFD, 0xFF, 0xA7, 0xB9, 0xFF, 0x86, 0xD1, 0xFF, 0x85,
-  0xD9, 0xFF, 0xC6, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF,
-  0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x67, 0xD9, 0xFF, 0x67, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0xC7, 0xC9, 0xFF, 0xF3, 0xEC, 0xFF, 0xBE, 0xFF,
-  0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x92, 0xDC, 0xFF, 0xC7, 0xC1,
-  0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x65,
-  0xD1, 0xFF, 0x65, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xE1,
-  0xFF, 0x65, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xE7, 0xC1, 0xFF,
-  0x33, 0xF5, 0xFF, 0x7D, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x95,
-  0xFD, 0xFF, 0xE6, 0xB9, 0xFF, 0xE7, 0xD9, 0xFF, 0x45, 0xC9, 0xFF, 0xC7, 0xC9,
-  0xFF, 0xD2, 0xFC, 0x84, 0x79, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0x0B,
-  0x69, 0xC2, 0xE3, 0xC7, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xC9, 0xFF, 0xAE,
-  0xD3, 0xFF, 0x7D, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDB, 0xFE,
-  0xFF, 0x28, 0xBA, 0xFF, 0xC7, 0xD1, 0xFF, 0xC7, 0xE1, 0xFF, 0x65, 0xD9, 0xFF,
-  0x65, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x65, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x66, 0xD9,
-  0xFF, 0x67, 0xD9, 0xFF, 0x67, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x66, 0xD9, 0xFF, 0xC7, 0xC9, 0xFF, 0x14, 0xF5, 0xFF, 0x9E, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x13, 0xE5, 0xFF, 0xC7, 0xC1, 0xFF, 0x66,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1,
-  0xFF, 0x45, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD1, 0xFF, 0xC6, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF, 0xA6, 0xD9, 0xFF, 0x44,
-  0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xC9, 0xFF, 0x69, 0xC2, 0xFF, 0xBB, 0xFE,
-  0xFF, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0xAE, 0xD3, 0xFF,
-  0xA6, 0xC1, 0xFF, 0x86, 0xD9, 0xFF, 0xC6, 0xD9, 0xFF, 0x48, 0xC2, 0xF1, 0x9A,
-  0xFE, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xEC, 0x75, 0xE7, 0xC1,
-  0xFF, 0x86, 0xD1, 0xFF, 0xA7, 0xD9, 0xFF, 0xE8, 0xC1, 0xFF, 0x7A, 0xFE, 0xFF,
-  0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0x6D, 0xDB, 0xFF, 0xC7,
-  0xD1, 0xFF, 0x65, 0xD1, 0xFF, 0xA6, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9,
-  0xFF, 0xA6, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xC7, 0xC9,
-  0xFF, 0xF4, 0xEC, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF,
-  0xFF, 0x13, 0xE5, 0xFF, 0xC7, 0xC1, 0xFF, 0x66, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66,
-  0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0x64, 0xD9, 0xFF,
-  0x65, 0xE9, 0xFF, 0x66, 0xE1, 0xFF, 0xA7, 0xC9, 0xFF, 0x8F, 0xE3, 0xFF, 0x9D,
-  0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x9B, 0xFE, 0xFF, 0xE8, 0xC1,
-  0xFF, 0x65, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xC6, 0xC1, 0xFF, 0xB2, 0xE4, 0x8F,
-  0x79, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xBC, 0xFE, 0x13, 0xAB, 0xC2, 0xE8, 0xC6, 0xC9, 0xFF, 0xA6, 0xD9, 0xFF, 0x87,
-  0xC9, 0xFF, 0xAF, 0xE3, 0xFF, 0x9F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDE, 0xFF,
-  0xFF, 0xF6, 0xFD, 0xFF, 0x28, 0xCA, 0xFF, 0x45, 0xD9, 0xFF,
-  0x65, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86,
-  0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xC7, 0xC9, 0xFF, 0xB3,
-  0xE4, 0xFF, 0xBE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x14,
-  0xE5, 0xFF, 0xC7, 0xC1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x66, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x65,
-  0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0x45, 0xE1,
-  0xFF, 0x46, 0xE1, 0xFF, 0x87, 0xE1, 0xFF, 0xE8, 0xC1, 0xFF, 0xD6, 0xFD, 0xFF,
-  0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0xFF, 0xFF, 0xEF, 0xEB, 0xFF, 0xA6,
-  0xD1, 0xFF, 0x85, 0xD9, 0xFF, 0xC6, 0xC9, 0xFF, 0xCB, 0xBA, 0xF4, 0xDB, 0xFE,
-  0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFC,
-  0x70, 0xA6, 0xB1, 0xFF, 0xC6, 0xD1, 0xFF, 0x85, 0xC9, 0xFF, 0x08, 0xBA, 0xFF,
-  0x7A, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x2C,
-  0xC3, 0xFF, 0xA6, 0xC9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9,
-  0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xC7, 0xC9, 0xFF, 0x92, 0xDC, 0xFF,
-  0x9E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x34, 0xED, 0xFF,
-  0xC7, 0xC1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66,
-  0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x85, 0xD9, 0xFF,
-  0xA5, 0xD9, 0xFF, 0x85, 0xD1, 0xFF, 0x65, 0xE1, 0xFF, 0x86, 0xE9, 0xFF, 0x46,
-  0xD9, 0xFF, 0x87, 0xC1, 0xFF, 0x4C, 0xC3, 0xFF, 0x7D, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0x79, 0xFE, 0xFF, 0x07, 0xC2, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA7, 0xB9, 0xFF, 0x14, 0xF5, 0x7A, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xCC, 0xCA, 0xD8, 0xC7,
-  0xD1, 0xFF, 0x85, 0xD1, 0xFF, 0xE6, 0xC9, 0xFF, 0xEF, 0xD3, 0xFF, 0x9E, 0xFF,
-  0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x55, 0xFD, 0xFF, 0xE7, 0xB9, 0xFF,
-  0xA7, 0xD1, 0xFF, 0xA6, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0xC7, 0xC9, 0xFF, 0x51, 0xDC, 0xFF, 0x9E, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x14, 0xED, 0xFF, 0xC7, 0xC1,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF,
-  0x65, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66,
-  0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD1,
-  0xFF, 0x85, 0xD1, 0xFF, 0x85, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x46, 0xD9, 0xFF,
-  0xC8, 0xD1, 0xFF, 0xE7, 0xB1, 0xFF, 0x96, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xDE,
-  0xFF, 0xFF, 0x9C, 0xFF, 0xFF, 0xCD, 0xDB, 0xFF, 0xA7, 0xD1, 0xFF, 0x46, 0xD9,
-  0xFF, 0xC8, 0xD1, 0xFF, 0xCC, 0xCA, 0xE7, 0xFB, 0xFE, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xF8, 0xFD, 0x40, 0xE8, 0xC9, 0xFF, 0xA6, 0xD9, 0xFF,
-  0xA6, 0xD9, 0xFF, 0xE7, 0xB9, 0xFF, 0x99, 0xFE, 0xFF, 0xDE, 0xFF, 0xFF, 0xBF,
-  0xFF, 0xFF, 0x7E, 0xFF, 0xFF, 0xEB, 0xD2, 0xFF, 0xA6, 0xC9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xE1, 0xFF,
-  0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0xC7, 0xC9, 0xFF, 0xF0, 0xD3, 0xFF, 0x9E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0x9E, 0xFF, 0xFF, 0xB2, 0xE4, 0xFF, 0xC7, 0xC1, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD9,
-  0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF,
-  0x66, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA5, 0xD1, 0xFF, 0xC5,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x45, 0xD9, 0xFF, 0x87, 0xE1, 0xFF, 0x66, 0xD1,
-  0xFF, 0xC8, 0xD1, 0xFF, 0xEC, 0xC2, 0xFF, 0x7D, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xBC, 0xFF, 0xFF, 0x98, 0xFE, 0xFF, 0xE7, 0xC9, 0xFF, 0x46, 0xD9, 0xFF, 0x87,
-  0xD9, 0xFF, 0xC8, 0xB9, 0xFF, 0xD7, 0xFD, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFE, 0x08, 0xD0,
-  0xDB, 0xB1, 0xA7, 0xD1, 0xFF, 0x65, 0xD9, 0xFF, 0xC6, 0xD1, 0xFF, 0x0B, 0xCB,
-  0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x96, 0xFD, 0xFF,
-  0xE8, 0xC9, 0xFF, 0x66, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9,
-  0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xC7, 0xC9,
-  0xFF, 0xAF, 0xCB, 0xFF, 0x9E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9E, 0xFF,
-  0xFF, 0x30, 0xDC, 0xFF, 0xC7, 0xC1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0xC6, 0xD9, 0xFF, 0xA5, 0xD1, 0xFF,
-  0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0xA7,
-  0xD9, 0xFF, 0xA7, 0xB9, 0xFF, 0xD7, 0xFD, 0xFF, 0xDE, 0xFF, 0xFF, 0xDD, 0xFF,
-  0xFF, 0xBD, 0xFF, 0xFF, 0xEB, 0xD2, 0xFF, 0xA7, 0xD9, 0xFF, 0x46, 0xD9, 0xFF,
-  0xC8, 0xC9, 0xFF, 0xCF, 0xCB, 0xC2, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0xFE, 0x17, 0x6A, 0xBA, 0xFD,
-  0x85, 0xD1, 0xFF, 0xA6, 0xD9, 0xFF, 0xC6, 0xB9, 0xFF, 0x95, 0xFD, 0xFF, 0xBD,
-  0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x7E, 0xFF, 0xFF, 0x4E, 0xCB, 0xFF, 0x86, 0xC1,
-  0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF,
-  0x66, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xC7, 0xC9, 0xFF, 0x4D,
-  0xC3, 0xFF, 0x7E, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x8E,
-  0xCB, 0xFF, 0xC7, 0xC9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x66, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xD1, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xE1,
-  0xFF, 0x45, 0xD9, 0xFF, 0xC7, 0xE9, 0xFF, 0x25, 0xD9, 0xFF, 0xA7, 0xD1, 0xFF,
-  0x6E, 0xD3, 0xFF, 0x3C, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0x14,
-  0xFD, 0xFF, 0x08, 0xC2, 0xFF, 0x86, 0xD1, 0xFF, 0xC7, 0xD1, 0xFF, 0x69, 0xBA,
-  0xFF, 0xDB, 0xFE, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFD, 0x66, 0xE7, 0xB9, 0xFF, 0xA5, 0xD1,
-  0xFF, 0xA5, 0xD1, 0xFF, 0x69, 0xBA, 0xFF, 0xFB, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0x5A, 0xFE, 0xFF, 0x29, 0xC2, 0xFF, 0x86, 0xD1, 0xFF, 0x85,
-  0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0xA7, 0xC9, 0xFF, 0x0C, 0xC3, 0xFF, 0x5D, 0xFF, 0xFF,
-  0xDE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xBE, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0x2D, 0xC3, 0xFF,
-  0xC7, 0xC9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9,
-  0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x65, 0xD9, 0xFF, 0xC6, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6,
-  0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x87, 0xD9, 0xFF, 0xE8, 0xB9,
-  0xFF, 0x7A, 0xFE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF,
-  0x69, 0xB2, 0xFF, 0xC7, 0xC9, 0xFF, 0x86, 0xC9, 0xFF, 0xE8, 0xB9, 0xFF, 0x96,
-  0xFD, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x06,
-  0x6D, 0xD3, 0xBF, 0xE7, 0xC9, 0xFF, 0xA6, 0xD9, 0xFF, 0xA6, 0xC9, 0xFF, 0xAE,
-  0xD3, 0xFF, 0x9D, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x31, 0xEC,
-  0xFF, 0xE8, 0xC9, 0xFF, 0x65, 0xD1, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0xA7, 0xC9, 0xFF, 0x8A, 0xBA, 0xFF, 0x7D, 0xFF, 0xFF, 0xDE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE,
-  0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0x8A, 0xBA, 0xFF, 0xC7, 0xC9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1,
-  0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0xA7, 0xC9, 0xFF, 0x31,
-  0xEC, 0xFF, 0xBE, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x0F, 0xCC,
-  0xFF, 0xC6, 0xC1, 0xFF, 0xA6, 0xD1, 0xFF, 0xC7, 0xC9, 0xFF, 0xAF, 0xE3, 0xC5,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFE, 0x05, 0xAA, 0xC2,
-  0xF5, 0xA6, 0xC9, 0xFF, 0xA6, 0xD9, 0xFF, 0xE7, 0xC1, 0xFF, 0xB6, 0xFD, 0xFF,
-  0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0xCB, 0xD2, 0xFF, 0x86,
-  0xD1, 0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0xA7, 0xC9, 0xFF, 0x6A, 0xBA, 0xFF, 0x5D, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF,
-  0x5D, 0xFF, 0xFF, 0x49, 0xBA, 0xFF, 0xA6, 0xC9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x65,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0xA7, 0xD9, 0xFF, 0x8A, 0xCA, 0xFF,
-  0x7E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xD6, 0xF5, 0xFF, 0x07,
-  0xBA, 0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0x49, 0xC2, 0xFF, 0xDB, 0xFE,
-  0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xFE, 0x39, 0xE6, 0xB9, 0xFF, 0x65,
-  0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0x08, 0xBA, 0xFF, 0x5D, 0xFF, 0xFF, 0xBE, 0xFF,
-  0xFF, 0xDE, 0xFF, 0xFF, 0x79, 0xFE, 0xFF, 0xC7, 0xC1, 0xFF, 0x65, 0xD9, 0xFF,
-  0xA6, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA7, 0xD1, 0xFF, 0x29, 0xB2,
-  0xFF, 0x1C, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFC, 0xFE,
-  0xFF, 0x08, 0xBA, 0xFF, 0xA6, 0xC9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x65, 0xE1, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x86, 0xB9, 0xFF, 0x79, 0xFE, 0xFF, 0xDE, 0xFF,
-  0xFF, 0xDE, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x49, 0xC2, 0xFF, 0x66, 0xD1, 0xFF,
-  0xA7, 0xE1, 0xFF, 0xA7, 0xB9, 0xFF, 0x17, 0xF6, 0x51, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x01, 0x33, 0xF5, 0x89, 0xA6, 0xC1, 0xFF, 0xA6, 0xD9, 0xFF,
-  0xA7, 0xD1, 0xFF, 0x0D, 0xD3, 0xFF, 0x9E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE,
-  0xFF, 0xFF, 0xD2, 0xE4, 0xFF, 0xA7, 0xC1, 0xFF, 0x66, 0xE1, 0xFF, 0x45, 0xD9,
-  0xFF, 0x85, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA7, 0xD1, 0xFF, 0xE8, 0xB1, 0xFF, 0xDB,
-  0xFE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x9A, 0xFE, 0xFF, 0xE8, 0xB9, 0xFF, 0x86,
-  0xC9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66,
-  0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x65, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0xC7, 0xC1, 0xFF, 0xD3, 0xE4, 0xFF, 0xBE, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x0C, 0xD3, 0xFF, 0xA7, 0xD1, 0xFF, 0x86, 0xD9,
-  0xFF, 0xC7, 0xC1, 0xFF, 0xD2, 0xDC, 0xA1, 0xFB, 0xFE, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x09, 0x8D,
-  0xCB, 0xC9, 0xC6, 0xC9, 0xFF, 0xA6, 0xD9, 0xFF, 0xC7, 0xC9, 0xFF, 0x72, 0xF4,
-  0xFF, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x2C, 0xBB, 0xFF,
-  0xE7, 0xD1, 0xFF, 0x86, 0xE1, 0xFF, 0x45, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x85,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xD1, 0xFF, 0xE8, 0xB9, 0xFF, 0x7A, 0xFE, 0xFF,
-  0xDE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xBE, 0xFF, 0xFF, 0x18, 0xFE, 0xFF, 0xE7, 0xC1, 0xFF, 0xA6, 0xD1, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF,
-  0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD1,
-  0xFF, 0x07, 0xD2, 0xFF, 0x0C, 0xBB, 0xFF, 0x7E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0x9E, 0xFF, 0xFF, 0x52, 0xF4, 0xFF, 0xC8, 0xD1, 0xFF, 0x66, 0xD1, 0xFF, 0xE7,
-  0xC9, 0xFF, 0x8D, 0xC3, 0xD5, 0x5D, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFE, 0x08, 0x89, 0xBA, 0xEF,
-  0xC6, 0xD1, 0xFF, 0x65, 0xD1, 0xFF, 0xA7, 0xB9, 0xFF, 0xB7, 0xFD, 0xFF, 0xBE,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x1C, 0xFF, 0xFF, 0x49, 0xB2, 0xFF, 0xA7, 0xD1,
-  0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0xA6, 0xD1, 0xFF, 0xE8, 0xB9, 0xFF, 0x18, 0xFE, 0xFF, 0xDE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE,
-  0xFF, 0xFF, 0x96, 0xFD, 0xFF, 0xE7, 0xC1, 0xFF, 0xA6, 0xD1, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65,
-  0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0xA6, 0xC9, 0xFF, 0x49,
-  0xB2, 0xFF, 0x1C, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xB7, 0xFD,
-  0xFF, 0xC7, 0xB9, 0xFF, 0xC6, 0xD1, 0xFF, 0xA6, 0xC9, 0xFF,
-  0x89, 0xBA, 0xF6, 0x5D, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFE, 0x21, 0x07, 0xB2, 0xFF, 0xC7, 0xD1,
-  0xFF, 0x86, 0xD1, 0xFF, 0x29, 0xC2, 0xFF, 0xDB, 0xFE, 0xFF, 0xDE, 0xFF, 0xFF,
-  0xBE, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xE8, 0xB1, 0xFF, 0x86, 0xD1, 0xFF, 0x65,
-  0xD9, 0xFF, 0x85, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xD1, 0xFF,
-  0xE8, 0xB9, 0xFF, 0xB7, 0xFD, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF,
-  0x14, 0xFD, 0xFF, 0xC7, 0xC1, 0xFF, 0xA6, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x66, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF,
-  0x65, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD1, 0xFF, 0x86,
-  0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0x85, 0xC9, 0xFF, 0x08, 0xBA, 0xFF,
-  0xF8, 0xFD, 0xFF, 0x9E, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xDB, 0xFE, 0xFF, 0x08,
-  0xB2, 0xFF, 0xA6, 0xC9, 0xFF, 0x85, 0xC9, 0xFF, 0xE8, 0xB9, 0xFF, 0x79, 0xFE,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xD6, 0xFD, 0x4D, 0xE7, 0xB9, 0xFF, 0xA6, 0xD1, 0xFF, 0xA7, 0xD1, 0xFF, 0x8B,
-  0xBA, 0xFF, 0x5D, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0xF4, 0xFC,
-  0xFF, 0xC8, 0xC1, 0xFF, 0x87, 0xD1, 0xFF, 0x86, 0xE1, 0xFF,
-  0x64, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xD1, 0xFF, 0xC7, 0xC1,
-  0xFF, 0x75, 0xFD, 0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xB2, 0xFC, 0xFF, 0xC7, 0xC1,
-  0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66,
-  0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xD9, 0xFF,
-  0x66, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xD1, 0xFF, 0xE7, 0xC1, 0xFF, 0xD3, 0xFC,
-  0xFF, 0x9E, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x7E, 0xFF, 0xFF, 0xAB, 0xB2, 0xFF,
-  0xC6, 0xC9, 0xFF, 0xA6, 0xD1, 0xFF, 0xE7, 0xC1, 0xFF, 0x75, 0xFD, 0x59, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xF4,
-  0x7E, 0xE7, 0xC9, 0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xC9, 0xFF, 0xB0, 0xD3, 0xFF,
-  0x7E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0xEF, 0xE3, 0xFF, 0xC6,
-  0xC9, 0xFF, 0x86, 0xD1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD1, 0xFF, 0xC7, 0xC1, 0xFF, 0xF4,
-  0xFC, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x2F, 0xE4, 0xFF, 0xE7, 0xC9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF,
-  0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9,
-  0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xC9, 0xFF, 0xCF, 0xEB, 0xFF, 0xBD,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x8F, 0xC3, 0xFF, 0xA7, 0xC9,
-  0xFF, 0x86, 0xD1, 0xFF, 0xE7, 0xC9, 0xFF, 0x92, 0xF4, 0x95, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x09, 0x50, 0xEC, 0xA8, 0xC6,
-  0xC9, 0xFF, 0x85, 0xD9, 0xFF, 0xA7, 0xC9, 0xFF, 0x52, 0xDC, 0xFF, 0x9F, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x2C, 0xD3, 0xFF, 0xC6, 0xC9, 0xFF,
-  0x86, 0xD1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD1, 0xFF, 0xC7, 0xC9, 0xFF, 0xB3, 0xFC, 0xFF,
-  0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x9E, 0xFF, 0xFF, 0xCE, 0xE3, 0xFF, 0xC6, 0xC9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x66, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x85, 0xD1, 0xFF, 0x0B, 0xDB, 0xFF, 0xBD, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF,
-  0xBF, 0xFF, 0xFF, 0x32, 0xD4, 0xFF, 0xA7, 0xC9, 0xFF, 0x85, 0xD9, 0xFF, 0xC6,
-  0xC9, 0xFF, 0x50, 0xF4, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xBA, 0xFE, 0x0C, 0xAE, 0xDB, 0xC5, 0xC6, 0xC9, 0xFF,
-  0x86, 0xD9, 0xFF, 0xC7, 0xC9, 0xFF, 0xF4, 0xEC, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF,
-  0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0x69, 0xC2, 0xFF, 0xA6, 0xD1, 0xFF, 0x86, 0xD9,
-  0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0xA6, 0xC9, 0xFF, 0x51, 0xF4, 0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x4C,
-  0xD3, 0xFF, 0xA6, 0xC9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x48, 0xC2, 0xFF, 0x9D, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF,
-  0xFF, 0x15, 0xED, 0xFF, 0xC7, 0xC9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xC9, 0xFF,
-  0xCE, 0xE3, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB,
-  0xFE, 0x0E, 0x0C, 0xD3, 0xD4, 0xA6, 0xD1, 0xFF, 0x85, 0xD9, 0xFF, 0xC7, 0xC9,
-  0xFF, 0x96, 0xFD, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF,
-  0xE7, 0xB9, 0xFF, 0x85, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86,
-  0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0xA7, 0xC9, 0xFF, 0xF0, 0xEB, 0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xCB, 0xCA, 0xFF,
-  0xA6, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0xE7, 0xB9, 0xFF, 0x5C, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x97,
-  0xFD, 0xFF, 0xC7, 0xC9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xC9, 0xFF, 0x2C, 0xD3,
-  0xDB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFE, 0x08,
-  0xAA, 0xCA, 0xDC, 0xA6, 0xD1, 0xFF, 0x85, 0xD9, 0xFF, 0xC7, 0xC1, 0xFF, 0x18,
-  0xFE, 0xFF, 0x9F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDA, 0xFE, 0xFF, 0xE7, 0xB9,
-  0xFF, 0x65, 0xD1, 0xFF, 0x86, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x65, 0xD9, 0xFF,
-  0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA7, 0xD1,
-  0xFF, 0x6E, 0xE3, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x69, 0xCA, 0xFF, 0x86, 0xD1,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xE7, 0xC1, 0xFF, 0xDA, 0xFE,
-  0xFF, 0xDF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x18, 0xFE, 0xFF,
-  0xC7, 0xC1, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xD1, 0xFF, 0xAA, 0xCA, 0xE8, 0x7D,
-  0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xCA,
-  0xE2, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xC7, 0xC1, 0xFF, 0x59, 0xFE, 0xFF,
-  0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x79, 0xFE, 0xFF, 0xE8, 0xC1, 0xFF, 0x65,
-  0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x45, 0xD9, 0xFF, 0x86, 0xE1,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA7, 0xD9, 0xFF, 0x0C, 0xD3, 0xFF, 0xBE,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0x3D, 0xFF, 0xFF, 0x08, 0xC2, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0xE7, 0xC9, 0xFF, 0x59, 0xFE, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x79, 0xFE, 0xFF, 0xC7, 0xC1, 0xFF, 0x85, 0xD9,
-  0xFF, 0xA6, 0xD9, 0xFF, 0x69, 0xC2, 0xF0, 0x1C, 0xFF, 0x12, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xCA, 0xE8, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0xE7, 0xC1, 0xFF, 0x9A, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0x59, 0xFE, 0xFF, 0xC7, 0xC1, 0xFF, 0x66, 0xE1, 0xFF,
-  0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0xA7, 0xD9, 0xFF, 0xAA, 0xCA, 0xFF, 0x9E, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFB, 0xFE,
-  0xFF, 0xE7, 0xC1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x65, 0xE1, 0xFF, 0xC7, 0xC9, 0xFF, 0x38, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xBA, 0xFE, 0xFF, 0xC7, 0xC1, 0xFF, 0x65, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x49, 0xC2, 0xF4, 0x1C, 0xFF, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x29, 0xC2, 0xE9, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0xE7, 0xC1, 0xFF, 0x9A, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x59,
-  0xFE, 0xFF, 0xA7, 0xC1, 0xFF, 0x86, 0xE1, 0xFF, 0x45, 0xD9, 0xFF, 0x66, 0xE1,
-  0xFF, 0x86, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x6A, 0xCA, 0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBA, 0xFE, 0xFF, 0xC7,
-  0xC1, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x66,
-  0xE1, 0xFF, 0xA7, 0xC9, 0xFF, 0x39, 0xFE, 0xFF, 0xBE, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xBA, 0xFE, 0xFF, 0xE7, 0xC1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x29, 0xC2, 0xF7, 0x1C, 0xFF, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
-  0xFF, 0x11, 0xE8, 0xC1, 0xEE, 0x86, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0xC6, 0xB9,
-  0xFF, 0xDB, 0xFE, 0xFF, 0xBE, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x59, 0xFE, 0xFF,
-  0xA7, 0xC1, 0xFF, 0x86, 0xE1, 0xFF, 0x45, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x86,
-  0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x08, 0xC2, 0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFD, 0xFF, 0xC7, 0xC9, 0xFF,
-  0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0xA7, 0xC9, 0xFF,
-  0x39, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBA, 0xFE, 0xFF, 0xE7,
-  0xC1, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x49, 0xC2, 0xF3, 0xDB, 0xFE,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFE, 0x10,
-  0x29, 0xC2, 0xEB, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xC6, 0xC1, 0xFF, 0xBA,
-  0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x59, 0xFE, 0xFF, 0xC7, 0xC1,
-  0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x65, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xE7, 0xB9,
-  0xFF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE,
-  0xFF, 0xFF, 0x96, 0xFD, 0xFF, 0xC7, 0xC9, 0xFF, 0x85, 0xE1, 0xFF, 0x85, 0xD9,
-  0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0xC7, 0xC9, 0xFF, 0x38, 0xFE,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBA, 0xFE, 0xFF, 0xC7, 0xC1, 0xFF,
-  0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x49, 0xCA, 0xEF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFE, 0x10, 0x6A, 0xCA, 0xE5, 0x86, 0xD1,
-  0xFF, 0x85, 0xD9, 0xFF, 0xE7, 0xC1, 0xFF, 0x59, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0x79, 0xFE, 0xFF, 0xE8, 0xC1, 0xFF, 0x65, 0xD9, 0xFF, 0x86,
-  0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x45, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xC7, 0xB9, 0xFF, 0x1C,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF,
-  0x34, 0xF5, 0xFF, 0xC6, 0xC9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0xE7, 0xC9, 0xFF, 0x59, 0xFE, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x59, 0xFE, 0xFF, 0xC7, 0xC1, 0xFF, 0x86, 0xD9,
-  0xFF, 0xA6, 0xD9, 0xFF, 0x8A, 0xCA, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFB, 0xFE, 0x10, 0xCB, 0xCA, 0xDC, 0xA6, 0xD1, 0xFF, 0x85,
-  0xD9, 0xFF, 0xE7, 0xC1, 0xFF, 0x18, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDB, 0xFE, 0xFF, 0xE7, 0xB9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF,
-  0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xC7, 0xC1, 0xFF, 0xBB, 0xFE, 0xFF,
-  0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xB2, 0xE4,
-  0xFF, 0xC6, 0xC9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0xE7, 0xC1, 0xFF, 0xDA, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xBE, 0xFF, 0xFF, 0x18, 0xFE, 0xFF, 0xC7, 0xC1, 0xFF, 0x86, 0xD9, 0xFF, 0xA6,
-  0xD1, 0xFF, 0xAA, 0xCA, 0xE2, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x2C, 0xD3, 0xCF, 0xC6, 0xD1, 0xFF, 0x85, 0xD9, 0xFF,
-  0xC6, 0xC1, 0xFF, 0x76, 0xFD, 0xFF, 0x7E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x5C,
-  0xFF, 0xFF, 0x07, 0xBA, 0xFF, 0xA6, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9,
-  0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0xE7, 0xC9, 0xFF, 0x39, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x30, 0xDC, 0xFF, 0xC6,
-  0xC9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xE7,
-  0xB9, 0xFF, 0x5C, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x97, 0xFD,
-  0xFF, 0xC7, 0xC9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xC9, 0xFF, 0x0B, 0xCB, 0xD9,
-  0x5D, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE,
-  0xE3, 0xBE, 0xC6, 0xC9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xC1, 0xFF, 0xF4, 0xEC,
-  0xFF, 0x9F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF,
-  0x69, 0xC2, 0xFF, 0xA6, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86,
-  0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x07, 0xCA, 0xFF, 0x76, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x7E, 0xFF, 0xFF, 0x8E, 0xD3, 0xFF, 0xC6, 0xC9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x65, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x28, 0xC2, 0xFF,
-  0x9D, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x15, 0xED, 0xFF, 0xC7,
-  0xC9, 0xFF, 0x65, 0xD9, 0xFF, 0xA6, 0xC9, 0xFF, 0x8D, 0xDB, 0xC8, 0x1C, 0xFF,
-  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xEC, 0x9B,
-  0xC6, 0xC9, 0xFF, 0x85, 0xD1, 0xFF, 0xC7, 0xC9, 0xFF, 0x32, 0xDC, 0xFF, 0x9F,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x2C, 0xD3, 0xFF, 0xC6, 0xD1,
-  0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xE7, 0xC9,
-  0xFF, 0x93, 0xE4, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x5D,
-  0xFF, 0xFF, 0xEC, 0xC2, 0xFF, 0xA6, 0xC9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xE1,
-  0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD1, 0xFF, 0x0B, 0xDB, 0xFF, 0xBD, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x31, 0xD4, 0xFF, 0xC7, 0xC9, 0xFF,
-  0x65, 0xD9, 0xFF, 0xC6, 0xC9, 0xFF, 0x30, 0xEC, 0xA9, 0xFF, 0xFF, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xF4, 0x78, 0xE7, 0xC1,
-  0xFF, 0x85, 0xD1, 0xFF, 0xC7, 0xC9, 0xFF, 0x6E, 0xCB, 0xFF, 0x7E, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0xEF, 0xE3, 0xFF, 0xC6, 0xC9, 0xFF, 0xA6,
-  0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xC9, 0xFF, 0xD0,
-  0xDB, 0xFF, 0x7E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFC, 0xFE, 0xFF,
-  0x6A, 0xBA, 0xFF, 0x86, 0xC1, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x65,
-  0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x65, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF,
-  0xA6, 0xC9, 0xFF, 0xCE, 0xEB, 0xFF, 0xBD, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F,
-  0xFF, 0xFF, 0x6E, 0xC3, 0xFF, 0xC7, 0xD1, 0xFF, 0x85, 0xD1, 0xFF, 0xE7, 0xC9,
-  0xFF, 0xB2, 0xFC, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFD, 0x53, 0xE7, 0xB9, 0xFF, 0xA6,
-  0xD1, 0xFF, 0xC6, 0xD1, 0xFF, 0x8A, 0xBA, 0xFF, 0x5D, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0x9E, 0xFF, 0xFF, 0xD4, 0xFC, 0xFF, 0xC8, 0xC1, 0xFF, 0x86, 0xD1, 0xFF,
-  0x85, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0xC7, 0xC9, 0xFF, 0xAB, 0xC2, 0xFF, 0x5D, 0xFF, 0xFF,
-  0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDE,
-  0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xD7, 0xFD, 0xFF, 0x29, 0xC2, 0xFF, 0xA6, 0xC9,
-  0xFF, 0x85, 0xD1, 0xFF, 0xA6, 0xE1, 0xFF, 0x65, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1,
-  0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD1, 0xFF,
-  0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xD1, 0xFF, 0xE7, 0xC1,
-  0xFF, 0xD3, 0xFC, 0xFF, 0x9E, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x7E, 0xFF, 0xFF,
-  0xCB, 0xB2, 0xFF, 0xC6, 0xC9, 0xFF, 0xA6, 0xD1, 0xFF, 0xC7, 0xC1, 0xFF, 0xB6,
-  0xFD, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x79, 0xFE, 0x24, 0x28, 0xB2, 0xFF, 0xA6, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF,
-  0x08, 0xBA, 0xFF, 0xBA, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF8,
-  0xFD, 0xFF, 0xE8, 0xB1, 0xFF, 0x86, 0xD1, 0xFF, 0x65, 0xD9, 0xFF, 0xA6, 0xE1,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6,
-  0xD9, 0xFF, 0x86, 0xC9, 0xFF, 0xE7, 0xB9, 0xFF, 0x18, 0xFE, 0xFF, 0xBE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x9E, 0xFF, 0xFF, 0xD0, 0xE3, 0xFF, 0x87, 0xC1, 0xFF, 0x86, 0xD1, 0xFF, 0x86,
-  0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x65, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65,
-  0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xD9,
-  0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x86, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0x85, 0xC9, 0xFF, 0x08, 0xBA, 0xFF, 0xF8,
-  0xFD, 0xFF, 0x9E, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xDB, 0xFE, 0xFF, 0x28, 0xB2,
-  0xFF, 0xC6, 0xC9, 0xFF, 0xA6, 0xC9, 0xFF, 0x08, 0xBA, 0xFF, 0x59, 0xFE, 0x21,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-  0xFF, 0x0A, 0x89, 0xBA, 0xEF, 0xA6, 0xC9, 0xFF, 0xA6, 0xD1, 0xFF, 0xC7, 0xB9,
-  0xFF, 0xD7, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x1C, 0xFF, 0xFF,
-  0x49, 0xB2, 0xFF, 0xC6, 0xD1, 0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0x65,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0xE7, 0xD9, 0xFF, 0xC7, 0xC9, 0xFF, 0x10, 0xEC, 0xFF, 0x3C, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBB, 0xFE,
-  0xFF, 0x4A, 0xCA, 0xFF, 0xA8, 0xD9, 0xFF, 0xC7, 0xE1, 0xFF, 0x65, 0xD9, 0xFF,
-  0x85, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9,
-  0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD9,
-  0xFF, 0xC6, 0xC9, 0xFF, 0x49, 0xB2, 0xFF, 0x1C, 0xFF, 0xFF,
-  0xBE, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xB7, 0xFD, 0xFF, 0xC7, 0xB9, 0xFF, 0xA6,
-  0xD1, 0xFF, 0xA6, 0xC9, 0xFF, 0x89, 0xBA, 0xF0, 0xDB, 0xFE, 0x0D, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x09,
-  0x6D, 0xCB, 0xCA, 0xC6, 0xC9, 0xFF, 0xA6, 0xD9, 0xFF, 0xC7, 0xC9, 0xFF, 0x92,
-  0xF4, 0xFF, 0x7E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x2C, 0xBB,
-  0xFF, 0xE7, 0xD1, 0xFF, 0x85, 0xE1, 0xFF, 0x45, 0xD9, 0xFF, 0x86, 0xE1, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x64, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x45, 0xC9,
-  0xFF, 0x08, 0xC2, 0xFF, 0x55, 0xFD, 0xFF, 0x5C, 0xFF, 0xFF,
-  0xBD, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0xFB, 0xFE, 0xFF, 0x0C, 0xCB, 0xFF, 0x87,
-  0xC1, 0xFF, 0xA7, 0xE1, 0xFF, 0x45, 0xD1, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xE1,
-  0xFF, 0x44, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x66, 0xD9,
-  0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0x64, 0xD1, 0xFF, 0x07,
-  0xD2, 0xFF, 0x0C, 0xBB, 0xFF, 0x9E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9E, 0xFF,
-  0xFF, 0x52, 0xF4, 0xFF, 0xC8, 0xC9, 0xFF, 0x86, 0xD1, 0xFF, 0xE7, 0xC9, 0xFF,
-  0xAD, 0xCB, 0xC2, 0x1C, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xEC, 0x8A, 0xE6, 0xC1,
-  0xFF, 0xA6, 0xD9, 0xFF, 0xC7, 0xD1, 0xFF, 0x0C, 0xD3, 0xFF,
-  0x9E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xD2, 0xE4, 0xFF, 0xC6,
-  0xC1, 0xFF, 0x85, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x85, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0xA6, 0xE1, 0xFF, 0x45,
-  0xD1, 0xFF, 0xC7, 0xC9, 0xFF, 0x69, 0xCA, 0xFF, 0x0B, 0xD3, 0xFF, 0x4C, 0xE3,
-  0xFF, 0xA6, 0xC9, 0xFF, 0xC6, 0xD9, 0xFF, 0xC6, 0xD9, 0xFF, 0x85, 0xD1, 0xFF,
-  0xA5, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0x65,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66,
-  0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD9,
-  0xFF, 0xA5, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xC7, 0xC1, 0xFF,
-  0xD3, 0xE4, 0xFF, 0xBE, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x0C,
-  0xD3, 0xFF, 0xA7, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xC1, 0xFF, 0x13, 0xED,
-  0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFD, 0x48, 0xC6, 0xB9, 0xFF, 0x85,
-  0xD1, 0xFF, 0xC6, 0xD9, 0xFF, 0x08, 0xBA, 0xFF, 0x5D, 0xFF, 0xFF, 0xBF, 0xFF,
-  0xFF, 0xBE, 0xFF, 0xFF, 0x79, 0xFE, 0xFF, 0xC6, 0xC1, 0xFF, 0x65, 0xD9, 0xFF,
-  0xA6, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xE1,
-  0xFF, 0xA6, 0xE1, 0xFF, 0x24, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0xA7, 0xE9, 0xFF,
-  0x86, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xC6, 0xD9, 0xFF, 0x64, 0xD1, 0xFF, 0xC6,
-  0xF1, 0xFF, 0x44, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD1, 0xFF, 0x85, 0xD1,
-  0xFF, 0xA5, 0xD9, 0xFF, 0x45, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x65, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF,
-  0x65, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x86, 0xB9, 0xFF, 0x79, 0xFE,
-  0xFF, 0xBE, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x29, 0xC2, 0xFF,
-  0x66, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xB9, 0xFF, 0x98, 0xFE, 0x31, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0x11, 0x89, 0xC2, 0xFB, 0xA5, 0xC9, 0xFF,
-  0xA5, 0xD1, 0xFF, 0xE6, 0xC1, 0xFF, 0xB6, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xBE,
-  0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0xEB, 0xD2, 0xFF, 0x86, 0xD1, 0xFF, 0xA6, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6,
-  0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x45, 0xD1,
-  0xFF, 0x86, 0xD9, 0xFF, 0xC7, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x24, 0xD1, 0xFF,
-  0xA6, 0xE1, 0xFF, 0x64, 0xD1, 0xFF, 0xA5, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF, 0x85,
-  0xD1, 0xFF, 0xA7, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66,
-  0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0xA7, 0xD9, 0xFF, 0x6A, 0xCA, 0xFF, 0x7D, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xBE,
-  0xFF, 0xFF, 0xD6, 0xF5, 0xFF, 0x07, 0xC2, 0xFF, 0x86, 0xD1, 0xFF, 0xA7, 0xD9,
-  0xFF, 0x8A, 0xCA, 0xEE, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xDB, 0xB1, 0x07, 0xCA, 0xFF, 0x64, 0xD1,
-  0xFF, 0xC6, 0xC9, 0xFF, 0xAE, 0xD3, 0xFF, 0x9E, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF,
-  0xBE, 0xFF, 0xFF, 0x31, 0xEC, 0xFF, 0xE7, 0xC9, 0xFF, 0x65, 0xD1, 0xFF, 0xA6,
-  0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA7, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0xC6, 0xE1,
-  0xFF, 0x85, 0xD1, 0xFF, 0xA6, 0xD9, 0xFF, 0x86, 0xD1, 0xFF,
-  0x66, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x66, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0xA7, 0xD1,
-  0xFF, 0x31, 0xEC, 0xFF, 0xBE, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF,
-  0x0F, 0xCC, 0xFF, 0xC6, 0xC1, 0xFF, 0xA6, 0xD1, 0xFF, 0xA7, 0xC9, 0xFF, 0x6D,
-  0xDB, 0xB5, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x75, 0xFD, 0x53, 0xE7, 0xB9, 0xFF, 0xA5, 0xD9, 0xFF, 0xA5, 0xD1, 0xFF, 0x69,
-  0xBA, 0xFF, 0xDB, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x59, 0xFE,
-  0xFF, 0x49, 0xC2, 0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xE1, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xE1, 0xFF, 0xA6, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x45, 0xD9, 0xFF, 0x86, 0xE1,
-  0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x86, 0xE1, 0xFF,
-  0x66, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0xC6, 0xE1, 0xFF, 0x45, 0xD9, 0xFF, 0x65,
-  0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x45, 0xD9, 0xFF, 0x86, 0xE1,
-  0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD9,
-  0xFF, 0xC6, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF,
-  0x65, 0xE1, 0xFF, 0x45, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0xE8, 0xB9, 0xFF, 0x7A,
-  0xFE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x69, 0xB2,
-  0xFF, 0xC7, 0xC9, 0xFF, 0xA6, 0xD1, 0xFF, 0xC7, 0xB9, 0xFF, 0x55, 0xFD, 0x5C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF,
-  0x09, 0x8A, 0xC2, 0xF9, 0x85, 0xD1, 0xFF, 0xA5, 0xD9, 0xFF, 0xC6, 0xB9, 0xFF,
-  0x96, 0xFD, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x6D,
-  0xCB, 0xFF, 0x86, 0xC1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1,
-  0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x66,
-  0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xE1,
-  0xFF, 0xA6, 0xE1, 0xFF, 0x45, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF,
-  0x45, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0xA6, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xD9, 0xFF,
-  0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xD1, 0xFF, 0x85,
-  0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x45, 0xD9, 0xFF, 0xC7, 0xE9, 0xFF, 0x45, 0xD9,
-  0xFF, 0xC7, 0xD1, 0xFF, 0x6E, 0xD3, 0xFF, 0x5C, 0xFF, 0xFF,
-  0xFE, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0x14, 0xFD, 0xFF, 0xE8, 0xC1, 0xFF, 0x66,
-  0xD1, 0xFF, 0xA6, 0xC9, 0xFF, 0x69, 0xBA, 0xFC, 0x79, 0xFE, 0x14, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF,
-  0xDB, 0xA9, 0xA6, 0xC9, 0xFF, 0x65, 0xD9, 0xFF, 0xC6, 0xD1, 0xFF, 0x0B, 0xCB,
-  0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x96, 0xFD, 0xFF,
-  0xE8, 0xC9, 0xFF, 0x66, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9,
-  0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1,
-  0xFF, 0x65, 0xE1, 0xFF, 0x45, 0xE1, 0xFF, 0xA6, 0xE9, 0xFF,
-  0x65, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xE1, 0xFF, 0x85, 0xE9, 0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xE9, 0xFF, 0x65, 0xE1,
-  0xFF, 0xA6, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0xA5, 0xD1, 0xFF, 0xA5, 0xD1, 0xFF, 0xA5, 0xD9, 0xFF,
-  0x65, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0xA7, 0xD9, 0xFF, 0xC7,
-  0xB9, 0xFF, 0xB6, 0xF5, 0xFF, 0xDE, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xBD, 0xFF,
-  0xFF, 0xEB, 0xD2, 0xFF, 0xA7, 0xD9, 0xFF, 0x46, 0xD9, 0xFF, 0xC8, 0xD1, 0xFF,
-  0xAE, 0xCB, 0xB0, 0xFB, 0xFE, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFD, 0x4B,
-  0xE7, 0xC9, 0xFF, 0xA6, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xE7, 0xB9, 0xFF, 0x79,
-  0xFE, 0xFF, 0xDE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0xEB, 0xD2,
-  0xFF, 0xA7, 0xC9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x86,
-  0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xC9, 0xFF, 0x07, 0xD2, 0xFF, 0xC6, 0xC1,
-  0xFF, 0xA9, 0xD2, 0xFF, 0x68, 0xCA, 0xFF, 0xC6, 0xC1, 0xFF, 0xA6, 0xC9, 0xFF,
-  0x86, 0xD1, 0xFF, 0xC7, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x44, 0xD9, 0xFF, 0xA5,
-  0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0xA5, 0xD1, 0xFF, 0xC6, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x65, 0xD9,
-  0xFF, 0x87, 0xE1, 0xFF, 0x46, 0xD1, 0xFF, 0xC8, 0xC9, 0xFF, 0xEC, 0xC2, 0xFF,
-  0x9E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xBC, 0xFF, 0xFF, 0x78, 0xFE, 0xFF, 0xC7,
-  0xC9, 0xFF, 0x46, 0xD9, 0xFF, 0x87, 0xD9, 0xFF, 0xC7, 0xB9, 0xFF, 0x38, 0xFE,
-  0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xFE, 0x0D, 0xAA, 0xCA, 0xDD, 0xE7, 0xD1,
-  0xFF, 0x85, 0xD1, 0xFF, 0xE7, 0xC9, 0xFF, 0xEF, 0xD3, 0xFF, 0x9E, 0xFF, 0xFF,
-  0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x55, 0xFD, 0xFF, 0xE7, 0xB9, 0xFF, 0xC6,
-  0xD1, 0xFF, 0xA6, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9,
-  0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xC7, 0xD1, 0xFF,
-  0xE7, 0xB9, 0xFF, 0x0B, 0xCB, 0xFF, 0x54, 0xF5, 0xFF, 0x5C, 0xFF, 0xFF, 0x9D,
-  0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0x1C, 0xFF, 0xFF, 0x56, 0xFD, 0xFF, 0xAB, 0xCA,
-  0xFF, 0xC8, 0xC9, 0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xE1, 0xFF, 0x44, 0xD9, 0xFF,
-  0xA5, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65,
-  0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1,
-  0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x85, 0xD9, 0xFF,
-  0xA5, 0xD1, 0xFF, 0x85, 0xD1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x46,
-  0xD9, 0xFF, 0xC8, 0xD1, 0xFF, 0xC7, 0xB1, 0xFF, 0x75, 0xFD, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0x9C, 0xFF, 0xFF, 0xCD, 0xDB, 0xFF, 0xA6, 0xD1, 0xFF,
-  0x46, 0xD9, 0xFF, 0xC8, 0xD1, 0xFF, 0xCB, 0xC2, 0xD8, 0xFF, 0xFF, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0xD2, 0xF4, 0x6C, 0xC7, 0xB9, 0xFF, 0xC6,
-  0xD9, 0xFF, 0x85, 0xC9, 0xFF, 0x29, 0xBA, 0xFF, 0x9A, 0xFE, 0xFF, 0xBE, 0xFF,
-  0xFF, 0x9E, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x2C, 0xC3, 0xFF, 0xA6, 0xC9, 0xFF,
-  0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x65,
-  0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x86, 0xC9, 0xFF, 0x28, 0xC2, 0xFF, 0x0F, 0xDC,
-  0xFF, 0x7C, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFD, 0xFE, 0xFF, 0xAF,
-  0xDB, 0xFF, 0xC8, 0xC9, 0xFF, 0x86, 0xD1, 0xFF, 0x85, 0xE1, 0xFF, 0x64, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xE1, 0xFF,
-  0x65, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66,
-  0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0x85, 0xD1,
-  0xFF, 0x65, 0xE1, 0xFF, 0x66, 0xE9, 0xFF, 0x66, 0xD9, 0xFF, 0x87, 0xC1, 0xFF,
-  0x4C, 0xC3, 0xFF, 0x7D, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x79,
-  0xFE, 0xFF, 0x07, 0xC2, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xC7, 0xB9,
-  0xFF, 0x14, 0xF5, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xF9, 0xFE, 0x10, 0xCA, 0xC2, 0xEA, 0xC6, 0xC9, 0xFF,
-  0xA6, 0xD9, 0xFF, 0x87, 0xC9, 0xFF, 0xAF, 0xE3, 0xFF, 0x9E, 0xFF, 0xFF, 0xDF,
-  0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xF6, 0xFD, 0xFF, 0x28, 0xCA, 0xFF, 0x45, 0xD9,
-  0xFF, 0x65, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF,
-  0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF,
-  0xE8, 0xC9, 0xFF, 0x4D, 0xD3, 0xFF, 0x9D, 0xFF, 0xFF, 0x9C, 0xFF, 0xFF, 0xBE,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF,
-  0x2D, 0xD3, 0xFF, 0xA7, 0xC9, 0xFF, 0x85, 0xD1, 0xFF, 0xA6, 0xE1, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1,
-  0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xE1, 0xFF,
-  0x65, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0x45,
-  0xE1, 0xFF, 0x46, 0xE1, 0xFF, 0x87, 0xE1, 0xFF, 0xE8, 0xC1, 0xFF, 0xD6, 0xFD,
-  0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x10, 0xEC, 0xFF,
-  0xC6, 0xD1, 0xFF, 0x85, 0xD1, 0xFF, 0xC6, 0xC9, 0xFF, 0xCA, 0xBA, 0xEB, 0xDB,
-  0xFE, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0xFF, 0x01, 0x91, 0xE4, 0x7B, 0xE7, 0xC1, 0xFF, 0x86, 0xD1, 0xFF, 0xA7, 0xD9,
-  0xFF, 0xE8, 0xC1, 0xFF, 0x7A, 0xFE, 0xFF, 0x9E, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0x6D, 0xDB, 0xFF, 0xE7, 0xD9, 0xFF, 0x65,
-  0xD1, 0xFF, 0xA6, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0xA6, 0xE1,
-  0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xE1, 0xFF,
-  0x85, 0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xD1, 0xFF, 0x09, 0xC2,
-  0xFF, 0x9B, 0xFE, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBA, 0xFE, 0xFF, 0xE8, 0xB9,
-  0xFF, 0xC7, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x85,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xE9, 0xFF,
-  0x66, 0xE1, 0xFF, 0x87, 0xC9, 0xFF, 0x8E, 0xDB, 0xFF, 0x9D, 0xFF, 0xFF, 0xDE,
-  0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x9B, 0xFE, 0xFF, 0xE8, 0xC1, 0xFF, 0x65, 0xD1,
-  0xFF, 0xA6, 0xD9, 0xFF, 0xE6, 0xC1, 0xFF, 0x13, 0xED, 0x73, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xDB, 0xFE, 0x14, 0x69, 0xBA, 0xEB, 0xC6, 0xD1, 0xFF, 0x65, 0xD1, 0xFF, 0xA7,
-  0xC9, 0xFF, 0x6E, 0xD3, 0xFF, 0x7E, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDA, 0xFE, 0xFF, 0x48, 0xBA, 0xFF, 0xA7, 0xD1, 0xFF, 0xA6, 0xD9, 0xFF,
-  0xA6, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xE1,
-  0xFF, 0x86, 0xE1, 0xFF, 0x67, 0xD9, 0xFF, 0x67, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0xC7, 0xC9, 0xFF, 0xAF, 0xD3, 0xFF, 0x7E,
-  0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xAE, 0xD3, 0xFF, 0xA6,
-  0xC9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x65, 0xE1, 0xFF, 0x44, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF,
-  0xA6, 0xD9, 0xFF, 0x85, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF, 0xA6,
-  0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0xA6, 0xE9, 0xFF, 0x86, 0xD1, 0xFF, 0x69, 0xC2,
-  0xFF, 0xBA, 0xFE, 0xFF, 0x9E, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
-  0x5D, 0xFF, 0xFF, 0xAE, 0xD3, 0xFF, 0xA6, 0xC9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6,
-  0xD9, 0xFF, 0x28, 0xC2, 0xE4, 0x1C, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x01, 0xB2, 0xF4, 0x6E, 0x07, 0xC2, 0xFF, 0x86, 0xD1, 0xFF, 0xE7, 0xD9, 0xFF,
-  0xE8, 0xB9, 0xFF, 0x76, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x7D,
-  0xFF, 0xFF, 0x54, 0xFD, 0xFF, 0xC7, 0xC1, 0xFF, 0xC7, 0xD9, 0xFF, 0x65, 0xD1,
-  0xFF, 0xA6, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x85, 0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x67, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xE1,
-  0xFF, 0xC7, 0xC9, 0xFF, 0xF3, 0xEC, 0xFF, 0x7E, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xD2, 0xE4, 0xFF, 0x08, 0xCA, 0xFF,
-  0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65,
-  0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD1,
-  0xFF, 0x65, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xE1, 0xFF,
-  0x45, 0xD9, 0xFF, 0x86, 0xD1, 0xFF, 0xE7, 0xC1, 0xFF, 0x34, 0xF5, 0xFF, 0x9D,
-  0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x75, 0xFD, 0xFF, 0xC6, 0xB1,
-  0xFF, 0xA7, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0xC7, 0xC9, 0xFF, 0x55, 0xFD, 0x66,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
-  0xFE, 0x08, 0xCA, 0xBA, 0xD4, 0xE7, 0xD1, 0xFF, 0x45, 0xD1, 0xFF, 0xA7, 0xC9,
-  0xFF, 0xAB, 0xCA, 0xFF, 0x3C, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF,
-  0x7D, 0xFF, 0xFF, 0xAE, 0xDB, 0xFF, 0xC7, 0xC9, 0xFF, 0xA6, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x45, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xC7,
-  0xC9, 0xFF, 0xD2, 0xEC, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBE,
-  0xFF, 0xFF, 0xF3, 0xEC, 0xFF, 0xA6, 0xC9, 0xFF, 0x65, 0xE1, 0xFF, 0x66, 0xE1,
-  0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x65, 0xE1, 0xFF,
-  0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x64, 0xD1, 0xFF,
-  0xA5, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x45, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0xA6,
-  0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x25, 0xE1, 0xFF, 0xA7, 0xE1,
-  0xFF, 0xC7, 0xC9, 0xFF, 0xEF, 0xDB, 0xFF, 0xBD, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF,
-  0xBE, 0xFF, 0xFF, 0x3D, 0xFF, 0xFF, 0xCB, 0xCA, 0xFF, 0xA6, 0xC9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0xC7, 0xC9, 0xFF, 0xCB, 0xC2, 0xD6, 0xBA, 0xFE, 0x0C, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xFE, 0x3B,
-  0xE8, 0xB9, 0xFF, 0x86, 0xD1, 0xFF, 0xA7, 0xD9, 0xFF, 0xA7, 0xC1, 0xFF, 0xEF,
-  0xD3, 0xFF, 0x9D, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFB, 0xFE,
-  0xFF, 0xAA, 0xC2, 0xFF, 0xC6, 0xC9, 0xFF, 0x65, 0xD1, 0xFF,
-  0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xC6, 0xC9, 0xFF,
-  0xB2, 0xEC, 0xFF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF,
-  0x91, 0xE4, 0xFF, 0xC7, 0xD1, 0xFF, 0x45, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x46,
-  0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x65, 0xE1, 0xFF,
-  0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x66,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x45, 0xE1,
-  0xFF, 0x45, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF,
-  0x45, 0xD9, 0xFF, 0x45, 0xE1, 0xFF, 0x67, 0xE1, 0xFF, 0x87, 0xD1, 0xFF, 0xCB,
-  0xCA, 0xFF, 0xFB, 0xFE, 0xFF, 0xDD, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xBE, 0xFF,
-  0xFF, 0x10, 0xCC, 0xFF, 0xA7, 0xB9, 0xFF, 0x66, 0xD1, 0xFF, 0xE8, 0xD1, 0xFF,
-  0xC8, 0xB1, 0xFF, 0xB6, 0xFD, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xD3,
-  0xA4, 0xE7, 0xC9, 0xFF, 0x65, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x07, 0xC2, 0xFF,
-  0x54, 0xFD, 0xFF, 0x9E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0x58,
-  0xFE, 0xFF, 0x49, 0xC2, 0xFF, 0xA7, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0xA6, 0xE1,
-  0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1,
-  0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xC6, 0xC9, 0xFF, 0x8D, 0xD3,
-  0xFF, 0x7D, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x7E, 0xFF, 0xFF, 0x4D, 0xD3,
-  0xFF, 0xA6, 0xD1, 0xFF, 0x85, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x66, 0xE1, 0xFF,
-  0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1,
-  0xFF, 0x66, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF,
-  0x65, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x85,
-  0xE1, 0xFF, 0x44, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x86, 0xE1,
-  0xFF, 0x87, 0xC9, 0xFF, 0x2A, 0xBA, 0xFF, 0x59, 0xFE, 0xFF, 0x9E, 0xFF, 0xFF,
-  0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x96, 0xFD, 0xFF, 0x08, 0xB2, 0xFF, 0xA7,
-  0xD1, 0xFF, 0xA7, 0xD9, 0xFF, 0xA7, 0xB9, 0xFF, 0x11, 0xDC, 0xA1, 0xFF, 0xFF,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xFE, 0x1B, 0x69,
-  0xBA, 0xE4, 0xC6, 0xD1, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xC9, 0xFF, 0x8A, 0xCA,
-  0xFF, 0xDB, 0xFE, 0xFF, 0x5D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF,
-  0x97, 0xFD, 0xFF, 0x08, 0xBA, 0xFF, 0xA6, 0xC9, 0xFF, 0x65, 0xD1, 0xFF, 0x85,
-  0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86,
-  0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0xA6, 0xD1, 0xFF, 0x07, 0xBA, 0xFF, 0x79, 0xFE, 0xFF, 0xBD,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x7A, 0xFE, 0xFF, 0x08, 0xBA, 0xFF, 0x65,
-  0xD1, 0xFF, 0x85, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66,
-  0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1,
-  0xFF, 0x65, 0xE1, 0xFF, 0x45, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0xC6, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x66, 0xD1, 0xFF, 0x29,
-  0xBA, 0xFF, 0x76, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9E, 0xFF,
-  0xFF, 0xBA, 0xFE, 0xFF, 0x08, 0xB2, 0xFF, 0x08, 0xD2, 0xFF, 0x86, 0xD1, 0xFF,
-  0xC7, 0xD1, 0xFF, 0xAB, 0xC2, 0xDD, 0x5D, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFD, 0x40,
-  0x07, 0xBA, 0xFF, 0xA6, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xC9, 0xFF, 0x0C,
-  0xCB, 0xFF, 0x5D, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0xFF,
-  0xFF, 0xF4, 0xF4, 0xFF, 0x08, 0xCA, 0xFF, 0xA6, 0xD9, 0xFF, 0x84, 0xD9, 0xFF,
-  0x84, 0xE1, 0xFF, 0xA5, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1,
-  0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF,
-  0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0xC7, 0xD1, 0xFF, 0xEC, 0xD2, 0xFF, 0x7C, 0xFF, 0xFF,
-  0x9C, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFE, 0xF7, 0xFF, 0xBE, 0xFF, 0xFF, 0x3D, 0xFF,
-  0xFF, 0x0D, 0xD3, 0xFF, 0xE8, 0xC9, 0xFF, 0xA6, 0xD9, 0xFF, 0x84, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9,
-  0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD1, 0xFF, 0xA5, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x45, 0xC9, 0xFF, 0x28, 0xCA, 0xFF, 0x34, 0xF5, 0xFF,
-  0x9E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x1D, 0xFF, 0xFF, 0x0C,
-  0xD3, 0xFF, 0x08, 0xD2, 0xFF, 0x65, 0xC9, 0xFF, 0xA6, 0xD1, 0xFF, 0xE7, 0xB9,
-  0xFF, 0x75, 0xFD, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xEC, 0x8B, 0xC7, 0xB9,
-  0xFF, 0x86, 0xD1, 0xFF, 0xA7, 0xD9, 0xFF, 0xC7, 0xB9, 0xFF, 0x0F, 0xDC, 0xFF,
-  0x9E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x92,
-  0xFC, 0xFF, 0xC6, 0xC9, 0xFF, 0xA5, 0xD1, 0xFF, 0xA4, 0xD9, 0xFF, 0xA5, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86,
-  0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1,
-  0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0xC8, 0xC9, 0xFF, 0x6D, 0xCB, 0xFF, 0xFA, 0xFE,
-  0xFF, 0xBD, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF,
-  0xDD, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xFB, 0xFE, 0xFF, 0x6E, 0xCB, 0xFF, 0xA8,
-  0xC1, 0xFF, 0x87, 0xD1, 0xFF, 0x64, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0xA5, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x85, 0xD1, 0xFF, 0xC6, 0xD9, 0xFF, 0x86, 0xC9, 0xFF, 0x08,
-  0xC2, 0xFF, 0x92, 0xF4, 0xFF, 0x9E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0x7D, 0xFF, 0xFF, 0xD0, 0xE3, 0xFF, 0xC8, 0xC9, 0xFF,
-  0x65, 0xD1, 0xFF, 0xA6, 0xD9, 0xFF, 0xC6, 0xB9, 0xFF, 0x30, 0xE4, 0x98, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x06, 0x0C, 0xBB, 0xC8, 0xE8,
-  0xC9, 0xFF, 0x87, 0xD1, 0xFF, 0x85, 0xC9, 0xFF, 0x07, 0xC2, 0xFF, 0x72, 0xE4,
-  0xFF, 0x9E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x5D, 0xFF, 0xFF,
-  0xB2, 0xFC, 0xFF, 0xE6, 0xC1, 0xFF, 0xC6, 0xD9, 0xFF, 0x85, 0xD1, 0xFF, 0xA6,
-  0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x46, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF,
-  0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86,
-  0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0xA6, 0xD9, 0xFF, 0x87, 0xD1, 0xFF, 0xA7, 0xC1, 0xFF, 0x6A, 0xCA, 0xFF, 0x10,
-  0xEC, 0xFF, 0xD6, 0xFD, 0xFF, 0x99, 0xFE, 0xFF, 0x79, 0xFE, 0xFF, 0xB6, 0xFD,
-  0xFF, 0xF0, 0xF3, 0xFF, 0x4A, 0xCA, 0xFF, 0x87, 0xC1, 0xFF, 0x87, 0xD1, 0xFF,
-  0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1,
-  0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF,
-  0xC6, 0xD9, 0xFF, 0xA5, 0xD1, 0xFF, 0x85, 0xD1, 0xFF, 0xA5, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x65, 0xE1,
-  0xFF, 0x86, 0xD9, 0xFF, 0xA7, 0xC9, 0xFF, 0x08, 0xBA, 0xFF, 0x92, 0xE4, 0xFF,
-  0x7E, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xB2,
-  0xE4, 0xFF, 0xC7, 0xB9, 0xFF, 0xA6, 0xD1, 0xFF, 0xA5, 0xD1, 0xFF, 0xC6, 0xC9,
-  0xFF, 0x4C, 0xCB, 0xCA, 0x79, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFE, 0x18, 0x4A, 0xB2, 0xDF,
-  0xA6, 0xC1, 0xFF, 0xC6, 0xE1, 0xFF, 0x86, 0xD1, 0xFF, 0x28, 0xC2, 0xFF, 0xD3,
-  0xEC, 0xFF, 0x9E, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x7D, 0xFF,
-  0xFF, 0xF4, 0xFC, 0xFF, 0xE7, 0xB9, 0xFF, 0xA6, 0xC9, 0xFF, 0xA6, 0xD1, 0xFF,
-  0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x65,
-  0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0xA6, 0xE1,
-  0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF,
-  0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x87, 0xD9,
-  0xFF, 0x87, 0xD9, 0xFF, 0x67, 0xD1, 0xFF, 0xA7, 0xC1, 0xFF, 0xE7, 0xC1, 0xFF,
-  0x07, 0xBA, 0xFF, 0xE7, 0xB9, 0xFF, 0xE7, 0xD1, 0xFF, 0xA7, 0xD1, 0xFF, 0x67,
-  0xD9, 0xFF, 0x87, 0xE1, 0xFF, 0x87, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x65, 0xD9,
-  0xFF, 0x64, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65,
-  0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xD1, 0xFF, 0x85, 0xC9,
-  0xFF, 0xA5, 0xD9, 0xFF, 0xC6, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF,
-  0x85, 0xE1, 0xFF, 0xA6, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD1, 0xFF, 0xA7,
-  0xC9, 0xFF, 0xE8, 0xB1, 0xFF, 0x35, 0xFD, 0xFF, 0x9E, 0xFF, 0xFF, 0x9E, 0xFF,
-  0xFF, 0x9D, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xB1, 0xE4, 0xFF, 0xE7, 0xB1, 0xFF,
-  0xC7, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0xC6, 0xC9, 0xFF, 0x89, 0xCA, 0xDF, 0x78,
-  0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xFE, 0x20, 0x69, 0xBA, 0xEA, 0x85, 0xC9,
-  0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD1, 0xFF, 0x08, 0xC2, 0xFF,
-  0x34, 0xED, 0xFF, 0xBE, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x9E,
-  0xFF, 0xFF, 0xD7, 0xFD, 0xFF, 0x28, 0xBA, 0xFF, 0xC7, 0xD1, 0xFF, 0xC7, 0xD9,
-  0xFF, 0x45, 0xD1, 0xFF, 0xA6, 0xE9, 0xFF, 0x45, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF,
-  0xC6, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6,
-  0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1,
-  0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86,
-  0xE1, 0xFF, 0x87, 0xE1, 0xFF, 0xA6, 0xD9, 0xFF, 0x86, 0xD1, 0xFF, 0xA6, 0xC9,
-  0xFF, 0xC6, 0xD1, 0xFF, 0x85, 0xC9, 0xFF, 0x85, 0xD1, 0xFF, 0x86, 0xD9, 0xFF,
-  0x45, 0xD9, 0xFF, 0x45, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1,
-  0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x65, 0xD1, 0xFF, 0xA6, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x45,
-  0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x66, 0xE9, 0xFF, 0x65, 0xE9, 0xFF, 0x65, 0xE1,
-  0xFF, 0x45, 0xD1, 0xFF, 0xE7, 0xC9, 0xFF, 0x8A, 0xBA, 0xFF,
-  0xD7, 0xFD, 0xFF, 0x5D, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x9D,
-  0xFF, 0xFF, 0x13, 0xF5, 0xFF, 0x07, 0xBA, 0xFF, 0xC6, 0xD1, 0xFF, 0xA6, 0xD9,
-  0xFF, 0xA6, 0xC9, 0xFF, 0x49, 0xC2, 0xEC, 0x75, 0xFD, 0x39, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xFD, 0x3D, 0x08, 0xC2, 0xF7, 0xA6,
-  0xD1, 0xFF, 0xA6, 0xE1, 0xFF, 0xA6, 0xC9, 0xFF, 0x07, 0xAA, 0xFF, 0x13, 0xED,
-  0xFF, 0x7E, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
-  0x79, 0xFE, 0xFF, 0xAA, 0xC2, 0xFF, 0xA6, 0xC1, 0xFF, 0xE7, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x45, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86,
-  0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0xC7, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x45, 0xE1, 0xFF,
-  0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6,
-  0xD9, 0xFF, 0xC6, 0xE1, 0xFF, 0xA6, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9,
-  0xFF, 0x65, 0xE1, 0xFF, 0x86, 0xE9, 0xFF, 0x86, 0xE1, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF,
-  0x86, 0xE9, 0xFF, 0x66, 0xE1, 0xFF, 0x45, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x07,
-  0xCA, 0xFF, 0x89, 0xBA, 0xFF, 0x38, 0xFE, 0xFF, 0x9D, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xF4, 0xF4, 0xFF, 0xE7, 0xB9, 0xFF,
-  0xA6, 0xD1, 0xFF, 0xC6, 0xD9, 0xFF, 0x85, 0xC9, 0xFF, 0x08, 0xC2, 0xF6, 0x75,
-  0xFD, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFD, 0x4F, 0x07, 0xBA, 0xFE,
-  0xA6, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0xA6, 0xC9, 0xFF, 0x08, 0xBA, 0xFF, 0xB3,
-  0xEC, 0xFF, 0x5D, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xDE, 0xFF,
-  0xFF, 0x3C, 0xFF, 0xFF, 0x6D, 0xD3, 0xFF, 0xA7, 0xB9, 0xFF, 0xC7, 0xD1, 0xFF,
-  0xA7, 0xD1, 0xFF, 0xC6, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xA6,
-  0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xE1,
-  0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF,
-  0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x65, 0xE1,
-  0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x86, 0xE1, 0xFF,
-  0x44, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xE1, 0xFF, 0x85,
-  0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xE1, 0xFF, 0x86,
-  0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x45, 0xD9, 0xFF, 0x45, 0xD9, 0xFF, 0x66, 0xD9,
-  0xFF, 0x87, 0xD9, 0xFF, 0xA7, 0xD1, 0xFF, 0xC7, 0xB9, 0xFF, 0xCE, 0xDB, 0xFF,
-  0x7C, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x3D,
-  0xFF, 0xFF, 0x52, 0xEC, 0xFF, 0xC8, 0xC1, 0xFF, 0x87, 0xD1, 0xFF, 0x86, 0xD9,
-  0xFF, 0x85, 0xC9, 0xFF, 0x07, 0xBA, 0xFB, 0xF3, 0xF4, 0x63, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFD, 0x5D, 0xC7, 0xB1,
-  0xFF, 0xC6, 0xD1, 0xFF, 0xA6, 0xD9, 0xFF, 0xA6, 0xD1, 0xFF, 0xE7, 0xB9, 0xFF,
-  0x0F, 0xDC, 0xFF, 0x5D, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D,
-  0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0x35, 0xFD, 0xFF, 0x49, 0xBA, 0xFF, 0xE7, 0xC1,
-  0xFF, 0xA6, 0xD1, 0xFF, 0x85, 0xD1, 0xFF, 0xA5, 0xD1, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x86,
-  0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0xA6, 0xE1, 0xFF, 0x86, 0xE9, 0xFF, 0x85, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x45, 0xE1, 0xFF, 0x86, 0xE9, 0xFF, 0x85, 0xE1,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x45, 0xD9, 0xFF,
-  0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0xA5, 0xD1, 0xFF, 0xA5, 0xD1, 0xFF, 0xA5, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x25, 0xE1, 0xFF,
-  0x45, 0xE1, 0xFF, 0xA7, 0xE1, 0xFF, 0xC7, 0xD9, 0xFF, 0xA6, 0xC9, 0xFF, 0xE7,
-  0xC1, 0xFF, 0x69, 0xBA, 0xFF, 0x35, 0xFD, 0xFF, 0x3C, 0xFF, 0xFF, 0xDE, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x5D, 0xFF, 0xFF, 0xAF, 0xDB, 0xFF,
-  0xC8, 0xC1, 0xFF, 0x87, 0xD1, 0xFF, 0xA7, 0xD9, 0xFF, 0x66, 0xC9, 0xFF, 0x28,
-  0xC2, 0xFD, 0x34, 0xF5, 0x6A, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xFD, 0x4F, 0x28, 0xBA, 0xF7, 0xA6,
-  0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xD1, 0xFF, 0xE6, 0xC1, 0xFF, 0xEB, 0xC2,
-  0xFF, 0xFB, 0xFE, 0xFF, 0x9E, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xBE, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0xDA, 0xFE, 0xFF, 0xEF, 0xDB, 0xFF, 0xE7,
-  0xC1, 0xFF, 0x85, 0xD1, 0xFF, 0xA6, 0xD9, 0xFF, 0xC6, 0xD9, 0xFF, 0x65, 0xD1,
-  0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xE1, 0xFF,
-  0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xE1,
-  0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0xA6, 0xD1, 0xFF, 0xC6, 0xD1, 0xFF,
-  0xA6, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x85,
-  0xD1, 0xFF, 0x85, 0xD1, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x66, 0xE1,
-  0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65,
-  0xE1, 0xFF, 0x66, 0xF1, 0xFF, 0x25, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0xC7, 0xD9,
-  0xFF, 0xC6, 0xB9, 0xFF, 0x27, 0xB2, 0xFF, 0x2E, 0xDC, 0xFF, 0x78, 0xFE, 0xFF,
-  0x9E, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xDB,
-  0xFE, 0xFF, 0xEB, 0xC2, 0xFF, 0xE7, 0xC9, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD1,
-  0xFF, 0xE7, 0xD1, 0xFF, 0x28, 0xBA, 0xF7, 0xF4, 0xEC, 0x64,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xFD, 0x3C, 0x27, 0xCA, 0xED,
-  0x85, 0xD1, 0xFF, 0xC6, 0xE1, 0xFF, 0x85, 0xD1, 0xFF, 0xE7, 0xC9, 0xFF, 0x28,
-  0xBA, 0xFF, 0x96, 0xFD, 0xFF, 0x9E, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xBE, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0xB5, 0xFD, 0xFF, 0x0B, 0xDB, 0xFF,
-  0xA6, 0xB9, 0xFF, 0xE7, 0xC9, 0xFF, 0xC6, 0xD1, 0xFF, 0x85, 0xD1, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1,
-  0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0x85, 0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x85,
-  0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0xC6, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF, 0xA6, 0xD9,
-  0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0xA5, 0xD9, 0xFF,
-  0x85, 0xD1, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66,
-  0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1, 0xFF,
-  0x45, 0xD9, 0xFF, 0xA7, 0xE1, 0xFF, 0xA7, 0xC9, 0xFF, 0xA6, 0xB1, 0xFF, 0x2C,
-  0xCB, 0xFF, 0xD6, 0xFD, 0xFF, 0x9C, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0x9E, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xB6, 0xFD, 0xFF, 0x69, 0xBA, 0xFF,
-  0xA6, 0xC1, 0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xD1, 0xFF, 0xE6, 0xC9, 0xFF, 0x28,
-  0xB2, 0xF2, 0x75, 0xFD, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xFE, 0x21, 0x8A, 0xBA,
-  0xE0, 0xC6, 0xC1, 0xFF, 0x86, 0xD1, 0xFF, 0x85, 0xD9, 0xFF, 0xC6, 0xD9, 0xFF,
-  0x07, 0xC2, 0xFF, 0xCE, 0xDB, 0xFF, 0x3B, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xBE,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x75, 0xF5,
-  0xFF, 0x0C, 0xC3, 0xFF, 0xE7, 0xB9, 0xFF, 0xA7, 0xC9, 0xFF, 0xA6, 0xD9, 0xFF,
-  0x45, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86,
-  0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1,
-  0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0xA5, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0xA5,
-  0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xE1, 0xFF,
-  0x46, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x65,
-  0xD9, 0xFF, 0x85, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0xA7, 0xD1,
-  0xFF, 0xC7, 0xC1, 0xFF, 0xEB, 0xC2, 0xFF, 0x96, 0xFD, 0xFF, 0x7D, 0xFF, 0xFF,
-  0xBE, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x3C,
-  0xFF, 0xFF, 0xEF, 0xE3, 0xFF, 0xC6, 0xB9, 0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xE1,
-  0xFF, 0x64, 0xD1, 0xFF, 0x06, 0xCA, 0xFF, 0xCA, 0xBA, 0xE1, 0x96, 0xF5, 0x3C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xFE, 0x1A, 0x2C,
-  0xCB, 0xC9, 0x08, 0xC2, 0xFF, 0x86, 0xD1, 0xFF, 0xC6, 0xE1, 0xFF, 0x85, 0xD1,
-  0xFF, 0xE6, 0xC9, 0xFF, 0x89, 0xBA, 0xFF, 0xB6, 0xFD, 0xFF, 0x9E, 0xFF, 0xFF,
-  0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x7D,
-  0xFF, 0xFF, 0xD7, 0xFD, 0xFF, 0x2C, 0xD3, 0xFF, 0xE8, 0xC1, 0xFF, 0xE8, 0xD1,
-  0xFF, 0xA7, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF, 0xC7, 0xD9, 0xFF,
-  0xA6, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x45, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0xA6,
-  0xE1, 0xFF, 0xA6, 0xE1, 0xFF, 0xA6, 0xE1, 0xFF, 0xA5, 0xE1, 0xFF, 0x85, 0xD9,
-  0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
-  0x85, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xE9, 0xFF, 0x65, 0xD9,
-  0xFF, 0x65, 0xD1, 0xFF, 0xA6, 0xD9, 0xFF, 0xA7, 0xD1, 0xFF, 0x86, 0xC9, 0xFF,
-  0xA7, 0xC9, 0xFF, 0xE8, 0xC1, 0xFF, 0x2C, 0xD3, 0xFF, 0xD7, 0xFD, 0xFF, 0x7D,
-  0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBF, 0xFF,
-  0xFF, 0x7E, 0xFF, 0xFF, 0xB6, 0xFD, 0xFF, 0xAA, 0xBA, 0xFF,
-  0xC7, 0xC1, 0xFF, 0x65, 0xC9, 0xFF, 0x85, 0xE1, 0xFF, 0x84, 0xD1, 0xFF, 0x06,
-  0xCA, 0xFF, 0x0A, 0xC3, 0xCC, 0x78, 0xFE, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x04, 0x71, 0xDC, 0x89,
-  0x28, 0xBA, 0xFF, 0x86, 0xC9, 0xFF, 0x45, 0xD1, 0xFF, 0xA7, 0xD9, 0xFF, 0xC7,
-  0xC9, 0xFF, 0xE7, 0xB1, 0xFF, 0x6D, 0xD3, 0xFF, 0x79, 0xFE, 0xFF, 0x9E, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF,
-  0xBF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x7A, 0xFE, 0xFF, 0x92, 0xDC, 0xFF, 0xAB,
-  0xBA, 0xFF, 0x29, 0xC2, 0xFF, 0xA6, 0xC1, 0xFF, 0x65, 0xC9, 0xFF, 0x86, 0xD9,
-  0xFF, 0xA6, 0xE1, 0xFF, 0xA6, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x45, 0xD9, 0xFF,
-  0x65, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x65,
-  0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x65, 0xE1, 0xFF, 0x65, 0xE1,
-  0xFF, 0x65, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xE1, 0xFF, 0x66, 0xD9, 0xFF,
-  0x66, 0xD9, 0xFF, 0x65, 0xD1, 0xFF, 0x65, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF, 0xE7,
-  0xD1, 0xFF, 0xE8, 0xC9, 0xFF, 0xC8, 0xB9, 0xFF, 0x8B, 0xC2, 0xFF, 0x73, 0xE4,
-  0xFF, 0x9B, 0xFE, 0xFF, 0xBE, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFE, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x99, 0xFE, 0xFF, 0x4D,
-  0xCB, 0xFF, 0xE8, 0xB9, 0xFF, 0xA7, 0xC1, 0xFF, 0xA7, 0xD1, 0xFF, 0xE8, 0xD9,
-  0xFF, 0xC7, 0xC9, 0xFF, 0x07, 0xBA, 0xFE, 0x2F, 0xDC, 0x99, 0xF9, 0xFE, 0x10,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xFD,
-  0x3E, 0xCB, 0xCA, 0xE8, 0xE8, 0xC9, 0xFF, 0x86, 0xC9, 0xFF, 0xA7, 0xD1, 0xFF,
-  0xA6, 0xC9, 0xFF, 0x08, 0xCA, 0xFF, 0x08, 0xB2, 0xFF, 0x10, 0xD4, 0xFF, 0x7A,
-  0xFE, 0xFF, 0x9E, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x5D, 0xFF, 0xFF, 0x59, 0xFE, 0xFF,
-  0xB2, 0xF4, 0xFF, 0xEB, 0xD2, 0xFF, 0xE7, 0xC1, 0xFF, 0xE7, 0xC1, 0xFF, 0xE7,
-  0xC1, 0xFF, 0xC6, 0xC9, 0xFF, 0xE7, 0xD1, 0xFF, 0xA7, 0xD1, 0xFF, 0x86, 0xD1,
-  0xFF, 0x86, 0xD1, 0xFF, 0xA7, 0xD9, 0xFF, 0xA7, 0xD9, 0xFF,
-  0x86, 0xD1, 0xFF, 0x66, 0xD1, 0xFF, 0xA7, 0xD9, 0xFF, 0xA6, 0xD1, 0xFF, 0x86,
-  0xD1, 0xFF, 0xA6, 0xD1, 0xFF, 0xA6, 0xC9, 0xFF, 0xA6, 0xC9, 0xFF, 0xC7, 0xC9,
-  0xFF, 0x07, 0xCA, 0xFF, 0x07, 0xBA, 0xFF, 0x69, 0xBA, 0xFF, 0xEB, 0xCA, 0xFF,
-  0x51, 0xEC, 0xFF, 0x39, 0xFE, 0xFF, 0x5E, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xBF,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xBD, 0xFF,
-  0xFF, 0xD9, 0xFE, 0xFF, 0x0E, 0xDC, 0xFF, 0xE6, 0xB1, 0xFF, 0x07, 0xCA, 0xFF,
-  0xA7, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0xA7, 0xC9, 0xFF, 0xE8, 0xB9, 0xFF, 0x8A,
-  0xBA, 0xE1, 0x75, 0xFD, 0x50, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59,
-  0xFE, 0x18, 0x0F, 0xD4, 0xA7, 0x28, 0xBA, 0xFF, 0xA7, 0xC1, 0xFF, 0xC7, 0xD9,
-  0xFF, 0x65, 0xD1, 0xFF, 0xA7, 0xD1, 0xFF, 0xA6, 0xC1, 0xFF, 0x08, 0xC2, 0xFF,
-  0xCF, 0xE3, 0xFF, 0x19, 0xFE, 0xFF, 0x5D, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xBE,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xDD, 0xFF,
-  0xFF, 0xBD, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0x38, 0xFE, 0xFF, 0xF3, 0xEC, 0xFF,
-  0x10, 0xDC, 0xFF, 0x0B, 0xC3, 0xFF, 0xAA, 0xBA, 0xFF, 0x28, 0xB2, 0xFF, 0x08,
-  0xB2, 0xFF, 0xE8, 0xB1, 0xFF, 0x08, 0xBA, 0xFF, 0x08, 0xBA, 0xFF, 0x08, 0xBA,
-  0xFF, 0x08, 0xBA, 0xFF, 0xE8, 0xB1, 0xFF, 0xE8, 0xB1, 0xFF, 0x28, 0xB2, 0xFF,
-  0x8A, 0xBA, 0xFF, 0x4C, 0xCB, 0xFF, 0x2F, 0xE4, 0xFF, 0xD2, 0xEC, 0xFF, 0x18,
-  0xFE, 0xFF, 0x1C, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF,
-  0xFF, 0xDE, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x9D, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x38, 0xFE, 0xFF, 0xAE, 0xE3, 0xFF, 0xE8,
-  0xC1, 0xFF, 0xA6, 0xC9, 0xFF, 0xA6, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xD1,
-  0xFF, 0xE8, 0xD1, 0xFF, 0xC7, 0xA9, 0xFC, 0x10, 0xD4, 0x9F, 0x3C, 0xFF, 0x0A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xF7, 0xFD, 0x38, 0xEB, 0xCA, 0xD6, 0xC7, 0xC1, 0xFF, 0xA7,
-  0xD1, 0xFF, 0xA6, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xD1, 0xFF, 0xC7, 0xD1,
-  0xFF, 0x08, 0xC2, 0xFF, 0x0C, 0xCB, 0xFF, 0x76, 0xFD, 0xFF, 0x3D, 0xFF, 0xFF,
-  0x9E, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xDE,
-  0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x9E, 0xFF,
-  0xFF, 0x7D, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0x1B, 0xFF, 0xFF, 0xBB, 0xFE, 0xFF,
-  0x59, 0xFE, 0xFF, 0x18, 0xFE, 0xFF, 0xF8, 0xFD, 0xFF, 0xF8, 0xFD, 0xFF, 0x18,
-  0xFE, 0xFF, 0x59, 0xFE, 0xFF, 0xBB, 0xFE, 0xFF, 0x1C, 0xFF, 0xFF, 0x5D, 0xFF,
-  0xFF, 0x7C, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xDE,
-  0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x5C, 0xFF, 0xFF, 0x95, 0xF5, 0xFF, 0x2C, 0xCB,
-  0xFF, 0xC7, 0xC1, 0xFF, 0xA7, 0xD1, 0xFF, 0x87, 0xD9, 0xFF, 0x66, 0xD9, 0xFF,
-  0x65, 0xD1, 0xFF, 0xC6, 0xD1, 0xFF, 0xA6, 0xC1, 0xFF, 0xAA, 0xCA, 0xD3, 0xB6,
-  0xFD, 0x46, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0x04, 0xD3, 0xEC, 0x6E, 0x8A, 0xBA, 0xEB, 0xC7, 0xC1, 0xFF,
-  0xA6, 0xD1, 0xFF, 0xC6, 0xD9, 0xFF, 0x84, 0xD1, 0xFF, 0x64, 0xC9, 0xFF, 0xE7,
-  0xD9, 0xFF, 0xA6, 0xC1, 0xFF, 0xE7, 0xB9, 0xFF, 0xCF, 0xE3, 0xFF, 0xB7, 0xFD,
-  0xFF, 0xDB, 0xFE, 0xFF, 0x9E, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
-  0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBE,
-  0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF,
-  0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
-  0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDE,
-  0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF,
-  0xFF, 0x9E, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0xFB, 0xFE, 0xFF, 0x95, 0xFD, 0xFF,
-  0xCD, 0xDB, 0xFF, 0x48, 0xBA, 0xFF, 0xE6, 0xC1, 0xFF, 0xA6, 0xC9, 0xFF, 0xA7,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x67, 0xD9, 0xFF, 0xA8, 0xD1, 0xFF, 0xE8, 0xC9,
-  0xFF, 0x49, 0xC2, 0xDD, 0x54, 0xFD, 0x5F, 0x79, 0xFE, 0x0A, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xFE, 0x12, 0x92, 0xEC, 0x78, 0x69, 0xC2,
-  0xE8, 0xE6, 0xC1, 0xFF, 0xE6, 0xD1, 0xFF, 0xA5, 0xD1, 0xFF, 0x85, 0xD9, 0xFF,
-  0xA6, 0xE1, 0xFF, 0x86, 0xD1, 0xFF, 0xA7, 0xC9, 0xFF, 0xA7, 0xB9, 0xFF, 0x4A,
-  0xBA, 0xFF, 0x4E, 0xC3, 0xFF, 0xB3, 0xDC, 0xFF, 0x18, 0xFE, 0xFF, 0x1C, 0xFF,
-  0xFF, 0x9E, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF,
-  0x9E, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF,
-  0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF,
-  0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF,
-  0x9E, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x1C, 0xFF, 0xFF, 0x18, 0xFE, 0xFF, 0xB3,
-  0xE4, 0xFF, 0x2D, 0xCB, 0xFF, 0x08, 0xBA, 0xFF, 0xC6, 0xC1, 0xFF, 0xC6, 0xC9,
-  0xFF, 0x85, 0xD1, 0xFF, 0xA5, 0xD1, 0xFF, 0x85, 0xD1, 0xFF, 0xA6, 0xD9, 0xFF,
-  0xA7, 0xC9, 0xFF, 0xC7, 0xB9, 0xFF, 0x8B, 0xC2, 0xE4, 0x93, 0xEC, 0x6D, 0x1C,
-  0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xFE, 0x0D, 0xF3,
-  0xEC, 0x63, 0x0C, 0xC3, 0xDE, 0x08, 0xBA, 0xFF, 0xE7, 0xD1, 0xFF, 0x86, 0xD9,
-  0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x87, 0xD1, 0xFF,
-  0xC7, 0xC9, 0xFF, 0xE8, 0xC1, 0xFF, 0xE7, 0xB9, 0xFF, 0x08, 0xBA, 0xFF, 0xAA,
-  0xCA, 0xFF, 0x4D, 0xDB, 0xFF, 0x30, 0xEC, 0xFF, 0xF3, 0xFC, 0xFF, 0x55, 0xFD,
-  0xFF, 0xD6, 0xFD, 0xFF, 0x38, 0xFE, 0xFF, 0x38, 0xFE, 0xFF, 0x99, 0xFE, 0xFF,
-  0x79, 0xFE, 0xFF, 0x79, 0xFE, 0xFF, 0x38, 0xFE, 0xFF, 0xD6, 0xFD, 0xFF, 0x75,
-  0xFD, 0xFF, 0xD3, 0xFC, 0xFF, 0x31, 0xEC, 0xFF, 0x4D, 0xD3, 0xFF, 0x8A, 0xC2,
-  0xFF, 0xE7, 0xB9, 0xFF, 0xC7, 0xC1, 0xFF, 0xC7, 0xC9, 0xFF, 0x86, 0xC9, 0xFF,
-  0x86, 0xD1, 0xFF, 0xA6, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xC7,
-  0xD9, 0xFF, 0x86, 0xC1, 0xFF, 0xE8, 0xB9, 0xFD, 0xCB, 0xC2, 0xD9, 0xD3, 0xE4,
-  0x66, 0xFB, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x5D, 0xFF, 0x0B, 0x55, 0xF5, 0x42, 0xAF, 0xDB, 0xA3, 0x49, 0xC2, 0xF1, 0xC7,
-  0xC9, 0xFF, 0x86, 0xD1, 0xFF, 0xC7, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD9,
-  0xFF, 0xA6, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xA6, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF,
-  0xA6, 0xD1, 0xFF, 0xA6, 0xC9, 0xFF, 0xE7, 0xC9, 0xFF, 0xC7, 0xC1, 0xFF, 0xE7,
-  0xC1, 0xFF, 0x07, 0xBA, 0xFF, 0x07, 0xB2, 0xFF, 0x28, 0xBA, 0xFF, 0x28, 0xBA,
-  0xFF, 0x07, 0xB2, 0xFF, 0x07, 0xBA, 0xFF, 0x07, 0xBA, 0xFF, 0xE7, 0xC1, 0xFF,
-  0xC7, 0xC1, 0xFF, 0xC7, 0xC9, 0xFF, 0xC7, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0x86,
-  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xD9,
-  0xFF, 0xA6, 0xD1, 0xFF, 0x86, 0xC1, 0xFF, 0xE8, 0xC1, 0xFF, 0x08, 0xBA, 0xF2,
-  0xCF, 0xE3, 0xA2, 0x18, 0xFE, 0x35, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x04, 0xD7, 0xFD, 0x4B, 0x10, 0xDC, 0xA6,
-  0x28, 0xBA, 0xEF, 0xC6, 0xC1, 0xFF, 0xA6, 0xC9, 0xFF, 0x86, 0xD1, 0xFF, 0xA6,
-  0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xA6, 0xD9,
-  0xFF, 0xC6, 0xD9, 0xFF, 0x86, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF,
-  0xC6, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF, 0xA6, 0xC9, 0xFF, 0xA6,
-  0xD1, 0xFF, 0xA6, 0xD1, 0xFF, 0xA6, 0xD1, 0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xD9,
-  0xFF, 0xA6, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x66, 0xD9, 0xFF,
-  0x86, 0xD9, 0xFF, 0xA6, 0xC9, 0xFF, 0xC6, 0xB9, 0xFF, 0xE7, 0xB1, 0xFD, 0xAA,
-  0xB2, 0xE9, 0xEF, 0xCB, 0xA7, 0x75, 0xED, 0x53, 0xBC, 0xFE, 0x13, 0x79, 0xFE,
-  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xFE,
-  0x0D, 0xD6, 0xFD, 0x3F, 0x91, 0xFC, 0x7C, 0x2B, 0xE3, 0xB9, 0x48, 0xCA, 0xEA,
-  0xE7, 0xC1, 0xFE, 0xC7, 0xC1, 0xFF, 0xE7, 0xC1, 0xFF, 0xC7, 0xC1, 0xFF, 0xC7,
-  0xC9, 0xFF, 0xA6, 0xC1, 0xFF, 0xA6, 0xC9, 0xFF, 0xE7, 0xD1, 0xFF, 0xA6, 0xC9,
-  0xFF, 0xA6, 0xC9, 0xFF, 0xC7, 0xD1, 0xFF, 0xC7, 0xD1, 0xFF, 0xC7, 0xD1, 0xFF,
-  0xA7, 0xD1, 0xFF, 0xA6, 0xC9, 0xFF, 0xC7, 0xC9, 0xFF, 0xC7, 0xC9, 0xFF, 0xC7,
-  0xC9, 0xFF, 0xC7, 0xC9, 0xFF, 0xC7, 0xC1, 0xFF, 0x49, 0xCA, 0xED, 0x6D, 0xDB,
-  0xB4, 0x13, 0xF5, 0x6F, 0x99, 0xFE, 0x2D, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x02, 0xB9, 0xFE,
-  0x13, 0xB6, 0xF5, 0x43, 0x14, 0xED, 0x6E, 0x51, 0xD4, 0x90, 0x0F, 0xCC, 0xB0,
-  0x8E, 0xC3, 0xC9, 0x0C, 0xBB, 0xE2, 0xAB, 0xBA, 0xF1, 0x6A, 0xB2, 0xF9, 0x29,
-  0xBA, 0xFC, 0x6A, 0xC2, 0xFA, 0x49, 0xBA, 0xF6, 0x8B, 0xC2, 0xEF, 0xEC, 0xC2,
-  0xE0, 0x2D, 0xCB, 0xCB, 0xCF, 0xD3, 0xB3, 0x51, 0xDC, 0x92, 0xF4, 0xEC, 0x6D,
-  0xB6, 0xF5, 0x43, 0x7B, 0xFE, 0x1A, 0xFB, 0xFE, 0x08, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1C, 0xFF, 0x09, 0xDB, 0xFE, 0x0E, 0x5B, 0xFE, 0x0E, 0x7B, 0xFE, 0x0F,
-  0x79, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x1C,
-  0xFF, 0x09, 0xBA, 0xFE, 0x06, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x52, 0x4C, 0x45, 0x03, 0x00, 0x00, 0x1E, 0x00, 0x54, 0x00, 0x95, 0x00, 0xD9,
+  0x00, 0x30, 0x01, 0x88, 0x01, 0xE8, 0x01, 0x49, 0x02, 0xB5, 0x02, 0x11, 0x03,
+  0x7D, 0x03, 0xE0, 0x03, 0x48, 0x04, 0x9D, 0x04, 0xF8, 0x04, 0x4A, 0x05, 0x96,
+  0x05, 0xE4, 0x05, 0x34, 0x06, 0x6E, 0x06, 0xA5, 0x06, 0xDC, 0x06, 0x1C, 0x07,
+  0x5A, 0x07, 0x92, 0x07, 0xE3, 0x07, 0x34, 0x08, 0x7D, 0x08, 0xCF, 0x08, 0x25,
+  0x09, 0x81, 0x09, 0xE0, 0x09, 0x44, 0x0A, 0xB1, 0x0A, 0x1A, 0x0B, 0x74, 0x0B,
+  0xD5, 0x0B, 0x33, 0x0C, 0x86, 0x0C, 0xDD, 0x0C, 0x2B, 0x0D, 0x6D, 0x0D, 0x91,
+  0x00, 0x00, 0x00, 0x06, 0x5C, 0xFF, 0x01, 0xFC, 0xFE, 0x04, 0x9D, 0xFF, 0x01,
+  0xFD, 0xFE, 0x02, 0x1C, 0xFF, 0x04, 0x3C, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x91,
+  0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x0E, 0x38, 0xFE, 0x01, 0x4F, 0xD4,
+  0x0B, 0x0E, 0xE4, 0x36, 0x89, 0xD2, 0x72, 0xAB, 0xD2, 0x9C, 0x8A, 0xD2, 0xC4,
+  0x28, 0xCA, 0xCA, 0x08, 0xC2, 0xCE, 0x28, 0xC2, 0xCE, 0x89, 0xCA, 0xBC, 0xAA,
+  0xD2, 0x9A, 0xAA, 0xD2, 0x71, 0x30, 0xE4, 0x39, 0xD3, 0xDC, 0x0C, 0x79, 0xFE,
+  0x01, 0x8D, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x03, 0x17, 0xF6, 0x05,
+  0x4D, 0xCB, 0x3B, 0x6A, 0xD2, 0x9C, 0x08, 0xD2, 0xE4, 0x81, 0xC6, 0xC9, 0xFF,
+  0x0C, 0x08, 0xD2, 0xFF, 0xAA, 0xD2, 0xFF, 0xEB, 0xD2, 0xFF, 0x2B, 0xD3, 0xFF,
+  0x0B, 0xD3, 0xFF, 0x8A, 0xDA, 0xFF, 0xE9, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xA6,
+  0xD1, 0xFF, 0x28, 0xCA, 0xE3, 0x6A, 0xD2, 0x99, 0x6E, 0xD3, 0x41, 0x38, 0xF6,
+  0x06, 0x8B, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x08, 0x75, 0xF5, 0x05,
+  0x2D, 0xD3, 0x40, 0x28, 0xD2, 0xBB, 0xC6, 0xD1, 0xF8, 0x07, 0xD2, 0xFF, 0x2C,
+  0xDB, 0xFF, 0xF4, 0xDC, 0xFF, 0x59, 0xF6, 0xFF, 0x1C, 0xF7, 0xFF, 0x84, 0x5D,
+  0xFF, 0xFF, 0x08, 0x3C, 0xF7, 0xFF, 0x79, 0xF6, 0xFF, 0xF3, 0xE4, 0xFF, 0x2B,
+  0xDB, 0xFF, 0x07, 0xD2, 0xFF, 0xC7, 0xD1, 0xF8, 0x4A, 0xD2, 0xC0, 0x2D, 0xD3,
+  0x46, 0x34, 0xF5, 0x04, 0x89, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x19,
+  0xFF, 0xFF, 0x00, 0xCF, 0xD3, 0x1C, 0x8A, 0xCA, 0xA3, 0xC7, 0xC9, 0xFB, 0x08,
+  0xD2, 0xFF, 0x51, 0xE4, 0xFF, 0xBA, 0xF6, 0xFF, 0xBE, 0xFF, 0xFF, 0xDA, 0xFE,
+  0xFF, 0xB6, 0xED, 0xFF, 0x71, 0xDC, 0xFF, 0xAE, 0xD3, 0xFF, 0x2C, 0xD3, 0xFF,
+  0x0C, 0xD3, 0xFF, 0x4C, 0xD3, 0xFF, 0xAE, 0xCB, 0xFF, 0x91, 0xDC, 0xFF, 0xD6,
+  0xED, 0xFF, 0xDB, 0xF6, 0xFF, 0xBE, 0xFF, 0xFF, 0xBA, 0xF6, 0xFF, 0x51, 0xE4,
+  0xFF, 0x28, 0xD2, 0xFF, 0xC7, 0xD1, 0xFB, 0x8A, 0xCA, 0xA3, 0x10, 0xD4, 0x1C,
+  0x88, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x0A, 0xF7, 0xFD, 0x02, 0x2C,
+  0xCB, 0x46, 0x08, 0xCA, 0xE3, 0xE7, 0xD1, 0xFF, 0x10, 0xDC, 0xFF, 0xFB, 0xF6,
+  0xFF, 0x5D, 0xFF, 0xFF, 0x76, 0xED, 0xFF, 0x2D, 0xDB, 0xFF, 0xE8, 0xD1, 0xFF,
+  0xA6, 0xD9, 0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x82, 0x85, 0xD9, 0xFF, 0x81, 0x86,
+  0xD9, 0xFF, 0x0A, 0xA6, 0xD9, 0xFF, 0x08, 0xD2, 0xFF, 0x2D, 0xDB, 0xFF, 0x96,
+  0xED, 0xFF, 0x7C, 0xFF, 0xFF, 0xFB, 0xF6, 0xFF, 0x10, 0xDC, 0xFF, 0xE7, 0xC9,
+  0xFF, 0x08, 0xD2, 0xE2, 0x4C, 0xD3, 0x44, 0x59, 0xFE, 0x01, 0x86, 0x00, 0x00,
+  0x00, 0x86, 0x00, 0x00, 0x00, 0x07, 0x0B, 0xD3, 0x67, 0xC6, 0xD1, 0xF3, 0x49,
+  0xD2, 0xFF, 0xD6, 0xED, 0xFF, 0x9D, 0xFF, 0xFF, 0x95, 0xED, 0xFF, 0xCA, 0xD2,
+  0xFF, 0x86, 0xD1, 0xFF, 0x81, 0x66, 0xD9, 0xFF, 0x02, 0x86, 0xD9, 0xFF, 0x66,
+  0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x01, 0x66, 0xE1, 0xFF,
+  0x85, 0xD9, 0xFF, 0x81, 0x66, 0xE1, 0xFF, 0x0A, 0x86, 0xD9, 0xFF, 0x85, 0xE1,
+  0xFF, 0x86, 0xD9, 0xFF, 0xCB, 0xD2, 0xFF, 0xB5, 0xED, 0xFF, 0x7E, 0xFF, 0xFF,
+  0xD7, 0xED, 0xFF, 0x69, 0xD2, 0xFF, 0xE7, 0xC9, 0xF1, 0x2C, 0xCB, 0x61, 0x5D,
+  0xFF, 0x01, 0x85, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x07, 0x55, 0xF5,
+  0x02, 0x0C, 0xD3, 0x6B, 0xC7, 0xC9, 0xFB, 0xEB, 0xD2, 0xFF, 0xFC, 0xF6, 0xFF,
+  0x1B, 0xF7, 0xFF, 0x6E, 0xDB, 0xFF, 0xA7, 0xD1, 0xFF, 0x81, 0x86, 0xD9, 0xFF,
+  0x81, 0x66, 0xD9, 0xFF, 0x00, 0x86, 0xD9, 0xFF, 0x81, 0x85, 0xD9, 0xFF, 0x01,
+  0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x82, 0x85, 0xD9, 0xFF, 0x00, 0x86, 0xD9,
+  0xFF, 0x81, 0x85, 0xD9, 0xFF, 0x81, 0x66, 0xE1, 0xFF, 0x07, 0xA7, 0xD1, 0xFF,
+  0x8E, 0xDB, 0xFF, 0x1B, 0xF7, 0xFF, 0xDB, 0xF6, 0xFF, 0xCB, 0xDA, 0xFF, 0xC6,
+  0xD1, 0xFA, 0x2C, 0xD3, 0x6A, 0x76, 0xFD, 0x02, 0x84, 0x00, 0x00, 0x00, 0x83,
+  0x00, 0x00, 0x00, 0x08, 0xBA, 0xFE, 0x00, 0x0C, 0xC3, 0x53, 0xC7, 0xD1, 0xF6,
+  0xEC, 0xD2, 0xFF, 0xFC, 0xF6, 0xFF, 0x7A, 0xF6, 0xFF, 0xAB, 0xD2, 0xFF, 0x86,
+  0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x81, 0x66, 0xD9, 0xFF,
+  0x81, 0x86, 0xD9, 0xFF, 0x08, 0x66, 0xE1, 0xFF, 0x87, 0xD1, 0xFF, 0xC7, 0xC9,
+  0xFF, 0xA6, 0xD1, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xD9, 0xFF,
+  0x65, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x08, 0x66, 0xE1,
+  0xFF, 0x86, 0xD9, 0xFF, 0xAB, 0xD2, 0xFF, 0x9A, 0xF6, 0xFF, 0xFB, 0xF6, 0xFF,
+  0x0B, 0xD3, 0xFF, 0xC7, 0xD1, 0xF4, 0x0C, 0xD3, 0x51, 0x1C, 0xFF, 0x00, 0x83,
+  0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x06, 0xAE, 0xD3, 0x30, 0xE8, 0xC9,
+  0xEE, 0xAA, 0xD2, 0xFF, 0x1C, 0xF7, 0xFF, 0x5A, 0xF6, 0xFF, 0x27, 0xD2, 0xFF,
+  0x85, 0xD9, 0xFF, 0x85, 0x66, 0xD9, 0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x04, 0x6A,
+  0xD2, 0xFF, 0x17, 0xF6, 0xFF, 0x3C, 0xFF, 0xFF, 0x99, 0xFE, 0xFF, 0xEC, 0xDA,
+  0xFF, 0x82, 0x85, 0xD9, 0xFF, 0x01, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x81,
+  0x85, 0xD9, 0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x05, 0x28, 0xCA, 0xFF, 0x79, 0xF6,
+  0xFF, 0x1B, 0xF7, 0xFF, 0x8A, 0xD2, 0xFF, 0x07, 0xCA, 0xEE, 0xAF, 0xDB, 0x2E,
+  0x83, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x06, 0x71, 0xE4, 0x0B, 0x29,
+  0xCA, 0xBF, 0x07, 0xD2, 0xFF, 0x38, 0xF6, 0xFF, 0xDB, 0xF6, 0xFF, 0x6A, 0xD2,
+  0xFF, 0x85, 0xE1, 0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x00, 0x85, 0xD9, 0xFF, 0x82,
+  0x66, 0xD9, 0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x07, 0xC7, 0xD1, 0xFF, 0xF7, 0xF5,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF5, 0xFF,
+  0x86, 0xD1, 0xFF, 0x85, 0xD9, 0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x00, 0x66, 0xE1,
+  0xFF, 0x82, 0x65, 0xE1, 0xFF, 0x07, 0x86, 0xD9, 0xFF, 0x85, 0xE1, 0xFF, 0x8A,
+  0xD2, 0xFF, 0xDB, 0xF6, 0xFF, 0x38, 0xF6, 0xFF, 0x08, 0xCA, 0xFF, 0x4A, 0xCA,
+  0xC3, 0x92, 0xDC, 0x0C, 0x82, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x05,
+  0xEB, 0xD2, 0x6C, 0xA7, 0xC9, 0xFF, 0xD3, 0xE4, 0xFF, 0x7D, 0xFF, 0xFF, 0x0B,
+  0xD3, 0xFF, 0x85, 0xD9, 0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x00, 0x85, 0xD9, 0xFF,
+  0x85, 0x86, 0xD9, 0xFF, 0x01, 0x49, 0xD2, 0xFF, 0x3C, 0xF7, 0xFF, 0x82, 0xFF,
+  0xFF, 0xFF, 0x03, 0x1C, 0xF7, 0xFF, 0x28, 0xD2, 0xFF, 0x66, 0xE1, 0xFF, 0x66,
+  0xD9, 0xFF, 0x82, 0x85, 0xD9, 0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x08, 0x66, 0xE1,
+  0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x0C, 0xD3, 0xFF, 0x7D, 0xFF, 0xFF,
+  0xD3, 0xE4, 0xFF, 0xA7, 0xC9, 0xFF, 0x0C, 0xD3, 0x6F, 0x79, 0xFE, 0x00, 0x81,
+  0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x09, 0x71, 0xE4, 0x14, 0x08, 0xCA,
+  0xDD, 0xCB, 0xD2, 0xFF, 0x5D, 0xFF, 0xFF, 0xD2, 0xE4, 0xFF, 0xA6, 0xD9, 0xFF,
+  0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x85,
+  0x86, 0xD9, 0xFF, 0x01, 0x6A, 0xDA, 0xFF, 0x5D, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
+  0xFF, 0x02, 0xDF, 0xFF, 0xFF, 0x5D, 0xFF, 0xFF, 0x69, 0xD2, 0xFF, 0x81, 0x86,
+  0xD9, 0xFF, 0x81, 0x85, 0xD9, 0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x00, 0x66, 0xE1,
+  0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x81, 0x85, 0xD9, 0xFF, 0x04, 0xB3, 0xE4, 0xFF,
+  0x5D, 0xFF, 0xFF, 0xCB, 0xD2, 0xFF, 0x07, 0xD2, 0xE2, 0x92, 0xDC, 0x1A, 0x81,
+  0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xAB, 0xCA, 0x70,
+  0xC6, 0xC9, 0xFE, 0x76, 0xED, 0xFF, 0xDB, 0xF6, 0xFF, 0x28, 0xD2, 0xFF, 0x8A,
+  0x86, 0xD9, 0xFF, 0x01, 0x49, 0xD2, 0xFF, 0x5C, 0xF7, 0xFF, 0x82, 0xFF, 0xFF,
+  0xFF, 0x01, 0x5D, 0xFF, 0xFF, 0x6A, 0xD2, 0xFF, 0x85, 0x86, 0xD9, 0xFF, 0x0B,
+  0x65, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x65,
+  0xE1, 0xFF, 0x09, 0xD2, 0xFF, 0xFB, 0xF6, 0xFF, 0x75, 0xED, 0xFF, 0xA7, 0xD1,
+  0xFF, 0xEC, 0xCA, 0x76, 0xFB, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0xB3, 0xE4, 0x08, 0x29, 0xD2, 0xD3, 0xAA, 0xD2, 0xFF, 0x9D, 0xFF, 0xFF,
+  0x31, 0xE4, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x88,
+  0x86, 0xD9, 0xFF, 0x01, 0x29, 0xD2, 0xFF, 0x3C, 0xF7, 0xFF, 0x82, 0xFF, 0xFF,
+  0xFF, 0x01, 0x3C, 0xF7, 0xFF, 0x49, 0xD2, 0xFF, 0x85, 0x86, 0xD9, 0xFF, 0x0B,
+  0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0xA6, 0xD9, 0xFF, 0x85,
+  0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x51, 0xDC, 0xFF, 0x9C, 0xFF, 0xFF, 0x8A, 0xDA,
+  0xFF, 0x29, 0xCA, 0xD9, 0x92, 0xDC, 0x08, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+  0x00, 0xCF, 0xDB, 0x39, 0xC6, 0xC9, 0xFF, 0xB2, 0xE4, 0xFF, 0x3C, 0xFF, 0xFF,
+  0x29, 0xD2, 0xFF, 0x8B, 0x86, 0xD9, 0xFF, 0x01, 0xE8, 0xC9, 0xFF, 0xFB, 0xF6,
+  0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0x01, 0xFB, 0xF6, 0xFF, 0x08, 0xCA, 0xFF, 0x85,
+  0x86, 0xD9, 0xFF, 0x0B, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xD9, 0xFF,
+  0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x85, 0xE1, 0xFF, 0x29, 0xD2, 0xFF, 0x3C,
+  0xFF, 0xFF, 0xD2, 0xDC, 0xFF, 0xC7, 0xC9, 0xFF, 0xF0, 0xE3, 0x38, 0x00, 0x00,
+  0x00, 0x06, 0xFF, 0xFF, 0x00, 0xAA, 0xCA, 0x81, 0xC7, 0xD1, 0xFF, 0x9A, 0xF6,
+  0xFF, 0x96, 0xED, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x8A, 0x86, 0xD9,
+  0xFF, 0x01, 0xC7, 0xC9, 0xFF, 0xBA, 0xF6, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0x01,
+  0x9A, 0xF6, 0xFF, 0xA7, 0xC9, 0xFF, 0x88, 0x86, 0xD9, 0xFF, 0x08, 0x66, 0xE1,
+  0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x96, 0xED, 0xFF,
+  0xBA, 0xF6, 0xFF, 0xC7, 0xD1, 0xFF, 0xAB, 0xCA, 0x8B, 0xFB, 0xFE, 0x00, 0x06,
+  0xFB, 0xFE, 0x02, 0x69, 0xCA, 0xC0, 0x6A, 0xDA, 0xFF, 0x5D, 0xFF, 0xFF, 0xF0,
+  0xD3, 0xFF, 0x65, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x8A, 0x86, 0xD9, 0xFF, 0x01,
+  0xA7, 0xD1, 0xFF, 0x59, 0xF6, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0x01, 0x38, 0xF6,
+  0xFF, 0xA6, 0xD1, 0xFF, 0x87, 0x86, 0xD9, 0xFF, 0x00, 0x65, 0xD9, 0xFF, 0x81,
+  0x66, 0xD9, 0xFF, 0x06, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0xF0, 0xD3, 0xFF,
+  0x3D, 0xFF, 0xFF, 0x6A, 0xDA, 0xFF, 0x69, 0xCA, 0xC6, 0x3D, 0xFF, 0x03, 0x04,
+  0x95, 0xFD, 0x10, 0x07, 0xCA, 0xDF, 0x6E, 0xD3, 0xFF, 0x5D, 0xFF, 0xFF, 0xAB,
+  0xD2, 0xFF, 0x81, 0x85, 0xD9, 0xFF, 0x8A, 0x86, 0xD9, 0xFF, 0x01, 0xA6, 0xD1,
+  0xFF, 0xF7, 0xF5, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0x01, 0xB6, 0xF5, 0xFF, 0xA6,
+  0xD1, 0xFF, 0x86, 0x86, 0xD9, 0xFF, 0x0A, 0x66, 0xD9, 0xFF, 0x65, 0xE1, 0xFF,
+  0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0xAB,
+  0xD2, 0xFF, 0x5D, 0xFF, 0xFF, 0x8E, 0xD3, 0xFF, 0xE7, 0xC9, 0xE1, 0x34, 0xFD,
+  0x12, 0x05, 0x30, 0xE4, 0x2A, 0xE7, 0xD1, 0xF1, 0x52, 0xE4, 0xFF, 0x3C, 0xF7,
+  0xFF, 0x07, 0xD2, 0xFF, 0x66, 0xD9, 0xFF, 0x8B, 0x86, 0xD9, 0xFF, 0x01, 0x86,
+  0xD1, 0xFF, 0x96, 0xF5, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0x00, 0x34, 0xED, 0xFF,
+  0x8D, 0x86, 0xD9, 0xFF, 0x04, 0xE7, 0xD1, 0xFF, 0x5C, 0xFF, 0xFF, 0x72, 0xDC,
+  0xFF, 0xE7, 0xD1, 0xF4, 0x0F, 0xEC, 0x29, 0x05, 0xEC, 0xD2, 0x33, 0xC6, 0xD1,
+  0xF9, 0xF4, 0xEC, 0xFF, 0xDB, 0xF6, 0xFF, 0xA6, 0xD1, 0xFF, 0x66, 0xD9, 0xFF,
+  0x8C, 0x86, 0xD9, 0xFF, 0x00, 0x14, 0xED, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0x00,
+  0xB2, 0xE4, 0xFF, 0x8D, 0x86, 0xD9, 0xFF, 0x04, 0xA6, 0xD1, 0xFF, 0xDB, 0xF6,
+  0xFF, 0xF4, 0xEC, 0xFF, 0xC6, 0xD1, 0xFB, 0x0C, 0xCB, 0x36, 0x05, 0x49, 0xCA,
+  0x33, 0xA6, 0xD1, 0xFB, 0x55, 0xED, 0xFF, 0xBA, 0xF6, 0xFF, 0x86, 0xD9, 0xFF,
+  0x66, 0xE1, 0xFF, 0x8C, 0x86, 0xD9, 0xFF, 0x01, 0xB3, 0xE4, 0xFF, 0xDF, 0xFF,
+  0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 0xE4, 0xFF, 0x8E, 0x86, 0xD9, 0xFF,
+  0x03, 0x9A, 0xF6, 0xFF, 0x55, 0xED, 0xFF, 0xA6, 0xD1, 0xFD, 0xCB, 0xCA, 0x3C,
+  0x07, 0xAB, 0xCA, 0x39, 0xA6, 0xD1, 0xFB, 0x54, 0xE5, 0xFF, 0xBA, 0xF6, 0xFF,
+  0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x8A,
+  0x85, 0xD9, 0xFF, 0x00, 0x51, 0xDC, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x01, 0xDF,
+  0xFF, 0xFF, 0x8E, 0xE3, 0xFF, 0x8D, 0x85, 0xD9, 0xFF, 0x04, 0x86, 0xD9, 0xFF,
+  0xBA, 0xF6, 0xFF, 0x55, 0xED, 0xFF, 0xA6, 0xD1, 0xFC, 0x6A, 0xCA, 0x35, 0x06,
+  0x4D, 0xD3, 0x31, 0xC6, 0xD1, 0xF7, 0xD3, 0xE4, 0xFF, 0xFB, 0xF6, 0xFF, 0xC6,
+  0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x8B, 0x86, 0xD9, 0xFF, 0x04,
+  0xEF, 0xE3, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x2C,
+  0xDB, 0xFF, 0x8D, 0x85, 0xD9, 0xFF, 0x04, 0xA6, 0xD1, 0xFF, 0xFB, 0xF6, 0xFF,
+  0xF3, 0xEC, 0xFF, 0xC7, 0xD1, 0xF9, 0x2C, 0xD3, 0x33, 0x04, 0x50, 0xEC, 0x21,
+  0xE7, 0xD1, 0xED, 0x31, 0xDC, 0xFF, 0x3C, 0xFF, 0xFF, 0x28, 0xD2, 0xFF, 0x8D,
+  0x86, 0xD9, 0xFF, 0x04, 0x2D, 0xDB, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xBE, 0xFF, 0xFF, 0x6A, 0xCA, 0xFF, 0x8D, 0x85, 0xD9, 0xFF, 0x04, 0x07, 0xDA,
+  0xFF, 0x5C, 0xFF, 0xFF, 0x31, 0xDC, 0xFF, 0xE7, 0xD1, 0xEE, 0x50, 0xEC, 0x24,
+  0x04, 0xD7, 0xFD, 0x0B, 0x07, 0xCA, 0xDA, 0x4D, 0xD3, 0xFF, 0x7E, 0xFF, 0xFF,
+  0xEC, 0xD2, 0xFF, 0x81, 0x85, 0xD9, 0xFF, 0x8B, 0x86, 0xD9, 0xFF, 0x04, 0x28,
+  0xCA, 0xFF, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xF6, 0xFF, 0xE8, 0xD1,
+  0xFF, 0x86, 0x85, 0xD9, 0xFF, 0x0B, 0x86, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x65,
+  0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x85, 0xD9,
+  0xFF, 0x0C, 0xD3, 0xFF, 0x5D, 0xFF, 0xFF, 0x4D, 0xD3, 0xFF, 0x07, 0xCA, 0xDA,
+  0xD7, 0xFD, 0x0A, 0x04, 0x1C, 0xFF, 0x01, 0x89, 0xCA, 0xB7, 0x69, 0xDA, 0xFF,
+  0x3D, 0xFF, 0xFF, 0x50, 0xDC, 0xFF, 0x81, 0x85, 0xD9, 0xFF, 0x8A, 0x86, 0xD9,
+  0xFF, 0x06, 0x85, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0xCF, 0xE3, 0xFF, 0xB5, 0xED,
+  0xFF, 0x2C, 0xDB, 0xFF, 0x86, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x87, 0x85, 0xD9,
+  0xFF, 0x09, 0x65, 0xD9, 0xFF, 0x66, 0xD9, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9,
+  0xFF, 0xA5, 0xD9, 0xFF, 0x51, 0xDC, 0xFF, 0x3C, 0xFF, 0xFF, 0x49, 0xD2, 0xFF,
+  0x89, 0xCA, 0xB3, 0xFC, 0xFE, 0x01, 0x06, 0x00, 0x00, 0x00, 0xCA, 0xCA, 0x74,
+  0xC6, 0xC9, 0xFF, 0x38, 0xF6, 0xFF, 0xF7, 0xED, 0xFF, 0xA6, 0xD9, 0xFF, 0x85,
+  0xD9, 0xFF, 0x8D, 0x86, 0xD9, 0xFF, 0x03, 0xA6, 0xD9, 0xFF, 0x85, 0xE1, 0xFF,
+  0xA5, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0x87, 0x85, 0xD9, 0xFF, 0x01, 0x86, 0xD9,
+  0xFF, 0x66, 0xE1, 0xFF, 0x81, 0x85, 0xD9, 0xFF, 0x05, 0xA6, 0xD9, 0xFF, 0xF7,
+  0xED, 0xFF, 0x58, 0xEE, 0xFF, 0xA7, 0xD1, 0xFF, 0x8A, 0xCA, 0x6D, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0x00, 0x00, 0x10, 0xE4, 0x23, 0xC6, 0xC9, 0xFC, 0x30, 0xDC,
+  0xFF, 0x7D, 0xFF, 0xFF, 0x8A, 0xD2, 0xFF, 0x86, 0xE1, 0xFF, 0x8B, 0x86, 0xD9,
+  0xFF, 0x00, 0x66, 0xE1, 0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x02, 0x85, 0xE1, 0xFF,
+  0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0x85, 0xD9, 0xFF, 0x0A, 0x86, 0xD9,
+  0xFF, 0x66, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xE1, 0xFF,
+  0x6A, 0xD2, 0xFF, 0x7D, 0xFF, 0xFF, 0x50, 0xDC, 0xFF, 0xC7, 0xC9, 0xFD, 0x10,
+  0xE4, 0x27, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xB2, 0xEC, 0x04, 0x49,
+  0xD2, 0xC1, 0x48, 0xD2, 0xFF, 0x3C, 0xFF, 0xFF, 0xD3, 0xEC, 0xFF, 0x86, 0xD1,
+  0xFF, 0x85, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x89, 0x86, 0xD9, 0xFF, 0x04, 0xA6,
+  0xD9, 0xFF, 0xAA, 0xDA, 0xFF, 0x8D, 0xDB, 0xFF, 0x8A, 0xDA, 0xFF, 0x86, 0xD9,
+  0xFF, 0x87, 0x85, 0xD9, 0xFF, 0x0A, 0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0xA5,
+  0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0x87, 0xD1, 0xFF, 0xF3, 0xE4, 0xFF, 0x5B, 0xFF,
+  0xFF, 0x29, 0xDA, 0xFF, 0x29, 0xCA, 0xBE, 0xF3, 0xE4, 0x05, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0x00, 0x0B, 0xCB, 0x59, 0xC6, 0xD1, 0xFC,
+  0xF4, 0xE4, 0xFF, 0x3C, 0xFF, 0xFF, 0x89, 0xDA, 0xFF, 0x86, 0xE1, 0xFF, 0x85,
+  0xD9, 0xFF, 0x88, 0x86, 0xD9, 0xFF, 0x05, 0xA6, 0xD9, 0xFF, 0x30, 0xDC, 0xFF,
+  0x7C, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x7E, 0xFF, 0xFF, 0xF0, 0xDB, 0xFF, 0x86,
+  0x85, 0xD9, 0xFF, 0x0B, 0x65, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF,
+  0x85, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x6A, 0xD2, 0xFF, 0x3C, 0xFF, 0xFF, 0xF3,
+  0xEC, 0xFF, 0xC6, 0xD1, 0xFC, 0x0C, 0xCB, 0x5A, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x81, 0x00, 0x00, 0x00, 0x05, 0x13, 0xED, 0x0B, 0x28, 0xCA, 0xCE, 0x49,
+  0xD2, 0xFF, 0x1C, 0xFF, 0xFF, 0x75, 0xED, 0xFF, 0xA6, 0xD1, 0xFF, 0x81, 0x86,
+  0xD9, 0xFF, 0x00, 0x85, 0xE1, 0xFF, 0x86, 0x86, 0xD9, 0xFF, 0x01, 0x28, 0xD2,
+  0xFF, 0xFB, 0xF6, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0x02, 0xFB, 0xF6, 0xFF, 0x08,
+  0xD2, 0xFF, 0x86, 0xD9, 0xFF, 0x84, 0x85, 0xD9, 0xFF, 0x09, 0x65, 0xD9, 0xFF,
+  0x85, 0xD9, 0xFF, 0x86, 0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x75,
+  0xED, 0xFF, 0x1C, 0xFF, 0xFF, 0x49, 0xD2, 0xFF, 0x28, 0xD2, 0xCB, 0x54, 0xED,
+  0x09, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x00,
+  0x0B, 0xCB, 0x48, 0xA7, 0xD1, 0xFB, 0x10, 0xDC, 0xFF, 0x7D, 0xFF, 0xFF, 0xEF,
+  0xDB, 0xFF, 0x82, 0x86, 0xD9, 0xFF, 0x00, 0x85, 0xD9, 0xFF, 0x85, 0x86, 0xD9,
+  0xFF, 0x01, 0x49, 0xDA, 0xFF, 0x3C, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0x03,
+  0x3C, 0xFF, 0xFF, 0x48, 0xDA, 0xFF, 0x66, 0xE1, 0xFF, 0x66, 0xD9, 0xFF, 0x81,
+  0x85, 0xD9, 0xFF, 0x02, 0x65, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x85, 0xD9, 0xFF,
+  0x81, 0x65, 0xE1, 0xFF, 0x05, 0x66, 0xD9, 0xFF, 0xEF, 0xDB, 0xFF, 0x9D, 0xFF,
+  0xFF, 0x10, 0xDC, 0xFF, 0xC7, 0xC9, 0xFA, 0x0C, 0xCB, 0x4B, 0x82, 0x00, 0x00,
+  0x00, 0x82, 0x00, 0x00, 0x00, 0x06, 0x70, 0xDC, 0x04, 0x69, 0xCA, 0xA0, 0xC7,
+  0xD1, 0xFF, 0x96, 0xED, 0xFF, 0x5D, 0xFF, 0xFF, 0x0C, 0xDB, 0xFF, 0x85, 0xD9,
+  0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x00, 0x85, 0xD9, 0xFF, 0x82, 0x86, 0xE1, 0xFF,
+  0x81, 0x86, 0xD9, 0xFF, 0x07, 0xC7, 0xD1, 0xFF, 0xF7, 0xED, 0xFF, 0xFE, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xD8, 0xED, 0xFF, 0xA6, 0xD1, 0xFF,
+  0x85, 0xD9, 0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x81, 0x66, 0xE1, 0xFF, 0x01, 0x65,
+  0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x81, 0x85, 0xD9, 0xFF, 0x05, 0x0C, 0xDB, 0xFF,
+  0x3D, 0xFF, 0xFF, 0x96, 0xED, 0xFF, 0xE7, 0xC9, 0xFF, 0x6A, 0xCA, 0x9F, 0x93,
+  0xE4, 0x04, 0x82, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x06, 0x91, 0xEC,
+  0x12, 0x08, 0xCA, 0xD1, 0x08, 0xCA, 0xFF, 0x59, 0xF6, 0xFF, 0x1C, 0xFF, 0xFF,
+  0xEA, 0xDA, 0xFF, 0xA6, 0xD1, 0xFF, 0x81, 0x86, 0xE1, 0xFF, 0x00, 0x86, 0xD9,
+  0xFF, 0x82, 0x86, 0xE1, 0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x04, 0x09, 0xD2, 0xFF,
+  0xF3, 0xEC, 0xFF, 0xF7, 0xED, 0xFF, 0xD3, 0xEC, 0xFF, 0x09, 0xD2, 0xFF, 0x81,
+  0x85, 0xD9, 0xFF, 0x03, 0x65, 0xE1, 0xFF, 0x65, 0xD9, 0xFF, 0x86, 0xD9, 0xFF,
+  0xA5, 0xD9, 0xFF, 0x81, 0x85, 0xD9, 0xFF, 0x06, 0x86, 0xD1, 0xFF, 0xEC, 0xD2,
+  0xFF, 0x1C, 0xFF, 0xFF, 0x58, 0xEE, 0xFF, 0x08, 0xD2, 0xFF, 0x28, 0xCA, 0xD3,
+  0x51, 0xE4, 0x15, 0x83, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x06, 0x0C,
+  0xCB, 0x2C, 0xE7, 0xD1, 0xE4, 0x69, 0xD2, 0xFF, 0x79, 0xF6, 0xFF, 0x1C, 0xFF,
+  0xFF, 0x8E, 0xDB, 0xFF, 0xA6, 0xD9, 0xFF, 0x82, 0x86, 0xD9, 0xFF, 0x81, 0x86,
+  0xE1, 0xFF, 0x83, 0x86, 0xD9, 0xFF, 0x05, 0xA6, 0xD1, 0xFF, 0xA6, 0xD9, 0xFF,
+  0x65, 0xE1, 0xFF, 0x85, 0xE1, 0xFF, 0x85, 0xD9, 0xFF, 0x65, 0xE1, 0xFF, 0x82,
+  0x85, 0xD9, 0xFF, 0x07, 0x66, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x8D, 0xD3, 0xFF,
+  0x1C, 0xFF, 0xFF, 0x59, 0xF6, 0xFF, 0x69, 0xD2, 0xFF, 0xE7, 0xC9, 0xE6, 0x4C,
+  0xDB, 0x32, 0x84, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x08, 0x6D, 0xD3,
+  0x38, 0xE7, 0xC9, 0xE8, 0x28, 0xD2, 0xFF, 0xF7, 0xED, 0xFF, 0x9D, 0xFF, 0xFF,
+  0xB2, 0xE4, 0xFF, 0x28, 0xD2, 0xFF, 0xA6, 0xD9, 0xFF, 0x85, 0xD9, 0xFF, 0x81,
+  0x86, 0xE1, 0xFF, 0x81, 0x86, 0xD9, 0xFF, 0x02, 0x86, 0xE1, 0xFF, 0x85, 0xD9,
+  0xFF, 0x65, 0xE1, 0xFF, 0x81, 0x85, 0xD9, 0xFF, 0x01, 0x65, 0xD9, 0xFF, 0x86,
+  0xD9, 0xFF, 0x81, 0x85, 0xD9, 0xFF, 0x08, 0x65, 0xE1, 0xFF, 0x86, 0xD9, 0xFF,
+  0x28, 0xD2, 0xFF, 0xB2, 0xE4, 0xFF, 0x9D, 0xFF, 0xFF, 0xF7, 0xED, 0xFF, 0x09,
+  0xD2, 0xFF, 0xE7, 0xC9, 0xEA, 0x6D, 0xD3, 0x3C, 0x85, 0x00, 0x00, 0x00, 0x86,
+  0x00, 0x00, 0x00, 0x0E, 0x2C, 0xDB, 0x34, 0xE7, 0xD1, 0xD9, 0xE7, 0xD1, 0xFF,
+  0xB2, 0xE4, 0xFF, 0x7C, 0xFF, 0xFF, 0x99, 0xF6, 0xFF, 0xCE, 0xDB, 0xFF, 0xE7,
+  0xD1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xE1, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xE1,
+  0xFF, 0x85, 0xD9, 0xFF, 0xA5, 0xD9, 0xFF, 0xA6, 0xD9, 0xFF, 0x81, 0x85, 0xD9,
+  0xFF, 0x01, 0x86, 0xD9, 0xFF, 0x66, 0xE1, 0xFF, 0x81, 0x85, 0xD9, 0xFF, 0x07,
+  0xC7, 0xD9, 0xFF, 0xAE, 0xDB, 0xFF, 0xB9, 0xF6, 0xFF, 0x5D, 0xFF, 0xFF, 0xB2,
+  0xE4, 0xFF, 0xE7, 0xD1, 0xFF, 0x27, 0xCA, 0xDC, 0x4D, 0xD3, 0x3B, 0x86, 0x00,
+  0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x09, 0xAE, 0xD3, 0x1D, 0x69, 0xCA, 0xB8,
+  0xA6, 0xD1, 0xFE, 0x0C, 0xD3, 0xFF, 0xF7, 0xED, 0xFF, 0x9E, 0xFF, 0xFF, 0x9A,
+  0xF6, 0xFF, 0x92, 0xE4, 0xFF, 0xCB, 0xD2, 0xFF, 0xC6, 0xD1, 0xFF, 0x83, 0x86,
+  0xD9, 0xFF, 0x0C, 0x85, 0xD9, 0xFF, 0x86, 0xD9, 0xFF, 0x86, 0xD1, 0xFF, 0xC7,
+  0xD1, 0xFF, 0xAB, 0xD2, 0xFF, 0x72, 0xE4, 0xFF, 0x9A, 0xF6, 0xFF, 0xBD, 0xFF,
+  0xFF, 0xF7, 0xED, 0xFF, 0xEC, 0xD2, 0xFF, 0xC7, 0xC9, 0xFE, 0x68, 0xCA, 0xBC,
+  0xCD, 0xD3, 0x21, 0x87, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x19, 0x51,
+  0xE4, 0x09, 0xEB, 0xCA, 0x6B, 0xE8, 0xC9, 0xE7, 0xC7, 0xD1, 0xFF, 0x2C, 0xDB,
+  0xFF, 0x96, 0xED, 0xFF, 0x3C, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0xFB, 0xF6, 0xFF,
+  0xB6, 0xED, 0xFF, 0xF3, 0xDC, 0xFF, 0x72, 0xDC, 0xFF, 0x51, 0xDC, 0xFF, 0x72,
+  0xDC, 0xFF, 0xF3, 0xDC, 0xFF, 0xD6, 0xED, 0xFF, 0xFB, 0xF6, 0xFF, 0x7D, 0xFF,
+  0xFF, 0x3C, 0xFF, 0xFF, 0xB6, 0xED, 0xFF, 0x0C, 0xDB, 0xFF, 0xC7, 0xD1, 0xFE,
+  0xE7, 0xD1, 0xE6, 0xCB, 0xC2, 0x6B, 0x10, 0xDC, 0x08, 0xFF, 0xFF, 0x00, 0x87,
+  0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x16, 0xFF, 0xFF, 0x00, 0xAF, 0xD3,
+  0x1F, 0x8A, 0xCA, 0x88, 0x07, 0xCA, 0xEB, 0xA6, 0xD1, 0xFF, 0x29, 0xD2, 0xFF,
+  0xAF, 0xD3, 0xFF, 0x34, 0xE5, 0xFF, 0x38, 0xF6, 0xFF, 0xDA, 0xFE, 0xFF, 0x3C,
+  0xFF, 0xFF, 0x5D, 0xFF, 0xFF, 0x3C, 0xFF, 0xFF, 0xDB, 0xFE, 0xFF, 0x38, 0xEE,
+  0xFF, 0x14, 0xE5, 0xFF, 0xAE, 0xDB, 0xFF, 0x48, 0xD2, 0xFF, 0xA6, 0xC9, 0xFF,
+  0xE8, 0xC9, 0xEA, 0x8B, 0xD2, 0x86, 0xAE, 0xDB, 0x1C, 0x79, 0xFE, 0x00, 0x89,
+  0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x12, 0x96, 0xF5, 0x01, 0x51, 0xDC,
+  0x13, 0xCB, 0xD2, 0x5F, 0x49, 0xD2, 0xB3, 0xE7, 0xD1, 0xE6, 0xC6, 0xD1, 0xFB,
+  0xC6, 0xD1, 0xFF, 0xE7, 0xD1, 0xFF, 0x07, 0xCA, 0xFF, 0x08, 0xCA, 0xFF, 0x07,
+  0xCA, 0xFF, 0xE7, 0xD1, 0xFF, 0xA7, 0xD1, 0xFF, 0xA6, 0xD1, 0xFB, 0xE7, 0xC9,
+  0xE3, 0x49, 0xCA, 0xB2, 0xCB, 0xCA, 0x62, 0x31, 0xDC, 0x10, 0x96, 0xED, 0x01,
+  0x8B, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x0C, 0xDB, 0xFE, 0x01, 0x70,
+  0xF4, 0x18, 0x89, 0xCA, 0x37, 0x2C, 0xD3, 0x60, 0xEB, 0xCA, 0x80, 0x8A, 0xC2,
+  0x9A, 0x29, 0xC2, 0x9D, 0x49, 0xCA, 0x94, 0xCB, 0xCA, 0x83, 0x0C, 0xD3, 0x60,
+  0xAB, 0xCA, 0x39, 0xD2, 0xEC, 0x15, 0xFF, 0xFF, 0x00, 0x8E, 0x00, 0x00, 0x00,
 };
 const lv_img_dsc_t ui_img_warning_icon_png = {
   .header.always_zero = 0,
-  .header.w = 110,
-  .header.h = 110,
+  .header.w = 43,
+  .header.h = 43,
   .data_size = sizeof(ui_img_warning_icon_png_data),
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = ui_img_warning_icon_png_data
 };
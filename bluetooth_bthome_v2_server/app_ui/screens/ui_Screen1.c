@@ -145,26 +145,24 @@ void ui_Screen1_screen_init(void)
 
   ui_lightofficon0 = lv_img_create(ui_deviceiconpn0);
   lv_img_set_src(ui_lightofficon0, &ui_img_light_off_icon_png);
-  lv_obj_set_width(ui_lightofficon0, LV_SIZE_CONTENT); /// 63
-  lv_obj_set_height(ui_lightofficon0, LV_SIZE_CONTENT);  /// 80
+  lv_obj_set_width(ui_lightofficon0, LV_SIZE_CONTENT); /// 37
+  lv_obj_set_height(ui_lightofficon0, LV_SIZE_CONTENT);  /// 47
   lv_obj_set_x(ui_lightofficon0, 1);
   lv_obj_set_y(ui_lightofficon0, 0);
   lv_obj_set_align(ui_lightofficon0, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_lightofficon0,
                   LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_lightofficon0, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_lightofficon0, 150);
 
   ui_tempicon0 = lv_img_create(ui_deviceiconpn0);
   lv_img_set_src(ui_tempicon0, &ui_img_temperature_icon_png);
-  lv_obj_set_width(ui_tempicon0, LV_SIZE_CONTENT); /// 128
-  lv_obj_set_height(ui_tempicon0, LV_SIZE_CONTENT);  /// 129
+  lv_obj_set_width(ui_tempicon0, LV_SIZE_CONTENT); /// 40
+  lv_obj_set_height(ui_tempicon0, LV_SIZE_CONTENT);  /// 40
   lv_obj_set_x(ui_tempicon0, -1);
   lv_obj_set_y(ui_tempicon0, -1);
   lv_obj_set_align(ui_tempicon0, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_tempicon0, LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_tempicon0, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_tempicon0, 80);
 
   ui_butofficon0 = lv_img_create(ui_deviceiconpn0);
   lv_img_set_src(ui_butofficon0, &ui_img_button_off_ic_1_png);
@@ -186,15 +184,14 @@ void ui_Screen1_screen_init(void)
 
   ui_lightonicon0 = lv_img_create(ui_deviceiconpn0);
   lv_img_set_src(ui_lightonicon0, &ui_img_light_on_icon_1_png);
-  lv_obj_set_width(ui_lightonicon0, LV_SIZE_CONTENT); /// 53
-  lv_obj_set_height(ui_lightonicon0, LV_SIZE_CONTENT);  /// 76
+  lv_obj_set_width(ui_lightonicon0, LV_SIZE_CONTENT); /// 31
+  lv_obj_set_height(ui_lightonicon0, LV_SIZE_CONTENT);  /// 45
   lv_obj_set_x(ui_lightonicon0, 1);
   lv_obj_set_y(ui_lightonicon0, -1);
   lv_obj_set_align(ui_lightonicon0, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_lightonicon0,
                   LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_lightonicon0, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_lightonicon0, 150);
 
   ui_devicenamelb0 = lv_label_create(ui_inforpanel0);
   lv_obj_set_width(ui_devicenamelb0, 160);
@@ -215,8 +212,8 @@ void ui_Screen1_screen_init(void)
 
   ui_removeicon0 = lv_img_create(ui_inforpanel0);
   lv_img_set_src(ui_removeicon0, &ui_img_rm_icon_png);
-  lv_obj_set_width(ui_removeicon0, LV_SIZE_CONTENT); /// 118
-  lv_obj_set_height(ui_removeicon0, LV_SIZE_CONTENT);  /// 119
+  lv_obj_set_width(ui_removeicon0, LV_SIZE_CONTENT); /// 18
+  lv_obj_set_height(ui_removeicon0, LV_SIZE_CONTENT);  /// 19
   lv_obj_set_x(ui_removeicon0, 142);
   lv_obj_set_y(ui_removeicon0, -18);
   lv_obj_set_align(ui_removeicon0, LV_ALIGN_CENTER);
@@ -224,7 +221,6 @@ void ui_Screen1_screen_init(void)
                   LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_CLICKABLE
                   | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_removeicon0, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_removeicon0, 40);
 
   ui_inforpanel1 = lv_obj_create(ui_Screen1);
   lv_obj_set_width(ui_inforpanel1, 310);
@@ -280,8 +276,8 @@ void ui_Screen1_screen_init(void)
 
   ui_removeicon1 = lv_img_create(ui_inforpanel1);
   lv_img_set_src(ui_removeicon1, &ui_img_rm_icon_png);
-  lv_obj_set_width(ui_removeicon1, LV_SIZE_CONTENT); /// 118
-  lv_obj_set_height(ui_removeicon1, LV_SIZE_CONTENT);  /// 119
+  lv_obj_set_width(ui_removeicon1, LV_SIZE_CONTENT); /// 18
+  lv_obj_set_height(ui_removeicon1, LV_SIZE_CONTENT);  /// 19
   lv_obj_set_x(ui_removeicon1, 142);
   lv_obj_set_y(ui_removeicon1, -18);
   lv_obj_set_align(ui_removeicon1, LV_ALIGN_CENTER);
@@ -289,7 +285,6 @@ void ui_Screen1_screen_init(void)
                   LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_CLICKABLE
                   | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_removeicon1, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_removeicon1, 40);
 
   ui_deviceiconpn1 = lv_obj_create(ui_inforpanel1);
   lv_obj_set_width(ui_deviceiconpn1, 45);
@@ -310,26 +305,24 @@ void ui_Screen1_screen_init(void)
 
   ui_lightofficon1 = lv_img_create(ui_deviceiconpn1);
   lv_img_set_src(ui_lightofficon1, &ui_img_light_off_icon_png);
-  lv_obj_set_width(ui_lightofficon1, LV_SIZE_CONTENT); /// 63
-  lv_obj_set_height(ui_lightofficon1, LV_SIZE_CONTENT);  /// 80
+  lv_obj_set_width(ui_lightofficon1, LV_SIZE_CONTENT); /// 37
+  lv_obj_set_height(ui_lightofficon1, LV_SIZE_CONTENT);  /// 47
   lv_obj_set_x(ui_lightofficon1, 1);
   lv_obj_set_y(ui_lightofficon1, 0);
   lv_obj_set_align(ui_lightofficon1, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_lightofficon1,
                   LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_lightofficon1, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_lightofficon1, 150);
 
   ui_tempicon1 = lv_img_create(ui_deviceiconpn1);
   lv_img_set_src(ui_tempicon1, &ui_img_temperature_icon_png);
-  lv_obj_set_width(ui_tempicon1, LV_SIZE_CONTENT); /// 128
-  lv_obj_set_height(ui_tempicon1, LV_SIZE_CONTENT);  /// 129
+  lv_obj_set_width(ui_tempicon1, LV_SIZE_CONTENT); /// 40
+  lv_obj_set_height(ui_tempicon1, LV_SIZE_CONTENT);  /// 40
   lv_obj_set_x(ui_tempicon1, -1);
   lv_obj_set_y(ui_tempicon1, -1);
   lv_obj_set_align(ui_tempicon1, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_tempicon1, LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_tempicon1, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_tempicon1, 80);
 
   ui_butofficon1 = lv_img_create(ui_deviceiconpn1);
   lv_img_set_src(ui_butofficon1, &ui_img_button_off_ic_1_png);
@@ -351,15 +344,14 @@ void ui_Screen1_screen_init(void)
 
   ui_lightonicon1 = lv_img_create(ui_deviceiconpn1);
   lv_img_set_src(ui_lightonicon1, &ui_img_light_on_icon_1_png);
-  lv_obj_set_width(ui_lightonicon1, LV_SIZE_CONTENT); /// 53
-  lv_obj_set_height(ui_lightonicon1, LV_SIZE_CONTENT);  /// 76
+  lv_obj_set_width(ui_lightonicon1, LV_SIZE_CONTENT); /// 31
+  lv_obj_set_height(ui_lightonicon1, LV_SIZE_CONTENT);  /// 45
   lv_obj_set_x(ui_lightonicon1, 1);
   lv_obj_set_y(ui_lightonicon1, -1);
   lv_obj_set_align(ui_lightonicon1, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_lightonicon1,
                   LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_lightonicon1, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_lightonicon1, 150);
 
   ui_historylb1 = lv_label_create(ui_inforpanel1);
   lv_obj_set_width(ui_historylb1, 90);
@@ -454,8 +446,8 @@ void ui_Screen1_screen_init(void)
 
   ui_removeicon2 = lv_img_create(ui_inforpanel2);
   lv_img_set_src(ui_removeicon2, &ui_img_rm_icon_png);
-  lv_obj_set_width(ui_removeicon2, LV_SIZE_CONTENT); /// 118
-  lv_obj_set_height(ui_removeicon2, LV_SIZE_CONTENT);  /// 119
+  lv_obj_set_width(ui_removeicon2, LV_SIZE_CONTENT); /// 18
+  lv_obj_set_height(ui_removeicon2, LV_SIZE_CONTENT);  /// 19
   lv_obj_set_x(ui_removeicon2, 142);
   lv_obj_set_y(ui_removeicon2, -18);
   lv_obj_set_align(ui_removeicon2, LV_ALIGN_CENTER);
@@ -463,7 +455,6 @@ void ui_Screen1_screen_init(void)
                   LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_CLICKABLE
                   | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_removeicon2, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_removeicon2, 40);
 
   ui_deviceiconpn2 = lv_obj_create(ui_inforpanel2);
   lv_obj_set_width(ui_deviceiconpn2, 45);
@@ -484,26 +475,24 @@ void ui_Screen1_screen_init(void)
 
   ui_lightofficon2 = lv_img_create(ui_deviceiconpn2);
   lv_img_set_src(ui_lightofficon2, &ui_img_light_off_icon_png);
-  lv_obj_set_width(ui_lightofficon2, LV_SIZE_CONTENT); /// 63
-  lv_obj_set_height(ui_lightofficon2, LV_SIZE_CONTENT);  /// 80
+  lv_obj_set_width(ui_lightofficon2, LV_SIZE_CONTENT); /// 37
+  lv_obj_set_height(ui_lightofficon2, LV_SIZE_CONTENT);  /// 47
   lv_obj_set_x(ui_lightofficon2, 1);
   lv_obj_set_y(ui_lightofficon2, 0);
   lv_obj_set_align(ui_lightofficon2, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_lightofficon2,
                   LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_lightofficon2, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_lightofficon2, 150);
 
   ui_tempicon2 = lv_img_create(ui_deviceiconpn2);
   lv_img_set_src(ui_tempicon2, &ui_img_temperature_icon_png);
-  lv_obj_set_width(ui_tempicon2, LV_SIZE_CONTENT); /// 128
-  lv_obj_set_height(ui_tempicon2, LV_SIZE_CONTENT);  /// 129
+  lv_obj_set_width(ui_tempicon2, LV_SIZE_CONTENT); /// 40
+  lv_obj_set_height(ui_tempicon2, LV_SIZE_CONTENT);  /// 40
   lv_obj_set_x(ui_tempicon2, -1);
   lv_obj_set_y(ui_tempicon2, -1);
   lv_obj_set_align(ui_tempicon2, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_tempicon2, LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_tempicon2, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_tempicon2, 80);
 
   ui_butofficon2 = lv_img_create(ui_deviceiconpn2);
   lv_img_set_src(ui_butofficon2, &ui_img_button_off_ic_1_png);
@@ -525,15 +514,14 @@ void ui_Screen1_screen_init(void)
 
   ui_lightonicon2 = lv_img_create(ui_deviceiconpn2);
   lv_img_set_src(ui_lightonicon2, &ui_img_light_on_icon_1_png);
-  lv_obj_set_width(ui_lightonicon2, LV_SIZE_CONTENT); /// 53
-  lv_obj_set_height(ui_lightonicon2, LV_SIZE_CONTENT);  /// 76
+  lv_obj_set_width(ui_lightonicon2, LV_SIZE_CONTENT); /// 31
+  lv_obj_set_height(ui_lightonicon2, LV_SIZE_CONTENT);  /// 45
   lv_obj_set_x(ui_lightonicon2, 1);
   lv_obj_set_y(ui_lightonicon2, -1);
   lv_obj_set_align(ui_lightonicon2, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_lightonicon2,
                   LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_lightonicon2, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_lightonicon2, 150);
 
   ui_historylb2 = lv_label_create(ui_inforpanel2);
   lv_obj_set_width(ui_historylb2, 90);
@@ -628,8 +616,8 @@ void ui_Screen1_screen_init(void)
 
   ui_removeicon3 = lv_img_create(ui_inforpanel3);
   lv_img_set_src(ui_removeicon3, &ui_img_rm_icon_png);
-  lv_obj_set_width(ui_removeicon3, LV_SIZE_CONTENT); /// 118
-  lv_obj_set_height(ui_removeicon3, LV_SIZE_CONTENT);  /// 119
+  lv_obj_set_width(ui_removeicon3, LV_SIZE_CONTENT); /// 18
+  lv_obj_set_height(ui_removeicon3, LV_SIZE_CONTENT);  /// 19
   lv_obj_set_x(ui_removeicon3, 142);
   lv_obj_set_y(ui_removeicon3, -18);
   lv_obj_set_align(ui_removeicon3, LV_ALIGN_CENTER);
@@ -637,7 +625,6 @@ void ui_Screen1_screen_init(void)
                   LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_CLICKABLE
                   | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_removeicon3, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_removeicon3, 40);
 
   ui_deviceiconpn3 = lv_obj_create(ui_inforpanel3);
   lv_obj_set_width(ui_deviceiconpn3, 45);
@@ -658,26 +645,24 @@ void ui_Screen1_screen_init(void)
 
   ui_lightofficon3 = lv_img_create(ui_deviceiconpn3);
   lv_img_set_src(ui_lightofficon3, &ui_img_light_off_icon_png);
-  lv_obj_set_width(ui_lightofficon3, LV_SIZE_CONTENT); /// 63
-  lv_obj_set_height(ui_lightofficon3, LV_SIZE_CONTENT);  /// 80
+  lv_obj_set_width(ui_lightofficon3, LV_SIZE_CONTENT); /// 37
+  lv_obj_set_height(ui_lightofficon3, LV_SIZE_CONTENT);  /// 47
   lv_obj_set_x(ui_lightofficon3, 1);
   lv_obj_set_y(ui_lightofficon3, 0);
   lv_obj_set_align(ui_lightofficon3, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_lightofficon3,
                   LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_lightofficon3, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_lightofficon3, 150);
 
   ui_tempicon3 = lv_img_create(ui_deviceiconpn3);
   lv_img_set_src(ui_tempicon3, &ui_img_temperature_icon_png);
-  lv_obj_set_width(ui_tempicon3, LV_SIZE_CONTENT); /// 128
-  lv_obj_set_height(ui_tempicon3, LV_SIZE_CONTENT);  /// 129
+  lv_obj_set_width(ui_tempicon3, LV_SIZE_CONTENT); /// 40
+  lv_obj_set_height(ui_tempicon3, LV_SIZE_CONTENT);  /// 40
   lv_obj_set_x(ui_tempicon3, -1);
   lv_obj_set_y(ui_tempicon3, -1);
   lv_obj_set_align(ui_tempicon3, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_tempicon3, LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_tempicon3, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_tempicon3, 80);
 
   ui_butofficon3 = lv_img_create(ui_deviceiconpn3);
   lv_img_set_src(ui_butofficon3, &ui_img_button_off_ic_1_png);
@@ -699,15 +684,14 @@ void ui_Screen1_screen_init(void)
 
   ui_lightonicon3 = lv_img_create(ui_deviceiconpn3);
   lv_img_set_src(ui_lightonicon3, &ui_img_light_on_icon_1_png);
-  lv_obj_set_width(ui_lightonicon3, LV_SIZE_CONTENT); /// 53
-  lv_obj_set_height(ui_lightonicon3, LV_SIZE_CONTENT);  /// 76
+  lv_obj_set_width(ui_lightonicon3, LV_SIZE_CONTENT); /// 31
+  lv_obj_set_height(ui_lightonicon3, LV_SIZE_CONTENT);  /// 45
   lv_obj_set_x(ui_lightonicon3, 1);
   lv_obj_set_y(ui_lightonicon3, -1);
   lv_obj_set_align(ui_lightonicon3, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_lightonicon3,
                   LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_lightonicon3, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_lightonicon3, 150);
 
   ui_historylb3 = lv_label_create(ui_inforpanel3);
   lv_obj_set_width(ui_historylb3, 90);
@@ -802,8 +786,8 @@ void ui_Screen1_screen_init(void)
 
   ui_removeicon4 = lv_img_create(ui_inforpanel4);
   lv_img_set_src(ui_removeicon4, &ui_img_rm_icon_png);
-  lv_obj_set_width(ui_removeicon4, LV_SIZE_CONTENT); /// 118
-  lv_obj_set_height(ui_removeicon4, LV_SIZE_CONTENT);  /// 119
+  lv_obj_set_width(ui_removeicon4, LV_SIZE_CONTENT); /// 18
+  lv_obj_set_height(ui_removeicon4, LV_SIZE_CONTENT);  /// 19
   lv_obj_set_x(ui_removeicon4, 142);
   lv_obj_set_y(ui_removeicon4, -18);
   lv_obj_set_align(ui_removeicon4, LV_ALIGN_CENTER);
@@ -811,7 +795,6 @@ void ui_Screen1_screen_init(void)
                   LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_CLICKABLE
                   | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_removeicon4, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_removeicon4, 40);
 
   ui_deviceiconpn4 = lv_obj_create(ui_inforpanel4);
   lv_obj_set_width(ui_deviceiconpn4, 45);
@@ -832,8 +815,8 @@ void ui_Screen1_screen_init(void)
 
   ui_lightofficon4 = lv_img_create(ui_deviceiconpn4);
   lv_img_set_src(ui_lightofficon4, &ui_img_light_off_icon_png);
-  lv_obj_set_width(ui_lightofficon4, LV_SIZE_CONTENT); /// 63
-  lv_obj_set_height(ui_lightofficon4, LV_SIZE_CONTENT);  /// 80
+  lv_obj_set_width(ui_lightofficon4, LV_SIZE_CONTENT); /// 37
+  lv_obj_set_height(ui_lightofficon4, LV_SIZE_CONTENT);  /// 47
   lv_obj_set_x(ui_lightofficon4, 1);
   lv_obj_set_y(ui_lightofficon4, 0);
   lv_obj_set_align(ui_lightofficon4, LV_ALIGN_CENTER);
@@ -841,19 +824,17 @@ void ui_Screen1_screen_init(void)
                   LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
 
   lv_obj_clear_flag(ui_lightofficon4, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_lightofficon4, 150);
 
   ui_tempicon4 = lv_img_create(ui_deviceiconpn4);
   lv_img_set_src(ui_tempicon4, &ui_img_temperature_icon_png);
-  lv_obj_set_width(ui_tempicon4, LV_SIZE_CONTENT); /// 128
-  lv_obj_set_height(ui_tempicon4, LV_SIZE_CONTENT);  /// 129
+  lv_obj_set_width(ui_tempicon4, LV_SIZE_CONTENT); /// 40
+  lv_obj_set_height(ui_tempicon4, LV_SIZE_CONTENT);  /// 40
   lv_obj_set_x(ui_tempicon4, -1);
   lv_obj_set_y(ui_tempicon4, -1);
   lv_obj_set_align(ui_tempicon4, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_tempicon4, LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
 
   lv_obj_clear_flag(ui_tempicon4, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_tempicon4, 80);
 
   ui_butofficon4 = lv_img_create(ui_deviceiconpn4);
   lv_img_set_src(ui_butofficon4, &ui_img_button_off_ic_1_png);
@@ -877,8 +858,8 @@ void ui_Screen1_screen_init(void)
 
   ui_lightonicon4 = lv_img_create(ui_deviceiconpn4);
   lv_img_set_src(ui_lightonicon4, &ui_img_light_on_icon_1_png);
-  lv_obj_set_width(ui_lightonicon4, LV_SIZE_CONTENT); /// 53
-  lv_obj_set_height(ui_lightonicon4, LV_SIZE_CONTENT);  /// 76
+  lv_obj_set_width(ui_lightonicon4, LV_SIZE_CONTENT); /// 31
+  lv_obj_set_height(ui_lightonicon4, LV_SIZE_CONTENT);  /// 45
   lv_obj_set_x(ui_lightonicon4, 1);
   lv_obj_set_y(ui_lightonicon4, -1);
   lv_obj_set_align(ui_lightonicon4, LV_ALIGN_CENTER);
@@ -886,7 +867,6 @@ void ui_Screen1_screen_init(void)
                   LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
 
   lv_obj_clear_flag(ui_lightonicon4, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_lightonicon4, 150);
 
   ui_historylb4 = lv_label_create(ui_inforpanel4);
   lv_obj_set_width(ui_historylb4, 90);
@@ -981,8 +961,8 @@ void ui_Screen1_screen_init(void)
 
   ui_removeicon5 = lv_img_create(ui_inforpanel5);
   lv_img_set_src(ui_removeicon5, &ui_img_rm_icon_png);
-  lv_obj_set_width(ui_removeicon5, LV_SIZE_CONTENT); /// 118
-  lv_obj_set_height(ui_removeicon5, LV_SIZE_CONTENT);  /// 119
+  lv_obj_set_width(ui_removeicon5, LV_SIZE_CONTENT); /// 18
+  lv_obj_set_height(ui_removeicon5, LV_SIZE_CONTENT);  /// 19
   lv_obj_set_x(ui_removeicon5, 142);
   lv_obj_set_y(ui_removeicon5, -18);
   lv_obj_set_align(ui_removeicon5, LV_ALIGN_CENTER);
@@ -991,7 +971,6 @@ void ui_Screen1_screen_init(void)
                   | LV_OBJ_FLAG_ADV_HITTEST);
 
   lv_obj_clear_flag(ui_removeicon5, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_removeicon5, 40);
 
   ui_deviceiconpn5 = lv_obj_create(ui_inforpanel5);
   lv_obj_set_width(ui_deviceiconpn5, 45);
@@ -1012,26 +991,24 @@ void ui_Screen1_screen_init(void)
 
   ui_lightofficon5 = lv_img_create(ui_deviceiconpn5);
   lv_img_set_src(ui_lightofficon5, &ui_img_light_off_icon_png);
-  lv_obj_set_width(ui_lightofficon5, LV_SIZE_CONTENT); /// 63
-  lv_obj_set_height(ui_lightofficon5, LV_SIZE_CONTENT);  /// 80
+  lv_obj_set_width(ui_lightofficon5, LV_SIZE_CONTENT); /// 37
+  lv_obj_set_height(ui_lightofficon5, LV_SIZE_CONTENT);  /// 47
   lv_obj_set_x(ui_lightofficon5, 1);
   lv_obj_set_y(ui_lightofficon5, 0);
   lv_obj_set_align(ui_lightofficon5, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_lightofficon5,
                   LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_lightofficon5, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_lightofficon5, 150);
 
   ui_tempicon5 = lv_img_create(ui_deviceiconpn5);
   lv_img_set_src(ui_tempicon5, &ui_img_temperature_icon_png);
-  lv_obj_set_width(ui_tempicon5, LV_SIZE_CONTENT); /// 128
-  lv_obj_set_height(ui_tempicon5, LV_SIZE_CONTENT);  /// 129
+  lv_obj_set_width(ui_tempicon5, LV_SIZE_CONTENT); /// 40
+  lv_obj_set_height(ui_tempicon5, LV_SIZE_CONTENT);  /// 40
   lv_obj_set_x(ui_tempicon5, -1);
   lv_obj_set_y(ui_tempicon5, -1);
   lv_obj_set_align(ui_tempicon5, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_tempicon5, LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_tempicon5, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_tempicon5, 80);
 
   ui_butofficon5 = lv_img_create(ui_deviceiconpn5);
   lv_img_set_src(ui_butofficon5, &ui_img_button_off_ic_1_png);
@@ -1053,15 +1030,14 @@ void ui_Screen1_screen_init(void)
 
   ui_lightonicon5 = lv_img_create(ui_deviceiconpn5);
   lv_img_set_src(ui_lightonicon5, &ui_img_light_on_icon_1_png);
-  lv_obj_set_width(ui_lightonicon5, LV_SIZE_CONTENT); /// 53
-  lv_obj_set_height(ui_lightonicon5, LV_SIZE_CONTENT);  /// 76
+  lv_obj_set_width(ui_lightonicon5, LV_SIZE_CONTENT); /// 31
+  lv_obj_set_height(ui_lightonicon5, LV_SIZE_CONTENT);  /// 45
   lv_obj_set_x(ui_lightonicon5, 1);
   lv_obj_set_y(ui_lightonicon5, -1);
   lv_obj_set_align(ui_lightonicon5, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_lightonicon5,
                   LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_ADV_HITTEST);
   lv_obj_clear_flag(ui_lightonicon5, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_lightonicon5, 150);
 
   ui_historylb5 = lv_label_create(ui_inforpanel5);
   lv_obj_set_width(ui_historylb5, 90);
@@ -1120,12 +1096,11 @@ void ui_Screen1_screen_init(void)
 
   ui_settingicon = lv_img_create(ui_settingpn);
   lv_img_set_src(ui_settingicon, &ui_img_setting_icon_png);
-  lv_obj_set_width(ui_settingicon, LV_SIZE_CONTENT); /// 118
-  lv_obj_set_height(ui_settingicon, LV_SIZE_CONTENT);  /// 122
+  lv_obj_set_width(ui_settingicon, LV_SIZE_CONTENT); /// 23
+  lv_obj_set_height(ui_settingicon, LV_SIZE_CONTENT);  /// 24
   lv_obj_set_align(ui_settingicon, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_settingicon, LV_OBJ_FLAG_ADV_HITTEST);   /// Flags
   lv_obj_clear_flag(ui_settingicon, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_settingicon, 50);
 
   ui_tickpn0 = lv_obj_create(ui_Screen1);
   lv_obj_set_width(ui_tickpn0, 58);
@@ -1146,12 +1121,11 @@ void ui_Screen1_screen_init(void)
 
   ui_tickicon0 = lv_img_create(ui_tickpn0);
   lv_img_set_src(ui_tickicon0, &ui_img_tick_icon_png);
-  lv_obj_set_width(ui_tickicon0, LV_SIZE_CONTENT); /// 87
-  lv_obj_set_height(ui_tickicon0, LV_SIZE_CONTENT);  /// 87
+  lv_obj_set_width(ui_tickicon0, LV_SIZE_CONTENT); /// 25
+  lv_obj_set_height(ui_tickicon0, LV_SIZE_CONTENT);  /// 25
   lv_obj_set_align(ui_tickicon0, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_tickicon0, LV_OBJ_FLAG_ADV_HITTEST);   /// Flags
   lv_obj_clear_flag(ui_tickicon0, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_tickicon0, 75);
 
   lv_obj_add_event_cb(ui_removeicon0, ui_event_removeicon0, LV_EVENT_ALL, NULL);
   lv_obj_add_event_cb(ui_removeicon1, ui_event_removeicon1, LV_EVENT_ALL, NULL);
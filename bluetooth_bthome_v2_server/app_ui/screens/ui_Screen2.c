@@ -97,12 +97,11 @@ void ui_Screen2_screen_init(void)
 
   ui_exiticon2 = lv_img_create(ui_exitscr3pn2);
   lv_img_set_src(ui_exiticon2, &ui_img_exit_icon_png);
-  lv_obj_set_width(ui_exiticon2, LV_SIZE_CONTENT); /// 128
-  lv_obj_set_height(ui_exiticon2, LV_SIZE_CONTENT);  /// 128
+  lv_obj_set_width(ui_exiticon2, LV_SIZE_CONTENT); /// 25
+  lv_obj_set_height(ui_exiticon2, LV_SIZE_CONTENT);  /// 25
   lv_obj_set_align(ui_exiticon2, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_exiticon2, LV_OBJ_FLAG_ADV_HITTEST);   /// Flags
   lv_obj_clear_flag(ui_exiticon2, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_exiticon2, 50);
 
   ui_warningpn = lv_obj_create(ui_Screen2);
   lv_obj_set_width(ui_warningpn, 250);
@@ -139,14 +138,13 @@ void ui_Screen2_screen_init(void)
 
   ui_warningicon = lv_img_create(ui_warningpn);
   lv_img_set_src(ui_warningicon, &ui_img_warning_icon_png);
-  lv_obj_set_width(ui_warningicon, LV_SIZE_CONTENT); /// 110
-  lv_obj_set_height(ui_warningicon, LV_SIZE_CONTENT);  /// 110
+  lv_obj_set_width(ui_warningicon, LV_SIZE_CONTENT); /// 43
+  lv_obj_set_height(ui_warningicon, LV_SIZE_CONTENT);  /// 43
   lv_obj_set_x(ui_warningicon, -2);
   lv_obj_set_y(ui_warningicon, -19);
   lv_obj_set_align(ui_warningicon, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_warningicon, LV_OBJ_FLAG_ADV_HITTEST);   /// Flags
   lv_obj_clear_flag(ui_warningicon, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_warningicon, 100);
 
   lv_obj_add_event_cb(ui_removedevpn, ui_event_removedevpn, LV_EVENT_ALL, NULL);
   lv_obj_add_event_cb(ui_adddevpn, ui_event_adddevpn, LV_EVENT_ALL, NULL);
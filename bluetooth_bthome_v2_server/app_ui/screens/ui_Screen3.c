@@ -275,12 +275,11 @@ void ui_Screen3_screen_init(void)
 
   ui_exiticon = lv_img_create(ui_exitscr3pn);
   lv_img_set_src(ui_exiticon, &ui_img_exit_icon_png);
-  lv_obj_set_width(ui_exiticon, LV_SIZE_CONTENT); /// 128
-  lv_obj_set_height(ui_exiticon, LV_SIZE_CONTENT);  /// 128
+  lv_obj_set_width(ui_exiticon, LV_SIZE_CONTENT); /// 25
+  lv_obj_set_height(ui_exiticon, LV_SIZE_CONTENT);  /// 25
   lv_obj_set_align(ui_exiticon, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_exiticon, LV_OBJ_FLAG_ADV_HITTEST);   /// Flags
   lv_obj_clear_flag(ui_exiticon, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_exiticon, 50);
 
   lv_obj_add_event_cb(ui_devscannedpn0,
                       ui_event_devscannedpn0,
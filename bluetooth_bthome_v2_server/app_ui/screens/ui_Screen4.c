@@ -140,14 +140,13 @@ void ui_Screen4_screen_init(void)
 
   ui_exiticon1 = lv_img_create(ui_exitscr3pn1);
   lv_img_set_src(ui_exiticon1, &ui_img_exit_icon_png);
-  lv_obj_set_width(ui_exiticon1, LV_SIZE_CONTENT); /// 128
-  lv_obj_set_height(ui_exiticon1, LV_SIZE_CONTENT);  /// 128
+  lv_obj_set_width(ui_exiticon1, LV_SIZE_CONTENT); /// 25
+  lv_obj_set_height(ui_exiticon1, LV_SIZE_CONTENT);  /// 25
   lv_obj_set_x(ui_exiticon1, 0);
   lv_obj_set_y(ui_exiticon1, 1);
   lv_obj_set_align(ui_exiticon1, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_exiticon1, LV_OBJ_FLAG_ADV_HITTEST);   /// Flags
   lv_obj_clear_flag(ui_exiticon1, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_exiticon1, 50);
 
   ui_tickpn1 = lv_obj_create(ui_Screen4);
   lv_obj_set_width(ui_tickpn1, 58);
@@ -167,12 +166,11 @@ void ui_Screen4_screen_init(void)
 
   ui_tickicon = lv_img_create(ui_tickpn1);
   lv_img_set_src(ui_tickicon, &ui_img_tick_icon_png);
-  lv_obj_set_width(ui_tickicon, LV_SIZE_CONTENT); /// 87
-  lv_obj_set_height(ui_tickicon, LV_SIZE_CONTENT);  /// 87
+  lv_obj_set_width(ui_tickicon, LV_SIZE_CONTENT); /// 25
+  lv_obj_set_height(ui_tickicon, LV_SIZE_CONTENT);  /// 25
   lv_obj_set_align(ui_tickicon, LV_ALIGN_CENTER);
   lv_obj_add_flag(ui_tickicon, LV_OBJ_FLAG_ADV_HITTEST);   /// Flags
   lv_obj_clear_flag(ui_tickicon, LV_OBJ_FLAG_SCROLLABLE);    /// Flags
-  lv_img_set_zoom(ui_tickicon, 75);
 
   lv_keyboard_set_textarea(ui_Keyboard1, ui_setenckeytxtarea);
   lv_obj_add_event_cb(ui_setenckeytxtarea,
@@ -0,0 +1,80 @@
+/***************************************************************************//**
+ * @file img_rle_decoder.h
+ * @brief RLE image decoder for LVGL.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+
+#ifndef IMG_RLE_DECODER_H
+#define IMG_RLE_DECODER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Decode statistics
+typedef struct {
+  uint32_t images;   ///< Number of image draws
+  uint32_t lines;    ///< Number of lines decoded
+  uint32_t cycles;   ///< CPU cycles spent decoding
+} img_rle_decoder_stats_t;
+
+/***************************************************************************//**
+ * @brief
+ *    Register the RLE image decoder with LVGL. Images converted by
+ *    tools/img_rle_convert.py have the LV_IMG_CF_RAW_ALPHA color format and
+ *    are decoded line by line straight into the LVGL draw buffer. LVGL
+ *    cannot zoom or rotate images read line by line, so zoomed images are
+ *    scaled by the tool instead.
+ *    Must be called after lv_init().
+ ******************************************************************************/
+void img_rle_decoder_init(void);
+
+/***************************************************************************//**
+ * @brief
+ *    Get the decode statistics.
+ *
+ * @param[out] stats
+ *    Statistics since the last reset.
+ * @param[in] reset
+ *    Reset the statistics after reading them.
+ ******************************************************************************/
+void img_rle_decoder_get_stats(img_rle_decoder_stats_t *stats, bool reset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // IMG_RLE_DECODER_H
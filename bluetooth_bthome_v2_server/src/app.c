@@ -33,6 +33,7 @@
  * maintained and there may be no bug maintenance planned for these resources.
  * Silicon Labs may update projects from time to time.
  ******************************************************************************/
+#include "em_device.h"
 #include "sl_common.h"
 #include "app_assert.h"
 #include "sl_bluetooth.h"
@@ -50,11 +51,12 @@
 #include "adafruit_hxd8357d_spi_config.h"
 #endif
 #include "app_ui/ui.h"
+#include "img_rle_decoder.h"
 
 #define LVGL_TIMER_PERIOD              1
 #define LVGL_TIMER_RUN_TIMER_HANDLER   5
-#define APP_TIMER_UPDATE_SCREEN        500
 #define APP_TIMER_TIMEOUT              1000
+#define APP_STATS_PERIOD_MS            10000
 
 #define APP_READ_DATA_EXT_SIG          0x01
 #define APP_UPDATE_SCREEN_EXT_SIG      0x02
@@ -65,6 +67,13 @@
 #define APP_NVM3_DEVICE_NAME_OFF_SET   (MAX_DEVICE + 2)
 #define APP_UPDATE_DATA_TIMEOUT_SECOND 10
 
+// Fields of a client device on the home screen, a set bit means the field
+// has a new value that is not on the screen yet
+#define APP_FIELD_PANEL                0x01 // Panel, device name and MAC
+#define APP_FIELD_INFO                 0x02 // Sensor value and its icon
+#define APP_FIELD_HISTORY              0x04 // Time since the last data
+#define APP_FIELD_ALL                  0x07
+
 MIPI_DBI_SPI_INTERFACE_DEFINE(hx8357d_config,
                               ADAFRUIT_HXD8357D_PERIPHERAL,
                               ADAFRUIT_HXD8357D_PERIPHERAL_NO,
@@ -88,17 +97,41 @@ typedef struct scanned_device {
   bool is_added;
 } scanned_device_t;
 
+typedef enum app_icon {
+  APP_ICON_NONE,
+  APP_ICON_TEMPERATURE,
+  APP_ICON_LIGHT_ON,
+  APP_ICON_LIGHT_OFF,
+  APP_ICON_BUTTON_ON,
+  APP_ICON_BUTTON_OFF
+} app_icon_t;
+
 typedef struct device {
   scanned_device_t device;
   uint8_t device_name[15];
   uint8_t device_key[16];
   uint32_t update_delay_ms;
+  bool has_data;
+  char info_str[9];
+  char history_str[18];
+  app_icon_t icon;
+  uint8_t dirty_fields;
 } device_t;
 
 static uint8_t scanned_device_count = 0;
 static uint8_t added_device_count = 0;
 static device_t added_device[6];
 static scanned_device_t scanned_device[6];
+static bool scanned_list_dirty = false;
+static lv_obj_t *drawn_screen = NULL;
+
+// Display statistics, reported every APP_STATS_PERIOD_MS
+static uint32_t stats_start_tick;
+static uint32_t stats_frames;
+static uint32_t stats_pixels;
+static uint32_t stats_render_ms;
+static uint32_t stats_updates;
+static uint32_t stats_update_ticks;
 
 static lv_obj_t **ui_devicename_label_scr1[6] =
 { &ui_devicenamelb0, &ui_devicenamelb1,
@@ -165,21 +198,25 @@ static lv_obj_t **ui_update_history_scr1[6] =
 
 static sl_sleeptimer_timer_handle_t lvgl_tick_timer;
 static sl_sleeptimer_timer_handle_t app_timer;
-static sl_sleeptimer_timer_handle_t update_screen_timer;
 
 static void app_get_client_information_handler(void);
 static void app_convert_str_to_hex(uint8_t *in, uint8_t *str);
 static void app_update_screen_handler(void);
+static void app_draw_device(uint8_t index);
 static void app_registe_new_device(void);
 static void app_remove_added_device(void);
-static void app_hidden_icon_on_panel_index(uint8_t panel_idx);
+static void app_format_history(uint32_t delay_s, char *str, size_t size);
+static void app_set_label_text(lv_obj_t *label, const char *text);
+static void app_set_hidden(lv_obj_t *obj, bool hidden);
+static void app_display_monitor_cb(lv_disp_drv_t *disp_drv,
+                                   uint32_t time,
+                                   uint32_t px);
+static void app_log_display_stats(void);
 
 static void lvgl_tick_timer_callback(sl_sleeptimer_timer_handle_t *timer,
                                      void *data);
 static void app_timer_cb(sl_sleeptimer_timer_handle_t *handle,
                          void *data);
-static void update_screen_timer_cb(sl_sleeptimer_timer_handle_t *handle,
-                                   void *data);
 
 /**************************************************************************//**
  * Application Init.
@@ -196,9 +233,12 @@ void app_init(void)
   adafruit_hxd8357d_init(&hx8357d_config);
 #endif
   lv_init();
+  img_rle_decoder_init();
   lv_port_disp_init();
   lv_port_indev_init();
   ui_init();
+  lv_disp_get_default()->driver->monitor_cb = app_display_monitor_cb;
+  stats_start_tick = sl_sleeptimer_get_tick_count();
   sc = sl_sleeptimer_start_periodic_timer_ms(&lvgl_tick_timer,
                                              LVGL_TIMER_PERIOD,
                                              lvgl_tick_timer_callback,
@@ -207,14 +247,6 @@ void app_init(void)
                                              0);
 
   app_assert_status(sc);
-
-  sc = sl_sleeptimer_start_periodic_timer_ms(&update_screen_timer,
-                                             APP_TIMER_UPDATE_SCREEN,
-                                             update_screen_timer_cb,
-                                             NULL,
-                                             0,
-                                             0);
-  app_assert_status(sc);
 }
 
 /**************************************************************************//**
@@ -280,6 +312,7 @@ void bthome_v2_server_found_device_callback(uint8_t *mac,
       app_log("Device name: %s\n",
               added_device[added_device_count].device_name);
     }
+    added_device[added_device_count].dirty_fields = APP_FIELD_ALL;
     added_device_count++;
   } else if (scanned_device_count < APP_MAX_CLIENT_DEVICES) {
     memcpy(scanned_device[scanned_device_count].device_mac, mac,
@@ -289,9 +322,11 @@ void bthome_v2_server_found_device_callback(uint8_t *mac,
     memcpy(scanned_device[scanned_device_count].device_mac_str, temp_mac_str,
            sizeof(temp_mac_str));
     scanned_device_count++;
+    scanned_list_dirty = true;
   } else {
     app_log("[WRN]: Full of the scanned devices!\n");
   }
+  sl_bt_external_signal(APP_UPDATE_SCREEN_EXT_SIG);
 
   sc = sl_sleeptimer_is_timer_running(&app_timer, &is_running);
   app_assert_status(sc);
@@ -312,6 +347,14 @@ void bthome_v2_server_found_device_callback(uint8_t *mac,
 void app_process_action(void)
 {
   lv_timer_handler_run_in_period(5);
+
+  // Screen changes and register/remove requests come from the touch screen
+  // events, the screen is only updated when one of them is pending
+  if ((lv_scr_act() != drawn_screen)
+      || !register_completed
+      || (!remove_completed && (remove_slot < added_device_count))) {
+    app_update_screen_handler();
+  }
 }
 
 /**************************************************************************//**
@@ -336,13 +379,15 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       break;
     case sl_bt_evt_system_external_signal_id:
 
+      // Signals raised close together are delivered in one event
       if (evt->data.evt_system_external_signal.extsignals
-          == APP_UPDATE_SCREEN_EXT_SIG) {
-        app_update_screen_handler();
-      } else if (evt->data.evt_system_external_signal.extsignals
-                 == APP_READ_DATA_EXT_SIG) {
+          & APP_READ_DATA_EXT_SIG) {
         app_get_client_information_handler();
       }
+      if (evt->data.evt_system_external_signal.extsignals
+          & APP_UPDATE_SCREEN_EXT_SIG) {
+        app_update_screen_handler();
+      }
       break;
     // -------------------------------
     // Default event handler.
@@ -360,147 +405,180 @@ static void app_get_client_information_handler(void)
   float tempertature;
   bthome_v2_server_sensor_data_t object[2];
   uint8_t object_count;
-  char temp_str[9];
+  char info_str[9];
+  char history_str[18];
+  app_icon_t icon;
   uint32_t update_time;
+  bool changed = false;
+  device_t *device;
 
-  if (remove_completed) {
-    for (int i = 0; i < added_device_count; i++) {
-      object_count = 0;
-      sc = bthome_v2_server_sensor_data_read(added_device[i].device.device_mac,
-                                             object, 2,
-                                             &object_count,
-                                             &update_time);
-      app_assert_status(sc);
-      lv_obj_clear_flag(*(ui_device_icon_scr1[i]), LV_OBJ_FLAG_HIDDEN);
-      added_device[i].update_delay_ms = sl_sleeptimer_tick_to_ms(
-        sl_sleeptimer_get_tick_count() - update_time) / 1000;
-      for (uint8_t j = 0; j < object_count; j++) {
-        switch (object[j].object_id) {
-          case ID_TEMPERATURE:
-            tempertature = (float) object[j].data / object[j].factor;
-            snprintf(temp_str, sizeof(temp_str), "%.1f °C", tempertature);
-            lv_label_set_text(*(ui_device_infor_scr1[i]), temp_str);
-            if (lv_obj_has_flag(*(ui_temperature_icon_scr1[i]),
-                                LV_OBJ_FLAG_HIDDEN)) {
-              lv_obj_clear_flag(*(ui_temperature_icon_scr1[i]),
-                                LV_OBJ_FLAG_HIDDEN);
-            }
-            break;
-          case STATE_GENERIC_BOOLEAN:
-            if (object[j].data) {
-              lv_label_set_text(*(ui_device_infor_scr1[i]), "ON");
-              if (lv_obj_has_flag(*(ui_light_on_icon_scr1[i]),
-                                  LV_OBJ_FLAG_HIDDEN)) {
-                lv_obj_add_flag(*(ui_light_off_icon_scr1[i]),
-                                LV_OBJ_FLAG_HIDDEN);
-                lv_obj_clear_flag(*(ui_light_on_icon_scr1[i]),
-                                  LV_OBJ_FLAG_HIDDEN);
-              }
-            } else {
-              lv_label_set_text(*(ui_device_infor_scr1[i]), "OFF");
-              if (lv_obj_has_flag(*(ui_light_off_icon_scr1[i]),
-                                  LV_OBJ_FLAG_HIDDEN)) {
-                lv_obj_add_flag(*(ui_light_on_icon_scr1[i]),
-                                LV_OBJ_FLAG_HIDDEN);
-                lv_obj_clear_flag(*(ui_light_off_icon_scr1[i]),
-                                  LV_OBJ_FLAG_HIDDEN);
-              }
-            }
-            break;
-          case EVENT_BUTTON:
-            if ((object[j].data == EVENT_BUTTON_DOUBLE_PRESS)
-                || (object[j].data == EVENT_BUTTON_PRESS)
-                || (object[j].data == EVENT_BUTTON_LONG_PRESS)
-                || (object[j].data == EVENT_BUTTON_TRIPLE_PRESS)) {
-              lv_label_set_text(*(ui_device_infor_scr1[i]), "PRESS");
-              if (lv_obj_has_flag(*(ui_but_on_icon_scr1[i]),
-                                  LV_OBJ_FLAG_HIDDEN)) {
-                lv_obj_clear_flag(*(ui_but_on_icon_scr1[i]),
-                                  LV_OBJ_FLAG_HIDDEN);
-                lv_obj_add_flag(*(ui_but_off_icon_scr1[i]), LV_OBJ_FLAG_HIDDEN);
-              }
-            } else if (object[j].data == EVENT_BUTTON_NONE) {
-              lv_label_set_text(*(ui_device_infor_scr1[i]), "NONE");
-              if (lv_obj_has_flag(*(ui_but_off_icon_scr1[i]),
-                                  LV_OBJ_FLAG_HIDDEN)) {
-                lv_obj_clear_flag(*(ui_but_off_icon_scr1[i]),
-                                  LV_OBJ_FLAG_HIDDEN);
-                lv_obj_add_flag(*(ui_but_on_icon_scr1[i]), LV_OBJ_FLAG_HIDDEN);
-              }
-            } else {
-            }
-            break;
-          default:
-            break;
-        }
+  if (!remove_completed) {
+    return;
+  }
+
+  for (int i = 0; i < added_device_count; i++) {
+    device = &added_device[i];
+    object_count = 0;
+    sc = bthome_v2_server_sensor_data_read(device->device.device_mac,
+                                           object, 2,
+                                           &object_count,
+                                           &update_time);
+    app_assert_status(sc);
+    if (!device->has_data) {
+      device->has_data = true;
+      device->dirty_fields |= APP_FIELD_INFO;
+    }
+    device->update_delay_ms = sl_sleeptimer_tick_to_ms(
+      sl_sleeptimer_get_tick_count() - update_time) / 1000;
+
+    strcpy(info_str, device->info_str);
+    icon = device->icon;
+    for (uint8_t j = 0; j < object_count; j++) {
+      switch (object[j].object_id) {
+        case ID_TEMPERATURE:
+          tempertature = (float) object[j].data / object[j].factor;
+          snprintf(info_str, sizeof(info_str), "%.1f °C", tempertature);
+          icon = APP_ICON_TEMPERATURE;
+          break;
+        case STATE_GENERIC_BOOLEAN:
+          if (object[j].data) {
+            strcpy(info_str, "ON");
+            icon = APP_ICON_LIGHT_ON;
+          } else {
+            strcpy(info_str, "OFF");
+            icon = APP_ICON_LIGHT_OFF;
+          }
+          break;
+        case EVENT_BUTTON:
+          if ((object[j].data == EVENT_BUTTON_DOUBLE_PRESS)
+              || (object[j].data == EVENT_BUTTON_PRESS)
+              || (object[j].data == EVENT_BUTTON_LONG_PRESS)
+              || (object[j].data == EVENT_BUTTON_TRIPLE_PRESS)) {
+            strcpy(info_str, "PRESS");
+            icon = APP_ICON_BUTTON_ON;
+          } else if (object[j].data == EVENT_BUTTON_NONE) {
+            strcpy(info_str, "NONE");
+            icon = APP_ICON_BUTTON_OFF;
+          } else {
+          }
+          break;
+        default:
+          break;
       }
     }
+    if ((icon != device->icon) || strcmp(info_str, device->info_str)) {
+      device->icon = icon;
+      strcpy(device->info_str, info_str);
+      device->dirty_fields |= APP_FIELD_INFO;
+    }
+
+    app_format_history(device->update_delay_ms,
+                       history_str,
+                       sizeof(history_str));
+    if (strcmp(history_str, device->history_str)) {
+      strcpy(device->history_str, history_str);
+      device->dirty_fields |= APP_FIELD_HISTORY;
+    }
+
+    if (device->dirty_fields) {
+      changed = true;
+    }
+  }
+
+  if (changed) {
+    sl_bt_external_signal(APP_UPDATE_SCREEN_EXT_SIG);
   }
 }
 
 /**************************************************************************//**
- * Update screen function.
+ * Update screen function. Only the fields that changed since the last update
+ * are written to the screen.
  *****************************************************************************/
 static void app_update_screen_handler(void)
 {
-  char history_str[18];
   lv_obj_t *current_screen;
+  uint32_t start_tick;
 
+  start_tick = sl_sleeptimer_get_tick_count();
   current_screen = lv_scr_act();
 
+  // A screen coming into view gets all of its fields checked once
+  if (current_screen != drawn_screen) {
+    for (int i = 0; i < APP_MAX_CLIENT_DEVICES; i++) {
+      added_device[i].dirty_fields = APP_FIELD_ALL;
+    }
+    scanned_list_dirty = true;
+    drawn_screen = current_screen;
+  }
+
   if (ui_Screen4 == current_screen) {
     app_registe_new_device();
   } else if (ui_Screen1 == current_screen) {
-    for (int i = 0; i < APP_MAX_CLIENT_DEVICES; i++) {
-      if (added_device[i].device.is_added) {
-        if (added_device[i].update_delay_ms > APP_UPDATE_DATA_TIMEOUT_SECOND) {
-          if (added_device[i].update_delay_ms > 86400) {
-            snprintf(history_str,
-                     sizeof(history_str),
-                     "%ld days ago",
-                     added_device[i].update_delay_ms / 86400);
-          } else if (added_device[i].update_delay_ms > 3600) {
-            snprintf(history_str,
-                     sizeof(history_str),
-                     "%ld hours ago",
-                     added_device[i].update_delay_ms / 3600);
-          } else if (added_device[i].update_delay_ms > 60) {
-            snprintf(history_str,
-                     sizeof(history_str),
-                     "%ld minutes ago",
-                     added_device[i].update_delay_ms / 60);
-          } else {
-            snprintf(history_str,
-                     sizeof(history_str),
-                     "%ld seconds ago",
-                     added_device[i].update_delay_ms);
-          }
-          lv_label_set_text(*(ui_update_history_scr1[i]), history_str);
-        } else {
-          lv_label_set_text(*(ui_update_history_scr1[i]), " ");
-        }
-        lv_obj_clear_flag(*(ui_device_panel_scr1[i]), LV_OBJ_FLAG_HIDDEN);
-        lv_label_set_text(*(ui_devicename_label_scr1[i]),
-                          (char *)added_device[i].device_name);
-        lv_label_set_text(*(ui_mac_label_scr1[i]),
-                          (char *)added_device[i].device.device_mac_str);
-      } else {
-        lv_obj_add_flag(*(ui_device_panel_scr1[i]), LV_OBJ_FLAG_HIDDEN);
-      }
-    }
     if (!remove_completed && (remove_slot < added_device_count)
         && added_device[remove_slot].device.is_added) {
       app_remove_added_device();
     }
-  } else if (ui_Screen3 == current_screen) {
+    for (int i = 0; i < APP_MAX_CLIENT_DEVICES; i++) {
+      if (added_device[i].dirty_fields) {
+        app_draw_device(i);
+      }
+    }
+  } else if ((ui_Screen3 == current_screen) && scanned_list_dirty) {
     for (int i = 0; i < scanned_device_count; i++) {
-      lv_obj_clear_flag(*(ui_scanned_dev_list_scr3[i]), LV_OBJ_FLAG_HIDDEN);
-      lv_label_set_text(*(ui_device_name_label_scr3[i]),
-                        (char *)scanned_device[i].device_mac_str);
+      app_set_hidden(*(ui_scanned_dev_list_scr3[i]), false);
+      app_set_label_text(*(ui_device_name_label_scr3[i]),
+                         (char *)scanned_device[i].device_mac_str);
     }
+    scanned_list_dirty = false;
   } else {
     /*Nothing*/
   }
+
+  stats_updates++;
+  stats_update_ticks += sl_sleeptimer_get_tick_count() - start_tick;
+}
+
+/**************************************************************************//**
+ * Write the changed fields of a client device to the home screen.
+ *****************************************************************************/
+static void app_draw_device(uint8_t index)
+{
+  device_t *device = &added_device[index];
+  uint8_t dirty_fields = device->dirty_fields;
+
+  device->dirty_fields = 0;
+
+  if (!device->device.is_added) {
+    app_set_hidden(*(ui_device_panel_scr1[index]), true);
+    return;
+  }
+
+  if (dirty_fields & APP_FIELD_PANEL) {
+    app_set_hidden(*(ui_device_panel_scr1[index]), false);
+    app_set_label_text(*(ui_devicename_label_scr1[index]),
+                       (char *)device->device_name);
+    app_set_label_text(*(ui_mac_label_scr1[index]),
+                       (char *)device->device.device_mac_str);
+  }
+
+  if (dirty_fields & APP_FIELD_INFO) {
+    app_set_hidden(*(ui_device_icon_scr1[index]), !device->has_data);
+    app_set_label_text(*(ui_device_infor_scr1[index]), device->info_str);
+    app_set_hidden(*(ui_temperature_icon_scr1[index]),
+                   device->icon != APP_ICON_TEMPERATURE);
+    app_set_hidden(*(ui_light_on_icon_scr1[index]),
+                   device->icon != APP_ICON_LIGHT_ON);
+    app_set_hidden(*(ui_light_off_icon_scr1[index]),
+                   device->icon != APP_ICON_LIGHT_OFF);
+    app_set_hidden(*(ui_but_on_icon_scr1[index]),
+                   device->icon != APP_ICON_BUTTON_ON);
+    app_set_hidden(*(ui_but_off_icon_scr1[index]),
+                   device->icon != APP_ICON_BUTTON_OFF);
+  }
+
+  if (dirty_fields & APP_FIELD_HISTORY) {
+    app_set_label_text(*(ui_update_history_scr1[index]), device->history_str);
+  }
 }
 
 /**************************************************************************//**
@@ -542,6 +620,7 @@ static void app_registe_new_device(void)
         app_log("Device is added: [NAME]: %s       [MAC]: %s\n",
                 added_device[added_device_count].device_name,
                 added_device[added_device_count].device.device_mac_str);
+        added_device[added_device_count].dirty_fields = APP_FIELD_ALL;
         added_device_count++;
         for (int j = i; j < scanned_device_count - 1; j++) {
           memcpy(&scanned_device[j], &scanned_device[j + 1],
@@ -552,12 +631,19 @@ static void app_registe_new_device(void)
                0,
                sizeof(scanned_device_t));
         register_completed = true;
+        scanned_list_dirty = true;
         lv_obj_add_flag(*(ui_scanned_dev_list_scr3[scanned_device_count]),
                         LV_OBJ_FLAG_HIDDEN);
         lv_disp_load_scr(ui_Screen3);
       }
     }
   }
+  if (!register_completed) {
+    // Drop a request that cannot be served, instead of retrying it on every
+    // pass of the main loop
+    app_log("[WRN]: Cannot register the device!\n");
+    register_completed = true;
+  }
 }
 
 /**************************************************************************//**
@@ -570,16 +656,13 @@ static void app_remove_added_device(void)
   app_log("Device is removed: [NAME]: %s       [MAC]: %s\n",
           added_device[remove_slot].device_name,
           added_device[remove_slot].device.device_mac_str);
-  for (int j = remove_slot; j < added_device_count; j++) {
-    app_hidden_icon_on_panel_index(j);
-  }
-  lv_obj_add_flag(*(ui_device_icon_scr1[remove_slot]), LV_OBJ_FLAG_HIDDEN);
   if (scanned_device_count < APP_MAX_CLIENT_DEVICES) {
     memcpy(&scanned_device[scanned_device_count],
            &added_device[remove_slot].device,
            sizeof(scanned_device_t));
     scanned_device[scanned_device_count].is_added = false;
     scanned_device_count++;
+    scanned_list_dirty = true;
   }
   sc = bthome_v2_server_key_remove(
     added_device[remove_slot].device.device_mac);
@@ -592,14 +675,10 @@ static void app_remove_added_device(void)
 
   memset(&added_device[added_device_count], 0, sizeof(device_t));
 
-  lv_label_set_text(*(ui_device_infor_scr1[added_device_count]), "");
-  lv_label_set_text(*(ui_devicename_label_scr1[added_device_count]), "");
-  lv_label_set_text(*(ui_mac_label_scr1[added_device_count]), "");
-  lv_label_set_text(*(ui_update_history_scr1[added_device_count]), "");
-  lv_obj_add_flag(*(ui_device_icon_scr1[added_device_count]),
-                  LV_OBJ_FLAG_HIDDEN);
-  lv_obj_add_flag(*(ui_device_panel_scr1[added_device_count]),
-                  LV_OBJ_FLAG_HIDDEN);
+  // The devices after the removed one moved up by one panel
+  for (int k = remove_slot; k < APP_MAX_CLIENT_DEVICES; k++) {
+    added_device[k].dirty_fields = APP_FIELD_ALL;
+  }
   remove_completed = true;
 }
 
@@ -617,27 +696,110 @@ static void app_convert_str_to_hex(uint8_t *in, uint8_t *str)
 }
 
 /**************************************************************************//**
- * Hidden all information icons in screen 1.
+ * Format the time since the last data of a client device.
  *****************************************************************************/
-static void app_hidden_icon_on_panel_index(uint8_t panel_idx)
+static void app_format_history(uint32_t delay_s, char *str, size_t size)
 {
-  lv_obj_add_flag(*(ui_temperature_icon_scr1[panel_idx]), LV_OBJ_FLAG_HIDDEN);
-  lv_obj_add_flag(*(ui_light_on_icon_scr1[panel_idx]), LV_OBJ_FLAG_HIDDEN);
-  lv_obj_add_flag(*(ui_light_off_icon_scr1[panel_idx]), LV_OBJ_FLAG_HIDDEN);
-  lv_obj_add_flag(*(ui_but_off_icon_scr1[panel_idx]), LV_OBJ_FLAG_HIDDEN);
-  lv_obj_add_flag(*(ui_but_on_icon_scr1[panel_idx]), LV_OBJ_FLAG_HIDDEN);
+  if (delay_s <= APP_UPDATE_DATA_TIMEOUT_SECOND) {
+    snprintf(str, size, " ");
+  } else if (delay_s > 86400) {
+    snprintf(str, size, "%ld days ago", delay_s / 86400);
+  } else if (delay_s > 3600) {
+    snprintf(str, size, "%ld hours ago", delay_s / 3600);
+  } else if (delay_s > 60) {
+    snprintf(str, size, "%ld minutes ago", delay_s / 60);
+  } else {
+    snprintf(str, size, "%ld seconds ago", delay_s);
+  }
 }
 
 /**************************************************************************//**
- * Update screen timer callback.
+ * Set the text of a label. LVGL redraws a label on every set, so the text is
+ * only set when it changed.
  *****************************************************************************/
-static void update_screen_timer_cb(sl_sleeptimer_timer_handle_t *handle,
-                                   void *data)
+static void app_set_label_text(lv_obj_t *label, const char *text)
 {
-  (void)handle;
-  (void)data;
+  if (strcmp(lv_label_get_text(label), text)) {
+    lv_label_set_text(label, text);
+  }
+}
 
-  sl_bt_external_signal(APP_UPDATE_SCREEN_EXT_SIG);
+/**************************************************************************//**
+ * Show or hide an object, without redrawing it if it is already in that
+ * state.
+ *****************************************************************************/
+static void app_set_hidden(lv_obj_t *obj, bool hidden)
+{
+  if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) != hidden) {
+    if (hidden) {
+      lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    } else {
+      lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    }
+  }
+}
+
+/**************************************************************************//**
+ * Display monitor callback, called by LVGL after each refresh with the
+ * render time in ms and the number of pixels flushed.
+ *****************************************************************************/
+static void app_display_monitor_cb(lv_disp_drv_t *disp_drv,
+                                   uint32_t time,
+                                   uint32_t px)
+{
+  (void)disp_drv;
+
+  stats_frames++;
+  stats_pixels += px;
+  stats_render_ms += time;
+  app_log_display_stats();
+}
+
+/**************************************************************************//**
+ * Log the display statistics once per APP_STATS_PERIOD_MS.
+ *****************************************************************************/
+static void app_log_display_stats(void)
+{
+  uint32_t now = sl_sleeptimer_get_tick_count();
+  uint32_t elapsed_ms = sl_sleeptimer_tick_to_ms(now - stats_start_tick);
+  uint32_t update_us = 0;
+  uint32_t decode_us = 0;
+  img_rle_decoder_stats_t decoder_stats;
+
+  if ((elapsed_ms < APP_STATS_PERIOD_MS) || (stats_frames == 0)) {
+    return;
+  }
+
+  img_rle_decoder_get_stats(&decoder_stats, true);
+  if (decoder_stats.images) {
+    decode_us = decoder_stats.cycles / (SystemCoreClockGet() / 1000000)
+                / decoder_stats.images;
+  }
+
+  if (stats_updates) {
+    update_us = (uint32_t)(((uint64_t)stats_update_ticks * 1000000)
+                           / sl_sleeptimer_get_timer_frequency()
+                           / stats_updates);
+  }
+  app_log("Display: %lu.%lu fps, %lu px/frame, render %lu ms/frame, "
+          "screen update %lu us x %lu\n",
+          (unsigned long)(stats_frames * 1000 / elapsed_ms),
+          (unsigned long)(stats_frames * 10000 / elapsed_ms % 10),
+          (unsigned long)(stats_pixels / stats_frames),
+          (unsigned long)(stats_render_ms / stats_frames),
+          (unsigned long)update_us,
+          (unsigned long)stats_updates);
+  app_log("Images: %lu drawn, %lu lines, decode %lu us/image\n",
+          (unsigned long)decoder_stats.images,
+          (unsigned long)decoder_stats.lines,
+          (unsigned long)decode_us);
+
+  stats_start_tick = now;
+  stats_frames = 0;
+  stats_pixels = 0;
+  stats_render_ms = 0;
+  stats_updates = 0;
+  stats_update_ticks = 0;
 }
 
 /**************************************************************************//**
@@ -0,0 +1,214 @@
+/***************************************************************************//**
+ * @file img_rle_decoder.c
+ * @brief RLE image decoder for LVGL.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+#include <string.h>
+#include "em_device.h"
+#include "lvgl.h"
+#include "img_rle_decoder.h"
+
+// Encoded data: 'R' 'L' 'E' <pixel size>, uint16_t row offsets, rows.
+// See tools/img_rle_convert.py for the packet format.
+#define IMG_RLE_HEADER_SIZE     4
+#define IMG_RLE_RUN_FLAG        0x80
+#define IMG_RLE_COUNT_MASK      0x7F
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+static img_rle_decoder_stats_t decoder_stats;
+
+// -----------------------------------------------------------------------------
+// Private function declarations
+
+static bool img_rle_is_valid(const lv_img_dsc_t *img);
+static lv_res_t img_rle_decoder_info(lv_img_decoder_t *decoder,
+                                     const void *src,
+                                     lv_img_header_t *header);
+static lv_res_t img_rle_decoder_open(lv_img_decoder_t *decoder,
+                                     lv_img_decoder_dsc_t *dsc);
+static lv_res_t img_rle_decoder_read_line(lv_img_decoder_t *decoder,
+                                          lv_img_decoder_dsc_t *dsc,
+                                          lv_coord_t x,
+                                          lv_coord_t y,
+                                          lv_coord_t len,
+                                          uint8_t *buf);
+static void img_rle_decoder_close(lv_img_decoder_t *decoder,
+                                  lv_img_decoder_dsc_t *dsc);
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+void img_rle_decoder_init(void)
+{
+  lv_img_decoder_t *decoder;
+
+  // Cycle counter for the decode statistics
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  decoder = lv_img_decoder_create();
+  LV_ASSERT_MALLOC(decoder);
+  lv_img_decoder_set_info_cb(decoder, img_rle_decoder_info);
+  lv_img_decoder_set_open_cb(decoder, img_rle_decoder_open);
+  lv_img_decoder_set_read_line_cb(decoder, img_rle_decoder_read_line);
+  lv_img_decoder_set_close_cb(decoder, img_rle_decoder_close);
+}
+
+void img_rle_decoder_get_stats(img_rle_decoder_stats_t *stats, bool reset)
+{
+  *stats = decoder_stats;
+  if (reset) {
+    memset(&decoder_stats, 0, sizeof(decoder_stats));
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static bool img_rle_is_valid(const lv_img_dsc_t *img)
+{
+  return (img->header.cf == LV_IMG_CF_RAW_ALPHA)
+         && (img->data_size
+             >= (uint32_t)IMG_RLE_HEADER_SIZE + 2 * img->header.h)
+         && (img->data[0] == 'R')
+         && (img->data[1] == 'L')
+         && (img->data[2] == 'E')
+         && (img->data[3] == LV_IMG_PX_SIZE_ALPHA_BYTE);
+}
+
+static lv_res_t img_rle_decoder_info(lv_img_decoder_t *decoder,
+                                     const void *src,
+                                     lv_img_header_t *header)
+{
+  const lv_img_dsc_t *img = src;
+
+  (void)decoder;
+
+  if ((lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE)
+      || !img_rle_is_valid(img)) {
+    return LV_RES_INV;
+  }
+
+  header->always_zero = 0;
+  header->w = img->header.w;
+  header->h = img->header.h;
+  header->cf = img->header.cf;
+  return LV_RES_OK;
+}
+
+static lv_res_t img_rle_decoder_open(lv_img_decoder_t *decoder,
+                                     lv_img_decoder_dsc_t *dsc)
+{
+  (void)decoder;
+
+  if ((dsc->src_type != LV_IMG_SRC_VARIABLE)
+      || !img_rle_is_valid(dsc->src)) {
+    return LV_RES_INV;
+  }
+
+  // Nothing is decoded up front, LVGL reads the image line by line. LVGL
+  // cannot transform such an image, the images are never zoomed or rotated.
+  dsc->img_data = NULL;
+  decoder_stats.images++;
+  return LV_RES_OK;
+}
+
+static lv_res_t img_rle_decoder_read_line(lv_img_decoder_t *decoder,
+                                          lv_img_decoder_dsc_t *dsc,
+                                          lv_coord_t x,
+                                          lv_coord_t y,
+                                          lv_coord_t len,
+                                          uint8_t *buf)
+{
+  const lv_img_dsc_t *img = dsc->src;
+  const uint8_t *p;
+  uint32_t start_cycles = DWT->CYCCNT;
+  uint16_t offset;
+  lv_coord_t skip = x;
+  lv_coord_t count;
+  lv_coord_t n;
+  bool run;
+
+  (void)decoder;
+
+  if ((x < 0) || (y < 0) || (len <= 0)
+      || (y >= img->header.h) || (x + len > img->header.w)) {
+    return LV_RES_INV;
+  }
+
+  offset = img->data[IMG_RLE_HEADER_SIZE + 2 * y]
+           | (img->data[IMG_RLE_HEADER_SIZE + 2 * y + 1] << 8);
+  p = img->data + IMG_RLE_HEADER_SIZE + 2 * img->header.h + offset;
+
+  while (len > 0) {
+    run = (*p & IMG_RLE_RUN_FLAG) != 0;
+    count = (*p++ & IMG_RLE_COUNT_MASK) + 1;
+
+    // Packets left of the requested area are skipped without copying
+    if (skip >= count) {
+      skip -= count;
+      p += run ? LV_IMG_PX_SIZE_ALPHA_BYTE : count * LV_IMG_PX_SIZE_ALPHA_BYTE;
+      continue;
+    }
+
+    n = LV_MIN(count - skip, len);
+    if (run) {
+      for (lv_coord_t i = 0; i < n; i++) {
+        memcpy(buf, p, LV_IMG_PX_SIZE_ALPHA_BYTE);
+        buf += LV_IMG_PX_SIZE_ALPHA_BYTE;
+      }
+      p += LV_IMG_PX_SIZE_ALPHA_BYTE;
+    } else {
+      memcpy(buf,
+             p + skip * LV_IMG_PX_SIZE_ALPHA_BYTE,
+             n * LV_IMG_PX_SIZE_ALPHA_BYTE);
+      buf += n * LV_IMG_PX_SIZE_ALPHA_BYTE;
+      p += count * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    }
+    skip = 0;
+    len -= n;
+  }
+
+  decoder_stats.lines++;
+  decoder_stats.cycles += DWT->CYCCNT - start_cycles;
+  return LV_RES_OK;
+}
+
+static void img_rle_decoder_close(lv_img_decoder_t *decoder,
+                                  lv_img_decoder_dsc_t *dsc)
+{
+  (void)decoder;
+  (void)dsc;
+}
@@ -0,0 +1,254 @@
+#!/usr/bin/env python3
+"""Convert SquareLine Studio / LVGL image sources to the RLE image format.
+
+The LV_IMG_CF_TRUE_COLOR_ALPHA pixel array of each file is replaced by a run
+length encoded copy that is decoded by src/img_rle_decoder.c. The image
+descriptor keeps its name, so the screens do not need to be changed. Files
+that are already converted are left as they are.
+
+The decoder hands the image to LVGL line by line, and LVGL 8.3 cannot zoom or
+rotate such an image. An image that a screen zooms with lv_img_set_zoom() is
+therefore scaled here with --zoom, using the same zoom value (256 is 100 %),
+and the lv_img_set_zoom() call is removed from the screen. Scaling averages
+the covered source pixels, weighted by their alpha. It also works on files
+that are already converted, but only once per file.
+
+Format of the encoded data:
+  'R' 'L' 'E' <pixel size in bytes>
+  uint16_t row_offset[height]   little endian, from the start of the rows
+  rows                          each row is encoded on its own
+
+A row is a sequence of packets. A control byte with bit 7 set is followed by
+one pixel that is repeated (control & 0x7F) + 1 times, a control byte with bit
+7 clear is followed by (control + 1) literal pixels.
+
+Usage:
+  python3 img_rle_convert.py ../app_ui/images/*.c
+  python3 img_rle_convert.py --zoom 50 ../app_ui/images/ui_img_exit_icon_png.c
+"""
+
+import argparse
+import re
+
+PIXEL_SIZE = 3      # LV_COLOR_DEPTH 16 with an 8 bit alpha channel
+MAX_PACKET = 128
+
+ARRAY_RE = re.compile(
+    r'(const LV_ATTRIBUTE_MEM_ALIGN uint8_t (\w+)\[\] = \{)(.*?)(\n\};)',
+    re.S)
+COMMENT_RE = re.compile(r'(// Scaled .*\n)?// RLE encoded by .*\n')
+ZOOM_NONE = 256
+
+
+def encode_row(row):
+    pixels = [row[i:i + PIXEL_SIZE] for i in range(0, len(row), PIXEL_SIZE)]
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_PACKET]
+            del literal[:MAX_PACKET]
+            out.append(len(chunk) - 1)
+            for pixel in chunk:
+                out.extend(pixel)
+
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while (i + run < len(pixels) and run < MAX_PACKET
+               and pixels[i + run] == pixels[i]):
+            run += 1
+        # A run of two pixels already saves bytes over a literal
+        if run >= 2:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.extend(pixels[i])
+            i += run
+        else:
+            literal.append(pixels[i])
+            i += 1
+    flush_literal()
+    return out
+
+
+def decode(data, width, height):
+    rows = 4 + 2 * height
+    out = bytearray()
+    for y in range(height):
+        pos = rows + (data[4 + 2 * y] | (data[5 + 2 * y] << 8))
+        count = 0
+        while count < width:
+            control = data[pos]
+            pos += 1
+            if control & 0x80:
+                n = (control & 0x7F) + 1
+                out.extend(data[pos:pos + PIXEL_SIZE] * n)
+                pos += PIXEL_SIZE
+            else:
+                n = control + 1
+                out.extend(data[pos:pos + n * PIXEL_SIZE])
+                pos += n * PIXEL_SIZE
+            count += n
+    return bytes(out)
+
+
+def encode(raw, width, height):
+    stride = width * PIXEL_SIZE
+    offsets = bytearray()
+    rows = bytearray()
+    for y in range(height):
+        if len(rows) > 0xFFFF:
+            raise ValueError('encoded image too large for 16 bit row offsets')
+        offsets.extend(len(rows).to_bytes(2, 'little'))
+        rows.extend(encode_row(raw[y * stride:(y + 1) * stride]))
+    return b'RLE' + bytes([PIXEL_SIZE]) + bytes(offsets) + bytes(rows)
+
+
+def unpack_pixel(raw, i):
+    color = raw[i] | (raw[i + 1] << 8)
+    return (color >> 11, (color >> 5) & 0x3F, color & 0x1F, raw[i + 2])
+
+
+def pack_pixel(red, green, blue, alpha):
+    color = (red << 11) | (green << 5) | blue
+    return bytes((color & 0xFF, color >> 8, alpha))
+
+
+def scale_weights(src_size, dst_size):
+    """Source pixels covered by each destination pixel, with their weight."""
+    step = src_size / dst_size
+    weights = []
+    for d in range(dst_size):
+        start = d * step
+        end = start + step
+        covered = []
+        s = int(start)
+        while s < end and s < src_size:
+            weight = min(end, s + 1) - max(start, s)
+            if weight > 1e-9:
+                covered.append((s, weight))
+            s += 1
+        weights.append(covered)
+    return weights
+
+
+def scale(raw, width, height, zoom):
+    """Scale an image the way lv_img_set_zoom(zoom) displays it."""
+    new_width = max(1, round(width * zoom / ZOOM_NONE))
+    new_height = max(1, round(height * zoom / ZOOM_NONE))
+    columns = scale_weights(width, new_width)
+    rows = scale_weights(height, new_height)
+    pixels = [unpack_pixel(raw, i) for i in range(0, len(raw), PIXEL_SIZE)]
+    out = bytearray()
+    for row in rows:
+        for column in columns:
+            red = green = blue = alpha = area = 0.0
+            for y, wy in row:
+                for x, wx in column:
+                    r, g, b, a = pixels[y * width + x]
+                    weight = wx * wy
+                    area += weight
+                    alpha += a * weight
+                    red += r * a * weight
+                    green += g * a * weight
+                    blue += b * a * weight
+            if alpha > 0:
+                out.extend(pack_pixel(round(red / alpha), round(green / alpha),
+                                      round(blue / alpha),
+                                      round(alpha / area)))
+            else:
+                out.extend(pack_pixel(0, 0, 0, 0))
+    return bytes(out), new_width, new_height
+
+
+def format_array(data):
+    lines = []
+    for i in range(0, len(data), 13):
+        lines.append('  ' + ' '.join('0x%02X,' % b for b in data[i:i + 13]))
+    return '\n' + '\n'.join(lines)
+
+
+def convert(path, zoom=None):
+    with open(path) as f:
+        source = f.read()
+
+    match = ARRAY_RE.search(source)
+    width = int(re.search(r'\.header\.w = (\d+)', source).group(1))
+    height = int(re.search(r'\.header\.h = (\d+)', source).group(1))
+    data = bytes(int(b, 16) for b in re.findall(r'0x([0-9a-fA-F]{2})',
+                                                 match.group(3)))
+
+    if 'LV_IMG_CF_RAW_ALPHA' in source:
+        if zoom is None:
+            return None
+        if 'Scaled' in source:
+            raise ValueError('%s: already scaled' % path)
+        raw = decode(data, width, height)
+    elif 'LV_IMG_CF_TRUE_COLOR_ALPHA' in source:
+        raw = data
+    else:
+        raise ValueError('%s: only LV_IMG_CF_TRUE_COLOR_ALPHA is supported'
+                         % path)
+    if len(raw) != width * height * PIXEL_SIZE:
+        raise ValueError('%s: pixel data does not match %dx%d'
+                         % (path, width, height))
+
+    original_size = len(raw)
+    comment = ''
+    if zoom is not None and zoom != ZOOM_NONE:
+        raw, new_width, new_height = scale(raw, width, height, zoom)
+        comment = ('// Scaled to zoom %d from %dx%d by '
+                   'tools/img_rle_convert.py\n' % (zoom, width, height))
+        source = source.replace('.header.w = %d,' % width,
+                                '.header.w = %d,' % new_width)
+        source = source.replace('.header.h = %d,' % height,
+                                '.header.h = %d,' % new_height)
+        width, height = new_width, new_height
+
+    encoded = encode(raw, width, height)
+    if decode(encoded, width, height) != raw:
+        raise ValueError('%s: encoding check failed' % path)
+
+    source = COMMENT_RE.sub('', source)
+    match = ARRAY_RE.search(source)
+    source = (source[:match.start()]
+              + comment
+              + '// RLE encoded by tools/img_rle_convert.py, %d bytes raw\n'
+              % len(raw)
+              + match.group(1) + format_array(encoded) + match.group(4)
+              + source[match.end():])
+    source = source.replace('LV_IMG_CF_TRUE_COLOR_ALPHA', 'LV_IMG_CF_RAW_ALPHA')
+    with open(path, 'w') as f:
+        f.write(source)
+    return original_size, len(encoded)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--zoom', type=int,
+                        help='scale the images by this LVGL zoom value')
+    parser.add_argument('paths', nargs='+', help='image source files')
+    options = parser.parse_args()
+
+    total_raw = 0
+    total_encoded = 0
+    for path in options.paths:
+        sizes = convert(path, options.zoom)
+        if sizes is None:
+            print('%-40s already converted' % path)
+            continue
+        raw, encoded = sizes
+        total_raw += raw
+        total_encoded += encoded
+        print('%-40s %7d -> %7d bytes (%5.1f %%)'
+              % (path, raw, encoded, 100.0 * encoded / raw))
+    if total_raw:
+        print('%-40s %7d -> %7d bytes (%5.1f %%), %d bytes saved'
+              % ('total', total_raw, total_encoded,
+                 100.0 * total_encoded / total_raw,
+                 total_raw - total_encoded))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,253 @@
+/***************************************************************************//**
+ * @file ad_parser.c
+ * @brief Advertising data parser and filter.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+#include <string.h>
+#include "ad_parser.h"
+
+// -----------------------------------------------------------------------------
+// Private function declarations
+
+static void type_mask_set(uint32_t *type_mask, uint8_t type);
+static bool type_mask_test(const uint32_t *type_mask, uint8_t type);
+static bool match_filter(const ad_filter_t *filter,
+                         uint16_t key,
+                         const ad_field_t *field);
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+void ad_iterator_init(ad_iterator_t *it, const uint8_t *data, uint16_t len)
+{
+  it->data = data;
+  it->len = len;
+  it->pos = 0;
+}
+
+bool ad_iterator_next(ad_iterator_t *it, ad_field_t *field)
+{
+  uint8_t ad_len;
+
+  if (it->pos >= it->len) {
+    return false;
+  }
+
+  // A zero length AD structure ends the significant part of the data, a
+  // length running past the end of the data means a malformed advertisement
+  ad_len = it->data[it->pos];
+  if ((ad_len == 0) || (ad_len > it->len - it->pos - 1)) {
+    it->pos = it->len;
+    return false;
+  }
+
+  field->type = it->data[it->pos + 1];
+  field->len = ad_len - 1;
+  field->data = &it->data[it->pos + 2];
+  it->pos += ad_len + 1;
+  return true;
+}
+
+bool ad_find_field(const uint8_t *data,
+                   uint16_t len,
+                   uint8_t type,
+                   ad_field_t *field)
+{
+  ad_iterator_t it;
+
+  ad_iterator_init(&it, data, len);
+  while (ad_iterator_next(&it, field)) {
+    if (field->type == type) {
+      return true;
+    }
+  }
+  return false;
+}
+
+sl_status_t ad_filter_set_init(ad_filter_set_t *set,
+                               const ad_filter_t *filters,
+                               uint8_t count)
+{
+  const ad_filter_t *filter;
+
+  if (count > AD_FILTER_MAX) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  memset(set, 0, sizeof(*set));
+  for (uint8_t i = 0; i < count; i++) {
+    filter = &filters[i];
+    switch (filter->type) {
+      case AD_FILTER_NAME:
+      case AD_FILTER_NAME_PREFIX:
+        if (filter->len == 0) {
+          return SL_STATUS_INVALID_PARAMETER;
+        }
+        type_mask_set(set->type_mask, AD_TYPE_SHORTENED_LOCAL_NAME);
+        type_mask_set(set->type_mask, AD_TYPE_COMPLETE_LOCAL_NAME);
+        break;
+
+      case AD_FILTER_UUID16:
+        if (filter->len != 2) {
+          return SL_STATUS_INVALID_PARAMETER;
+        }
+        type_mask_set(set->type_mask, AD_TYPE_UUID16_INCOMPLETE);
+        type_mask_set(set->type_mask, AD_TYPE_UUID16_COMPLETE);
+        break;
+
+      case AD_FILTER_UUID128:
+        if (filter->len != 16) {
+          return SL_STATUS_INVALID_PARAMETER;
+        }
+        type_mask_set(set->type_mask, AD_TYPE_UUID128_INCOMPLETE);
+        type_mask_set(set->type_mask, AD_TYPE_UUID128_COMPLETE);
+        break;
+
+      case AD_FILTER_MANUFACTURER_ID:
+        if (filter->len != 2) {
+          return SL_STATUS_INVALID_PARAMETER;
+        }
+        type_mask_set(set->type_mask, AD_TYPE_MANUFACTURER_DATA);
+        break;
+
+      default:
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+
+    // Most fields are rejected on this key, without calling memcmp()
+    set->key[i] = filter->value[0];
+    if (filter->len > 1) {
+      set->key[i] |= (uint16_t)filter->value[1] << 8;
+    }
+  }
+
+  set->filters = filters;
+  set->count = count;
+  return SL_STATUS_OK;
+}
+
+int ad_filter_set_match(const ad_filter_set_t *set,
+                        const uint8_t *data,
+                        uint16_t len,
+                        ad_field_t *field)
+{
+  ad_iterator_t it;
+  ad_field_t current;
+
+  ad_iterator_init(&it, data, len);
+  while (ad_iterator_next(&it, &current)) {
+    if (!type_mask_test(set->type_mask, current.type)) {
+      continue;
+    }
+    for (uint8_t i = 0; i < set->count; i++) {
+      if (match_filter(&set->filters[i], set->key[i], &current)) {
+        if (field != NULL) {
+          *field = current;
+        }
+        return i;
+      }
+    }
+  }
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static void type_mask_set(uint32_t *type_mask, uint8_t type)
+{
+  type_mask[type >> 5] |= 1UL << (type & 0x1F);
+}
+
+static bool type_mask_test(const uint32_t *type_mask, uint8_t type)
+{
+  return (type_mask[type >> 5] & (1UL << (type & 0x1F))) != 0;
+}
+
+static bool match_filter(const ad_filter_t *filter,
+                         uint16_t key,
+                         const ad_field_t *field)
+{
+  uint16_t i;
+
+  switch (filter->type) {
+    case AD_FILTER_NAME:
+    case AD_FILTER_NAME_PREFIX:
+      if ((field->type != AD_TYPE_SHORTENED_LOCAL_NAME)
+          && (field->type != AD_TYPE_COMPLETE_LOCAL_NAME)) {
+        return false;
+      }
+      if ((field->len < filter->len)
+          || ((filter->type == AD_FILTER_NAME)
+              && (field->len != filter->len))) {
+        return false;
+      }
+      if (field->data[0] != (uint8_t)key) {
+        return false;
+      }
+      return memcmp(&field->data[1], &filter->value[1], filter->len - 1) == 0;
+
+    case AD_FILTER_UUID16:
+      if ((field->type != AD_TYPE_UUID16_INCOMPLETE)
+          && (field->type != AD_TYPE_UUID16_COMPLETE)) {
+        return false;
+      }
+      for (i = 0; i + 2 <= field->len; i += 2) {
+        if ((field->data[i] | (field->data[i + 1] << 8)) == key) {
+          return true;
+        }
+      }
+      return false;
+
+    case AD_FILTER_UUID128:
+      if ((field->type != AD_TYPE_UUID128_INCOMPLETE)
+          && (field->type != AD_TYPE_UUID128_COMPLETE)) {
+        return false;
+      }
+      for (i = 0; i + 16 <= field->len; i += 16) {
+        if (((field->data[i] | (field->data[i + 1] << 8)) == key)
+            && (memcmp(&field->data[i + 2], &filter->value[2], 14) == 0)) {
+          return true;
+        }
+      }
+      return false;
+
+    case AD_FILTER_MANUFACTURER_ID:
+      return (field->type == AD_TYPE_MANUFACTURER_DATA)
+             && (field->len >= 2)
+             && ((field->data[0] | (field->data[1] << 8)) == key);
+
+    default:
+      return false;
+  }
+}
@@ -47,6 +47,7 @@
 #include "app_timer.h"
 #include "app_log.h"
 #include "app_assert.h"
+#include "ad_parser.h"
 
 #define MAIN_TIMER_MS                 300000 // AT+QIOPEN take upto 150s to response, this timer should longer than 150s
 #define SENDER_TIMER_MS               100
@@ -138,6 +139,15 @@ const uint8_t humidity_char[2] = { 0x6f, 0x2a };
 
 char device_name[] = "Thunderboard";
 
+// A Thunderboard is recognized by its name or by the Environmental sensing
+// service in its advertisement
+static const ad_filter_t scan_filters[] = {
+  { AD_FILTER_NAME_PREFIX, (const uint8_t *)device_name,
+    sizeof(device_name) - 1 },
+  { AD_FILTER_UUID16, envir_service, sizeof(envir_service) },
+};
+static ad_filter_set_t scan_filter_set;
+
 // 50% RHT is interpreted 5000
 static  uint16_t humidity_readout = 5000;
 // 25.0 °C is interpreted 2500
@@ -167,8 +177,6 @@ static bool bg96_net_query_timer_expired = false;
 bg96_state_t _bg96_state = _waking_up;
 at_scheduler_status_t output_object = { SL_STATUS_OK, 0, "" };
 
-static bool find_device_in_advertisement(uint8_t *data, uint8_t len);
-
 static app_timer_t bg96_periodic_timer;
 static app_timer_t main_periodic_timer;
 static app_timer_t ble_scanning_timer;
@@ -214,11 +222,18 @@ static void gps_stop_handler(void *handler_data);
  *****************************************************************************/
 void app_init(void)
 {
+  sl_status_t sc;
+
   sl_iostream_set_default(sl_iostream_vcom_handle);
   app_log_iostream_set(sl_iostream_vcom_handle);
 
   app_log("BLE Cellular Gateway example!\r\n");
 
+  sc = ad_filter_set_init(&scan_filter_set,
+                          scan_filters,
+                          sizeof(scan_filters) / sizeof(scan_filters[0]));
+  app_assert_status(sc);
+
   bg96_init(sl_iostream_uart_mikroe_handle);
 
   app_log("\r\nWaking-up device...\r\n");
@@ -276,9 +291,11 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     // This event is generated when an advertisement packet or a scan response
     // is received from a responder
     case sl_bt_evt_scanner_legacy_advertisement_report_id:
-      if (find_device_in_advertisement(
-            &(evt->data.evt_scanner_legacy_advertisement_report.data.data[0]),
-            evt->data.evt_scanner_legacy_advertisement_report.data.len)) {
+      if (ad_filter_set_match(
+            &scan_filter_set,
+            evt->data.evt_scanner_legacy_advertisement_report.data.data,
+            evt->data.evt_scanner_legacy_advertisement_report.data.len,
+            NULL) >= 0) {
         if (scan_properties.highest_rssi
             <= evt->data.evt_scanner_legacy_advertisement_report.rssi) {
           scan_properties.highest_rssi =
@@ -472,43 +489,6 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
   }
 }
 
-/**************************************************************************//**
- *    @brief
- * Decoding advertising packets is done here. The list of AD types can be found
- * at: https://www.bluetooth.com/specifications/assigned-numbers/Generic-Access-Profile
- *****************************************************************************/
-static bool find_device_in_advertisement(uint8_t *data, uint8_t len)
-{
-  uint8_t ad_field_length;
-  uint8_t ad_field_type;
-  uint8_t i = 0;
-
-  while (i < len) {
-    ad_field_length = data[i];
-    ad_field_type = data[i + 1];
-
-    if ((ad_field_type == 0x08) || (ad_field_type == 0x09)) {
-      // Compare local name
-      if (strncmp((char *)&data[i + 2], device_name,
-                  sizeof(device_name) - 1) == 0) {
-        return 1;
-      }
-    }
-
-    if ((ad_field_type == 0x02) || (ad_field_type == 0x03)) {
-      // Type 0x02 = Incomplete List of 16-bit Service Class UUIDs
-      // Type 0x03 = Complete List of 16-bit Service Class UUIDs
-      if (memcmp(envir_service, &data[i + 2], 2) == 0) {
-        return 1;
-      }
-    }
-    // advance to the next AD struct
-    i = i + ad_field_length + 1;
-  }
-
-  return 0;
-}
-
 /**************************************************************************//**
  * @brief
  *   Callback of the BG96 periodic timer. This timer is used to wake-up
@@ -0,0 +1,197 @@
+/***************************************************************************//**
+ * @file sample_filter.h
+ * @brief Fixed-point sliding window filter for sensor samples.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+
+#ifndef SAMPLE_FILTER_H_
+#define SAMPLE_FILTER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sl_status.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Largest window a filter can hold
+#ifndef SAMPLE_FILTER_WINDOW_MAX
+#define SAMPLE_FILTER_WINDOW_MAX      16
+#endif
+
+// Fraction bits of the exponential moving average state
+#define SAMPLE_FILTER_EMA_FRAC_BITS   8
+
+/// Filter output
+typedef enum {
+  SAMPLE_FILTER_MEAN,         ///< Mean of the window
+  SAMPLE_FILTER_TRIMMED_MEAN, ///< Mean of the window without its minimum
+                              ///< and maximum, once it holds 3 samples
+  SAMPLE_FILTER_MEDIAN,       ///< Median of the window
+  SAMPLE_FILTER_EMA           ///< Exponential moving average
+} sample_filter_mode_t;
+
+/// Window extreme, tracked in a monotonic queue
+typedef struct {
+  int32_t value;
+  uint32_t seq;       ///< Sample number, tells when the value leaves the window
+} sample_filter_extreme_t;
+
+/// Monotonic queue of window extremes
+typedef struct {
+  sample_filter_extreme_t entry[SAMPLE_FILTER_WINDOW_MAX];
+  uint8_t head;
+  uint8_t len;
+} sample_filter_queue_t;
+
+/// Sliding window filter
+typedef struct {
+  int32_t window[SAMPLE_FILTER_WINDOW_MAX];   ///< Samples, oldest at head
+  int32_t sorted[SAMPLE_FILTER_WINDOW_MAX];   ///< Median mode only
+  sample_filter_queue_t min;
+  sample_filter_queue_t max;
+  int64_t sum;
+  int64_t ema;          ///< EMA with SAMPLE_FILTER_EMA_FRAC_BITS fraction bits
+  uint32_t seq;         ///< Samples pushed since reset
+  uint8_t size;
+  uint8_t count;
+  uint8_t head;
+  uint8_t ema_shift;
+  sample_filter_mode_t mode;
+} sample_filter_t;
+
+/***************************************************************************//**
+ * @brief
+ *    Initialize a filter. Samples are integers, fractional values have to be
+ *    scaled by the caller, e.g. to hundredths.
+ *
+ * @param[out] filter
+ *    Filter.
+ * @param[in] mode
+ *    Output of @ref sample_filter_get.
+ * @param[in] size
+ *    Window size, 1 to SAMPLE_FILTER_WINDOW_MAX.
+ * @param[in] ema_shift
+ *    Weight of a new sample is 1 / 2^ema_shift, EMA mode only.
+ *
+ * @return
+ *    @ref SL_STATUS_OK or @ref SL_STATUS_INVALID_PARAMETER.
+ ******************************************************************************/
+sl_status_t sample_filter_init(sample_filter_t *filter,
+                               sample_filter_mode_t mode,
+                               uint8_t size,
+                               uint8_t ema_shift);
+
+/***************************************************************************//**
+ * @brief
+ *    Drop all samples, keep the configuration.
+ *
+ * @param[in,out] filter
+ *    Filter.
+ ******************************************************************************/
+void sample_filter_reset(sample_filter_t *filter);
+
+/***************************************************************************//**
+ * @brief
+ *    Add a sample, the oldest one leaves a full window. Constant time apart
+ *    from the median mode, which keeps the window sorted.
+ *
+ * @param[in,out] filter
+ *    Filter.
+ * @param[in] sample
+ *    New sample.
+ ******************************************************************************/
+void sample_filter_push(sample_filter_t *filter, int32_t sample);
+
+/***************************************************************************//**
+ * @brief
+ *    Get the filter output for the configured mode, 0 if there are no
+ *    samples yet.
+ *
+ * @param[in] filter
+ *    Filter.
+ ******************************************************************************/
+int32_t sample_filter_get(const sample_filter_t *filter);
+
+/***************************************************************************//**
+ * @brief
+ *    Get the mean of the window, truncated towards zero.
+ *
+ * @param[in] filter
+ *    Filter.
+ ******************************************************************************/
+int32_t sample_filter_mean(const sample_filter_t *filter);
+
+/***************************************************************************//**
+ * @brief
+ *    Get the mean of the window without its minimum and maximum. Windows of
+ *    1 or 2 samples are averaged as they are.
+ *
+ * @param[in] filter
+ *    Filter.
+ ******************************************************************************/
+int32_t sample_filter_trimmed_mean(const sample_filter_t *filter);
+
+/***************************************************************************//**
+ * @brief
+ *    Get the smallest sample of the window.
+ *
+ * @param[in] filter
+ *    Filter.
+ ******************************************************************************/
+int32_t sample_filter_min(const sample_filter_t *filter);
+
+/***************************************************************************//**
+ * @brief
+ *    Get the largest sample of the window.
+ *
+ * @param[in] filter
+ *    Filter.
+ ******************************************************************************/
+int32_t sample_filter_max(const sample_filter_t *filter);
+
+/***************************************************************************//**
+ * @brief
+ *    Get the number of samples in the window.
+ *
+ * @param[in] filter
+ *    Filter.
+ ******************************************************************************/
+uint8_t sample_filter_count(const sample_filter_t *filter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SAMPLE_FILTER_H_ */
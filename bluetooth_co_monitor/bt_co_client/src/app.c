@@ -46,6 +46,8 @@
 #include "co_client_app.h"
 #include "co_client_oled.h"
 #include "co_client_nvm.h"
+#include "ad_parser.h"
+#include "sample_filter.h"
 
 #define CLIENT_BUTTON_EVENT                        (1 << 0)
 #define CO_MONITOR_EVENT                           (1 << 1)
@@ -64,11 +66,18 @@ typedef enum {
 // The advertised name of the CO sensor (prefix)
 static char dev_name_to_cmp[] = "CO_S_";
 
+// Sensor advertisements are recognized by the name prefix
+static const ad_filter_t scan_filters[] = {
+  { AD_FILTER_NAME_PREFIX, (const uint8_t *)dev_name_to_cmp,
+    sizeof(dev_name_to_cmp) - 1 },
+};
+static ad_filter_set_t scan_filter_set;
+
 // Connection state handle.
 static conn_state_t conn_state = booting;
 
-// Buffer contains the value of the CO level
-static uint32_t value_ppm[DATA_BUFFER_SIZE] = { 0 };
+// Last DATA_BUFFER_SIZE values of the CO level
+static sample_filter_t ppm_filter;
 
 // Status flags of scanning and stop scanning
 static bool is_already_scanning_flag = false;
@@ -96,9 +105,6 @@ static uint8_t advertising_set_handle = 0xff;
 // Connect with phone
 static void connection_open_handle(sl_bt_msg_t *evt);
 
-// Find device by name.
-static uint8_t find_name_in_advertisement(uint8_t *data, uint8_t len);
-
 // System boot event handler.
 static void system_boot_handle(sl_bt_msg_t *evt);
 
@@ -132,7 +138,18 @@ static void co_monitor_data_process(void);
  *****************************************************************************/
 void app_init(void)
 {
+  sl_status_t sc;
+
   app_log("BLE Client\r\n");
+  sc = ad_filter_set_init(&scan_filter_set,
+                          scan_filters,
+                          sizeof(scan_filters) / sizeof(scan_filters[0]));
+  app_assert_status(sc);
+  sc = sample_filter_init(&ppm_filter,
+                          SAMPLE_FILTER_TRIMMED_MEAN,
+                          DATA_BUFFER_SIZE,
+                          0);
+  app_assert_status(sc);
   client_app_init();
   client_nvm3_get_config(&cfg);
 
@@ -199,40 +216,44 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
 
 static void scanner_legacy_advertisement_report_handle(sl_bt_msg_t *evt)
 {
-  uint32_t sum = 0;
   uint32_t average_value_ppm = 0;
-  uint8_t data_advertisement[100] = { 0 };
-//  static uint32_t value_ppm[5] = {0};
+  uint32_t value_ppm;
+  ad_field_t manuf_data;
   static uint32_t counter_ppm;
   static uint32_t counter_ppm_old = 0;
 
   static uint8_t sample_counter = 0;
 
   // If a sensor advertisement is found...
-  if (find_name_in_advertisement(evt->data.
-                                 evt_scanner_legacy_advertisement_report.data.
-                                 data,
-                                 evt->data.
-                                 evt_scanner_legacy_advertisement_report.data.
-                                 len)) {
-    memcpy(data_advertisement,
-           evt->data.evt_scanner_legacy_advertisement_report.data.data,
-           evt->data.evt_scanner_legacy_advertisement_report.data.len);
-
-    counter_ppm =
-      (data_advertisement[7]
-       | (data_advertisement[8] <<
-          8) | (data_advertisement[9] << 16) | (data_advertisement[10] << 24));
+  if ((ad_filter_set_match(&scan_filter_set,
+                           evt->data.evt_scanner_legacy_advertisement_report.
+                           data.data,
+                           evt->data.evt_scanner_legacy_advertisement_report.
+                           data.len,
+                           NULL) >= 0)
+      // ...read the sample counter and the CO level that follow the
+      // manufacturer ID, in place
+      && ad_find_field(evt->data.evt_scanner_legacy_advertisement_report.
+                       data.data,
+                       evt->data.evt_scanner_legacy_advertisement_report.
+                       data.len,
+                       AD_TYPE_MANUFACTURER_DATA,
+                       &manuf_data)
+      && (manuf_data.len >= 10)) {
+    counter_ppm = manuf_data.data[2]
+                  | (manuf_data.data[3] << 8)
+                  | (manuf_data.data[4] << 16)
+                  | ((uint32_t)manuf_data.data[5] << 24);
 
     if (counter_ppm != counter_ppm_old) {
-      value_ppm[sample_counter] = data_advertisement[11]
-                                  | (data_advertisement[12] <<
-                                     8)
-                                  | (data_advertisement[13] <<
-                                     16) | (data_advertisement[14] << 24);
+      value_ppm = manuf_data.data[6]
+                  | (manuf_data.data[7] << 8)
+                  | (manuf_data.data[8] << 16)
+                  | ((uint32_t)manuf_data.data[9] << 24);
       app_log("advertise receive: count: %ld, data in ppm: %ld\r\n",
               counter_ppm,
-              value_ppm[sample_counter]);
+              value_ppm);
+      sample_filter_push(&ppm_filter, (int32_t)value_ppm);
       sample_counter++;
       counter_ppm_old = counter_ppm;
     }
@@ -241,12 +262,8 @@ static void scanner_legacy_advertisement_report_handle(sl_bt_msg_t *evt)
       sample_counter = 0;
 
       // calculate average of ppm value
-      for (uint8_t i = 0; i < 5; i++) {
-        sum += value_ppm[i];
-      }
-      average_value_ppm = sum / 5;
+      average_value_ppm = (uint32_t)sample_filter_mean(&ppm_filter);
       app_log("average value (5 sample) %ld\r\n", average_value_ppm);
-      sum = 0;
 
       // update value on oled
       client_oled_app_update_co_level_screen(average_value_ppm,
@@ -265,73 +282,6 @@ static void scanner_legacy_advertisement_report_handle(sl_bt_msg_t *evt)
   }
 }
 
-/***************************************************************************//**
- * Parse advertisements looking for the name of the peripheral device
- * @param[in] data: Advertisement packet
- * @param[in] len:  Length of the advertisement packet
- ******************************************************************************/
-static uint8_t find_name_in_advertisement(uint8_t *data, uint8_t len)
-{
-  uint8_t ad_field_length;
-  uint8_t ad_field_type;
-  uint8_t i = 0;
-
-  // Parse advertisement packet
-  while (i < len) {
-    ad_field_length = data[i];
-    ad_field_type = data[i + 1];
-    // Shortened Local Name ($08) or Complete Local Name($09)
-    if ((ad_field_type == 0x08) || (ad_field_type == 0x09)) {
-      // compare name
-      if (memcmp(&data[i + 2], dev_name_to_cmp, 5) == 0) {
-        return 1;
-      }
-    }
-    // advance to the next AD struct
-    i = i + ad_field_length + 1;
-  }
-  return 0;
-}
-
-/***************************************************************************//**
- * @brief
- *  This function processes the measured values.
- *  Filters the lowest and greatest values, and calculates an average.
- *
- * @param[in] data
- *  Pointer to data storage structure
- *
- * @return
- *  Returns sample filtered.
- ******************************************************************************/
-static uint32_t co_calculate_average_ppm(uint32_t *data)
-{
-  uint32_t sum = 0;
-  uint16_t min, max;
-  uint8_t i;
-
-  // Calculate average value
-  min = max = data[0];
-  for (i = 0; i < DATA_BUFFER_SIZE; i++) {
-    sum += data[i];
-    if (data[i] > max) {
-      max = data[i];
-    }
-
-    if (data[i] < min) {
-      min = data[i];
-    }
-  }
-
-  // Exclude  min. and max. values
-  if (i > 2) {
-    i -= 2;
-    sum = sum - (min + max);
-  }
-
-  return (uint32_t) (sum / i);
-}
-
 /**************************************************************************//**
  * Handler function for boot event.
  *****************************************************************************/
@@ -627,7 +577,7 @@ void co_monitor_timer_event_handler(void)
 
 void co_monitor_data_process(void)
 {
-  uint32_t average_ppm_value = co_calculate_average_ppm(value_ppm);
+  uint32_t average_ppm_value = (uint32_t)sample_filter_get(&ppm_filter);
   app_log("average ppm value for control buzzer is: %ld\r\n",
           average_ppm_value);
 
@@ -46,6 +46,7 @@
 
 #include "sparkfun_vl53l1x.h"
 #include "sparkfun_vl53l1x_config.h"
+#include "sample_filter.h"
 
 #define C_LVL_SENSOR_TIMER_EVENT           (1 << 0)
 #define NUMBER_SAMPLE                      10
@@ -123,8 +124,8 @@ static advertising_packet_t advertising_data = {
 // The advertising set handle allocated from Bluetooth stack.
 static uint8_t advertising_set_handle = 0xff;
 static sl_sleeptimer_timer_handle_t app_distance_timer;
-static uint16_t arr_result[10];
-static uint16_t sum = 0;
+// Moving average of the last NUMBER_SAMPLE distances
+static sample_filter_t distance_filter;
 static uint8_t sample_counter = 0;
 
 static void app_distance_init(void);
@@ -358,18 +359,17 @@ static void container_level_detection_sensor_event_handler(void)
   if (0 != is_data_ready) {
     // Measurement data is ready to read from the sensor
     sc = vl53l1x_get_result(VL53L1X_ADDR, &raw_result);
-    sum = (sum - arr_result[sample_counter] + raw_result.distance);
-    arr_result[sample_counter] = raw_result.distance;
-    result = sum / NUMBER_SAMPLE;
+    sample_filter_push(&distance_filter, raw_result.distance);
+    result = (uint16_t)sample_filter_get(&distance_filter);
     update_adv_data(result, sample_counter);
     sample_counter++;
     // Clear sensor's interrupt status
     sc = vl53l1x_clear_interrupt(VL53L1X_ADDR);
     // Print result
-    app_log(" > Distance: %4u mm, sample counter: %d, sum: %d\n",
+    app_log(" > Distance: %4u mm, sample counter: %d, average: %d\n",
             raw_result.distance,
             sample_counter,
-            sum);
+            result);
   }
 
   if (sample_counter >= NUMBER_SAMPLE) {
@@ -389,6 +389,11 @@ static void calculate_moving_average(void)
   vl53l1x_result_t result;
   uint16_t value_distance_average = 0;
 
+  sc = sample_filter_init(&distance_filter,
+                          SAMPLE_FILTER_MEAN,
+                          NUMBER_SAMPLE,
+                          0);
+  app_assert_status(sc);
   sample_counter = 0;
   while (sample_counter < NUMBER_SAMPLE)
   {
@@ -398,13 +403,12 @@ static void calculate_moving_average(void)
       // Measurement data is ready to read from the sensor
       sc = vl53l1x_get_result(VL53L1X_ADDR, &result);
       app_assert_status(sc);
-      arr_result[sample_counter] = result.distance;
-      sum += result.distance;
+      sample_filter_push(&distance_filter, result.distance);
       sample_counter++;
     }
   }
 
-  value_distance_average = sum / sample_counter;
+  value_distance_average = (uint16_t)sample_filter_get(&distance_filter);
   sample_counter = 0;
   app_log("Distance average: %d\n", value_distance_average);
 }
@@ -111,6 +111,13 @@ uint16_t sli_bt_cgm_crc16(uint16_t crc, uint8_t *data, size_t len);
  * */
 #define SL_BT_CGM_E2E_CRC_SUPPORTED    0
 
+/** @brief switch this to 1 to compute the E2E-CRC with the GPCRC peripheral
+ * instead of the lookup table. Requires the emlib_gpcrc component.
+ * */
+#ifndef SL_BT_CGM_E2E_CRC_USE_GPCRC
+#define SL_BT_CGM_E2E_CRC_USE_GPCRC    0
+#endif
+
 /** @} */ // end addtogroup bluetooth
 
 /**
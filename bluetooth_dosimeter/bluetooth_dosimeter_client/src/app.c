@@ -46,6 +46,7 @@
 #include "client_nvm.h"
 #include "mikroe_cmt_8540s_smt.h"
 #include "app.h"
+#include "ad_parser.h"
 
 #define client_BUTTON_EVENT                         1
 #define TIMER_TIMEOUT                               10000
@@ -66,6 +67,12 @@ typedef enum {
 // The advertised name of the dosimeter unit
 static char dev_name[] = "DM_SENSOR";
 
+// Dosimeter advertisements are recognized by the name
+static const ad_filter_t scan_filters[] = {
+  { AD_FILTER_NAME, (const uint8_t *)dev_name, sizeof(dev_name) - 1 },
+};
+static ad_filter_set_t scan_filter_set;
+
 // Connection state handle.
 static conn_state_t conn_state = booting;
 
@@ -107,9 +114,6 @@ static uint8_t advertising_set_handle = 0xff;
  * Local function prototypes.
  *****************************************************************************/
 
-// Find device by name.
-static uint8_t find_name_in_advertisement(uint8_t *data, uint8_t len);
-
 // System boot event handler.
 static void system_boot_handle(sl_bt_msg_t *evt);
 
@@ -150,7 +154,13 @@ static void client_external_event_handle();
  *****************************************************************************/
 void app_init(void)
 {
+  sl_status_t sc;
+
   app_log("BLE - Dosimeter (Sparkfun Type 5) - Client\r\n");
+  sc = ad_filter_set_init(&scan_filter_set,
+                          scan_filters,
+                          sizeof(scan_filters) / sizeof(scan_filters[0]));
+  app_assert_status(sc);
   client_app_init();
   client_nvm3_get_config(&cfg);
 
@@ -236,12 +246,12 @@ static void scanner_legacy_advertisement_report_handle(sl_bt_msg_t *evt)
   sl_status_t sc;
 
   // If a sensor advertisement is found...
-  if (find_name_in_advertisement(evt->data.
-                                 evt_scanner_legacy_advertisement_report.data.
-                                 data,
-                                 evt->data.
-                                 evt_scanner_legacy_advertisement_report.data.
-                                 len)) {
+  if (ad_filter_set_match(&scan_filter_set,
+                          evt->data.evt_scanner_legacy_advertisement_report.
+                          data.data,
+                          evt->data.evt_scanner_legacy_advertisement_report.
+                          data.len,
+                          NULL) >= 0) {
     // then stop scanning for a while
     sl_bt_scanner_stop();
     // and connect to that device
@@ -255,34 +265,6 @@ static void scanner_legacy_advertisement_report_handle(sl_bt_msg_t *evt)
   }
 }
 
-/***************************************************************************//**
- * Parse advertisements looking for the name of the peripheral device
- * @param[in] data: Advertisement packet
- * @param[in] len:  Length of the advertisement packet
- ******************************************************************************/
-static uint8_t find_name_in_advertisement(uint8_t *data, uint8_t len)
-{
-  uint8_t ad_field_length;
-  uint8_t ad_field_type;
-  uint8_t i = 0;
-
-  // Parse advertisement packet
-  while (i < len) {
-    ad_field_length = data[i];
-    ad_field_type = data[i + 1];
-    // Shortened Local Name ($08) or Complete Local Name($09)
-    if ((ad_field_type == 0x08) || (ad_field_type == 0x09)) {
-      // compare name
-      if (memcmp(&data[i + 2], dev_name, (ad_field_length - 1)) == 0) {
-        return 1;
-      }
-    }
-    // advance to the next AD struct
-    i = i + ad_field_length + 1;
-  }
-  return 0;
-}
-
 /**************************************************************************//**
  * Handler function for boot event.
  *****************************************************************************/
@@ -0,0 +1,105 @@
+/***************************************************************************//**
+ * @file esl_epd_diff.h
+ * @brief Row based image diff for the e-paper display.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+
+#ifndef ESL_EPD_DIFF_H
+#define ESL_EPD_DIFF_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Maximum number of row bands in one diff
+#define ESL_EPD_DIFF_MAX_BANDS   8
+
+/// Band of consecutive rows to be sent to the display
+typedef struct {
+  uint16_t first_row;
+  uint16_t row_count;
+} esl_epd_band_t;
+
+/// Rows that differ between the image shown and the next one
+typedef struct {
+  uint16_t       changed_rows;  ///< Number of rows that changed
+  uint16_t       band_rows;     ///< Number of rows covered by the bands
+  uint8_t        band_count;
+  esl_epd_band_t bands[ESL_EPD_DIFF_MAX_BANDS];
+} esl_epd_diff_t;
+
+/***************************************************************************//**
+ * @brief
+ *    Hash one row of an image.
+ *
+ * @param[in] row
+ *    Row data.
+ * @param[in] len
+ *    Length of the row in bytes.
+ *
+ * @return
+ *    32-bit FNV-1a hash of the row.
+ ******************************************************************************/
+uint32_t esl_epd_diff_row_hash(const uint8_t *row, uint16_t len);
+
+/***************************************************************************//**
+ * @brief
+ *    Compare the row hashes of the image shown and the next image, and
+ *    collect the changed rows into bands. Bands closer than merge_gap rows
+ *    are merged, and if there are more than ESL_EPD_DIFF_MAX_BANDS bands the
+ *    last one is extended to cover the remaining changes.
+ *
+ * @param[in] shown
+ *    Row hashes of the image shown.
+ * @param[in] next
+ *    Row hashes of the next image.
+ * @param[in] rows
+ *    Number of rows.
+ * @param[in] merge_gap
+ *    Maximum number of unchanged rows between two merged bands.
+ * @param[out] diff
+ *    Result.
+ ******************************************************************************/
+void esl_epd_diff_compare(const uint32_t *shown,
+                          const uint32_t *next,
+                          uint16_t rows,
+                          uint16_t merge_gap,
+                          esl_epd_diff_t *diff);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ESL_EPD_DIFF_H
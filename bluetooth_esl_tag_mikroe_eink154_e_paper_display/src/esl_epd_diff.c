@@ -0,0 +1,90 @@
+/***************************************************************************//**
+ * @file esl_epd_diff.c
+ * @brief Row based image diff for the e-paper display.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+#include <stddef.h>
+#include "esl_epd_diff.h"
+
+#define FNV_OFFSET_BASIS  2166136261UL
+#define FNV_PRIME         16777619UL
+
+uint32_t esl_epd_diff_row_hash(const uint8_t *row, uint16_t len)
+{
+  uint32_t hash = FNV_OFFSET_BASIS;
+
+  for (uint16_t i = 0; i < len; i++) {
+    hash ^= row[i];
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
+
+void esl_epd_diff_compare(const uint32_t *shown,
+                          const uint32_t *next,
+                          uint16_t rows,
+                          uint16_t merge_gap,
+                          esl_epd_diff_t *diff)
+{
+  esl_epd_band_t *band = NULL;
+  uint16_t band_end;
+
+  diff->changed_rows = 0;
+  diff->band_rows = 0;
+  diff->band_count = 0;
+
+  for (uint16_t row = 0; row < rows; row++) {
+    if (shown[row] == next[row]) {
+      continue;
+    }
+    diff->changed_rows++;
+
+    if (band != NULL) {
+      band_end = band->first_row + band->row_count;
+      // Close enough to the previous band, or out of bands: extend it
+      if ((row - band_end <= merge_gap)
+          || (diff->band_count == ESL_EPD_DIFF_MAX_BANDS)) {
+        band->row_count = row + 1 - band->first_row;
+        continue;
+      }
+    }
+
+    band = &diff->bands[diff->band_count++];
+    band->first_row = row;
+    band->row_count = 1;
+  }
+
+  for (uint8_t i = 0; i < diff->band_count; i++) {
+    diff->band_rows += diff->bands[i].row_count;
+  }
+}
@@ -35,6 +35,9 @@
  ******************************************************************************/
 #include <stdint.h>
 #include <stdarg.h>
+#include <string.h>
+#include "em_gpio.h"
+#include "sl_sleeptimer.h"
 #include "esl_tag_log.h"
 #include "esl_tag_display.h"
 #include "esl_tag_image_core.h"
@@ -46,6 +49,7 @@
 #include "esl_tag_display.h"
 #include "esl_tag_image_core.h"
 #include "mikroe_eink_display_config.h"
+#include "esl_epd_diff.h"
 
 // ESL EPD Display timer fast update interval [tick]
 #define ESL_MIKROE_EPD_DISPLAY_TIMER_FAST    2
@@ -56,10 +60,55 @@
 // ESL EPD Display timer slow update interval [ms]
 #define ESL_MIKROE_EPD_DISPLAY_TIMER_SLOW    (sl_sleeptimer_ms_to_tick(250))
 
+// Partial updates in a row before a full refresh clears the ghosting
+#define ESL_MIKROE_EPD_FULL_REFRESH_INTERVAL 10
+
+// Largest change shown with a partial update [rows]
+#define ESL_MIKROE_EPD_PARTIAL_MAX_ROWS      (MIKROE_EINK_DISPLAY_HEIGHT / 2)
+
+// Unchanged rows between two changed bands that are sent rather than
+// starting a new band
+#define ESL_MIKROE_EPD_BAND_MERGE_GAP        4
+
+// Longest partial refresh before it is considered failed [tick]
+#define ESL_MIKROE_EPD_PARTIAL_TIMEOUT       (sl_sleeptimer_ms_to_tick(2000))
+
+// Typical refresh power of the panel, for the energy estimate [uW]
+#define ESL_MIKROE_EPD_REFRESH_POWER_UW      26400
+
+#define ESL_MIKROE_EPD_ROW_BYTES             (MIKROE_EINK_DISPLAY_WIDTH / 8)
+#define ESL_MIKROE_EPD_ROWS                  MIKROE_EINK_DISPLAY_HEIGHT
+
+// EPD controller commands used by the partial update
+#define EPD_CMD_WRITE_RAM                    0x24
+#define EPD_CMD_SET_RAM_X_WINDOW             0x44
+#define EPD_CMD_SET_RAM_Y_WINDOW             0x45
+#define EPD_CMD_SET_RAM_X_COUNTER            0x4E
+#define EPD_CMD_SET_RAM_Y_COUNTER            0x4F
+#define EPD_CMD_UPDATE_CONTROL_2             0x22
+#define EPD_CMD_MASTER_ACTIVATION            0x20
+#define EPD_CMD_TERMINATE                    0xFF
+#define EPD_UPDATE_SEQUENCE_DISPLAY          0xC4
+
 // ESL EPD driver states
 enum driver_states {
   DRIVER_STANDBY,
   DRIVER_IN_PROGRESS,
+  DRIVER_PARTIAL_IN_PROGRESS,
+};
+
+// ESL EPD update kinds
+enum update_kinds {
+  UPDATE_NONE,
+  UPDATE_PARTIAL,
+  UPDATE_FULL,
+};
+
+// ESL EPD statistics of the update in progress
+struct update_stats {
+  enum update_kinds kind;
+  uint32_t          start_tick;
+  uint32_t          spi_bytes;
 };
 
 // ESL EPD driver results
@@ -85,7 +134,39 @@ const uint8_t EINK154_LUT_TABLE[30] =
   0x35, 0x51, 0x51, 0x19, 0x01, 0x00
 };
 
+// Waveform for partial updates: only drives the pixels that change, no
+// flashing of the whole panel
+const uint8_t EINK154_PARTIAL_LUT_TABLE[30] =
+{
+  0x10, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x44, 0x12,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// Row hashes of the image on the panel, and of the image being written
+static uint32_t shown_row_hash[ESL_MIKROE_EPD_ROWS];
+static uint32_t next_row_hash[ESL_MIKROE_EPD_ROWS];
+static bool shown_valid = false;
+static bool partial_lut_loaded = false;
+static uint8_t partial_updates = 0;
+static uint8_t pending_image_index;
+static esl_epd_diff_t diff;
+static struct update_stats update;
+
 static sl_status_t esl_mikroe_epd_display_yield(void);
+static sl_status_t esl_mikroe_epd_read_row(uint8_t image_index,
+                                           uint16_t row,
+                                           uint8_t *buffer);
+static sl_status_t esl_mikroe_epd_plan(uint8_t image_index);
+static sl_status_t esl_mikroe_epd_write_rows(uint8_t image_index,
+                                             uint16_t first_row,
+                                             uint16_t row_count);
+static sl_status_t esl_mikroe_epd_write_bands(uint8_t image_index);
+static void esl_mikroe_epd_set_window(uint16_t first_row, uint16_t row_count);
+static sl_status_t esl_mikroe_epd_partial_start(uint8_t image_index);
+static void esl_mikroe_epd_partial_step(void);
+static void esl_mikroe_epd_finish(sl_status_t sc);
 
 static void esl_mikroe_epd_display_step(uint8_t display_index,
                                         uint8_t image_index)
@@ -105,7 +186,10 @@ static void esl_mikroe_epd_display_step(uint8_t display_index,
           state_machine = DRIVER_IN_PROGRESS;
         } else {
           last_result.error = ESL_ERROR_INSUFFICIENT_RESOURCES;
+          esl_mikroe_epd_finish(last_result.status);
         }
+      } else {
+        esl_mikroe_epd_finish(sc);
       }
       break;
 
@@ -115,11 +199,210 @@ static void esl_mikroe_epd_display_step(uint8_t display_index,
         last_result.status = sc;
         last_result.error = esl_core_get_last_error();
         state_machine = DRIVER_STANDBY;
+        if (sc == SL_STATUS_OK) {
+          // The panel has two RAM buffers and the full update only filled one
+          // of them, a later partial update needs both to hold this image
+          sc = esl_mikroe_epd_write_rows(pending_image_index,
+                                         0,
+                                         ESL_MIKROE_EPD_ROWS);
+        }
+        esl_mikroe_epd_finish(sc);
       } else {
         (void)esl_mikroe_epd_display_yield();
       }
       break;
+
+    case DRIVER_PARTIAL_IN_PROGRESS:
+      break;
+  }
+}
+
+static sl_status_t esl_mikroe_epd_read_row(uint8_t image_index,
+                                           uint16_t row,
+                                           uint8_t *buffer)
+{
+  uint16_t offset = row * ESL_MIKROE_EPD_ROW_BYTES;
+
+  return esl_image_get_data(image_index,
+                            &offset,
+                            ESL_MIKROE_EPD_ROW_BYTES,
+                            buffer);
+}
+
+// Hash the rows of the new image and compare them with the image shown
+static sl_status_t esl_mikroe_epd_plan(uint8_t image_index)
+{
+  uint8_t row_data[ESL_MIKROE_EPD_ROW_BYTES];
+  sl_status_t sc;
+
+  for (uint16_t row = 0; row < ESL_MIKROE_EPD_ROWS; row++) {
+    sc = esl_mikroe_epd_read_row(image_index, row, row_data);
+    if (sc != SL_STATUS_OK) {
+      return sc;
+    }
+    next_row_hash[row] = esl_epd_diff_row_hash(row_data,
+                                               ESL_MIKROE_EPD_ROW_BYTES);
+  }
+
+  esl_epd_diff_compare(shown_row_hash,
+                       next_row_hash,
+                       ESL_MIKROE_EPD_ROWS,
+                       ESL_MIKROE_EPD_BAND_MERGE_GAP,
+                       &diff);
+  if (!shown_valid) {
+    // Nothing is known about the panel content yet, the row hashes of the
+    // image shown are stale: the whole panel is one band
+    diff.changed_rows = ESL_MIKROE_EPD_ROWS;
+    diff.band_rows = ESL_MIKROE_EPD_ROWS;
+    diff.band_count = 1;
+    diff.bands[0].first_row = 0;
+    diff.bands[0].row_count = ESL_MIKROE_EPD_ROWS;
+  }
+  return SL_STATUS_OK;
+}
+
+static void esl_mikroe_epd_set_window(uint16_t first_row, uint16_t row_count)
+{
+  uint16_t last_row = first_row + row_count - 1;
+
+  mikroe_eink_display_send_command(EPD_CMD_SET_RAM_X_WINDOW);
+  mikroe_eink_display_send_data(0);
+  mikroe_eink_display_send_data(ESL_MIKROE_EPD_ROW_BYTES - 1);
+  mikroe_eink_display_send_command(EPD_CMD_SET_RAM_Y_WINDOW);
+  mikroe_eink_display_send_data(first_row & 0xFF);
+  mikroe_eink_display_send_data(first_row >> 8);
+  mikroe_eink_display_send_data(last_row & 0xFF);
+  mikroe_eink_display_send_data(last_row >> 8);
+  mikroe_eink_display_send_command(EPD_CMD_SET_RAM_X_COUNTER);
+  mikroe_eink_display_send_data(0);
+  mikroe_eink_display_send_command(EPD_CMD_SET_RAM_Y_COUNTER);
+  mikroe_eink_display_send_data(first_row & 0xFF);
+  mikroe_eink_display_send_data(first_row >> 8);
+  update.spi_bytes += 14;
+}
+
+// Write rows of the image into the panel RAM, without refreshing the panel
+static sl_status_t esl_mikroe_epd_write_rows(uint8_t image_index,
+                                             uint16_t first_row,
+                                             uint16_t row_count)
+{
+  uint8_t row_data[ESL_MIKROE_EPD_ROW_BYTES];
+  sl_status_t sc;
+
+  esl_mikroe_epd_set_window(first_row, row_count);
+  mikroe_eink_display_send_command(EPD_CMD_WRITE_RAM);
+  update.spi_bytes++;
+  for (uint16_t row = first_row; row < first_row + row_count; row++) {
+    sc = esl_mikroe_epd_read_row(image_index, row, row_data);
+    if (sc != SL_STATUS_OK) {
+      return sc;
+    }
+    for (uint16_t i = 0; i < ESL_MIKROE_EPD_ROW_BYTES; i++) {
+      mikroe_eink_display_send_data(row_data[i]);
+    }
+    update.spi_bytes += ESL_MIKROE_EPD_ROW_BYTES;
+  }
+  return SL_STATUS_OK;
+}
+
+static sl_status_t esl_mikroe_epd_write_bands(uint8_t image_index)
+{
+  sl_status_t sc = SL_STATUS_OK;
+
+  for (uint8_t i = 0; (i < diff.band_count) && (sc == SL_STATUS_OK); i++) {
+    sc = esl_mikroe_epd_write_rows(image_index,
+                                   diff.bands[i].first_row,
+                                   diff.bands[i].row_count);
   }
+  return sc;
+}
+
+static void esl_mikroe_epd_partial_step(void)
+{
+  sl_status_t sc;
+
+  if (GPIO_PinInGet(EINK_DISPLAY_BUSY_PORT, EINK_DISPLAY_BUSY_PIN)) {
+    if ((sl_sleeptimer_get_tick_count() - update.start_tick)
+        < ESL_MIKROE_EPD_PARTIAL_TIMEOUT) {
+      (void)esl_mikroe_epd_display_yield();
+      return;
+    }
+    sc = SL_STATUS_TIMEOUT;
+  } else {
+    // The panel switched to the other RAM buffer, bring it up to date too
+    sc = esl_mikroe_epd_write_bands(pending_image_index);
+    esl_mikroe_epd_set_window(0, ESL_MIKROE_EPD_ROWS);
+  }
+
+  last_result.status = sc;
+  last_result.error = (sc == SL_STATUS_OK) ? ESL_ERROR_VENDOR_NOERROR
+                      : ESL_ERROR_UNSPECIFIED;
+  state_machine = DRIVER_STANDBY;
+  esl_mikroe_epd_finish(sc);
+}
+
+// Start a partial update of the changed bands
+static sl_status_t esl_mikroe_epd_partial_start(uint8_t image_index)
+{
+  sl_status_t sc;
+
+  if (!partial_lut_loaded) {
+    sc = mikroe_eink_display_set_lut(EINK154_PARTIAL_LUT_TABLE, 30);
+    if (sc != SL_STATUS_OK) {
+      return sc;
+    }
+    partial_lut_loaded = true;
+    update.spi_bytes += 31;
+  }
+
+  sc = esl_mikroe_epd_write_bands(image_index);
+  if (sc != SL_STATUS_OK) {
+    return sc;
+  }
+
+  mikroe_eink_display_send_command(EPD_CMD_UPDATE_CONTROL_2);
+  mikroe_eink_display_send_data(EPD_UPDATE_SEQUENCE_DISPLAY);
+  mikroe_eink_display_send_command(EPD_CMD_MASTER_ACTIVATION);
+  mikroe_eink_display_send_command(EPD_CMD_TERMINATE);
+  update.spi_bytes += 4;
+
+  last_result.period = ESL_MIKROE_EPD_DISPLAY_TIMER_START;
+  sc = esl_mikroe_epd_display_yield();
+  if (sc == SL_STATUS_OK) {
+    last_result.error = ESL_ERROR_RETRY;
+    state_machine = DRIVER_PARTIAL_IN_PROGRESS;
+  }
+  return sc;
+}
+
+// Record the image shown and report the cost of the update
+static void esl_mikroe_epd_finish(sl_status_t sc)
+{
+  uint32_t time_ms = sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count()
+                                              - update.start_tick);
+
+  if (sc == SL_STATUS_OK) {
+    memcpy(shown_row_hash, next_row_hash, sizeof(shown_row_hash));
+    shown_valid = true;
+  } else {
+    // The panel content is unknown, the next update will be a full one
+    shown_valid = false;
+  }
+
+  sl_bt_esl_log(ESL_LOG_COMPONENT_APP,
+                ESL_LOG_LEVEL_INFO,
+                "EPD %s update: %u rows changed, %u rows in %u bands, "
+                "%lu SPI bytes, %lu ms, est. %lu uJ, status 0x%04lx",
+                (update.kind == UPDATE_FULL) ? "full"
+                : (update.kind == UPDATE_PARTIAL) ? "partial" : "no",
+                diff.changed_rows,
+                diff.band_rows,
+                diff.band_count,
+                (unsigned long)update.spi_bytes,
+                (unsigned long)time_ms,
+                (unsigned long)((uint64_t)ESL_MIKROE_EPD_REFRESH_POWER_UW
+                                * time_ms / 1000),
+                (unsigned long)sc);
 }
 
 static void esl_mikroe_epd_display_writer(sl_sleeptimer_timer_handle_t *handle,
@@ -129,6 +412,8 @@ static void esl_mikroe_epd_display_writer(sl_sleeptimer_timer_handle_t *handle,
   (void)data;
   if (state_machine == DRIVER_IN_PROGRESS) {
     esl_mikroe_epd_display_step(0, 0);
+  } else if (state_machine == DRIVER_PARTIAL_IN_PROGRESS) {
+    esl_mikroe_epd_partial_step();
   }
 }
 
@@ -172,8 +457,39 @@ sl_status_t esl_user_display_write(int param_count, ...)
   va_end(ptr);
 
   if (state_machine == DRIVER_STANDBY) {
-    // Call step function once to find out the current status of the EPD display
-    esl_mikroe_epd_display_step(display_index, image_index);
+    pending_image_index = image_index;
+    update.start_tick = sl_sleeptimer_get_tick_count();
+    update.spi_bytes = 0;
+    last_result.status = esl_mikroe_epd_plan(image_index);
+
+    if (last_result.status != SL_STATUS_OK) {
+      last_result.error = ESL_ERROR_IMAGE_NOT_AVAILABLE;
+    } else if (diff.changed_rows == 0) {
+      // Same image as the one shown, the panel is left alone
+      update.kind = UPDATE_NONE;
+      esl_mikroe_epd_finish(SL_STATUS_OK);
+    } else if ((diff.band_rows <= ESL_MIKROE_EPD_PARTIAL_MAX_ROWS)
+               && (partial_updates < ESL_MIKROE_EPD_FULL_REFRESH_INTERVAL)) {
+      update.kind = UPDATE_PARTIAL;
+      partial_updates++;
+      last_result.status = esl_mikroe_epd_partial_start(image_index);
+      if (last_result.status != SL_STATUS_OK) {
+        last_result.error = ESL_ERROR_INSUFFICIENT_RESOURCES;
+        esl_mikroe_epd_finish(last_result.status);
+      }
+    } else {
+      update.kind = UPDATE_FULL;
+      partial_updates = 0;
+      if (partial_lut_loaded) {
+        (void)mikroe_eink_display_set_lut(EINK154_LUT_TABLE, 30);
+        partial_lut_loaded = false;
+        update.spi_bytes += 31;
+      }
+      update.spi_bytes += ESL_MIKROE_EPD_ROWS * ESL_MIKROE_EPD_ROW_BYTES;
+      // Call step function once to find out the current status of the EPD
+      // display
+      esl_mikroe_epd_display_step(display_index, image_index);
+    }
   }
 
   // Set return status according to current state and set ESL error if any
@@ -38,6 +38,7 @@
 #include "app_assert.h"
 #include "sl_bluetooth.h"
 #include "dweet_http_client.h"
+#include "ad_parser.h"
 
 // -----------------------------------------------------------------------------
 // Local Macros and Definitions
@@ -158,6 +159,13 @@ static const uint8_t es_humidity_char[2] = { 0x6f, 0x2a };
 
 static characteristic_read_t characteristic_read;
 
+// Thunderboard advertisements are recognized by the name prefix
+static const ad_filter_t scan_filters[] = {
+  { AD_FILTER_NAME_PREFIX, (const uint8_t *)THUNDERBOARD_NAME_CHECK,
+    THUNDERBOARD_NAME_CHECK_LENGTH },
+};
+static ad_filter_set_t scan_filter_set;
+
 static sl_sleeptimer_timer_handle_t scanner_timeout_timer;
 static sl_sleeptimer_timer_handle_t connection_timeout_timer;
 static sl_sleeptimer_timer_handle_t data_collector_timer;
@@ -166,10 +174,6 @@ static sl_sleeptimer_timer_handle_t data_collector_timer;
 // Common local function declarations
 
 static void init_properties(void);
-static uint8_t find_device_name_pattern_in_advertisement(const uint8_t *data,
-                                                         uint8_t data_length,
-                                                         const char *name,
-                                                         uint8_t name_length);
 static void add_connection(uint8_t connection, uint16_t address);
 static void remove_connection(void);
 static uint8_t bt_gatt_read_characteristic_value_from_offset(uint16_t offset,
@@ -213,7 +217,13 @@ static void data_collecter_callback(sl_sleeptimer_timer_handle_t *timer,
  *****************************************************************************/
 void app_init(void)
 {
+  sl_status_t sc;
+
   init_properties();
+  sc = ad_filter_set_init(&scan_filter_set,
+                          scan_filters,
+                          sizeof(scan_filters) / sizeof(scan_filters[0]));
+  app_assert_status(sc);
   dweet_http_client_init();
 }
 
@@ -314,32 +324,6 @@ static void init_properties(void)
   conn_properties.rssi = RSSI_INVALID;
 }
 
-static uint8_t find_device_name_pattern_in_advertisement(const uint8_t *data,
-                                                         uint8_t data_length,
-                                                         const char *name,
-                                                         uint8_t name_length)
-{
-  uint8_t ad_field_length;
-  uint8_t ad_field_type;
-  uint8_t i = 0;
-  // Parse advertisement packet
-  while (i < data_length) {
-    ad_field_length = data[i];
-    ad_field_type = data[i + 1];
-    // Complete ($02) local name.
-    if (ad_field_type == 0x09) {
-      // check local name is match
-      if ((ad_field_length >= name_length)
-          && (strncmp((char *)&data[i + 2], name, name_length) == 0)) {
-        return 1;
-      }
-    }
-    // advance to the next AD struct
-    i = i + ad_field_length + 1;
-  }
-  return 0;
-}
-
 // Add a new connection to the connection_properties array
 static void add_connection(uint8_t connection, uint16_t address)
 {
@@ -580,11 +564,10 @@ static void app_bt_evt_scanner_legacy_advertisement_report(
   // Parse advertisement packets
   if (scan_report->event_flags & SL_BT_SCANNER_EVENT_FLAG_SCANNABLE) {
     // If a thunderboard advertisement is found...
-    if (find_device_name_pattern_in_advertisement(scan_report->data.data,
-                                                  scan_report->data.len,
-                                                  THUNDERBOARD_NAME_CHECK,
-                                                  THUNDERBOARD_NAME_CHECK_LENGTH))
-    {
+    if (ad_filter_set_match(&scan_filter_set,
+                            scan_report->data.data,
+                            scan_report->data.len,
+                            NULL) >= 0) {
       app_log_info(
         "New device found: %02x:%02x:%02x:%02x:%02x:%02x, rssi: %d\r\n",
         scan_report->address.addr[0],
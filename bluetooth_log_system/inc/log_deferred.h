@@ -0,0 +1,89 @@
+/***************************************************************************//**
+ * @file
+ * @brief Deferred binary logging (header)
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+
+#ifndef LOG_DEFERRED_H
+#define LOG_DEFERRED_H
+
+#include <stdint.h>
+
+// Set to 1 to queue the messages of LOG() in binary and send them from the
+// main loop. The host decodes them with tools/log_decode.py.
+#ifndef LOG_DEFERRED_ENABLE
+#define LOG_DEFERRED_ENABLE             0
+#endif
+
+// Size of the ring of pending messages in 32-bit words, a power of 2
+#ifndef LOG_DEFERRED_RING_WORDS
+#define LOG_DEFERRED_RING_WORDS         256
+#endif
+
+// Most arguments of one message, each at most 32 bits wide
+#define LOG_DEFERRED_MAX_ARGS           8
+
+// Frame sent for a message, all fields little endian:
+// marker | number of arguments, format string address, arguments
+#define LOG_DEFERRED_FRAME_MARKER       0xC0
+#define LOG_DEFERRED_FRAME_SIZE(nargs)  (1 + 4 + 4 * (nargs))
+// Format address of the frame that reports the number of dropped messages
+#define LOG_DEFERRED_ID_DROPPED         0
+
+#define LOG_DEFERRED_NARGS(...) \
+  LOG_DEFERRED_NARGS_(0, ## __VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define LOG_DEFERRED_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, n, ...) n
+
+/**************************************************************************//**
+ * Queue a message. The format must be a string literal: its address is sent
+ * instead of the text and the host looks it up in the ELF file.
+ *****************************************************************************/
+#define log_deferred(fmt, ...)                                   \
+  log_deferred_write(fmt, LOG_DEFERRED_NARGS(__VA_ARGS__), ## __VA_ARGS__)
+
+/**************************************************************************//**
+ * Queue a message without formatting it. Safe to call from interrupts, the
+ * message is dropped and counted if the ring is full.
+ *
+ * @param[in] fmt Format string, must stay in the firmware image.
+ * @param[in] nargs Number of arguments.
+ * @param[in] ... Arguments, integers or pointers of at most 32 bits.
+ *****************************************************************************/
+void log_deferred_write(const char *fmt, uint32_t nargs, ...);
+
+/**************************************************************************//**
+ * Send the queued messages. Call it from the main loop.
+ *****************************************************************************/
+void log_deferred_process(void);
+
+#endif // LOG_DEFERRED_H
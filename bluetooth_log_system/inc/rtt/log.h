@@ -1,8 +1,16 @@
 #ifndef LOG_H
 #define LOG_H
 
+#include <stdint.h>
+#include "sl_status.h"
+#include "sl_bluetooth.h"
 #include "SEGGER_RTT.h"
 
+// Output of the deferred log mode, see log_deferred.h
+#define LOG_DEFERRED_OUTPUT(data, len)  SEGGER_RTT_Write(0, data, len)
+
+#include "log_deferred.h"
+
 #if (LOCAL_LOG_OFF == 1)
 #define GK_LOGD(_tag_, _prefix_, ...)
 #define GK_LOGI(_tag_, _prefix_, ...)
@@ -14,6 +22,7 @@
 #define GK_CHECK(tag__, x)
 #define LOG_ASSERT(x)
 #define LOG(...)
+#define LOG_PRINTF(...)
 #define LOGN()
 #define UINT8_ARRAY_DUMP(array_base, array_size)
 #define LOG_DIRECT_ERR(_prefix_, ...)
@@ -84,7 +93,12 @@
   RTT_CTRL_RESET VERBOSE_FLAG \
   SUB_MODULE_NAME END_OF_LOG_HEADER
 
-#define LOG(...)                        SEGGER_RTT_printf(0, __VA_ARGS__)
+#define LOG_PRINTF(...)                 SEGGER_RTT_printf(0, __VA_ARGS__)
+#if (LOG_DEFERRED_ENABLE == 1)
+#define LOG(...)                        log_deferred(__VA_ARGS__)
+#else
+#define LOG(...)                        LOG_PRINTF(__VA_ARGS__)
+#endif
 
 #define LOG_ASSERT_MSG()                                                  \
   do {                                                                    \
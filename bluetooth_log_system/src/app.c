@@ -42,6 +42,11 @@
 #include "app.h"
 #include "log.h"
 
+#if (LOG_DEFERRED_ENABLE == 1)
+#include <stdio.h>
+#include "em_device.h"
+#endif
+
 /* System */
 #define SYSTEM_BOOT_EVT                     SURROUNDING("Boot")
 #define EXSYSTEM_TERNAL_SIGNAL_EVT          SURROUNDING("External signal")
@@ -66,6 +71,9 @@
 #define FOLLOWINGS                          "   |-->>"
 
 static void log_out(uint8_t direct, const char *msg, sl_status_t sc);
+#if (LOG_DEFERRED_ENABLE == 1)
+static void log_benchmark(void);
+#endif
 
 // The advertising set handle allocated from Bluetooth stack.
 static uint8_t advertising_set_handle = 0xff;
@@ -91,6 +99,9 @@ void app_process_action(void)
   // This is called infinitely.                                              //
   // Do not call blocking functions from here!                               //
   /////////////////////////////////////////////////////////////////////////////
+#if (LOG_DEFERRED_ENABLE == 1)
+  log_deferred_process();
+#endif
 }
 
 /**************************************************************************//**
@@ -116,6 +127,9 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       LOGD("This is a DEBUG message\r\n");
       LOGV("This is a VERBOSE message\r\n");
       LOGI("This is an INFORMATION message\r\n\r\n");
+#if (LOG_DEFERRED_ENABLE == 1)
+      log_benchmark();
+#endif
 
       // Create an advertising set.
       sc = sl_bt_advertiser_create_set(&advertising_set_handle);
@@ -330,6 +344,39 @@ static void log_out(uint8_t direct, const char *msg, sl_status_t sc)
   }
 }
 
+#if (LOG_DEFERRED_ENABLE == 1)
+#define BENCHMARK_FORMAT  "Handle = 0x%02x, Interval = %d, Latency = %d\r\n"
+#define BENCHMARK_ARGS    1, 24, 0
+
+/**************************************************************************//**
+ * Compare the cost of one message formatted in place and queued in binary.
+ *****************************************************************************/
+static void log_benchmark(void)
+{
+  uint32_t printf_cycles, deferred_cycles, start;
+  int printf_bytes;
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  start = DWT->CYCCNT;
+  LOG_PRINTF(BENCHMARK_FORMAT, BENCHMARK_ARGS);
+  printf_cycles = DWT->CYCCNT - start;
+
+  start = DWT->CYCCNT;
+  log_deferred(BENCHMARK_FORMAT, BENCHMARK_ARGS);
+  deferred_cycles = DWT->CYCCNT - start;
+
+  printf_bytes = snprintf(NULL, 0, BENCHMARK_FORMAT, BENCHMARK_ARGS);
+  log_deferred("printf: %lu cycles, %d bytes; deferred: %lu cycles, %d bytes\r\n",
+               printf_cycles,
+               printf_bytes,
+               deferred_cycles,
+               LOG_DEFERRED_FRAME_SIZE(3));
+}
+#endif
+
 sl_status_t error_checking(sl_status_t sc, uint8_t directly)
 {
   if (sc == SL_STATUS_OK) {
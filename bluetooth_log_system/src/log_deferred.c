@@ -0,0 +1,183 @@
+/***************************************************************************//**
+ * @file
+ * @brief Deferred binary logging
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+#include "log_deferred.h"
+
+#if (LOG_DEFERRED_ENABLE == 1)
+
+#include <stdarg.h>
+#include <stdatomic.h>
+#include "log.h"
+
+#define RING_MASK               (LOG_DEFERRED_RING_WORDS - 1)
+
+// Record in the ring: header word, format address, arguments. The header is
+// 0 until the whole record is written.
+#define RECORD_COMMITTED        0x80000000UL
+#define RECORD_PADDING          0x40000000UL
+#define RECORD_WORDS_MASK       0x0000FFFFUL
+#define RECORD_HEADER_WORDS     2
+
+_Static_assert((LOG_DEFERRED_RING_WORDS & RING_MASK) == 0,
+               "LOG_DEFERRED_RING_WORDS must be a power of 2");
+
+// Words that are not part of a record are always 0
+static _Atomic uint32_t ring[LOG_DEFERRED_RING_WORDS];
+// Free running word counters, reserved by the writers and freed by the drain
+static _Atomic uint32_t ring_head;
+static _Atomic uint32_t ring_tail;
+// Messages lost because the ring was full
+static _Atomic uint32_t dropped;
+
+static void send_frame(uint32_t id, uint32_t nargs, const uint32_t *args);
+
+/**************************************************************************//**
+ * Queue a message without formatting it.
+ *****************************************************************************/
+void log_deferred_write(const char *fmt, uint32_t nargs, ...)
+{
+  va_list ap;
+  uint32_t head, tail, offset, pad, len;
+
+  if (nargs > LOG_DEFERRED_MAX_ARGS) {
+    nargs = LOG_DEFERRED_MAX_ARGS;
+  }
+  len = RECORD_HEADER_WORDS + nargs;
+
+  // Reserve the words without a lock, an interrupt may log in between. A
+  // record never wraps, the end of the ring is padded instead.
+  head = atomic_load_explicit(&ring_head, memory_order_relaxed);
+  do {
+    tail = atomic_load_explicit(&ring_tail, memory_order_acquire);
+    offset = head & RING_MASK;
+    pad = (offset + len > LOG_DEFERRED_RING_WORDS)
+          ? LOG_DEFERRED_RING_WORDS - offset : 0;
+    if (head + pad + len - tail > LOG_DEFERRED_RING_WORDS) {
+      atomic_fetch_add_explicit(&dropped, 1, memory_order_relaxed);
+      return;
+    }
+  } while (!atomic_compare_exchange_weak_explicit(&ring_head,
+                                                  &head,
+                                                  head + pad + len,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed));
+
+  if (pad > 0) {
+    atomic_store_explicit(&ring[offset],
+                          RECORD_COMMITTED | RECORD_PADDING | pad,
+                          memory_order_release);
+    offset = 0;
+  }
+
+  atomic_store_explicit(&ring[offset + 1],
+                        (uint32_t)(uintptr_t)fmt,
+                        memory_order_relaxed);
+  va_start(ap, nargs);
+  for (uint32_t i = 0; i < nargs; i++) {
+    atomic_store_explicit(&ring[offset + RECORD_HEADER_WORDS + i],
+                          va_arg(ap, uint32_t),
+                          memory_order_relaxed);
+  }
+  va_end(ap);
+
+  // The drain takes the record once the header is set
+  atomic_store_explicit(&ring[offset],
+                        RECORD_COMMITTED | len,
+                        memory_order_release);
+}
+
+/**************************************************************************//**
+ * Send the queued messages.
+ *****************************************************************************/
+void log_deferred_process(void)
+{
+  uint32_t args[LOG_DEFERRED_MAX_ARGS];
+  uint32_t head, tail, offset, header, len, id, lost;
+
+  tail = atomic_load_explicit(&ring_tail, memory_order_relaxed);
+  head = atomic_load_explicit(&ring_head, memory_order_acquire);
+
+  while (tail != head) {
+    offset = tail & RING_MASK;
+    header = atomic_load_explicit(&ring[offset], memory_order_acquire);
+    if (header == 0) {
+      // Still being written, messages are sent in the order reserved
+      break;
+    }
+    len = header & RECORD_WORDS_MASK;
+
+    if ((header & RECORD_PADDING) == 0) {
+      id = atomic_load_explicit(&ring[offset + 1], memory_order_relaxed);
+      for (uint32_t i = 0; i < len - RECORD_HEADER_WORDS; i++) {
+        args[i] = atomic_load_explicit(&ring[offset + RECORD_HEADER_WORDS + i],
+                                       memory_order_relaxed);
+      }
+      send_frame(id, len - RECORD_HEADER_WORDS, args);
+    }
+
+    for (uint32_t i = 0; i < len; i++) {
+      atomic_store_explicit(&ring[offset + i], 0, memory_order_relaxed);
+    }
+    tail += len;
+    atomic_store_explicit(&ring_tail, tail, memory_order_release);
+  }
+
+  lost = atomic_exchange_explicit(&dropped, 0, memory_order_relaxed);
+  if (lost > 0) {
+    send_frame(LOG_DEFERRED_ID_DROPPED, 1, &lost);
+  }
+}
+
+/**************************************************************************//**
+ * Send one message to the host.
+ *****************************************************************************/
+static void send_frame(uint32_t id, uint32_t nargs, const uint32_t *args)
+{
+  uint8_t frame[LOG_DEFERRED_FRAME_SIZE(LOG_DEFERRED_MAX_ARGS)];
+  uint8_t *p = frame;
+
+  *p++ = (uint8_t)(LOG_DEFERRED_FRAME_MARKER | nargs);
+  for (uint32_t i = 0; i <= nargs; i++) {
+    uint32_t value = (i == 0) ? id : args[i - 1];
+
+    *p++ = (uint8_t)value;
+    *p++ = (uint8_t)(value >> 8);
+    *p++ = (uint8_t)(value >> 16);
+    *p++ = (uint8_t)(value >> 24);
+  }
+  LOG_DEFERRED_OUTPUT(frame, LOG_DEFERRED_FRAME_SIZE(nargs));
+}
+
+#endif // LOG_DEFERRED_ENABLE
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+"""Decode the binary messages of the deferred log mode.
+
+With LOG_DEFERRED_ENABLE set to 1 the firmware does not format the messages,
+it sends the address of the format string and the raw arguments instead. The
+strings are looked up in the ELF file of the same build, so the decoder must
+be given the .axf/.out file that is flashed on the device.
+
+Format of a frame, all fields little endian:
+  0xC0 | n                      marker and number of arguments, n <= 8
+  uint32_t format               address of the format string
+  uint32_t argument[n]          integers, or addresses for %s
+
+A frame with format 0 carries the number of messages dropped because the
+buffer of the device was full. Bytes that are not part of a frame, e.g. the
+text of an assert, are printed as they are.
+
+Usage:
+  python3 log_decode.py bt_log_system_vcom.axf < capture.bin
+  python3 log_decode.py bt_log_system_vcom.axf --serial /dev/ttyACM0
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+FRAME_MARKER = 0xC0
+MAX_ARGS = 8
+ID_DROPPED = 0
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+SPEC_RE = re.compile(r'%([-+ #0]*)(\d+|\*)?(\.\d+)?(hh|h|ll|l|z|j|t)?([diuxXocsp%])')
+
+
+class Image:
+    """Loaded sections of an ELF file, to read the strings by address."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            data = f.read()
+        if data[:4] != b'\x7fELF':
+            raise ValueError('%s is not an ELF file' % path)
+        wide = data[4] == 2
+        endian = '<' if data[5] == 1 else '>'
+        if wide:
+            shoff, = struct.unpack_from(endian + 'Q', data, 0x28)
+            shentsize, shnum = struct.unpack_from(endian + 'HH', data, 0x3A)
+            header = endian + 'IIQQQQ'
+        else:
+            shoff, = struct.unpack_from(endian + 'I', data, 0x20)
+            shentsize, shnum = struct.unpack_from(endian + 'HH', data, 0x2E)
+            header = endian + 'IIIIII'
+
+        self.sections = []
+        for i in range(shnum):
+            _, sh_type, flags, addr, offset, size = struct.unpack_from(
+                header, data, shoff + i * shentsize)
+            if (flags & SHF_ALLOC) and sh_type != SHT_NOBITS and size > 0:
+                self.sections.append((addr, data[offset:offset + size]))
+
+    def string(self, addr):
+        for start, content in self.sections:
+            if start <= addr < start + len(content):
+                end = content.find(b'\0', addr - start)
+                if end < 0:
+                    end = len(content)
+                return content[addr - start:end].decode('utf-8', 'replace')
+        return None
+
+
+def signed(value):
+    return value - (1 << 32) if value & 0x80000000 else value
+
+
+def format_message(image, fmt, args):
+    args = list(args)
+
+    def convert(match):
+        flags, width, precision, _, conv = match.groups()
+        if conv == '%':
+            return '%'
+        if width == '*':
+            width = str(signed(args.pop(0))) if args else ''
+        if not args:
+            return match.group(0)
+        value = args.pop(0)
+        spec = '%' + flags + (width or '') + (precision or '')
+        if conv in 'di':
+            return (spec + 'd') % signed(value)
+        if conv == 'c':
+            return (spec + 'c') % chr(value & 0xFF)
+        if conv == 's':
+            text = image.string(value)
+            return (spec + 's') % (text if text is not None else '<0x%08x>' % value)
+        if conv == 'p':
+            return '0x%08x' % value
+        return (spec + conv) % value
+
+    return SPEC_RE.sub(convert, fmt)
+
+
+class Decoder:
+    """Splits a byte stream into frames, resynchronizing on the marker."""
+
+    def __init__(self, image, out):
+        self.image = image
+        self.out = out
+        self.buffer = bytearray()
+
+    def feed(self, data):
+        self.buffer.extend(data)
+        while self.buffer:
+            byte = self.buffer[0]
+            nargs = byte & 0x0F
+            if (byte & 0xF0) != FRAME_MARKER or nargs > MAX_ARGS:
+                self.raw(1)
+                continue
+            size = 1 + 4 * (nargs + 1)
+            if len(self.buffer) < size:
+                break
+            words = struct.unpack_from('<%dI' % (nargs + 1), self.buffer, 1)
+            fmt_id, args = words[0], words[1:]
+            if fmt_id == ID_DROPPED and nargs == 1:
+                self.out.write('\n<%u messages dropped>\n' % args[0])
+            else:
+                fmt = self.image.string(fmt_id)
+                if fmt is None:
+                    # Not a frame, a text byte that looks like a marker
+                    self.raw(1)
+                    continue
+                self.out.write(format_message(self.image, fmt, args))
+            del self.buffer[:size]
+        self.out.flush()
+
+    def raw(self, count):
+        self.out.write(self.buffer[:count].decode('latin-1'))
+        del self.buffer[:count]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('elf', help='ELF file of the firmware')
+    parser.add_argument('capture', nargs='?',
+                        help='captured byte stream, stdin if omitted')
+    parser.add_argument('--serial', help='read from this serial port')
+    parser.add_argument('--baudrate', type=int, default=115200)
+    options = parser.parse_args()
+
+    decoder = Decoder(Image(options.elf), sys.stdout)
+    if options.serial:
+        import serial  # pyserial, only needed for live decoding
+        port = serial.Serial(options.serial, options.baudrate, timeout=0.1)
+        try:
+            while True:
+                decoder.feed(port.read(256))
+        except KeyboardInterrupt:
+            pass
+    else:
+        stream = (open(options.capture, 'rb') if options.capture
+                  else sys.stdin.buffer)
+        with stream:
+            for chunk in iter(lambda: stream.read(4096), b''):
+                decoder.feed(chunk)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,197 @@
+/***************************************************************************//**
+ * @file ad_parser.h
+ * @brief Advertising data parser and filter.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+
+#ifndef AD_PARSER_H_
+#define AD_PARSER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sl_status.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// AD types, see the Generic Access Profile section of the Bluetooth SIG
+// Assigned Numbers
+#define AD_TYPE_FLAGS                 0x01
+#define AD_TYPE_UUID16_INCOMPLETE     0x02
+#define AD_TYPE_UUID16_COMPLETE       0x03
+#define AD_TYPE_UUID128_INCOMPLETE    0x06
+#define AD_TYPE_UUID128_COMPLETE      0x07
+#define AD_TYPE_SHORTENED_LOCAL_NAME  0x08
+#define AD_TYPE_COMPLETE_LOCAL_NAME   0x09
+#define AD_TYPE_MANUFACTURER_DATA     0xFF
+
+// Maximum number of filters in one filter set
+#define AD_FILTER_MAX                 8
+
+/// One AD structure of an advertisement
+typedef struct {
+  uint8_t type;         ///< AD type
+  uint8_t len;          ///< Length of the AD data, without the type byte
+  const uint8_t *data;  ///< AD data, points into the advertisement
+} ad_field_t;
+
+/// Iterator over the AD structures of an advertisement
+typedef struct {
+  const uint8_t *data;
+  uint16_t len;
+  uint16_t pos;
+} ad_iterator_t;
+
+/// Filter types
+typedef enum {
+  AD_FILTER_NAME,           ///< Shortened or complete local name equals value
+  AD_FILTER_NAME_PREFIX,    ///< Shortened or complete local name starts with
+                            ///< value
+  AD_FILTER_UUID16,         ///< 16-bit service UUID in the list, little endian
+  AD_FILTER_UUID128,        ///< 128-bit service UUID in the list, little endian
+  AD_FILTER_MANUFACTURER_ID ///< Company ID of the manufacturer specific data,
+                            ///< little endian
+} ad_filter_type_t;
+
+/// Filter on one AD field
+typedef struct {
+  ad_filter_type_t type;
+  const uint8_t *value;
+  uint8_t len;
+} ad_filter_t;
+
+/// Set of filters, matched against an advertisement in one pass
+typedef struct {
+  const ad_filter_t *filters;
+  uint8_t count;
+  uint32_t type_mask[8];          ///< AD types looked at by any filter
+  uint16_t key[AD_FILTER_MAX];    ///< First two bytes of each filter value
+} ad_filter_set_t;
+
+/***************************************************************************//**
+ * @brief
+ *    Start iterating over the AD structures of an advertisement.
+ *
+ * @param[out] it
+ *    Iterator.
+ * @param[in] data
+ *    Advertising data.
+ * @param[in] len
+ *    Length of the advertising data.
+ ******************************************************************************/
+void ad_iterator_init(ad_iterator_t *it, const uint8_t *data, uint16_t len);
+
+/***************************************************************************//**
+ * @brief
+ *    Get the next AD structure. The field points into the advertising data,
+ *    nothing is copied. Iteration stops at a zero length or truncated AD
+ *    structure.
+ *
+ * @param[in,out] it
+ *    Iterator.
+ * @param[out] field
+ *    Next AD structure.
+ *
+ * @return
+ *    true if a field was returned, false at the end of the advertising data.
+ ******************************************************************************/
+bool ad_iterator_next(ad_iterator_t *it, ad_field_t *field);
+
+/***************************************************************************//**
+ * @brief
+ *    Find the first AD structure of the given type.
+ *
+ * @param[in] data
+ *    Advertising data.
+ * @param[in] len
+ *    Length of the advertising data.
+ * @param[in] type
+ *    AD type to look for.
+ * @param[out] field
+ *    AD structure found.
+ *
+ * @return
+ *    true if found, false otherwise.
+ ******************************************************************************/
+bool ad_find_field(const uint8_t *data,
+                   uint16_t len,
+                   uint8_t type,
+                   ad_field_t *field);
+
+/***************************************************************************//**
+ * @brief
+ *    Prepare a filter set. The filters are not copied and must stay valid
+ *    while the set is in use.
+ *
+ * @param[out] set
+ *    Filter set.
+ * @param[in] filters
+ *    Filters.
+ * @param[in] count
+ *    Number of filters, at most AD_FILTER_MAX.
+ *
+ * @return
+ *    @ref SL_STATUS_OK on success or @ref SL_STATUS_INVALID_PARAMETER if a
+ *    filter value has the wrong length or there are too many filters.
+ ******************************************************************************/
+sl_status_t ad_filter_set_init(ad_filter_set_t *set,
+                               const ad_filter_t *filters,
+                               uint8_t count);
+
+/***************************************************************************//**
+ * @brief
+ *    Match an advertisement against a filter set.
+ *
+ * @param[in] set
+ *    Filter set.
+ * @param[in] data
+ *    Advertising data.
+ * @param[in] len
+ *    Length of the advertising data.
+ * @param[out] field
+ *    AD structure that matched, may be NULL.
+ *
+ * @return
+ *    Index of the filter that matched first, -1 if none matched.
+ ******************************************************************************/
+int ad_filter_set_match(const ad_filter_set_t *set,
+                        const uint8_t *data,
+                        uint16_t len,
+                        ad_field_t *field);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AD_PARSER_H_ */
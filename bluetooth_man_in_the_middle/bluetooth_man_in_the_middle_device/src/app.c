@@ -39,6 +39,7 @@
 #include "app_assert.h"
 #include "app_log.h"
 #include "app.h"
+#include "ad_parser.h"
 
 typedef struct {
   uint8_t  connection;
@@ -63,23 +64,16 @@ static uint8_t thermo_service[2] = { 0x09, 0x18 };
 static uint8_t thermo_character[2] = { 0x1c, 0x2a };
 // Device's name of thermometer server to connect
 uint8_t target_name[] = "Thermometer Example";
+// Thermometer server advertisements are recognized by the name
+static const ad_filter_t scan_filters[] = {
+  { AD_FILTER_NAME, target_name, sizeof(target_name) - 1 },
+};
+static ad_filter_set_t scan_filter_set;
 // flags indicate the discovery for health thermometer service completed
 uint8_t discover_service_done = 0;
 // flags indicate the discovery for health thermometer characteristic completed
 uint8_t discover_characteristic_done = 0;
 
-/**************************************************************************//**
- * Static Functions.
- *****************************************************************************/
-/*
- * @brief: Parse advertising packet which received from scanning process to get
- * the device name. which use for finding the device by target name.
- * @param[in]: @input: the input string is used to parsed.
- * @param[in]: @output: the parsed string.
- * @return: NULL.
- */
-static void parse_adv_packet(uint8_t *input, uint8_t *output);
-
 /**************************************************************************//**
  * Application Init.
  *****************************************************************************/
@@ -89,7 +83,13 @@ void app_init(void)
   // Put your additional application init code here!                         //
   // This is called once during start-up.                                    //
   /////////////////////////////////////////////////////////////////////////////
+  sl_status_t sc;
+
   app_log("\n\nSystem Initialization ---> Power on...");
+  sc = ad_filter_set_init(&scan_filter_set,
+                          scan_filters,
+                          sizeof(scan_filters) / sizeof(scan_filters[0]));
+  app_assert_status(sc);
 }
 
 /**************************************************************************//**
@@ -130,14 +130,16 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     // This event indicates that a scan report is received.
     case sl_bt_evt_scanner_legacy_advertisement_report_id:
     {
-      uint8_t scanned_name[sizeof(target_name)];
-
-      parse_adv_packet(
-        evt->data.evt_scanner_legacy_advertisement_report.data.data,
-        scanned_name);
+      ad_field_t scanned_name;
 
-      if (strcmp((char *)target_name, (char *)scanned_name) == 0) {
-        app_log("%s - device found. Start connecting..!\n", scanned_name);
+      if (ad_filter_set_match(
+            &scan_filter_set,
+            evt->data.evt_scanner_legacy_advertisement_report.data.data,
+            evt->data.evt_scanner_legacy_advertisement_report.data.len,
+            &scanned_name) >= 0) {
+        app_log("%.*s - device found. Start connecting..!\n",
+                scanned_name.len,
+                (const char *)scanned_name.data);
         sl_bt_connection_open(
           evt->data.evt_scanner_legacy_advertisement_report.address,
           evt->data.evt_scanner_legacy_advertisement_report.address_type,
@@ -301,18 +303,3 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       break;
   }
 }
-
-void parse_adv_packet(uint8_t *input, uint8_t *output)
-{
-  uint8_t pos_local_name = 9;
-  uint8_t index = pos_local_name;
-  uint8_t device_name_length = input[pos_local_name - 2] + pos_local_name;
-
-  if (input[pos_local_name - 1] == 0x09) {
-    for (index = pos_local_name; index < device_name_length; index++)
-    {
-      output[index - pos_local_name] = input[index];
-    }
-    output[index - pos_local_name - 1] = '\0';
-  }
-}
@@ -0,0 +1,117 @@
+/***************************************************************************//**
+ * @file midi_packet.h
+ * @brief BLE-MIDI packet builder.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+
+#ifndef MIDI_PACKET_H_
+#define MIDI_PACKET_H_
+
+#include <stdint.h>
+#include "sl_status.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Largest BLE-MIDI packet, ATT_MTU of 247 minus the notification header
+#define MIDI_PACKET_SIZE_MAX    244
+
+// BLE-MIDI timestamps are 13-bit milliseconds
+#define MIDI_TIMESTAMP_MASK     0x1FFF
+
+/// BLE-MIDI packet under construction
+typedef struct {
+  uint8_t data[MIDI_PACKET_SIZE_MAX];
+  uint16_t len;             ///< Bytes used, 0 if the packet is empty
+  uint16_t size;            ///< Bytes available, ATT_MTU - 3
+  uint16_t timestamp;       ///< Timestamp of the last message
+  uint8_t running_status;   ///< Status byte of the last message
+} midi_packet_t;
+
+/***************************************************************************//**
+ * @brief
+ *    Initialize an empty packet.
+ *
+ * @param[out] packet
+ *    Packet.
+ * @param[in] size
+ *    Maximum packet size, truncated to MIDI_PACKET_SIZE_MAX.
+ ******************************************************************************/
+void midi_packet_init(midi_packet_t *packet, uint16_t size);
+
+/***************************************************************************//**
+ * @brief
+ *    Empty the packet, after it has been sent. The size is kept.
+ *
+ * @param[in,out] packet
+ *    Packet.
+ ******************************************************************************/
+void midi_packet_reset(midi_packet_t *packet);
+
+/***************************************************************************//**
+ * @brief
+ *    Append a channel message to the packet.
+ *
+ *    The header byte carries the upper 6 bits of the timestamp of the first
+ *    message, every message is preceded by the lower 7 bits of its own
+ *    timestamp. A message with the same status as the previous one is sent
+ *    without the status byte (running status), and without the timestamp byte
+ *    too if the timestamp did not change either.
+ *
+ * @param[in,out] packet
+ *    Packet.
+ * @param[in] timestamp
+ *    Timestamp of the message in milliseconds, only the lower 13 bits are
+ *    used. Timestamps must not decrease within a packet.
+ * @param[in] msg
+ *    Status byte followed by the data bytes.
+ * @param[in] len
+ *    Length of the message, 2 or 3 bytes.
+ *
+ * @return
+ *    @ref SL_STATUS_OK on success, @ref SL_STATUS_FULL if the message does
+ *    not fit or is too far from the previous message and the packet has to
+ *    be sent first, @ref SL_STATUS_INVALID_PARAMETER if the message is not a
+ *    channel message.
+ ******************************************************************************/
+sl_status_t midi_packet_add(midi_packet_t *packet,
+                            uint16_t timestamp,
+                            const uint8_t *msg,
+                            uint8_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MIDI_PACKET_H_ */
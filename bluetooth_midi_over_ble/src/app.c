@@ -39,6 +39,7 @@
 #include "sl_sleeptimer.h"
 #include "app.h"
 #include "app_assert.h"
+#include "midi_packet.h"
 
 // Notes to MIDI code
 #define    C__4               60
@@ -69,20 +70,15 @@
 #define SIGNAL_BTN_0_PRESSED  0x01
 #define SIGNAL_BTN_0_RELEASED 0x02
 #define SIGNAL_BTN_1_PRESSED  0x04
+#define SIGNAL_MIDI_FLUSH     0x08
 
-PACKSTRUCT(typedef struct
-{
-  uint8_t  header;
-  uint8_t  timestamp;
-  uint8_t  status;
-  uint8_t  note;
-  uint8_t  velocity;
-}) midi_event_packet_t;
-
-typedef union {
-  midi_event_packet_t  midi_event;
-  uint8_t payload[5];
-}midi_data_t;
+#define MIDI_NOTE_ON          0x90
+#define MIDI_NOTE_OFF         0x80
+
+#define ATT_HEADER_SIZE       3
+#define ATT_MTU_DEFAULT       23
+// Connection interval requested in connection_opened, 0x12 * 1.25 ms
+#define CONN_INTERVAL_DEFAULT 0x12
 
 #define MELODY_SIZE 18
 static uint8_t melody[MELODY_SIZE] =
@@ -94,9 +90,20 @@ static uint8_t playhead = 0;
 // The advertising set handle allocated from Bluetooth stack.
 static uint8_t advertising_set_handle = 0xff;
 static uint8_t conn_handle = 0xFF;
+static uint16_t att_mtu = ATT_MTU_DEFAULT;
+// Connection interval in 1.25 ms units
+static uint16_t conn_interval = CONN_INTERVAL_DEFAULT;
+
+// Events queued for the next connection event
+static midi_packet_t midi_packet;
+static sl_sleeptimer_timer_handle_t midi_flush_timer;
 
 static void midi_note_off(uint8_t note, uint8_t velocity);
 static void midi_note_on(uint8_t note, uint8_t velocity);
+static void midi_send(uint8_t status, uint8_t note, uint8_t velocity);
+static void midi_flush(void);
+static void midi_flush_timer_cb(sl_sleeptimer_timer_handle_t *handle,
+                                void *data);
 
 /**************************************************************************//**
  * Application Init.
@@ -164,12 +171,33 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     // This event indicates that a new connection was opened.
     case sl_bt_evt_connection_opened_id:
       conn_handle = evt->data.evt_connection_opened.connection;
+      att_mtu = ATT_MTU_DEFAULT;
+      conn_interval = CONN_INTERVAL_DEFAULT;
+      midi_packet_init(&midi_packet, att_mtu - ATT_HEADER_SIZE);
       // Connection parameter constrains for BLE MIDI
       sl_bt_connection_set_parameters(conn_handle,
                                       0x12, 0x12, 0, 0x64, 0, 0xFFFF);
       break;
 
+    // -------------------------------
+    // Queued events are sent once per connection interval
+    case sl_bt_evt_connection_parameters_id:
+      conn_interval = evt->data.evt_connection_parameters.interval;
+      break;
+
+    // -------------------------------
+    // A larger MTU lets more events share one notification
+    case sl_bt_evt_gatt_mtu_exchanged_id:
+      att_mtu = evt->data.evt_gatt_mtu_exchanged.mtu;
+      midi_flush();
+      midi_packet_init(&midi_packet, att_mtu - ATT_HEADER_SIZE);
+      break;
+
     case sl_bt_evt_system_external_signal_id:
+      if (evt->data.evt_system_external_signal.extsignals
+          & SIGNAL_MIDI_FLUSH) {
+        midi_flush();
+      }
       if (evt->data.evt_system_external_signal.extsignals
           & SIGNAL_BTN_0_PRESSED) {
         midi_note_on(melody[playhead], 100);
@@ -195,7 +223,8 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     // This event indicates that a connection was closed.
     case sl_bt_evt_connection_closed_id:
       conn_handle = 0xFF;
-      midi_note_off(melody[playhead], 100);
+      sl_sleeptimer_stop_timer(&midi_flush_timer);
+      midi_packet_reset(&midi_packet);
       playhead = 0;
       // Restart advertising after client has disconnected.
       sc = sl_bt_legacy_advertiser_start(advertising_set_handle,
@@ -231,50 +260,68 @@ void sl_button_on_change(const sl_button_t *handle)
 
 static void midi_note_on(uint8_t note, uint8_t velocity)
 {
-  static midi_data_t note_on;
-
-  uint32_t tick;
-  uint32_t temp;
-
-  tick = sl_sleeptimer_get_tick_count();
-  temp = sl_sleeptimer_tick_to_ms(tick);
-  // Mask it - only the lower 13 bit needed
-  temp = temp & 0x00001fff;
-  // Header byte = 0b10xxxxxx where xxxxxxx is top 6 bits of timestamp
-  note_on.midi_event.header = 0x80 | (temp >> 7);
-  // Timestamp byte = 0b1xxxxxxx where xxxxxxx is lower 7 bits of timestamp
-  note_on.midi_event.timestamp = 0x80 | (temp & 0x003f);
-  // Status byte = 0b1sssnnnn where sss is message type and nnnn is channel
-  note_on.midi_event.status = 0x90;
-  // Setting the note parameter
-  note_on.midi_event.note = note;
-  // Setting the velocity parameter
-  note_on.midi_event.velocity = velocity;
-
-  // Sending the assembled midi message
-  sl_bt_gatt_server_send_notification(conn_handle, gattdb_xgatt_midi, 5,
-                                      (uint8_t const *) &note_on);
+  midi_send(MIDI_NOTE_ON, note, velocity);
 }
 
 static void midi_note_off(uint8_t note, uint8_t velocity)
 {
-  static midi_data_t note_off;
+  midi_send(MIDI_NOTE_OFF, note, velocity);
+}
+
+static void midi_send(uint8_t status, uint8_t note, uint8_t velocity)
+{
+  sl_status_t sc;
+  bool running;
+  uint16_t timestamp;
+  // Status byte = 0b1sssnnnn where sss is message type and nnnn is channel
+  uint8_t msg[3] = { status, note, velocity };
+
+  if (conn_handle == 0xFF) {
+    return;
+  }
+
+  // Only the lower 13 bit of the millisecond tick is sent
+  timestamp = sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count())
+              & MIDI_TIMESTAMP_MASK;
+
+  // Queue the event, send the pending packet first if it is full
+  sc = midi_packet_add(&midi_packet, timestamp, msg, sizeof(msg));
+  if (sc == SL_STATUS_FULL) {
+    midi_flush();
+    sc = midi_packet_add(&midi_packet, timestamp, msg, sizeof(msg));
+  }
+  app_assert_status(sc);
 
-  uint32_t tick;
-  uint32_t temp;
+  // Everything queued within one connection interval shares a notification
+  sl_sleeptimer_is_timer_running(&midi_flush_timer, &running);
+  if (!running) {
+    sl_sleeptimer_start_timer_ms(&midi_flush_timer,
+                                 (conn_interval * 5) / 4,
+                                 midi_flush_timer_cb,
+                                 NULL,
+                                 0,
+                                 0);
+  }
+}
 
-  tick = sl_sleeptimer_get_tick_count();
-  temp = sl_sleeptimer_tick_to_ms(tick);
+static void midi_flush(void)
+{
+  if ((conn_handle == 0xFF) || (midi_packet.len == 0)) {
+    return;
+  }
 
-  temp = temp & 0x00001fff;
-  temp = temp & 0x00001fff;
+  // Sending the assembled midi packet
+  sl_bt_gatt_server_send_notification(conn_handle, gattdb_xgatt_midi,
+                                      midi_packet.len, midi_packet.data);
+  midi_packet_reset(&midi_packet);
+  sl_sleeptimer_stop_timer(&midi_flush_timer);
+}
 
-  note_off.midi_event.header = 0x80 | (temp >> 7);
-  note_off.midi_event.timestamp = 0x80 | (temp & 0x003f);
-  note_off.midi_event.status = 0x80;
-  note_off.midi_event.note = note;
-  note_off.midi_event.velocity = velocity;
+static void midi_flush_timer_cb(sl_sleeptimer_timer_handle_t *handle,
+                                void *data)
+{
+  (void)handle;
+  (void)data;
 
-  sl_bt_gatt_server_send_notification(conn_handle, gattdb_xgatt_midi, 5,
-                                      (uint8_t const *)&note_off);
+  sl_bt_external_signal(SIGNAL_MIDI_FLUSH);
 }
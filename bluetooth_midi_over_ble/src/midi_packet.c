@@ -0,0 +1,118 @@
+/***************************************************************************//**
+ * @file midi_packet.c
+ * @brief BLE-MIDI packet builder.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+#include <stdbool.h>
+#include <string.h>
+#include "midi_packet.h"
+
+// Header byte: bit 7 set, bit 6 reserved, bits 0-5 timestamp high
+#define MIDI_HEADER(ts)         (0x80 | (((ts) >> 7) & 0x3F))
+// Timestamp byte: bit 7 set, bits 0-6 timestamp low
+#define MIDI_TIMESTAMP(ts)      (0x80 | ((ts) & 0x7F))
+
+// A receiver only notices one wrap of the timestamp low byte between two
+// messages, so consecutive messages must be less than 128 ms apart
+#define MIDI_TIMESTAMP_DELTA_MAX  0x7F
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+void midi_packet_init(midi_packet_t *packet, uint16_t size)
+{
+  if (size > MIDI_PACKET_SIZE_MAX) {
+    size = MIDI_PACKET_SIZE_MAX;
+  }
+  packet->size = size;
+  midi_packet_reset(packet);
+}
+
+void midi_packet_reset(midi_packet_t *packet)
+{
+  packet->len = 0;
+  packet->timestamp = 0;
+  packet->running_status = 0;
+}
+
+sl_status_t midi_packet_add(midi_packet_t *packet,
+                            uint16_t timestamp,
+                            const uint8_t *msg,
+                            uint8_t len)
+{
+  uint16_t delta;
+  uint16_t need;
+  bool same_status;
+
+  // Channel messages only: status 0x80-0xEF, one or two data bytes
+  if ((len < 2) || (len > 3) || (msg[0] < 0x80) || (msg[0] >= 0xF0)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  timestamp &= MIDI_TIMESTAMP_MASK;
+  if (packet->len == 0) {
+    if (packet->size < 2 + len) {
+      return SL_STATUS_INVALID_PARAMETER;
+    }
+    packet->data[packet->len++] = MIDI_HEADER(timestamp);
+    packet->data[packet->len++] = MIDI_TIMESTAMP(timestamp);
+    memcpy(&packet->data[packet->len], msg, len);
+    packet->len += len;
+    packet->timestamp = timestamp;
+    packet->running_status = msg[0];
+    return SL_STATUS_OK;
+  }
+
+  delta = (timestamp - packet->timestamp) & MIDI_TIMESTAMP_MASK;
+  if (delta > MIDI_TIMESTAMP_DELTA_MAX) {
+    return SL_STATUS_FULL;
+  }
+
+  same_status = (msg[0] == packet->running_status);
+  need = len - (same_status ? 1 : 0) + ((delta != 0 || !same_status) ? 1 : 0);
+  if (packet->len + need > packet->size) {
+    return SL_STATUS_FULL;
+  }
+
+  if ((delta != 0) || !same_status) {
+    packet->data[packet->len++] = MIDI_TIMESTAMP(timestamp);
+  }
+  if (!same_status) {
+    packet->data[packet->len++] = msg[0];
+  }
+  memcpy(&packet->data[packet->len], &msg[1], len - 1);
+  packet->len += len - 1;
+  packet->timestamp = timestamp;
+  packet->running_status = msg[0];
+  return SL_STATUS_OK;
+}
@@ -48,12 +48,7 @@ static uint8_t connecting_handle = 0x00;
 static const uint8_t serviceUUID[2] = { 0x09, 0x18 }; // HTM service UUID: 0x1809
 static const uint8_t characteristicUUID[2] = { 0x1c, 0x2A }; // Temperature Measurement characteristics: 0x2A1C
 
-static uint32_t serviceHandle = 0xFFFFFFFF;
-static uint16_t characteristicHandle = 0xFFFF;
 static bool connecting = false;
-static bool enabling_indications = false;
-static bool discovering_service = false;
-static bool discovering_characteristic = false;
 
 // number of active connections <= SL_BT_CONFIG_MAX_CONNECTIONS
 static uint8_t numOfActiveConn = 0;
@@ -63,10 +58,12 @@ static const char string_peripheral[] = "PERIPHERAL";
 
 #define CONNECTION_TIMEOUT 1
 
+// Marks a free entry in the slot table
+#define SLOT_INVALID       0xFF
+
 sl_sleeptimer_timer_handle_t connection_timeout_timer;
 sl_bt_gap_phy_type_t scanning_phy = sl_bt_gap_1m_phy;
 sl_bt_gap_phy_type_t connection_phy = sl_bt_gap_1m_phy;
-uint8_t dev_index;
 
 typedef enum
 {
@@ -76,7 +73,8 @@ typedef enum
   CS_CLOSED
 } conn_state_t;
 
-/*------------CHANGE THE ABOVE ENUM USING THIS ONE-----------------*/
+// GATT discovery state of a connection where the remote device is a
+// thermometer peripheral
 typedef enum {
   scanning,
   opening,
@@ -86,8 +84,6 @@ typedef enum {
   running
 } conn_state;
 
-/*----------------------------------------------------------------*/
-
 typedef enum
 {
   // Connection Roles (CR)
@@ -96,7 +92,8 @@ typedef enum
 } conn_role_t;
 
 /* Struct to store the connecting device address, our device role in the
- * connection, and connection state*/
+ * connection, connection state, and the GATT discovery state of the
+ * connection*/
 typedef struct
 {
   bd_addr address;
@@ -104,8 +101,25 @@ typedef struct
   conn_role_t conn_role;
   conn_state_t conn_state;
   uint8_t conn_handle;
+  conn_state gatt_state;
+  uint32_t service_handle;
+  uint16_t characteristic_handle;
+  uint8_t next_free; // Next free slot, only valid while this slot is free
 } device_info_t;
 
+// Temperature Measurement characteristics the values received from the
+// thermometers are forwarded on, selected by slot index
+static const uint16_t temperature_measurement_chars[] = {
+  gattdb_temperature_measurement_0,
+  gattdb_temperature_measurement_1,
+  gattdb_temperature_measurement_2,
+  gattdb_temperature_measurement_3,
+  gattdb_temperature_measurement_4,
+  gattdb_temperature_measurement_5,
+  gattdb_temperature_measurement_6,
+  gattdb_temperature_measurement_7
+};
+
 /**************************************************************************//**
  *    Callback for the sleeptimer. Since this function is called from interrupt
  *   context,
@@ -133,7 +147,76 @@ const char * get_conn_state(uint8_t state)
   }
 }
 
+/* Slot table of the connections. A slot keeps its index for the whole
+ * lifetime of the connection, free slots are linked in a free list */
 static device_info_t device_list[SL_BT_CONFIG_MAX_CONNECTIONS];
+static uint8_t free_slot_head;
+
+// Slot index of each connection handle, SLOT_INVALID if not in use
+static uint8_t slot_by_handle[256];
+
+static void slot_table_init(void)
+{
+  uint8_t i;
+
+  memset(slot_by_handle, SLOT_INVALID, sizeof(slot_by_handle));
+  for (i = 0; i < SL_BT_CONFIG_MAX_CONNECTIONS; i++) {
+    device_list[i].conn_state = CS_CLOSED;
+    device_list[i].next_free = i + 1;
+  }
+  device_list[SL_BT_CONFIG_MAX_CONNECTIONS - 1].next_free = SLOT_INVALID;
+  free_slot_head = 0;
+  numOfActiveConn = 0;
+}
+
+/* takes a free slot for the connection handle, returns NULL if all slots are
+ *   in use */
+static device_info_t *slot_alloc(uint8_t handle)
+{
+  device_info_t *dev;
+
+  if ((free_slot_head == SLOT_INVALID)
+      || (slot_by_handle[handle] != SLOT_INVALID)) {
+    return NULL;
+  }
+
+  dev = &device_list[free_slot_head];
+  slot_by_handle[handle] = free_slot_head;
+  free_slot_head = dev->next_free;
+
+  dev->conn_handle = handle;
+  dev->conn_state = CS_CONNECTING;
+  dev->gatt_state = opening;
+  dev->service_handle = 0xFFFFFFFF;
+  dev->characteristic_handle = 0xFFFF;
+  numOfActiveConn++;
+  return dev;
+}
+
+/* returns the slot of the connection handle, NULL if there is none */
+static device_info_t *slot_get(uint8_t handle)
+{
+  uint8_t index = slot_by_handle[handle];
+
+  return (index == SLOT_INVALID) ? NULL : &device_list[index];
+}
+
+/* returns the slot of the connection handle to the free list, the other
+ *   slots are not moved */
+static void slot_free(uint8_t handle)
+{
+  uint8_t index = slot_by_handle[handle];
+
+  if (index == SLOT_INVALID) {
+    return;
+  }
+
+  slot_by_handle[handle] = SLOT_INVALID;
+  device_list[index].conn_state = CS_CLOSED;
+  device_list[index].next_free = free_slot_head;
+  free_slot_head = index;
+  numOfActiveConn--;
+}
 
 /* returns true if the remote device address is found in the list of connected
  *   device list */
@@ -141,8 +224,10 @@ bool found_device(bd_addr bd_address)
 {
   int i;
 
-  for (i = 0; i < numOfActiveConn; i++) {
-    if (memcmp(&device_list[i].address, &bd_address, sizeof(bd_addr)) == 0) {
+  for (i = 0; i < SL_BT_CONFIG_MAX_CONNECTIONS; i++) {
+    if ((device_list[i].conn_state != CS_CLOSED)
+        && (memcmp(&device_list[i].address, &bd_address,
+                   sizeof(bd_addr)) == 0)) {
       return true; // Found
     }
   }
@@ -180,18 +265,6 @@ static bool htm_service_found(
   return false;
 }
 
-uint8_t get_dev_index(uint8_t handle)
-{
-  uint8_t index;
-
-  for (index = 0; index < numOfActiveConn; index++) {
-    if (device_list[index].conn_handle == handle) {
-      return index;
-    }
-  }
-  return 0xFF;
-}
-
 /* print bd_addr */
 void print_bd_addr(bd_addr bd_address)
 {
@@ -219,7 +292,10 @@ void sl_app_log_stats(void)
   app_log("==========================================================\r\n");
 
   int i;
-  for (i = 0; i < numOfActiveConn; i++) {
+  for (i = 0; i < SL_BT_CONFIG_MAX_CONNECTIONS; i++) {
+    if (device_list[i].conn_state == CS_CLOSED) {
+      continue;
+    }
     print_bd_addr(device_list[i].address);
     app_log("  %-14s%-14d%-10s\r\n",
             (device_list[i].conn_role == 0) ? string_peripheral : string_central,
@@ -280,10 +356,7 @@ static void get_system_id(void)
  *****************************************************************************/
 void app_init(void)
 {
-  /////////////////////////////////////////////////////////////////////////////
-  // Put your additional application init code here!                         //
-  // This is called once during start-up.                                    //
-  /////////////////////////////////////////////////////////////////////////////
+  slot_table_init();
 }
 
 /**************************************************************************//**
@@ -307,6 +380,7 @@ void app_process_action(void)
 void sl_bt_on_event(sl_bt_msg_t *evt)
 {
   sl_status_t sc;
+  device_info_t *dev;
 
   switch (SL_BT_MSG_ID(evt->header)) {
     // -------------------------------
@@ -363,10 +437,9 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       }
 
       /* Exit if device is in connection process (processing another scan
-       * response),
-       * or service, or characterstics discovery */
-      if (connecting || enabling_indications || discovering_service
-          || discovering_characteristic) {
+       * response). GATT discovery is tracked per connection and does not
+       * block scanning */
+      if (connecting) {
         break;
       }
 
@@ -401,15 +474,12 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       /* Update device list. If connection doesn't succeed (due to timeout) the
        * device will be removed from the list in connection closed event
        * handler*/
-      device_list[numOfActiveConn].address =
-        evt->data.evt_scanner_legacy_advertisement_report.address;
-      device_list[numOfActiveConn].address_type =
+      dev = slot_alloc(connecting_handle);
+      app_assert(dev != NULL, "No free connection slot\n");
+      dev->address = evt->data.evt_scanner_legacy_advertisement_report.address;
+      dev->address_type =
         evt->data.evt_scanner_legacy_advertisement_report.address_type;
-      device_list[numOfActiveConn].conn_handle = connecting_handle;
-      device_list[numOfActiveConn].conn_role = CR_PERIPHERAL; // connection role
-                                                              // of the remote
-                                                              // device
-      device_list[numOfActiveConn].conn_state = CS_CONNECTING;
+      dev->conn_role = CR_PERIPHERAL; // connection role of the remote device
 
       /* Set connection timeout timer */
       sc = sl_sleeptimer_start_timer(&connection_timeout_timer,
@@ -419,9 +489,6 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
                                      0,
                                      0);
       app_assert_status(sc);
-
-      /* Increment numOfActiveConn */
-      numOfActiveConn++;
       break;
 
     case sl_bt_evt_system_external_signal_id:
@@ -432,9 +499,10 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
         app_log("Connection timeout!\r\n");
         app_log("Cancel connection with device :");
 
-        uint8_t dev_index;
-        dev_index = get_dev_index(connecting_handle);
-        print_bd_addr(device_list[dev_index].address);
+        dev = slot_get(connecting_handle);
+        if (dev != NULL) {
+          print_bd_addr(dev->address);
+        }
         app_log("\r\n");
         app_log("Handle .......: #%d\r\n", connecting_handle);
 
@@ -464,7 +532,10 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
           serviceUUID);
         app_assert_status(sc);
 
-        discovering_service = true;
+        dev = slot_get(evt->data.evt_connection_opened.connection);
+        if (dev != NULL) {
+          dev->gatt_state = discover_services;
+        }
 
         /* connection process completed. */
         connecting = false;
@@ -473,21 +544,13 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       /* else if connection role is PERIPHERAL ...*/
       else if (evt->data.evt_connection_opened.role == CR_PERIPHERAL) {
         /* update device list */
-        device_list[numOfActiveConn].address =
-          evt->data.evt_connection_opened.address;
-        device_list[numOfActiveConn].address_type =
-          evt->data.evt_connection_opened.address_type;
-        device_list[numOfActiveConn].conn_handle =
-          evt->data.evt_connection_opened.connection;
-        device_list[numOfActiveConn].conn_role = CR_CENTRAL; // connection role of the remote device
-
-        /* Increment numOfActiveConn. */
-        numOfActiveConn++;
+        dev = slot_alloc(evt->data.evt_connection_opened.connection);
+        app_assert(dev != NULL, "No free connection slot\n");
+        dev->address = evt->data.evt_connection_opened.address;
+        dev->address_type = evt->data.evt_connection_opened.address_type;
+        dev->conn_role = CR_CENTRAL; // connection role of the remote device
       }
 
-      // Update device connection state. common for both master and slave roles
-      device_list[numOfActiveConn - 1].conn_state = CS_CONNECTING;
-
       /* Advertising stops when connection is opened. Re-start advertising */
       if (numOfActiveConn == SL_BT_CONFIG_MAX_CONNECTIONS) {
         app_log("Maximum number of allowed connections reached.\r\n");
@@ -509,18 +572,22 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
 
     // This event ensures connection has been established.
     case sl_bt_evt_connection_parameters_id:
-      dev_index = get_dev_index(evt->data.evt_connection_parameters.connection);
-      device_list[dev_index].conn_state = CS_CONNECTED;
+      dev = slot_get(evt->data.evt_connection_parameters.connection);
+      // Only the first parameters event of a connection is reported
+      if ((dev == NULL) || (dev->conn_state == CS_CONNECTED)) {
+        break;
+      }
+      dev->conn_state = CS_CONNECTED;
 
       app_log("\r\nNEW CONNECTION ESTABLISHED \r\n");
       app_log("Device ID .................: ");
-      print_bd_addr(device_list[numOfActiveConn - 1].address);
+      print_bd_addr(dev->address);
       app_log("\r\n");
       app_log("Role ......................: %s\r\n",
-              (device_list[dev_index].conn_role
+              (dev->conn_role
                == CR_PERIPHERAL) ? string_peripheral : string_central);
       app_log("Handle ....................: %d\r\n",
-              device_list[dev_index].conn_handle);
+              dev->conn_handle);
       app_log("Number of connected devices: %d\r\n", numOfActiveConn);
       app_log("Available connections .....: %d\r\n",
               SL_BT_CONFIG_MAX_CONNECTIONS - numOfActiveConn);
@@ -531,44 +598,52 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
 
     case sl_bt_evt_gatt_service_id:
       /* save the service handle for the Health Thermometer service */
-      serviceHandle = evt->data.evt_gatt_service.service;
+      dev = slot_get(evt->data.evt_gatt_service.connection);
+      if (dev != NULL) {
+        dev->service_handle = evt->data.evt_gatt_service.service;
+      }
       break;
 
     case sl_bt_evt_gatt_characteristic_id:
       /* save the characteristic handle for the Temperature Measurement
        *   characteristic */
-      characteristicHandle = evt->data.evt_gatt_characteristic.characteristic;
+      dev = slot_get(evt->data.evt_gatt_characteristic.connection);
+      if (dev != NULL) {
+        dev->characteristic_handle =
+          evt->data.evt_gatt_characteristic.characteristic;
+      }
       break;
 
     case sl_bt_evt_gatt_procedure_completed_id:
-      /* if service discovery completed */
-      if (discovering_service) {
-        discovering_service = false;
+      dev = slot_get(evt->data.evt_gatt_procedure_completed.connection);
+      if (dev == NULL) {
+        break;
+      }
 
+      /* if service discovery completed */
+      if (dev->gatt_state == discover_services) {
         /* discover Temperature Measurement characteristic */
         app_log("success\r\n");
         sc = sl_bt_gatt_discover_characteristics_by_uuid(
           evt->data.evt_gatt_procedure_completed.connection,
-          serviceHandle,
+          dev->service_handle,
           sizeof(characteristicUUID),
           characteristicUUID);
         app_assert_status(sc);
-        discovering_characteristic = true;
+        dev->gatt_state = discover_characteristics;
       }
 
       /* if characteristic discovery completed */
-      else if (discovering_characteristic) {
-        discovering_characteristic = false;
-
+      else if (dev->gatt_state == discover_characteristics) {
         /* enable indications on the Temperature Measurement characteristic */
         sc = sl_bt_gatt_set_characteristic_notification(
           evt->data.evt_gatt_procedure_completed.connection,
-          characteristicHandle,
+          dev->characteristic_handle,
           sl_bt_gatt_indication);
         app_assert_status(sc);
-        enabling_indications = true;
-      } else if (enabling_indications) {
-        enabling_indications = 0;
+        dev->gatt_state = enable_indication;
+      } else if (dev->gatt_state == enable_indication) {
+        dev->gatt_state = running;
       }
       break;
 
@@ -577,36 +652,18 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       if (evt->data.evt_gatt_characteristic_value.att_opcode
           == sl_bt_gatt_handle_value_indication) {
         uint16_t temp_measurement_char;
-
-        switch ((evt->data.evt_gatt_characteristic_value.connection - 1) % 8) {
-          case 0:
-            temp_measurement_char = gattdb_temperature_measurement_0;
-            break;
-          case 1:
-            temp_measurement_char = gattdb_temperature_measurement_1;
-            break;
-          case 2:
-            temp_measurement_char = gattdb_temperature_measurement_2;
-            break;
-          case 3:
-            temp_measurement_char = gattdb_temperature_measurement_3;
-            break;
-          case 4:
-            temp_measurement_char = gattdb_temperature_measurement_4;
-            break;
-          case 5:
-            temp_measurement_char = gattdb_temperature_measurement_5;
-            break;
-          case 6:
-            temp_measurement_char = gattdb_temperature_measurement_6;
-            break;
-          case 7:
-            temp_measurement_char = gattdb_temperature_measurement_7;
-            break;
-          default:
-            temp_measurement_char = gattdb_temperature_measurement_0;
-            break;
+        uint8_t index;
+
+        /* the slot index of a thermometer is stable for the whole connection,
+         * so it keeps its characteristic while others connect and leave */
+        index = slot_by_handle[evt->data.evt_gatt_characteristic_value.
+                               connection];
+        if (index == SLOT_INVALID) {
+          index = 0;
         }
+        temp_measurement_char = temperature_measurement_chars[
+          index % (sizeof(temperature_measurement_chars)
+                   / sizeof(temperature_measurement_chars[0]))];
 
         /* Acknowledge indication */
         sc = sl_bt_gatt_send_characteristic_confirmation(
@@ -627,20 +684,22 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       app_log("\r\nCONNECTION CLOSED \r\n");
       // handle of the closed connection
       uint8_t closed_handle = evt->data.evt_connection_closed.connection;
-      dev_index = get_dev_index(closed_handle);
+      dev = slot_get(closed_handle);
       app_log("Device ");
-      print_bd_addr(device_list[dev_index].address);
+      if (dev != NULL) {
+        print_bd_addr(dev->address);
+      }
       app_log(" left the connection::0x%04X\r\n",
               evt->data.evt_connection_closed.reason);
 
-      uint8_t i;
-      for (i = dev_index; i < numOfActiveConn - 1; i++) {
-        device_list[i] = device_list[i + 1];
+      /* a connection attempt that failed before it was opened also ends the
+       * connection process */
+      if (connecting && (closed_handle == connecting_handle)) {
+        sl_sleeptimer_stop_timer(&connection_timeout_timer);
+        connecting = false;
       }
 
-      if (numOfActiveConn > 0) {
-        numOfActiveConn--;
-      }
+      slot_free(closed_handle);
 
       // print list of remaining connections
       sl_app_log_stats();
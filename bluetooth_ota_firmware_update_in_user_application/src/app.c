@@ -39,6 +39,8 @@
  * Silicon Labs may update projects from time to time.
  ******************************************************************************/
 #include <stdbool.h>
+#include <string.h>
+#include "em_device.h"
 #include "sl_common.h"
 #include "app_log.h"
 #include "app_assert.h"
@@ -57,9 +59,25 @@
 #include "btl_interface.h"
 #include "btl_interface_storage.h"
 
-// OTA DFU block size
+// OTA control commands
 #define OTA_FIRMWARE_START        0x00
 #define OTA_FIRMWARE_END          0x03
+// OTA control notification acknowledging the bytes written to the slot
+#define OTA_FIRMWARE_ACK          0x04
+
+// Incoming data is gathered and written to the slot in aligned chunks of
+// this size, an acknowledgement is notified after each chunk.
+#define OTA_WRITE_BUFFER_SIZE     2048
+
+#define PROGRESS_PERIOD_MS        200
+
+// Download area pages are erased just ahead of the write position,
+// this limits the number of pages that can be tracked.
+#define SLOT_MAX_PAGES            1024
+#define SLOT_READ_BLOCK_SIZE      256
+
+// ATT application error returned when no download area is available
+#define OTA_ATT_ERROR_NO_SLOT     0x80
 
 static sl_sleeptimer_timer_handle_t sleeptimer_handle_t;
 
@@ -77,14 +95,38 @@ static uint32_t ota_image_position = 0;
 static uint8_t ota_in_progress = 0;
 static uint8_t ota_image_finished = 0;
 static uint16_t ota_time_elapsed = 0;
+static uint32_t ota_write_buffer[OTA_WRITE_BUFFER_SIZE / sizeof(uint32_t)];
+static uint32_t ota_write_buffer_len = 0;
+static uint32_t ota_flash_position = 0;
+static uint32_t ota_crc = 0;
+static int32_t ota_write_error = BOOTLOADER_OK;
+static bool ota_ack_enabled = false;
+// An acknowledgement the stack had no buffer for, sent again until accepted
+static bool ota_ack_pending = false;
+static uint32_t ota_start_tick = 0;
+static bool ota_first_write_done = false;
+
+/* Download area pages known to be blank, one bit per page */
+static uint8_t slot_blank_pages[SLOT_MAX_PAGES / 8];
+static uint32_t slot_page_size = 0;
+static uint32_t slot_num_pages = 0;
 
 /**************************************************************************//**
  * Static function declaration
  *****************************************************************************/
 static int32_t get_slot_info(void);
-static void erase_slot_if_needed(void);
+static void slot_pages_init(void);
+static int32_t slot_prepare_range(uint32_t offset, uint32_t len);
+static int32_t slot_prepare_page(uint32_t page);
+static uint32_t ota_elapsed_ms(void);
 static void print_progress(void);
 static int32_t verify_application(void);
+static void ota_start(void);
+static void ota_receive(const uint8_t *data, uint32_t len);
+static void ota_flush(void);
+static void ota_send_ack(void);
+static int32_t ota_finish(const uint8_t *data, uint8_t len);
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, uint32_t len);
 static void sleeptimer_callback(sl_sleeptimer_timer_handle_t *handle,
                                 void *data);
 
@@ -97,7 +139,7 @@ void app_init(void)
 
   app_log("...........................................\r\n");
   sc = sl_sleeptimer_start_periodic_timer_ms(&sleeptimer_handle_t,
-                                             200,
+                                             PROGRESS_PERIOD_MS,
                                              sleeptimer_callback,
                                              (void *)NULL,
                                              1,
@@ -119,6 +161,9 @@ void app_process_action(void)
   // This is called infinitely.                                              //
   // Do not call blocking functions from here!                               //
   /////////////////////////////////////////////////////////////////////////////
+  if (ota_ack_pending) {
+    ota_send_ack();
+  }
 }
 
 /**************************************************************************//**
@@ -133,6 +178,7 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
   bd_addr address;
   uint8_t address_type;
   int32_t err = BOOTLOADER_OK;
+  uint8_t att_errorcode = 0;
 
   switch (SL_BT_MSG_ID(evt->header)) {
     // -------------------------------
@@ -174,14 +220,17 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       app_assert_status(sc);
       app_log("Boot event - started advertising\r\n");
 
+      // Large packets let a data write fill a whole connection event
+      sc = sl_bt_gatt_server_set_max_mtu(247, NULL);
+      app_assert_status(sc);
+
       // bootloader init must be called before calling other bootloader_xxx API
       bootloader_init();
 
       // read slot information from bootloader
       if (get_slot_info() == BOOTLOADER_OK) {
-        // the download area is erased here (if needed), prior to any
-        //   connections are opened
-        erase_slot_if_needed();
+        // the download area is erased page by page during the upload
+        slot_pages_init();
       } else {
         app_log(
           "Check that you have installed correct type of Gecko bootloader!\r\n");
@@ -199,6 +248,8 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     case sl_bt_evt_connection_closed_id:
       app_log("Connection closed, reason: 0x%2.2x\r\n",
               evt->data.evt_connection_closed.reason);
+      ota_ack_enabled = false;
+      ota_ack_pending = false;
 
       if (ota_image_finished) {
         app_log("Installing new image\r\n");
@@ -225,21 +276,24 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       connection = evt->data.evt_gatt_server_user_write_request.connection;
       characteristic =
         evt->data.evt_gatt_server_user_write_request.characteristic;
-      if (characteristic == gattdb_ota_control) {
+      if ((slot_num_pages == 0)
+          && ((characteristic == gattdb_ota_control)
+              || (characteristic == gattdb_ota_data))) {
+        // The download area is unknown, nothing can be written to it
+        att_errorcode = OTA_ATT_ERROR_NO_SLOT;
+      } else if (characteristic == gattdb_ota_control) {
         switch (evt->data.evt_gatt_server_user_write_request.value.data[0]) {
           case OTA_FIRMWARE_START:// Erase and use slot 0
-            ota_image_position = 0;
-            ota_in_progress = 1;
+            ota_start();
             break;
 
           case OTA_FIRMWARE_END:// END OTA process
             // wait for connection close and then reboot
-            ota_in_progress = 0;
-            ota_image_finished = 1;
-            app_log("upload finished. received file size %lu bytes\r\n",
-                    ota_image_position);
-            err = verify_application();
+            err = ota_finish(
+              evt->data.evt_gatt_server_user_write_request.value.data,
+              evt->data.evt_gatt_server_user_write_request.value.len);
             if (err == 0) {
+              ota_image_finished = 1;
               sl_bt_connection_close(connection);
             }
             break;
@@ -249,17 +303,30 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
         }
       } else if (characteristic == gattdb_ota_data) {
         if (ota_in_progress) {
-          bootloader_writeStorage(
-            0, // use slot 0
-            ota_image_position,
-            evt->data.evt_gatt_server_user_write_request.value.data,
-            evt->data.evt_gatt_server_user_write_request.value.len);
-          ota_image_position +=
-            evt->data.evt_gatt_server_user_write_request.value.len;
+          ota_receive(evt->data.evt_gatt_server_user_write_request.value.data,
+                      evt->data.evt_gatt_server_user_write_request.value.len);
         }
       }
-      sl_bt_gatt_server_send_user_write_response(connection, characteristic, 0);
+      // Data is streamed with write without response, which has no response
+      if (evt->data.evt_gatt_server_user_write_request.att_opcode
+          == sl_bt_gatt_write_request) {
+        sl_bt_gatt_server_send_user_write_response(connection,
+                                                   characteristic,
+                                                   att_errorcode);
+      }
+      break;
+
+    case sl_bt_evt_gatt_server_characteristic_status_id:
+      if ((evt->data.evt_gatt_server_characteristic_status.characteristic
+           == gattdb_ota_control)
+          && (evt->data.evt_gatt_server_characteristic_status.status_flags
+              == sl_bt_gatt_server_client_config)) {
+        ota_ack_enabled =
+          (evt->data.evt_gatt_server_characteristic_status.client_config_flags
+           & sl_bt_gatt_notification) != 0;
+      }
       break;
+
     // -------------------------------
     // Default event handler.
     default:
@@ -292,50 +359,254 @@ static int32_t get_slot_info(void)
   return(err);
 }
 
-static void erase_slot_if_needed(void)
+static void slot_pages_init(void)
+{
+  BootloaderStorageInformation_t storage_info;
+
+  bootloader_getStorageInfo(&storage_info);
+  if ((storage_info.info != NULL) && (storage_info.info->pageSize != 0)) {
+    slot_page_size = storage_info.info->pageSize;
+  } else {
+    slot_page_size = FLASH_PAGE_SIZE;
+  }
+  slot_num_pages = (slotInfo.length + slot_page_size - 1) / slot_page_size;
+  memset(slot_blank_pages, 0, sizeof(slot_blank_pages));
+  if (slot_num_pages == 0) {
+    app_log("download area is empty, OTA disabled\r\n");
+    return;
+  }
+  app_log("download area: %lu pages of %lu bytes\r\n",
+          slot_num_pages,
+          slot_page_size);
+}
+
+/* Make sure that the pages of the range, and the one after it, are blank */
+static int32_t slot_prepare_range(uint32_t offset, uint32_t len)
+{
+  uint32_t page;
+  uint32_t last_page;
+  int32_t err = BOOTLOADER_OK;
+
+  if ((slot_page_size == 0) || (slot_num_pages == 0)) {
+    return BOOTLOADER_ERROR_STORAGE_INVALID_SLOT;
+  }
+  if (len == 0) {
+    return BOOTLOADER_OK;
+  }
+  page = offset / slot_page_size;
+  last_page = (offset + len - 1) / slot_page_size + 1;
+  if (last_page >= slot_num_pages) {
+    last_page = slot_num_pages - 1;
+  }
+  for (; (page <= last_page) && (err == BOOTLOADER_OK); page++) {
+    err = slot_prepare_page(page);
+  }
+  return err;
+}
+
+static int32_t slot_prepare_page(uint32_t page)
 {
-  uint32_t offset = 0, num_blocks = 0, i = 0;
-  uint8_t buffer[256];
+  uint32_t offset = page * slot_page_size;
+  uint32_t end = offset + slot_page_size;
+  uint8_t buffer[SLOT_READ_BLOCK_SIZE];
   bool dirty = false;
   int32_t err = BOOTLOADER_OK;
+  uint32_t i;
 
-  /* check the download area content by reading it in 256-byte blocks */
-  num_blocks = slotInfo.length / 256;
-
-  while ((dirty == 0) && (offset < 256 * num_blocks) && (err == BOOTLOADER_OK))
-  {
-    err = bootloader_readStorage(0, offset, buffer, 256);
-    if (err == BOOTLOADER_OK) {
-      i = 0;
-      while (i < 256)
-      {
-        if (buffer[i++] != 0xFF) {
-          dirty = true;
-          break;
-        }
+  if (slot_blank_pages[page / 8] & (1 << (page % 8))) {
+    return BOOTLOADER_OK;
+  }
+  // Reading is much faster than erasing, erase only if needed
+  while (!dirty && (offset < end) && (err == BOOTLOADER_OK)) {
+    err = bootloader_readStorage(0, offset, buffer, SLOT_READ_BLOCK_SIZE);
+    if (err != BOOTLOADER_OK) {
+      break;
+    }
+    for (i = 0; i < SLOT_READ_BLOCK_SIZE; i++) {
+      if (buffer[i] != 0xFF) {
+        dirty = true;
+        break;
       }
-      offset += 256;
     }
-    app_log(".");
+    offset += SLOT_READ_BLOCK_SIZE;
+  }
+  if ((err == BOOTLOADER_OK) && dirty) {
+    err = bootloader_eraseRawStorage(slotInfo.address + page * slot_page_size,
+                                     slot_page_size);
+  }
+  if (err == BOOTLOADER_OK) {
+    slot_blank_pages[page / 8] |= 1 << (page % 8);
+  } else {
+    app_log("error preparing page %lu! %lx\r\n", page, err);
   }
+  return err;
+}
 
-  if (err != BOOTLOADER_OK) {
-    app_log("error reading flash! %lx\r\n", err);
-  } else if (dirty) {
-    app_log("download area is not empty, erasing...\r\n");
-    bootloader_eraseStorageSlot(0);
-    app_log("done\r\n");
+static uint32_t ota_elapsed_ms(void)
+{
+  return sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count()
+                                  - ota_start_tick);
+}
+
+static void ota_start(void)
+{
+  ota_image_position = 0;
+  ota_flash_position = 0;
+  ota_write_buffer_len = 0;
+  ota_crc = 0;
+  ota_write_error = BOOTLOADER_OK;
+  ota_time_elapsed = 0;
+  ota_start_tick = sl_sleeptimer_get_tick_count();
+  ota_first_write_done = false;
+  if (slot_num_pages > SLOT_MAX_PAGES) {
+    // Too many pages to track, erase the whole download area
+    ota_write_error = bootloader_eraseStorageSlot(0);
   } else {
-    app_log("download area is empty\r\n");
+    // Pages written by the previous upload are no longer blank
+    memset(slot_blank_pages, 0, sizeof(slot_blank_pages));
+  }
+  ota_in_progress = 1;
+}
+
+static void ota_receive(const uint8_t *data, uint32_t len)
+{
+  uint8_t *buffer = (uint8_t *)ota_write_buffer;
+  uint32_t chunk;
+
+  ota_crc = crc32_update(ota_crc, data, len);
+  ota_image_position += len;
+
+  while (len > 0) {
+    chunk = OTA_WRITE_BUFFER_SIZE - ota_write_buffer_len;
+    if (chunk > len) {
+      chunk = len;
+    }
+    memcpy(&buffer[ota_write_buffer_len], data, chunk);
+    ota_write_buffer_len += chunk;
+    data += chunk;
+    len -= chunk;
+    if (ota_write_buffer_len == OTA_WRITE_BUFFER_SIZE) {
+      ota_flush();
+    }
+  }
+}
+
+static void ota_flush(void)
+{
+  int32_t err;
+
+  if (ota_write_buffer_len == 0) {
+    return;
+  }
+  if (slot_num_pages <= SLOT_MAX_PAGES) {
+    err = slot_prepare_range(ota_flash_position, ota_write_buffer_len);
+  } else {
+    err = BOOTLOADER_OK;
+  }
+  if (err == BOOTLOADER_OK) {
+    err = bootloader_writeStorage(0, // use slot 0
+                                  ota_flash_position,
+                                  (uint8_t *)ota_write_buffer,
+                                  ota_write_buffer_len);
+  }
+  if (!ota_first_write_done) {
+    ota_first_write_done = true;
+    app_log("first chunk written %lu ms after start\r\n", ota_elapsed_ms());
   }
+  if ((err != BOOTLOADER_OK) && (ota_write_error == BOOTLOADER_OK)) {
+    app_log("error writing flash! %lx\r\n", err);
+    ota_write_error = err;
+  }
+  ota_flash_position += ota_write_buffer_len;
+  ota_write_buffer_len = 0;
+
+  ota_ack_pending = true;
+  ota_send_ack();
+}
+
+/* Let the client know how much data can be sent ahead */
+static void ota_send_ack(void)
+{
+  sl_status_t sc;
+  uint8_t ack[5];
+
+  if (!ota_ack_enabled) {
+    ota_ack_pending = false;
+    return;
+  }
+  // The position is read when sending, a late ack carries the latest one
+  ack[0] = OTA_FIRMWARE_ACK;
+  ack[1] = (uint8_t)ota_flash_position;
+  ack[2] = (uint8_t)(ota_flash_position >> 8);
+  ack[3] = (uint8_t)(ota_flash_position >> 16);
+  ack[4] = (uint8_t)(ota_flash_position >> 24);
+  sc = sl_bt_gatt_server_send_notification(connection,
+                                           gattdb_ota_control,
+                                           sizeof(ack),
+                                           ack);
+  if (sc == SL_STATUS_NO_MORE_RESOURCE) {
+    // Out of buffers, try again from app_process_action()
+    return;
+  }
+  if (sc != SL_STATUS_OK) {
+    app_log("error sending ack! %lx\r\n", sc);
+  }
+  ota_ack_pending = false;
+}
 
-  return;
+static int32_t ota_finish(const uint8_t *data, uint8_t len)
+{
+  uint32_t expected_crc;
+
+  ota_flush();
+  ota_in_progress = 0;
+  app_log("upload finished. received file size %lu bytes, crc32 0x%08lx\r\n",
+          ota_image_position,
+          ota_crc);
+  app_log("upload time %lu ms, download area %lu bytes\r\n",
+          ota_elapsed_ms(),
+          slotInfo.length);
+  if (ota_write_error != BOOTLOADER_OK) {
+    return ota_write_error;
+  }
+  // The client can append the CRC-32 of the image to the END command
+  if (len >= 5) {
+    expected_crc = data[1]
+                   | ((uint32_t)data[2] << 8)
+                   | ((uint32_t)data[3] << 16)
+                   | ((uint32_t)data[4] << 24);
+    if (expected_crc != ota_crc) {
+      app_log("crc32 mismatch, expected 0x%08lx\r\n", expected_crc);
+      return BOOTLOADER_ERROR_STORAGE_BOOTLOAD;
+    }
+  }
+  return verify_application();
+}
+
+// CRC-32 (IEEE 802.3), nibble table to keep the flash footprint small
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+  static const uint32_t crc32_table[16] = {
+    0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac,
+    0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+    0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+    0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+  };
+
+  crc = ~crc;
+  while (len--) {
+    crc ^= *data++;
+    crc = (crc >> 4) ^ crc32_table[crc & 0x0f];
+    crc = (crc >> 4) ^ crc32_table[crc & 0x0f];
+  }
+  return ~crc;
 }
 
 static void print_progress(void)
 {
   // estimate transfer speed in kbps
-  int kbps = ota_image_position * 8 / (1024 * ota_time_elapsed);
+  uint32_t elapsed_ms = ota_time_elapsed * PROGRESS_PERIOD_MS;
+  int kbps = ota_image_position * 1000 / (128 * elapsed_ms);
 
   app_log("pos: %lu, time: %u, kbps: %u\r\n",
           ota_image_position,
@@ -0,0 +1,192 @@
+/***************************************************************************//**
+ * @file pawr_payload.h
+ * @brief Subevent payload and response codec of the PAwR thermometer.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+
+#ifndef PAWR_PAYLOAD_H_
+#define PAWR_PAYLOAD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sl_status.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Subevent payload:
+// byte 0:      group id (subevent or 0xFF to broadcast)
+// byte 1:      command mask for every device of the group
+// byte 2 + 2n: device id of record n, records sorted by device id
+// byte 3 + 2n: command mask for that device
+// A device runs the commands of the group mask and of its own record.
+#define PAWR_PAYLOAD_HEADER_SIZE        2
+#define PAWR_PAYLOAD_RECORD_SIZE        2
+#define PAWR_PAYLOAD_SIZE(records)      (PAWR_PAYLOAD_HEADER_SIZE \
+                                         + (records) * PAWR_PAYLOAD_RECORD_SIZE)
+#define PAWR_ADDRESS_BROADCAST          0xFF
+
+// Ping opcode
+#define PAWR_PING_OPCODE                0x00
+// Read data sensor opcode
+#define PAWR_READ_DATA_SENSOR_OPCODE    0x01
+// Control LED opcode
+#define PAWR_CONTROL_LED_OPCODE         0x02
+// Bit of an opcode in a command mask
+#define PAWR_COMMAND(opcode)            ((uint8_t)(1u << (opcode)))
+
+// Response: status byte followed by the temperature in degrees Celsius
+#define PAWR_RESPONSE_SIZE              2
+#define PAWR_STATUS_LED_ON              0x01  ///< LED is on
+#define PAWR_STATUS_LED_TOGGLED         0x02  ///< LED toggled in this subevent
+#define PAWR_STATUS_TEMP_VALID          0x04  ///< Temperature is valid
+
+/// Subevent payload under construction
+typedef struct {
+  uint8_t *data;
+  uint8_t size;
+  uint8_t len;
+  uint8_t last_device_id;
+} pawr_payload_writer_t;
+
+/***************************************************************************//**
+ * @brief
+ *    Start a subevent payload.
+ *
+ * @param[out] writer
+ *    Payload writer.
+ * @param[out] data
+ *    Payload buffer.
+ * @param[in] size
+ *    Size of the payload buffer.
+ * @param[in] group_id
+ *    Group ID or @ref PAWR_ADDRESS_BROADCAST.
+ * @param[in] group_commands
+ *    Command mask for every device of the group.
+ *
+ * @return
+ *    @ref SL_STATUS_OK or @ref SL_STATUS_WOULD_OVERFLOW if the buffer is too
+ *    small for the header.
+ ******************************************************************************/
+sl_status_t pawr_payload_begin(pawr_payload_writer_t *writer,
+                               uint8_t *data,
+                               uint8_t size,
+                               uint8_t group_id,
+                               uint8_t group_commands);
+
+/***************************************************************************//**
+ * @brief
+ *    Add the record of a device. Records have to be added in increasing
+ *    device ID order.
+ *
+ * @param[in,out] writer
+ *    Payload writer.
+ * @param[in] device_id
+ *    Device ID, 1-254.
+ * @param[in] commands
+ *    Command mask for the device.
+ *
+ * @return
+ *    @ref SL_STATUS_OK, @ref SL_STATUS_INVALID_PARAMETER if the device ID is
+ *    out of order or @ref SL_STATUS_WOULD_OVERFLOW if the payload is full.
+ ******************************************************************************/
+sl_status_t pawr_payload_add(pawr_payload_writer_t *writer,
+                             uint8_t device_id,
+                             uint8_t commands);
+
+/***************************************************************************//**
+ * @brief
+ *    Get the commands of a device from a subevent payload. The record of the
+ *    device is found with a binary search.
+ *
+ * @param[in] data
+ *    Subevent payload.
+ * @param[in] len
+ *    Length of the subevent payload.
+ * @param[in] group_id
+ *    Group ID of the device.
+ * @param[in] device_id
+ *    Device ID of the device.
+ * @param[out] commands
+ *    Command mask for the device. Group and device LED commands cancel out,
+ *    as both toggle the LED.
+ *
+ * @return
+ *    true if the payload is well formed and addressed to the group.
+ ******************************************************************************/
+bool pawr_payload_find(const uint8_t *data,
+                       uint8_t len,
+                       uint8_t group_id,
+                       uint8_t device_id,
+                       uint8_t *commands);
+
+/***************************************************************************//**
+ * @brief
+ *    Encode a response.
+ *
+ * @param[out] data
+ *    Response buffer, @ref PAWR_RESPONSE_SIZE bytes.
+ * @param[in] status
+ *    Status flags.
+ * @param[in] temp
+ *    Temperature in degrees Celsius.
+ ******************************************************************************/
+void pawr_response_encode(uint8_t *data, uint8_t status, int8_t temp);
+
+/***************************************************************************//**
+ * @brief
+ *    Decode a response.
+ *
+ * @param[in] data
+ *    Response data.
+ * @param[in] len
+ *    Length of the response data.
+ * @param[out] status
+ *    Status flags.
+ * @param[out] temp
+ *    Temperature in degrees Celsius.
+ *
+ * @return
+ *    true if the response has the expected length.
+ ******************************************************************************/
+bool pawr_response_decode(const uint8_t *data,
+                          uint8_t len,
+                          uint8_t *status,
+                          int8_t *temp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PAWR_PAYLOAD_H_ */
@@ -0,0 +1,247 @@
+/***************************************************************************//**
+ * @file pawr_scheduler.h
+ * @brief Subevent and response slot scheduler for PAwR observers.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+
+#ifndef PAWR_SCHEDULER_H_
+#define PAWR_SCHEDULER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sl_status.h"
+#include "pawr_payload.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Number of subevents in the PAwR train. Every subevent serves one group.
+#define PAWR_SUBEVENT_COUNT             16
+// Number of response slots in a subevent. Every slot serves one device of the
+// group, device ID n answers in slot n - 1.
+#define PAWR_RESPONSE_SLOT_COUNT        50
+// Number of observers the broadcaster can serve
+#define PAWR_OBSERVERS_MAX              (PAWR_SUBEVENT_COUNT \
+                                         * PAWR_RESPONSE_SLOT_COUNT)
+#define PAWR_OBSERVER_INDEX_INVALID     ((uint16_t)0xFFFFu)
+
+// Largest subevent payload: a record for every device of the group
+#define PAWR_SUBEVENT_DATA_MAX          PAWR_PAYLOAD_SIZE( \
+    PAWR_RESPONSE_SLOT_COUNT)
+
+// Polls an observer may miss in a row before its slot is released
+#define PAWR_OBSERVER_MISSED_MAX        10
+// Polls a released slot stays quarantined before it is given to a new
+// observer. Has to outlast the sync timeout of the observers (10 s), so the
+// old observer has dropped the slot by then.
+#define PAWR_OBSERVER_QUARANTINE_POLLS  15
+
+/// Observer states
+typedef enum {
+  PAWR_OBSERVER_FREE,         ///< Slot not assigned
+  PAWR_OBSERVER_CONFIGURING,  ///< Address written, sync not yet transferred
+  PAWR_OBSERVER_SYNCHRONIZED, ///< Polled in every round
+  PAWR_OBSERVER_QUARANTINED   ///< Released, the old observer may still answer
+} pawr_observer_state_t;
+
+/// Observer table entry
+typedef struct {
+  uint8_t state;      ///< @ref pawr_observer_state_t
+  int8_t temp;        ///< Last reported temperature
+  uint8_t led_stt;    ///< Last reported LED state
+  uint8_t missed;     ///< Polls missed in a row, or polls spent in
+                      ///< quarantine
+  bool answered;      ///< Answered the current poll
+} pawr_observer_t;
+
+/// Scheduler statistics
+typedef struct {
+  uint16_t synchronized;    ///< Observers being polled
+  uint16_t free;            ///< Slots free for new observers
+  uint16_t polled;          ///< Observers polled in the last round
+  uint16_t answered;        ///< Observers that answered the last round
+  uint32_t latency_max_ms;  ///< Longest poll to response time, last round
+  uint32_t released;        ///< Observers released for missing polls
+  uint16_t commands;        ///< Commands delivered in the last interval
+  uint16_t payload_bytes;   ///< Subevent payload bytes in the last interval
+} pawr_scheduler_stats_t;
+
+/***************************************************************************//**
+ * @brief
+ *    Clear the observer table and the command queues.
+ ******************************************************************************/
+void pawr_scheduler_init(void);
+
+/***************************************************************************//**
+ * @brief
+ *    Assign a subevent and response slot to a new observer. Observers are
+ *    spread over the subevents first, so subevents stay short while the
+ *    network is small.
+ *
+ * @return
+ *    Observer index or @ref PAWR_OBSERVER_INDEX_INVALID if the table is full.
+ ******************************************************************************/
+uint16_t pawr_scheduler_alloc(void);
+
+/***************************************************************************//**
+ * @brief
+ *    Mark an observer synchronized, so it is polled from the next round.
+ *
+ * @param[in] index
+ *    Observer index.
+ ******************************************************************************/
+void pawr_scheduler_set_synchronized(uint16_t index);
+
+/***************************************************************************//**
+ * @brief
+ *    Release the subevent and response slot of an observer. The slot is
+ *    quarantined for @ref PAWR_OBSERVER_QUARANTINE_POLLS polls before it is
+ *    given to a new observer. If the old observer answers in the meantime, it
+ *    gets its slot back.
+ *
+ * @param[in] index
+ *    Observer index.
+ ******************************************************************************/
+void pawr_scheduler_release(uint16_t index);
+
+/***************************************************************************//**
+ * @brief
+ *    Get the group ID of an observer, which is its subevent.
+ *
+ * @param[in] index
+ *    Observer index.
+ ******************************************************************************/
+uint8_t pawr_scheduler_group_id(uint16_t index);
+
+/***************************************************************************//**
+ * @brief
+ *    Get the device ID of an observer, which is its response slot + 1.
+ *
+ * @param[in] index
+ *    Observer index.
+ ******************************************************************************/
+uint8_t pawr_scheduler_device_id(uint16_t index);
+
+/***************************************************************************//**
+ * @brief
+ *    Get an observer table entry.
+ *
+ * @param[in] index
+ *    Observer index.
+ *
+ * @return
+ *    Table entry, NULL if the index is out of range.
+ ******************************************************************************/
+const pawr_observer_t *pawr_scheduler_get(uint16_t index);
+
+/***************************************************************************//**
+ * @brief
+ *    Queue a command. The commands of a subevent are packed into one
+ *    payload, commands for the same device merge into its record, so the
+ *    queue of a subevent never overflows.
+ *
+ * @param[in] group_id
+ *    Group ID or @ref PAWR_ADDRESS_BROADCAST to send to every group.
+ * @param[in] device_id
+ *    Device ID or @ref PAWR_ADDRESS_BROADCAST to send to the whole group.
+ * @param[in] opcode
+ *    Command opcode.
+ *
+ * @return
+ *    @ref SL_STATUS_OK or @ref SL_STATUS_INVALID_PARAMETER if the address or
+ *    the opcode is out of range.
+ ******************************************************************************/
+sl_status_t pawr_scheduler_queue(uint8_t group_id,
+                                 uint8_t device_id,
+                                 uint8_t opcode);
+
+/***************************************************************************//**
+ * @brief
+ *    Start a poll round: close the books on the previous round and queue a
+ *    Read Data Sensor command in every subevent with synchronized or
+ *    quarantined observers. Quarantined slots nobody answered in are freed
+ *    after @ref PAWR_OBSERVER_QUARANTINE_POLLS polls.
+ ******************************************************************************/
+void pawr_scheduler_poll(void);
+
+/***************************************************************************//**
+ * @brief
+ *    Take the pending commands of a subevent.
+ *
+ * @param[in] subevent
+ *    Subevent requested by the stack.
+ * @param[out] data
+ *    Subevent payload, at least @ref PAWR_SUBEVENT_DATA_MAX bytes.
+ * @param[out] response_slot_count
+ *    Number of response slots to listen to, 0 if no response is expected.
+ *
+ * @return
+ *    Payload length, 0 if there is nothing to send in the subevent.
+ ******************************************************************************/
+uint8_t pawr_scheduler_get_subevent_data(uint8_t subevent,
+                                         uint8_t *data,
+                                         uint8_t *response_slot_count);
+
+/***************************************************************************//**
+ * @brief
+ *    Store a response.
+ *
+ * @param[in] subevent
+ *    Subevent of the response.
+ * @param[in] response_slot
+ *    Response slot of the response.
+ * @param[in] data
+ *    Response data: status and temperature.
+ * @param[in] len
+ *    Length of the response data.
+ ******************************************************************************/
+void pawr_scheduler_on_response(uint8_t subevent,
+                                uint8_t response_slot,
+                                const uint8_t *data,
+                                uint8_t len);
+
+/***************************************************************************//**
+ * @brief
+ *    Get the scheduler statistics.
+ *
+ * @param[out] stats
+ *    Statistics.
+ ******************************************************************************/
+void pawr_scheduler_get_stats(pawr_scheduler_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PAWR_SCHEDULER_H_ */
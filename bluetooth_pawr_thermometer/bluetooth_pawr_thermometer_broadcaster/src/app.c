@@ -40,24 +40,24 @@
 #include "app.h"
 #include "app_log.h"
 #include "app_assert.h"
+#include "ad_parser.h"
+#include "pawr_scheduler.h"
 
 #include "glib.h"
 #include "dmd.h"
 #include "stdio.h"
 
-// Define the number of devices the application needs.
-#define PAWR_DEVICES_MAX_SYNC                   3
-
 // Value for no flag present for the advertiser
 #define PERIODIC_ADVERTISER_FLAG_NONE           0
-// Periodic advertisement interval for PAwR train.
+// Periodic advertisement interval for PAwR train, every observer is polled
+// once per interval. Has to fit all subevents.
 // Value in units of 1.25 ms.
-#define PAWR_PERIODIC_ADV_MIN_INTERVAL_DEFAULT  500
-#define PAWR_PERIODIC_ADV_MAX_INTERVAL_DEFAULT  500
-// Scalable up to 255 Sensors in 1 groups
-#define PAWR_SUBEVENT_COUNT_DEFAULT             1
-// 7.5 ms
-#define PAWR_SUBEVENT_INTERVAL_DEFAULT          100
+#define PAWR_PERIODIC_ADV_MIN_INTERVAL_DEFAULT  800
+#define PAWR_PERIODIC_ADV_MAX_INTERVAL_DEFAULT  800
+// One subevent per group, see pawr_scheduler.h
+#define PAWR_SUBEVENT_COUNT_DEFAULT             PAWR_SUBEVENT_COUNT
+// 50 ms, has to fit the response slot delay and all response slots
+#define PAWR_SUBEVENT_INTERVAL_DEFAULT          40
 // Time between the advertising packet in a subevent and the first response
 // slot. Value in units of 1.25 ms.
 #define PAWR_RESPONSE_SLOT_DELAY_DEFAULT        6
@@ -65,8 +65,8 @@
 // 0.75 ms enough for up to 75 bytes on 1M phy
 // (including LL overhead plus T_IFS)
 #define PAWR_RESPONSE_SLOT_SPACING_DEFAULT      6
-// Number of subevent response slots
-#define PAWR_RESPONSE_SLOT_COUNT_DEFAULT        6
+// Number of subevent response slots, one per device of a group
+#define PAWR_RESPONSE_SLOT_COUNT_DEFAULT        PAWR_RESPONSE_SLOT_COUNT
 
 // calculate timeout as follows:
 // tmeout_value_ms = 6 * (pawr.adv_interval * 1.25f) [ms]
@@ -76,14 +76,8 @@
                                                     + (                                       \
                                                       PAWR_PERIODIC_ADV_MAX_INTERVAL_DEFAULT  \
                                                       >> 2)))
-#define TABLE_INDEX_INVALID                     ((uint8_t)0xFFu)
-
-// Ping opcode
-#define PAWR_PING_OPCODE                        0x00
-// Read data sensor opcode
-#define PAWR_READ_DATA_SENSOR_OPCODE            0x01
-// Control LED opcode
-#define PAWR_CONTROL_LED_OPCODE                 0x02
+// Number of observers listed on the display
+#define DISPLAY_OBSERVERS_MAX                   8
 
 typedef enum {
   scanning,
@@ -95,33 +89,16 @@ typedef enum {
   unsynchronized
 } connection_state_t;
 
-typedef struct device_address_s {
-  uint8_t group_id; // ranging from 0-127
-  uint8_t device_id; // valid in the range of 1-255.
-                     // 0 is the default (reset) value meaning no address
-                     // assigned to the device
-} device_address_t;
-
-typedef struct device_data_s {
-  device_address_t addr;
-  uint8_t temp;
-  uint8_t led_stt;
-} device_data_t;
-
-/// Array type
-typedef struct pawr_array_s {
-  uint8_t len;     ///< Number of bytes stored in @p data
-  // byte 0: group id (sub event or 0xFF to broadcast)
-  // byte 1: device id (response slot or 0xFF to broadcast)
-  // byte 2: opcode (0x00 - ping, 0x01 - Read Data Sensor, 0x02 - Control LED)
-  uint8_t data[3]; ///< Data bytes
-} pawr_array_t;
-
 // PAwR service UUID defined by user
 // 74e2e878-e82c-4e07-b276-5d2affe4239f
 const uint8_t pawr_service[16] =
 { 0x9f, 0x23, 0xe4, 0xff, 0x2a, 0x5d, 0x76, 0xb2,
   0x07, 0x4e, 0x2c, 0xe8, 0x78, 0xe8, 0xe2, 0x74 };
+// Observer advertisements are recognized by the PAwR service UUID
+static const ad_filter_t scan_filters[] = {
+  { AD_FILTER_UUID128, pawr_service, sizeof(pawr_service) },
+};
+static ad_filter_set_t scan_filter_set;
 // DeviceID characteristic UUID defined by user
 // 6a02d89c-80d5-4f4a-9162-4946120aab7c
 const uint8_t device_addr_char[16] =
@@ -135,17 +112,11 @@ static uint32_t pawr_service_handle = 0xff;
 static uint16_t device_addr_char_handle = 0xff;
 // State of the connection under establishment
 static uint8_t running_state;
-static device_address_t device_addr = {
-  .group_id = 0,
-  .device_id = 1,
-};
-
-pawr_array_t subevent_data;
-// device info contain sub event and response slot
-static device_data_t device_data[PAWR_DEVICES_MAX_SYNC];
-static uint8_t device_count = 0;
+// Observer table entry of the connection under establishment
+static uint16_t observer_index = PAWR_OBSERVER_INDEX_INVALID;
 
-static volatile uint8_t enable_refresh_display = false;
+static volatile bool poll_requested = false;
+static volatile bool led_toggle_requested = false;
 static GLIB_Context_t glibContext;
 static int current_line = 0;
 static char text_string[20];
@@ -156,9 +127,10 @@ static void read_data_timeout(sl_sleeptimer_timer_handle_t *timer, void *data);
 sl_sleeptimer_timer_handle_t connection_timer;
 static void connection_timeout(sl_sleeptimer_timer_handle_t *timer, void *data);
 
-static uint8_t find_service_in_adv(uint8_t *data, uint8_t len);
 static void gatt_procedure_completed_handler(sl_bt_msg_t *evt);
 static void refresh_display(void);
+static void start_scanning(void);
+static void poll_observers(void);
 
 /**************************************************************************//**
  * Application Init.
@@ -167,6 +139,13 @@ void app_init(void)
 {
   uint32_t status;
 
+  status = ad_filter_set_init(&scan_filter_set,
+                              scan_filters,
+                              sizeof(scan_filters) / sizeof(scan_filters[0]));
+  app_assert_status(status);
+
+  pawr_scheduler_init();
+
   status = DMD_init(0);
   EFM_ASSERT(status == SL_STATUS_OK);
 
@@ -196,8 +175,18 @@ void app_init(void)
  *****************************************************************************/
 void app_process_action(void)
 {
-  if (enable_refresh_display) {
-    enable_refresh_display = false;
+  sl_status_t sc;
+
+  if (led_toggle_requested) {
+    led_toggle_requested = false;
+    sc = pawr_scheduler_queue(PAWR_ADDRESS_BROADCAST,
+                              PAWR_ADDRESS_BROADCAST,
+                              PAWR_CONTROL_LED_OPCODE);
+    app_assert_status(sc);
+  }
+  if (poll_requested) {
+    poll_requested = false;
+    poll_observers();
     refresh_display();
   }
 }
@@ -240,10 +229,7 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
                                        PAWR_RESPONSE_SLOT_COUNT_DEFAULT);
       app_assert_status(sc);
 
-      sc = sl_bt_scanner_start(sl_bt_scanner_scan_phy_1m,
-                               sl_bt_scanner_discover_generic);
-      app_assert_status(sc);
-      running_state = scanning;
+      start_scanning();
 
       // Start a timer to Read data sensor
       sc = sl_sleeptimer_start_periodic_timer_ms(&read_data_timer,
@@ -259,12 +245,21 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
           == (SL_BT_SCANNER_EVENT_FLAG_CONNECTABLE
               | SL_BT_SCANNER_EVENT_FLAG_SCANNABLE)) {
         // If a thermometer advertisement is found...
-        if (find_service_in_adv(
+        if (ad_filter_set_match(
+              &scan_filter_set,
               evt->data.evt_scanner_legacy_advertisement_report.data.data,
-              evt->data.evt_scanner_legacy_advertisement_report.data.len)) {
+              evt->data.evt_scanner_legacy_advertisement_report.data.len,
+              NULL) >= 0) {
           // then stop scanning for a while
           sc = sl_bt_scanner_stop();
           app_assert_status(sc);
+          // Reserve a subevent and response slot for the observer
+          observer_index = pawr_scheduler_alloc();
+          if (observer_index == PAWR_OBSERVER_INDEX_INVALID) {
+            app_log("Observer table full, scanning stopped\r\n");
+            running_state = unsynchronized;
+            break;
+          }
           app_log("Found PAwR Observer device\r\n");
           // and connect to that device
           sc = sl_bt_connection_open(
@@ -338,58 +333,58 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       (void)sl_sleeptimer_stop_timer(&connection_timer);
 
       if (running_state == synchronized) {
-        device_addr.device_id++;
-        device_count++;
-      }
-      // more devices can be connected
-      if (device_count < PAWR_DEVICES_MAX_SYNC) {
-        if (running_state != scanning) {
-          // start scanning again to find new devices
-          sc = sl_bt_scanner_start(sl_bt_scanner_scan_phy_1m,
-                                   sl_bt_scanner_discover_generic);
-          app_assert_status(sc);
-          running_state = scanning;
-        }
+        pawr_scheduler_set_synchronized(observer_index);
+        app_log("Observer %u synchronized, group id: %d, device id: %d\r\n",
+                observer_index,
+                pawr_scheduler_group_id(observer_index),
+                pawr_scheduler_device_id(observer_index));
+      } else {
+        pawr_scheduler_release(observer_index);
       }
+      observer_index = PAWR_OBSERVER_INDEX_INVALID;
+      // start scanning again to find new devices
+      start_scanning();
       break;
 
     case sl_bt_evt_pawr_advertiser_subevent_data_request_id:
     {
-      // Check if command is already prepared
-      if (subevent_data.len) {
-        sc = sl_bt_pawr_advertiser_set_subevent_data(pawr_handle,
-                                                     device_addr.group_id,
-                                                     0,
-                                                     device_addr.device_id,
-                                                     subevent_data.len,
-                                                     subevent_data.data);
-        app_assert_status(sc);
-        subevent_data.len = 0;
+      uint8_t data[PAWR_SUBEVENT_DATA_MAX];
+      uint8_t len;
+      uint8_t subevent;
+      uint8_t response_slot_count;
+
+      // The stack asks for several subevents at once, send the commands
+      // packed for each of them
+      for (uint8_t i = 0;
+           i < evt->data.evt_pawr_advertiser_subevent_data_request
+           .subevent_data_count;
+           i++) {
+        subevent =
+          (evt->data.evt_pawr_advertiser_subevent_data_request.subevent_start
+           + i) % PAWR_SUBEVENT_COUNT;
+        len = pawr_scheduler_get_subevent_data(subevent,
+                                               data,
+                                               &response_slot_count);
+        if (len) {
+          sc = sl_bt_pawr_advertiser_set_subevent_data(pawr_handle,
+                                                       subevent,
+                                                       0,
+                                                       response_slot_count,
+                                                       len,
+                                                       data);
+          app_assert_status(sc);
+        }
       }
     }
     break;
 
     case sl_bt_evt_pawr_advertiser_response_report_id:
       if (evt->data.evt_pawr_advertiser_response_report.data_status != 255) {
-        uint8_t device_index =
-          evt->data.evt_pawr_advertiser_response_report.response_slot - 1;
-
-        device_data[device_index].addr.group_id =
-          evt->data.evt_pawr_advertiser_response_report.subevent;
-        device_data[device_index].addr.device_id =
-          evt->data.evt_pawr_advertiser_response_report.response_slot;
-        device_data[device_index].temp =
-          evt->data.evt_pawr_advertiser_response_report.data.data[0];
-        device_data[device_index].led_stt =
-          evt->data.evt_pawr_advertiser_response_report.data.data[1];
-        app_log(
-          "Response received in group id: %d, device id: %d, status: %d\r\n",
+        pawr_scheduler_on_response(
           evt->data.evt_pawr_advertiser_response_report.subevent,
           evt->data.evt_pawr_advertiser_response_report.response_slot,
-          evt->data.evt_pawr_advertiser_response_report.data_status);
-        app_log("Temp = %d, led status = %d\n\r",
-                evt->data.evt_pawr_advertiser_response_report.data.data[0],
-                evt->data.evt_pawr_advertiser_response_report.data.data[1]);
+          evt->data.evt_pawr_advertiser_response_report.data.data,
+          evt->data.evt_pawr_advertiser_response_report.data.len);
       }
       break;
 
@@ -410,34 +405,8 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
 void sl_button_on_change(const sl_button_t *handle)
 {
   if (sl_button_get_state(handle) == SL_SIMPLE_BUTTON_PRESSED) {
-    subevent_data.len = 3;
-    subevent_data.data[0] = device_addr.group_id;
-    subevent_data.data[1] = 0xff;
-    subevent_data.data[2] = PAWR_CONTROL_LED_OPCODE;
-  }
-}
-
-static uint8_t find_service_in_adv(uint8_t *data, uint8_t len)
-{
-  uint8_t ad_length;
-  uint8_t ad_type;
-  uint8_t i = 0;
-
-  // Parse advertisement packet
-  while (i < len) {
-    ad_length = data[i];
-    ad_type = data[i + 1];
-    // Partial ($02) or complete ($03) list of 128-bit UUIDs
-    if ((ad_type == 0x06) || (ad_type == 0x07)) {
-      // compare UUID to service UUID
-      if (memcmp(&data[i + 2], pawr_service, 16) == 0) {
-        return 1;
-      }
-    }
-    // advance to the next AD element
-    i = i + ad_length + 1;
+    led_toggle_requested = true;
   }
-  return 0;
 }
 
 void gatt_procedure_completed_handler(sl_bt_msg_t *evt)
@@ -456,7 +425,8 @@ void gatt_procedure_completed_handler(sl_bt_msg_t *evt)
 
     case discover_characteristics:
     {
-      uint8_t data[2] = { device_addr.group_id, device_addr.device_id };
+      uint8_t data[2] = { pawr_scheduler_group_id(observer_index),
+                          pawr_scheduler_device_id(observer_index) };
 
       sc = sl_bt_gatt_write_characteristic_value(conn_handle,
                                                  device_addr_char_handle,
@@ -505,14 +475,7 @@ static void read_data_timeout(sl_sleeptimer_timer_handle_t *timer, void *data)
   (void) timer;
   (void) data;
 
-  if (!subevent_data.len) {
-    subevent_data.len = 3;
-    subevent_data.data[0] = device_addr.group_id;
-    subevent_data.data[1] = 0xff;
-    subevent_data.data[2] = PAWR_READ_DATA_SENSOR_OPCODE;
-  }
-
-  enable_refresh_display = true;
+  poll_requested = true;
 }
 
 static void connection_timeout(sl_sleeptimer_timer_handle_t *timer,
@@ -526,53 +489,98 @@ static void connection_timeout(sl_sleeptimer_timer_handle_t *timer,
   running_state = unsynchronized;
 }
 
+static void start_scanning(void)
+{
+  sl_status_t sc;
+  pawr_scheduler_stats_t stats;
+
+  // A full table stays full until a quarantined slot is freed, there is no
+  // point in looking for observers before that
+  pawr_scheduler_get_stats(&stats);
+  if ((running_state == scanning)
+      || (conn_handle != 0xff)
+      || (stats.free == 0)) {
+    return;
+  }
+  sc = sl_bt_scanner_start(sl_bt_scanner_scan_phy_1m,
+                           sl_bt_scanner_discover_generic);
+  app_assert_status(sc);
+  running_state = scanning;
+}
+
+static void poll_observers(void)
+{
+  pawr_scheduler_stats_t stats;
+
+  pawr_scheduler_poll();
+  pawr_scheduler_get_stats(&stats);
+  if (stats.polled) {
+    app_log("Poll: %u/%u observers answered, max latency %lu ms, "
+            "released %lu\r\n",
+            stats.answered,
+            stats.polled,
+            (unsigned long)stats.latency_max_ms,
+            (unsigned long)stats.released);
+    app_log("Interval: %u commands delivered in %u payload bytes\r\n",
+            stats.commands,
+            stats.payload_bytes);
+  }
+  // Slots freed from quarantine can be given to new observers
+  if (observer_index == PAWR_OBSERVER_INDEX_INVALID) {
+    start_scanning();
+  }
+}
+
 static void refresh_display(void)
 {
+  pawr_scheduler_stats_t stats;
+  const pawr_observer_t *observer;
+  uint8_t listed = 0;
+
+  pawr_scheduler_get_stats(&stats);
   GLIB_clear(&glibContext);
   current_line = 0;
-  for (uint8_t i = 0; i < device_count; i++) {
-    if (device_data[i].addr.device_id) {
-      snprintf(text_string, 20, "GroupID: %d", device_data[i].addr.group_id);
-      GLIB_drawStringOnLine(&glibContext,
-                            text_string,
-                            current_line++,
-                            GLIB_ALIGN_LEFT,
-                            5,
-                            5,
-                            true);
-      snprintf(text_string, 20, "DeviceID: %d", i + 1);
-
-      /* Draw text on the memory lcd display*/
-      GLIB_drawStringOnLine(&glibContext,
-                            text_string,
-                            current_line++,
-                            GLIB_ALIGN_LEFT,
-                            5,
-                            5,
-                            true);
-      snprintf(text_string, 20, "  TEMP  %d *C", device_data[i].temp);
-
-      /* Draw text on the memory lcd display*/
-      GLIB_drawStringOnLine(&glibContext,
-                            text_string,
-                            current_line++,
-                            GLIB_ALIGN_LEFT,
-                            5,
-                            5,
-                            true);
-
-      snprintf(text_string, 20, "  LED   %s",
-               device_data[i].led_stt? "On" : "Off");
-
-      /* Draw text on the memory lcd display*/
-      GLIB_drawStringOnLine(&glibContext,
-                            text_string,
-                            current_line++,
-                            GLIB_ALIGN_LEFT,
-                            5,
-                            5,
-                            true);
+  snprintf(text_string, 20, "Observers: %u", stats.synchronized);
+  GLIB_drawStringOnLine(&glibContext,
+                        text_string,
+                        current_line++,
+                        GLIB_ALIGN_LEFT,
+                        5,
+                        5,
+                        true);
+  snprintf(text_string, 20, "Answered: %u/%u", stats.answered, stats.polled);
+  GLIB_drawStringOnLine(&glibContext,
+                        text_string,
+                        current_line++,
+                        GLIB_ALIGN_LEFT,
+                        5,
+                        5,
+                        true);
+  current_line++;
+
+  // List the first observers, the whole network does not fit on the screen
+  for (uint16_t i = 0;
+       (i < PAWR_OBSERVERS_MAX) && (listed < DISPLAY_OBSERVERS_MAX);
+       i++) {
+    observer = pawr_scheduler_get(i);
+    if (observer->state != PAWR_OBSERVER_SYNCHRONIZED) {
+      continue;
     }
+    snprintf(text_string, 20, "G%d D%d %d*C %s",
+             pawr_scheduler_group_id(i),
+             pawr_scheduler_device_id(i),
+             observer->temp,
+             observer->led_stt ? "On" : "Off");
+
+    /* Draw text on the memory lcd display*/
+    GLIB_drawStringOnLine(&glibContext,
+                          text_string,
+                          current_line++,
+                          GLIB_ALIGN_LEFT,
+                          5,
+                          5,
+                          true);
+    listed++;
   }
   DMD_updateDisplay();
 }
@@ -0,0 +1,133 @@
+/***************************************************************************//**
+ * @file pawr_payload.c
+ * @brief Subevent payload and response codec of the PAwR thermometer.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+#include "pawr_payload.h"
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+sl_status_t pawr_payload_begin(pawr_payload_writer_t *writer,
+                               uint8_t *data,
+                               uint8_t size,
+                               uint8_t group_id,
+                               uint8_t group_commands)
+{
+  if (size < PAWR_PAYLOAD_HEADER_SIZE) {
+    return SL_STATUS_WOULD_OVERFLOW;
+  }
+  data[0] = group_id;
+  data[1] = group_commands;
+  writer->data = data;
+  writer->size = size;
+  writer->len = PAWR_PAYLOAD_HEADER_SIZE;
+  writer->last_device_id = 0;
+  return SL_STATUS_OK;
+}
+
+sl_status_t pawr_payload_add(pawr_payload_writer_t *writer,
+                             uint8_t device_id,
+                             uint8_t commands)
+{
+  // Increasing order keeps the records searchable, 0 and 0xFF are no devices
+  if ((device_id <= writer->last_device_id)
+      || (device_id == PAWR_ADDRESS_BROADCAST)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (writer->len + PAWR_PAYLOAD_RECORD_SIZE > writer->size) {
+    return SL_STATUS_WOULD_OVERFLOW;
+  }
+  writer->data[writer->len++] = device_id;
+  writer->data[writer->len++] = commands;
+  writer->last_device_id = device_id;
+  return SL_STATUS_OK;
+}
+
+bool pawr_payload_find(const uint8_t *data,
+                       uint8_t len,
+                       uint8_t group_id,
+                       uint8_t device_id,
+                       uint8_t *commands)
+{
+  const uint8_t *records;
+  uint8_t low = 0;
+  uint8_t high;
+  uint8_t mid;
+  uint8_t record_commands = 0;
+
+  if ((len < PAWR_PAYLOAD_HEADER_SIZE)
+      || ((len - PAWR_PAYLOAD_HEADER_SIZE) % PAWR_PAYLOAD_RECORD_SIZE)
+      || ((data[0] != group_id) && (data[0] != PAWR_ADDRESS_BROADCAST))) {
+    return false;
+  }
+
+  records = &data[PAWR_PAYLOAD_HEADER_SIZE];
+  high = (len - PAWR_PAYLOAD_HEADER_SIZE) / PAWR_PAYLOAD_RECORD_SIZE;
+  while (low < high) {
+    mid = low + (high - low) / 2;
+    if (records[mid * PAWR_PAYLOAD_RECORD_SIZE] == device_id) {
+      record_commands = records[mid * PAWR_PAYLOAD_RECORD_SIZE + 1];
+      break;
+    } else if (records[mid * PAWR_PAYLOAD_RECORD_SIZE] < device_id) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  *commands = ((data[1] | record_commands)
+               & ~PAWR_COMMAND(PAWR_CONTROL_LED_OPCODE))
+              | ((data[1] ^ record_commands)
+                 & PAWR_COMMAND(PAWR_CONTROL_LED_OPCODE));
+  return true;
+}
+
+void pawr_response_encode(uint8_t *data, uint8_t status, int8_t temp)
+{
+  data[0] = status;
+  data[1] = (uint8_t)temp;
+}
+
+bool pawr_response_decode(const uint8_t *data,
+                          uint8_t len,
+                          uint8_t *status,
+                          int8_t *temp)
+{
+  if (len < PAWR_RESPONSE_SIZE) {
+    return false;
+  }
+  *status = data[0];
+  *temp = (int8_t)data[1];
+  return true;
+}
@@ -0,0 +1,406 @@
+/***************************************************************************//**
+ * @file pawr_scheduler.c
+ * @brief Subevent and response slot scheduler for PAwR observers.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+#include <string.h>
+#include "sl_sleeptimer.h"
+#include "pawr_scheduler.h"
+
+// Observers are indexed by slot first, so consecutive indexes land in
+// different subevents
+#define OBSERVER_INDEX(subevent, slot) \
+  ((uint16_t)(slot) * PAWR_SUBEVENT_COUNT + (subevent))
+
+/// Per subevent state
+typedef struct {
+  uint8_t group_commands;     ///< Pending commands for the whole group
+  uint8_t device_commands[PAWR_RESPONSE_SLOT_COUNT]; ///< Pending commands
+                                                     ///< per device, by slot
+  uint8_t devices_pending;    ///< Devices with pending commands
+  uint8_t slots_used;         ///< Highest assigned slot + 1
+  uint8_t synchronized;       ///< Synchronized observers
+  uint8_t quarantined;        ///< Released slots not yet free
+  bool read_sent;             ///< Group read was sent this round
+} subevent_t;
+
+static pawr_observer_t observers[PAWR_OBSERVERS_MAX];
+static subevent_t subevents[PAWR_SUBEVENT_COUNT];
+static pawr_scheduler_stats_t scheduler_stats;
+static uint32_t latency_max_ms;
+static uint16_t commands_sent;
+static uint16_t payload_bytes_sent;
+static uint32_t poll_tick;
+
+// -----------------------------------------------------------------------------
+// Private function declarations
+
+static void queue_command(subevent_t *sub, uint8_t device_id, uint8_t opcode);
+static uint8_t merge_commands(uint8_t pending, uint8_t opcode);
+static uint8_t count_commands(uint8_t commands);
+static void shrink_slots_used(uint8_t subevent);
+static void account_observer(uint16_t index,
+                             uint16_t *polled,
+                             uint16_t *answered);
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+void pawr_scheduler_init(void)
+{
+  memset(observers, 0, sizeof(observers));
+  memset(subevents, 0, sizeof(subevents));
+  memset(&scheduler_stats, 0, sizeof(scheduler_stats));
+  scheduler_stats.free = PAWR_OBSERVERS_MAX;
+  latency_max_ms = 0;
+  commands_sent = 0;
+  payload_bytes_sent = 0;
+  poll_tick = sl_sleeptimer_get_tick_count();
+}
+
+uint16_t pawr_scheduler_alloc(void)
+{
+  uint8_t subevent;
+  uint8_t slot;
+
+  for (uint16_t i = 0; i < PAWR_OBSERVERS_MAX; i++) {
+    if (observers[i].state == PAWR_OBSERVER_FREE) {
+      subevent = i % PAWR_SUBEVENT_COUNT;
+      slot = i / PAWR_SUBEVENT_COUNT;
+      memset(&observers[i], 0, sizeof(observers[i]));
+      observers[i].state = PAWR_OBSERVER_CONFIGURING;
+      if (subevents[subevent].slots_used <= slot) {
+        subevents[subevent].slots_used = slot + 1;
+      }
+      scheduler_stats.free--;
+      return i;
+    }
+  }
+  return PAWR_OBSERVER_INDEX_INVALID;
+}
+
+void pawr_scheduler_set_synchronized(uint16_t index)
+{
+  if ((index >= PAWR_OBSERVERS_MAX)
+      || (observers[index].state != PAWR_OBSERVER_CONFIGURING)) {
+    return;
+  }
+  observers[index].state = PAWR_OBSERVER_SYNCHRONIZED;
+  subevents[index % PAWR_SUBEVENT_COUNT].synchronized++;
+  scheduler_stats.synchronized++;
+}
+
+void pawr_scheduler_release(uint16_t index)
+{
+  uint8_t subevent;
+
+  if ((index >= PAWR_OBSERVERS_MAX)
+      || (observers[index].state == PAWR_OBSERVER_FREE)
+      || (observers[index].state == PAWR_OBSERVER_QUARANTINED)) {
+    return;
+  }
+  subevent = index % PAWR_SUBEVENT_COUNT;
+  if (observers[index].state == PAWR_OBSERVER_SYNCHRONIZED) {
+    subevents[subevent].synchronized--;
+    scheduler_stats.synchronized--;
+  }
+  // The old observer may still be synchronized and answer in the slot, keep
+  // the slot away from new observers until it had time to drop out
+  observers[index].state = PAWR_OBSERVER_QUARANTINED;
+  observers[index].missed = 0;
+  observers[index].answered = false;
+  subevents[subevent].quarantined++;
+}
+
+uint8_t pawr_scheduler_group_id(uint16_t index)
+{
+  return index % PAWR_SUBEVENT_COUNT;
+}
+
+uint8_t pawr_scheduler_device_id(uint16_t index)
+{
+  return index / PAWR_SUBEVENT_COUNT + 1;
+}
+
+const pawr_observer_t *pawr_scheduler_get(uint16_t index)
+{
+  if (index >= PAWR_OBSERVERS_MAX) {
+    return NULL;
+  }
+  return &observers[index];
+}
+
+sl_status_t pawr_scheduler_queue(uint8_t group_id,
+                                 uint8_t device_id,
+                                 uint8_t opcode)
+{
+  if ((opcode > PAWR_CONTROL_LED_OPCODE)
+      || ((device_id != PAWR_ADDRESS_BROADCAST)
+          && ((device_id == 0) || (device_id > PAWR_RESPONSE_SLOT_COUNT)))) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  if (group_id != PAWR_ADDRESS_BROADCAST) {
+    if (group_id >= PAWR_SUBEVENT_COUNT) {
+      return SL_STATUS_INVALID_PARAMETER;
+    }
+    queue_command(&subevents[group_id], device_id, opcode);
+    return SL_STATUS_OK;
+  }
+
+  // Broadcast to every group that has someone listening
+  for (uint8_t i = 0; i < PAWR_SUBEVENT_COUNT; i++) {
+    if (subevents[i].synchronized > 0) {
+      queue_command(&subevents[i], device_id, opcode);
+    }
+  }
+  return SL_STATUS_OK;
+}
+
+void pawr_scheduler_poll(void)
+{
+  subevent_t *sub;
+  uint16_t polled = 0;
+  uint16_t answered = 0;
+
+  for (uint8_t i = 0; i < PAWR_SUBEVENT_COUNT; i++) {
+    sub = &subevents[i];
+
+    // Account for the previous round, if its read command went out
+    if (sub->read_sent) {
+      sub->read_sent = false;
+      for (uint8_t slot = 0; slot < sub->slots_used; slot++) {
+        account_observer(OBSERVER_INDEX(i, slot), &polled, &answered);
+      }
+      shrink_slots_used(i);
+    }
+
+    // One group read per subevent polls the whole group. Quarantined slots
+    // are polled as well, to hear whether the old observer is still there.
+    if ((sub->synchronized > 0) || (sub->quarantined > 0)) {
+      sub->group_commands |= PAWR_COMMAND(PAWR_READ_DATA_SENSOR_OPCODE);
+    }
+  }
+
+  // Polls are one periodic advertising interval apart
+  scheduler_stats.polled = polled;
+  scheduler_stats.answered = answered;
+  scheduler_stats.latency_max_ms = latency_max_ms;
+  scheduler_stats.commands = commands_sent;
+  scheduler_stats.payload_bytes = payload_bytes_sent;
+  latency_max_ms = 0;
+  commands_sent = 0;
+  payload_bytes_sent = 0;
+  poll_tick = sl_sleeptimer_get_tick_count();
+}
+
+uint8_t pawr_scheduler_get_subevent_data(uint8_t subevent,
+                                         uint8_t *data,
+                                         uint8_t *response_slot_count)
+{
+  subevent_t *sub;
+  pawr_payload_writer_t writer;
+  uint8_t read_slots = 0;
+
+  *response_slot_count = 0;
+  if (subevent >= PAWR_SUBEVENT_COUNT) {
+    return 0;
+  }
+  sub = &subevents[subevent];
+  if ((sub->group_commands == 0) && (sub->devices_pending == 0)) {
+    return 0;
+  }
+
+  (void)pawr_payload_begin(&writer,
+                           data,
+                           PAWR_SUBEVENT_DATA_MAX,
+                           subevent,
+                           sub->group_commands);
+  commands_sent += count_commands(sub->group_commands) * sub->synchronized;
+
+  // Slot order is device ID order, so the records come out sorted. There is
+  // at most one record per slot, the buffer cannot overflow.
+  for (uint8_t slot = 0;
+       (slot < PAWR_RESPONSE_SLOT_COUNT) && (sub->devices_pending > 0);
+       slot++) {
+    if (sub->device_commands[slot] == 0) {
+      continue;
+    }
+    (void)pawr_payload_add(&writer, slot + 1, sub->device_commands[slot]);
+    commands_sent += count_commands(sub->device_commands[slot]);
+    if (sub->device_commands[slot]
+        & PAWR_COMMAND(PAWR_READ_DATA_SENSOR_OPCODE)) {
+      read_slots = slot + 1;
+    }
+    sub->device_commands[slot] = 0;
+    sub->devices_pending--;
+  }
+
+  // Listen to the slots in use only, the rest of the subevent stays idle
+  if (sub->group_commands & PAWR_COMMAND(PAWR_READ_DATA_SENSOR_OPCODE)) {
+    read_slots = sub->slots_used;
+    sub->read_sent = true;
+  }
+  *response_slot_count = read_slots;
+  sub->group_commands = 0;
+  payload_bytes_sent += writer.len;
+  return writer.len;
+}
+
+void pawr_scheduler_on_response(uint8_t subevent,
+                                uint8_t response_slot,
+                                const uint8_t *data,
+                                uint8_t len)
+{
+  pawr_observer_t *observer;
+  uint32_t latency_ms;
+  uint8_t status;
+  int8_t temp;
+
+  if ((subevent >= PAWR_SUBEVENT_COUNT)
+      || (response_slot >= PAWR_RESPONSE_SLOT_COUNT)
+      || !pawr_response_decode(data, len, &status, &temp)) {
+    return;
+  }
+  observer = &observers[OBSERVER_INDEX(subevent, response_slot)];
+  if (observer->state == PAWR_OBSERVER_QUARANTINED) {
+    // The old observer is still synchronized, give it its slot back
+    observer->state = PAWR_OBSERVER_SYNCHRONIZED;
+    subevents[subevent].quarantined--;
+    subevents[subevent].synchronized++;
+    scheduler_stats.synchronized++;
+  } else if (observer->state != PAWR_OBSERVER_SYNCHRONIZED) {
+    return;
+  }
+
+  if (status & PAWR_STATUS_TEMP_VALID) {
+    observer->temp = temp;
+  }
+  observer->led_stt = (status & PAWR_STATUS_LED_ON) ? 1 : 0;
+  observer->answered = true;
+  observer->missed = 0;
+
+  latency_ms = sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count()
+                                        - poll_tick);
+  if (latency_ms > latency_max_ms) {
+    latency_max_ms = latency_ms;
+  }
+}
+
+void pawr_scheduler_get_stats(pawr_scheduler_stats_t *stats)
+{
+  *stats = scheduler_stats;
+}
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static void queue_command(subevent_t *sub, uint8_t device_id, uint8_t opcode)
+{
+  uint8_t *pending;
+
+  if (device_id == PAWR_ADDRESS_BROADCAST) {
+    sub->group_commands = merge_commands(sub->group_commands, opcode);
+    return;
+  }
+
+  pending = &sub->device_commands[device_id - 1];
+  if (*pending == 0) {
+    sub->devices_pending++;
+  }
+  *pending = merge_commands(*pending, opcode);
+  if (*pending == 0) {
+    sub->devices_pending--;
+  }
+}
+
+static uint8_t merge_commands(uint8_t pending, uint8_t opcode)
+{
+  // Two LED toggles cancel out, other commands run once however often
+  // they were queued
+  if (opcode == PAWR_CONTROL_LED_OPCODE) {
+    return pending ^ PAWR_COMMAND(opcode);
+  }
+  return pending | PAWR_COMMAND(opcode);
+}
+
+static uint8_t count_commands(uint8_t commands)
+{
+  uint8_t count = 0;
+
+  while (commands) {
+    commands &= commands - 1;
+    count++;
+  }
+  return count;
+}
+
+static void account_observer(uint16_t index,
+                             uint16_t *polled,
+                             uint16_t *answered)
+{
+  pawr_observer_t *observer = &observers[index];
+
+  if (observer->state == PAWR_OBSERVER_QUARANTINED) {
+    // Nobody answered in the slot for longer than the sync timeout, so the
+    // old observer has dropped it and the slot can be reassigned
+    if (++observer->missed >= PAWR_OBSERVER_QUARANTINE_POLLS) {
+      observer->state = PAWR_OBSERVER_FREE;
+      subevents[index % PAWR_SUBEVENT_COUNT].quarantined--;
+      scheduler_stats.free++;
+    }
+    return;
+  }
+  if (observer->state != PAWR_OBSERVER_SYNCHRONIZED) {
+    return;
+  }
+  (*polled)++;
+  if (observer->answered) {
+    (*answered)++;
+  } else if (++observer->missed >= PAWR_OBSERVER_MISSED_MAX) {
+    pawr_scheduler_release(index);
+    scheduler_stats.released++;
+  }
+  observer->answered = false;
+}
+
+static void shrink_slots_used(uint8_t subevent)
+{
+  subevent_t *sub = &subevents[subevent];
+
+  while ((sub->slots_used > 0)
+         && (observers[OBSERVER_INDEX(subevent, sub->slots_used - 1)].state
+             == PAWR_OBSERVER_FREE)) {
+    sub->slots_used--;
+  }
+}
@@ -41,16 +41,10 @@
 #include "gatt_db.h"
 #include "app.h"
 #include "app_assert.h"
+#include "pawr_payload.h"
 
 #include "tempdrv.h"
 
-// Ping opcode
-#define PAWR_PING_OPCODE               0x00
-// Read data sensor opcode
-#define PAWR_READ_DATA_SENSOR_OPCODE   0x01
-// Control LED opcode
-#define PAWR_CONTROL_LED_OPCODE        0x02
-
 typedef struct device_address_s {
   uint8_t group_id; // ranging from 0-127
   uint8_t device_id; // valid in the range of 1-255.
@@ -177,6 +171,12 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       break;
 
     case sl_bt_evt_pawr_sync_transfer_received_id:
+      // Only the subevent of the own group carries commands for this device
+      sc = sl_bt_pawr_sync_set_sync_subevents(
+        evt->data.evt_pawr_sync_transfer_received.sync,
+        1,
+        &device_addr.group_id);
+      app_assert_status(sc);
       sc = sl_bt_connection_close(conn_handle);
       app_assert_status(sc);
       break;
@@ -207,28 +207,41 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
 static void process_opcode(sl_bt_msg_t *evt)
 {
   sl_status_t sc;
-  uint8_t opcode = evt->data.evt_pawr_sync_subevent_report.data.data[2];
+  uint8_t commands;
+  uint8_t status;
+  uint8_t response_data[PAWR_RESPONSE_SIZE];
+
+  // Find the commands for this device among the records of its group
+  if ((device_addr.device_id == 0)
+      || !pawr_payload_find(evt->data.evt_pawr_sync_subevent_report.data.data,
+                            evt->data.evt_pawr_sync_subevent_report.data.len,
+                            device_addr.group_id,
+                            device_addr.device_id,
+                            &commands)) {
+    return;
+  }
 
-  switch (opcode) {
-    case PAWR_PING_OPCODE:
-      break;
-    case PAWR_READ_DATA_SENSOR_OPCODE:
-    {
-      uint8_t response_data[2] = { TEMPDRV_GetTemp(),
-                                   sl_led_get_state(&sl_led_led0) };
-      sc = sl_bt_pawr_sync_set_response_data(
-        evt->data.evt_pawr_sync_subevent_report.sync,
-        evt->data.evt_pawr_sync_subevent_report.event_counter,
-        evt->data.evt_pawr_sync_subevent_report.subevent,
-        evt->data.evt_pawr_sync_subevent_report.subevent,
-        device_addr.device_id,
-        sizeof(response_data),
-        response_data);
-      app_assert_status(sc);
+  status = 0;
+  if (commands & PAWR_COMMAND(PAWR_CONTROL_LED_OPCODE)) {
+    sl_led_toggle(&sl_led_led0);
+    status |= PAWR_STATUS_LED_TOGGLED;
+  }
+
+  // Answer once, after the LED command of the same subevent took effect
+  if (commands & PAWR_COMMAND(PAWR_READ_DATA_SENSOR_OPCODE)) {
+    status |= PAWR_STATUS_TEMP_VALID;
+    if (sl_led_get_state(&sl_led_led0)) {
+      status |= PAWR_STATUS_LED_ON;
     }
-    break;
-    case PAWR_CONTROL_LED_OPCODE:
-      sl_led_toggle(&sl_led_led0);
-      break;
+    pawr_response_encode(response_data, status, TEMPDRV_GetTemp());
+    sc = sl_bt_pawr_sync_set_response_data(
+      evt->data.evt_pawr_sync_subevent_report.sync,
+      evt->data.evt_pawr_sync_subevent_report.event_counter,
+      evt->data.evt_pawr_sync_subevent_report.subevent,
+      evt->data.evt_pawr_sync_subevent_report.subevent,
+      device_addr.device_id - 1,
+      sizeof(response_data),
+      response_data);
+    app_assert_status(sc);
   }
 }
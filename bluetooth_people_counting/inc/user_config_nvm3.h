@@ -46,6 +46,61 @@
  ******************************************************************************/
 void user_config_nvm3_init(void);
 
+/***************************************************************************//**
+ * @brief
+ *    Write the pending configuration changes to the nvm3 entry.
+ *
+ * @details
+ *    The configuration setters only update the RAM copy, all the fields are
+ *    written to flash together by this function. It does nothing if there is
+ *    no pending change.
+ *
+ * @return
+ *    @ref SL_STATUS_OK on success or @ref SL_STATUS_FAIL on failure.
+ ******************************************************************************/
+sl_status_t user_config_nvm3_commit(void);
+
+/***************************************************************************//**
+ * @brief
+ *    Check if there are configuration changes not yet written to nvm3.
+ *
+ * @return
+ *    True if @ref user_config_nvm3_commit has something to write.
+ ******************************************************************************/
+bool user_config_nvm3_is_dirty(void);
+
+/***************************************************************************//**
+ * @brief
+ *    Set all the configuration values at once.
+ *
+ * @details
+ *    Every value is checked before any of them is applied, so an invalid
+ *    value leaves the whole configuration unchanged.
+ *
+ * @param[in] min_distance
+ *    Minimum distance value to set.
+ * @param[in] max_distance
+ *    Maximum distance value to set.
+ * @param[in] distance_threshold
+ *    Distance threshold value to set.
+ * @param[in] timing_budget
+ *    Timing budget value to set.
+ * @param[in] room_capacity
+ *    Room capacity value to set.
+ * @param[in] notification_status
+ *    Enable or disable notifications.
+ *
+ * @return
+ *    @ref SL_STATUS_OK on success or @ref SL_STATUS_INVALID_RANGE if any
+ *    value is out of range.
+ ******************************************************************************/
+sl_status_t user_config_nvm3_set_config(uint16_t min_distance,
+                                        uint16_t max_distance,
+                                        uint16_t distance_threshold,
+                                        uint16_t timing_budget,
+                                        uint16_t room_capacity,
+                                        bool notification_status);
+
 /***************************************************************************//**
  * @brief
  *    Set people entered the room so far value to the nvm3 entry.
@@ -60,7 +115,7 @@ sl_status_t user_config_nvm3_set_people_entered_so_far(uint32_t people_count);
 
 /***************************************************************************//**
  * @brief
- *    Set minimum distance to the nvm3 entry.
+ *    Set minimum distance, stored by @ref user_config_nvm3_commit.
  *
  * @param[in] distance
  *    Distance value to set.
@@ -72,7 +127,7 @@ sl_status_t user_config_nvm3_set_min_distance(uint16_t distance);
 
 /***************************************************************************//**
  * @brief
- *    Set maximum distance to the nvm3 entry.
+ *    Set maximum distance, stored by @ref user_config_nvm3_commit.
  *
  * @param[in] distance
  *    Distance value to set.
@@ -84,7 +139,7 @@ sl_status_t user_config_nvm3_set_max_distance(uint16_t distance);
 
 /***************************************************************************//**
  * @brief
- *    Set max distance threshold to the nvm3 entry.
+ *    Set max distance threshold, stored by @ref user_config_nvm3_commit.
  *
  * @param[in] distance
  *    Distance value to set.
@@ -96,7 +151,7 @@ sl_status_t user_config_nvm3_set_distance_threshold(uint16_t distance);
 
 /***************************************************************************//**
  * @brief
- *    Set timing budget to the nvm3 entry.
+ *    Set timing budget, stored by @ref user_config_nvm3_commit.
  *
  * @param[in] timing_budget
  *    Timing budget value to set.
@@ -108,7 +163,7 @@ sl_status_t user_config_nvm3_set_timing_budget(uint16_t timing_budget);
 
 /***************************************************************************//**
  * @brief
- *    Set notification status to the nvm3 entry.
+ *    Set notification status, stored by @ref user_config_nvm3_commit.
  *
  * @param[in] enable
  *    Enable or disable.
@@ -120,7 +175,7 @@ sl_status_t user_config_nvm3_set_notification_status(bool enable);
 
 /***************************************************************************//**
  * @brief
- *    Set room capacity to the nvm3 entry.
+ *    Set room capacity, stored by @ref user_config_nvm3_commit.
  *
  * @param[in] room_capacity
  *    Room capacity value.
@@ -37,6 +37,21 @@
 #ifndef VL53L1X_APP_H
 #define VL53L1X_APP_H
 
+#include "em_gpio.h"
+
+// Set to 1 to sample on the GPIO1 data ready interrupt instead of polling the
+// data ready flag of the sensor. The Qwiic cable does not carry GPIO1, the
+// pad has to be wired to the pin below.
+#ifndef VL53L1X_APP_USE_INTERRUPT
+#define VL53L1X_APP_USE_INTERRUPT         0
+#endif
+
+// Pin connected to the GPIO1 (INT) pad of the distance sensor breakout.
+#ifndef VL53L1X_APP_INT_PORT
+#define VL53L1X_APP_INT_PORT              gpioPortB
+#define VL53L1X_APP_INT_PIN               3
+#endif
+
 /***************************************************************************//**
  * @brief
  *    Initialize VL53L1x application.
@@ -47,11 +62,22 @@ void vl53l1x_app_init(void);
 /***************************************************************************//**
  * @brief
  *   Get sampling data from the VL53L1x sensor and process people counting
- *   algorithm.
+ *   algorithm. Called on the data ready interrupt, or periodically when
+ *   VL53L1X_APP_USE_INTERRUPT is 0.
  *
  ******************************************************************************/
 void vl53l1x_app_process_action(void);
 
+/***************************************************************************//**
+ * @brief
+ *    Get the number of samples processed in the last second.
+ *
+ * @return
+ *    Achieved samples per second, both zones together.
+ *
+ ******************************************************************************/
+uint16_t vl53l1x_app_get_samples_per_second(void);
+
 /***************************************************************************//**
  * @brief
  *    Get current measured distance.
@@ -42,6 +42,7 @@
 #include "sl_simple_led_instances.h"
 #endif
 #include "sl_simple_button_instances.h"
+#include "gpiointerrupt.h"
 #include "user_config_nvm3.h"
 #include "oled.h"
 #include "app.h"
@@ -90,6 +91,19 @@
 #define PEOPLE_COUNTING_EVENT           (1 << 0)
 #define PEOPLE_COUNTING_BUTTON_EVENT    (1 << 1)
 #define PEOPLE_COUNTING_SAMPLING_EVENT  (1 << 2)
+#define PEOPLE_COUNTING_CONFIG_EVENT    (1 << 3)
+
+// Configuration changes are written to NVM3 once no other change has been
+// received for this long, so a full reconfiguration costs one flash write.
+#define CONFIG_COMMIT_DELAY_MS          (2000)
+
+// Clear mask of the Counters characteristic
+#define COUNTERS_CLEAR_PEOPLE_COUNT     (1 << 0)
+#define COUNTERS_CLEAR_ENTERED_SO_FAR   (1 << 1)
+
+// Packed little-endian characteristic values
+#define COUNTERS_LEN                    (6)
+#define CONFIGURATION_LEN               (11)
 
 // -----------------------------------------------------------------------------
 // Private variables
@@ -97,9 +111,13 @@
 static uint8_t bt_connection_handle = INVALID_BT_HANDLE;
 
 static sl_sleeptimer_timer_handle_t oled_timer;
+static sl_sleeptimer_timer_handle_t config_commit_timer;
+#if !VL53L1X_APP_USE_INTERRUPT
 static sl_sleeptimer_timer_handle_t people_counting_timer;
+#endif
 static bool notification_status = false;
 
+static uint16_t last_samples_per_second = 0;
 static uint16_t last_people_count = (uint16_t)-1;
 static uint32_t last_people_entered_so_far = (uint32_t)-1;
 
@@ -108,10 +126,23 @@ static uint32_t last_people_entered_so_far = (uint32_t)-1;
 
 static void people_counting_event_handler(void);
 static void people_counting_button_handler(void);
+static void people_counting_config_changed(void);
+static void people_counting_config_commit_callback(
+  sl_sleeptimer_timer_handle_t *timer, void *data);
+static void put_u16_le(uint8_t *buf, uint16_t value);
+static void put_u32_le(uint8_t *buf, uint32_t value);
+static uint16_t get_u16_le(const uint8_t *buf);
+static sl_status_t people_counting_write_counters(const uint8array *value);
+static sl_status_t people_counting_write_configuration(
+  const uint8array *value);
 static void people_counting_oled_display_callback(
   sl_sleeptimer_timer_handle_t *timer, void *data);
+#if VL53L1X_APP_USE_INTERRUPT
+static void people_counting_sensor_data_ready_callback(uint8_t int_no);
+#else
 static void people_counting_sensor_sampling_callback(
   sl_sleeptimer_timer_handle_t *timer, void *data);
+#endif
 
 // -----------------------------------------------------------------------------
 // Public function definitions
@@ -136,6 +167,24 @@ void people_counting_app_init(void)
                                         0,
                                         0);
 
+#if VL53L1X_APP_USE_INTERRUPT
+  // Sample and calculate people count on each data ready interrupt
+  GPIOINT_Init();
+  GPIO_PinModeSet(VL53L1X_APP_INT_PORT,
+                  VL53L1X_APP_INT_PIN,
+                  gpioModeInputPullFilter,
+                  0);
+  GPIO_ExtIntConfig(VL53L1X_APP_INT_PORT,
+                    VL53L1X_APP_INT_PIN,
+                    VL53L1X_APP_INT_PIN,
+                    true,
+                    false,
+                    true);
+  GPIOINT_CallbackRegister(VL53L1X_APP_INT_PIN,
+                           people_counting_sensor_data_ready_callback);
+  // A result may already be pending, it has no edge left to trigger on
+  sl_bt_external_signal(PEOPLE_COUNTING_SAMPLING_EVENT);
+#else
   // Create sampling and calculate people count periodic timer
   sl_sleeptimer_start_periodic_timer_ms(&people_counting_timer,
                                         10,
@@ -143,6 +192,7 @@ void people_counting_app_init(void)
                                         NULL,
                                         0,
                                         0);
+#endif
 }
 
 /***************************************************************************//**
@@ -161,6 +211,10 @@ void people_counting_process_evt_external_signal(uint32_t extsignals)
   if (extsignals & PEOPLE_COUNTING_SAMPLING_EVENT) {
     vl53l1x_app_process_action();
   }
+
+  if (extsignals & PEOPLE_COUNTING_CONFIG_EVENT) {
+    user_config_nvm3_commit();
+  }
 }
 
 /***************************************************************************//**
@@ -263,6 +317,15 @@ void people_counting_process_evt_gatt_server_user_write_request(
         sc = SL_STATUS_BT_ATT_OUT_OF_RANGE;
       }
       break;
+    case gattdb_counters:
+      sc = people_counting_write_counters(&data->value);
+      break;
+    case gattdb_configuration:
+      sc = people_counting_write_configuration(&data->value);
+      break;
+  }
+  if ((SL_STATUS_OK == sc) && user_config_nvm3_is_dirty()) {
+    people_counting_config_changed();
   }
   // Send write response.
   sc = sl_bt_gatt_server_send_user_write_response(
@@ -406,6 +469,44 @@ void people_counting_process_evt_gatt_server_user_read_request(
       app_assert_status(sc);
       break;
     }
+    case gattdb_counters: {
+      uint8_t value[COUNTERS_LEN];
+      uint32_t people_entered_so_far = vl53l1x_app_get_people_entered_so_far();
+      uint16_t people_count = vl53l1x_app_get_people_count();
+
+      put_u32_le(&value[0], people_entered_so_far);
+      put_u16_le(&value[4], people_count);
+      // Send gatt response.
+      sc = sl_bt_gatt_server_send_user_read_response(
+        data->connection,
+        data->characteristic,
+        0,
+        sizeof(value),
+        value,
+        NULL);
+      app_assert_status(sc);
+      break;
+    }
+    case gattdb_configuration: {
+      uint8_t value[CONFIGURATION_LEN];
+
+      put_u16_le(&value[0], user_config_nvm3_get_min_distance());
+      put_u16_le(&value[2], user_config_nvm3_get_max_distance());
+      put_u16_le(&value[4], user_config_nvm3_get_distance_threshold());
+      put_u16_le(&value[6], user_config_nvm3_get_timing_budget());
+      put_u16_le(&value[8], user_config_nvm3_get_room_capacity());
+      value[10] = user_config_nvm3_get_notification_status() ? 1 : 0;
+      // Send gatt response.
+      sc = sl_bt_gatt_server_send_user_read_response(
+        data->connection,
+        data->characteristic,
+        0,
+        sizeof(value),
+        value,
+        NULL);
+      app_assert_status(sc);
+      break;
+    }
   }
 }
 
@@ -446,11 +547,31 @@ void people_counting_set_bt_connection_handle(uint8_t connection)
 void people_counting_reset_bt_connection_handle(void)
 {
   bt_connection_handle = INVALID_BT_HANDLE;
+  // Do not wait for the commit timer once the client is gone
+  sl_sleeptimer_stop_timer(&config_commit_timer);
+  user_config_nvm3_commit();
 }
 
 // -----------------------------------------------------------------------------
 // Private function
 
+static void put_u16_le(uint8_t *buf, uint16_t value)
+{
+  buf[0] = value & 0xff;
+  buf[1] = value >> 8;
+}
+
+static void put_u32_le(uint8_t *buf, uint32_t value)
+{
+  put_u16_le(&buf[0], (uint16_t)value);
+  put_u16_le(&buf[2], (uint16_t)(value >> 16));
+}
+
+static uint16_t get_u16_le(const uint8_t *buf)
+{
+  return (uint16_t)(buf[0] | (buf[1] << 8));
+}
+
 static void send_notification_data_u16(uint16_t characteristic, uint16_t data)
 {
   uint8_t notification_data[2];
@@ -467,6 +588,12 @@ static void people_counting_event_handler(void)
 {
   uint16_t people_count = vl53l1x_app_get_people_count();
   uint32_t people_entered_so_far = vl53l1x_app_get_people_entered_so_far();
+  uint16_t samples_per_second = vl53l1x_app_get_samples_per_second();
+
+  if (samples_per_second != last_samples_per_second) {
+    last_samples_per_second = samples_per_second;
+    log_info("Sampling rate: %d samples/s\r\n", samples_per_second);
+  }
 
   // Only display & notify people count when their value is changed
   if ((people_count != last_people_count)
@@ -496,6 +623,67 @@ static void people_counting_button_handler(void)
   vl53l1x_app_clear_people_count();
 }
 
+static void people_counting_config_changed(void)
+{
+  // Restart the timer on every change to coalesce them
+  sl_sleeptimer_restart_timer_ms(&config_commit_timer,
+                                 CONFIG_COMMIT_DELAY_MS,
+                                 people_counting_config_commit_callback,
+                                 NULL,
+                                 0,
+                                 0);
+}
+
+static sl_status_t people_counting_write_counters(const uint8array *value)
+{
+  uint8_t clear_mask;
+
+  if ((value->len != 1)
+      || (value->data[0] & ~(COUNTERS_CLEAR_PEOPLE_COUNT
+                             | COUNTERS_CLEAR_ENTERED_SO_FAR))) {
+    return SL_STATUS_BT_ATT_VALUE_NOT_ALLOWED;
+  }
+  clear_mask = value->data[0];
+  log_info("[BLE_GATT]: Write: counters clear mask: 0x%02x\r\n", clear_mask);
+  if (clear_mask & COUNTERS_CLEAR_PEOPLE_COUNT) {
+    vl53l1x_app_clear_people_count();
+  }
+  if (clear_mask & COUNTERS_CLEAR_ENTERED_SO_FAR) {
+    vl53l1x_app_clear_people_entered_so_far();
+  }
+  return SL_STATUS_OK;
+}
+
+static sl_status_t people_counting_write_configuration(
+  const uint8array *value)
+{
+  uint16_t timing_budget;
+  uint16_t last_timing_budget = user_config_nvm3_get_timing_budget();
+  bool notification;
+
+  if (value->len != CONFIGURATION_LEN) {
+    return SL_STATUS_BT_ATT_INVALID_ATT_LENGTH;
+  }
+  timing_budget = get_u16_le(&value->data[6]);
+  notification = value->data[10] ? true : false;
+  if ((value->data[10] > 1)
+      || (SL_STATUS_OK
+          != user_config_nvm3_set_config(get_u16_le(&value->data[0]),
+                                         get_u16_le(&value->data[2]),
+                                         get_u16_le(&value->data[4]),
+                                         timing_budget,
+                                         get_u16_le(&value->data[8]),
+                                         notification))) {
+    return SL_STATUS_BT_ATT_OUT_OF_RANGE;
+  }
+  log_info("[BLE_GATT]: Write: configuration\r\n");
+  if (timing_budget != last_timing_budget) {
+    vl53l1x_app_change_timing_budget_in_ms(timing_budget);
+  }
+  notification_status = notification;
+  return SL_STATUS_OK;
+}
+
 /***************************************************************************//**
  * Callback on timer period.
  ******************************************************************************/
@@ -507,6 +695,28 @@ static void people_counting_oled_display_callback(
   sl_bt_external_signal(PEOPLE_COUNTING_EVENT);
 }
 
+/***************************************************************************//**
+ * Callback on configuration commit timeout.
+ ******************************************************************************/
+static void people_counting_config_commit_callback(
+  sl_sleeptimer_timer_handle_t *timer, void *data)
+{
+  (void) timer;
+  (void) data;
+  sl_bt_external_signal(PEOPLE_COUNTING_CONFIG_EVENT);
+}
+
+#if VL53L1X_APP_USE_INTERRUPT
+/***************************************************************************//**
+ * Callback on sensor data ready.
+ ******************************************************************************/
+static void people_counting_sensor_data_ready_callback(uint8_t int_no)
+{
+  (void) int_no;
+  sl_bt_external_signal(PEOPLE_COUNTING_SAMPLING_EVENT);
+}
+
+#else
 /***************************************************************************//**
  * Callback on timer period.
  ******************************************************************************/
@@ -517,6 +727,7 @@ static void people_counting_sensor_sampling_callback(
   (void) data;
   sl_bt_external_signal(PEOPLE_COUNTING_SAMPLING_EVENT);
 }
+#endif
 
 /***************************************************************************//**
  * Callback on button change.
@@ -61,6 +61,7 @@
 #define TIMING_BUDGET_KEY                    (NVM3_KEY_MIN + 4)
 #define NOTIFICATION_STATUS_KEY              (NVM3_KEY_MIN + 5)
 #define ROOM_CAPACITY_KEY                    (NVM3_KEY_MIN + 6)
+#define CONFIG_KEY                           (NVM3_KEY_MIN + 7)
 
 #define PEOPLE_ENTERED_SO_FAR_VALUE_DEFAULT  (0)
 
@@ -89,24 +90,42 @@
 // Use the default nvm3 handle from nvm3_default.h
 #define NVM3_DEFAULT_HANDLE                  nvm3_defaultHandle
 
+// -----------------------------------------------------------------------------
+// Private variables
+
+// All the configuration fields are kept in RAM and stored as a single NVM3
+// object, so that several changes cost one flash write.
+typedef struct {
+  uint16_t min_distance;
+  uint16_t max_distance;
+  uint16_t distance_threshold;
+  uint16_t timing_budget;
+  uint16_t room_capacity;
+  uint8_t notification_status;
+} user_config_t;
+
+static user_config_t user_config;
+static bool user_config_dirty = false;
+
 // -----------------------------------------------------------------------------
 // Private function declarations
 static Ecode_t conf_data_u8_read(nvm3_ObjectKey_t key, uint8_t *u8_value);
 static Ecode_t conf_data_u16_read(nvm3_ObjectKey_t key, uint16_t *u16_value);
 static Ecode_t conf_data_counter_read(nvm3_ObjectKey_t key,
                                       uint32_t *u32_value);
-static Ecode_t conf_data_counter_read(nvm3_ObjectKey_t key,
-                                      uint32_t *u32_value);
-static void conf_data_u8_init(nvm3_ObjectKey_t key,
-                              uint8_t min_value,
-                              uint8_t max_value,
-                              uint8_t default_value);
-static void conf_data_u16_init(nvm3_ObjectKey_t key,
-                               uint16_t min_value,
-                               uint16_t max_value,
-                               uint16_t default_value);
+static uint8_t conf_data_u8_load(nvm3_ObjectKey_t key,
+                                 uint8_t min_value,
+                                 uint8_t max_value,
+                                 uint8_t default_value);
+static uint16_t conf_data_u16_load(nvm3_ObjectKey_t key,
+                                   uint16_t min_value,
+                                   uint16_t max_value,
+                                   uint16_t default_value);
 static void conf_counter_init(nvm3_ObjectKey_t key,
                               uint32_t default_value);
+static bool conf_is_valid(const user_config_t *config);
+static bool conf_is_equal(const user_config_t *a, const user_config_t *b);
+static void conf_legacy_load(user_config_t *config);
 
 // -----------------------------------------------------------------------------
 // Public function definitions
@@ -127,38 +146,87 @@ void user_config_nvm3_init(void)
   conf_counter_init(PEOPLE_ENTERED_SO_FAR_KEY,
                     PEOPLE_ENTERED_SO_FAR_VALUE_DEFAULT);
 
-  // Initialize the min distance config.
-  conf_data_u16_init(MIN_DISTANCE_KEY,
-                     MIN_DISTANCE_VALUE_MIN,
-                     MIN_DISTANCE_VALUE_MAX,
-                     MIN_DISTANCE_VALUE_DEFAULT);
-
-  // Initialize the max distance config.
-  conf_data_u16_init(MAX_DISTANCE_KEY,
-                     MAX_DISTANCE_VALUE_MIN,
-                     MAX_DISTANCE_VALUE_MAX,
-                     MAX_DISTANCE_VALUE_DEFAULT);
-
-  // Initialize the distance threshold config.
-  conf_data_u16_init(DISTANCE_THRESHOLD_KEY,
-                     DISTANCE_THRESHOLD_VALUE_MIN,
-                     DISTANCE_THRESHOLD_VALUE_MAX,
-                     DISTANCE_THRESHOLD_VALUE_DEFAULT);
-
-  // Initialize the timing budget config.
-  conf_data_u16_init(TIMING_BUDGET_KEY,
-                     TIMING_BUDGET_VALUE_MIN,
-                     TIMING_BUDGET_VALUE_MAX,
-                     TIMING_BUDGET_VALUE_DEFAULT);
-
-  // Initialize the notification enable config.
-  conf_data_u8_init(NOTIFICATION_STATUS_KEY, 0, 1, 1);
-
-  // Initialize the room capacity config.
-  conf_data_u16_init(ROOM_CAPACITY_KEY,
-                     ROOM_CAPACITY_VALUE_MIN,
-                     ROOM_CAPACITY_VALUE_MAX,
-                     ROOM_CAPACITY_VALUE_DEFAULT);
+  err = nvm3_readData(NVM3_DEFAULT_HANDLE,
+                      CONFIG_KEY,
+                      &user_config,
+                      sizeof(user_config));
+  if ((err == ECODE_NVM3_OK) && conf_is_valid(&user_config)) {
+    return;
+  }
+  // Move the configuration stored one field per object by earlier versions
+  // into the single configuration object.
+  conf_legacy_load(&user_config);
+  user_config_dirty = true;
+  if (user_config_nvm3_commit() == SL_STATUS_OK) {
+    nvm3_deleteObject(NVM3_DEFAULT_HANDLE, MIN_DISTANCE_KEY);
+    nvm3_deleteObject(NVM3_DEFAULT_HANDLE, MAX_DISTANCE_KEY);
+    nvm3_deleteObject(NVM3_DEFAULT_HANDLE, DISTANCE_THRESHOLD_KEY);
+    nvm3_deleteObject(NVM3_DEFAULT_HANDLE, TIMING_BUDGET_KEY);
+    nvm3_deleteObject(NVM3_DEFAULT_HANDLE, NOTIFICATION_STATUS_KEY);
+    nvm3_deleteObject(NVM3_DEFAULT_HANDLE, ROOM_CAPACITY_KEY);
+  }
+}
+
+/***************************************************************************//**
+ * Write the pending configuration changes to NVM3.
+ ******************************************************************************/
+sl_status_t user_config_nvm3_commit(void)
+{
+  Ecode_t err;
+
+  if (!user_config_dirty) {
+    return SL_STATUS_OK;
+  }
+  err = nvm3_writeData(NVM3_DEFAULT_HANDLE,
+                       CONFIG_KEY,
+                       (unsigned char *)&user_config,
+                       sizeof(user_config));
+  if (ECODE_NVM3_OK == err) {
+    user_config_dirty = false;
+    app_log("[NVM3]: Stored configuration\r\n");
+    return SL_STATUS_OK;
+  } else {
+    app_log("[NVM3_E]: Error storing configuration\r\n");
+    return SL_STATUS_FAIL;
+  }
+}
+
+/***************************************************************************//**
+ * Check if there are configuration changes not written to NVM3.
+ ******************************************************************************/
+bool user_config_nvm3_is_dirty(void)
+{
+  return user_config_dirty;
+}
+
+/***************************************************************************//**
+ * Set all the configuration fields at once.
+ ******************************************************************************/
+sl_status_t user_config_nvm3_set_config(uint16_t min_distance,
+                                        uint16_t max_distance,
+                                        uint16_t distance_threshold,
+                                        uint16_t timing_budget,
+                                        uint16_t room_capacity,
+                                        bool notification_status)
+{
+  user_config_t config = {
+    .min_distance = min_distance,
+    .max_distance = max_distance,
+    .distance_threshold = distance_threshold,
+    .timing_budget = timing_budget,
+    .room_capacity = room_capacity,
+    .notification_status = notification_status ? 1 : 0
+  };
+
+  if (!conf_is_valid(&config)) {
+    app_log("[NVM3]: Invalid configuration\r\n");
+    return SL_STATUS_INVALID_RANGE;
+  }
+  if (!conf_is_equal(&config, &user_config)) {
+    user_config = config;
+    user_config_dirty = true;
+  }
+  return SL_STATUS_OK;
 }
 
 /***************************************************************************//**
@@ -199,24 +267,17 @@ uint32_t user_config_nvm3_get_people_entered_so_far(void)
  ******************************************************************************/
 sl_status_t user_config_nvm3_set_min_distance(uint16_t distance)
 {
-  Ecode_t err;
-
   if ((distance > MAX_DISTANCE_VALUE_MAX)
       || (distance < MIN_DISTANCE_VALUE_MIN)) {
     app_log("[NVM3]: Invalid min_distance config: %d\r\n", distance);
     return SL_STATUS_INVALID_RANGE;
   }
-  err = nvm3_writeData(NVM3_DEFAULT_HANDLE,
-                       MIN_DISTANCE_KEY,
-                       (unsigned char *)&distance,
-                       sizeof(distance));
-  if (ECODE_NVM3_OK == err) {
-    app_log("[NVM3]: Stored min_distance config: %d\r\n", distance);
-    return SL_STATUS_OK;
-  } else {
-    app_log("[NVM3_E]: Error storing min_distance config\r\n");
-    return SL_STATUS_FAIL;
+  if (user_config.min_distance != distance) {
+    user_config.min_distance = distance;
+    user_config_dirty = true;
   }
+  app_log("[NVM3]: Set min_distance config: %d\r\n", distance);
+  return SL_STATUS_OK;
 }
 
 /***************************************************************************//**
@@ -224,12 +285,7 @@ sl_status_t user_config_nvm3_set_min_distance(uint16_t distance)
  ******************************************************************************/
 uint16_t user_config_nvm3_get_min_distance(void)
 {
-  uint16_t distance;
-  Ecode_t err;
-
-  err = conf_data_u16_read(MIN_DISTANCE_KEY, &distance);
-  app_assert_s(err == ECODE_NVM3_OK);
-  return distance;
+  return user_config.min_distance;
 }
 
 /***************************************************************************//**
@@ -237,24 +293,17 @@ uint16_t user_config_nvm3_get_min_distance(void)
  ******************************************************************************/
 sl_status_t user_config_nvm3_set_max_distance(uint16_t distance)
 {
-  Ecode_t err;
-
   if ((distance > MAX_DISTANCE_VALUE_MAX)
       || (distance < MAX_DISTANCE_VALUE_MIN)) {
     app_log("[NVM3]: Invalid max_distance config: %d\r\n", distance);
     return SL_STATUS_INVALID_RANGE;
   }
-  err = nvm3_writeData(NVM3_DEFAULT_HANDLE,
-                       MAX_DISTANCE_KEY,
-                       (unsigned char *)&distance,
-                       sizeof(distance));
-  if (ECODE_NVM3_OK == err) {
-    app_log("[NVM3]: Stored max_distance config: %d\r\n", distance);
-    return SL_STATUS_OK;
-  } else {
-    app_log("[NVM3_E]: Error storing max_distance config\r\n");
-    return SL_STATUS_FAIL;
+  if (user_config.max_distance != distance) {
+    user_config.max_distance = distance;
+    user_config_dirty = true;
   }
+  app_log("[NVM3]: Set max_distance config: %d\r\n", distance);
+  return SL_STATUS_OK;
 }
 
 /***************************************************************************//**
@@ -262,12 +311,7 @@ sl_status_t user_config_nvm3_set_max_distance(uint16_t distance)
  ******************************************************************************/
 uint16_t user_config_nvm3_get_max_distance(void)
 {
-  uint16_t distance;
-  Ecode_t err;
-
-  err = conf_data_u16_read(MAX_DISTANCE_KEY, &distance);
-  app_assert_s(err == ECODE_NVM3_OK);
-  return distance;
+  return user_config.max_distance;
 }
 
 /***************************************************************************//**
@@ -275,24 +319,17 @@ uint16_t user_config_nvm3_get_max_distance(void)
  ******************************************************************************/
 sl_status_t user_config_nvm3_set_distance_threshold(uint16_t distance)
 {
-  Ecode_t err;
-
   if ((distance > DISTANCE_THRESHOLD_VALUE_MAX)
       || (distance < DISTANCE_THRESHOLD_VALUE_MIN)) {
     app_log("[NVM3]: Invalid distance_threshold config: %d\r\n", distance);
     return SL_STATUS_INVALID_RANGE;
   }
-  err = nvm3_writeData(NVM3_DEFAULT_HANDLE,
-                       DISTANCE_THRESHOLD_KEY,
-                       (unsigned char *)&distance,
-                       sizeof(distance));
-  if (ECODE_NVM3_OK == err) {
-    app_log("[NVM3]: Stored distance_threshold config: %d\r\n", distance);
-    return SL_STATUS_OK;
-  } else {
-    app_log("[NVM3_E]: Error storing distance_threshold config\r\n");
-    return SL_STATUS_FAIL;
+  if (user_config.distance_threshold != distance) {
+    user_config.distance_threshold = distance;
+    user_config_dirty = true;
   }
+  app_log("[NVM3]: Set distance_threshold config: %d\r\n", distance);
+  return SL_STATUS_OK;
 }
 
 /***************************************************************************//**
@@ -300,12 +337,7 @@ sl_status_t user_config_nvm3_set_distance_threshold(uint16_t distance)
  ******************************************************************************/
 uint16_t user_config_nvm3_get_distance_threshold(void)
 {
-  uint16_t distance;
-  Ecode_t err;
-
-  err = conf_data_u16_read(DISTANCE_THRESHOLD_KEY, &distance);
-  app_assert_s(err == ECODE_NVM3_OK);
-  return distance;
+  return user_config.distance_threshold;
 }
 
 /***************************************************************************//**
@@ -313,24 +345,17 @@ uint16_t user_config_nvm3_get_distance_threshold(void)
  ******************************************************************************/
 sl_status_t user_config_nvm3_set_timing_budget(uint16_t timing_budget)
 {
-  Ecode_t err;
-
   if ((timing_budget > TIMING_BUDGET_VALUE_MAX)
       || (timing_budget < TIMING_BUDGET_VALUE_MIN)) {
     app_log("[NVM3]: Invalid timing_budget config: %d\r\n", timing_budget);
     return SL_STATUS_INVALID_RANGE;
   }
-  err = nvm3_writeData(NVM3_DEFAULT_HANDLE,
-                       TIMING_BUDGET_KEY,
-                       (unsigned char *)&timing_budget,
-                       sizeof(timing_budget));
-  if (ECODE_NVM3_OK == err) {
-    app_log("[NVM3]: Stored timing_budget config: %d\r\n", timing_budget);
-    return SL_STATUS_OK;
-  } else {
-    app_log("[NVM3_E]: Error storing timing_budget config\r\n");
-    return SL_STATUS_FAIL;
+  if (user_config.timing_budget != timing_budget) {
+    user_config.timing_budget = timing_budget;
+    user_config_dirty = true;
   }
+  app_log("[NVM3]: Set timing_budget config: %d\r\n", timing_budget);
+  return SL_STATUS_OK;
 }
 
 /***************************************************************************//**
@@ -338,12 +363,7 @@ sl_status_t user_config_nvm3_set_timing_budget(uint16_t timing_budget)
  ******************************************************************************/
 uint16_t user_config_nvm3_get_timing_budget(void)
 {
-  uint16_t timing_budget;
-  Ecode_t err;
-
-  err = conf_data_u16_read(TIMING_BUDGET_KEY, &timing_budget);
-  app_assert_s(err == ECODE_NVM3_OK);
-  return timing_budget;
+  return user_config.timing_budget;
 }
 
 /***************************************************************************//**
@@ -352,19 +372,13 @@ uint16_t user_config_nvm3_get_timing_budget(void)
 sl_status_t user_config_nvm3_set_notification_status(bool enable)
 {
   uint8_t data = enable ? 1:0;
-  Ecode_t err;
 
-  err = nvm3_writeData(NVM3_DEFAULT_HANDLE,
-                       NOTIFICATION_STATUS_KEY,
-                       (unsigned char *)&data,
-                       sizeof(data));
-  if (ECODE_NVM3_OK == err) {
-    app_log("[NVM3]: Stored notification_status config: %d\r\n", data);
-    return SL_STATUS_OK;
-  } else {
-    app_log("[NVM3_E]: Error storing notification_status config\r\n");
-    return SL_STATUS_FAIL;
+  if (user_config.notification_status != data) {
+    user_config.notification_status = data;
+    user_config_dirty = true;
   }
+  app_log("[NVM3]: Set notification_status config: %d\r\n", data);
+  return SL_STATUS_OK;
 }
 
 /***************************************************************************//**
@@ -372,12 +386,7 @@ sl_status_t user_config_nvm3_set_notification_status(bool enable)
  ******************************************************************************/
 bool user_config_nvm3_get_notification_status(void)
 {
-  Ecode_t err;
-  uint8_t notification_status;
-
-  err = conf_data_u8_read(NOTIFICATION_STATUS_KEY, &notification_status);
-  app_assert_s(err == ECODE_NVM3_OK);
-  return notification_status == 0 ? false:true;
+  return user_config.notification_status == 0 ? false:true;
 }
 
 /***************************************************************************//**
@@ -385,24 +394,17 @@ bool user_config_nvm3_get_notification_status(void)
  ******************************************************************************/
 sl_status_t user_config_nvm3_set_room_capacity(uint16_t room_capacity)
 {
-  Ecode_t err;
-
   if ((room_capacity > ROOM_CAPACITY_VALUE_MAX)
       || (room_capacity < ROOM_CAPACITY_VALUE_MIN)) {
     app_log("[NVM3]: Invalid room_capacity config: %d\r\n", room_capacity);
     return SL_STATUS_INVALID_RANGE;
   }
-  err = nvm3_writeData(NVM3_DEFAULT_HANDLE,
-                       ROOM_CAPACITY_KEY,
-                       (unsigned char *)&room_capacity,
-                       sizeof(room_capacity));
-  if (ECODE_NVM3_OK == err) {
-    app_log("[NVM3]: Stored room_capacity config: %d\r\n", room_capacity);
-    return SL_STATUS_OK;
-  } else {
-    app_log("[NVM3_E]: Error storing room_capacity config\r\n");
-    return SL_STATUS_FAIL;
+  if (user_config.room_capacity != room_capacity) {
+    user_config.room_capacity = room_capacity;
+    user_config_dirty = true;
   }
+  app_log("[NVM3]: Set room_capacity config: %d\r\n", room_capacity);
+  return SL_STATUS_OK;
 }
 
 /***************************************************************************//**
@@ -410,12 +412,7 @@ sl_status_t user_config_nvm3_set_room_capacity(uint16_t room_capacity)
  ******************************************************************************/
 uint16_t user_config_nvm3_get_room_capacity(void)
 {
-  uint16_t room_capacity;
-  Ecode_t err;
-
-  err = conf_data_u16_read(ROOM_CAPACITY_KEY, &room_capacity);
-  app_assert_s(err == ECODE_NVM3_OK);
-  return room_capacity;
+  return user_config.room_capacity;
 }
 
 // -----------------------------------------------------------------------------
@@ -491,52 +488,38 @@ static Ecode_t conf_data_counter_read(nvm3_ObjectKey_t key, uint32_t *u32_value)
   return ECODE_NVM3_ERR_OBJECT_IS_NOT_A_COUNTER;
 }
 
-static void conf_data_u8_init(nvm3_ObjectKey_t key,
-                              uint8_t min_value,
-                              uint8_t max_value,
-                              uint8_t default_value)
+static uint8_t conf_data_u8_load(nvm3_ObjectKey_t key,
+                                 uint8_t min_value,
+                                 uint8_t max_value,
+                                 uint8_t default_value)
 {
   Ecode_t err;
   uint8_t read_value;
 
-  // check if the designated keys contain data, and initialize if needed.
   err = conf_data_u8_read(key, &read_value);
   if ((err == ECODE_NVM3_OK)
       && (read_value >= min_value)
       && (read_value <= max_value)) {
-    return;
-  } else {
-    nvm3_deleteObject(NVM3_DEFAULT_HANDLE, key);
+    return read_value;
   }
-  // Write default value
-  err = nvm3_writeData(NVM3_DEFAULT_HANDLE,
-                       key,
-                       (unsigned char *)&default_value,
-                       sizeof(default_value));
+  return default_value;
 }
 
-static void conf_data_u16_init(nvm3_ObjectKey_t key,
-                               uint16_t min_value,
-                               uint16_t max_value,
-                               uint16_t default_value)
+static uint16_t conf_data_u16_load(nvm3_ObjectKey_t key,
+                                   uint16_t min_value,
+                                   uint16_t max_value,
+                                   uint16_t default_value)
 {
   Ecode_t err;
   uint16_t read_value;
 
-  // check if the designated keys contain data, and initialize if needed.
   err = conf_data_u16_read(key, &read_value);
   if ((err == ECODE_NVM3_OK)
       && (read_value >= min_value)
       && (read_value <= max_value)) {
-    return;
-  } else {
-    nvm3_deleteObject(NVM3_DEFAULT_HANDLE, key);
+    return read_value;
   }
-  // Write default value
-  err = nvm3_writeData(NVM3_DEFAULT_HANDLE,
-                       key,
-                       (unsigned char *)&default_value,
-                       sizeof(default_value));
+  return default_value;
 }
 
 static void conf_counter_init(nvm3_ObjectKey_t key,
@@ -558,4 +541,60 @@ static void conf_counter_init(nvm3_ObjectKey_t key,
                           default_value);
 }
 
+static bool conf_is_valid(const user_config_t *config)
+{
+  // The default min distance is 0, which only disables the lower bound.
+  return (config->min_distance <= MIN_DISTANCE_VALUE_MAX)
+         && (config->max_distance >= MAX_DISTANCE_VALUE_MIN)
+         && (config->max_distance <= MAX_DISTANCE_VALUE_MAX)
+         && (config->distance_threshold >= DISTANCE_THRESHOLD_VALUE_MIN)
+         && (config->distance_threshold <= DISTANCE_THRESHOLD_VALUE_MAX)
+         && (config->timing_budget >= TIMING_BUDGET_VALUE_MIN)
+         && (config->timing_budget <= TIMING_BUDGET_VALUE_MAX)
+         && (config->room_capacity >= ROOM_CAPACITY_VALUE_MIN)
+         && (config->room_capacity <= ROOM_CAPACITY_VALUE_MAX)
+         && (config->notification_status <= 1);
+}
+
+// Compared field by field, the padding of the struct is not initialized.
+static bool conf_is_equal(const user_config_t *a, const user_config_t *b)
+{
+  return (a->min_distance == b->min_distance)
+         && (a->max_distance == b->max_distance)
+         && (a->distance_threshold == b->distance_threshold)
+         && (a->timing_budget == b->timing_budget)
+         && (a->room_capacity == b->room_capacity)
+         && (a->notification_status == b->notification_status);
+}
+
+static void conf_legacy_load(user_config_t *config)
+{
+  config->min_distance = conf_data_u16_load(MIN_DISTANCE_KEY,
+                                            MIN_DISTANCE_VALUE_MIN,
+                                            MIN_DISTANCE_VALUE_MAX,
+                                            MIN_DISTANCE_VALUE_DEFAULT);
+  config->max_distance = conf_data_u16_load(MAX_DISTANCE_KEY,
+                                            MAX_DISTANCE_VALUE_MIN,
+                                            MAX_DISTANCE_VALUE_MAX,
+                                            MAX_DISTANCE_VALUE_DEFAULT);
+  config->distance_threshold =
+    conf_data_u16_load(DISTANCE_THRESHOLD_KEY,
+                       DISTANCE_THRESHOLD_VALUE_MIN,
+                       DISTANCE_THRESHOLD_VALUE_MAX,
+                       DISTANCE_THRESHOLD_VALUE_DEFAULT);
+  config->timing_budget = conf_data_u16_load(TIMING_BUDGET_KEY,
+                                             TIMING_BUDGET_VALUE_MIN,
+                                             TIMING_BUDGET_VALUE_MAX,
+                                             TIMING_BUDGET_VALUE_DEFAULT);
+  config->notification_status =
+    conf_data_u8_load(NOTIFICATION_STATUS_KEY,
+                      0,
+                      1,
+                      NOTIFICATION_STATUS_DEFAULT);
+  config->room_capacity = conf_data_u16_load(ROOM_CAPACITY_KEY,
+                                             ROOM_CAPACITY_VALUE_MIN,
+                                             ROOM_CAPACITY_VALUE_MAX,
+                                             ROOM_CAPACITY_VALUE_DEFAULT);
+}
+
 /** @} (end group user_config_nvm3) */
@@ -43,6 +43,7 @@
 #include "sparkfun_vl53l1x_config.h"
 #include "sl_i2cspm_instances.h"
 #include "sl_sleeptimer.h"
+#include "sl_i2cspm.h"
 
 // -----------------------------------------------------------------------------
 // Led
@@ -87,6 +88,14 @@
 #define PATTERN_ZONE_LEFT         (1 << 0)
 #define PATTERN_ZONE_RIGHT        (1 << 1)
 
+// VL53L1X register read by the burst transfer
+#define REG_RESULT_RANGE_STATUS   0x0089 // start of the result block
+
+// Result block read in one transaction, 0x0089 to 0x0099
+#define RESULT_BLOCK_SIZE         17
+#define RESULT_RANGE_STATUS       0
+#define RESULT_DISTANCE           13
+
 enum ZONE_STATUS {
   NOBODY,
   SOMEONE
@@ -127,6 +136,18 @@ static uint32_t people_entered_so_far;
 
 static uint16_t distance_threshold;
 
+// Achieved sampling rate
+static uint32_t sample_count = 0;
+static uint32_t sample_window_start = 0;
+static uint16_t samples_per_second = 0;
+
+// Raw range status to VL53L1_RANGESTATUS_* as returned by the driver
+static const uint8_t range_status_rtn[24] = {
+  255, 255, 255, 5, 2, 4, 1, 7, 3, 0,
+  255, 255, 9, 13, 255, 255, 255, 255, 10, 6,
+  255, 255, 11, 12
+};
+
 static path_track_state_t path_track_state = {
   .last_zone_status_left = NOBODY,
   .last_zone_status_right = NOBODY,
@@ -138,6 +159,8 @@ static path_track_state_t path_track_state = {
 // Private function declarations
 
 static uint16_t recalculate_distance(uint16_t distance, uint8_t range_status);
+static sl_status_t read_registers(uint16_t reg, uint8_t *data, uint16_t len);
+static void update_samples_per_second(void);
 static void change_timing_budget(uint16_t timing_budget);
 static uint16_t process_people_counting_data(int16_t distance, enum ZONE zone);
 static enum ZONE_EVENT update_path_track_state(path_track_state_t *pt_state,
@@ -209,6 +232,12 @@ void vl53l1x_app_init(void)
   sc = vl53l1x_set_roi_xy(VL53L1X_ADDR, 8, 16);
   app_assert_status(sc);
 
+#if VL53L1X_APP_USE_INTERRUPT
+  // GPIO1 goes high when a new ranging result is available
+  sc = vl53l1x_set_interrupt_polarity(VL53L1X_ADDR, 1);
+  app_assert_status(sc);
+#endif
+
   // Start ranging
   app_log("=============== Start counting people ================\r\n");
   sc = vl53l1x_start_ranging(VL53L1X_ADDR);
@@ -220,40 +249,58 @@ void vl53l1x_app_init(void)
  ******************************************************************************/
 void vl53l1x_app_process_action(void)
 {
-  uint8_t is_data_ready = 0;
+  uint8_t result[RESULT_BLOCK_SIZE];
   uint8_t range_status = 0;
   uint16_t distance = 0;
-  uint16_t signal_per_spad;
+  enum ZONE sampled_zone = (enum ZONE)zone;
   sl_status_t sc;
 
+#if !VL53L1X_APP_USE_INTERRUPT
+  uint8_t is_data_ready = 0;
+
   sc = vl53l1x_check_for_data_ready(VL53L1X_ADDR, &is_data_ready);
   app_assert_status(sc);
-  if (is_data_ready) {
-    sc = vl53l1x_get_range_status(VL53L1X_ADDR, &range_status);
-    app_assert_status(sc);
-
-    sc = vl53l1x_get_distance(VL53L1X_ADDR, &distance);
-    app_assert_status(sc);
-    measured_distance = distance;
+  if (!is_data_ready) {
+    return;
+  }
+#endif
 
-    sc = vl53l1x_get_signal_per_spad(VL53L1X_ADDR, &signal_per_spad);
-    app_assert_status(sc);
+  // Range status and distance in one burst read
+  sc = read_registers(REG_RESULT_RANGE_STATUS, result, sizeof(result));
+  app_assert_status(sc);
 
-    sc = vl53l1x_clear_interrupt(VL53L1X_ADDR);
-    app_assert_status(sc);
+  range_status = result[RESULT_RANGE_STATUS] & 0x1F;
+  if (range_status < sizeof(range_status_rtn)) {
+    range_status = range_status_rtn[range_status];
+  }
+  distance = (result[RESULT_DISTANCE] << 8) | result[RESULT_DISTANCE + 1];
+  measured_distance = distance;
+
+  // Switch to the other zone, then clear the interrupt. The next ranging
+  // starts with the new ROI as soon as the interrupt is cleared. The ROI
+  // size is the same for both zones, only the center (0x007F) is written.
+  zone++;
+  zone %= 2;
+  sc = vl53l1x_set_roi_center(VL53L1X_ADDR, roi_center[zone]);
+  app_assert_status(sc);
+  sc = vl53l1x_clear_interrupt(VL53L1X_ADDR);
+  app_assert_status(sc);
 
-    // re-calculate distance base on range status
-    distance = recalculate_distance(distance, range_status);
+  // re-calculate distance base on range status
+  distance = recalculate_distance(distance, range_status);
 
-    // add new ranged distance sample to the people counting algorithm
-    people_count = process_people_counting_data(distance, zone);
+  // add new ranged distance sample to the people counting algorithm
+  people_count = process_people_counting_data(distance, sampled_zone);
 
-    zone++;
-    zone %= 2;
+  update_samples_per_second();
+}
 
-    sc = vl53l1x_set_roi_center(VL53L1X_ADDR, roi_center[zone]);
-    app_assert_status(sc);
-  }
+/***************************************************************************//**
+ * VL53L1X Get Samples Per Second.
+ ******************************************************************************/
+uint16_t vl53l1x_app_get_samples_per_second(void)
+{
+  return samples_per_second;
 }
 
 /***************************************************************************//**
@@ -316,6 +363,37 @@ sl_status_t vl53l1x_app_change_timing_budget_in_ms(uint16_t timing_budget)
 
 // -----------------------------------------------------------------------------
 // Private function
+static sl_status_t read_registers(uint16_t reg, uint8_t *data, uint16_t len)
+{
+  I2C_TransferSeq_TypeDef seq;
+  uint8_t index[2] = { (uint8_t)(reg >> 8), (uint8_t)reg };
+
+  seq.addr = VL53L1X_ADDR;
+  seq.flags = I2C_FLAG_WRITE_READ;
+  seq.buf[0].data = index;
+  seq.buf[0].len = sizeof(index);
+  seq.buf[1].data = data;
+  seq.buf[1].len = len;
+  if (I2CSPM_Transfer(sl_i2cspm_qwiic, &seq) != i2cTransferDone) {
+    return SL_STATUS_TRANSMIT;
+  }
+  return SL_STATUS_OK;
+}
+
+static void update_samples_per_second(void)
+{
+  uint32_t now = sl_sleeptimer_get_tick_count();
+  uint32_t elapsed_ms;
+
+  sample_count++;
+  elapsed_ms = sl_sleeptimer_tick_to_ms(now - sample_window_start);
+  if (elapsed_ms >= 1000) {
+    samples_per_second = (uint16_t)(sample_count * 1000 / elapsed_ms);
+    sample_count = 0;
+    sample_window_start = now;
+  }
+}
+
 static uint16_t recalculate_distance(uint16_t distance, uint8_t range_status)
 {
   switch (range_status) {
@@ -19,6 +19,7 @@
 #define APP_H
 #include <stdint.h>
 #include <stddef.h>
+#include "session_resume.h"
 
 /**************************************************************************//**
  * Application Init.
@@ -51,6 +52,11 @@ typedef enum {
   send_challenge_response,
   read_server_ecdh_public_key,
   send_client_ecdh_public_key,
+  read_session_ticket,
+  resume_session,
+  read_resume_response,
+  read_test_data,
+  enable_secure_stream,
   running,
   idle
 } conn_state_t;
@@ -70,6 +76,9 @@ enum {device_certificate,
       server_ecdh_pub_key,
       client_ecdh_pub_key,
       test_data,
+      session_ticket,
+      session_resume,
+      secure_stream,
       nCharacteristics};
 
 typedef struct {
@@ -100,6 +109,10 @@ struct secure_attest_data_t {
   size_t  root_cert_actual_size;
   uint8_t challenge[16];
   uint8_t response[64];
+  uint8_t device_cert_hash[32];
+  uint8_t session_ticket[SESSION_TICKET_SIZE];
+  uint8_t client_nonce[SESSION_NONCE_SIZE];
+  uint8_t resume_response[SESSION_RESUME_RESPONSE_SIZE];
 };
 
 /* Application config section*/
@@ -174,6 +187,15 @@ struct secure_attest_data_t {
 #define TEST_DATA_UUID                 { 0x6e, 0x1e, 0x74, 0x11, 0xe3, 0xef, \
                                          0x19, 0xbd, 0xb6, 0x40, 0x87, 0xae, \
                                          0x7a, 0xbe, 0xdf, 0xc9 }
+#define SESSION_TICKET_UUID            { 0xa5, 0xde, 0xc7, 0x0f, 0x50, 0xb5, \
+                                         0xcb, 0xbe, 0xb5, 0x4a, 0xde, 0xe3, \
+                                         0x5e, 0x55, 0x66, 0xab }
+#define SESSION_RESUME_UUID            { 0x5d, 0xe7, 0xb4, 0x60, 0x19, 0x1e, \
+                                         0x95, 0xb9, 0x5c, 0x4f, 0xf9, 0x77, \
+                                         0xb8, 0xdd, 0xe9, 0x2a }
+#define SECURE_STREAM_UUID             { 0xfd, 0x1a, 0x0f, 0x34, 0xef, 0xf1, \
+                                         0x4b, 0x8b, 0xd9, 0x4c, 0x3c, 0x2c, \
+                                         0xa1, 0x24, 0xa8, 0x42 }
 
 extern const uint8_t factory[];
 extern const uint8_t root[];
@@ -0,0 +1,151 @@
+/***************************************************************************//**
+ * @file cert_cache.h
+ * @brief Cache of verified server device certificates.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+
+#ifndef CERT_CACHE_H_
+#define CERT_CACHE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "psa/crypto.h"
+#include "sl_status.h"
+#include "session_resume.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Number of servers remembered, the least recently verified one is replaced
+#define CERT_CACHE_SLOTS              4
+// NVM3 object of each slot
+#define CERT_CACHE_NVM3_KEY(slot)     (NVM3_KEY_MIN + (slot))
+// Persistent PSA key holding the resumption secret of each slot
+#define CERT_CACHE_SECRET_KEY_ID(slot) ((psa_key_id_t)(0x8100 + (slot)))
+
+#define CERT_CACHE_HASH_SIZE          32
+#define CERT_CACHE_PUBLIC_KEY_SIZE    65
+
+/// Server whose certificate chain has been verified
+typedef struct {
+  uint32_t sequence;                              ///< Higher is more recent
+  uint8_t cert_hash[CERT_CACHE_HASH_SIZE];        ///< SHA-256 of the DER
+                                                  ///< device certificate
+  uint8_t public_key[CERT_CACHE_PUBLIC_KEY_SIZE]; ///< Device public key,
+                                                  ///< uncompressed point
+  uint8_t ticket_valid;                           ///< Ticket and secret key
+                                                  ///< can be used to resume
+  uint8_t ticket[SESSION_TICKET_SIZE];            ///< Last session ticket
+} cert_cache_entry_t;
+
+/***************************************************************************//**
+ * @brief
+ *    Load the cache from NVM3.
+ ******************************************************************************/
+void cert_cache_init(void);
+
+/***************************************************************************//**
+ * @brief
+ *    Look up a device certificate.
+ *
+ * @param[in] cert_hash
+ *    SHA-256 of the DER device certificate.
+ *
+ * @return
+ *    The cached entry, or NULL if the certificate has not been verified yet.
+ ******************************************************************************/
+const cert_cache_entry_t *cert_cache_find(const uint8_t *cert_hash);
+
+/***************************************************************************//**
+ * @brief
+ *    Remember a device certificate whose chain has been verified. Any ticket
+ *    of the slot reused is dropped.
+ *
+ * @param[in] cert_hash
+ *    SHA-256 of the DER device certificate.
+ * @param[in] public_key
+ *    Public key of the device certificate, uncompressed point.
+ *
+ * @return
+ *    The stored entry.
+ ******************************************************************************/
+const cert_cache_entry_t *cert_cache_store(const uint8_t *cert_hash,
+                                           const uint8_t *public_key);
+
+/***************************************************************************//**
+ * @brief
+ *    Save the session ticket of a server, with the resumption secret.
+ *
+ * @param[in] entry
+ *    Cached entry of the server.
+ * @param[in] ticket
+ *    Ticket, SESSION_TICKET_SIZE bytes.
+ * @param[in] secret
+ *    Resumption secret, SESSION_SECRET_SIZE bytes, stored as a persistent
+ *    PSA key.
+ *
+ * @return
+ *    @ref SL_STATUS_OK on success, an error code otherwise.
+ ******************************************************************************/
+sl_status_t cert_cache_set_ticket(const cert_cache_entry_t *entry,
+                                  const uint8_t *ticket,
+                                  const uint8_t *secret);
+
+/***************************************************************************//**
+ * @brief
+ *    Forget the session ticket of a server, after it has been rejected. The
+ *    certificate stays cached.
+ *
+ * @param[in] entry
+ *    Cached entry of the server.
+ ******************************************************************************/
+void cert_cache_drop_ticket(const cert_cache_entry_t *entry);
+
+/***************************************************************************//**
+ * @brief
+ *    Get the resumption secret key of a server.
+ *
+ * @param[in] entry
+ *    Cached entry of the server, with a valid ticket.
+ *
+ * @return
+ *    Persistent PSA key of the resumption secret.
+ ******************************************************************************/
+psa_key_id_t cert_cache_secret_key(const cert_cache_entry_t *entry);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CERT_CACHE_H_ */
@@ -0,0 +1,178 @@
+/***************************************************************************//**
+ * @file secure_channel.h
+ * @brief Record layer of the secure channel.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+
+#ifndef SECURE_CHANNEL_H_
+#define SECURE_CHANNEL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "psa/crypto.h"
+#include "sl_status.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Record: flags, 32-bit sequence number (little endian), ciphertext, CCM tag
+#define SECURE_CHANNEL_HEADER_SIZE    5
+#define SECURE_CHANNEL_TAG_SIZE       16
+#define SECURE_CHANNEL_OVERHEAD       (SECURE_CHANNEL_HEADER_SIZE \
+                                       + SECURE_CHANNEL_TAG_SIZE)
+// Largest record, one notification with the maximum ATT MTU of 247
+#define SECURE_CHANNEL_RECORD_MAX     244
+#define SECURE_CHANNEL_PAYLOAD_MAX    (SECURE_CHANNEL_RECORD_MAX \
+                                       - SECURE_CHANNEL_OVERHEAD)
+// Record flags
+#define SECURE_CHANNEL_FLAG_LAST      0x01  ///< Last record of a stream
+
+/// Side of the channel, each side has its own nonce space
+typedef enum {
+  SECURE_CHANNEL_SERVER = 0,
+  SECURE_CHANNEL_CLIENT = 1
+} secure_channel_role_t;
+
+/// State of one secure channel
+typedef struct {
+  psa_key_id_t key;         ///< AES-CCM record key, not owned
+  uint8_t tx_direction;     ///< Direction byte of the nonces we send
+  uint32_t tx_sequence;     ///< Sequence number of the next record we send
+  uint32_t rx_sequence;     ///< Lowest sequence number still accepted
+} secure_channel_t;
+
+/***************************************************************************//**
+ * @brief
+ *    Start a secure channel on a record key. Both sides count the records
+ *    from 0, so a new record key needs a new channel.
+ *
+ * @param[out] channel
+ *    Channel.
+ * @param[in] key
+ *    Record key, AES with PSA_ALG_CCM. It must stay valid while the channel
+ *    is in use, and must not be used with any other nonces.
+ * @param[in] role
+ *    Own side of the channel.
+ ******************************************************************************/
+void secure_channel_init(secure_channel_t *channel,
+                         psa_key_id_t key,
+                         secure_channel_role_t role);
+
+/***************************************************************************//**
+ * @brief
+ *    Largest payload of a record that fits one notification.
+ *
+ * @param[in] mtu
+ *    ATT MTU of the connection.
+ *
+ * @return
+ *    Payload size in bytes, 0 if the MTU is too small for a record.
+ ******************************************************************************/
+size_t secure_channel_payload_size(uint16_t mtu);
+
+/***************************************************************************//**
+ * @brief
+ *    Encrypt and authenticate a payload into the next record. The header is
+ *    authenticated as additional data.
+ *
+ * @param[in,out] channel
+ *    Channel.
+ * @param[in] flags
+ *    Record flags.
+ * @param[in] payload
+ *    Payload.
+ * @param[in] len
+ *    Length of the payload.
+ * @param[out] record
+ *    Record, len + SECURE_CHANNEL_OVERHEAD bytes.
+ * @param[in] record_size
+ *    Size of the record buffer.
+ * @param[out] record_len
+ *    Length of the record.
+ *
+ * @return
+ *    @ref SL_STATUS_OK on success, @ref SL_STATUS_WOULD_OVERFLOW if the
+ *    record buffer is too small or the sequence numbers ran out, or
+ *    @ref SL_STATUS_FAIL if the encryption failed.
+ ******************************************************************************/
+sl_status_t secure_channel_seal(secure_channel_t *channel,
+                                uint8_t flags,
+                                const uint8_t *payload,
+                                size_t len,
+                                uint8_t *record,
+                                size_t record_size,
+                                size_t *record_len);
+
+/***************************************************************************//**
+ * @brief
+ *    Check and decrypt a record of the other side. Records must arrive with
+ *    increasing sequence numbers; a record that is replayed, or older than
+ *    the last accepted one, is rejected. A rejected record does not change
+ *    the channel.
+ *
+ * @param[in,out] channel
+ *    Channel.
+ * @param[in] record
+ *    Record.
+ * @param[in] record_len
+ *    Length of the record.
+ * @param[out] flags
+ *    Record flags.
+ * @param[out] payload
+ *    Payload, record_len - SECURE_CHANNEL_OVERHEAD bytes.
+ * @param[in] payload_size
+ *    Size of the payload buffer.
+ * @param[out] payload_len
+ *    Length of the payload.
+ *
+ * @return
+ *    @ref SL_STATUS_OK on success, @ref SL_STATUS_INVALID_PARAMETER for a
+ *    truncated record, @ref SL_STATUS_WOULD_OVERFLOW if the payload buffer
+ *    is too small, @ref SL_STATUS_ALREADY_EXISTS for a replayed record or
+ *    @ref SL_STATUS_INVALID_SIGNATURE if the record is not authentic.
+ ******************************************************************************/
+sl_status_t secure_channel_open(secure_channel_t *channel,
+                                const uint8_t *record,
+                                size_t record_len,
+                                uint8_t *flags,
+                                uint8_t *payload,
+                                size_t payload_size,
+                                size_t *payload_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SECURE_CHANNEL_H_ */
@@ -0,0 +1,211 @@
+/***************************************************************************//**
+ * @file session_resume.h
+ * @brief Session resumption tickets and key derivation.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+
+#ifndef SESSION_RESUME_H_
+#define SESSION_RESUME_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "psa/crypto.h"
+#include "sl_status.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SESSION_SECRET_SIZE           32
+#define SESSION_NONCE_SIZE            16
+#define SESSION_PROOF_SIZE            16
+#define SESSION_TICKET_NONCE_SIZE     13
+#define SESSION_TICKET_TAG_SIZE       16
+
+// Ticket: CCM nonce, then the resumption secret sealed with the ticket key
+#define SESSION_TICKET_SIZE           (SESSION_TICKET_NONCE_SIZE   \
+                                       + SESSION_SECRET_SIZE       \
+                                       + SESSION_TICKET_TAG_SIZE)
+// Resume request, written by the client: ticket, then the client nonce
+#define SESSION_RESUME_REQUEST_SIZE   (SESSION_TICKET_SIZE + SESSION_NONCE_SIZE)
+// Resume response, read by the client: server nonce, then the server proof
+#define SESSION_RESUME_RESPONSE_SIZE  (SESSION_NONCE_SIZE + SESSION_PROOF_SIZE)
+// ATT application error returned by the server for a ticket it can not open
+#define SESSION_RESUME_ATT_ERROR      0x80
+
+/***************************************************************************//**
+ * @brief
+ *    Derive the resumption secret from the ECDH shared secret of a full
+ *    handshake, with HKDF-SHA256. The session key of the full handshake is
+ *    derived differently, so it can not be recovered from this secret.
+ *
+ * @param[in] shared_secret
+ *    ECDH shared secret.
+ * @param[in] len
+ *    Length of the shared secret.
+ * @param[out] secret
+ *    Resumption secret, SESSION_SECRET_SIZE bytes.
+ *
+ * @return
+ *    Status of the PSA operation.
+ ******************************************************************************/
+sl_status_t session_secret_derive(const uint8_t *shared_secret,
+                                  size_t len,
+                                  uint8_t *secret);
+
+/***************************************************************************//**
+ * @brief
+ *    Derive the record layer key of a full handshake from the ECDH shared
+ *    secret, with HKDF-SHA256. The secure channel seals its records with
+ *    this key only, so its counter nonces never meet the random nonces used
+ *    with the session key.
+ *
+ * @param[in] shared_secret
+ *    ECDH shared secret.
+ * @param[in] len
+ *    Length of the shared secret.
+ * @param[out] record_key
+ *    Volatile AES-CCM record key.
+ *
+ * @return
+ *    Status of the PSA operation.
+ ******************************************************************************/
+sl_status_t session_record_key_derive(const uint8_t *shared_secret,
+                                      size_t len,
+                                      psa_key_id_t *record_key);
+
+/***************************************************************************//**
+ * @brief
+ *    Import a resumption secret as an HKDF key.
+ *
+ * @param[in] secret
+ *    Resumption secret, SESSION_SECRET_SIZE bytes.
+ * @param[in,out] key_id
+ *    Key identifier. Input for a persistent key, output for a volatile one.
+ * @param[in] lifetime
+ *    PSA_KEY_LIFETIME_VOLATILE or PSA_KEY_LIFETIME_PERSISTENT.
+ *
+ * @return
+ *    Status of the PSA operation.
+ ******************************************************************************/
+sl_status_t session_secret_import(const uint8_t *secret,
+                                  psa_key_id_t *key_id,
+                                  psa_key_lifetime_t lifetime);
+
+/***************************************************************************//**
+ * @brief
+ *    Create the volatile AES-CCM key that seals the tickets of this server.
+ *    Tickets sealed with a previous key, i.e. before a reset, are rejected.
+ *
+ * @param[out] ticket_key
+ *    Ticket key.
+ *
+ * @return
+ *    Status of the PSA operation.
+ ******************************************************************************/
+sl_status_t session_ticket_key_create(psa_key_id_t *ticket_key);
+
+/***************************************************************************//**
+ * @brief
+ *    Seal a resumption secret into a ticket. The server keeps no state per
+ *    ticket, the client presents the ticket when it resumes.
+ *
+ * @param[in] ticket_key
+ *    Ticket key.
+ * @param[in] secret
+ *    Resumption secret, SESSION_SECRET_SIZE bytes.
+ * @param[out] ticket
+ *    Ticket, SESSION_TICKET_SIZE bytes.
+ *
+ * @return
+ *    Status of the PSA operation.
+ ******************************************************************************/
+sl_status_t session_ticket_seal(psa_key_id_t ticket_key,
+                                const uint8_t *secret,
+                                uint8_t *ticket);
+
+/***************************************************************************//**
+ * @brief
+ *    Open a ticket and recover the resumption secret.
+ *
+ * @param[in] ticket_key
+ *    Ticket key.
+ * @param[in] ticket
+ *    Ticket, SESSION_TICKET_SIZE bytes.
+ * @param[out] secret
+ *    Resumption secret, SESSION_SECRET_SIZE bytes.
+ *
+ * @return
+ *    @ref SL_STATUS_OK on success, @ref SL_STATUS_INVALID_SIGNATURE if the
+ *    ticket was not sealed with this ticket key or was modified.
+ ******************************************************************************/
+sl_status_t session_ticket_open(psa_key_id_t ticket_key,
+                                const uint8_t *ticket,
+                                uint8_t *secret);
+
+/***************************************************************************//**
+ * @brief
+ *    Derive the AES-CCM session key of a resumed session, the proof that
+ *    the server knows the resumption secret and the record layer key. All
+ *    come from HKDF-SHA256 over the resumption secret, salted with the
+ *    nonces of both sides, so every resumed session gets fresh keys without
+ *    a new ECDH.
+ *
+ * @param[in] secret_key
+ *    Resumption secret, imported with session_secret_import().
+ * @param[in] client_nonce
+ *    Client nonce, SESSION_NONCE_SIZE bytes.
+ * @param[in] server_nonce
+ *    Server nonce, SESSION_NONCE_SIZE bytes.
+ * @param[out] session_key
+ *    Volatile AES-CCM session key.
+ * @param[out] proof
+ *    Server proof, SESSION_PROOF_SIZE bytes.
+ * @param[out] record_key
+ *    Volatile AES-CCM record key of the secure channel.
+ *
+ * @return
+ *    Status of the PSA operation.
+ ******************************************************************************/
+sl_status_t session_resume_derive(psa_key_id_t secret_key,
+                                  const uint8_t *client_nonce,
+                                  const uint8_t *server_nonce,
+                                  psa_key_id_t *session_key,
+                                  uint8_t *proof,
+                                  psa_key_id_t *record_key);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SESSION_RESUME_H_ */
@@ -53,6 +53,10 @@
 #include "mbedtls/x509_crt.h"
 #include "mbedtls/pk.h"
 #include "ecdh_util.h"
+#include "session_resume.h"
+#include "secure_channel.h"
+#include "cert_cache.h"
+#include "sl_sleeptimer.h"
 
 #if SL_BT_CONFIG_MAX_CONNECTIONS < 1
 #error At least 1 connection has to be enabled!
@@ -83,7 +87,10 @@ static const uint8_t characteristic_uuids[nCharacteristics][16] =
   SERVER_CHALLENGE_RESPONSE_UUID,
   SERVER_ECDH_PUBLIC_KEY_UUID,
   CLIENT_ECDH_PUBLIC_KEY_UUID,
-  TEST_DATA_UUID };
+  TEST_DATA_UUID,
+  SESSION_TICKET_UUID,
+  SESSION_RESUME_UUID,
+  SECURE_STREAM_UUID };
 static struct secure_attest_data_t secure_attest_data;
 static psa_key_id_t server_device_pub_key,
                     client_ecdh_id,
@@ -92,6 +99,18 @@ static struct signed_key_t peer_key_material;
 static mbedtls_x509_crt cert_chain;
 static mbedtls_x509_crt root_trust;
 mbedtls_pk_context root_pub_pk;
+// Cache entry of the connected server, NULL until its chain is verified
+static const cert_cache_entry_t *server_cache_entry;
+// Resumption secret of the last full key agreement
+static uint8_t session_secret[SESSION_SECRET_SIZE];
+// Connection opened, start of the time to secure channel
+static uint32_t handshake_start;
+// Secure stream from the server, opened with its own record key
+static secure_channel_t secure_stream;
+static psa_key_id_t secure_stream_key;
+static uint32_t secure_stream_bytes;
+static uint32_t secure_stream_records;
+static uint32_t secure_stream_start;
 
 #ifdef USE_CUSTOM_CERTIFICATES
 static const uint8_t server_root_pub_key[] =
@@ -132,6 +151,13 @@ static int verify_callback(void *data,
                            int depth,
                            uint32_t *flags);
 
+static void send_challenge_to_server(uint8_t connection, uint8_t table_index);
+
+static sl_status_t send_resume_request(uint8_t connection,
+                                       uint8_t table_index);
+
+static void log_secure_channel_time(const char *handshake);
+
 /**************************************************************************//**
  * GATT characteristic callback
  *****************************************************************************/
@@ -159,6 +185,15 @@ sl_status_t gatt_characteristic_value_server_ecdh_pub_key_cb(
 sl_status_t gatt_characteristic_value_test_data_cb(
   sl_bt_evt_gatt_characteristic_value_t *value,
   uint8_t table_index);
+sl_status_t gatt_characteristic_value_session_ticket_cb(
+  sl_bt_evt_gatt_characteristic_value_t *value,
+  uint8_t table_index);
+sl_status_t gatt_characteristic_value_session_resume_cb(
+  sl_bt_evt_gatt_characteristic_value_t *value,
+  uint8_t table_index);
+sl_status_t gatt_characteristic_value_secure_stream_cb(
+  sl_bt_evt_gatt_characteristic_value_t *value,
+  uint8_t table_index);
 
 sl_status_t (*gatt_characteristic_callback[nCharacteristics])(
   sl_bt_evt_gatt_characteristic_value_t *value,
@@ -179,7 +214,10 @@ sl_status_t (*gatt_characteristic_callback[nCharacteristics])(
   NULL,   // characteristic is write-only
   gatt_characteristic_value_server_ecdh_pub_key_cb,
   NULL,   // characteristic is write-only
-  gatt_characteristic_value_test_data_cb
+  gatt_characteristic_value_test_data_cb,
+  gatt_characteristic_value_session_ticket_cb,
+  gatt_characteristic_value_session_resume_cb,
+  gatt_characteristic_value_secure_stream_cb
 };
 
 /**************************************************************************//**
@@ -200,6 +238,9 @@ void app_init(void)
 
   memset(&secure_attest_data, 0, sizeof(secure_attest_data));
 
+  // Servers verified before a reset are still trusted
+  cert_cache_init();
+
   mbedtls_pk_init(&root_pub_pk);
 
   sc = mbedtls_pk_parse_public_key(&root_pub_pk,
@@ -312,6 +353,9 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
         + evt->data.evt_connection_opened.address.addr[0];
       // Add connection to the connection_properties array
       add_connection(evt->data.evt_connection_opened.connection, addr_value);
+      memset(&secure_attest_data, 0, sizeof(secure_attest_data));
+      server_cache_entry = NULL;
+      handshake_start = sl_sleeptimer_get_tick_count();
 //      sl_bt_sm_increase_security(evt->data.evt_connection_opened.connection);
       sc = sl_bt_connection_set_parameters(
         evt->data.evt_connection_opened.connection,
@@ -332,6 +376,20 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       sc = sl_bt_sm_delete_bondings();
       app_assert_status(sc);
       remove_connection(evt->data.evt_connection_opened.connection);
+      psa_destroy_key(share_derived_key_id);
+      psa_destroy_key(secure_stream_key);
+      psa_destroy_key(server_device_pub_key);
+      psa_destroy_key(client_ecdh_id);
+      share_derived_key_id = secure_stream_key = 0;
+      server_device_pub_key = client_ecdh_id = 0;
+      memset(session_secret, 0, sizeof(session_secret));
+      memset(&secure_stream, 0, sizeof(secure_stream));
+
+      // Scan again, a reconnect resumes the session if there is a ticket
+      sc = sl_bt_scanner_start(sl_bt_gap_1m_phy,
+                               sl_bt_scanner_discover_generic);
+      app_assert_status(sc);
+      conn_state = scanning;
       break;
 
     // -------------------------------
@@ -365,7 +423,9 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     // This event is generated for various procedure completions, e.g. when a
     // write procedure is completed, or service discovery is completed
     case sl_bt_evt_gatt_procedure_completed_id:
-      app_assert(evt->data.evt_gatt_procedure_completed.result == SL_STATUS_OK,
+      // A rejected session ticket is handled by gatt_proc_complete_cb()
+      app_assert((evt->data.evt_gatt_procedure_completed.result == SL_STATUS_OK)
+                 || (conn_state == resume_session),
                  "GATT procedure completed with error 0x%02X\r\n",
                  evt->data.evt_gatt_procedure_completed.result);
       gatt_proc_complete_cb(&evt->data.evt_gatt_procedure_completed);
@@ -593,6 +653,90 @@ sl_status_t gatt_characteristic_value_test_data_cb(
   return sc;
 }
 
+sl_status_t gatt_characteristic_value_session_ticket_cb(
+  sl_bt_evt_gatt_characteristic_value_t *value,
+  uint8_t table_index)
+{
+  if ((value->value.len + value->offset)
+      > sizeof(secure_attest_data.session_ticket)) {
+    return SL_STATUS_WOULD_OVERFLOW;
+  }
+  if (value->characteristic
+      == conn_properties[table_index].characteristic_handles[session_ticket]) {
+    memcpy(&secure_attest_data.session_ticket[value->offset],
+           value->value.data,
+           value->value.len);
+  }
+  return SL_STATUS_OK;
+}
+
+sl_status_t gatt_characteristic_value_session_resume_cb(
+  sl_bt_evt_gatt_characteristic_value_t *value,
+  uint8_t table_index)
+{
+  if ((value->value.len + value->offset)
+      > sizeof(secure_attest_data.resume_response)) {
+    return SL_STATUS_WOULD_OVERFLOW;
+  }
+  if (value->characteristic
+      == conn_properties[table_index].characteristic_handles[session_resume]) {
+    memcpy(&secure_attest_data.resume_response[value->offset],
+           value->value.data,
+           value->value.len);
+  }
+  return SL_STATUS_OK;
+}
+
+sl_status_t gatt_characteristic_value_secure_stream_cb(
+  sl_bt_evt_gatt_characteristic_value_t *value,
+  uint8_t table_index)
+{
+  uint8_t payload[SECURE_CHANNEL_PAYLOAD_MAX];
+  uint8_t flags;
+  size_t len;
+  uint32_t elapsed_ms;
+  sl_status_t sc;
+
+  (void)table_index;
+
+  // A record that is not authentic or replayed is dropped, the stream goes on
+  sc = secure_channel_open(&secure_stream,
+                           value->value.data,
+                           value->value.len,
+                           &flags,
+                           payload,
+                           sizeof(payload),
+                           &len);
+  if (sc != SL_STATUS_OK) {
+    app_log("secure stream record dropped, error 0x%lX\r\n", sc);
+    return SL_STATUS_OK;
+  }
+
+  // The server sends a counting pattern
+  for (size_t i = 0; i < len; i++) {
+    if (payload[i] != (uint8_t)(secure_stream_bytes + i)) {
+      app_log("secure stream data mismatch at byte %lu\r\n",
+              (unsigned long)(secure_stream_bytes + i));
+      break;
+    }
+  }
+  secure_stream_bytes += len;
+  secure_stream_records++;
+
+  if (flags & SECURE_CHANNEL_FLAG_LAST) {
+    elapsed_ms = sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count()
+                                          - secure_stream_start);
+    app_log("secure stream: %lu bytes in %lu records, %lu ms, %lu bytes/s\r\n",
+            (unsigned long)secure_stream_bytes,
+            (unsigned long)secure_stream_records,
+            (unsigned long)elapsed_ms,
+            (unsigned long)(elapsed_ms
+                            ? (uint64_t)secure_stream_bytes * 1000 / elapsed_ms
+                            : 0));
+  }
+  return SL_STATUS_OK;
+}
+
 sl_status_t gatt_characteristic_value_server_challenge_cb(
   sl_bt_evt_gatt_characteristic_value_t *value,
   uint8_t table_index)
@@ -824,14 +968,54 @@ void gatt_proc_complete_cb(
         break;
 
       case read_device_cert:
+      {
+        size_t bytes_written;
+
         sl_bt_scanner_stop();
-        sc = sl_bt_gatt_read_characteristic_value(
-          procedure_completed->connection,
-          conn_properties[table_index].characteristic_handles[
-            batch_certificate]);
+        sc = psa_hash_compute(PSA_ALG_SHA_256,
+                              secure_attest_data.device_certificate_buffer,
+                              secure_attest_data.device_cert_actual_size,
+                              secure_attest_data.device_cert_hash,
+                              sizeof(secure_attest_data.device_cert_hash),
+                              &bytes_written);
         app_assert_status(sc);
-        conn_state = read_batch_cert;
-        break;
+        server_cache_entry =
+          cert_cache_find(secure_attest_data.device_cert_hash);
+        if (server_cache_entry == NULL) {
+          sc = sl_bt_gatt_read_characteristic_value(
+            procedure_completed->connection,
+            conn_properties[table_index].characteristic_handles[
+              batch_certificate]);
+          app_assert_status(sc);
+          conn_state = read_batch_cert;
+          break;
+        }
+
+        /* the chain of this device certificate has already been verified,
+         * skip reading and verifying the rest of it */
+        app_log("server device certificate found in cache\r\n");
+        sc = create_import_key(&server_device_pub_key,
+                               PSA_KEY_USAGE_VERIFY_HASH,
+                               PSA_KEY_TYPE_ECC_PUBLIC_KEY(
+                                 PSA_ECC_FAMILY_SECP_R1),
+                               PSA_ALG_ECDSA(PSA_ALG_SHA_256),
+                               PSA_KEY_LIFETIME_VOLATILE,
+                               256,
+                               (uint8_t *)server_cache_entry->public_key,
+                               CERT_CACHE_PUBLIC_KEY_SIZE);
+        app_assert_status(sc);
+        if (server_cache_entry->ticket_valid
+            && (send_resume_request(procedure_completed->connection,
+                                    table_index) == SL_STATUS_OK)) {
+          app_log("resuming session with cached ticket\r\n");
+          conn_state = resume_session;
+        } else {
+          send_challenge_to_server(procedure_completed->connection,
+                                   table_index);
+          conn_state = send_challenge;
+        }
+      }
+      break;
 
       case read_batch_cert:
         sc = sl_bt_gatt_read_characteristic_value(
@@ -883,23 +1067,30 @@ void gatt_proc_complete_cb(
                                      verify_callback,
                                      NULL);
         if (sc == SL_STATUS_OK) {
-          /*generate a random number and get the remote device to sign it*/
-          generate_random_number(secure_attest_data.challenge,
-                                 sizeof(secure_attest_data.challenge));
-          app_log("\r" "sending challenge to server\r\n");
-          sl_bt_gatt_write_characteristic_value(
-            procedure_completed->connection, conn_properties[
-              table_index].characteristic_handles[challenge],
-            sizeof(secure_attest_data.challenge),
-            secure_attest_data.challenge);
+          uint8_t public_key[CERT_CACHE_PUBLIC_KEY_SIZE];
+          size_t bytes_written;
+
+          send_challenge_to_server(procedure_completed->connection,
+                                   table_index);
           sc = save_peer_pub_key(&cert_chain.pk, &server_device_pub_key);
           app_assert_status(sc);
+
+          // Remember the verified certificate for the next connections
+          sc = psa_export_public_key(server_device_pub_key,
+                                     public_key,
+                                     sizeof(public_key),
+                                     &bytes_written);
+          app_assert_status(sc);
+          server_cache_entry =
+            cert_cache_store(secure_attest_data.device_cert_hash, public_key);
           conn_state = send_challenge;
         } else {
           app_log(
             "certificate chain verification failed ... closing connection\r\n");
           sl_bt_connection_close(conn_properties[table_index].connection_handle);
         }
+        mbedtls_x509_crt_free(&cert_chain);
+        mbedtls_x509_crt_free(&root_trust);
         conn_state = send_challenge;
         break;
 
@@ -1070,19 +1261,114 @@ void gatt_proc_complete_cb(
         sc = finalize_key_agreement(client_ecdh_id,
                                     server_device_pub_key,
                                     &peer_key_material,
-                                    &share_derived_key_id);
+                                    &share_derived_key_id,
+                                    &secure_stream_key,
+                                    session_secret);
         app_assert_status(sc);
+        secure_channel_init(&secure_stream,
+                            secure_stream_key,
+                            SECURE_CHANNEL_CLIENT);
         app_log("ECDH key OK\r\n");
+        log_secure_channel_time("full handshake");
 
+        conn_state = read_session_ticket;
+      }
+      break;
+      case read_session_ticket:
+        sc = sl_bt_gatt_read_characteristic_value(
+          procedure_completed->connection,
+          conn_properties[table_index].characteristic_handles[session_ticket]);
+        app_assert_status(sc);
         conn_state = running;
+        break;
+      case resume_session:
+        if (procedure_completed->result != SL_STATUS_OK) {
+          /* the server could not open the ticket, e.g. it has been reset.
+           * The certificate is still trusted, attest the server again */
+          app_log("session ticket rejected, doing a full handshake\r\n");
+          cert_cache_drop_ticket(server_cache_entry);
+          send_challenge_to_server(procedure_completed->connection,
+                                   table_index);
+          conn_state = send_challenge;
+          break;
+        }
+        sc = sl_bt_gatt_read_characteristic_value(
+          procedure_completed->connection,
+          conn_properties[table_index].characteristic_handles[session_resume]);
+        app_assert_status(sc);
+        conn_state = read_resume_response;
+        break;
+      case read_resume_response:
+      {
+        uint8_t proof[SESSION_PROOF_SIZE];
+        uint8_t diff = 0;
+
+        sc = session_resume_derive(
+          cert_cache_secret_key(server_cache_entry),
+          secure_attest_data.client_nonce,
+          secure_attest_data.resume_response,
+          &share_derived_key_id,
+          proof,
+          &secure_stream_key);
+        app_assert_status(sc);
+
+        // Constant time compare of the proof
+        for (uint8_t i = 0; i < SESSION_PROOF_SIZE; i++) {
+          diff |= proof[i]
+                  ^ secure_attest_data.resume_response[SESSION_NONCE_SIZE + i];
+        }
+        if (diff != 0) {
+          app_log("wrong proof from server, closing connection\r\n");
+          cert_cache_drop_ticket(server_cache_entry);
+          sl_bt_connection_close(procedure_completed->connection);
+          break;
+        }
+        secure_channel_init(&secure_stream,
+                            secure_stream_key,
+                            SECURE_CHANNEL_CLIENT);
+        app_log("session resumed without key agreement\r\n");
+        log_secure_channel_time("resumed");
+
+        sc = sl_bt_gatt_read_characteristic_value(
+          procedure_completed->connection,
+          conn_properties[table_index].characteristic_handles[test_data]);
+        app_assert_status(sc);
+        conn_state = read_test_data;
       }
       break;
       case running:
+        // The ticket from the server has been read
+        if (server_cache_entry != NULL) {
+          sc = cert_cache_set_ticket(server_cache_entry,
+                                     secure_attest_data.session_ticket,
+                                     session_secret);
+          if (sc != SL_STATUS_OK) {
+            app_log("error saving session ticket %ld\r\n", sc);
+          }
+        }
+        memset(session_secret, 0, sizeof(session_secret));
         sc = sl_bt_gatt_read_characteristic_value(
           procedure_completed->connection,
           conn_properties[
             table_index].characteristic_handles[test_data]);
         app_assert_status(sc);
+        conn_state = read_test_data;
+        break;
+      case read_test_data:
+        // The channel keeps its record numbers, a record from an earlier
+        // subscription is a replay
+        secure_stream_bytes = 0;
+        secure_stream_records = 0;
+        secure_stream_start = sl_sleeptimer_get_tick_count();
+        sc = sl_bt_gatt_set_characteristic_notification(
+          procedure_completed->connection,
+          conn_properties[table_index].characteristic_handles[secure_stream],
+          sl_bt_gatt_notification);
+        app_assert_status(sc);
+        conn_state = enable_secure_stream;
+        break;
+      case enable_secure_stream:
+        app_log("subscribed to the secure stream\r\n");
         conn_state = idle;
         break;
       case opening:
@@ -1094,6 +1380,61 @@ void gatt_proc_complete_cb(
   }
 }
 
+/**************************************************************************
+ *    Send a random challenge for the server to sign
+ ***************************************************************************/
+static void send_challenge_to_server(uint8_t connection, uint8_t table_index)
+{
+  /*generate a random number and get the remote device to sign it*/
+  generate_random_number(secure_attest_data.challenge,
+                         sizeof(secure_attest_data.challenge));
+  app_log("\r" "sending challenge to server\r\n");
+  sl_bt_gatt_write_characteristic_value(
+    connection,
+    conn_properties[table_index].characteristic_handles[challenge],
+    sizeof(secure_attest_data.challenge),
+    secure_attest_data.challenge);
+}
+
+/**************************************************************************
+ *    Present the cached session ticket with a fresh client nonce
+ ***************************************************************************/
+static sl_status_t send_resume_request(uint8_t connection,
+                                       uint8_t table_index)
+{
+  uint8_t request[SESSION_RESUME_REQUEST_SIZE];
+  uint16_t mtu = 0;
+
+  // The server takes the request in a single write
+  sl_bt_gatt_server_get_mtu(connection, &mtu);
+  if (mtu < sizeof(request) + 3U) {
+    return SL_STATUS_WOULD_OVERFLOW;
+  }
+  generate_random_number(secure_attest_data.client_nonce,
+                         sizeof(secure_attest_data.client_nonce));
+  memcpy(request, server_cache_entry->ticket, SESSION_TICKET_SIZE);
+  memcpy(request + SESSION_TICKET_SIZE,
+         secure_attest_data.client_nonce,
+         SESSION_NONCE_SIZE);
+  return sl_bt_gatt_write_characteristic_value(
+    connection,
+    conn_properties[table_index].characteristic_handles[session_resume],
+    sizeof(request),
+    request);
+}
+
+/**************************************************************************
+ *    Report the time from connection opened to the session key
+ ***************************************************************************/
+static void log_secure_channel_time(const char *handshake)
+{
+  uint32_t elapsed = sl_sleeptimer_get_tick_count() - handshake_start;
+
+  app_log("secure channel ready in %lu ms (%s)\r\n",
+          (unsigned long)sl_sleeptimer_tick_to_ms(elapsed),
+          handshake);
+}
+
 /**************************************************************************
  *    Send a certificate to a remote device
  ***************************************************************************/
@@ -0,0 +1,179 @@
+/***************************************************************************//**
+ * @file cert_cache.c
+ * @brief Cache of verified server device certificates.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+#include <string.h>
+#include "nvm3_default.h"
+#include "app_log.h"
+#include "cert_cache.h"
+
+// -----------------------------------------------------------------------------
+// Private variables
+
+// RAM copy of the NVM3 objects, sequence 0 marks an empty slot
+static cert_cache_entry_t cache[CERT_CACHE_SLOTS];
+static uint32_t last_sequence;
+
+// -----------------------------------------------------------------------------
+// Private function declarations
+
+static uint8_t slot_of(const cert_cache_entry_t *entry);
+static sl_status_t save_slot(uint8_t slot);
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+void cert_cache_init(void)
+{
+  uint32_t type;
+  size_t len;
+  Ecode_t err;
+
+  memset(cache, 0, sizeof(cache));
+  last_sequence = 0;
+  for (uint8_t slot = 0; slot < CERT_CACHE_SLOTS; slot++) {
+    err = nvm3_getObjectInfo(NVM3_DEFAULT_HANDLE,
+                             CERT_CACHE_NVM3_KEY(slot),
+                             &type,
+                             &len);
+    if ((err != ECODE_NVM3_OK)
+        || (type != NVM3_OBJECTTYPE_DATA)
+        || (len != sizeof(cache[slot]))
+        || (nvm3_readData(NVM3_DEFAULT_HANDLE,
+                          CERT_CACHE_NVM3_KEY(slot),
+                          &cache[slot],
+                          sizeof(cache[slot])) != ECODE_NVM3_OK)) {
+      memset(&cache[slot], 0, sizeof(cache[slot]));
+      continue;
+    }
+    if (cache[slot].sequence > last_sequence) {
+      last_sequence = cache[slot].sequence;
+    }
+  }
+}
+
+const cert_cache_entry_t *cert_cache_find(const uint8_t *cert_hash)
+{
+  for (uint8_t slot = 0; slot < CERT_CACHE_SLOTS; slot++) {
+    if ((cache[slot].sequence != 0)
+        && (memcmp(cache[slot].cert_hash,
+                   cert_hash,
+                   CERT_CACHE_HASH_SIZE) == 0)) {
+      return &cache[slot];
+    }
+  }
+  return NULL;
+}
+
+const cert_cache_entry_t *cert_cache_store(const uint8_t *cert_hash,
+                                           const uint8_t *public_key)
+{
+  const cert_cache_entry_t *entry;
+  uint8_t slot = 0;
+
+  // Reuse the slot of the same certificate, or else the oldest one
+  entry = cert_cache_find(cert_hash);
+  if (entry != NULL) {
+    slot = slot_of(entry);
+  } else {
+    for (uint8_t i = 1; i < CERT_CACHE_SLOTS; i++) {
+      if (cache[i].sequence < cache[slot].sequence) {
+        slot = i;
+      }
+    }
+  }
+
+  cert_cache_drop_ticket(&cache[slot]);
+  cache[slot].sequence = ++last_sequence;
+  memcpy(cache[slot].cert_hash, cert_hash, CERT_CACHE_HASH_SIZE);
+  memcpy(cache[slot].public_key, public_key, CERT_CACHE_PUBLIC_KEY_SIZE);
+  if (save_slot(slot) != SL_STATUS_OK) {
+    app_log("error saving certificate cache slot %d\r\n", slot);
+  }
+  return &cache[slot];
+}
+
+sl_status_t cert_cache_set_ticket(const cert_cache_entry_t *entry,
+                                  const uint8_t *ticket,
+                                  const uint8_t *secret)
+{
+  uint8_t slot = slot_of(entry);
+  psa_key_id_t key_id = CERT_CACHE_SECRET_KEY_ID(slot);
+  sl_status_t sc;
+
+  psa_destroy_key(key_id);
+  sc = session_secret_import(secret, &key_id, PSA_KEY_LIFETIME_PERSISTENT);
+  if (sc != SL_STATUS_OK) {
+    return sc;
+  }
+  memcpy(cache[slot].ticket, ticket, SESSION_TICKET_SIZE);
+  cache[slot].ticket_valid = 1;
+  return save_slot(slot);
+}
+
+void cert_cache_drop_ticket(const cert_cache_entry_t *entry)
+{
+  uint8_t slot = slot_of(entry);
+
+  if (cache[slot].ticket_valid) {
+    psa_destroy_key(CERT_CACHE_SECRET_KEY_ID(slot));
+    cache[slot].ticket_valid = 0;
+    memset(cache[slot].ticket, 0, SESSION_TICKET_SIZE);
+    save_slot(slot);
+  }
+}
+
+psa_key_id_t cert_cache_secret_key(const cert_cache_entry_t *entry)
+{
+  return CERT_CACHE_SECRET_KEY_ID(slot_of(entry));
+}
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static uint8_t slot_of(const cert_cache_entry_t *entry)
+{
+  return (uint8_t)(entry - cache);
+}
+
+static sl_status_t save_slot(uint8_t slot)
+{
+  Ecode_t err;
+
+  err = nvm3_writeData(NVM3_DEFAULT_HANDLE,
+                       CERT_CACHE_NVM3_KEY(slot),
+                       &cache[slot],
+                       sizeof(cache[slot]));
+  return (err == ECODE_NVM3_OK) ? SL_STATUS_OK : SL_STATUS_FAIL;
+}
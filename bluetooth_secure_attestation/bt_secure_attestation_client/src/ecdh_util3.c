@@ -20,6 +20,7 @@
 #include "psa/crypto.h"
 #include "psa/crypto_values.h"
 #include "ecdh_util.h"
+#include "session_resume.h"
 #include "app_assert.h"
 #include "sl_se_manager_internal_keys.h"
 #define mbedtls_fprintf            fprintf
@@ -263,11 +264,17 @@ sl_status_t verifyPublicKey(struct signed_key_t *signed_key,
  *      certificate
  *      key : struct containing the peer's public key and signature
  *      shared_derived_key : id of the key derived from the shared secret
+ *      record_key : id of the secure channel key derived from the shared
+ *      secret
+ *      session_secret : resumption secret derived from the shared secret,
+ *      SESSION_SECRET_SIZE bytes. May be NULL.
  **/
 sl_status_t finalize_key_agreement(psa_key_id_t private_key_id,
                                    psa_key_id_t pubkey_from_cert,
                                    struct signed_key_t *key,
-                                   psa_key_id_t *shared_derived_key)
+                                   psa_key_id_t *shared_derived_key,
+                                   psa_key_id_t *record_key,
+                                   uint8_t *session_secret)
 {
   sl_status_t status;
   uint8_t shared_secret[64];
@@ -285,6 +292,17 @@ sl_status_t finalize_key_agreement(psa_key_id_t private_key_id,
                                  shared_derived_key);
   app_assert_status(status);
 //     }
+  status = session_record_key_derive(shared_secret,
+                                     ECDH_COORDINATE_SIZE,
+                                     record_key);
+  app_assert_status(status);
+  if (session_secret != NULL) {
+    status = session_secret_derive(shared_secret,
+                                   ECDH_COORDINATE_SIZE,
+                                   session_secret);
+    app_assert_status(status);
+  }
+  memset(shared_secret, 0, sizeof(shared_secret));
   return status;
 }
 
@@ -0,0 +1,245 @@
+/***************************************************************************//**
+ * @file session_resume.c
+ * @brief Session resumption tickets and key derivation.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+#include <string.h>
+#include "session_resume.h"
+
+#define SESSION_KEY_BITS        256
+#define TICKET_KEY_BITS         128
+
+// HKDF info strings, keep the derived values of each purpose apart
+static const uint8_t resumption_info[] = "attestation resumption";
+static const uint8_t session_info[] = "attestation session";
+static const uint8_t record_info[] = "attestation record";
+
+// -----------------------------------------------------------------------------
+// Private function declarations
+
+static void session_key_attributes(psa_key_attributes_t *attributes);
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+sl_status_t session_secret_derive(const uint8_t *shared_secret,
+                                  size_t len,
+                                  uint8_t *secret)
+{
+  psa_key_derivation_operation_t op = PSA_KEY_DERIVATION_OPERATION_INIT;
+  psa_status_t status;
+
+  status = psa_key_derivation_setup(&op, PSA_ALG_HKDF(PSA_ALG_SHA_256));
+  if (status == PSA_SUCCESS) {
+    status = psa_key_derivation_input_bytes(&op,
+                                            PSA_KEY_DERIVATION_INPUT_SECRET,
+                                            shared_secret,
+                                            len);
+  }
+  if (status == PSA_SUCCESS) {
+    status = psa_key_derivation_input_bytes(&op,
+                                            PSA_KEY_DERIVATION_INPUT_INFO,
+                                            resumption_info,
+                                            sizeof(resumption_info) - 1);
+  }
+  if (status == PSA_SUCCESS) {
+    status = psa_key_derivation_output_bytes(&op, secret, SESSION_SECRET_SIZE);
+  }
+  psa_key_derivation_abort(&op);
+  return status;
+}
+
+sl_status_t session_record_key_derive(const uint8_t *shared_secret,
+                                      size_t len,
+                                      psa_key_id_t *record_key)
+{
+  psa_key_derivation_operation_t op = PSA_KEY_DERIVATION_OPERATION_INIT;
+  psa_key_attributes_t attributes = psa_key_attributes_init();
+  psa_status_t status;
+
+  session_key_attributes(&attributes);
+  status = psa_key_derivation_setup(&op, PSA_ALG_HKDF(PSA_ALG_SHA_256));
+  if (status == PSA_SUCCESS) {
+    status = psa_key_derivation_input_bytes(&op,
+                                            PSA_KEY_DERIVATION_INPUT_SECRET,
+                                            shared_secret,
+                                            len);
+  }
+  if (status == PSA_SUCCESS) {
+    status = psa_key_derivation_input_bytes(&op,
+                                            PSA_KEY_DERIVATION_INPUT_INFO,
+                                            record_info,
+                                            sizeof(record_info) - 1);
+  }
+  if (status == PSA_SUCCESS) {
+    status = psa_key_derivation_output_key(&attributes, &op, record_key);
+  }
+  psa_key_derivation_abort(&op);
+  return status;
+}
+
+sl_status_t session_secret_import(const uint8_t *secret,
+                                  psa_key_id_t *key_id,
+                                  psa_key_lifetime_t lifetime)
+{
+  psa_key_attributes_t attributes = psa_key_attributes_init();
+
+  psa_set_key_type(&attributes, PSA_KEY_TYPE_DERIVE);
+  psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_DERIVE);
+  psa_set_key_algorithm(&attributes, PSA_ALG_HKDF(PSA_ALG_SHA_256));
+  psa_set_key_lifetime(&attributes, lifetime);
+  if (lifetime == PSA_KEY_LIFETIME_PERSISTENT) {
+    psa_set_key_id(&attributes, *key_id);
+  }
+  return psa_import_key(&attributes, secret, SESSION_SECRET_SIZE, key_id);
+}
+
+sl_status_t session_ticket_key_create(psa_key_id_t *ticket_key)
+{
+  psa_key_attributes_t attributes = psa_key_attributes_init();
+
+  psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+  psa_set_key_bits(&attributes, TICKET_KEY_BITS);
+  psa_set_key_usage_flags(&attributes,
+                          PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT);
+  psa_set_key_algorithm(&attributes, PSA_ALG_CCM);
+  psa_set_key_lifetime(&attributes, PSA_KEY_LIFETIME_VOLATILE);
+  return psa_generate_key(&attributes, ticket_key);
+}
+
+sl_status_t session_ticket_seal(psa_key_id_t ticket_key,
+                                const uint8_t *secret,
+                                uint8_t *ticket)
+{
+  psa_status_t status;
+  size_t bytes_written;
+
+  status = psa_generate_random(ticket, SESSION_TICKET_NONCE_SIZE);
+  if (status != PSA_SUCCESS) {
+    return status;
+  }
+  return psa_aead_encrypt(ticket_key, PSA_ALG_CCM,
+                          ticket, SESSION_TICKET_NONCE_SIZE,
+                          NULL, 0,
+                          secret, SESSION_SECRET_SIZE,
+                          ticket + SESSION_TICKET_NONCE_SIZE,
+                          SESSION_TICKET_SIZE - SESSION_TICKET_NONCE_SIZE,
+                          &bytes_written);
+}
+
+sl_status_t session_ticket_open(psa_key_id_t ticket_key,
+                                const uint8_t *ticket,
+                                uint8_t *secret)
+{
+  psa_status_t status;
+  size_t bytes_written;
+
+  status = psa_aead_decrypt(ticket_key, PSA_ALG_CCM,
+                            ticket, SESSION_TICKET_NONCE_SIZE,
+                            NULL, 0,
+                            ticket + SESSION_TICKET_NONCE_SIZE,
+                            SESSION_TICKET_SIZE - SESSION_TICKET_NONCE_SIZE,
+                            secret, SESSION_SECRET_SIZE,
+                            &bytes_written);
+  if ((status != PSA_SUCCESS) || (bytes_written != SESSION_SECRET_SIZE)) {
+    memset(secret, 0, SESSION_SECRET_SIZE);
+    return SL_STATUS_INVALID_SIGNATURE;
+  }
+  return SL_STATUS_OK;
+}
+
+sl_status_t session_resume_derive(psa_key_id_t secret_key,
+                                  const uint8_t *client_nonce,
+                                  const uint8_t *server_nonce,
+                                  psa_key_id_t *session_key,
+                                  uint8_t *proof,
+                                  psa_key_id_t *record_key)
+{
+  psa_key_derivation_operation_t op = PSA_KEY_DERIVATION_OPERATION_INIT;
+  psa_key_attributes_t attributes = psa_key_attributes_init();
+  uint8_t salt[2 * SESSION_NONCE_SIZE];
+  psa_status_t status;
+
+  memcpy(salt, client_nonce, SESSION_NONCE_SIZE);
+  memcpy(salt + SESSION_NONCE_SIZE, server_nonce, SESSION_NONCE_SIZE);
+
+  // Same key attributes as the session key of a full handshake
+  session_key_attributes(&attributes);
+
+  status = psa_key_derivation_setup(&op, PSA_ALG_HKDF(PSA_ALG_SHA_256));
+  if (status == PSA_SUCCESS) {
+    status = psa_key_derivation_input_bytes(&op,
+                                            PSA_KEY_DERIVATION_INPUT_SALT,
+                                            salt,
+                                            sizeof(salt));
+  }
+  if (status == PSA_SUCCESS) {
+    status = psa_key_derivation_input_key(&op,
+                                          PSA_KEY_DERIVATION_INPUT_SECRET,
+                                          secret_key);
+  }
+  if (status == PSA_SUCCESS) {
+    status = psa_key_derivation_input_bytes(&op,
+                                            PSA_KEY_DERIVATION_INPUT_INFO,
+                                            session_info,
+                                            sizeof(session_info) - 1);
+  }
+  if (status == PSA_SUCCESS) {
+    status = psa_key_derivation_output_key(&attributes, &op, session_key);
+  }
+  if (status == PSA_SUCCESS) {
+    status = psa_key_derivation_output_bytes(&op, proof, SESSION_PROOF_SIZE);
+    // The record key comes from the same output stream, after the proof
+    if (status == PSA_SUCCESS) {
+      status = psa_key_derivation_output_key(&attributes, &op, record_key);
+    }
+    if (status != PSA_SUCCESS) {
+      psa_destroy_key(*session_key);
+    }
+  }
+  psa_key_derivation_abort(&op);
+  return status;
+}
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static void session_key_attributes(psa_key_attributes_t *attributes)
+{
+  psa_set_key_type(attributes, PSA_KEY_TYPE_AES);
+  psa_set_key_bits(attributes, SESSION_KEY_BITS);
+  psa_set_key_usage_flags(attributes,
+                          PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT);
+  psa_set_key_algorithm(attributes, PSA_ALG_CCM);
+  psa_set_key_lifetime(attributes, PSA_KEY_LIFETIME_VOLATILE);
+}
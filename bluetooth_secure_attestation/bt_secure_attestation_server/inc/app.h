@@ -51,6 +51,8 @@ void app_process_action(void);
 #define CHALLENGE_SIZE          16
 #define SE_MANAGER_PRINT_CERT   1
 #define PRIVATE_KEY_BASE        0x7E400
+// Bytes of test data sent on the secure stream once it is subscribed
+#define SECURE_STREAM_LENGTH    16384
 
 extern const uint8_t custom_batch_certificate[];
 extern const uint8_t custom_device_certificate[];
@@ -25,13 +25,24 @@ psa_status_t setupEcdhPeer(uint8_t *public, size_t size, psa_key_id_t key_id);
 sl_status_t finalize_key_agreement(psa_key_id_t private_key_id,
                                    psa_key_id_t pubkey_from_cert,
                                    struct signed_key_t *key,
-                                   psa_key_id_t *shared_derived_key);
+                                   psa_key_id_t *shared_derived_key,
+                                   psa_key_id_t *record_key,
+                                   uint8_t *session_secret);
 
 psa_status_t derive_key(psa_key_id_t private_key_id,
                         uint8_t *input_key,
                         size_t input_key_size,
                         psa_key_id_t *derived_key_id);
 
+sl_status_t create_import_key(psa_key_id_t *id,
+                              psa_key_usage_t usage,
+                              psa_key_type_t type,
+                              psa_algorithm_t algo,
+                              psa_key_lifetime_t lifetime,
+                              psa_key_bits_t bits,
+                              uint8_t *key_material,
+                              size_t key_len);
+
 sl_status_t save_peer_pub_key(mbedtls_pk_context *pubkey,
                               psa_key_id_t *pubkey_id);
 
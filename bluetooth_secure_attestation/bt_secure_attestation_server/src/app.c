@@ -46,6 +46,8 @@
 #include "mbedtls/pem.h"
 #include "mbedtls/error.h"
 #include "ecdh_util.h"
+#include "session_resume.h"
+#include "secure_channel.h"
 #include "psa/crypto.h"
 #include "sl_sleeptimer.h"
 
@@ -77,6 +79,26 @@ static mbedtls_pk_context client_root_public_key;
 static psa_key_id_t peer_device_pub_key_id,
                     server_ecdh_id,
                     share_derived_key_id;
+// Seals the session tickets, a new one is made at every reset
+static psa_key_id_t ticket_key;
+// Ticket issued at the end of a full handshake
+static uint8_t session_ticket[SESSION_TICKET_SIZE];
+static bool session_ticket_valid = false;
+// Server nonce and proof of a resumed session
+static uint8_t resume_response[SESSION_RESUME_RESPONSE_SIZE];
+static bool resume_response_valid = false;
+// Secure stream of test data. Records are sealed with a key of their own, so
+// the random nonces of gattdb_test_data never meet the record counters. The
+// channel lives as long as the key, so no nonce is used twice
+static secure_channel_t secure_stream;
+static psa_key_id_t secure_stream_key;
+static bool secure_stream_active = false;
+static uint8_t secure_stream_connection;
+static uint32_t secure_stream_offset;
+static uint32_t secure_stream_records;
+// Sealed record the stack had no buffer for, sent again before the next one
+static uint8_t secure_stream_record[SECURE_CHANNEL_RECORD_MAX];
+static size_t secure_stream_record_len;
 
 /**************************************************************************//**
  * Private functions declaration
@@ -100,6 +122,10 @@ static int verify_callback(void *data,
 
 static bool check_key_initialized(psa_key_id_t key);
 
+static void secure_stream_start(uint8_t connection);
+
+static void secure_stream_send(void);
+
 /**************************************************************************//**
  * Application Init.
  *****************************************************************************/
@@ -122,6 +148,8 @@ void app_init(void)
   mbedtls_pk_parse_public_key(&client_root_public_key,
                               sl_root_pub_key,
                               sizeof(sl_root_pub_key));
+  sc = session_ticket_key_create(&ticket_key);
+  app_assert_status(sc);
 #ifdef USE_CUSTOM_CERTIFICATES
 
   /* check to see if key is already imported. If it is, skip.
@@ -164,6 +192,9 @@ void app_process_action(void)
   // This is called infinitely.                                              //
   // Do not call blocking functions from here!                               //
   /////////////////////////////////////////////////////////////////////////////
+  if (secure_stream_active) {
+    secure_stream_send();
+  }
 }
 
 /**************************************************************************//**
@@ -268,6 +299,18 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
             app_log("error sending indication %ld\r\n", sc);
           }
         }
+      } else if (evt->data.evt_gatt_server_characteristic_status.characteristic
+                 == gattdb_secure_stream) {
+        if (evt->data.evt_gatt_server_characteristic_status.status_flags
+            == sl_bt_gatt_server_client_config) {
+          if (evt->data.evt_gatt_server_characteristic_status.
+              client_config_flags & sl_bt_gatt_notification) {
+            secure_stream_start(
+              evt->data.evt_gatt_server_characteristic_status.connection);
+          } else {
+            secure_stream_active = false;
+          }
+        }
       }
       break;
 
@@ -330,6 +373,100 @@ static void data_cleanup(void)
   challenge_valid = false;
   memset(challenge, 0, sizeof(challenge));
   mtu = 0;
+  session_ticket_valid = false;
+  memset(session_ticket, 0, sizeof(session_ticket));
+  resume_response_valid = false;
+  secure_stream_active = false;
+  secure_stream_record_len = 0;
+  memset(&secure_stream, 0, sizeof(secure_stream));
+  psa_destroy_key(share_derived_key_id);
+  psa_destroy_key(secure_stream_key);
+  share_derived_key_id = secure_stream_key = 0;
+}
+
+/**************************************************************************//**
+ * Start the secure stream when the client subscribes to it.
+ *****************************************************************************/
+static void secure_stream_start(uint8_t connection)
+{
+  if (secure_stream.key == 0) {
+    app_log("secure stream subscribed before key agreement\r\n");
+    return;
+  }
+  if (secure_channel_payload_size(mtu) == 0) {
+    app_log("ATT MTU %d too small for the secure stream\r\n", mtu);
+    return;
+  }
+
+  // The record numbers go on from the previous subscription
+  secure_stream_connection = connection;
+  secure_stream_offset = 0;
+  secure_stream_records = 0;
+  secure_stream_record_len = 0;
+  secure_stream_active = true;
+  app_log("sending %d bytes on the secure stream\r\n", SECURE_STREAM_LENGTH);
+}
+
+/**************************************************************************//**
+ * Send records of the secure stream until the stack runs out of buffers.
+ *****************************************************************************/
+static void secure_stream_send(void)
+{
+  uint8_t payload[SECURE_CHANNEL_PAYLOAD_MAX];
+  uint8_t flags;
+  size_t len;
+  sl_status_t sc;
+
+  while (secure_stream_active) {
+    if (secure_stream_record_len == 0) {
+      // Records are as large as the MTU allows, the last one is shorter
+      flags = 0;
+      len = secure_channel_payload_size(mtu);
+      if (len >= SECURE_STREAM_LENGTH - secure_stream_offset) {
+        len = SECURE_STREAM_LENGTH - secure_stream_offset;
+        flags = SECURE_CHANNEL_FLAG_LAST;
+      }
+      for (size_t i = 0; i < len; i++) {
+        payload[i] = (uint8_t)(secure_stream_offset + i);
+      }
+      sc = secure_channel_seal(&secure_stream,
+                               flags,
+                               payload,
+                               len,
+                               secure_stream_record,
+                               sizeof(secure_stream_record),
+                               &secure_stream_record_len);
+      if (sc != SL_STATUS_OK) {
+        app_log("error sealing secure stream record %ld\r\n", sc);
+        secure_stream_active = false;
+        break;
+      }
+      secure_stream_offset += len;
+      secure_stream_records++;
+    }
+
+    // The sealed record is kept until the stack accepts it, sealing it again
+    // would use up a new sequence number
+    sc = sl_bt_gatt_server_send_notification(secure_stream_connection,
+                                             gattdb_secure_stream,
+                                             secure_stream_record_len,
+                                             secure_stream_record);
+    if (sc == SL_STATUS_NO_MORE_RESOURCE) {
+      break;
+    }
+    if (sc != SL_STATUS_OK) {
+      app_log("error sending secure stream record %ld\r\n", sc);
+      secure_stream_active = false;
+      break;
+    }
+    secure_stream_record_len = 0;
+
+    if (secure_stream_offset == SECURE_STREAM_LENGTH) {
+      app_log("secure stream sent in %lu records\r\n",
+              (unsigned long)secure_stream_records);
+      secure_stream_active = false;
+    }
+  }
 }
 
 static int verify_callback(void *data,
@@ -513,6 +650,26 @@ static sl_status_t user_read_request_cb(
     }
     break;
 
+    case gattdb_session_ticket:
+      if (session_ticket_valid == false) {
+        app_log("session ticket read before key agreement\r\n");
+        return SL_STATUS_NOT_READY;
+      }
+      memcpy(buffer, session_ticket, sizeof(session_ticket));
+      bytes_to_send = sizeof(session_ticket);
+      sc = SL_STATUS_OK;
+      break;
+
+    case gattdb_session_resume:
+      if (resume_response_valid == false) {
+        app_log("session resume response read before request\r\n");
+        return SL_STATUS_NOT_READY;
+      }
+      memcpy(buffer, resume_response, sizeof(resume_response));
+      bytes_to_send = sizeof(resume_response);
+      sc = SL_STATUS_OK;
+      break;
+
     case gattdb_test_data:
     {
       const uint8_t plaintext[] = "Silabs success";
@@ -609,6 +766,7 @@ static sl_status_t gatt_server_user_write_request_cb(
   size_t cert_size;
   sl_status_t sc = SL_STATUS_FAIL, result;
   uint32_t flags = 1;
+  uint8_t att_errorcode = 0;
 
   switch (user_write_request->characteristic) {
     /* first byte indicates whether more data to follow or not*/
@@ -691,6 +849,7 @@ static sl_status_t gatt_server_user_write_request_cb(
     case gattdb_client_pubkey:
     {
       struct signed_key_t peer_key_material;
+      uint8_t session_secret[SESSION_SECRET_SIZE];
       sl_status_t sc;
       if (user_write_request->value.len > sizeof(peer_key_material)) {
         return SL_STATUS_WOULD_OVERFLOW;
@@ -701,8 +860,67 @@ static sl_status_t gatt_server_user_write_request_cb(
       sc = finalize_key_agreement(server_ecdh_id,
                                   peer_device_pub_key_id,
                                   &peer_key_material,
-                                  &share_derived_key_id);
+                                  &share_derived_key_id,
+                                  &secure_stream_key,
+                                  session_secret);
+      app_assert_status(sc);
+      secure_channel_init(&secure_stream,
+                          secure_stream_key,
+                          SECURE_CHANNEL_SERVER);
+
+      /* the ticket lets the attested client resume without a new ECDH.
+       * Only the client and the ticket key can recover the secret */
+      if (challenge_valid) {
+        sc = session_ticket_seal(ticket_key, session_secret, session_ticket);
+        app_assert_status(sc);
+        session_ticket_valid = true;
+      }
+      memset(session_secret, 0, sizeof(session_secret));
+    }
+    break;
+    case gattdb_session_resume:
+    {
+      uint8_t session_secret[SESSION_SECRET_SIZE];
+      psa_key_id_t secret_key;
+      const uint8_t *client_nonce;
+
+      resume_response_valid = false;
+      if (user_write_request->value.len != SESSION_RESUME_REQUEST_SIZE) {
+        att_errorcode = SESSION_RESUME_ATT_ERROR;
+        break;
+      }
+      client_nonce = user_write_request->value.data + SESSION_TICKET_SIZE;
+      sc = session_ticket_open(ticket_key,
+                               user_write_request->value.data,
+                               session_secret);
+      if (sc != SL_STATUS_OK) {
+        app_log("session ticket rejected\r\n");
+        att_errorcode = SESSION_RESUME_ATT_ERROR;
+        break;
+      }
+      sc = session_secret_import(session_secret,
+                                 &secret_key,
+                                 PSA_KEY_LIFETIME_VOLATILE);
+      memset(session_secret, 0, sizeof(session_secret));
+      app_assert_status(sc);
+
+      psa_destroy_key(share_derived_key_id);
+      psa_destroy_key(secure_stream_key);
+      sc = psa_generate_random(resume_response, SESSION_NONCE_SIZE);
+      app_assert_status(sc);
+      sc = session_resume_derive(secret_key,
+                                 client_nonce,
+                                 resume_response,
+                                 &share_derived_key_id,
+                                 resume_response + SESSION_NONCE_SIZE,
+                                 &secure_stream_key);
+      psa_destroy_key(secret_key);
       app_assert_status(sc);
+      secure_channel_init(&secure_stream,
+                          secure_stream_key,
+                          SECURE_CHANNEL_SERVER);
+      resume_response_valid = true;
+      app_log("session resumed without key agreement\r\n");
     }
     break;
     case gattdb_peer_challenge_response:
@@ -741,7 +959,7 @@ static sl_status_t gatt_server_user_write_request_cb(
   result = sl_bt_gatt_server_send_user_write_response(
     user_write_request->connection,
     user_write_request->characteristic,
-    SL_STATUS_OK);
+    att_errorcode);
   if ((peer_device_cert_complete == true) && peer_batch_cert_complete
       && (peer_factory_cert_complete == true)
       && (peer_root_cert_complete == true)) {
@@ -0,0 +1,180 @@
+/***************************************************************************//**
+ * @file secure_channel.c
+ * @brief Record layer of the secure channel.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+#include <string.h>
+#include "secure_channel.h"
+
+// CCM nonce: direction byte, zero padding, sequence number (big endian)
+#define SECURE_CHANNEL_NONCE_SIZE     13
+// No record is sent with this sequence number, it would repeat a nonce
+#define SECURE_CHANNEL_SEQUENCE_END   0xFFFFFFFFUL
+
+// -----------------------------------------------------------------------------
+// Private function declarations
+
+static void build_nonce(uint8_t *nonce, uint8_t direction, uint32_t sequence);
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+void secure_channel_init(secure_channel_t *channel,
+                         psa_key_id_t key,
+                         secure_channel_role_t role)
+{
+  channel->key = key;
+  channel->tx_direction = (uint8_t)role;
+  channel->tx_sequence = 0;
+  channel->rx_sequence = 0;
+}
+
+size_t secure_channel_payload_size(uint16_t mtu)
+{
+  // A notification carries mtu - 3 bytes of value
+  size_t record_size = (mtu > 3) ? mtu - 3U : 0;
+
+  if (record_size > SECURE_CHANNEL_RECORD_MAX) {
+    record_size = SECURE_CHANNEL_RECORD_MAX;
+  }
+  if (record_size <= SECURE_CHANNEL_OVERHEAD) {
+    return 0;
+  }
+  return record_size - SECURE_CHANNEL_OVERHEAD;
+}
+
+sl_status_t secure_channel_seal(secure_channel_t *channel,
+                                uint8_t flags,
+                                const uint8_t *payload,
+                                size_t len,
+                                uint8_t *record,
+                                size_t record_size,
+                                size_t *record_len)
+{
+  uint8_t nonce[SECURE_CHANNEL_NONCE_SIZE];
+  uint32_t sequence = channel->tx_sequence;
+  psa_status_t status;
+  size_t bytes_written;
+
+  if ((record_size < SECURE_CHANNEL_OVERHEAD)
+      || (len > record_size - SECURE_CHANNEL_OVERHEAD)
+      || (sequence == SECURE_CHANNEL_SEQUENCE_END)) {
+    return SL_STATUS_WOULD_OVERFLOW;
+  }
+
+  record[0] = flags;
+  record[1] = (uint8_t)sequence;
+  record[2] = (uint8_t)(sequence >> 8);
+  record[3] = (uint8_t)(sequence >> 16);
+  record[4] = (uint8_t)(sequence >> 24);
+  build_nonce(nonce, channel->tx_direction, sequence);
+
+  // The ciphertext and the tag are written right behind the header
+  status = psa_aead_encrypt(channel->key,
+                            PSA_ALG_CCM,
+                            nonce, sizeof(nonce),
+                            record, SECURE_CHANNEL_HEADER_SIZE,
+                            payload, len,
+                            record + SECURE_CHANNEL_HEADER_SIZE,
+                            record_size - SECURE_CHANNEL_HEADER_SIZE,
+                            &bytes_written);
+  if (status != PSA_SUCCESS) {
+    return SL_STATUS_FAIL;
+  }
+
+  channel->tx_sequence++;
+  *record_len = SECURE_CHANNEL_HEADER_SIZE + bytes_written;
+  return SL_STATUS_OK;
+}
+
+sl_status_t secure_channel_open(secure_channel_t *channel,
+                                const uint8_t *record,
+                                size_t record_len,
+                                uint8_t *flags,
+                                uint8_t *payload,
+                                size_t payload_size,
+                                size_t *payload_len)
+{
+  uint8_t nonce[SECURE_CHANNEL_NONCE_SIZE];
+  uint32_t sequence;
+  psa_status_t status;
+
+  if (record_len < SECURE_CHANNEL_OVERHEAD) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (record_len - SECURE_CHANNEL_OVERHEAD > payload_size) {
+    return SL_STATUS_WOULD_OVERFLOW;
+  }
+
+  // Replays are rejected before spending time on the decryption
+  sequence = record[1]
+             | ((uint32_t)record[2] << 8)
+             | ((uint32_t)record[3] << 16)
+             | ((uint32_t)record[4] << 24);
+  if ((sequence < channel->rx_sequence)
+      || (sequence == SECURE_CHANNEL_SEQUENCE_END)) {
+    return SL_STATUS_ALREADY_EXISTS;
+  }
+
+  // Records of the other side carry the other direction byte
+  build_nonce(nonce, channel->tx_direction ^ 1, sequence);
+  status = psa_aead_decrypt(channel->key,
+                            PSA_ALG_CCM,
+                            nonce, sizeof(nonce),
+                            record, SECURE_CHANNEL_HEADER_SIZE,
+                            record + SECURE_CHANNEL_HEADER_SIZE,
+                            record_len - SECURE_CHANNEL_HEADER_SIZE,
+                            payload, payload_size,
+                            payload_len);
+  if (status != PSA_SUCCESS) {
+    return SL_STATUS_INVALID_SIGNATURE;
+  }
+
+  // Only an authentic record moves the replay window
+  channel->rx_sequence = sequence + 1;
+  *flags = record[0];
+  return SL_STATUS_OK;
+}
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+static void build_nonce(uint8_t *nonce, uint8_t direction, uint32_t sequence)
+{
+  memset(nonce, 0, SECURE_CHANNEL_NONCE_SIZE);
+  nonce[0] = direction;
+  nonce[9] = (uint8_t)(sequence >> 24);
+  nonce[10] = (uint8_t)(sequence >> 16);
+  nonce[11] = (uint8_t)(sequence >> 8);
+  nonce[12] = (uint8_t)sequence;
+}
@@ -109,11 +109,15 @@ const uint8_t charUUID[16] = { 0xd6,
                                0xc2,
                                0xfe };
 
-/* Maximum number of iterations when polling UART RX data before sending data
- * over BLE connection
- * set value to 0 to disable optimization -> minimum latency but may decrease
- * throughput */
-#define UART_POLL_TIMEOUT 5000
+/* UART RX data is moved in bulk from the interrupt-fed iostream buffer into
+ * this ring buffer, and sent from there in packets of up to _max_packet_size
+ * bytes. The size must be a power of two */
+#define SPP_RX_RING_SIZE 4096
+
+/* A packet shorter than _max_packet_size is sent only after the UART has been
+ * idle for this long. Set value to 0 to send data as soon as it is read ->
+ * minimum latency but may decrease throughput */
+#define UART_IDLE_FLUSH_MS 2
 
 static sl_sleeptimer_timer_handle_t reconnect_timer;
 
@@ -125,6 +129,8 @@ typedef struct
   uint32_t num_pack_received;
   uint32_t num_bytes_received;
   uint32_t num_writes; /* Total number of send attempts */
+  uint32_t num_bytes_dropped; /* UART bytes lost on RX ring buffer overflow */
+  uint32_t start_tick; /* First data sent, for the throughput */
 } tsCounters;
 
 /* Function is only used in SPP client mode */
@@ -135,6 +141,7 @@ static bool process_scan_response(
 static void printStats(tsCounters *psCounters);
 static void reset_variables();
 static void send_spp_data();
+static void read_uart_data(void);
 static void setup_advertising_or_scanning(sl_bt_msg_t *evt);
 static void discover_primary_services(void);
 static sl_bt_connection_security_t get_connection_security_mode(
@@ -158,7 +165,12 @@ static enum STATE _main_state = STATE_INIT;
 tsCounters _sCounters;
 
 static uint8_t _max_packet_size = 20; // Maximum bytes per one packet
-static uint8_t _min_packet_size = 20; // Target minimum bytes for one packet
+
+// UART RX ring buffer, the indexes are free running
+static uint8_t _spp_rx_ring[SPP_RX_RING_SIZE];
+static uint32_t _spp_rx_head;
+static uint32_t _spp_rx_tail;
+static uint32_t _spp_rx_last_tick;
 
 uint8_t connectionToIncreasSec = 0xFF;
 enum SOFT_TIMER_HANDLES
@@ -175,6 +187,8 @@ static void reset_variables()
     _main_state = STATE_DISCONNECTED;
   }
   _max_packet_size = 20;
+  _spp_rx_head = 0;
+  _spp_rx_tail = 0;
 
   memset(&_sCounters, 0, sizeof(_sCounters));
 }
@@ -320,9 +334,6 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
        * this depends on the MTU.
        * up to ATT_MTU-3 bytes can be sent at once  */
       _max_packet_size = evt->data.evt_gatt_mtu_exchanged.mtu - 3;
-      _min_packet_size = _max_packet_size;
-
-      /* Try to send maximum length packets whenever possible */
       app_log("MTU exchanged: %d\r\n\n", evt->data.evt_gatt_mtu_exchanged.mtu);
       break;
 
@@ -670,13 +681,25 @@ static bool process_scan_response(
 
 static void printStats(tsCounters *psCounters)
 {
+  uint32_t elapsed_ms = 0;
+
   app_log("Outgoing data:\r\n");
   app_log(" bytes/packets sent: %lu / %lu ",
           psCounters->num_bytes_sent,
           psCounters->num_pack_sent);
   app_log(", num writes: %lu\r\n",
           psCounters->num_writes);
-  app_log("(RX buffer overflow is not tracked)\r\n");
+  app_log(" bytes dropped on RX buffer overflow: %lu\r\n",
+          psCounters->num_bytes_dropped);
+  if (psCounters->start_tick != 0) {
+    elapsed_ms = sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count()
+                                          - psCounters->start_tick);
+  }
+  if (elapsed_ms != 0) {
+    app_log(" throughput: %lu bps\r\n",
+            (uint32_t)((uint64_t)psCounters->num_bytes_sent * 8000
+                       / elapsed_ms));
+  }
   app_log("Incoming data:\r\n");
   app_log(" bytes/packets received: %lu / %lu\r\n",
           psCounters->num_bytes_received,
@@ -685,61 +708,108 @@ static void printStats(tsCounters *psCounters)
   return;
 }
 
-static void send_spp_data()
+static void read_uart_data(void)
 {
-  uint8_t len = 0;
-  uint8_t data[256];
-  sl_status_t result, read_result;
-  uint32_t timeout = 0;
-  char c;
+  uint8_t discard[64];
+  uint32_t free_space;
+  uint32_t chunk;
+  size_t bytes_read = 0;
+  sl_status_t sc;
 
-  // Read up to _max_packet_size characters from local buffer
-  while (len < _max_packet_size)
+  do
   {
-    read_result = sl_iostream_getchar(sl_iostream_vcom_handle, &c);
-    if (SL_STATUS_OK == read_result) {
-      data[len++] = (uint8_t)c;
-    } else if (len == 0) {
-      /* If the first sl_iostream_getchar() fails then return immediately */
-      return;
-    } else {
-      /* Speed optimization: if there are some bytes to be sent but the length
-       * is still below the preferred minimum packet size, then wait for
-       * additional bytes until timeout. Target is to put as many bytes as
-       * possible into each air packet */
-      // Conditions for exiting the while loop and proceed to send data:
-      if (timeout++ > UART_POLL_TIMEOUT) {
+    free_space = SPP_RX_RING_SIZE - (_spp_rx_head - _spp_rx_tail);
+    if (free_space == 0) {
+      // Keep the UART driver drained, but count what is lost
+      sc = sl_iostream_read(sl_iostream_vcom_handle,
+                            discard,
+                            sizeof(discard),
+                            &bytes_read);
+      if (sc != SL_STATUS_OK) {
+        // Nothing left to read, or the stream failed
         break;
-      } else if (len >= _min_packet_size) {
+      }
+      _sCounters.num_bytes_dropped += bytes_read;
+    } else {
+      // Read up to the end of the ring, the rest on the next iteration
+      chunk = SPP_RX_RING_SIZE - (_spp_rx_head & (SPP_RX_RING_SIZE - 1));
+      if (chunk > free_space) {
+        chunk = free_space;
+      }
+      sc = sl_iostream_read(sl_iostream_vcom_handle,
+                            &_spp_rx_ring[_spp_rx_head
+                                          & (SPP_RX_RING_SIZE - 1)],
+                            chunk,
+                            &bytes_read);
+      if (sc != SL_STATUS_OK) {
         break;
       }
+      _spp_rx_head += bytes_read;
     }
-  }
+    if (bytes_read > 0) {
+      _spp_rx_last_tick = sl_sleeptimer_get_tick_count();
+    }
+  } while (bytes_read > 0);
+}
 
-  if (len > 0) {
+static void send_spp_data()
+{
+  uint8_t data[256];
+  uint32_t len, index, chunk;
+  sl_status_t result;
+
+  read_uart_data();
+
+  while (_spp_rx_head != _spp_rx_tail)
+  {
+    len = _spp_rx_head - _spp_rx_tail;
+    if (len > _max_packet_size) {
+      len = _max_packet_size;
+    } else if ((len < _max_packet_size)
+               && (sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count()
+                                            - _spp_rx_last_tick)
+                   < UART_IDLE_FLUSH_MS)) {
+      /* Speed optimization: wait for a full packet until the UART is idle.
+       * Target is to put as many bytes as possible into each air packet */
+      break;
+    }
+
+    index = _spp_rx_tail & (SPP_RX_RING_SIZE - 1);
+    chunk = SPP_RX_RING_SIZE - index;
+    if (chunk > len) {
+      chunk = len;
+    }
+    memcpy(data, &_spp_rx_ring[index], chunk);
+    memcpy(&data[chunk], _spp_rx_ring, len - chunk);
+
+    if (_spp_operation_mode == SPP_SERVER_MODE) {
+      result = sl_bt_gatt_server_send_notification(_conn_handle,
+                                                   gattdb_gatt_spp_data,
+                                                   len,
+                                                   data);
+    } else {
+      result = sl_bt_gatt_write_characteristic_value_without_response(
+        _conn_handle,
+        _char_handle,
+        len,
+        data,
+        NULL);
+    }
+    _sCounters.num_writes++;
     /* Stack may return "out-of-memory" (SL_STATUS_NO_MORE_RESOURCE)
-     * error if the local buffer is full -> in that case, just keep trying
-     * until the command succeeds
+     * error if the local buffer is full -> in that case, the data stays in
+     * the ring buffer and is sent on a next call, once the stack has freed
+     * some buffers
      */
-    do
-    {
-      if (_spp_operation_mode == SPP_SERVER_MODE) {
-        result = sl_bt_gatt_server_send_notification(_conn_handle,
-                                                     gattdb_gatt_spp_data,
-                                                     len,
-                                                     data);
-      } else {
-        result = sl_bt_gatt_write_characteristic_value_without_response(
-          _conn_handle,
-          _char_handle,
-          len,
-          data,
-          NULL);
-      }
-      _sCounters.num_writes++;
-    } while (result == SL_STATUS_NO_MORE_RESOURCE);
+    if (result == SL_STATUS_NO_MORE_RESOURCE) {
+      break;
+    }
     app_assert_status(result);
 
+    if (_sCounters.start_tick == 0) {
+      _sCounters.start_tick = sl_sleeptimer_get_tick_count();
+    }
+    _spp_rx_tail += len;
     _sCounters.num_pack_sent++;
     _sCounters.num_bytes_sent += len;
   }
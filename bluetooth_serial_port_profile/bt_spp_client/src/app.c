@@ -35,6 +35,7 @@
  ******************************************************************************/
 #include "sl_common.h"
 #include "sl_iostream_handles.h"
+#include "sl_sleeptimer.h"
 #include "sl_bluetooth.h"
 #include "gatt_db.h"
 #include "app.h"
@@ -60,6 +61,7 @@
 #define ENABLE_NOTIF       4
 #define DATA_MODE          5
 #define DISCONNECTING      6
+#define ENABLE_CREDITS     7
 
 #define STATE_ADVERTISING  1
 #define STATE_CONNECTED    2
@@ -101,11 +103,45 @@ const uint8_t charUUID[16] = { 0xd6,
                                0xc2,
                                0xfe };
 
-/* maximum number of iterations when polling UART RX data before sending data
- *   over BLE connection
- * set value to 0 to disable optimization -> minimum latency but may decrease
- *   throughput */
-#define UART_POLL_TIMEOUT  5000
+// SPP credits UUID: 2f1e7c3a-9b64-4d5e-8a0c-5b3d91e6f472
+const uint8_t creditsUUID[16] = { 0x72,
+                                  0xf4,
+                                  0xe6,
+                                  0x91,
+                                  0x3d,
+                                  0x5b,
+                                  0x0c,
+                                  0x8a,
+                                  0x5e,
+                                  0x4d,
+                                  0x64,
+                                  0x9b,
+                                  0x3a,
+                                  0x7c,
+                                  0x1e,
+                                  0x2f };
+
+/* UART RX data is moved in bulk from the interrupt-fed iostream buffer into
+ *   this ring buffer, and sent from there in packets of up to max_packet_size
+ *   bytes. The size must be a power of two */
+#define SPP_RX_RING_SIZE   4096
+
+/* A packet shorter than max_packet_size is sent only after the UART has been
+ *   idle for this long. Set value to 0 to send data as soon as it is read ->
+ *   minimum latency but may decrease throughput */
+#define UART_IDLE_FLUSH_MS 2
+
+/* Data received over BLE is queued in this ring buffer and written to the UART
+ *   from the main loop. Its free space is what the peer is granted as credits.
+ *   The size must be a power of two */
+#define UART_TX_RING_SIZE  2048
+
+/* Maximum number of bytes written to the UART per main loop pass */
+#define UART_TX_CHUNK_SIZE 64
+
+/* Credits are returned to the peer once at least this many bytes have been
+ *   written to the UART, so that one grant covers several packets */
+#define CREDIT_BATCH_SIZE  (UART_TX_RING_SIZE / 4)
 
 /*Bookkeeping struct for storing amount of received/sent data  */
 typedef struct
@@ -115,6 +151,11 @@ typedef struct
   uint32_t num_pack_received;
   uint32_t num_bytes_received;
   uint32_t num_writes; /* Total number of send attempts */
+  uint32_t num_bytes_dropped; /* UART bytes lost on RX ring buffer overflow */
+  uint32_t start_tick; /* Start of SPP mode, for the throughput */
+  uint32_t num_credits_received; /* Bytes the peer allowed us to send */
+  uint32_t num_credits_returned; /* Bytes we allowed the peer to send */
+  uint32_t num_rx_overruns; /* Packets received beyond the granted credits */
 } ts_counters;
 
 /* Function is only used in SPP client mode */
@@ -128,6 +169,10 @@ static bool process_scan_response(
 static void print_stats(ts_counters *p_counters);
 static void reset_variables();
 static void send_spp_data();
+static void read_uart_data(void);
+static void queue_uart_data(const uint8_t *data, uint32_t len);
+static void write_uart_data(void);
+static void return_credits(void);
 
 /*******************************************************************************
  *    Local Variables
@@ -136,13 +181,30 @@ static uint8_t conn_handle = 0xFF;
 static uint8_t main_state;
 static uint32_t service_handle;
 static uint16_t char_handle;
+static uint16_t credits_char_handle;
 
 ts_counters counters;
 
 // Default maximum packet size is 20 bytes. This is adjusted after connection is
 // opened based on the connection parameters
 static uint8_t max_packet_size = 20;
-static uint8_t min_packet_size = 20;  // Target minimum bytes for one packet
+
+// UART RX ring buffer, the indexes are free running
+static uint8_t spp_rx_ring[SPP_RX_RING_SIZE];
+static uint32_t spp_rx_head;
+static uint32_t spp_rx_tail;
+static uint32_t spp_rx_last_tick;
+
+// UART TX ring buffer, the indexes are free running
+static uint8_t uart_tx_ring[UART_TX_RING_SIZE];
+static uint32_t uart_tx_head;
+static uint32_t uart_tx_tail;
+
+// Credit based flow control, active if the server has the SPP credits
+//   characteristic
+static bool flow_control;
+static uint32_t tx_credits;
+static uint32_t credits_to_return;
 
 static void reset_variables()
 {
@@ -150,7 +212,15 @@ static void reset_variables()
   main_state = STATE_ADVERTISING;
   service_handle = 0;
   char_handle = 0;
+  credits_char_handle = 0;
   max_packet_size = 20;
+  spp_rx_head = 0;
+  spp_rx_tail = 0;
+  uart_tx_head = 0;
+  uart_tx_tail = 0;
+  flow_control = false;
+  tx_credits = 0;
+  credits_to_return = 0;
 
   memset(&counters, 0, sizeof(counters));
 }
@@ -168,6 +238,8 @@ void app_init(void)
 void app_process_action(void)
 {
   if (STATE_SPP_MODE == main_state) {
+    write_uart_data();
+    return_credits();
     send_spp_data();
   }
 }
@@ -233,9 +305,6 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       // Calculate maximum data per one notification / write-without-response,
       // this depends on the MTU. up to ATT_MTU-3 bytes can be sent at once
       max_packet_size = evt->data.evt_gatt_mtu_exchanged.mtu - 3;
-
-      /* Try to send maximum length packets whenever possible */
-      min_packet_size = max_packet_size;
       app_log("MTU exchanged: %d\r\n", evt->data.evt_gatt_mtu_exchanged.mtu);
       break;
 
@@ -264,7 +333,14 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
           break;
 
         case FIND_CHAR:
-          if (char_handle > 0) {
+          if ((char_handle > 0) && (credits_char_handle > 0)) {
+            // The server supports flow control, turn on credit notifications
+            //   before any data can arrive
+            sl_bt_gatt_set_characteristic_notification(conn_handle,
+                                                       credits_char_handle,
+                                                       sl_bt_gatt_notification);
+            main_state = ENABLE_CREDITS;
+          } else if (char_handle > 0) {
             // Characteristic found, turn on indications
             sl_bt_gatt_set_characteristic_notification(conn_handle,
                                                        char_handle,
@@ -277,8 +353,21 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
           }
           break;
 
+        case ENABLE_CREDITS:
+          flow_control = true;
+          app_log("Flow control ON\r\n");
+          sl_bt_gatt_set_characteristic_notification(conn_handle,
+                                                     char_handle,
+                                                     sl_bt_gatt_notification);
+          main_state = ENABLE_NOTIF;
+          break;
+
         case ENABLE_NOTIF:
           main_state = STATE_SPP_MODE;
+          counters.start_tick = sl_sleeptimer_get_tick_count();
+          // The whole UART TX ring buffer is granted to the server as the
+          //   first credits
+          credits_to_return = UART_TX_RING_SIZE;
           app_log("SPP Mode ON\r\n");
           // disable deep sleep (for using USART)
           sl_power_manager_add_em_requirement(SL_POWER_MANAGER_EM1);
@@ -295,24 +384,38 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
             == 0) {
           app_log("Char discovered\r\n");
           char_handle = evt->data.evt_gatt_characteristic.characteristic;
+        } else if (memcmp(creditsUUID,
+                          evt->data.evt_gatt_characteristic.uuid.data,
+                          16) == 0) {
+          app_log("Credits char discovered\r\n");
+          credits_char_handle =
+            evt->data.evt_gatt_characteristic.characteristic;
         }
       }
       break;
 
     case sl_bt_evt_gatt_characteristic_value_id:
-      if (evt->data.evt_gatt_characteristic_value.characteristic
-          == char_handle) {
-        for (uint8_t i = 0;
-             i < evt->data.evt_gatt_server_attribute_value.value.len; i++) {
-          sl_iostream_putchar(
-            sl_iostream_vcom_handle,
-            evt->data.evt_gatt_server_attribute_value.value.data[i]);
+    {
+      sl_bt_evt_gatt_characteristic_value_t *char_value;
+      uint16_t credits;
+      char_value = &evt->data.evt_gatt_characteristic_value;
+
+      if ((char_value->characteristic == credits_char_handle)
+          && (credits_char_handle > 0)) {
+        // Credit grant: number of bytes, 16-bit little endian
+        if (char_value->value.len == 2) {
+          credits = char_value->value.data[0]
+                    | (char_value->value.data[1] << 8);
+          tx_credits += credits;
+          counters.num_credits_received += credits;
         }
+      } else if (char_value->characteristic == char_handle) {
+        queue_uart_data(char_value->value.data, char_value->value.len);
         counters.num_pack_received++;
-        counters.num_bytes_received +=
-          evt->data.evt_gatt_server_attribute_value.value.len;
+        counters.num_bytes_received += char_value->value.len;
       }
-      break;
+    }
+    break;
 
     // -------------------------------
     // Default event handler.
@@ -363,72 +466,214 @@ static bool process_scan_response(
 
 static void print_stats(ts_counters *p_counters)
 {
+  uint32_t elapsed_ms = 0;
+
+  if (p_counters->start_tick != 0) {
+    elapsed_ms = sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count()
+                                          - p_counters->start_tick);
+  }
   app_log("Outgoing data:\r\n");
   app_log(" bytes/packets sent: %lu / %lu ",
           p_counters->num_bytes_sent,
           p_counters->num_pack_sent);
   app_log(", num writes: %lu\r\n", p_counters->num_writes);
-  app_log("(RX buffer overflow is not tracked)\r\n");
+  app_log(" bytes dropped on RX buffer overflow: %lu\r\n",
+          p_counters->num_bytes_dropped);
+  if (elapsed_ms != 0) {
+    app_log(" throughput: %lu bps\r\n",
+            (uint32_t)((uint64_t)p_counters->num_bytes_sent * 8000
+                       / elapsed_ms));
+  }
   app_log("Incoming data:\r\n");
   app_log(" bytes/packets received: %lu / %lu\r\n",
           p_counters->num_bytes_received,
           p_counters->num_pack_received);
+  app_log("Flow control:\r\n");
+  app_log(" credits received/returned: %lu / %lu",
+          p_counters->num_credits_received,
+          p_counters->num_credits_returned);
+  app_log(", overruns: %lu\r\n", p_counters->num_rx_overruns);
 
   return;
 }
 
+static void read_uart_data(void)
+{
+  uint8_t discard[64];
+  uint32_t free_space;
+  uint32_t chunk;
+  size_t bytes_read = 0;
+  sl_status_t sc;
+
+  do {
+    free_space = SPP_RX_RING_SIZE - (spp_rx_head - spp_rx_tail);
+    if (free_space == 0) {
+      // Keep the UART driver drained, but count what is lost
+      sc = sl_iostream_read(sl_iostream_vcom_handle,
+                            discard,
+                            sizeof(discard),
+                            &bytes_read);
+      if (sc != SL_STATUS_OK) {
+        // Nothing left to read, or the stream failed
+        break;
+      }
+      counters.num_bytes_dropped += bytes_read;
+    } else {
+      // Read up to the end of the ring, the rest on the next iteration
+      chunk = SPP_RX_RING_SIZE - (spp_rx_head & (SPP_RX_RING_SIZE - 1));
+      if (chunk > free_space) {
+        chunk = free_space;
+      }
+      sc = sl_iostream_read(sl_iostream_vcom_handle,
+                            &spp_rx_ring[spp_rx_head
+                                         & (SPP_RX_RING_SIZE - 1)],
+                            chunk,
+                            &bytes_read);
+      if (sc != SL_STATUS_OK) {
+        break;
+      }
+      spp_rx_head += bytes_read;
+    }
+    if (bytes_read > 0) {
+      spp_rx_last_tick = sl_sleeptimer_get_tick_count();
+    }
+  } while (bytes_read > 0);
+}
+
+static void queue_uart_data(const uint8_t *data, uint32_t len)
+{
+  uint32_t index, chunk;
+
+  if (len > UART_TX_RING_SIZE - (uart_tx_head - uart_tx_tail)) {
+    // The server sent more than its credits or does not use flow control:
+    //   make room by writing to the UART until the packet fits
+    if (flow_control) {
+      counters.num_rx_overruns++;
+    }
+    while (len > UART_TX_RING_SIZE - (uart_tx_head - uart_tx_tail)) {
+      write_uart_data();
+    }
+  }
+
+  index = uart_tx_head & (UART_TX_RING_SIZE - 1);
+  chunk = UART_TX_RING_SIZE - index;
+  if (chunk > len) {
+    chunk = len;
+  }
+  memcpy(&uart_tx_ring[index], data, chunk);
+  memcpy(uart_tx_ring, &data[chunk], len - chunk);
+  uart_tx_head += len;
+}
+
+static void write_uart_data(void)
+{
+  uint32_t len, index;
+
+  len = uart_tx_head - uart_tx_tail;
+  if (len == 0) {
+    return;
+  }
+
+  // Write up to the end of the ring, the rest on the next call
+  index = uart_tx_tail & (UART_TX_RING_SIZE - 1);
+  if (len > UART_TX_RING_SIZE - index) {
+    len = UART_TX_RING_SIZE - index;
+  }
+  if (len > UART_TX_CHUNK_SIZE) {
+    len = UART_TX_CHUNK_SIZE;
+  }
+  sl_iostream_write(sl_iostream_vcom_handle, &uart_tx_ring[index], len);
+  uart_tx_tail += len;
+  credits_to_return += len;
+}
+
+static void return_credits(void)
+{
+  uint8_t grant[2];
+  sl_status_t result;
+  uint16_t sent_len = 0;
+
+  if (!flow_control || (credits_to_return < CREDIT_BATCH_SIZE)) {
+    return;
+  }
+
+  grant[0] = (uint8_t)credits_to_return;
+  grant[1] = (uint8_t)(credits_to_return >> 8);
+  result = sl_bt_gatt_write_characteristic_value_without_response(
+    conn_handle,
+    credits_char_handle,
+    sizeof(grant),
+    grant,
+    &sent_len);
+  // On error, e.g. stack TX buffers full, the credits are kept and returned
+  //   on a next call
+  if (result == SL_STATUS_OK) {
+    counters.num_credits_returned += credits_to_return;
+    credits_to_return = 0;
+  }
+}
+
 static void send_spp_data()
 {
-  uint8_t len = 0;
   uint8_t data[256];
-  sl_status_t result, read_result;
+  uint32_t len, index, chunk;
+  sl_status_t result;
   uint16_t sent_len = 0;
-  uint32_t timeout = 0;
-  char c;
-
-  // Read up to max_packet_size characters from local buffer
-  while (len < max_packet_size) {
-    read_result = sl_iostream_getchar(sl_iostream_vcom_handle, &c);
-    if (SL_STATUS_OK == read_result) {
-      data[len++] = (uint8_t)c;
-    } else if (len == 0) {
-      /* If the first ReadChar() fails then return immediately */
-      return;
-    } else {
-      // Speed optimization: if there are some bytes to be sent but the length
-      // is still below the preferred minimum packet size, then wait for
-      // additional bytes until timeout. Target is to put as many bytes as
-      // possible into each air packet.
 
-      // Conditions for exiting the while loop and proceed to send data:
-      if (timeout++ > UART_POLL_TIMEOUT) {
-        break;
-      } else if (len >= min_packet_size) {
+  read_uart_data();
+
+  while (spp_rx_head != spp_rx_tail) {
+    len = spp_rx_head - spp_rx_tail;
+    if (len > max_packet_size) {
+      len = max_packet_size;
+    } else if ((len < max_packet_size)
+               && (sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count()
+                                            - spp_rx_last_tick)
+                   < UART_IDLE_FLUSH_MS)) {
+      // Speed optimization: wait for a full packet until the UART is idle.
+      // Target is to put as many bytes as possible into each air packet.
+      break;
+    }
+    if (flow_control) {
+      // Only send what the server has room for
+      if (tx_credits == 0) {
         break;
       }
+      if (len > tx_credits) {
+        len = tx_credits;
+      }
     }
-  }
 
-  if (len > 0) {
-    // Stack may return "out-of-memory" (SL_STATUS_NO_MORE_RESOURCE) error if
-    //   the local buffer is full -> in that case, just keep trying until the
-    //   command succeeds
-    do {
-      result = sl_bt_gatt_write_characteristic_value_without_response(
-        conn_handle,
-        char_handle,
-        len,
-        data,
-        &sent_len);
-      counters.num_writes++;
-    } while (result == SL_STATUS_NO_MORE_RESOURCE);
-
-    if (result != 0) {
+    index = spp_rx_tail & (SPP_RX_RING_SIZE - 1);
+    chunk = SPP_RX_RING_SIZE - index;
+    if (chunk > len) {
+      chunk = len;
+    }
+    memcpy(data, &spp_rx_ring[index], chunk);
+    memcpy(&data[chunk], spp_rx_ring, len - chunk);
+
+    result = sl_bt_gatt_write_characteristic_value_without_response(
+      conn_handle,
+      char_handle,
+      len,
+      data,
+      &sent_len);
+    counters.num_writes++;
+    if (result == SL_STATUS_NO_MORE_RESOURCE) {
+      // Stack TX buffers are full, the data stays in the ring buffer and is
+      //   sent on a next call, once the stack has freed some buffers
+      break;
+    } else if (result != SL_STATUS_OK) {
       app_log("Unexpected error: %lu\r\n", result);
-    } else {
-      counters.num_pack_sent++;
-      counters.num_bytes_sent += len;
+      spp_rx_tail += len;
+      break;
+    }
+    spp_rx_tail += len;
+    if (flow_control) {
+      tx_credits -= len;
     }
+    counters.num_pack_sent++;
+    counters.num_bytes_sent += len;
   }
   return;
 }
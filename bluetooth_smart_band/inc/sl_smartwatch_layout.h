@@ -0,0 +1,88 @@
+/***************************************************************************//**
+ * @file
+ * @brief Text layout of the notifications (header)
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+
+#ifndef SL_SMARTWATCH_LAYOUT_H
+#define SL_SMARTWATCH_LAYOUT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Printable characters kept of one message
+#define SL_SMARTWATCH_LAYOUT_TEXT_SIZE    100
+// Rows of one message, the rest of a longer message is dropped
+#define SL_SMARTWATCH_LAYOUT_ROWS         16
+
+/// One row of the display, a run of characters drawn in one go
+typedef struct {
+  uint8_t start;      ///< Offset of the first character in the text
+  uint8_t len;        ///< Number of characters, 0 for an empty row
+} sl_smartwatch_layout_row_t;
+
+/// Message broken into display rows
+typedef struct {
+  char text[SL_SMARTWATCH_LAYOUT_TEXT_SIZE];  ///< Printable characters
+  uint8_t len;                                ///< Length of the text
+  sl_smartwatch_layout_row_t rows[SL_SMARTWATCH_LAYOUT_ROWS];
+  uint8_t row_count;                          ///< Rows in use
+  uint8_t row_chars;                          ///< Characters per row
+  bool row_break;                             ///< Next character starts a
+                                              ///< new row
+} sl_smartwatch_layout_t;
+
+/**************************************************************************//**
+ *  Starts an empty layout.
+ *
+ *  @param[out] layout     Layout.
+ *  @param[in]  row_chars  Number of characters that fit on a row.
+ *****************************************************************************/
+void sl_smartwatch_layout_init(sl_smartwatch_layout_t *layout,
+                               uint8_t row_chars);
+
+/**************************************************************************//**
+ *  Appends a fragment of the message and breaks it into rows. Only the new
+ *  characters are looked at, the rows laid out before are kept. A row ends
+ *  at a line break or when it is full. Characters that can not be printed
+ *  are dropped.
+ *
+ *  @param[in,out] layout  Layout.
+ *  @param[in]     data    Fragment of the message.
+ *  @param[in]     len     Length of the fragment.
+ *****************************************************************************/
+void sl_smartwatch_layout_append(sl_smartwatch_layout_t *layout,
+                                 const char *data,
+                                 uint16_t len);
+
+#endif /* SL_SMARTWATCH_LAYOUT_H */
@@ -37,6 +37,8 @@
 #ifndef SL_SMARTWATCH_UI_H
 #define SL_SMARTWATCH_UI_H
 
+#include "sl_smartwatch_layout.h"
+
 // <o SMARTWATCH_UI_LOG_ENABLE> Enable logging
 // <i> Enables UI logging.
 // <i> Default: 1
@@ -65,16 +67,6 @@ void sl_smartwatch_ui_update(void);
  *****************************************************************************/
 void sl_smartwatch_ui_clear_screen(void);
 
-/**************************************************************************//**
- *  Returns the number of rows it will take to print given number of characters
- *   based on the selected font and display size. Display should be initialized
- *   before calling this.
- *
- * @param[in] charCount number of characters.
- * @return number of rows required to print given number of characters.
- *****************************************************************************/
-uint8_t sl_smartwatch_ui_char_to_rows(uint8_t charCount);
-
 /**************************************************************************//**
  *  Prints a wrapped string on the display. When the maximum characters in a
  *  row are printed, the cursor moves to the next line. Multiple calls to this
@@ -85,19 +77,22 @@ uint8_t sl_smartwatch_ui_char_to_rows(uint8_t charCount);
 void sl_smartwatch_ui_print_text_wrapped(char *data);
 
 /**************************************************************************//**
- *  Prints wrapped string on the display shifted on X and Y axis. A global
- *  variable in sl_smartwatch_ui.c named 'row_to_print' is updated to keep a
- *  track of last printed row.
+ *  Prints laid out messages on the display shifted on X and Y axis. Each
+ *  message starts on a new row. A global variable in sl_smartwatch_ui.c named
+ *  'row_to_print' is updated to the row after the last message.
  *
- *  @param[in] data  A pointer to the character array to be printed.
+ *  @param[in] layouts  Messages, in the order they are shown.
+ *  @param[in] count    Number of messages.
  *  @param[in] xOffset The number of pixels to shift on the X axis. Positive
  *   values prints the string shifted towards right and negative values towards
  *   left.
  *  @param[in] yOffset The number of pixels to shift on the Y axis. Positive
  *   values prints the string shifted downwards and negative values upwards.
  *****************************************************************************/
-void sl_smartwatch_ui_print_text_with_offset(char *data, int16_t xOffset,
-                                             int16_t yOffset);
+void sl_smartwatch_ui_print_layout(const sl_smartwatch_layout_t *layouts,
+                                   uint8_t count,
+                                   int16_t xOffset,
+                                   int16_t yOffset);
 
 /**************************************************************************//**
  *  Clears the screen and prints time on line zero and date on line one
@@ -75,6 +75,10 @@
 
 char notifData[NOTIF_COUNT][NOTIF_SIZE];
 uint8_t notifPtr = NOTIF_COUNT;
+// Rows of each notification, laid out as its packets arrive
+static sl_smartwatch_layout_t notifLayout[NOTIF_COUNT];
+// Bytes of each notification written so far
+static uint16_t notifLen[NOTIF_COUNT];
 // batteryLevel[6]: 00-not charging, 01-charging, 02-charged;
 // batteryLevel[7]: battery %
 uint8_t batteryLevel[] = { 0xAB, 0x00, 0x05, 0xFF, 0x91, 0x80, 0x00, 0x64 };
@@ -103,6 +107,7 @@ int16_t current_scroll = 0;          // to keep the track of row while scrolling
 // screen configuration values, defined in sl_smartwatch_ui_init()
 extern uint8_t max_rows_on_display;
 extern uint8_t row_height;
+extern uint8_t chars_per_row;
 
 // The advertising set handle allocated from Bluetooth stack.
 static uint8_t advertising_set_handle = 0xff;
@@ -126,6 +131,27 @@ static bool time_set = false;
  *****************************************************************************/
 void dataFilter(uint8_t len, uint8_t data[]);
 
+/**************************************************************************//**
+ * Takes the next notification slot and clears it.
+ *****************************************************************************/
+static void notif_new(void);
+
+/**************************************************************************//**
+ * Lays out bytes written to a notification. A fragment that continues the
+ * notification is only appended to its rows, any other fragment lays the
+ * whole notification out again.
+ *
+ * @param[in] slot index of the notification
+ * @param[in] offset offset of the bytes in the notification
+ * @param[in] len number of bytes
+ *****************************************************************************/
+static void notif_layout_update(uint8_t slot, uint16_t offset, uint16_t len);
+
+/**************************************************************************//**
+ * Returns the number of rows of the stored notifications.
+ *****************************************************************************/
+static uint8_t notif_row_count(void);
+
 /**************************************************************************//**
  * Application Init.
  *****************************************************************************/
@@ -341,24 +367,11 @@ void show_time()
  *****************************************************************************/
 void show_notif(uint16_t xOffset, uint16_t yOffset)
 {
-  char tempString[NOTIF_COUNT * NOTIF_SIZE] = "";
-  uint16_t j = 0;
-  for (uint8_t i = notifPtr; i < NOTIF_COUNT; i++) {
-    sl_strcat_s(tempString, sizeof(tempString), notifData[i]);
-    sl_strcat_s(tempString, sizeof(tempString), "\n");
-  }
-  for (uint16_t i = 0; i < sl_strlen(tempString); i++) {
-    if ((!((tempString[i] < ' ') || (tempString[i] > '~')))
-        || (tempString[i] == '\n')) {
-      tempString[j] = tempString[i];
-      j++;
-    }
-  }
-  char notifString[j];
-  for (uint16_t i = 0; i < j; i++) {
-    notifString[i] = tempString[i];
-  }
-  sl_smartwatch_ui_print_text_with_offset(notifString, xOffset, yOffset);
+  // Notifications are stored from the newest one, at notifPtr, onwards
+  sl_smartwatch_ui_print_layout(&notifLayout[notifPtr],
+                                NOTIF_COUNT - notifPtr,
+                                (int16_t) xOffset,
+                                (int16_t) yOffset);
   sl_smartwatch_ui_update();
   LOG("NOTIF PRINTED\n");
 }
@@ -386,14 +399,17 @@ void dataFilter(uint8_t len, uint8_t data[])
   if (pData[0] != 0xAB) {
     // extension message of long notifs
     uint8_t packetNo = pData[0];
-    for (uint8_t i = 1; i < len; i++) {
-      notifData[notifPtr][(packetNo * 19) + 12 + i - 1] = (char) pData[i];
+    uint16_t offset = (packetNo * 19) + 12;
+    if ((notifPtr == NOTIF_COUNT) || (len < 1)
+        || (offset + len - 1 > NOTIF_SIZE)) {
+      app_log_warning("Dropped notification packet %d\n", packetNo);
+      return;
     }
-    row_count = 0;
-    for (uint8_t i = notifPtr; i < NOTIF_COUNT; i++) {
-      row_count += sl_smartwatch_ui_char_to_rows((uint8_t) (sl_strlen(
-                                                              notifData[i])));
+    for (uint8_t i = 1; i < len; i++) {
+      notifData[notifPtr][offset + i - 1] = (char) pData[i];
     }
+    notif_layout_update(notifPtr, offset, len - 1);
+    row_count = notif_row_count();
     if (row_count > max_rows_on_display) {
       current_scroll = 0;
       canScrollUp = false;
@@ -468,7 +484,7 @@ void dataFilter(uint8_t len, uint8_t data[])
         switch (pData[6]) {
           case 0x01:
 
-            notifPtr--;
+            notif_new();
             char prefix_str[] = "Call from: ";
             for (uint8_t i = 0; i < sl_strlen(prefix_str); i++) {
               notifData[notifPtr][i] = (char) prefix_str[i];
@@ -478,23 +494,23 @@ void dataFilter(uint8_t len, uint8_t data[])
               notifData[notifPtr][i] = (char) pData[i + 8 - sl_strlen(
                                                       prefix_str)];
             }
+            notif_layout_update(notifPtr,
+                                0,
+                                sl_strlen(prefix_str)
+                                + ((len > 8) ? len - 8 : 0));
             LOG("saved CALL INFO to memory\n");
             break;
 
           default:
-            notifPtr--;
+            notif_new();
             for (uint8_t i = 0; i < (len - 8); i++) {
               notifData[notifPtr][i] = (char) pData[i + 8];
             }
+            notif_layout_update(notifPtr, 0, (len > 8) ? len - 8 : 0);
             break;
         }
 
-        row_count = 0;
-
-        for (uint8_t i = notifPtr; i < NOTIF_COUNT; i++) {
-          row_count += sl_smartwatch_ui_char_to_rows(
-            (uint8_t) (sl_strlen(notifData[i])));
-        }
+        row_count = notif_row_count();
 
         if (row_count > max_rows_on_display) {
           current_scroll = 0;
@@ -520,6 +536,44 @@ void dataFilter(uint8_t len, uint8_t data[])
   }
 }
 
+static void notif_new(void)
+{
+  notifPtr--;
+  memset(notifData[notifPtr], 0, sizeof(notifData[notifPtr]));
+  notifLen[notifPtr] = 0;
+  sl_smartwatch_layout_init(&notifLayout[notifPtr], chars_per_row);
+}
+
+static void notif_layout_update(uint8_t slot, uint16_t offset, uint16_t len)
+{
+  if (offset == notifLen[slot]) {
+    sl_smartwatch_layout_append(&notifLayout[slot],
+                                &notifData[slot][offset],
+                                len);
+    notifLen[slot] = offset + len;
+    return;
+  }
+
+  // Fragment out of order, the bytes not received yet are zero
+  if (offset + len > notifLen[slot]) {
+    notifLen[slot] = offset + len;
+  }
+  sl_smartwatch_layout_init(&notifLayout[slot], chars_per_row);
+  sl_smartwatch_layout_append(&notifLayout[slot],
+                              notifData[slot],
+                              notifLen[slot]);
+}
+
+static uint8_t notif_row_count(void)
+{
+  uint8_t rows = 0;
+
+  for (uint8_t i = notifPtr; i < NOTIF_COUNT; i++) {
+    rows += notifLayout[i].row_count;
+  }
+  return rows;
+}
+
 void sl_button_on_change(const sl_button_t *handle)
 {
   if (sl_button_get_state(handle) == SL_SIMPLE_BUTTON_RELEASED) {
@@ -554,11 +608,7 @@ void sl_button_on_change(const sl_button_t *handle)
             sl_smartwatch_ui_update();
           } else {
             sl_smartwatch_ui_clear_screen();
-            row_count = 0;
-            for (uint8_t i = notifPtr; i < NOTIF_COUNT; i++) {
-              row_count += sl_smartwatch_ui_char_to_rows(
-                (uint8_t) (sl_strlen(notifData[i])));
-            }
+            row_count = notif_row_count();
             if (row_count > max_rows_on_display) {
               current_scroll = 0;
               canScrollUp = false;
@@ -580,11 +630,7 @@ void sl_button_on_change(const sl_button_t *handle)
           sl_smartwatch_ui_update();
         } else {
           sl_smartwatch_ui_clear_screen();
-          row_count = 0;
-          for (uint8_t i = notifPtr; i < NOTIF_COUNT; i++) {
-            row_count += sl_smartwatch_ui_char_to_rows(
-              (uint8_t) (sl_strlen(notifData[i])));
-          }
+          row_count = notif_row_count();
           if (row_count > max_rows_on_display) {
             current_scroll = 0;
             canScrollUp = false;
@@ -0,0 +1,118 @@
+/***************************************************************************//**
+ * @file
+ * @brief Text layout of the notifications
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+
+#include "sl_smartwatch_layout.h"
+
+// ----------------------------------------------------------------------------
+// Private function declarations
+
+static bool new_row(sl_smartwatch_layout_t *layout);
+
+// ----------------------------------------------------------------------------
+// Global functions
+
+/**************************************************************************//**
+ *  Starts an empty layout.
+ *****************************************************************************/
+void sl_smartwatch_layout_init(sl_smartwatch_layout_t *layout,
+                               uint8_t row_chars)
+{
+  layout->len = 0;
+  layout->row_count = 0;
+  layout->row_chars = row_chars;
+  layout->row_break = false;
+}
+
+/**************************************************************************//**
+ *  Appends a fragment of the message and breaks it into rows.
+ *****************************************************************************/
+void sl_smartwatch_layout_append(sl_smartwatch_layout_t *layout,
+                                 const char *data,
+                                 uint16_t len)
+{
+  sl_smartwatch_layout_row_t *row;
+
+  for (uint16_t i = 0; i < len; i++) {
+    if (data[i] == '\n') {
+      // A line break at the start or right after another one leaves an
+      // empty row
+      if ((layout->row_count == 0) || layout->row_break) {
+        if (!new_row(layout)) {
+          return;
+        }
+      }
+      layout->row_break = true;
+      continue;
+    }
+    if ((data[i] < ' ') || (data[i] > '~')) {
+      continue;
+    }
+    if (layout->len >= SL_SMARTWATCH_LAYOUT_TEXT_SIZE) {
+      return;
+    }
+    if ((layout->row_count == 0)
+        || layout->row_break
+        || (layout->rows[layout->row_count - 1].len >= layout->row_chars)) {
+      if (!new_row(layout)) {
+        return;
+      }
+      layout->row_break = false;
+    }
+    row = &layout->rows[layout->row_count - 1];
+    layout->text[layout->len++] = data[i];
+    row->len++;
+  }
+}
+
+// ----------------------------------------------------------------------------
+// Private functions
+
+/**************************************************************************//**
+ *  Adds an empty row at the end of the text.
+ *
+ *  @param[in,out] layout  Layout.
+ *  @return false if the row table is full.
+ *****************************************************************************/
+static bool new_row(sl_smartwatch_layout_t *layout)
+{
+  if (layout->row_count >= SL_SMARTWATCH_LAYOUT_ROWS) {
+    return false;
+  }
+  layout->rows[layout->row_count].start = layout->len;
+  layout->rows[layout->row_count].len = 0;
+  layout->row_count++;
+  return true;
+}
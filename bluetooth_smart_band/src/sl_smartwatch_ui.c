@@ -37,6 +37,7 @@
 #include <sl_string.h>
 #include <stdio.h>
 #include "em_types.h"
+#include "sl_sleeptimer.h"
 #include "glib.h"
 #include "dmd/dmd.h"
 #include "sl_smartwatch_ui.h"
@@ -63,6 +64,7 @@ static GLIB_Context_t glibContext;
 uint8_t max_rows_on_display;
 uint8_t row_height;
 uint8_t col_width;
+uint8_t chars_per_row;
 
 // ----------------------------------------------------------------------------
 // Private function declarations
@@ -96,7 +98,8 @@ static void clear_row(int16_t row)
 }
 
 /**************************************************************************//**
- *  private function to print a wrapped string on the display.
+ *  private function to print a wrapped string on the display. Each row is
+ *  drawn as one run of characters.
  *
  *  @param[in]  str  A pointer to the character array to be printed.
  *  @param[in]  row The row number to be printed on
@@ -104,132 +107,39 @@ static void clear_row(int16_t row)
 static void write_row_wrapped(char *str, int16_t row)
 {
   EMSTATUS status;
-  int32_t x, y, x0, y0;
-  bool opaque = false;
-  uint8_t characters_printed = 0;
-
-  x0 = COL_OFFSET;
-  y0 = ROW_OFFSET + (row - 1) * row_height;
-  x = x0;
-  y = y0;
-
-  row--;
-  row_to_print--;
-
-  uint8_t max_char_row = (uint8_t) ((SL_MEMLCD_DISPLAY_WIDTH - COL_OFFSET)
-                                    / col_width);
+  size_t len = sl_strlen(str);
+  size_t start = 0;
+  size_t run;
 
   LOG("printing on display:\n");
-  // Loops through the string and prints char for char
-  for (uint32_t stringIndex = 0; stringIndex < sl_strlen(str); stringIndex++) {
-    if (str[stringIndex] == '\n') {
-      characters_printed = characters_printed
-                           - (characters_printed % max_char_row) + max_char_row;
-      continue;
-    } else if (characters_printed % max_char_row == 0) {
-      row++;
-      row_to_print++;
-      clear_row(row);
-      x = x0;
-      y = y + row_height;
+  while (start < len) {
+    // A row ends at a line break or when it is full
+    run = 0;
+    while ((start + run < len)
+           && (str[start + run] != '\n')
+           && (run < chars_per_row)) {
+      run++;
     }
-
-    status = GLIB_drawChar(&glibContext, str[stringIndex], x, y, opaque);
-    if (status == GLIB_ERROR_INVALID_CHAR) {
-      continue;
-    } else {
+    clear_row(row);
+    if (run > 0) {
+      status = GLIB_drawString(&glibContext,
+                               &str[start],
+                               run,
+                               COL_OFFSET,
+                               ROW_OFFSET + row * row_height,
+                               false);
       app_assert(status <= GLIB_ERROR_NOTHING_TO_DRAW,
-                 "Failed to draw character\n");
-      characters_printed++;
+                 "Failed to draw string\n");
     }
-    x += col_width;
-  }
-  LOG("%s", str);
-  LOGLN();
-  row++;
-  row_to_print++;
-}
-
-/**************************************************************************//**
- *  private function to print wrapped string on the display shifted on X and Y
- *   axis.
- *
- *  @param[in]   str  A pointer to the character array to be printed.
- *  @param[in]  row The row number to be printed on
- *  @param[in]   xOffset The number of pixels to shift on the X axis. Positive
- *   values prints the string shifted towards right and negative values towards
- *   left.
- *  @param[in]   yOffset The number of pixels to shift on the Y axis. Positive
- *   values prints the string shifted downwards and negative values upwards.
- *****************************************************************************/
-static void write_row_with_offset(char *str, int16_t row, int16_t xOffset,
-                                  int16_t yOffset)
-{
-  EMSTATUS status;
-  int32_t x, y, x0, y0;
-  bool opaque = false;
-  uint8_t rows_to_skip = 0, characters_printed = 0;
-  int16_t pixels_to_skip = 0;
-
-  // Limiting offset values
-  xOffset = xOffset % SL_MEMLCD_DISPLAY_WIDTH;
-  yOffset = yOffset % SL_MEMLCD_DISPLAY_HEIGHT;
-
-  if (yOffset < 0) {
-    rows_to_skip = (uint8_t) (abs(yOffset) / row_height);
-  } else if (yOffset > 0) {
-    row += (uint8_t) (yOffset / row_height);
-    row_to_print += (uint8_t) (yOffset / row_height);
-  } else {
-    rows_to_skip = 0;
-  }
-
-  pixels_to_skip = yOffset % row_height;
-
-  x0 = COL_OFFSET + xOffset;
-  y0 = ROW_OFFSET + (row - 1) * row_height;
-  x = x0;
-  y = y0 + pixels_to_skip;
-
-  row--;
-  row_to_print--;
-
-  uint8_t max_char_row = (uint8_t) ((SL_MEMLCD_DISPLAY_WIDTH - COL_OFFSET)
-                                    / col_width);
-
-  LOG("printing on display:\n");
-  // Loops through the string and prints char for char
-  for (uint32_t stringIndex = 0; stringIndex < sl_strlen(str); stringIndex++) {
-    if (str[stringIndex] == '\n') {
-      characters_printed = characters_printed
-                           - (characters_printed % max_char_row) + max_char_row;
-      continue;
-    } else if (characters_printed % max_char_row == 0) {
-      row++;
-      row_to_print++;
-      if (row >= rows_to_skip) {
-        x = x0;
-        y = y + row_height;
-      }
+    row++;
+    start += run;
+    if ((start < len) && (str[start] == '\n')) {
+      start++;
     }
-    if (row >= rows_to_skip) {
-      status = GLIB_drawChar(&glibContext, str[stringIndex], x, y, opaque);
-      if (status == GLIB_ERROR_INVALID_CHAR) {
-        continue;
-      } else {
-        app_assert(status <= GLIB_ERROR_NOTHING_TO_DRAW,
-                   "Failed to draw character\n");
-        characters_printed++;
-      }
-    } else {
-      characters_printed++;
-    }
-    x += col_width;
   }
+  row_to_print = row;
   LOG("%s", str);
   LOGLN();
-  row++;
-  row_to_print++;
 }
 
 // ----------------------------------------------------------------------------
@@ -269,6 +179,8 @@ void sl_smartwatch_ui_init(void)
                           + glibContext.font.lineSpacing);
   col_width = (uint8_t) (glibContext.font.fontWidth
                          + glibContext.font.charSpacing);
+  chars_per_row = (uint8_t) ((SL_MEMLCD_DISPLAY_WIDTH - COL_OFFSET)
+                             / col_width);
 
   sl_smartwatch_ui_clear_screen();
   sl_smartwatch_ui_update();
@@ -298,23 +210,6 @@ void sl_smartwatch_ui_clear_screen(void)
   app_assert(DMD_OK == status, "Failed to clear the display\n");
 }
 
-/**************************************************************************//**
- *  Returns the number of rows it will take to print given number of characters
- *   based on the selected font and display size. Display should be initialized
- *   before calling this.
- *****************************************************************************/
-uint8_t sl_smartwatch_ui_char_to_rows(uint8_t charCount)
-{
-  uint8_t max_char_row = (uint8_t) (SL_MEMLCD_DISPLAY_WIDTH / (col_width));
-  uint8_t no_of_rows;
-  if (charCount % max_char_row) {
-    no_of_rows = (uint8_t) ((charCount / max_char_row) + 1);
-  } else {
-    no_of_rows = (uint8_t) (charCount / max_char_row);
-  }
-  return no_of_rows;
-}
-
 /**************************************************************************//**
  *  Prints a wrapped string on the display. When the maximum characters in a
  *  row are printed, the cursor moves to the next line. Multiple calls to this
@@ -322,20 +217,60 @@ uint8_t sl_smartwatch_ui_char_to_rows(uint8_t charCount)
  *****************************************************************************/
 void sl_smartwatch_ui_print_text_wrapped(char *data)
 {
-  clear_row(row_to_print);
   write_row_wrapped(data, row_to_print);
 }
 
 /**************************************************************************//**
- *  Prints wrapped string on the display shifted on X and Y axis. A global
- *  variable in sl_smartwatch_ui.c named 'row_to_print' is updated to keep a
- *  track of last printed row.
+ *  Prints laid out messages on the display shifted on X and Y axis. Only the
+ *  rows that are on the screen are drawn, each as one run of characters.
  *****************************************************************************/
-void sl_smartwatch_ui_print_text_with_offset(char *data, int16_t xOffset,
-                                             int16_t yOffset)
+void sl_smartwatch_ui_print_layout(const sl_smartwatch_layout_t *layouts,
+                                   uint8_t count,
+                                   int16_t xOffset,
+                                   int16_t yOffset)
 {
-  clear_row(row_to_print);
-  write_row_with_offset(data, row_to_print, xOffset, yOffset);
+  EMSTATUS status;
+  const sl_smartwatch_layout_t *layout;
+  const sl_smartwatch_layout_row_t *row;
+  uint32_t start = sl_sleeptimer_get_tick_count();
+  uint32_t elapsed;
+  int32_t y = ROW_OFFSET + row_to_print * row_height + yOffset;
+  uint16_t rows_drawn = 0;
+
+  xOffset = xOffset % SL_MEMLCD_DISPLAY_WIDTH;
+
+  for (uint8_t i = 0; (i < count) && (y < SL_MEMLCD_DISPLAY_HEIGHT); i++) {
+    layout = &layouts[i];
+    // Messages scrolled above the screen are skipped as a whole
+    if (y + layout->row_count * row_height <= 0) {
+      y += layout->row_count * row_height;
+      continue;
+    }
+    for (uint8_t r = 0;
+         (r < layout->row_count) && (y < SL_MEMLCD_DISPLAY_HEIGHT);
+         r++) {
+      row = &layout->rows[r];
+      if ((y + row_height > 0) && (row->len > 0)) {
+        status = GLIB_drawString(&glibContext,
+                                 &layout->text[row->start],
+                                 row->len,
+                                 COL_OFFSET + xOffset,
+                                 y,
+                                 false);
+        app_assert(status <= GLIB_ERROR_NOTHING_TO_DRAW,
+                   "Failed to draw string\n");
+        rows_drawn++;
+      }
+      y += row_height;
+    }
+  }
+  row_to_print = (int16_t) ((y - ROW_OFFSET) / row_height);
+
+  elapsed = sl_sleeptimer_get_tick_count() - start;
+  LOG("%d rows drawn in %lu us", rows_drawn,
+      (unsigned long) ((uint64_t) elapsed * 1000000
+                       / sl_sleeptimer_get_timer_frequency()));
+  LOGLN();
 }
 
 /**************************************************************************//**
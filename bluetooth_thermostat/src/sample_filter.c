@@ -0,0 +1,276 @@
+/***************************************************************************//**
+ * @file sample_filter.c
+ * @brief Fixed-point sliding window filter for sensor samples.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *******************************************************************************
+ * # Experimental Quality
+ * This code has not been formally tested and is provided as-is. It is not
+ * suitable for production environments. In addition, this code will not be
+ * maintained and there may be no bug maintenance planned for these resources.
+ * Silicon Labs may update projects from time to time.
+ ******************************************************************************/
+#include <string.h>
+#include "sample_filter.h"
+
+// -----------------------------------------------------------------------------
+// Private function declarations
+
+static void queue_push(sample_filter_queue_t *queue,
+                       int32_t value,
+                       uint32_t seq,
+                       bool keep_smaller);
+static void queue_expire(sample_filter_queue_t *queue, uint32_t oldest_seq);
+static void sorted_remove(sample_filter_t *filter, int32_t value);
+static void sorted_insert(sample_filter_t *filter, int32_t value);
+static uint8_t sorted_search(const sample_filter_t *filter,
+                             uint8_t n,
+                             int32_t value);
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+sl_status_t sample_filter_init(sample_filter_t *filter,
+                               sample_filter_mode_t mode,
+                               uint8_t size,
+                               uint8_t ema_shift)
+{
+  if ((size == 0)
+      || (size > SAMPLE_FILTER_WINDOW_MAX)
+      || (mode > SAMPLE_FILTER_EMA)
+      || (ema_shift > 16)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  filter->mode = mode;
+  filter->size = size;
+  filter->ema_shift = ema_shift;
+  sample_filter_reset(filter);
+  return SL_STATUS_OK;
+}
+
+void sample_filter_reset(sample_filter_t *filter)
+{
+  filter->min.head = 0;
+  filter->min.len = 0;
+  filter->max.head = 0;
+  filter->max.len = 0;
+  filter->sum = 0;
+  filter->ema = 0;
+  filter->seq = 0;
+  filter->count = 0;
+  filter->head = 0;
+}
+
+void sample_filter_push(sample_filter_t *filter, int32_t sample)
+{
+  uint8_t tail;
+  int32_t oldest;
+
+  if (filter->count == filter->size) {
+    // The oldest sample leaves the window
+    oldest = filter->window[filter->head];
+    filter->sum -= oldest;
+    if (filter->mode == SAMPLE_FILTER_MEDIAN) {
+      sorted_remove(filter, oldest);
+    }
+    filter->window[filter->head] = sample;
+    filter->head = (filter->head + 1) % filter->size;
+  } else {
+    tail = (filter->head + filter->count) % filter->size;
+    filter->window[tail] = sample;
+    filter->count++;
+  }
+  filter->sum += sample;
+  if (filter->mode == SAMPLE_FILTER_MEDIAN) {
+    sorted_insert(filter, sample);
+  }
+
+  // Drop the extremes that left the window before queueing the new sample,
+  // so a queue never holds more than a window
+  if (filter->seq + 1 > filter->size) {
+    queue_expire(&filter->min, filter->seq + 1 - filter->size);
+    queue_expire(&filter->max, filter->seq + 1 - filter->size);
+  }
+  queue_push(&filter->min, sample, filter->seq, true);
+  queue_push(&filter->max, sample, filter->seq, false);
+
+  if (filter->seq == 0) {
+    filter->ema = (int64_t)sample * (1 << SAMPLE_FILTER_EMA_FRAC_BITS);
+  } else {
+    filter->ema += ((int64_t)sample * (1 << SAMPLE_FILTER_EMA_FRAC_BITS)
+                    - filter->ema) / (1 << filter->ema_shift);
+  }
+  filter->seq++;
+}
+
+int32_t sample_filter_get(const sample_filter_t *filter)
+{
+  uint8_t mid;
+
+  if (filter->count == 0) {
+    return 0;
+  }
+
+  switch (filter->mode) {
+    case SAMPLE_FILTER_TRIMMED_MEAN:
+      return sample_filter_trimmed_mean(filter);
+
+    case SAMPLE_FILTER_MEDIAN:
+      mid = filter->count / 2;
+      if (filter->count & 1) {
+        return filter->sorted[mid];
+      }
+      return (int32_t)(((int64_t)filter->sorted[mid - 1]
+                        + filter->sorted[mid]) / 2);
+
+    case SAMPLE_FILTER_EMA:
+      return (int32_t)(filter->ema / (1 << SAMPLE_FILTER_EMA_FRAC_BITS));
+
+    default:
+      return sample_filter_mean(filter);
+  }
+}
+
+int32_t sample_filter_mean(const sample_filter_t *filter)
+{
+  if (filter->count == 0) {
+    return 0;
+  }
+  return (int32_t)(filter->sum / filter->count);
+}
+
+int32_t sample_filter_trimmed_mean(const sample_filter_t *filter)
+{
+  if (filter->count <= 2) {
+    return sample_filter_mean(filter);
+  }
+  return (int32_t)((filter->sum
+                    - sample_filter_min(filter)
+                    - sample_filter_max(filter))
+                   / (filter->count - 2));
+}
+
+int32_t sample_filter_min(const sample_filter_t *filter)
+{
+  if (filter->min.len == 0) {
+    return 0;
+  }
+  return filter->min.entry[filter->min.head].value;
+}
+
+int32_t sample_filter_max(const sample_filter_t *filter)
+{
+  if (filter->max.len == 0) {
+    return 0;
+  }
+  return filter->max.entry[filter->max.head].value;
+}
+
+uint8_t sample_filter_count(const sample_filter_t *filter)
+{
+  return filter->count;
+}
+
+// -----------------------------------------------------------------------------
+// Private function definitions
+
+// The queue holds the candidates for the minimum (or maximum) in sample
+// order. A new sample evicts every candidate it beats, as that one can never
+// be the extreme again, so the head is always the extreme of the window and
+// every sample is pushed and popped at most once.
+static void queue_push(sample_filter_queue_t *queue,
+                       int32_t value,
+                       uint32_t seq,
+                       bool keep_smaller)
+{
+  sample_filter_extreme_t *last;
+  uint8_t tail;
+
+  while (queue->len > 0) {
+    last = &queue->entry[(queue->head + queue->len - 1)
+                         % SAMPLE_FILTER_WINDOW_MAX];
+    if (keep_smaller ? (last->value < value) : (last->value > value)) {
+      break;
+    }
+    queue->len--;
+  }
+
+  tail = (queue->head + queue->len) % SAMPLE_FILTER_WINDOW_MAX;
+  queue->entry[tail].value = value;
+  queue->entry[tail].seq = seq;
+  queue->len++;
+}
+
+static void queue_expire(sample_filter_queue_t *queue, uint32_t oldest_seq)
+{
+  while ((queue->len > 0) && (queue->entry[queue->head].seq < oldest_seq)) {
+    queue->head = (queue->head + 1) % SAMPLE_FILTER_WINDOW_MAX;
+    queue->len--;
+  }
+}
+
+static void sorted_remove(sample_filter_t *filter, int32_t value)
+{
+  uint8_t n = filter->count;
+  uint8_t i = sorted_search(filter, n, value);
+
+  memmove(&filter->sorted[i],
+          &filter->sorted[i + 1],
+          (n - i - 1) * sizeof(filter->sorted[0]));
+}
+
+static void sorted_insert(sample_filter_t *filter, int32_t value)
+{
+  // sorted[] holds count - 1 values at this point
+  uint8_t n = filter->count - 1;
+  uint8_t i = sorted_search(filter, n, value);
+
+  memmove(&filter->sorted[i + 1],
+          &filter->sorted[i],
+          (n - i) * sizeof(filter->sorted[0]));
+  filter->sorted[i] = value;
+}
+
+// First of the n sorted values not smaller than value
+static uint8_t sorted_search(const sample_filter_t *filter,
+                             uint8_t n,
+                             int32_t value)
+{
+  uint8_t low = 0;
+  uint8_t high = n;
+  uint8_t mid;
+
+  while (low < high) {
+    mid = (low + high) / 2;
+    if (filter->sorted[mid] < value) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
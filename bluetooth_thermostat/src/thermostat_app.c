@@ -51,6 +51,7 @@
 #include "oled_app.h"
 #include "thermostat_app.h"
 #include "buzz2_app.h"
+#include "sample_filter.h"
 
 /***************************************************************************//**
  * @addtogroup thermostat_app
@@ -65,6 +66,8 @@
 #define THERMOSTAT_TIMER_EVENT           (1 << 0)
 #define THERMOSTAT_BUTTON_EVENT          (1 << 1)
 #define DATA_BUFFER_SIZE                 5
+// Measurements are filtered in hundredths of a degree / percent
+#define FILTER_SCALE                     100
 
 // -----------------------------------------------------------------------------
 // Enum
@@ -92,11 +95,9 @@ static float upper_threshold;
 static float setpoint;
 static float hysteresis;
 static mode_t mode;
-// Buffer to store measurement data.
-static float temperature_buffer[DATA_BUFFER_SIZE];
-static float humidity_buffer[DATA_BUFFER_SIZE];
-static uint32_t samples_counter;
-static bool buffer_full = false;
+// Last DATA_BUFFER_SIZE measurements, without the lowest and greatest
+static sample_filter_t temperature_filter;
+static sample_filter_t humidity_filter;
 
 // temperature result from the SHTC3.
 static float temperature;
@@ -118,7 +119,7 @@ static int16_t thermostat_app_get_temperature(void);
 static uint16_t thermostat_app_get_humidity(void);
 static uint8_t thermostat_app_get_threshold_alarm_status(void);
 static void thermostat_output_control(output_control_t output_control);
-static float thermostat_calculate_average(float *data);
+static int32_t thermostat_to_fixed(float value);
 static void buzzer_activate(void);
 static void buzzer_deactivate(void);
 
@@ -127,8 +128,21 @@ static void buzzer_deactivate(void);
  ******************************************************************************/
 void thermostat_app_init(void)
 {
+  sl_status_t sc;
+
   oled_app_init();
 
+  sc = sample_filter_init(&temperature_filter,
+                          SAMPLE_FILTER_TRIMMED_MEAN,
+                          DATA_BUFFER_SIZE,
+                          0);
+  app_assert_status(sc);
+  sc = sample_filter_init(&humidity_filter,
+                          SAMPLE_FILTER_TRIMMED_MEAN,
+                          DATA_BUFFER_SIZE,
+                          0);
+  app_assert_status(sc);
+
   // Load configuration from NVM
   user_config_nvm3_init();
 
@@ -456,42 +470,18 @@ void thermostat_process_evt_external_signal(uint32_t extsignals)
 
 /***************************************************************************//**
  * @brief
- *  This function processes the measured values.
- *  Filters the lowest and greatest values, and calculates an average.
+ *  Convert a measured value to the fixed-point format of the filters.
  *
- * @param[in] data
- *  Pointer to data storage structure
+ * @param[in] value
+ *  Measured value
  *
  * @return
- *  Returns sample filtered.
+ *  Value in hundredths, rounded.
  ******************************************************************************/
-static float thermostat_calculate_average(float *data)
+static int32_t thermostat_to_fixed(float value)
 {
-  float sum = 0;
-  float min, max;
-  uint8_t i, max_count;
-
-  // Calculate average value
-  min = max = data[0];
-  max_count = buffer_full ? DATA_BUFFER_SIZE:samples_counter;
-  for (i = 0; i < max_count; i++) {
-    sum += data[i];
-    if (data[i] > max) {
-      max = data[i];
-    }
-
-    if (data[i] < min) {
-      min = data[i];
-    }
-  }
-
-  // Exclude  min. and max. values
-  if (i > 2) {
-    i -= 2;
-    sum = sum - (min + max);
-  }
-
-  return (float) (sum / i);
+  value *= FILTER_SCALE;
+  return (int32_t)((value < 0) ? (value - 0.5f) : (value + 0.5f));
 }
 
 /***************************************************************************//**
@@ -534,13 +524,10 @@ static void thermostat_timer_event_handler(void)
            measurement_value.humidity);
   }
 
-  uint8_t index = samples_counter % DATA_BUFFER_SIZE;
-  temperature_buffer[index] = measurement_value.temperature;
-  humidity_buffer[index] = measurement_value.humidity;
-  samples_counter++;
-  if (samples_counter >= DATA_BUFFER_SIZE) {
-    buffer_full = true;
-  }
+  sample_filter_push(&temperature_filter,
+                     thermostat_to_fixed(measurement_value.temperature));
+  sample_filter_push(&humidity_filter,
+                     thermostat_to_fixed(measurement_value.humidity));
 
   thermostat_data_process();
 
@@ -549,8 +536,8 @@ static void thermostat_timer_event_handler(void)
 
 static void thermostat_data_process(void)
 {
-  temperature = thermostat_calculate_average(temperature_buffer);
-  humidity = thermostat_calculate_average(humidity_buffer);
+  temperature = (float)sample_filter_get(&temperature_filter) / FILTER_SCALE;
+  humidity = (float)sample_filter_get(&humidity_filter) / FILTER_SCALE;
 
   printf(">> Average Temp: %.2f °C Average RH: %.2f %%\n", temperature,
          humidity);
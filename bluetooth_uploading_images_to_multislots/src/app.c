@@ -33,7 +33,10 @@
  * maintained and there may be no bug maintenance planned for these resources.
  * Silicon Labs may update projects from time to time.
  ******************************************************************************/
+#include <string.h>
+#include "em_device.h"
 #include "sl_common.h"
+#include "sl_sleeptimer.h"
 #include "gatt_db.h"
 #include "sl_bluetooth.h"
 #include "app_assert.h"
@@ -54,6 +57,11 @@ typedef enum {
 #define MULTISLOTS_OTA_DFU_COMMIT       0x03
 #define MAX_SLOT_ID                     0xFFFFFFFF
 
+// Slot pages are erased just ahead of the write position,
+// this limits the number of pages that can be tracked.
+#define SLOT_MAX_PAGES                  1024
+#define SLOT_READ_BLOCK_SIZE            256
+
 static uint32_t ota_dfu_offset;
 static uint32_t ota_dfu_slot_id = MAX_SLOT_ID;
 static uint8_t connection = 0;
@@ -61,9 +69,21 @@ static sl_status_t sc;
 // The advertising set handle allocated from Bluetooth stack.
 static uint8_t advertising_set_handle = 0xff;
 
+static BootloaderStorageSlot_t ota_dfu_slot;
+static uint32_t ota_dfu_start_tick;
+static bool ota_dfu_first_write_done;
+
+// Slot pages known to be blank, one bit per page
+static uint8_t slot_blank_pages[SLOT_MAX_PAGES / 8];
+static uint32_t slot_page_size;
+static uint32_t slot_num_pages;
+
 OTAErrorCodes_t multislot_ota_dfu_transaction_begin();
 OTAErrorCodes_t multislot_ota_dfu_transaction_finish();
 OTAErrorCodes_t multislot_ota_dfu_data_received(uint8_t len, uint8_t *data);
+static int32_t slot_prepare_range(uint32_t offset, uint32_t len);
+static int32_t slot_prepare_page(uint32_t page);
+static uint32_t ota_dfu_elapsed_ms(void);
 
 /**************************************************************************//**
  * Application Init.
@@ -259,6 +279,7 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
 OTAErrorCodes_t multislot_ota_dfu_transaction_begin()
 {
   int32_t rv;
+  BootloaderStorageInformation_t storage_info;
 
   ota_dfu_slot_id = 0x00000000;
 
@@ -271,17 +292,49 @@ OTAErrorCodes_t multislot_ota_dfu_transaction_begin()
   app_assert_status(sc);
 
   ota_dfu_offset = 0;
+  ota_dfu_start_tick = sl_sleeptimer_get_tick_count();
+  ota_dfu_first_write_done = false;
 
-  // erasing slot. This may take several seconds!!!
-  rv = bootloader_eraseStorageSlot(ota_dfu_slot_id);
+  rv = bootloader_getStorageSlotInfo(ota_dfu_slot_id, &ota_dfu_slot);
+  if ((BOOTLOADER_OK != rv) || (0 == ota_dfu_slot.length)) {
+    // No data is accepted until a valid slot is selected
+    ota_dfu_slot_id = MAX_SLOT_ID;
+    return OTA_SlotError;
+  }
 
-  return (BOOTLOADER_OK == rv) ? OTA_NoError : OTA_EraseError;
+  bootloader_getStorageInfo(&storage_info);
+  if ((storage_info.info != NULL) && (storage_info.info->pageSize != 0)) {
+    slot_page_size = storage_info.info->pageSize;
+  } else {
+    slot_page_size = FLASH_PAGE_SIZE;
+  }
+  slot_num_pages = (ota_dfu_slot.length + slot_page_size - 1) / slot_page_size;
+  app_log("slot %lu: %lu bytes, %lu pages.\n",
+          ota_dfu_slot_id,
+          ota_dfu_slot.length,
+          slot_num_pages);
+
+  if (slot_num_pages > SLOT_MAX_PAGES) {
+    // Too many pages to track, erasing slot. This may take several seconds!!!
+    rv = bootloader_eraseStorageSlot(ota_dfu_slot_id);
+    if (BOOTLOADER_OK != rv) {
+      ota_dfu_slot_id = MAX_SLOT_ID;
+      return OTA_EraseError;
+    }
+    return OTA_NoError;
+  }
+  // The slot is erased page by page as the data comes in
+  memset(slot_blank_pages, 0, sizeof(slot_blank_pages));
+  return OTA_NoError;
 }
 
 OTAErrorCodes_t multislot_ota_dfu_transaction_finish()
 {
   int8_t ret = OTA_NoError;
 
+  app_log("upload time %lu ms, %lu bytes.\n",
+          ota_dfu_elapsed_ms(),
+          ota_dfu_offset);
   ota_dfu_slot_id = MAX_SLOT_ID;
 
   return ret;
@@ -290,22 +343,102 @@ OTAErrorCodes_t multislot_ota_dfu_transaction_finish()
 OTAErrorCodes_t multislot_ota_dfu_data_received(uint8_t len, uint8_t *data)
 {
   int32_t rv;
-  BootloaderStorageSlot_t storageSlot;
 
-  rv = bootloader_getStorageSlotInfo(ota_dfu_slot_id, &storageSlot);
-  if (BOOTLOADER_OK != rv) {
+  if (MAX_SLOT_ID == ota_dfu_slot_id) {
     return OTA_SlotError;
   }
 
-  if ((ota_dfu_offset + len) > storageSlot.length) {
+  if ((ota_dfu_offset + len) > ota_dfu_slot.length) {
     return OTA_SizeError;
   }
 
+  if (slot_num_pages <= SLOT_MAX_PAGES) {
+    rv = slot_prepare_range(ota_dfu_offset, len);
+    if (BOOTLOADER_OK != rv) {
+      return OTA_EraseError;
+    }
+  }
+
   rv = bootloader_writeStorage(ota_dfu_slot_id, ota_dfu_offset, data, len);
 
   if (BOOTLOADER_OK == rv) {
+    if (!ota_dfu_first_write_done) {
+      ota_dfu_first_write_done = true;
+      app_log("first data written %lu ms after start.\n",
+              ota_dfu_elapsed_ms());
+    }
     ota_dfu_offset += len;
     return OTA_NoError;
   }
   return OTA_WriteError;
 }
+
+/* Make sure that the pages of the range, and the one after it, are blank */
+static int32_t slot_prepare_range(uint32_t offset, uint32_t len)
+{
+  uint32_t page;
+  uint32_t last_page;
+  int32_t rv = BOOTLOADER_OK;
+
+  if ((0 == slot_page_size) || (0 == slot_num_pages)) {
+    return BOOTLOADER_ERROR_STORAGE_INVALID_SLOT;
+  }
+  if (0 == len) {
+    return BOOTLOADER_OK;
+  }
+  page = offset / slot_page_size;
+  last_page = (offset + len - 1) / slot_page_size + 1;
+  if (last_page >= slot_num_pages) {
+    last_page = slot_num_pages - 1;
+  }
+  for (; (page <= last_page) && (BOOTLOADER_OK == rv); page++) {
+    rv = slot_prepare_page(page);
+  }
+  return rv;
+}
+
+static int32_t slot_prepare_page(uint32_t page)
+{
+  uint32_t offset = page * slot_page_size;
+  uint32_t end = offset + slot_page_size;
+  uint8_t buffer[SLOT_READ_BLOCK_SIZE];
+  bool dirty = false;
+  int32_t rv = BOOTLOADER_OK;
+  uint32_t i;
+
+  if (slot_blank_pages[page / 8] & (1 << (page % 8))) {
+    return BOOTLOADER_OK;
+  }
+  // Reading is much faster than erasing, erase only if needed
+  while (!dirty && (offset < end) && (BOOTLOADER_OK == rv)) {
+    rv = bootloader_readStorage(ota_dfu_slot_id,
+                                offset,
+                                buffer,
+                                SLOT_READ_BLOCK_SIZE);
+    if (BOOTLOADER_OK != rv) {
+      break;
+    }
+    for (i = 0; i < SLOT_READ_BLOCK_SIZE; i++) {
+      if (buffer[i] != 0xFF) {
+        dirty = true;
+        break;
+      }
+    }
+    offset += SLOT_READ_BLOCK_SIZE;
+  }
+  if ((BOOTLOADER_OK == rv) && dirty) {
+    rv = bootloader_eraseRawStorage(ota_dfu_slot.address
+                                    + page * slot_page_size,
+                                    slot_page_size);
+  }
+  if (BOOTLOADER_OK == rv) {
+    slot_blank_pages[page / 8] |= 1 << (page % 8);
+  }
+  return rv;
+}
+
+static uint32_t ota_dfu_elapsed_ms(void)
+{
+  return sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count()
+                                  - ota_dfu_start_tick);
+}